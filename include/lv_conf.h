@@ -20,8 +20,26 @@
 // ============================================
 // MEMÓRIA
 // ============================================
-#define LV_MEM_CUSTOM 0
-#define LV_MEM_SIZE (64U * 1024U)  // 64KB
+// Heap do LVGL = heap do sistema, contado no MemoryBudget (concessão
+// MEM_LVGL_HEAP): sem pool fixo de 64 KB, a tela do QR Code apagada devolve
+// a memória (funções em src/display/main.cpp)
+#define LV_MEM_CUSTOM 1
+#if LV_MEM_CUSTOM
+  #include <stddef.h>
+  #define LV_MEM_CUSTOM_INCLUDE <stddef.h>
+  #ifdef __cplusplus
+  extern "C" {
+  #endif
+  void* lvgl_lease_alloc(size_t size);
+  void lvgl_lease_free(void* ptr);
+  void* lvgl_lease_realloc(void* ptr, size_t size);
+  #ifdef __cplusplus
+  }
+  #endif
+  #define LV_MEM_CUSTOM_ALLOC lvgl_lease_alloc
+  #define LV_MEM_CUSTOM_FREE lvgl_lease_free
+  #define LV_MEM_CUSTOM_REALLOC lvgl_lease_realloc
+#endif
 
 // ============================================
 // DISPLAY (PORTRAIT 240x320)
@@ -113,7 +131,12 @@
 #define LV_USE_ASSERT_MEM_INTEGRITY 0
 #define LV_USE_ASSERT_OBJ 0
 
-#define LV_TICK_CUSTOM 0
+// Relógio do LVGL = esp_timer (sem lv_tick_inc(); ver src/display/LvglTask.h)
+#define LV_TICK_CUSTOM 1
+#if LV_TICK_CUSTOM
+  #define LV_TICK_CUSTOM_INCLUDE "esp_timer.h"
+  #define LV_TICK_CUSTOM_SYS_TIME_EXPR ((uint32_t)(esp_timer_get_time() / 1000))
+#endif
 #define LV_DISP_DEF_REFR_PERIOD 30
 
 #endif // LV_CONF_H
@@ -0,0 +1,588 @@
+"""
+Converte as imagens de assets/ em arrays RGB565 para o display CYD.
+
+Roda como pre-script do PlatformIO (extra_scripts = pre:scripts/build_assets.py)
+ou direto: python scripts/build_assets.py [--force] [--bundle [arquivo]]
+
+- Lê assets/assets.json (lista de imagens, símbolo C e formato)
+- Gera src/display/generated/<simbolo>.h (só quando o PNG ou o manifesto mudam)
+  e generated/assets_index.h (tabela nome -> ImageAsset usada pelo AssetRegistry)
+- Imprime relatório de tamanho (flash antes/depois e razão de compressão)
+- Gera generated/assets_reference.h: os pixels RGB565 sem compressão de cada
+  imagem, só para o teste nativo (test/test_assetbundle) conferir os
+  decodificadores; o firmware não inclui
+- Fontes suaves: cada assets/fonts/<nome>.vlw vira generated/<Nome>.h (bytes
+  do VLW em PROGMEM, lidos por SmoothText.h); .vlw novo com
+  scripts/ttf_to_vlw.py
+- --bundle: gera o bundle da partição "assets" (padrão .pio/assets.bin)
+- Alvo do PlatformIO: pio run -e display-cyd -t uploadassets
+  (gera o bundle e grava só a partição assets)
+
+Bundle (little-endian, lido por src/display/AssetBundle.h):
+  cabeçalho   "CYDA" | versão u16 | qtd u16 | tamanho u32 | crc32 u32
+              (tamanho e crc32 cobrem tudo depois do cabeçalho)
+  diretório   qtd x { nome[24] | largura u16 | altura u16 | formato u8 |
+              pad[3] | dados u32 | aux u32 }   (offsets a partir do início)
+  blobs       alinhados em 4 bytes; aux = paleta (palette) ou índice de
+              linhas (q565), 0 se não houver
+
+Formatos:
+  rgb565   2 bytes/pixel, bytes já trocados (envio direto com setSwapBytes(false))
+  palette  1 byte/pixel + paleta de até 256 cores RGB565 (só se a imagem tiver
+           no máximo 256 cores após a redução para RGB565)
+  q565     compactado (variante do QOI para RGB565) com índice por linha;
+           decodificado linha a linha no display (ver ImageAsset.h)
+  auto     palette quando couber, senão o menor entre q565 e rgb565
+
+Decodificador PNG em Python puro (8 bits, sem entrelaçamento): não precisa de PIL.
+"""
+
+import json
+import os
+import struct
+import sys
+import zlib
+
+try:
+    Import("env")  # noqa: F821 (definido pelo PlatformIO/SCons)
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+ASSETS_DIR = os.path.join(PROJECT_DIR, "assets")
+FONTS_DIR = os.path.join(ASSETS_DIR, "fonts")
+MANIFEST = os.path.join(ASSETS_DIR, "assets.json")
+OUTPUT_DIR = os.path.join(PROJECT_DIR, "src", "display", "generated")
+SCRIPT = os.path.join(PROJECT_DIR, "scripts", "build_assets.py")
+BUNDLE = os.path.join(PROJECT_DIR, ".pio", "assets.bin")
+PARTITIONS = os.path.join(PROJECT_DIR, "partitions_cyd_assets.csv")
+
+# Tamanho do formato antigo (uint32_t 0x00RRGGBB por pixel), para o relatório
+LEGACY_BYTES_PER_PIXEL = 4
+
+
+# ---------------------------------------------------------------------------
+# PNG
+# ---------------------------------------------------------------------------
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """Retorna (largura, altura, [(r, g, b), ...]). Alfa é composto sobre preto."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s não é PNG" % path)
+
+    pos = 8
+    idat = b""
+    plte = None
+    trns = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"PLTE":
+            plte = chunk
+        elif ctype == b"tRNS":
+            trns = chunk
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError("%s: só PNG de 8 bits sem entrelaçamento" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+
+    pixels = []
+    prev = bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[i] = (line[i] + _paeth(a, b, c)) & 0xFF
+        prev = line
+
+        for x in range(width):
+            p = line[x * channels:(x + 1) * channels]
+            if color == 0:
+                rgb, alpha = (p[0], p[0], p[0]), 255
+            elif color == 2:
+                rgb, alpha = (p[0], p[1], p[2]), 255
+            elif color == 3:
+                rgb = tuple(plte[p[0] * 3:p[0] * 3 + 3])
+                alpha = trns[p[0]] if trns and p[0] < len(trns) else 255
+            elif color == 4:
+                rgb, alpha = (p[0], p[0], p[0]), p[1]
+            else:
+                rgb, alpha = (p[0], p[1], p[2]), p[3]
+            if alpha != 255:
+                rgb = tuple(v * alpha // 255 for v in rgb)
+            pixels.append(rgb)
+    return width, height, pixels
+
+
+# ---------------------------------------------------------------------------
+# Conversão
+# ---------------------------------------------------------------------------
+
+def rgb565(rgb):
+    r, g, b = rgb
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def rgb565_swapped(rgb):
+    value = rgb565(rgb)
+    return ((value & 0xFF) << 8) | (value >> 8)
+
+
+# ---------------------------------------------------------------------------
+# Q565: QOI adaptado para RGB565, estado zerado a cada linha
+#   00iiiiii             INDEX  cache[i] (64 cores recentes)
+#   01rrggbb             DIFF   dr, dg, db em -2..1
+#   10gggggg rrrrbbbb    LUMA   dg em -32..31, dr-dg e db-dg em -8..7
+#   11nnnnnn (n < 62)    RUN    repete a cor anterior n+1 vezes
+#   11111110 hi lo       COR    RGB565 literal
+# ---------------------------------------------------------------------------
+
+Q565_OP_INDEX, Q565_OP_DIFF, Q565_OP_LUMA, Q565_OP_RUN, Q565_OP_RGB = 0x00, 0x40, 0x80, 0xC0, 0xFE
+Q565_MAX_RUN = 62
+
+
+def _split(p):
+    return p >> 11, (p >> 5) & 0x3F, p & 0x1F
+
+
+def _q565_hash(p):
+    r, g, b = _split(p)
+    return (r * 3 + g * 5 + b * 7) & 0x3F
+
+
+def _wrap(value, bits):
+    half = 1 << (bits - 1)
+    return ((value + half) & ((1 << bits) - 1)) - half
+
+
+def q565_encode_row(row):
+    out = bytearray()
+    cache = [0] * 64
+    prev = 0
+    run = 0
+    for p in row:
+        if p == prev:
+            run += 1
+            if run == Q565_MAX_RUN:
+                out.append(Q565_OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(Q565_OP_RUN | (run - 1))
+            run = 0
+
+        h = _q565_hash(p)
+        if cache[h] == p:
+            out.append(Q565_OP_INDEX | h)
+        else:
+            cache[h] = p
+            (r0, g0, b0), (r1, g1, b1) = _split(prev), _split(p)
+            dr, dg, db = _wrap(r1 - r0, 5), _wrap(g1 - g0, 6), _wrap(b1 - b0, 5)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(Q565_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out += bytes((Q565_OP_LUMA | (dg + 32), ((dr - dg + 8) << 4) | (db - dg + 8)))
+            else:
+                out += bytes((Q565_OP_RGB, p >> 8, p & 0xFF))
+        prev = p
+    if run:
+        out.append(Q565_OP_RUN | (run - 1))
+    return bytes(out)
+
+
+def q565_decode_row(data, pos, width):
+    """Referência do decodificador C++ (usada para validar o encoder)."""
+    cache = [0] * 64
+    prev = 0
+    row = []
+    while len(row) < width:
+        op = data[pos]
+        pos += 1
+        if op == Q565_OP_RGB:
+            prev = (data[pos] << 8) | data[pos + 1]
+            pos += 2
+        elif op >= Q565_OP_RUN:
+            row += [prev] * ((op & 0x3F) + 1)
+            continue
+        elif op >= Q565_OP_LUMA:
+            b2 = data[pos]
+            pos += 1
+            dg = (op & 0x3F) - 32
+            r, g, b = _split(prev)
+            prev = (((r + dg + (b2 >> 4) - 8) & 0x1F) << 11) | (((g + dg) & 0x3F) << 5) | \
+                   ((b + dg + (b2 & 0x0F) - 8) & 0x1F)
+        elif op >= Q565_OP_DIFF:
+            r, g, b = _split(prev)
+            prev = (((r + ((op >> 4) & 3) - 2) & 0x1F) << 11) | (((g + ((op >> 2) & 3) - 2) & 0x3F) << 5) | \
+                   ((b + (op & 3) - 2) & 0x1F)
+        else:
+            prev = cache[op]
+            row.append(prev)
+            continue
+        cache[_q565_hash(prev)] = prev
+        row.append(prev)
+    return row
+
+
+def q565_encode(colors, width, height):
+    data = bytearray()
+    rows = []
+    for y in range(height):
+        rows.append(len(data))
+        data += q565_encode_row(colors[y * width:(y + 1) * width])
+    for y in range(height):
+        if q565_decode_row(data, rows[y], width) != colors[y * width:(y + 1) * width]:
+            raise ValueError("Q565: linha %d não confere" % y)
+    return bytes(data), rows
+
+
+def format_array(ctype, name, values, per_line, digits, attrs="PROGMEM"):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join("0x%0*X" % (digits, v) for v in values[i:i + per_line]) + ",")
+    return "static const %s %s[]%s = {\n%s\n};\n" % (ctype, name, " " + attrs if attrs else "", "\n".join(lines))
+
+
+def encode(entry):
+    """Escolhe o formato e codifica a imagem (usado pelo header e pelo bundle)"""
+    src = os.path.join(ASSETS_DIR, entry["file"])
+    wanted = entry.get("format", "auto")
+
+    width, height, pixels = read_png(src)
+    colors = [rgb565_swapped(p) for p in pixels]
+    palette = sorted(set(colors))
+
+    fmt = wanted
+    packed = rows = None
+    if wanted == "palette" and len(palette) > 256:
+        print("⚠️  %s: %d cores (> 256), usando rgb565" % (entry["file"], len(palette)))
+        fmt = "rgb565"
+    elif wanted == "auto" and len(palette) <= 256:
+        fmt = "palette"
+    if fmt in ("auto", "q565"):
+        packed, rows = q565_encode([rgb565(p) for p in pixels], width, height)
+        if fmt == "auto":
+            fmt = "q565" if len(packed) + 4 * height < 2 * width * height else "rgb565"
+    return {"width": width, "height": height, "format": fmt, "colors": colors,
+            "palette": palette, "packed": packed, "rows": rows}
+
+
+def convert(entry):
+    symbol = entry["symbol"]
+    macro = entry.get("macro", symbol.upper())
+    enc = encode(entry)
+    width, height, fmt = enc["width"], enc["height"], enc["format"]
+    colors, palette, packed, rows = enc["colors"], enc["palette"], enc["packed"], enc["rows"]
+
+    guard = "ASSET_%s_H" % macro
+    out = [
+        "// Gerado por scripts/build_assets.py a partir de assets/%s - não editar" % entry["file"],
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        '#include "../ImageAsset.h"',
+        "",
+        "#define %s_WIDTH %d" % (macro, width),
+        "#define %s_HEIGHT %d" % (macro, height),
+        "",
+    ]
+
+    if fmt == "palette":
+        index = {c: i for i, c in enumerate(palette)}
+        out.append(format_array("uint16_t", symbol + "_palette", palette, 12, 4))
+        out.append(format_array("uint8_t", symbol + "_pixels", [index[c] for c in colors], 24, 2))
+        out.append("static const ImageAsset %s = { %d, %d, ASSET_PALETTE8, %s_pixels, %s_palette };"
+                   % (symbol, width, height, symbol, symbol))
+        size = len(colors) + 2 * len(palette)
+    elif fmt == "q565":
+        out.append(format_array("uint8_t", symbol + "_data", list(packed), 24, 2))
+        out.append(format_array("uint32_t", symbol + "_rows", rows, 12, 5))
+        out.append("static const ImageAsset %s = { %d, %d, ASSET_Q565, %s_data, NULL, %s_rows };"
+                   % (symbol, width, height, symbol, symbol))
+        size = len(packed) + 4 * len(rows)
+    else:
+        out.append(format_array("uint16_t", symbol + "_pixels", colors, 16, 4))
+        out.append("static const ImageAsset %s = { %d, %d, ASSET_RGB565, %s_pixels, NULL };"
+                   % (symbol, width, height, symbol))
+        size = 2 * len(colors)
+
+    out += ["", "#endif // %s" % guard, ""]
+    return "\n".join(out), {
+        "file": entry["file"], "size": "%dx%d" % (width, height), "format": fmt,
+        "colors": len(palette), "before": width * height * LEGACY_BYTES_PER_PIXEL, "after": size,
+    }
+
+
+def needs_update(entry, header):
+    if not os.path.exists(header):
+        return True
+    built = os.path.getmtime(header)
+    sources = [os.path.join(ASSETS_DIR, entry["file"]), MANIFEST, SCRIPT]
+    return any(os.path.exists(s) and os.path.getmtime(s) > built for s in sources)
+
+
+def report(rows):
+    print("\n🖼️  Assets (scripts/build_assets.py)")
+    print("  %-22s %-9s %-8s %6s %10s %10s %6s %7s" % (
+        "arquivo", "tamanho", "formato", "cores", "antes", "depois", "razão", "x565"))
+    before = after = 0
+    for r in rows:
+        print("  %-22s %-9s %-8s %6d %10d %10d %5.0f%% %6.2fx" % (
+            r["file"], r["size"], r["format"], r["colors"], r["before"], r["after"],
+            100.0 * r["after"] / r["before"], r["before"] / 2.0 / r["after"]))
+        before += r["before"]
+        after += r["after"]
+    if before:
+        print("  %-22s %-9s %-8s %6s %10d %10d %5.0f%% %6.2fx\n" % (
+            "total", "", "", "", before, after, 100.0 * after / before, before / 2.0 / after))
+
+
+# ---------------------------------------------------------------------------
+# Fontes suaves (VLW)
+# ---------------------------------------------------------------------------
+
+def font_symbol(filename):
+    """DejaVuSans-20.vlw -> DejaVuSans20"""
+    return "".join(c for c in os.path.splitext(filename)[0] if c.isalnum())
+
+
+def build_fonts(force=False):
+    if not os.path.isdir(FONTS_DIR):
+        return
+    for filename in sorted(os.listdir(FONTS_DIR)):
+        if not filename.endswith(".vlw"):
+            continue
+        src = os.path.join(FONTS_DIR, filename)
+        symbol = font_symbol(filename)
+        header = os.path.join(OUTPUT_DIR, symbol + ".h")
+        if not force and os.path.exists(header) and \
+                max(os.path.getmtime(src), os.path.getmtime(SCRIPT)) <= os.path.getmtime(header):
+            continue
+
+        with open(src, "rb") as f:
+            data = f.read()
+        count, version = struct.unpack(">ii", data[:8])
+        guard = "FONT_%s_H" % symbol.upper()
+        text = "\n".join([
+            "// Gerado por scripts/build_assets.py a partir de assets/fonts/%s - não editar" % filename,
+            "#ifndef %s" % guard,
+            "#define %s" % guard,
+            "",
+            "#include <Arduino.h>",
+            "",
+            "#define %s_VLW_SIZE %d" % (symbol.upper(), len(data)),
+            "",
+            format_array("uint8_t", symbol + "_vlw", list(data), 24, 2),
+            "#endif // %s" % guard,
+            "",
+        ])
+        with open(header, "w") as f:
+            f.write(text)
+        print("🔤 %s: %d glifos (VLW v%d), %d bytes -> generated/%s.h" % (
+            filename, count, version, len(data), symbol))
+
+
+# ---------------------------------------------------------------------------
+# Bundle da partição assets
+# ---------------------------------------------------------------------------
+
+BUNDLE_MAGIC = b"CYDA"
+BUNDLE_VERSION = 1
+BUNDLE_HEADER = struct.Struct("<4sHHII")
+BUNDLE_ENTRY = struct.Struct("<24sHHB3xII")
+BUNDLE_FORMATS = {"rgb565": 0, "palette": 1, "q565": 2}   # = ImageAssetFormat
+
+
+def _align4(data):
+    data += b"\0" * (-len(data) % 4)
+
+
+def build_bundle(path=BUNDLE):
+    """Empacota todas as imagens do manifesto num bundle para a partição assets"""
+    with open(MANIFEST) as f:
+        entries = json.load(f)
+
+    directory = b""
+    blobs = bytearray()
+    base = BUNDLE_HEADER.size + BUNDLE_ENTRY.size * len(entries)
+    for entry in entries:
+        name = entry["symbol"].encode()
+        if len(name) > 23:
+            raise ValueError("%s: nome do símbolo passa de 23 caracteres" % entry["symbol"])
+        enc = encode(entry)
+        fmt = enc["format"]
+        if fmt == "palette":
+            index = {c: i for i, c in enumerate(enc["palette"])}
+            main = bytes(index[c] for c in enc["colors"])
+            # Paleta sempre com 256 cores: o firmware valida 512 bytes
+            palette = enc["palette"] + [0] * (256 - len(enc["palette"]))
+            aux = struct.pack("<256H", *palette)
+        elif fmt == "q565":
+            main = enc["packed"]
+            aux = struct.pack("<%dI" % len(enc["rows"]), *enc["rows"])
+        else:
+            main = struct.pack("<%dH" % len(enc["colors"]), *enc["colors"])
+            aux = b""
+
+        main_offset = base + len(blobs)
+        blobs += main
+        _align4(blobs)
+        aux_offset = base + len(blobs) if aux else 0
+        blobs += aux
+        _align4(blobs)
+        directory += BUNDLE_ENTRY.pack(name, enc["width"], enc["height"],
+                                       BUNDLE_FORMATS[fmt], main_offset, aux_offset)
+        print("  %-22s %-8s %8d bytes" % (entry["file"], fmt, len(main) + len(aux)))
+
+    body = directory + bytes(blobs)
+    header = BUNDLE_HEADER.pack(BUNDLE_MAGIC, BUNDLE_VERSION, len(entries), len(body), zlib.crc32(body))
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "wb") as f:
+        f.write(header + body)
+
+    limit = partition_info("assets")
+    print("📦 Bundle: %s (%d bytes%s)" % (path, len(header) + len(body),
+          ", partição de %d" % limit[1] if limit else ""))
+    if limit and len(header) + len(body) > limit[1]:
+        raise ValueError("bundle maior que a partição assets")
+    return path
+
+
+def partition_info(label):
+    """(offset, tamanho) da partição em partitions_cyd_assets.csv"""
+    if not os.path.exists(PARTITIONS):
+        return None
+    with open(PARTITIONS) as f:
+        for line in f:
+            fields = [v.strip() for v in line.split("#")[0].split(",")]
+            if len(fields) >= 5 and fields[0] == label:
+                return int(fields[3], 0), int(fields[4], 0)
+    return None
+
+
+def write_index(entries):
+    """Tabela das imagens compiladas (só reescreve se o manifesto mudou)"""
+    lines = [
+        "// Gerado por scripts/build_assets.py a partir de assets/assets.json - não editar",
+        "#ifndef ASSETS_INDEX_H",
+        "#define ASSETS_INDEX_H",
+        "",
+    ]
+    lines += ['#include "%s.h"' % e["symbol"] for e in entries]
+    lines += ["", "static const BuiltinAsset builtinAssets[] = {"]
+    lines += ['  { "%s", &%s },' % (e["symbol"], e["symbol"]) for e in entries]
+    lines += ["};", "", "#define BUILTIN_ASSET_COUNT %d" % len(entries), "", "#endif // ASSETS_INDEX_H", ""]
+    text = "\n".join(lines)
+
+    path = os.path.join(OUTPUT_DIR, "assets_index.h")
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def write_reference(entries, force=False):
+    """Pixels crus de cada imagem, na ordem de builtinAssets (teste nativo)"""
+    path = os.path.join(OUTPUT_DIR, "assets_reference.h")
+    if not force and not any(needs_update(e, path) for e in entries):
+        return
+    lines = [
+        "// Gerado por scripts/build_assets.py a partir de assets/assets.json - não editar",
+        "// RGB565 sem compressão (bytes trocados): referência de test/test_assetbundle",
+        "#ifndef ASSETS_REFERENCE_H",
+        "#define ASSETS_REFERENCE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    for e in entries:
+        _, _, pixels = read_png(os.path.join(ASSETS_DIR, e["file"]))
+        lines.append(format_array("uint16_t", e["symbol"] + "_reference",
+                                  [rgb565_swapped(p) for p in pixels], 16, 4, attrs=""))
+    lines += ["static const uint16_t* const builtinAssetReference[] = {"]
+    lines += ["  %s_reference," % e["symbol"] for e in entries]
+    lines += ["};", "", "#endif // ASSETS_REFERENCE_H", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def build(force=False):
+    with open(MANIFEST) as f:
+        entries = json.load(f)
+    os.makedirs(OUTPUT_DIR, exist_ok=True)
+
+    rows = []
+    for entry in entries:
+        header = os.path.join(OUTPUT_DIR, entry["symbol"] + ".h")
+        if not force and not needs_update(entry, header):
+            continue
+        text, row = convert(entry)
+        with open(header, "w") as f:
+            f.write(text)
+        rows.append(row)
+    write_index(entries)
+    write_reference(entries, force)
+    if rows:
+        report(rows)
+    build_fonts(force)
+
+
+build(force="--force" in sys.argv)
+
+if "--bundle" in sys.argv:
+    i = sys.argv.index("--bundle")
+    build_bundle(sys.argv[i + 1] if i + 1 < len(sys.argv) else BUNDLE)
+
+try:
+    env  # noqa: F821
+
+    def _upload_assets(target, source, env):
+        offset = partition_info("assets")
+        if offset is None:
+            sys.exit("❌ partitions_cyd_assets.csv sem a partição assets")
+        path = build_bundle()
+        env.AutodetectUploadPort()
+        return env.Execute(" ".join([
+            "$PYTHONEXE", '"$PROJECT_PACKAGES_DIR/tool-esptoolpy/esptool.py"',
+            "--chip", "esp32", "--port", '"$UPLOAD_PORT"', "--baud", "$UPLOAD_SPEED",
+            "write_flash", hex(offset[0]), '"%s"' % path]))
+
+    env.AddCustomTarget(  # noqa: F821
+        name="uploadassets",
+        dependencies=None,
+        actions=[_upload_assets],
+        title="Upload Assets",
+        description="Gera o bundle de imagens e grava só a partição assets")
+except NameError:
+    pass
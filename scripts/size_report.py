@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""
+Compara Flash/RAM estática do display com e sem LVGL (resumo do pio run).
+
+Uso:
+  python scripts/size_report.py
+  python scripts/size_report.py display-cyd display-cyd-lvgl
+
+Compila cada env e lê as linhas "RAM:" e "Flash:" que o PlatformIO imprime
+no fim do build. Sai uma tabela Markdown com a diferença (primeiro env
+menos o segundo), no formato da tabela do ROBOEYES_INTEGRATION.md.
+Requer o PlatformIO (pio) no PATH.
+"""
+
+import re
+import subprocess
+import sys
+
+DEFAULT_ENVS = ("display-cyd", "display-cyd-lvgl")
+
+# RAM:   [==        ]  15.2% (used 49860 bytes from 327680 bytes)
+USAGE = re.compile(r"^(RAM|Flash):.*\(used (\d+) bytes from (\d+) bytes\)", re.M)
+
+
+def build_size(env):
+    result = subprocess.run(["pio", "run", "-e", env], capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout[-2000:] + result.stderr[-2000:])
+        sys.exit(f"❌ pio run -e {env} falhou")
+    sizes = {kind: (int(used), int(total)) for kind, used, total in USAGE.findall(result.stdout)}
+    if set(sizes) != {"RAM", "Flash"}:
+        sys.exit(f"❌ resumo RAM/Flash não encontrado no build de {env}")
+    return sizes
+
+
+def main():
+    envs = sys.argv[1:] if len(sys.argv) > 1 else DEFAULT_ENVS
+    if len(envs) != 2:
+        sys.exit(__doc__)
+    sizes = [build_size(env) for env in envs]
+
+    print(f"| Medida | `{envs[0]}` | `{envs[1]}` | Diferença |")
+    print("|--------|---:|---:|---:|")
+    for kind in ("Flash", "RAM"):
+        new, old = sizes[0][kind][0], sizes[1][kind][0]
+        print(f"| {kind} | {new} B | {old} B | {new - old:+d} B |")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""
+Exporta/importa a base de tags do display CYD pela serial (USB ou link do Reader).
+
+Uso:
+  python scripts/tag_sync.py export COM37 display1.tags
+  python scripts/tag_sync.py import COM37 display1.tags display2.tags
+  python scripts/tag_sync.py csv display1.tags
+
+Arquivo .tags: cabeçalho "TAGX" + versão (u16) + quantidade (u32) seguido de
+registros TagRecord de 24 bytes (mesmo formato do TagStore).
+Protocolo: ver src/common/protocol.h e src/display/TagSync.h.
+Requer pyserial (pip install pyserial).
+"""
+
+import re
+import struct
+import sys
+import time
+import zlib
+
+SYNC_MAGIC = b"\xA5\x5A"
+SYNC_HEADER = struct.Struct("<BIH")     # tipo, indice, qtd (após o magic)
+SYNC_RECORD_SIZE = 24
+SYNC_MAX_RECORDS = 16
+SYNC_CHUNK, SYNC_END, SYNC_ABORT = 1, 2, 3
+ACK_TIMEOUT_S = 2.0
+MAX_RETRIES = 5
+
+FILE_MAGIC = b"TAGX"
+FILE_HEADER = struct.Struct("<4sHI")
+FILE_VERSION = 1
+
+# TagRecord: uid[10], uidLen, epoch, firstSeen, lastSeen, taps, reserved
+RECORD = struct.Struct("<10sBBIIHH")
+
+# Respostas do display: ACK|<n>, NAK|<n> ou ACK|END|<novas>|<mescladas>
+REPLY = re.compile(r"(ACK|NAK)\|\d+|ACK\|END\|\d+\|\d+")
+
+
+def open_port(name):
+    import serial
+    port = serial.Serial(name, 115200, timeout=0.1)
+    time.sleep(0.2)
+    port.reset_input_buffer()
+    return port
+
+
+def send_line(port, line):
+    port.write((line + "\n").encode())
+
+
+def read_frame(port, timeout):
+    """Lê o próximo quadro válido, ignorando logs de texto entre quadros."""
+    deadline = time.time() + timeout
+    buf = b""
+    while time.time() < deadline:
+        buf += port.read(port.in_waiting or 1)
+        start = buf.find(SYNC_MAGIC)
+        if start < 0:
+            buf = buf[-1:]
+            continue
+        buf = buf[start:]
+        if len(buf) < 2 + SYNC_HEADER.size:
+            continue
+        ftype, index, count = SYNC_HEADER.unpack_from(buf, 2)
+        if count > SYNC_MAX_RECORDS:
+            buf = buf[2:]
+            continue
+        size = 2 + SYNC_HEADER.size + count * SYNC_RECORD_SIZE + 4
+        if len(buf) < size:
+            continue
+        body = buf[2:size - 4]
+        (crc,) = struct.unpack_from("<I", buf, size - 4)
+        if zlib.crc32(body) != crc:
+            return ("bad", index, b"")
+        return (ftype, index, body[SYNC_HEADER.size:])
+    return None
+
+
+def read_reply(port, timeout):
+    """Lê a próxima resposta ACK/NAK completa (ignora logs e linhas truncadas)."""
+    deadline = time.time() + timeout
+    line = b""
+    while time.time() < deadline:
+        c = port.read(1)
+        if not c:
+            continue
+        if c != b"\n":
+            line += c
+            continue
+        text = line.decode(errors="ignore").strip()
+        line = b""
+        if REPLY.fullmatch(text):
+            return text.split("|")
+    return None
+
+
+def export_tags(port_name, path):
+    port = open_port(port_name)
+    records = []
+    send_line(port, "CMD|EXPORT|0")
+    retries = 0
+    started = time.time()
+    while True:
+        frame = read_frame(port, ACK_TIMEOUT_S)
+        if frame is None:
+            retries += 1
+            if retries > 2 * MAX_RETRIES:
+                sys.exit("❌ Display não respondeu")
+            # ACK perdido: reconfirma; se o display desistiu, reinicia do ponto atual
+            if retries <= MAX_RETRIES:
+                send_line(port, "ACK|%d" % len(records))
+            else:
+                send_line(port, "CMD|EXPORT|%d" % len(records))
+            continue
+        if frame[0] == "bad":
+            send_line(port, "NAK|%d" % len(records))
+            continue
+        ftype, index, payload = frame
+        if ftype == SYNC_ABORT:
+            sys.exit("❌ Exportação cancelada pelo display (tags apagadas?)")
+        if index != len(records):
+            send_line(port, "NAK|%d" % len(records))
+            continue
+        retries = 0
+        if ftype == SYNC_END:
+            send_line(port, "ACK|%d" % len(records))
+            break
+        for i in range(0, len(payload), SYNC_RECORD_SIZE):
+            records.append(payload[i:i + SYNC_RECORD_SIZE])
+        send_line(port, "ACK|%d" % len(records))
+
+    with open(path, "wb") as f:
+        f.write(FILE_HEADER.pack(FILE_MAGIC, FILE_VERSION, len(records)))
+        f.write(b"".join(records))
+    print("✅ %d tags exportadas para %s (%.1f s)" % (len(records), path, time.time() - started))
+
+
+def load_file(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, count = FILE_HEADER.unpack_from(data)
+    if magic != FILE_MAGIC or version != FILE_VERSION:
+        sys.exit("❌ %s não é um arquivo de tags" % path)
+    body = data[FILE_HEADER.size:FILE_HEADER.size + count * SYNC_RECORD_SIZE]
+    return [body[i:i + SYNC_RECORD_SIZE] for i in range(0, len(body), SYNC_RECORD_SIZE)]
+
+
+def send_frame(port, ftype, index, records):
+    body = SYNC_HEADER.pack(ftype, index, len(records)) + b"".join(records)
+    port.write(SYNC_MAGIC + body + struct.pack("<I", zlib.crc32(body)))
+
+
+def import_tags(port_name, path):
+    records = load_file(path)
+    port = open_port(port_name)
+    transfer_id = zlib.crc32(b"".join(records)) or 1
+    started = time.time()
+
+    send_line(port, "CMD|IMPORT|%d|%d" % (len(records), transfer_id))
+    reply = read_reply(port, ACK_TIMEOUT_S)
+    if reply is None or reply[0] != "ACK":
+        sys.exit("❌ Display não aceitou a importação")
+    next_index = int(reply[1])
+    if next_index:
+        print("↪️  Retomando importação a partir da tag %d" % next_index)
+
+    retries = 0
+    while True:
+        if next_index >= len(records):
+            send_frame(port, SYNC_END, len(records), [])
+        else:
+            send_frame(port, SYNC_CHUNK, next_index,
+                       records[next_index:next_index + SYNC_MAX_RECORDS])
+        reply = read_reply(port, ACK_TIMEOUT_S)
+        if reply is None:
+            retries += 1
+            if retries > MAX_RETRIES:
+                sys.exit("❌ Display não respondeu (rode de novo para retomar)")
+            continue
+        retries = 0
+        if reply[0] == "ACK" and reply[1] == "END":
+            print("✅ %s: %s tags novas, %s mescladas (%.1f s)"
+                  % (path, reply[2], reply[3], time.time() - started))
+            return
+        next_index = int(reply[1])
+
+
+def dump_csv(path):
+    print("uid,primeira,ultima,toques")
+    for raw in load_file(path):
+        uid, uid_len, _epoch, first, last, taps, _ = RECORD.unpack(raw)
+        print("%s,%d,%d,%d" % (uid[:uid_len].hex().upper(), first, last, taps))
+
+
+def main():
+    if len(sys.argv) >= 4 and sys.argv[1] == "export":
+        export_tags(sys.argv[2], sys.argv[3])
+    elif len(sys.argv) >= 4 and sys.argv[1] == "import":
+        for path in sys.argv[3:]:
+            import_tags(sys.argv[2], path)
+    elif len(sys.argv) == 3 and sys.argv[1] == "csv":
+        dump_csv(sys.argv[2])
+    else:
+        sys.exit(__doc__)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,365 @@
+"""
+Gera uma fonte suave VLW (formato do Processing / TFT_eSPI) a partir de um TTF.
+
+Uso: python scripts/ttf_to_vlw.py fonte.ttf tamanho saida.vlw [--chars latin1|ascii]
+
+- Rasterizador TrueType em Python puro (glyf/loca/cmap 4, glifos compostos,
+  curvas quadráticas): não precisa de PIL nem de freetype
+- Anti-aliasing: 16 sub-linhas por pixel, cobertura horizontal exata
+- Conjunto padrão: ASCII imprimível + Latin-1 (acentos do português: ã, õ, ç,
+  á, ê, ...), em ordem de código (a busca no display é binária)
+
+O .vlw gerado vai para assets/fonts/ e scripts/build_assets.py o compila em
+src/display/generated/ (lido por src/display/SmoothText.h).
+
+VLW (big-endian, int32):
+  cabeçalho   qtd | versão (11) | tamanho | 0 | ascent | descent
+  glifos      qtd x { unicode | altura | largura | avanço | topo | esquerda | 0 }
+              (topo: pixels acima da linha de base; esquerda: deslocamento x)
+  bitmaps     alfa de 8 bits, largura x altura por glifo, na ordem dos glifos
+  rodapé      nome e nome PostScript (UTF do Java), suave (1 byte)
+"""
+
+import math
+import os
+import struct
+import sys
+
+CHARSETS = {
+    "ascii": list(range(0x20, 0x7F)),
+    "latin1": list(range(0x20, 0x7F)) + list(range(0xA0, 0x100)),
+}
+
+SUBSAMPLES = 16        # sub-linhas por pixel
+CURVE_STEPS = 8        # segmentos por curva quadrática
+VLW_VERSION = 11
+
+
+# ---------------------------------------------------------------------------
+# TrueType
+# ---------------------------------------------------------------------------
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num_tables = struct.unpack(">H", self.data[4:6])[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack(">4sIII", self.data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode("latin-1")] = (offset, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em = self._u16(head + 18)
+        self.long_loca = self._i16(head + 50) == 1
+        hhea = self.tables["hhea"][0]
+        self.ascender = self._i16(hhea + 4)
+        self.descender = self._i16(hhea + 6)
+        self.num_hmetrics = self._u16(hhea + 34)
+        self.num_glyphs = self._u16(self.tables["maxp"][0] + 4)
+        self.cmap = self._read_cmap()
+
+        name = self._read_name(4) or os.path.splitext(os.path.basename(path))[0]
+        self.full_name = name
+        self.ps_name = self._read_name(6) or name.replace(" ", "")
+
+    def _u16(self, pos):
+        return struct.unpack(">H", self.data[pos:pos + 2])[0]
+
+    def _i16(self, pos):
+        return struct.unpack(">h", self.data[pos:pos + 2])[0]
+
+    def _u32(self, pos):
+        return struct.unpack(">I", self.data[pos:pos + 4])[0]
+
+    def _read_cmap(self):
+        base = self.tables["cmap"][0]
+        count = self._u16(base + 2)
+        sub = None
+        for i in range(count):
+            platform, encoding, offset = struct.unpack(">HHI", self.data[base + 4 + 8 * i:base + 12 + 8 * i])
+            if self._u16(base + offset) == 4 and (platform, encoding) in ((3, 1), (0, 3), (0, 4)):
+                sub = base + offset
+                break
+        if sub is None:
+            raise ValueError("TTF sem cmap formato 4 (Unicode BMP)")
+
+        seg_count = self._u16(sub + 6) // 2
+        ends = sub + 14
+        starts = ends + 2 * seg_count + 2
+        deltas = starts + 2 * seg_count
+        ranges = deltas + 2 * seg_count
+        cmap = {}
+        for i in range(seg_count):
+            start, end = self._u16(starts + 2 * i), self._u16(ends + 2 * i)
+            delta, range_offset = self._i16(deltas + 2 * i), self._u16(ranges + 2 * i)
+            for code in range(start, end + 1):
+                if code == 0xFFFF:
+                    continue
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    glyph = self._u16(ranges + 2 * i + range_offset + 2 * (code - start))
+                    if glyph:
+                        glyph = (glyph + delta) & 0xFFFF
+                if glyph:
+                    cmap[code] = glyph
+        return cmap
+
+    def _read_name(self, name_id):
+        if "name" not in self.tables:
+            return None
+        base = self.tables["name"][0]
+        count, strings = self._u16(base + 2), base + self._u16(base + 4)
+        for i in range(count):
+            platform, encoding, _, nid, length, offset = struct.unpack(
+                ">HHHHHH", self.data[base + 6 + 12 * i:base + 18 + 12 * i])
+            if nid == name_id and platform == 3 and encoding == 1:
+                return self.data[strings + offset:strings + offset + length].decode("utf-16-be")
+        return None
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        index = min(glyph, self.num_hmetrics - 1)
+        return self._u16(hmtx + 4 * index)
+
+    def _glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = self._u32(loca + 4 * glyph), self._u32(loca + 4 * glyph + 4)
+        else:
+            start, end = 2 * self._u16(loca + 2 * glyph), 2 * self._u16(loca + 2 * glyph + 2)
+        return self.tables["glyf"][0] + start, end - start
+
+    def contours(self, glyph, depth=0):
+        """Contornos do glifo: listas de (x, y, on_curve) em unidades da fonte"""
+        pos, length = self._glyph_range(glyph)
+        if length == 0:
+            return []
+        n = self._i16(pos)
+        if n >= 0:
+            return self._simple(pos, n)
+        if depth > 8:
+            raise ValueError("glifo composto recursivo demais")
+        return self._composite(pos, depth)
+
+    def _simple(self, pos, n):
+        ends = [self._u16(pos + 10 + 2 * i) for i in range(n)]
+        count = ends[-1] + 1 if ends else 0
+        p = pos + 10 + 2 * n
+        p += 2 + self._u16(p)           # instruções
+
+        flags = []
+        while len(flags) < count:
+            flag = self.data[p]
+            p += 1
+            flags.append(flag)
+            if flag & 0x08:
+                repeat = self.data[p]
+                p += 1
+                flags += [flag] * repeat
+
+        def coords(short_bit, same_bit):
+            nonlocal p
+            values, value = [], 0
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self.data[p]
+                    p += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += self._i16(p)
+                    p += 2
+                values.append(value)
+            return values
+
+        xs = coords(0x02, 0x10)
+        ys = coords(0x04, 0x20)
+        contours, start = [], 0
+        for end in ends:
+            contours.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(start, end + 1)])
+            start = end + 1
+        return contours
+
+    def _composite(self, pos, depth):
+        p = pos + 10
+        contours = []
+        while True:
+            flags, glyph = struct.unpack(">HH", self.data[p:p + 4])
+            p += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack(">hh", self.data[p:p + 4])
+                p += 4
+            else:
+                dx, dy = struct.unpack(">bb", self.data[p:p + 2])
+                p += 2
+            if not flags & 0x0002:
+                dx = dy = 0             # casamento de pontos: raro, ignorado
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = d = self._i16(p) / 16384.0
+                p += 2
+            elif flags & 0x0040:
+                a, d = self._i16(p) / 16384.0, self._i16(p + 2) / 16384.0
+                p += 4
+            elif flags & 0x0080:
+                a, b, c, d = (self._i16(p + 2 * i) / 16384.0 for i in range(4))
+                p += 8
+            for contour in self.contours(glyph, depth + 1):
+                contours.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+            if not flags & 0x0020:
+                return contours
+
+
+# ---------------------------------------------------------------------------
+# Rasterização
+# ---------------------------------------------------------------------------
+
+def flatten(contour, scale):
+    """Contorno TrueType → polígono em pixels (y para cima)"""
+    pts = [(x * scale, y * scale, on) for x, y, on in contour]
+    if not pts:
+        return []
+    # Começa num ponto na curva (ou no meio de dois de controle)
+    start = next((i for i, p in enumerate(pts) if p[2]), None)
+    if start is None:
+        a, b = pts[0], pts[1]
+        pts.insert(0, ((a[0] + b[0]) / 2, (a[1] + b[1]) / 2, True))
+        start = 0
+    pts = pts[start:] + pts[:start]
+
+    poly = [(pts[0][0], pts[0][1])]
+    control = None
+    for x, y, on in pts[1:] + [pts[0]]:
+        if on:
+            if control is None:
+                poly.append((x, y))
+            else:
+                poly += quad(poly[-1], control, (x, y))
+                control = None
+        else:
+            if control is not None:
+                mid = ((control[0] + x) / 2, (control[1] + y) / 2)
+                poly += quad(poly[-1], control, mid)
+            control = (x, y)
+    return poly
+
+
+def quad(p0, p1, p2):
+    out = []
+    for i in range(1, CURVE_STEPS + 1):
+        t = i / CURVE_STEPS
+        u = 1 - t
+        out.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                    u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return out
+
+
+def rasterize(polys):
+    """Alfa (bytes), largura, altura, topo, esquerda; regra de enrolamento não-zero"""
+    points = [p for poly in polys for p in poly]
+    if not points:
+        return b"", 0, 0, 0, 0
+    left = int(math.floor(min(p[0] for p in points)))
+    right = int(math.ceil(max(p[0] for p in points)))
+    bottom = int(math.floor(min(p[1] for p in points)))
+    top = int(math.ceil(max(p[1] for p in points)))
+    width, height = right - left, top - bottom
+
+    edges = []
+    for poly in polys:
+        for i in range(len(poly)):
+            (x0, y0), (x1, y1) = poly[i], poly[(i + 1) % len(poly)]
+            if y0 != y1:
+                edges.append((x0 - left, y0, x1 - left, y1))
+
+    alpha = bytearray(width * height)
+    for row in range(height):
+        cover = [0.0] * (width + 1)
+        for sub in range(SUBSAMPLES):
+            y = top - row - (sub + 0.5) / SUBSAMPLES
+            crossings = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= y < y1) or (y1 <= y < y0):
+                    crossings.append((x0 + (y - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+            crossings.sort()
+            winding = 0
+            for i, (x, direction) in enumerate(crossings):
+                before = winding
+                winding += direction
+                if before == 0 and winding != 0:
+                    span_start = x
+                elif before != 0 and winding == 0:
+                    add_span(cover, span_start, x, width)
+        for col in range(width):
+            alpha[row * width + col] = min(255, int(round(cover[col] * 255 / SUBSAMPLES)))
+    return bytes(alpha), width, height, top, left
+
+
+def add_span(cover, xa, xb, width):
+    xa, xb = max(0.0, xa), min(float(width), xb)
+    if xb <= xa:
+        return
+    first, last = int(xa), int(xb)
+    if first == last:
+        cover[first] += xb - xa
+        return
+    cover[first] += first + 1 - xa
+    for col in range(first + 1, last):
+        cover[col] += 1.0
+    if last < width:
+        cover[last] += xb - last
+
+
+# ---------------------------------------------------------------------------
+# VLW
+# ---------------------------------------------------------------------------
+
+def java_utf(text):
+    data = text.encode("utf-8")
+    return struct.pack(">H", len(data)) + data
+
+
+def build_vlw(font, size, codes):
+    scale = size / font.units_per_em
+    glyphs = []
+    for code in sorted(set(codes)):
+        glyph = font.cmap.get(code)
+        if glyph is None:
+            print("⚠️  U+%04X sem glifo na fonte, ignorado" % code)
+            continue
+        polys = [flatten(c, scale) for c in font.contours(glyph)]
+        bitmap, width, height, top, left = rasterize([p for p in polys if len(p) > 2])
+        glyphs.append((code, height, width, int(round(font.advance(glyph) * scale)), top, left, bitmap))
+
+    ascent = int(round(font.ascender * scale))
+    descent = int(round(-font.descender * scale))
+    out = bytearray(struct.pack(">6i", len(glyphs), VLW_VERSION, size, 0, ascent, descent))
+    for code, height, width, advance, top, left, _ in glyphs:
+        out += struct.pack(">7i", code, height, width, advance, top, left, 0)
+    for glyph in glyphs:
+        out += glyph[6]
+    out += java_utf("%s-%d" % (font.full_name, size)) + java_utf(font.ps_name) + b"\x01"
+    return bytes(out), len(glyphs)
+
+
+def main(argv):
+    charset = "latin1"
+    if "--chars" in argv:
+        i = argv.index("--chars")
+        charset = argv[i + 1] if i + 1 < len(argv) else ""
+        argv = argv[:i] + argv[i + 2:]
+    if len(argv) != 3 or charset not in CHARSETS:
+        sys.exit(__doc__)
+    ttf, size, output = argv[0], int(argv[1]), argv[2]
+
+    font = TrueType(ttf)
+    data, count = build_vlw(font, size, CHARSETS[charset])
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+    with open(output, "wb") as f:
+        f.write(data)
+    print("🔤 %s: %d glifos, %d px, %d bytes" % (output, count, size, len(data)))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
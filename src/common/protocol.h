@@ -14,6 +14,35 @@
 #define MSG_ERROR   "ERROR"
 #define MSG_CMD     "CMD"
 #define MSG_ACK     "ACK"
+#define MSG_NAK     "NAK"
+
+// Comandos (CMD|<comando>|...)
+#define CMD_EXPORT  "EXPORT"   // CMD|EXPORT|<indice_inicial>
+#define CMD_IMPORT  "IMPORT"   // CMD|IMPORT|<total_registros>|<id_transferencia>
+
+// ============================================
+// QUADROS BINÁRIOS DE SINCRONIZAÇÃO DE TAGS
+// Usados por CMD|EXPORT e CMD|IMPORT (ver src/display/TagSync.h)
+//
+// Quadro (little endian):
+//   0xA5 0x5A | tipo (1) | indice (4) | qtd (2) | qtd * 24 bytes | crc32 (4)
+// O CRC32 (mesmo do zlib) cobre tipo, indice, qtd e registros.
+// O receptor responde em texto: ACK|<proximo_indice> ou NAK|<proximo_indice>
+// ============================================
+
+#define SYNC_MAGIC_0        0xA5
+#define SYNC_MAGIC_1        0x5A
+#define SYNC_HEADER_SIZE    9      // magic + tipo + indice + qtd
+#define SYNC_RECORD_SIZE    24     // sizeof(TagRecord)
+#define SYNC_MAX_RECORDS    16     // registros por quadro
+#define SYNC_ACK_TIMEOUT_MS 2000   // reenvia quadro sem resposta
+#define SYNC_MAX_RETRIES    5
+
+enum SyncFrameType {
+  SYNC_CHUNK = 1,   // registros a partir de indice
+  SYNC_END   = 2,   // fim da transferência (indice = total)
+  SYNC_ABORT = 3    // transferência cancelada pelo emissor
+};
 
 // Tipos de conteúdo NDEF
 enum ContentType {
@@ -128,7 +157,8 @@ public:
             type == MSG_STATUS || 
             type == MSG_ERROR || 
             type == MSG_CMD || 
-            type == MSG_ACK);
+            type == MSG_ACK ||
+            type == MSG_NAK);
   }
 };
 
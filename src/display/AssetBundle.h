@@ -0,0 +1,179 @@
+/**
+ * Bundle de imagens na partição "assets" (partitions_cyd_assets.csv)
+ *
+ * Gerado por scripts/build_assets.py --bundle e gravado só na partição
+ * (pio run -e display-cyd -t uploadassets): trocar uma arte não exige
+ * regravar o firmware.
+ *
+ * A partição é mapeada com esp_partition_mmap: find() devolve um
+ * ImageAsset cujos ponteiros apontam direto para a flash mapeada
+ * (sem cópia para a RAM), desenhado normalmente com drawImageAsset().
+ *
+ * Formato (little-endian, mesmo de build_assets.py):
+ *   cabeçalho   "CYDA" | versão u16 | qtd u16 | tamanho u32 | crc32 u32
+ *   diretório   qtd x { nome[24] | largura u16 | altura u16 | formato u8 |
+ *               pad[3] | dados u32 | aux u32 }
+ *   blobs       offsets a partir do início do bundle, alinhados em 4
+ */
+
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include "ImageAsset.h"
+
+#define ASSET_BUNDLE_MAGIC "CYDA"
+#define ASSET_BUNDLE_VERSION 1
+#define ASSET_BUNDLE_NAME_LEN 24
+
+// Subtipo da partição de dados (ver partitions_cyd_assets.csv)
+#ifndef ASSET_PARTITION_SUBTYPE
+  #define ASSET_PARTITION_SUBTYPE 0x40
+#endif
+
+class AssetBundle {
+private:
+    struct __attribute__((packed)) Header {
+        char magic[4];
+        uint16_t version;
+        uint16_t count;
+        uint32_t size;      // bytes depois do cabeçalho
+        uint32_t crc;       // CRC32 desses bytes
+    };
+
+    struct __attribute__((packed)) Entry {
+        char name[ASSET_BUNDLE_NAME_LEN];
+        uint16_t width;
+        uint16_t height;
+        uint8_t format;
+        uint8_t pad[3];
+        uint32_t data;
+        uint32_t aux;
+    };
+
+    const uint8_t* base = NULL;
+    const Entry* entries = NULL;
+    uint16_t entryCount = 0;
+    uint32_t bundleSize = 0;
+    spi_flash_mmap_handle_t mapHandle;
+
+    bool inside(uint32_t offset, uint64_t size) const {
+        return offset >= sizeof(Header) && offset + size <= bundleSize;
+    }
+
+    /**
+     * Tudo que drawImageAsset() vai ler precisa estar dentro do bundle:
+     * pixels, paleta inteira (256 cores, qualquer índice) e, no Q565,
+     * cada linha decodificada a partir do seu offset
+     */
+    bool valid(const Entry& e) const {
+        if (e.format > ASSET_Q565 || e.width == 0 || e.height == 0) return false;
+        uint64_t pixels = (uint64_t)e.width * e.height;
+
+        if (e.format == ASSET_RGB565) return inside(e.data, pixels * 2);
+        if (e.format == ASSET_PALETTE8) {
+            return inside(e.data, pixels) && inside(e.aux, 256 * sizeof(uint16_t)) && !(e.aux & 1);
+        }
+
+        if (!inside(e.data, 1) || !inside(e.aux, (uint64_t)e.height * 4) || (e.aux & 3)) return false;
+        const uint32_t* rows = (const uint32_t*)(base + e.aux);
+        for (uint16_t y = 0; y < e.height; y++) {
+            if (rows[y] >= bundleSize - e.data) return false;
+            uint32_t avail = bundleSize - e.data - rows[y];
+            if (Q565Decoder::rowLength(base + e.data + rows[y], avail, e.width) == 0) return false;
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Mapeia a partição e valida cabeçalho, CRC e diretório.
+     * Retorna false (e find() sempre falha) se não houver bundle válido.
+     */
+    bool begin(const char* label = "assets") {
+        const esp_partition_t* partition = esp_partition_find_first(
+            ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, label);
+        if (partition == NULL) {
+            Serial.println("📦 Partição assets não encontrada (usando imagens do firmware)");
+            return false;
+        }
+
+        Header header;
+        if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+            memcmp(header.magic, ASSET_BUNDLE_MAGIC, 4) != 0 ||
+            header.version != ASSET_BUNDLE_VERSION ||
+            header.size > partition->size - sizeof(header)) {
+            Serial.println("📦 Partição assets vazia ou inválida (usando imagens do firmware)");
+            return false;
+        }
+
+        // Mapeia só o que o bundle ocupa (o MMU trabalha em páginas de 64 KB)
+        const void* mapped;
+        if (esp_partition_mmap(partition, 0, sizeof(header) + header.size,
+                               ESP_PARTITION_MMAP_DATA, &mapped, &mapHandle) != ESP_OK) {
+            Serial.println("❌ Falha ao mapear a partição assets");
+            return false;
+        }
+
+        const uint8_t* body = (const uint8_t*)mapped + sizeof(header);
+        if (esp_rom_crc32_le(0, body, header.size) != header.crc ||
+            header.count * sizeof(Entry) > header.size) {
+            Serial.println("❌ Bundle de assets corrompido (CRC)");
+            spi_flash_munmap(mapHandle);
+            return false;
+        }
+
+        base = (const uint8_t*)mapped;
+        entries = (const Entry*)body;
+        entryCount = header.count;
+        bundleSize = sizeof(header) + header.size;
+
+        for (uint16_t i = 0; i < entryCount; i++) {
+            if (!valid(entries[i])) {
+                Serial.printf("❌ Bundle de assets: entrada %u inválida\n", i);
+                end();
+                return false;
+            }
+        }
+
+        Serial.printf("📦 Bundle de assets: %u imagens, %lu bytes (flash mapeada)\n",
+                      entryCount, (unsigned long)bundleSize);
+        return true;
+    }
+
+    void end() {
+        if (base) spi_flash_munmap(mapHandle);
+        base = NULL;
+        entries = NULL;
+        entryCount = 0;
+        bundleSize = 0;
+    }
+
+    /**
+     * Procura a imagem pelo nome (símbolo do assets.json).
+     * out aponta para a flash mapeada: válido enquanto o bundle estiver aberto.
+     */
+    bool find(const char* name, ImageAsset& out) const {
+        for (uint16_t i = 0; i < entryCount; i++) {
+            const Entry& e = entries[i];
+            if (strncmp(e.name, name, ASSET_BUNDLE_NAME_LEN) != 0) continue;
+
+            out.width = e.width;
+            out.height = e.height;
+            out.format = e.format;
+            out.pixels = base + e.data;
+            out.palette = e.format == ASSET_PALETTE8 ? (const uint16_t*)(base + e.aux) : NULL;
+            out.rows = e.format == ASSET_Q565 ? (const uint32_t*)(base + e.aux) : NULL;
+            return true;
+        }
+        return false;
+    }
+
+    bool isOpen() const { return base != NULL; }
+    uint16_t count() const { return entryCount; }
+    uint32_t size() const { return bundleSize; }
+};
+
+#endif // ASSET_BUNDLE_H
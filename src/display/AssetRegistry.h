@@ -0,0 +1,63 @@
+/**
+ * Registro único das imagens do display
+ *
+ * Procura pelo nome (symbol do assets/assets.json):
+ *   1. no bundle da partição assets (AssetBundle, flash mapeada)
+ *   2. nas imagens compiladas (generated/assets_index.h), se ASSETS_BUILTIN
+ *
+ * Usado pelo desenho direto (drawImageAsset) e pelo decodificador de
+ * imagens do LVGL (LvglAssetDecoder.h): a mesma arte serve os dois.
+ */
+
+#ifndef ASSET_REGISTRY_H
+#define ASSET_REGISTRY_H
+
+#include <Arduino.h>
+#include "ImageAsset.h"
+#include "AssetBundle.h"
+
+// 0 = imagens só na partição assets (firmware menor)
+#ifndef ASSETS_BUILTIN
+  #define ASSETS_BUILTIN 1
+#endif
+
+#if ASSETS_BUILTIN
+  #include "generated/assets_index.h"
+#endif
+
+class AssetRegistry {
+private:
+    AssetBundle bundle;
+
+public:
+    /**
+     * Abre o bundle da partição (sem ele, só as imagens compiladas)
+     */
+    bool begin() {
+        return bundle.begin();
+    }
+
+    /**
+     * Preenche out com a imagem name. fromBundle indica a origem.
+     */
+    bool find(const char* name, ImageAsset& out, bool* fromBundle = NULL) const {
+        if (bundle.find(name, out)) {
+            if (fromBundle) *fromBundle = true;
+            return true;
+        }
+        if (fromBundle) *fromBundle = false;
+#if ASSETS_BUILTIN
+        for (uint8_t i = 0; i < BUILTIN_ASSET_COUNT; i++) {
+            if (strcmp(builtinAssets[i].name, name) == 0) {
+                out = *builtinAssets[i].asset;
+                return true;
+            }
+        }
+#endif
+        return false;
+    }
+
+    const AssetBundle& partition() const { return bundle; }
+};
+
+#endif // ASSET_REGISTRY_H
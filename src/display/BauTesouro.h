@@ -1,231 +0,0 @@
-#define BAUTESOURO_HEIGHT 224
-#define BAUTESOURO_WIDTH 240
-
-// array size is 53760 pixels (240 * 224)
-// Each pixel is a 32-bit RGB888 value (0x00RRGGBB)
-static const uint32_t BauTesouro[] PROGMEM  = {
-  0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020100, 0x010100, 0x020300, 0x020300, 0x020300, 0x020300, 0x030400, 0x030500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030200, 0x020200, 0x020200, 0x020200, 0x030300, 0x030400, 0x020401, 0x020300, 0x030400, 0x030500, 0x040500, 0x040500, 0x040600, 0x030500, 0x040400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030300, 0x010100, 0x020200, 0x010100, 0x010200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010200, 0x010101, 0x010100, 0x010100, 0x010100, 0x010101, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010100, 0x010100, 0x020100, 0x020201, 0x020200, 0x020200, 0x020201, 0x010301, 0x010201, 0x020200, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030300, 0x030200, 0x040301, 0x030301, 0x040300, 0x030400, 0x030400, 0x030500, 0x040600, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x030400, 0x030400, 0x020300, 0x030400, 0x020400, 0x020400, 0x020400, 0x030400, 0x020300, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x000000, 0x010101, 0x000001, 0x000001, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x020200, 0x020201, 0x020200, 0x010100, 0x010100, 0x020101, 0x010101, 0x020201, 0x030300, 0x030300, 0x030400, 0x030400, 0x030400, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x040300, 0x040301, 0x030300, 0x030400, 0x040500, 0x030500, 0x030500, 0x030501, 0x050601, 0x040601, 0x040601, 0x050601, 0x050601, 0x050600, 0x050601, 0x050601, 0x040601, 0x040601, 0x030500, 0x030300, 0x020200, 0x020300, 0x020300, 0x030200, 0x020200, 0x020200, 0x030300, 0x030400, 0x020300, 0x030300, 0x030300, 0x020200, 0x020200, 0x010200, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x020200, 0x020200, 0x020200, 0x030300, 0x030200, 0x030200, 0x020200, 0x020200, 0x020300, 0x020200, 0x020201, 0x040301, 0x030301, 0x030400, 0x040401, 0x040601, 0x040600, 0x040600, 0x040500, 0x040500, 0x030400, 0x040500, 0x040500, 0x040500, 0x040500, 0x040600, 0x040601, 0x050701, 0x050701, 0x050701, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030301, 0x030400, 0x030400, 0x030500, 0x030500, 0x030500, 0x030500, 0x030400, 0x030200, 0x030200, 0x020100, 0x010200, 0x010200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020201, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x020101, 0x020100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020300, 0x030300, 0x020200, 0x020200, 0x030300, 0x030200, 0x030300, 0x030300, 0x020300, 0x020200, 0x030400, 0x020400, 0x030400, 0x040500, 0x040500, 0x040500, 0x040601, 0x040600, 0x040600, 0x040600, 0x040501, 0x040501, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x050601, 0x050601, 0x050601, 0x060701, 0x060701, 0x060702, 0x060702, 0x070602, 0x060702, 0x050601, 0x050701, 0x060701, 0x050701, 0x060701, 0x060601, 0x050601, 0x040500, 0x030501, 0x040500, 0x030500, 0x030500, 0x030500, 0x030500, 0x030500, 0x030400, 0x030400, 0x040400, 0x030400, 0x030300, 0x030300, 0x030200, 0x020300, 0x020300, 0x030300, 0x020200, 0x020200, 0x020100, 0x020200, 0x020200, 0x020200, 0x030301, 0x020301, 0x020301, 0x020201, 0x010101, 0x010101, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010100, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020201, 0x020300, 0x030400, 0x020300, 0x020200, 0x020200, 0x020200, 0x020200, 0x030400, 0x030400, 0x020300, 0x020200, 0x030400, 0x030400, 0x030500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x050601, 0x040600, 0x040500, 0x040500, 0x040601, 0x040500, 0x040600, 0x040500, 0x040500, 0x050501, 0x050601, 0x040501, 0x060702, 0x060802, 0x060803, 0x070803, 0x070803, 0x080803, 0x060702, 0x070702, 0x060702, 0x060802, 0x060902, 0x060802, 0x060702, 0x050601, 0x050601, 0x050601, 0x050601, 0x040601, 0x030600, 0x040701, 0x040500, 0x040500, 0x030400, 0x030400, 0x040500, 0x040500, 0x030400, 0x040400, 0x030400, 0x040400, 0x030500, 0x030400, 0x030300, 0x020300, 0x020300, 0x020200, 0x020200, 0x030301, 0x030400, 0x030400, 0x030300, 0x020200, 0x020200, 0x020200, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000001, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020300, 0x030200, 0x030300, 0x020300, 0x020300, 0x030300, 0x030301, 0x030400, 0x030400, 0x030400, 0x030300, 0x030400, 0x030501, 0x030500, 0x040501, 0x050500, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x040500, 0x040500, 0x040601, 0x040500, 0x050601, 0x050601, 0x050601, 0x060601, 0x050701, 0x050701, 0x060702, 0x060702, 0x060702, 0x060802, 0x060802, 0x060802, 0x060802, 0x060701, 0x060702, 0x060802, 0x060802, 0x060802, 0x060802, 0x050802, 0x050702, 0x050701, 0x050701, 0x050701, 0x050701, 0x050701, 0x050601, 0x040601, 0x040501, 0x040501, 0x050601, 0x050601, 0x030500, 0x040500, 0x030500, 0x040500, 0x040600, 0x040500, 0x040500, 0x040400, 0x030500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x020200, 0x020200, 0x010200, 0x020200, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x020100, 0x020201, 0x020201, 0x010101, 0x010101, 0x010101, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x030200, 0x020200, 0x010100, 0x020100, 0x010101, 0x010100, 0x020200, 0x030301, 0x030301, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030500, 0x030400, 0x030500, 0x040601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x040500, 0x040600, 0x040501, 0x040500, 0x040500, 0x040500, 0x040500, 0x050600, 0x050700, 0x050701, 0x060802, 0x060802, 0x060802, 0x060701, 0x060802, 0x060802, 0x060802, 0x060802, 0x060701, 0x060702, 0x050702, 0x060802, 0x060702, 0x060801, 0x060902, 0x060802, 0x060802, 0x050802, 0x060803, 0x060802, 0x050701, 0x040601, 0x040601, 0x050601, 0x050601, 0x050601, 0x050701, 0x030500, 0x040500, 0x030400, 0x030400, 0x040600, 0x050601, 0x040500, 0x030400, 0x030500, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x020300, 0x020200, 0x020201, 0x010101, 0x020200, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x020100, 0x020200, 0x020200, 0x020200, 0x020100, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x020200, 0x020100, 0x020100, 0x020200, 0x020300, 0x030300, 0x030300, 0x030300, 0x030301, 0x030400, 0x030400, 0x040500, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x040400, 0x040500, 0x040500, 0x040500, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x060702, 0x050702, 0x060702, 0x060701, 0x050701, 0x050702, 0x050601, 0x050601, 0x060701, 0x060701, 0x050701, 0x050801, 0x060701, 0x060803, 0x070903, 0x070903, 0x060802, 0x070803, 0x070903, 0x070902, 0x060802, 0x070803, 0x070803, 0x060803, 0x070804, 0x070903, 0x070903, 0x070903, 0x060903, 0x070803, 0x070803, 0x070803, 0x060702, 0x060601, 0x060702, 0x050701, 0x050601, 0x050601, 0x050601, 0x050601, 0x040500, 0x040500, 0x040500, 0x040500, 0x040601, 0x050701, 0x050601, 0x040500, 0x040500, 0x050601, 0x040500, 0x030400, 0x030400, 0x020400, 0x030500, 0x030301, 0x020200, 0x010100, 0x020200, 0x010100, 0x000000, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010100, 0x010101, 0x020200, 0x030301, 0x020200, 0x020100, 0x010100, 0x020200, 0x020200, 0x010200, 0x010100, 0x030300, 0x030400, 0x030300, 0x020200, 0x020300, 0x020301, 0x030400, 0x030400, 0x030500, 0x030400, 0x030500, 0x030500, 0x040500, 0x040400, 0x030500, 0x030500, 0x030500, 0x030500, 0x040500, 0x040500, 0x040600, 0x050600, 0x050601, 0x060702, 0x060702, 0x060702, 0x060702, 0x060702, 0x060702, 0x060702, 0x070802, 0x060803, 0x050703, 0x050702, 0x050702, 0x050702, 0x060703, 0x070702, 0x070803, 0x070803, 0x070803, 0x070803, 0x080904, 0x070804, 0x070904, 0x080904, 0x070803, 0x070803, 0x070803, 0x070803, 0x070904, 0x070904, 0x070904, 0x070904, 0x070903, 0x080a02, 0x070902, 0x080a02, 0x080903, 0x080803, 0x080702, 0x080602, 0x080703, 0x070802, 0x060803, 0x050601, 0x050501, 0x050600, 0x050601, 0x050601, 0x060702, 0x060802, 0x060802, 0x050701, 0x050601, 0x040601, 0x040500, 0x050601, 0x050601, 0x040500, 0x040500, 0x040500, 0x040400, 0x030400, 0x030400, 0x030301, 0x020200, 0x010100, 0x020100, 0x020100, 0x020200, 0x010200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x020200, 0x030400, 0x020200, 0x020100, 0x010100, 0x020200, 0x020200, 0x030300, 0x020300, 0x030400, 0x040400, 0x030400, 0x030300, 0x030500, 0x030501, 0x030500, 0x030400, 0x030500, 0x030400, 0x030500, 0x040500, 0x040601, 0x050601, 0x040601, 0x050701, 0x050601, 0x050601, 0x040501, 0x050500, 0x050601, 0x050601, 0x060701, 0x060702, 0x060702, 0x060702, 0x060702, 0x060702, 0x060702, 0x070803, 0x070803, 0x070904, 0x070804, 0x060803, 0x060803, 0x060903, 0x070803, 0x070903, 0x070903, 0x080904, 0x080903, 0x090a04, 0x0a0904, 0x060601, 0x070802, 0x090a05, 0x090a05, 0x080a05, 0x090a05, 0x090a05, 0x090a05, 0x090a05, 0x090a05, 0x090a05, 0x090904, 0x090904, 0x090a04, 0x090a04, 0x090903, 0x090803, 0x080703, 0x090703, 0x090804, 0x070903, 0x070902, 0x050701, 0x060702, 0x060701, 0x050601, 0x040601, 0x060802, 0x060802, 0x060802, 0x050702, 0x050601, 0x050601, 0x050501, 0x050601, 0x050602, 0x040500, 0x040500, 0x040500, 0x040400, 0x030400, 0x030400, 0x030400, 0x020200, 0x020100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x020200, 0x030301, 0x020201, 0x010100, 0x020200, 0x030200, 0x020200, 0x030400, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030300, 0x030500, 0x040500, 0x030400, 0x030400, 0x030500, 0x030500, 0x040600, 0x040501, 0x040501, 0x050500, 0x040500, 0x040601, 0x040600, 0x040500, 0x040601, 0x050701, 0x050801, 0x050701, 0x060702, 0x060702, 0x060702, 0x060702, 0x050702, 0x060702, 0x070702, 0x070803, 0x070803, 0x070803, 0x070904, 0x070903, 0x070903, 0x070903, 0x070903, 0x070803, 0x070804, 0x070903, 0x070903, 0x080904, 0x040500, 0x2c291f, 0x1f1d14, 0x070703, 0x090a05, 0x090904, 0x090904, 0x090904, 0x090b05, 0x090a05, 0x0a0a05, 0x0b0a05, 0x0c0905, 0x0c0906, 0x0c0906, 0x0b0906, 0x0b0905, 0x0a0904, 0x090804, 0x090804, 0x080804, 0x060903, 0x060802, 0x050701, 0x060802, 0x060902, 0x060701, 0x050701, 0x050802, 0x050901, 0x060802, 0x060701, 0x060702, 0x060702, 0x050602, 0x050601, 0x050701, 0x050601, 0x050501, 0x050601, 0x040500, 0x030400, 0x040400, 0x030400, 0x030300, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x020200, 0x030300, 0x030400, 0x020300, 0x020200, 0x020200, 0x030200, 0x020200, 0x030400, 0x030400, 0x030400, 0x030400, 0x020400, 0x030400, 0x030400, 0x030400, 0x030500, 0x030500, 0x030500, 0x040601, 0x040600, 0x040600, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050701, 0x050701, 0x050702, 0x060702, 0x060702, 0x060702, 0x070804, 0x070904, 0x070803, 0x060803, 0x050803, 0x060803, 0x080703, 0x080903, 0x070903, 0x080904, 0x080804, 0x080904, 0x080903, 0x080803, 0x070903, 0x070904, 0x080a04, 0x080a04, 0x080a04, 0x080904, 0x080803, 0x1d1b11, 0x16130a, 0x0c0a05, 0x0b0906, 0x0a0905, 0x0a0a05, 0x0a0a05, 0x090b05, 0x0a0a06, 0x0c0a06, 0x0d0a07, 0x0d0b06, 0x0d0c07, 0x0d0c06, 0x0e0c05, 0x0d0c06, 0x0a0a05, 0x0a0a05, 0x090904, 0x080803, 0x070903, 0x070903, 0x060802, 0x060801, 0x060902, 0x060903, 0x070903, 0x070903, 0x070a03, 0x070803, 0x060703, 0x070803, 0x070803, 0x060703, 0x060702, 0x060702, 0x060702, 0x060702, 0x050601, 0x030600, 0x040500, 0x030500, 0x030400, 0x030400, 0x010200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020201, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010101, 0x010200, 0x020200, 0x030300, 0x030300, 0x030300, 0x030300, 0x030300, 0x020300, 0x030300, 0x030400, 0x030400, 0x030300, 0x030400, 0x040500, 0x040500, 0x040501, 0x050601, 0x040601, 0x050601, 0x040601, 0x050601, 0x050600, 0x050601, 0x050701, 0x050702, 0x050702, 0x060702, 0x050702, 0x050702, 0x050702, 0x050702, 0x050702, 0x060803, 0x060802, 0x060803, 0x070803, 0x070904, 0x070904, 0x070904, 0x070803, 0x070803, 0x080903, 0x090903, 0x080803, 0x080904, 0x080904, 0x090904, 0x080904, 0x080904, 0x080904, 0x080904, 0x080904, 0x090904, 0x090904, 0x0a0a05, 0x0b0a06, 0x0a0905, 0x0c0b06, 0x0c0c07, 0x0b0b06, 0x0b0b06, 0x0a0a05, 0x0a0b06, 0x0a0c06, 0x0b0b06, 0x0c0a07, 0x0e0c08, 0x0e0d09, 0x0e0e09, 0x0e0e08, 0x0e0d07, 0x0d0d07, 0x0b0c05, 0x0a0b05, 0x090a04, 0x090804, 0x080904, 0x080a04, 0x070903, 0x060802, 0x060802, 0x070803, 0x080904, 0x080903, 0x080904, 0x080904, 0x070904, 0x070a04, 0x080904, 0x070803, 0x060803, 0x070803, 0x060802, 0x060703, 0x050701, 0x040600, 0x040500, 0x030400, 0x040400, 0x030400, 0x030300, 0x030300, 0x030300, 0x030300, 0x030300, 0x020300, 0x020201, 0x020201, 0x010101, 0x010100, 0x020300, 0x020301, 0x020201, 0x020201, 0x010101, 0x000101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x010200, 0x020200, 0x020200, 0x020200, 0x020200, 0x030300, 0x030400, 0x030400, 0x030400, 0x030401, 0x030400, 0x030400, 0x030400, 0x030400, 0x030500, 0x040601, 0x050601, 0x050601, 0x040601, 0x050601, 0x050702, 0x050702, 0x060601, 0x060601, 0x060702, 0x060803, 0x060802, 0x050702, 0x050803, 0x060803, 0x060803, 0x060803, 0x060803, 0x060803, 0x060802, 0x060802, 0x070904, 0x070804, 0x080804, 0x070904, 0x070904, 0x070904, 0x080a04, 0x090b04, 0x090a04, 0x090904, 0x090a04, 0x090b04, 0x090b05, 0x090c05, 0x090c05, 0x090a04, 0x0a0905, 0x0a0905, 0x0b0905, 0x0b0905, 0x0b0b06, 0x0c0c07, 0x0d0c08, 0x0e0d08, 0x0c0d07, 0x0b0c06, 0x0b0c07, 0x0c0d07, 0x0b0c06, 0x0c0c07, 0x0d0c07, 0x0d0d08, 0x0d0c08, 0x0e0e0a, 0x0f0f0a, 0x0f0e0b, 0x0e0d0a, 0x0e0d08, 0x0d0e06, 0x0c0d05, 0x0b0b05, 0x090a04, 0x090a04, 0x080a04, 0x070a03, 0x070904, 0x080804, 0x080803, 0x080803, 0x080803, 0x080803, 0x080a04, 0x090a04, 0x080b04, 0x080a04, 0x070904, 0x070803, 0x070803, 0x060903, 0x060803, 0x060702, 0x050601, 0x040400, 0x040402, 0x030301, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x030400, 0x020301, 0x020300, 0x020200, 0x020200, 0x020300, 0x030400, 0x030300, 0x030200, 0x020201, 0x010100, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x020100, 0x020200, 0x020200, 0x010100, 0x010200, 0x020200, 0x020200, 0x030300, 0x030400, 0x030400, 0x030400, 0x040500, 0x030400, 0x040400, 0x040500, 0x040500, 0x040500, 0x040500, 0x050501, 0x050600, 0x050601, 0x040601, 0x050601, 0x050702, 0x050801, 0x060801, 0x060802, 0x050702, 0x070803, 0x070803, 0x060803, 0x070904, 0x070904, 0x080904, 0x070904, 0x070904, 0x070804, 0x070904, 0x070904, 0x080904, 0x080905, 0x080904, 0x080904, 0x080904, 0x070905, 0x090a04, 0x090b05, 0x090b05, 0x090a04, 0x0a0a04, 0x0a0b04, 0x0a0b05, 0x0a0b05, 0x0a0b05, 0x0a0a05, 0x0a0a05, 0x0b0a06, 0x0b0a06, 0x0b0b06, 0x0c0c07, 0x0d0d07, 0x0e0e07, 0x0e0d08, 0x0e0e09, 0x0d0d08, 0x0c0c07, 0x0d0e08, 0x0d0d08, 0x0d0c07, 0x0d0c07, 0x0e0f09, 0x0f0f0a, 0x0f100a, 0x100f0b, 0x100f0b, 0x100f0b, 0x0f0f09, 0x100f07, 0x0e0f06, 0x0c0d05, 0x0c0b05, 0x0a0a05, 0x090a04, 0x080903, 0x080803, 0x080804, 0x080803, 0x090904, 0x090904, 0x090903, 0x0a0904, 0x090905, 0x090a05, 0x080a04, 0x080a04, 0x080904, 0x080804, 0x070903, 0x070902, 0x070802, 0x060701, 0x040501, 0x040502, 0x030401, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030300, 0x030300, 0x020300, 0x030300, 0x040300, 0x020200, 0x020100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x030400, 0x020300, 0x030400, 0x030400, 0x030301, 0x030400, 0x030500, 0x040500, 0x040500, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x040601, 0x040601, 0x050701, 0x050701, 0x060802, 0x050801, 0x050801, 0x060802, 0x070903, 0x080903, 0x080803, 0x080904, 0x080804, 0x080803, 0x080803, 0x080803, 0x080904, 0x070904, 0x070903, 0x080904, 0x080a04, 0x080a05, 0x080a05, 0x090a05, 0x080a05, 0x070905, 0x090b05, 0x0a0b04, 0x0a0b05, 0x0c0a06, 0x0d0a06, 0x0c0b05, 0x0c0b06, 0x0b0c06, 0x0b0c06, 0x0b0b06, 0x0a0a05, 0x0b0b06, 0x0b0c07, 0x0c0d07, 0x0d0d08, 0x0d0e09, 0x0e0e08, 0x0e0e09, 0x0f0e09, 0x0e0d08, 0x0d0d08, 0x0e0e09, 0x0f0e09, 0x0f0f08, 0x0e0f07, 0x0f1009, 0x10120b, 0x10100b, 0x100f0b, 0x100f0c, 0x100f0b, 0x0f0f0a, 0x100f07, 0x100f06, 0x0f0e06, 0x0f0d05, 0x0e0c06, 0x0b0a05, 0x090903, 0x080903, 0x090904, 0x0a0a04, 0x0a0a05, 0x0a0a05, 0x0b0b05, 0x0c0b05, 0x0c0b05, 0x0c0b06, 0x0b0a05, 0x0a0a03, 0x090903, 0x080902, 0x070802, 0x070802, 0x070802, 0x060701, 0x050601, 0x050601, 0x040500, 0x040500, 0x040500, 0x030400, 0x030400, 0x030400, 0x030500, 0x030500, 0x030500, 0x030400, 0x030400, 0x030400, 0x030300, 0x030301, 0x030400, 0x040400, 0x030300, 0x020200, 0x020201, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010100, 0x010200, 0x010100, 0x020200, 0x030300, 0x020200, 0x020201, 0x010100, 0x020300, 0x030500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x040501, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050601, 0x050701, 0x060702, 0x060803, 0x060803, 0x070803, 0x060902, 0x060902, 0x060802, 0x060902, 0x070903, 0x080a04, 0x080904, 0x090a04, 0x090a05, 0x090904, 0x090904, 0x090904, 0x080904, 0x080a04, 0x080a05, 0x080905, 0x090a05, 0x090a05, 0x090a05, 0x090a05, 0x090b05, 0x090b05, 0x0a0b05, 0x0c0b05, 0x0c0b06, 0x0d0b07, 0x0c0b07, 0x0c0c07, 0x0c0c07, 0x0b0c07, 0x0b0c07, 0x0d0d07, 0x0c0c08, 0x0d0d08, 0x0d0d09, 0x0e0e0a, 0x0d0d09, 0x0e0f09, 0x0e0f09, 0x0f0e09, 0x100e09, 0x0f0e09, 0x100f0a, 0x12100b, 0x120e08, 0x110e06, 0x101007, 0x101109, 0x11120b, 0x11120c, 0x12110e, 0x12110d, 0x11110c, 0x11110c, 0x121108, 0x121007, 0x111007, 0x120f06, 0x100d05, 0x0d0c05, 0x0c0a03, 0x0b0b03, 0x0a0b04, 0x0d0c06, 0x0d0c07, 0x0c0d07, 0x0d0c07, 0x0f0d07, 0x0e0e06, 0x0f0d05, 0x0e0c05, 0x0c0b04, 0x0b0b02, 0x0a0a02, 0x090902, 0x080802, 0x070802, 0x070802, 0x060701, 0x050700, 0x040600, 0x040600, 0x040500, 0x030500, 0x030500, 0x030500, 0x040600, 0x040601, 0x040501, 0x040601, 0x030400, 0x040500, 0x040500, 0x030500, 0x030400, 0x030400, 0x040400, 0x040400, 0x030400, 0x020201, 0x010100, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000001, 0x010101, 0x010100, 0x010101, 0x010101, 0x010100, 0x010100, 0x010200, 0x020300, 0x020200, 0x010200, 0x030301, 0x030400, 0x030400, 0x030400, 0x030500, 0x040500, 0x030400, 0x030500, 0x040500, 0x050601, 0x050601, 0x040600, 0x050701, 0x050701, 0x060701, 0x060802, 0x060802, 0x060802, 0x060902, 0x060803, 0x060803, 0x060803, 0x070904, 0x070903, 0x060903, 0x080a04, 0x080a05, 0x090a05, 0x090a05, 0x090a06, 0x090a04, 0x080904, 0x080903, 0x090a04, 0x090a04, 0x080a04, 0x090a04, 0x0a0a05, 0x0a0a06, 0x0a0a04, 0x0a0a05, 0x0b0b06, 0x0b0b05, 0x0b0c06, 0x0c0b07, 0x0c0c06, 0x0b0b06, 0x0b0c06, 0x0c0d08, 0x0c0e08, 0x0c0e08, 0x0c0e08, 0x0d0f09, 0x0f0e0a, 0x0e0e09, 0x0e0d08, 0x0e0d08, 0x0e0f08, 0x0f1008, 0x0f0f07, 0x0f0e08, 0x110f09, 0x111109, 0x131108, 0x161207, 0x1f1400, 0x231b04, 0x161507, 0x111109, 0x12120b, 0x12130c, 0x13130d, 0x13130b, 0x12130a, 0x13130a, 0x121309, 0x121208, 0x111107, 0x0f1006, 0x0e0e06, 0x0c0d07, 0x0b0b05, 0x0b0c05, 0x0c0c06, 0x0e0e09, 0x0e0e0a, 0x0e0f0a, 0x0f100a, 0x0f0f0a, 0x0e0f09, 0x0e0e09, 0x0d0d08, 0x0b0b06, 0x0c0d05, 0x0b0c04, 0x090903, 0x080702, 0x070702, 0x060701, 0x050701, 0x050701, 0x050802, 0x040701, 0x040701, 0x040601, 0x040500, 0x040500, 0x040600, 0x050600, 0x050601, 0x040501, 0x050501, 0x050601, 0x040500, 0x030500, 0x030400, 0x030400, 0x030400, 0x030400, 0x020400, 0x020300, 0x010200, 0x010100, 0x010100, 0x010000, 0x000000, 0x000101, 0x000100, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x020100, 0x020200, 0x010200, 0x020200, 0x020300, 0x030400, 0x020400, 0x030500, 0x030400, 0x030500, 0x040500, 0x040601, 0x040501, 0x040601, 0x040601, 0x050602, 0x060702, 0x050702, 0x060802, 0x060702, 0x060702, 0x060801, 0x060802, 0x060903, 0x060903, 0x060903, 0x070903, 0x070904, 0x080a05, 0x080a05, 0x080a05, 0x090a05, 0x090a04, 0x090904, 0x090a04, 0x090a04, 0x090a04, 0x090a05, 0x0a0a05, 0x0a0b05, 0x0b0b06, 0x0a0b05, 0x0a0b05, 0x0a0a05, 0x0a0b05, 0x0a0b06, 0x0b0d07, 0x0c0d07, 0x0c0d07, 0x0c0d08, 0x0d0d08, 0x0c0d07, 0x0c0d07, 0x0c0d07, 0x0c0e08, 0x0d0e09, 0x0d0e08, 0x0d0e09, 0x0f0f0a, 0x100f0a, 0x0f0f0a, 0x0f0e09, 0x0e0e08, 0x0f1107, 0x101108, 0x101009, 0x110f09, 0x121006, 0x111205, 0x141304, 0x2f2605, 0x695c31, 0x574a22, 0x221a03, 0x120f08, 0x121108, 0x121308, 0x131309, 0x121208, 0x121308, 0x121409, 0x121309, 0x13120a, 0x121308, 0x101206, 0x0f1007, 0x0d0e08, 0x0c0e07, 0x0e0f07, 0x0f0f08, 0x10100a, 0x101009, 0x10110a, 0x10110b, 0x10110b, 0x0f0f0a, 0x0f0f0a, 0x0e0d09, 0x0c0c07, 0x0d0d06, 0x0c0c05, 0x090a04, 0x080903, 0x080802, 0x070802, 0x050801, 0x050802, 0x050802, 0x050701, 0x040701, 0x040701, 0x040601, 0x050701, 0x050701, 0x050601, 0x050601, 0x040501, 0x050601, 0x050601, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x030400, 0x020400, 0x020400, 0x020400, 0x020201, 0x020201, 0x010101, 0x000000, 0x000101, 0x010201, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000001, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010100, 0x010101, 0x010101, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010200, 0x020200, 0x030400, 0x020500, 0x030400, 0x030400, 0x030601, 0x030601, 0x040601, 0x050500, 0x040601, 0x050702, 0x050702, 0x060702, 0x060802, 0x060803, 0x070702, 0x060702, 0x060803, 0x060903, 0x070903, 0x060903, 0x070904, 0x070a04, 0x080a05, 0x080a05, 0x090a05, 0x090a05, 0x090a04, 0x090903, 0x080903, 0x080904, 0x090a04, 0x0a0a05, 0x0b0a06, 0x0b0b06, 0x0c0c07, 0x0c0c07, 0x0c0c07, 0x0b0d07, 0x0a0c06, 0x0b0c06, 0x0b0c06, 0x0c0d07, 0x0c0d07, 0x0c0e07, 0x0c0e08, 0x0d0d08, 0x0d0d08, 0x0c0d08, 0x0c0e07, 0x0d0d07, 0x0e0d09, 0x0e0e09, 0x0f0e09, 0x100f0b, 0x10100b, 0x10100b, 0x10100b, 0x0e0f0a, 0x101107, 0x131107, 0x110f07, 0x130f07, 0x121106, 0x121206, 0x151102, 0x483b0b, 0xc6bd8a, 0x958a5b, 0x1f0400, 0x170f08, 0x151209, 0x131309, 0x131309, 0x121309, 0x131409, 0x121307, 0x121207, 0x131209, 0x121308, 0x111307, 0x101208, 0x111109, 0x121009, 0x121009, 0x111108, 0x121107, 0x121107, 0x121107, 0x111209, 0x11120a, 0x12120b, 0x10110a, 0x0f0f0a, 0x0e0e09, 0x0e0f07, 0x0c0d06, 0x090a04, 0x080a04, 0x070903, 0x060802, 0x060802, 0x050802, 0x050702, 0x060702, 0x050802, 0x050901, 0x060801, 0x050802, 0x060802, 0x060702, 0x060802, 0x050701, 0x050601, 0x050601, 0x040500, 0x030500, 0x030500, 0x030500, 0x030500, 0x030400, 0x020400, 0x030400, 0x030400, 0x010200, 0x010101, 0x010101, 0x000101, 0x000100, 0x000100, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010100, 0x010100, 0x010100, 0x020200, 0x020201, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x030400, 0x030500, 0x030400, 0x030500, 0x040601, 0x040601, 0x050601, 0x050601, 0x050601, 0x040701, 0x050702, 0x050702, 0x050702, 0x050803, 0x070803, 0x070804, 0x070804, 0x070904, 0x080a04, 0x070a04, 0x070904, 0x080a04, 0x090a05, 0x0a0a05, 0x090905, 0x0a0905, 0x0a0904, 0x0c0a03, 0x0c0b03, 0x0c0b05, 0x0e0b04, 0x0e0c05, 0x0f0c06, 0x0f0d06, 0x0f0d06, 0x0e0e06, 0x0e0f08, 0x0e0f07, 0x0c0e06, 0x0c0e07, 0x0d0e08, 0x0e0e08, 0x0e0e09, 0x0e0f09, 0x0e0f09, 0x0e0e0a, 0x0f0e0a, 0x0e0d08, 0x0e0d08, 0x0e0e08, 0x100f09, 0x100e09, 0x110f0a, 0x11100c, 0x11100b, 0x11110c, 0x11110c, 0x10110b, 0x141208, 0x191408, 0x150c00, 0x170f00, 0x171308, 0x131207, 0x181406, 0x342a09, 0x6c623a, 0x554a24, 0x211701, 0x191309, 0x17130a, 0x15140a, 0x14140a, 0x13150a, 0x13140a, 0x131308, 0x13130a, 0x131409, 0x131408, 0x121408, 0x131208, 0x141209, 0x161109, 0x16120b, 0x16120b, 0x16120b, 0x16130c, 0x15130b, 0x12130a, 0x12130a, 0x12120a, 0x12120a, 0x111109, 0x101008, 0x0e0f06, 0x0b0c05, 0x0a0b05, 0x080a05, 0x080904, 0x070903, 0x060803, 0x060802, 0x060802, 0x060803, 0x060902, 0x060902, 0x060902, 0x060902, 0x060802, 0x050701, 0x050701, 0x050701, 0x050601, 0x050601, 0x040500, 0x040500, 0x030500, 0x040400, 0x030400, 0x030500, 0x030400, 0x030500, 0x030400, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000001, 0x010101, 0x010101, 0x010101, 0x000001, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x020201, 0x020200, 0x020300, 0x020301, 0x030400, 0x030500, 0x040601, 0x030500, 0x050601, 0x050601, 0x050702, 0x050702, 0x050702, 0x050702, 0x050702, 0x050702, 0x050702, 0x060803, 0x070a03, 0x070a04, 0x080b04, 0x090b05, 0x080a05, 0x080a04, 0x080a04, 0x090a04, 0x090a05, 0x0a0a05, 0x0a0a05, 0x0a0905, 0x0b0a05, 0x0d0b05, 0x0d0b05, 0x0d0b07, 0x0e0c06, 0x0d0d06, 0x0f0d07, 0x0f0e08, 0x100f07, 0x0f0f07, 0x0f0f07, 0x0f1007, 0x0e0f06, 0x0d0f06, 0x0e0f0a, 0x0f1009, 0x0f0f09, 0x0f0f0a, 0x0e0f0a, 0x0e0e0a, 0x0f0e0a, 0x0f0d09, 0x0e0e0a, 0x0e0f09, 0x0f0f0a, 0x100f09, 0x0f0f0a, 0x10100c, 0x11110c, 0x12120d, 0x12120c, 0x12120c, 0x151209, 0x190d00, 0x61593d, 0x4e4730, 0x100b01, 0x15140a, 0x161508, 0x1d1808, 0x120300, 0x1a1204, 0x1c170a, 0x19150b, 0x17150c, 0x17150b, 0x16140b, 0x15140c, 0x14130a, 0x13130a, 0x13130a, 0x14140a, 0x15140a, 0x16140a, 0x18150a, 0x1b150a, 0x1b150a, 0x19150a, 0x18140b, 0x18140d, 0x17150d, 0x17140d, 0x15130c, 0x14130c, 0x14130c, 0x13120b, 0x121209, 0x111109, 0x0f0f07, 0x0b0d06, 0x0a0b06, 0x090a04, 0x080a04, 0x080a04, 0x070903, 0x050802, 0x060802, 0x070903, 0x060802, 0x060802, 0x060803, 0x070703, 0x060802, 0x050701, 0x050601, 0x050601, 0x050702, 0x050702, 0x040601, 0x050601, 0x040500, 0x040500, 0x030500, 0x030500, 0x030500, 0x030500, 0x030400, 0x020300, 0x020200, 0x010201, 0x010201, 0x010100, 0x010000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020202, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000100, 0x010101, 0x010101, 0x010100, 0x020200, 0x020200, 0x020200, 0x010200, 0x010101, 0x020200, 0x020300, 0x020300, 0x030400, 0x030400, 0x030401, 0x040501, 0x040500, 0x040501, 0x040601, 0x050601, 0x050501, 0x050702, 0x040601, 0x040602, 0x050701, 0x050702, 0x070803, 0x060803, 0x070904, 0x070905, 0x080b04, 0x090a03, 0x090b04, 0x0b0c04, 0x0e0c04, 0x0e0c04, 0x0c0b03, 0x0a0c04, 0x0b0c05, 0x0b0c04, 0x0b0a05, 0x0c0b06, 0x0d0b08, 0x0c0b07, 0x0c0d08, 0x0d0d09, 0x0e0e09, 0x0f0f0a, 0x0f0f0b, 0x0f100b, 0x0f1008, 0x0f1008, 0x0f1007, 0x101007, 0x0f0f08, 0x0e0f0a, 0x0f0f0a, 0x0f0f0a, 0x100f0b, 0x100f0b, 0x0f0e0a, 0x0e0e09, 0x0e0e0a, 0x100f0b, 0x0e0f09, 0x0e1008, 0x0f1009, 0x10100b, 0x10110d, 0x12110d, 0x13130e, 0x13130d, 0x13120d, 0x17130b, 0x211801, 0x625732, 0x4d4427, 0x151107, 0x17150c, 0x16140b, 0x16130a, 0x16130a, 0x15120a, 0x16130a, 0x18150b, 0x18150b, 0x18150c, 0x18140d, 0x17130c, 0x17140b, 0x16130c, 0x15130b, 0x16130b, 0x17140a, 0x19160b, 0x1e180c, 0x22190d, 0x1f170a, 0x1d160a, 0x1a160b, 0x19160c, 0x18150c, 0x18150d, 0x17140c, 0x17130c, 0x17130b, 0x13130b, 0x12130b, 0x121209, 0x101006, 0x0d0e06, 0x0b0c07, 0x090b05, 0x080a04, 0x080903, 0x070803, 0x080804, 0x070803, 0x070703, 0x080703, 0x080903, 0x080803, 0x070703, 0x060702, 0x060702, 0x050702, 0x050602, 0x060702, 0x060702, 0x050602, 0x050701, 0x040600, 0x040600, 0x040600, 0x030600, 0x030500, 0x030500, 0x020400, 0x020400, 0x020500, 0x020300, 0x020100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010101, 0x020200, 0x030400, 0x020300, 0x020100, 0x020200, 0x030301, 0x030301, 0x030500, 0x030500, 0x030500, 0x030500, 0x040501, 0x050601, 0x050601, 0x040500, 0x030500, 0x050601, 0x040501, 0x070701, 0x090801, 0x070601, 0x0c0a02, 0x090902, 0x060802, 0x070903, 0x080a04, 0x080a04, 0x090b04, 0x0a0b03, 0x0c0d03, 0x130f04, 0x150c04, 0x150c04, 0x130d04, 0x0d0c04, 0x0c0c05, 0x0b0c04, 0x0c0c07, 0x0c0c07, 0x0c0d07, 0x0d0d08, 0x0e0d09, 0x0f0f0a, 0x10100a, 0x11100c, 0x11110c, 0x10110b, 0x11120b, 0x13120b, 0x14110b, 0x141109, 0x12100b, 0x0f0f0b, 0x0f0f0a, 0x10100b, 0x10100b, 0x100f0c, 0x0f0f0b, 0x0f0f0a, 0x110f0b, 0x10100b, 0x10100a, 0x111109, 0x11110a, 0x11110b, 0x13120c, 0x13130d, 0x14140f, 0x14140e, 0x14150e, 0x17150b, 0x201a08, 0x332b08, 0x2e270d, 0x1c190f, 0x17150d, 0x17140d, 0x16130e, 0x17140d, 0x17140c, 0x17140b, 0x18150b, 0x18150c, 0x18150c, 0x17150e, 0x18150e, 0x17150e, 0x17140c, 0x17130b, 0x161509, 0x18180b, 0x1a170c, 0x1f180b, 0x221a0c, 0x21190b, 0x1f170b, 0x1c170c, 0x1b160b, 0x1a170c, 0x1a160d, 0x19160c, 0x18150c, 0x18140a, 0x16130b, 0x14130a, 0x131108, 0x121007, 0x0e0e05, 0x0b0d06, 0x0a0c05, 0x0a0a05, 0x090904, 0x090904, 0x090904, 0x090804, 0x080904, 0x080904, 0x080904, 0x080904, 0x080803, 0x070803, 0x060802, 0x060802, 0x060803, 0x060702, 0x050701, 0x060702, 0x060701, 0x050701, 0x050701, 0x040600, 0x040701, 0x040500, 0x040500, 0x030400, 0x020400, 0x020400, 0x020200, 0x020100, 0x010200, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x020200, 0x020200, 0x020300, 0x030400, 0x030300, 0x020200, 0x030200, 0x030301, 0x030301, 0x030400, 0x030400, 0x030500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x050701, 0x050702, 0x040602, 0x120d02, 0x2c2205, 0x3a2d05, 0x241c05, 0x0b0a03, 0x070803, 0x070802, 0x070802, 0x080903, 0x0a0a03, 0x0b0c02, 0x161206, 0x211402, 0x2e1800, 0x342300, 0x221806, 0x150e05, 0x100c06, 0x0c0c07, 0x0c0d07, 0x0c0d07, 0x0d0d08, 0x0e0d08, 0x0f0f0a, 0x11110c, 0x10100b, 0x12120c, 0x12120d, 0x12120d, 0x12120d, 0x14120d, 0x15120c, 0x15120b, 0x14120c, 0x10100c, 0x0f0f0a, 0x100f0b, 0x10100c, 0x100f0c, 0x100f0b, 0x10100b, 0x11100b, 0x11100b, 0x11120a, 0x14120b, 0x14120c, 0x14130b, 0x14130a, 0x14150b, 0x14150d, 0x14140c, 0x14160b, 0x16160b, 0x1a170a, 0x1b170a, 0x1d180c, 0x1d1a0f, 0x19170d, 0x17150b, 0x16140b, 0x17140b, 0x17140b, 0x18140b, 0x18150b, 0x18160b, 0x19150d, 0x18140d, 0x18130d, 0x18130f, 0x17140c, 0x18140c, 0x18170a, 0x19180c, 0x1a160b, 0x1c160b, 0x1f180b, 0x1f180c, 0x1e180c, 0x1d170c, 0x1b160b, 0x1c160b, 0x1b150b, 0x1b150b, 0x19150a, 0x18150a, 0x18160b, 0x161408, 0x131107, 0x121008, 0x0e0e06, 0x0c0d06, 0x0b0c06, 0x0a0b05, 0x0a0a05, 0x0a0905, 0x090804, 0x080804, 0x090a05, 0x090a05, 0x080904, 0x080904, 0x080904, 0x080903, 0x070903, 0x070803, 0x060702, 0x060702, 0x060802, 0x050802, 0x050701, 0x050801, 0x050701, 0x040600, 0x040601, 0x040500, 0x030400, 0x020200, 0x030300, 0x020400, 0x020200, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x020400, 0x040500, 0x040500, 0x040500, 0x050601, 0x050601, 0x040500, 0x050701, 0x060702, 0x040603, 0x140600, 0x74642f, 0xa89852, 0x493e14, 0x020300, 0x090a04, 0x080a04, 0x070902, 0x080903, 0x0a0b01, 0x0d0e03, 0x120900, 0x5b4b22, 0xbaac6f, 0x9e8e52, 0x3f3005, 0x130d03, 0x0f0e06, 0x0e0e07, 0x0e0e06, 0x0e0e08, 0x0d0e09, 0x0e0e09, 0x0f100a, 0x11110c, 0x12130d, 0x14130e, 0x14130e, 0x14130f, 0x14130f, 0x14130f, 0x14120e, 0x14120d, 0x14120d, 0x12110d, 0x10100b, 0x11100c, 0x11100c, 0x11100c, 0x11100c, 0x11100c, 0x12110d, 0x12120d, 0x14130d, 0x16130d, 0x17120e, 0x16130d, 0x15140d, 0x14150a, 0x16160c, 0x18160d, 0x18160c, 0x19170e, 0x1c180f, 0x1c190f, 0x1d190f, 0x1d1910, 0x1b180d, 0x19170b, 0x18150b, 0x18150a, 0x18140b, 0x18150b, 0x19150b, 0x19160c, 0x19140e, 0x18140f, 0x18130e, 0x19140e, 0x19140e, 0x19170d, 0x1b180d, 0x1b180d, 0x1a160c, 0x1b160b, 0x1c170c, 0x1d180c, 0x1e170c, 0x1b170c, 0x1e170d, 0x1d170d, 0x1e160c, 0x1e160d, 0x1c160c, 0x1b170b, 0x19170b, 0x171509, 0x141208, 0x110f09, 0x0d0d08, 0x0c0d06, 0x0b0d06, 0x0a0b06, 0x0a0b05, 0x0a0905, 0x0a0905, 0x0a0905, 0x090a05, 0x090905, 0x0a0905, 0x090a04, 0x090a04, 0x080904, 0x080904, 0x080904, 0x070904, 0x070903, 0x070903, 0x070803, 0x060803, 0x060803, 0x050802, 0x050701, 0x040601, 0x030500, 0x030400, 0x030200, 0x030400, 0x030400, 0x030400, 0x030201, 0x020100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x020202, 0x020202, 0x030300, 0x030400, 0x020200, 0x020200, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030500, 0x030500, 0x040600, 0x040600, 0x040601, 0x060702, 0x050601, 0x050601, 0x050601, 0x060702, 0x050602, 0x140900, 0x615020, 0x8a793a, 0x41360f, 0x050501, 0x090a04, 0x090a04, 0x090a04, 0x090a03, 0x0c0c02, 0x100f02, 0x050000, 0x7a6a38, 0xdfd18c, 0xb0a260, 0x3a2a00, 0x120c02, 0x0f0d05, 0x0f0f06, 0x0f0f05, 0x0f0f06, 0x0f0f08, 0x0f0f09, 0x101009, 0x10120b, 0x13140e, 0x13140e, 0x14140e, 0x15140f, 0x14140e, 0x14130e, 0x15140e, 0x15120d, 0x14120d, 0x13120d, 0x12110c, 0x12110d, 0x12110d, 0x12110d, 0x12100c, 0x13110c, 0x15130e, 0x15130e, 0x15140f, 0x15130f, 0x15130e, 0x15130e, 0x17140c, 0x18150b, 0x18160c, 0x1a170e, 0x1b160d, 0x1a150f, 0x1b1710, 0x1c1711, 0x1c1712, 0x1d1710, 0x1d180d, 0x1c180d, 0x1a160b, 0x1a160b, 0x19150c, 0x19150d, 0x19160b, 0x19170b, 0x19160c, 0x19160e, 0x1a160e, 0x1a160e, 0x1b170e, 0x1b190e, 0x1b190e, 0x1c180e, 0x1c180e, 0x1b170c, 0x1b170d, 0x1c180d, 0x1e180e, 0x1d190e, 0x1d190f, 0x1b170e, 0x1a170c, 0x1e180d, 0x1f170d, 0x1e170c, 0x1b160b, 0x19150a, 0x15120a, 0x100f0a, 0x0d0e09, 0x0c0d07, 0x0b0c06, 0x0a0b06, 0x0a0b04, 0x090a04, 0x0a0a04, 0x090a05, 0x090904, 0x090904, 0x0a0a05, 0x090a04, 0x090a04, 0x090904, 0x080803, 0x090804, 0x090904, 0x090904, 0x080903, 0x080803, 0x070904, 0x060803, 0x050702, 0x060801, 0x050701, 0x040501, 0x030401, 0x030301, 0x030401, 0x030400, 0x030301, 0x020101, 0x020100, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010101, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x020202, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x020400, 0x040501, 0x050601, 0x050701, 0x050701, 0x060702, 0x060702, 0x050701, 0x060701, 0x060701, 0x060702, 0x060702, 0x0b0a02, 0x190f00, 0x1a0500, 0x140c02, 0x0a0a04, 0x090a04, 0x090a04, 0x0a0c06, 0x0a0b04, 0x0d0c03, 0x121003, 0x191302, 0x3e2f0b, 0x64501b, 0x574616, 0x281e04, 0x151105, 0x120e07, 0x120f07, 0x111006, 0x111107, 0x111109, 0x111109, 0x12120a, 0x12120b, 0x15130c, 0x15140d, 0x16140e, 0x15140e, 0x15130e, 0x15140f, 0x16140f, 0x17140f, 0x16130f, 0x15130e, 0x15130d, 0x15120e, 0x14120e, 0x15130e, 0x17140f, 0x18140f, 0x181410, 0x18140f, 0x18150f, 0x17140e, 0x16140f, 0x18140e, 0x17140c, 0x18140a, 0x19150c, 0x1a160d, 0x1b160d, 0x1b1510, 0x1b1611, 0x1c1712, 0x1d1812, 0x1c180f, 0x1e1a0e, 0x1e190e, 0x1d190e, 0x1c180d, 0x1c160d, 0x1d160d, 0x19160c, 0x19160b, 0x19170b, 0x1b170c, 0x1c170d, 0x1c180f, 0x1c190f, 0x1c1910, 0x1d1a10, 0x1d190f, 0x1d1910, 0x1c190e, 0x1d190e, 0x1e190f, 0x1f190f, 0x211a0f, 0x201910, 0x1f1a11, 0x1e1a11, 0x211a10, 0x20180e, 0x1f170c, 0x1c170c, 0x18150a, 0x15120a, 0x110f0b, 0x0f0e0a, 0x0d0e09, 0x0c0d08, 0x0c0c08, 0x0b0c06, 0x0a0b06, 0x0b0b06, 0x0b0c06, 0x0b0b06, 0x0a0b06, 0x0b0c06, 0x0b0b06, 0x0b0b05, 0x0a0a05, 0x0a0a05, 0x0a0904, 0x090804, 0x090904, 0x090904, 0x090805, 0x080904, 0x070903, 0x060803, 0x060802, 0x060702, 0x050601, 0x040500, 0x040400, 0x030400, 0x030400, 0x040301, 0x020200, 0x020200, 0x020201, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020100, 0x020100, 0x020200, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x020202, 0x020202, 0x020200, 0x030300, 0x040400, 0x050501, 0x040600, 0x040500, 0x040500, 0x030500, 0x030500, 0x030500, 0x040500, 0x050601, 0x050602, 0x060702, 0x060702, 0x060802, 0x050701, 0x050702, 0x060802, 0x060802, 0x080a04, 0x080a04, 0x080a04, 0x0a0a04, 0x0a0c06, 0x0a0c06, 0x0a0c05, 0x0b0c06, 0x0c0c07, 0x0e0d06, 0x0f1005, 0x121005, 0x1c1406, 0x1b0e00, 0x1d1405, 0x191407, 0x151108, 0x130f07, 0x120d08, 0x130f07, 0x131008, 0x15120a, 0x14120b, 0x13120c, 0x14130c, 0x16130c, 0x16130c, 0x17140c, 0x17130c, 0x16130e, 0x16130f, 0x15140f, 0x17130f, 0x17130f, 0x17130f, 0x16130e, 0x16130d, 0x16120d, 0x16130e, 0x17130f, 0x18130f, 0x17130f, 0x18130f, 0x18130d, 0x18140d, 0x18140c, 0x18140d, 0x18150b, 0x19150a, 0x19150b, 0x19160d, 0x1b160e, 0x1b1611, 0x1b1711, 0x1c1611, 0x1d1812, 0x1d1810, 0x1e190f, 0x1e190f, 0x1e1a0e, 0x1e190d, 0x20180e, 0x20170f, 0x1d170f, 0x1c170d, 0x1b170d, 0x1d170e, 0x1f1810, 0x1f1911, 0x201a12, 0x1f1b12, 0x1f1b12, 0x1e1a11, 0x1d1911, 0x1d190e, 0x1e180e, 0x1f180e, 0x201a0e, 0x221a0f, 0x231910, 0x221a12, 0x221c12, 0x221b10, 0x20190f, 0x1d190d, 0x1b180c, 0x181609, 0x16130a, 0x12100b, 0x0f0f0b, 0x0d0e09, 0x0c0e08, 0x0c0c07, 0x0b0c07, 0x0b0c07, 0x0b0c06, 0x0c0b06, 0x0c0c07, 0x0b0c07, 0x0b0b06, 0x0b0b05, 0x0b0b06, 0x0b0b06, 0x0b0c06, 0x0b0b05, 0x0a0a05, 0x090a04, 0x090903, 0x080803, 0x080803, 0x070904, 0x070903, 0x060802, 0x050601, 0x050500, 0x050500, 0x040500, 0x040500, 0x040500, 0x030400, 0x030300, 0x030400, 0x020200, 0x020300, 0x030301, 0x030301, 0x030301, 0x020200, 0x020200, 0x010100, 0x010100, 0x020200, 0x020100, 0x020200, 0x030100, 0x020100, 0x010000, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x020202, 0x020202, 0x020202, 0x020202, 0x020300, 0x030400, 0x030400, 0x040500, 0x040500, 0x050601, 0x040500, 0x030500, 0x050701, 0x040601, 0x040600, 0x050602, 0x050703, 0x050702, 0x060802, 0x070803, 0x060702, 0x060803, 0x060803, 0x060803, 0x080a05, 0x080b05, 0x090a04, 0x0a0b05, 0x0a0c06, 0x0b0c06, 0x0b0c06, 0x0c0c05, 0x0d0c07, 0x0e0d08, 0x0e0f09, 0x0f100a, 0x101009, 0x121109, 0x12120a, 0x14120b, 0x16120b, 0x130f08, 0x120f07, 0x131108, 0x15120a, 0x16120c, 0x16130c, 0x16130c, 0x16130b, 0x16140b, 0x17140b, 0x17140b, 0x17130a, 0x17140e, 0x171410, 0x171310, 0x17120e, 0x17140f, 0x18140f, 0x17130f, 0x17130f, 0x17120f, 0x17120f, 0x18130f, 0x191410, 0x181310, 0x1a140f, 0x1a150d, 0x1a160c, 0x19150c, 0x19160b, 0x1a160c, 0x1a170d, 0x1a170d, 0x1a170c, 0x1b1610, 0x1b1611, 0x1b1610, 0x1c1713, 0x1e1814, 0x1f1a12, 0x201c12, 0x201c11, 0x201c10, 0x201b10, 0x231b12, 0x221911, 0x1f1810, 0x1f170f, 0x1e180f, 0x201810, 0x211811, 0x221a13, 0x231c14, 0x201d12, 0x201d12, 0x1f1a12, 0x1f1a12, 0x1e1910, 0x20180f, 0x20190f, 0x231c10, 0x231b0f, 0x231b10, 0x241e12, 0x231d12, 0x221c12, 0x201b10, 0x1d190e, 0x1b180e, 0x18150b, 0x14120a, 0x12110c, 0x0f0f0b, 0x0e0f0a, 0x0d0e09, 0x0c0d08, 0x0c0d07, 0x0d0c07, 0x0e0c07, 0x0d0c07, 0x0d0d08, 0x0d0d08, 0x0c0b06, 0x0c0b06, 0x0c0c07, 0x0c0c07, 0x0c0c07, 0x0c0c06, 0x0b0c06, 0x0a0b06, 0x0a0a04, 0x090903, 0x080802, 0x080a03, 0x070903, 0x060702, 0x060702, 0x050601, 0x050601, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x030501, 0x030500, 0x030400, 0x030301, 0x030301, 0x030301, 0x030301, 0x020201, 0x020200, 0x020200, 0x020200, 0x020200, 0x030300, 0x030200, 0x020100, 0x020100, 0x010100, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010001, 0x010101, 0x010101, 0x010101, 0x030302, 0x030302, 0x030201, 0x020201, 0x030400, 0x030500, 0x030401, 0x030500, 0x040600, 0x050701, 0x040601, 0x030501, 0x040600, 0x040600, 0x050601, 0x050602, 0x050602, 0x060702, 0x060702, 0x070803, 0x070903, 0x070903, 0x080904, 0x080904, 0x080904, 0x090a04, 0x0a0b05, 0x0b0b06, 0x0a0b06, 0x0a0b05, 0x0c0b06, 0x0d0d08, 0x0e0d08, 0x0e0d08, 0x0e0d08, 0x0e0e09, 0x0f0e0a, 0x100f0b, 0x11110d, 0x12110d, 0x14120a, 0x121208, 0x121206, 0x121206, 0x15120a, 0x16130d, 0x17140d, 0x17140d, 0x17140c, 0x17140c, 0x18130d, 0x18140c, 0x18130c, 0x17130d, 0x16140e, 0x18150f, 0x18140e, 0x18140c, 0x19150e, 0x19130f, 0x18140f, 0x18140f, 0x18140f, 0x19150f, 0x1b150f, 0x1b140f, 0x1a150f, 0x1a160d, 0x1b160e, 0x1b160d, 0x1b160d, 0x1a160d, 0x1b170e, 0x1c180f, 0x1b170e, 0x1b1710, 0x1b1612, 0x1c1712, 0x1d1814, 0x1e1913, 0x201b12, 0x231d12, 0x241e12, 0x251f12, 0x251e12, 0x231a12, 0x211912, 0x201911, 0x201911, 0x201811, 0x221912, 0x221a11, 0x231c14, 0x231e14, 0x211e13, 0x201d12, 0x1e1c12, 0x1e1b12, 0x1f1b10, 0x221b10, 0x221b10, 0x261e0f, 0x2b1d00, 0x231200, 0x2b2311, 0x271f14, 0x241d13, 0x221d11, 0x1f1a0f, 0x1b170c, 0x18160c, 0x15130b, 0x12100b, 0x110f0b, 0x110f0a, 0x100f09, 0x0f0e09, 0x0d0e08, 0x0c0d07, 0x0d0d08, 0x0d0d08, 0x0d0e08, 0x0d0d08, 0x0c0d07, 0x0c0d07, 0x0c0d07, 0x0d0d08, 0x0d0d07, 0x0e0d08, 0x0d0d07, 0x0c0d06, 0x0c0c05, 0x0b0a04, 0x0a0904, 0x090903, 0x080903, 0x070803, 0x060702, 0x050601, 0x050600, 0x040500, 0x040500, 0x040500, 0x040500, 0x040501, 0x040501, 0x040400, 0x040400, 0x040401, 0x030400, 0x030301, 0x030401, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x020300, 0x020100, 0x020201, 0x020200, 0x020100, 0x010100, 0x010100, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010200, 0x020200, 0x020201, 0x030301, 0x030301, 0x030501, 0x030500, 0x040501, 0x030601, 0x030500, 0x040601, 0x050701, 0x040601, 0x040601, 0x050601, 0x060702, 0x050601, 0x060602, 0x060702, 0x060803, 0x070803, 0x070903, 0x070904, 0x080a04, 0x090a04, 0x080803, 0x090a04, 0x0b0c06, 0x0c0c07, 0x0c0b07, 0x0b0b06, 0x0c0c07, 0x0d0e08, 0x0d0e07, 0x0e0d09, 0x0e0e09, 0x0e0e0a, 0x100f0a, 0x11100c, 0x12110e, 0x12120d, 0x121309, 0x121208, 0x131307, 0x131308, 0x16130a, 0x17140e, 0x18150e, 0x18150d, 0x17140d, 0x18140e, 0x18120e, 0x18130d, 0x18130d, 0x17140c, 0x16150c, 0x18150d, 0x18150c, 0x19160c, 0x19160c, 0x19160d, 0x19150c, 0x19160e, 0x19160e, 0x1b170d, 0x1d170e, 0x1d160c, 0x1b160d, 0x1a160d, 0x1b160f, 0x1c1810, 0x1c180f, 0x1c190f, 0x1c180f, 0x1d1910, 0x1d1810, 0x1c180f, 0x1b1610, 0x1d1712, 0x1d1812, 0x201911, 0x231a12, 0x271e12, 0x292114, 0x292115, 0x282115, 0x261f13, 0x241d13, 0x221c13, 0x211a12, 0x221b12, 0x231c13, 0x231d12, 0x241f14, 0x232115, 0x232114, 0x1f1e12, 0x1d1e11, 0x1e1d11, 0x201d11, 0x221e12, 0x231c11, 0x1d0c00, 0x685e44, 0x8f8668, 0x2d1c00, 0x291e11, 0x251e13, 0x231e12, 0x1f190e, 0x1c160c, 0x18150b, 0x15120b, 0x12110c, 0x13100b, 0x14100b, 0x130f0a, 0x0f0e09, 0x0d0f09, 0x0e0e09, 0x0e0d09, 0x0f0e0a, 0x0e0e09, 0x0d0e08, 0x0e0e09, 0x0e0e09, 0x0e0e09, 0x0e0e09, 0x0e0d07, 0x100f08, 0x100f07, 0x111006, 0x0f0e06, 0x0e0c04, 0x0d0b05, 0x0b0a06, 0x090904, 0x070803, 0x060701, 0x050601, 0x050601, 0x040501, 0x040501, 0x040601, 0x040600, 0x050601, 0x050702, 0x050601, 0x040501, 0x040500, 0x040500, 0x040500, 0x030500, 0x030500, 0x040500, 0x030400, 0x020400, 0x030500, 0x030400, 0x030300, 0x020300, 0x020200, 0x020100, 0x020101, 0x020100, 0x000001, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x010101, 0x010101, 0x020101, 0x020100, 0x030200, 0x020200, 0x020200, 0x020200, 0x020200, 0x030301, 0x030301, 0x030301, 0x020400, 0x030500, 0x040601, 0x050601, 0x040601, 0x040601, 0x060701, 0x060702, 0x060702, 0x060702, 0x060702, 0x070803, 0x060702, 0x060802, 0x070804, 0x070904, 0x080804, 0x070804, 0x080803, 0x090803, 0x080a04, 0x090a05, 0x0b0b05, 0x0c0c06, 0x0c0c07, 0x0c0c07, 0x0c0c07, 0x0d0d08, 0x0e0e08, 0x0f0f0a, 0x100f0b, 0x10100c, 0x12110d, 0x13120d, 0x15120e, 0x14120d, 0x15120b, 0x15120a, 0x151309, 0x16130b, 0x17140e, 0x17140e, 0x18140e, 0x18150e, 0x17140d, 0x18130c, 0x18130e, 0x19120e, 0x19130e, 0x18150e, 0x17170d, 0x19160d, 0x1b160d, 0x1b170e, 0x1b180f, 0x1a180e, 0x1a170c, 0x1b160c, 0x1a160d, 0x1d190f, 0x1d190f, 0x1c190d, 0x1c190d, 0x1b170d, 0x1c180e, 0x1e190f, 0x1d180f, 0x1e1a0f, 0x1e1b10, 0x1e1a11, 0x1e1a11, 0x1d1911, 0x1c1811, 0x1c1810, 0x1f1910, 0x241b12, 0x271f14, 0x292215, 0x2b2417, 0x2b2318, 0x292317, 0x262114, 0x242014, 0x252014, 0x241f13, 0x241e12, 0x241f12, 0x241f12, 0x242015, 0x242116, 0x242215, 0x222014, 0x201f13, 0x211f12, 0x231f12, 0x231f13, 0x231e10, 0x201601, 0x524a34, 0x746c52, 0x312002, 0x2e2112, 0x271e13, 0x231d12, 0x20190f, 0x1c150c, 0x18140b, 0x15120b, 0x15120c, 0x15120d, 0x15110c, 0x13100b, 0x110f0a, 0x110f0a, 0x100f09, 0x100f0b, 0x100f0a, 0x0e0f0a, 0x0e0f09, 0x0f0f0a, 0x100f0a, 0x0f0f0a, 0x0f0f09, 0x110e06, 0x140f04, 0x171103, 0x171002, 0x171203, 0x141105, 0x100d06, 0x0d0b05, 0x0a0904, 0x080803, 0x070702, 0x060701, 0x060802, 0x050701, 0x050701, 0x050602, 0x050701, 0x050701, 0x050702, 0x060701, 0x050701, 0x040601, 0x040500, 0x040500, 0x040500, 0x050501, 0x040501, 0x030500, 0x030501, 0x040500, 0x040400, 0x040500, 0x030400, 0x020200, 0x020200, 0x030200, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x010101, 0x020100, 0x020100, 0x020100, 0x020200, 0x010100, 0x010101, 0x020201, 0x030301, 0x040401, 0x030300, 0x030301, 0x030500, 0x050701, 0x050601, 0x050500, 0x040501, 0x050601, 0x060501, 0x060601, 0x060601, 0x060702, 0x060702, 0x050701, 0x060802, 0x060702, 0x070602, 0x080703, 0x080703, 0x090703, 0x090704, 0x090904, 0x090b05, 0x0b0c06, 0x0a0c05, 0x0b0b06, 0x0b0c06, 0x0b0c06, 0x0b0d07, 0x0d0d08, 0x0f0d0a, 0x100f0b, 0x10100c, 0x12120c, 0x14120c, 0x16130d, 0x16130e, 0x17130c, 0x17130c, 0x17140b, 0x18150a, 0x18150a, 0x18130d, 0x18130f, 0x18130f, 0x18130d, 0x18130d, 0x19150d, 0x19140d, 0x19130f, 0x191310, 0x18150f, 0x18160d, 0x1a160d, 0x1b160d, 0x1a160c, 0x1b170f, 0x1b170f, 0x1f180e, 0x251a0f, 0x21190e, 0x201910, 0x1f1b12, 0x1d1b10, 0x1d1a0e, 0x1d180e, 0x1e170e, 0x20180f, 0x20170f, 0x20190f, 0x201b12, 0x201b13, 0x1f1a13, 0x1e1913, 0x1d1913, 0x1e1912, 0x221a12, 0x271d14, 0x272115, 0x292317, 0x2b2518, 0x2a2217, 0x292216, 0x282216, 0x272215, 0x282316, 0x292413, 0x2b230c, 0x2b2105, 0x282010, 0x242014, 0x232215, 0x242115, 0x231f14, 0x211e12, 0x221f12, 0x241f13, 0x262014, 0x252013, 0x262011, 0x221704, 0x1c0900, 0x2f2413, 0x2c2213, 0x261f13, 0x221d12, 0x20190f, 0x1b160c, 0x18140c, 0x16130c, 0x16130c, 0x16120d, 0x15110c, 0x14100c, 0x141009, 0x141008, 0x131008, 0x131007, 0x111008, 0x0e0e09, 0x100e0a, 0x10100b, 0x0f0f0b, 0x100f09, 0x141109, 0x141107, 0x1b1606, 0x291a00, 0x331a00, 0x2b1d06, 0x1a1405, 0x110e04, 0x0f0b05, 0x0b0a05, 0x080803, 0x070702, 0x060702, 0x060702, 0x050701, 0x050601, 0x040601, 0x050701, 0x050601, 0x050702, 0x060702, 0x060802, 0x050801, 0x040600, 0x040600, 0x050601, 0x050601, 0x050602, 0x040601, 0x030501, 0x040500, 0x040500, 0x040500, 0x030400, 0x020200, 0x020100, 0x030200, 0x020200, 0x020200, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x010100, 0x020200, 0x020200, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x030301, 0x030301, 0x030301, 0x030301, 0x040500, 0x050601, 0x060701, 0x060702, 0x050702, 0x050701, 0x070702, 0x070702, 0x070602, 0x070602, 0x060702, 0x070903, 0x060803, 0x070804, 0x070803, 0x080703, 0x080703, 0x080803, 0x090904, 0x090905, 0x0a0b05, 0x0b0b06, 0x0c0c07, 0x0c0c07, 0x0c0c07, 0x0c0d07, 0x0b0d07, 0x0c0e08, 0x0d0e08, 0x0f0e0a, 0x10100b, 0x12110c, 0x15130c, 0x17130b, 0x18140d, 0x17140d, 0x18130b, 0x18150a, 0x18160a, 0x19160a, 0x18160a, 0x18150d, 0x191510, 0x18140f, 0x18140e, 0x18140c, 0x19160c, 0x19150e, 0x1a1611, 0x1b1612, 0x1a1710, 0x1a170e, 0x1c170f, 0x1c160f, 0x1c170e, 0x1b170f, 0x1b170f, 0x22190e, 0x392a1b, 0x2c2014, 0x21190f, 0x201c12, 0x1f1d11, 0x1f1b0f, 0x201a10, 0x201910, 0x20190f, 0x211911, 0x221b12, 0x201d12, 0x211e14, 0x211c14, 0x201c14, 0x1f1b14, 0x1f1c13, 0x251d13, 0x292117, 0x292217, 0x282418, 0x2a2418, 0x282116, 0x272115, 0x272216, 0x272317, 0x2b2518, 0x2a200b, 0x584f36, 0x797054, 0x241701, 0x252015, 0x242115, 0x242115, 0x232014, 0x221e13, 0x242013, 0x262013, 0x2a1f13, 0x271c0c, 0x29200f, 0x282011, 0x292013, 0x2a2214, 0x292114, 0x251f12, 0x211c10, 0x1f190e, 0x1c170d, 0x1a150c, 0x18140c, 0x17140d, 0x17130e, 0x17120d, 0x16110d, 0x15110a, 0x151108, 0x141109, 0x141108, 0x131009, 0x100f0b, 0x10100c, 0x10100b, 0x100f0a, 0x100f09, 0x121106, 0x141306, 0x171000, 0x66542c, 0xab9569, 0x5b492a, 0x151100, 0x120f04, 0x0f0c06, 0x0c0a05, 0x090903, 0x060702, 0x050701, 0x060903, 0x060803, 0x060802, 0x060702, 0x060702, 0x040802, 0x050702, 0x060702, 0x060702, 0x060802, 0x050701, 0x050701, 0x050601, 0x040601, 0x050701, 0x050701, 0x050601, 0x040501, 0x040500, 0x040500, 0x040400, 0x030400, 0x030300, 0x030200, 0x020200, 0x020200, 0x010100, 0x000000, 0x000100, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x020202, 0x020202, 0x020200, 0x020201, 0x030200, 0x020200, 0x020200, 0x020200, 0x020300, 0x030400, 0x040500, 0x040600, 0x050601, 0x060702, 0x060802, 0x050702, 0x050703, 0x060802, 0x060803, 0x070802, 0x080702, 0x080803, 0x060702, 0x070803, 0x070902, 0x060803, 0x070803, 0x070703, 0x090803, 0x0a0905, 0x090a05, 0x0a0b05, 0x0c0b06, 0x0c0c07, 0x0d0c07, 0x0d0c07, 0x0d0d08, 0x0d0d08, 0x0e0d09, 0x0e0e09, 0x0f0f0a, 0x100f0b, 0x11110b, 0x15120b, 0x18140b, 0x19150e, 0x1c150d, 0x20180d, 0x1e180c, 0x1c180c, 0x1b180d, 0x1c180c, 0x1a180c, 0x1a170f, 0x181610, 0x171610, 0x19160f, 0x19160f, 0x19160e, 0x1a170f, 0x1a1711, 0x1b1811, 0x1b1811, 0x1b170f, 0x1c1710, 0x1b170f, 0x1b170e, 0x1b1810, 0x1c1910, 0x221a0f, 0x322216, 0x291e12, 0x221c11, 0x211d12, 0x1f1d11, 0x201c10, 0x211d11, 0x1f1c10, 0x1f1b0f, 0x201c10, 0x211e12, 0x221f13, 0x232013, 0x221f15, 0x222014, 0x221f13, 0x221f13, 0x231f13, 0x262217, 0x282318, 0x282217, 0x272215, 0x262013, 0x262114, 0x272216, 0x272317, 0x2c2617, 0x312713, 0x41351c, 0x4c4128, 0x2b220f, 0x261f15, 0x252015, 0x272216, 0x262115, 0x252013, 0x252014, 0x282014, 0x251904, 0x695f48, 0x4d432e, 0x251d0b, 0x292014, 0x282014, 0x251f13, 0x231e12, 0x1f1c10, 0x1d1a0f, 0x1c180e, 0x1a170b, 0x1a160d, 0x18150f, 0x181510, 0x18140d, 0x18140c, 0x16140d, 0x17140e, 0x15120d, 0x12110c, 0x11110c, 0x11110c, 0x11100b, 0x10100b, 0x11100a, 0x121108, 0x131206, 0x151306, 0x1d1200, 0x766035, 0xb7a272, 0x5b4b29, 0x120f00, 0x121005, 0x0f0c07, 0x0b0a05, 0x080904, 0x070802, 0x070702, 0x070803, 0x070803, 0x080803, 0x070903, 0x080903, 0x060903, 0x070903, 0x060803, 0x070702, 0x060803, 0x060702, 0x060702, 0x060702, 0x050801, 0x050801, 0x050701, 0x040500, 0x040501, 0x040501, 0x040500, 0x040500, 0x030400, 0x040500, 0x030300, 0x020200, 0x020200, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x020101, 0x020203, 0x020201, 0x020200, 0x020200, 0x030400, 0x030400, 0x020400, 0x020500, 0x030500, 0x040601, 0x040601, 0x050801, 0x060802, 0x060702, 0x060802, 0x060702, 0x060803, 0x060803, 0x070703, 0x070702, 0x080703, 0x070803, 0x070803, 0x070803, 0x070903, 0x080903, 0x090a04, 0x090904, 0x090a04, 0x0a0b05, 0x0b0c07, 0x0c0c07, 0x0c0c07, 0x0d0d08, 0x0e0d08, 0x0e0d08, 0x0e0e09, 0x0e0e09, 0x0e0f0a, 0x100f0b, 0x10100b, 0x11100b, 0x14110a, 0x161209, 0x19140c, 0x1f170f, 0x2a1c0c, 0x2e1800, 0x2b1900, 0x281d0d, 0x21190f, 0x1d180e, 0x1a190d, 0x1a180f, 0x1a1710, 0x191710, 0x19170f, 0x1a1710, 0x1a1710, 0x1b1711, 0x1b1811, 0x1b1811, 0x1c1810, 0x1d1910, 0x1d1910, 0x1d1911, 0x1d1910, 0x1c1910, 0x1d1911, 0x1e1910, 0x201810, 0x211b11, 0x211e11, 0x211d12, 0x211d12, 0x211e12, 0x211e12, 0x1e1d10, 0x1f1e10, 0x201e11, 0x221f13, 0x231f13, 0x242015, 0x242115, 0x232014, 0x232014, 0x232013, 0x232114, 0x232216, 0x262217, 0x282116, 0x272215, 0x262014, 0x272115, 0x282218, 0x292418, 0x2d2517, 0x2f2616, 0x2d2513, 0x2b2411, 0x2c2719, 0x2b2319, 0x2b2116, 0x2c2114, 0x2b2111, 0x292012, 0x272012, 0x292013, 0x29200f, 0x433a26, 0x362e1a, 0x292211, 0x282013, 0x252013, 0x231f13, 0x201d11, 0x1f1b10, 0x1d1c0f, 0x1c190d, 0x1c170d, 0x1c180d, 0x1a160f, 0x1a1610, 0x19150c, 0x17140b, 0x16140e, 0x17140f, 0x16140e, 0x15140e, 0x13130e, 0x14130c, 0x12120a, 0x11120a, 0x111209, 0x121207, 0x151307, 0x171508, 0x201806, 0x382404, 0x412c00, 0x2c2304, 0x171403, 0x100e05, 0x0e0d06, 0x0b0a05, 0x090904, 0x090804, 0x080903, 0x080803, 0x080903, 0x090903, 0x090904, 0x080a04, 0x080a05, 0x070904, 0x080904, 0x070702, 0x060803, 0x060702, 0x060802, 0x060702, 0x050702, 0x050801, 0x050801, 0x050601, 0x040501, 0x050601, 0x050601, 0x040500, 0x030400, 0x030400, 0x030400, 0x020200, 0x020100, 0x020200, 0x020200, 0x020201, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x020200, 0x020201, 0x020202, 0x020201, 0x020200, 0x020300, 0x030400, 0x030400, 0x020400, 0x020500, 0x030500, 0x030501, 0x040600, 0x050701, 0x050701, 0x050602, 0x060802, 0x060903, 0x060902, 0x060803, 0x070803, 0x080803, 0x090804, 0x080804, 0x080904, 0x070903, 0x080903, 0x080904, 0x0a0904, 0x0a0a04, 0x0a0a05, 0x0b0c07, 0x0c0c07, 0x0c0d07, 0x0c0e07, 0x0d0e07, 0x0e0e08, 0x0f0e09, 0x0f0e0a, 0x0e0e0a, 0x0e0f0a, 0x100f0b, 0x11100c, 0x12110a, 0x151208, 0x161308, 0x18150b, 0x221a0c, 0x3e2f09, 0x83784e, 0x786d43, 0x3a2902, 0x22190b, 0x1d180d, 0x19180d, 0x1a1811, 0x1b1711, 0x1a1610, 0x1a160f, 0x1a1710, 0x1b1710, 0x1d1810, 0x1d1811, 0x1d1911, 0x1f1911, 0x1e1a11, 0x1f1a11, 0x1e1a11, 0x1e1a10, 0x1d1a0f, 0x1d1a0f, 0x1e1a12, 0x1e1912, 0x1f1c11, 0x201e11, 0x201e12, 0x222013, 0x222013, 0x222014, 0x201e12, 0x221f14, 0x231f12, 0x231b09, 0x1d1200, 0x272112, 0x252115, 0x252114, 0x252115, 0x242115, 0x232015, 0x232015, 0x262015, 0x261f15, 0x272115, 0x262115, 0x262115, 0x282317, 0x2b2317, 0x2d2417, 0x2d2517, 0x2b2517, 0x292517, 0x2b2719, 0x2e2518, 0x2e2314, 0x30220f, 0x281800, 0x2c2110, 0x282112, 0x282114, 0x2a2314, 0x262010, 0x262212, 0x272113, 0x252013, 0x231f12, 0x221f13, 0x201e12, 0x1f1c10, 0x1e1b0f, 0x1e1b0f, 0x1e190f, 0x1d190e, 0x1c190e, 0x1b170e, 0x19160c, 0x18140c, 0x17140e, 0x16140f, 0x16140f, 0x16140f, 0x15140e, 0x15150a, 0x141309, 0x13120a, 0x121209, 0x141207, 0x151307, 0x171408, 0x181407, 0x191404, 0x171302, 0x151404, 0x121104, 0x0f0e06, 0x0e0c07, 0x0c0a06, 0x0a0904, 0x0a0a05, 0x0a0a05, 0x0a0b04, 0x090b04, 0x090a03, 0x090a04, 0x080a04, 0x080904, 0x080903, 0x070903, 0x060803, 0x060802, 0x050701, 0x050701, 0x060701, 0x060702, 0x050701, 0x050601, 0x050601, 0x050601, 0x050701, 0x050701, 0x050601, 0x030500, 0x020500, 0x030400, 0x030200, 0x020200, 0x010200, 0x020300, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x020200, 0x020200, 0x030201, 0x020202, 0x010201, 0x020300, 0x030400, 0x030500, 0x030500, 0x030500, 0x030500, 0x030600, 0x040601, 0x050701, 0x050701, 0x050701, 0x050701, 0x060902, 0x060902, 0x060902, 0x070902, 0x090904, 0x090904, 0x090904, 0x090904, 0x090a04, 0x080a03, 0x080b03, 0x090b05, 0x0a0b05, 0x0b0c06, 0x0c0d07, 0x0d0d08, 0x0d0d08, 0x0c0e07, 0x0d0e06, 0x0e0f08, 0x0f0f09, 0x0f0f0a, 0x100f0a, 0x100f0b, 0x0f100b, 0x10100b, 0x11110b, 0x121209, 0x151307, 0x161407, 0x18160a, 0x231907, 0x544712, 0xded9a7, 0xcfc998, 0x433100, 0x22180a, 0x1f190f, 0x1d190d, 0x1c1812, 0x1c1713, 0x1c1612, 0x1c1710, 0x1c1711, 0x1c1810, 0x1d1910, 0x1f1a11, 0x1f1a11, 0x201a12, 0x211a11, 0x221b11, 0x211b12, 0x1f1b12, 0x1f1b10, 0x1f1b0f, 0x201a0f, 0x201a10, 0x201d11, 0x211f12, 0x222014, 0x242215, 0x242115, 0x252115, 0x231f14, 0x251f16, 0x211a09, 0x464030, 0x6a6452, 0x241c03, 0x262014, 0x262014, 0x272215, 0x242214, 0x242114, 0x252114, 0x282116, 0x292117, 0x292318, 0x292317, 0x292215, 0x2a2215, 0x2c2316, 0x2b2415, 0x2a2618, 0x2b2718, 0x2c2617, 0x2e2718, 0x2d2516, 0x2c2210, 0x4a3f29, 0x7a735c, 0x2d2207, 0x282212, 0x282214, 0x292314, 0x272314, 0x252313, 0x242113, 0x242014, 0x231f13, 0x211f12, 0x1f1f12, 0x1f1d11, 0x1f1b10, 0x1e1b0f, 0x1f1b10, 0x1f1b10, 0x1d1a0e, 0x1b190d, 0x19170c, 0x19150d, 0x19160f, 0x191611, 0x181610, 0x181710, 0x18160f, 0x18160a, 0x161509, 0x161309, 0x151407, 0x151207, 0x161207, 0x161307, 0x161308, 0x151208, 0x141207, 0x111207, 0x0f0e05, 0x0e0e07, 0x0d0d08, 0x0c0c06, 0x0b0b05, 0x0b0c06, 0x0b0c06, 0x0c0d05, 0x0b0d05, 0x0b0c04, 0x0a0c05, 0x090b04, 0x080903, 0x080903, 0x080803, 0x070803, 0x060802, 0x060802, 0x060802, 0x060802, 0x060802, 0x050701, 0x040601, 0x050601, 0x050701, 0x050801, 0x050801, 0x050701, 0x040600, 0x040701, 0x030500, 0x030400, 0x020200, 0x020200, 0x020300, 0x020200, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x030200, 0x020100, 0x020101, 0x020300, 0x030401, 0x030500, 0x020500, 0x020500, 0x030500, 0x030500, 0x040601, 0x050701, 0x050601, 0x060702, 0x050701, 0x060802, 0x060902, 0x060802, 0x070903, 0x090904, 0x0a0905, 0x0a0a05, 0x0a0905, 0x090a04, 0x0a0c05, 0x0a0c05, 0x090c05, 0x0a0c05, 0x0a0c06, 0x0b0c07, 0x0c0e08, 0x0c0e09, 0x0d0e08, 0x0e0e08, 0x0f0f08, 0x100f09, 0x110f0a, 0x12100b, 0x11100d, 0x12110d, 0x11110c, 0x13120c, 0x14120b, 0x151209, 0x17130a, 0x18150a, 0x1a180c, 0x251e0b, 0x463913, 0x847b4f, 0x7d7348, 0x382902, 0x251c0e, 0x201b0f, 0x1f1b0e, 0x1d1910, 0x1e1811, 0x1d1811, 0x1d1912, 0x1d1812, 0x1e1911, 0x1f1a11, 0x201b13, 0x1f1c12, 0x201c13, 0x221c12, 0x221b12, 0x221b11, 0x201c12, 0x1f1c11, 0x1e1b10, 0x1e1c0f, 0x1f1c10, 0x201d12, 0x211e12, 0x242015, 0x262117, 0x262116, 0x262315, 0x262215, 0x262116, 0x211808, 0x4a4637, 0x746f5e, 0x201700, 0x241e12, 0x262014, 0x272215, 0x272214, 0x282215, 0x272216, 0x292217, 0x2b2418, 0x2c2418, 0x2b2418, 0x2b2317, 0x2b2416, 0x2c2517, 0x2b2516, 0x2b2618, 0x2a2719, 0x2c2617, 0x2d2619, 0x2c2417, 0x2b2413, 0x3d331c, 0x534833, 0x2c220e, 0x272112, 0x272114, 0x262214, 0x242212, 0x242212, 0x242113, 0x242014, 0x232014, 0x212013, 0x201f12, 0x201d12, 0x1f1c11, 0x1f1c10, 0x1f1c11, 0x201c11, 0x1e1b10, 0x1c1b0f, 0x1c1a0e, 0x1b180f, 0x1a1811, 0x1a1912, 0x191812, 0x1a1811, 0x191710, 0x19160b, 0x181609, 0x171509, 0x161408, 0x171208, 0x161309, 0x151209, 0x14120b, 0x13110b, 0x110f09, 0x100f09, 0x0f0e08, 0x0e0d08, 0x0e0d07, 0x0d0c07, 0x0c0d07, 0x0c0d07, 0x0c0e07, 0x0c0e07, 0x0b0d06, 0x0c0d06, 0x0b0c05, 0x090a05, 0x080903, 0x080903, 0x090904, 0x080904, 0x070904, 0x070803, 0x070802, 0x070903, 0x070903, 0x070703, 0x050601, 0x050601, 0x050600, 0x040701, 0x040701, 0x040601, 0x030500, 0x030500, 0x040600, 0x030500, 0x020400, 0x020300, 0x020300, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010100, 0x030200, 0x030200, 0x020200, 0x010200, 0x010200, 0x030400, 0x030501, 0x020500, 0x030500, 0x030500, 0x030500, 0x040600, 0x040601, 0x050601, 0x050701, 0x060802, 0x060802, 0x060802, 0x060902, 0x070803, 0x090a04, 0x0a0a04, 0x0b0a05, 0x0b0b06, 0x0a0a05, 0x0a0b05, 0x0b0d06, 0x0b0d06, 0x0b0d06, 0x0b0e07, 0x0b0d07, 0x0c0d07, 0x0d0e09, 0x0d0e09, 0x0e0f09, 0x100e09, 0x110e0a, 0x110f0a, 0x120f0a, 0x12100b, 0x12110d, 0x15130d, 0x15130d, 0x16140c, 0x17130a, 0x18140a, 0x18150b, 0x1b160d, 0x1b180d, 0x1e1b0d, 0x281f0b, 0x281400, 0x261500, 0x271f0c, 0x221c10, 0x211b10, 0x211b0f, 0x1d1b0f, 0x1d1a10, 0x1e1a11, 0x1f1a11, 0x1e1911, 0x1f1912, 0x211b12, 0x221c14, 0x211d13, 0x221e12, 0x231c11, 0x231c12, 0x211d12, 0x201d12, 0x201e12, 0x201d11, 0x1f1d11, 0x1f1e11, 0x211e13, 0x241f15, 0x272017, 0x272219, 0x272318, 0x292518, 0x282516, 0x282315, 0x292216, 0x221a0a, 0x170c00, 0x272013, 0x251e14, 0x272015, 0x292215, 0x2b2316, 0x2d2419, 0x2d251a, 0x2d261a, 0x2e261a, 0x2f251a, 0x30261a, 0x2f2519, 0x2e2519, 0x2e261a, 0x2d271a, 0x2d2719, 0x2c2619, 0x2b2618, 0x2c2516, 0x2d2517, 0x2b2416, 0x2b2312, 0x291d0a, 0x2b2012, 0x271f13, 0x272216, 0x262215, 0x262213, 0x252314, 0x242215, 0x252115, 0x252115, 0x242115, 0x221f13, 0x211e12, 0x211d11, 0x211d12, 0x211e12, 0x211d12, 0x201d11, 0x1e1c10, 0x1e1b10, 0x1d1b11, 0x1e1b11, 0x1d1b11, 0x1d1a11, 0x1c190f, 0x1b180e, 0x19190c, 0x18180b, 0x18160a, 0x17150a, 0x17130b, 0x16120c, 0x15120c, 0x13120d, 0x12110c, 0x110f0b, 0x0f0e0a, 0x0e0e09, 0x0d0d08, 0x0d0e08, 0x0d0e08, 0x0e0f09, 0x0d0e08, 0x0c0d07, 0x0c0e08, 0x0b0e08, 0x0b0d08, 0x0a0c07, 0x0b0c06, 0x0b0b06, 0x0a0b05, 0x090903, 0x090904, 0x090804, 0x090904, 0x070802, 0x070902, 0x070803, 0x090703, 0x070602, 0x060601, 0x050701, 0x050601, 0x060701, 0x050600, 0x030600, 0x040600, 0x030600, 0x030600, 0x030400, 0x020200, 0x020300, 0x020300, 0x020100, 0x010100, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000101, 0x010101, 0x010101, 0x000101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x020100, 0x030200, 0x020200, 0x020200, 0x010200, 0x020200, 0x030400, 0x030500, 0x030500, 0x030500, 0x040600, 0x040600, 0x050701, 0x040701, 0x050601, 0x060701, 0x060702, 0x060802, 0x060903, 0x060802, 0x070903, 0x090a03, 0x0b0b05, 0x0c0b07, 0x0c0c07, 0x0c0c07, 0x0b0c07, 0x0c0d07, 0x0c0e07, 0x0c0e08, 0x0d0e08, 0x0c0e08, 0x0d0f09, 0x0e0f09, 0x0f0f09, 0x10100a, 0x120f09, 0x110f0a, 0x120f0b, 0x13100b, 0x13100b, 0x14120c, 0x17140c, 0x18140c, 0x18150b, 0x18150a, 0x19150a, 0x1b160c, 0x1e170e, 0x1e190d, 0x1b1a0d, 0x1a1a0d, 0x1e1b0d, 0x1f1b0e, 0x1f1c10, 0x1f1c12, 0x211a11, 0x221b10, 0x201b11, 0x201b11, 0x201b11, 0x1f1a11, 0x201a12, 0x211b14, 0x231b14, 0x241b13, 0x241c13, 0x241c12, 0x231b11, 0x231c11, 0x241d12, 0x231e13, 0x221f13, 0x221f13, 0x231e13, 0x221f13, 0x232015, 0x262217, 0x2a2318, 0x2b2419, 0x2b251a, 0x2c2619, 0x2c2618, 0x2b2416, 0x2a2417, 0x292217, 0x282117, 0x292017, 0x282016, 0x282116, 0x2b2414, 0x2c2411, 0x2b2410, 0x302918, 0x31291a, 0x32291b, 0x34291b, 0x35291c, 0x34291c, 0x32271b, 0x30271a, 0x2f271b, 0x2d271a, 0x2e271a, 0x2d271a, 0x2b2518, 0x2b2517, 0x2a2416, 0x2b2417, 0x2a2114, 0x2e2215, 0x2c2217, 0x2a2317, 0x292316, 0x292316, 0x282416, 0x272316, 0x272216, 0x282216, 0x262115, 0x242015, 0x252015, 0x271d14, 0x241b11, 0x211a0f, 0x1e1a0d, 0x1b1707, 0x110f00, 0x050300, 0x030300, 0x090600, 0x070400, 0x000000, 0x000100, 0x060800, 0x0d0f00, 0x141406, 0x19180b, 0x19170b, 0x18140a, 0x17130a, 0x16130c, 0x14120d, 0x12110d, 0x11100c, 0x0f0e0a, 0x0e0e09, 0x0e0f09, 0x0d0f09, 0x0e0f0a, 0x0f0f0a, 0x0e0f0a, 0x0e0f08, 0x0d0e08, 0x0c0e08, 0x0b0d07, 0x0a0c06, 0x0a0b05, 0x0a0a05, 0x090a05, 0x090904, 0x090904, 0x0a0904, 0x090904, 0x080a03, 0x080a03, 0x080903, 0x080803, 0x070803, 0x060802, 0x060802, 0x070802, 0x070802, 0x050801, 0x040701, 0x040600, 0x030600, 0x030500, 0x030400, 0x020300, 0x030300, 0x020200, 0x020200, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000001, 0x000000, 0x020100, 0x020100, 0x020200, 0x020200, 0x020300, 0x030400, 0x030300, 0x020300, 0x030500, 0x030500, 0x040601, 0x050600, 0x050601, 0x040601, 0x040600, 0x050702, 0x070803, 0x070a03, 0x070902, 0x070803, 0x090a03, 0x0a0b03, 0x0b0c06, 0x0c0c07, 0x0d0d07, 0x0d0c08, 0x0d0d08, 0x0e0e08, 0x0d0e08, 0x0e0e09, 0x0e0e0a, 0x0d0f09, 0x0e100a, 0x0e0f09, 0x101009, 0x10100a, 0x120f0b, 0x130f0b, 0x12100b, 0x13110c, 0x15120d, 0x16120c, 0x18130d, 0x19150e, 0x1a160b, 0x1c170b, 0x1e160c, 0x1e170c, 0x1e170c, 0x1d180c, 0x1b1a0e, 0x1b1a0f, 0x1b190f, 0x1c1912, 0x1f1b14, 0x211b14, 0x231a13, 0x221b12, 0x231c12, 0x241b12, 0x231a11, 0x221b12, 0x221a12, 0x231a13, 0x241b14, 0x241b12, 0x251d13, 0x251c13, 0x251b12, 0x251c12, 0x251d13, 0x251d14, 0x261e14, 0x261e14, 0x261e14, 0x261f15, 0x272015, 0x292318, 0x2b251a, 0x2c261a, 0x2d261a, 0x2f2619, 0x2f2719, 0x2f2619, 0x2e2619, 0x2c2418, 0x2c2219, 0x292117, 0x282116, 0x292116, 0x2b2414, 0x36311c, 0x504a33, 0x302812, 0x332a18, 0x352c1a, 0x372d1b, 0x372c1b, 0x362b1c, 0x362b1e, 0x352a1f, 0x32291c, 0x2f281a, 0x2e261a, 0x2d2619, 0x2c2617, 0x2b2517, 0x2b2517, 0x2b2515, 0x2b2516, 0x2e2417, 0x2d2318, 0x2a2216, 0x292217, 0x2a2216, 0x2a2315, 0x272316, 0x282316, 0x292217, 0x272317, 0x252316, 0x242013, 0x231b0f, 0x251d14, 0x2a2820, 0x30322c, 0x3f433c, 0x4e534a, 0x63675d, 0x6a695f, 0x6f6c61, 0x736c5f, 0x766b5d, 0x6b5f52, 0x574f42, 0x453e32, 0x2a251a, 0x0a0800, 0x0d0b00, 0x161407, 0x18150c, 0x17130c, 0x15120d, 0x12110c, 0x10100c, 0x10100b, 0x0f0f09, 0x0e0f09, 0x0e0f0a, 0x0f0f0a, 0x100f0a, 0x10100a, 0x0f0f09, 0x0d0d08, 0x0c0c07, 0x0b0c06, 0x0b0c06, 0x0b0b05, 0x0b0b06, 0x0a0a06, 0x090a04, 0x090904, 0x0a0904, 0x0a0904, 0x080a04, 0x070903, 0x070a03, 0x070803, 0x060803, 0x060802, 0x060701, 0x060802, 0x070802, 0x050701, 0x040601, 0x040601, 0x030500, 0x020400, 0x030400, 0x020300, 0x030400, 0x030300, 0x020100, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010001, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020100, 0x020200, 0x020200, 0x020300, 0x030500, 0x030400, 0x020300, 0x030501, 0x040600, 0x040601, 0x050701, 0x060701, 0x050601, 0x050600, 0x060702, 0x060902, 0x060902, 0x070903, 0x070a03, 0x0a0b04, 0x0b0c05, 0x0c0c07, 0x0c0d08, 0x0d0e08, 0x0e0f09, 0x0f1009, 0x11100a, 0x11100a, 0x12100a, 0x110f0a, 0x0f100a, 0x0f100a, 0x101009, 0x101007, 0x101007, 0x12100b, 0x13100b, 0x14110c, 0x16120d, 0x17130d, 0x17130d, 0x18150e, 0x1b170f, 0x1c190d, 0x1f190d, 0x20190f, 0x20190f, 0x1f190e, 0x1e1a0e, 0x1e1b10, 0x1e1b10, 0x1c190e, 0x1d1a11, 0x221a13, 0x231a13, 0x231a14, 0x241c14, 0x251d14, 0x251c15, 0x251c15, 0x241b14, 0x231b13, 0x241a13, 0x241b13, 0x251e13, 0x262014, 0x271f15, 0x271f14, 0x271f15, 0x271f15, 0x281f16, 0x281f16, 0x292017, 0x292017, 0x292016, 0x292117, 0x2c2419, 0x2e261b, 0x2e271b, 0x2e261b, 0x30281a, 0x31281b, 0x31271b, 0x31281b, 0x302719, 0x2f251a, 0x2c2319, 0x2b2418, 0x2a2416, 0x2b2515, 0x302a18, 0x413b27, 0x322915, 0x342a19, 0x372d1c, 0x3a2e1d, 0x3a2e1d, 0x392d1d, 0x3a2e1f, 0x392d20, 0x362c1e, 0x312719, 0x2b2214, 0x261d0d, 0x221a05, 0x1a1100, 0x1b1300, 0x1e1700, 0x201800, 0x211400, 0x1c0800, 0x1e1000, 0x221b0c, 0x282014, 0x2a2317, 0x282316, 0x272215, 0x272115, 0x221e0f, 0x232518, 0x353a31, 0x3c413b, 0x4a4f4a, 0x4f564f, 0x505853, 0x515a54, 0x575f58, 0x626660, 0x706f67, 0x817d74, 0x8e887c, 0x998d7f, 0xa59687, 0xa69784, 0xa09280, 0x908374, 0x70675a, 0x524c42, 0x272317, 0x000000, 0x0f0d04, 0x15120d, 0x12110c, 0x11100b, 0x11110c, 0x11100c, 0x11110c, 0x10110c, 0x10110b, 0x10100b, 0x10100b, 0x0f0f09, 0x0e0e09, 0x0d0d07, 0x0c0c07, 0x0c0c07, 0x0d0c07, 0x0c0b06, 0x0b0b05, 0x0a0a05, 0x0a0a05, 0x0a0904, 0x090904, 0x090a04, 0x070902, 0x070903, 0x070904, 0x070903, 0x070903, 0x060802, 0x060802, 0x070802, 0x060802, 0x050701, 0x050701, 0x040500, 0x030400, 0x030400, 0x020300, 0x020300, 0x030200, 0x010100, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x010101, 0x020202, 0x020200, 0x020200, 0x020200, 0x020300, 0x020400, 0x040500, 0x040500, 0x030500, 0x030500, 0x040600, 0x040600, 0x050701, 0x050701, 0x060701, 0x060701, 0x060702, 0x060702, 0x060802, 0x080903, 0x090905, 0x0a0a05, 0x0b0b06, 0x0c0c07, 0x0d0d08, 0x0e0f08, 0x101108, 0x111208, 0x121209, 0x101109, 0x0f1009, 0x0f0f0a, 0x100f0a, 0x12100a, 0x13110a, 0x12110b, 0x13110b, 0x14110c, 0x15120c, 0x16130d, 0x18140e, 0x18150e, 0x18150e, 0x1a170f, 0x1c190f, 0x1d1c10, 0x1f1c10, 0x1f1c10, 0x1e1c10, 0x1d1a0e, 0x1e1a10, 0x1f1b12, 0x1e1a11, 0x1d1a0f, 0x1e1b11, 0x201a13, 0x221a12, 0x231a12, 0x241c13, 0x241e14, 0x251e15, 0x261f15, 0x272016, 0x272015, 0x272016, 0x272016, 0x282116, 0x272115, 0x282216, 0x292217, 0x292017, 0x282017, 0x292017, 0x292117, 0x281f16, 0x2a2118, 0x2a2118, 0x2b2218, 0x2e251b, 0x2f261c, 0x2f271c, 0x2f271c, 0x31291d, 0x332a1d, 0x332a1d, 0x32291c, 0x312a1b, 0x30271a, 0x2e2519, 0x2d2518, 0x2d2418, 0x2c2417, 0x2c2515, 0x2d2614, 0x322a19, 0x352b1b, 0x3a2f1e, 0x3b2f1f, 0x3e3221, 0x3c3021, 0x382e1f, 0x3d3427, 0x3e372a, 0x423c31, 0x4d493f, 0x5f5b51, 0x6f6b60, 0x7f7c70, 0x817b6c, 0x837e6d, 0x888270, 0x8b8575, 0x8a8577, 0x706a5e, 0x514c41, 0x383126, 0x231804, 0x1e1401, 0x272216, 0x2e2a21, 0x424038, 0x5b5b53, 0x606158, 0x616055, 0x58554a, 0x555044, 0x5e5648, 0x554d40, 0x494236, 0x3f382f, 0x312c24, 0x231e17, 0x332f2a, 0x514b44, 0x6d645c, 0x877d71, 0x928679, 0x867c6e, 0x877c6f, 0x8e8274, 0x877d70, 0x6a6257, 0x302a21, 0x000000, 0x0f0f09, 0x14130e, 0x13130e, 0x13120e, 0x13130d, 0x13130c, 0x11110b, 0x11110b, 0x10100a, 0x0f0f09, 0x0d0e08, 0x0d0d08, 0x0c0c07, 0x0c0b07, 0x0b0c06, 0x0a0b05, 0x0b0c06, 0x0b0c06, 0x0c0b07, 0x0a0a05, 0x090a04, 0x080a04, 0x080903, 0x070903, 0x070903, 0x080903, 0x070903, 0x070803, 0x070903, 0x070802, 0x060802, 0x030500, 0x040601, 0x030500, 0x030400, 0x020400, 0x020301, 0x030200, 0x020200, 0x020100, 0x020200, 0x010200, 0x010101, 0x010101, 0x010102, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010201, 0x020202, 0x020200, 0x020200, 0x020201, 0x020300, 0x030400, 0x040500, 0x040500, 0x040500, 0x030500, 0x030600, 0x040500, 0x050701, 0x050701, 0x060702, 0x070802, 0x060802, 0x070803, 0x080904, 0x090904, 0x0a0905, 0x0a0a06, 0x0b0c07, 0x0c0d07, 0x0e0e09, 0x0f1008, 0x111208, 0x121307, 0x121307, 0x111309, 0x12120b, 0x12120c, 0x13110c, 0x14120c, 0x14120c, 0x16120c, 0x16130c, 0x16130c, 0x17140d, 0x19150e, 0x19170f, 0x1a1710, 0x1b1811, 0x1c1811, 0x1f1a11, 0x211c11, 0x201c10, 0x1f1c10, 0x1f1c10, 0x1f1c11, 0x1f1b12, 0x1f1913, 0x1e1912, 0x1e1b12, 0x1e1b12, 0x201b12, 0x211a11, 0x221b11, 0x211e12, 0x222014, 0x232014, 0x252215, 0x282317, 0x2a2317, 0x2a2317, 0x2a2317, 0x2a2417, 0x2a2216, 0x2a2217, 0x2a2218, 0x292117, 0x2b2119, 0x2b2219, 0x2b2318, 0x2a2118, 0x2a1f18, 0x2a2118, 0x2d231a, 0x2e251b, 0x2f251c, 0x2f251c, 0x2f261c, 0x30271c, 0x332a1d, 0x342a1e, 0x332b1c, 0x332a1b, 0x30271a, 0x2f2519, 0x302518, 0x2f2519, 0x2e2618, 0x2f2617, 0x32281a, 0x332a1b, 0x332b19, 0x382d1b, 0x382f1d, 0x382f1d, 0x4b4539, 0x5d594e, 0x57554a, 0x514f44, 0x505046, 0x4f4f45, 0x59574e, 0x5c5b52, 0x6d6a61, 0x777365, 0x928b7c, 0xa49e8c, 0xa19d8c, 0x9a9789, 0x999588, 0x9a968b, 0x8d8a7f, 0x797368, 0x7d7364, 0x908271, 0x988777, 0x9b8b7c, 0xa19483, 0xa49580, 0xa79680, 0xa5917a, 0xa18b71, 0xa48c72, 0x9c846b, 0x8d755b, 0x876e56, 0x77624b, 0x645340, 0x483b2c, 0x20150a, 0x241b14, 0x443c34, 0x756b62, 0x92897c, 0x978d7f, 0x95897a, 0x918376, 0x938577, 0x918576, 0x675e54, 0x181811, 0x030200, 0x17150f, 0x16140e, 0x15150c, 0x131307, 0x141107, 0x13110b, 0x11100b, 0x0f0f0a, 0x0f0f0a, 0x0d0e08, 0x0d0e08, 0x0c0d08, 0x0c0c07, 0x0b0c06, 0x0c0c06, 0x0c0c07, 0x0b0c06, 0x0a0b06, 0x090b05, 0x090a04, 0x080a04, 0x090a04, 0x080a03, 0x080a03, 0x080904, 0x070803, 0x070803, 0x060802, 0x050702, 0x030500, 0x040600, 0x030500, 0x030500, 0x030400, 0x030300, 0x030200, 0x030200, 0x020200, 0x020200, 0x020200, 0x020100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x020302, 0x020200, 0x030300, 0x020200, 0x030300, 0x040500, 0x030500, 0x040500, 0x040500, 0x040601, 0x050801, 0x050701, 0x050601, 0x050701, 0x050701, 0x070802, 0x070803, 0x060803, 0x080904, 0x0a0904, 0x0a0a05, 0x0c0b07, 0x0d0d08, 0x0e0e09, 0x0e1009, 0x111209, 0x12130a, 0x13140a, 0x151509, 0x151409, 0x15130a, 0x16130c, 0x16130c, 0x16130d, 0x16130e, 0x16120d, 0x16130d, 0x17140d, 0x18140e, 0x19160d, 0x1a170e, 0x1b180f, 0x1b1810, 0x1e1911, 0x211910, 0x231c12, 0x211e12, 0x201d11, 0x201c10, 0x211c11, 0x201a13, 0x1e1913, 0x1e1a14, 0x1f1b14, 0x1e1b12, 0x1d1b10, 0x1e1a12, 0x1f1a13, 0x1f1d10, 0x1e1b0c, 0x211e12, 0x242014, 0x292317, 0x2a2317, 0x292114, 0x292114, 0x2a2316, 0x2c2418, 0x2c2319, 0x2b2118, 0x2a2118, 0x2b2219, 0x2c231a, 0x2c2219, 0x2c2219, 0x2b2119, 0x2b2119, 0x2d2219, 0x2f251c, 0x2f251d, 0x30241c, 0x2f231b, 0x2f231b, 0x35271c, 0x34281b, 0x332719, 0x2f2416, 0x2b2113, 0x261e10, 0x271b0c, 0x261b0c, 0x271c09, 0x2a1f0b, 0x312715, 0x39301f, 0x453b2c, 0x504531, 0x574d39, 0x675e4c, 0x776d5e, 0x766c5d, 0x756b5b, 0x736859, 0x726756, 0x6c6251, 0x5f5547, 0x4c4436, 0x393126, 0x312b22, 0x39332a, 0x565248, 0x6f6b62, 0x79756d, 0x7e7a71, 0x7f7c74, 0x807d74, 0x888178, 0x9a8f83, 0xaf9e8d, 0xb09780, 0xab8f74, 0xad9174, 0xae9272, 0xae906f, 0xb39576, 0xb89774, 0xba9872, 0xb5926d, 0xb5906c, 0xb38f6a, 0xb08e6b, 0xac8c6b, 0xa48768, 0x8b745d, 0x665343, 0x3f3025, 0x352920, 0x54493e, 0x82776b, 0x9e9082, 0x98897b, 0x8c7e71, 0x877768, 0x908274, 0x847b6f, 0x433e35, 0x000000, 0x18150d, 0x17140b, 0x151307, 0x141207, 0x13110a, 0x12100b, 0x0f0f0a, 0x0e0f0a, 0x0d0d09, 0x0d0e09, 0x0d0d08, 0x0d0e09, 0x0c0d07, 0x0c0d07, 0x0c0b07, 0x0b0b06, 0x0b0b05, 0x090a05, 0x080903, 0x090a04, 0x0a0b05, 0x090a04, 0x090a04, 0x080903, 0x080904, 0x070803, 0x060702, 0x060702, 0x050602, 0x050701, 0x040500, 0x030400, 0x040400, 0x030400, 0x030200, 0x030100, 0x020200, 0x020200, 0x030301, 0x030301, 0x020200, 0x010100, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x030302, 0x020201, 0x030300, 0x020200, 0x030400, 0x040500, 0x040500, 0x030500, 0x030500, 0x050601, 0x060701, 0x050702, 0x040601, 0x050602, 0x060702, 0x070803, 0x070804, 0x070803, 0x080904, 0x0a0906, 0x0b0b06, 0x0c0c07, 0x0d0d08, 0x0f0e0a, 0x10110a, 0x12120a, 0x13140b, 0x14140b, 0x17160a, 0x181609, 0x171509, 0x16140a, 0x16130c, 0x16130c, 0x16130e, 0x18150f, 0x18150e, 0x191510, 0x1a160f, 0x1c170e, 0x1c180e, 0x1d190d, 0x1e1a0e, 0x1f190f, 0x211a0f, 0x231c12, 0x221d11, 0x211c11, 0x211c10, 0x201a10, 0x201a12, 0x1e1912, 0x1e1915, 0x1f1b16, 0x1b160e, 0x181307, 0x170f02, 0x160e04, 0x24221c, 0x373631, 0x252119, 0x231d0e, 0x251c0b, 0x281f13, 0x322a1e, 0x362d22, 0x31291e, 0x281e0f, 0x201301, 0x261a0e, 0x2d2219, 0x2e2219, 0x2b2118, 0x2a1f17, 0x271d14, 0x261b12, 0x23180e, 0x231a0f, 0x231910, 0x21160e, 0x251912, 0x291c15, 0x30241a, 0x3c2c20, 0x423325, 0x4d3e30, 0x5d4d3d, 0x635343, 0x685c4b, 0x736653, 0x7c6c59, 0x867662, 0x907f6c, 0x9a8b74, 0x9d8d76, 0xa6957d, 0xae9b81, 0xb4a187, 0xb5a388, 0xb5a088, 0xb39d85, 0xb39d84, 0xad957b, 0xa88f73, 0xa48b6f, 0xa48d70, 0xa58e70, 0x9f886a, 0x867157, 0x64523d, 0x35271b, 0x342e27, 0x4e473f, 0x6b645d, 0x7a736b, 0x7e766e, 0x857d75, 0x887f76, 0x93877a, 0xa2907f, 0xb0967f, 0xb59371, 0xbb966f, 0xbd9973, 0xc19e79, 0xc29c74, 0xc49d73, 0xbf966d, 0xb48861, 0xbd9269, 0xbb926a, 0xba936c, 0xba9671, 0xb99877, 0xad8d6e, 0x9a7c60, 0x6f5a44, 0x403123, 0x3d2e22, 0x675a4e, 0x928576, 0x948576, 0x88786a, 0x877869, 0x908171, 0x8e8273, 0x565048, 0x000000, 0x17150a, 0x161408, 0x161108, 0x14100b, 0x13110c, 0x10100b, 0x0f0f0a, 0x0e0e09, 0x0e0f0a, 0x0e0f0a, 0x0f0f0a, 0x0d0e08, 0x0c0d06, 0x0c0c07, 0x0b0b06, 0x0b0b06, 0x0b0a04, 0x0a0a04, 0x0a0a05, 0x0a0b05, 0x0a0a04, 0x0a0803, 0x080903, 0x080a03, 0x080903, 0x060702, 0x050702, 0x060703, 0x050701, 0x040601, 0x040500, 0x030400, 0x030300, 0x040301, 0x030200, 0x030200, 0x030200, 0x030301, 0x030401, 0x030301, 0x020100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010201, 0x020201, 0x030201, 0x020200, 0x030300, 0x030301, 0x030401, 0x040500, 0x030500, 0x040500, 0x030500, 0x040601, 0x060702, 0x060802, 0x050601, 0x050601, 0x060702, 0x060803, 0x080804, 0x070903, 0x090a05, 0x0b0a06, 0x0c0c07, 0x0d0c08, 0x0e0e09, 0x10100b, 0x12120b, 0x15140c, 0x16140d, 0x17150c, 0x171509, 0x191509, 0x19160a, 0x100c00, 0x0f0a03, 0x15120d, 0x16130e, 0x141009, 0x16120b, 0x19160d, 0x1c180d, 0x1d190e, 0x1e1b0f, 0x211c10, 0x221c0f, 0x231d11, 0x221c11, 0x231d12, 0x221d11, 0x201c11, 0x211b11, 0x201a10, 0x201a14, 0x1f1a15, 0x1e1913, 0x201d17, 0x393935, 0x494947, 0x525250, 0x605f5e, 0x767574, 0x7b7a78, 0x7b7976, 0x87827b, 0x958e86, 0x908880, 0x897f76, 0x7f756c, 0x7a7068, 0x7c736c, 0x6d645e, 0x524842, 0x32241a, 0x302115, 0x382b21, 0x423427, 0x4d4034, 0x59493c, 0x625344, 0x6e5d4d, 0x7d6b5a, 0x8a7664, 0x907d69, 0x96826c, 0x9f8973, 0xa68e76, 0xa88e75, 0xa89078, 0xb0967d, 0xb0967c, 0xb29981, 0xae987f, 0xb59e84, 0xb79f85, 0xb69d83, 0xb0977c, 0xb29a7f, 0xaf967a, 0xae9377, 0xa88d70, 0xa98f70, 0xb29476, 0xb79877, 0xbe9e7b, 0xc3a27f, 0xc4a37d, 0xbf9e77, 0xc09f77, 0xc0a076, 0xc5a57a, 0xc5a57c, 0xc1a27c, 0xac9373, 0x725f49, 0x35271d, 0x302621, 0x524941, 0x7d736a, 0x92877e, 0x978a80, 0x9b8e82, 0x9e8e80, 0xa18e7e, 0xae967c, 0xbe9c78, 0xb99168, 0xba9268, 0xb98f66, 0xb78d62, 0xb78d62, 0xbc9167, 0xc9a277, 0xd0ac84, 0xd1ae86, 0xc9a580, 0xc9a783, 0xc2a07d, 0xb2906e, 0xad8c6d, 0x977c61, 0x5d4b3b, 0x2b1d13, 0x4f4339, 0x8f8071, 0x988778, 0x706256, 0xa39588, 0xaa9c8c, 0xa79989, 0x6c635a, 0x000000, 0x171409, 0x161208, 0x15100a, 0x14120d, 0x11100b, 0x100f0a, 0x0f0f0a, 0x0f0f0a, 0x100f0a, 0x0f0f0a, 0x0e0d09, 0x0c0d07, 0x0c0d07, 0x0b0b06, 0x0b0c06, 0x0b0c06, 0x0c0b06, 0x0b0b06, 0x0a0b05, 0x0a0a05, 0x080804, 0x080803, 0x080904, 0x070803, 0x060702, 0x060802, 0x060802, 0x050702, 0x040601, 0x030500, 0x030400, 0x030400, 0x040301, 0x030201, 0x030300, 0x020300, 0x030301, 0x030401, 0x030301, 0x020200, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010000, 0x000000, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010201, 0x020302, 0x020201, 0x020200, 0x030300, 0x040401, 0x030500, 0x030500, 0x040500, 0x050601, 0x050601, 0x050701, 0x060702, 0x060702, 0x050702, 0x050601, 0x060802, 0x070802, 0x070803, 0x080904, 0x0a0b06, 0x0c0c07, 0x0d0d08, 0x110e09, 0x131009, 0x15120b, 0x17140e, 0x19150f, 0x18140d, 0x140f06, 0x0d0500, 0x050000, 0x000000, 0x31312d, 0x33312c, 0x140e03, 0x080100, 0x302b21, 0x2a251a, 0x1a1504, 0x0b0900, 0x030300, 0x181302, 0x241d11, 0x251f11, 0x241f10, 0x231d10, 0x201a0f, 0x1b160a, 0x181207, 0x150e04, 0x160f06, 0x140d05, 0x0e0700, 0x232119, 0x3f403e, 0x4b4e4d, 0x454849, 0x3f4344, 0x3d4040, 0x363838, 0x434344, 0x5b5b5a, 0x696762, 0x83807a, 0x97928d, 0x968f8b, 0x8a827c, 0x786e68, 0x817873, 0x948c88, 0x978f88, 0x95897f, 0x968476, 0x9a8370, 0x9c856e, 0xa28b74, 0xa38b75, 0xaa8f7a, 0xa98f79, 0xac9279, 0xb1977d, 0xb1967a, 0xb09478, 0xb29478, 0xac8c6f, 0xaf8e71, 0xb19274, 0xb29375, 0xac8d6f, 0xb09275, 0xb19679, 0xb59a7c, 0xbc9f7f, 0xbfa181, 0xba9b7b, 0xbea17f, 0xbc9e7a, 0xba9a74, 0xc09f78, 0xc6a37d, 0xc6a37c, 0xbf9a72, 0xc19a74, 0xc29d75, 0xc5a075, 0xc6a275, 0xd4b183, 0xd5b386, 0xd8b789, 0xdab98a, 0xdbb98b, 0xd1b084, 0xc6a77f, 0xa48766, 0x684f39, 0x271508, 0x40342c, 0x827469, 0x9f8f83, 0x9f8f82, 0xaf9d8e, 0xa39081, 0x9e8a77, 0xac9379, 0xbf9e7c, 0xc39c71, 0xcba578, 0xd2ad82, 0xcda97f, 0xd4b28a, 0xd4b38c, 0xd6b692, 0xcdae8b, 0xbf9f7b, 0xc5a583, 0xc2a281, 0xb99979, 0xb29274, 0x95775c, 0x6b5541, 0x312014, 0x24160b, 0x44362c, 0x988879, 0xa2917f, 0x8d7d6b, 0x887966, 0xa4937e, 0xb6a491, 0x6e6359, 0x000000, 0x171508, 0x16130a, 0x15120b, 0x12110c, 0x110f0b, 0x100f0a, 0x0f0e0a, 0x0f0f0a, 0x0f0f0a, 0x0e0e09, 0x0d0d08, 0x0c0d07, 0x0c0d07, 0x0c0d07, 0x0c0c07, 0x0c0c07, 0x0c0c06, 0x0b0c05, 0x0a0a04, 0x090804, 0x080704, 0x070803, 0x070804, 0x060803, 0x070702, 0x060702, 0x060701, 0x040601, 0x040500, 0x040500, 0x030400, 0x030400, 0x030301, 0x030400, 0x030400, 0x030401, 0x030301, 0x030301, 0x010100, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x010101, 0x020200, 0x020301, 0x030301, 0x030300, 0x030400, 0x040401, 0x040500, 0x030500, 0x040500, 0x050701, 0x060801, 0x060803, 0x060802, 0x060703, 0x060703, 0x060703, 0x070802, 0x080802, 0x080903, 0x090904, 0x0b0b06, 0x0e0e07, 0x100f07, 0x141106, 0x181407, 0x161106, 0x100700, 0x0b0100, 0x120c01, 0x252523, 0x3f4343, 0x4d5251, 0x595c57, 0x74736d, 0x838077, 0x858175, 0x8e877b, 0x948b7b, 0x978e7e, 0x918878, 0x817a6c, 0x756f65, 0x4c473d, 0x1d1400, 0x180c00, 0x261d07, 0x2d2313, 0x382d20, 0x473a2e, 0x4e4034, 0x514137, 0x4e4035, 0x574a3d, 0x675b4f, 0x6e655a, 0x736b63, 0x776e66, 0x7a7267, 0x867d71, 0x857c71, 0x786e64, 0x6a5f57, 0x514943, 0x3f3b36, 0x2f2f2c, 0x3c3d3b, 0x5c5b5a, 0x797472, 0x837f7c, 0x807976, 0x847c7a, 0x8d8680, 0x938a84, 0xa09289, 0xaa9485, 0xb29884, 0xab8f78, 0xa2866d, 0x9e8068, 0x987b62, 0x9a7d62, 0xa18266, 0xa48565, 0xa78563, 0xab8763, 0xa9835e, 0xaa845e, 0xb38d66, 0xc09d74, 0xc8a57f, 0xc8a780, 0xcaa982, 0xcaa981, 0xc7a57d, 0xcaa780, 0xcda981, 0xccaa7e, 0xcaa77b, 0xcca678, 0xcda777, 0xcea678, 0xc9a374, 0xc19a6c, 0xc89f73, 0xcaa173, 0xcea674, 0xcca473, 0xd8b481, 0xdbba87, 0xd8b682, 0xd7b481, 0xd4af7d, 0xcda877, 0xcfaa7c, 0xd1ac7d, 0xcca87d, 0x967859, 0x3d2b1b, 0x3b2c21, 0x827166, 0xa99788, 0x958273, 0x786556, 0xb8a692, 0xb7a48e, 0xaa9176, 0xd1b28d, 0xd5b48a, 0xcdae87, 0xbc9c79, 0xb19171, 0xa38365, 0x9c7d60, 0x997c5e, 0x9b7c5c, 0xa88a69, 0xae9370, 0xb39774, 0xae906d, 0x9e7e5d, 0x8d6d51, 0x745a41, 0x433221, 0x201309, 0x4c3f34, 0xa1907e, 0xa6947e, 0x9c8a76, 0x9c8a75, 0xb29d86, 0xbbaa96, 0x70675d, 0x000000, 0x18150b, 0x17130c, 0x14120d, 0x12100b, 0x11100c, 0x0f0f0b, 0x0f0e09, 0x0e0f08, 0x0d0e08, 0x0d0d08, 0x0c0d07, 0x0c0d07, 0x0d0d08, 0x0d0d07, 0x0c0d07, 0x0b0c06, 0x0b0c05, 0x090a03, 0x090804, 0x090804, 0x070904, 0x070903, 0x070903, 0x070703, 0x060702, 0x060701, 0x050601, 0x040500, 0x040500, 0x030400, 0x030400, 0x030400, 0x040400, 0x030400, 0x030301, 0x030301, 0x020200, 0x020100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x020200, 0x020200, 0x030400, 0x030301, 0x020200, 0x040400, 0x030400, 0x030500, 0x040500, 0x050701, 0x050701, 0x050601, 0x070703, 0x070803, 0x060703, 0x060702, 0x070903, 0x080903, 0x090803, 0x0a0904, 0x0a0904, 0x0c0b06, 0x100e07, 0x101007, 0x131307, 0x110c00, 0x1a1a13, 0x404645, 0x505a5f, 0x6d797f, 0x7e8b90, 0x859297, 0x879498, 0x929998, 0x959792, 0x888680, 0x89857b, 0x969083, 0x948d7e, 0x978f81, 0x968d80, 0x9a9186, 0x9d948a, 0x989185, 0x958e84, 0x958c81, 0x918575, 0x907f6c, 0x99816e, 0xa28975, 0xa38a74, 0xa58b78, 0xa08774, 0xa18874, 0x9f8876, 0x9e8a7b, 0x9d8878, 0x9e8b78, 0xa28f7c, 0xa08e7c, 0xa49281, 0xa08e7d, 0x9f8c7c, 0x9a8879, 0x88796c, 0x665b50, 0x3c352f, 0x21201d, 0x363535, 0x595855, 0x716965, 0x7a706b, 0x817871, 0x857c77, 0x857972, 0x807167, 0x928073, 0x9d8573, 0x9a7d65, 0x9d7e62, 0xa58568, 0xa68467, 0xaf8d6c, 0xb7936e, 0xb48e64, 0xb99266, 0xc09769, 0xc29968, 0xc6a06d, 0xd0ab79, 0xd3ae7c, 0xd2ac7b, 0xcfab7a, 0xceaa79, 0xcea776, 0xd6b07f, 0xd5b07f, 0xd5b07e, 0xd7b17e, 0xd6af7b, 0xd8b17d, 0xdbb582, 0xd9b27e, 0xd6af7a, 0xd6ae7c, 0xdab27f, 0xe1bb86, 0xe6c08a, 0xeac690, 0xe8c690, 0xe5c38c, 0xdcb882, 0xdcb781, 0xd9b37f, 0xddb886, 0xdab684, 0xd6b384, 0xc3a278, 0x8c7258, 0x332112, 0x38271c, 0x807065, 0xaa9786, 0x806c5b, 0x958574, 0xb6a48f, 0x9e846c, 0xb99e82, 0x9f8263, 0x9b7851, 0xb4916a, 0xba9870, 0xc4a27a, 0xd6b78c, 0xe0c295, 0xe6c697, 0xe8c895, 0xe8c997, 0xe5c593, 0xd4b082, 0xc5a077, 0xb08c68, 0x917150, 0x72573b, 0x42321f, 0x251b0d, 0x594c40, 0xaf9e8b, 0xab9781, 0xa39079, 0xb29e85, 0xbca890, 0xc1b09e, 0x72685e, 0x000000, 0x18130e, 0x15130d, 0x13130c, 0x12120c, 0x11110b, 0x101008, 0x0f0f06, 0x0d0e07, 0x0c0d07, 0x0d0e08, 0x0d0d08, 0x0d0e08, 0x0c0d07, 0x0d0e08, 0x0b0c07, 0x0c0b06, 0x0a0a04, 0x090804, 0x0a0805, 0x0a0905, 0x080904, 0x070803, 0x070803, 0x060601, 0x060701, 0x050601, 0x040501, 0x040500, 0x040500, 0x040500, 0x040500, 0x030400, 0x030400, 0x030400, 0x030301, 0x020200, 0x020200, 0x020200, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000001, 0x010000, 0x010000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x020201, 0x030301, 0x030301, 0x020300, 0x030500, 0x030400, 0x040501, 0x040500, 0x050601, 0x060702, 0x070803, 0x080803, 0x080803, 0x080804, 0x080803, 0x090903, 0x0b0903, 0x0b0904, 0x0b0a06, 0x0c0b06, 0x0e0d07, 0x0f0f07, 0x0f0e06, 0x090b01, 0x343b3b, 0x525c5f, 0x5c6a6f, 0x51626b, 0x4f616a, 0x64757e, 0x495c65, 0x41545d, 0x4b5a62, 0x576266, 0x5e6668, 0x686e6e, 0x656965, 0x72736c, 0x827e75, 0x7c776e, 0x79746b, 0x837f75, 0x8b867f, 0x928d84, 0x9d968c, 0xa59a8e, 0xa89686, 0xab9481, 0xb19883, 0xa68c79, 0x99806d, 0x98806f, 0x9a826f, 0x99826c, 0x97826f, 0x947d6b, 0x937e6a, 0x8c7766, 0x867160, 0x927f6d, 0x958170, 0x998372, 0x998575, 0x9a8777, 0x9a8779, 0x89796c, 0x5e5248, 0x2a2520, 0x232422, 0x54504c, 0x7e7570, 0x83766e, 0x86786f, 0x86786f, 0x85756c, 0x85756a, 0x917e70, 0x9c8470, 0x9a795e, 0xa27f5e, 0xa6825e, 0xae8760, 0xbe966a, 0xc49c6c, 0xcfa574, 0xd0a875, 0xcda672, 0xcea773, 0xcea772, 0xcea770, 0xd9b37c, 0xdbb57f, 0xdab57f, 0xd9b37e, 0xdeb984, 0xe0bc88, 0xe1bf8a, 0xdfbd87, 0xdfbb86, 0xe0bd87, 0xe6c48f, 0xe4c28d, 0xe0bc88, 0xe0bd8d, 0xd9b484, 0xcca674, 0xcea978, 0xc6a272, 0xc19f71, 0xb39267, 0xa8875d, 0xa48257, 0x96744e, 0x977754, 0x9c7e5a, 0x9d815e, 0xa18461, 0x967959, 0x695139, 0x342112, 0x342315, 0x827164, 0xb09b89, 0x9f8873, 0x9f856f, 0xa38973, 0xaa9076, 0xc9ad8e, 0xba9872, 0xba966c, 0xbf9b71, 0xc6a277, 0xddbc8e, 0xdabb8d, 0xddc091, 0xdbbc8b, 0xddbd8c, 0xdbba8b, 0xcba679, 0xc7a175, 0xc09b71, 0xb08a64, 0x997653, 0x7f6448, 0x473726, 0x2f2214, 0x66594c, 0xb4a38e, 0xa8957d, 0xa48f77, 0xb29d85, 0xbca791, 0xbaa997, 0x554c43, 0x000000, 0x171510, 0x14140b, 0x131309, 0x111207, 0x101007, 0x0f0e07, 0x0e0e09, 0x0e0e09, 0x0f0e0a, 0x0e0f09, 0x0d0e08, 0x0c0d07, 0x0c0e08, 0x0b0c06, 0x0c0c06, 0x0a0a04, 0x090903, 0x090904, 0x090904, 0x080803, 0x070903, 0x080803, 0x070702, 0x050701, 0x040600, 0x050601, 0x050601, 0x040500, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030301, 0x020200, 0x020200, 0x020200, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000001, 0x000000, 0x010000, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x020202, 0x030301, 0x020200, 0x020300, 0x030500, 0x030300, 0x040500, 0x030500, 0x040601, 0x060802, 0x070802, 0x070803, 0x080804, 0x080804, 0x070802, 0x090902, 0x0a0b02, 0x0b0b06, 0x0c0b06, 0x0d0d06, 0x0e0f06, 0x0f0f07, 0x020100, 0x313838, 0x495357, 0x3d4a51, 0x2b3a43, 0x2e3e48, 0x31434c, 0x354750, 0x3b4d56, 0x384a53, 0x3b4c53, 0x3c4850, 0x3a4348, 0x5f676b, 0x6c7579, 0x62696a, 0x666968, 0x6c6b67, 0x6f6d68, 0x73736d, 0x7b7974, 0x76746f, 0x726f6a, 0x817a73, 0xa5998d, 0x9e8d7e, 0x836d5c, 0x887262, 0x7e6959, 0x7f695a, 0x796352, 0x745f4e, 0x7a6554, 0x7c6855, 0x8b7662, 0x9a8571, 0x9a8571, 0x9c8672, 0x9e8773, 0x9f8872, 0x97806b, 0x957e69, 0x8c7562, 0x8b7563, 0x84715f, 0x6d5d4c, 0x403529, 0x292520, 0x58514d, 0x82756d, 0x8a796e, 0x87756a, 0x88756a, 0x857467, 0x867464, 0x947f6b, 0xa58a71, 0xa98767, 0xb6906b, 0xc0976e, 0xc99f72, 0xd4ac79, 0xdcb480, 0xe3be89, 0xe2bf89, 0xe2c08a, 0xe6c38c, 0xe9c58e, 0xeac892, 0xe9c894, 0xe8c897, 0xebcc9c, 0xe9ca9a, 0xe4c494, 0xdec091, 0xd6b789, 0xc7a87a, 0xbd9f73, 0xb5976c, 0xae9068, 0xa48660, 0xa4845f, 0xa88962, 0xb79971, 0xc0a27b, 0xc6a880, 0xc8aa7f, 0xcaac80, 0xd3b587, 0xd9ba8b, 0xddbe8e, 0xdfc08f, 0xd8b785, 0xd6b483, 0xd6b382, 0xcaa576, 0xb39068, 0x806344, 0x46301e, 0x322015, 0x857568, 0xad9885, 0xac957f, 0xb59c84, 0xc3aa8f, 0xceb698, 0xbfa485, 0xad8b67, 0xb9956f, 0xa9845d, 0xad8a62, 0xc6a77d, 0xcdb087, 0xc4a67e, 0xad8d63, 0xac8a60, 0xc8a476, 0xc19b6e, 0xba956a, 0xb6916a, 0xa4805c, 0x997857, 0x7e664c, 0x3f3222, 0x180200, 0x7b6e5f, 0xcfbea7, 0xaf9b84, 0xb09a83, 0xb29d86, 0xbca993, 0xbaab9b, 0x443e38, 0x000000, 0x16160c, 0x13140a, 0x111108, 0x111109, 0x100f0a, 0x0e0e09, 0x0e0e08, 0x100f0b, 0x0f100b, 0x0e0e08, 0x0d0e08, 0x0c0d07, 0x0c0c07, 0x0b0b06, 0x0a0b05, 0x090a04, 0x090903, 0x080902, 0x080803, 0x080803, 0x080703, 0x070702, 0x060702, 0x050701, 0x050601, 0x050601, 0x050601, 0x040501, 0x030400, 0x040600, 0x040500, 0x040401, 0x030301, 0x030200, 0x020200, 0x020200, 0x020201, 0x020201, 0x020101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x020201, 0x020200, 0x020200, 0x030300, 0x040500, 0x030300, 0x030500, 0x030500, 0x040601, 0x050802, 0x070803, 0x080804, 0x090803, 0x080803, 0x080802, 0x090902, 0x0a0a02, 0x0b0c05, 0x0b0c05, 0x0d0e05, 0x0f1006, 0x000000, 0x393d3d, 0x4e5658, 0x374045, 0x343d44, 0x333b44, 0x343d45, 0x364148, 0x3a474e, 0x3b494f, 0x3e4c52, 0x414d54, 0x41494e, 0x3c4245, 0x333a3d, 0x393f44, 0x444a4d, 0x63696c, 0x6d6f6f, 0x70716d, 0x6c6b66, 0x706d6a, 0x75726e, 0x74726f, 0x7a7673, 0x756f6a, 0x8e847b, 0x8d7f74, 0x766354, 0x7b6657, 0x8a7462, 0x9a836e, 0x99816c, 0x968068, 0x92795f, 0x957b60, 0x9e8265, 0x9e8264, 0xa08365, 0xa68769, 0xa28465, 0x9a7c5e, 0x98795e, 0x987a5e, 0x93755b, 0x95785d, 0x91765c, 0x7e684f, 0x4b3c2b, 0x2b251d, 0x514941, 0x84746a, 0x8f7d6f, 0x79665a, 0x756356, 0x988370, 0xb29d88, 0x9f866e, 0xa6886e, 0xaf8c69, 0xbf9a71, 0xc8a072, 0xd2ac7c, 0xd1ac7b, 0xd0ac7c, 0xc9a777, 0xc6a577, 0xbfa072, 0xaf9066, 0xa58560, 0xac8e67, 0xae906b, 0xac8d6a, 0xa88965, 0xad8d67, 0xb19169, 0xb59468, 0xbf9c6f, 0xc6a676, 0xd5b685, 0xd6b786, 0xd4b583, 0xd8b888, 0xddbd8d, 0xdebd8c, 0xddbc8b, 0xdfbd8c, 0xdcba85, 0xdebc87, 0xe3c38e, 0xdebf8a, 0xe2c18a, 0xe9c88e, 0xe4c188, 0xe2be84, 0xe3be86, 0xe1ba85, 0xe1b987, 0xc6a274, 0x826444, 0x342212, 0x2e1d0f, 0x837265, 0xa5917e, 0xd2bda3, 0xd3ba9b, 0xcab191, 0xc9b091, 0xb3987a, 0x9a7754, 0xae8861, 0xb49166, 0xbf9b70, 0xc5a175, 0xc39f71, 0xc19c6e, 0xc49e70, 0xcea979, 0xc09b6d, 0xc6a176, 0xbf9a70, 0xb18c65, 0x9e7c57, 0x947758, 0x67543e, 0x180000, 0x3a2814, 0xc6b59d, 0xd3c1a8, 0xc5b19a, 0xbca78e, 0xbeaa91, 0xcab9a2, 0xb4a797, 0x27221a, 0x070600, 0x15130b, 0x12110a, 0x12110b, 0x100f0b, 0x0f0e0a, 0x0f0e0a, 0x100f0a, 0x0f0f0a, 0x0d0e08, 0x0d0e08, 0x0c0d07, 0x0c0d08, 0x0b0b06, 0x090a05, 0x090a04, 0x090904, 0x090904, 0x090904, 0x090804, 0x090904, 0x080803, 0x070903, 0x060802, 0x060701, 0x060802, 0x050801, 0x040601, 0x050601, 0x060701, 0x050601, 0x040501, 0x030200, 0x020200, 0x030301, 0x030400, 0x020200, 0x020100, 0x020000, 0x010001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x020201, 0x020200, 0x030300, 0x040500, 0x040500, 0x030400, 0x040500, 0x040501, 0x050602, 0x060802, 0x070803, 0x070803, 0x080803, 0x0a0905, 0x090903, 0x090a01, 0x0a0b03, 0x0c0c04, 0x0c0d06, 0x0c0e05, 0x000000, 0x474b4a, 0x5a6162, 0x3a4245, 0x3d4348, 0x3d4147, 0x34383f, 0x31363e, 0x333a42, 0x394148, 0x3d454c, 0x3c464d, 0x374147, 0x40474d, 0x3f4446, 0x3a3d3e, 0x3f4042, 0x353536, 0x3d3f3e, 0x78797a, 0x7a7b7a, 0x767672, 0x746f6b, 0x6f6a67, 0x666261, 0x6a6462, 0x6a6361, 0x6a645f, 0x776d65, 0x897b6e, 0x836e5c, 0x887059, 0x927960, 0x92785e, 0x8f755a, 0x8c6f53, 0x947756, 0xa2815c, 0xaa8860, 0xae8d63, 0xb29169, 0xb08d65, 0xac8b65, 0xa88766, 0xad8b69, 0xb18f6b, 0xbb9973, 0xbb9b75, 0xad8f6c, 0x8a7154, 0x4b3a27, 0x2c241b, 0x50473f, 0x8c7b6e, 0x857161, 0x594637, 0x806c5a, 0xb29d87, 0x967b62, 0xa78c73, 0xa28870, 0x74573b, 0x8c6a47, 0x9b7a55, 0xa1815c, 0xa98962, 0xaf8e63, 0xbb9669, 0xc7a273, 0xcfac7b, 0xd1ac79, 0xd5b07b, 0xdbb581, 0xe2bc88, 0xe7c28e, 0xe4c18b, 0xe1bf88, 0xdab67c, 0xd4af76, 0xd6b47e, 0xd6b680, 0xcfae7c, 0xcbaa79, 0xcbab7d, 0xcdad80, 0xcfac7c, 0xc9a470, 0xd8b37e, 0xe0bb86, 0xe6c28b, 0xeac994, 0xe8c993, 0xe0be85, 0xdebb81, 0xe2bf86, 0xddb77d, 0xd7b178, 0xd3ab78, 0xc49c69, 0xb68f60, 0x906e48, 0x563e25, 0x2a1a0c, 0x342319, 0x827061, 0xceb99e, 0xdec5a2, 0xe2caa7, 0xd2ba9a, 0xc9af91, 0xb09072, 0xb08b62, 0xbb966a, 0xb59065, 0xc7a474, 0xc9a474, 0xcea978, 0xceaa79, 0xc4a271, 0xc5a578, 0xb9996f, 0xad8a63, 0xaa8a64, 0xab8c6a, 0xa08569, 0x735f47, 0x958773, 0xc5b399, 0xd0ba9d, 0xcdb79d, 0xc4af97, 0xc4af96, 0xc8b399, 0xc8b49a, 0xcfbca5, 0xa29585, 0x000000, 0x181107, 0x15110b, 0x12100c, 0x10110b, 0x11100c, 0x100f0a, 0x0f0e0a, 0x0f0e09, 0x0d0e08, 0x0d0d08, 0x0c0c07, 0x0d0c07, 0x0b0b06, 0x0a0904, 0x0a0905, 0x0a0905, 0x0a0a05, 0x0a0a05, 0x090a05, 0x090905, 0x090904, 0x080a04, 0x070902, 0x060802, 0x070803, 0x060701, 0x050701, 0x050701, 0x050601, 0x040500, 0x040300, 0x030201, 0x030300, 0x030300, 0x030500, 0x020300, 0x020200, 0x020200, 0x020100, 0x010000, 0x000000, 0x010100, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x000000, 0x010001, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000001, 0x020201, 0x020202, 0x020201, 0x020200, 0x030300, 0x040500, 0x040500, 0x040500, 0x050601, 0x040601, 0x050701, 0x060802, 0x060701, 0x070802, 0x090904, 0x090904, 0x0a0a04, 0x0a0b04, 0x0a0c03, 0x0c0d03, 0x0d0e05, 0x000000, 0x4e5250, 0x626869, 0x3b4347, 0x41464c, 0x41454b, 0x393b40, 0x39393e, 0x2d2e35, 0x2f3239, 0x33373e, 0x3a4047, 0x384047, 0x3d444b, 0x41474c, 0x404648, 0x414445, 0x3f3f3f, 0x3f3c39, 0x413d3b, 0x3f3f40, 0x454749, 0x686869, 0x85817e, 0x736b67, 0x685f5d, 0x675d5a, 0x706461, 0x7d726d, 0x776c65, 0x72675e, 0x8d7c6e, 0x8f7760, 0x8b7053, 0x8b6f53, 0x937658, 0x9b7c5b, 0xa5835e, 0xb8956a, 0xc4a175, 0xbf9c71, 0xb7966d, 0xb3916b, 0xa38361, 0x9e7f61, 0x957457, 0x937356, 0xab8b68, 0xb2926d, 0xa58664, 0x896e52, 0x57422c, 0x2f2315, 0x272118, 0x5a4f44, 0x978372, 0x8e7661, 0x846e59, 0x7b624b, 0x917861, 0x927960, 0xa28970, 0xac9073, 0xa9865f, 0xbe996d, 0xc49d6e, 0xdcb582, 0xe6c08a, 0xe9c38b, 0xeac58d, 0xe6c088, 0xe4bc83, 0xdcb47b, 0xdbb47c, 0xddb880, 0xdcb781, 0xdfbc85, 0xdcba83, 0xd6b27a, 0xd1ac75, 0xd2af7b, 0xc9ab7c, 0xc3a884, 0xbfa583, 0xc4ab8a, 0xbfa583, 0xceb38c, 0xcfb085, 0xcdaa7d, 0xc5a372, 0xc5a270, 0xceaa77, 0xd5b27e, 0xd1ae79, 0xc8a470, 0xbe9763, 0xbc945f, 0xbd9762, 0xc29d6c, 0xc49f6c, 0xb99466, 0xab895e, 0x8c6e4b, 0x563f2a, 0x301f12, 0x3f2b1d, 0xc2af97, 0xd5bb9b, 0xd3ba98, 0xdfc6a6, 0xc7ae91, 0xbda285, 0xbda07f, 0xac8a62, 0xb5936a, 0xb39268, 0xbd9d74, 0xc6a880, 0xccaf85, 0xceb48b, 0xceb58f, 0xd7c09c, 0xd6bf9c, 0xd4be9b, 0xcab192, 0xa79278, 0x877560, 0xd8c3a6, 0xd2bb9c, 0xbfa587, 0xccb395, 0xd1bba0, 0xcdb89e, 0xc7b299, 0xc3ae95, 0xc8b49b, 0xc7b59e, 0x7a6f60, 0x000000, 0x16120b, 0x14120d, 0x12120d, 0x12120d, 0x11110c, 0x0f0e0a, 0x0e0d09, 0x0d0d07, 0x0c0d07, 0x0d0c07, 0x0d0c07, 0x0c0b06, 0x0c0b06, 0x0c0b06, 0x0b0a06, 0x0b0b06, 0x0a0a06, 0x0a0a05, 0x0b0a06, 0x0a0905, 0x090a05, 0x070902, 0x070902, 0x070802, 0x060802, 0x050801, 0x050801, 0x050701, 0x040601, 0x040501, 0x050402, 0x030301, 0x030400, 0x030400, 0x020300, 0x010100, 0x030301, 0x020101, 0x010100, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000100, 0x000101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010100, 0x010100, 0x020201, 0x020201, 0x020300, 0x030400, 0x030400, 0x030500, 0x040501, 0x050601, 0x050701, 0x050601, 0x040601, 0x060802, 0x060802, 0x070902, 0x090a04, 0x0a0a05, 0x0a0a05, 0x0b0c05, 0x0c0d04, 0x0f0e04, 0x030000, 0x373936, 0x606665, 0x3c4549, 0x3f474e, 0x41484c, 0x3c4044, 0x35373b, 0x313136, 0x2a2c31, 0x2b2d34, 0x2d3239, 0x394047, 0x373f46, 0x3c4449, 0x3d4449, 0x3e4446, 0x3c4143, 0x3f4040, 0x3f3b39, 0x3c3531, 0x3c3b3b, 0x3d4144, 0x5b5e63, 0x787879, 0x8b8481, 0x6d635e, 0x50433f, 0x584943, 0x978780, 0xcbbdb4, 0x796c64, 0x796b63, 0x9a8775, 0x907458, 0xa18363, 0xae8f6f, 0xaf9270, 0xa18462, 0x96795a, 0x917558, 0x8e7259, 0x8a7058, 0x856b56, 0x816753, 0x937865, 0x977a66, 0x967963, 0xa8886c, 0xaf8e6e, 0xb19070, 0xae8d6e, 0x96795d, 0x614c37, 0x2c2116, 0x231e17, 0x7a6e61, 0xa28d7a, 0x947f6a, 0x8d7965, 0x8b7763, 0x907962, 0x957c60, 0xc2a788, 0xb99874, 0xc09a6d, 0xcaa372, 0xd5ae7b, 0xdab481, 0xdbb581, 0xd8b27e, 0xdbb480, 0xdcb47f, 0xd6af79, 0xd1aa75, 0xc8a06a, 0xcba16d, 0xd2aa75, 0xd8b27b, 0xdab37d, 0xcda877, 0xa88961, 0xc8b69a, 0xd5c6ac, 0x9b8b78, 0xb1a292, 0xb9a894, 0xc4b197, 0xc1ab8f, 0xc4ab8e, 0xc5aa8a, 0xc4a780, 0xc2a176, 0xbc996b, 0xb99767, 0xbc9969, 0xbc9969, 0xc09e6d, 0xbf9d6d, 0xb49364, 0xb08e60, 0xae8d63, 0xaa8a62, 0xa28662, 0x876e54, 0x604f3d, 0x554333, 0x7a6a5a, 0xd8c2a7, 0xccb190, 0xc1a688, 0xc2a78b, 0xc4ad8e, 0xe3ccad, 0xc1a788, 0xa78966, 0xb99d7c, 0xc2a885, 0xc6ae8b, 0xcab38d, 0xd3bb97, 0xd0b997, 0xd5c09f, 0xd0bc9d, 0xceba9b, 0xc8b497, 0x85725d, 0x816f5a, 0xd8c1a3, 0x90795f, 0xbda890, 0xd6c2a6, 0xd5bfa1, 0xd9c4a8, 0xccb89c, 0xc4af94, 0xc5b096, 0xc8b399, 0xb2a28a, 0x383328, 0x050500, 0x15150e, 0x14140f, 0x13130e, 0x11100c, 0x101009, 0x0e0f08, 0x0c0e08, 0x0c0d07, 0x0d0c07, 0x0c0c07, 0x0d0c07, 0x0d0c07, 0x0e0d08, 0x0d0c08, 0x0c0c07, 0x0c0a06, 0x0d0b05, 0x0a0a05, 0x0a0a05, 0x090a04, 0x080a03, 0x070a03, 0x070802, 0x060802, 0x070902, 0x060902, 0x050701, 0x040601, 0x040601, 0x040502, 0x040501, 0x040500, 0x040500, 0x030400, 0x020300, 0x020301, 0x020201, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000001, 0x010100, 0x010100, 0x020100, 0x020200, 0x020200, 0x030400, 0x040500, 0x040500, 0x050601, 0x050701, 0x050701, 0x050701, 0x050701, 0x060702, 0x070903, 0x070903, 0x090a04, 0x090a05, 0x0a0b05, 0x0b0d05, 0x0e0f05, 0x120f02, 0x17160f, 0x505453, 0x3e4549, 0x3a4349, 0x3e454b, 0x3c4146, 0x33373b, 0x35373c, 0x2f3035, 0x2d3034, 0x313439, 0x30353a, 0x383d42, 0x3e4449, 0x363d42, 0x353c41, 0x363c40, 0x383d41, 0x3c3e40, 0x3d3d3b, 0x342f2b, 0x333232, 0x36393e, 0x3b3f45, 0x5c6063, 0x747271, 0x847a75, 0x70625c, 0x50443f, 0x5d4e47, 0x998981, 0x70615a, 0x6c5e58, 0x81726a, 0x7c6a5d, 0x725845, 0x88705e, 0x8e7564, 0x8b7362, 0x907969, 0x927c6c, 0x917869, 0x937a68, 0x987f6a, 0xa1846e, 0xaa8a72, 0xb29074, 0xb39072, 0xb79373, 0xc7a47f, 0xc6a37e, 0xbd9a77, 0xb08e70, 0x977b60, 0x594732, 0x272016, 0x2e2921, 0x6b6053, 0x7f7061, 0x928272, 0x988674, 0x998571, 0xa78f76, 0xb8a083, 0xc7ae8d, 0xad8a61, 0xb18a5e, 0xbc9467, 0xc29b6d, 0xc49c6c, 0xc79f6d, 0xcfa573, 0xd0a774, 0xcda570, 0xc69e69, 0xc09863, 0xc19762, 0xc09662, 0xc49c68, 0xb58f5f, 0x876640, 0xac9b84, 0xd9cab3, 0xd0c2ac, 0xa19180, 0x6c5b4f, 0x867567, 0xad9c87, 0xcfbda4, 0xb8a38b, 0xb7a38b, 0xbfa98f, 0xbea78b, 0xc5ad8e, 0xc2a785, 0xc2a680, 0xbe9f77, 0xb69970, 0xb1956d, 0xad916c, 0xb39875, 0xbea481, 0xc0a785, 0xc8b090, 0xbba488, 0xceb99b, 0xbda88b, 0x452e11, 0xa4937d, 0xdbc3a4, 0xbba184, 0xa99076, 0xc4ad90, 0xddc7a8, 0xdfc9ab, 0x9f8467, 0xb9a081, 0xbda686, 0xb79f7f, 0xc4ac88, 0xd5bf9b, 0xd8c1a1, 0xccb797, 0xc1ad90, 0xc8b497, 0xcbb69a, 0x93806a, 0x442901, 0xbaa589, 0xc5b297, 0x8d7d6b, 0xad9c85, 0xc5b091, 0xd7c2a3, 0xd4c2a5, 0xd4c1a4, 0xd9c5a8, 0xccb89a, 0xbcaa8c, 0x8e826e, 0x000000, 0x17170e, 0x15150f, 0x13130e, 0x11110a, 0x0f1006, 0x0e1007, 0x0d0e09, 0x0d0d08, 0x0d0d07, 0x0c0d07, 0x0d0d07, 0x0e0d08, 0x0d0d08, 0x0d0c07, 0x0c0c08, 0x0c0b06, 0x0d0b03, 0x050400, 0x070600, 0x090b03, 0x080a04, 0x080a03, 0x080a03, 0x070903, 0x070903, 0x070903, 0x050702, 0x040701, 0x050601, 0x040500, 0x040600, 0x050500, 0x040400, 0x030400, 0x030400, 0x020300, 0x020200, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x020300, 0x030400, 0x040500, 0x040500, 0x050500, 0x050601, 0x050701, 0x060802, 0x060802, 0x070803, 0x080a03, 0x080b04, 0x090b05, 0x0a0b05, 0x0b0c06, 0x0c0d06, 0x121005, 0x0f0400, 0x4b4c4a, 0x474c4f, 0x373e44, 0x373e44, 0x383d42, 0x35383e, 0x33353a, 0x36393e, 0x34373b, 0x38393c, 0x454646, 0x3a3d3d, 0x343637, 0x36393a, 0x2f3335, 0x333839, 0x33393b, 0x31363a, 0x404346, 0x3b3d3c, 0x363634, 0x343434, 0x36373c, 0x32363b, 0x393c41, 0x525457, 0x78726e, 0x8d7f79, 0x766862, 0x625450, 0x655652, 0x746661, 0x726763, 0x776964, 0x9d8d82, 0x847162, 0x836d5d, 0x887060, 0x836c5d, 0x7a6254, 0x7a6152, 0x816756, 0x7f634f, 0x94765e, 0x9c7c62, 0xa07d62, 0xa58264, 0xa68264, 0xab8768, 0xb28e6e, 0xab8869, 0xa58264, 0x9d7a5f, 0x967459, 0x836950, 0x483b2b, 0x28231a, 0x332e27, 0x655b53, 0x94877a, 0xad9e8c, 0xa3927f, 0xa5917c, 0xb9a48b, 0xb9a588, 0xb29879, 0xa5815b, 0xaf8961, 0xb58f63, 0xb79265, 0xbb9568, 0xc39c6c, 0xc49f6d, 0xc9a570, 0xcca973, 0xcdaa74, 0xc8a56f, 0xc09c68, 0xab8b5c, 0x7d603a, 0x9a8870, 0xd1c1a8, 0xcabba4, 0xc3b39f, 0xb8a897, 0xa39487, 0x99887a, 0xa2907d, 0xc4af97, 0xcdb69d, 0xbca78d, 0xaa957d, 0xa8927b, 0xb6a087, 0xcab397, 0xc3ac8f, 0xc0a889, 0xbda685, 0xb7a07e, 0xbda585, 0xc2a98a, 0xcfb895, 0xd8c09c, 0xc8b08e, 0xc2aa8a, 0xd5bc99, 0xdac19e, 0x937d65, 0x493524, 0xcbb69c, 0xc0a88b, 0x755e49, 0xd1bda4, 0xc9b497, 0xdac5a4, 0xb9a284, 0xb39a79, 0xc8b290, 0xc0ab8a, 0xc3ac89, 0xceb995, 0xd9c2a1, 0xc9b392, 0xbeaa8c, 0xbfac8f, 0xc5b094, 0xbca88f, 0x6d5945, 0x765f47, 0xe7d5b8, 0xdeceaf, 0xb7a484, 0xcab695, 0xdecaaa, 0xe6d6b7, 0xe8dabb, 0xe6d8b8, 0xe1d2b2, 0xd3c3a2, 0xd3c5a7, 0x676252, 0x000000, 0x15150d, 0x13140d, 0x11120b, 0x0f1005, 0x0d0f07, 0x0e0e0a, 0x0e0f09, 0x0e0e09, 0x0d0d08, 0x0d0d08, 0x0d0d08, 0x0d0d08, 0x0d0c07, 0x0c0d07, 0x0c0d06, 0x0d0b00, 0x4a4027, 0x3d331c, 0x0a0900, 0x090a03, 0x080a03, 0x080a03, 0x080902, 0x080a04, 0x080904, 0x060802, 0x060701, 0x050701, 0x040500, 0x040600, 0x050500, 0x040400, 0x030400, 0x030400, 0x020300, 0x020201, 0x020201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x030200, 0x020100, 0x020200, 0x030400, 0x040500, 0x040500, 0x050601, 0x050601, 0x060702, 0x060803, 0x070903, 0x080a04, 0x070b04, 0x080a04, 0x0a0a05, 0x0a0a06, 0x0a0b06, 0x0d0e06, 0x070500, 0x353531, 0x595d5c, 0x3a4146, 0x373c42, 0x313439, 0x37393d, 0x35383c, 0x373a3d, 0x393a3c, 0x353435, 0x2e2d2b, 0x201f1a, 0x100f09, 0x0e0e07, 0x101109, 0x14150f, 0x1e201b, 0x303333, 0x3d4143, 0x3b3f42, 0x383c3e, 0x393a3a, 0x3b3c3b, 0x424447, 0x303237, 0x313238, 0x33353a, 0x5b5a5b, 0x948985, 0x93847e, 0x776963, 0x776a65, 0x807470, 0x817674, 0x7d716d, 0x897d74, 0x9f9083, 0x776150, 0x836855, 0x8a6f5b, 0x8a6f5b, 0x8a6d59, 0x8e6f58, 0x96755c, 0xa28266, 0xa68569, 0xa68469, 0xa28063, 0xab896c, 0xa8886a, 0x9e7c60, 0x97775c, 0x997960, 0x97785f, 0x9e8168, 0xa38971, 0x74614d, 0x342b1d, 0x2c2921, 0x46423e, 0x7e756c, 0xb2a392, 0xae9f8c, 0x948373, 0x9a8674, 0x9c8974, 0xb69e86, 0xa88c70, 0x957551, 0xa98960, 0xac8d63, 0xac8e65, 0xab8d63, 0xa88a60, 0xa5895d, 0x9f8257, 0xa18659, 0xa58b60, 0x988059, 0x937e5f, 0x84745e, 0xb5a68f, 0xc8b8a1, 0xcdbca7, 0xc8b8a4, 0xb7a895, 0xb5a593, 0xb8a794, 0xb3a28c, 0xb29e85, 0xb09982, 0xb39b81, 0xad957b, 0xa58f75, 0x99846a, 0x9f8970, 0xa08d75, 0xac9a80, 0xc6b699, 0xbeab8e, 0xad9677, 0xb9a080, 0xcfb793, 0xdfc7a2, 0xc7ae8a, 0xc8b08d, 0xceb691, 0xd5bc99, 0xceb79a, 0x4b3521, 0x867461, 0xcdb698, 0xa79076, 0x907d67, 0xae997d, 0xccb795, 0xcfb998, 0xa88f6f, 0xc9b697, 0xd3c3a3, 0xe2d2b3, 0xe5d5b3, 0xe0cdad, 0xdcccab, 0xeadcbd, 0xcebda0, 0xbfac90, 0xcebba1, 0xc1ae95, 0x725f49, 0x84735e, 0xded0b4, 0xebdbbd, 0xf0e0c3, 0xf3e6c7, 0xf6eacd, 0xf0e8cc, 0xe9e0c5, 0xe4dabf, 0xd2c6aa, 0xc4b99f, 0x797362, 0x000000, 0x16140d, 0x13140d, 0x11120c, 0x101009, 0x0e0f09, 0x0f0f0b, 0x10100b, 0x100f0b, 0x0f0f0a, 0x0e0e09, 0x0f0e09, 0x0e0f09, 0x0d0e09, 0x0c0e09, 0x0c0d06, 0x000000, 0x6a5f42, 0x5e5236, 0x070200, 0x0a0a01, 0x090b04, 0x080a04, 0x080902, 0x080904, 0x070803, 0x060701, 0x070702, 0x060701, 0x050701, 0x050601, 0x050500, 0x050400, 0x040500, 0x030400, 0x020300, 0x010101, 0x010101, 0x020202, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x030200, 0x030200, 0x020200, 0x020300, 0x030400, 0x040501, 0x050601, 0x050801, 0x050702, 0x060803, 0x070803, 0x070a04, 0x080a05, 0x070a05, 0x080a05, 0x0a0a05, 0x0b0b06, 0x0b0c06, 0x0c0e05, 0x070900, 0x545654, 0x444a4d, 0x3c4247, 0x3a3e44, 0x282a2f, 0x38393d, 0x343438, 0x3a3a39, 0x31302c, 0x1d1914, 0x15120c, 0x16140e, 0x191a13, 0x1f211a, 0x21221c, 0x22231e, 0x242621, 0x252822, 0x2e2f2c, 0x373939, 0x414444, 0x444544, 0x3a3b3a, 0x414346, 0x2b2c2f, 0x343539, 0x36363b, 0x4c4c50, 0x7d7978, 0xa39791, 0x9b8d85, 0x887b74, 0x8d817b, 0x908480, 0x8d817c, 0x857b73, 0x998a80, 0x988374, 0x7d614b, 0x876c57, 0x886d58, 0x8c6f5a, 0x8b6d57, 0x93755d, 0xa4876e, 0xaa8e74, 0xa2856d, 0x947860, 0x997d65, 0x8a6e57, 0x836750, 0x81674e, 0x846952, 0x8c725a, 0x967c64, 0x8b735c, 0x7e6851, 0x4f3f2e, 0x292218, 0x282420, 0x625951, 0xbaac9c, 0xbbaa98, 0x988576, 0x8c7a6a, 0x96816e, 0xad967f, 0xb6a189, 0x8d765e, 0x917a60, 0x8e795f, 0x8d785e, 0x8b765e, 0x84715a, 0x9a8872, 0xa29079, 0xa6937a, 0xb09d82, 0xb7a488, 0x9e8e75, 0x948570, 0xaa9981, 0xae9e87, 0xb0a08b, 0xad9e8a, 0xac9d89, 0x8e8070, 0x9a8b7a, 0xb8a893, 0xbfae97, 0xc3b19b, 0xc5b49d, 0xcfbda6, 0xd8c6ae, 0xd5c2a9, 0xd8c6ab, 0xd1bfa5, 0xe2d2b5, 0xe0d0b3, 0xc8b69a, 0xb3a082, 0xbfa888, 0xd3bb97, 0xe9d2ad, 0xd6bd97, 0xccb38d, 0xddc6a1, 0xd0b996, 0xc8b08f, 0x907b63, 0x39230e, 0xc2ae94, 0xdac3a4, 0xd5be9e, 0xdac5a3, 0xe3d2b0, 0xe0d0b0, 0xd3c1a2, 0xc7b799, 0xc5b799, 0xddcfb2, 0xe8dbbc, 0xeadcbe, 0xf4eacc, 0xf7edd2, 0xebe0c5, 0xe0d3b8, 0xdeceb4, 0xe0cfb5, 0xcdbda3, 0x988673, 0x58412c, 0x816d58, 0x95846f, 0x958570, 0x8e7d69, 0x7f6d58, 0x6e5a44, 0x665037, 0x675034, 0x534128, 0x201907, 0x17180e, 0x15150e, 0x13140e, 0x12120d, 0x12110c, 0x11100b, 0x10100b, 0x10100c, 0x11100b, 0x10110b, 0x10110b, 0x10100c, 0x0f100b, 0x0f100a, 0x0e100a, 0x0d0e07, 0x121104, 0x211b04, 0x201b05, 0x131002, 0x0b0c03, 0x0a0b05, 0x090a04, 0x070a03, 0x070a04, 0x070902, 0x070802, 0x070802, 0x060802, 0x060802, 0x060701, 0x050601, 0x050500, 0x040500, 0x030500, 0x020400, 0x010201, 0x010200, 0x020202, 0x010102, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x020200, 0x020200, 0x030201, 0x030300, 0x030300, 0x020300, 0x020400, 0x040601, 0x060802, 0x060802, 0x060802, 0x070904, 0x080a05, 0x080b05, 0x090b05, 0x0a0b06, 0x0a0b06, 0x0a0b06, 0x0b0c06, 0x000100, 0x3d3e3a, 0x5a5d5c, 0x35393f, 0x3b4045, 0x3d4045, 0x313237, 0x2e3032, 0x403e3c, 0x37332f, 0x0e0903, 0x0f0c06, 0x181711, 0x1d1d18, 0x23241f, 0x282a23, 0x2a2c27, 0x262823, 0x282a26, 0x2d302b, 0x343530, 0x252620, 0x2e2e2b, 0x434342, 0x393a3b, 0x2e2f31, 0x2a292d, 0x323438, 0x3a3b3f, 0x3c3c40, 0x5a5b5c, 0x918b87, 0xab9e95, 0x9a8d84, 0x877a73, 0x897e77, 0x8b817a, 0x857b75, 0x8d7f77, 0xa59487, 0x7d6956, 0x6f553f, 0x755a47, 0x745948, 0x7f6451, 0x78604c, 0x7b634e, 0x7c654e, 0x7e654e, 0x7b614b, 0x7b624a, 0x786047, 0x7c644b, 0x81684d, 0x8a7155, 0x876e54, 0x7f6950, 0x7e6850, 0x79634c, 0x6e5c4a, 0x574c3f, 0x4e473e, 0x413a31, 0x9d9083, 0xab9a89, 0xa99682, 0xaa957e, 0xb59f87, 0xbaa38a, 0xbea990, 0xc0ac95, 0xa18e7c, 0x9c8a79, 0x968473, 0x9b8a7a, 0x8a7b6f, 0x817266, 0x998978, 0xac9b85, 0xc1af94, 0xbdac90, 0x685a48, 0x9a8c76, 0xaa9a81, 0x897a67, 0xc8b89f, 0x988873, 0x7c6c5c, 0x544437, 0x786759, 0xdccbb6, 0xe4d2b9, 0xd9c7ae, 0xd3c1a7, 0xceb99f, 0xbda78d, 0xa99176, 0x987d60, 0x806446, 0x795d3f, 0x896f51, 0xcfbb9d, 0xcfbc9e, 0xad9676, 0xbba281, 0xd5be9c, 0xcfb693, 0xd3b994, 0xe1cba6, 0xe5cfab, 0xdac3a1, 0xc5ae90, 0x5d4a36, 0x83715f, 0xd9c2a6, 0xd6be9e, 0xdecbaa, 0xfbedce, 0xf8edd2, 0xe5d8bf, 0xccbda2, 0xd8cbb0, 0xecdfc4, 0xe8ddc2, 0xe7d8be, 0xe9ddc2, 0xe8ddc7, 0xddd2be, 0xd0c3af, 0xc1b19e, 0xa89683, 0x927e69, 0x7f6853, 0x674630, 0x66442b, 0x633f23, 0x634022, 0x624022, 0x664428, 0x6a482c, 0x6d4e31, 0x675037, 0x352c1d, 0x0e1005, 0x15150c, 0x15150e, 0x13130e, 0x13120d, 0x13110d, 0x12110a, 0x111209, 0x111209, 0x121209, 0x121208, 0x111208, 0x101108, 0x11120a, 0x111209, 0x0e1007, 0x0e0f07, 0x0e1006, 0x0c0e02, 0x0c0d01, 0x0d0d05, 0x0c0b05, 0x0a0a04, 0x080903, 0x080903, 0x080a04, 0x080904, 0x070803, 0x060702, 0x060702, 0x060702, 0x050601, 0x040601, 0x040601, 0x040500, 0x030400, 0x030401, 0x020301, 0x030300, 0x020300, 0x010200, 0x010201, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x020200, 0x020200, 0x020300, 0x030400, 0x030301, 0x030301, 0x030400, 0x040701, 0x060802, 0x070803, 0x080804, 0x080904, 0x080a04, 0x090b05, 0x0a0c04, 0x0a0b05, 0x0b0b06, 0x0b0b06, 0x0a0b05, 0x010200, 0x575a57, 0x3f4344, 0x373b41, 0x3a3d43, 0x393b40, 0x323336, 0x3e3d39, 0x3c3833, 0x16100b, 0x13100a, 0x171611, 0x1c1c17, 0x262722, 0x2b2c26, 0x2c2d27, 0x2b2c26, 0x2b2d27, 0x2e2f2b, 0x31342e, 0x32342e, 0x2e2f2a, 0x2a2923, 0x2a2a27, 0x353535, 0x333336, 0x35363a, 0x333438, 0x3a3b3f, 0x3c3d41, 0x3b3e41, 0x696969, 0x9c948e, 0x9c8d83, 0x908177, 0x857971, 0x8b7e77, 0x8c7f78, 0x83756e, 0x8a796f, 0x988675, 0x806c5b, 0x7a6453, 0x756252, 0x7e6c5b, 0x766351, 0x68543f, 0x715d47, 0x745f4a, 0x7a654f, 0x826d57, 0x8c7861, 0x917d66, 0x968069, 0x937f67, 0x98866d, 0x9f8e77, 0xa89581, 0xa7927e, 0xaf9d86, 0xb6a792, 0x9e9182, 0x5e544b, 0x655a50, 0x9b8a78, 0xb8a58e, 0xa6947d, 0x8e7b65, 0x9e8a73, 0xa79077, 0xbfa992, 0xb09d8a, 0x968270, 0x9c8875, 0xb7a692, 0xa59585, 0x817162, 0x8e7d6c, 0xa6937d, 0xbaa68b, 0xbfad92, 0x625543, 0x786956, 0xb8a58a, 0x776653, 0xbfae93, 0x978770, 0x463524, 0x443627, 0x78644f, 0x896f55, 0x846647, 0x795834, 0x6f4b21, 0x6a4419, 0x643c0e, 0x623c16, 0x684522, 0x6b4a29, 0x75573c, 0xc0a582, 0xd2bb9a, 0xc9b597, 0xc8b596, 0xbea98b, 0xbfa989, 0xd4bd9a, 0xd6bf9a, 0xd9c29e, 0xdec9a6, 0xe9d5b2, 0xdec9a7, 0xbea78c, 0x54381a, 0xa3896f, 0xb59779, 0xab9275, 0xb09b80, 0x9a856d, 0x866d52, 0xbfac94, 0xcab9a0, 0xb4a089, 0xa38c75, 0x927760, 0x78583d, 0x6f4b2f, 0x663e1d, 0x663804, 0x643706, 0x6a3f19, 0x673c16, 0x663c1c, 0x694327, 0x6a462a, 0x664227, 0x664226, 0x674326, 0x6c4828, 0x775132, 0x6e4f36, 0x342517, 0x151109, 0x17160c, 0x16150c, 0x15140d, 0x14120e, 0x15120e, 0x16130e, 0x14130b, 0x131309, 0x131409, 0x131309, 0x131307, 0x121206, 0x111206, 0x111207, 0x111107, 0x0f1006, 0x0e0f07, 0x0c0e04, 0x0b0d01, 0x0b0d02, 0x0b0c06, 0x0b0b05, 0x0b0a05, 0x0a0a04, 0x080903, 0x080a04, 0x090904, 0x070804, 0x060802, 0x060803, 0x050702, 0x050601, 0x050601, 0x040601, 0x030500, 0x030400, 0x030401, 0x020200, 0x020300, 0x010300, 0x010100, 0x010201, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010201, 0x020201, 0x020201, 0x020200, 0x030300, 0x030400, 0x030400, 0x030400, 0x030500, 0x050601, 0x060803, 0x060802, 0x070703, 0x080803, 0x090a04, 0x0a0b03, 0x0a0b02, 0x0c0c04, 0x0c0c06, 0x0b0c05, 0x040500, 0x2b2a28, 0x555758, 0x34373b, 0x3a3b42, 0x2f3037, 0x323136, 0x3a3937, 0x2e2b26, 0x060100, 0x100e09, 0x1d1b16, 0x1e1f19, 0x21221d, 0x2f2f2b, 0x2d2c27, 0x32312b, 0x34322e, 0x35352f, 0x363731, 0x353630, 0x353530, 0x34342e, 0x32302a, 0x12100b, 0x272826, 0x3b3c3e, 0x35353a, 0x323439, 0x383a3e, 0x3e3e43, 0x36383d, 0x494b4f, 0x827f7c, 0xab9f94, 0x9d8e81, 0x8a7b70, 0x86786f, 0x897972, 0x8a7972, 0x7c6a61, 0x847265, 0x9a8a7a, 0xa29181, 0xac9d8e, 0xa69687, 0xac9b8b, 0x978576, 0x82715f, 0x877664, 0xab9988, 0xa1917e, 0x988674, 0x9f8e7b, 0xa3937f, 0x9a8974, 0xac9c85, 0xb6a78f, 0xb2a18c, 0xa8947f, 0xbeaa92, 0xd4c3ac, 0xb6a793, 0x86786b, 0x4f4238, 0x918171, 0xbba994, 0x877867, 0x3c270c, 0xb4a692, 0xcdbda8, 0xb8a186, 0xcab69f, 0x8b7662, 0xa38e78, 0xc1ad94, 0xc5b49e, 0xa6947f, 0xa7937e, 0xb7a289, 0xbea98f, 0xbaa58c, 0x8b7a65, 0x281000, 0xae987f, 0xb9a183, 0xaf9a7e, 0x9f8c73, 0x4e3e2b, 0x392a1a, 0x513d27, 0x664e36, 0x886d54, 0x886c4f, 0x977b5d, 0xa18566, 0xb09372, 0xa0815e, 0xa1805b, 0xbc9e75, 0xc0a681, 0xa48a6a, 0x9e8668, 0xcab69a, 0xf5e6c8, 0xe9d9ba, 0xd4c09e, 0xe3d0ac, 0xe7d3af, 0xe2ceab, 0xdcc7a3, 0xd1bc97, 0xc7af8e, 0xb19373, 0x855d39, 0x784b1d, 0x764314, 0x73400a, 0x6e3c00, 0x6f3d03, 0x794a1d, 0x764404, 0x723e00, 0x754001, 0x7f4a16, 0x7f4b1b, 0x814e22, 0x804e24, 0x804e26, 0x825027, 0x84532d, 0x80502a, 0x7c4c27, 0x7b4c27, 0x6d411e, 0x603516, 0x643c1e, 0x5f3618, 0x623e1e, 0x724e2f, 0x6b4d31, 0x322111, 0x1b150a, 0x1a180c, 0x19160c, 0x18150b, 0x16120a, 0x16120a, 0x16110b, 0x16110c, 0x15120b, 0x13140a, 0x13140a, 0x14140a, 0x131309, 0x131309, 0x121208, 0x121207, 0x111206, 0x101107, 0x0f1006, 0x0e0e02, 0x0d0e01, 0x0d0e04, 0x0c0e07, 0x0b0c06, 0x0b0a05, 0x0a0a05, 0x080904, 0x090a05, 0x080a05, 0x070904, 0x070803, 0x060702, 0x060702, 0x060702, 0x050602, 0x050601, 0x040600, 0x030500, 0x030500, 0x020300, 0x020400, 0x020400, 0x010200, 0x010201, 0x010102, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x020200, 0x020200, 0x020200, 0x020200, 0x020300, 0x040400, 0x030400, 0x030500, 0x040501, 0x050701, 0x060802, 0x060802, 0x070802, 0x080801, 0x090a03, 0x0d0c03, 0x151004, 0x140f04, 0x0e0c05, 0x0c0c05, 0x000000, 0x3f3f3f, 0x484a4e, 0x393c42, 0x3a3c43, 0x26262c, 0x323130, 0x2b2825, 0x0b0500, 0x120f09, 0x1a1813, 0x20201b, 0x1f211c, 0x292925, 0x34312d, 0x3a3530, 0x36322b, 0x37342f, 0x3c3933, 0x3c3833, 0x37352f, 0x3a3831, 0x3b3831, 0x221f19, 0x2c2c28, 0x343530, 0x343535, 0x3c3e41, 0x333539, 0x383b3f, 0x3c3d41, 0x393b3f, 0x3f4045, 0x666667, 0xa39c93, 0xb5a697, 0xa79687, 0x928074, 0x948378, 0x948279, 0x89766e, 0x8a796f, 0x99887b, 0xb2a194, 0xa49588, 0xa29386, 0xa19182, 0xb5a393, 0xa38f7e, 0x847261, 0x978574, 0x948471, 0xa1917e, 0xa79783, 0xa99986, 0xa4937f, 0xab9a83, 0xb2a089, 0xb29d86, 0xa8927a, 0xa5937b, 0xc4b39b, 0xc2b29c, 0x9f8f7e, 0x716053, 0x605042, 0xb29e8a, 0xab9781, 0x746351, 0x8c7966, 0x947f69, 0xb59a7f, 0xd0b89b, 0xae9a82, 0xa18971, 0xc2ac91, 0xd8c5aa, 0xcbb8a0, 0xbea990, 0xb09b82, 0xc6b196, 0xbaa488, 0xb29d82, 0x6a5744, 0x503824, 0xb39a80, 0xc9b193, 0xae997d, 0x87745d, 0x64523e, 0x523d28, 0x624d3a, 0xcdb799, 0xd6be9b, 0xd1b895, 0xc7ae8a, 0xceb18c, 0xc3a57e, 0xbc9d76, 0xc3a77f, 0xdec6a0, 0xab8d69, 0xc0a37e, 0xceb492, 0xc4ad8b, 0xbca17e, 0xb0916c, 0xa7845d, 0x966e43, 0x8d6030, 0x875622, 0x814e17, 0x7b460d, 0x774205, 0x814b1c, 0x834c1d, 0x80491a, 0x7f4a1c, 0x824f21, 0x824f21, 0x844f22, 0x885427, 0x845125, 0x8b5629, 0x925c2e, 0x935b2d, 0x935d2e, 0x905c2f, 0x85522a, 0x7a4721, 0x6f3e1d, 0x6b3614, 0x693310, 0x653009, 0x64300c, 0x764522, 0x6b3d1b, 0x643d1c, 0x6e4e31, 0x5d452f, 0x2a1c0e, 0x1c170c, 0x1d190d, 0x1b180d, 0x1a160c, 0x18150b, 0x18130a, 0x17130a, 0x17130a, 0x17130b, 0x17130b, 0x15140b, 0x14140a, 0x141509, 0x131309, 0x131409, 0x12140a, 0x11120a, 0x121209, 0x101107, 0x101006, 0x0e0e04, 0x0d0e04, 0x0d0d06, 0x0c0c06, 0x0a0b05, 0x0b0a05, 0x0b0a05, 0x090904, 0x090a05, 0x080a05, 0x080904, 0x070803, 0x060701, 0x050701, 0x050701, 0x050702, 0x050601, 0x040601, 0x030500, 0x030400, 0x020200, 0x030300, 0x030300, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x020200, 0x020200, 0x020100, 0x020100, 0x030300, 0x040500, 0x030500, 0x030500, 0x040501, 0x050701, 0x060802, 0x070803, 0x070801, 0x080901, 0x090a02, 0x0f0f03, 0x372d1b, 0x2e2413, 0x0f0b04, 0x0a0b05, 0x060601, 0x4d5050, 0x32373d, 0x32363d, 0x2d3138, 0x2c2d31, 0x302e2c, 0x110c06, 0x0c0804, 0x181612, 0x22211c, 0x242420, 0x30302b, 0x383833, 0x3e3a34, 0x423b34, 0x3f3730, 0x3c352e, 0x423b34, 0x3f3934, 0x413d35, 0x403c34, 0x302c26, 0x282521, 0x45443f, 0x363630, 0x262520, 0x3f4241, 0x44474b, 0x363a3e, 0x3a3c42, 0x3b3c41, 0x404145, 0x505154, 0x6b6762, 0xaa9a8d, 0x9f8a79, 0x8c7667, 0x978375, 0x948174, 0x89756a, 0x938176, 0x9c8b7e, 0xac9a8e, 0xad9d8f, 0x93867b, 0x8b7d73, 0xab9a8c, 0x9f8a79, 0xa59180, 0x938170, 0x92816e, 0xa79680, 0xa69580, 0xa79782, 0xae9d86, 0xa8957f, 0xb6a38d, 0xb39f89, 0xa6927e, 0xa08f79, 0xae9b85, 0xbfad98, 0xb4a28e, 0x958372, 0x503e30, 0x95826e, 0xbea78f, 0xb19981, 0xb49a81, 0xb69b80, 0xbea486, 0xdac2a3, 0xe1cdb1, 0xaf977d, 0xb79f83, 0xcfba9d, 0xddcbb0, 0xd2c0a3, 0xc9b497, 0xbca789, 0xc1ac8b, 0xbea788, 0xbaa686, 0x988568, 0x7a6249, 0x8a7258, 0x866d53, 0x725b45, 0x604835, 0x4d331e, 0x3c1400, 0x978266, 0xe5cfac, 0xd6be9a, 0xd1b893, 0xc0a47f, 0xc5a882, 0xd1b690, 0xd3b892, 0xe9d2ad, 0xb48d5f, 0xaa7335, 0xa26a2c, 0x9c631f, 0x9c621c, 0xa26622, 0xac6c28, 0xad6d28, 0xa66725, 0xa46529, 0xa66a32, 0xa26632, 0x9e6533, 0x9f6839, 0x986135, 0x8d592d, 0x8b572d, 0x855229, 0x7e4b22, 0x794823, 0x643a1f, 0x64381b, 0x6e3b16, 0x6c3510, 0x69300a, 0x6e340b, 0x72390d, 0x6c350c, 0x612a07, 0x68300c, 0x672e09, 0x602500, 0x713b16, 0x986238, 0x7a461e, 0x6d411e, 0x715031, 0x513c27, 0x1d1409, 0x1b180d, 0x1e190f, 0x1e170d, 0x1c160c, 0x1c150b, 0x1b150a, 0x19150a, 0x18150a, 0x18140a, 0x171409, 0x17140a, 0x18150b, 0x16140a, 0x16150a, 0x16150a, 0x15140a, 0x15120c, 0x14120b, 0x14120b, 0x13120a, 0x121008, 0x0f0e05, 0x0e0f06, 0x0e0f07, 0x0c0d07, 0x0b0c06, 0x0a0b05, 0x0a0a04, 0x090904, 0x080a04, 0x070a04, 0x070904, 0x070803, 0x060701, 0x050601, 0x060702, 0x060701, 0x050701, 0x040601, 0x030401, 0x030400, 0x030300, 0x030300, 0x030301, 0x020200, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000100, 0x000101, 0x000000, 0x010101, 0x010101, 0x010000, 0x000000, 0x000000, 0x000000, 0x010000, 0x020100, 0x020200, 0x010100, 0x020100, 0x030300, 0x040500, 0x040500, 0x040500, 0x050701, 0x050701, 0x060802, 0x080903, 0x070801, 0x080901, 0x090b02, 0x121204, 0x302715, 0x2a200f, 0x100d04, 0x060600, 0x232423, 0x4c4f52, 0x31373e, 0x30333b, 0x2b2c33, 0x333134, 0x221e1b, 0x080300, 0x13110c, 0x1f1f1a, 0x24241f, 0x2b2b27, 0x3d3d38, 0x3c3a34, 0x453e36, 0x494037, 0x433a31, 0x433831, 0x433a32, 0x433b33, 0x473f36, 0x423b32, 0x15110b, 0x423f3a, 0x45423c, 0x36322d, 0x2d2a26, 0x292926, 0x484b4d, 0x42474c, 0x3c4045, 0x3d3e43, 0x3b3c3f, 0x454547, 0x454344, 0x8f8077, 0xa89080, 0x977d6d, 0x917b6d, 0x988274, 0x917b6e, 0xa08d7f, 0x9c8a7e, 0xa59385, 0xaf9e91, 0x5d534d, 0x7a706a, 0xd0c3b7, 0xa69585, 0xa18d7a, 0xa99886, 0x8e7b67, 0x9d8a74, 0xa28f7a, 0xa2907b, 0xa3927e, 0xa08d79, 0xab9985, 0xae9c89, 0xbcaa97, 0xc5b39f, 0xc3af99, 0xbfab96, 0xb9a48f, 0xad9884, 0x756250, 0x634f3d, 0xc4ab8f, 0xb99d7d, 0xb69a7a, 0xc5ad8c, 0xd2b991, 0xe0cba1, 0xf0dfb8, 0xceb995, 0xc3ad8a, 0xd9c7a2, 0xe9dab4, 0xefe1bd, 0xe5d5ae, 0xdec99e, 0xddc79a, 0xd8c294, 0xd6c095, 0xcdb38b, 0xbf9e74, 0xb28f5d, 0xac854e, 0xa67e3d, 0xa47f3b, 0xa47d38, 0xa9833e, 0x7d5b2d, 0xdac3a2, 0xe5cda8, 0xd7be95, 0xcbaf87, 0xcbb08a, 0xdabf99, 0xd6bd96, 0xe1cca7, 0xd6b588, 0xbf8237, 0xc2843e, 0xc48541, 0xc48541, 0xc18240, 0xc1803e, 0xc08141, 0xba7f43, 0xae753f, 0xa06a3b, 0x915b34, 0x834d2a, 0x774625, 0x6b3a1a, 0x652e0b, 0x672b04, 0x6f360b, 0x6c3916, 0x411804, 0x49220b, 0x673514, 0x672f0a, 0x632906, 0x6a300b, 0x6f330c, 0x71360b, 0x71350d, 0x6f340c, 0x6f330b, 0x612200, 0x844d22, 0xa56b3a, 0x844c1e, 0x7b4c28, 0x785536, 0x48321f, 0x191208, 0x1f190f, 0x1f180e, 0x1e170d, 0x1d160d, 0x1d150b, 0x1c140a, 0x1c130a, 0x1a160a, 0x19170b, 0x19160a, 0x18150a, 0x19150b, 0x19150c, 0x1a150c, 0x19150a, 0x18160a, 0x17150a, 0x17120d, 0x16110b, 0x15110a, 0x15110a, 0x14110a, 0x120f08, 0x100f07, 0x0f0f08, 0x0d0e08, 0x0c0d07, 0x0b0c07, 0x0a0c06, 0x090904, 0x080904, 0x070904, 0x070903, 0x070903, 0x060702, 0x060701, 0x060702, 0x050702, 0x050601, 0x050601, 0x040500, 0x030500, 0x030400, 0x020300, 0x030400, 0x030200, 0x010001, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000100, 0x000101, 0x000000, 0x010101, 0x010101, 0x010001, 0x000000, 0x000000, 0x000000, 0x000000, 0x020100, 0x020200, 0x020100, 0x020100, 0x030300, 0x040500, 0x030500, 0x050501, 0x050701, 0x050801, 0x060802, 0x080a03, 0x070801, 0x080901, 0x0a0c01, 0x0c0e02, 0x0e0b00, 0x100d03, 0x110f05, 0x020100, 0x37393a, 0x44484f, 0x363c46, 0x353a42, 0x323339, 0x302d2d, 0x130d08, 0x0c0904, 0x1a1a15, 0x22231d, 0x232320, 0x383834, 0x383631, 0x48423b, 0x50463e, 0x4a4138, 0x51463d, 0x4e433b, 0x4a4037, 0x4c4238, 0x4a4138, 0x2a231c, 0x37332f, 0x45403a, 0x413a34, 0x3a342f, 0x302c28, 0x292723, 0x2d2f30, 0x50575e, 0x434b51, 0x3c3f43, 0x3d3d40, 0x3e3c3f, 0x403e41, 0x685f5b, 0x9e8a7e, 0xb09888, 0xa18a7a, 0x8f7969, 0x9b8475, 0x9f897b, 0x9f8c7e, 0xaf9c8e, 0xb3a294, 0x92857c, 0x5c514b, 0x7f7067, 0x8d7969, 0x99836e, 0xbba994, 0x84705b, 0x836e59, 0x98846d, 0x9f8b76, 0xa6927d, 0xae9b84, 0xae9c84, 0x9f8a75, 0xa8947e, 0xb29f89, 0xb7a18b, 0xb29c85, 0xbba58e, 0xbea991, 0x927d65, 0x52371c, 0x997b59, 0xc19e6f, 0xbf9f6d, 0xd5bd8c, 0xd2ba82, 0xcdb479, 0xcbb178, 0xb99f6a, 0xd3c190, 0xdac996, 0xd4bf8c, 0xc8b27d, 0xc1a970, 0xc1a25f, 0xc4a357, 0xc5a150, 0xc69f4a, 0xcaa048, 0xc7993c, 0xc69337, 0xcb9837, 0xd7a540, 0xd8a943, 0xd9aa43, 0xe2b44e, 0xa67f33, 0xc0a685, 0xead2ab, 0xe3cba1, 0xd9be94, 0xe6cca3, 0xe8cea5, 0xddc49b, 0xdac39e, 0xe4cda6, 0xa2743f, 0x9c6b37, 0x916030, 0x855327, 0x7d491e, 0x764016, 0x6e360c, 0x6b3309, 0x642b03, 0x5d2200, 0x5b2100, 0x5c2400, 0x5d2601, 0x612a03, 0x682f09, 0x753a12, 0x75431c, 0x4e260c, 0x5a2e10, 0x6f3b15, 0x6d330e, 0x662c09, 0x672c09, 0x6f350c, 0x773d11, 0x71350b, 0x77390c, 0x7b3b0e, 0x6e2a00, 0x9b612f, 0xb47a42, 0x894e1c, 0x824e22, 0x7b5231, 0x48311d, 0x1f140b, 0x221a10, 0x21190f, 0x1f170e, 0x1e160c, 0x1e160d, 0x1d150b, 0x1c140a, 0x1b140a, 0x19160a, 0x1a180b, 0x1a170b, 0x1a160b, 0x1c150b, 0x1c140c, 0x1c140d, 0x1a150b, 0x191509, 0x181509, 0x17140a, 0x16120a, 0x16110b, 0x15110b, 0x14110b, 0x13100a, 0x101009, 0x0e0f08, 0x0d0e08, 0x0d0d08, 0x0c0d07, 0x0a0b06, 0x090a04, 0x0a0904, 0x080902, 0x080903, 0x070803, 0x070802, 0x060801, 0x060801, 0x050802, 0x050701, 0x050601, 0x040500, 0x030500, 0x030401, 0x030300, 0x030300, 0x020300, 0x020101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020100, 0x020200, 0x020100, 0x030100, 0x030300, 0x030400, 0x030500, 0x040601, 0x050701, 0x060801, 0x070802, 0x080a03, 0x080902, 0x080a01, 0x0a0c02, 0x0b0d04, 0x0b0c05, 0x0e0d05, 0x100f06, 0x0a0800, 0x434648, 0x3c424a, 0x343a44, 0x32363e, 0x3a393c, 0x231f1c, 0x0b0602, 0x0f0e09, 0x1f1f1a, 0x232420, 0x2d2d2a, 0x3b3a36, 0x3f3b34, 0x4f463e, 0x4a4038, 0x4f443c, 0x544840, 0x4e4239, 0x53463d, 0x53493f, 0x393028, 0x38332d, 0x48413a, 0x453d35, 0x453c35, 0x3d3630, 0x393430, 0x33312e, 0x353737, 0x3e464a, 0x434b50, 0x3c4145, 0x36373a, 0x3a393d, 0x39383b, 0x444142, 0x897e79, 0xac9a8e, 0xaf9a8a, 0xa89282, 0xa18a79, 0x9b8573, 0x9d8778, 0xb2a091, 0xad9c8e, 0xa6958a, 0x948479, 0x806f62, 0x927e6d, 0xa99681, 0xc0ad97, 0x87725a, 0x7a654e, 0x958069, 0xab9880, 0xae9a82, 0xb8a48b, 0xbca88d, 0xb7a184, 0xbba78b, 0xcebb9d, 0xc3ae8f, 0xd1bd9b, 0xd7c4a1, 0xd6c39e, 0xc1ab87, 0x826236, 0xa87f30, 0xcba249, 0xd5af4e, 0xd2ac45, 0xd6b247, 0xd9b74b, 0xd6b246, 0xdebd54, 0xe1c15a, 0xdebe57, 0xe0bd58, 0xdab649, 0xdeba4b, 0xe6c355, 0xedc95b, 0xebc656, 0xeec859, 0xecc559, 0xebc457, 0xe6bb51, 0xe3b650, 0xe0b350, 0xd7ab4a, 0xd6ac4d, 0xd5ac51, 0xb59047, 0xa08362, 0xe5cca5, 0xdcc398, 0xdfc69d, 0xc8ad88, 0xc1a784, 0xdbc29a, 0xdcc49c, 0xe3ceaa, 0x957c66, 0x420000, 0x5d2b07, 0x622e08, 0x68330d, 0x6a330c, 0x733b13, 0x733c14, 0x69330d, 0x67310c, 0x67310d, 0x5f2a07, 0x652d09, 0x6b300a, 0x723914, 0x723f1d, 0x542a11, 0x6a3b1a, 0x733d14, 0x6d320d, 0x6a2b08, 0x71320d, 0x71330c, 0x773a10, 0x75390e, 0x703108, 0x7a390b, 0x763300, 0xb2763c, 0xc18446, 0x955721, 0x875125, 0x744c2b, 0x432b17, 0x23170a, 0x261d12, 0x241d0f, 0x211a0d, 0x1f180d, 0x1f160d, 0x1f160d, 0x1d150c, 0x1b180c, 0x1b180c, 0x1b170c, 0x1c160c, 0x1c180d, 0x1d160c, 0x1d150c, 0x1d140c, 0x1e150d, 0x1d140c, 0x1c160b, 0x1a150a, 0x181509, 0x171409, 0x17130a, 0x16100a, 0x14100a, 0x12100a, 0x100f09, 0x0e0e09, 0x0d0e09, 0x0d0c08, 0x0d0b07, 0x0b0a06, 0x0a0905, 0x0c0904, 0x0a0903, 0x090803, 0x080802, 0x070801, 0x070902, 0x060902, 0x060903, 0x060902, 0x050701, 0x040500, 0x030500, 0x030400, 0x030200, 0x030300, 0x020200, 0x010001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x030200, 0x030201, 0x020100, 0x020200, 0x030300, 0x020300, 0x030401, 0x050602, 0x050701, 0x050801, 0x060802, 0x070903, 0x070802, 0x080901, 0x0a0a04, 0x0c0b06, 0x0d0c07, 0x0e0d07, 0x0f0d04, 0x1d1c19, 0x494c4e, 0x3a4047, 0x373d45, 0x33353b, 0x343233, 0x140f09, 0x0b0703, 0x171712, 0x22231f, 0x272725, 0x30312d, 0x3e3c36, 0x484138, 0x4b4238, 0x3e352d, 0x564a41, 0x4c4138, 0x4e413a, 0x5d5046, 0x473c32, 0x3e3730, 0x4c443c, 0x4b423b, 0x4b413a, 0x443b34, 0x483f38, 0x3e3931, 0x3b3934, 0x3a3d3c, 0x434b51, 0x3f464c, 0x393d40, 0x323336, 0x3a393d, 0x373639, 0x303133, 0x635e5c, 0xad9f96, 0xae9b8d, 0xa69181, 0xb39d89, 0xac9682, 0xab9684, 0xbba999, 0xbfaf9f, 0xc1b0a2, 0xc5b4a4, 0xc4b2a2, 0xccbba8, 0xcebda9, 0xbaa791, 0xb4a187, 0xb9a48b, 0xb29c82, 0xc7b297, 0xd1bea2, 0xd0be9f, 0xd2bf9c, 0xc9b28c, 0xc7ad86, 0xc5ac83, 0xb9a071, 0xc1a76d, 0xcfb471, 0xd5ba6c, 0xdcbe68, 0xdebb5b, 0xe2b949, 0xe2b845, 0xe6be48, 0xe4bd47, 0xe8c34a, 0xebc64b, 0xecc84e, 0xf6d55c, 0xf9da63, 0xfadb66, 0xf8d866, 0xf3d060, 0xeecc5e, 0xedcd66, 0xe5c560, 0xdebe61, 0xd6b660, 0xc9a95c, 0xb89a50, 0xa4843e, 0x906e33, 0x7f5c29, 0x754f1d, 0x6f4917, 0x70491b, 0x6f4614, 0x8c6c47, 0xdac09b, 0xceb38b, 0xe2c8a1, 0x896441, 0x5f2800, 0xc0a785, 0xe2c9a1, 0xcfb690, 0xd4bc9d, 0x643919, 0x6d3912, 0x6e3913, 0x6b3610, 0x713b15, 0x763f18, 0x6d3710, 0x6c360f, 0x6e3712, 0x67300c, 0x642c09, 0x672e09, 0x703814, 0x6c3a1d, 0x4d240f, 0x754521, 0x7c4216, 0x73360b, 0x70310b, 0x763710, 0x76370f, 0x78390e, 0x7b3b11, 0x79390e, 0x763509, 0x753306, 0xb97d44, 0xbf8242, 0x92541b, 0x8b5528, 0x714928, 0x3c2512, 0x281b0d, 0x271d10, 0x211805, 0x231d0a, 0x221c0a, 0x201a0d, 0x1f190d, 0x20170e, 0x1c170d, 0x1a180c, 0x1b190d, 0x1f180e, 0x22190f, 0x211a10, 0x20180e, 0x1e160c, 0x1e150d, 0x1e150e, 0x1d160d, 0x1d160e, 0x1b160d, 0x19160a, 0x19160a, 0x18140a, 0x17120b, 0x151109, 0x131009, 0x121009, 0x0f0e08, 0x0e0e09, 0x0e0d08, 0x0f0c07, 0x0e0b06, 0x0c0a06, 0x0c0905, 0x0c0904, 0x0a0803, 0x090803, 0x080803, 0x070902, 0x060802, 0x060802, 0x060802, 0x050701, 0x040500, 0x040401, 0x030301, 0x030200, 0x030300, 0x030300, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x020202, 0x020202, 0x020202, 0x020201, 0x020201, 0x030301, 0x040301, 0x040402, 0x060702, 0x060802, 0x060902, 0x060902, 0x070903, 0x080903, 0x0a0a05, 0x0b0b07, 0x0c0c07, 0x0d0b06, 0x0d0800, 0x2c2b29, 0x45494b, 0x3d4248, 0x3d4149, 0x3a3b3e, 0x2c2a28, 0x0a0501, 0x0e0b07, 0x21221d, 0x1e1f1b, 0x31322e, 0x363631, 0x454038, 0x4c423b, 0x3d342c, 0x4d423a, 0x51443b, 0x4d4038, 0x51443a, 0x473b32, 0x3a332b, 0x595249, 0x534a41, 0x51473e, 0x493f36, 0x483e35, 0x3f372e, 0x3c3730, 0x36342f, 0x35393b, 0x4b5257, 0x353d42, 0x373c40, 0x34373a, 0x38383b, 0x404044, 0x38383a, 0x383635, 0xa2978f, 0xd6c9bb, 0xcfc1b2, 0xd4c4b1, 0xccbead, 0xc8b7a7, 0xbcac9d, 0xb8a798, 0xac9b8d, 0xa08d7b, 0xa18871, 0xaa8d6e, 0x8a6a49, 0xad9478, 0xb29c81, 0x9d8266, 0x9b7c57, 0xa07e54, 0xa3804e, 0xa47f47, 0xb8924d, 0xc09949, 0xcda64e, 0xc79d41, 0xd4af52, 0xe2be5a, 0xe3c054, 0xf2d15f, 0xf6d662, 0xf2d15a, 0xf1cd54, 0xf3d159, 0xf8d965, 0xf8d968, 0xf5d86a, 0xf2d567, 0xebce63, 0xe2c25f, 0xd7b75b, 0xcaaa55, 0xb79648, 0xa5833e, 0x927134, 0x815e28, 0x714b1c, 0x63390c, 0x592500, 0x521900, 0x521b00, 0x521f00, 0x552601, 0x60350d, 0x663c13, 0x6b4419, 0x734d20, 0x764f1f, 0x9a7951, 0xe6cfa9, 0xe1c9a0, 0xe1c79e, 0xa28360, 0x6a3500, 0x927355, 0xddc19a, 0xd6bb94, 0xdec6a4, 0xb5997c, 0x662f00, 0x703d15, 0x733f16, 0x774118, 0x723b13, 0x733c13, 0x723b12, 0x68300c, 0x6d3510, 0x6c340f, 0x703a15, 0x6c3b1d, 0x4d240d, 0x71421e, 0x7f4416, 0x793b0d, 0x79390c, 0x813e11, 0x78360b, 0x7e3f12, 0x814213, 0x7c3d12, 0x753409, 0x76370d, 0xb47840, 0xb07438, 0x8f541b, 0x8b582c, 0x684424, 0x372512, 0x2a1f12, 0x281f13, 0x241d0c, 0x484234, 0x30291b, 0x241d0d, 0x211b0d, 0x1e1a0e, 0x1d180d, 0x1d190e, 0x1e1c10, 0x1f1d10, 0x231c12, 0x241c12, 0x231c11, 0x231c11, 0x211a0f, 0x20190f, 0x1f180e, 0x1e170e, 0x1d170d, 0x1b180d, 0x1b170c, 0x19150c, 0x18140a, 0x18140a, 0x151309, 0x121209, 0x101108, 0x101007, 0x100f08, 0x0f0e08, 0x0e0d07, 0x0f0d07, 0x0c0c04, 0x0b0a04, 0x0b0a03, 0x0a0902, 0x090903, 0x080a04, 0x070a03, 0x060802, 0x060702, 0x060601, 0x050601, 0x030500, 0x030400, 0x030400, 0x030400, 0x020300, 0x030200, 0x030200, 0x020100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x020102, 0x020202, 0x020202, 0x020201, 0x030200, 0x030300, 0x030301, 0x040402, 0x060703, 0x060802, 0x060902, 0x070a03, 0x070a03, 0x080903, 0x0a0905, 0x0b0b07, 0x0c0b07, 0x0d0b06, 0x070500, 0x303030, 0x424448, 0x393c43, 0x383d43, 0x3e4042, 0x221f1c, 0x080300, 0x171611, 0x23231e, 0x30312e, 0x3b3c37, 0x423f37, 0x494138, 0x453c34, 0x3a3129, 0x4b4038, 0x4e4038, 0x4f4139, 0x4b3e35, 0x251b14, 0x534d44, 0x524b41, 0x574c43, 0x554840, 0x483b33, 0x453b32, 0x3f372d, 0x39352d, 0x272723, 0x42474c, 0x3d4349, 0x343a40, 0x34383d, 0x35373b, 0x35363a, 0x3f3e42, 0x3e3c3e, 0x4f4541, 0x68564b, 0x9d8976, 0x947e6b, 0x856b57, 0x7d5f43, 0x76502e, 0x693c07, 0x784a0f, 0x845414, 0x8a591b, 0x8a5b20, 0x9b6d33, 0xa57637, 0xaf7f36, 0xb78737, 0xbb8a38, 0xc4923b, 0xc9963b, 0xce9b3f, 0xd19f41, 0xe1b34e, 0xe7bc51, 0xf0c75a, 0xf0c75a, 0xf1cd61, 0xf6d366, 0xf3cf5f, 0xf0cd61, 0xe9c75f, 0xe1be58, 0xdcb853, 0xd4b255, 0xc8a852, 0xbb9948, 0xa88439, 0x9b742e, 0x8d621f, 0x825213, 0x7d4a08, 0x784200, 0x6d3500, 0x6c3500, 0x653100, 0x633100, 0x613001, 0x623306, 0x64360a, 0x633509, 0x61350b, 0x64390f, 0x643810, 0x653a11, 0x6d4218, 0x70481c, 0x724c1f, 0x77501d, 0xa88a63, 0xedd7b1, 0xe5cea6, 0xe4c9a1, 0xbea17d, 0x683400, 0x744824, 0xcaaf8b, 0xdec49d, 0xcab08b, 0xdfc39d, 0x8e6a49, 0x713c09, 0x7a461a, 0x774114, 0x70370c, 0x753c12, 0x733b12, 0x69320c, 0x6f3810, 0x7b431b, 0x6f3c19, 0x5a2d11, 0x76431b, 0x7d4211, 0x7e3d0b, 0x803d0c, 0x87430f, 0x87420d, 0x884310, 0x884513, 0x844414, 0x7d3f0f, 0x824518, 0xb1763e, 0xa2672e, 0x8a521c, 0x8a5b30, 0x6d4a2b, 0x362411, 0x2d2515, 0x2c2317, 0x292115, 0x231f0e, 0x464033, 0x332a1d, 0x241c0f, 0x231b0f, 0x211b10, 0x211c10, 0x221c11, 0x221e12, 0x241e12, 0x251f13, 0x251e12, 0x241e12, 0x231d10, 0x221c0f, 0x221c10, 0x201b0f, 0x20190d, 0x1f170c, 0x1e190d, 0x1e190e, 0x1d150d, 0x1a140b, 0x18150b, 0x131409, 0x121209, 0x110f06, 0x101006, 0x100f05, 0x0f0e05, 0x0f0d03, 0x0e0b01, 0x020000, 0x0d0b02, 0x0a0a02, 0x0a0a02, 0x090903, 0x080a04, 0x070903, 0x060702, 0x060702, 0x060601, 0x060501, 0x040401, 0x030400, 0x030400, 0x030400, 0x020300, 0x020200, 0x020200, 0x020100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020101, 0x030202, 0x030202, 0x030201, 0x030201, 0x030200, 0x030301, 0x040402, 0x060603, 0x060802, 0x070903, 0x070903, 0x070a04, 0x080903, 0x090903, 0x0b0b05, 0x0c0c07, 0x0d0c07, 0x080600, 0x373737, 0x404246, 0x36383d, 0x33363b, 0x3f3e3f, 0x18120d, 0x0c0903, 0x1c1b16, 0x292a26, 0x3a3b37, 0x3b3b34, 0x474137, 0x463e34, 0x41392f, 0x41372f, 0x483d35, 0x52443b, 0x493c33, 0x241a13, 0x504c43, 0x575045, 0x554d41, 0x5b5045, 0x55483d, 0x504238, 0x473e33, 0x443d32, 0x322f28, 0x26292a, 0x41464a, 0x30343a, 0x363a40, 0x33373d, 0x34373b, 0x36383c, 0x3d3d3f, 0x48413d, 0x624d3f, 0x75502e, 0x8a5b2a, 0xa6763c, 0xa36f30, 0xaa7537, 0xb07a3a, 0xb17a38, 0xb57e3a, 0xb78139, 0xbc863c, 0xba853a, 0xbe893b, 0xc38f3f, 0xcc9a43, 0xd19e43, 0xd6a142, 0xd7a240, 0xdaa744, 0xdca947, 0xdcaa4b, 0xd7a94b, 0xd2a64b, 0xc79b46, 0xb98d3e, 0xb0843a, 0xa97e37, 0x9d6e2a, 0x966321, 0x935f1b, 0x97631b, 0x92590a, 0x975e12, 0x996216, 0x9d681c, 0x9f691e, 0x98621d, 0x98621e, 0x97611f, 0x925d1e, 0x8c5719, 0x824d14, 0x784611, 0x713f0f, 0x663407, 0x603107, 0x5c2e05, 0x5c3008, 0x61340b, 0x62360d, 0x62370d, 0x64390f, 0x6a3f14, 0x73491b, 0x764e1f, 0x785221, 0x7c541d, 0xab8d64, 0xedd7b1, 0xdec69e, 0xe0c79f, 0xd0b58f, 0x714319, 0x6d3a0a, 0xa88a6b, 0xe0c69f, 0xdac09b, 0xd5b992, 0xc9aa86, 0x764313, 0x7b4617, 0x733c0e, 0x753b0e, 0x7a4115, 0x6e350c, 0x703910, 0x7d471c, 0x76411a, 0x673613, 0x7f491c, 0x844814, 0x86470e, 0x89450d, 0x8d4710, 0x8f4a11, 0x975217, 0x924c12, 0x8f4b15, 0x8d4b16, 0x995b22, 0xb7793c, 0x975c26, 0x84501f, 0x875d35, 0x694b2d, 0x392713, 0x312516, 0x312719, 0x2e2218, 0x2a2115, 0x252214, 0x251f0e, 0x282011, 0x272010, 0x241c0e, 0x251c0f, 0x261e10, 0x261f11, 0x272011, 0x272011, 0x272013, 0x251f14, 0x251f13, 0x262013, 0x262014, 0x251e11, 0x251d10, 0x241b0c, 0x221a0a, 0x221a0a, 0x20190a, 0x1f160c, 0x1c150d, 0x19150d, 0x161408, 0x151209, 0x120f05, 0x120f05, 0x120f05, 0x100e04, 0x0e0b03, 0x1d180f, 0x443f37, 0x0a0700, 0x0b0a03, 0x090a03, 0x090a03, 0x070a03, 0x070903, 0x060702, 0x060702, 0x060501, 0x070501, 0x040500, 0x030400, 0x030400, 0x030400, 0x020300, 0x030200, 0x030200, 0x020200, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x020201, 0x030301, 0x020201, 0x030301, 0x030301, 0x030301, 0x050503, 0x060703, 0x070903, 0x070903, 0x080904, 0x080903, 0x090903, 0x0a0a04, 0x0b0c06, 0x0c0c07, 0x0d0b07, 0x0e0c06, 0x393a3a, 0x3a3d41, 0x2f3135, 0x393a3d, 0x3c3a39, 0x0f0901, 0x101009, 0x232420, 0x323330, 0x32332f, 0x3b3931, 0x4a4439, 0x4c443a, 0x473d34, 0x473d34, 0x4a3d33, 0x4f4137, 0x291f17, 0x36332d, 0x5d574e, 0x595146, 0x5c5045, 0x605245, 0x594b3c, 0x55483b, 0x534a3d, 0x423c33, 0x272623, 0x404346, 0x3d4145, 0x3c3e42, 0x2b2e33, 0x33363d, 0x38383e, 0x37383b, 0x464140, 0x513d33, 0x825b34, 0xab7a46, 0x9a642d, 0xb17839, 0xb47831, 0xba8036, 0xc38a3d, 0xc88f40, 0xca9142, 0xc48c3f, 0xc38c42, 0xc59145, 0xc89447, 0xc69345, 0xc28f44, 0xb58038, 0xaf7931, 0xab742d, 0xa46d29, 0x985f21, 0x884e16, 0x80430a, 0x84450b, 0x874608, 0x8b4a08, 0x955410, 0x94520e, 0x9a5c17, 0xa76820, 0xaa6e23, 0xae7427, 0xac7325, 0xac7326, 0xae762b, 0xad782c, 0xa56e26, 0x9b6421, 0x9d6723, 0x955f1d, 0x8d571a, 0x854f15, 0x79440e, 0x703d0c, 0x6d3b0b, 0x663608, 0x623308, 0x5f3208, 0x5b2f07, 0x5c3109, 0x5f330a, 0x65390f, 0x6b4014, 0x714718, 0x7a511f, 0x7c5422, 0x805a26, 0x835b25, 0x9e7a4d, 0xe0c79f, 0xd0b58c, 0xdfc59b, 0xe3c7a0, 0x896545, 0x6b3600, 0x855e3f, 0xd7bd97, 0xddc39c, 0xdcc29d, 0xe5cba7, 0x8b6541, 0x7c450e, 0x774011, 0x814819, 0x7f4618, 0x733b10, 0x79441a, 0x713e19, 0x6e3a12, 0x854b1a, 0x86460f, 0x8e4b0f, 0x965215, 0x954f11, 0x965012, 0x9e5a19, 0x9d591a, 0x995417, 0x955012, 0x9d5c1f, 0xb17334, 0x93581f, 0x885226, 0x825934, 0x5d4227, 0x342410, 0x322716, 0x332718, 0x322517, 0x302317, 0x2e2216, 0x2a2314, 0x2c2315, 0x2b2214, 0x292111, 0x292111, 0x292112, 0x292112, 0x272010, 0x272010, 0x272111, 0x272013, 0x262014, 0x252014, 0x272115, 0x292216, 0x2c2311, 0x2e200c, 0x31200c, 0x2d1e0b, 0x281e0a, 0x221a08, 0x1e160a, 0x1d150e, 0x19150c, 0x171409, 0x161207, 0x130f03, 0x120e05, 0x110e06, 0x100f06, 0x0e0d07, 0x16130c, 0x2f2b24, 0x0e0c03, 0x0a0a04, 0x090904, 0x080903, 0x080902, 0x070902, 0x060701, 0x060601, 0x060501, 0x050501, 0x040400, 0x030400, 0x030400, 0x030400, 0x020400, 0x020200, 0x020200, 0x020100, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010101, 0x000000, 0x010100, 0x010100, 0x020200, 0x020301, 0x030301, 0x030302, 0x030301, 0x030401, 0x030401, 0x040501, 0x060702, 0x060802, 0x070903, 0x080803, 0x090904, 0x0a0904, 0x0a0a05, 0x0b0c07, 0x0c0b07, 0x0c0a05, 0x14140f, 0x3f4142, 0x3b3d41, 0x2f3136, 0x3d3f40, 0x373632, 0x0a0400, 0x181812, 0x2c2d29, 0x2d2e2a, 0x302f2a, 0x464338, 0x4f493d, 0x443a31, 0x50443b, 0x4d4037, 0x53443a, 0x3c3027, 0x25211c, 0x575249, 0x564e44, 0x584d41, 0x605245, 0x5b4c3d, 0x544637, 0x5a4f3f, 0x473f34, 0x2d2a23, 0x3d4141, 0x515558, 0x393d42, 0x4b4d50, 0x2a2c2e, 0x35373b, 0x3a3b3f, 0x3e3c3d, 0x4c3c34, 0x765130, 0xb37e46, 0xb87c39, 0xac7030, 0x975b21, 0xb77b3a, 0xb47c3b, 0xaf7839, 0xaa7234, 0xa16a2f, 0x925a27, 0x935927, 0x864e1d, 0x773d0f, 0x7b3d09, 0x87460c, 0x864308, 0x89460a, 0x99571b, 0x945217, 0x904e14, 0x8c4b14, 0x8c4912, 0x965318, 0x9d591a, 0xa4621e, 0xa5631e, 0xa05d1c, 0x9f5d1a, 0xa3651d, 0xa5681f, 0xa76b21, 0xa97025, 0xa87026, 0xa46d26, 0xa46e28, 0xa16b26, 0xa06b28, 0xa16c29, 0x9d6826, 0x986324, 0x8f5b1f, 0x814c16, 0x74400f, 0x703f10, 0x6e3e0f, 0x683a0c, 0x65370c, 0x66390e, 0x683c11, 0x673c11, 0x6b3f14, 0x714618, 0x784d1d, 0x7e5622, 0x805925, 0x855f2a, 0x87612a, 0x956d37, 0xcfb188, 0xdbbe93, 0xd8bb8e, 0xdbbe93, 0xbd9f7c, 0x6d4118, 0x765232, 0xd7bd98, 0xd4ba93, 0xd0b993, 0xe6cfab, 0x906d4b, 0x7b4505, 0x814a17, 0x834a19, 0x7d4416, 0x7b451b, 0x653412, 0x6f3c13, 0x8a501b, 0x8a4a10, 0x954f12, 0xa8621e, 0xa45d19, 0x9f5a14, 0xa36115, 0xa4631a, 0xa1611b, 0x9f5b15, 0xa96825, 0xb87936, 0x995c21, 0x8e5929, 0x7e5631, 0x573d24, 0x332612, 0x352918, 0x332817, 0x322618, 0x322517, 0x302316, 0x302315, 0x2f2314, 0x302315, 0x302315, 0x2c2313, 0x2d2514, 0x2d2514, 0x2c2513, 0x282210, 0x282111, 0x272112, 0x272013, 0x282115, 0x272115, 0x282215, 0x2c2312, 0x3b2c0f, 0x594610, 0x634f13, 0x483308, 0x34240b, 0x261b0a, 0x1e160b, 0x1d150e, 0x19150c, 0x171309, 0x161207, 0x141006, 0x120f05, 0x100f06, 0x0f0f07, 0x0d0d07, 0x0b0b06, 0x030400, 0x0b0a05, 0x090a04, 0x080a04, 0x080802, 0x080902, 0x080901, 0x070801, 0x060701, 0x050601, 0x050501, 0x030400, 0x030400, 0x030400, 0x030300, 0x020300, 0x020200, 0x020200, 0x020100, 0x010001, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010000, 0x020100, 0x020200, 0x020200, 0x020201, 0x030301, 0x030301, 0x030401, 0x030601, 0x040500, 0x050500, 0x050702, 0x060802, 0x070903, 0x090903, 0x0a0904, 0x0a0a05, 0x0b0b06, 0x0c0c07, 0x0d0b07, 0x0b0a05, 0x191915, 0x414244, 0x37393e, 0x35373b, 0x414141, 0x2b2723, 0x0c0702, 0x20211d, 0x282a25, 0x2c2e29, 0x43433a, 0x534f43, 0x4a4338, 0x4c4338, 0x554a3f, 0x5b4e42, 0x4f4237, 0x201811, 0x49463f, 0x595247, 0x574c40, 0x504337, 0x534538, 0x554637, 0x5c4f40, 0x544b3b, 0x3a342a, 0x30302d, 0x5c6162, 0x404448, 0x3e4245, 0x343739, 0x222224, 0x2e2e32, 0x3c3b3c, 0x413730, 0x5e3d25, 0x9c6738, 0xb6793a, 0xb67630, 0xbd813a, 0xb88248, 0x7e3c05, 0x813f0a, 0x8c4a11, 0x945316, 0x945319, 0x92521a, 0x93531b, 0x8d4e18, 0x8b4c17, 0x8e4e18, 0x9c5c23, 0x93521a, 0x8d4b15, 0x8f4e17, 0x8b4a14, 0x8a4812, 0x874511, 0x874310, 0x8d4812, 0x934f14, 0x914d11, 0x924e12, 0x945015, 0x995718, 0x9b5d1a, 0xa36822, 0xaa6f28, 0xab712b, 0xa8702a, 0xa7702b, 0xaa732d, 0xac7830, 0xac7830, 0xa9742d, 0xa36e2b, 0x996423, 0x905b1d, 0x834e15, 0x774410, 0x754212, 0x703e0f, 0x6a3a0b, 0x68390d, 0x67380d, 0x6a3d11, 0x683c0f, 0x6a3e12, 0x704617, 0x7a511f, 0x825a24, 0x866028, 0x88652c, 0x886228, 0x91682f, 0xab8758, 0xdabc8f, 0xddbf91, 0xc7a779, 0xceaf85, 0xceb38f, 0xdbc4a1, 0xd2b892, 0xd5b992, 0xdbc4a0, 0xdbc4a4, 0x7e5225, 0x875217, 0x88511a, 0x814917, 0x7f4a1c, 0x62320e, 0x723e15, 0x93561f, 0x8f4f14, 0x945112, 0xa15b16, 0xaa661b, 0xa76517, 0xab6c1a, 0xc79746, 0xb88131, 0xa66719, 0xbd8035, 0xc2853d, 0xa26427, 0x96612e, 0x805831, 0x523b20, 0x382a15, 0x382c19, 0x352c1a, 0x332a18, 0x332717, 0x322618, 0x322417, 0x312415, 0x312514, 0x332617, 0x332517, 0x2f2616, 0x2f2715, 0x2e2714, 0x2e2613, 0x2b2413, 0x292212, 0x282212, 0x261f0e, 0x282112, 0x282112, 0x282213, 0x2d220d, 0x5c4914, 0xbbac68, 0xd3c67e, 0x917d36, 0x432c00, 0x281c0a, 0x1f180c, 0x1c160b, 0x181509, 0x161309, 0x161209, 0x141108, 0x141006, 0x101007, 0x0e0e07, 0x0c0d07, 0x0c0c07, 0x0b0b06, 0x0a0a05, 0x090904, 0x090904, 0x080803, 0x080801, 0x080800, 0x070701, 0x060701, 0x050601, 0x050600, 0x030500, 0x030400, 0x030400, 0x020201, 0x020201, 0x020200, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010000, 0x020100, 0x020200, 0x020200, 0x030301, 0x030301, 0x030301, 0x030501, 0x040601, 0x050701, 0x050601, 0x050702, 0x060803, 0x070903, 0x090803, 0x0a0904, 0x0a0a05, 0x0b0b07, 0x0c0d08, 0x0d0c07, 0x0a0903, 0x222220, 0x3c3d40, 0x303236, 0x383c3e, 0x424240, 0x1e1b14, 0x0e0c06, 0x1f211d, 0x272924, 0x3a3b33, 0x4f4e42, 0x534e41, 0x464034, 0x574e42, 0x574c3f, 0x53473b, 0x342a22, 0x3b3832, 0x5a5449, 0x5a5244, 0x5a4d40, 0x514236, 0x4a3b2f, 0x534637, 0x584e3e, 0x4a4236, 0x302e26, 0x565c5b, 0x4d5355, 0x393d40, 0x444548, 0x2e2f32, 0x29292b, 0x303031, 0x3f3933, 0x503522, 0x804f26, 0x9c5d24, 0xb16d2a, 0xb16f25, 0xcb914a, 0x915724, 0x823f09, 0x874612, 0x8b4b14, 0x915217, 0x8f5117, 0x8f521c, 0x884a17, 0x7f4110, 0x7b3c0f, 0x793a0d, 0x7d3c0f, 0x803f0f, 0x854410, 0x894712, 0x884611, 0x894713, 0x8d4b16, 0x904e18, 0x8d4a13, 0x8d4a13, 0x8d4a12, 0x904b13, 0x955115, 0x9a5a1b, 0xa36623, 0xa86d27, 0xa96f28, 0xab712b, 0xab722b, 0xab742c, 0xae772f, 0xb07b31, 0xb17d31, 0xae7a2c, 0xa67026, 0x9e6622, 0x96601e, 0x8b5617, 0x844e16, 0x7d4914, 0x73400d, 0x6b3909, 0x66380b, 0x64340a, 0x62350a, 0x663a0e, 0x683c0f, 0x754a1a, 0x7e5522, 0x835c25, 0x886228, 0x8d692e, 0x8d662b, 0x865c1f, 0xa67d45, 0xc09e67, 0xd9b884, 0xceae7f, 0xccaf84, 0xe3cea6, 0xebd9b5, 0xd8c29e, 0xc7af8a, 0xe5d2af, 0xa58a6a, 0x814e00, 0x8f5c1f, 0x8b571d, 0x814d1a, 0x68350b, 0x7e4a1a, 0x995d23, 0x9a5a19, 0x955110, 0xa05d18, 0xa66219, 0xad7323, 0xbb8733, 0xb57f25, 0xd5ab52, 0xc2913a, 0xbc8233, 0xbe8137, 0xa46727, 0x9a6532, 0x825932, 0x543a1e, 0x41301a, 0x3e301e, 0x392e1d, 0x362e1c, 0x332c1a, 0x332918, 0x342818, 0x332717, 0x342818, 0x352a19, 0x372b1a, 0x352918, 0x312818, 0x2f2916, 0x2d2613, 0x2e2614, 0x2f2714, 0x302714, 0x3a3115, 0x4b4122, 0x332a0e, 0x2b2511, 0x2a2413, 0x2a1e08, 0x6e5a1d, 0xded086, 0xf8eca0, 0xb5a04d, 0x513700, 0x291b07, 0x1f180b, 0x1b170c, 0x18150a, 0x17130a, 0x161209, 0x141007, 0x120f06, 0x101107, 0x0e0f06, 0x0c0c07, 0x0b0c06, 0x0b0b06, 0x0a0a05, 0x090904, 0x0a0904, 0x080803, 0x080802, 0x070801, 0x060701, 0x050701, 0x050601, 0x040500, 0x030400, 0x030500, 0x030400, 0x020202, 0x020201, 0x020201, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000100, 0x010200, 0x010100, 0x010100, 0x020100, 0x020200, 0x030300, 0x030301, 0x030301, 0x030400, 0x040600, 0x050701, 0x040601, 0x050701, 0x060802, 0x070802, 0x080803, 0x0a0905, 0x0a0a05, 0x0b0a06, 0x0c0c07, 0x0d0d08, 0x070601, 0x2e2e2e, 0x3a3a3f, 0x26272c, 0x383b3d, 0x3c3b38, 0x151006, 0x14140e, 0x1e1f1a, 0x2b2d28, 0x414139, 0x4f4e41, 0x464336, 0x4b453a, 0x544b3f, 0x514639, 0x44392f, 0x343028, 0x575348, 0x5a5246, 0x594e40, 0x584a3c, 0x524234, 0x483a2e, 0x524638, 0x494032, 0x302c21, 0x4d504e, 0x555d5d, 0x3f4549, 0x3c3e41, 0x474646, 0x434241, 0x3e3c3a, 0x48413b, 0x473224, 0x764821, 0x965c23, 0xbe7f35, 0xc27f2e, 0xcf9242, 0xa86f33, 0x823c03, 0x803f0d, 0x7f400e, 0x844512, 0x91531d, 0x8e4e19, 0x7d3c0a, 0x7b3c0c, 0x7c3f10, 0x7e4216, 0x804419, 0x793b10, 0x824212, 0x8a4914, 0x894611, 0x87440f, 0x874510, 0x894813, 0x8c4a14, 0x914c14, 0x914c14, 0x945015, 0x9a561a, 0x9c581b, 0x9b5b1b, 0xa0611f, 0xa46822, 0xa66b23, 0xa97027, 0xae762b, 0xad752a, 0xb57e32, 0xb78233, 0xb47f2f, 0xcfa049, 0xce9e46, 0xab7323, 0x9e6821, 0x915a19, 0x885114, 0x844d16, 0x7a4610, 0x72400c, 0x6d3d0d, 0x69390b, 0x67380a, 0x67390b, 0x6d4011, 0x794e1b, 0x835a24, 0x896128, 0x90692c, 0x967032, 0x916a2d, 0x8a6022, 0x8d6122, 0xa67d41, 0xc09c5e, 0xcdab72, 0xd7b783, 0xdfc79a, 0xeedeb9, 0xe9d9b6, 0xe2cfac, 0xb69f7c, 0x815100, 0x915f22, 0x905c20, 0x85511b, 0x713d0e, 0x88501c, 0x9b5d1e, 0x9b5c19, 0xa0611c, 0x9f5e17, 0xa16118, 0xa56817, 0xe8c97a, 0xf3da86, 0xc4983c, 0xbc8a2c, 0xc48d37, 0xb87d31, 0xa56928, 0x9b6732, 0x7f5932, 0x573d21, 0x47341a, 0x45341c, 0x41331f, 0x3c301f, 0x392f1c, 0x372e1a, 0x372c18, 0x362b18, 0x372c1a, 0x382d1c, 0x3a2f1d, 0x382c1b, 0x362a1a, 0x322a18, 0x312a17, 0x312a16, 0x312914, 0x312915, 0x322712, 0x544827, 0xa99f79, 0x4a3e20, 0x2b230d, 0x2b2614, 0x2e2510, 0x503e10, 0x98853f, 0xae9a4d, 0x816a27, 0x422e07, 0x291e0c, 0x1e190d, 0x1b170c, 0x18160a, 0x161409, 0x141308, 0x141008, 0x130f07, 0x111106, 0x0e1006, 0x0b0c07, 0x0b0c07, 0x0a0b05, 0x0a0b05, 0x0a0a04, 0x090904, 0x090904, 0x080703, 0x060801, 0x060802, 0x060802, 0x050601, 0x040600, 0x030400, 0x040501, 0x030301, 0x020102, 0x020202, 0x020200, 0x020200, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x010200, 0x010101, 0x010101, 0x010100, 0x020200, 0x020201, 0x030301, 0x030301, 0x030400, 0x030500, 0x040601, 0x050701, 0x060701, 0x060602, 0x060802, 0x070802, 0x090803, 0x0b0a04, 0x0a0a05, 0x0b0b06, 0x0c0d08, 0x050600, 0x313435, 0x383b41, 0x28282d, 0x383838, 0x312f29, 0x110d05, 0x15150f, 0x242620, 0x33342e, 0x3b3c34, 0x414034, 0x403c30, 0x4a4439, 0x50473c, 0x4b4035, 0x332c25, 0x555147, 0x5c5549, 0x594f41, 0x594e3d, 0x5a4a3b, 0x524233, 0x534538, 0x493e31, 0x3c352a, 0x454642, 0x5b6060, 0x3e4548, 0x43464a, 0x414142, 0x444140, 0x4e4945, 0x4a423b, 0x473427, 0x72461f, 0x975c22, 0xb87b31, 0xd19239, 0xda9d45, 0xb87e3b, 0x853e02, 0x844210, 0x7b3d0e, 0x7d3f0f, 0x854612, 0x8b4a15, 0x8f4e18, 0x95541b, 0x995a1f, 0x9f5f24, 0x9b5b23, 0x995a23, 0x90511b, 0x8e4d18, 0x8c4c18, 0x894914, 0x864510, 0x904f16, 0x925116, 0x935216, 0x9f5c1c, 0xa05d1b, 0x9c5819, 0x9a5517, 0x9a5617, 0x9b5717, 0x9e5d19, 0xa86b22, 0xad7228, 0xb2772d, 0xb37a2f, 0xb0782c, 0xb57e31, 0xba8434, 0xbc8736, 0xbf8c37, 0xcd9d44, 0xc08f3c, 0xa36b1f, 0x985f1b, 0x8e5515, 0x8b5418, 0x844e15, 0x7d4911, 0x794612, 0x744412, 0x724412, 0x744615, 0x794d1b, 0x815822, 0x8b622a, 0x91692d, 0x987132, 0x977132, 0x8d6528, 0x8e6325, 0x8d6120, 0x8d5d17, 0x976821, 0xad8343, 0xc9a666, 0xd2b47b, 0xe6d2a6, 0xefe0be, 0xe6d6b4, 0x8f6838, 0x956323, 0x936024, 0x86531b, 0x774312, 0x8d551f, 0x9d5f20, 0x9a5a16, 0xa66621, 0xa4641e, 0xa1621b, 0xa6691e, 0xb07826, 0xeacb77, 0xf6de87, 0xcaa043, 0xcb973e, 0xc38c3c, 0xaa712e, 0x9d6d35, 0x7d5a32, 0x564022, 0x4d3c20, 0x4a381e, 0x48371e, 0x44351e, 0x3f321e, 0x3e311a, 0x3e311a, 0x3c3019, 0x3c301a, 0x3c311c, 0x3d311c, 0x3c301b, 0x382c19, 0x372d1a, 0x362d1a, 0x352c19, 0x332c18, 0x332b17, 0x332b18, 0x372f1c, 0x40351b, 0x54492b, 0x3f3419, 0x312915, 0x2d2816, 0x2f2816, 0x352910, 0x402e05, 0x453100, 0x382706, 0x32250e, 0x231d0e, 0x1c190d, 0x1b180b, 0x19160a, 0x17150a, 0x151309, 0x141209, 0x141108, 0x121107, 0x0f0f07, 0x0c0d06, 0x0c0c07, 0x0b0c06, 0x0b0b05, 0x0a0a05, 0x0a0a04, 0x090904, 0x080904, 0x060803, 0x060803, 0x060702, 0x050601, 0x040500, 0x030400, 0x030501, 0x030201, 0x030201, 0x020302, 0x020401, 0x020200, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010001, 0x010101, 0x010200, 0x010100, 0x010100, 0x010101, 0x030201, 0x030301, 0x020300, 0x030400, 0x030500, 0x030500, 0x040600, 0x040600, 0x050701, 0x060702, 0x060802, 0x060902, 0x080803, 0x0a0904, 0x0b0a05, 0x0a0b05, 0x0b0d07, 0x040400, 0x383b3d, 0x3f444b, 0x383a40, 0x373736, 0x27231e, 0x0d0803, 0x151511, 0x242521, 0x2e2f29, 0x3a3a31, 0x3d3b2f, 0x464236, 0x4c4438, 0x4b4237, 0x2c251c, 0x4f4c44, 0x666155, 0x50473b, 0x4f4337, 0x534537, 0x554738, 0x524637, 0x504537, 0x4b4338, 0x38362f, 0x4e5251, 0x444a4d, 0x393f42, 0x3e4141, 0x444343, 0x3d3c3a, 0x4b4440, 0x54453a, 0x6c451c, 0xa97130, 0xb77727, 0xc7822a, 0xce8d33, 0xbb7f39, 0x813a03, 0x8d4712, 0x834212, 0x814314, 0x7d3d0d, 0x854310, 0x8a4812, 0x914f16, 0x9b581a, 0x955518, 0x925116, 0x8e4e15, 0x8c4d17, 0x894a15, 0x864512, 0x7e3e0c, 0x82400e, 0x884610, 0x925016, 0x985717, 0x9e5c18, 0xa35f19, 0xa7641c, 0xa25e19, 0x9f5b18, 0xa25f1a, 0x9e5b17, 0xa1601a, 0xa86921, 0xaa6e25, 0xad7229, 0xb0782d, 0xb37c2f, 0xb68032, 0xb98435, 0xbc8838, 0xb68130, 0xc79742, 0xc59440, 0xac7426, 0xa26921, 0x975e1b, 0x945f1e, 0x895518, 0x824e14, 0x7b4a13, 0x744513, 0x6e4112, 0x6d4213, 0x704716, 0x7a531f, 0x855d26, 0x8e672b, 0x977031, 0x966e2f, 0x8e6628, 0x916727, 0x926724, 0x936520, 0x986820, 0x976516, 0x9a6822, 0xbc9455, 0xd4b77c, 0xecd9ab, 0xd1bc93, 0x91601a, 0x956324, 0x8a551c, 0x7e4a16, 0x90581f, 0x995d1d, 0x9a5b17, 0xa76821, 0xac6e26, 0xa66820, 0xa96e22, 0xb47a2a, 0xba822f, 0xbe8d34, 0xc5983d, 0xca993e, 0xbf8b3a, 0xac7835, 0xa2743d, 0x7e5b32, 0x5a4425, 0x534124, 0x4f3e24, 0x4b3920, 0x49371e, 0x45351c, 0x44351d, 0x43341c, 0x42341b, 0x40341d, 0x40341f, 0x3f331d, 0x3d311a, 0x3b2f19, 0x392e1a, 0x382f1c, 0x392e1c, 0x382e1b, 0x362e1b, 0x382e1c, 0x372f1d, 0x37301d, 0x37311d, 0x352d19, 0x342d19, 0x302a17, 0x2b2715, 0x292513, 0x2a2311, 0x29210e, 0x27200c, 0x29220f, 0x261f12, 0x211c11, 0x1c180d, 0x1c180c, 0x19160a, 0x17140b, 0x16130a, 0x151208, 0x141107, 0x13100a, 0x0e0f08, 0x0c0e07, 0x0c0d07, 0x0c0c06, 0x0c0c06, 0x0a0a05, 0x090a04, 0x080803, 0x080804, 0x060803, 0x070803, 0x060702, 0x050601, 0x040600, 0x030400, 0x020400, 0x030400, 0x030400, 0x030500, 0x030300, 0x020200, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x010100, 0x010100, 0x010100, 0x010100, 0x020201, 0x030301, 0x030401, 0x040500, 0x030500, 0x040500, 0x040600, 0x040601, 0x050701, 0x060702, 0x060803, 0x060902, 0x070802, 0x090903, 0x090902, 0x090a04, 0x0a0c06, 0x030400, 0x3e4143, 0x3d4248, 0x43464b, 0x41403d, 0x29251f, 0x0c0702, 0x181714, 0x21221f, 0x32332e, 0x393931, 0x4a473c, 0x4d473b, 0x4f463b, 0x393128, 0x383730, 0x666257, 0x595246, 0x4d4136, 0x4a3c31, 0x514235, 0x504235, 0x4d4436, 0x484035, 0x3a362e, 0x434748, 0x3b4347, 0x3d4448, 0x3b3f41, 0x464745, 0x464747, 0x3a393a, 0x473f3a, 0x5b422c, 0xab7c41, 0xbe7f2d, 0xc37f22, 0xd19032, 0xc4883c, 0x8e4b14, 0x8d4710, 0x8c4812, 0x894610, 0x82420c, 0x86440e, 0x8b480f, 0x924d12, 0x9b5617, 0x9e5817, 0x9f5c1b, 0xa15f1d, 0x995617, 0x945218, 0x8f4e15, 0x894911, 0x864711, 0x88460f, 0x904d14, 0x975315, 0x9e5a16, 0xa45f19, 0xac661b, 0xac671b, 0xa6621a, 0xa25d18, 0xa4611b, 0xa4621b, 0xa3631d, 0xa6661f, 0xa96d24, 0xad7429, 0xb0792d, 0xb37c2e, 0xb78032, 0xbc8636, 0xc28f3d, 0xc08e3a, 0xbe8c38, 0xb78331, 0xaf7a2d, 0x9e6921, 0x8e5919, 0x845015, 0x78460e, 0x703e09, 0x6b3b0a, 0x693b0b, 0x6c3f0f, 0x734717, 0x7e531f, 0x90652c, 0x976b2f, 0x9a6f30, 0xa17734, 0x9d7431, 0x956b29, 0x966b29, 0x966a26, 0x946722, 0x996923, 0x97661f, 0x956119, 0x935d0e, 0xa87e42, 0xb08c53, 0x9a6f32, 0x996724, 0x8c591c, 0x875219, 0x945b1f, 0x9c6020, 0x9f611d, 0xa2621c, 0xad7028, 0xaa6f25, 0xab7024, 0xb47a29, 0xb67d29, 0xb57c27, 0xbf8933, 0xca963e, 0xb98636, 0xaa7a37, 0xa07742, 0x7d5f38, 0x5f4826, 0x5a4727, 0x554326, 0x503e24, 0x4d3920, 0x4a371e, 0x46361e, 0x47371f, 0x493921, 0x48391f, 0x453820, 0x423721, 0x40351f, 0x3f341e, 0x3e321d, 0x3c311d, 0x3c311f, 0x3c311f, 0x3b301e, 0x3a301e, 0x3b311f, 0x3b321d, 0x393019, 0x3a311a, 0x37301b, 0x322b18, 0x2f2815, 0x2b2614, 0x292414, 0x282313, 0x242111, 0x221f11, 0x211c10, 0x221d12, 0x211d12, 0x1f1b10, 0x1c180c, 0x19160b, 0x18150b, 0x17140b, 0x151209, 0x141108, 0x13100a, 0x0e0f08, 0x0d0e06, 0x0c0d07, 0x0b0c06, 0x0e0d05, 0x0c0b05, 0x080904, 0x070803, 0x080804, 0x070903, 0x070803, 0x060702, 0x040500, 0x030500, 0x030400, 0x020400, 0x020400, 0x020400, 0x030400, 0x020300, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x030301, 0x030301, 0x030400, 0x030500, 0x030500, 0x040500, 0x050601, 0x050702, 0x060802, 0x070703, 0x060904, 0x060903, 0x070802, 0x090902, 0x090901, 0x090b04, 0x0b0c06, 0x040600, 0x3a3e3e, 0x3c4247, 0x414346, 0x3f3d39, 0x27231b, 0x110d05, 0x141311, 0x252623, 0x393a35, 0x38362e, 0x4a453a, 0x4e473b, 0x463f34, 0x28241e, 0x605c52, 0x595447, 0x494035, 0x483d31, 0x504235, 0x4f4032, 0x54483b, 0x40382c, 0x363329, 0x4a4d4a, 0x404748, 0x3c4548, 0x444a4d, 0x3e4142, 0x414242, 0x414245, 0x3e3b3a, 0x473428, 0x885e2e, 0xb07935, 0xb97622, 0xcd8b2d, 0xd39948, 0x8a4c1a, 0x793000, 0x833e0b, 0x843f0c, 0x894612, 0x8e4d15, 0x945116, 0x9b5719, 0xa45f1d, 0xa45e19, 0xa35d18, 0xa5601c, 0xab6520, 0xa4601a, 0xa7611d, 0xa4601b, 0xa15e1b, 0x985517, 0x965314, 0x995515, 0x9a5414, 0x9a5310, 0x9c5511, 0xa86219, 0xa86418, 0xaa681e, 0xab681d, 0xaf7024, 0xad6e26, 0xaa6e24, 0xae7328, 0xb37a2d, 0xb98234, 0xba8535, 0xb98535, 0xb78232, 0xb88433, 0xb98936, 0xb78633, 0xb38231, 0xab792c, 0xa16e24, 0x97631d, 0x925e1d, 0x8d5b1d, 0x8b591d, 0x8b5920, 0x84521b, 0x7e4d16, 0x7f4d14, 0x825116, 0x8d5c20, 0x976727, 0x9e6f2d, 0xa47632, 0xa77b35, 0x9f742e, 0x996d2a, 0x9a6e2b, 0x996e29, 0x976b25, 0x976923, 0x996924, 0x91601d, 0x905f1d, 0x8c5710, 0x915c12, 0x966320, 0x925c1e, 0x8e591d, 0x986022, 0x9a5f1d, 0x9e611c, 0xa1651f, 0xab6f27, 0xae7528, 0xb17729, 0xb57b2b, 0xb77e29, 0xb37a21, 0xc38e37, 0xce9b44, 0xb48134, 0xaa7b3b, 0xa07742, 0x7b5c35, 0x604a29, 0x604b2a, 0x5b4727, 0x554223, 0x513e22, 0x503c23, 0x4b3a21, 0x4b3a21, 0x4c3c24, 0x4d3d25, 0x4b3c22, 0x493b23, 0x473a23, 0x433821, 0x423721, 0x403521, 0x403522, 0x3f3422, 0x3d3321, 0x3d3220, 0x3d3320, 0x40331e, 0x47381b, 0x60542a, 0x5a4e26, 0x3e3218, 0x332a18, 0x2e2616, 0x2d2615, 0x2b2415, 0x282113, 0x242112, 0x221f12, 0x211d11, 0x201d11, 0x201d11, 0x1f1c10, 0x1c190c, 0x1a180c, 0x18160c, 0x17140a, 0x151309, 0x141208, 0x131008, 0x0f0f08, 0x0d0e06, 0x0c0d07, 0x0b0c05, 0x0d0b04, 0x0a0904, 0x080803, 0x060703, 0x060803, 0x070903, 0x060902, 0x050701, 0x050501, 0x040500, 0x030300, 0x020400, 0x020300, 0x030301, 0x030401, 0x030400, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010100, 0x010200, 0x020200, 0x020200, 0x020200, 0x030201, 0x030300, 0x030500, 0x030500, 0x030500, 0x040601, 0x050602, 0x060702, 0x060803, 0x070804, 0x070904, 0x070903, 0x080803, 0x090803, 0x090901, 0x090b04, 0x0a0c06, 0x030500, 0x3c3f40, 0x3c4045, 0x343638, 0x423f39, 0x2a241c, 0x141008, 0x161714, 0x2c2e29, 0x383732, 0x3e3b33, 0x4c463b, 0x484135, 0x231c15, 0x555248, 0x5c574b, 0x4a4237, 0x4a3f34, 0x514437, 0x4c3e31, 0x4e4337, 0x4a4135, 0x39352a, 0x3a3c38, 0x424746, 0x3f474a, 0x474e51, 0x484c4f, 0x3d3f41, 0x414142, 0x42403e, 0x493d34, 0x7a542e, 0xab7537, 0xb9792c, 0xb9771e, 0xdba24d, 0x935d2c, 0x752b00, 0x85400d, 0x8c4713, 0x904a15, 0x924f18, 0x96531a, 0x9b571b, 0x9d5919, 0xa05917, 0x9f5614, 0x9c5411, 0xa35c18, 0xa9621c, 0xab661c, 0xaf6a1f, 0xb06d21, 0xae6c1f, 0xa46017, 0xa56119, 0xa9661c, 0xa7631a, 0xaa671d, 0xaf6e26, 0xb17129, 0xb1732a, 0xb1762a, 0xaa6f23, 0xa1681f, 0x9a6320, 0x99621f, 0x96611d, 0x99641d, 0xa47025, 0xb07c2e, 0xb68433, 0xbb8836, 0xc2903d, 0xc79743, 0xc89943, 0xc69742, 0xc1903e, 0xb58131, 0xad782b, 0xa46f25, 0x945f1c, 0x8d5817, 0x875113, 0x7f4a0e, 0x7d490f, 0x834e10, 0x8b5817, 0x9b6926, 0xa4732c, 0xa8782f, 0xae7f35, 0xae8035, 0xa57930, 0x9d712a, 0x9b702b, 0x9b712b, 0x9a6e28, 0x986a24, 0x976724, 0x905e1e, 0x8e5d1d, 0x915d1d, 0x986221, 0x935d1d, 0x955c1f, 0x9e6424, 0x9b601e, 0x9b5f1a, 0xa2671e, 0xab7128, 0xab7025, 0xb2792a, 0xb77f2d, 0xbb822f, 0xba8229, 0xcb973d, 0xce9b46, 0xb48338, 0xac7d3d, 0x9f7843, 0x775a31, 0x665028, 0x624d27, 0x5f4925, 0x5c4726, 0x574324, 0x534023, 0x514025, 0x4f3d24, 0x4f3d24, 0x533f24, 0x594123, 0x594323, 0x514023, 0x4d3c23, 0x493a22, 0x463a20, 0x423821, 0x423723, 0x403624, 0x3f3522, 0x3e3320, 0x3c311d, 0x40321b, 0x493500, 0xbbb382, 0xa7a072, 0x372500, 0x322918, 0x2d2619, 0x2c2518, 0x2b2416, 0x292213, 0x272212, 0x242012, 0x221d11, 0x201d10, 0x201c10, 0x1f1c0f, 0x1d1a0d, 0x1b180c, 0x18150b, 0x161409, 0x141108, 0x141007, 0x121008, 0x0e0f06, 0x0d0f04, 0x0b0d06, 0x0c0b06, 0x0c0a04, 0x090803, 0x080904, 0x070703, 0x060903, 0x060903, 0x060802, 0x040601, 0x030400, 0x030500, 0x020300, 0x030400, 0x020200, 0x020201, 0x030400, 0x030300, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000101, 0x010101, 0x010101, 0x010100, 0x010101, 0x020200, 0x020200, 0x020300, 0x020300, 0x030300, 0x020300, 0x020400, 0x030500, 0x030500, 0x040600, 0x040601, 0x050602, 0x060702, 0x070803, 0x070803, 0x070902, 0x080903, 0x080903, 0x090903, 0x090a04, 0x0a0c06, 0x050700, 0x3d3e40, 0x414248, 0x3e3e41, 0x4a4640, 0x342e26, 0x110c04, 0x1c1d19, 0x2d2e29, 0x38362f, 0x3f3b31, 0x443d32, 0x251f17, 0x413f37, 0x5c574c, 0x4c453a, 0x483f35, 0x4d4136, 0x4c3e32, 0x4a3e32, 0x4e4437, 0x3f392e, 0x3f3f3a, 0x484c4c, 0x353a3d, 0x3e4448, 0x464b4f, 0x484b4e, 0x3f3f42, 0x3f3e3d, 0x473d36, 0x5f4025, 0x956331, 0xb57730, 0xb26d1f, 0xd29848, 0xb27f41, 0x843b02, 0x85400d, 0x813d0d, 0x803d0f, 0x884412, 0x8b4814, 0x924e18, 0x955016, 0x97500f, 0xa05914, 0xa7611b, 0xa6601a, 0xa9641c, 0xaf6a21, 0xb37023, 0xb57424, 0xbc7c29, 0xbd7f2d, 0xb17325, 0xb17127, 0xb17229, 0xa76a22, 0x9b5f1b, 0x905518, 0x844b12, 0x814a11, 0x814b15, 0x814d17, 0x895419, 0x915b1c, 0x97601e, 0xa06a24, 0xb17b30, 0xbd8637, 0xc6923e, 0xcd9a43, 0xc9963f, 0xcb9842, 0xcb9a43, 0xc89740, 0xc3913c, 0xbc8935, 0xb68130, 0xb07a2c, 0xa56f25, 0x98611b, 0x905b18, 0x8c5616, 0x844e0f, 0x875213, 0x905b1a, 0x9b6723, 0xa67229, 0xb28034, 0xb38235, 0xb68537, 0xb58638, 0xa97d30, 0xa0742c, 0x9e742d, 0x9e742c, 0x9e7129, 0x9a6b25, 0x966522, 0x946222, 0x925e20, 0x945f20, 0x935d1e, 0x9b6525, 0xa26926, 0x9b611d, 0x9c611c, 0xa2671d, 0xac7224, 0xad7426, 0xae7525, 0xb47a2a, 0xb77e2b, 0xb8812b, 0xd29e44, 0xcf9d46, 0xb8853d, 0xab7e40, 0x9d7844, 0x7b5e33, 0x6a532a, 0x695329, 0x654e26, 0x614b25, 0x5e4925, 0x584525, 0x564126, 0x554125, 0x543f25, 0x594126, 0x644625, 0x77592c, 0x866b3c, 0x5d4722, 0x503d23, 0x4d3c23, 0x4a3b21, 0x463a21, 0x433922, 0x423724, 0x413623, 0x3f3521, 0x3b311d, 0x3c2f1b, 0x463613, 0x7d7248, 0x72683f, 0x3c2f13, 0x302817, 0x2d2617, 0x2c2516, 0x2b2315, 0x2a2312, 0x292213, 0x262113, 0x241e11, 0x231d10, 0x211c10, 0x211c10, 0x1e1a0e, 0x1b170c, 0x18150b, 0x17130a, 0x151208, 0x131007, 0x100f07, 0x0e0f06, 0x0d0e04, 0x0c0c06, 0x0c0b06, 0x0c0a04, 0x090803, 0x070803, 0x070903, 0x070903, 0x060902, 0x050701, 0x040501, 0x030500, 0x040600, 0x030400, 0x030300, 0x020200, 0x020200, 0x020300, 0x020200, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010001, 0x010101, 0x010101, 0x010101, 0x010100, 0x020101, 0x020200, 0x020201, 0x020300, 0x030300, 0x030400, 0x020400, 0x030400, 0x030400, 0x030400, 0x040501, 0x040601, 0x040601, 0x060801, 0x070802, 0x070802, 0x070903, 0x080a04, 0x080a04, 0x0a0904, 0x0a0a05, 0x0a0b06, 0x080903, 0x313333, 0x3e3f44, 0x404042, 0x4c4a42, 0x312c22, 0x120d04, 0x252521, 0x2f302a, 0x363429, 0x413a2f, 0x2f2a21, 0x2d2c26, 0x59574b, 0x494439, 0x453d33, 0x3f372c, 0x4d4236, 0x4c4134, 0x4d4438, 0x494236, 0x3c3a33, 0x4b4f4e, 0x34393d, 0x383b40, 0x3d4245, 0x43484b, 0x4a4b4d, 0x454544, 0x423c35, 0x553922, 0x865628, 0xa46724, 0xad6a1e, 0xc4883d, 0xbf8b4d, 0x874209, 0x985219, 0x914c15, 0x853f0d, 0x7b370b, 0x854414, 0x92501c, 0x96531f, 0x9b5820, 0xb27232, 0xc78942, 0xc6873c, 0xb8762d, 0xa76622, 0xa56621, 0xa1631e, 0x985b15, 0x985b14, 0x945a17, 0x965d1c, 0x955c1c, 0x965d1f, 0x976022, 0x9c6423, 0x9d6425, 0x965e20, 0xa46c29, 0xac732d, 0xa76e26, 0xaa6f26, 0xa96c23, 0xaa6e24, 0xaf7326, 0xb57929, 0xb67c2a, 0xc08833, 0xcc973d, 0xd3a044, 0xd5a245, 0xd6a548, 0xd4a347, 0xce9c42, 0xc9953f, 0xc08b36, 0xb88230, 0xae7829, 0xa66f25, 0x9a641d, 0x955f1a, 0x8f5816, 0x8f5916, 0x9b661e, 0xa47025, 0xac772c, 0xb88436, 0xbb8939, 0xbb8a39, 0xb78837, 0xae8032, 0xa5782e, 0xa0762d, 0xa1772e, 0xa0722b, 0x9b6c26, 0x966623, 0x976625, 0x946122, 0x935d1e, 0x9a6424, 0xa06823, 0xa26822, 0x9e641d, 0xa46b1f, 0xbc8d3b, 0xcda550, 0xbd8d38, 0xb47d2b, 0xb47b28, 0xb9832d, 0xcd9a41, 0xcb9944, 0xbb883f, 0xae8043, 0x997542, 0x7a5c30, 0x71582d, 0x6e582e, 0x6b562c, 0x685128, 0x634e25, 0x614b26, 0x5d4727, 0x594528, 0x574228, 0x564126, 0x5f4527, 0x6b4a26, 0x8c6f3e, 0xb39e68, 0x604a20, 0x4f3d22, 0x4e3f25, 0x4d3d24, 0x4a3c22, 0x443921, 0x433722, 0x413622, 0x3e3421, 0x3a321e, 0x3a311e, 0x3a2d19, 0x3a270c, 0x392b11, 0x362d19, 0x302917, 0x2f2818, 0x2d2716, 0x2c2516, 0x2a2214, 0x292212, 0x262112, 0x241f12, 0x241e12, 0x221c10, 0x211a0f, 0x1e180d, 0x1b150b, 0x17140b, 0x161209, 0x151208, 0x131107, 0x0f1007, 0x0e1005, 0x0d0e05, 0x0c0c06, 0x0b0a06, 0x0c0a05, 0x090803, 0x070802, 0x070903, 0x060702, 0x050701, 0x040701, 0x030500, 0x030500, 0x040600, 0x030500, 0x020400, 0x020200, 0x020201, 0x020201, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x030400, 0x030400, 0x030400, 0x030500, 0x040501, 0x040601, 0x050601, 0x050701, 0x060802, 0x070702, 0x070803, 0x070a03, 0x080a04, 0x080a04, 0x090904, 0x0a0905, 0x0a0a06, 0x080803, 0x2c2d2d, 0x34373a, 0x3c3d3f, 0x484740, 0x272219, 0x18140b, 0x25251f, 0x313028, 0x3b372b, 0x3d372c, 0x272520, 0x515049, 0x4e4a40, 0x474138, 0x413930, 0x41372e, 0x43382e, 0x42392e, 0x4c453a, 0x444138, 0x4c4f4d, 0x3a4043, 0x30353a, 0x313538, 0x3b3e40, 0x47494a, 0x4e4f4e, 0x4a4540, 0x543b28, 0x8d5c2b, 0xa66721, 0xbc7a2d, 0xb7792b, 0xc3914d, 0x75390c, 0x904e19, 0xa76529, 0xac682c, 0xaa6630, 0x9e5d2d, 0x94562a, 0x915229, 0x8e5229, 0x8b5025, 0x8e5729, 0x8e5828, 0x915720, 0x955a1d, 0x995f21, 0xa06526, 0xac722e, 0xba8136, 0xc28a39, 0xc8903d, 0xc88e39, 0xc58834, 0xc38633, 0xc28533, 0xbd812e, 0xb57728, 0xa76b1f, 0xab6d22, 0xae6f23, 0xad6d20, 0xaf6e21, 0xad6b20, 0xac6c1f, 0xb37424, 0xb67827, 0xbf8430, 0xc99239, 0xd29d40, 0xd9a749, 0xdfae4e, 0xe0b34f, 0xdeb14d, 0xd9a948, 0xd09c41, 0xc6923a, 0xbc8632, 0xb37d2c, 0xa66e22, 0x9c641b, 0x965e16, 0x945d17, 0x965e19, 0x9d651d, 0xa87327, 0xb48032, 0xbe8a39, 0xc3913d, 0xc2923e, 0xbb8d38, 0xb48534, 0xad7e31, 0xa2752a, 0xa2752d, 0x9f712a, 0x9c6d28, 0x9b6a27, 0x976524, 0x956022, 0x9a6423, 0x9f6724, 0xa26a24, 0xa36924, 0xa66c21, 0xaf7a24, 0xecd27d, 0xfff39c, 0xd9b65d, 0xb9842b, 0xc18a34, 0xcd9a43, 0xc89544, 0xbe8b43, 0xb08244, 0x98713f, 0x7f5f33, 0x785b31, 0x775c31, 0x735a30, 0x6e572e, 0x6a542a, 0x685229, 0x665029, 0x624e2b, 0x5b4627, 0x5b4627, 0x5b4527, 0x5c4527, 0x624626, 0x664a23, 0x685123, 0x5b4621, 0x544121, 0x524121, 0x4d3d1f, 0x4d3e22, 0x473a21, 0x443722, 0x413522, 0x3d3320, 0x39311d, 0x38301e, 0x362c1d, 0x372a1c, 0x352a1a, 0x322a18, 0x302817, 0x302716, 0x2f2515, 0x2d2414, 0x2a2313, 0x282212, 0x252112, 0x231f13, 0x221d12, 0x211a10, 0x1f180e, 0x1d160c, 0x1a1509, 0x17140a, 0x161208, 0x151108, 0x141006, 0x111106, 0x0e0f05, 0x0d0d05, 0x0c0c06, 0x0c0a06, 0x0b0a05, 0x0a0804, 0x070803, 0x070903, 0x070702, 0x060601, 0x040601, 0x030500, 0x030500, 0x040600, 0x030500, 0x020300, 0x010100, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020202, 0x020200, 0x030300, 0x030301, 0x030400, 0x030500, 0x050601, 0x050601, 0x060602, 0x050601, 0x060802, 0x060702, 0x070904, 0x070a03, 0x080a04, 0x090a04, 0x090a04, 0x0a0b05, 0x0a0b06, 0x050700, 0x2f3031, 0x383a3d, 0x3a393a, 0x43413c, 0x201912, 0x18130b, 0x26251e, 0x3d3930, 0x403b30, 0x232019, 0x494943, 0x53524b, 0x403d34, 0x454036, 0x3e362e, 0x40372e, 0x433c31, 0x443c32, 0x423e35, 0x494d49, 0x474e4f, 0x40474a, 0x35393d, 0x343639, 0x343535, 0x413f3d, 0x4e4842, 0x523f31, 0x855629, 0xab6b2a, 0xba7422, 0xb87723, 0xcf9a50, 0x936030, 0x844820, 0x8c5226, 0x8d5225, 0x864c24, 0x864b26, 0x7f4722, 0x844c25, 0x90582f, 0x9a6433, 0xa77136, 0xb47e3d, 0xbf8940, 0xc68d3d, 0xc48b3a, 0xb47a2d, 0xb97f30, 0xc28834, 0xc88f35, 0xc78f33, 0xc78d32, 0xc2852b, 0xbc7d26, 0xbb7d27, 0xba7a25, 0xb87825, 0xb37322, 0xb17222, 0xb67625, 0xb47323, 0xb47323, 0xb57425, 0xb37224, 0xb06e1f, 0xb57323, 0xb77725, 0xc58a34, 0xd19a3f, 0xd8a344, 0xdcac4a, 0xe9c460, 0xf5da77, 0xebcb66, 0xdcaf4b, 0xd4a243, 0xca983c, 0xc18c35, 0xbb8432, 0xad7526, 0xa66e22, 0x9f661d, 0x9b621a, 0x9d631b, 0xa56c22, 0xb27c2d, 0xbd8a38, 0xc4913d, 0xc6953f, 0xc5953f, 0xbf903a, 0xb88a35, 0xb08130, 0xa6792c, 0xa3752b, 0xa2722b, 0x9f6f29, 0x9c6b27, 0x976624, 0xa26d2b, 0xa16c27, 0xa26c25, 0xa36e27, 0xa46e26, 0xaa7123, 0xb68328, 0xe4c86f, 0xf8e68d, 0xd5b156, 0xc7943a, 0xd3a049, 0xc59141, 0xc08e48, 0xb38749, 0x96723e, 0x846636, 0x806334, 0x7c6132, 0x7b5e30, 0x785b2e, 0x755a2f, 0x70582c, 0x6d562c, 0x6a542d, 0x65502a, 0x644e29, 0x614b27, 0x5d4828, 0x5a4527, 0x584425, 0x584525, 0x584423, 0x5d4921, 0x66511a, 0x665216, 0x57461f, 0x4e3e22, 0x4a3a23, 0x473822, 0x423623, 0x3f3322, 0x3a311d, 0x382f1b, 0x372c1b, 0x362b1b, 0x342918, 0x332a18, 0x322917, 0x332816, 0x312414, 0x2e2212, 0x2a2411, 0x262211, 0x232012, 0x201d11, 0x211b10, 0x21190f, 0x1e170e, 0x1d150d, 0x1b140a, 0x18140a, 0x17130a, 0x151108, 0x131007, 0x101006, 0x0e1004, 0x0d0e04, 0x0c0b06, 0x0c0906, 0x0b0905, 0x0a0804, 0x070702, 0x060702, 0x070702, 0x060601, 0x040600, 0x030500, 0x030600, 0x040601, 0x030500, 0x020300, 0x010100, 0x020200, 0x030300, 0x010100, 0x000000, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x010101, 0x030302, 0x020200, 0x020200, 0x020200, 0x030400, 0x030400, 0x050501, 0x050601, 0x060602, 0x050701, 0x060802, 0x060702, 0x070803, 0x080a04, 0x070a04, 0x090a04, 0x090a04, 0x0a0a05, 0x0a0c06, 0x050700, 0x303131, 0x3b3c3f, 0x363637, 0x3f3c38, 0x211d16, 0x150e06, 0x302d24, 0x474036, 0x302a22, 0x3a3a36, 0x51524b, 0x4c4b43, 0x47443c, 0x3f3b33, 0x3b352d, 0x423b31, 0x464034, 0x413c33, 0x454542, 0x474e4f, 0x384246, 0x444d50, 0x373c3f, 0x3a3b3d, 0x32312e, 0x4a403a, 0x554235, 0x774c25, 0xab6d2e, 0xb36c20, 0xba7521, 0xce964f, 0x865c32, 0x5e290a, 0x6a3718, 0x6e3919, 0x773f1c, 0x834821, 0x935426, 0x9d5e29, 0xa8682e, 0xb47434, 0xbe7f38, 0xc08136, 0xbe8132, 0xba7e2c, 0xbc822f, 0xb47a2a, 0xb17629, 0xba7e2e, 0xc68e37, 0xd7a94a, 0xe0b452, 0xd5a23f, 0xd19b3a, 0xcc9435, 0xc78b30, 0xc4882f, 0xc1832c, 0xbd7e29, 0xbd7d29, 0xbc7c29, 0xb97927, 0xb97927, 0xba7929, 0xb57425, 0xb26f20, 0xb47221, 0xb67623, 0xc28731, 0xce983c, 0xd6a343, 0xe3b750, 0xf6df7c, 0xfffdaa, 0xf9e88c, 0xe3bb53, 0xdaac48, 0xd2a143, 0xc79339, 0xbc8631, 0xb37b29, 0xaa7122, 0xa56c20, 0xa76d21, 0xa97023, 0xb17829, 0xbc8634, 0xc6933f, 0xcb9b44, 0xca9b43, 0xca9b43, 0xc4943d, 0xbc8d37, 0xb68834, 0xb28635, 0xa5782b, 0xa4752b, 0xa06f28, 0x9b6a24, 0xa5722c, 0xa6732b, 0xa36f26, 0xa57027, 0xa46f26, 0xa77026, 0xab7425, 0xbd8a31, 0xc59737, 0xcca140, 0xcc9e42, 0xd0a14a, 0xc39244, 0xbc8c45, 0xb08548, 0x967240, 0x876739, 0x856939, 0x826735, 0x806433, 0x7f6131, 0x7d5e2f, 0x7c5e2f, 0x785d2f, 0x725a30, 0x6f592f, 0x6c552d, 0x685129, 0x634c28, 0x5c4726, 0x5a4526, 0x594627, 0x584527, 0x584424, 0x67521c, 0xb6a970, 0xc7bb81, 0x715e24, 0x503f21, 0x4a3a23, 0x473823, 0x423521, 0x3f3320, 0x3c311e, 0x392f1b, 0x382c1a, 0x362b19, 0x352917, 0x342816, 0x342917, 0x352816, 0x382717, 0x312513, 0x2a2411, 0x24210f, 0x211f11, 0x1f1c10, 0x1f1b0f, 0x1f190d, 0x1e180d, 0x1c160c, 0x19140a, 0x19160b, 0x18150c, 0x151108, 0x131007, 0x101006, 0x0d0f06, 0x0c0c05, 0x0b0b06, 0x0a0905, 0x0a0804, 0x080703, 0x070702, 0x060702, 0x070702, 0x050601, 0x030601, 0x030500, 0x030500, 0x040600, 0x030500, 0x020300, 0x010100, 0x020201, 0x030301, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000001, 0x000101, 0x010100, 0x030200, 0x030300, 0x030300, 0x030300, 0x030400, 0x030400, 0x040400, 0x050602, 0x050601, 0x050601, 0x070803, 0x060702, 0x090802, 0x0a0902, 0x090a04, 0x090a05, 0x090a04, 0x0a0a05, 0x0a0b06, 0x030400, 0x333434, 0x3b3d41, 0x353335, 0x413d39, 0x27221c, 0x161008, 0x363129, 0x332e25, 0x2f2e2b, 0x474743, 0x484942, 0x4c4b45, 0x48453f, 0x3f3a34, 0x3b342c, 0x3f372e, 0x3c362d, 0x383633, 0x4c5052, 0x374247, 0x3a4449, 0x3d454a, 0x373c3e, 0x363535, 0x403a36, 0x4c3c31, 0x5f391d, 0x9c6127, 0xb26d27, 0xb0671a, 0xd19548, 0xa7723b, 0x783f19, 0x7c461d, 0x81481e, 0x83461c, 0x85481b, 0x92511f, 0x96521c, 0xa15b1f, 0xac6725, 0xb06c26, 0xac6923, 0xa45f1a, 0xad6c23, 0xc38639, 0xc4893a, 0xac7024, 0xb07528, 0xbc812f, 0xd2a145, 0xf7e081, 0xfcec8d, 0xe6c15b, 0xd8a33c, 0xd6a03c, 0xcf9635, 0xc5882d, 0xc3832c, 0xc3832c, 0xbd7d27, 0xbc7b29, 0xbb7a28, 0xb47224, 0xb87526, 0xba7626, 0xb87524, 0xb67323, 0xb97724, 0xc68a32, 0xd19a3f, 0xd8a545, 0xe1b54d, 0xf2d673, 0xfdf39d, 0xf4de7f, 0xe5be54, 0xdfb44f, 0xd6a948, 0xcd9b3f, 0xc08a31, 0xb8802b, 0xad7323, 0xa4691b, 0xa56b1d, 0xa86e1f, 0xb57d2b, 0xc28f3b, 0xcd9e45, 0xd1a449, 0xd1a449, 0xcea248, 0xc79840, 0xc0913b, 0xbd903a, 0xbb8f3c, 0xa67829, 0xa17126, 0xa17125, 0xa67528, 0xaa762a, 0xaa762a, 0xa97429, 0xaa7429, 0xaa7329, 0xa77125, 0xb27c2b, 0xbc8a30, 0xc39235, 0xcea044, 0xd1a34c, 0xc19244, 0xbc8e48, 0xae854a, 0x967340, 0x89693a, 0x896a3a, 0x886c37, 0x866a35, 0x846734, 0x866735, 0x856633, 0x836432, 0x7e6132, 0x775e30, 0x71592e, 0x6e572e, 0x6a532b, 0x644e29, 0x5d4926, 0x5b4627, 0x5a4528, 0x594427, 0x5a4524, 0x695217, 0xc7ba80, 0xd5ca8e, 0x73601e, 0x4f3f1f, 0x493a22, 0x473822, 0x423622, 0x3f3421, 0x3c311e, 0x392f1c, 0x382b1c, 0x362a1a, 0x352917, 0x342815, 0x342817, 0x352717, 0x362516, 0x302311, 0x2b220f, 0x24200f, 0x1f1d10, 0x1e1c10, 0x1e1b0f, 0x1c190d, 0x1c180c, 0x1a180c, 0x19160c, 0x18150c, 0x17140c, 0x141208, 0x111007, 0x100f08, 0x0e0d08, 0x0c0c07, 0x0b0a05, 0x090904, 0x0a0704, 0x080702, 0x070802, 0x060902, 0x050602, 0x050601, 0x030500, 0x030400, 0x030500, 0x040500, 0x030400, 0x030300, 0x020100, 0x020100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010200, 0x020200, 0x020300, 0x030400, 0x030300, 0x030400, 0x040501, 0x050602, 0x060701, 0x050602, 0x060702, 0x070702, 0x090803, 0x0a0a02, 0x0a0a03, 0x0a0b05, 0x0a0b05, 0x0b0b05, 0x0d0c05, 0x070500, 0x2c2c2b, 0x404044, 0x323133, 0x3a3631, 0x29231d, 0x16110b, 0x221c18, 0x221f1b, 0x474642, 0x42423e, 0x43433f, 0x4b4a47, 0x413f3b, 0x3d3934, 0x3b352e, 0x3a332d, 0x34332e, 0x3f4344, 0x3b4449, 0x39444b, 0x373f44, 0x404447, 0x3b3c3e, 0x3c3836, 0x4d4039, 0x533420, 0x8f5927, 0xaf6a2a, 0xa65c16, 0xbf7d38, 0xad7238, 0x813c04, 0x834110, 0x7c3c0d, 0x7f3d0f, 0x7f3c0e, 0x824010, 0x96501d, 0x975016, 0xa35c1c, 0xaf6925, 0xb36c27, 0xb16c26, 0xb06b26, 0xb16f27, 0xbd7f30, 0xc48735, 0xbe8030, 0xbf8231, 0xca8f39, 0xdcac4b, 0xfae683, 0xfff591, 0xedca60, 0xd7a136, 0xdfac41, 0xe1ae43, 0xcf9333, 0xc9882f, 0xc5842c, 0xc1812a, 0xbf7e29, 0xc17f2a, 0xc2802a, 0xc4832d, 0xc4822c, 0xc07e29, 0xbc7a26, 0xbc7b26, 0xc78b33, 0xd29e40, 0xdaa845, 0xdcac47, 0xe1b850, 0xe9c65d, 0xe7c158, 0xe3b951, 0xdfb44e, 0xd9ab49, 0xcf9d3f, 0xc38c33, 0xb9812b, 0xaf7524, 0xae7424, 0xad7323, 0xb57d2c, 0xbd8a37, 0xc99a45, 0xd1a54d, 0xd3a84f, 0xd0a64d, 0xcba048, 0xc4973f, 0xbd9038, 0xb48731, 0xac7e2a, 0xaa7b2b, 0xa67526, 0xbb8e3d, 0xc79b46, 0xad7928, 0xb0792d, 0xb07a2c, 0xaf7a2c, 0xa97528, 0xab7727, 0xb3802b, 0xc08f36, 0xd1a447, 0xcfa34b, 0xc49749, 0xc0954e, 0xb0894c, 0x95733f, 0x8b6b39, 0x8a6b3a, 0x8a6c37, 0x8d7038, 0x8d7037, 0x8d6f36, 0x907037, 0x927139, 0x8c6b36, 0x836432, 0x7b602f, 0x745a2d, 0x70582f, 0x6c552d, 0x664f29, 0x5f4b26, 0x5c4726, 0x594427, 0x584327, 0x594527, 0x634d25, 0x786026, 0x7c6323, 0x634f1f, 0x4e3e20, 0x483a20, 0x473821, 0x433821, 0x3f361e, 0x3c331c, 0x3b301d, 0x392c1c, 0x372b19, 0x342816, 0x322816, 0x322515, 0x332416, 0x352513, 0x3c2c12, 0x3a2b13, 0x271e0e, 0x1f1c10, 0x1d1c10, 0x1d1c0f, 0x1b1b0e, 0x1b190d, 0x1a180c, 0x19160c, 0x17140b, 0x17130b, 0x121107, 0x0f0f05, 0x0d0d07, 0x0c0b06, 0x0b0b06, 0x0a0a05, 0x0a0804, 0x0a0703, 0x070702, 0x060902, 0x050802, 0x040702, 0x050601, 0x030500, 0x030400, 0x030500, 0x030500, 0x030400, 0x020300, 0x010100, 0x020100, 0x020101, 0x010000, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x020200, 0x020200, 0x030300, 0x030400, 0x020400, 0x020400, 0x040401, 0x050601, 0x060702, 0x050602, 0x070803, 0x070702, 0x080904, 0x0a0a02, 0x0a0b02, 0x0a0b03, 0x0b0b04, 0x0d0c04, 0x120d03, 0x100900, 0x272724, 0x3f3e42, 0x373437, 0x3c3633, 0x2b251f, 0x130f07, 0x0e0c06, 0x353532, 0x41413e, 0x3e3f3a, 0x434340, 0x41403e, 0x3b3938, 0x3b3734, 0x3a3632, 0x33312e, 0x444748, 0x333b3e, 0x374248, 0x3a4249, 0x373a3e, 0x3a383a, 0x3a3736, 0x4c433c, 0x51392b, 0x804d1f, 0xac6828, 0xa75d1c, 0xb46e2c, 0xb17135, 0x873f05, 0x904a10, 0x954d14, 0x985017, 0x9f591e, 0x9c571c, 0x954d15, 0xa35a20, 0xa95f22, 0xb36a27, 0xb56e29, 0xb8712a, 0xbb732b, 0xb46f26, 0xb57327, 0xbf8131, 0xc0822f, 0xbc7e2e, 0xc18330, 0xc88b34, 0xd19b3a, 0xe5ba4f, 0xf1cc5d, 0xe3b446, 0xdda83b, 0xe5b544, 0xe1ae41, 0xd79d3a, 0xd29536, 0xd39537, 0xd19437, 0xd19238, 0xcb8a32, 0xc9882f, 0xc78a31, 0xc7872f, 0xc7872d, 0xc2822a, 0xc3832a, 0xc88c31, 0xd19b3d, 0xdaa845, 0xe0b04b, 0xe4b950, 0xe4ba50, 0xe8c057, 0xe6bf57, 0xe4ba55, 0xe0b552, 0xd6a849, 0xca973d, 0xc38f39, 0xb37e2c, 0xa97324, 0xa87426, 0xaf7c2d, 0xba8a39, 0xc89d48, 0xd0a851, 0xd2ab53, 0xd2aa51, 0xcfa74c, 0xcba045, 0xc4973c, 0xbd9138, 0xb78931, 0xb07e2a, 0xad7926, 0xc2933e, 0xc99b43, 0xb4812d, 0xb37e2b, 0xb17e2c, 0xb07b2c, 0xac7828, 0xb17d29, 0xbc8a32, 0xd0a148, 0xc99c45, 0xc79a4a, 0xc39951, 0xb18b4d, 0x997741, 0x93733f, 0x91713d, 0x90723b, 0x917339, 0x937439, 0x95763a, 0x96763a, 0x98783a, 0x99783b, 0x94723b, 0x876833, 0x7d602f, 0x765a2d, 0x71572e, 0x6d542d, 0x674f29, 0x634d28, 0x5d4826, 0x594325, 0x594226, 0x574226, 0x564224, 0x584322, 0x584321, 0x534123, 0x4c3d23, 0x493a21, 0x483920, 0x463820, 0x42361c, 0x3e341b, 0x3c311b, 0x3a2d1c, 0x372b1a, 0x322a17, 0x302816, 0x302616, 0x302515, 0x352612, 0x47361a, 0x47391b, 0x281e0e, 0x1f1b0f, 0x1d1b0f, 0x1c1b0e, 0x1c1b0e, 0x1c1a0d, 0x1b180c, 0x19160b, 0x18140b, 0x16130a, 0x121107, 0x0f0f05, 0x0d0d07, 0x0c0b07, 0x0b0a06, 0x0a0a05, 0x0a0804, 0x0a0803, 0x070803, 0x060802, 0x040601, 0x040601, 0x050601, 0x040500, 0x040500, 0x030500, 0x030400, 0x030400, 0x020300, 0x010100, 0x020100, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010000, 0x010100, 0x020100, 0x020200, 0x020200, 0x030300, 0x020400, 0x020300, 0x020301, 0x040500, 0x050601, 0x060702, 0x060802, 0x060803, 0x070802, 0x090a03, 0x0a0b01, 0x0a0b02, 0x0a0b04, 0x0c0b05, 0x0e0a04, 0x170f03, 0x150c00, 0x2c2a24, 0x3a3a3a, 0x3b3a3c, 0x403d3b, 0x322e27, 0x130d06, 0x1e1e1a, 0x353634, 0x383836, 0x414141, 0x434343, 0x343333, 0x393737, 0x373534, 0x302f2d, 0x404344, 0x43484c, 0x373e44, 0x424951, 0x3e4249, 0x343436, 0x292522, 0x3a312c, 0x534239, 0x6c401c, 0xa9692d, 0xab621f, 0xa55c1d, 0xb06f34, 0x823d08, 0x904e18, 0xb2702d, 0xa9641c, 0xb27026, 0xc2843a, 0xbc7c39, 0xa45d22, 0xa0571e, 0xa2591f, 0xb66f2d, 0xb87029, 0xb77027, 0xbd762b, 0xbc792c, 0xbc7b2e, 0xc38634, 0xcb8f3a, 0xcd903c, 0xd4963e, 0xce8f37, 0xce9236, 0xd69d39, 0xdaa13a, 0xd49b34, 0xdca53c, 0xe0ac3f, 0xdda73d, 0xd69c37, 0xd49836, 0xd39635, 0xd29436, 0xcd8e34, 0xcc8c34, 0xd19237, 0xd19439, 0xd6993e, 0xcf9135, 0xc6892f, 0xc88c32, 0xcc9238, 0xcf993b, 0xdaaa47, 0xdfb34f, 0xe4ba55, 0xe3ba54, 0xe3bd57, 0xe4bf5b, 0xe2be5c, 0xdfb858, 0xd1a74b, 0xc3953e, 0xb68634, 0xab7a2b, 0xa67326, 0xad7a2d, 0xb88737, 0xc59843, 0xd4aa50, 0xddb559, 0xdeb75a, 0xdbb355, 0xd6ae4e, 0xd1a747, 0xca9e40, 0xc09237, 0xb98a31, 0xb5832d, 0xb5822f, 0xb98631, 0xbd8a35, 0xbb8934, 0xcea047, 0xba8b36, 0xb27f2f, 0xb4802e, 0xbc8833, 0xcc9c44, 0xc99c48, 0xc49a4a, 0xc59b52, 0xb48d4e, 0x9f7e47, 0x9b7b45, 0x997a42, 0x977940, 0x97793d, 0x99793c, 0x9c7c3c, 0x9c7d3c, 0x9c7d3b, 0x9e7d38, 0x9c7d3a, 0x937339, 0x866833, 0x7c612f, 0x755a2f, 0x6e532c, 0x6c512b, 0x6a512c, 0x67502b, 0x614a29, 0x5b4526, 0x584124, 0x564125, 0x534126, 0x514025, 0x504025, 0x4c3e23, 0x4b3d24, 0x4b3d23, 0x4b3b22, 0x4a3b22, 0x46391f, 0x43361c, 0x3f321a, 0x3b2e1b, 0x372d1b, 0x322a18, 0x302816, 0x2e2617, 0x2e2516, 0x2e2313, 0x312410, 0x322711, 0x251e0e, 0x1f1c0f, 0x1d1a0f, 0x1c1b0f, 0x1c1a0f, 0x1b1a0d, 0x1a180c, 0x19150c, 0x17140b, 0x16120a, 0x111108, 0x0f0f06, 0x0c0d06, 0x0b0b07, 0x0a0904, 0x080804, 0x070702, 0x090803, 0x070702, 0x060802, 0x040701, 0x040601, 0x050601, 0x040500, 0x040500, 0x030500, 0x030500, 0x030400, 0x030300, 0x010100, 0x020100, 0x020200, 0x010100, 0x000000, 0x000100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x020100, 0x020200, 0x020200, 0x030400, 0x030400, 0x020200, 0x020300, 0x040600, 0x050701, 0x050801, 0x060801, 0x070802, 0x070802, 0x090a03, 0x0b0a04, 0x0b0a04, 0x0b0b05, 0x0a0b05, 0x0c0a04, 0x1b1507, 0x1f1805, 0x2b2720, 0x393838, 0x38383a, 0x44413f, 0x3c3932, 0x1b140b, 0x24211e, 0x2e2d2d, 0x312f30, 0x3a3a3c, 0x343435, 0x323132, 0x353334, 0x333131, 0x3a3c3e, 0x4b4f52, 0x3a4245, 0x33393e, 0x3c3f46, 0x36373d, 0x302d2f, 0x39322e, 0x54453c, 0x5e3b21, 0x9b5f2a, 0xa55c1e, 0x9d5314, 0xb77436, 0x914e1a, 0x8b4812, 0x9c5b21, 0xbb7a32, 0xbf7d2e, 0xcc9141, 0xd79f4c, 0xbf8137, 0xab6725, 0xac6a29, 0xb47230, 0xbe7c32, 0xb6732a, 0xb6732b, 0xba782e, 0xc18134, 0xcb903d, 0xd39a45, 0xce943e, 0xc98d36, 0xcf953c, 0xd0953b, 0xce9338, 0xd3973a, 0xd79e3e, 0xdaa140, 0xdba340, 0xdfa943, 0xe1ad45, 0xe2ae49, 0xe3ae49, 0xe2aa46, 0xdda442, 0xd79b3c, 0xd6983a, 0xd29437, 0xd3973b, 0xd4993d, 0xce9639, 0xc68f36, 0xc08a34, 0xbe8a33, 0xc08f37, 0xcb9f43, 0xd4aa4c, 0xd9b253, 0xdcb656, 0xdfbc5b, 0xe2c05f, 0xe1bf5e, 0xdfbc5c, 0xdcb557, 0xd3a64b, 0xc99840, 0xc4913b, 0xbf8a35, 0xc18d38, 0xc89640, 0xd0a247, 0xd9ae51, 0xdeb657, 0xe0ba59, 0xddb857, 0xe0c261, 0xe0c262, 0xcfa847, 0xc4983b, 0xcfa549, 0xbc8c35, 0xba8732, 0xbe8b37, 0xbe8b37, 0xbe8d38, 0xc3943e, 0xb78733, 0xb6832f, 0xc38f38, 0xc99a42, 0xc79a47, 0xc79c4d, 0xc49c53, 0xb28d4e, 0xa38148, 0x9f8048, 0x9e7f46, 0x9c7d42, 0x9b7c3f, 0x9e7e40, 0xa28341, 0xa48541, 0xa1813d, 0xaa904c, 0xdfcc8b, 0xac9250, 0x8e7032, 0x856933, 0x7c6130, 0x765b30, 0x71562e, 0x70522c, 0x6e522c, 0x6b502c, 0x644c29, 0x5e4626, 0x594325, 0x574226, 0x554126, 0x523f24, 0x513f24, 0x4f3f24, 0x4d3e25, 0x4e3f25, 0x4f3f25, 0x4d3e23, 0x4a3d21, 0x45381e, 0x40331b, 0x3c301b, 0x3a2e1c, 0x362d1a, 0x332918, 0x2e2618, 0x2a2315, 0x2a2013, 0x282011, 0x272010, 0x231e10, 0x1e1c0f, 0x1e1b0f, 0x1d1b0f, 0x1d1a0f, 0x1c1a0e, 0x1b180c, 0x19150c, 0x17120b, 0x15100a, 0x121008, 0x0e0f06, 0x0c0c06, 0x0b0a06, 0x0a0a05, 0x080803, 0x070702, 0x080703, 0x070601, 0x060802, 0x050801, 0x040701, 0x040601, 0x040500, 0x040500, 0x040500, 0x040500, 0x030300, 0x020300, 0x010100, 0x010100, 0x020200, 0x020100, 0x000000, 0x000100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010001, 0x010100, 0x030200, 0x020200, 0x030400, 0x030400, 0x020200, 0x030300, 0x040500, 0x050701, 0x060801, 0x060701, 0x070802, 0x070802, 0x090904, 0x0a0905, 0x0b0a06, 0x0b0b06, 0x0a0a04, 0x0a0904, 0x120e05, 0x171105, 0x1f1d18, 0x3a3a3a, 0x343438, 0x434242, 0x42403a, 0x1c180e, 0x1c1b16, 0x2a2a28, 0x333131, 0x2b2a2a, 0x2d2d2f, 0x353436, 0x343234, 0x393a3b, 0x4b5053, 0x3f4347, 0x3f4246, 0x35363b, 0x3f3e44, 0x363539, 0x312d2c, 0x4d413a, 0x533726, 0x834d21, 0x9b5920, 0x994e0f, 0xb47137, 0x975722, 0x8c4813, 0x95551f, 0x9e5d23, 0xa05e1e, 0xa96823, 0xaf7026, 0xb37428, 0xaf6e25, 0xa96723, 0xb4732f, 0xb77731, 0xc18235, 0xbb7f35, 0xb0722c, 0xb1722a, 0xb5792d, 0xc08837, 0xc78f3e, 0xcb913f, 0xd39a42, 0xdaa348, 0xdea849, 0xdea746, 0xe0aa46, 0xe2ab47, 0xe0a945, 0xdea945, 0xdfaa45, 0xe4b14b, 0xebbd55, 0xe9b953, 0xe5b14d, 0xe1aa48, 0xd49c3f, 0xcb9237, 0xc38930, 0xb9812a, 0xb67f2a, 0xb4802c, 0xac7926, 0xaa7926, 0xb07f2a, 0xbb8a33, 0xca9c42, 0xd8ad50, 0xe0b858, 0xe4bf5e, 0xeac663, 0xebc966, 0xeac765, 0xe8c461, 0xe5bf5c, 0xdcb14f, 0xd5a547, 0xcd9a3e, 0xca973c, 0xcc9a40, 0xd2a447, 0xdaaf50, 0xdfb757, 0xe2bb5a, 0xe4be5b, 0xe0bd5a, 0xf5e486, 0xfcf091, 0xdbb959, 0xca9f42, 0xbf9238, 0xbe8e37, 0xbd8c39, 0xbe8c38, 0xc08d3b, 0xbf8e3b, 0xba8935, 0xb78530, 0xc3923b, 0xcb9d44, 0xc79c47, 0xc9a151, 0xc7a058, 0xb59050, 0xa8874c, 0xa5864b, 0xa38449, 0xa28447, 0xa28444, 0xa18443, 0xa48543, 0xa78845, 0xa78943, 0xa1833f, 0xa58c49, 0xd4c27f, 0xa48b4b, 0x8c6e33, 0x856a33, 0x7f6332, 0x7a5f32, 0x75592f, 0x73572f, 0x70532c, 0x6c512c, 0x664d29, 0x604826, 0x5a4426, 0x584328, 0x554026, 0x543f25, 0x544026, 0x544227, 0x504024, 0x544224, 0x563f16, 0x59441c, 0x51411e, 0x493b1e, 0x42361e, 0x3c321e, 0x3b2f1d, 0x392d1a, 0x342918, 0x2d2616, 0x272414, 0x262213, 0x252111, 0x232010, 0x211e10, 0x1f1c10, 0x1e1b0e, 0x1e1b0e, 0x1d1b0f, 0x1b190e, 0x1b170d, 0x19140c, 0x16110c, 0x14100a, 0x101008, 0x0e0f06, 0x0d0d07, 0x0b0a06, 0x0a0a05, 0x0a0804, 0x070702, 0x080803, 0x070802, 0x060802, 0x050701, 0x050701, 0x040601, 0x040500, 0x040500, 0x040500, 0x040500, 0x030400, 0x030300, 0x010100, 0x010101, 0x020101, 0x010000, 0x000000, 0x000001, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x020100, 0x020100, 0x020200, 0x030400, 0x030400, 0x020300, 0x030400, 0x040601, 0x060802, 0x050802, 0x050701, 0x070701, 0x070801, 0x080902, 0x090a04, 0x0b0a05, 0x0b0b06, 0x0a0a05, 0x0a0a05, 0x0b0c05, 0x0a0902, 0x12120c, 0x444344, 0x5d5d61, 0x3f4041, 0x494842, 0x201c12, 0x14130d, 0x2d2c2b, 0x2d2b2a, 0x282727, 0x363437, 0x353335, 0x343334, 0x4c4e51, 0x4b4e51, 0x46484b, 0x3a3b40, 0x393a40, 0x414147, 0x444246, 0x423833, 0x4c3628, 0x6d3d18, 0x834413, 0x874009, 0xa45f29, 0x9c5a26, 0x8f4c1a, 0x935421, 0x965924, 0x955821, 0x965720, 0x9a5b20, 0x96581c, 0x9f6022, 0xa26122, 0x9f5d1d, 0x9f5c1c, 0xa15e1b, 0xb0722b, 0xbd823a, 0xb77b35, 0xb1742d, 0xb0752c, 0xb47a2f, 0xb77d33, 0xb87d31, 0xc18734, 0xc89139, 0xcf993d, 0xd6a13f, 0xdea945, 0xdca845, 0xd9a343, 0xe1ae4c, 0xe1af4e, 0xddac4c, 0xd8a74a, 0xca983c, 0xc08b32, 0xbb842c, 0xb6802a, 0xb47f2c, 0xb7832f, 0xbe8933, 0xc89338, 0xcd993c, 0xce993d, 0xcc963a, 0xce973b, 0xd19c3d, 0xd8a646, 0xdfb250, 0xe7bf5b, 0xeac55f, 0xefcb65, 0xefcd68, 0xefce67, 0xf0cd66, 0xeac45f, 0xe2b854, 0xdcaf4c, 0xd6a745, 0xd2a240, 0xd6a647, 0xddb150, 0xe3bc59, 0xe7c25f, 0xe8c45f, 0xe8c661, 0xe6c461, 0xead170, 0xead271, 0xdbb656, 0xd2a84b, 0xc99c41, 0xc89843, 0xc59340, 0xc18d3b, 0xc08d3b, 0xbd8c3b, 0xbd8c39, 0xc89940, 0xcc9f47, 0xc79c46, 0xc7a050, 0xc9a45b, 0xb89553, 0xad8b4d, 0xad8d4f, 0xa98b4c, 0xa8894b, 0xa88a49, 0xa98a46, 0xaa8e48, 0xab8e48, 0xa88a46, 0xa38643, 0x9e8241, 0x957a3a, 0x8d702f, 0x8e7136, 0x896e34, 0x866a2d, 0x866a35, 0x826636, 0x7a5e31, 0x755a30, 0x71542d, 0x6d512b, 0x674e29, 0x624a27, 0x5b4525, 0x574225, 0x544126, 0x554125, 0x564225, 0x574426, 0x584223, 0x614a21, 0xa18f5e, 0x96804a, 0x5e480b, 0x534319, 0x483c1d, 0x3e351f, 0x3d301d, 0x392c1a, 0x312917, 0x2b2715, 0x262513, 0x242312, 0x232012, 0x221f12, 0x211d11, 0x1f1c0e, 0x1e1c0d, 0x1e1b0e, 0x1d1a0e, 0x1a180d, 0x19150b, 0x18130b, 0x16120c, 0x14110a, 0x101008, 0x0e0e06, 0x0d0d07, 0x0b0b06, 0x0a0a04, 0x0a0904, 0x080703, 0x080803, 0x070801, 0x060802, 0x050802, 0x050701, 0x050601, 0x040500, 0x040500, 0x040500, 0x040500, 0x030400, 0x020300, 0x010100, 0x010100, 0x010001, 0x000000, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010000, 0x010100, 0x020100, 0x020200, 0x020300, 0x030400, 0x030400, 0x020300, 0x040400, 0x040601, 0x060702, 0x060902, 0x050701, 0x070702, 0x060701, 0x070902, 0x0a0a05, 0x0b0a05, 0x0b0b06, 0x0b0d07, 0x0c0c06, 0x0c0d05, 0x0c0d04, 0x050500, 0x484849, 0x626265, 0x37393a, 0x4e4e4a, 0x25221a, 0x191711, 0x262522, 0x272523, 0x323131, 0x353335, 0x343234, 0x3e3f42, 0x3f4245, 0x4f5255, 0x3e4044, 0x3d3d44, 0x3b3c42, 0x3e3e43, 0x504a49, 0x49372d, 0x663b19, 0x7e4315, 0x85410c, 0x985723, 0x975624, 0x8b4816, 0x8b4b1b, 0x874616, 0x874817, 0x864816, 0x864814, 0x90521d, 0x8f541e, 0x94561d, 0x98561b, 0x9e5b1e, 0xa66121, 0xac6623, 0xb4722b, 0xb5722c, 0xb37128, 0xbf7f33, 0xc58b3a, 0xcc9542, 0xce9642, 0xca923c, 0xd8a64d, 0xddaf54, 0xd5a549, 0xce9c3f, 0xd0a042, 0xcb9a40, 0xc6923a, 0xbe8b34, 0xbb8a32, 0xbd8b32, 0xc4913a, 0xcc9b43, 0xd2a349, 0xd8a84a, 0xdcab4b, 0xe0ae4d, 0xe2ae4a, 0xdfa945, 0xd9a23e, 0xd7a23d, 0xd9a540, 0xd39d3a, 0xd19a39, 0xd5a03d, 0xdba945, 0xe1b44e, 0xebc45e, 0xefcd66, 0xf2d26a, 0xf3d36d, 0xf3d36c, 0xf2d36b, 0xf1d069, 0xeac55c, 0xe5bb53, 0xe0b54d, 0xdcb049, 0xdeb24c, 0xe4bb57, 0xe7c360, 0xeac764, 0xecca66, 0xeccb67, 0xe9c867, 0xe5c361, 0xe0bc5b, 0xdab353, 0xd5ac4d, 0xd1a548, 0xce9f46, 0xc99842, 0xc2913d, 0xbf8d3a, 0xbf903d, 0xc99c46, 0xcda049, 0xc9a04b, 0xcba655, 0xcca95f, 0xbd9b5a, 0xb39254, 0xb19251, 0xb09351, 0xaf9350, 0xaf914c, 0xb0924c, 0xb09249, 0xb69b4e, 0xaf944a, 0xa48845, 0x9e8241, 0x977d41, 0x91783f, 0x8c713a, 0x8a6f36, 0x927a3e, 0xb09c60, 0x91773a, 0x886c39, 0x806334, 0x775b30, 0x70542d, 0x6b512a, 0x6a4e2a, 0x684c2b, 0x62482a, 0x5b4526, 0x5b4528, 0x584226, 0x574225, 0x574225, 0x594121, 0x6b5122, 0xdbcc95, 0xcebb77, 0x9e8938, 0x796525, 0x554418, 0x45381c, 0x3e321d, 0x372c1a, 0x2f2817, 0x292615, 0x252412, 0x242212, 0x221f12, 0x211e11, 0x201c10, 0x1f1c0f, 0x1e1b0d, 0x1d1a0e, 0x1b190c, 0x1a180d, 0x1b160b, 0x1b140c, 0x16120c, 0x14110c, 0x111009, 0x0f1006, 0x0d0e08, 0x0b0c07, 0x0b0b05, 0x0a0904, 0x090702, 0x080802, 0x070802, 0x060802, 0x060801, 0x050701, 0x050601, 0x040500, 0x040500, 0x040500, 0x040501, 0x020300, 0x020300, 0x010100, 0x010100, 0x000001, 0x000000, 0x000000, 0x000100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x030400, 0x030500, 0x030300, 0x030400, 0x050601, 0x060803, 0x050802, 0x060701, 0x080702, 0x060802, 0x070802, 0x0a0a04, 0x0c0a06, 0x0b0b06, 0x0c0c06, 0x0d0d06, 0x0e0e06, 0x0f0e05, 0x0e0c02, 0x3d3e3d, 0x4d4e50, 0x2c2d30, 0x4e4e4b, 0x2a2922, 0x101008, 0x20201c, 0x302f2e, 0x302e2f, 0x302e31, 0x333436, 0x3b3e41, 0x393c40, 0x45484d, 0x383b40, 0x3f4047, 0x424247, 0x514c4c, 0x4b3d36, 0x5a3316, 0x7f451a, 0x874512, 0x904f1f, 0x985b2a, 0x803f0e, 0x864311, 0x8b4614, 0x8d4b18, 0x8f4c19, 0x914e19, 0x94541d, 0x9a5b22, 0x9c5e25, 0xa56529, 0xaf6d2e, 0xb36f2e, 0xb97532, 0xc28039, 0xc7863d, 0xc1803a, 0xb97a36, 0xbd803a, 0xb8813a, 0xb6843e, 0xad7b35, 0x9f6c27, 0xa06f29, 0xa47129, 0xaa762a, 0xb38031, 0xc2903c, 0xcd9b44, 0xd6a54a, 0xdbaa4d, 0xdeab4c, 0xe2af4e, 0xe5b352, 0xe9b855, 0xeabb57, 0xecbd57, 0xeab953, 0xe7b74f, 0xe7b64f, 0xe1ae48, 0xdaa53f, 0xdda842, 0xe1ae48, 0xdeaa45, 0xdaa540, 0xdba741, 0xddad46, 0xe6bc53, 0xeeca61, 0xf3d169, 0xf4d46d, 0xf5d770, 0xf5d871, 0xf5d970, 0xf5d86f, 0xf0cf65, 0xe9c359, 0xe5bb53, 0xdfb54e, 0xe0b752, 0xe5bf59, 0xebc966, 0xeccc6a, 0xeccd6b, 0xedcd6b, 0xe9c967, 0xe6c463, 0xe1bd5d, 0xdab453, 0xd8b151, 0xd9b050, 0xdaaf51, 0xd4a74a, 0xcea047, 0xcb9c47, 0xc69843, 0xca9d48, 0xcca250, 0xd0aa5b, 0xcfac63, 0xbfa05e, 0xb7975a, 0xb69758, 0xb39553, 0xb29653, 0xb29550, 0xb2974e, 0xb5984e, 0xb79a50, 0xb5994e, 0xaa8f47, 0xa08442, 0x997d41, 0x937941, 0x917741, 0x8e733c, 0x896f36, 0x947d44, 0xc3b178, 0x8b7137, 0x826635, 0x7e6235, 0x745a30, 0x6f552c, 0x6e552d, 0x72542e, 0x75532e, 0x704f2d, 0x65492a, 0x5d4527, 0x594327, 0x564125, 0x574124, 0x5a4322, 0x664c20, 0x8c702b, 0xccb766, 0xf3e79d, 0xb0a15c, 0x5a4504, 0x47391b, 0x3a3019, 0x332b18, 0x2e2715, 0x292413, 0x252111, 0x232013, 0x221f12, 0x201d11, 0x1f1b10, 0x1e1a0f, 0x1d190d, 0x1a170b, 0x19170b, 0x19160c, 0x1a150a, 0x19130b, 0x17120c, 0x15110b, 0x131008, 0x110f06, 0x0e0e06, 0x0c0b05, 0x0b0b05, 0x090a04, 0x080802, 0x070802, 0x060701, 0x060802, 0x060802, 0x050701, 0x050601, 0x040500, 0x040500, 0x030400, 0x030300, 0x020200, 0x020201, 0x010101, 0x010100, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x020200, 0x010100, 0x020300, 0x020400, 0x020500, 0x030500, 0x040701, 0x050702, 0x050703, 0x060802, 0x070702, 0x080703, 0x070702, 0x070903, 0x090a05, 0x0a0a05, 0x0a0b06, 0x0b0c06, 0x0d0d07, 0x100f08, 0x100f08, 0x111004, 0x363836, 0x3c4042, 0x313234, 0x494a46, 0x2f2f28, 0x121209, 0x1e1e1a, 0x2f2f2d, 0x31302f, 0x303031, 0x3e4144, 0x34383c, 0x404448, 0x3a3d42, 0x3d3e44, 0x424248, 0x4b4849, 0x524640, 0x512f18, 0x794319, 0x874916, 0x824212, 0x945729, 0x7e3f13, 0x864719, 0x995824, 0xa26029, 0x9f5e26, 0xa5642a, 0xb27336, 0xb67639, 0xaf7035, 0xaa6d33, 0xaa6e33, 0xad7036, 0xa26730, 0x9b602d, 0x985f2e, 0x935b2b, 0x885023, 0x814a21, 0x844e21, 0x8a5722, 0x96642a, 0xa57234, 0xb47e38, 0xbf883a, 0xca923d, 0xd29a43, 0xd69f45, 0xdba448, 0xdca548, 0xdca746, 0xe2b04d, 0xe0ae4c, 0xe3b04d, 0xe5b24e, 0xe7b651, 0xecc059, 0xefc55d, 0xebbf57, 0xe7b952, 0xe2b34c, 0xdfad47, 0xdeaa43, 0xdeab44, 0xe1af48, 0xe2b048, 0xe2b34a, 0xe4b34a, 0xe4b64d, 0xeac056, 0xf0cb62, 0xf3d169, 0xf4d56d, 0xf4d76f, 0xf4d76f, 0xf7db73, 0xf6d971, 0xf2d36a, 0xebc75e, 0xe5bf56, 0xe4bf58, 0xe8c45f, 0xeccc66, 0xeed16e, 0xefd573, 0xf0d774, 0xefd472, 0xefd474, 0xeacb6b, 0xe7c363, 0xe6c161, 0xe2bd5d, 0xddb657, 0xd8af52, 0xd4a94e, 0xcfa34a, 0xcb9d48, 0xcb9e4a, 0xcda351, 0xcea758, 0xcfab60, 0xc7a663, 0xbfa061, 0xbc9e5e, 0xb99c5a, 0xb79a58, 0xb59854, 0xb69951, 0xb69b51, 0xb89c53, 0xb79b52, 0xae924c, 0xa68a48, 0x9f8344, 0x997c41, 0x90753e, 0x8d723d, 0x8d713a, 0x8b7038, 0x876c35, 0x82682d, 0x846b34, 0x806735, 0x775e31, 0x72592e, 0x705a2e, 0x715a2e, 0x75592e, 0x886036, 0x93683f, 0x724e2c, 0x5b4225, 0x554125, 0x524023, 0x574323, 0x5a4623, 0x614a21, 0x795e1c, 0xb29e53, 0xd8cb87, 0x998a49, 0x57420b, 0x443619, 0x392f19, 0x322a16, 0x2d2614, 0x2a2412, 0x262211, 0x232013, 0x211e12, 0x201c10, 0x1e1a0f, 0x1c180e, 0x1b170d, 0x19160c, 0x18150c, 0x19160d, 0x18150d, 0x1a150d, 0x1a140d, 0x1a130b, 0x17110a, 0x131006, 0x100e05, 0x0c0d04, 0x0a0a04, 0x0a0904, 0x070802, 0x070903, 0x070803, 0x070802, 0x050702, 0x050701, 0x050501, 0x040501, 0x040501, 0x030500, 0x040300, 0x020100, 0x020100, 0x020200, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x010100, 0x010200, 0x010100, 0x020200, 0x010500, 0x010501, 0x030500, 0x040701, 0x050801, 0x060803, 0x070803, 0x090703, 0x0b0805, 0x080804, 0x080a04, 0x090a05, 0x090a05, 0x0a0b05, 0x0b0d06, 0x0e0e09, 0x100f0a, 0x110f0a, 0x0e0d04, 0x2c2d2c, 0x3b3e41, 0x333437, 0x3d3f3d, 0x2f302a, 0x15140b, 0x21201b, 0x30302c, 0x2e2d2d, 0x3c4043, 0x373c40, 0x34373e, 0x3c4046, 0x37393f, 0x3d3d43, 0x444244, 0x4e453f, 0x523521, 0x72411b, 0x864d1e, 0x7a3b0c, 0x8a4e22, 0x7e451a, 0x874e21, 0x8f5428, 0x965829, 0x9c5e2d, 0x965b2b, 0x925827, 0x8f5827, 0x7f491f, 0x713e19, 0x683615, 0x673414, 0x6e3b1b, 0x794522, 0x885029, 0x955b2f, 0x9f6531, 0xaa6f34, 0xb27739, 0xb97e39, 0xbd8437, 0xc18638, 0xbf8334, 0xc18531, 0xc78c35, 0xce933b, 0xd2983e, 0xd0973c, 0xdaa345, 0xe3b04c, 0xe5b44f, 0xe9bb53, 0xebbd56, 0xe8b652, 0xe8b751, 0xe9bb54, 0xe7bc54, 0xecc25a, 0xecc159, 0xebc056, 0xebc057, 0xeabd52, 0xe7b84b, 0xe5b349, 0xe5b54b, 0xe9bb50, 0xe7bc51, 0xe8bd52, 0xebc156, 0xecc359, 0xefca60, 0xf4d36b, 0xf4d870, 0xf4dd74, 0xf6e079, 0xf5de77, 0xf4dc74, 0xf2d870, 0xefd268, 0xedcd65, 0xeccc66, 0xedd06c, 0xf1d773, 0xf1d975, 0xf1da7a, 0xf2db7c, 0xefd677, 0xecd174, 0xe7c86b, 0xe1bf62, 0xdeb85b, 0xdab458, 0xd6af54, 0xd3aa51, 0xd1a64f, 0xcea34d, 0xd0a550, 0xd0a552, 0xd1a85a, 0xcfaa5d, 0xd0ad64, 0xc7a864, 0xc0a262, 0xbe9f5e, 0xbb9e5b, 0xba9d58, 0xb99d54, 0xb99c53, 0xbb9e55, 0xb99d54, 0xb2954f, 0xaa8c4a, 0xa48748, 0x9e8142, 0x987b40, 0x90753d, 0x8c713b, 0x8b7039, 0x8a7038, 0x896f37, 0x8a7031, 0xccb980, 0xb5a370, 0x725928, 0x725b2e, 0x705c30, 0x6c582d, 0x6e5329, 0x8b6136, 0xac7e52, 0x805832, 0x5d4426, 0x564427, 0x554525, 0x564423, 0x584523, 0x5b4722, 0x66501f, 0x6f5a1a, 0x745f19, 0x604b14, 0x4e3b17, 0x423317, 0x372b13, 0x312814, 0x2c2412, 0x292210, 0x24210e, 0x211e11, 0x1f1c10, 0x1e1a0f, 0x1c190d, 0x1b170c, 0x18150c, 0x18150b, 0x18140c, 0x18150c, 0x1a160d, 0x1c160d, 0x1c140c, 0x1b130c, 0x1a120a, 0x161108, 0x100f05, 0x0d0e04, 0x0a0a04, 0x080803, 0x060802, 0x080904, 0x070803, 0x050801, 0x040701, 0x050701, 0x050601, 0x040600, 0x040500, 0x040500, 0x040300, 0x020100, 0x020200, 0x010300, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010100, 0x010200, 0x020200, 0x010100, 0x010300, 0x010601, 0x010501, 0x030500, 0x040600, 0x060801, 0x060803, 0x070803, 0x080803, 0x0a0804, 0x080803, 0x090904, 0x090904, 0x090904, 0x0a0b05, 0x0b0c06, 0x0d0d08, 0x0f0e0a, 0x100f0a, 0x100f08, 0x222320, 0x363739, 0x323538, 0x3e4041, 0x373834, 0x171910, 0x1e1f19, 0x2a2a26, 0x404241, 0x3b3e41, 0x373a40, 0x3c3f46, 0x3d3f47, 0x3c3d43, 0x3b3a3e, 0x4a4340, 0x4b3728, 0x6c411f, 0x80491e, 0x763d10, 0x7d431b, 0x855027, 0x82522b, 0x7a4925, 0x714221, 0x623215, 0x5a2a10, 0x54240b, 0x57270e, 0x582910, 0x5c2e12, 0x643411, 0x75421c, 0x8a5228, 0x9a5d2d, 0xa56530, 0xad6b30, 0xaf6c2e, 0xaf6c29, 0xb5752d, 0xbf8135, 0xbf8132, 0xc58835, 0xcb8f3a, 0xca8b36, 0xce8f39, 0xd0933e, 0xcf923d, 0xd3973e, 0xd0973d, 0xd9a345, 0xe3b04b, 0xe6b750, 0xe8ba52, 0xe8bb53, 0xe7b651, 0xe6b651, 0xe9bc55, 0xedc25a, 0xefc75d, 0xf1c85f, 0xf0c85e, 0xeec45a, 0xedc357, 0xe8bc50, 0xe6b84d, 0xe5b74c, 0xe9bc52, 0xefc65b, 0xecc55a, 0xeec85e, 0xedc75d, 0xeeca62, 0xf3d66f, 0xf6df78, 0xfaec8b, 0xfdf698, 0xfaee8a, 0xf9e882, 0xf7e37d, 0xf1da73, 0xeacf68, 0xe9cc69, 0xebd06d, 0xecd271, 0xecd371, 0xebd373, 0xedd477, 0xecd174, 0xe9cd70, 0xe4c86d, 0xe0c166, 0xdfbc62, 0xdfbd64, 0xdfbe65, 0xe0bc62, 0xe1be66, 0xe5c169, 0xe6c26a, 0xd7b25d, 0xd8b462, 0xd6b464, 0xd4b267, 0xcdae67, 0xc3a663, 0xbfa15c, 0xbfa25c, 0xbea15a, 0xbea359, 0xc0a35a, 0xbda057, 0xb89b53, 0xb2944e, 0xa98b49, 0xa08243, 0x9c7d40, 0x987a3e, 0x94773e, 0x90733b, 0x8f723b, 0x8e713a, 0x8c7139, 0x8c7235, 0x9c874e, 0x917b49, 0x775f30, 0x745e32, 0x6f5c32, 0x6a562d, 0x69502a, 0x75522a, 0x7b542c, 0x6e4c28, 0x5b4425, 0x564324, 0x554525, 0x574525, 0x584524, 0x574523, 0x5a4520, 0x57421b, 0x503c19, 0x4c391a, 0x433417, 0x3c2f15, 0x352a13, 0x302713, 0x2a2312, 0x272011, 0x231f0f, 0x201e11, 0x1e1b0f, 0x1d190d, 0x1b170b, 0x19150a, 0x181409, 0x171409, 0x17140b, 0x18150b, 0x1c160d, 0x1d160e, 0x1c160d, 0x1c160c, 0x1b140a, 0x161107, 0x100f05, 0x0d0e05, 0x0a0b04, 0x080802, 0x060802, 0x080a04, 0x080803, 0x050702, 0x050702, 0x050701, 0x050601, 0x050600, 0x040600, 0x040500, 0x030200, 0x010200, 0x020201, 0x020301, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000101, 0x010200, 0x010200, 0x010100, 0x020301, 0x020500, 0x020500, 0x040500, 0x050701, 0x060801, 0x070802, 0x070903, 0x090804, 0x090803, 0x090904, 0x0b0a05, 0x0a0a05, 0x0a0a05, 0x0b0b05, 0x0d0c07, 0x0d0d08, 0x0f0f0a, 0x0f100b, 0x11110b, 0x1e1f19, 0x353838, 0x313439, 0x3f4346, 0x3d403f, 0x20211a, 0x13120b, 0x363837, 0x404343, 0x323539, 0x35393f, 0x3e4048, 0x43444d, 0x414146, 0x453f40, 0x46372e, 0x5b3920, 0x653714, 0x713c13, 0x78441a, 0x723f1b, 0x5b2d13, 0x5a2e16, 0x5e331a, 0x693c1f, 0x704323, 0x734323, 0x75421f, 0x713e1a, 0x734019, 0x794319, 0x82491b, 0x874b19, 0x91531d, 0x93521a, 0x9f5b20, 0xa96425, 0xb4702d, 0xc4833b, 0xcb8d40, 0xc7873a, 0xc68536, 0xcb8e3b, 0xce923e, 0xcd903c, 0xca8d3a, 0xbd7f2f, 0xbb7b2b, 0xc78a37, 0xcc933e, 0xd49e44, 0xdfac4b, 0xe6b551, 0xe5b551, 0xe6b753, 0xeabc58, 0xecbe5a, 0xeabe58, 0xe9be57, 0xe9be57, 0xecc45d, 0xeec75f, 0xe9c158, 0xedc65d, 0xefca5f, 0xeec85c, 0xe9c155, 0xe9c359, 0xf1cf66, 0xf1d26a, 0xf2d26c, 0xf2d36d, 0xf4d873, 0xf5de79, 0xf7e27f, 0xf8e98a, 0xf8ee92, 0xf4e686, 0xf2e27e, 0xf0dd79, 0xe8d16e, 0xe4c967, 0xe6cb68, 0xecd370, 0xf0da7a, 0xefd978, 0xedd676, 0xeed579, 0xecd275, 0xebd074, 0xedd478, 0xf1d97e, 0xf2d97d, 0xf1d77b, 0xedcf75, 0xe7c568, 0xe4c065, 0xdfba62, 0xddb65e, 0xddb861, 0xdfbc65, 0xdfbe68, 0xddbd6a, 0xdabb6e, 0xd6bb70, 0xcfb36d, 0xc7ab63, 0xc2a55c, 0xc2a65d, 0xc2a45b, 0xbda056, 0xb89b53, 0xb1924d, 0xa98947, 0xa48445, 0xa28243, 0xa18242, 0x9c7d41, 0x94763e, 0x91743d, 0x8e703a, 0x8a6f38, 0x896d38, 0x806631, 0x7c6332, 0x786134, 0x766036, 0x735d34, 0x6a552e, 0x664e2b, 0x674b29, 0x654828, 0x5e4426, 0x594425, 0x574425, 0x554527, 0x564527, 0x564426, 0x554425, 0x534223, 0x4d3c1f, 0x46361b, 0x42341c, 0x3c2e19, 0x362b18, 0x312715, 0x2b2412, 0x262110, 0x231f10, 0x211d10, 0x1f1c10, 0x1d190e, 0x1c180c, 0x1a160c, 0x19160b, 0x18140a, 0x16130a, 0x16130a, 0x18140b, 0x1c140d, 0x1d150d, 0x1b150b, 0x19150a, 0x181408, 0x141006, 0x0f1005, 0x0c0e03, 0x090a03, 0x080903, 0x070803, 0x080a04, 0x070903, 0x060702, 0x050702, 0x050802, 0x050801, 0x040601, 0x040601, 0x030500, 0x030300, 0x010100, 0x020200, 0x020200, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010100, 0x020200, 0x010201, 0x020200, 0x030500, 0x030400, 0x040601, 0x050701, 0x060802, 0x070903, 0x070902, 0x080802, 0x090803, 0x090a05, 0x0b0b06, 0x0c0b06, 0x0c0c06, 0x0d0c07, 0x0e0e08, 0x0e0f08, 0x101009, 0x101109, 0x12120a, 0x1b1c16, 0x393c3c, 0x303539, 0x3a3e42, 0x404444, 0x333632, 0x272826, 0x464a4c, 0x3e4243, 0x2f3034, 0x393c41, 0x3b3e46, 0x3a3a42, 0x474446, 0x423632, 0x553822, 0x572f14, 0x592907, 0x663310, 0x875225, 0x824e23, 0x814c24, 0x7f4a22, 0x7f4a21, 0x7f481f, 0x7c451b, 0x7c451b, 0x784017, 0x7b4318, 0x84481b, 0x8b501e, 0x8d501d, 0x925520, 0x9a5d26, 0x9a5c27, 0x9b5a22, 0xa26125, 0xa76727, 0xa86726, 0xae6f28, 0xb06e27, 0xb7742b, 0xb47328, 0xb8782b, 0xbb7a2f, 0xc28436, 0xc48838, 0xc98f3b, 0xd7a047, 0xdca54b, 0xdda74c, 0xdca84a, 0xdeab4c, 0xe2b251, 0xe9bb59, 0xe9be5b, 0xe9c15d, 0xebc45f, 0xebc460, 0xeac35f, 0xeac460, 0xeac561, 0xe9c55f, 0xeccb62, 0xefcf65, 0xf0cf68, 0xf0ce68, 0xeecc67, 0xeccc68, 0xecce6c, 0xe9ca6a, 0xe4c464, 0xe3c463, 0xe7cb6b, 0xedd574, 0xf2dd7d, 0xf3e282, 0xf2e583, 0xf5e886, 0xf6ea89, 0xf3e786, 0xf2e480, 0xf3e17a, 0xf3df77, 0xf5e37d, 0xf3e07d, 0xf2dc7a, 0xf0d876, 0xeed774, 0xefd878, 0xebd577, 0xe6d072, 0xe2c76a, 0xe0bf63, 0xdeba5f, 0xdeb85c, 0xdeb75b, 0xdcb65c, 0xdab258, 0xd7af57, 0xe0bc60, 0xf0d373, 0xdfc064, 0xdbb962, 0xe0c16d, 0xe6cb7c, 0xe4ca7b, 0xd4b869, 0xccae61, 0xc4a659, 0xbd9f53, 0xb79850, 0xb1904a, 0xad8c48, 0xad8b49, 0xa98846, 0xa58442, 0x9e7d3f, 0x96763d, 0x93743c, 0x8e7039, 0x8a6d39, 0x866a38, 0x826837, 0x7e6537, 0x796236, 0x745e34, 0x705933, 0x6b5330, 0x654d2c, 0x62482b, 0x5d442a, 0x5b4127, 0x574125, 0x564325, 0x534326, 0x534325, 0x534225, 0x514225, 0x4f4022, 0x4a3a1e, 0x43341c, 0x3e301b, 0x362b18, 0x322816, 0x2e2414, 0x292213, 0x242011, 0x201e10, 0x1e1c0f, 0x1e190e, 0x1d190e, 0x1b180c, 0x1a160b, 0x19150d, 0x18140c, 0x17130a, 0x15130a, 0x17130d, 0x19140e, 0x1a140d, 0x181509, 0x181509, 0x151407, 0x131106, 0x110f06, 0x0e0f04, 0x090b04, 0x080803, 0x080803, 0x080a04, 0x060902, 0x060702, 0x050702, 0x050802, 0x060701, 0x050601, 0x040500, 0x030400, 0x020300, 0x010100, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x020200, 0x020200, 0x010200, 0x020300, 0x030400, 0x030400, 0x040601, 0x050601, 0x060802, 0x060902, 0x060801, 0x070901, 0x090903, 0x0a0a05, 0x0b0b06, 0x0c0c07, 0x0d0c08, 0x0d0e07, 0x0e0f06, 0x0f1007, 0x101207, 0x101206, 0x121208, 0x14140e, 0x373a3a, 0x32373b, 0x383b40, 0x414448, 0x54585a, 0x474c4e, 0x3c4144, 0x484d4e, 0x343637, 0x3e4045, 0x41424a, 0x3c3a3e, 0x4a413f, 0x432a1a, 0x512c15, 0x4e2107, 0x542409, 0x703c18, 0x7b4319, 0x703a10, 0x773d13, 0x7b4219, 0x82481d, 0x84481e, 0x804418, 0x804318, 0x7d3e14, 0x7d3e13, 0x87481a, 0x915321, 0x935421, 0x925420, 0x985c27, 0x8f541f, 0x8a4e18, 0x915519, 0x995e20, 0x9b5c1e, 0xa76723, 0xb3732a, 0xbe7d31, 0xc68537, 0xcc8e3d, 0xcc903d, 0xd29543, 0xd69d48, 0xd69e47, 0xd59d46, 0xd59f45, 0xd9a64a, 0xddab4d, 0xe0b251, 0xe3b755, 0xe9c25e, 0xecca65, 0xeed06b, 0xf1d470, 0xf2d471, 0xf1d16e, 0xeac866, 0xe9c665, 0xe9c867, 0xe7c565, 0xe5c363, 0xe1bf5e, 0xdab759, 0xd3ae52, 0xd4b052, 0xdab757, 0xe0be5e, 0xe3c160, 0xe5c461, 0xe9cd69, 0xeed671, 0xf4e37f, 0xfaf18d, 0xf9f38e, 0xf9f48d, 0xf9f590, 0xf9f694, 0xfbf690, 0xfaf58a, 0xf5ea80, 0xf2e077, 0xf2db6f, 0xf3dc6f, 0xf5e06e, 0xf5e16e, 0xf7e777, 0xf9ec80, 0xf7ea7f, 0xf4e276, 0xedd46b, 0xe4c65f, 0xe8c860, 0xe7c95e, 0xeac95f, 0xe9c65e, 0xe5bf59, 0xe3bf58, 0xeed167, 0xe9ca63, 0xd2a94d, 0xd9b257, 0xe2be63, 0xe8c66c, 0xe7c86c, 0xe5c769, 0xe4ca6c, 0xdec268, 0xcfb260, 0xbb9c50, 0xb29049, 0xad8b46, 0xaa8843, 0xa78741, 0xa0803f, 0x99793d, 0x95763e, 0x91743c, 0x8c6f3c, 0x896c3b, 0x846939, 0x7f6436, 0x765c32, 0x6e572f, 0x6a522f, 0x664c2d, 0x62492b, 0x5d4429, 0x5a4127, 0x594027, 0x564027, 0x534025, 0x514024, 0x4f4024, 0x4e3f22, 0x4e4022, 0x4a3b1f, 0x46371d, 0x42341d, 0x3a2e1b, 0x342a18, 0x2f2616, 0x2a2114, 0x262013, 0x211e11, 0x1f1d10, 0x1d1b0e, 0x1e180e, 0x1f180e, 0x1c190e, 0x1b190d, 0x19170b, 0x18150c, 0x17140b, 0x16130b, 0x17130c, 0x17140d, 0x17130c, 0x161509, 0x161507, 0x151207, 0x141007, 0x111005, 0x0d0f05, 0x0b0c06, 0x080804, 0x080803, 0x080902, 0x060802, 0x060702, 0x050601, 0x050701, 0x050601, 0x040600, 0x040500, 0x030301, 0x020200, 0x010200, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010100, 0x010101, 0x010101, 0x010100, 0x020100, 0x020200, 0x020200, 0x020200, 0x030400, 0x030400, 0x030500, 0x040701, 0x050701, 0x060802, 0x060701, 0x080901, 0x090a03, 0x0a0a05, 0x0b0b06, 0x0c0d07, 0x0d0c07, 0x0d0e07, 0x0e0e06, 0x0f0f06, 0x101107, 0x101106, 0x131109, 0x0f0c04, 0x343736, 0x333a3e, 0x373c42, 0x3d4146, 0x3a4045, 0x3c4246, 0x424549, 0x424547, 0x40403f, 0x333337, 0x424247, 0x49423f, 0x4a3527, 0x503018, 0x4c2107, 0x55280f, 0x623114, 0x723d19, 0x763f18, 0x763f17, 0x753c14, 0x783e15, 0x86481e, 0x85481e, 0x8d4f25, 0x884920, 0x84461e, 0x8b491e, 0x8a4a1b, 0x9a5925, 0x9d5a20, 0x924f16, 0x88490d, 0x8f5416, 0xa66b26, 0xb57a2e, 0xba8134, 0xbb7d30, 0xc48636, 0xc98c3a, 0xc48433, 0xc98b3a, 0xcd933c, 0xce953d, 0xc9913b, 0xca943e, 0xcb973f, 0xd4a247, 0xdeb051, 0xe2ba59, 0xe8c261, 0xecc868, 0xf0ce6e, 0xeecf6e, 0xeace6e, 0xe1c669, 0xd9ba5e, 0xd2b053, 0xd4af50, 0xd3ad4f, 0xd4ad51, 0xd6af53, 0xd9b158, 0xddb65c, 0xdfbc5c, 0xdebc5c, 0xe1be5d, 0xe6c25b, 0xecc95e, 0xf0cf63, 0xf3d364, 0xf2d466, 0xf2da6d, 0xf1df70, 0xf8ec7e, 0xf9f283, 0xf5f181, 0xf5ef83, 0xf3ef87, 0xf4f18c, 0xf3f087, 0xf5f186, 0xf6f289, 0xf9f189, 0xf2e073, 0xf1da64, 0xf6e367, 0xf7e468, 0xf4e163, 0xfae96d, 0xf5e46b, 0xf4e368, 0xf3e067, 0xf4de65, 0xf2da61, 0xf1d95e, 0xf4d95e, 0xf2d55a, 0xefd155, 0xefd155, 0xe9ca51, 0xe7c656, 0xd6b14e, 0xcda345, 0xd2a648, 0xd8ad4d, 0xe2ba56, 0xedc960, 0xeac95f, 0xf0d46b, 0xeed373, 0xe4c86d, 0xdabc66, 0xcaaa5a, 0xb99c51, 0xad914b, 0xa38642, 0x987b3b, 0x97793f, 0x947640, 0x917240, 0x8b6b3b, 0x856637, 0x7e6134, 0x73592f, 0x6a532d, 0x67502d, 0x644b2a, 0x614a2b, 0x5c4628, 0x584328, 0x554229, 0x534127, 0x534227, 0x514125, 0x4f3f23, 0x4d3d21, 0x4b3b1f, 0x47381e, 0x43361c, 0x3d301b, 0x372c1b, 0x312717, 0x2b2316, 0x262114, 0x221f11, 0x1f1d0f, 0x1f1c0e, 0x1d1a0e, 0x1d180e, 0x1d170d, 0x1d190e, 0x1b190d, 0x1a180c, 0x1a160d, 0x17140b, 0x16130a, 0x16130a, 0x15120a, 0x151309, 0x151407, 0x141207, 0x131007, 0x120f04, 0x0f1004, 0x0c0e05, 0x0b0b06, 0x0a0905, 0x090803, 0x080902, 0x070803, 0x060803, 0x050801, 0x050601, 0x050600, 0x040500, 0x030400, 0x030301, 0x020201, 0x010100, 0x020200, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x030200, 0x020200, 0x020201, 0x030301, 0x040500, 0x030400, 0x040501, 0x040601, 0x050801, 0x070902, 0x060702, 0x080a03, 0x090a04, 0x0a0a05, 0x0b0c07, 0x0c0d08, 0x0d0d08, 0x0e0e07, 0x0f0f06, 0x0f1007, 0x101107, 0x101106, 0x14120a, 0x0f0f05, 0x2d302d, 0x383e40, 0x32393f, 0x3b3f46, 0x3b4046, 0x3d4147, 0x46474c, 0x2f2f30, 0x383837, 0x31312f, 0x494542, 0x423327, 0x4d3019, 0x4e290f, 0x53280c, 0x653819, 0x663515, 0x633111, 0x67330f, 0x78401a, 0x7c431b, 0x7f451a, 0x87491e, 0x84461b, 0x85481e, 0x81441b, 0x7c3f15, 0x834516, 0x8d4b17, 0xa15c1d, 0xb06b24, 0xbb782b, 0xc2822f, 0xc88e35, 0xc88f36, 0xc48a33, 0xbe8530, 0xba7e2d, 0xb87b2c, 0xcd9438, 0xd5a13f, 0xd6a544, 0xd9ab4b, 0xe1b555, 0xdfb557, 0xe0b75c, 0xe1bb60, 0xe1bc61, 0xdebb61, 0xd8b45b, 0xcfab55, 0xc49e4c, 0xbd9745, 0xbb913e, 0xba9139, 0xd2ac49, 0xddb64d, 0xe4bd51, 0xe8c155, 0xe7c25a, 0xe4bf5b, 0xdcb655, 0xdcb555, 0xe0bc59, 0xeac861, 0xefce63, 0xf2d062, 0xefcc5a, 0xf1cf5c, 0xf2d460, 0xf4da68, 0xf9e475, 0xf5e574, 0xf5e973, 0xf5ea72, 0xf0e56c, 0xf2ec76, 0xf8f589, 0xfaf78e, 0xf9f68e, 0xf4f186, 0xf5f386, 0xf5f082, 0xf7f288, 0xf9f288, 0xf3e879, 0xf7ec7b, 0xf8ea78, 0xefda5f, 0xf5df63, 0xfae86d, 0xf9e96e, 0xf4e368, 0xf4e46a, 0xf4e469, 0xf3e061, 0xf1dc5c, 0xecd557, 0xf3db5b, 0xf5da55, 0xf1d451, 0xf6db5f, 0xf6de6c, 0xecd169, 0xe0be5d, 0xd2a848, 0xd3a43f, 0xdeb249, 0xe7bf4f, 0xeccb5c, 0xf1d469, 0xeacb67, 0xe9ca6c, 0xebd274, 0xe2ce74, 0xd8c374, 0xcab46c, 0xb49b59, 0xa2854a, 0x967840, 0x91733b, 0x8b6d37, 0x846635, 0x7e5f31, 0x75592e, 0x6d552e, 0x69512d, 0x674f2e, 0x644c2c, 0x5f4927, 0x5b4728, 0x574528, 0x544327, 0x534328, 0x514225, 0x4e3f23, 0x4b3a20, 0x493a1f, 0x45371d, 0x3f331b, 0x382d18, 0x332a18, 0x2f2617, 0x2a2216, 0x242114, 0x212011, 0x201e0e, 0x1e1c0d, 0x1d190d, 0x1c180d, 0x1c180d, 0x1c190d, 0x1a180c, 0x19180b, 0x18160a, 0x17150a, 0x161309, 0x141208, 0x141107, 0x141206, 0x141205, 0x131106, 0x120f06, 0x120e07, 0x100f06, 0x0c0e05, 0x0a0b06, 0x0a0905, 0x090803, 0x070802, 0x060802, 0x070903, 0x050701, 0x050701, 0x050601, 0x040500, 0x040500, 0x020300, 0x020300, 0x010200, 0x020200, 0x010100, 0x000000, 0x010101, 0x010101, 0x010001, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010100, 0x010101, 0x010200, 0x020200, 0x020200, 0x020200, 0x030301, 0x030400, 0x030400, 0x030400, 0x040601, 0x050801, 0x070902, 0x060802, 0x090a04, 0x0a0a05, 0x0a0a05, 0x0b0c07, 0x0c0d08, 0x0d0d08, 0x0e0e07, 0x0e0f07, 0x0e0f07, 0x101107, 0x111007, 0x14120a, 0x151108, 0x232421, 0x393e42, 0x353b42, 0x353b43, 0x393d46, 0x373b41, 0x2d2f33, 0x2a2a2a, 0x2d2c29, 0x35302b, 0x493f36, 0x422915, 0x44220a, 0x4e270c, 0x5d3316, 0x663615, 0x673716, 0x683617, 0x703b19, 0x79431d, 0x773f19, 0x7c4218, 0x81451b, 0x84481c, 0x834617, 0x874b1a, 0x90521d, 0x955721, 0x9f5d21, 0xaf6b25, 0xb47126, 0xb87927, 0xb07626, 0xb88027, 0xb78024, 0xac7621, 0xb17c29, 0xb6833a, 0xc19043, 0xdaae4e, 0xe0ba58, 0xd8b357, 0xd3ae58, 0xcca755, 0xbe994b, 0xb08a41, 0xa87e37, 0xa2752c, 0xa27227, 0xa37227, 0xa57429, 0xa6762c, 0xaa7b32, 0xb48736, 0xe7c157, 0xf4cf57, 0xefc84c, 0xf0c84d, 0xf0c84e, 0xf2ca54, 0xf4cd5a, 0xf0cb5c, 0xe9c359, 0xeac558, 0xf1cf5e, 0xf0cf5b, 0xf2d15b, 0xf5d55e, 0xf6d963, 0xf7e16e, 0xfaea7b, 0xf3e273, 0xf2e36e, 0xf7eb6f, 0xf1e365, 0xf5e86e, 0xf9f27e, 0xf9f589, 0xf8f489, 0xf6f289, 0xf9f891, 0xfaf88f, 0xf4eb7e, 0xf5ee82, 0xf9f691, 0xfaf798, 0xf9f696, 0xfaf490, 0xf2e173, 0xe7ca57, 0xe4cb5c, 0xf0de70, 0xf2e474, 0xf9ef81, 0xf9f182, 0xf9ee76, 0xfaed6d, 0xfbed6b, 0xf8e361, 0xf3d651, 0xe9c642, 0xe9ca4d, 0xedd35c, 0xf1d966, 0xf3dc6d, 0xf1d569, 0xddb750, 0xce9f38, 0xce9e32, 0xd8ad3d, 0xe9c655, 0xf3d466, 0xedd169, 0xefd974, 0xf1e17e, 0xf0e185, 0xe5d480, 0xd7c075, 0xd3b574, 0xc7a86d, 0xb59660, 0xa2814f, 0x8e6e3f, 0x7e5e30, 0x745428, 0x6f552d, 0x6d552f, 0x6a532e, 0x674f2b, 0x654c29, 0x5f4929, 0x5b4727, 0x584527, 0x544428, 0x514126, 0x4c3c23, 0x4a3b21, 0x47391f, 0x42341a, 0x3c3018, 0x352b17, 0x2f2816, 0x2d2415, 0x282214, 0x232013, 0x211e11, 0x201d11, 0x1f1b0f, 0x1e190e, 0x1d190e, 0x1d190e, 0x1b180c, 0x1a170b, 0x19160c, 0x16140a, 0x15140a, 0x151208, 0x131107, 0x121006, 0x121005, 0x110f05, 0x110e05, 0x100e06, 0x100e05, 0x100e06, 0x0c0d05, 0x0a0b05, 0x090905, 0x090904, 0x070802, 0x070802, 0x070902, 0x050601, 0x040601, 0x040600, 0x040500, 0x040500, 0x020200, 0x020200, 0x010100, 0x020100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000100, 0x000101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x020202, 0x020201, 0x020200, 0x020201, 0x020301, 0x030500, 0x040600, 0x030500, 0x050601, 0x060701, 0x070802, 0x070803, 0x080903, 0x0a0a04, 0x0a0b05, 0x0a0c06, 0x0c0d06, 0x0d0d07, 0x0e0e08, 0x0f0f07, 0x0e0f06, 0x0f1005, 0x111107, 0x16120b, 0x161309, 0x22231d, 0x3c4041, 0x373d43, 0x383d44, 0x333943, 0x363b43, 0x333439, 0x323231, 0x2e2b26, 0x30271e, 0x382518, 0x381b07, 0x452008, 0x552d12, 0x653718, 0x653414, 0x714020, 0x713f1f, 0x713e1d, 0x713b19, 0x743c18, 0x81481f, 0x884f22, 0x8c4f1f, 0x9a5d26, 0xb37938, 0xab6f2b, 0x995b19, 0x9f6120, 0xb0742d, 0xc28838, 0xd5a44f, 0xe5c067, 0xdbb863, 0xc9a154, 0xb4893f, 0xa77a34, 0xaa813f, 0xa57d3d, 0x8e6629, 0x81581e, 0x7a4f18, 0x7a4c14, 0x77490a, 0x764703, 0x7c4b08, 0x875717, 0x916121, 0x936120, 0x996622, 0x9f6a25, 0xa8732b, 0xb37f36, 0xbe8c37, 0xecbf4b, 0xecc345, 0xf1c949, 0xf0c94a, 0xf2cc4f, 0xf0c94f, 0xecc34c, 0xeec853, 0xeecc5a, 0xe8c556, 0xe8c555, 0xebc856, 0xebc755, 0xf0cc58, 0xefce5a, 0xf4d867, 0xedd163, 0xedd562, 0xf7e970, 0xf4e86b, 0xf3e567, 0xf3e96f, 0xf7f07d, 0xf6f080, 0xf9f386, 0xf7f389, 0xf7f48e, 0xf4ef86, 0xf4ed80, 0xf6ef7f, 0xf1eb83, 0xf8f79a, 0xf8f89d, 0xfdf99b, 0xf4e67a, 0xebd664, 0xe2cc61, 0xe1cf6b, 0xe5d674, 0xe8da78, 0xeadd78, 0xf0e377, 0xefde6a, 0xe3c953, 0xd4af38, 0xdab033, 0xebc642, 0xf5da57, 0xefd960, 0xf5e670, 0xf4e775, 0xf4e673, 0xf5e26c, 0xf2d760, 0xe7c54f, 0xe4ba46, 0xd8ab38, 0xd9b145, 0xf0d468, 0xf8e376, 0xf2e175, 0xf1e17c, 0xfaee8f, 0xefe089, 0xd4b66b, 0xcca565, 0xd3ab70, 0xd3ac74, 0xc8a46f, 0xbe9e6e, 0xa3875b, 0x7d623a, 0x695027, 0x664c25, 0x674f29, 0x654c2b, 0x614b2c, 0x5d4929, 0x584628, 0x544427, 0x504125, 0x4b3c22, 0x48391f, 0x44361d, 0x40331a, 0x3b2f17, 0x352a17, 0x2e2716, 0x2b2415, 0x282115, 0x242014, 0x211e11, 0x201c11, 0x1f1b10, 0x1d190e, 0x1d180d, 0x1c170d, 0x1b170d, 0x1a160d, 0x18150d, 0x16140d, 0x14140b, 0x14130b, 0x121209, 0x101007, 0x0f0f07, 0x0e0f07, 0x0d0e05, 0x0e0e06, 0x0d0e05, 0x0d0e04, 0x0c0c04, 0x0a0a05, 0x090905, 0x080904, 0x070802, 0x070802, 0x060802, 0x050701, 0x050700, 0x040600, 0x030400, 0x030300, 0x010200, 0x010200, 0x010200, 0x020201, 0x020202, 0x000000, 0x000000, 0x000101, 0x000201, 0x000101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x020202, 0x020201, 0x020200, 0x010101, 0x030201, 0x030400, 0x030500, 0x040600, 0x050601, 0x060701, 0x070802, 0x080802, 0x080903, 0x0a0905, 0x0a0a05, 0x0b0c06, 0x0c0d07, 0x0c0d08, 0x0e0e08, 0x0f0f08, 0x0f0f07, 0x101006, 0x111109, 0x16130c, 0x18150a, 0x1a1a10, 0x3a3d3d, 0x3a3f44, 0x343941, 0x353b46, 0x3a3f49, 0x3c3d43, 0x3e3c3b, 0x312b26, 0x302217, 0x321b0b, 0x361805, 0x44210c, 0x60371b, 0x653415, 0x653313, 0x683515, 0x6a3615, 0x713b19, 0x753e17, 0x773e15, 0x7e4416, 0x854d1d, 0x97612e, 0xa9753e, 0xbb8b4c, 0xc2944f, 0xbe8f51, 0xb4854b, 0xa8783f, 0x9e6e32, 0x966d33, 0x916e35, 0x7e5b29, 0x734c1c, 0x6e4513, 0x694012, 0x613708, 0x5d3206, 0x5e3409, 0x63380d, 0x663a0d, 0x643a07, 0x7a5322, 0x98723b, 0xb0884a, 0xb98d4b, 0xab762f, 0xa56920, 0xab6e22, 0xb27527, 0xb17627, 0xb27626, 0xb0751f, 0xd19b30, 0xe9b83f, 0xeec143, 0xefc648, 0xeecb4f, 0xefcf56, 0xf2d560, 0xf5dc68, 0xf4db67, 0xf1d866, 0xf0d662, 0xf0d562, 0xefd260, 0xeecd5c, 0xe8c653, 0xe7c351, 0xdeb645, 0xe1be4a, 0xf7e56a, 0xf7ed6f, 0xf4ea6c, 0xf8f177, 0xf8f383, 0xf2ec7d, 0xf7f387, 0xf6f38c, 0xf8f595, 0xf8f591, 0xf8f283, 0xefe36f, 0xeae075, 0xf8f696, 0xf9f799, 0xf8f494, 0xf5ef8b, 0xf7f086, 0xf8f187, 0xfbf48c, 0xfaf48c, 0xfbf48b, 0xf9f084, 0xf7ee7f, 0xeee170, 0xd3b952, 0xb89028, 0xcba32b, 0xe2bd39, 0xf2d54d, 0xf7e05d, 0xf8e769, 0xfbee74, 0xfbf076, 0xf6e569, 0xf3da5a, 0xf3d452, 0xdeb138, 0xe8bc40, 0xd7ad36, 0xc9a235, 0xe2c555, 0xf2da67, 0xecd664, 0xf2e078, 0xf9eb85, 0xf5e180, 0xcdad5b, 0xb78945, 0xcda160, 0xd6ad72, 0xd5b078, 0xd6b47e, 0xcba978, 0xb8986b, 0x9e8059, 0x896e49, 0x6e5631, 0x5b4420, 0x56421f, 0x554425, 0x534427, 0x504027, 0x4a3b23, 0x463821, 0x40351e, 0x3b321b, 0x372e19, 0x312a17, 0x2d2716, 0x2c2416, 0x292214, 0x242013, 0x221e12, 0x201c11, 0x1f1b11, 0x1f190f, 0x1f180e, 0x1c170d, 0x1a160d, 0x19150c, 0x18150d, 0x16150d, 0x13140c, 0x12130b, 0x11120a, 0x101109, 0x0f1008, 0x0e0f08, 0x0e0d08, 0x0e0f07, 0x0e0e06, 0x0d0e04, 0x0b0c04, 0x090a04, 0x090804, 0x070803, 0x080903, 0x070803, 0x060702, 0x050701, 0x050701, 0x040600, 0x030400, 0x030300, 0x020200, 0x020200, 0x020201, 0x020202, 0x010102, 0x000000, 0x000000, 0x010101, 0x000101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010202, 0x020201, 0x020200, 0x020201, 0x030301, 0x030400, 0x030500, 0x040500, 0x050601, 0x060701, 0x070801, 0x080803, 0x080903, 0x090904, 0x090a04, 0x0a0c06, 0x0c0d08, 0x0d0d08, 0x0d0d08, 0x0f0e08, 0x0f1007, 0x101106, 0x111208, 0x15130a, 0x18150b, 0x181507, 0x343634, 0x3a3f44, 0x31363d, 0x313841, 0x3a3e46, 0x424143, 0x443f3c, 0x272019, 0x271509, 0x361d0d, 0x381807, 0x563118, 0x643818, 0x693916, 0x76441e, 0x764119, 0x814b21, 0x865126, 0x895429, 0x8d5a31, 0x9c6d43, 0xa87f53, 0xa98155, 0x9b744b, 0x8a663b, 0x785329, 0x663d19, 0x562800, 0x541f00, 0x571d00, 0x521600, 0x522100, 0x542c0a, 0x553210, 0x5f3c1a, 0x603d1b, 0x583613, 0x5b3714, 0x65411e, 0x6d441d, 0x865b2a, 0xb2874d, 0xc69756, 0xc5924c, 0xbd853d, 0xbb8132, 0xc69137, 0xd7a845, 0xd6a13b, 0xd99f38, 0xd69d35, 0xd9a23a, 0xd29c34, 0xcd952c, 0xdba333, 0xdba935, 0xeac24a, 0xf0d559, 0xf4dd64, 0xf4db62, 0xf0d458, 0xeecf51, 0xf0d252, 0xf3d756, 0xf3d95c, 0xf4da5e, 0xf4da60, 0xf0d75e, 0xf3da63, 0xeed05c, 0xdbb23b, 0xe6c64d, 0xf5e66a, 0xf9ef75, 0xf7f37f, 0xf6f48b, 0xf6f28e, 0xfbf897, 0xfcfb9f, 0xfcfca5, 0xfcfb9e, 0xf6f289, 0xeadf73, 0xefe77c, 0xf3ef88, 0xf4f18f, 0xfcfba1, 0xf4f192, 0xf9f696, 0xfaf795, 0xf9f58f, 0xf5f189, 0xf4f085, 0xf8f487, 0xf3ee7d, 0xf9f27e, 0xf8ec79, 0xf2df6c, 0xf4de60, 0xf7e05b, 0xebc942, 0xeac642, 0xecc643, 0xe4bd3d, 0xe7c245, 0xeac549, 0xebc444, 0xe6b93c, 0xcd9921, 0xedc847, 0xf8de5b, 0xf1db63, 0xe0c759, 0xdec252, 0xe9cc58, 0xe6c956, 0xecd161, 0xf6dd6e, 0xf6dd74, 0xcfa952, 0xaf7a2e, 0xbd8c47, 0xc79b5b, 0xcea567, 0xd1a96e, 0xd2ad76, 0xcfab7a, 0xccab7d, 0xc4a579, 0xad906d, 0x886e4f, 0x614c2e, 0x4d3a1b, 0x46361b, 0x45361e, 0x443622, 0x3f3320, 0x3a301d, 0x362e1b, 0x312b19, 0x2e2718, 0x2c2417, 0x282114, 0x241f13, 0x221e13, 0x211d11, 0x1f1b11, 0x1f1b10, 0x1f190e, 0x1c160d, 0x1a160e, 0x19150c, 0x18150c, 0x14140d, 0x12130b, 0x11120a, 0x111109, 0x101008, 0x101008, 0x0f0f08, 0x0e0d09, 0x0d0c08, 0x0d0d07, 0x0d0e06, 0x0c0c04, 0x090904, 0x090804, 0x080802, 0x080903, 0x060803, 0x060802, 0x050702, 0x040601, 0x040500, 0x030400, 0x020401, 0x020200, 0x020200, 0x010100, 0x010202, 0x010101, 0x000000, 0x010101, 0x010101, 0x020101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010102, 0x020201, 0x020200, 0x020201, 0x030201, 0x030400, 0x030500, 0x030500, 0x050601, 0x060701, 0x060802, 0x070802, 0x090803, 0x090904, 0x090a04, 0x0a0b05, 0x0c0d08, 0x0d0d08, 0x0e0e09, 0x0e0f07, 0x0e1106, 0x121206, 0x141208, 0x161309, 0x19150a, 0x191407, 0x2c2b29, 0x383c41, 0x2d343b, 0x2b3038, 0x393b3f, 0x4b4642, 0x3b332d, 0x1e1003, 0x2f190c, 0x301506, 0x4b2a14, 0x5f391b, 0x6a3f1e, 0x7c4e2a, 0x83562d, 0x7d4e27, 0x8e6038, 0x91653b, 0x7c512c, 0x674022, 0x563219, 0x3f1b03, 0x1c0000, 0x2f0000, 0x3c0000, 0x471400, 0x603e24, 0x755334, 0x956f46, 0x9b754b, 0xb38e63, 0xb3936b, 0x694a2d, 0x69492b, 0x6c4b2d, 0x6a492a, 0x6d4a28, 0x77512a, 0x83572c, 0x925e2c, 0xaa7034, 0xb07430, 0xb27123, 0xb7731f, 0xbd7820, 0xd09232, 0xe0ac3f, 0xe0b141, 0xd9a230, 0xdba12e, 0xe1a934, 0xe0a933, 0xe0a934, 0xe0a933, 0xdda737, 0xd8a539, 0xe8c14e, 0xf8e062, 0xedd151, 0xf1d24f, 0xf0ce4b, 0xf3d04f, 0xf1cf4d, 0xf3d251, 0xf4d554, 0xeed355, 0xf7e46a, 0xfaea72, 0xf0de66, 0xf7e670, 0xe1c34f, 0xdfbd46, 0xd7ba42, 0xe3d266, 0xf7f18d, 0xf9f79a, 0xf9f79c, 0xf6f499, 0xf7f69d, 0xf5f49b, 0xf6f39a, 0xf8f79a, 0xfafa99, 0xfaf691, 0xefe97f, 0xf5f193, 0xfbfda8, 0xf6f59b, 0xf9f79a, 0xf7f493, 0xf4f18a, 0xf7f38c, 0xf2ee85, 0xf2ed83, 0xf5f082, 0xf3eb79, 0xf8f17c, 0xf4e873, 0xe8d45e, 0xefd856, 0xf5d951, 0xf1d04d, 0xf1cf4f, 0xeac64c, 0xe4be45, 0xe0b643, 0xcd9f33, 0xc28e1b, 0xe3b940, 0xebcb50, 0xe0c34a, 0xdec353, 0xf2db6f, 0xfbe87c, 0xf4df74, 0xe0c258, 0xd2ab3c, 0xdeb744, 0xebc756, 0xe8be59, 0xb47d2d, 0xac7325, 0xb4802f, 0xb48435, 0xb5863f, 0xbf9555, 0xcfa86c, 0xd5b079, 0xd6b280, 0xd1b085, 0xccac83, 0xc0a37a, 0xad936f, 0x8f7858, 0x6c573c, 0x4b3923, 0x35260f, 0x322611, 0x332b19, 0x322b19, 0x302818, 0x2b2217, 0x282015, 0x251e13, 0x231d13, 0x211d12, 0x211b11, 0x201c10, 0x20190f, 0x1c160c, 0x1a160c, 0x19150c, 0x17140c, 0x14140b, 0x11120a, 0x12120a, 0x111109, 0x101008, 0x0f0f08, 0x0e0e09, 0x0c0d08, 0x0c0b07, 0x0c0b07, 0x0b0c06, 0x0b0b03, 0x090804, 0x080704, 0x080703, 0x070803, 0x050702, 0x050802, 0x060701, 0x040601, 0x040500, 0x030400, 0x020300, 0x020200, 0x020201, 0x010100, 0x020202, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x020101, 0x030201, 0x030200, 0x030201, 0x030301, 0x030300, 0x040401, 0x040502, 0x050602, 0x060702, 0x070802, 0x070903, 0x070802, 0x090a04, 0x080a04, 0x0a0a05, 0x0c0b06, 0x0c0d07, 0x0f0e09, 0x131009, 0x100d03, 0x151309, 0x151309, 0x17130a, 0x1a150b, 0x1b170b, 0x1e1c17, 0x333537, 0x2f353c, 0x303239, 0x454241, 0x3c342d, 0x221407, 0x311f12, 0x2e1809, 0x361e0f, 0x4f311c, 0x4e2e16, 0x4c2e17, 0x492913, 0x452711, 0x452511, 0x44220d, 0x46210b, 0x42200c, 0x42220f, 0x4b301f, 0x624936, 0x6b5240, 0x755a47, 0x94785b, 0xb59875, 0xbea078, 0xa4835e, 0x9d7951, 0x9c7a52, 0x94724c, 0x83623e, 0x6a4421, 0x764e28, 0x784f27, 0x7f5326, 0x8b5c29, 0x925d28, 0x955b23, 0x9b5c21, 0x9d5c1b, 0xa7651f, 0xb57224, 0xb87526, 0xb77523, 0xd69b3a, 0xd69d33, 0xd0962d, 0xdb9f32, 0xdca534, 0xdfaa39, 0xdeaa3a, 0xe3b140, 0xebbd4a, 0xefc452, 0xdba83e, 0xc3912a, 0xefcc54, 0xf4d655, 0xf2d351, 0xedca49, 0xf0cc4c, 0xefcd4c, 0xf0cf50, 0xf2d554, 0xf6e268, 0xfbef7a, 0xfaef79, 0xf7e970, 0xf6e66e, 0xf4e471, 0xf9ec7a, 0xf3e980, 0xf5f08f, 0xf6f497, 0xf6f49b, 0xfaf9a5, 0xf9f9a5, 0xf6f5a0, 0xf4f39e, 0xf9f8a9, 0xf8f7a6, 0xf5f499, 0xf6f392, 0xf5f18a, 0xf7f599, 0xfbfcaa, 0xfafaa3, 0xf8f79b, 0xf3f190, 0xf4f28e, 0xf9f795, 0xf9f798, 0xf8f48f, 0xeee67a, 0xefe573, 0xf2eb76, 0xf3e975, 0xf5e46b, 0xf8e25b, 0xf3da51, 0xeccf4a, 0xeed14e, 0xecce4c, 0xf3d453, 0xf5d757, 0xf3d459, 0xeccd54, 0xf0d458, 0xf5de64, 0xf8e36e, 0xe4c763, 0xa1741e, 0xc2a14c, 0xe2c768, 0xf2da74, 0xf3da73, 0xe1c260, 0xcea749, 0xb9852d, 0xa96f1a, 0xb78d43, 0xe7cb73, 0xebce70, 0xdfbc61, 0xcea752, 0xc19646, 0xb68843, 0xbe9359, 0xd1ab74, 0xdab57f, 0xdbb784, 0xd4b181, 0xcba97d, 0xbd9c76, 0xae8f6e, 0x907559, 0x6e5842, 0x4a3a27, 0x2f2411, 0x241b0a, 0x271e12, 0x272014, 0x261f15, 0x251e14, 0x241e13, 0x221d11, 0x211c10, 0x20190f, 0x1d170c, 0x1a160b, 0x18150b, 0x17140c, 0x15130b, 0x12120a, 0x111109, 0x0f1008, 0x0f0f08, 0x0e0f09, 0x0e0e09, 0x0c0d08, 0x0b0b06, 0x0b0b07, 0x0c0a06, 0x0a0a03, 0x0a0904, 0x090804, 0x080804, 0x060803, 0x060702, 0x040601, 0x040601, 0x040500, 0x030400, 0x020400, 0x030400, 0x030300, 0x020201, 0x020101, 0x010101, 0x010101, 0x010101, 0x010000, 0x000101, 0x000101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x020100, 0x020200, 0x030200, 0x030300, 0x030301, 0x030301, 0x040302, 0x040402, 0x050503, 0x060802, 0x060802, 0x070902, 0x060802, 0x090904, 0x090904, 0x0a0a05, 0x0b0c06, 0x0d0d08, 0x0e0d08, 0x1e1811, 0x3e372f, 0x1e150c, 0x161209, 0x18130b, 0x19140c, 0x19160a, 0x18150b, 0x2e3030, 0x34373d, 0x3c3b3e, 0x3a332d, 0x2d2014, 0x2e1f12, 0x2c1a0d, 0x301e11, 0x372314, 0x352110, 0x311d0c, 0x2e1906, 0x2f1806, 0x301c0e, 0x352013, 0x382318, 0x3f2a1e, 0x412c20, 0x644e3c, 0x856b52, 0x93785b, 0x947960, 0x785c47, 0x785b42, 0x785a3d, 0x674222, 0x673a13, 0x6c3c10, 0x744517, 0x774816, 0x825422, 0x8a5d2c, 0x976a36, 0xab7e44, 0xbe8e4e, 0xb68042, 0xa36729, 0xa56829, 0xa56521, 0xab6821, 0xaa6820, 0xac6b22, 0x9a5c18, 0x965614, 0xb07529, 0xc18731, 0xc3882f, 0xd59b39, 0xdca740, 0xdcaa40, 0xd5a039, 0xd8a339, 0xdba63c, 0xd59c34, 0xc18220, 0xb47319, 0xbb8222, 0xdbb143, 0xebc853, 0xf0ce52, 0xf1d154, 0xf3d557, 0xf3d457, 0xf4d95b, 0xf4dd63, 0xf8e169, 0xf7e068, 0xf1da61, 0xf1de64, 0xfaee7b, 0xefe478, 0xfaf894, 0xf2ef8c, 0xf6f594, 0xf7f69d, 0xf8f8a9, 0xf7f8aa, 0xf8f7a4, 0xf7f5a4, 0xfcfcb5, 0xfbfcb3, 0xf4f49e, 0xf5f393, 0xf5f18a, 0xf9f797, 0xfbfca8, 0xf2f19c, 0xfbfaa5, 0xfafaa0, 0xfbfa9b, 0xf5f395, 0xfbf99d, 0xf8f48b, 0xf3ea78, 0xf1e774, 0xf2ea77, 0xf4eb78, 0xf3e267, 0xf6e15c, 0xf7e05c, 0xf1d755, 0xf5dd5c, 0xf3da5c, 0xf3d85a, 0xeed253, 0xf5db5c, 0xf1d85a, 0xf3dc61, 0xf2dc69, 0xd0b151, 0xc9a74c, 0xd7b85c, 0xdbbc5f, 0xd9b555, 0xcea746, 0xd6b353, 0xedcf69, 0xf5da72, 0xefcd67, 0xe1b755, 0xeaca6a, 0xfae882, 0xefd975, 0xe9ce6c, 0xefd372, 0xefd170, 0xe0bd61, 0xbd903f, 0xa56f21, 0xc08d46, 0xd1a25f, 0xd0a468, 0xdab076, 0xd7b079, 0xcfa676, 0xbc966c, 0xae8a68, 0xa48367, 0x8e745b, 0x725e48, 0x4e3d2c, 0x271b0a, 0x180f00, 0x1d1508, 0x231c11, 0x231e12, 0x221c10, 0x1f1a0e, 0x1b170d, 0x1b170e, 0x19160c, 0x18150c, 0x17130c, 0x15120b, 0x11100a, 0x0e0e08, 0x0e0f08, 0x0e0f09, 0x0c0d08, 0x0c0c07, 0x0b0a06, 0x0b0a06, 0x0a0905, 0x090804, 0x090804, 0x090703, 0x080804, 0x060802, 0x050601, 0x040600, 0x040500, 0x040500, 0x040400, 0x020300, 0x030400, 0x030301, 0x020200, 0x020201, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x020100, 0x020100, 0x020201, 0x030200, 0x040301, 0x040302, 0x040402, 0x050502, 0x060702, 0x070802, 0x060902, 0x070802, 0x090904, 0x090a05, 0x0a0b06, 0x0b0b06, 0x0c0d08, 0x0e0d08, 0x1a140c, 0x332c23, 0x1f150b, 0x171109, 0x16130c, 0x17140c, 0x17130a, 0x161307, 0x292925, 0x3f3f41, 0x3e3935, 0x2f2419, 0x2f2115, 0x2d2014, 0x26180c, 0x27180d, 0x2c1d11, 0x2d1f15, 0x342820, 0x40352e, 0x4a3e36, 0x312219, 0x4b3c31, 0x5c4b3c, 0x5a4537, 0x574030, 0x533927, 0x50311b, 0x4a2100, 0x461600, 0x4f2000, 0x5b2d04, 0x6a3d15, 0x815327, 0x96693a, 0x9e6f3e, 0xa6753f, 0xba8b50, 0xc19255, 0xc49659, 0xc09254, 0xb38246, 0xad793e, 0xb47b3f, 0xbe8037, 0xc07c2f, 0xbc7627, 0xb87424, 0xb97525, 0xa56218, 0x804000, 0x81460d, 0x7f4109, 0x8a4d10, 0x965817, 0xa2651e, 0xb47e2d, 0xc18c31, 0xc69030, 0xcb922f, 0xc68a28, 0xbf7f1e, 0xa8640a, 0x9c5b0d, 0xa96e15, 0xbe8f30, 0xcea63e, 0xd9b242, 0xddb542, 0xeac34b, 0xe7bf46, 0xe8c148, 0xe8c046, 0xdeb139, 0xd7a72f, 0xe6be45, 0xf5d962, 0xd5b74c, 0xcdb24d, 0xfaf58c, 0xf6f48a, 0xf1ef89, 0xfaf8a0, 0xfafaae, 0xf9f9b2, 0xf5f4a9, 0xf5f3a5, 0xf9faaf, 0xf9faaf, 0xf8f9a3, 0xf7f596, 0xfaf58d, 0xf2e47c, 0xfcf7a0, 0xf8f7a5, 0xf5f6a3, 0xf7f8a3, 0xf7f699, 0xf4f18e, 0xf5f28f, 0xf3ee84, 0xf2ea7a, 0xf0e878, 0xf2eb7c, 0xf7ea78, 0xe9ce53, 0xf6de5c, 0xf8e362, 0xf4de5f, 0xf1dd5f, 0xf1dd61, 0xf8e164, 0xf1d658, 0xefd153, 0xf3d758, 0xf3db61, 0xe6cb5c, 0xc19333, 0xefd369, 0xf8e372, 0xf6df6c, 0xf9df6a, 0xf7d865, 0xebcc5e, 0xe2c359, 0xdcba52, 0xe3ba4f, 0xd39e37, 0xd8ab42, 0xf7e175, 0xf3e281, 0xedd879, 0xf4e180, 0xf4df7c, 0xecd370, 0xefd170, 0xdcba63, 0xb27f30, 0xb97b26, 0xc08330, 0xc1883c, 0xc69451, 0xcf9e62, 0xcb9e69, 0xc19769, 0xb48d67, 0xa88564, 0xa58567, 0x9c7f64, 0x8d7459, 0x77614a, 0x564536, 0x392d20, 0x1e1505, 0x140d00, 0x191409, 0x1a170c, 0x1a170e, 0x17150a, 0x18160a, 0x16140b, 0x15120b, 0x121109, 0x0e0f08, 0x0d0e08, 0x0c0e08, 0x0d0c07, 0x0c0c07, 0x0a0a06, 0x0a0905, 0x090804, 0x080803, 0x080703, 0x080703, 0x080803, 0x070803, 0x050701, 0x040500, 0x040500, 0x040500, 0x030400, 0x020300, 0x020300, 0x030301, 0x020200, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x020200, 0x020100, 0x010101, 0x030301, 0x040302, 0x040402, 0x040402, 0x050503, 0x060702, 0x060902, 0x060902, 0x070802, 0x090a03, 0x090a04, 0x0a0a05, 0x0a0b06, 0x0d0c07, 0x0e0e09, 0x110f08, 0x110b03, 0x161107, 0x16120a, 0x16130c, 0x16120b, 0x171309, 0x161205, 0x2b2721, 0x484440, 0x393029, 0x332921, 0x302924, 0x352f2a, 0x3a322c, 0x3c322c, 0x3d332c, 0x463d35, 0x4d4238, 0x514439, 0x4a3b30, 0x3f2c1a, 0x493018, 0x553618, 0x563410, 0x5a3613, 0x664220, 0x79532d, 0x886138, 0x946d45, 0xa57e54, 0xa87f52, 0xa6794a, 0xb08350, 0xad804d, 0x9e6e3c, 0x93602b, 0x8e5b25, 0x86521c, 0x7b4407, 0x874e15, 0xb37a3b, 0xba7b39, 0xae6621, 0xb36818, 0xb96e1d, 0xbd7322, 0xb87320, 0xb26d1d, 0xb0721d, 0xd2a94b, 0xa77327, 0x844607, 0x814a15, 0x976326, 0xb57f35, 0xcb963b, 0xd6a13e, 0xdca63d, 0xe4ae3e, 0xe5b03e, 0xe9b845, 0xd8a537, 0xc59733, 0xe0bf56, 0xefd15b, 0xf3d75b, 0xf4d55a, 0xedc74d, 0xedc54b, 0xe9c147, 0xeac249, 0xebc54a, 0xedc54b, 0xe4b742, 0xcd9d31, 0xce9e2f, 0xcca032, 0xd3af42, 0xf0df6e, 0xf9f384, 0xf5f186, 0xf4f08e, 0xfaf9a6, 0xfcfcb7, 0xfdfeba, 0xfbfcb3, 0xf6f8a8, 0xf7f9a3, 0xf7f79c, 0xf9f793, 0xf7e879, 0xd5b140, 0xe1c768, 0xfaf499, 0xfbf9a2, 0xf3f39a, 0xf3f193, 0xeeea8b, 0xf1ee8e, 0xf7f294, 0xf7f08c, 0xfbf489, 0xfbf181, 0xead05e, 0xe9c349, 0xf4d75a, 0xf7df62, 0xefd95d, 0xf5e065, 0xf2dd62, 0xebcf54, 0xeacb4f, 0xebca4e, 0xf3d759, 0xf3dc60, 0xf1d765, 0xcda039, 0xf8dc66, 0xf5e16c, 0xf2dc66, 0xf1d45f, 0xeed15d, 0xebd25e, 0xf1d867, 0xf2d96a, 0xebca5d, 0xcb9937, 0xd69d2f, 0xeec953, 0xf4de72, 0xf4e482, 0xedde7f, 0xf4e485, 0xf1df7f, 0xecd472, 0xf1d775, 0xe3c168, 0xaf7b31, 0xb17024, 0xba782b, 0xb47226, 0xa96a24, 0xa66c2e, 0xae7c48, 0xb18353, 0xa98157, 0xa98661, 0xb69572, 0xb59773, 0xb19676, 0xa38b70, 0x927c65, 0x725f4e, 0x55473c, 0x33291f, 0x000000, 0x000000, 0x000200, 0x161407, 0x171409, 0x151209, 0x111108, 0x0f0f08, 0x0c0e08, 0x0c0d08, 0x0c0d08, 0x0c0c07, 0x0a0b06, 0x090903, 0x080903, 0x080903, 0x080703, 0x080803, 0x070803, 0x070802, 0x050701, 0x050601, 0x040500, 0x030400, 0x020400, 0x020300, 0x020200, 0x010100, 0x020200, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000001, 0x000000, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x010100, 0x020200, 0x020100, 0x010101, 0x030201, 0x030301, 0x040401, 0x040401, 0x050502, 0x050701, 0x060901, 0x060902, 0x060802, 0x080803, 0x090804, 0x0a0904, 0x0a0b05, 0x0c0b06, 0x0d0c08, 0x100f08, 0x121008, 0x151109, 0x15110a, 0x14110b, 0x14110a, 0x161309, 0x1b160b, 0x20190c, 0x31291f, 0x5e564c, 0x4c463e, 0x49413b, 0x3e3730, 0x3b3028, 0x392b20, 0x39291e, 0x402d1c, 0x4a341f, 0x543c23, 0x5d442c, 0x71573b, 0x8b6e4d, 0x977956, 0x9b7b56, 0xa48159, 0xa98359, 0xa67e52, 0xa3784a, 0x9e7345, 0x996d3f, 0x916235, 0x805024, 0x714114, 0x744011, 0x784214, 0x7b4619, 0x723d11, 0x6b3508, 0x885121, 0xba7d3d, 0xb56f2a, 0xa5550a, 0xaa5c14, 0xbb7223, 0xb86f20, 0xaf6717, 0xb06c19, 0xb9832c, 0xe3c45d, 0xebca62, 0xa87222, 0xcf9c46, 0xe0ad4c, 0xe3ad44, 0xe2a93b, 0xdca433, 0xdba433, 0xdaa22f, 0xe4ae39, 0xdeab34, 0xeac14b, 0xe8c44e, 0xf0d157, 0xe8ca4e, 0xecce4e, 0xf1d454, 0xeccb4a, 0xedc647, 0xebc346, 0xedc548, 0xeac54a, 0xedca4f, 0xedc84d, 0xedc84d, 0xe9c550, 0xe9c951, 0xf8e269, 0xeed35f, 0xd6ae3d, 0xf0d667, 0xf0e172, 0xf1e97c, 0xf6f392, 0xf9f8a6, 0xfafcb0, 0xfbfdb0, 0xfcfca8, 0xf9f698, 0xf8f18c, 0xf2df73, 0xd5b148, 0xa97204, 0xc79529, 0xe3be50, 0xeed56d, 0xf1e17e, 0xf4e989, 0xf8f090, 0xf8f394, 0xf8f296, 0xf4ea87, 0xe8d86e, 0xd6b94f, 0xae801c, 0xdab145, 0xf1d158, 0xf2d75a, 0xf3dd5e, 0xf0da5e, 0xf1db61, 0xf3d95f, 0xefd55a, 0xf0d659, 0xecd255, 0xf9e568, 0xe8ca5c, 0xa56a0a, 0xddb243, 0xfae36e, 0xf3df6d, 0xedd565, 0xeed869, 0xf4e073, 0xf3e175, 0xf4e277, 0xf4df75, 0xe9cc6b, 0xbf8f3a, 0xdba737, 0xeac149, 0xf5e074, 0xfaee8b, 0xf0e284, 0xf1e082, 0xefd979, 0xefd875, 0xead06d, 0xdab764, 0x925d26, 0x905317, 0x9d5f23, 0x9f6126, 0x9c5f25, 0x95591f, 0x864e14, 0x8a5722, 0x8a5d2c, 0x9f774d, 0xb1916a, 0xb49976, 0xa98f70, 0xa68c71, 0x99826b, 0xa18f7c, 0xa49483, 0xa39687, 0x807569, 0x52483d, 0x060000, 0x0c0900, 0x14130b, 0x101009, 0x0d0d08, 0x0c0c08, 0x0c0c07, 0x0c0c07, 0x0b0b06, 0x0a0a05, 0x090803, 0x080903, 0x080902, 0x080803, 0x070803, 0x070802, 0x060802, 0x050701, 0x040600, 0x040500, 0x030400, 0x030400, 0x020300, 0x020200, 0x020100, 0x020100, 0x010100, 0x010000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x030301, 0x030301, 0x040500, 0x040500, 0x040601, 0x040701, 0x050802, 0x050802, 0x060902, 0x070903, 0x0a0a05, 0x0a0a04, 0x090a04, 0x0b0b05, 0x0d0c07, 0x0e0e06, 0x101007, 0x121007, 0x141008, 0x121008, 0x131108, 0x161209, 0x1c180d, 0x221b0b, 0x2f2818, 0x6d655c, 0x6d6760, 0x534b43, 0x43382e, 0x413429, 0x443124, 0x462e1d, 0x4d311b, 0x4f2e15, 0x694a30, 0x97795a, 0xa0815e, 0x967654, 0x856544, 0x73502f, 0x7a522c, 0x7b4f25, 0x794a1f, 0x7f4f24, 0x7f5128, 0x76471f, 0x70411b, 0x6b3814, 0x733b14, 0x783d11, 0x7d3f11, 0x854817, 0x793f12, 0x71380d, 0x9a5c26, 0xa45e1e, 0xa1540f, 0xa85b19, 0xa55917, 0xb0681f, 0xbd792a, 0xc07f2b, 0xd3a045, 0xe9c561, 0xd3b256, 0x93611d, 0xb1752b, 0xd69b3b, 0xcc8d27, 0xd4972f, 0xd3972d, 0xd79c2f, 0xe1ac39, 0xe1ad38, 0xe5b63e, 0xe9bd48, 0xe4bc49, 0xf1d359, 0xe4c347, 0xe8c447, 0xebc645, 0xecc646, 0xebc443, 0xe6bc3f, 0xe7bf43, 0xe9c448, 0xedcd52, 0xf4d759, 0xefcd51, 0xe9c64b, 0xf6de64, 0xf8e369, 0xf8e267, 0xf0d25b, 0xc48f27, 0xcd972b, 0xe4bd4d, 0xecd164, 0xf4e47c, 0xf8ee8e, 0xf7ed91, 0xf6ea8e, 0xeddd7f, 0xe6cf68, 0xe0c153, 0xd1a93e, 0xbf9027, 0xc89c37, 0xbc8b22, 0xc08b21, 0xc8962d, 0xc7972c, 0xc7a138, 0xe9d56a, 0xf3e67b, 0xf1e377, 0xeddb6c, 0xefda66, 0xe8ce5f, 0xceae4e, 0xb08831, 0xc79c39, 0xe9c24e, 0xf1d356, 0xedd356, 0xedd257, 0xe9cf53, 0xf0d85c, 0xf3dd61, 0xf6e267, 0xf4da62, 0xc39739, 0x823800, 0xbd811a, 0xecc955, 0xfbe875, 0xf6e578, 0xfaed86, 0xf1e580, 0xf9ed87, 0xf2e581, 0xf2e37e, 0xf5e07a, 0xedcf6e, 0xc4973d, 0xd39d29, 0xd9b045, 0xefd974, 0xfaec88, 0xf7ea8a, 0xe5d377, 0xe6d074, 0xebd372, 0xe9cb6c, 0xc4a15a, 0x6d3700, 0x622b00, 0x5e2400, 0x632c00, 0x814c24, 0x905e39, 0xa07450, 0xb38a64, 0xba926d, 0xb4906e, 0xb59575, 0xad9275, 0xa3896e, 0x9f886e, 0x9d8871, 0xa18f7c, 0xc3b5a3, 0xd2c4b1, 0xc6b6a4, 0xaea093, 0x4e4740, 0x000000, 0x0f0f0a, 0x0d0d08, 0x0c0c07, 0x0c0c08, 0x0c0c08, 0x0b0b06, 0x0a0a05, 0x080903, 0x080903, 0x080902, 0x080903, 0x070802, 0x080903, 0x050802, 0x040601, 0x040400, 0x030400, 0x020400, 0x030500, 0x020400, 0x020200, 0x020200, 0x020200, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x010100, 0x020200, 0x020200, 0x020201, 0x030300, 0x040500, 0x040500, 0x040600, 0x040801, 0x060802, 0x050801, 0x060903, 0x070903, 0x090904, 0x090904, 0x0a0904, 0x0b0b06, 0x0d0d07, 0x0e0e07, 0x0f0e08, 0x130e07, 0x131007, 0x141207, 0x151208, 0x16140a, 0x1a170d, 0x1f1a0d, 0x251d0f, 0x47443f, 0x51504e, 0x666461, 0x65615d, 0x504943, 0x4a3c32, 0x4f392c, 0x563924, 0x5f3c24, 0x5e381e, 0x603716, 0x6e421c, 0x70441e, 0x744822, 0x784e26, 0x7c4f25, 0x815228, 0x845328, 0x7e4c20, 0x744117, 0x7f4a1d, 0x894b1a, 0x8b4615, 0x894410, 0x924f17, 0x98541c, 0x8d4917, 0x894a17, 0x9e652c, 0x632500, 0x874414, 0x934810, 0x90430b, 0x90470c, 0x995111, 0xa25a14, 0xad6b20, 0xc08833, 0xbc862e, 0xa76e1f, 0x975a12, 0xc2822c, 0xb16f0e, 0xc98b26, 0xce9228, 0xd5982c, 0xdba233, 0xdaa634, 0xdeaf3d, 0xe3b747, 0xd8a940, 0xc39432, 0xeecf56, 0xe7c446, 0xe0b63a, 0xdfb337, 0xe3b83d, 0xdeb33a, 0xe6bf44, 0xf2d252, 0xf0d254, 0xf4d75b, 0xf1d557, 0xf3d658, 0xedd054, 0xf8e168, 0xf0d65c, 0xeed156, 0xedce57, 0xddb449, 0xab7213, 0xb97e17, 0xcc9427, 0xdaaa3b, 0xdcb244, 0xd6ad40, 0xd2ac40, 0xd0ac43, 0xcda944, 0xcca846, 0xd3b14d, 0xebd067, 0xfcea7c, 0xf3da6b, 0xc39428, 0xa06600, 0xa97c23, 0xe8d065, 0xfaec79, 0xf7e974, 0xf8ea72, 0xf7e86e, 0xf1dc60, 0xf2dc5e, 0xf6dd61, 0xf5dc67, 0xdaba54, 0xc0922c, 0xd4a332, 0xeac047, 0xf1cc51, 0xf0ce52, 0xf3d458, 0xf4d65e, 0xedcc57, 0xd5a83d, 0xbd8729, 0xa96b19, 0x9b5a0a, 0xd6a433, 0xe0c153, 0xf0de76, 0xfef590, 0xf7ef8d, 0xece07f, 0xf0e480, 0xf0e380, 0xf5e781, 0xf0da70, 0xecce61, 0xcaa142, 0xa86c00, 0xad7b27, 0xceaf5e, 0xefdb81, 0xf8e78a, 0xecdb80, 0xf6e287, 0xe8cb70, 0xdebc6b, 0xc09754, 0xa27d52, 0x9c7a5e, 0xb28e70, 0xc49c7b, 0xcba37f, 0xcba581, 0xc8a583, 0xc8a685, 0xc9a786, 0xc5a586, 0xbfa387, 0xbba58d, 0xc2b09a, 0xc6b5a2, 0xc0ae9c, 0xbbab9a, 0xad9d8d, 0x958172, 0x928071, 0x5c5248, 0x000000, 0x100f0a, 0x0e0d08, 0x0d0d08, 0x0c0c07, 0x0b0c07, 0x0c0b07, 0x0b0b06, 0x080903, 0x080903, 0x080902, 0x070802, 0x080902, 0x070903, 0x050801, 0x040601, 0x030400, 0x020400, 0x030400, 0x030500, 0x020300, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x020200, 0x020200, 0x010100, 0x020200, 0x030300, 0x030400, 0x030401, 0x030500, 0x050601, 0x060701, 0x060701, 0x060802, 0x070904, 0x080904, 0x0a0a05, 0x0a0905, 0x0b0a05, 0x0d0c07, 0x0f0d08, 0x130f07, 0x150f05, 0x160f05, 0x151005, 0x161208, 0x17140b, 0x19160e, 0x1c180d, 0x211c0c, 0x31322c, 0x363a3d, 0x34373b, 0x4f5052, 0x626161, 0x54514e, 0x453931, 0x5b483b, 0x5b402d, 0x5c3c25, 0x5e391e, 0x663d1e, 0x6f4321, 0x754922, 0x7b4f26, 0x78481f, 0x76441b, 0x764319, 0x794116, 0x965927, 0xaf6c2d, 0xaa6422, 0xa05517, 0xa05617, 0xa7601f, 0x9d571a, 0x803500, 0xb9883c, 0xc5923d, 0x6a3003, 0x743611, 0x8d4713, 0x924911, 0xa05b1d, 0xa7601c, 0xac621a, 0xb06619, 0xa9610a, 0xb87d23, 0xcf9f3d, 0xb27e2c, 0xb27827, 0xc6933a, 0xcb9c3c, 0xcc9c36, 0xd19e37, 0xd5a439, 0xdbac41, 0xd3a33e, 0xc0882a, 0xaa680c, 0xa76b18, 0xe9c04d, 0xebc243, 0xd7a72d, 0xd9aa35, 0xe0b33d, 0xe2ba40, 0xeacb4d, 0xebce50, 0xecd050, 0xedcf51, 0xedce4e, 0xefd355, 0xf5db61, 0xf1d65e, 0xedd056, 0xf6dd64, 0xf7e26b, 0xfbe573, 0xe7c961, 0xbd8e2d, 0xac7208, 0xb1770e, 0xaf7e22, 0xdabe5f, 0xf1e07a, 0xf6e77f, 0xf7e981, 0xf7e981, 0xf0e17a, 0xf0e37c, 0xf4e87b, 0xf7e573, 0xe6c856, 0xbe932d, 0xd7bc58, 0xfaeb77, 0xf5e570, 0xf3e166, 0xf5e567, 0xf8ea6d, 0xebd459, 0xecd254, 0xf1da5a, 0xf0db5e, 0xf8e268, 0xeed465, 0xba8d32, 0xba7c16, 0xc68d23, 0xcd982f, 0xd3a038, 0xcb9a36, 0xc18f2d, 0xdcb140, 0xecc24b, 0xe3b13e, 0xb97f1f, 0xc89a39, 0xddba4d, 0xab852d, 0xddc970, 0xfbf392, 0xfbf28f, 0xf1e683, 0xf4e886, 0xf6e987, 0xead76e, 0xf0da67, 0xf4dc6f, 0xbf9c4d, 0x844800, 0x7b3e00, 0x91672d, 0xbb9f5f, 0xe1c87f, 0xe8cc84, 0xddbb7a, 0xd8b37c, 0xd4ad7b, 0xd1ab80, 0xc8a480, 0xc8a784, 0xc9aa8b, 0xcbb091, 0xceb394, 0xcfb495, 0xcdb293, 0xaa8f72, 0xb49a80, 0xbda68e, 0xaa9682, 0x998776, 0x847162, 0x70594a, 0x6a4e3f, 0x6a4f41, 0x5c4034, 0x654d41, 0x382c23, 0x0b0b07, 0x11100b, 0x0e0e09, 0x0d0c07, 0x0d0c07, 0x0d0d07, 0x0d0c07, 0x0a0a05, 0x080803, 0x080903, 0x080802, 0x070902, 0x070a02, 0x060902, 0x060802, 0x050601, 0x030601, 0x030400, 0x030400, 0x020400, 0x020200, 0x020200, 0x020100, 0x010100, 0x000000, 0x000000, 0x000001, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x020200, 0x020200, 0x010100, 0x030200, 0x030300, 0x030301, 0x030401, 0x030500, 0x040601, 0x060701, 0x060701, 0x050901, 0x070904, 0x080904, 0x090904, 0x090904, 0x0b0b05, 0x0c0c06, 0x0f0e07, 0x141106, 0x1c1608, 0x221809, 0x1a1105, 0x181108, 0x16130b, 0x181610, 0x1b170e, 0x1e180a, 0x2f302b, 0x373b3d, 0x36393e, 0x34383f, 0x373a40, 0x49494b, 0x3e3c3b, 0x504841, 0x6a5d53, 0x624e40, 0x5d402c, 0x634028, 0x643d20, 0x693e1d, 0x724420, 0x7c4c25, 0x714220, 0x6a3815, 0x9e622d, 0xb46c2b, 0xbd722a, 0xa15617, 0x9f5717, 0xbb762e, 0xa55d17, 0x9e540d, 0xb9863a, 0xefc55b, 0xd3a241, 0x84460f, 0x77380b, 0x914f1b, 0xa86121, 0xb0671f, 0xb1691f, 0xb66e22, 0xbe7623, 0xbb7514, 0xd9ad44, 0xf1d366, 0xa27329, 0x602f08, 0x9e793c, 0xc29f53, 0xc7a450, 0xc29b48, 0xbe923e, 0xad7d2c, 0xa26c1d, 0xb37c2a, 0xc5862d, 0xb67019, 0xbe8225, 0xd9a438, 0xe7b43b, 0xe3b43a, 0xdeb33c, 0xddb63e, 0xedcf55, 0xf0d559, 0xf1d454, 0xeccc4e, 0xeecd53, 0xf0d15e, 0xeac957, 0xeacc53, 0xf4df64, 0xf6e269, 0xf5e36b, 0xf7ea79, 0xf9e978, 0xf4d966, 0xe1bd4d, 0xbf932d, 0xe2cb6d, 0xfcf48d, 0xf6f086, 0xf7f187, 0xfaf68e, 0xf9f58e, 0xf5ee88, 0xf5ea81, 0xeedf75, 0xeedb6e, 0xf4de69, 0xe6c857, 0xedd96a, 0xfbee77, 0xf1e06a, 0xedd65a, 0xf5e061, 0xf9e769, 0xfbe86c, 0xf3de60, 0xf7e463, 0xf0d95c, 0xeed85e, 0xf5e26a, 0xf3db69, 0xdfb647, 0xcb9d31, 0xcca23b, 0xc9a03c, 0xd2ac45, 0xe8c650, 0xf7da5c, 0xe8c94d, 0xe2be44, 0xeac044, 0xdeb840, 0xf3d767, 0x916726, 0x946415, 0xc1a452, 0xead97e, 0xf4e888, 0xf4e989, 0xf9ee8e, 0xf5e47d, 0xead269, 0xefd674, 0xe4c06f, 0xbe9059, 0xb88a5e, 0xc89b6e, 0xc4986b, 0xc29767, 0xc9a071, 0xd1ac7f, 0xd6b58d, 0xdabd98, 0xdcc3a2, 0xdec9ab, 0xdfccb0, 0xceb89b, 0xae987d, 0x947f66, 0x987e65, 0x6f543c, 0x6f5645, 0x8e7360, 0x674a34, 0x644631, 0x684b38, 0x6c5141, 0x6e5344, 0x725747, 0x735748, 0x604436, 0x6b5448, 0x3a2f27, 0x0b0a06, 0x100f0a, 0x0f0f0a, 0x0d0e08, 0x0d0d08, 0x0d0c08, 0x0c0c06, 0x0a0905, 0x090803, 0x080903, 0x070801, 0x070902, 0x060903, 0x060701, 0x060702, 0x050701, 0x040701, 0x030301, 0x020400, 0x020300, 0x020300, 0x020200, 0x010101, 0x010101, 0x000000, 0x000000, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020201, 0x020201, 0x010100, 0x020200, 0x030300, 0x030400, 0x030400, 0x030600, 0x040701, 0x060701, 0x060701, 0x050802, 0x070903, 0x080a04, 0x090a04, 0x090903, 0x0a0a04, 0x0c0b06, 0x0d0e05, 0x101104, 0x181606, 0x201807, 0x1d1708, 0x18140a, 0x15140d, 0x15140f, 0x18150c, 0x181507, 0x33332e, 0x3a3d3e, 0x363c3f, 0x3a3d43, 0x36393f, 0x3c3e43, 0x4c4c4c, 0x383734, 0x4e4a47, 0x5a514d, 0x594c43, 0x5f4a3b, 0x654833, 0x67462a, 0x6d4423, 0x794d28, 0x80542d, 0x9a693c, 0xa4662e, 0x995215, 0x9c5115, 0xa25514, 0xb77127, 0xb06820, 0xa3580f, 0xbc843a, 0xe4b753, 0xd0a03d, 0x9e651f, 0x834511, 0xa16122, 0x9f5c21, 0xab6621, 0xb46d22, 0xae661b, 0xa96215, 0xb77118, 0xc69436, 0xf1d76b, 0xd5b759, 0x733300, 0x440000, 0x380000, 0x400000, 0x4c1600, 0x582607, 0x6d3a0f, 0xa67d3a, 0xd9bb5d, 0xefc95d, 0xd1952e, 0xa45b0c, 0x8e4504, 0xa3631e, 0xc28830, 0xd4a037, 0xe4b743, 0xebc44e, 0xecc854, 0xe9c554, 0xe2bb4d, 0xd9af45, 0xcda03e, 0xae802d, 0xa67b2b, 0xf0d160, 0xfae66d, 0xf6e36a, 0xf2e068, 0xf7ea76, 0xf7e974, 0xf4e36c, 0xf8e268, 0xe8cc5a, 0xf8ed88, 0xf7f28d, 0xf1eb83, 0xf4ef87, 0xf6f28b, 0xf7f48c, 0xfaf690, 0xf2e981, 0xefe379, 0xefe176, 0xf3e172, 0xdfc459, 0xe0c65b, 0xfced73, 0xf0dc63, 0xe9cd55, 0xecd156, 0xefd85c, 0xf3e166, 0xf5e46a, 0xf3e065, 0xe9d359, 0xf0d95d, 0xf0da61, 0xf8e873, 0xf1d965, 0xedce5a, 0xf9df68, 0xfee871, 0xf9e56e, 0xf7e36c, 0xf6e06a, 0xf2d861, 0xf0d25d, 0xd9b344, 0xd3aa39, 0xcba646, 0x824d0f, 0x6c3300, 0x834d00, 0x9d7222, 0xb49853, 0xe3cd7e, 0xeed685, 0xe8c879, 0xd2a963, 0xd1a163, 0xce9c67, 0xd3a271, 0xcb9c6e, 0xcaa074, 0xc9a378, 0xc7a57c, 0xcbad86, 0xdec29e, 0xdcc6a4, 0xccb99b, 0xb2a189, 0x9d8b74, 0x836e58, 0x715a42, 0x63472f, 0x6b4f37, 0x6e523a, 0x462c19, 0x7d6351, 0x6d503d, 0x7a6455, 0x9d8574, 0x654a38, 0x684e3d, 0x705545, 0x775a4a, 0x65483a, 0x624639, 0x6c564a, 0x30261f, 0x0c0b05, 0x101009, 0x100f09, 0x0e0e08, 0x0e0e08, 0x0d0d06, 0x0c0c06, 0x0a0a05, 0x090904, 0x090903, 0x080a03, 0x070903, 0x070903, 0x060701, 0x060801, 0x040601, 0x040500, 0x030301, 0x020300, 0x020300, 0x020200, 0x020200, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x020302, 0x020202, 0x010100, 0x020200, 0x020200, 0x030400, 0x030500, 0x040700, 0x040700, 0x050701, 0x070702, 0x060802, 0x070803, 0x070a04, 0x080a04, 0x090a04, 0x0a0b05, 0x0b0c06, 0x0d0d06, 0x0e1004, 0x131204, 0x171205, 0x181509, 0x161409, 0x15130c, 0x14130c, 0x15120a, 0x131105, 0x2c2d28, 0x3c3d3d, 0x373b3f, 0x323439, 0x47494e, 0x4f5055, 0x4d4d4d, 0x333230, 0x3e3e3e, 0x3c3c3c, 0x353534, 0x494440, 0x564b41, 0x6a5644, 0x795d44, 0x7c5636, 0x80542e, 0x84552b, 0x8f5c2f, 0x925a2a, 0x8f4e1a, 0xa86422, 0xbe772e, 0xa35a14, 0xbd7c34, 0xca903d, 0xb67b27, 0x844704, 0x885023, 0xa86d2f, 0xb57b39, 0x955010, 0xb16f26, 0xb77629, 0xbb7726, 0xb4701f, 0xcea04a, 0xf7e281, 0xe9d375, 0xa57724, 0xb9903f, 0xa4762d, 0x9b6525, 0xa56e2b, 0xab732f, 0xb1772e, 0xb87e2d, 0xd4a349, 0xf3d569, 0xedca57, 0xe2ad3e, 0xbb7724, 0x8a3e01, 0x702500, 0x7a3c0e, 0x9a611e, 0xb17a2b, 0xbf8a33, 0xbc862f, 0xa7701c, 0x98600d, 0xa06a1d, 0x986622, 0x754106, 0x5e1a00, 0xa98031, 0xe4c357, 0xf5de68, 0xfded77, 0xfcef7a, 0xfaed74, 0xf6e368, 0xf5da5e, 0xdebe4d, 0xf5eb85, 0xf4f089, 0xf2ec85, 0xf8f389, 0xf4ef87, 0xefe97e, 0xf4ef87, 0xfbf793, 0xf3ea84, 0xf6eb81, 0xf4e77a, 0xf2dd70, 0xd5b550, 0xead060, 0xf6df66, 0xedd55b, 0xe9d15a, 0xf2df69, 0xf2e16d, 0xf7e875, 0xf1e06a, 0xf8e66e, 0xf4e066, 0xebd65e, 0xf7e773, 0xe6d16d, 0xa57824, 0xb6903e, 0xc0a34e, 0xc4aa53, 0xc9ae55, 0xc1a44e, 0xb39341, 0xac802a, 0xc0902f, 0xb58529, 0x9d6d2f, 0xcda15c, 0xd0a86c, 0xc59e68, 0xd2ab70, 0xd1a96d, 0xcda365, 0xc5975b, 0xc6975f, 0xc49560, 0xcb9d6f, 0xd6aa81, 0xcca47a, 0xcfad86, 0xdabc97, 0xdec59f, 0xd9c7a5, 0xd5c1a2, 0xa79279, 0x7f6952, 0x7d6954, 0x6f5947, 0x705844, 0x654c37, 0x6e5440, 0x694d38, 0x6e513b, 0x5f4530, 0x422d1d, 0x765e4c, 0x5c4436, 0x7a6454, 0x8b7262, 0x654936, 0x694d3c, 0x6d5040, 0x694c3d, 0x684b3f, 0x5d4236, 0x675246, 0x221913, 0x0d0e06, 0x101006, 0x101007, 0x0f0f09, 0x0e0e07, 0x0d0e05, 0x0d0d07, 0x0a0b05, 0x080904, 0x080903, 0x070a03, 0x070903, 0x070802, 0x050801, 0x050701, 0x040500, 0x030400, 0x020200, 0x030301, 0x020302, 0x010200, 0x030301, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010201, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010201, 0x020302, 0x020202, 0x010100, 0x020200, 0x020200, 0x030401, 0x030500, 0x030500, 0x040500, 0x040601, 0x060702, 0x060802, 0x060903, 0x060903, 0x080904, 0x090a04, 0x090b05, 0x0b0b06, 0x0d0c07, 0x0d0f06, 0x0e0f05, 0x0f0e05, 0x121108, 0x131109, 0x14110a, 0x14110a, 0x151209, 0x131005, 0x20201b, 0x3e3f3e, 0x393b3f, 0x323539, 0x393d40, 0x2f3035, 0x434343, 0x2d2c2a, 0x333332, 0x3f4042, 0x333639, 0x34383b, 0x3c3d3e, 0x4c4742, 0x726454, 0x877059, 0x866547, 0x855b35, 0x875931, 0x8f5f33, 0x945f31, 0x965c2a, 0x965723, 0x97551d, 0x9c5d1d, 0x935111, 0x8d4f1b, 0xa06834, 0xa0652e, 0x9a5b23, 0x93551f, 0x8d4908, 0xb06e22, 0xb77725, 0xb9792f, 0xc0873b, 0xe2be60, 0xe2cc77, 0xb28e42, 0xeacb60, 0xefcd5d, 0xd7a442, 0xc3862e, 0xc2842a, 0xc78c2e, 0xc6892b, 0xc98b2b, 0xc2821e, 0xc38c29, 0xe3ba4e, 0xe0b041, 0xc78829, 0xb16f21, 0xa16725, 0x88571d, 0x7d4511, 0x7b3b00, 0x6e2100, 0x7e5023, 0xad8f4f, 0xc7ac5e, 0xe3ca6a, 0xe8cf66, 0xe1c560, 0xc7a652, 0xa8823c, 0xaf7d20, 0xc5962c, 0xdbb64d, 0xe9cb5b, 0xecd05e, 0xeac753, 0xe1b547, 0xb88322, 0xe5d072, 0xf8f18a, 0xe9e179, 0xf3ec81, 0xfaf68d, 0xf4f088, 0xece77d, 0xf5f18b, 0xf4ef8b, 0xf1e882, 0xf6ec84, 0xf6e97d, 0xecd26a, 0xb68c34, 0xe4c259, 0xf8e06c, 0xf6e371, 0xf5e876, 0xf8ed7d, 0xf9ed7e, 0xf6ea79, 0xf5e675, 0xf2e06e, 0xe5d05f, 0xf4e474, 0xe9d072, 0x9c6017, 0x925301, 0x824400, 0x743900, 0x763d00, 0x8b5b1d, 0xac8140, 0xd2a656, 0xe0b45e, 0xd6ac62, 0xdfb772, 0xe4bd77, 0xe5c07d, 0xe5c281, 0xe0be82, 0xcdab72, 0xc5a775, 0xc8ab7f, 0xceaf85, 0xcdad88, 0xc6a684, 0x9d7f63, 0xc8aa89, 0xc2a989, 0xb49a7c, 0xa08468, 0x846e55, 0x866d57, 0x705a47, 0x5b4433, 0x5d4536, 0x695342, 0x6e5543, 0x684e3a, 0x745a46, 0x6e513c, 0x684c37, 0x523b29, 0x352315, 0x685244, 0x4f3b30, 0x483425, 0x583e2b, 0x674c3b, 0x6a4d3c, 0x624436, 0x6b4f41, 0x6f5346, 0x62473b, 0x685448, 0x140d04, 0x101107, 0x111207, 0x111109, 0x0f0f0a, 0x0d0e08, 0x0d0e04, 0x0c0d05, 0x0a0a05, 0x080904, 0x080904, 0x070903, 0x060802, 0x050701, 0x050600, 0x050601, 0x040500, 0x030400, 0x020200, 0x030301, 0x020202, 0x020200, 0x020200, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x020202, 0x030303, 0x020202, 0x020200, 0x020200, 0x020300, 0x030400, 0x030500, 0x030500, 0x030500, 0x050601, 0x050701, 0x050702, 0x050702, 0x050702, 0x070903, 0x080a04, 0x080903, 0x0a0a04, 0x0c0c07, 0x0d0e07, 0x0d0f06, 0x0d0e07, 0x0f0f09, 0x11100a, 0x130f09, 0x141107, 0x151306, 0x131306, 0x1c1a14, 0x3d3c3c, 0x46484b, 0x33383b, 0x34383d, 0x333438, 0x3a3a3a, 0x23221f, 0x2d2d2c, 0x393b3e, 0x393d41, 0x383c40, 0x34383b, 0x36393b, 0x424241, 0x5f5952, 0x807163, 0x816951, 0x886543, 0x8e6339, 0x936539, 0x8f5f31, 0x9c6937, 0xa06b38, 0x875125, 0x723b15, 0x8d5423, 0x8f531e, 0x9e5d1f, 0x985311, 0xa0601c, 0xa2621d, 0xb27228, 0xba7d34, 0xab6f2c, 0xaf7937, 0xb28643, 0xab8239, 0xe8c65d, 0xdebc53, 0xbb8e35, 0xb87f29, 0xb57522, 0xb57821, 0xc78c2f, 0xc28526, 0xc98c2c, 0xcf9632, 0xbf801f, 0xcb9d3d, 0xeac14e, 0xe5b542, 0xe0b045, 0xe0b249, 0xe7c054, 0xe7c45d, 0xe1be57, 0xcaa74d, 0xe7d274, 0xf7e67b, 0xf6e374, 0xf4df6c, 0xf2da65, 0xf1d963, 0xf0d764, 0xeed464, 0xe7c75d, 0xcea441, 0xbb8729, 0xbe8321, 0xc58b28, 0xc98f2d, 0xaa6d19, 0x854400, 0xc09646, 0xfaed8c, 0xeee57e, 0xe3d970, 0xf3ee86, 0xf9f691, 0xfaf891, 0xf6f28b, 0xf6f18d, 0xf2ec89, 0xf5ed88, 0xf9ef85, 0xf8e679, 0xc39e4a, 0x975c06, 0xc8a049, 0xedd46e, 0xfbeb7f, 0xfdf286, 0xf5ea7b, 0xf2e679, 0xf0e175, 0xeedb6b, 0xeddb6c, 0xf4e279, 0xc8a757, 0xb58345, 0x9b6f3b, 0xa37c49, 0xb68f56, 0xd5b06a, 0xe8c376, 0xeac474, 0xe1b96c, 0xddb56c, 0xdbb570, 0xd8b677, 0xdbba81, 0xdfc18b, 0xd4ba8a, 0xd7c097, 0xcdb992, 0xbeac89, 0xaa9678, 0x977e63, 0x856b52, 0x634933, 0x361803, 0x694b36, 0x68452e, 0x704d35, 0x6d4b31, 0x785a43, 0x826754, 0x6d5747, 0x563d2c, 0x5d4333, 0x614837, 0x6b513e, 0x705744, 0x715743, 0x6e533e, 0x654c38, 0x4c3829, 0x2c1b0e, 0x614c40, 0x604a3d, 0x483324, 0x664c39, 0x684d3b, 0x684d3c, 0x644738, 0x6b4f41, 0x6c5043, 0x695042, 0x635145, 0x100800, 0x131207, 0x111206, 0x101209, 0x0f0f0a, 0x0d0e08, 0x0d0e04, 0x0c0d03, 0x0a0b04, 0x090a04, 0x080a04, 0x070903, 0x060801, 0x050701, 0x040700, 0x040601, 0x040500, 0x040501, 0x020400, 0x020201, 0x020102, 0x010101, 0x020200, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x020202, 0x020202, 0x010101, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x020201, 0x020201, 0x020200, 0x020200, 0x020200, 0x030401, 0x020401, 0x030501, 0x030500, 0x040601, 0x050701, 0x050701, 0x050601, 0x050702, 0x070a03, 0x080903, 0x080903, 0x090a03, 0x0b0c06, 0x0c0d07, 0x0d0e07, 0x0d0e08, 0x0d0f08, 0x0f0f08, 0x100f07, 0x111006, 0x131206, 0x151407, 0x151208, 0x3a3a39, 0x3a3b3e, 0x383b3f, 0x35383d, 0x3a3b3e, 0x3b3b3a, 0x181714, 0x2b2c2c, 0x34383b, 0x373c41, 0x3a3f45, 0x363a3f, 0x303438, 0x353739, 0x3b3f42, 0x484848, 0x67625b, 0x7b6d5e, 0x8b725a, 0x9d7a59, 0x996f48, 0x9b6e41, 0x9a6938, 0x9d6a39, 0x9b693b, 0x804f2a, 0x6e3a15, 0xa86d30, 0xaf7232, 0xaa6d30, 0xa76c2f, 0xa3662b, 0x905220, 0x763e14, 0x7b4921, 0xa97b3c, 0xe7c260, 0xd9b351, 0xb68637, 0xb37b2c, 0xb87c2d, 0xa66418, 0xbe8533, 0xc58d36, 0xb97d26, 0xbc8024, 0xd5a03e, 0xb87a1d, 0xd4aa4d, 0xefca5a, 0xe7be4c, 0xf2cb55, 0xecc754, 0xe6c14f, 0xe7c452, 0xebcb57, 0xf2da6d, 0xf1e272, 0xf0e16e, 0xecd663, 0xeed863, 0xecd45f, 0xe7cf5e, 0xf3de6e, 0xf2dd6d, 0xf1da6b, 0xf3db6d, 0xdfbe5b, 0xbe9241, 0x975e15, 0x905103, 0x824000, 0x773700, 0x9f651f, 0xcca858, 0xf6e98c, 0xf4ea87, 0xe8e079, 0xebe580, 0xf0eb86, 0xf2ee89, 0xf8f492, 0xf8f292, 0xefe784, 0xf6ed85, 0xf8eb7f, 0xd7b95f, 0x783600, 0x935004, 0xa06619, 0xbb9443, 0xd2b95f, 0xe1cc6a, 0xead876, 0xead974, 0xead771, 0xe6d06d, 0xe0c56c, 0xddbc6f, 0xefce7e, 0xf1d07f, 0xf0cd7a, 0xe9c572, 0xe5c070, 0xe3c076, 0xdebc78, 0xd5b375, 0xcaaa72, 0xbea272, 0xb89f75, 0xad9672, 0xa48d6c, 0x856e53, 0x7d654d, 0x715840, 0x70543c, 0x6e4e34, 0x74553d, 0x745642, 0x5a4332, 0x321d10, 0x6e513e, 0x72513d, 0x654938, 0xa38e7b, 0x7f6957, 0x7a6050, 0x6e5748, 0x664d3a, 0x684e3d, 0x664b3a, 0x6d5341, 0x6f5643, 0x725946, 0x705641, 0x654e3a, 0x513e2e, 0x2e1e11, 0x4a392e, 0x755f4f, 0x6a5141, 0x735b46, 0x725845, 0x694f3e, 0x634739, 0x614537, 0x674c3f, 0x795f50, 0x5b493d, 0x0a0400, 0x151408, 0x141307, 0x111209, 0x10110b, 0x0f0f08, 0x0d0d03, 0x0b0c03, 0x090a04, 0x090804, 0x080a04, 0x070903, 0x060802, 0x050701, 0x040600, 0x030500, 0x030400, 0x030400, 0x020300, 0x020201, 0x010101, 0x020201, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x020100, 0x010100, 0x020200, 0x020201, 0x030301, 0x030400, 0x040600, 0x040601, 0x050601, 0x050702, 0x060702, 0x060802, 0x070903, 0x080a03, 0x080904, 0x080a04, 0x0a0a05, 0x0b0b06, 0x0c0c07, 0x0d0d07, 0x0d0e06, 0x0e0f06, 0x0f1005, 0x101107, 0x121107, 0x161308, 0x161205, 0x424140, 0x39393d, 0x35383d, 0x373a3f, 0x393a3b, 0x282724, 0x1d1c19, 0x2c2d2d, 0x35393c, 0x393e43, 0x353c41, 0x3d4248, 0x323639, 0x343638, 0x3a3f43, 0x33393d, 0x343a3e, 0x484a4b, 0x6c6761, 0x807060, 0x967c63, 0xa2805e, 0xab825a, 0xa87c4e, 0xa27240, 0xa27040, 0x916134, 0x8d5b2e, 0x905e2f, 0x6f390f, 0x733c12, 0x7e4822, 0x622e0f, 0x612b0d, 0x7c4925, 0xc59b50, 0xd3ab52, 0xb18133, 0xb78535, 0xa76b1e, 0xa06119, 0xac6d23, 0xb67d2c, 0xc28e38, 0xd09f45, 0xcf9d40, 0xd29a3c, 0xb57822, 0xe1b758, 0xba8734, 0xc8933a, 0xdbae4d, 0xe1b957, 0xe0b958, 0xddb655, 0xcda447, 0xe5ce69, 0xf5e773, 0xf0da67, 0xe6c959, 0xebd15f, 0xf4de6d, 0xe7d165, 0xf0db6e, 0xefd96b, 0xe3cc65, 0xf0de74, 0xf5e073, 0xe8ca61, 0xd9ae49, 0xd9ad46, 0xc69535, 0xa26514, 0x824205, 0x9f6527, 0xad8141, 0xddca7a, 0xf7ec90, 0xf0e889, 0xede586, 0xf5f191, 0xf4f090, 0xefe986, 0xf2e985, 0xf1e880, 0xf3e580, 0xc4a051, 0x9e611a, 0x743500, 0x81460d, 0x955e20, 0x9d6f2f, 0xb08c49, 0xc4a65b, 0xd7bc68, 0xead075, 0xf1d87e, 0xf6db85, 0xf6d884, 0xf1d585, 0xf5db90, 0xedd38e, 0xe7ce91, 0xd6bb83, 0xbca473, 0xa79068, 0x9d8867, 0xa38f73, 0xae9c82, 0xa08d74, 0x6e553f, 0x6c5641, 0x705946, 0x684c39, 0x70553f, 0x73553e, 0x7a5940, 0x72553d, 0x654c3a, 0x5a4536, 0x372217, 0x715442, 0x634635, 0x4a3627, 0x7f6c5b, 0x7d6a5a, 0x695345, 0x6c5546, 0x694f3e, 0x715948, 0x7c6352, 0x6c513f, 0x6c513e, 0x745945, 0x775c46, 0x6a533e, 0x5d4a39, 0x463628, 0x2e1f15, 0x46362b, 0x635246, 0x5f4d3e, 0x6b5545, 0x634b3c, 0x5c4134, 0x614639, 0x65493c, 0x725749, 0x564539, 0x110a00, 0x18140a, 0x161308, 0x131109, 0x111009, 0x100f04, 0x0e0d03, 0x0c0c04, 0x0a0b05, 0x0a0804, 0x090903, 0x070a03, 0x060802, 0x040601, 0x040401, 0x040500, 0x030400, 0x030200, 0x020200, 0x020100, 0x020200, 0x020200, 0x020200, 0x010101, 0x000001, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000101, 0x010101, 0x010101, 0x020200, 0x010100, 0x010101, 0x030302, 0x020201, 0x020200, 0x030400, 0x040600, 0x050601, 0x050601, 0x050701, 0x050801, 0x060902, 0x070801, 0x080903, 0x090904, 0x0a0a05, 0x0a0a06, 0x0b0b06, 0x0c0c07, 0x0c0d07, 0x0d0e07, 0x0e1008, 0x0f1106, 0x111207, 0x171309, 0x131001, 0x3e3d3b, 0x3c3e42, 0x36393f, 0x373a3e, 0x2b2c2d, 0x000000, 0x12120f, 0x292a28, 0x3c3e40, 0x3d4145, 0x3a3f45, 0x3a3f45, 0x313538, 0x2a2c2d, 0x3b4044, 0x383f42, 0x3d4549, 0x444c54, 0x3c4247, 0x3d3d3d, 0x615a52, 0x7e6e60, 0x9a8068, 0xae8a65, 0xb48b5d, 0xab7c4a, 0xa67541, 0xa77844, 0xa67644, 0x9b6e41, 0x784929, 0x662a09, 0x9d6432, 0xaa7137, 0x9e6a31, 0xad7f3b, 0xb7893e, 0xb58434, 0xc19040, 0xa96e22, 0xa56920, 0xa7691c, 0xbb8230, 0xc38e38, 0xc5923a, 0xcb973d, 0xb37618, 0xd6a749, 0xc99a46, 0x650d00, 0x80410f, 0x986024, 0xa26f2f, 0x946429, 0x835824, 0x673100, 0xc1aa5f, 0xfceb7b, 0xe7ce5c, 0xdaba4e, 0xe9ce60, 0xefd76a, 0xf3dd6d, 0xebd564, 0xf1db6a, 0xead466, 0xe9d66a, 0xefdc6d, 0xeed86b, 0xe4c658, 0xfadc68, 0xf7d35f, 0xe3b148, 0x9f641c, 0x682b00, 0x6e3300, 0x733b01, 0x9e814a, 0xd3c078, 0xebdc8a, 0xf7f099, 0xf4ef95, 0xe9e282, 0xe9de7e, 0xeedf7d, 0xd8c36c, 0xc29b4e, 0xe1b968, 0xdebc71, 0xe2c67b, 0xedd281, 0xf2d881, 0xf4d980, 0xf0d67c, 0xefd37a, 0xedd37e, 0xf1da8b, 0xecd68e, 0xe2ca88, 0xd3be87, 0xc0ac7d, 0xaf9b74, 0xab9a7b, 0xa89578, 0xa59077, 0xa5927b, 0x9e8b74, 0x947d68, 0x7c6752, 0x79614b, 0x7d634d, 0x745b48, 0x634736, 0x705340, 0x74553e, 0x76543b, 0x76543d, 0x6e5341, 0x665142, 0x5a473a, 0x382519, 0x6b5040, 0x5c4132, 0x392418, 0x433123, 0x554438, 0x624e43, 0x614b3d, 0x5b4232, 0x6d5442, 0x79604c, 0x755c47, 0x745b46, 0x715947, 0x68513e, 0x564330, 0x403123, 0x352517, 0x291c0f, 0x160a01, 0x060000, 0x000000, 0x5d4d3f, 0x6b5546, 0x5c4336, 0x61473a, 0x725747, 0x765c4b, 0x49392d, 0x120b00, 0x191309, 0x151109, 0x131009, 0x110f07, 0x100e04, 0x0e0d02, 0x0a0c03, 0x0a0b06, 0x090904, 0x080802, 0x070802, 0x060802, 0x050601, 0x040501, 0x040600, 0x030400, 0x030300, 0x020100, 0x020100, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000101, 0x000101, 0x000000, 0x010101, 0x000100, 0x020201, 0x020201, 0x020201, 0x020300, 0x030400, 0x040600, 0x050601, 0x060702, 0x060801, 0x070902, 0x070a03, 0x080903, 0x080903, 0x080803, 0x090a04, 0x0a0a05, 0x0a0a05, 0x0b0a06, 0x0c0c07, 0x0d0e08, 0x0e0f08, 0x0f1008, 0x121109, 0x17140a, 0x150f02, 0x353433, 0x3b3d42, 0x373a40, 0x393a3e, 0x1d1c1c, 0x010000, 0x13130e, 0x1c1d18, 0x2a2b29, 0x3c3e40, 0x3e4146, 0x393d43, 0x33363b, 0x323439, 0x3a3f43, 0x343b3f, 0x3b434a, 0x3f4750, 0x3e434a, 0x3a3e40, 0x323435, 0x403e3e, 0x635a53, 0x786555, 0x977b5d, 0xb99468, 0xb8905e, 0xb38751, 0xb88a51, 0xc1935a, 0xc1935d, 0xab7c4e, 0x8e5c32, 0x925c25, 0x854f19, 0x90612b, 0xbf9046, 0xb98534, 0xb07b32, 0xb37c33, 0xa66a20, 0xa86a1e, 0xb67c2c, 0xb67d27, 0xbc832b, 0xb2771d, 0xd5a74a, 0xe0b552, 0xa86c25, 0xb07134, 0xb87c39, 0xb87f37, 0xb78039, 0xa87638, 0x9b6e3c, 0x754924, 0x78592d, 0xeed97d, 0xf2dd6b, 0xe6cc5d, 0xdfc358, 0xe3c659, 0xedd462, 0xefd968, 0xf0da6c, 0xefda6b, 0xf1dd6f, 0xe7d166, 0xe7d269, 0xecd66c, 0xd1b256, 0xd9b85c, 0xd7ac54, 0xbb8849, 0x844e1f, 0x753f15, 0x6e370a, 0x621600, 0x5a0000, 0x784d15, 0xa08650, 0xc0ad6c, 0xd8c97a, 0xecdd88, 0xf5e68b, 0xf9e88f, 0xfbe68c, 0xfce58e, 0xfce68e, 0xfbe88f, 0xf8e894, 0xf8e899, 0xeeda91, 0xe3cf8d, 0xd1bd81, 0xbea973, 0xb19d6f, 0xa99670, 0x9f8a69, 0x9d8669, 0xa48e75, 0xa7947b, 0x9e8a74, 0x88725c, 0x6c523c, 0x6b4d38, 0x674632, 0x63442f, 0x624731, 0x9d8872, 0x7b634d, 0x775c48, 0x634433, 0x6a4a37, 0x76543c, 0x78553d, 0x72513e, 0x705748, 0x6a5548, 0x564338, 0x352115, 0x6f5444, 0x634638, 0x412c20, 0x4b382d, 0x58463b, 0x614e43, 0x655043, 0x5d4537, 0x614a39, 0x554030, 0x4c3a2b, 0x3f2e20, 0x2f1c10, 0x361f10, 0x342110, 0x3f2d1c, 0x473625, 0x3e3122, 0x2b2116, 0x150e07, 0x080000, 0x544337, 0x614b3d, 0x594234, 0x5f4436, 0x6e5446, 0x765e4d, 0x3b2d21, 0x161003, 0x151106, 0x131006, 0x120f06, 0x100e06, 0x0f0d04, 0x0d0c02, 0x0a0c04, 0x090b05, 0x090904, 0x080803, 0x060903, 0x060802, 0x050601, 0x040600, 0x040600, 0x030400, 0x030300, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x000000, 0x000000, 0x010000, 0x020200, 0x010100, 0x030300, 0x030400, 0x030400, 0x030500, 0x040601, 0x050600, 0x050802, 0x070902, 0x070802, 0x080a04, 0x080903, 0x080803, 0x090a04, 0x080b04, 0x090a05, 0x0a0905, 0x0b0c06, 0x0c0d07, 0x0d0e06, 0x0f0f08, 0x131109, 0x161209, 0x151105, 0x272725, 0x3a3c41, 0x37393e, 0x38383b, 0x21201f, 0x020200, 0x1a1a14, 0x2b2b24, 0x292a23, 0x2b2c27, 0x313333, 0x3c3e40, 0x3f4145, 0x383b40, 0x3a3e44, 0x383d43, 0x383e46, 0x3b434b, 0x3b4047, 0x4d4f53, 0x383a3c, 0x313233, 0x3f3e3e, 0x484441, 0x5a4f48, 0x735f4c, 0x9f8463, 0xb48f62, 0xb9915e, 0xbc935c, 0xc0965d, 0xc1965a, 0xbd9059, 0xaa7f52, 0x744b2b, 0x6b421c, 0xbd8f49, 0xb37d29, 0xa56c1f, 0xa76c21, 0x9f631b, 0xa1641a, 0xb9812f, 0xc79339, 0xc58e37, 0xd2a045, 0xe0b250, 0xc69038, 0xbe8131, 0xbd7e2d, 0xbc822f, 0xc08835, 0xbd8633, 0xbe8838, 0xc18c3d, 0xbe8a44, 0x90612f, 0x947847, 0xe9d178, 0xf8e275, 0xf1d869, 0xe4c85c, 0xe6cd61, 0xefd86c, 0xe2cd64, 0xebd970, 0xf0df76, 0xead770, 0xecda73, 0xf5e37d, 0xa78b4b, 0x4b0000, 0x6d4215, 0x784d23, 0x713d0c, 0x804f23, 0x946e41, 0xb49462, 0xc7aa75, 0xd5b97d, 0xe7ce8a, 0xf3e096, 0xf9e99c, 0xf9ed9d, 0xfbf0a1, 0xf8eb9d, 0xf8e79b, 0xf4e297, 0xe9d892, 0xdcca89, 0xcec08a, 0xb6a779, 0xa38f66, 0xae9e7a, 0xbaac8c, 0xbfb192, 0xaf9e80, 0x99846b, 0x7c6751, 0x6d5440, 0x654833, 0x66452f, 0x64422c, 0x72513b, 0x6f503b, 0x6b4d39, 0x6a4c38, 0x573c2a, 0x5d4531, 0x917b64, 0x77604a, 0x684b38, 0x604334, 0x5e402f, 0x74533f, 0x795946, 0x6a4d40, 0x6d5349, 0x6a5347, 0x574338, 0x3a261a, 0x765b4d, 0x684a3d, 0x583d30, 0x5e483b, 0x59453a, 0x614f42, 0x48392d, 0x301c10, 0x331f0f, 0x3e2818, 0x432c1b, 0x49311d, 0x543b29, 0x5a402b, 0x5f4530, 0x654c35, 0x5f4931, 0x4d3c28, 0x392d1e, 0x1b130a, 0x160b04, 0x513f33, 0x553e31, 0x645145, 0x847165, 0x5b4235, 0x6a5546, 0x281c12, 0x191307, 0x151105, 0x141107, 0x130f07, 0x0f0e04, 0x0d0e04, 0x0c0d03, 0x0a0b02, 0x0a0a05, 0x090803, 0x080904, 0x070903, 0x060802, 0x040701, 0x040500, 0x040600, 0x030400, 0x030400, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x000000, 0x000000, 0x020200, 0x030300, 0x030400, 0x030401, 0x030400, 0x040500, 0x050501, 0x050600, 0x050600, 0x060702, 0x070803, 0x060802, 0x060702, 0x080802, 0x090802, 0x090903, 0x080903, 0x0a0904, 0x0a0a05, 0x0b0c07, 0x0d0d07, 0x0e0e08, 0x141009, 0x151109, 0x111004, 0x242522, 0x3e4044, 0x3f4246, 0x262625, 0x2d2d2b, 0x050400, 0x191912, 0x2a2b22, 0x2c2d25, 0x2e2f28, 0x2e2e29, 0x2e2e2b, 0x353537, 0x3d3d41, 0x3d4045, 0x393d43, 0x363b42, 0x3a3f47, 0x3c4148, 0x4c4f53, 0x2d2f32, 0x2f2f33, 0x39393c, 0x353637, 0x383737, 0x43403e, 0x524740, 0x79624e, 0xa28460, 0xba9769, 0xc19a67, 0xc19a63, 0xc19862, 0xbd915a, 0xbe9461, 0xa07b53, 0x996f3d, 0xaf7b31, 0xa87228, 0xae762e, 0xaa722d, 0xb27b31, 0xc89443, 0xcc9a47, 0xb48137, 0x9f6d29, 0xc08d3c, 0xcc973e, 0xca963f, 0xce9b42, 0xcc9a41, 0xbf8a37, 0xb78333, 0xb27d2e, 0xc39140, 0xbd893c, 0xb5823e, 0x835327, 0x7e582a, 0xcbaf61, 0xecd272, 0xf1d76f, 0xeed66d, 0xead66c, 0xefdf76, 0xeddd75, 0xf0e079, 0xecda76, 0xf2e17e, 0xeed97e, 0x9a7943, 0x916b3f, 0xa8814f, 0xb68c57, 0xc79a61, 0xdfb778, 0xefd08f, 0xf4da98, 0xf4dd9a, 0xf1dd98, 0xf3e19a, 0xf2e39c, 0xe9d996, 0xe6d799, 0xdfd097, 0xd2c38f, 0xbfac7d, 0x9f8c64, 0x7c6749, 0x695139, 0x5e4028, 0x684c30, 0xb49e7e, 0xae9d7e, 0x9b886d, 0x856d53, 0x785d46, 0x6a503b, 0x664d3a, 0x674c3a, 0x684936, 0x6b4935, 0x6e4e3a, 0x6e4f3a, 0x6d4e39, 0x6b4f3a, 0x674b37, 0x5c4130, 0x422a1c, 0x5d422e, 0x5f4431, 0x644839, 0x63473a, 0x593e31, 0x694c3d, 0x715446, 0x71564a, 0x6a5247, 0x614a3f, 0x4e3a2f, 0x3c281c, 0x74594b, 0x694a3d, 0x624437, 0x60473a, 0x5a4439, 0x5c483a, 0x4a3626, 0x563e29, 0x5c412b, 0x654833, 0x6f5038, 0x725237, 0x6c4b31, 0x69482c, 0x745133, 0x7a5839, 0x735537, 0x5f482f, 0x413221, 0x1c130a, 0x1e1109, 0x675347, 0x5b4639, 0x746255, 0xaa9688, 0x7b6556, 0x665142, 0x1a0e03, 0x171005, 0x161006, 0x151007, 0x110e07, 0x0d0d04, 0x0b0d02, 0x0b0c02, 0x0a0b02, 0x090903, 0x090803, 0x080903, 0x070803, 0x060701, 0x050601, 0x040500, 0x040600, 0x030400, 0x030300, 0x020300, 0x020200, 0x020200, 0x010100, 0x010201, 0x000100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x030201, 0x040300, 0x030400, 0x030401, 0x030401, 0x040500, 0x050601, 0x050601, 0x060701, 0x050701, 0x060903, 0x050701, 0x060702, 0x070802, 0x080802, 0x090903, 0x080903, 0x0b0905, 0x0b0a05, 0x0c0d07, 0x0d0e09, 0x0d0e09, 0x121008, 0x141108, 0x121004, 0x22221e, 0x393c3e, 0x26282a, 0x242524, 0x343432, 0x080602, 0x16160f, 0x2c2b22, 0x35362b, 0x37382f, 0x373730, 0x35352f, 0x2e2e29, 0x2b2b29, 0x333535, 0x37393c, 0x383a40, 0x393d43, 0x363c43, 0x33383e, 0x25282c, 0x29292c, 0x36363a, 0x37373b, 0x37373a, 0x3c3d3f, 0x403f3e, 0x504943, 0x5c4d40, 0x6c563f, 0x9a7e59, 0xb89567, 0xc19a6a, 0xb9915c, 0xb78f5b, 0xb88f5c, 0xbb925e, 0xc0955b, 0xb18547, 0x9e7034, 0x966429, 0x935f25, 0x966028, 0x7c481a, 0x642e0b, 0xb48545, 0xce9c45, 0xc5933b, 0xba8934, 0xd0a448, 0xc4953e, 0xb38231, 0xb98638, 0xab7427, 0xbd8e43, 0xc7994e, 0xae7932, 0xa27036, 0x481000, 0x501700, 0x785424, 0xa88c49, 0xcdb668, 0xe6d67e, 0xf4e485, 0xf1e080, 0xeeda7c, 0xf0da81, 0xefd680, 0xe6c577, 0xe2b974, 0xeac078, 0xe9bd77, 0xe6b876, 0xdcae70, 0xd6ac6f, 0xd3ae73, 0xd1b278, 0xe2cb96, 0xebdaa5, 0xd7c795, 0xc1b083, 0xa29169, 0x8b7959, 0x735e42, 0x685239, 0x674e36, 0x6b5139, 0x70573f, 0x6d543e, 0x4d331e, 0x6f5742, 0x715740, 0x88705d, 0x7d614c, 0x70533d, 0x725742, 0x654f3d, 0x634e3e, 0x6a5140, 0x7b5d46, 0x7d6045, 0x6d4f38, 0x6b4a36, 0x674834, 0x694d39, 0x674b36, 0x654a38, 0x604738, 0x614637, 0x5d4234, 0x5f4538, 0x604639, 0x60463a, 0x654b3f, 0x664c41, 0x5a4238, 0x422f25, 0x33221a, 0x1e0d05, 0x412e21, 0x6a5142, 0x654739, 0x624538, 0x61453a, 0x563e32, 0x654d3b, 0x664a34, 0x6e4f35, 0x6b492e, 0x6e4a2d, 0x785434, 0x7d5635, 0x835a37, 0x8a6036, 0x90663b, 0x93683f, 0x8f6944, 0x6f5438, 0x413121, 0x150c05, 0x2e2019, 0x6c574a, 0x543f33, 0x4b3629, 0x5b4334, 0x6e5445, 0x614e41, 0x0a0200, 0x160f06, 0x160e05, 0x140e05, 0x0f0d04, 0x0c0d03, 0x0b0c01, 0x0b0c01, 0x0a0b02, 0x080803, 0x080803, 0x070902, 0x060802, 0x050700, 0x050600, 0x040500, 0x040600, 0x020300, 0x030400, 0x020300, 0x020300, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020201, 0x020101, 0x030300, 0x030400, 0x030400, 0x040500, 0x040501, 0x040601, 0x040601, 0x050701, 0x060802, 0x050701, 0x060702, 0x070702, 0x070803, 0x080803, 0x080803, 0x090a05, 0x0b0a05, 0x0c0c07, 0x0d0e08, 0x0e0e0a, 0x120f09, 0x141007, 0x151205, 0x1d1c17, 0x373839, 0x2c2e30, 0x303234, 0x393937, 0x0f0f09, 0x12130c, 0x26251c, 0x333329, 0x3c3a33, 0x3e3b34, 0x414037, 0x42423b, 0x3a3a35, 0x34342e, 0x272723, 0x2c2c2d, 0x393a3e, 0x373a40, 0x32363e, 0x2b2d33, 0x2a2a2f, 0x323337, 0x36373b, 0x36373a, 0x38383b, 0x3e3e40, 0x42403f, 0x48423c, 0x50463e, 0x504238, 0x66513c, 0x9d805e, 0xbe9c71, 0xbc976a, 0xb79061, 0xb58c5b, 0xbd9460, 0xc39a65, 0xb18a5c, 0x835c3b, 0x572505, 0x531800, 0x561f00, 0xaf8546, 0xcc9d4c, 0xc49643, 0xaf7c2a, 0xaa7a29, 0xba8c3a, 0xaf7f31, 0xc19348, 0xa8742c, 0xa06b20, 0xc8a156, 0xc39951, 0xb27e37, 0xc79b55, 0x532a02, 0x320700, 0x55341f, 0x724b29, 0x8e6537, 0xaa844e, 0xd2af68, 0xdcba6e, 0xd9b56e, 0xd7b16e, 0xd3aa68, 0xd1a767, 0xd2a86b, 0xdfb97b, 0xdbb579, 0xd3ab75, 0xd6b27f, 0xd7b789, 0xddc294, 0xe2caa0, 0xd8c5a3, 0xaf9b7d, 0x6f5336, 0x64472e, 0x634731, 0x634932, 0x6a513a, 0x68523c, 0x69543d, 0x6c553e, 0x6b543f, 0x624c39, 0x442c1d, 0x6d5746, 0x483122, 0xa99682, 0x9b8672, 0x614531, 0x694e3c, 0x614b3a, 0x5a4537, 0x573f2d, 0x7b6249, 0xb09876, 0xa89270, 0x684b32, 0x5c3d2a, 0x644531, 0x674935, 0x664b3a, 0x6a5243, 0x644b3c, 0x583f32, 0x563f34, 0x4b352b, 0x433025, 0x39261c, 0x311d11, 0x311e10, 0x372518, 0x27170d, 0x170703, 0x443127, 0x685042, 0x5d4033, 0x583b2d, 0x593b2e, 0x5e4132, 0x80654d, 0x77573c, 0x6c482c, 0x754e2f, 0x7c5130, 0x7f542e, 0x976b40, 0xa27648, 0xa87a49, 0xac7e4d, 0x906237, 0x734b29, 0x583d25, 0x332416, 0x120702, 0x382a21, 0x6d594b, 0x634d41, 0x433024, 0x574134, 0x6b5546, 0x5a4c40, 0x000000, 0x120e06, 0x110d04, 0x100d04, 0x0d0d02, 0x0b0c04, 0x0b0b03, 0x0a0a02, 0x090902, 0x080804, 0x080703, 0x060702, 0x050701, 0x050601, 0x040600, 0x040500, 0x040500, 0x030400, 0x020400, 0x020300, 0x030300, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010001, 0x010100, 0x030300, 0x030400, 0x040400, 0x030400, 0x030401, 0x050601, 0x040601, 0x040601, 0x050701, 0x050602, 0x060702, 0x060702, 0x080703, 0x080803, 0x070802, 0x090903, 0x090904, 0x0b0b06, 0x0d0d08, 0x0e0e0a, 0x120f09, 0x151007, 0x151106, 0x16140d, 0x353636, 0x393c3f, 0x36393b, 0x40403e, 0x13130d, 0x10100a, 0x2a2820, 0x312f28, 0x2c2a23, 0x3b3831, 0x3e3c33, 0x424139, 0x413f38, 0x36352e, 0x2b2b24, 0x25231f, 0x252421, 0x2d2f31, 0x383b41, 0x37393e, 0x303237, 0x323338, 0x303237, 0x303236, 0x35363a, 0x393a3d, 0x3e3e3f, 0x44413f, 0x46413d, 0x463e38, 0x453d36, 0x4b3e34, 0x725d49, 0x9e8364, 0xb4926d, 0xb08a61, 0xb69163, 0xbb9566, 0xbf9969, 0xc09868, 0xb69062, 0x8b6743, 0x987442, 0xd2a959, 0xb48635, 0xc49746, 0xb38434, 0xbf9045, 0xa2712a, 0xb68842, 0xba8c43, 0xad7c33, 0xc49a4d, 0xe5c474, 0xaa7c37, 0xcea058, 0xe4b96c, 0xbc8e54, 0xc59760, 0xd0a267, 0xd1a162, 0xcf9f60, 0xce9f63, 0xc99d62, 0xc89f65, 0xc9a069, 0xc79f6a, 0xd5af7c, 0xd7b481, 0xcfae7e, 0xae9265, 0xb1946b, 0xcfb287, 0xc0a47d, 0xaa9272, 0x988266, 0x7d674f, 0x6a492f, 0x856147, 0x6f5039, 0x6b513a, 0x6c533c, 0x654e38, 0x664e3a, 0x664f3c, 0x624e3b, 0x63503e, 0x645140, 0x564436, 0x422d20, 0x6d5646, 0x3d2a1e, 0x5b4838, 0x654e3d, 0x5f4332, 0x634937, 0x644e3f, 0x554334, 0x443122, 0x230200, 0x5b4831, 0xc7b796, 0xcabc9d, 0x624b36, 0x5b3f2c, 0x674b38, 0x684d3b, 0x664d3f, 0x533c30, 0x3f271a, 0x422c1e, 0x432b1d, 0x4c3322, 0x543927, 0x583d2b, 0x503826, 0x402c1e, 0x24160c, 0x130500, 0x48362b, 0x6c5446, 0x573a2c, 0x593e2e, 0x70523e, 0x6f4d38, 0x826249, 0x755132, 0x754f2e, 0x8a613e, 0x966a41, 0xa07344, 0x9c6d3d, 0x996939, 0x9c6b3c, 0x8e6036, 0x805835, 0x775436, 0x5d422d, 0x352619, 0x0e0300, 0x423328, 0x745e4e, 0x6c5545, 0x634b3c, 0x624a3b, 0x6f5b4c, 0x564b41, 0x000000, 0x0e0d05, 0x0c0b03, 0x0b0c03, 0x0b0c04, 0x0a0a04, 0x090904, 0x080703, 0x090804, 0x090804, 0x080803, 0x070803, 0x060701, 0x050601, 0x040501, 0x030400, 0x030400, 0x030400, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000101, 0x010101, 0x030301, 0x030400, 0x030401, 0x030301, 0x030401, 0x040501, 0x040500, 0x040601, 0x040701, 0x040702, 0x050702, 0x060702, 0x070702, 0x080904, 0x070903, 0x090903, 0x090904, 0x0a0b05, 0x0c0c07, 0x0e0d09, 0x110f09, 0x141006, 0x141005, 0x100e04, 0x333333, 0x3d3e41, 0x3b3c3d, 0x444342, 0x191814, 0x101009, 0x2e2d24, 0x39382f, 0x3b3830, 0x423f37, 0x44423a, 0x4a4840, 0x4a473f, 0x434138, 0x3d3932, 0x2f2c27, 0x292723, 0x2d2d2c, 0x323333, 0x313235, 0x35363b, 0x333439, 0x303136, 0x2e2f34, 0x313236, 0x37373b, 0x3c3c3e, 0x403f3f, 0x413d3b, 0x3e3a36, 0x3e3935, 0x423a36, 0x433a35, 0x5a4d44, 0x7c6856, 0x9a7d5f, 0xb3936d, 0xb9966d, 0xb38e65, 0xad8a60, 0xb59366, 0xc09e6d, 0xc6a469, 0xc6a057, 0xa4742b, 0xbc9144, 0xc49a4c, 0xae7e36, 0xa77833, 0xb0823c, 0xbd8e46, 0xc3954b, 0xcba155, 0xcca35e, 0xbd8b4c, 0xc59151, 0xc18e50, 0xca995e, 0xd0a268, 0xcba169, 0xc69f6b, 0xae8757, 0xa37e54, 0xc7a87f, 0xc8ad86, 0xc3aa83, 0xa78963, 0xab8c67, 0x987957, 0x715437, 0x432b17, 0x361d0c, 0x6f4f35, 0x6a482d, 0x573722, 0x49250f, 0x432103, 0x674933, 0x7f5d45, 0x624732, 0x624935, 0x664e3a, 0x644d3a, 0x614c3b, 0x635041, 0x645142, 0x625142, 0x615144, 0x4f4035, 0x412e22, 0x765c4c, 0x5c4536, 0x493123, 0x634735, 0x6a4d3a, 0x644a38, 0x614d3e, 0x504032, 0x382a1e, 0x231306, 0x281000, 0x60523c, 0xe4daba, 0xb6a88d, 0x593c27, 0x694f3d, 0x6a4f3f, 0x614638, 0x482d1c, 0x543925, 0x5e412d, 0x674832, 0x6b4b33, 0x67452d, 0x5f3e27, 0x563a25, 0x442e1f, 0x26180d, 0x150400, 0x49362b, 0x6d5346, 0x4e2c1c, 0xa98f78, 0xac8f75, 0x714d33, 0x8d694c, 0x845c37, 0x7e532e, 0x8d623c, 0x92663e, 0x84572f, 0x86582e, 0x97683e, 0xa2744c, 0x8f633c, 0x835936, 0x6c492c, 0x523925, 0x302014, 0x130500, 0x4c3b2f, 0x755b4a, 0x6e5242, 0x694e3d, 0x6b5140, 0x6f5b4a, 0x4d4439, 0x000000, 0x0b0b05, 0x0b0b03, 0x0b0b04, 0x090a04, 0x090803, 0x080703, 0x080703, 0x080803, 0x080803, 0x060802, 0x060802, 0x060701, 0x040600, 0x030500, 0x030400, 0x030400, 0x030400, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x020202, 0x030302, 0x030302, 0x040302, 0x030301, 0x040400, 0x030400, 0x040700, 0x040601, 0x040700, 0x050701, 0x060702, 0x060802, 0x070803, 0x080904, 0x0a0a05, 0x0b0b05, 0x0a0c05, 0x0b0c07, 0x0f0e09, 0x120e08, 0x120f06, 0x141105, 0x0d0b00, 0x353533, 0x3e3d40, 0x3c3d3f, 0x4b4a4b, 0x21201e, 0x070501, 0x2a271f, 0x424036, 0x4b4940, 0x47433c, 0x46443d, 0x43423a, 0x444139, 0x454139, 0x444037, 0x444039, 0x4e4d4c, 0x3a3b3d, 0x404345, 0x3b3e3f, 0x303234, 0x292a2b, 0x2e2e31, 0x343438, 0x343438, 0x343439, 0x37373b, 0x363537, 0x3f3c3c, 0x3e3a39, 0x3a3633, 0x3c3834, 0x3e3734, 0x46403d, 0x655b55, 0x8a7b6c, 0xa28c74, 0xb69a78, 0xc5a57e, 0xc4a37a, 0xb5956c, 0xa9885e, 0xac8c5d, 0xb99962, 0xbe9a5d, 0xc09857, 0xbf9656, 0xbb9054, 0xbb9054, 0xc39658, 0xc09355, 0xbd8f53, 0xb98b52, 0xc1945e, 0xc69c67, 0xba9060, 0xbb9668, 0xc7aa80, 0xd3bb93, 0xcfb993, 0xcfb792, 0xcfbb96, 0x746047, 0x59412e, 0x5f4836, 0x5d4430, 0x654832, 0x7a553a, 0x7f583c, 0x654630, 0x4a3626, 0x311f14, 0x5a3d2a, 0x61432e, 0x644734, 0x977f6d, 0x9a8573, 0x5f402a, 0x73543e, 0x5d4431, 0x604b39, 0x644f3e, 0x634f3f, 0x645343, 0x625042, 0x5a4a3c, 0x5c4c3f, 0x5b4c42, 0x4d4036, 0x35241a, 0x715949, 0x725745, 0x674b39, 0x644532, 0x6a4d3a, 0x654b3a, 0x5e4b3c, 0x4a3d31, 0x2d2419, 0x180b02, 0x2a1c0e, 0x240200, 0x9e9277, 0xc2b293, 0x664c38, 0x694e3e, 0x694e3f, 0x5f412f, 0x5f3f28, 0x6a472d, 0x6a4529, 0x6c462a, 0x704a2c, 0x734b2d, 0x6e4a2e, 0x5e412b, 0x422c1c, 0x23150a, 0x110000, 0x503e31, 0x6f5647, 0x4c2d1f, 0x84644c, 0x8c6b50, 0x775338, 0x865e3e, 0x835832, 0x855934, 0x8c613b, 0x825632, 0x7d4e29, 0x8e5f36, 0x966639, 0x96663b, 0x92653b, 0x875c37, 0x795637, 0x543c26, 0x342417, 0x190b03, 0x523f32, 0x6c503e, 0x5f4231, 0x6c5240, 0x6e5642, 0x705f4d, 0x41392f, 0x000000, 0x090a04, 0x080a03, 0x090a03, 0x090904, 0x0a0704, 0x080803, 0x060803, 0x070803, 0x070803, 0x060802, 0x060802, 0x050601, 0x050600, 0x040500, 0x030400, 0x030400, 0x030301, 0x020200, 0x020201, 0x020201, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020202, 0x020201, 0x030301, 0x030301, 0x030301, 0x040500, 0x030400, 0x030400, 0x040500, 0x040600, 0x050701, 0x060701, 0x060802, 0x070903, 0x070904, 0x090a05, 0x0a0c06, 0x0a0c05, 0x0b0b06, 0x0e0c07, 0x110d07, 0x120e06, 0x161006, 0x150d01, 0x383633, 0x444345, 0x4a494c, 0x4c4a4c, 0x282726, 0x050501, 0x25231d, 0x3d3b31, 0x48453b, 0x4a463e, 0x4a463f, 0x413e37, 0x3d3a34, 0x37342e, 0x36312a, 0x3c3934, 0x575757, 0x34383c, 0x2c2f34, 0x2d3133, 0x373a3b, 0x343535, 0x20201e, 0x292929, 0x343535, 0x383839, 0x323236, 0x303034, 0x363536, 0x3d3c3d, 0x3c393a, 0x373432, 0x393531, 0x46423f, 0x3e3b39, 0x4b4744, 0x726960, 0x8f7f6f, 0xa58d72, 0xbda17e, 0xc0a27c, 0xbc9c75, 0xb4956d, 0xb3976d, 0xba9b6d, 0xac8958, 0xb78f5f, 0xb89060, 0xbd9463, 0xb99161, 0xb38e60, 0xb49269, 0xb59771, 0xbda37f, 0xc2ad8e, 0xc7b497, 0xcbbb9c, 0xc6b699, 0x9b886d, 0x77624c, 0x624933, 0xa39072, 0xbca789, 0x6a5440, 0x513b28, 0x604a38, 0x6c533d, 0x6b4b34, 0x6d4a35, 0x664935, 0x4b372a, 0x2e2015, 0x5d4331, 0x644935, 0x5c4130, 0x9f8773, 0xc7b19a, 0x6d513d, 0x6f523d, 0x5b4535, 0x604d3f, 0x5f4c3e, 0x5c493b, 0x5b493b, 0x624f42, 0x604e41, 0x5e4d41, 0x605045, 0x55483d, 0x3c2f25, 0x412f23, 0x654a3a, 0x725340, 0x6b4b37, 0x644835, 0x624a3a, 0x554337, 0x3a3026, 0x29211a, 0x180e06, 0x261707, 0x2f1e0d, 0x594730, 0x9f896a, 0x6d5440, 0x644a3a, 0x66493a, 0x724f38, 0x774e2f, 0x774b2a, 0x7f5330, 0x895c36, 0x8b5f39, 0x8d623e, 0x87613f, 0x6b4c34, 0x3f2a1b, 0x201209, 0x100100, 0x554234, 0x6a5040, 0x3d2316, 0x583824, 0x724d35, 0x7b573d, 0x8e643f, 0xa37346, 0xb08150, 0xa67749, 0x95653a, 0x98683a, 0x976638, 0x976839, 0x9c6e3d, 0x976c3f, 0x825930, 0x785533, 0x573f27, 0x312315, 0x190a01, 0x5e483a, 0x654736, 0x6a4b3a, 0x715542, 0x6f5742, 0x726351, 0x363228, 0x000000, 0x080a03, 0x080802, 0x080803, 0x080703, 0x0a0603, 0x080702, 0x060903, 0x060802, 0x070803, 0x060803, 0x060802, 0x060701, 0x040600, 0x030300, 0x020300, 0x030300, 0x020200, 0x020200, 0x010101, 0x020201, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x020201, 0x030301, 0x030300, 0x030301, 0x040401, 0x030400, 0x030300, 0x040501, 0x040500, 0x050601, 0x040701, 0x060702, 0x060802, 0x070904, 0x080a04, 0x090a04, 0x090b05, 0x0a0a05, 0x0c0b07, 0x0e0e08, 0x110e06, 0x171105, 0x1d1405, 0x302e29, 0x434243, 0x474549, 0x444345, 0x292827, 0x050500, 0x1d1b15, 0x35322b, 0x433f37, 0x49453c, 0x4c483f, 0x444038, 0x44423b, 0x3e3c36, 0x2c2a25, 0x242422, 0x2f3134, 0x34383c, 0x434950, 0x3f464c, 0x212629, 0x333637, 0x303130, 0x22201b, 0x272621, 0x302f2d, 0x323334, 0x2c2d2f, 0x313133, 0x353537, 0x373639, 0x343333, 0x33312f, 0x413d3a, 0x3f3c3a, 0x32302e, 0x33332f, 0x3e3a36, 0x554b41, 0x7d6c5a, 0x99826a, 0xad9474, 0xbb9f7a, 0xb39771, 0x9f825d, 0x9d7c58, 0xad8d65, 0xb49770, 0xb69b77, 0xbca585, 0xc8b697, 0xcfc1a4, 0xcbbea5, 0xbfb39a, 0xaa9c87, 0x8b7e6b, 0x72624f, 0x766552, 0x69533f, 0x4f3826, 0x523e2c, 0x4d3620, 0x745d47, 0x836c56, 0x5a4734, 0x574535, 0x5c4838, 0x664e3c, 0x684d3a, 0x614735, 0x423023, 0x322417, 0x6c513d, 0x5c412f, 0x452f21, 0x5d422f, 0x765a45, 0x624532, 0x6c503c, 0x5e4b3b, 0x5b4a3e, 0x5a4a3b, 0x5f4e3e, 0x685545, 0x725f4f, 0x705d4e, 0x655345, 0x59483b, 0x4a3c33, 0x362c24, 0x0f0400, 0x362318, 0x6b4d3b, 0x74533f, 0x694b38, 0x5e4738, 0x493a2f, 0x312922, 0x262119, 0x20150b, 0x5d503c, 0x433524, 0x493623, 0x8f775e, 0x6a503c, 0x5e4231, 0x664735, 0x81593b, 0x855630, 0x86552d, 0x92633b, 0x91623a, 0x8b5d36, 0x8a5f3c, 0x805a3b, 0x573923, 0x352112, 0x1d1007, 0x0e0100, 0x574538, 0x5e4738, 0x523828, 0x5a3c2a, 0x6a4935, 0x7f5b41, 0x9f7149, 0x996436, 0xa4703f, 0x936033, 0x8d5d30, 0x9c6e3d, 0xa87948, 0xa57849, 0x9c7140, 0x9c7343, 0x987246, 0x7a5a36, 0x563f29, 0x2e2115, 0x1b0d03, 0x664d3d, 0x70523e, 0x6c4e3b, 0x6c4f3b, 0x6e5740, 0x726350, 0x2d2921, 0x000100, 0x070803, 0x080703, 0x080603, 0x080603, 0x090702, 0x080702, 0x060802, 0x060803, 0x060702, 0x050602, 0x050601, 0x040501, 0x040500, 0x040500, 0x030500, 0x030300, 0x020200, 0x020201, 0x020200, 0x020200, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010102, 0x020201, 0x030301, 0x030301, 0x030301, 0x030201, 0x030300, 0x030400, 0x040500, 0x040500, 0x040601, 0x050601, 0x060702, 0x060702, 0x070803, 0x080a04, 0x080903, 0x080903, 0x090a04, 0x0b0a06, 0x0d0d07, 0x100e06, 0x151105, 0x1b1405, 0x2c2a24, 0x403f3e, 0x47464b, 0x47464b, 0x333233, 0x070701, 0x1c1b16, 0x333029, 0x3a3530, 0x48423b, 0x504b42, 0x4c473e, 0x46423b, 0x3d3b37, 0x404244, 0x33373c, 0x2b2e33, 0x1c2024, 0x363b40, 0x555d63, 0x464d51, 0x2a2f33, 0x3e4141, 0x2a2924, 0x302d26, 0x2f2b24, 0x272723, 0x2a2a29, 0x303032, 0x343437, 0x363638, 0x343335, 0x333130, 0x343231, 0x3a3837, 0x53514e, 0x3a3734, 0x363531, 0x32302c, 0x3e3934, 0x564c44, 0x76695b, 0x917e69, 0x9a8367, 0x9f876c, 0xab967a, 0xb9a589, 0xc0af92, 0xbbab90, 0xafa088, 0x9c8d76, 0x83725f, 0x695545, 0x594232, 0x56402f, 0x483220, 0x503b2c, 0x614a3b, 0x715b49, 0x594535, 0x554332, 0x554231, 0x5a432f, 0x6a523d, 0x614d3b, 0x5a493a, 0x5a4839, 0x584536, 0x584233, 0x594434, 0x3d2e22, 0x37281c, 0x735540, 0x5d412e, 0x301d0f, 0x4b3424, 0x533a28, 0x4e3422, 0x644b38, 0x604d3d, 0x5b493b, 0x5d4b3b, 0x574636, 0x594737, 0x584435, 0x4a3729, 0x3c2a1c, 0x331f10, 0x2e1d10, 0x1d1208, 0x1a140e, 0x1d1007, 0x614838, 0x70503c, 0x6d503c, 0x5a4436, 0x41342a, 0x2d2620, 0x231e19, 0x1a0e03, 0x695945, 0x4d3e2d, 0x4e3828, 0x725843, 0x5f4533, 0x7b6656, 0x755a46, 0x855a3a, 0x8d5b32, 0x99673b, 0x96663e, 0x875833, 0x7e4f2c, 0x6e4324, 0x634028, 0x664934, 0x493323, 0x21140b, 0x160902, 0x504033, 0x584537, 0x594435, 0x614938, 0x6f5542, 0x836248, 0x8b5e3b, 0x915d33, 0x996638, 0x916135, 0x9c6f41, 0xa27849, 0x8d6640, 0x58391f, 0x7f5e3c, 0x99754a, 0x8c6c46, 0x694f35, 0x402f20, 0x190f08, 0x190c04, 0x68513e, 0x715540, 0x674c36, 0x735841, 0x775f47, 0x675846, 0x15120d, 0x050702, 0x070802, 0x070702, 0x070602, 0x070502, 0x080602, 0x070602, 0x060701, 0x060802, 0x060701, 0x040601, 0x040600, 0x040501, 0x030400, 0x030400, 0x030400, 0x020200, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x020201, 0x010201, 0x010201, 0x030300, 0x030400, 0x030400, 0x020300, 0x030300, 0x030300, 0x030400, 0x040500, 0x040500, 0x050600, 0x060701, 0x070802, 0x070802, 0x080903, 0x080903, 0x090a04, 0x090a04, 0x0a0a05, 0x0d0c07, 0x100f07, 0x120f06, 0x121003, 0x23231c, 0x414141, 0x403f44, 0x3e3e43, 0x302f30, 0x080803, 0x10110c, 0x2f2d27, 0x403c36, 0x48423a, 0x4a443c, 0x423e37, 0x3d3832, 0x5b5e5f, 0x78848b, 0x515e67, 0x2b333b, 0x16191c, 0x121112, 0x222528, 0x41474a, 0x373c3e, 0x323536, 0x353534, 0x26231c, 0x332f27, 0x322f27, 0x292721, 0x21211f, 0x2c2c2c, 0x333334, 0x333334, 0x353434, 0x373635, 0x3c3a39, 0x504f4b, 0x373732, 0x3b3a36, 0x3a3834, 0x36332e, 0x302e29, 0x36332d, 0x544c45, 0x837361, 0xb39f85, 0x9e8a73, 0x8b7660, 0x715a45, 0x5f452f, 0x583b26, 0x563a26, 0x5d4230, 0x614837, 0x5c4637, 0x584537, 0x908174, 0x7b6c60, 0x4e3829, 0x6d5847, 0x584636, 0x564535, 0x544232, 0x5f4734, 0x6a513c, 0x644f3d, 0x5a4a3a, 0x554436, 0x584638, 0x5b4739, 0x584537, 0x3d2e24, 0x35261a, 0x70523c, 0x674933, 0x453223, 0x49382a, 0x544131, 0x533d2d, 0x654d3a, 0x564434, 0x433227, 0x3e2c20, 0x2f1d0f, 0x2f1b0a, 0x38200e, 0x432917, 0x492f1c, 0x4b321f, 0x44301f, 0x2c1f15, 0x19120b, 0x21140b, 0x5c4434, 0x6f513d, 0x694c3b, 0x594536, 0x3e3227, 0x2b251e, 0x1f1b15, 0x170c03, 0x332314, 0x322110, 0x4f3928, 0x664b38, 0x4b3323, 0x806d5d, 0x745b47, 0x815430, 0x915e33, 0x8b5a31, 0x8f6139, 0x8c5f38, 0x8b603b, 0x906746, 0x815d41, 0x664934, 0x3b2617, 0x190d04, 0x1b0e06, 0x493a2e, 0x4f4032, 0x584738, 0x655243, 0x6c5746, 0x7c5e45, 0x956b47, 0x94673d, 0x8c5f37, 0x916842, 0x744f2d, 0x563313, 0x48250c, 0x2e1007, 0x624a36, 0x5c432d, 0x4d3a27, 0x524230, 0x45372a, 0x1b120b, 0x180b02, 0x69523f, 0x684d37, 0x6e533c, 0x735942, 0x715941, 0x685b4b, 0x000000, 0x070903, 0x070802, 0x060801, 0x060601, 0x060601, 0x060601, 0x050500, 0x050600, 0x050700, 0x060701, 0x050601, 0x040601, 0x040500, 0x040501, 0x030400, 0x020300, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010100, 0x010100, 0x020202, 0x010101, 0x010100, 0x030300, 0x030500, 0x030400, 0x020200, 0x020300, 0x020300, 0x030400, 0x040500, 0x050601, 0x050701, 0x050701, 0x060802, 0x070802, 0x070802, 0x070903, 0x090a04, 0x0a0a05, 0x0a0b05, 0x0d0d07, 0x0f0f07, 0x100f06, 0x0e0f04, 0x1a1c15, 0x424342, 0x3f3f43, 0x3f4043, 0x363535, 0x0d0c06, 0x151511, 0x1c1c1a, 0x2a2825, 0x413d37, 0x4e4942, 0x49453d, 0x3a3630, 0x6a7073, 0x808f96, 0x72828e, 0x5c6a77, 0x394249, 0x212428, 0x1d1f1e, 0x191918, 0x272928, 0x2b2c2b, 0x3e3f3c, 0x2b2a27, 0x2e2b21, 0x38332c, 0x34302a, 0x312e26, 0x2a2822, 0x272724, 0x31312f, 0x353434, 0x383737, 0x3e3d3b, 0x393834, 0x2d2e28, 0x343532, 0x3c3b37, 0x33312c, 0x302e29, 0x30302a, 0x44433f, 0x5a4e42, 0x705743, 0x5b3a23, 0x664832, 0x664a36, 0x634734, 0x634837, 0x634936, 0x5e4433, 0x604838, 0x544034, 0x413228, 0x938376, 0xa39283, 0x4a3525, 0x6b5544, 0x594736, 0x534334, 0x574535, 0x5d4330, 0x664c39, 0x604b3a, 0x574638, 0x58483c, 0x59493c, 0x594739, 0x594639, 0x43352b, 0x302317, 0x6a4e39, 0x664833, 0x564230, 0x584636, 0x5c493a, 0x513c2d, 0x674e3a, 0x4d3725, 0x37200d, 0x432a17, 0x50351f, 0x563820, 0x55341c, 0x59381f, 0x614127, 0x624329, 0x503621, 0x322316, 0x191109, 0x2a1c12, 0x594131, 0x674c3a, 0x563d2c, 0x533f2f, 0x3b2f24, 0x2a241c, 0x262018, 0x241a11, 0x2a190c, 0x34200e, 0x5c4433, 0x634938, 0x4c3525, 0x483021, 0x60402b, 0x8c5f39, 0xa57647, 0xa57647, 0x996c40, 0x93663e, 0x895d39, 0x764d2e, 0x5d3b22, 0x4d321f, 0x352114, 0x1c0f06, 0x23170d, 0x493b2f, 0x504337, 0x5c4d40, 0x665648, 0x685546, 0x785c46, 0x906b4a, 0x8a6541, 0x613e20, 0x573419, 0x705134, 0x907352, 0x9f8260, 0xa48765, 0x9e7c59, 0x91704b, 0x8a6d4c, 0x745e43, 0x473727, 0x170d05, 0x2e2017, 0x6f5745, 0x674d37, 0x6d543c, 0x70573d, 0x735d44, 0x645747, 0x000000, 0x080904, 0x070803, 0x070802, 0x050701, 0x050600, 0x050701, 0x050600, 0x050700, 0x050600, 0x050601, 0x050601, 0x040501, 0x030401, 0x030301, 0x030301, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x010201, 0x010101, 0x000100, 0x020200, 0x020400, 0x020300, 0x020200, 0x020300, 0x030300, 0x030400, 0x040500, 0x040500, 0x040601, 0x050701, 0x060701, 0x060701, 0x070802, 0x070902, 0x080902, 0x090a04, 0x0a0c05, 0x0d0d08, 0x0e0f07, 0x0e0f06, 0x0d0e05, 0x13140b, 0x3e3f3d, 0x404145, 0x3f3e43, 0x3b3a3a, 0x12100b, 0x1d1d19, 0x2a2b29, 0x373635, 0x2e2b29, 0x33312c, 0x43423b, 0x403e39, 0x464a49, 0x575f62, 0x69757b, 0x7d8b95, 0x6b7984, 0x515c64, 0x3a4144, 0x3b3d3b, 0x31312b, 0x262620, 0x2b2b27, 0x3c3c37, 0x22201b, 0x363229, 0x38342b, 0x3b372d, 0x36342a, 0x32322b, 0x2d2e28, 0x2c2c28, 0x353531, 0x383835, 0x373733, 0x2e2e29, 0x333332, 0x393937, 0x33322d, 0x2e2e28, 0x32322d, 0x41403c, 0x5d534a, 0x705948, 0x664732, 0x684a36, 0x654733, 0x634733, 0x634936, 0x684e3c, 0x644a39, 0x5a4434, 0x4e3e34, 0x352821, 0x574336, 0x644d3d, 0x594335, 0x705a49, 0x564334, 0x534235, 0x5a4839, 0x56402f, 0x604c3b, 0x614f3f, 0x5e4e3f, 0x5e4f41, 0x59493b, 0x554437, 0x4b3c31, 0x352a22, 0x33271d, 0x6e5541, 0x614632, 0x5a4635, 0x5b4938, 0x584737, 0x4e3b2c, 0x674f3b, 0x5d432c, 0x583a21, 0x614125, 0x6d4a2b, 0x70492a, 0x7d5431, 0x885e3b, 0x895f3d, 0x7f5736, 0x5e3f25, 0x2f2011, 0x1e150d, 0x312116, 0x533b2c, 0x594231, 0x8d7b69, 0x665546, 0x32251a, 0x27221a, 0x312a21, 0x44362a, 0x35251a, 0x452e1f, 0x614633, 0x5c412f, 0x5a3f2a, 0x6b4b30, 0x815836, 0x8e5e34, 0x966435, 0x966436, 0x895b33, 0x885c36, 0x885e38, 0x88613e, 0x795637, 0x5c3f28, 0x3c2818, 0x1e1106, 0x2d2013, 0x544537, 0x564a3e, 0x63564a, 0x635446, 0x614f40, 0x795f4b, 0x684b33, 0x6b4d32, 0x7f6042, 0xa2815c, 0xba976d, 0xbf9c72, 0xb59066, 0xa67e50, 0xa3784a, 0x987041, 0x8d6a41, 0x6a5033, 0x3d2f1f, 0x100600, 0x413024, 0x715844, 0x644b34, 0x6d543b, 0x71583c, 0x766046, 0x615345, 0x000000, 0x070703, 0x070903, 0x060801, 0x060802, 0x060601, 0x050600, 0x050600, 0x040600, 0x040601, 0x030501, 0x030500, 0x030300, 0x020201, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020300, 0x030400, 0x020200, 0x030400, 0x040500, 0x040501, 0x040500, 0x050701, 0x060801, 0x060802, 0x070903, 0x080a03, 0x090b04, 0x0a0b05, 0x0a0c06, 0x0e0e09, 0x0f1009, 0x0f1007, 0x0e1005, 0x111206, 0x3e3e3b, 0x3b3b3d, 0x3f3e42, 0x3d3d3d, 0x0f0f09, 0x161613, 0x2a2a27, 0x34322e, 0x4c4945, 0x44403d, 0x2a2824, 0x41413c, 0x454641, 0x3f413e, 0x434a48, 0x5f6869, 0x727d84, 0x6a787e, 0x677174, 0x676966, 0x33312a, 0x121209, 0x13120b, 0x23221d, 0x292924, 0x2b261d, 0x3d362c, 0x3d382b, 0x3b392c, 0x3a382d, 0x333129, 0x2d2e26, 0x2a2b24, 0x2c2e28, 0x32342e, 0x353632, 0x3f3f3e, 0x3a3938, 0x31312d, 0x2f2f2a, 0x383833, 0x3d3c39, 0x5e554d, 0x776252, 0x6b4c38, 0x614533, 0x5d4132, 0x563c2d, 0x5e4536, 0x5e4737, 0x624d3c, 0x5e4b3a, 0x524438, 0x2b2119, 0x44352b, 0x473326, 0x5f4a3c, 0x5d4a3b, 0x564436, 0x554638, 0x544335, 0x5c4b39, 0x685645, 0x574637, 0x4f3f2f, 0x453627, 0x382c1e, 0x2d2318, 0x130f08, 0x000000, 0x362a21, 0x6e5744, 0x5c4330, 0x564130, 0x5c4534, 0x5e4837, 0x533f30, 0x715843, 0x77573d, 0x6f4d2e, 0x7b5634, 0x7d5431, 0x7c502e, 0x865833, 0x8a5d37, 0x7f5330, 0x6e4526, 0x52341c, 0x352515, 0x23190f, 0x36261c, 0x604839, 0x4d3a2b, 0x625141, 0x524132, 0x392b1e, 0x2e251c, 0x3a3025, 0x4d3d2f, 0x5c4739, 0x5a4132, 0x583d2c, 0x60422e, 0x795337, 0x7f5230, 0x85522b, 0x8e5d31, 0x9e6d3e, 0xa57541, 0xad814f, 0xa37949, 0xa07445, 0x91683e, 0x76512f, 0x62462d, 0x43311f, 0x1c0f03, 0x332518, 0x635443, 0x5c4f42, 0x615549, 0x655448, 0x604c3e, 0x7e624c, 0x9c7a5a, 0x9d7852, 0x987149, 0x916941, 0x8c6135, 0x926331, 0x9b6e3b, 0x9e733f, 0xa67a47, 0xa27b49, 0x99774b, 0x725a3a, 0x3d301f, 0x0d0400, 0x493727, 0x674f39, 0x5e452e, 0x604930, 0x70573c, 0x7d664d, 0x5b4e40, 0x000000, 0x070702, 0x070803, 0x070802, 0x060702, 0x050701, 0x040701, 0x040600, 0x040500, 0x030401, 0x030301, 0x030400, 0x030301, 0x030301, 0x030301, 0x020200, 0x020200, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010200, 0x020200, 0x020200, 0x020200, 0x030400, 0x020300, 0x030401, 0x040500, 0x040401, 0x040500, 0x050701, 0x060701, 0x060802, 0x060902, 0x080a03, 0x090a04, 0x0a0a05, 0x0a0b06, 0x0d0e09, 0x0f0f09, 0x0f0f07, 0x0f1007, 0x0e0f04, 0x363632, 0x393838, 0x353536, 0x3c3a3a, 0x161612, 0x10110c, 0x31302b, 0x3d3a35, 0x44403b, 0x4b4742, 0x4a4743, 0x575651, 0x3c3b35, 0x30312b, 0x3f403a, 0x4a4c45, 0x404440, 0x5c6362, 0x676b68, 0x3a3832, 0x0e0d07, 0x040501, 0x13130d, 0x1a1a13, 0x20201a, 0x26221a, 0x423b31, 0x4a4339, 0x403b31, 0x3c382d, 0x3e3b32, 0x333329, 0x2c2d26, 0x282823, 0x2a2b26, 0x32332f, 0x3b3b3a, 0x383736, 0x31312d, 0x32322d, 0x3a3936, 0x42413e, 0x5d554d, 0x786656, 0x674e3b, 0x614838, 0x563f31, 0x503c2e, 0x533f32, 0x544133, 0x523f31, 0x564436, 0x58483b, 0x45382c, 0x413327, 0x524033, 0x59483a, 0x4f4033, 0x554638, 0x534537, 0x3a2d1e, 0x372919, 0x332415, 0x2f2013, 0x352517, 0x3b2a1b, 0x3f3020, 0x352a1e, 0x1e1913, 0x010401, 0x342a20, 0x695240, 0x614833, 0x644b3a, 0x694e3c, 0x6c5341, 0x5b4535, 0x6d523c, 0x6e4d34, 0x674326, 0x78502e, 0x845a36, 0x865b34, 0x92653b, 0x93673d, 0x7c502e, 0x684224, 0x5c3e25, 0x422e1d, 0x281b10, 0x2f2116, 0x5f4a3b, 0x523c2e, 0x4a3525, 0x4c3828, 0x413023, 0x382c20, 0x4a3c30, 0x443529, 0x614b3d, 0x5d4334, 0x5a3e2d, 0x6a462e, 0x825532, 0x875832, 0x936338, 0x9f7041, 0xa87c49, 0xb48953, 0xa67b48, 0x9c7345, 0xa88151, 0x947046, 0x7e6141, 0x624d35, 0x3b2c1d, 0x150902, 0x392b1e, 0x685847, 0x605345, 0x5d4f44, 0x635145, 0x644f41, 0x795a40, 0x8c643e, 0x8e6032, 0x976837, 0x9c6e3c, 0xa27442, 0xaa7c47, 0xb28751, 0xb58c55, 0xb08851, 0xa27c4c, 0x8c6d45, 0x614c31, 0x2e2114, 0x130802, 0x4b3727, 0x674d38, 0x5b402a, 0x796250, 0x6f5841, 0x78624c, 0x4d4338, 0x000000, 0x080904, 0x070703, 0x060602, 0x040601, 0x040600, 0x040501, 0x030501, 0x030501, 0x030400, 0x030301, 0x030400, 0x030300, 0x020200, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x020201, 0x020202, 0x020202, 0x020201, 0x020200, 0x020200, 0x020100, 0x030301, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x050801, 0x060802, 0x060803, 0x070803, 0x080803, 0x080903, 0x090903, 0x0a0a05, 0x0c0d08, 0x0f0e0a, 0x0f0e09, 0x0d0e08, 0x080802, 0x30302c, 0x464647, 0x3c3a3d, 0x403c3a, 0x1d1b18, 0x100f0a, 0x24231e, 0x3e3934, 0x4c4640, 0x443e37, 0x4b4842, 0x56544f, 0x1e1c12, 0x0f0e09, 0x31312b, 0x373731, 0x44443d, 0x56564f, 0x45423b, 0x272521, 0x3d3d38, 0x090a05, 0x0a0b06, 0x1a1a15, 0x1e1d17, 0x19160e, 0x383228, 0x494339, 0x4c463b, 0x423d33, 0x38342b, 0x37352c, 0x2f3027, 0x282822, 0x23231d, 0x282823, 0x373633, 0x3e3d3c, 0x32312e, 0x373733, 0x3e3d3d, 0x464643, 0x4f473f, 0x6d5e4f, 0x584435, 0x5b4738, 0x544134, 0x4a392d, 0x4f3f33, 0x574436, 0x574436, 0x5c4b3c, 0x59483a, 0x564639, 0x594a3d, 0x46392d, 0x34291d, 0x2f251b, 0x30251a, 0x36291a, 0x3b2e1e, 0x3b2e1d, 0x41311f, 0x4d3a27, 0x513b2a, 0x523b28, 0x513d2b, 0x392c1e, 0x231d15, 0x050804, 0x30261d, 0x634e3c, 0x604a36, 0x604b39, 0x735b49, 0x6c5240, 0x523b2b, 0x624833, 0x69482e, 0x623e22, 0x6e4727, 0x8b623c, 0x92673d, 0x9a6e41, 0x93663b, 0x885c34, 0x7d5734, 0x66472c, 0x3c2815, 0x2e1f13, 0x26190d, 0x302014, 0x463324, 0x594232, 0x5b4333, 0x4c392b, 0x423428, 0x4b3c2f, 0x3d2b1e, 0x574031, 0x5e4231, 0x68442e, 0x7e5634, 0xad8559, 0xb38b5c, 0xa37b4c, 0xac8354, 0xad8555, 0xa17a4d, 0x906942, 0x85613f, 0x745637, 0x664e34, 0x5d4a37, 0x3e2e1e, 0x201408, 0x0a0100, 0x3b2d21, 0x645342, 0x5d4f42, 0x5a4b3e, 0x5f4d40, 0x624c3d, 0x836143, 0xa17447, 0xa97846, 0xad7e49, 0xb58753, 0xb2854f, 0xae814b, 0xad834f, 0x9e7645, 0x916d3f, 0x8a6a42, 0x846b48, 0x5f4d34, 0x322518, 0x0e0100, 0x5c4636, 0x6b503c, 0x523723, 0x8f7662, 0x846c56, 0x7a6450, 0x473e34, 0x000000, 0x070804, 0x060703, 0x060601, 0x050601, 0x040501, 0x040401, 0x030301, 0x030500, 0x030500, 0x030400, 0x030301, 0x020300, 0x020200, 0x020200, 0x020200, 0x020200, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000100, 0x000101, 0x010201, 0x010201, 0x010101, 0x010000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x020201, 0x010101, 0x020201, 0x020200, 0x020200, 0x020200, 0x030200, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x060701, 0x060702, 0x060803, 0x070903, 0x080903, 0x090903, 0x090903, 0x0a0a05, 0x0b0b06, 0x0d0d08, 0x0d0d08, 0x0c0c07, 0x050500, 0x2b2a28, 0x474748, 0x353436, 0x393836, 0x211f1c, 0x0f0f0a, 0x272521, 0x352f2a, 0x463e37, 0x4f463f, 0x4d4841, 0x434138, 0x1f1b0f, 0x20201b, 0x3a3a32, 0x2a2b22, 0x2b2c23, 0x444239, 0x3c372e, 0x22201c, 0x545352, 0x232324, 0x040501, 0x151610, 0x1b1b14, 0x1c1a11, 0x302c21, 0x413a30, 0x474338, 0x484338, 0x4b473c, 0x3e3c30, 0x333229, 0x2c2c25, 0x292923, 0x272721, 0x36342f, 0x3a3835, 0x383736, 0x333332, 0x3a3a3a, 0x444242, 0x49403a, 0x685a4d, 0x5d4d3d, 0x5c4c3d, 0x574639, 0x534234, 0x5a4638, 0x5c4738, 0x574335, 0x5b4a3a, 0x534334, 0x433529, 0x36291f, 0x2c1f12, 0x2f2213, 0x38291a, 0x40301f, 0x513e2b, 0x5c4631, 0x5b432d, 0x5d432d, 0x60452d, 0x65462f, 0x664832, 0x573e2a, 0x3b2b1d, 0x241e14, 0x0c0d08, 0x342920, 0x5c4837, 0x544231, 0x453425, 0x836f5b, 0x7a6552, 0x5e4534, 0x6e523b, 0x755234, 0x7c5636, 0x88613d, 0x885e37, 0x92643b, 0x9e7040, 0x9a6d41, 0x855a32, 0x77502e, 0x66472b, 0x462f19, 0x332212, 0x332416, 0x372516, 0x2d1c0c, 0x382417, 0x563f30, 0x523b2d, 0x473527, 0x513b2d, 0x5a4130, 0x563723, 0x5d3921, 0x7d5635, 0x9d754d, 0xa68055, 0x97734b, 0x805e3b, 0x6b4a2a, 0x5f4024, 0x5d422b, 0x785f44, 0x937959, 0x9c825f, 0x9e835f, 0x967c5a, 0x624d31, 0x362715, 0x130800, 0x3c2e22, 0x614f40, 0x645245, 0x604f42, 0x5d4a3d, 0x61493a, 0x846042, 0xa37548, 0xa57544, 0xa0703f, 0xa37442, 0x9a6c3c, 0x926838, 0x91683c, 0x956f45, 0x977549, 0x9a7f52, 0x8e774f, 0x68573b, 0x34291b, 0x150200, 0x5c4432, 0x634834, 0x3f281a, 0x59402b, 0x6d533c, 0x7b6753, 0x3e372e, 0x000000, 0x070702, 0x060702, 0x050501, 0x050501, 0x040500, 0x040401, 0x030400, 0x030500, 0x030500, 0x030400, 0x020200, 0x020200, 0x010100, 0x010101, 0x020200, 0x020201, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x020202, 0x020202, 0x020201, 0x020200, 0x020200, 0x020200, 0x020200, 0x030400, 0x030400, 0x030400, 0x040500, 0x040500, 0x050701, 0x050702, 0x060803, 0x070902, 0x080802, 0x080803, 0x090803, 0x090a04, 0x0b0b06, 0x0b0b07, 0x0c0c08, 0x0c0b07, 0x050500, 0x262523, 0x404041, 0x353335, 0x393836, 0x282623, 0x0f0f09, 0x282923, 0x35302b, 0x362e28, 0x433b33, 0x4f4941, 0x433d35, 0x231c0f, 0x2f2d28, 0x3c3b34, 0x2f2e26, 0x2b291f, 0x2a271d, 0x322d23, 0x0a0800, 0x4e4e4f, 0x424346, 0x020300, 0x0c0e08, 0x12130d, 0x19170f, 0x2d281f, 0x352e26, 0x403b31, 0x413e34, 0x403d34, 0x423f35, 0x3f3e35, 0x3c3c35, 0x34342d, 0x2e2d26, 0x34312b, 0x383633, 0x343334, 0x363537, 0x363536, 0x3e3c3b, 0x433c36, 0x5f5146, 0x5a4a3e, 0x5f4f42, 0x5f4e41, 0x594738, 0x5e4636, 0x5a4131, 0x594435, 0x5a4a3c, 0x34251a, 0x301f12, 0x3e2d1e, 0x463122, 0x4f3725, 0x563c28, 0x594029, 0x654930, 0x725338, 0x705033, 0x6f4d2f, 0x7f5c3c, 0x7f5b3d, 0x69472f, 0x543a26, 0x3a2b1d, 0x221d13, 0x090b06, 0x32291f, 0x604d3c, 0x473625, 0x3b2d1e, 0x493727, 0x5c4937, 0x574230, 0x775b43, 0x8b6645, 0x936945, 0x8d6340, 0x8d623a, 0x96693d, 0x9b6c3f, 0x8f6239, 0x885d36, 0x855f3b, 0x775739, 0x50341c, 0x3e2915, 0x341f0e, 0x37210d, 0x36210f, 0x341e0f, 0x341f10, 0x392316, 0x593e2f, 0x603f2c, 0x714d35, 0x775035, 0x80593c, 0x886445, 0x7b5a3d, 0x61432b, 0x5f4329, 0x765c3e, 0x957a59, 0xac8e69, 0xbb9a70, 0xba976c, 0xad8a5e, 0xa37e50, 0x9e7b4b, 0x947448, 0x6e5536, 0x332512, 0x100500, 0x3f3025, 0x634e3f, 0x5f4a3d, 0x5f4c3f, 0x5b4639, 0x644a3a, 0x856042, 0x986b40, 0x98683b, 0x895930, 0x8b5c33, 0x8e6136, 0x977040, 0x967042, 0x997648, 0x9a7a4b, 0x92764a, 0x76613e, 0x5c4b32, 0x2f2014, 0x2a1408, 0x614834, 0x6a4d38, 0x4f3525, 0x583c2a, 0x735741, 0x756352, 0x312b24, 0x000000, 0x070703, 0x070602, 0x050501, 0x040600, 0x040500, 0x040500, 0x030400, 0x040500, 0x030500, 0x020400, 0x020100, 0x010101, 0x020201, 0x020201, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000001, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x020202, 0x020201, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x030400, 0x030400, 0x030400, 0x040500, 0x040601, 0x060702, 0x070802, 0x070903, 0x070902, 0x080802, 0x080903, 0x080903, 0x090903, 0x090a04, 0x0b0a05, 0x0b0a06, 0x0a0a05, 0x040400, 0x22221f, 0x3a3a3b, 0x2f2f33, 0x3a3a3a, 0x2d2b28, 0x10100a, 0x23241e, 0x302c26, 0x433a32, 0x4b4239, 0x4b443d, 0x4c473e, 0x2c2319, 0x323029, 0x3d3b34, 0x2b2922, 0x28251c, 0x262319, 0x2a261d, 0x231e16, 0x464646, 0x5e6064, 0x1a1b1c, 0x0f1009, 0x151510, 0x16140e, 0x27221a, 0x352f27, 0x3b362f, 0x3d3a31, 0x48453a, 0x433f37, 0x36342c, 0x3d3c36, 0x3b3b34, 0x393830, 0x2e2c25, 0x383735, 0x303031, 0x333234, 0x353435, 0x3c3837, 0x403832, 0x584a3f, 0x4c3c31, 0x5e4e42, 0x5b4a3d, 0x5c4638, 0x5b4031, 0x5b4131, 0x614b3c, 0x413025, 0x3a2517, 0x473121, 0x553c29, 0x5b3d29, 0x65452f, 0x68482f, 0x6b4a30, 0x735135, 0x7f5c3e, 0x7d5939, 0x815a38, 0x815a37, 0x744f30, 0x65452c, 0x533b27, 0x382a1c, 0x221c12, 0x080a04, 0x392f24, 0x715e4a, 0x463526, 0x2e1f11, 0x3f2d1d, 0x493727, 0x4c3929, 0x785c42, 0x86603f, 0x8a5f38, 0x93673d, 0xa37547, 0x9f7041, 0x895a31, 0x794a26, 0x714623, 0x744e2c, 0x714f30, 0x67482c, 0x62472c, 0x5b4127, 0x61472e, 0x573f27, 0x523b24, 0x4a331f, 0x321c0b, 0x573c2b, 0x7b573f, 0x764e33, 0x643d25, 0x614129, 0x77593e, 0x957752, 0xb29164, 0xc3a06c, 0xc8a36b, 0xb38c5b, 0xa47949, 0x9c6c39, 0x9a6a35, 0xa0723f, 0x9e7441, 0x95703f, 0x8a683c, 0x674d2b, 0x3b2c17, 0x120500, 0x47372c, 0x644f3f, 0x5a4132, 0x5b4234, 0x5d4336, 0x6f5441, 0x8d684a, 0x8e623a, 0x916338, 0x8e6035, 0x95683c, 0x986d3f, 0x997244, 0x906b3f, 0x927143, 0x9c7c4f, 0x947a50, 0x816c4c, 0x574630, 0x2b1b0f, 0x2a1306, 0x624734, 0x71533c, 0x70523b, 0x6d513a, 0x725741, 0x766656, 0x241f18, 0x020300, 0x060702, 0x060602, 0x040501, 0x040600, 0x050601, 0x050701, 0x040500, 0x040500, 0x040500, 0x030300, 0x010200, 0x020201, 0x030303, 0x020202, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x000100, 0x010101, 0x010101, 0x010101, 0x020202, 0x020201, 0x020201, 0x020200, 0x020200, 0x020200, 0x020200, 0x030400, 0x030400, 0x030400, 0x040400, 0x040601, 0x060702, 0x050801, 0x050802, 0x060802, 0x080802, 0x080903, 0x070802, 0x080803, 0x070803, 0x090904, 0x0a0904, 0x0a0a05, 0x070702, 0x1a1b18, 0x373839, 0x2d2e32, 0x3c3c3f, 0x2f2e2c, 0x0d0d06, 0x1c1b16, 0x2b2721, 0x40382f, 0x50463c, 0x554e47, 0x514b44, 0x342c23, 0x322f29, 0x37362e, 0x242019, 0x242119, 0x252219, 0x242019, 0x221e18, 0x2b2a29, 0x5c5f63, 0x393c3f, 0x0f100a, 0x181812, 0x110f08, 0x231f17, 0x332d26, 0x3a352f, 0x3a362f, 0x3c372f, 0x454139, 0x46443b, 0x3e3c34, 0x3a3932, 0x3e3c35, 0x35332d, 0x393836, 0x353535, 0x373637, 0x393838, 0x3b3937, 0x3f3733, 0x6b5c50, 0x5e4d3e, 0x5e4c3e, 0x594739, 0x594235, 0x53392a, 0x543d2e, 0x5f4a3c, 0x4f3a2a, 0x553b29, 0x583c28, 0x60402a, 0x63412b, 0x654229, 0x67452b, 0x68462a, 0x745235, 0x745132, 0x7d5b3b, 0x7d5c3a, 0x805e3d, 0x7a5839, 0x6b4e34, 0x483320, 0x2d2215, 0x1c1910, 0x050803, 0x3d3126, 0x6f5b48, 0x564432, 0x3d2c1b, 0x533f2d, 0x503f2f, 0x4d3c2c, 0x73553c, 0x845d3b, 0x875b33, 0x95673b, 0x9a6d3e, 0xa17244, 0x97693d, 0x956940, 0x926841, 0x8b643f, 0x85613e, 0x7b5a3b, 0x745538, 0x725438, 0x6b5035, 0x644b33, 0x604832, 0x493421, 0x2e1a0b, 0x351908, 0x7f5a3f, 0x966b48, 0x9f734d, 0xb4895c, 0xc39865, 0xbb9059, 0xb38549, 0xae7f3d, 0xb2823d, 0xab7a39, 0xa7753c, 0xa4723c, 0xa57541, 0x9e713f, 0xa37a47, 0xa07948, 0x957245, 0x795e39, 0x402f19, 0x110300, 0x4b3b2e, 0x6a5241, 0x583d2d, 0x756155, 0x695246, 0x715541, 0x8d6647, 0x92633b, 0x97663b, 0x9b6b3c, 0x996a3b, 0x9a6e3e, 0x966e40, 0x8e6a3f, 0x826137, 0x856640, 0x745938, 0x5d472d, 0x443321, 0x25160c, 0x2a1508, 0x6c503b, 0x76563e, 0x73553c, 0x70553a, 0x745b42, 0x706050, 0x090a01, 0x060801, 0x060802, 0x060701, 0x050601, 0x050601, 0x050701, 0x050701, 0x040501, 0x030500, 0x030400, 0x020200, 0x010100, 0x020201, 0x020201, 0x020201, 0x020100, 0x020100, 0x010100, 0x010101, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010101, 0x010100, 0x010101, 0x010101, 0x000000, 0x020202, 0x030302, 0x030300, 0x030301, 0x020200, 0x010100, 0x020201, 0x030400, 0x030400, 0x030400, 0x030400, 0x030500, 0x040701, 0x060802, 0x050600, 0x050701, 0x060802, 0x070802, 0x070803, 0x070803, 0x070903, 0x090904, 0x0a0904, 0x0b0a05, 0x0a0804, 0x141510, 0x333434, 0x2c2d32, 0x38383c, 0x313030, 0x080801, 0x1a1b15, 0x2c2a23, 0x3b332b, 0x493e35, 0x554f47, 0x504c47, 0x37312b, 0x26231d, 0x33312a, 0x25231b, 0x232017, 0x29251b, 0x302b23, 0x25221c, 0x1b1a15, 0x4a4c51, 0x46494e, 0x131512, 0x161610, 0x18160f, 0x1c160f, 0x272019, 0x312b22, 0x3c362e, 0x453d35, 0x463f37, 0x3f3b32, 0x48443c, 0x45433b, 0x3d3a34, 0x32312d, 0x363533, 0x373737, 0x343435, 0x3d3c3a, 0x3b3837, 0x3e362f, 0x6f5f51, 0x604c3d, 0x5f4c3d, 0x5e4c3d, 0x574334, 0x4f3728, 0x50392b, 0x614d3e, 0x5b4333, 0x543725, 0x52331f, 0x5b3b27, 0x62422b, 0x65462e, 0x715237, 0x75563b, 0x735439, 0x6e5033, 0x74573b, 0x6c5134, 0x6a4d30, 0x614427, 0x664b2f, 0x5c4730, 0x382e20, 0x1e1a12, 0x030402, 0x3d3226, 0x665240, 0x5d4b3a, 0x554231, 0x553f2c, 0x584637, 0x513f31, 0x6d5039, 0x805a38, 0x91683e, 0xaa7f4f, 0xbc9361, 0xc09663, 0xb68857, 0x9d7346, 0x966c43, 0x8b6440, 0x805d3c, 0x69492e, 0x533723, 0x442b1b, 0x3b2416, 0x442d1b, 0x452d1b, 0x321b0d, 0x301a0c, 0x4e2a15, 0x7f5235, 0x915f36, 0x9c6836, 0xb68247, 0xc08b48, 0xc6934f, 0xc79550, 0xbe8d49, 0xbe8f49, 0xb58445, 0xa6753c, 0xa87840, 0xa3733f, 0x9e713f, 0xa27845, 0x98703e, 0x8c693d, 0x735836, 0x3c2b17, 0x0d0000, 0x4e3e31, 0x695241, 0x40281b, 0x8e786b, 0x836a5c, 0x6e4d38, 0x8f6442, 0x8d5c33, 0x8e5c30, 0x9f7041, 0x9d6f40, 0x9e7444, 0x9c7647, 0x7b5730, 0x72512d, 0x775936, 0x71583b, 0x56422c, 0x3e2c1e, 0x23130b, 0x2f180c, 0x725540, 0x77573e, 0x74553b, 0x74593d, 0x775e45, 0x645546, 0x000000, 0x080902, 0x070802, 0x060701, 0x050702, 0x050702, 0x040701, 0x050601, 0x040501, 0x030500, 0x030500, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x020202, 0x020201, 0x020201, 0x020200, 0x020200, 0x010100, 0x020200, 0x030300, 0x030400, 0x030500, 0x030400, 0x020500, 0x040601, 0x050701, 0x050600, 0x050600, 0x070702, 0x070802, 0x070802, 0x070802, 0x070803, 0x080803, 0x090804, 0x0b0905, 0x0b0905, 0x0f0f09, 0x313131, 0x36363b, 0x404044, 0x363433, 0x090702, 0x141610, 0x2c2a22, 0x413930, 0x453b32, 0x554e48, 0x4f4c49, 0x393532, 0x24221e, 0x3a3932, 0x2a2720, 0x221d14, 0x2b261d, 0x332d25, 0x39342b, 0x2e2b24, 0x414345, 0x4b4f53, 0x1e201e, 0x0c0d07, 0x191812, 0x1f1b14, 0x272019, 0x2e271e, 0x352c24, 0x3f372e, 0x50483e, 0x4e463c, 0x3f3a32, 0x3c3932, 0x3f3b36, 0x34322e, 0x2f2e2e, 0x303032, 0x323231, 0x363332, 0x3f3b38, 0x423a34, 0x615042, 0x5a4636, 0x5f4a3b, 0x5f4d3d, 0x554232, 0x4d3222, 0x5c4434, 0x6e5949, 0x5c4637, 0x513726, 0x5f432f, 0x71543d, 0x6a4e37, 0x6b503a, 0x6a5039, 0x5d4630, 0x563c27, 0x5b412a, 0x5f442c, 0x604529, 0x684b2c, 0x735733, 0x765938, 0x624a32, 0x443728, 0x242018, 0x000000, 0x392e23, 0x5f4e3d, 0x5c4b3b, 0x5a4838, 0x5a4531, 0x554232, 0x514030, 0x6d5037, 0x845f39, 0x9d7448, 0xab8052, 0xb38b5c, 0xaa8255, 0x9c7248, 0x7f5b39, 0x624126, 0x50311c, 0x452614, 0x533a25, 0x765d43, 0x8e7050, 0x977551, 0x916c4a, 0x835d3e, 0x57331b, 0x431f08, 0x815b3d, 0x966439, 0xac7842, 0xc69455, 0xc89554, 0xc18c4a, 0xb68041, 0xbd8947, 0xc3914c, 0xc2924b, 0xbb8c4a, 0xb38446, 0xad7f45, 0xa57742, 0x9f7442, 0x9b7240, 0x966e3f, 0x89653c, 0x694e31, 0x301f10, 0x0d0000, 0x534033, 0x5f4739, 0x32180c, 0x5d3a27, 0x5f3d2b, 0x69462f, 0x8d6240, 0x8f6138, 0x996a3f, 0x976a3e, 0x845930, 0x7f5830, 0x7d5a33, 0x6e4b28, 0x866642, 0x90724d, 0x7c6243, 0x59442f, 0x372519, 0x221009, 0x382015, 0x765943, 0x74553d, 0x6e5037, 0x765b3f, 0x765d44, 0x554638, 0x000000, 0x090902, 0x060601, 0x060702, 0x050702, 0x040702, 0x050701, 0x050601, 0x040500, 0x030500, 0x030500, 0x030301, 0x020301, 0x030301, 0x030301, 0x020200, 0x020200, 0x020100, 0x010100, 0x010100, 0x010100, 0x000100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010101, 0x010102, 0x020102, 0x020202, 0x020201, 0x020201, 0x020200, 0x030301, 0x020301, 0x030400, 0x020300, 0x030400, 0x030500, 0x040600, 0x040600, 0x050600, 0x050601, 0x070903, 0x070803, 0x070801, 0x070802, 0x070803, 0x080903, 0x090904, 0x0a0a03, 0x0b0a05, 0x0b0b05, 0x30312f, 0x37383a, 0x403f40, 0x3e3b38, 0x0d0c06, 0x161712, 0x282720, 0x3c352c, 0x433930, 0x4f4641, 0x514d4b, 0x383835, 0x191714, 0x36332d, 0x2e2b22, 0x28231a, 0x2d261d, 0x393128, 0x393229, 0x342f27, 0x3d3d3d, 0x484b4e, 0x272927, 0x171813, 0x0e0f0a, 0x100f09, 0x26231c, 0x413a31, 0x423a30, 0x3c342a, 0x433b31, 0x4a4137, 0x4a443a, 0x423d35, 0x35322c, 0x302e2b, 0x302f2f, 0x37363a, 0x4e4d4b, 0x3a3633, 0x403b38, 0x48403a, 0x5e4e40, 0x5b4535, 0x544031, 0x564538, 0x7d6b5c, 0x8a7666, 0x593f2f, 0x725e4c, 0x65503e, 0x614734, 0x6b4f3b, 0x664b35, 0x5c422e, 0x5f4530, 0x684e36, 0x71573b, 0x725538, 0x765839, 0x775a38, 0x7c5d3a, 0x84643f, 0x85643e, 0x7a5a39, 0x61472d, 0x463828, 0x262018, 0x050502, 0x32291f, 0x554435, 0x5d4c3c, 0x5d4c3d, 0x5d4834, 0x5a4434, 0x534031, 0x816346, 0x926d48, 0x8d6742, 0x835f3b, 0x6f4f30, 0x604127, 0x5e3f28, 0x6e523a, 0x866849, 0x9e7f5c, 0xb79770, 0xc09e73, 0xb79367, 0xaa8257, 0x90643c, 0x875932, 0x8f6038, 0x895c35, 0x895a32, 0xa67647, 0xb8864d, 0xc29050, 0xc3914f, 0xc69451, 0xc58e4e, 0xb98143, 0xb57f42, 0xb98747, 0xb88945, 0xb18543, 0xb08448, 0xb4874c, 0xa97a44, 0xa77a48, 0xa17a4a, 0x906a3f, 0x73512f, 0x533a23, 0x2f1f13, 0x170600, 0x5d483b, 0x634736, 0x442613, 0x52301e, 0x55311d, 0x76523a, 0x81593a, 0x825631, 0x835732, 0x7f5532, 0x744b2a, 0x694121, 0x83603c, 0x94734a, 0x8a6944, 0x775738, 0x62462c, 0x533d29, 0x332217, 0x1f0d07, 0x3c261b, 0x795c48, 0x70503a, 0x6b4b34, 0x705236, 0x785f45, 0x554539, 0x000000, 0x000000, 0x000000, 0x000000, 0x070701, 0x050801, 0x050601, 0x040501, 0x050601, 0x050500, 0x040400, 0x040400, 0x030400, 0x030301, 0x030301, 0x030201, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x010101, 0x010101, 0x010201, 0x020303, 0x020202, 0x020200, 0x030300, 0x020301, 0x030400, 0x030400, 0x030400, 0x040500, 0x030500, 0x040601, 0x050601, 0x060600, 0x070802, 0x070702, 0x070702, 0x090803, 0x090904, 0x0a0905, 0x0a0905, 0x0a0a05, 0x0b0b06, 0x090702, 0x313130, 0x3c3a3c, 0x413f3f, 0x403c38, 0x16140c, 0x15160f, 0x26261e, 0x3d372e, 0x473d35, 0x49413a, 0x504c4b, 0x414040, 0x161512, 0x2c2823, 0x252119, 0x28221a, 0x322a21, 0x3a3229, 0x3f372d, 0x3d362d, 0x3c3a38, 0x424444, 0x272724, 0x1b1b16, 0x1e201b, 0x161613, 0x161615, 0x27241e, 0x413b32, 0x483f36, 0x4a4035, 0x4c4238, 0x473f34, 0x464036, 0x3b3831, 0x33322e, 0x363536, 0x414144, 0x464343, 0x2e2926, 0x3a3632, 0x473e3a, 0x5e4e42, 0x5e493a, 0x47372c, 0x392b23, 0x776455, 0x978371, 0x4f3726, 0x624c3d, 0x544031, 0x5a422d, 0x6c4f38, 0x72533a, 0x715338, 0x705136, 0x735539, 0x795b3d, 0x7e5f3e, 0x81613d, 0x85643f, 0x7f5d38, 0x7a5733, 0x74512d, 0x6d4a2b, 0x5c4027, 0x473524, 0x292117, 0x0c0b06, 0x362a21, 0x594638, 0x614f40, 0x5e4e3d, 0x5f4a39, 0x5a4434, 0x634d3d, 0x6e5138, 0x583920, 0x553b27, 0x695039, 0x806045, 0x906b4a, 0xa17b57, 0xa7805a, 0xa67f57, 0xa07950, 0xa47d51, 0xa37848, 0x8d5e30, 0x89592e, 0x8e5c32, 0x99683b, 0x9f6f41, 0x9f6f40, 0xa37040, 0xb07b45, 0xba854b, 0xbe8a4b, 0xb58043, 0xb47d42, 0xb2783f, 0xac723c, 0xa86f39, 0xae793d, 0xbe8f4e, 0xb98c4c, 0xb5884c, 0xa67841, 0xa1723e, 0xa57745, 0x956a3f, 0x8d643c, 0x7f5c38, 0x60472e, 0x2e1e11, 0x1d0c03, 0x634c3d, 0x6b4b37, 0x6b472e, 0x724f36, 0x67432d, 0x7f5c44, 0x815b3f, 0x7e5435, 0x7b5233, 0x7a5333, 0x7d5635, 0x7d5936, 0x815e3a, 0x704f2f, 0x735334, 0x846240, 0x826242, 0x5d442f, 0x2c1c12, 0x1b0b05, 0x3c251a, 0x6f513e, 0x6b4a35, 0x6e4c35, 0x735337, 0x7a5f43, 0x8f7b5d, 0x817153, 0x6b5f48, 0x4d4534, 0x25201a, 0x000000, 0x000000, 0x080802, 0x060702, 0x060601, 0x050400, 0x050301, 0x040301, 0x040401, 0x030301, 0x030301, 0x020200, 0x020101, 0x020101, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x000201, 0x020202, 0x030300, 0x030201, 0x030303, 0x030301, 0x030301, 0x030400, 0x040500, 0x030500, 0x050601, 0x060702, 0x060701, 0x070802, 0x070702, 0x080703, 0x0a0804, 0x0b0a05, 0x0c0b06, 0x0c0b06, 0x0e0c07, 0x0c0b07, 0x060601, 0x2e2e2d, 0x3b3a3b, 0x3f3b3a, 0x44403a, 0x1e1b14, 0x10100a, 0x23221a, 0x3b352b, 0x423830, 0x50463f, 0x504a48, 0x484748, 0x252424, 0x2d2923, 0x2e2a23, 0x241f18, 0x28231a, 0x312a21, 0x3f372d, 0x463d34, 0x413d38, 0x41423f, 0x2b2a25, 0x181813, 0x21221d, 0x191914, 0x2d2b29, 0x2c2b29, 0x1e1d1a, 0x332d27, 0x4c433a, 0x4e4339, 0x4e4439, 0x453d34, 0x36332d, 0x302f2b, 0x383837, 0x38383b, 0x2c2829, 0x24201d, 0x433f3c, 0x443e38, 0x57483c, 0x594637, 0x493a2e, 0x292019, 0x4b3b30, 0x584436, 0x654a3a, 0x644b3a, 0x594131, 0x634833, 0x6b4d36, 0x73533c, 0x6a4a30, 0x6a4a30, 0x725336, 0x765638, 0x725030, 0x7c5834, 0x78542d, 0x7a552f, 0x865f39, 0x7e5631, 0x764f2d, 0x69482e, 0x523b2a, 0x2f241a, 0x0b0804, 0x453a2e, 0x695546, 0x5c483a, 0x5a493a, 0x594637, 0x5a4637, 0x634e3d, 0x927458, 0xaa8865, 0xb4916a, 0xaf8961, 0x9c724b, 0x92673d, 0x9b6c40, 0x906032, 0xa17241, 0xa87b4a, 0x8b5b2d, 0x85552a, 0x86562f, 0x8c5e35, 0x95663b, 0x9b6c3d, 0xac7d4c, 0xae7c4b, 0xa37040, 0xa16a3b, 0xa46c39, 0xb07841, 0xae7740, 0xaa713e, 0xaa6d3a, 0xab6f39, 0xae773d, 0xaf7a3f, 0xbe8d4f, 0xb8884c, 0xab7a42, 0xa87744, 0xa17242, 0x9e6d3f, 0x956536, 0x95693c, 0x8f6a42, 0x62472c, 0x271508, 0x231209, 0x5f4637, 0x6e4f38, 0x7f5a41, 0x755137, 0x6a4833, 0x805f47, 0x6a472e, 0x6b462a, 0x755033, 0x7c593a, 0x704e34, 0x705034, 0x8c6c4c, 0x9b7855, 0x97724e, 0x7e5c3a, 0x63472e, 0x3f2a1b, 0x24160e, 0x130400, 0x40291e, 0x664835, 0x6c4a34, 0x6f4b33, 0x715135, 0x7b603f, 0xc7ac76, 0xd2b577, 0xd3b97e, 0xc8b07a, 0xbba779, 0x968666, 0x463e2e, 0x000000, 0x070803, 0x060602, 0x060601, 0x050601, 0x050501, 0x040402, 0x030301, 0x040402, 0x030301, 0x020200, 0x020200, 0x020201, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020201, 0x030301, 0x020201, 0x030303, 0x030301, 0x030301, 0x030400, 0x030500, 0x040500, 0x060701, 0x070903, 0x070802, 0x080903, 0x080703, 0x080703, 0x040402, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x212122, 0x3e3d3d, 0x3a3736, 0x453f3b, 0x26221b, 0x0b0c05, 0x12130e, 0x322d27, 0x463e36, 0x483e37, 0x544c4a, 0x4f4d50, 0x363638, 0x1b1915, 0x332e28, 0x261f17, 0x251e17, 0x2a241c, 0x362e26, 0x3c342c, 0x403b36, 0x403f3b, 0x25211c, 0x191813, 0x25251f, 0x1b1912, 0x27221c, 0x403b37, 0x484643, 0x353433, 0x24201d, 0x3e372f, 0x4c433a, 0x473f34, 0x36322d, 0x2d2d28, 0x393a3a, 0x3a3b3e, 0x302f31, 0x2d2d2d, 0x43423f, 0x44403a, 0x58493d, 0x5c483a, 0x4d3d31, 0x261f1a, 0x2b231d, 0x49372c, 0x664c3c, 0x6b523f, 0x5b4333, 0x5b402d, 0x6a4b35, 0x6a4932, 0x6a472f, 0x6d4b2f, 0x714e30, 0x724e30, 0x75502e, 0x8c6741, 0xa07a4f, 0xa88152, 0xa77f4f, 0x9f7648, 0x946c44, 0x7b5839, 0x563e2b, 0x2b2015, 0x100a04, 0x483b30, 0x6e5a4b, 0x5b4738, 0x5e4c3d, 0x5b4a3b, 0x524133, 0x5d4937, 0x8e6e4d, 0x966d44, 0x8d6035, 0x8a5a2c, 0xb28555, 0xbb905c, 0xac7b48, 0xa2713e, 0xa67945, 0xa77b43, 0xa27440, 0x9c6d3e, 0x95683d, 0x9b6e43, 0x9f7243, 0xa07242, 0xa37344, 0xa06f41, 0x976439, 0x996237, 0xa97342, 0xb47e47, 0xa5703b, 0xa7703c, 0xab713c, 0xb57e44, 0xc38d4f, 0xbe894c, 0xb58248, 0xa77541, 0x9d6c3d, 0x9e6b3c, 0x956034, 0x946136, 0x976538, 0x94663b, 0x8e6944, 0x5a422a, 0x231208, 0x2b1910, 0x604637, 0x6a4c36, 0x6f4c33, 0x67452b, 0x6f5038, 0x7e6048, 0x5f3d24, 0x69472e, 0x694b32, 0x75573f, 0x826146, 0x8b694b, 0x8b6b4d, 0x755438, 0x634027, 0x684931, 0x674d38, 0x554131, 0x312318, 0x110100, 0x4a3429, 0x684937, 0x6d4a34, 0x734e35, 0x6d4b2f, 0x80643d, 0xd0b06f, 0xdcb86b, 0xdcba6e, 0xd0b169, 0xd0b26d, 0xd0b678, 0xbca77b, 0x463e31, 0x000000, 0x060701, 0x070702, 0x070802, 0x050601, 0x030400, 0x030301, 0x030301, 0x030301, 0x030300, 0x020201, 0x020201, 0x010101, 0x000100, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x020201, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010102, 0x020201, 0x020200, 0x020200, 0x030303, 0x030301, 0x030301, 0x030400, 0x040601, 0x050701, 0x060802, 0x060702, 0x060703, 0x090905, 0x0a0602, 0x000000, 0x18130e, 0x3f3528, 0x534432, 0x5f4d3a, 0x6f5b44, 0x6e5c43, 0x73634a, 0x5f5342, 0x3d3b37, 0x363330, 0x3f3935, 0x2b2620, 0x0f0f09, 0x21221e, 0x1e1d1b, 0x322d28, 0x4d453f, 0x514a47, 0x4f4d50, 0x4c4d51, 0x1f1f1e, 0x36312b, 0x2e251d, 0x251d15, 0x29221a, 0x302921, 0x362e27, 0x38332e, 0x3e3b34, 0x29241c, 0x1c1a15, 0x27251f, 0x1d1a13, 0x282119, 0x312820, 0x39322c, 0x3d3836, 0x34312f, 0x1a1917, 0x2f2a24, 0x453e35, 0x39342d, 0x2d2b26, 0x323334, 0x33353a, 0x2e2f33, 0x303033, 0x383837, 0x413d38, 0x594c40, 0x614c3e, 0x5a4639, 0x43352c, 0x4e4036, 0x584438, 0x5e4637, 0x664e3d, 0x5d4637, 0x593d29, 0x63422c, 0x5f3d26, 0x6b4628, 0x77512d, 0x7b5833, 0x88653e, 0x946f46, 0x9e794e, 0xa98457, 0xa88356, 0xa07d51, 0x94744e, 0x7e6041, 0x5e442d, 0x3b291a, 0x20150b, 0x161007, 0x43372b, 0x574335, 0x5e4a3c, 0x604d3f, 0x59483a, 0x534336, 0x624e3e, 0x856345, 0x8f653a, 0x906437, 0x9e7041, 0xa37442, 0x976837, 0x936032, 0x946436, 0xa07542, 0xa77d44, 0xa47943, 0x956a3a, 0x93683d, 0xa17748, 0xa57747, 0x9e7041, 0x93643a, 0x916038, 0x8f5d35, 0x986338, 0xa57042, 0xa97541, 0xb37e45, 0xba8045, 0xb57a41, 0xbc8449, 0xb67f46, 0xa7703c, 0xb07948, 0x986134, 0x9e6739, 0x976134, 0x89552d, 0x895834, 0x7e4e2a, 0x754626, 0x694327, 0x402917, 0x221209, 0x2c1a10, 0x604536, 0x62442f, 0x68452c, 0x704e35, 0x75553c, 0x856850, 0x775b45, 0x70533d, 0x6a4f39, 0x6b4f3b, 0x705038, 0x704e36, 0x8e6b4a, 0xa17c56, 0xa17952, 0x987150, 0x73523a, 0x452f20, 0x24160c, 0x180501, 0x594133, 0x694936, 0x6f4a34, 0x704b31, 0x5e3d22, 0x907547, 0xd4b066, 0xdab460, 0xe1bc6a, 0xd6b366, 0xd6b569, 0xd5b772, 0xb59969, 0x483a2a, 0x000000, 0x070702, 0x080702, 0x070702, 0x060601, 0x050501, 0x040400, 0x030301, 0x030300, 0x040400, 0x030300, 0x030200, 0x020201, 0x020201, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000001, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020101, 0x010101, 0x020200, 0x010200, 0x030303, 0x030301, 0x030301, 0x040401, 0x040500, 0x050701, 0x060802, 0x060702, 0x060803, 0x0c0907, 0x0d0703, 0x72624f, 0x937f60, 0x9a835d, 0xa38960, 0xab8f64, 0xab8d5f, 0xa5895b, 0x9f8458, 0x7c6848, 0x433e36, 0x393735, 0x3a3632, 0x2a2620, 0x0a0804, 0x1c1d19, 0x262622, 0x2c2b29, 0x33302d, 0x47423e, 0x4f4d4e, 0x5b5d62, 0x3c3f43, 0x221f19, 0x38322a, 0x2e261d, 0x221c14, 0x261f17, 0x312922, 0x3b342f, 0x3e3933, 0x2c241c, 0x201c16, 0x29251e, 0x1c1811, 0x292219, 0x322921, 0x372e26, 0x372f28, 0x352f29, 0x2d2927, 0x262221, 0x2a2724, 0x3f3c37, 0x3e3d37, 0x353634, 0x34363b, 0x2b2e32, 0x2e3033, 0x2a2a2a, 0x35302d, 0x4d4036, 0x5a4839, 0x614a3b, 0x5a4538, 0x5c493b, 0x5c4739, 0x594333, 0x584435, 0x5c4636, 0x61462f, 0x6f4f31, 0x815d3a, 0x9c764b, 0xa68152, 0x9f7c4e, 0x9a784b, 0x93714a, 0x856643, 0x795d3c, 0x674e33, 0x543d24, 0x4d3621, 0x503926, 0x59402d, 0x4f3928, 0x2a1c11, 0x160e07, 0x403329, 0x4f3d2f, 0x5b483a, 0x604d3f, 0x5d4b3d, 0x57463a, 0x6d5948, 0x876647, 0x946a3f, 0x9a6e41, 0xa17647, 0xa17646, 0x9c6f42, 0x8a5c33, 0x906438, 0x9f7445, 0xa17645, 0x9f7343, 0xa27648, 0xa07449, 0x9c6f45, 0x93653b, 0x875730, 0x91633c, 0x996940, 0x98663b, 0xac7749, 0xb6814e, 0xb7824c, 0xb07842, 0xab703b, 0xac6f3d, 0xaa6d39, 0xb0733d, 0xad713a, 0xab703b, 0xaa703d, 0xa2693a, 0x895229, 0x834d28, 0x7d4927, 0x7c4b27, 0x7c4e2c, 0x6e4a2c, 0x3f2a18, 0x1f1008, 0x2f1d14, 0x614737, 0x5d3d27, 0x6a482c, 0x7b593d, 0x725138, 0x775a44, 0x5e4633, 0x674a32, 0x77553a, 0x835b3e, 0x855c3c, 0x8e6744, 0x9c734b, 0x986d43, 0x956941, 0x8c5f3a, 0x613b21, 0x3e2617, 0x25170f, 0x1c0902, 0x5d4232, 0x674631, 0x6a462f, 0x644127, 0x553618, 0xa58d5d, 0xe0c278, 0xdcb967, 0xe5c271, 0xe1c070, 0xd6b368, 0xb28e51, 0x6a4a23, 0x180601, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020300, 0x040401, 0x040400, 0x030300, 0x020200, 0x020200, 0x020200, 0x010100, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010100, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x030302, 0x030301, 0x030401, 0x030500, 0x040600, 0x050600, 0x060702, 0x060702, 0x060702, 0x000000, 0x6e5f4b, 0xa08864, 0xa18558, 0xa4895a, 0xa38758, 0xae9161, 0xab8d5c, 0xb09260, 0xa18354, 0x89714a, 0x484133, 0x3a3835, 0x413d39, 0x322e29, 0x050401, 0x191a15, 0x20211d, 0x23211f, 0x393733, 0x383431, 0x413f40, 0x5c5d61, 0x606369, 0x1f2123, 0x25221c, 0x312b24, 0x282119, 0x251c16, 0x231b14, 0x36322d, 0x3d362f, 0x2a2118, 0x251f19, 0x2a261f, 0x201b14, 0x271f18, 0x342b23, 0x3b3129, 0x393029, 0x3b332b, 0x3a332d, 0x393632, 0x383735, 0x2c2c2c, 0x2d2d2a, 0x373635, 0x303135, 0x26292d, 0x2a2d31, 0x28292a, 0x2e2c28, 0x5b4e42, 0x5f4c3c, 0x5b4130, 0x5e4636, 0x5a4536, 0x584335, 0x584234, 0x594538, 0x5f493a, 0x654a33, 0x846543, 0x9e7d54, 0x9e7e54, 0x93744c, 0x7a5e3c, 0x62492d, 0x4e3823, 0x4c3928, 0x533f2a, 0x674c31, 0x856543, 0x896642, 0x886240, 0x7f5a3b, 0x5b3e29, 0x2d1b10, 0x130a04, 0x43362c, 0x513f32, 0x59463a, 0x5c4a3c, 0x5d4a3c, 0x5f4c3e, 0x6c5545, 0x7c593d, 0x8b6039, 0x92663d, 0x9e7348, 0x997045, 0x9e7347, 0xa17748, 0x9e7445, 0x9b6f44, 0x956a3f, 0x93683b, 0x93673c, 0x8e6139, 0x8c5e38, 0x8a5a35, 0x95643e, 0x996842, 0x9d6a41, 0x9e693b, 0xa06637, 0xa36837, 0xa46836, 0xa76936, 0xa66837, 0x9c5d2e, 0x9e5f2d, 0xa96d37, 0xb67c43, 0xaf743d, 0xa66a38, 0x9a5f33, 0x935b33, 0x8a542e, 0x8a562f, 0x8f5e33, 0x8e6137, 0x745230, 0x442d1b, 0x231309, 0x331f17, 0x654737, 0x64422a, 0x6c492f, 0x6a492f, 0x6d4b34, 0x714f36, 0x906a49, 0x8d623f, 0x7f5331, 0x7a4c2c, 0x734729, 0x774b2e, 0x734526, 0x805432, 0x815633, 0x764c2c, 0x5a3821, 0x462f1f, 0x25160e, 0x1f0c04, 0x5f4332, 0x62412c, 0x5f3c23, 0x5c3e25, 0x6c563a, 0xa28a57, 0xe4c87e, 0xddbf73, 0xdebf74, 0xddbd70, 0xd8b870, 0xbd9c62, 0x6e5738, 0x000000, 0x362f23, 0x5c523f, 0x746851, 0x71664e, 0x605540, 0x514736, 0x2c271c, 0x000000, 0x000000, 0x000000, 0x060502, 0x030302, 0x030301, 0x030300, 0x020201, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000001, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010000, 0x000000, 0x010101, 0x000101, 0x010101, 0x030301, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x040501, 0x040500, 0x040501, 0x000000, 0x675842, 0x967f59, 0x9c8256, 0x9e8556, 0xa18757, 0xa58a5b, 0xaf9262, 0xad8e5e, 0x9b7b4c, 0x866c47, 0x554c40, 0x3c3a36, 0x3b3834, 0x36322e, 0x060500, 0x161712, 0x252520, 0x2c2924, 0x2f2b27, 0x3b3734, 0x413d39, 0x474746, 0x6c6f74, 0x55585c, 0x0c0e0d, 0x16130e, 0x221e18, 0x282118, 0x29231b, 0x3a3732, 0x362e25, 0x221910, 0x2a221b, 0x2b251c, 0x1e1811, 0x211811, 0x31271e, 0x3d322a, 0x3c3229, 0x362d25, 0x39322b, 0x463f39, 0x47423d, 0x494644, 0x474644, 0x282826, 0x2b2c2e, 0x222428, 0x26272b, 0x27282b, 0x31302c, 0x584c40, 0x634e3b, 0x664934, 0x674b38, 0x5e4737, 0x594436, 0x594536, 0x5f4b3d, 0x594536, 0x5c4431, 0x61482e, 0x614a30, 0x523d27, 0x5e4934, 0x7b654d, 0x8c7357, 0x8b6e4f, 0x866849, 0x8c6b46, 0x9a7448, 0x9e7546, 0x9d7143, 0x95683e, 0x8c643f, 0x624229, 0x2c1a0e, 0x110903, 0x403329, 0x503f32, 0x59473a, 0x554335, 0x5c483a, 0x604c3d, 0x654e3b, 0x815f43, 0x805636, 0x825633, 0x845933, 0x926940, 0x9e7549, 0x986e43, 0x8e633a, 0x855730, 0x8b5e35, 0x98693d, 0x95653b, 0x8d5d35, 0x8a5933, 0x8f5d34, 0x9d683d, 0x9b663b, 0x9a6338, 0x9c6436, 0x9e6333, 0xae723f, 0xaf723f, 0xa86b3b, 0xa46639, 0x9d5e32, 0xa36534, 0xb47841, 0xb1793f, 0xac723a, 0xa46736, 0x92562c, 0x935a31, 0x895328, 0x966234, 0x9d6d3d, 0x966b3f, 0x6c4b2c, 0x3b2616, 0x220f08, 0x392116, 0x6a4835, 0x6d472d, 0x704d30, 0x6d4c30, 0x714e35, 0x734c30, 0x824f29, 0x7b4621, 0x7a4724, 0x794928, 0x704326, 0x6d4026, 0x64381e, 0x6c4023, 0x7f5333, 0x7a5032, 0x68472f, 0x4a3323, 0x25150c, 0x2c160b, 0x624533, 0x5b3b24, 0x6a4e31, 0x826947, 0x816a47, 0xa28750, 0xdabb6e, 0xd9b96d, 0xdebd74, 0xd7b76d, 0xe0c177, 0xdabc77, 0xccb174, 0xc3ae7b, 0xccb883, 0xd2ba80, 0xceb67d, 0xd6bd82, 0xd2ba80, 0xcab47d, 0xbba778, 0xa3916d, 0x6d614a, 0x140e0d, 0x000000, 0x060503, 0x030301, 0x030300, 0x030300, 0x020200, 0x020100, 0x010100, 0x020100, 0x010100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010000, 0x020201, 0x030301, 0x030301, 0x030201, 0x020300, 0x030400, 0x040401, 0x040401, 0x010000, 0x000000, 0x2e2619, 0x68563a, 0x846d4a, 0x92774d, 0x977a4f, 0x9e8057, 0x9c7d52, 0x86643c, 0x886439, 0x9a7e58, 0x675d50, 0x4f4e49, 0x2e2e2b, 0x2b2926, 0x080803, 0x13140f, 0x21211c, 0x2e2c26, 0x3b3733, 0x403c38, 0x443f3a, 0x423d39, 0x4d4e4f, 0x707479, 0x555a5f, 0x2a2d30, 0x0c0c09, 0x171611, 0x3d3b37, 0x37332e, 0x2d2319, 0x1a1108, 0x282019, 0x29221a, 0x211a12, 0x1f160f, 0x2e231b, 0x3e3329, 0x40362c, 0x3e342b, 0x3c332a, 0x40372f, 0x463e36, 0x453d37, 0x45413c, 0x464542, 0x343435, 0x212124, 0x232427, 0x27292a, 0x35332f, 0x54483a, 0x705a46, 0x6b4d38, 0x684e39, 0x624c39, 0x5e4a3b, 0x584436, 0x5d4b3d, 0x584739, 0x523f2b, 0x755e44, 0x8a7053, 0x917656, 0xa28362, 0x9a7a59, 0x866543, 0x815c36, 0x8a6239, 0x956d40, 0x9a6f3e, 0x9a6c3c, 0x946638, 0x845830, 0x754d2d, 0x50341e, 0x27180d, 0x0e0702, 0x3c3128, 0x4f3f33, 0x554336, 0x523e31, 0x563f2f, 0x5c4435, 0x6a513c, 0x745438, 0x7d5839, 0x8e6744, 0x916841, 0x865c33, 0x92673d, 0x956940, 0x92663f, 0x8d6038, 0x9c6c41, 0x99663a, 0x976336, 0x9b683a, 0x9e6a3b, 0xa57142, 0xa36d3f, 0x9a6336, 0x9f673a, 0xa66d3d, 0xa9713c, 0xa96f3a, 0xa76a3a, 0x9f6537, 0xa86c3e, 0xab6e3d, 0xac723b, 0xb47c42, 0xb57d41, 0xae763e, 0x9a6032, 0x986038, 0xa37145, 0xa47649, 0x966c43, 0x845f3a, 0x68482d, 0x462f1d, 0x2d1d10, 0x1d0902, 0x44271a, 0x754e38, 0x764b2d, 0x6b4321, 0x734f2e, 0x6e4b2e, 0x7c5233, 0x83512a, 0x84532b, 0x7f4e29, 0x744525, 0x7b4d2d, 0x825333, 0x835635, 0x805432, 0x764a2b, 0x61371f, 0x42220f, 0x3a2516, 0x24150a, 0x341e11, 0x654934, 0x4f341e, 0xb29c75, 0x816940, 0x74582a, 0xbe9d5d, 0xe8c372, 0xe6c270, 0xe5c16e, 0xddba69, 0xe1c070, 0xe2c273, 0xdab86b, 0xd4b46b, 0xe7cb81, 0xe0c375, 0xe0c277, 0xdec178, 0xd5b971, 0xd4b872, 0xcdb272, 0xceb578, 0xc3ad7d, 0xa09074, 0x39332a, 0x000000, 0x030301, 0x020300, 0x030400, 0x020200, 0x010100, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x010100, 0x020100, 0x020100, 0x010200, 0x020301, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x121210, 0x000000, 0x221500, 0x321400, 0x53350c, 0x5e3b18, 0x56300f, 0x572f04, 0x60360a, 0x663e14, 0x816646, 0x594e3e, 0x484641, 0x3d3d3b, 0x1c1b16, 0x0c0b06, 0x151410, 0x24231d, 0x2f2c26, 0x3b3732, 0x3c3833, 0x443e38, 0x433d37, 0x3c3733, 0x414144, 0x63676c, 0x65696f, 0x54585c, 0x525355, 0x494745, 0x342c25, 0x231a10, 0x20170f, 0x261d16, 0x1f1710, 0x1f160f, 0x241b13, 0x2b1f17, 0x3e3226, 0x4a3e32, 0x44392e, 0x3c3429, 0x443c33, 0x483f36, 0x423930, 0x39312a, 0x2f2c27, 0x373533, 0x262627, 0x2a2b2b, 0x282a28, 0x37342f, 0x493c2f, 0x5d4834, 0x6b5440, 0x6f5a46, 0x654f3c, 0x574233, 0x4b372a, 0x5c4b3d, 0x75624e, 0x8a7253, 0x957a56, 0x7b5f3e, 0x694b29, 0x7e5c37, 0x846039, 0x7e5832, 0x855f35, 0x91693b, 0x986e3e, 0x9a6f3d, 0x8d5e2f, 0x83552b, 0x7d502d, 0x734b2e, 0x4d311d, 0x2b1c12, 0x130b06, 0x3c3229, 0x4c3e32, 0x48362a, 0x604e44, 0x745f54, 0x533828, 0x6c503a, 0x93714d, 0x9e774e, 0x966d46, 0x966c42, 0x8e643a, 0x91653a, 0x906238, 0x93643a, 0x97673c, 0x8d5a2e, 0x996536, 0xa57140, 0xa5713f, 0x9b6637, 0x9f693b, 0x9e6739, 0x9c6537, 0xa2693b, 0xa16839, 0xa26b39, 0x9c6435, 0xa06436, 0x9e6638, 0xb07c47, 0xbf8b51, 0xc19054, 0xbf9059, 0xbb8e5d, 0xab8258, 0x946b4a, 0x7f583b, 0x75543a, 0x74543a, 0x74543a, 0x876747, 0x937453, 0x775e42, 0x3e2c1b, 0x1f0d03, 0x492b1c, 0x7b533b, 0x7a5131, 0x76502a, 0x78522e, 0x754d2e, 0x865c3b, 0x794a26, 0x7e4e28, 0x875730, 0x8c5c35, 0x8c5c38, 0x815434, 0x75492c, 0x72472a, 0x6c4024, 0x643c23, 0x573a24, 0x3f2a1a, 0x231308, 0x3f2917, 0x6a4f35, 0x51371b, 0xa18b65, 0x755d38, 0x7b5d30, 0x9f7740, 0xaf7c3b, 0xc69650, 0xd1a357, 0xd7ac5d, 0xdab061, 0xd6ab5a, 0xd0a454, 0xcaa152, 0xd7b462, 0xd4b261, 0xd6b669, 0xdcbe74, 0xd4b86f, 0xd8bc72, 0xd8bb73, 0xd3b771, 0xcbb275, 0xc3ae7e, 0x756851, 0x000000, 0x020200, 0x030300, 0x020400, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010200, 0x020201, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010101, 0x010100, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010001, 0x010101, 0x010101, 0x000101, 0x010201, 0x010201, 0x010101, 0x010100, 0x010100, 0x000100, 0x000000, 0x312e2d, 0x474440, 0x37342f, 0x686763, 0xa5a5a0, 0xa2a19c, 0x030100, 0x474645, 0x898680, 0x70604d, 0x5a3b11, 0x50391e, 0x694f2f, 0x745834, 0x6b502f, 0x4d361b, 0x3f3326, 0x3f3933, 0x31302c, 0x1a1a16, 0x0b0c06, 0x12120e, 0x26241e, 0x312d26, 0x3e3934, 0x433e37, 0x423c34, 0x413931, 0x403a34, 0x3b3732, 0x393938, 0x444649, 0x4c4e50, 0x454342, 0x322d28, 0x282018, 0x20160f, 0x2d2019, 0x261b14, 0x20160f, 0x1d120c, 0x241810, 0x2e2118, 0x3a2c20, 0x443528, 0x4b3e31, 0x44392e, 0x3a3127, 0x383026, 0x443b32, 0x443b33, 0x39332c, 0x3a3633, 0x2a2a28, 0x30312e, 0x302f2e, 0x35322c, 0x54483b, 0x5b4a3a, 0x675745, 0x695746, 0x67503f, 0x624837, 0x503a2c, 0x5e4d3e, 0x6a5b47, 0x514021, 0x675531, 0x74603b, 0x79633d, 0x7d623a, 0x7a5832, 0x76512a, 0x835d31, 0x956b3b, 0x946937, 0x936534, 0x8b5b2e, 0x88582e, 0x875a35, 0x7e5636, 0x553822, 0x2d1e14, 0x0e0701, 0x463c34, 0x4e3f34, 0x362519, 0x6c5649, 0x9e8677, 0x593f31, 0x6d503a, 0x7f5c3c, 0x835b35, 0x92673e, 0x90653b, 0x94683e, 0x9b6d3f, 0x9b6b3c, 0x9f6d41, 0x926035, 0x925e33, 0x9e6a3b, 0x9c6638, 0x975f32, 0x9b6336, 0x9d6538, 0x9c6336, 0x9d6437, 0x9d6538, 0x9a6337, 0x9d683b, 0xa26f42, 0xaa7747, 0xb08352, 0xb68e5c, 0xb08957, 0x9c784e, 0x806345, 0x654b36, 0x574131, 0x634a39, 0x644531, 0x7c563a, 0x8d6342, 0x8f6443, 0x8a6442, 0x724f30, 0x53371e, 0x342212, 0x160701, 0x492e1f, 0x79563c, 0x765130, 0x704c27, 0x76512c, 0x78502d, 0x805534, 0x774a26, 0x84532e, 0x81512c, 0x724422, 0x724526, 0x7b4c2e, 0x7e502e, 0x794c2b, 0x704425, 0x623d22, 0x533823, 0x392619, 0x1d0b03, 0x4d3722, 0x705337, 0x5d3d1e, 0x593810, 0x5f401d, 0x7a5c33, 0x7c5934, 0x662800, 0x793c09, 0x804108, 0x86470b, 0x894a06, 0xae7629, 0xc59341, 0xcca051, 0xd6af5a, 0xd8b562, 0xe0c171, 0xd6b668, 0xdcbc6e, 0xdfc275, 0xd7ba6e, 0xd6b76e, 0xd8bc78, 0xc6ae77, 0x66563c, 0x000000, 0x020300, 0x020300, 0x030301, 0x030400, 0x030201, 0x020200, 0x020200, 0x020201, 0x030301, 0x020201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010201, 0x010102, 0x020202, 0x000000, 0x000000, 0x000000, 0x353430, 0xa5a29b, 0xbebab2, 0x989284, 0xb3afa4, 0xb9b8ae, 0x9d9a8f, 0x736f67, 0xb7b6b1, 0xd6d2c9, 0x98896f, 0x9b8452, 0xa99360, 0xaf9963, 0xac935f, 0xae9561, 0xa38d61, 0x5f513c, 0x36302c, 0x2e2c27, 0x20201c, 0x0a0905, 0x0f0f0a, 0x22201a, 0x342e26, 0x342d25, 0x353028, 0x453e36, 0x443e35, 0x372f27, 0x423e36, 0x3f3c36, 0x35332f, 0x2f2e2b, 0x302e28, 0x251f18, 0x160e07, 0x2d241c, 0x32271e, 0x281b14, 0x291b15, 0x281c15, 0x2e2119, 0x36271c, 0x3b2d1f, 0x463728, 0x47382a, 0x504132, 0x493d2f, 0x3a3026, 0x3a3127, 0x433a30, 0x3f3930, 0x3d3936, 0x2e2b28, 0x2f2e2c, 0x31302e, 0x35322d, 0x554a3e, 0x5a4c3d, 0x534737, 0x5a4a3c, 0x61493a, 0x694937, 0x5f4332, 0x5b4938, 0x6c5f49, 0x675d3c, 0x695f3b, 0x5e5330, 0x615232, 0x634d2a, 0x775832, 0x826036, 0x8f6839, 0x976d3a, 0x8d6130, 0x905f30, 0x956234, 0x8e5d34, 0x865631, 0x784d2e, 0x543923, 0x2a1b11, 0x0f0903, 0x3f352c, 0x43362b, 0x2d1f16, 0x4e3524, 0x624838, 0x4f3829, 0x684c36, 0x7c5534, 0x946940, 0x95693f, 0x95673b, 0x946538, 0x97683b, 0x96653a, 0x8e5c33, 0x8e5b31, 0x966134, 0x9b6336, 0x91572d, 0x8b522a, 0x8c532c, 0x935a31, 0x9a6136, 0x965f35, 0x9e6b40, 0xa37345, 0x9a6a3e, 0x92673f, 0x7e5737, 0x6f4f33, 0x62482f, 0x694c34, 0x73553d, 0x7f6147, 0x8e6d54, 0x8c694e, 0x795237, 0x7d4f2c, 0x96663a, 0x88552c, 0x75401b, 0x673718, 0x633a20, 0x583a24, 0x2d1c0f, 0x100200, 0x472e20, 0x77573c, 0x7d5b3a, 0x7e5933, 0x7d5730, 0x825934, 0x815533, 0x744421, 0x784724, 0x774825, 0x764827, 0x7c4f2d, 0x754726, 0x6f4221, 0x734725, 0x724928, 0x55351b, 0x412a19, 0x291a0e, 0x160400, 0x69513b, 0x6e4f32, 0x583613, 0x64421f, 0x6b4c26, 0x836439, 0x705133, 0x531e03, 0x7c471f, 0x915b2a, 0x864b15, 0x965d19, 0xc89745, 0xd7aa50, 0xd5aa51, 0xd9b459, 0xe1c168, 0xdec06a, 0xe2c470, 0xbd9a51, 0xb9944f, 0xc49f57, 0xbf9b55, 0xa5844a, 0x6f542d, 0x201101, 0x000202, 0x050602, 0x050601, 0x050401, 0x050401, 0x040401, 0x040300, 0x030401, 0x030401, 0x030301, 0x020301, 0x020200, 0x020200, 0x010200, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010200, 0x010100, 0x010101, 0x010101, 0x010201, 0x010202, 0x000000, 0x141516, 0x817f7d, 0x8f8b86, 0x827c72, 0x959085, 0x989389, 0x7e7766, 0x8e8775, 0x8e8a79, 0x938e7c, 0x9e9b8f, 0xb4b1a9, 0x908a80, 0x79663d, 0xac975e, 0xb39d61, 0xb29b61, 0xaa925b, 0xa68e5a, 0x9b8455, 0x66573d, 0x2f2a24, 0x33312a, 0x34342e, 0x181512, 0x12120d, 0x1b1a15, 0x2b2822, 0x3b352d, 0x3b342c, 0x322d23, 0x3b342c, 0x3d352c, 0x3c362d, 0x3d372e, 0x413a32, 0x39342d, 0x38322a, 0x312c23, 0x231f19, 0x201a14, 0x2d241d, 0x30231b, 0x2c1e16, 0x2f2118, 0x36281d, 0x3a2b1e, 0x3e3020, 0x433323, 0x403020, 0x483828, 0x514333, 0x483a2c, 0x3e3429, 0x383028, 0x372f28, 0x3d3633, 0x342f2c, 0x302c29, 0x2d2a27, 0x332f2a, 0x554b3f, 0x6b5d4d, 0x625545, 0x5b4c3d, 0x664b3b, 0x6a4633, 0x684834, 0x6e5a46, 0x6f634c, 0x5d5635, 0x66603c, 0x57502d, 0x615635, 0x74623f, 0x7e653e, 0x816034, 0x8e6836, 0x946b36, 0x926634, 0x905f30, 0x845126, 0x784621, 0x764826, 0x674226, 0x462d1a, 0x26190e, 0x0c0803, 0x473e35, 0x4b3e32, 0x302217, 0x301e11, 0x463323, 0x473526, 0x664b33, 0x865d39, 0x94683e, 0x96673a, 0x986739, 0x926033, 0x9a663b, 0xa16c3e, 0xa16a3b, 0x9a6235, 0x92592d, 0x90552b, 0x864c23, 0x875028, 0x864f29, 0x864e27, 0x844f27, 0x936540, 0x9d734d, 0x89623e, 0x6c492d, 0x523725, 0x523928, 0x694b35, 0x836043, 0x86603f, 0x885f3c, 0x805332, 0x7a4825, 0x834d24, 0x8f592c, 0xa26e3c, 0xa26d3b, 0x956030, 0x8c572e, 0x7c4d2b, 0x6e4528, 0x50341e, 0x26190d, 0x090100, 0x442f21, 0x6d523a, 0x745534, 0x805c2f, 0x835b30, 0x865a34, 0x835531, 0x754421, 0x784825, 0x714423, 0x653b1e, 0x623819, 0x693f1e, 0x643a1b, 0x6e4423, 0x684527, 0x50341f, 0x362112, 0x150700, 0x362a1d, 0x775d43, 0x6c4a26, 0x684621, 0x6a4923, 0x75552e, 0x8c6c3f, 0x8f6d47, 0x612804, 0x955925, 0xaa6f2e, 0xba8238, 0xcf9b46, 0xe1b052, 0xe4b859, 0xeac363, 0xeece6f, 0xf2d97b, 0xecd076, 0xdcbc64, 0xc5a156, 0xc19d57, 0xc49f56, 0xba954f, 0xa08049, 0x705c3c, 0x3c3222, 0x000000, 0x000000, 0x090703, 0x070602, 0x060501, 0x050401, 0x050501, 0x050502, 0x040501, 0x030501, 0x030401, 0x030301, 0x020200, 0x010200, 0x010100, 0x010200, 0x010101, 0x020202, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000100, 0x010201, 0x010101, 0x010201, 0x020201, 0x030403, 0x000000, 0x000000, 0xa9a9a8, 0xd1ceca, 0x9f978f, 0x817769, 0x7f7567, 0x52483b, 0x433c2b, 0x6e6958, 0x9f9988, 0x938d7d, 0xcfcbc1, 0xbfb8b0, 0x665b4b, 0x6c592d, 0xa08b53, 0xa28b52, 0xa18953, 0xa68d55, 0xa9915b, 0xa08a59, 0x756548, 0x27221c, 0x322f27, 0x3b3a33, 0x262622, 0x12130f, 0x151612, 0x1f1f1b, 0x27251f, 0x322e27, 0x3f3931, 0x362e26, 0x3f362e, 0x413931, 0x40382f, 0x3a3228, 0x3e352c, 0x3e352b, 0x3e362c, 0x332e26, 0x27231e, 0x1b1812, 0x2b241c, 0x352a21, 0x312319, 0x3a2b20, 0x3b2c1f, 0x3b2b1d, 0x402f20, 0x3f2e20, 0x3f2e1f, 0x473727, 0x4d3d2d, 0x4d4031, 0x3f342a, 0x322922, 0x3b3330, 0x3b3331, 0x37302d, 0x332e2b, 0x322e2a, 0x4d4238, 0x655847, 0x6a5c4b, 0x635342, 0x6d5140, 0x75513c, 0x6e4e3a, 0x6c5743, 0x675b44, 0x514c2b, 0x6d6743, 0x645b3a, 0x695e3f, 0x645535, 0x644f2d, 0x7e6238, 0x8e6b3b, 0x8c6434, 0x83572c, 0x83562b, 0x926436, 0x94653a, 0x8c603a, 0x6c4c2d, 0x462f1b, 0x291c10, 0x100902, 0x4e4237, 0x554739, 0x463628, 0x433426, 0x4c3c2c, 0x4c3b2b, 0x684d34, 0x90663f, 0x9e6e41, 0x9d6b3b, 0x9f6b3c, 0x9a6638, 0x976034, 0x965f33, 0x996035, 0x90542b, 0x8b4f26, 0x8a4f25, 0x925d34, 0xa06f46, 0x90603b, 0x90623e, 0x8d6445, 0x846348, 0x73573f, 0x71543b, 0x8f6d50, 0x9f7858, 0x926848, 0x865737, 0x85512d, 0x935e30, 0xa16c39, 0x986031, 0x975c30, 0xa66a3a, 0xa9703b, 0xb07941, 0xab763e, 0x976233, 0x814f2a, 0x6d4021, 0x623c20, 0x492d18, 0x23170b, 0x080000, 0x412d1f, 0x634933, 0x6c4f2d, 0xb8996c, 0x9f7b50, 0x81542b, 0x875832, 0x794a26, 0x744826, 0x694022, 0x59351b, 0x5e3c20, 0x624021, 0x674224, 0x603d20, 0x4e2f14, 0x3c220c, 0x1c0000, 0x190b03, 0x6b5944, 0x735536, 0x6b4924, 0x694722, 0x6d4c27, 0x76572f, 0x8b6c3b, 0xb38f5c, 0x662d0c, 0x955723, 0xaf7331, 0xb47b38, 0xb47b30, 0xaf792d, 0xb98536, 0xc39443, 0xd1a851, 0xd6b057, 0xcfa84d, 0xcba145, 0xdbb65f, 0xe3c068, 0xdfbb65, 0xd8b663, 0xd7b56a, 0xd2b472, 0xc5ab73, 0x9c8963, 0x32291c, 0x000000, 0x080803, 0x070701, 0x060601, 0x050601, 0x050501, 0x040500, 0x040500, 0x030500, 0x030401, 0x020300, 0x020200, 0x020200, 0x010200, 0x010102, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x010201, 0x010202, 0x000000, 0x2d2d2d, 0xababaa, 0xc5c5c1, 0x8b887e, 0x5e5243, 0x594c3b, 0x665b4e, 0x595143, 0x615b4a, 0xa29f8f, 0xc9c7b9, 0xb5b0a2, 0xafa799, 0x948a78, 0x6f5d41, 0x866f41, 0x9f8652, 0x957b48, 0x99804d, 0xa78d5b, 0xae9666, 0xa69166, 0x706147, 0x28231d, 0x312e27, 0x393833, 0x484947, 0x191b1a, 0x121312, 0x1b1c19, 0x222320, 0x282824, 0x39352e, 0x413930, 0x3e372e, 0x413b32, 0x423d33, 0x352f26, 0x373027, 0x3e362c, 0x3e362c, 0x3a3329, 0x342f26, 0x2b2721, 0x1f1d18, 0x221c16, 0x382d24, 0x3d2e24, 0x3f3024, 0x423224, 0x463628, 0x423324, 0x423223, 0x423223, 0x493829, 0x483829, 0x4b3e32, 0x41382f, 0x3e3631, 0x403733, 0x3c3330, 0x352e2a, 0x332c28, 0x4c4036, 0x675644, 0x6e5c49, 0x655341, 0x6b4f3d, 0x80604c, 0x6a4b37, 0x6a543f, 0x71634b, 0x4b4426, 0x554e30, 0x585032, 0x605439, 0x685a3f, 0x695535, 0x7a5f39, 0x7e5e36, 0x7d5932, 0x8d663b, 0x976d3d, 0x8f6437, 0x875d32, 0x78532d, 0x624526, 0x4a351f, 0x2c1f14, 0x0f0700, 0x5a4c3c, 0x544434, 0x4c3d2e, 0x4a3d2e, 0x4b3d2f, 0x554434, 0x6f5239, 0x8c6139, 0x9b6b3c, 0x946234, 0x8f5b30, 0x956135, 0x925d33, 0x884e26, 0x8c5128, 0x8c522b, 0x8c5631, 0x90603c, 0x8d6442, 0x7b573a, 0x67462f, 0x664933, 0x765a42, 0x957252, 0xa57c56, 0xa0724a, 0x97643d, 0x8c542c, 0x80451b, 0x8a5026, 0x9d6334, 0xac713e, 0xa36632, 0x9d602f, 0xa46737, 0xa76d3a, 0xa56c39, 0x9c6633, 0x976433, 0x824f27, 0x7b4a26, 0x744724, 0x754c2d, 0x543922, 0x23180c, 0x0e0300, 0x442e1f, 0x674c35, 0x5a3f23, 0x97774e, 0x936e43, 0x784c26, 0x7d512f, 0x663d1e, 0x654125, 0x5f3e23, 0x4d3118, 0x51351a, 0x583a1b, 0x533514, 0x4f3619, 0x6a583f, 0x5f4e34, 0x7d6f57, 0xa19178, 0x7a6147, 0x674623, 0x684725, 0x694824, 0x72512c, 0x7c5c34, 0x8a6b38, 0xb79861, 0x582a13, 0x7f441e, 0xa36831, 0xb88142, 0xc49046, 0xc89445, 0xbf8834, 0xb57e29, 0xbe8b30, 0xcca249, 0xd7bb64, 0xcfb862, 0xc9ad56, 0xdabd67, 0xd5b662, 0xd6b764, 0xd6b866, 0xd9bc6d, 0xd5b86d, 0xd4bc7c, 0xb2a57f, 0x000000, 0x040500, 0x080801, 0x060701, 0x050701, 0x050601, 0x040601, 0x040601, 0x050701, 0x040500, 0x030500, 0x030401, 0x030301, 0x020201, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020202, 0x010201, 0x010101, 0x010101, 0x010101, 0x030403, 0x000000, 0x7e7e7d, 0xb0b1af, 0x9d9b94, 0x857f70, 0x574e3b, 0x3a3125, 0x433b2f, 0x4b4437, 0x797364, 0xc0bdaf, 0xdbd8cb, 0xb5af9f, 0x766953, 0x644f30, 0x5c4424, 0x6a5231, 0x765e3b, 0x79623e, 0x7a6441, 0x725d3e, 0x604e34, 0x3b2a18, 0x26190e, 0x302b23, 0x312e28, 0x2f2e27, 0x4a4b49, 0x3f4242, 0x141617, 0x1c1e1e, 0x1c1f1d, 0x1f221e, 0x2b2a26, 0x32302a, 0x34302a, 0x38332c, 0x3c372f, 0x3c372e, 0x39352c, 0x312d25, 0x332e26, 0x342e25, 0x2f271e, 0x2c261d, 0x302b23, 0x25211b, 0x251f19, 0x3b3028, 0x45382c, 0x453629, 0x4a392b, 0x473728, 0x463528, 0x402f20, 0x443324, 0x443325, 0x42362a, 0x3d342b, 0x413732, 0x423834, 0x372d2a, 0x352d29, 0x342d27, 0x5b4f44, 0x756352, 0x5c4835, 0x614b3a, 0x6d533f, 0x7a5d48, 0x71533d, 0x725942, 0x6f6048, 0x565035, 0x655e42, 0x645a40, 0x534630, 0x4d3d27, 0x654e31, 0x6d5130, 0x6f4e2b, 0x8e6a40, 0x926c3c, 0x896234, 0x7d572d, 0x77532c, 0x70512c, 0x694e2f, 0x503b25, 0x312315, 0x120903, 0x665543, 0x5a4633, 0x524233, 0x4d4032, 0x4e4135, 0x4e3d2e, 0x6b4e36, 0x885d38, 0x936439, 0x885831, 0x81512e, 0x865532, 0x8e5c3a, 0x8e5c3a, 0x8a5b39, 0x7a4e30, 0x633d27, 0x5b3c29, 0x5a3e2b, 0x7a5a40, 0x8d6849, 0x966c4c, 0x946847, 0x8f5e3a, 0x885027, 0x8f5024, 0x8f4f23, 0x915327, 0x9b5e32, 0x9f6437, 0xa36939, 0x975b2c, 0x96582b, 0x94592c, 0x8e542a, 0x8c542a, 0x955f32, 0x9f6a3b, 0xa16c3c, 0x935f33, 0x84532b, 0x7c522e, 0x6c4b2c, 0x46301c, 0x21160b, 0x130500, 0x493221, 0x654932, 0x442a15, 0x593511, 0x724924, 0x764e2c, 0x694427, 0x4d2c13, 0x46280f, 0x3d2205, 0x41290e, 0x533e27, 0x7b6950, 0x97856c, 0xa6957b, 0x97866b, 0x8e7d61, 0x9b8a6d, 0x775c3d, 0x6a4928, 0x614022, 0x5b3b1e, 0x614223, 0x70502c, 0x76562e, 0x826430, 0xcaaa6b, 0x7b5c36, 0x450800, 0x5e2306, 0x672a07, 0x743e12, 0x8e561f, 0x9c6121, 0xc19147, 0xe2bc67, 0xc7b668, 0x9da762, 0x9bae65, 0xa4b066, 0xc0bf73, 0xc9bf72, 0xcdbf71, 0xd4c274, 0xdac477, 0xdec67a, 0xe0c983, 0xc3b183, 0x1d150e, 0x000100, 0x0a0a02, 0x090902, 0x070801, 0x060701, 0x060701, 0x060802, 0x060802, 0x050601, 0x030500, 0x040500, 0x030500, 0x020300, 0x020200, 0x020201, 0x010101, 0x010101, 0x010201, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x010101, 0x000000, 0x010101, 0x020201, 0x010201, 0x000000, 0x000000, 0x000000, 0x000000, 0x4c4d4f, 0xa7a7a9, 0x929491, 0x807f76, 0x797162, 0x574f42, 0x000000, 0x090704, 0x000000, 0x575143, 0x8a8370, 0x8f8775, 0x796e59, 0x72614a, 0x6b5334, 0x694a24, 0x7a5d3b, 0x6b5235, 0x614a35, 0x604b3b, 0x3b271e, 0x210000, 0x230f04, 0x32261a, 0x302c24, 0x2d2c26, 0x2c2c26, 0x2b2c27, 0x404443, 0x303434, 0x232528, 0x17191a, 0x121616, 0x181a19, 0x21221e, 0x34342f, 0x3a3732, 0x34312a, 0x36332b, 0x322f27, 0x322f27, 0x2f2b24, 0x2a261f, 0x2c261d, 0x2e261d, 0x322b21, 0x383027, 0x352e25, 0x2b251e, 0x2c251b, 0x3b3126, 0x45372a, 0x483729, 0x473529, 0x433123, 0x483628, 0x433224, 0x3c3125, 0x382f27, 0x3f3530, 0x403530, 0x403733, 0x302925, 0x342d28, 0x5b5043, 0x7a6956, 0x5f4a37, 0x64503f, 0x654f3c, 0x8b745d, 0x7c604b, 0x654933, 0x64503d, 0x49402a, 0x574e34, 0x52482f, 0x584931, 0x624d32, 0x7b623f, 0x735633, 0x684927, 0x7e5c33, 0x886338, 0x7e5830, 0x714e28, 0x73512c, 0x745530, 0x6a4f31, 0x48301e, 0x281a0e, 0x180e06, 0x644c39, 0x634833, 0x4f3c2b, 0x4e3f31, 0x514235, 0x49392b, 0x6a4f38, 0x7f5837, 0x7c5434, 0x6d462c, 0x67402c, 0x69432f, 0x623e29, 0x5b3926, 0x6c4d38, 0x846349, 0x957052, 0x966b47, 0x9b6c47, 0x9a6942, 0x8b542d, 0x81451e, 0x864822, 0x844620, 0x85461f, 0x8e4e25, 0x8a4c23, 0x8a4c23, 0x8c4f25, 0x84491f, 0x8c5329, 0x8d542a, 0x884e25, 0x884e27, 0x7f4621, 0x834c25, 0xa47041, 0x9b6737, 0x8f5c31, 0x794924, 0x683d1d, 0x5b371c, 0x4d321b, 0x352413, 0x20150b, 0x170701, 0x4a3221, 0x61462d, 0x563c20, 0x57391b, 0x684422, 0x6d4729, 0x57351a, 0x472d12, 0x6b553c, 0x7f6952, 0x927c63, 0x988267, 0x947f65, 0x826b52, 0x644c34, 0x452c0d, 0x6f5539, 0x684822, 0x734f29, 0x644120, 0x59381c, 0x55381d, 0x593b1f, 0x6a4a28, 0x72522a, 0x7e5f2f, 0x8b6832, 0x946d32, 0xac8746, 0xbc9650, 0xc59e57, 0xc19b57, 0xb98f4a, 0xb78943, 0xa27735, 0x9b7a3d, 0x62662c, 0x005306, 0x006716, 0x579554, 0xb4d8a1, 0xb8d19a, 0xafc388, 0xadba7b, 0xafb070, 0xc5ba78, 0xb5a164, 0x79633d, 0x0f0804, 0x090a03, 0x0c0c02, 0x0b0b03, 0x0a0a02, 0x080903, 0x060802, 0x070802, 0x060702, 0x060702, 0x050601, 0x040601, 0x040601, 0x040601, 0x030500, 0x030300, 0x020200, 0x010100, 0x010201, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000201, 0x010201, 0x010101, 0x020202, 0x010101, 0x000000, 0x000000, 0x393229, 0x5c5443, 0x6d624b, 0x938a7c, 0xb6b4af, 0x979995, 0x94928a, 0x757063, 0x4a4338, 0x000000, 0x000000, 0x000000, 0x645f58, 0x8d8577, 0x6f6554, 0x544733, 0x473925, 0x594324, 0x7f643e, 0x89693e, 0x7c5a32, 0x735436, 0x644b38, 0x332118, 0x130000, 0x361f0e, 0x483724, 0x211d15, 0x262520, 0x262621, 0x25251e, 0x21221d, 0x323431, 0x232425, 0x313335, 0x202326, 0x080b0d, 0x141615, 0x262724, 0x373732, 0x3a3a34, 0x32302b, 0x2d2b24, 0x28271f, 0x29261f, 0x2b2620, 0x29251d, 0x2b251d, 0x32291f, 0x382c22, 0x3f342a, 0x3e352c, 0x363027, 0x1e1912, 0x2d241a, 0x453729, 0x483729, 0x453325, 0x493728, 0x4a392a, 0x443629, 0x372d26, 0x3b322c, 0x3c312b, 0x3c332e, 0x211c19, 0x332e28, 0x584d40, 0x71604d, 0x64503d, 0x544133, 0x6e5744, 0x8a735d, 0x6d513d, 0x624430, 0x614d39, 0x463d26, 0x564c31, 0x605437, 0x6f5c3d, 0x745938, 0x80633e, 0x715331, 0x674727, 0x785633, 0x7c5a35, 0x73502d, 0x6d4b28, 0x6f4d2a, 0x704d2a, 0x68482a, 0x4c311d, 0x29190e, 0x170a03, 0x604730, 0x64462d, 0x59402c, 0x574130, 0x554030, 0x4e3829, 0x6a4e38, 0x5e3d2a, 0x513324, 0x43271c, 0x5b4131, 0x745842, 0x87664c, 0xa17957, 0xb0855d, 0xab7b54, 0x9a663f, 0x884e27, 0x80421a, 0x8e5025, 0x8f4f24, 0x894a23, 0x824320, 0x793b18, 0x804320, 0x814823, 0x7b421e, 0x824721, 0x8c4f25, 0x8f5328, 0x945a2e, 0x9c6235, 0x945a2f, 0x895028, 0x824d26, 0x8b5732, 0x895730, 0x7b4b24, 0x734421, 0x6d4322, 0x603a1e, 0x593a20, 0x4f3721, 0x362616, 0x1d1309, 0x190701, 0x4c3321, 0x60452a, 0x573a1c, 0x614223, 0x664324, 0x6c4627, 0x93775e, 0xa0886c, 0x967c5e, 0x8b6e53, 0x7f5f42, 0x654426, 0x593515, 0x573617, 0x3f250f, 0x533d23, 0x634322, 0x7b5a35, 0xae895b, 0x774f22, 0x633e1c, 0x5d3b1f, 0x59351a, 0x5f3c1d, 0x66451f, 0x795a2f, 0x653e10, 0xbf9447, 0xebc76d, 0xf2ce75, 0xedc870, 0xe9c66d, 0xdeba62, 0xd5ae56, 0xddb963, 0xceb364, 0xa5a25b, 0x2e6625, 0x166925, 0x218135, 0x9ecd9c, 0xc4e8b9, 0xc2e1b3, 0xc3dfb2, 0xb7cea2, 0x8e9c6b, 0x5f5c33, 0x251506, 0x090702, 0x0e0c04, 0x0d0d03, 0x0d0d03, 0x0d0d02, 0x0c0b03, 0x0a0a02, 0x090903, 0x080802, 0x070702, 0x070702, 0x050701, 0x050701, 0x050701, 0x040601, 0x040400, 0x030301, 0x020200, 0x010201, 0x000201, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010001, 0x010101, 0x010101, 0x000000, 0x000000, 0x564c3f, 0x84735d, 0x968162, 0x9a8561, 0x9a855c, 0x968159, 0x988d77, 0xb7b5ad, 0xc2c1bb, 0x9e9d92, 0x5b584e, 0x060602, 0x393836, 0x474643, 0xcac8c3, 0xc7c4bc, 0x8b857a, 0x473e34, 0x271906, 0x513d22, 0x7e6645, 0x795c39, 0x603910, 0x583008, 0x4e3216, 0x5b442a, 0x654e33, 0x685133, 0x6d593c, 0x514631, 0x2a271c, 0x171613, 0x25251d, 0x2b2b24, 0x252622, 0x10110e, 0x222325, 0x47484c, 0x414448, 0x121719, 0x141717, 0x222422, 0x2b2c29, 0x31302c, 0x2f2f29, 0x2a2a24, 0x26251d, 0x29251e, 0x2e2923, 0x2c271e, 0x2b2319, 0x362c22, 0x3e3127, 0x42372b, 0x473d32, 0x403830, 0x2a251e, 0x231d14, 0x3b3025, 0x453529, 0x443123, 0x483324, 0x49382b, 0x3c3127, 0x3a2f28, 0x3d312c, 0x392f29, 0x27211d, 0x2f2a24, 0x6a6053, 0x86735f, 0x624937, 0x3d291c, 0x3d2716, 0x422915, 0x533929, 0x5f4333, 0x624e3b, 0x4c4129, 0x605338, 0x6b5b3d, 0x735c3d, 0x735537, 0x775737, 0x735434, 0x6b4b2d, 0x654529, 0x482b14, 0x513219, 0x634226, 0x734e2f, 0x7d5432, 0x754e2f, 0x563922, 0x25170b, 0x140a04, 0x59402c, 0x6a492f, 0x64452e, 0x61442f, 0x5b402c, 0x60422d, 0x6d4d35, 0x644833, 0x86664d, 0x9f7c5f, 0xa77e5d, 0xa77a55, 0xa16f4b, 0x98613a, 0x8a4e23, 0x854619, 0x844419, 0x8e4f25, 0x905127, 0x8f5125, 0x8a4c22, 0x80431f, 0x783b1b, 0x783f1d, 0x743b1d, 0x6f391a, 0x753f1b, 0x8d552a, 0x9e6436, 0x94592b, 0xa06536, 0x9d6234, 0x8a5127, 0x86502a, 0x865732, 0x7a4a29, 0x6d3f1d, 0x6f4321, 0x6c4425, 0x6b482b, 0x53341c, 0x4c331c, 0x43301d, 0x2d1f11, 0x110600, 0x1a0700, 0x4b2f1c, 0x5d3e25, 0x56371a, 0x5e4022, 0x613e21, 0x734b2b, 0x8b674b, 0x785539, 0x6b421f, 0x6e4624, 0x654121, 0x6a4624, 0x6b4727, 0x5e3e22, 0x321a06, 0x573c22, 0x502f0f, 0x5f3a17, 0x794c24, 0x72410b, 0x774e21, 0x7f5d31, 0x8c6c3b, 0x896839, 0x745326, 0x806130, 0x9b7c44, 0xd5b05a, 0xe6c467, 0xe6c36b, 0xdfbb6a, 0xe4c371, 0xdfc16e, 0xdbbd6c, 0xd4b668, 0xc8b066, 0xa19a55, 0x446a2f, 0x005b16, 0x258b3e, 0x67a46f, 0xb9e4b6, 0xbde0b5, 0xc2e2bb, 0xcae5c0, 0xbad3aa, 0x738560, 0x232517, 0x060000, 0x100d03, 0x0f0d02, 0x110f02, 0x121003, 0x0f0e03, 0x0d0b02, 0x0c0a03, 0x090903, 0x070802, 0x070701, 0x060701, 0x050801, 0x050601, 0x050501, 0x040500, 0x030300, 0x020201, 0x010201, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x6c6151, 0x968163, 0xa58d67, 0x9d845a, 0x9b8155, 0x957c4d, 0x937a4a, 0x927f5d, 0xbbb5a8, 0xbab6ad, 0x9d9a8f, 0x817d72, 0x9d9a97, 0xb1b1ad, 0x87847e, 0xaba79f, 0x8d8980, 0x6a6357, 0x423c31, 0x3c3323, 0x635239, 0x533a1a, 0x664823, 0x806238, 0x937649, 0xa08659, 0xa38a5b, 0xa18858, 0x977d4f, 0x836c44, 0x726041, 0x786a4c, 0x5a523d, 0x191912, 0x23231e, 0x181913, 0x1a1b17, 0x080707, 0x1f2021, 0x5c5f62, 0x5e6164, 0x2c3032, 0x101517, 0x1a1b1b, 0x1e1f1b, 0x2a2b26, 0x2c2c27, 0x28261f, 0x2a2820, 0x28251e, 0x2c2820, 0x2f281f, 0x352c23, 0x3e3228, 0x47392d, 0x4c3e31, 0x4e4135, 0x493f35, 0x403831, 0x26221b, 0x312921, 0x45372c, 0x4a392b, 0x473528, 0x3a2d24, 0x382d26, 0x3e3029, 0x3e332c, 0x372f29, 0x38312b, 0x63584d, 0x8c7864, 0x6b4e3a, 0x4d3827, 0x3e2e21, 0x4b392c, 0x503b2d, 0x52392b, 0x5f4b3a, 0x54472f, 0x605237, 0x645236, 0x634c30, 0x60442b, 0x68492d, 0x6a4d30, 0x5b3f26, 0x402510, 0x563921, 0x82603e, 0x8e6640, 0x855b34, 0x764c28, 0x694527, 0x4c321f, 0x23160d, 0x130a04, 0x543c2a, 0x63422a, 0x623f29, 0x5d3d29, 0x5c3c28, 0x654028, 0x875e3d, 0xa47955, 0x9d6f4f, 0x885738, 0x804723, 0x864822, 0x8a4b24, 0x915228, 0x8f5227, 0x905227, 0x8f5026, 0x8b4d23, 0x864a20, 0x8c4f27, 0x854a23, 0x804622, 0x7c4221, 0x794221, 0x733d1e, 0x703b1c, 0x854f2a, 0x945d33, 0x8b532a, 0x854c24, 0x8e552b, 0x824a23, 0x7c4723, 0x81502e, 0x774b2c, 0x6a4023, 0x694225, 0x603c21, 0x51321c, 0x492f1a, 0x3e2815, 0x3a2610, 0x301c04, 0x302415, 0x41372d, 0x301f15, 0x452816, 0x63422a, 0x5c3c20, 0x533418, 0x5c391e, 0x744b2d, 0x6a3d1f, 0x623418, 0x643b1e, 0x633c1f, 0x6e4e33, 0x8b6948, 0x714b26, 0x512d13, 0x1a0000, 0x6a512c, 0x7f6438, 0x7e5826, 0xa58042, 0xcfae66, 0xdbb96d, 0xdbb667, 0xdab362, 0xdab260, 0xd8b05e, 0xdcb965, 0xe9ca72, 0xe7c86d, 0xd7b35c, 0xd7b25c, 0xe0be69, 0xe1c270, 0xe6cb79, 0xe2c87a, 0xad914e, 0x7e672e, 0x7b7a40, 0x557a3e, 0x0a7028, 0x1c8234, 0x25843e, 0x93d09c, 0xb6e5b8, 0xbae2bb, 0xbde0bb, 0xbbdbb5, 0xa0bc93, 0x536044, 0x0b0100, 0x0f0c02, 0x100d03, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x050501, 0x050601, 0x050601, 0x050601, 0x040500, 0x040401, 0x030201, 0x010100, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010001, 0x010201, 0x010101, 0x010101, 0x000000, 0x211e1a, 0x8f7e67, 0x988059, 0x92784e, 0x947b4f, 0x9b8153, 0x977c4e, 0x967c4f, 0x8c774f, 0x8b7e69, 0x9f978a, 0x999387, 0x847e73, 0xa8a69f, 0xafafa8, 0x7c776e, 0x625a4f, 0x63594d, 0x443a2d, 0x2c2519, 0x3b3123, 0x65553b, 0x5d482a, 0x866e43, 0xa98f5c, 0xb09864, 0xad9664, 0xb19966, 0xb09964, 0xa7905d, 0x8f794b, 0x543f1b, 0x5c4a29, 0x7f7051, 0x342e21, 0x030604, 0x12130e, 0x191915, 0x0e0f0e, 0x181715, 0x1a1a15, 0x424343, 0x535557, 0x3a3c40, 0x18191c, 0x181919, 0x1f1f1d, 0x23231e, 0x272722, 0x27251e, 0x26241d, 0x2b2821, 0x2e2821, 0x30261f, 0x31251c, 0x3c2e24, 0x453629, 0x4b392b, 0x413125, 0x473a30, 0x463e36, 0x322d27, 0x2a231d, 0x3b3026, 0x413428, 0x342820, 0x362b24, 0x3e312a, 0x3c3028, 0x3b322b, 0x3e362f, 0x54473c, 0x7b6452, 0x684a35, 0x5c4734, 0x5a4a3b, 0x58483a, 0x503e31, 0x563e30, 0x6c5847, 0x4d3f2a, 0x51422b, 0x56452d, 0x544028, 0x5a4128, 0x5d4028, 0x5f452d, 0x301a09, 0x553d2c, 0x7b5a3e, 0x765130, 0x704a29, 0x653f22, 0x5d3d24, 0x533a25, 0x332217, 0x100904, 0x140d04, 0x4c3625, 0x5a3a24, 0x5a3824, 0x5c3925, 0x64432e, 0x654025, 0x7a4c2c, 0x764020, 0x783c1a, 0x7f4320, 0x854824, 0x7c3f1e, 0x773a1b, 0x864d2b, 0x8b532d, 0x8f562e, 0x844b24, 0x773c18, 0x753c18, 0x7d431e, 0x7a421e, 0x723b19, 0x6f381a, 0x7c4828, 0x7c4827, 0x7c4a2b, 0x804c2b, 0x764020, 0x6e381b, 0x74401f, 0x74401e, 0x6e3d1d, 0x6c3f21, 0x6d4325, 0x654023, 0x56351d, 0x52341f, 0x432813, 0x361d06, 0x3f2c1b, 0x554534, 0x716250, 0x8b7b68, 0x95836e, 0x85715e, 0x462f20, 0x401f0e, 0x5c3a23, 0x5f3d22, 0x4e2c10, 0x5a361c, 0x70442b, 0x643720, 0x572f18, 0x563219, 0x502e16, 0x654429, 0x68472b, 0x5a3716, 0x997c4c, 0xc2a86b, 0xceae66, 0xcda75b, 0xd0a654, 0xe9c367, 0xd0a954, 0xb98c39, 0xba8c36, 0xbb8d37, 0xc79b43, 0xd9b255, 0xe0be61, 0xe4c86d, 0xe1c56b, 0xe1c36a, 0xdebe67, 0xe8ca71, 0xe3c871, 0xe2cc7a, 0xe6d180, 0xd8c57b, 0xa6975e, 0x70713d, 0x729753, 0x42954b, 0x39a45c, 0x45bb70, 0x47b36c, 0x76c58b, 0x9bd7a5, 0xabdbae, 0xb3ddb2, 0x9cc598, 0x78946c, 0x323723, 0x000000, 0x000000, 0x443b2b, 0x74684f, 0x887d61, 0x8c8266, 0x847b62, 0x716855, 0x50483b, 0x27241b, 0x000000, 0x000000, 0x000100, 0x060702, 0x050601, 0x040400, 0x030200, 0x020100, 0x010100, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x756751, 0x937d5b, 0x977f55, 0x947d52, 0x9c8358, 0x9a8055, 0x967d53, 0x917853, 0x746145, 0x827562, 0x7e7362, 0x615543, 0x7b7568, 0x766f62, 0x584d3d, 0x463828, 0x5f5545, 0x574e3f, 0x393228, 0x372c1e, 0x907c59, 0xa18a5c, 0xaf9761, 0xb49b64, 0xac9561, 0xa7905f, 0xae9561, 0x9d8353, 0x90794a, 0x887041, 0x644d26, 0x5b4525, 0x6a563a, 0x292215, 0x0e0f0b, 0x181712, 0x161611, 0x0b0b09, 0x171615, 0x1c1c18, 0x1e1c17, 0x22201c, 0x3f4042, 0x454648, 0x222427, 0x151515, 0x1d1d1b, 0x252621, 0x292823, 0x27261f, 0x28251e, 0x2e2a23, 0x2e261e, 0x30261e, 0x35281f, 0x3a2c21, 0x412f23, 0x453224, 0x453324, 0x463629, 0x4f4238, 0x3f362e, 0x27211b, 0x2e261e, 0x332a21, 0x362b24, 0x3d322a, 0x3f332b, 0x3f342d, 0x41382f, 0x57493e, 0x755e4c, 0x61442f, 0x5a4332, 0x574738, 0x58493b, 0x513f34, 0x523d31, 0x6a5648, 0x463827, 0x544531, 0x53422d, 0x523f29, 0x5f462f, 0x6e523a, 0x604734, 0x1c0902, 0x241207, 0x3c2312, 0x452915, 0x4d331f, 0x4a3220, 0x463426, 0x35291d, 0x211a10, 0x18120a, 0x140d05, 0x4d3a29, 0x563a25, 0x5d3e29, 0x593a26, 0x5f422d, 0x613f26, 0x704223, 0x753f20, 0x7a4323, 0x7c4220, 0x794120, 0x763f21, 0x733c20, 0x784327, 0x713e1e, 0x703c1a, 0x6d3816, 0x6d3918, 0x7d4923, 0x845129, 0x834f2a, 0x794624, 0x6f3c1f, 0x6d3c1e, 0x6e3d20, 0x68391d, 0x693921, 0x6c3c22, 0x714225, 0x6f4124, 0x6a4023, 0x653d20, 0x613d20, 0x56351d, 0x4b2f15, 0x3d1f00, 0x442c18, 0x5c4b3a, 0x786652, 0x826e59, 0x8a7561, 0x84705c, 0x765f4a, 0x6a4b35, 0x593821, 0x381b0b, 0x442314, 0x5d3823, 0x5e3b24, 0x7c5b40, 0x58351f, 0x6a4029, 0x633b26, 0x4d2e1b, 0x3c210d, 0x3b200b, 0x4f3119, 0x3c1600, 0xa9884c, 0xe6be6a, 0xcca14e, 0xcfa14d, 0xb5863a, 0xbb8c3f, 0xc59641, 0x956316, 0xa6772b, 0xc1923f, 0xb28332, 0xd4a94f, 0xdfb95d, 0xeaca70, 0xeed87f, 0xdec670, 0xe1c56c, 0xdbc069, 0xe8ce71, 0xe6cd77, 0xf7e690, 0xf2de81, 0xeed97e, 0xe6d380, 0xd0c479, 0xa4b067, 0x629e53, 0x51bf79, 0x63d88d, 0x33a85e, 0x1f964b, 0x349552, 0x58a26a, 0x76b482, 0x589060, 0x659362, 0x4c6343, 0x3e3424, 0xb2a482, 0xdbc999, 0xe2cc95, 0xdec78e, 0xd7c087, 0xd6c087, 0xd2bc87, 0xcdb584, 0xc0ab7e, 0xa69571, 0x72664f, 0x000000, 0x000000, 0x070802, 0x050401, 0x040200, 0x030200, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x010101, 0x000101, 0x010000, 0x000000, 0x3c3123, 0x625039, 0x766141, 0x7e6744, 0x846b49, 0x7e6645, 0x755e3d, 0x695337, 0x55402a, 0x3c2a13, 0x32220c, 0x362814, 0x56492f, 0x756545, 0x7d6b49, 0x7e6a49, 0x786648, 0x77674b, 0x61543d, 0x51442e, 0xa89166, 0xb09865, 0xaf9864, 0xb19862, 0xaf9561, 0x9e8856, 0x937a48, 0x977b4b, 0xa08555, 0x927a4b, 0x7a6038, 0x6e5738, 0x3f2b18, 0x150a02, 0x090903, 0x100d0a, 0x16130f, 0x0a0908, 0x161615, 0x191916, 0x1d1b18, 0x1b1914, 0x130f08, 0x2a2928, 0x3f4141, 0x343536, 0x18191a, 0x1b1d1a, 0x20211e, 0x262621, 0x25241d, 0x26221b, 0x2c231c, 0x2a2018, 0x33281f, 0x3f3429, 0x48392e, 0x443125, 0x453124, 0x4a3426, 0x483425, 0x48382c, 0x453b32, 0x2f2922, 0x1f1a13, 0x312720, 0x3e3129, 0x40332b, 0x42362e, 0x3e342b, 0x584a3e, 0x7c6652, 0x654a35, 0x5e4937, 0x5a4a3b, 0x594a3e, 0x503f34, 0x4a352a, 0x685246, 0x463628, 0x574735, 0x533e2c, 0x4e3826, 0x492f20, 0x4d301e, 0x391e0f, 0x302015, 0x3b2e23, 0x443124, 0x554133, 0x5e4838, 0x5e4834, 0x5a4633, 0x443424, 0x342a1d, 0x1f180f, 0x150c06, 0x4c3c2a, 0x5c452e, 0x5c422b, 0x5b432c, 0x5b442c, 0x614429, 0x724929, 0x764422, 0x7c4826, 0x804a27, 0x7a4626, 0x723f22, 0x67351b, 0x68351b, 0x6c391a, 0x713f1e, 0x744322, 0x764522, 0x7c4b26, 0x7c4d28, 0x704222, 0x613318, 0x5e3119, 0x60351d, 0x63381f, 0x663c22, 0x693f27, 0x613721, 0x58321d, 0x54321b, 0x492a12, 0x422001, 0x3f1e00, 0x533a23, 0x725b42, 0x988369, 0xa6927c, 0x9a8671, 0x7b6551, 0x634935, 0x4f301b, 0x4f2e16, 0x53321e, 0x603f2c, 0x503120, 0x351a0e, 0x432214, 0x4b2818, 0x4e2e1e, 0x6b4c35, 0x3e2112, 0x5c3826, 0x60402c, 0x452f1d, 0x2b1505, 0x43290f, 0x6e4c26, 0x795126, 0xc6974c, 0xd1a044, 0xd09d45, 0xb37f35, 0x88531f, 0x804718, 0xbb8540, 0xb38139, 0xc29342, 0xc39542, 0xae8030, 0xd1a64b, 0xd3ac51, 0xe0bd67, 0xebd178, 0xf0da7e, 0xe6cc6f, 0xe0c96c, 0xe8ce70, 0xd5b768, 0xf6e38c, 0xf4e283, 0xf4e07f, 0xeed97c, 0xe6d279, 0xd9ca77, 0xb3b66b, 0x89b46f, 0x5fb974, 0x43a55e, 0x449e56, 0x2f8846, 0x227939, 0x2f8045, 0x196c31, 0x3b7d45, 0x567b4c, 0xada176, 0xe4ce95, 0xe2ca87, 0xdac079, 0xd2b36b, 0xcfaf65, 0xd2b266, 0xd1b066, 0xd4b36c, 0xd3b470, 0xd1b375, 0xc8ae7a, 0xac9974, 0x564a39, 0x000000, 0x050501, 0x040200, 0x020100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 0x000000, 0x030200, 0x1d140b, 0x291c0d, 0x372817, 0x402e1c, 0x412f1f, 0x38291a, 0x1a0c02, 0x190f08, 0x4c412f, 0x756548, 0x927f57, 0x9f8a5c, 0xa28d5c, 0xa08958, 0xa08856, 0xa08557, 0x977e51, 0x9c875d, 0x8b7857, 0x836b4b, 0xac9266, 0xac9464, 0xa78e5c, 0xad9260, 0xb89f6c, 0xa58b5b, 0x9e8354, 0x997e51, 0x7c623c, 0x584025, 0x341d0b, 0x321d0e, 0x3e2d1d, 0x322519, 0x2f261c, 0x0d0906, 0x0a0807, 0x151514, 0x191919, 0x171715, 0x181713, 0x1f1d19, 0x1f1c16, 0x292721, 0x3c3c3b, 0x454545, 0x2d2f2e, 0x131715, 0x1d1f1b, 0x23231e, 0x24221b, 0x282019, 0x2c231b, 0x2e241c, 0x3c3329, 0x483d33, 0x47382c, 0x473526, 0x463124, 0x483023, 0x4c3729, 0x4e3d30, 0x3e3229, 0x332d26, 0x2f2720, 0x3e3129, 0x3d2f26, 0x3e3028, 0x3a2e26, 0x524439, 0x7d6553, 0x674b37, 0x5b4636, 0x534436, 0x524438, 0x503f34, 0x4c352a, 0x6c5548, 0x463529, 0x5b4739, 0x5b4536, 0x341f14, 0x402c22, 0x634a3a, 0x6f5543, 0x705744, 0x725946, 0x6f533d, 0x6c4e39, 0x6b4d35, 0x6b4c32, 0x634730, 0x453321, 0x33291d, 0x19130a, 0x120d04, 0x4a3d27, 0x5e4b30, 0x5c482d, 0x59472e, 0x59482f, 0x5f472a, 0x6f4828, 0x754625, 0x774729, 0x714124, 0x6f3f23, 0x6e3d20, 0x67351a, 0x643317, 0x673719, 0x6e3f20, 0x6f4223, 0x67391b, 0x65381c, 0x6e4124, 0x5b3219, 0x623c23, 0x69422a, 0x643e26, 0x56331d, 0x52311b, 0x52321e, 0x4a2812, 0x3d1b00, 0x3c2310, 0x594534, 0x7f6c56, 0xa18d74, 0xa28a6d, 0x896c4c, 0x897056, 0x634a37, 0x432207, 0x3a1900, 0x422513, 0x432718, 0x4a2d1d, 0x4c2f1e, 0x4a2d1f, 0x45291c, 0x33190f, 0x422315, 0x462719, 0x402316, 0x402415, 0x3a2114, 0x44291b, 0x48301f, 0x261106, 0x5f4522, 0xa17a3c, 0xa27235, 0x835220, 0x96642c, 0xca9445, 0xce9641, 0xb07730, 0x763d0f, 0x5f2409, 0x884b21, 0xb1793b, 0xce994b, 0xd7a554, 0xe5b861, 0xe5bb5e, 0xefca6c, 0xe9ca6e, 0xf0d579, 0xf3da7f, 0xecd47a, 0xedd379, 0xcfab5d, 0x956a36, 0xe7cd7e, 0xf2de81, 0xefd97c, 0xf4e186, 0xf4e38a, 0xe4d07a, 0xe1d07c, 0xd3cc81, 0xb0bc7a, 0x73985b, 0x7eb274, 0x82b87b, 0x6fa363, 0x478241, 0x448341, 0x337436, 0x436333, 0xaf9e72, 0xe6cd8e, 0xdcc17a, 0xd1b46c, 0xcdaf67, 0xd3b367, 0xd6b464, 0xddbb6c, 0xd9b86c, 0xd8b86e, 0xd9ba73, 0xdabd79, 0xdbc184, 0xc2ae84, 0x363025, 0x000000, 0x030200, 0x020100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010102, 0x010101, 0x000100, 0x000000, 0x010101, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x312b1f, 0x76684b, 0x907c54, 0xa28c5a, 0xab955e, 0xb39a62, 0xac945d, 0xa88e57, 0xb49862, 0xa18452, 0xa28654, 0x9f8553, 0xa18a64, 0x371d12, 0x573b22, 0x7c623f, 0x90754e, 0x9b7f57, 0x9d835a, 0x937750, 0x785d3c, 0x5a3e25, 0x452611, 0x482e1c, 0x4f3523, 0x4d3522, 0x352111, 0x3c2c1f, 0x544637, 0x231a11, 0x050505, 0x141414, 0x19191b, 0x191819, 0x181718, 0x1c1b19, 0x1c1915, 0x272520, 0x22211b, 0x2e2e2b, 0x4f4f4e, 0x3d3f3f, 0x0f1210, 0x161715, 0x1e1d19, 0x25211b, 0x271f19, 0x30261e, 0x342b24, 0x3a2f27, 0x3b2d23, 0x433124, 0x493527, 0x4b3426, 0x493326, 0x503c2e, 0x47372a, 0x382e25, 0x3a2f28, 0x463931, 0x3d2e24, 0x423228, 0x3c2e25, 0x4d3d32, 0x6d5340, 0x60422e, 0x5a4434, 0x544538, 0x514136, 0x513e34, 0x4d3228, 0x695043, 0x433329, 0x3e2d23, 0x523e33, 0x685040, 0x7e6250, 0x876954, 0x785844, 0x694734, 0x64412d, 0x6b462e, 0x734d32, 0x6d492d, 0x6a492d, 0x5e4128, 0x483623, 0x302619, 0x150f08, 0x120e05, 0x483b24, 0x554527, 0x59492b, 0x554729, 0x56472a, 0x60492b, 0x6e4727, 0x754628, 0x7a492b, 0x794727, 0x754423, 0x6a3c1d, 0x693c21, 0x653b1f, 0x5e3318, 0x5d3118, 0x61381d, 0x663c20, 0x683f22, 0x643c20, 0x633e25, 0x623f28, 0x51311d, 0x452614, 0x3c1c05, 0x391a00, 0x4f392b, 0x705f51, 0x8b7b6c, 0x92806f, 0x947e67, 0x9e8469, 0x8d6f54, 0x7c5835, 0x734b25, 0x5e340c, 0x4c2910, 0x513521, 0x6a4c37, 0x492d1a, 0x422718, 0x472b1b, 0x503322, 0x4e3121, 0x45281a, 0x33170d, 0x3f2113, 0x3d2011, 0x331508, 0x381a08, 0x49321a, 0x503a1f, 0x48341b, 0x543a19, 0xa27a3a, 0xae8035, 0x97682b, 0x602f0a, 0x542102, 0x875626, 0xbb8441, 0xbf8641, 0xa36b35, 0x764422, 0x5b2008, 0x783814, 0x944f21, 0x9d5a27, 0xad7236, 0xba8540, 0xd9a958, 0xdfb45e, 0xe3bb63, 0xe2ba63, 0xd3a853, 0xc6943e, 0xb57f3a, 0x6c2300, 0xbd9d64, 0xebd37f, 0xecd57a, 0xf1dd82, 0xf2e188, 0xf1df89, 0xe9d57f, 0xe1cd78, 0xd7c97b, 0xcfd08e, 0xa6b681, 0xafbc8c, 0xc4cda3, 0x9dae84, 0x4f773d, 0x447238, 0x304a25, 0x4f300c, 0xa98d5c, 0xd4b879, 0xe0c67f, 0xdec479, 0xe3c778, 0xdbbe6e, 0xe7cd80, 0xecd489, 0xecd28a, 0xe8cc83, 0xe0c379, 0xe0c480, 0xd1ba88, 0x4b4230, 0x000000, 0x030300, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000001, 0x010101, 0x000101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000201, 0x000201, 0x000301, 0x000302, 0x020302, 0x000000, 0x453e32, 0x8e7c5a, 0x998352, 0xae965d, 0xb0975c, 0x9d844c, 0xa58b52, 0xb59b62, 0xaa8f59, 0xa4854f, 0x9b7b46, 0xa88c57, 0xa18453, 0x7e6647, 0x1c0000, 0x311003, 0x350d00, 0x290000, 0x350c00, 0x4b2606, 0x542d10, 0x5c3a21, 0x69472d, 0x6b482f, 0x5d402a, 0x412817, 0x2f1606, 0x301b0b, 0x2d1909, 0x4f3f32, 0x352a21, 0x000000, 0x070605, 0x131214, 0x1a191c, 0x19191b, 0x1b1a1b, 0x1d1c1b, 0x1f1f1b, 0x22231d, 0x1e1f18, 0x232220, 0x454645, 0x505253, 0x212425, 0x040504, 0x13120f, 0x1f1b17, 0x28211b, 0x302721, 0x372c24, 0x382b22, 0x403025, 0x3e2b1e, 0x453022, 0x4b372a, 0x453124, 0x443124, 0x3b2b21, 0x362a22, 0x43332b, 0x3d2a20, 0x443127, 0x3d2c22, 0x4a392d, 0x694e3b, 0x6b4d38, 0x674f3d, 0x564336, 0x554237, 0x564037, 0x503328, 0x6e5044, 0x554133, 0x674f40, 0x725645, 0x6c4c38, 0x65422d, 0x623d28, 0x5a3522, 0x5a3624, 0x643d29, 0x6a412a, 0x6f472c, 0x694328, 0x6d4b2f, 0x61442c, 0x483523, 0x32261a, 0x140e06, 0x140d05, 0x433721, 0x524124, 0x4d3c20, 0x605136, 0x67553a, 0x5e4424, 0x734b2a, 0x6f4123, 0x6e3e21, 0x764627, 0x734425, 0x60361c, 0x542d16, 0x532c15, 0x5e371d, 0x633c22, 0x613c21, 0x623e23, 0x5e3b23, 0x55341d, 0x4a2a14, 0x381600, 0x391d09, 0x523e30, 0x796755, 0x998977, 0xa19281, 0x9d8b7c, 0x826e5e, 0x644935, 0x5c3413, 0x5e3103, 0x61330d, 0x653815, 0x774923, 0x7c4f28, 0x603b1f, 0x553824, 0x886548, 0x6a482e, 0x583924, 0x523321, 0x563826, 0x573a29, 0x492f20, 0x30160a, 0x391a0d, 0x381704, 0x785a32, 0xae8b4f, 0xbe9755, 0xb18542, 0xac7f3b, 0xab7c33, 0xad7c2d, 0xb17f33, 0xa16f2e, 0x774a1d, 0x522609, 0x541801, 0x6a2a08, 0x904f23, 0xae6d3b, 0xca8752, 0xc27c4f, 0x954f31, 0x7b2a19, 0x7d2711, 0x7e2a0b, 0x7a2c00, 0x924d07, 0xa66523, 0xb1712c, 0xab6a1f, 0xb67e32, 0xe1b15b, 0xbe8742, 0x550400, 0x844721, 0xd4b16f, 0xf1d782, 0xf7e48d, 0xf3e18a, 0xe5cf77, 0xf0dc87, 0xe3cc79, 0xe5ce7b, 0xe1cf83, 0xd9d092, 0xcdc396, 0xe5dcba, 0xdfd9ba, 0xbdbfa3, 0x667255, 0x636248, 0x7b6d54, 0x7c6343, 0x836741, 0xaa905a, 0xcdb372, 0xdfc47e, 0xe5ca81, 0xebd288, 0xeed78f, 0xecd38e, 0xead18b, 0xe3c57d, 0xd1b274, 0x988159, 0x1e180f, 0x000000, 0x020200, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010100, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010202, 0x010101, 0x000101, 0x010301, 0x020402, 0x000000, 0x7a6e57, 0xa38c5d, 0xa48b52, 0xb69d62, 0xb9a164, 0xa78f54, 0xa68d53, 0xa38950, 0x987c46, 0x9e804a, 0x9e804b, 0x947645, 0x806037, 0x63411c, 0x674828, 0x735536, 0x6e5332, 0x674e32, 0x503823, 0x341a09, 0x300f00, 0x3b1f0c, 0x3d1f09, 0x3d1c02, 0x331200, 0x2e1200, 0x361a0c, 0x3b1e12, 0x432217, 0x513428, 0x37271d, 0x000000, 0x000000, 0x020202, 0x101012, 0x18191b, 0x19191c, 0x1c1c1d, 0x1c1c19, 0x1f201b, 0x20201b, 0x21201c, 0x161510, 0x3a3b3b, 0x515456, 0x35383a, 0x070b0d, 0x171615, 0x24221e, 0x29241f, 0x2a221b, 0x291f17, 0x382b23, 0x433429, 0x3d2c21, 0x453328, 0x473427, 0x412f21, 0x3d2c20, 0x382921, 0x3e2c23, 0x3a261c, 0x432e24, 0x3d2a20, 0x4b372b, 0x6c503e, 0x6c4c37, 0x654837, 0x5a4134, 0x563e33, 0x593e34, 0x543328, 0x715040, 0x684c3a, 0x634432, 0x563523, 0x563521, 0x522f1c, 0x5d3a28, 0x694632, 0x65402c, 0x67412b, 0x663f29, 0x663f29, 0x694028, 0x674026, 0x4e3019, 0x3d2918, 0x2c2116, 0x120c06, 0x140e06, 0x3e331f, 0x48381d, 0x423318, 0x87785d, 0x9a8a6b, 0x5e401b, 0x724b29, 0x673e22, 0x653b23, 0x623920, 0x59321b, 0x512d17, 0x59351f, 0x613c23, 0x5c3920, 0x523119, 0x4b2b15, 0x46260d, 0x391400, 0x452d1d, 0x6b5949, 0x897866, 0x988671, 0xa28f7b, 0x96836f, 0x7e6a57, 0x5c4330, 0x421e00, 0x482302, 0x603b1f, 0x6d4321, 0x693c17, 0x6c3f1b, 0x70421d, 0x825026, 0x8c592c, 0x794e28, 0x5d371d, 0x8f6643, 0x724a2c, 0x5d3a22, 0x4d2f1c, 0x442819, 0x462c1c, 0x301e13, 0x1d0903, 0x381d08, 0x99743e, 0xba8d49, 0xb48235, 0xbe8932, 0xbe882f, 0xbf8731, 0xbf8731, 0xbb8530, 0xb7812f, 0xbd8836, 0xb48034, 0xa06c2d, 0x7e451d, 0x792d19, 0x8e2b1d, 0x941710, 0xb13325, 0xb9472c, 0xa7401f, 0x8d2003, 0x790000, 0x760800, 0x9a5345, 0xc78d7c, 0x975f4b, 0x7d3c13, 0xa16227, 0xd7a04e, 0xd79d4a, 0x97531f, 0x510000, 0x6a2906, 0x9c612c, 0xd0a964, 0xf0d783, 0xf8e58e, 0xe8d179, 0xebd67f, 0xe2cc77, 0xe1c872, 0xebd985, 0xe9da90, 0xd9ca93, 0xc1ac83, 0xd5c3a4, 0xf2ecd9, 0xe3e1d0, 0xd0c3a0, 0xceb682, 0xd1b67c, 0xcfb377, 0xc9ae6d, 0xb99e5d, 0xb09053, 0xa2834a, 0x98763e, 0xa78548, 0xb39253, 0xb19054, 0xa18047, 0x7c5f35, 0x40311e, 0x000000, 0x020200, 0x010100, 0x000000, 0x010001, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000100, 0x000001, 0x000001, 0x000101, 0x000101, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x74674e, 0xa79160, 0xa28850, 0x9b834a, 0x9b824a, 0x9a8048, 0x8e733f, 0x947944, 0xa48a55, 0xa88c59, 0x967a48, 0x806332, 0x8a6d3b, 0x917542, 0x8a6f3f, 0x886b3c, 0x8f7141, 0x957545, 0x9a7c4e, 0x93784d, 0x685030, 0x3e2710, 0x4a321c, 0x593f31, 0x694c46, 0x72504e, 0x70423c, 0x5e2720, 0x551e19, 0x60251d, 0x562219, 0x411d14, 0x1d0d07, 0x000000, 0x060703, 0x14120d, 0x0a0c0e, 0x070c0f, 0x131413, 0x1a1b16, 0x1d1d18, 0x1f1e19, 0x211d19, 0x201c15, 0x302d2b, 0x4b4d4c, 0x444446, 0x1f1f21, 0x1a1a18, 0x23221f, 0x231e1a, 0x251f1a, 0x2b231c, 0x3d3128, 0x3e3026, 0x443329, 0x453427, 0x453326, 0x3d2d20, 0x37291e, 0x3a2922, 0x36231b, 0x402c23, 0x3e2b21, 0x432e22, 0x644633, 0x6b4b35, 0x6b4c39, 0x604131, 0x513529, 0x56382e, 0x543126, 0x725041, 0x53392b, 0x482d22, 0x3f2619, 0x4b3020, 0x61402e, 0x5f3c29, 0x5d3b28, 0x593623, 0x603b27, 0x633e2b, 0x623924, 0x5f351d, 0x694027, 0x644029, 0x4d3724, 0x2c2216, 0x110c05, 0x130e06, 0x3d3421, 0x3b3016, 0x352c16, 0x443821, 0x605032, 0x684b26, 0x744e2c, 0x532f18, 0x512f19, 0x66442b, 0x6b4a30, 0x5e3d25, 0x5a3821, 0x523018, 0x412000, 0x482c14, 0x594333, 0x6e5e52, 0x918274, 0xa89888, 0x9e8b7a, 0x917c69, 0x6b533f, 0x583b26, 0x46260b, 0x492a15, 0x4f3220, 0x4c2f1d, 0x5b3b24, 0x623c20, 0x704523, 0x6d3f19, 0x7c4d23, 0x7d4d20, 0x7b481c, 0x8f5b27, 0x93612b, 0x92612e, 0x855527, 0x653b16, 0x532e12, 0x402211, 0x2a1309, 0x2a180e, 0x1c110a, 0x13060b, 0x7b5e35, 0xbc9046, 0xa06a1c, 0xac7524, 0xd39f42, 0xc89237, 0xbf882f, 0xc48e36, 0xc7943e, 0xc6923e, 0xb9832e, 0xc58f3a, 0xbf8635, 0xae6e34, 0xa44d33, 0x951215, 0x910b11, 0x9f1a1a, 0xb03938, 0xc56d6c, 0xc57b7a, 0xc68384, 0xce9190, 0xd99d9a, 0xe4aaa6, 0xe09e96, 0xb26852, 0x955116, 0xad6d2b, 0xa1652b, 0x9c6530, 0xa26c37, 0x6d3713, 0x572002, 0x844e21, 0xc09655, 0xe7c979, 0xead27e, 0xefda84, 0xe5cf79, 0xe8d37d, 0xebd983, 0xebdb88, 0xe2d08c, 0xaf915f, 0xd7bf9b, 0xddd0ba, 0xf0e9da, 0xe0d1b2, 0xcdb070, 0xd1b36d, 0xd8bc76, 0xdabf76, 0xd9be75, 0xd8bb70, 0xd3b46b, 0xbc9e63, 0x8b7049, 0x593d16, 0x503a1c, 0x3a2815, 0x040000, 0x000000, 0x020201, 0x010201, 0x010101, 0x000101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010001, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x060304, 0x322c23, 0x4e4435, 0x5f5341, 0x695c47, 0x675a43, 0x564834, 0x4b3922, 0x765e39, 0x957a4d, 0x998050, 0x987e4f, 0x997e4f, 0x8f754b, 0x806742, 0x685132, 0x826743, 0x907543, 0x9d854f, 0x9b844f, 0xa8915c, 0x9b8450, 0x9b824d, 0x907543, 0x8a6d3c, 0x785b2c, 0x8d7143, 0x92764c, 0x573d21, 0x6b524d, 0x7e616c, 0x7f6173, 0x886275, 0x885868, 0x6d323b, 0x550002, 0x5b0305, 0x661913, 0x6f2a1d, 0x5c2b1b, 0x553a23, 0x5c4b31, 0x66573b, 0x5f543d, 0x4c4330, 0x2e281b, 0x16160f, 0x151510, 0x1c1b16, 0x221e1a, 0x221f19, 0x27231c, 0x2e2b24, 0x3e3c3b, 0x474747, 0x393a3a, 0x151515, 0x181816, 0x1a1815, 0x231e19, 0x372d25, 0x392b21, 0x3a2a1f, 0x463529, 0x443427, 0x403125, 0x35291e, 0x33261e, 0x32221a, 0x3b2820, 0x3d2a22, 0x4c3629, 0x6e4e3a, 0x7a553f, 0x744f3a, 0x694431, 0x553426, 0x533329, 0x593328, 0x6e4c3e, 0x563c2f, 0x52392a, 0x513626, 0x583a29, 0x583927, 0x4f2f20, 0x513322, 0x563524, 0x65422e, 0x6e452d, 0x784c30, 0x704227, 0x71462b, 0x6b4930, 0x4c3724, 0x2b2215, 0x151008, 0x141007, 0x423a25, 0x3b3218, 0x352e16, 0x2e2811, 0x4a3d1f, 0x5e441f, 0x745130, 0x583821, 0x543521, 0x4f311c, 0x492c15, 0x492d14, 0x5c432e, 0x76614c, 0x8e7b66, 0xa2917e, 0xa29281, 0x887a6c, 0x706257, 0x554437, 0x462f1e, 0x553d29, 0x5a3f2c, 0x604432, 0x4b3324, 0x3e2719, 0x4d3425, 0x634836, 0x63442b, 0x5f3d22, 0x623a1a, 0x794c23, 0x8f5e2d, 0x905d2a, 0x8b5823, 0x976429, 0x9c692b, 0x926129, 0x825625, 0x77532a, 0x73532f, 0x664c2d, 0x564027, 0x392a17, 0x130b07, 0x000000, 0x7b5c31, 0xbe924c, 0xa36f24, 0xaf7825, 0xc18b2f, 0xc69237, 0xca963b, 0xbe8831, 0xd2a44a, 0xd3a54b, 0xcfa04b, 0xd5a44d, 0xba822f, 0xb36e39, 0x963a26, 0xa20c17, 0xa3161b, 0x880000, 0xb75b5e, 0xdb9092, 0xd39093, 0xd08f92, 0xcf9395, 0xce9496, 0xd89c9f, 0xd48787, 0xae4c42, 0x9b542d, 0xca924f, 0xdeab5f, 0xdaa558, 0xb17e42, 0x5b2c0d, 0x2d0801, 0x2d0800, 0x734a24, 0xb1864a, 0xcda961, 0xdec273, 0xe3c672, 0xead27e, 0xf5e38e, 0xf4e491, 0xd7c381, 0xa7885a, 0xc5a87d, 0xbea887, 0xddd3bf, 0xe8dec5, 0xd7c18b, 0xd1b46a, 0xd7ba73, 0xe0c77f, 0xd6bc73, 0xceb065, 0xddbf6f, 0xdabd70, 0xd0b882, 0x574e3d, 0x000000, 0x000000, 0x000100, 0x010200, 0x010101, 0x000101, 0x010201, 0x010201, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000100, 0x010000, 0x010100, 0x000000, 0x251e18, 0x5c503e, 0x77674c, 0x857251, 0x907954, 0x9c845c, 0xa18a60, 0x998257, 0x8d764e, 0x816844, 0x684e2e, 0x573a1e, 0x452b13, 0x3c2812, 0x412910, 0x3f2410, 0x3f2412, 0x4a2c0f, 0x8c6f47, 0x9f824f, 0xaa935c, 0xb19b64, 0xa38d57, 0xa08a55, 0xa38d58, 0x917948, 0x8f7545, 0x896d3f, 0x87693e, 0x785936, 0x654641, 0x785c6c, 0x795e77, 0x785a77, 0x815c7a, 0x8c5e7a, 0x844f63, 0x420000, 0x640506, 0x751815, 0x68120e, 0x62230e, 0x754f2b, 0x634822, 0x604b25, 0x5e4c2b, 0x5f4f35, 0x66593f, 0x5a513b, 0x1f1b11, 0x0e0e0a, 0x14130e, 0x15140f, 0x1d1c15, 0x26231b, 0x25231c, 0x262521, 0x484748, 0x434345, 0x171719, 0x131313, 0x1a1917, 0x211d18, 0x29201a, 0x32261c, 0x3c2c21, 0x3e2e23, 0x3d3024, 0x34291e, 0x2f251c, 0x2d2118, 0x37271f, 0x3a2921, 0x4a3327, 0x73533d, 0x734c34, 0x6b422c, 0x5f3927, 0x533023, 0x563429, 0x522c20, 0x6f4c3d, 0x5d4232, 0x523826, 0x533827, 0x472c1d, 0x452a1c, 0x4d3020, 0x5f3f2d, 0x6a4631, 0x7d573d, 0x6a3f24, 0x75492e, 0x663a21, 0x5c341d, 0x4c2e1c, 0x392819, 0x271f15, 0x16120a, 0x1b160a, 0x4c422a, 0x423a1c, 0x3d371b, 0x403a1e, 0x4a4021, 0x543b19, 0x6f4c2d, 0x42230d, 0x442710, 0x5b4430, 0x78624c, 0x978068, 0xa68f77, 0xa28f78, 0x847360, 0x655544, 0x453223, 0x382513, 0x3d2b20, 0x403025, 0x4c3b30, 0x4b392d, 0x503a2d, 0x563e31, 0x4c3628, 0x453023, 0x412e1e, 0x4b3521, 0x553c26, 0x573c23, 0x5a3a20, 0x6d4826, 0x7c542a, 0x7e5328, 0x7c5023, 0x9a6c33, 0xaf813f, 0xa8793b, 0xa97a39, 0xaa7a39, 0xaa7b3c, 0xb38542, 0xab803f, 0x9f7740, 0x88693c, 0x664c2d, 0x44240a, 0x926938, 0xb48545, 0xbe8b3c, 0xc29037, 0xc9973d, 0xca9941, 0xc1913c, 0xd7aa4f, 0xddb052, 0xc6953e, 0xc2913f, 0xc08a4b, 0xaa6942, 0x6f0000, 0x961318, 0xa31218, 0x8d0000, 0xb05157, 0xc9797f, 0xc67d83, 0xbf7a7e, 0xbb787c, 0xbc7b81, 0xc28488, 0xc98283, 0xae4241, 0xb55a34, 0xca863e, 0xaf7025, 0x995c19, 0x632c00, 0x502505, 0x4e2d10, 0x4b2e13, 0x381a07, 0x5e3a1b, 0x916432, 0xa87c41, 0xb79052, 0xc19f60, 0xc7ad6c, 0xbca86e, 0x665430, 0x644e34, 0xb5986e, 0xc8b08d, 0xe0d5c0, 0xf5f0df, 0xefe2c0, 0xd0b46f, 0xd7ba6e, 0xe4ca7f, 0xe4c97f, 0xd5b76d, 0xd5b769, 0xe1c577, 0xdec78b, 0x796e54, 0x000000, 0x030402, 0x020201, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000101, 0x010101, 0x000101, 0x010001, 0x000000, 0x373127, 0x857359, 0x9a845c, 0xa18b5b, 0x997f4e, 0x997c4a, 0x9f824e, 0x9b7e4c, 0x9c8251, 0x9e8655, 0x9e8456, 0x8c7046, 0x8b7452, 0x3d3225, 0x000000, 0x564a3b, 0x6e573c, 0x745733, 0x7a5b31, 0x7c5a2f, 0x9a7846, 0xa68b56, 0xa9955d, 0xad9960, 0xb19c63, 0xab965f, 0x887140, 0x927847, 0xa08254, 0x917047, 0x724e41, 0x7f5869, 0x7f5c76, 0x7d5c78, 0x7e5a77, 0x835979, 0x8d5879, 0x82485f, 0x581923, 0x6e161d, 0x6f0307, 0x660000, 0x7c3d27, 0x825b37, 0x5c3f17, 0x543a14, 0x4e3714, 0x3d2806, 0x4e3c1e, 0x5c4d31, 0x332917, 0x0f0f0a, 0x141510, 0x171813, 0x191914, 0x1f1e16, 0x211f18, 0x201d17, 0x16150f, 0x373737, 0x454547, 0x242427, 0x0f1012, 0x181817, 0x1a1815, 0x251f19, 0x372d24, 0x2f241a, 0x30271d, 0x30271e, 0x2c261e, 0x29211a, 0x30251e, 0x35271f, 0x443023, 0x6a4b35, 0x6b452d, 0x663f2b, 0x5a3523, 0x532f20, 0x512d23, 0x4f291e, 0x684636, 0x543b2b, 0x45301e, 0x4f3825, 0x563b28, 0x5f3e2a, 0x64412c, 0x633e28, 0x5f391f, 0x724a30, 0x693f23, 0x673c21, 0x623a20, 0x57341d, 0x482f1e, 0x2a1e11, 0x221b11, 0x141008, 0x211b0d, 0x53492d, 0x483d1c, 0x3f3a18, 0x443d1e, 0x4c3f21, 0x543b1a, 0x74532f, 0x927657, 0xa1866a, 0x92785e, 0x917a61, 0x7c664e, 0x5b432b, 0x4d361b, 0x47321f, 0x443121, 0x675646, 0x554437, 0x402e24, 0x433228, 0x4a3a30, 0x4d3d33, 0x423328, 0x3e2c20, 0x473527, 0x473526, 0x463424, 0x3d2d1b, 0x3a2b19, 0x43321f, 0x453220, 0x46331f, 0x45321e, 0x402a15, 0x896637, 0xc39349, 0xbd8838, 0xa97426, 0xae7726, 0xae7625, 0xb27b29, 0xc38c37, 0xb7802f, 0x9e6a22, 0xac7e3c, 0x916531, 0x5e3c20, 0x2f0000, 0x603411, 0x94652e, 0xb38139, 0xc59445, 0xcfa04f, 0xd2a451, 0xd0a24e, 0xcb9c50, 0xcc9c57, 0xc4985e, 0x9e6f48, 0x661409, 0x9d4339, 0x7c0000, 0xa7181b, 0x8d0000, 0x9d373e, 0xc96e78, 0xc17278, 0xc27b7d, 0xbf797c, 0xb97378, 0xb67277, 0xbe787a, 0xa74242, 0xad392b, 0xd5914e, 0xdca44f, 0xc48b3b, 0xaf7c39, 0xb48545, 0xa1743c, 0x6d4820, 0x42230c, 0x250000, 0x1f0000, 0x48260c, 0x503016, 0x533417, 0x46290d, 0x120000, 0x000000, 0x000000, 0x7f6c50, 0xbaa585, 0xc9bda8, 0xd8d1c0, 0xe7dcbd, 0xe5cc8b, 0xe0c375, 0xe3c97c, 0xe5ca78, 0xe5ca7a, 0xe3c97d, 0xe3cb85, 0xc9b582, 0x5c523f, 0x000000, 0x020200, 0x010201, 0x010101, 0x020202, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x000201, 0x010101, 0x010201, 0x000000, 0x38342d, 0x7a6e57, 0x98835c, 0xa99261, 0xa9935e, 0x977c48, 0xad9059, 0x9f824d, 0x9b7d49, 0xa28553, 0xa78b5b, 0x9f8355, 0x91764b, 0xa08961, 0x504331, 0x695c47, 0x85704b, 0x8d7142, 0x997a47, 0x9b7b47, 0x8b6736, 0x81572a, 0x9d7a48, 0xac925b, 0xae955b, 0xb9a167, 0xb49d64, 0xaa915d, 0xad915f, 0x997a4f, 0x714e32, 0x82555f, 0x8a5d77, 0x885b79, 0x865876, 0x845373, 0x895274, 0x915272, 0x78354c, 0x853850, 0x8b3749, 0x720407, 0x6e0704, 0x712f19, 0x613c1c, 0x634825, 0x5d4521, 0x48300c, 0x422c0d, 0x463212, 0x4b391a, 0x3c2e15, 0x181207, 0x18160f, 0x11130e, 0x0f120f, 0x1a1b16, 0x1c1b15, 0x1d1c16, 0x1d1c18, 0x0d0c0c, 0x1f1f21, 0x3b3b3d, 0x353537, 0x19191b, 0x181817, 0x181816, 0x1f1d16, 0x252219, 0x221f18, 0x231f19, 0x2a2620, 0x231f18, 0x241e18, 0x2a221b, 0x38281c, 0x5e402a, 0x6a442c, 0x623c27, 0x5a3421, 0x532e1e, 0x4c291d, 0x4e2c20, 0x654534, 0x553d2b, 0x4a341f, 0x5d422b, 0x65452e, 0x644028, 0x5d3921, 0x5c3821, 0x5d3921, 0x653e27, 0x5d3820, 0x613e25, 0x603e26, 0x61412b, 0x4e3827, 0x291e12, 0x1c160e, 0x0d0a02, 0x211c0d, 0x524a2c, 0x4d431e, 0x483f19, 0x49411c, 0x524522, 0x573e1b, 0x75532d, 0x93724f, 0x805e3f, 0x6a4522, 0x65411d, 0x5b3c1c, 0x553c23, 0x4f3c27, 0x3f3022, 0x3c2b1e, 0x8c7964, 0x695644, 0x3f2b1d, 0x443328, 0x443529, 0x433529, 0x3f3326, 0x3f3125, 0x433627, 0x463727, 0x473a29, 0x423827, 0x413729, 0x3e3628, 0x332d20, 0x2d261c, 0x1a1810, 0x342413, 0x9c713b, 0xab742a, 0xb27a2d, 0xba8331, 0xbb842f, 0xc48e37, 0xb57d27, 0xb9802c, 0xaa7223, 0x9e671f, 0x915d1d, 0x7a4a19, 0x532b0f, 0x3f1e0d, 0x582a12, 0x632c07, 0x783e0b, 0x8b5113, 0x975f1d, 0xa56e25, 0xa6702d, 0x955e27, 0x7e441b, 0x763112, 0x843923, 0xad563e, 0xbf5a45, 0xb0282a, 0xae0f16, 0x920000, 0x98262f, 0xca5d6a, 0xc26770, 0xbe6f74, 0xba7075, 0xb77174, 0xb67276, 0xb97477, 0x933f41, 0xa82926, 0xda9256, 0xe7b25d, 0xc38e3f, 0xba843b, 0xaa7934, 0x936629, 0x7c5620, 0x694a1e, 0x72562b, 0x7e6339, 0x684e30, 0x1a1009, 0x000000, 0x000000, 0x040201, 0x0c0803, 0x000000, 0x5e5548, 0xc5b8a4, 0xeee8da, 0xf1edde, 0xc6ba9a, 0xaa915b, 0xbfa465, 0xcdb474, 0xceb472, 0xcbb172, 0xc3a96c, 0xa98e5a, 0x766141, 0x110d07, 0x000000, 0x010100, 0x000201, 0x000201, 0x010201, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x575044, 0x948563, 0x988456, 0x9e8957, 0xa68f5a, 0x947b46, 0x9d834d, 0x977947, 0x927645, 0x997c4a, 0x917648, 0x886b41, 0x947a51, 0x6a563a, 0x605442, 0x94815a, 0x9c8552, 0x9d834f, 0xa1834b, 0x9f7e45, 0x9e7741, 0x6e461f, 0x6f4723, 0x8a6335, 0x936c3d, 0x8b6b40, 0x95764d, 0x9a7a51, 0x916f49, 0x6a4627, 0x6b3b3b, 0x935e73, 0x8e5a7a, 0x8a5675, 0x895070, 0x9a5476, 0xa35679, 0x8d4260, 0x6e2038, 0x893757, 0x9f4762, 0x77161e, 0x670803, 0x59230f, 0x533213, 0x5f4322, 0x5f4624, 0x4f3716, 0x553e1c, 0x5c4523, 0x65502b, 0x604b29, 0x5b482a, 0x57462e, 0x4d402a, 0x2e2819, 0x10110d, 0x141410, 0x141511, 0x191917, 0x151515, 0x171817, 0x1c1d1a, 0x383837, 0x4a4b4b, 0x1f1f20, 0x191b1b, 0x1c1d1b, 0x1a1b17, 0x1e1e1a, 0x191a16, 0x282722, 0x4f504b, 0x41413d, 0x26221d, 0x302217, 0x5a3d28, 0x724b32, 0x613b25, 0x5a3928, 0x4b2c1e, 0x371c11, 0x4d2f22, 0x624232, 0x5d4431, 0x47301a, 0x533820, 0x5a3a21, 0x5c3a23, 0x5d3b25, 0x553420, 0x472a18, 0x492b1a, 0x4f311f, 0x5c3e29, 0x593c25, 0x503622, 0x362414, 0x1a0d01, 0x000000, 0x030000, 0x1f1b0b, 0x554b2d, 0x4e441e, 0x4c451d, 0x4d461e, 0x524721, 0x594720, 0x684621, 0x643a10, 0x6e451e, 0x7b522c, 0x764f2b, 0x734f2d, 0x65492d, 0x533c28, 0x39291d, 0x2e2115, 0x4e3d2a, 0x503c29, 0x413021, 0x403023, 0x443729, 0x473e2e, 0x423b2c, 0x443d30, 0x474031, 0x433c2d, 0x3f392b, 0x383429, 0x25221a, 0x18160f, 0x060603, 0x000000, 0x000000, 0x1d0e02, 0x916d3d, 0xb28340, 0xb37e2e, 0xbb8530, 0xc79038, 0xc08a34, 0xc48d36, 0xbd842d, 0xb37b2a, 0xa36d22, 0x925b16, 0x643200, 0x57331a, 0x43200d, 0x5b2e15, 0x6d3b17, 0x905c2c, 0x976029, 0x9d652a, 0xae7c3e, 0xbb8d53, 0xbf945c, 0xb98a56, 0xc88c5a, 0xbf724b, 0x8e3c27, 0x831a0d, 0xca4448, 0xdd3e4a, 0xba1622, 0xb92531, 0xd75261, 0xca5a68, 0xc0626d, 0xba6a72, 0xb87075, 0xc07d82, 0xc18083, 0x914c4e, 0x951c1c, 0xae5836, 0xae7539, 0xaf7b37, 0xc39248, 0xd7ae61, 0xd7b268, 0xd6b368, 0xd1ae66, 0xc5a35f, 0xab8c53, 0x584429, 0x000000, 0x050400, 0x080501, 0x0d0904, 0x000000, 0x130d03, 0x988e7e, 0xb8ad9b, 0xe0dbcc, 0xf1eee1, 0xc7c0ae, 0x503700, 0x69502d, 0x654c27, 0x725835, 0x7d633b, 0x69522e, 0x4e3d25, 0x130d05, 0x000000, 0x020202, 0x010201, 0x010201, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010101, 0x000000, 0x352f24, 0x8a7d5f, 0x9a895e, 0x9b8656, 0xa38d5a, 0x9b8552, 0x927a48, 0x947a4a, 0x8e7546, 0x90784a, 0x91794e, 0x88714e, 0x5d492f, 0x000000, 0x69604e, 0xa09069, 0x9c8653, 0x987e49, 0x9c8047, 0xa17e44, 0xa37d45, 0x7b562b, 0x462307, 0x421e04, 0x593417, 0x582e10, 0x5f3417, 0x5f361a, 0x562c15, 0x54291a, 0x895765, 0x95607e, 0x8d5678, 0x8a5171, 0x8d486a, 0xa1496c, 0x9c3c5b, 0x841e39, 0x781731, 0x872f4d, 0xb15470, 0x83242e, 0x5a0000, 0x4b230d, 0x5a3c1c, 0x503518, 0x4d3415, 0x4c3515, 0x4b3414, 0x5d431f, 0x674c26, 0x634824, 0x503514, 0x533c1e, 0x634f33, 0x68573a, 0x4b402b, 0x110f09, 0x0f100f, 0x121213, 0x161719, 0x171a19, 0x1d201b, 0x1b1e17, 0x282925, 0x323331, 0x2d2e2e, 0x1c1e1d, 0x1a1c1c, 0x1c1d1e, 0x161717, 0x252622, 0x696b65, 0x6b6d68, 0x25231d, 0x2f241c, 0x563b27, 0x704d35, 0x674936, 0x634a39, 0x715f51, 0x705f52, 0x4a2f22, 0x523425, 0x4d3627, 0x412f1b, 0x523a25, 0x5d432d, 0x523924, 0x4c3321, 0x452e1f, 0x3b2519, 0x402a1c, 0x422c1c, 0x3a2211, 0x39200a, 0x331b00, 0x433424, 0x5c5444, 0x6e6858, 0x5c5749, 0x201d0f, 0x4e472a, 0x49431e, 0x49481e, 0x46461c, 0x4d4a21, 0x534921, 0x644a23, 0x694720, 0x6e4922, 0x764e28, 0x784f29, 0x754f2c, 0x6f4e31, 0x614730, 0x4f3d2d, 0x3f3124, 0x3e3121, 0x47392a, 0x45392a, 0x453c2d, 0x4b4537, 0x4c4638, 0x4a4639, 0x444135, 0x363328, 0x28261d, 0x12110b, 0x040502, 0x000000, 0x000000, 0x020201, 0x020201, 0x000001, 0x0a0501, 0x5d4122, 0x9e7842, 0xb18440, 0xb08035, 0xbc8a3c, 0xb58131, 0xba8531, 0xbf8a33, 0xbb8632, 0xbb8839, 0xb08341, 0x9d794c, 0x5c412b, 0x330300, 0x57250f, 0x4c1803, 0x5b2a0c, 0x73401a, 0x804d20, 0x946330, 0xa6753d, 0xb6834b, 0xaf7743, 0x9a562c, 0x721f07, 0x630c05, 0x812016, 0xab3233, 0xe34d59, 0xed4959, 0xcb1d2e, 0xd54253, 0xcb4c5d, 0xc55565, 0xc26470, 0xbf6f78, 0xb9717a, 0xc48086, 0xa45f64, 0x870a0e, 0xa0413a, 0x552006, 0x8d6c4f, 0xb69874, 0xb3945e, 0xa98845, 0xa7894b, 0x9d7e42, 0x8c6f3c, 0x6a5532, 0x0f0a05, 0x000000, 0x000000, 0x000000, 0x000000, 0x70695f, 0xc9c2b7, 0xded7ca, 0xb8ae9c, 0xaea694, 0xc7c1af, 0xb8b3a5, 0x000000, 0x000000, 0x000000, 0x120c09, 0x0b0707, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010201, 0x010201, 0x010201, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010000, 0x010101, 0x000100, 0x000000, 0x000000, 0x010101, 0x000000, 0x080502, 0x443927, 0x63563a, 0x7a6b46, 0x8a7750, 0x8e7b53, 0x86714a, 0x8b754e, 0x7c643f, 0x755c3b, 0x584227, 0x3c2a16, 0x180b04, 0x000000, 0x2c261c, 0x877b60, 0x998760, 0x9b8151, 0x997c49, 0xa0804b, 0x947442, 0x987846, 0x8e6e42, 0x745939, 0x6b573f, 0x65513c, 0x503822, 0x3c2312, 0x291100, 0x563238, 0x996882, 0x8e5b7d, 0x8b5273, 0x8a4565, 0x933859, 0x992747, 0x9b1233, 0xa31637, 0x991735, 0x992847, 0xbb4e6b, 0x88222d, 0x5a1807, 0x57331c, 0x412509, 0x473010, 0x614b26, 0x5c4724, 0x574120, 0x573d1a, 0x563a16, 0x694c26, 0x6a4c24, 0x614620, 0x4f3614, 0x5f492b, 0x6b583a, 0x292113, 0x111210, 0x101012, 0x14161a, 0x141819, 0x181e18, 0x191e17, 0x1c1e17, 0x1a1a15, 0x31312f, 0x383938, 0x1f2021, 0x101214, 0x161818, 0x23241f, 0x32322c, 0x52514b, 0x2a2821, 0x2f271e, 0x483120, 0x593c28, 0x573d29, 0x432f1e, 0x645344, 0x665243, 0x4b2e22, 0x523223, 0x462f20, 0x392a1a, 0x4b3b2b, 0x4d3a2a, 0x3d2d1d, 0x3a2a1b, 0x362518, 0x2a1708, 0x261000, 0x3c2919, 0x544332, 0x75634f, 0x9b8a72, 0x9f8f77, 0x908770, 0x6f6a57, 0x312d21, 0x091102, 0x2c3a1b, 0x2e411a, 0x284014, 0x475e37, 0x495f35, 0x3c491f, 0x494621, 0x56451e, 0x5f4721, 0x6f4e28, 0x754e27, 0x694222, 0x6b482d, 0x60442a, 0x584532, 0x4c3d2d, 0x463b2b, 0x484032, 0x484235, 0x454135, 0x3c392f, 0x2c2b22, 0x201f17, 0x0e0f09, 0x000000, 0x000000, 0x000000, 0x010100, 0x020201, 0x010201, 0x010201, 0x020202, 0x010203, 0x000000, 0x26180b, 0x503216, 0x785227, 0x946a35, 0xa67a3f, 0xaf8244, 0xb48644, 0xb98b47, 0xb28444, 0xaf8548, 0x977444, 0x72502f, 0x503118, 0x6a4a2a, 0x84572d, 0x895426, 0x815124, 0x72441f, 0x603215, 0x501f09, 0x612b10, 0x723414, 0x722d0f, 0x6f1f0a, 0x7a2515, 0x862b1c, 0x78160c, 0x932929, 0xc3404c, 0xe24658, 0xcd2d3c, 0x9d121c, 0x8a121f, 0x9c2a39, 0xab4450, 0xaf5660, 0xaa5f66, 0xa9646a, 0xa04d53, 0xb8464b, 0xc15c5a, 0xa46955, 0xd8bfa7, 0xfaeedc, 0xefe5d2, 0x897f6f, 0x170000, 0x230900, 0x070000, 0x000000, 0x000000, 0x3c3932, 0x9a9589, 0xb4afa3, 0x7a7468, 0xbdb19f, 0xdfd7c7, 0xf5f1e5, 0xdbd4c5, 0xa49984, 0xa39a85, 0x747065, 0x000000, 0x000000, 0x000001, 0x000000, 0x000000, 0x000001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x010000, 0x010001, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x0c0803, 0x261c0f, 0x2d1f0e, 0x3a2817, 0x3c2914, 0x3e2815, 0x3f2915, 0x3c2614, 0x332212, 0x1c1107, 0x040100, 0x000000, 0x000101, 0x000000, 0x383021, 0x66573d, 0x7b6643, 0x866e46, 0x93784e, 0x8f764c, 0x8b7247, 0x8d714a, 0x7a613f, 0x5f4d34, 0x433322, 0x281a0c, 0x180e06, 0x0d0000, 0x754653, 0x945c78, 0x864866, 0x76324a, 0x81223a, 0x89112c, 0x9f102e, 0xac0d2f, 0xc62645, 0xd73456, 0xcc365a, 0xbf3d58, 0x902426, 0x713a25, 0x583315, 0x583b19, 0x7d643a, 0x775f34, 0x614c26, 0x5e4723, 0x694f26, 0x583d18, 0x533209, 0x6a4a1e, 0x6d4f25, 0x644c25, 0x4c3516, 0x574428, 0x2a2010, 0x10100e, 0x111213, 0x14181b, 0x131718, 0x151a16, 0x141a13, 0x151a12, 0x171a13, 0x15160e, 0x272723, 0x363734, 0x2a2b28, 0x23231f, 0x25261e, 0x252319, 0x222016, 0x26231a, 0x2c251b, 0x3f2a1a, 0x4d321e, 0x4f3524, 0x331f12, 0x452f20, 0x4f3324, 0x54301f, 0x5f3926, 0x6c5441, 0x302213, 0x35281b, 0x302114, 0x362518, 0x493828, 0x54432f, 0x685746, 0x806e5e, 0x877461, 0x7c6a58, 0x74634f, 0x7f6e5a, 0x3e2f1d, 0x2c1f00, 0x212501, 0x1d4219, 0x205f28, 0x11571f, 0x22632e, 0x32723e, 0x104e18, 0x104c18, 0x174917, 0x174315, 0x44573c, 0x3e492b, 0x524420, 0x71522d, 0x603d1a, 0x5a381c, 0x5d4024, 0x5d4528, 0x624d2c, 0x5c4b2d, 0x514732, 0x2c2b24, 0x010a0d, 0x000000, 0x000000, 0x000000, 0x010100, 0x020302, 0x010201, 0x010101, 0x000201, 0x010201, 0x000201, 0x000201, 0x000202, 0x000201, 0x010201, 0x000000, 0x0a0201, 0x3d2715, 0x634327, 0x7c552f, 0x835b31, 0x825b31, 0x7f5528, 0x6b3f12, 0x6d4218, 0x8f6b39, 0xad8549, 0xbf9251, 0xbc8b46, 0xba833d, 0xb77d34, 0xb57d33, 0xb77f38, 0xb37e3a, 0xab7b3a, 0xa2733b, 0xbc8c5b, 0xb37647, 0x97451f, 0x873019, 0x782113, 0x651109, 0x762928, 0xc75a60, 0xd33e4e, 0xb1141e, 0x930000, 0x810107, 0x800007, 0x8d0513, 0x98212d, 0x8e1e2a, 0x640000, 0x771118, 0xc6585e, 0xc35f62, 0xab6654, 0xd4ac93, 0xe8d5c2, 0xf0e4d3, 0xd1c7b9, 0x625b52, 0xbfb8ae, 0xd5d1c7, 0xa4a298, 0x3c382f, 0xaaa291, 0xccc5b2, 0xeae6d6, 0xe9e3d4, 0xc5b9a6, 0xbcae9c, 0xd2cabb, 0xdcd5c5, 0x898272, 0x484035, 0x000000, 0x000000, 0x010201, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010000, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000101, 0x0a0805, 0x080604, 0x060403, 0x000001, 0x000000, 0x000000, 0x000000, 0x000101, 0x010101, 0x010101, 0x000000, 0x020302, 0x231c11, 0x342616, 0x3f2f1a, 0x46321c, 0x47331c, 0x412d18, 0x3d2a16, 0x2e1e0d, 0x1a0e03, 0x0d0502, 0x070402, 0x000000, 0x351619, 0x6e2d38, 0x722234, 0x782335, 0x600412, 0x761021, 0x7a0a1d, 0x900d24, 0xa70626, 0xd02946, 0xe53454, 0xe03e5d, 0xc64a55, 0x8f3333, 0x795036, 0x7f5b37, 0x765424, 0x7d6135, 0x745d33, 0x604b25, 0x695129, 0x7c6134, 0x7c6232, 0x846637, 0x76582f, 0x634822, 0x5f4823, 0x513b1d, 0x3e2d14, 0x251b0c, 0x060702, 0x0f100d, 0x161618, 0x121517, 0x0f1613, 0x0f1410, 0x121710, 0x151a11, 0x1a1d13, 0x28281f, 0x313129, 0x41403b, 0x35352f, 0x27291e, 0x28291c, 0x1f1f13, 0x201e13, 0x2b2518, 0x46331e, 0x563a25, 0x4c3121, 0x361d12, 0x412617, 0x52301f, 0x593321, 0x5a321e, 0x7c624d, 0x7d6c57, 0x503e2c, 0x5e4934, 0x6a523c, 0x755d44, 0x907a60, 0x877260, 0x69564a, 0x453023, 0x301505, 0x270b00, 0x2b1200, 0x2e1f10, 0x332f1b, 0x253e18, 0x236426, 0x2a8739, 0x338f47, 0x529b5e, 0x56965e, 0x568b5a, 0x628e60, 0x6b9065, 0x6f8f65, 0xbdcfb3, 0xa5b49a, 0x001c00, 0x493b19, 0x7a5c35, 0x937242, 0x9b763c, 0xa07a38, 0x9e7939, 0x8b6930, 0x7d5f30, 0x664e2b, 0x534328, 0x241d11, 0x000000, 0x000000, 0x010200, 0x010201, 0x010202, 0x010202, 0x000201, 0x000201, 0x000201, 0x000201, 0x000201, 0x010201, 0x000301, 0x010302, 0x000101, 0x000000, 0x000000, 0x100702, 0x281a0c, 0x352514, 0x2c1709, 0x614828, 0xb98f53, 0xbe914b, 0xb28035, 0xb47d2e, 0xaf7521, 0xb87e2a, 0xbe8430, 0xc08933, 0xbb832d, 0xbc8633, 0xc08d3a, 0xba8634, 0xc08d4d, 0xb97d48, 0x8d431f, 0x671f0f, 0x48100a, 0x2d0503, 0x2b0b08, 0xbb565b, 0xcf3c47, 0xb41019, 0xa8080e, 0x9c040a, 0x920004, 0x8f030b, 0x8a0812, 0x8d1b23, 0x801b22, 0x670003, 0x993c40, 0xb4595a, 0x9d604f, 0xc89980, 0xc5a289, 0xd9c2ab, 0xcab8a4, 0xb4a592, 0xd0c5b4, 0xede7db, 0xebe8db, 0xb7afa0, 0xbcaf9b, 0xa89b87, 0xd7cebe, 0xe9e2d1, 0xc3b7a3, 0x9b8974, 0xb2a28d, 0xbbb0a1, 0x363531, 0x000000, 0x000000, 0x010101, 0x010101, 0x000100, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000101, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020201, 0x010201, 0x010202, 0x010202, 0x000101, 0x000102, 0x000102, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 0x000000, 0x000000, 0x050402, 0x080503, 0x050302, 0x000001, 0x000000, 0x000001, 0x000101, 0x000001, 0x000000, 0x3c1d20, 0x5f1f26, 0x6a1824, 0x731727, 0x6f1522, 0x6d1122, 0x6f0d1f, 0x8f182c, 0xba253f, 0xc21631, 0xd61f3a, 0xd13847, 0xa74044, 0x591804, 0x5f3110, 0x937149, 0x97784a, 0x785a2e, 0x5e431b, 0x533b13, 0x644b24, 0x81663c, 0x806233, 0x765625, 0x76582d, 0x634a28, 0x5b4628, 0x443118, 0x31220e, 0x221a0d, 0x040502, 0x050505, 0x0a0a09, 0x111213, 0x101313, 0x0f110d, 0x0e120b, 0x151710, 0x1a1c12, 0x232319, 0x39372f, 0x2a2921, 0x1e1f16, 0x24261d, 0x27291e, 0x25271a, 0x27291c, 0x2f2a1b, 0x503c25, 0x5d4129, 0x4b2e1e, 0x472c1e, 0x523525, 0x583626, 0x543020, 0x4d2c1c, 0x54341f, 0x765d47, 0x775e46, 0x967c64, 0xa89077, 0x9c856f, 0x614331, 0x4a2314, 0x40180d, 0x3d1d13, 0x402418, 0x3b2216, 0x362215, 0x302213, 0x32301b, 0x27481d, 0x145119, 0x025311, 0x438e4f, 0x73c17d, 0x74b778, 0x7eb57d, 0x85b27e, 0x86ac7c, 0x85a376, 0xadbfa3, 0xc9d8c0, 0x264413, 0x4d481d, 0xa78548, 0xb0823a, 0xab7b2c, 0xb1812e, 0xa57729, 0x996c25, 0x966c2d, 0x8e652b, 0xa07e43, 0x947642, 0x62502d, 0x020201, 0x000000, 0x010201, 0x010201, 0x010201, 0x010201, 0x010101, 0x010101, 0x010101, 0x000201, 0x010101, 0x010201, 0x010101, 0x010101, 0x020201, 0x020302, 0x000201, 0x000000, 0x000000, 0x000000, 0xa38553, 0xb08139, 0xa37026, 0xb17b2c, 0xb78232, 0xba842f, 0xbd852f, 0xcb953c, 0xc89137, 0xcc953c, 0xc7923c, 0xc9963e, 0xc79136, 0xba8330, 0xad7633, 0x8d5b2e, 0x54331b, 0x000000, 0x000000, 0x000000, 0x862f30, 0xd0444a, 0xcb3c45, 0xa1181f, 0xa4161b, 0xb7282c, 0x9b0710, 0xa5151f, 0xa7232c, 0x7a1017, 0x6c0f17, 0x781f23, 0x6d2a28, 0x5d392a, 0xa27c65, 0xbf9e84, 0xb89c85, 0x867161, 0xa49383, 0xaa9986, 0xbbaf9e, 0xd2c9b7, 0xb0a391, 0xaa9a86, 0xa4937d, 0xbaab96, 0xc6b9a4, 0x938674, 0x6d5b48, 0x847665, 0x625a51, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000001, 0x000001, 0x000101, 0x000201, 0x010201, 0x010201, 0x010201, 0x000101, 0x000000, 0x291615, 0x491f23, 0x55151e, 0x6a1925, 0x7a1f2b, 0x6b0f1c, 0x6a0d1c, 0x8c1b2c, 0xb42b40, 0xbd283a, 0xac1221, 0x951d22, 0x68110e, 0x864f33, 0x865935, 0x653905, 0x805e35, 0x8f7246, 0x8b7044, 0x7e653a, 0x786137, 0x786038, 0x846a42, 0x7e653e, 0x725a35, 0x634e2e, 0x443219, 0x2d2009, 0x261d0c, 0x0e0803, 0x000000, 0x000000, 0x000000, 0x000000, 0x08090a, 0x0b0d0a, 0x0d0e09, 0x10100a, 0x19180f, 0x222116, 0x2d2a22, 0x1f1e18, 0x181913, 0x181a12, 0x202219, 0x22251a, 0x26281c, 0x2e2919, 0x533e25, 0x5b3d24, 0x482919, 0x4c2f22, 0x533527, 0x5c3d2c, 0x583928, 0x563929, 0x563726, 0x5c3924, 0x593823, 0x492917, 0x371604, 0x331205, 0x4f2921, 0x69372e, 0x622c25, 0x58271f, 0x4a2217, 0x442116, 0x3b2115, 0x322315, 0x2b2714, 0x26461f, 0x1a5320, 0x347543, 0x387f47, 0x5fb070, 0x69b376, 0x7ab880, 0x6e9e6e, 0x6d9368, 0x6d8d65, 0x8ca284, 0xd7e9d2, 0x68825f, 0x475109, 0x946f22, 0xa77321, 0xb68434, 0xae7c2d, 0xaa7726, 0xa37227, 0xa77934, 0x885b17, 0xa2762b, 0xa97d2d, 0xad8b4a, 0x66512f, 0x000000, 0x000101, 0x010100, 0x010201, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010000, 0x010000, 0x010101, 0x010101, 0x010202, 0x010302, 0x000001, 0x090200, 0xa08150, 0xb68940, 0xb58234, 0xba8838, 0xd6a752, 0xcc9a41, 0xb98531, 0xc4903a, 0xc6913c, 0xd8a448, 0xb77f2a, 0xd09d3e, 0xd09d3d, 0xd29d40, 0xc78e37, 0xca8f41, 0xac7635, 0x886032, 0x432e1c, 0x000000, 0x330907, 0x81282a, 0x8f272c, 0x902329, 0xa83034, 0xb22f33, 0xa92128, 0xab282f, 0x84191f, 0x6a161a, 0x682125, 0x5b2324, 0x220907, 0x090000, 0x4d3526, 0x735947, 0x6e5a4b, 0x322720, 0x7d6d5f, 0xa39181, 0xae9d8b, 0xb8a894, 0x7c6d5d, 0x6e5e4e, 0xa08e7a, 0xa7947f, 0x9f917f, 0x3b362e, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010201, 0x000201, 0x000201, 0x000201, 0x010101, 0x000000, 0x170909, 0x38161b, 0x571a20, 0x6d171d, 0x710e14, 0x660910, 0x570206, 0x5f0506, 0x731115, 0x701515, 0x5b0303, 0x6e3827, 0x8a563b, 0x95673f, 0x956b3e, 0x714b1f, 0x633f0b, 0x624211, 0x5f4115, 0x5d4318, 0x584017, 0x563d16, 0x4b3512, 0x3d2700, 0x281700, 0x2e3d1d, 0x293e1f, 0x1a2e16, 0x142815, 0x192c18, 0x22321f, 0x2d3527, 0x2c2e23, 0x2b291f, 0x312e23, 0x2c281f, 0x121008, 0x18150b, 0x1e190d, 0x37342d, 0x403f39, 0x0d0e09, 0x161812, 0x1c1f18, 0x1f2219, 0x23251a, 0x302b1b, 0x523d23, 0x5c3d24, 0x4c2d1c, 0x4e3224, 0x543629, 0x503224, 0x5d3e2f, 0x5a3a2c, 0x512f21, 0x56301f, 0x532d1b, 0x573729, 0x49291f, 0x3b140c, 0x58241f, 0x6b2522, 0x6d1a19, 0x6b1c1a, 0x671d18, 0x5e1a13, 0x511607, 0x411801, 0x2e230f, 0x203d18, 0x043d0b, 0x337845, 0x55b16f, 0x4bab6a, 0x4aa668, 0x5da56d, 0x598f62, 0x5c8863, 0x5e8460, 0x738f72, 0xd1e5d1, 0x88aa84, 0x385300, 0x917228, 0xa57220, 0xb5802d, 0xaf7b27, 0xab7826, 0xa46e1c, 0xa97823, 0xb88a33, 0xae7f24, 0xb28734, 0xb69248, 0x826539, 0x261f15, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010001, 0x010001, 0x000100, 0x000000, 0x010101, 0x010101, 0x000101, 0x000101, 0x010302, 0x010202, 0x000202, 0x000000, 0x6a4d28, 0xa98143, 0xb6883d, 0xb78533, 0xb88631, 0xc5933b, 0xcf9d43, 0xca963c, 0xd19e40, 0xd7a544, 0xd2a243, 0xe1b44f, 0xdfae47, 0xd29b3d, 0xb77923, 0xc88831, 0xc4842f, 0xc28a3b, 0xa5804b, 0x3a2d1e, 0x000000, 0x070000, 0x3a0e0f, 0x50191b, 0x5a1c1d, 0x4e0d10, 0x4e0d10, 0x470c0d, 0x340507, 0x260506, 0x190303, 0x010000, 0x000100, 0x000201, 0x000000, 0x000000, 0x000000, 0x000000, 0x332921, 0x78675a, 0x8f7d6c, 0x766656, 0x23170f, 0x080000, 0x493b31, 0x564a3e, 0x2f2722, 0x000000, 0x000101, 0x000000, 0x000001, 0x000000, 0x010101, 0x010000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000201, 0x000202, 0x010101, 0x030100, 0x000000, 0x000000, 0x000000, 0x25090b, 0x611d1a, 0x751b1a, 0x6d1512, 0x5e130e, 0x5a0e0a, 0x580e0b, 0x531412, 0x3f0606, 0x4d2110, 0x9b6b4b, 0x713e17, 0x82562d, 0x977042, 0x957244, 0x8c6b3d, 0x7d6034, 0x6f572e, 0x6a542f, 0x614d2b, 0x493d1a, 0x444f38, 0x6a856d, 0x21512a, 0x15451e, 0x1a4522, 0x194725, 0x1f5029, 0x205027, 0x284e27, 0x2f4724, 0x33391f, 0x3d3621, 0x524834, 0x463c2b, 0x1b1307, 0x191509, 0x242019, 0x32312c, 0x151510, 0x151811, 0x1b1e17, 0x1c1f16, 0x232419, 0x302b19, 0x4d391d, 0x5f4026, 0x523421, 0x523527, 0x543527, 0x503024, 0x533327, 0x512f22, 0x552f22, 0x512518, 0x5f3626, 0x785342, 0x5d352b, 0x480d09, 0x550c0d, 0x630506, 0x690104, 0x6c0000, 0x6f0000, 0x650000, 0x723a37, 0x8e5448, 0x66290d, 0x547141, 0x3f7d43, 0x005d1d, 0x319852, 0x3eaf6b, 0x5cc887, 0x54a870, 0x438157, 0x4e835d, 0x4f7f5c, 0x5d8365, 0xc6e1cc, 0x99c79f, 0x2f681a, 0x827226, 0xa1741f, 0xbc8931, 0xb48029, 0xaf7a24, 0xa9731b, 0xab7920, 0xb38932, 0xcaa550, 0xc6a24d, 0x9f7c37, 0x9b845a, 0x292116, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010000, 0x010000, 0x010000, 0x000100, 0x010101, 0x010101, 0x010101, 0x010201, 0x020302, 0x010302, 0x000303, 0x000000, 0x311e0c, 0x654118, 0x90662e, 0xaa7c39, 0xb2833b, 0xb7893e, 0xc29241, 0xc3903b, 0xd19d42, 0xd3a142, 0xe1b550, 0xe1b24c, 0xd7a345, 0xc38b39, 0xcc8f35, 0xcc8b31, 0xc8872f, 0xd39e44, 0xc9a35c, 0x796648, 0x000000, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x000001, 0x000101, 0x000101, 0x000101, 0x010101, 0x020101, 0x010101, 0x000000, 0x000101, 0x020202, 0x000000, 0x000000, 0x080000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020202, 0x010101, 0x000101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x020202, 0x000000, 0x090203, 0x392e21, 0x5d4c39, 0x725a42, 0x7e5941, 0x7a422f, 0x7f382c, 0x84372b, 0x7a3127, 0x73291f, 0x611e15, 0x4a170f, 0x220000, 0x390f01, 0x7b4c2b, 0x93663f, 0x7e5228, 0x744919, 0x784f1e, 0x86612e, 0x81612d, 0x745929, 0x674f25, 0x55421d, 0x2e3300, 0x5c7c62, 0x689179, 0x27634a, 0x265942, 0x23523a, 0x1f5437, 0x205d36, 0x125729, 0x125523, 0x174a1c, 0x324926, 0x474527, 0x4a3b20, 0x493922, 0x362815, 0x281e15, 0x17130d, 0x070803, 0x11130d, 0x161912, 0x1a1c15, 0x1a1b14, 0x1f2114, 0x302b19, 0x533d21, 0x604127, 0x543421, 0x553526, 0x523123, 0x4e2d21, 0x4e2e23, 0x502c22, 0x4d251b, 0x4e2015, 0x5a2f21, 0x592c20, 0x51110d, 0x721415, 0x800c13, 0x9b242a, 0x9b141d, 0x943f40, 0xb67f7e, 0xcf9f9d, 0xdcafaa, 0xe7b7aa, 0xc28d7b, 0x77703f, 0x72b46d, 0x13843a, 0x068237, 0x1c9652, 0x41bf7e, 0x2e8f58, 0x347d51, 0x44865f, 0x43805e, 0x497f5f, 0xb5ddc4, 0xa5e2b7, 0x459449, 0x858e3e, 0xa28234, 0x9f6f1f, 0x9c6915, 0x9d6913, 0xb98933, 0xc19841, 0xc8a34a, 0xc8a753, 0xc5a558, 0xc5a76a, 0x957e58, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x0c0908, 0x1e1711, 0x382112, 0x553010, 0x6e4217, 0x7d5120, 0x865621, 0x8e5a20, 0x8f571b, 0x9b611e, 0xae782e, 0xc69647, 0xbf904a, 0xb9863d, 0xd6a040, 0xdea63e, 0xd59c3a, 0xd6a241, 0xd9ae53, 0xc8a86a, 0x8d795a, 0x000000, 0x000101, 0x010102, 0x010202, 0x000202, 0x000202, 0x010102, 0x010101, 0x020201, 0x010101, 0x000101, 0x010101, 0x010102, 0x010101, 0x020101, 0x010101, 0x010101, 0x020201, 0x010101, 0x000000, 0x000000, 0x000001, 0x010102, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010001, 0x010101, 0x010001, 0x000100, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x000101, 0x010101, 0x010101, 0x010101, 0x000100, 0x000100, 0x010101, 0x010101, 0x000000, 0x000101, 0x000101, 0x010001, 0x010101, 0x020201, 0x000000, 0x342d23, 0x74634b, 0x927750, 0xa38258, 0x98724a, 0x885a34, 0x7a4526, 0x6f3219, 0x752915, 0x7a2d1a, 0x7f3421, 0x74301c, 0x7b3f2a, 0x6f3f2b, 0x442013, 0x653b20, 0x6a4222, 0x77522c, 0x876236, 0x876334, 0x805e2d, 0x7e5d2c, 0x735629, 0x675026, 0x4e471f, 0x25451e, 0x3c6e55, 0x336d59, 0x2e6856, 0x2f6957, 0x2f6756, 0x285f4e, 0x2d6c53, 0x347a5a, 0x4d9671, 0x3c7757, 0x093e1b, 0x353f1c, 0x483a1a, 0x483618, 0x412f16, 0x281a0e, 0x161009, 0x10110c, 0x13140f, 0x14160f, 0x171a13, 0x181b12, 0x1b1d11, 0x2b2614, 0x554023, 0x664529, 0x573621, 0x533222, 0x4e2c1f, 0x4c2b1f, 0x4e2d22, 0x48231a, 0x492018, 0x4e2119, 0x46150e, 0x5b100e, 0x760e11, 0x9a1921, 0x930b14, 0xa51822, 0xbd5f60, 0xeaafac, 0xe6b9b8, 0xdcb6b6, 0xd9b7b5, 0xe0beb6, 0xebc4b7, 0xae8879, 0x769a5d, 0x64bd6f, 0x39b063, 0x2ca35e, 0x52d996, 0x2da167, 0x1c7040, 0x2c714a, 0x2b704b, 0x31734f, 0x649a7b, 0x6bb287, 0x53a362, 0x6a8641, 0x867135, 0x987537, 0x946d2b, 0x9d722d, 0xab8137, 0xad8942, 0xbb9b51, 0xbda05c, 0xb3955b, 0x967b4c, 0x44331e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000201, 0x010101, 0x010101, 0x030202, 0x000000, 0x000000, 0x61533f, 0x8b7655, 0x9a8158, 0xa38557, 0xa58353, 0xa88351, 0x967041, 0x7e5b32, 0x6f5030, 0x593519, 0x673814, 0x7e4921, 0x99693c, 0x9c6d36, 0xad7e3c, 0xc69546, 0xd29d3f, 0xcd9a38, 0xd6a844, 0xd7ac49, 0xd6b053, 0xcaaa63, 0xc1a978, 0x5f4d38, 0x000000, 0x000201, 0x000201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010102, 0x010102, 0x010101, 0x010101, 0x010201, 0x000201, 0x010101, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010100, 0x010101, 0x000101, 0x010101, 0x000100, 0x010101, 0x010000, 0x010101, 0x010001, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010001, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000201, 0x000101, 0x000001, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000201, 0x000102, 0x010101, 0x000000, 0x373129, 0x7d6c50, 0xa08457, 0xaf8e5e, 0xa88556, 0xa68254, 0xa27d4e, 0x936a3f, 0x84542d, 0x804221, 0x8e4125, 0x954a2c, 0x8d4a2c, 0x7d4123, 0x8c593b, 0x583521, 0x745239, 0x5f3b1c, 0x66421f, 0x69451d, 0x704d20, 0x775325, 0x735125, 0x684b21, 0x56431c, 0x344116, 0x315d41, 0x497f6b, 0x346b5c, 0x2b6355, 0x2a6355, 0x2b6355, 0x286052, 0x296a54, 0x52a281, 0x5ab48d, 0x5cb38a, 0x50956e, 0x41522c, 0x574821, 0x4e3818, 0x3b250b, 0x2c1c0c, 0x1c150b, 0x0f0f08, 0x151611, 0x11130e, 0x12150e, 0x16170f, 0x1a1b0f, 0x26200e, 0x543e1f, 0x6a492a, 0x573621, 0x4f2c1e, 0x49271c, 0x47271b, 0x47271c, 0x47241b, 0x431e16, 0x461e17, 0x460d0a, 0x7d181a, 0x961b21, 0x961320, 0x921423, 0x7f0000, 0xd5908f, 0xf0bdba, 0xdcafb0, 0xd6aeb0, 0xd1b1b2, 0xd1b3b3, 0xdabdb6, 0xe6c5b9, 0xa0816f, 0x749c5f, 0x6ecc80, 0x41b86e, 0x4cd490, 0x24985e, 0x005724, 0x095026, 0x12572d, 0x1b6036, 0x045529, 0x175a2f, 0x366f3e, 0x38592d, 0x261600, 0x46310e, 0x573e17, 0x694e21, 0x745827, 0x816434, 0x785b2f, 0x71552c, 0x624b2e, 0x2c2014, 0x000000, 0x020202, 0x000001, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000101, 0x010100, 0x020202, 0x000000, 0x574933, 0xaf9369, 0xbb9561, 0xb4874a, 0xb08038, 0xbb8834, 0xb98431, 0xc28b38, 0xc38e3d, 0xb68538, 0xaa7d3b, 0x9c743f, 0x72512e, 0x52250a, 0x835930, 0xa37840, 0xb88f4b, 0xc49a54, 0xc79d55, 0xc7a055, 0xd2af61, 0xc9a85a, 0xbca05c, 0x998251, 0x59472d, 0x000000, 0x020303, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010102, 0x010201, 0x000201, 0x010201, 0x010201, 0x000100, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000101, 0x000201, 0x010201, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000004, 0x050506, 0x000002, 0x000000, 0x000000, 0x000000, 0x000000, 0x020201, 0x010101, 0x010101, 0x000000, 0x645848, 0x937a54, 0xa88a5a, 0xa88a58, 0xa38455, 0x9b7b4d, 0x9d7b4c, 0x8f6b3d, 0x765025, 0x825429, 0x8a502a, 0x894725, 0x93532e, 0x8f5b37, 0x8d6142, 0x462717, 0x644831, 0x7f5f41, 0x6e4d29, 0x734c21, 0x6f4a1d, 0x664216, 0x5b3b16, 0x4a310e, 0x3a3a12, 0x234a1f, 0x457960, 0x467c6b, 0x356a5c, 0x255b4e, 0x255e51, 0x255f51, 0x276254, 0x35765f, 0x60b492, 0x5db994, 0x67c097, 0x4c9368, 0x3f4a22, 0x473511, 0x452c10, 0x422910, 0x2b1b0a, 0x1c130a, 0x030200, 0x060804, 0x13110a, 0x121107, 0x0d0d05, 0x0f0f05, 0x251c0a, 0x533c1f, 0x6a4a2c, 0x4f2d19, 0x472618, 0x3c1c13, 0x381911, 0x3d1e16, 0x3b1b13, 0x391710, 0x421d15, 0x571a15, 0x8e1e1f, 0xb63c43, 0xb13343, 0xae2941, 0x9a0f2d, 0x943e45, 0xdea1a4, 0xe3adb0, 0xdbacad, 0xd6afae, 0xd1b1b1, 0xcfb5b2, 0xdcc2ba, 0xe8c9bc, 0x946e58, 0x769454, 0x4fa75e, 0x229754, 0x23884b, 0x2a804b, 0x155d31, 0x206236, 0x296b3c, 0x246133, 0x296134, 0x113a15, 0x222f12, 0x423c23, 0x52462d, 0x4e3f26, 0x574728, 0x554524, 0x463618, 0x322415, 0x030002, 0x000000, 0x000000, 0x000000, 0x000001, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010000, 0x010101, 0x010101, 0x010101, 0x000000, 0x463a2b, 0xb79465, 0xbb8b47, 0xab7423, 0xbd8834, 0xc9953a, 0xd29e3f, 0xc1872d, 0xb37520, 0xc18733, 0xcb9539, 0xc18c30, 0xb88433, 0xb68a45, 0x765935, 0x200000, 0x47260f, 0x5d3b1c, 0x75532b, 0x876536, 0x916f3c, 0x906f3c, 0x896936, 0x7d6438, 0x54432a, 0x000000, 0x000000, 0x000000, 0x000002, 0x494439, 0x6c624b, 0x786d51, 0x766a4f, 0x6c6149, 0x5a5342, 0x302d27, 0x000000, 0x000000, 0x000000, 0x020303, 0x010201, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000100, 0x000100, 0x000000, 0x010101, 0x010101, 0x010000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000100, 0x010101, 0x010101, 0x000201, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x010201, 0x010302, 0x000000, 0x000000, 0x393227, 0x635945, 0x796d56, 0x7f7156, 0x857558, 0x867558, 0x827357, 0x76684f, 0x635945, 0x433c31, 0x000000, 0x000000, 0x030302, 0x000001, 0x000000, 0x6d614e, 0x937c55, 0x9e8354, 0x9a7e50, 0x9c8051, 0x907347, 0x9f8153, 0x947546, 0x856133, 0x92683b, 0x7a451c, 0x975f33, 0x99643b, 0x9d7049, 0x735135, 0x200a03, 0x221108, 0x553d28, 0x775938, 0x88673e, 0x8a683b, 0x866439, 0x7a5b35, 0x5f4b28, 0x384f21, 0x3e6c4a, 0x4b836c, 0x427a68, 0x34685b, 0x22564a, 0x22584d, 0x276156, 0x1f5b4d, 0x44886d, 0x68bf99, 0x6ac39a, 0x68bc8e, 0x478353, 0x50451a, 0x5f4824, 0x5f4424, 0x371c02, 0x392814, 0x513f23, 0x5a4726, 0x675431, 0x6c5631, 0x69522d, 0x68512e, 0x574327, 0x271803, 0x462f14, 0x593a1d, 0x3c0d00, 0x3b1403, 0x482e1a, 0x51371f, 0x4c2f18, 0x4c2c18, 0x4b2715, 0x603629, 0x5a1e15, 0x953130, 0xa1292d, 0x9b0012, 0xa90024, 0xa7092d, 0x930024, 0x9a4853, 0xe19fa3, 0xe6abaa, 0xdfaaa9, 0xd7b0ad, 0xd5b8b3, 0xddc1bb, 0xe6cac2, 0xd9b0a1, 0x99653b, 0x6d864a, 0x1e7a3a, 0x2c884c, 0x55a870, 0x357247, 0x063f16, 0x21542b, 0x396c3d, 0x3b703d, 0x264318, 0x0c1400, 0x171306, 0x433b29, 0x4f412b, 0x514026, 0x524021, 0x635236, 0x706049, 0x4a4134, 0x626059, 0x888780, 0x6d6d68, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x6c583e, 0xa87946, 0xad7228, 0xb27827, 0xbf862e, 0xd4a042, 0xcd973a, 0xc3882d, 0xbf8633, 0xb67e2b, 0xc69136, 0xdaa645, 0xc89336, 0xc59842, 0xaa8a55, 0x241d17, 0x000000, 0x0d0503, 0x27190c, 0x372715, 0x3e2c1a, 0x392717, 0x332414, 0x1f160c, 0x000000, 0x000000, 0x110d0e, 0x8d7f61, 0xc1ae7f, 0xd5bd87, 0xd9be82, 0xcfb378, 0xceb176, 0xd0b477, 0xceb57c, 0xc0aa78, 0x9f8c68, 0x6d5f4c, 0x231e1b, 0x000000, 0x030302, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000101, 0x000101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x595040, 0x8e7f63, 0xa18f6d, 0xa49066, 0xa89365, 0xa99360, 0xab945f, 0xa48d5b, 0xa08958, 0xa49063, 0xa08e65, 0xa08f6c, 0x80745b, 0x1c1813, 0x000000, 0x010101, 0x000000, 0x4b4232, 0x907e5e, 0x967f56, 0x92784d, 0x997f51, 0xa68a5a, 0xa98d5d, 0xa58655, 0xa5814c, 0x9e7743, 0x8d6234, 0x986e45, 0x9b744d, 0x7c5b3a, 0x472f1d, 0x090401, 0x000000, 0x0f0703, 0x301f10, 0x4e3821, 0x5b4226, 0x644c2d, 0x594428, 0x413c1c, 0x3f623b, 0x83ad90, 0x3f7b61, 0x37735e, 0x225948, 0x1a4f42, 0x184f44, 0x1d5449, 0x094939, 0x57a585, 0x6ec59c, 0x60b387, 0x51a16a, 0x527747, 0x543e10, 0x4d3006, 0x583e1e, 0x79603b, 0x7d633a, 0x785d31, 0x745729, 0x775a2c, 0x795b2a, 0x85662f, 0x916e35, 0x8e6a35, 0x553b1c, 0x230000, 0x7d6031, 0xb19150, 0xc6a45a, 0xc7a360, 0xbc9558, 0xaa7e4b, 0x986c42, 0x81512f, 0x733f23, 0x6a341d, 0x78291f, 0xd16361, 0xc43941, 0xd34d5d, 0xc64052, 0xad1233, 0x900018, 0xaa5b62, 0xe49fa2, 0xe3acab, 0xdeb7b3, 0xe0c1bb, 0xe0c3bd, 0xe3c3bd, 0xe1b1a9, 0x994232, 0x775129, 0x5d7b43, 0x256332, 0x2b6539, 0x2b532c, 0x2f4b23, 0x233f15, 0x2e4314, 0x666a2f, 0x8a813c, 0x6e5f31, 0x180d00, 0x312715, 0x8c8273, 0xaea595, 0xa79d8b, 0x6c5b45, 0x655339, 0x887e70, 0xc1bdb1, 0xdeddd0, 0xeeefe2, 0x8c8b83, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x3e2c19, 0x9c7040, 0xbc853d, 0xca933e, 0xc68c32, 0xc78d30, 0xc3892d, 0xc78e34, 0xc48f37, 0xc38f38, 0xc48e34, 0xcf9a3d, 0xca963a, 0xc59944, 0xb8985f, 0x392b1b, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x332b1f, 0xb5a176, 0xd7b876, 0xcea95d, 0xcda558, 0xcca253, 0xc69d53, 0xceaa62, 0xd6b468, 0xd8b668, 0xdcbc6d, 0xd8bb74, 0xc4aa71, 0xa79470, 0x615747, 0x000000, 0x020202, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010001, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x000000, 0x796e5a, 0xa49271, 0x9d885e, 0xa99361, 0xb29c65, 0xaf9960, 0xae985d, 0xb29c60, 0xb09a5f, 0xae985f, 0x9f8954, 0x988254, 0xa38d60, 0xad9a72, 0x786b53, 0x000000, 0x000101, 0x000001, 0x0f0704, 0x493c2a, 0x756548, 0x8c7852, 0x957d54, 0x9b8055, 0x9d8153, 0xa18454, 0xa1804f, 0xa28152, 0x967750, 0x856846, 0x654a2f, 0x46321e, 0x1b1108, 0x000000, 0x010101, 0x000000, 0x000000, 0x080403, 0x1b130b, 0x2b2015, 0x231308, 0x385637, 0x488153, 0x589369, 0x166237, 0x195e38, 0x0f5633, 0x0c5134, 0x1c5c45, 0x185744, 0x1b5d47, 0x66ba95, 0x5fb58a, 0x429761, 0x60a26a, 0x5e5c2b, 0x6f5326, 0x896b3c, 0x927542, 0x8e7139, 0x7d6029, 0x664a19, 0x785a26, 0x806028, 0x96773a, 0xaa8742, 0xa27c38, 0x986f2e, 0xa78348, 0xb08e4d, 0xe3bd63, 0xd7ae58, 0xbf9548, 0xa87b39, 0x93632a, 0x8e5a25, 0x9c652f, 0x965d30, 0x92562d, 0x93532e, 0x823819, 0xa3473e, 0xdd6668, 0xfa9099, 0xfc939d, 0xd74a5f, 0xb41230, 0x8d000e, 0xaa555d, 0xca878c, 0xc99a9b, 0xd3a9a9, 0xcea4a5, 0xc48f8e, 0x9c5554, 0x8c1b18, 0x832c17, 0x614d21, 0x353509, 0x312c00, 0x3e4118, 0x4d5222, 0x515119, 0x706a29, 0xab9d50, 0xbba44d, 0xa88c44, 0x7d6539, 0x6f6355, 0xc2baa9, 0xd9d5c6, 0xf4f0e2, 0xb1a99a, 0x000000, 0x9b9183, 0xb5afa3, 0xcccabe, 0xefecdc, 0xc3bfb1, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x1b110a, 0x5f4024, 0x9e723d, 0xbe8c43, 0xc5913f, 0xcc9b44, 0xcf9e43, 0xc7953c, 0xc08d37, 0xcf9e49, 0xcf9e49, 0xc99740, 0xc39845, 0xcaa865, 0xa88c5b, 0x24190e, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000201, 0x000000, 0x857658, 0xcfb16f, 0xc99f48, 0xc99f51, 0xd9b061, 0xd7ac55, 0xd4ac5a, 0xdab96c, 0xe2c57c, 0xdbbd71, 0xe1c371, 0xedd482, 0xe4cb7f, 0xcfb372, 0xb6a17a, 0x4c4336, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010001, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x524a3d, 0xa89676, 0x9e885b, 0xb19b64, 0xbba466, 0xb39e60, 0xb19d62, 0xbda76e, 0xb49d62, 0xb19b5f, 0xae995e, 0xaa955d, 0xa5905d, 0xa89463, 0xb09a6c, 0x93805c, 0x000000, 0x000000, 0x000101, 0x010102, 0x130d07, 0x251c0e, 0x3b2d19, 0x59482f, 0x6c5438, 0x735838, 0x725735, 0x6c4f2f, 0x634629, 0x4b321b, 0x382512, 0x23160c, 0x000000, 0x000000, 0x010101, 0x010101, 0x010102, 0x010101, 0x000102, 0x000001, 0x000000, 0x000000, 0x2a5734, 0x1e6530, 0x06652a, 0x0f622a, 0x1d753c, 0x23824a, 0x25814c, 0x1b7043, 0x196643, 0x196545, 0x5caf88, 0x409666, 0x54a069, 0x608755, 0x6b592b, 0x9e814e, 0x94793b, 0x8c7531, 0x8b722d, 0x896e2d, 0x7d612b, 0x8e6e34, 0x8f6c2e, 0x8a6727, 0xac8843, 0x956c28, 0xb9954b, 0xe5b85b, 0xe1af4e, 0xc29036, 0xa06c21, 0x9c6a26, 0x8f5d23, 0x94622a, 0xa46b30, 0xa4672a, 0xa3642c, 0xa6642f, 0xa45b2c, 0x904321, 0x812304, 0xae4340, 0xdd6a6f, 0xf8868e, 0xdf5465, 0xa90620, 0x8e0210, 0x94041d, 0x9f213b, 0x8b223c, 0x903947, 0x7a1729, 0x971a2b, 0x9b1923, 0x921618, 0x973d24, 0xa07b39, 0x96863a, 0x7d7028, 0x796b26, 0x74651f, 0x86792b, 0x8a7828, 0x8f771e, 0xbca348, 0xb69946, 0x99743c, 0x988062, 0xbeb4a2, 0xcdc8ba, 0xefebdc, 0xcac2b3, 0x0e0000, 0x998979, 0xbaae9e, 0xb2a797, 0xd2c6b3, 0xb9af9f, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010000, 0x010201, 0x000101, 0x2f1c10, 0x5a381e, 0x80572c, 0x9e743c, 0xb28948, 0xba9147, 0xbd9248, 0xbd924b, 0xc29a57, 0xc49c55, 0xc49f5b, 0xc4a260, 0xb3925e, 0x6e5436, 0x000000, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x000000, 0x736346, 0xcead69, 0xc0943f, 0xbc8e3e, 0xcea450, 0xdcb45c, 0xdbbb6c, 0xdfc379, 0xdbc078, 0xe7cd7d, 0xe0c571, 0xebd585, 0xefdb8e, 0xe7cd82, 0xc9b07a, 0x887a61, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x000100, 0x000100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000101, 0x010101, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x000101, 0x000100, 0x000000, 0x000101, 0x000100, 0x000100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000101, 0x000000, 0x716652, 0xa3906a, 0xa48f60, 0xc2aa6c, 0xbca362, 0xb39e60, 0xb5a168, 0xbfa86e, 0xb9a269, 0xbaa46a, 0xb9a36a, 0xad9863, 0xa08c5b, 0xa18f5d, 0xab9566, 0x826d49, 0x000000, 0x000000, 0x000201, 0x010201, 0x000000, 0x000000, 0x000000, 0x0c0401, 0x27190e, 0x2c1e10, 0x2c1d0e, 0x291a0e, 0x1e1209, 0x070301, 0x000000, 0x000000, 0x000101, 0x020101, 0x010101, 0x010101, 0x010101, 0x000201, 0x010101, 0x020102, 0x010101, 0x000000, 0x285737, 0x1a6330, 0x106729, 0x1a7237, 0x0a682a, 0x0e7030, 0x1c8041, 0x097333, 0x0e6f39, 0x0a6539, 0x227649, 0x277f4d, 0x5a9c6a, 0x4e5b38, 0x8d7845, 0x8a7434, 0x786a21, 0x74691d, 0x867327, 0x927934, 0x8e7133, 0x997a3d, 0x947235, 0x9f7e41, 0xa68141, 0xa47f3b, 0xefc96f, 0xd09841, 0xca8f39, 0xbc8733, 0x9e6b27, 0x966729, 0xa16e2e, 0xb17b35, 0xaa742f, 0xc39048, 0xb47a32, 0xad6927, 0xa65b25, 0x81310e, 0x741e08, 0x8d2919, 0xb84748, 0xdc515e, 0xc73c4b, 0x9a0914, 0x8f0710, 0x90020e, 0xa3182e, 0x971c33, 0x88192a, 0x911d2f, 0x941220, 0x9e161b, 0x950f11, 0xad5f37, 0xb48f46, 0x9c8536, 0x806d1e, 0x7c6a1c, 0x8b7934, 0xa7954b, 0xc9b75e, 0xd6c05f, 0xd0b656, 0xc2a252, 0x916a32, 0xb29b7e, 0xdcd4c3, 0xe7e4d5, 0xdad2be, 0xaea08d, 0x000000, 0x6f5c4d, 0xa68d76, 0xac937b, 0xb39c85, 0x807264, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x000202, 0x000000, 0x26170c, 0x4c321d, 0x644327, 0x755330, 0x805f36, 0x8f6d3f, 0x957343, 0xa68653, 0x9d7c4b, 0x957345, 0x86663d, 0x61462a, 0x0f0201, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010201, 0x010101, 0x010101, 0x000000, 0x240900, 0xa48655, 0xd3ad60, 0xd6ab50, 0xd4aa51, 0xcaa24e, 0xe3c777, 0xddc67c, 0xe5ce88, 0xe1c97a, 0xe8d17e, 0xf1de90, 0xedd78a, 0xe9cf83, 0xd5be86, 0x8f8164, 0x000000, 0x000001, 0x000001, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x000100, 0x000100, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x5c533f, 0xa69670, 0xa08c5f, 0xb8a269, 0xad9459, 0xa89159, 0xb09a63, 0xb29a61, 0xb39b63, 0xbaa46b, 0xbba76d, 0xab9561, 0xa99563, 0xac9768, 0x977e57, 0x5b482f, 0x000000, 0x000101, 0x010201, 0x010101, 0x020101, 0x010201, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000100, 0x010001, 0x010101, 0x010101, 0x010201, 0x000201, 0x010100, 0x020102, 0x000000, 0x23412c, 0x215a32, 0x1c6f36, 0x2f9757, 0x1e9250, 0x1d974f, 0x249f55, 0x188742, 0x0b7235, 0x1e7848, 0x0d6739, 0x2b7346, 0x457951, 0x6e6138, 0x7f6e32, 0x726720, 0x6a641b, 0x787021, 0x8f7b32, 0x9b813f, 0x7a5c1f, 0x8e7033, 0xb39350, 0xa27f3e, 0xa07b35, 0xe6c16b, 0xe8b758, 0xa86a1e, 0xb27a33, 0xac782d, 0xa2722c, 0xb58539, 0xb88436, 0xb67f30, 0xbd8939, 0xc4933e, 0xc59441, 0xc8954b, 0xb87432, 0x9b4f1c, 0x812f0e, 0x832a19, 0x7a1d18, 0xbc3a44, 0xcc3241, 0xc32937, 0xa61320, 0xa20b19, 0x950415, 0x941123, 0xa22235, 0xaa363f, 0xb03939, 0xa33326, 0x9e4a20, 0xa76c2b, 0xaa883c, 0x897023, 0x978134, 0xac974d, 0xb09c54, 0xa99444, 0xcab354, 0xd8c05c, 0xc1a144, 0xa37b33, 0xa88b68, 0xbcad9c, 0xe2dcce, 0xfbfaec, 0xe9e2d1, 0x64594a, 0x000000, 0x1f150f, 0x735b4a, 0x7c624d, 0x604b3b, 0x0e0300, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010201, 0x010101, 0x010101, 0x010201, 0x010101, 0x010101, 0x010202, 0x010201, 0x000000, 0x000000, 0x180f07, 0x342417, 0x3b2a1b, 0x3e2b1b, 0x372212, 0x392410, 0x3d2a18, 0x322214, 0x0b0302, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x000000, 0x140503, 0x503118, 0x9c7c47, 0xcda85d, 0xe0ba65, 0xe0bc65, 0xe4c56f, 0xe3c776, 0xe7cf83, 0xe8d181, 0xebd686, 0xe9d688, 0xecd78c, 0xe7d08c, 0xcfb986, 0x69583e, 0x000000, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010001, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x1c1508, 0x6e6047, 0x998763, 0xa08c61, 0xa89262, 0xa58f5c, 0xa68f59, 0xa38a54, 0xaf955d, 0xb39a61, 0xb29c66, 0xb29c6b, 0xaa9467, 0x89724c, 0x5c472e, 0x170f09, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010000, 0x010101, 0x000001, 0x000000, 0x010101, 0x010102, 0x010101, 0x010201, 0x010201, 0x020201, 0x000000, 0x000000, 0x000000, 0x05230f, 0x1a4b22, 0x20703d, 0x258f53, 0x29a05c, 0x2fa961, 0x37a764, 0x16743b, 0x247648, 0x226b43, 0x114426, 0x323921, 0x806f3c, 0x74631e, 0x776b24, 0x776e25, 0x88782e, 0xa18a41, 0xa3883f, 0x977b35, 0xa48641, 0x977632, 0x9d7736, 0xc09549, 0xcb9c49, 0xad7b38, 0xbb884e, 0xa97635, 0xb17f37, 0xb4843a, 0xc29443, 0xc79a4a, 0xc39444, 0xbc8d3a, 0xd4ae5e, 0xe0ba6a, 0xcea053, 0xb87b31, 0xa45e21, 0x93491d, 0x7c361a, 0x420000, 0x6d0406, 0xaf212b, 0xcc3542, 0xa81626, 0xb1182c, 0xa00a1f, 0xa72432, 0xb03c43, 0xaf4b4b, 0x983431, 0xa5573d, 0xc28852, 0xb18540, 0xa8873a, 0xa3863c, 0xa6893e, 0x937830, 0x977d2f, 0xaf963f, 0xba9f42, 0xb89840, 0xb48e44, 0x97713d, 0xaa9582, 0xb4a89c, 0xbfb7aa, 0xe1d8c7, 0xe4dac7, 0x968f83, 0x27241e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010201, 0x010101, 0x010201, 0x000301, 0x000201, 0x010101, 0x010102, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000001, 0x000000, 0x170803, 0x4b3018, 0x7b5c33, 0x997942, 0xb7985a, 0xcaab68, 0xd0b06a, 0xd3b773, 0xd9c17c, 0xdcc783, 0xd7c483, 0xcbb67c, 0xae9768, 0x846d48, 0x382919, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020202, 0x000001, 0x282012, 0x4a3b26, 0x67563b, 0x7d6a47, 0x89744f, 0x8f774d, 0x93794b, 0x9a7d4e, 0x9a7b4b, 0x977a4c, 0x846b45, 0x6e593b, 0x433624, 0x020303, 0x000000, 0x020201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010000, 0x010101, 0x000101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x020201, 0x010202, 0x000000, 0x151309, 0x514631, 0x67593c, 0x6d6542, 0x595e34, 0x364e18, 0x265016, 0x20591e, 0x1c612b, 0x1d6634, 0x1d5e2f, 0x1e532c, 0x11361f, 0x000301, 0x2b2313, 0x8d7a46, 0x856e2b, 0x85712c, 0x8c7833, 0x9e8741, 0xa48941, 0xac8e43, 0xa9883d, 0xad893e, 0xb48a40, 0xae7f3c, 0xaf8143, 0x735128, 0x240000, 0x77552f, 0xaf8650, 0xb48849, 0xb98c44, 0xb98c41, 0xc99f4f, 0xc49946, 0xc0923f, 0xc69b4a, 0xbf903e, 0xb27e2c, 0xb98336, 0xb57e37, 0xb97b3c, 0x763d1d, 0x360000, 0x4b0000, 0x640407, 0x9a252c, 0xa82f36, 0xb5373e, 0xb23f44, 0x98363a, 0x783332, 0x380806, 0x4a120d, 0x6b2a1e, 0x8b5433, 0xa37846, 0xac8547, 0xb6934e, 0xad8a43, 0xae8d47, 0xae8e48, 0xb39453, 0xac8b4b, 0xa48146, 0x896638, 0x4e331b, 0x988476, 0xaa998c, 0xa49284, 0xb5a48f, 0xcfc3af, 0xf3eedf, 0xd0ccbe, 0x1e180e, 0x000000, 0x000000, 0x000000, 0x000000, 0x040403, 0x010101, 0x000000, 0x000000, 0x000000, 0x010102, 0x010201, 0x000100, 0x000000, 0x000000, 0x000000, 0x010302, 0x000201, 0x020202, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010302, 0x000201, 0x000301, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000102, 0x000000, 0x2e1e0f, 0x46301a, 0x604a2e, 0x6c5535, 0x755a37, 0x7c5f39, 0x876e46, 0x857048, 0x745e39, 0x6a5435, 0x5a462e, 0x291d11, 0x000000, 0x010102, 0x010101, 0x000000, 0x000001, 0x010101, 0x010101, 0x010101, 0x010000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020101, 0x010101, 0x000100, 0x1d160e, 0x322518, 0x3c2b18, 0x4b3924, 0x573f27, 0x563e22, 0x5a4026, 0x593f25, 0x47311a, 0x271b0f, 0x000000, 0x000000, 0x000000, 0x020202, 0x020202, 0x010101, 0x020202, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000100, 0x010200, 0x020201, 0x000000, 0x000000, 0x63583e, 0x937f59, 0x957b52, 0x887343, 0x867744, 0x857d44, 0x7d803d, 0x727c37, 0x6d7936, 0x5e682b, 0x545c27, 0x384113, 0x3e421d, 0x231d0e, 0x000000, 0x000000, 0x635430, 0x8f7941, 0x937b3d, 0x9c7e3e, 0x9f7c3d, 0xab8545, 0xaf853e, 0xc09446, 0xc39449, 0xad7f3d, 0x866033, 0x48301a, 0x000000, 0x110100, 0x2e0f00, 0x6c4822, 0x9c743f, 0xac8348, 0xb98d4e, 0xca9d56, 0xc3984c, 0xc2974b, 0xc39341, 0xc0903d, 0xcb9d46, 0xd9ac4e, 0xe4b355, 0xb57e3b, 0x511000, 0x591d0b, 0x652412, 0x591c10, 0x4e0608, 0x67191d, 0x752828, 0x602524, 0x260604, 0x000000, 0x000000, 0x000000, 0x311611, 0x522b1b, 0x653d1f, 0x785228, 0x845e30, 0x8d6837, 0x916e3c, 0x8a6838, 0x856439, 0x6d4d29, 0x523519, 0x230e05, 0x000000, 0x5e4f46, 0x998274, 0xa58f7c, 0xbaab99, 0xbdb5a9, 0xe2dfd2, 0xf5f0df, 0x928b7b, 0x716c61, 0xaeaa9e, 0xa7a399, 0x3b3935, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x3f3d39, 0x44423e, 0x000000, 0x000000, 0x030403, 0x000000, 0x0c0a08, 0x726f66, 0x9a968d, 0x86837c, 0x14120d, 0x000000, 0x020302, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x020202, 0x000202, 0x000000, 0x000000, 0x030200, 0x241d12, 0x322819, 0x352819, 0x362b1b, 0x2d2519, 0x21180f, 0x110805, 0x000000, 0x000000, 0x020201, 0x000000, 0x000000, 0x000000, 0x010000, 0x010101, 0x000101, 0x000101, 0x000101, 0x010201, 0x010201, 0x010201, 0x010101, 0x020202, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x030203, 0x060403, 0x020101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x010101, 0x010100, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x685a39, 0x9d8654, 0x886c34, 0x997c3c, 0x9c8445, 0x8d7a3d, 0x88773a, 0x978c46, 0x928b42, 0x8c8640, 0x89823e, 0x887f3d, 0x7f7135, 0x8d7741, 0x79613b, 0x1b1109, 0x000000, 0x0a0300, 0x3f3218, 0x5f4d27, 0x705426, 0x78511e, 0x774d1d, 0x845721, 0x90652c, 0x724b1f, 0x512e14, 0x543522, 0x50331d, 0x3d220e, 0x311404, 0x210300, 0x3e230f, 0x6f4b25, 0x8d6231, 0x8b5b29, 0x91602b, 0x9c6f35, 0xb18442, 0xc18e3f, 0xcd9b42, 0xdbac4c, 0xd4a84e, 0xb78b41, 0xa67539, 0xa76b3b, 0x9c5025, 0xa1552b, 0x99502d, 0x955533, 0x7d492d, 0x391909, 0x000000, 0x000000, 0x000101, 0x010101, 0x000000, 0x000000, 0x000000, 0x0d0603, 0x26170a, 0x311f0f, 0x3b2817, 0x3b2816, 0x342211, 0x2b1b0d, 0x100604, 0x000000, 0x000000, 0x000001, 0x000000, 0x322219, 0x8a796c, 0xab9d8e, 0xa1978c, 0xb2a99a, 0xd7cdb8, 0xcabea8, 0xbdb6a6, 0xe4e1d2, 0xfbf8eb, 0xcecbbd, 0x221e17, 0x403e3b, 0x979388, 0xb8b6aa, 0xa5a39a, 0x2e2c27, 0x000000, 0x8e8980, 0xcac6bb, 0xdad7cc, 0xb7b5ac, 0x2e2f2c, 0x000000, 0x000000, 0x878279, 0xb8b3a6, 0xcdcabd, 0xf1f0e3, 0xb0afa4, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010202, 0x010101, 0x000000, 0x010101, 0x010001, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x010101, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x000101, 0x010201, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020102, 0x010101, 0x010101, 0x010201, 0x010102, 0x010101, 0x000101, 0x000000, 0x000001, 0x000101, 0x000001, 0x010101, 0x010101, 0x010101, 0x020101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x4f4630, 0x967f4b, 0xa08243, 0x927534, 0xa98d46, 0xab904b, 0x9d8440, 0x95803d, 0x887536, 0x7d6c31, 0x79682d, 0x7c6929, 0x8b7432, 0x876c2b, 0xae8e51, 0xa18251, 0x493b29, 0x000000, 0x000100, 0x000001, 0x060503, 0x150900, 0x6e533a, 0x734b28, 0x663f1e, 0x674426, 0x634020, 0x754e24, 0x7c5327, 0x7b5428, 0x835b2c, 0x886231, 0x7a542a, 0x563212, 0x49270c, 0x49250a, 0x583010, 0x5d3517, 0x714820, 0x976b37, 0x9b7038, 0x9e7339, 0x9d7233, 0xb0843a, 0xd3a446, 0xdca64d, 0xb87236, 0xc27539, 0xc7783b, 0xc2723b, 0xbb6f3c, 0xc07d49, 0xa26f46, 0x473221, 0x000000, 0x010101, 0x000000, 0x000101, 0x010101, 0x020202, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x010102, 0x020202, 0x020102, 0x000001, 0x000000, 0x4f473f, 0x9c8d7d, 0xa69687, 0xae9d8d, 0xac957e, 0xc0af97, 0xbeb7a8, 0xc0bdb0, 0xe6e5d5, 0xf0ebd8, 0x8d8475, 0xaca597, 0xc7c3b5, 0xdedccf, 0xf5f4e8, 0xb4afa4, 0x756f68, 0xc7c2b6, 0xc5c3b7, 0xdfded1, 0xf3f2e5, 0xa29f94, 0x000000, 0x3a3731, 0xbeb7a9, 0xb5afa3, 0xb5b2a5, 0xdcd9cd, 0xdddacb, 0x5d5a52, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010201, 0x020201, 0x020202, 0x010202, 0x010201, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000001, 0x010001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010102, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x7f7357, 0xa3884d, 0xa28442, 0xa28341, 0xa18340, 0xb09551, 0xb69a56, 0x977c3c, 0x82692d, 0x7c6125, 0x80662c, 0x987c41, 0xa08041, 0x8b6826, 0x9a7738, 0xac8e5e, 0x443522, 0x000000, 0x010101, 0x000101, 0x000000, 0x000000, 0x766045, 0xac8659, 0x986a35, 0x9b703c, 0x986f3c, 0x996f37, 0x996f35, 0x9d713a, 0x9e7237, 0xa77c3c, 0xae8242, 0xa3743a, 0x7f5017, 0x7f5d33, 0x8f714c, 0x4e321b, 0x866744, 0x92683a, 0x93642f, 0xac7a35, 0xd09d3e, 0xe3b345, 0xe7b448, 0xc58b35, 0xae6323, 0xc27a3b, 0xd68d4c, 0xcd7c43, 0xcb7c45, 0xc57b3e, 0xba7e45, 0x8c6944, 0x0c0b07, 0x000000, 0x010201, 0x010201, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020101, 0x010102, 0x010101, 0x010101, 0x010102, 0x000000, 0x594c42, 0x887869, 0x92806f, 0x705946, 0xa39078, 0xa99e8b, 0xa09b8d, 0xbfb9a7, 0xccc0aa, 0xb29f88, 0xd1c7b5, 0xb1ac9f, 0xbcb9ad, 0xdad8cb, 0xd1cabb, 0xa99f91, 0xc1bbb0, 0x9f9d94, 0xb6b1a5, 0xd9d3c5, 0xb2ab9d, 0x000000, 0x4a4036, 0xb6ab9a, 0xafa797, 0x9f9889, 0xa9a192, 0xd1caba, 0x777269, 0x000000, 0x010101, 0x010201, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010000, 0x010101, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x615642, 0xb09766, 0xa98949, 0xad8d48, 0xb59653, 0xb2944d, 0xa98b45, 0xa58545, 0xb69756, 0xbf9d57, 0xc2a25b, 0xb79754, 0x997536, 0x987844, 0xb8996a, 0x91734c, 0x0d0000, 0x000001, 0x010201, 0x000201, 0x010201, 0x000000, 0x21190d, 0x77603f, 0x9c7b4d, 0xa07c48, 0x9b743d, 0xa0793d, 0xa87d3b, 0xa37635, 0xa67832, 0xb9893b, 0xbd8e3f, 0xba9045, 0xcca55c, 0xbe9c60, 0x735735, 0x090000, 0x9a7b50, 0xb4833e, 0xcc923b, 0xc78e31, 0xdaa53b, 0xe1b045, 0xd6a342, 0xcb913f, 0xcb8a41, 0xc67e3d, 0xc57434, 0xc77237, 0xca793d, 0xc47739, 0xbc7d3d, 0xac8659, 0x372d20, 0x000000, 0x000000, 0x000000, 0x27251d, 0x665b43, 0x7e6f50, 0x8d7b58, 0x92805b, 0x907d59, 0x7d6c4d, 0x615340, 0x2f2923, 0x000000, 0x000000, 0x010102, 0x010101, 0x010101, 0x020102, 0x000001, 0x000000, 0x0d0300, 0x1b110a, 0x000000, 0x6c5c49, 0xa7957b, 0xac9e85, 0xa99a81, 0x97846c, 0x796654, 0xae9e8d, 0xa2978a, 0xa59c8e, 0xc1b9a7, 0xbfb19f, 0x908070, 0xa79d90, 0xaba397, 0xa29889, 0xb7aa98, 0x8f8376, 0x000000, 0x21160a, 0x857563, 0xaa9b87, 0xb0a390, 0xb0a18e, 0xa99c89, 0x423d35, 0x000000, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 0x000101, 0x010100, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x000001, 0x030000, 0x786546, 0xa88e5d, 0xb59656, 0xb08f4b, 0xa98944, 0x9f7e3a, 0x967538, 0xa78648, 0xaa8644, 0xa48245, 0xad8d53, 0xb99861, 0xb19362, 0x8d6f4b, 0x3f2b17, 0x000000, 0x010202, 0x010201, 0x010201, 0x010201, 0x010202, 0x000201, 0x282016, 0x4c3b24, 0x695331, 0x7e6338, 0x937441, 0xa07c40, 0xad8544, 0xb88d44, 0xbe9243, 0xbb9245, 0xbc9751, 0xa27f43, 0x66471c, 0x270e00, 0x000000, 0x8e734a, 0xc69b54, 0xd5a043, 0xd29c3a, 0xd19d3a, 0xc99438, 0xc4903d, 0xc79045, 0xb87a38, 0xa55a1e, 0xbc6f32, 0xce8a4c, 0xd28c4f, 0xbb7335, 0xb47f42, 0xb19266, 0x2c2318, 0x000000, 0x201e16, 0x8c7d5b, 0xaf996b, 0xa68b5a, 0xa4844c, 0xa58245, 0xb18c4d, 0xb18d50, 0xba9659, 0xb79660, 0x9e835d, 0x67533e, 0x30251f, 0x000000, 0x010101, 0x010101, 0x010101, 0x010202, 0x020304, 0x000002, 0x000000, 0x000000, 0x130f08, 0x6a5b49, 0x7f6d58, 0x776551, 0x514232, 0x000000, 0x7d695a, 0xa48e7d, 0xb09c8a, 0xb39f8a, 0x927f6d, 0x3d2f27, 0x79695d, 0x9b887a, 0xa0907f, 0x96887a, 0x362d26, 0x000000, 0x000000, 0x382e24, 0x7f6f5e, 0x93816d, 0x90806c, 0x5a4e41, 0x000000, 0x020202, 0x000101, 0x010101, 0x010201, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010001, 0x010101, 0x010100, 0x010100, 0x010101, 0x000100, 0x010101, 0x010201, 0x010101, 0x000000, 0x271a0a, 0x574124, 0x785e35, 0x8d7241, 0x9b7f49, 0x9f824a, 0xa2834c, 0xa1834d, 0xa78752, 0xa68855, 0x9b7f51, 0x856942, 0x60482a, 0x2c1b0d, 0x000000, 0x010201, 0x010202, 0x010101, 0x010101, 0x010101, 0x010201, 0x000000, 0x000000, 0x0e0a06, 0x281f13, 0x40311d, 0x4c381c, 0x654c28, 0x705328, 0x82622f, 0x805f2c, 0x6a4a1e, 0x573b17, 0x3e270f, 0x1a0c04, 0x000000, 0x000000, 0x4f3a21, 0xa6834d, 0xbc914a, 0xc99b46, 0xd1a147, 0xbd8834, 0xbe883c, 0xaa712d, 0xb27633, 0xc98e46, 0xce984e, 0xd8a358, 0xc68b45, 0xc18c4d, 0xc49e67, 0x917854, 0x000000, 0x443c2a, 0xae9769, 0xb1905a, 0x9e7532, 0xa77c33, 0xa6772d, 0xb3863b, 0xad8135, 0xaa7d33, 0xb98e42, 0xc1974b, 0xc49c58, 0xbb955d, 0x9b7e58, 0x615240, 0x000000, 0x020202, 0x010101, 0x010201, 0x020202, 0x010101, 0x010100, 0x020201, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x1f1610, 0x655247, 0x7a6658, 0x655345, 0x30231b, 0x000000, 0x060000, 0x392a23, 0x41352c, 0x110601, 0x000000, 0x030302, 0x030302, 0x000000, 0x000000, 0x231a10, 0x21170f, 0x000000, 0x000101, 0x010101, 0x000001, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x000100, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010001, 0x010101, 0x010000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 0x191109, 0x362515, 0x4a361d, 0x5b4627, 0x68522f, 0x6e5732, 0x69502c, 0x6d5632, 0x5e4a2d, 0x493824, 0x2a1e12, 0x000000, 0x000000, 0x010101, 0x010201, 0x010201, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x0c0703, 0x1c1308, 0x261a0c, 0x2b1e0f, 0x23190d, 0x030001, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x160b06, 0x564025, 0x8c6c40, 0xa98248, 0xbe954f, 0xbf9349, 0xc5964e, 0xc29048, 0xc29046, 0xc5974d, 0xd2a65b, 0xcb9e57, 0xc2995b, 0xbc9862, 0x9a7b52, 0x423120, 0x150f0c, 0xa58a5e, 0xad8545, 0x976518, 0xad7e33, 0xbf9144, 0xb07f33, 0xb88a3c, 0xc09441, 0xb88e3d, 0xbf9442, 0xc89b46, 0xca9d49, 0xcaa052, 0xcaa461, 0xa78a61, 0x40362b, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x000000, 0x000101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010001, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x000100, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x110c06, 0x191209, 0x171109, 0x0d0704, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000000, 0x1c130a, 0x49331e, 0x684a2a, 0x7a5932, 0x8c6a39, 0x9a7940, 0x9d7a40, 0xa37e42, 0xad8c52, 0xb1925b, 0xa0804f, 0x826339, 0x674c2b, 0x3c2b18, 0x000000, 0x5e5038, 0xb38e53, 0xb28233, 0xbb8c40, 0xb4853d, 0xa16f24, 0xa9792c, 0xb78a39, 0xc89d48, 0xd4ac52, 0xd1a84d, 0xcfa54b, 0xdbb560, 0xd0a953, 0xdab25f, 0xb89257, 0x66553e, 0x000000, 0x000001, 0x010201, 0x000201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x000101, 0x000000, 0x000001, 0x000101, 0x010101, 0x000001, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x010100, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010001, 0x000101, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x020102, 0x020302, 0x000202, 0x000001, 0x000000, 0x000000, 0x000000, 0x000001, 0x010101, 0x020202, 0x010202, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x1b1008, 0x382616, 0x48331d, 0x635032, 0x6d5732, 0x705730, 0x614727, 0x492f18, 0x37200c, 0x201106, 0x000000, 0x000000, 0x000000, 0x544933, 0xb8975d, 0xb98a3a, 0xbf8f3d, 0xc3954a, 0xb5873b, 0xcba350, 0xc09540, 0xb98f3b, 0xbc933c, 0xc1983b, 0xcaa54b, 0xd7b15a, 0xcfa54e, 0xd5a954, 0xc39e62, 0x68563d, 0x000000, 0x000001, 0x000101, 0x000101, 0x000201, 0x010101, 0x010101, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010201, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010201, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000100, 0x010101, 0x000101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x000101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x000201, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x000101, 0x000101, 0x000101, 0x000000, 0x010101, 0x000201, 0x000101, 0x000000, 0x000000, 0x000101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010201, 0x010201, 0x010101, 0x010101, 0x000000, 0x010101, 0x000101, 0x000001, 0x000000, 0x000000, 0x090606, 0x18110a, 0x191109, 0x0b0604, 0x000000, 0x000000, 0x000000, 0x000101, 0x000201, 0x000000, 0x000000, 0x876e46, 0xb89250, 0xb98a3d, 0xb48434, 0xae8133, 0xcea752, 0xc59f4d, 0xb08431, 0xbd953f, 0xd3ae56, 0xdab661, 0xc2973e, 0xc49843, 0xd0a862, 0xb19162, 0x3e2f21, 0x000000, 0x000001, 0x010001, 0x010101, 0x010201, 0x000101, 0x000100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000101, 0x000100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x000100, 0x010101, 0x010201, 0x000101, 0x000100, 0x000000, 0x000101, 0x000100, 0x000100, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010000, 0x010000, 0x010000, 0x010001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x000000, 0x010101, 0x010101, 0x010101, 0x010001, 0x010101, 0x000101, 0x010100, 0x010100, 0x010101, 0x010000, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010000, 0x010000, 0x000000, 0x010101, 0x010101, 0x000100, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000001, 0x010202, 0x010101, 0x010101, 0x010201, 0x010202, 0x000101, 0x000002, 0x3b2917, 0x7e6239, 0xa58147, 0xb28b47, 0xb78f47, 0xcca85a, 0xb69043, 0xbc9646, 0xbf9946, 0xb89240, 0xb48d43, 0xc9a55f, 0xcbaa6a, 0xab8b5a, 0x735b3f, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000001, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010001, 0x010101, 0x000101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010102, 0x010103, 0x000003, 0x000000, 0x342311, 0x5c4423, 0x765a30, 0x886a39, 0x957542, 0xa8874e, 0xb19258, 0xa88951, 0xa88b54, 0xa38553, 0x9c8054, 0x836742, 0x57422a, 0x080000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010000, 0x010101, 0x000101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010001, 0x010101, 0x010103, 0x010105, 0x000001, 0x000000, 0x100702, 0x342614, 0x4d381f, 0x63482a, 0x6b502e, 0x6a512e, 0x695131, 0x6a5133, 0x5d472f, 0x4a3826, 0x1f140d, 0x000000, 0x000001, 0x010000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010001, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010102, 0x010103, 0x010203, 0x000002, 0x000000, 0x000000, 0x110b06, 0x170e07, 0x140c05, 0x0f0803, 0x020000, 0x000000, 0x000000, 0x000000, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010000, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000100, 0x000101, 0x000100, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x000100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010102, 0x010100, 0x010101, 0x010102, 0x010101, 0x010101, 0x000101, 0x000001, 0x000000, 0x000000, 0x000000, 0x000001, 0x000001, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000001, 0x010101, 0x010100, 0x010101, 0x010101, 0x010000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x000001, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000100, 0x000100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x000000, 0x010000, 0x010000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x010101, 0x010100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000100, 0x010101, 0x010101, 0x010101, 0x000101, 0x000101, 0x010101, 0x000101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x000100, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000101, 0x000000, 0x000000, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x000100, 0x000101, 0x000101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101
-};
\ No newline at end of file
@@ -0,0 +1,74 @@
+/**
+ * Fila de eventos de tamanho fixo entre tasks (FreeRTOS)
+ *
+ * Depth eventos T copiados por valor, em memória estática (xQueueCreateStatic):
+ * nada de heap depois do boot e o tamanho aparece no .bss. send() não
+ * espera por padrão: fila cheia descarta o evento e conta (dropped), para
+ * quem produz nunca travar esperando quem consome.
+ *
+ *   EventQueue<TagEvent, 4> tagQueue;
+ *   tagQueue.begin();
+ *   tagQueue.send(event);                        // task que produz
+ *   while (tagQueue.receive(event, waitTicks))   // task que consome
+ *
+ * T deve ser copiável com memcpy (sem String, sem ponteiros para a pilha).
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+template <typename T, uint8_t Depth>
+class EventQueue {
+public:
+  struct Stats {
+    uint8_t depth;
+    uint8_t peak;        // maior ocupação desde o boot
+    uint32_t sent;
+    uint32_t dropped;    // fila cheia
+  };
+
+private:
+  StaticQueue_t control;
+  uint8_t storage[Depth * sizeof(T)];
+  QueueHandle_t handle = NULL;
+  volatile uint8_t peak = 0;
+  volatile uint32_t sent = 0;
+  volatile uint32_t dropped = 0;
+
+public:
+  bool begin() {
+    if (handle == NULL) handle = xQueueCreateStatic(Depth, sizeof(T), storage, &control);
+    return handle != NULL;
+  }
+
+  /**
+   * Copia o evento para a fila. false = cheia após waitTicks (descartado)
+   */
+  bool send(const T& event, TickType_t waitTicks = 0) {
+    if (xQueueSend(handle, &event, waitTicks) != pdTRUE) {
+      dropped++;
+      return false;
+    }
+    sent++;
+    uint8_t used = uxQueueMessagesWaiting(handle);
+    if (used > peak) peak = used;
+    return true;
+  }
+
+  bool receive(T& event, TickType_t waitTicks = 0) {
+    return xQueueReceive(handle, &event, waitTicks) == pdTRUE;
+  }
+
+  Stats getStats() const {
+    Stats stats = { Depth, peak, sent, dropped };
+    return stats;
+  }
+
+  static size_t memoryBytes() { return Depth * sizeof(T) + sizeof(StaticQueue_t); }
+};
+
+#endif // EVENT_QUEUE_H
@@ -0,0 +1,82 @@
+/**
+ * Ritmo da task da tela: dorme até o próximo evento em vez de um delay() fixo
+ *
+ * A task calcula quanto pode dormir (RoboEyes::nextFrameIn(), próximo
+ * timeout, limite das tarefas periódicas) e chama sleep(ms). O sono termina
+ * antes quando chega uma entrada: wake(), chamado pelas outras tasks (tag
+ * verificada, toque)
+ *
+ * Usa a notificação da task que chamou begin() (ulTaskNotifyTake): sem
+ * filas nem semáforos extras.
+ */
+
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+class FramePacer {
+public:
+    /**
+     * Estatísticas da última janela de 1 segundo
+     */
+    struct Stats {
+        uint8_t sleepPercent;   // tempo dormindo
+        uint16_t loops;         // passagens pelo laço da task
+        uint16_t inputWakes;    // sonos interrompidos por entrada
+    };
+
+private:
+    TaskHandle_t task = NULL;
+    Stats stats = { 0, 0, 0 };
+    unsigned long windowStart = 0;
+    uint32_t windowSlept = 0;
+    uint16_t windowLoops = 0;
+    uint16_t windowWakes = 0;
+
+public:
+    /**
+     * Chamar na task que vai dormir em sleep()
+     */
+    void begin() {
+        task = xTaskGetCurrentTaskHandle();
+        windowStart = millis();
+    }
+
+    /**
+     * Acorda a task (fora de interrupção)
+     */
+    void wake() {
+        if (task) xTaskNotifyGive(task);
+    }
+
+    /**
+     * Dorme até ms milissegundos (mínimo 1: a task idle precisa rodar).
+     * Retorna true se foi acordado por uma entrada.
+     */
+    bool sleep(uint32_t ms) {
+        unsigned long start = millis();
+        bool woken = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(max<uint32_t>(ms, 1))) > 0;
+
+        windowSlept += millis() - start;
+        windowLoops++;
+        if (woken) windowWakes++;
+
+        unsigned long elapsed = millis() - windowStart;
+        if (elapsed >= 1000) {
+            stats.sleepPercent = min<uint32_t>(100, windowSlept * 100 / elapsed);
+            stats.loops = windowLoops;
+            stats.inputWakes = windowWakes;
+            windowSlept = 0;
+            windowLoops = windowWakes = 0;
+            windowStart = millis();
+        }
+        return woken;
+    }
+
+    const Stats& getStats() const { return stats; }
+};
+
+#endif // FRAME_PACER_H
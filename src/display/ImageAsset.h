@@ -0,0 +1,264 @@
+/**
+ * Imagens geradas em tempo de build (scripts/build_assets.py)
+ *
+ * Os arrays ficam em src/display/generated/ e já estão na ordem de
+ * bytes do ILI9341: o envio é direto, sem conversão por pixel.
+ *
+ * Formatos:
+ *   ASSET_RGB565    2 bytes/pixel, enviado direto da flash
+ *   ASSET_PALETTE8  1 byte/pixel + paleta RGB565 (até 256 cores)
+ *   ASSET_Q565      compactado (QOI adaptado para RGB565) com índice de
+ *                   linhas
+ *
+ * Desenho (drawImageAsset): a imagem é expandida em faixas de
+ * IMAGE_BAND_LINES linhas em dois buffers DMA alternados; enquanto uma
+ * faixa é enviada por pushImageDMA a próxima é decodificada. Sem DMA
+ * (imageBlitterBegin não chamado ou falhou) as faixas vão por pushImage.
+ */
+
+#ifndef IMAGE_ASSET_H
+#define IMAGE_ASSET_H
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+// Linhas decodificadas por envio (buffer = largura máx. * linhas * 2 bytes)
+#ifndef IMAGE_BAND_LINES
+  #define IMAGE_BAND_LINES 16
+#endif
+
+#define IMAGE_MAX_WIDTH 320
+
+enum ImageAssetFormat {
+  ASSET_RGB565 = 0,
+  ASSET_PALETTE8 = 1,
+  ASSET_Q565 = 2
+};
+
+struct ImageAsset {
+  uint16_t width;
+  uint16_t height;
+  uint8_t format;
+  const void* pixels;        // uint16_t (RGB565), uint8_t (índices ou Q565)
+  const uint16_t* palette;   // só ASSET_PALETTE8
+  const uint32_t* rows;      // só ASSET_Q565: offset (bytes) de cada linha
+};
+
+// Entrada da tabela de imagens compiladas (generated/assets_index.h)
+struct BuiltinAsset {
+  const char* name;
+  const ImageAsset* asset;
+};
+
+/**
+ * Tempos de um desenho (microssegundos)
+ */
+struct ImageDrawStats {
+  uint32_t totalMicros;
+  uint32_t decodeMicros;   // parte gasta expandindo Q565/paleta
+  bool dma;                // faixas enviadas por DMA
+};
+
+/**
+ * Decodificador Q565 (mesmo formato de scripts/build_assets.py)
+ *   00iiiiii             INDEX  cache[i]
+ *   01rrggbb             DIFF   dr, dg, db em -2..1
+ *   10gggggg rrrrbbbb    LUMA   dg em -32..31, dr-dg e db-dg em -8..7
+ *   11nnnnnn (n < 62)    RUN    repete a cor anterior n+1 vezes
+ *   11111110 hi lo       COR    RGB565 literal
+ * Estado zerado a cada linha: qualquer linha pode ser decodificada sozinha.
+ */
+struct Q565Decoder {
+  static inline uint8_t hash(uint16_t c) {
+    return ((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 0x3F;
+  }
+
+  /**
+   * Decodifica uma linha para out (RGB565 com bytes trocados)
+   */
+  static void IRAM_ATTR decodeRow(const uint8_t* src, uint16_t width, uint16_t* out) {
+    uint16_t cache[64] = {};
+    uint16_t color = 0;
+    uint16_t* end = out + width;
+
+    while (out < end) {
+      uint8_t op = *src++;
+      if (op < 0x40) {
+        color = cache[op];
+        *out++ = (color >> 8) | (color << 8);
+        continue;
+      }
+      if (op >= 0xC0) {
+        if (op == 0xFE) {
+          color = (src[0] << 8) | src[1];
+          src += 2;
+        } else {
+          uint16_t swapped = (color >> 8) | (color << 8);
+          for (uint8_t n = (op & 0x3F) + 1; n > 0 && out < end; n--) *out++ = swapped;
+          continue;
+        }
+      } else {
+        int8_t dr, dg, db;
+        if (op < 0x80) {
+          dr = ((op >> 4) & 3) - 2;
+          dg = ((op >> 2) & 3) - 2;
+          db = (op & 3) - 2;
+        } else {
+          uint8_t b2 = *src++;
+          dg = (op & 0x3F) - 32;
+          dr = dg + (b2 >> 4) - 8;
+          db = dg + (b2 & 0x0F) - 8;
+        }
+        color = ((((color >> 11) + dr) & 0x1F) << 11) |
+                (((((color >> 5) & 0x3F) + dg) & 0x3F) << 5) |
+                (((color & 0x1F) + db) & 0x1F);
+      }
+      cache[hash(color)] = color;
+      *out++ = (color >> 8) | (color << 8);
+    }
+  }
+
+  /**
+   * Bytes que decodeRow() lê para uma linha de width pixels, sem ler além
+   * de avail. 0 = a linha não termina dentro de avail (dados malformados).
+   */
+  static uint32_t rowLength(const uint8_t* src, uint32_t avail, uint16_t width) {
+    uint32_t used = 0;
+    uint32_t pixels = 0;
+    while (pixels < width) {
+      if (used >= avail) return 0;
+      uint8_t op = src[used++];
+      uint32_t extra = op == 0xFE ? 2 : (op >= 0x80 && op < 0xC0) ? 1 : 0;
+      if (avail - used < extra) return 0;
+      used += extra;
+      pixels += (op >= 0xC0 && op != 0xFE) ? (op & 0x3F) + 1 : 1;
+    }
+    return used;
+  }
+};
+
+/**
+ * Expande linhas [row, row + lines) para out (RGB565 com bytes trocados)
+ */
+inline void decodeImageRows(const ImageAsset& asset, uint16_t row, uint16_t lines, uint16_t* out) {
+  for (uint16_t i = 0; i < lines; i++, out += asset.width) {
+    uint32_t y = row + i;
+    if (asset.format == ASSET_Q565) {
+      Q565Decoder::decodeRow((const uint8_t*)asset.pixels + asset.rows[y], asset.width, out);
+    } else if (asset.format == ASSET_PALETTE8) {
+      const uint8_t* index = (const uint8_t*)asset.pixels + y * asset.width;
+      for (uint16_t x = 0; x < asset.width; x++) out[x] = asset.palette[index[x]];
+    } else {
+      memcpy(out, (const uint16_t*)asset.pixels + y * asset.width, asset.width * sizeof(uint16_t));
+    }
+  }
+}
+
+/**
+ * Estado compartilhado do blitter: dois buffers de faixa (memória DMA)
+ */
+struct ImageBlitter {
+  uint16_t* bands[2];
+  bool dma;
+};
+
+inline ImageBlitter& imageBlitter() {
+  static ImageBlitter blitter = { { NULL, NULL }, false };
+  return blitter;
+}
+
+/**
+ * Aloca os buffers de faixa (uma vez)
+ */
+inline bool imageBandsAlloc() {
+  ImageBlitter& blitter = imageBlitter();
+  for (uint8_t i = 0; i < 2; i++) {
+    if (blitter.bands[i] == NULL) {
+      blitter.bands[i] = (uint16_t*)heap_caps_malloc(IMAGE_MAX_WIDTH * IMAGE_BAND_LINES * sizeof(uint16_t), MALLOC_CAP_DMA);
+    }
+  }
+  return blitter.bands[0] != NULL && blitter.bands[1] != NULL;
+}
+
+/**
+ * Heap dos buffers de faixa (0 se não alocados)
+ */
+inline size_t imageBandsBytes() {
+  ImageBlitter& blitter = imageBlitter();
+  size_t bytes = 0;
+  for (uint8_t i = 0; i < 2; i++) {
+    if (blitter.bands[i]) bytes += IMAGE_MAX_WIDTH * IMAGE_BAND_LINES * sizeof(uint16_t);
+  }
+  return bytes;
+}
+
+/**
+ * Chamar no setup() depois de tft.init(): aloca os buffers e liga o DMA.
+ * Retorna true se o envio por DMA está disponível.
+ */
+template <typename Display>
+bool imageBlitterBegin(Display& tft) {
+  ImageBlitter& blitter = imageBlitter();
+  if (!blitter.dma && imageBandsAlloc()) {
+    blitter.dma = tft.initDMA();
+  }
+  return blitter.dma;
+}
+
+/**
+ * Desenha a imagem em (x, y). Retorna o tempo gasto em microssegundos.
+ * Display é qualquer classe com a API de TFT_eSPI (pushImage, pushImageDMA,
+ * dmaWait, startWrite/endWrite, setSwapBytes).
+ */
+template <typename Display>
+uint32_t drawImageAsset(Display& tft, const ImageAsset& asset, int32_t x, int32_t y,
+                        ImageDrawStats* stats = NULL) {
+  uint32_t start = micros();
+  uint32_t decodeMicros = 0;
+
+  // Dados já estão na ordem de bytes do display
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+
+  ImageBlitter& blitter = imageBlitter();
+  bool dma = blitter.dma && asset.width <= IMAGE_MAX_WIDTH;
+
+  if (dma) {
+    // Buffer duplo: pushImageDMA espera a faixa anterior terminar antes de
+    // começar a próxima, então a decodificação de uma sobrepõe o envio da outra
+    uint8_t current = 0;
+    tft.startWrite();
+    for (uint16_t row = 0; row < asset.height; row += IMAGE_BAND_LINES) {
+      uint16_t lines = min<uint16_t>(IMAGE_BAND_LINES, asset.height - row);
+      uint32_t decodeStart = micros();
+      decodeImageRows(asset, row, lines, blitter.bands[current]);
+      decodeMicros += micros() - decodeStart;
+      tft.pushImageDMA(x, y + row, asset.width, lines, blitter.bands[current]);
+      current ^= 1;
+    }
+    tft.dmaWait();
+    tft.endWrite();
+  } else if (asset.format == ASSET_RGB565) {
+    tft.pushImage(x, y, asset.width, asset.height, (const uint16_t*)asset.pixels);
+  } else if (imageBandsAlloc() && asset.width <= IMAGE_MAX_WIDTH) {
+    uint16_t* band = blitter.bands[0];
+    for (uint16_t row = 0; row < asset.height; row += IMAGE_BAND_LINES) {
+      uint16_t lines = min<uint16_t>(IMAGE_BAND_LINES, asset.height - row);
+      uint32_t decodeStart = micros();
+      decodeImageRows(asset, row, lines, band);
+      decodeMicros += micros() - decodeStart;
+      tft.pushImage(x, y + row, asset.width, lines, band);
+    }
+  }
+
+  tft.setSwapBytes(swap);
+  uint32_t elapsed = micros() - start;
+  if (stats) {
+    stats->totalMicros = elapsed;
+    stats->decodeMicros = decodeMicros;
+    stats->dma = dma;
+  }
+  return elapsed;
+}
+
+#endif // IMAGE_ASSET_H
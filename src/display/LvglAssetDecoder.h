@@ -0,0 +1,151 @@
+/**
+ * Decodificador de imagens do LVGL para o AssetRegistry
+ *
+ * Telas do SquareLine (C) usam ui_asset_img("BauTesouro") em vez de um
+ * lv_img_dsc_t próprio: a imagem vem do mesmo registro usado por
+ * drawImageAsset(), sem uma segunda cópia da arte na flash.
+ *
+ * O descritor devolvido tem cf = LV_IMG_CF_USER_ENCODED_0 e data aponta
+ * para o ImageAsset; o decodificador entrega LV_IMG_CF_TRUE_COLOR:
+ *   ASSET_RGB565      img_data aponta direto para os pixels (mesma ordem de
+ *                     bytes do lv_color_t com LV_COLOR_16_SWAP=1)
+ *   ASSET_Q565/PALETTE8  read_line decodifica a linha pedida (cache de
+ *                     uma linha: o LVGL lê linha a linha)
+ *
+ * Chamar lvglAssetDecoderInit() depois de lv_init().
+ */
+
+#ifndef LVGL_ASSET_DECODER_H
+#define LVGL_ASSET_DECODER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "AssetRegistry.h"
+
+// Imagens distintas usadas por telas LVGL
+#ifndef LVGL_ASSET_MAX
+  #define LVGL_ASSET_MAX 8
+#endif
+
+struct LvglAsset {
+  lv_img_dsc_t dsc;
+  ImageAsset asset;
+  char name[ASSET_BUNDLE_NAME_LEN];
+};
+
+struct LvglAssetRow {
+  int32_t row;          // linha decodificada em pixels (-1 = nenhuma)
+  uint16_t pixels[IMAGE_MAX_WIDTH];
+};
+
+static AssetRegistry* lvglAssetRegistry = NULL;
+static LvglAsset lvglAssets[LVGL_ASSET_MAX];
+static uint8_t lvglAssetCount = 0;
+
+static const ImageAsset* lvglAssetFromSrc(const void* src) {
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return NULL;
+  const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+  if (dsc->header.cf != LV_IMG_CF_USER_ENCODED_0) return NULL;
+  return (const ImageAsset*)dsc->data;
+}
+
+static lv_res_t lvglAssetInfo(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+  const ImageAsset* asset = lvglAssetFromSrc(src);
+  if (asset == NULL) return LV_RES_INV;
+  *header = ((const lv_img_dsc_t*)src)->header;
+  header->cf = LV_IMG_CF_TRUE_COLOR;
+  return LV_RES_OK;
+}
+
+static lv_res_t lvglAssetOpen(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+  const ImageAsset* asset = lvglAssetFromSrc(dsc->src);
+  if (asset == NULL) return LV_RES_INV;
+
+#if LV_COLOR_16_SWAP
+  if (asset->format == ASSET_RGB565) {
+    dsc->img_data = (const uint8_t*)asset->pixels;
+    return LV_RES_OK;
+  }
+#endif
+  if (asset->width > IMAGE_MAX_WIDTH) return LV_RES_INV;
+
+  LvglAssetRow* cache = (LvglAssetRow*)lv_mem_alloc(sizeof(LvglAssetRow));
+  if (cache == NULL) return LV_RES_INV;
+  cache->row = -1;
+  dsc->user_data = cache;
+  dsc->img_data = NULL;
+  return LV_RES_OK;
+}
+
+static lv_res_t lvglAssetReadLine(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf) {
+  const ImageAsset* asset = lvglAssetFromSrc(dsc->src);
+  LvglAssetRow* cache = (LvglAssetRow*)dsc->user_data;
+  if (asset == NULL || cache == NULL) return LV_RES_INV;
+
+  if (cache->row != y) {
+    decodeImageRows(*asset, y, 1, cache->pixels);
+    cache->row = y;
+  }
+
+  uint16_t* out = (uint16_t*)buf;
+  for (lv_coord_t i = 0; i < len; i++) {
+    uint16_t c = cache->pixels[x + i];
+#if LV_COLOR_16_SWAP
+    out[i] = c;
+#else
+    out[i] = (c >> 8) | (c << 8);   // assets já vêm na ordem do ILI9341
+#endif
+  }
+  return LV_RES_OK;
+}
+
+static void lvglAssetClose(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+  if (dsc->user_data) {
+    lv_mem_free(dsc->user_data);
+    dsc->user_data = NULL;
+  }
+}
+
+/**
+ * Registra o decodificador (depois de lv_init())
+ */
+inline void lvglAssetDecoderInit(AssetRegistry& registry) {
+  lvglAssetRegistry = &registry;
+  lv_img_decoder_t* decoder = lv_img_decoder_create();
+  lv_img_decoder_set_info_cb(decoder, lvglAssetInfo);
+  lv_img_decoder_set_open_cb(decoder, lvglAssetOpen);
+  lv_img_decoder_set_read_line_cb(decoder, lvglAssetReadLine);
+  lv_img_decoder_set_close_cb(decoder, lvglAssetClose);
+}
+
+/**
+ * Fonte de imagem LVGL para name (chamado pelas telas em C via ui.h).
+ * Retorna NULL se a imagem não existir no registro.
+ */
+extern "C" const lv_img_dsc_t* ui_asset_img(const char* name) {
+  for (uint8_t i = 0; i < lvglAssetCount; i++) {
+    if (strcmp(lvglAssets[i].name, name) == 0) return &lvglAssets[i].dsc;
+  }
+
+  if (lvglAssetRegistry == NULL || lvglAssetCount >= LVGL_ASSET_MAX) return NULL;
+  LvglAsset& entry = lvglAssets[lvglAssetCount];
+  if (!lvglAssetRegistry->find(name, entry.asset)) {
+    Serial.printf("❌ LVGL: imagem %s não encontrada no registro\n", name);
+    return NULL;
+  }
+
+  strncpy(entry.name, name, sizeof(entry.name) - 1);
+  entry.name[sizeof(entry.name) - 1] = '\0';
+  memset(&entry.dsc, 0, sizeof(entry.dsc));
+  entry.dsc.header.always_zero = 0;
+  entry.dsc.header.w = entry.asset.width;
+  entry.dsc.header.h = entry.asset.height;
+  entry.dsc.header.cf = LV_IMG_CF_USER_ENCODED_0;
+  entry.dsc.data = (const uint8_t*)&entry.asset;
+  entry.dsc.data_size = 0;
+  lvglAssetCount++;
+  return &entry.dsc;
+}
+
+#endif // LVGL_ASSET_DECODER_H
@@ -0,0 +1,139 @@
+/**
+ * Task dedicada do LVGL
+ *
+ * lv_timer_handler() roda numa task fixa em um núcleo, que dorme
+ * exatamente até o próximo prazo que ele retorna (ou até wake()). O relógio
+ * do LVGL vem de esp_timer_get_time() (LV_TICK_CUSTOM no lv_conf.h): não
+ * depende de quantas vezes o loop() passa.
+ *
+ * O LVGL não é thread-safe: fora da task, qualquer chamada lv_* precisa do
+ * mutex (recursivo):
+ *
+ *   {
+ *     LvglLock lock(lvglTask);
+ *     lv_qrcode_update(qr_code, url, len);
+ *   }
+ *   lvglTask.wake();   // desenha agora em vez de no próximo prazo
+ *
+ * O painel é dividido com o RoboEyes e as imagens: a task só renderiza
+ * depois de resume() (modo QR Code). pause() espera o render em andamento
+ * terminar e para de desenhar até o próximo resume().
+ */
+
+#ifndef LVGL_TASK_H
+#define LVGL_TASK_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#ifndef LVGL_TASK_CORE
+  #define LVGL_TASK_CORE 1          // mesmo núcleo do loop() do Arduino
+#endif
+#ifndef LVGL_TASK_PRIORITY
+  #define LVGL_TASK_PRIORITY 2      // acima do loopTask (1)
+#endif
+#ifndef LVGL_TASK_STACK
+  #define LVGL_TASK_STACK 6144
+#endif
+#ifndef LVGL_TASK_MAX_SLEEP_MS
+  #define LVGL_TASK_MAX_SLEEP_MS 500
+#endif
+
+class LvglTask {
+private:
+    SemaphoreHandle_t mutex = NULL;
+    TaskHandle_t task = NULL;
+    volatile bool rendering = false;
+
+    static void run(void* arg) {
+        LvglTask* self = (LvglTask*)arg;
+        for (;;) {
+            uint32_t sleepMs = LVGL_TASK_MAX_SLEEP_MS;
+            self->lock();
+            bool active = self->rendering;
+            if (active) sleepMs = lv_timer_handler();   // ms até o próximo timer
+            self->unlock();
+
+            if (!active) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            } else {
+                sleepMs = constrain(sleepMs, 1, LVGL_TASK_MAX_SLEEP_MS);
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs));
+            }
+        }
+    }
+
+public:
+    /**
+     * Cria o mutex e a task (depois de lv_init() e do registro do display).
+     * A task começa pausada.
+     */
+    bool begin() {
+        if (task) return true;
+        mutex = xSemaphoreCreateRecursiveMutex();
+        if (mutex == NULL) return false;
+        if (xTaskCreatePinnedToCore(run, "lvgl", LVGL_TASK_STACK, this,
+                                    LVGL_TASK_PRIORITY, &task, LVGL_TASK_CORE) != pdPASS) {
+            vSemaphoreDelete(mutex);
+            mutex = NULL;
+            task = NULL;
+            return false;
+        }
+        Serial.printf("  ├─ Task LVGL: núcleo %d, prioridade %d, pilha %d bytes\n",
+                      LVGL_TASK_CORE, LVGL_TASK_PRIORITY, LVGL_TASK_STACK);
+        return true;
+    }
+
+    bool started() const { return task != NULL; }
+
+    void lock() { if (mutex) xSemaphoreTakeRecursive(mutex, portMAX_DELAY); }
+    void unlock() { if (mutex) xSemaphoreGiveRecursive(mutex); }
+
+    /**
+     * Acorda a task (objetos alterados: desenha já)
+     */
+    void wake() { if (task) xTaskNotifyGive(task); }
+
+    /**
+     * LVGL volta a ser dono do painel: redesenha a tela ativa inteira
+     * (outra coisa pode ter desenhado por cima)
+     */
+    void resume() {
+        if (!task) return;
+        lock();
+        lv_obj_invalidate(lv_scr_act());
+        rendering = true;
+        unlock();
+        wake();
+    }
+
+    /**
+     * Para de desenhar (retorna depois do render em andamento)
+     */
+    void pause() {
+        if (!task) return;
+        lock();
+        rendering = false;
+        unlock();
+    }
+
+    bool isRendering() const { return rendering; }
+};
+
+/**
+ * Mutex do LVGL pelo escopo
+ */
+class LvglLock {
+private:
+    LvglTask& owner;
+public:
+    explicit LvglLock(LvglTask& t) : owner(t) { owner.lock(); }
+    ~LvglLock() { owner.unlock(); }
+    LvglLock(const LvglLock&) = delete;
+    LvglLock& operator=(const LvglLock&) = delete;
+};
+
+#endif // LVGL_TASK_H
@@ -0,0 +1,214 @@
+/**
+ * Orçamento de memória por subsistema (concessões nomeadas)
+ *
+ * O CYD não tem PSRAM: sprite dos olhos, LVGL, faixas das imagens e o
+ * armazenamento disputam ~300 KB de DRAM. Cada subsistema tem uma
+ * concessão (MemLease) com orçamento máximo; os modos de tela constroem e
+ * desmontam subsistemas e a memória volta para o heap em vez de ficar
+ * presa até o reset.
+ *
+ * Dois jeitos de contar:
+ *   alloc()/free()/realloc()  memória do próprio subsistema (buffers do
+ *                             LVGL, heap do LVGL via LV_MEM_CUSTOM)
+ *   set()                     memória alocada por uma biblioteca (sprite
+ *                             do TFT_eSprite, bloco do backup, índice do
+ *                             TagStore): informa o total atual
+ * admit() responde se uma alocação cabe antes de construir o subsistema.
+ *
+ * Para cada concessão: em uso, pico (high-water), orçamento, negadas e o
+ * maior bloco livre do heap quando ela bateu o pico (pior caso), que
+ * mostra quanto a fragmentação deixou para os outros.
+ */
+
+#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+
+// Orçamentos (bytes); 0 = sem limite
+#ifndef MEM_BUDGET_EYES
+  #define MEM_BUDGET_EYES 32768           // sprite + 2 faixas DMA do RoboEyes
+#endif
+#ifndef MEM_BUDGET_LVGL_BUFFERS
+  #define MEM_BUDGET_LVGL_BUFFERS 40960   // 2 faixas de desenho do LVGL
+#endif
+#ifndef MEM_BUDGET_LVGL_HEAP
+  #define MEM_BUDGET_LVGL_HEAP 49152      // objetos lv_* (tela do QR Code)
+#endif
+#ifndef MEM_BUDGET_IMAGES
+  #define MEM_BUDGET_IMAGES 20480         // 2 faixas do blitter de imagens
+#endif
+#ifndef MEM_BUDGET_STORAGE
+  #define MEM_BUDGET_STORAGE 16384        // bloco do backup SD + índice do TagStore
+#endif
+
+// Heap que nenhuma concessão pode consumir (pilhas de tasks, UART, SD)
+#ifndef MEM_HEAP_RESERVE
+  #define MEM_HEAP_RESERVE 24576
+#endif
+
+enum MemLease : uint8_t {
+  MEM_EYES,
+  MEM_LVGL_BUFFERS,
+  MEM_LVGL_HEAP,
+  MEM_IMAGES,
+  MEM_STORAGE,
+  MEM_LEASE_COUNT
+};
+
+class MemoryBudget {
+public:
+  struct Lease {
+    const char* name;
+    uint32_t budget;
+    uint32_t used;
+    uint32_t peak;          // high-water mark
+    uint32_t largestFree;   // menor "maior bloco livre" nos picos
+    uint32_t denied;        // pedidos recusados (orçamento ou heap)
+  };
+
+private:
+  // Cabeçalho de alloc(): free() descobre tamanho e concessão sozinho
+  // (8 bytes mantêm o alinhamento do heap)
+  struct Header {
+    uint32_t size;
+    uint8_t lease;
+    uint8_t pad[3];
+  };
+
+  Lease leases[MEM_LEASE_COUNT] = {
+    { "olhos",        MEM_BUDGET_EYES,         0, 0, UINT32_MAX, 0 },
+    { "lvgl buffers", MEM_BUDGET_LVGL_BUFFERS, 0, 0, UINT32_MAX, 0 },
+    { "lvgl heap",    MEM_BUDGET_LVGL_HEAP,    0, 0, UINT32_MAX, 0 },
+    { "imagens",      MEM_BUDGET_IMAGES,       0, 0, UINT32_MAX, 0 },
+    { "storage",      MEM_BUDGET_STORAGE,      0, 0, UINT32_MAX, 0 },
+  };
+  uint32_t leaseCaps[MEM_LEASE_COUNT] = {
+    MALLOC_CAP_8BIT, MALLOC_CAP_DMA, MALLOC_CAP_8BIT, MALLOC_CAP_DMA, MALLOC_CAP_8BIT
+  };
+
+  // O LVGL aloca na própria task: contadores protegidos
+  portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+  void grow(MemLease id, int32_t delta) {
+    Lease& lease = leases[id];
+    portENTER_CRITICAL(&mux);
+    lease.used = (int32_t)lease.used + delta > 0 ? lease.used + delta : 0;
+    bool newPeak = lease.used > lease.peak;
+    if (newPeak) lease.peak = lease.used;
+    portEXIT_CRITICAL(&mux);
+
+    // Percorrer o heap custa: maior bloco livre só em pico novo
+    if (newPeak) {
+      uint32_t largest = heap_caps_get_largest_free_block(leaseCaps[id]);
+      portENTER_CRITICAL(&mux);
+      if (largest < lease.largestFree) lease.largestFree = largest;
+      portEXIT_CRITICAL(&mux);
+    }
+  }
+
+  void deny(MemLease id) {
+    portENTER_CRITICAL(&mux);
+    leases[id].denied++;
+    portEXIT_CRITICAL(&mux);
+  }
+
+  bool fits(MemLease id, size_t bytes, uint32_t caps) const {
+    const Lease& lease = leases[id];
+    if (lease.budget > 0 && lease.used + bytes > lease.budget) return false;
+    if (heap_caps_get_free_size(caps) < bytes + MEM_HEAP_RESERVE) return false;
+    return heap_caps_get_largest_free_block(caps) >= bytes;
+  }
+
+public:
+  /**
+   * Cabe mais bytes na concessão (orçamento, reserva e maior bloco livre)?
+   * Recusa conta como negada.
+   */
+  bool admit(MemLease id, size_t bytes) {
+    if (fits(id, bytes, leaseCaps[id])) return true;
+    deny(id);
+    return false;
+  }
+
+  /**
+   * Aloca na concessão. enforce = false só conta (o LVGL para em assert se
+   * a alocação falhar: passar do orçamento vira pico no relatório).
+   */
+  void* alloc(MemLease id, size_t bytes, bool enforce = true) {
+    if (enforce && !fits(id, bytes + sizeof(Header), leaseCaps[id])) {
+      deny(id);
+      return NULL;
+    }
+    Header* header = (Header*)heap_caps_malloc(bytes + sizeof(Header), leaseCaps[id]);
+    if (header == NULL) {
+      deny(id);
+      return NULL;
+    }
+    header->size = bytes;
+    header->lease = id;
+    grow(id, bytes + sizeof(Header));
+    return header + 1;
+  }
+
+  void free(void* ptr) {
+    if (ptr == NULL) return;
+    Header* header = (Header*)ptr - 1;
+    grow((MemLease)header->lease, -(int32_t)(header->size + sizeof(Header)));
+    heap_caps_free(header);
+  }
+
+  void* realloc(MemLease id, void* ptr, size_t bytes) {
+    if (ptr == NULL) return alloc(id, bytes, false);
+    if (bytes == 0) {
+      free(ptr);
+      return NULL;
+    }
+    Header* header = (Header*)ptr - 1;
+    uint32_t oldSize = header->size;
+    Header* moved = (Header*)heap_caps_realloc(header, bytes + sizeof(Header), leaseCaps[id]);
+    if (moved == NULL) {
+      deny(id);
+      return NULL;
+    }
+    moved->size = bytes;
+    grow(id, (int32_t)bytes - (int32_t)oldSize);
+    return moved + 1;
+  }
+
+  /**
+   * Total atual de uma concessão alocada fora daqui (biblioteca)
+   */
+  void set(MemLease id, size_t bytes) {
+    grow(id, (int32_t)bytes - (int32_t)leases[id].used);
+  }
+
+  const Lease& lease(MemLease id) const { return leases[id]; }
+
+  /**
+   * Uma linha por concessão + estado do heap
+   */
+  void report(Print& out) {
+    out.println("🧮 Memória por subsistema (em uso / pico / orçamento, maior bloco livre no pico):");
+    for (uint8_t i = 0; i < MEM_LEASE_COUNT; i++) {
+      Lease snapshot;
+      portENTER_CRITICAL(&mux);
+      snapshot = leases[i];
+      portEXIT_CRITICAL(&mux);
+      out.printf("   %-12s %6lu / %6lu / %6lu B, bloco livre %6lu B, %lu negadas\n",
+                 snapshot.name, (unsigned long)snapshot.used, (unsigned long)snapshot.peak,
+                 (unsigned long)snapshot.budget,
+                 (unsigned long)(snapshot.largestFree == UINT32_MAX ? 0 : snapshot.largestFree),
+                 (unsigned long)snapshot.denied);
+    }
+    out.printf("   heap: %lu B livres (mínimo %lu), maior bloco %lu B (DMA %lu B)\n",
+               (unsigned long)heap_caps_get_free_size(MALLOC_CAP_8BIT),
+               (unsigned long)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT),
+               (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT),
+               (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+  }
+};
+
+#endif // MEMORY_BUDGET_H
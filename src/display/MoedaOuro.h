@@ -1,246 +0,0 @@
-#define MOEDAOURO_HEIGHT 240
-#define MOEDAOURO_WIDTH 243
-
-// array size is 174960
-static const uint32_t MoedaOuro[] PROGMEM  = {
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x020202, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010200, 0x020200, 0x020200, 0x020200, 0x030301, 0x030400, 0x030400, 0x030400, 0x040500, 0x040400, 0x060300, 0x090501, 0x0b0702, 0x0b0904, 0x0c0703, 0x0a0702, 0x080500, 0x070501, 0x060400, 0x050400, 0x050400, 0x040400, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x060501, 0x080401, 0x070401, 0x070401, 0x070401, 0x080401, 0x080501, 0x090601, 0x090702, 0x0a0803, 0x0c0803, 0x0d0803, 0x100902, 0x110a02, 0x120b03, 0x120a03, 0x120a03, 0x120b03, 0x130b04, 0x140a03, 0x140b03, 0x130a03, 0x120a02, 0x120902, 0x130a03, 0x130b04, 0x130a03, 0x120a03, 0x100902, 0x0e0802, 0x0d0803, 0x0c0703, 0x0b0702, 0x0a0702, 0x0a0702, 0x090601, 0x080601, 0x060600, 0x070601, 0x070601, 0x080500, 0x080500, 0x080500, 0x080401, 0x080401, 0x080401, 0x070401, 0x070401, 0x070401, 0x070401, 0x070401, 0x080401, 0x080401, 0x090602, 0x0a0602, 0x0c0904, 0x0d0a05, 0x0c0904, 0x090702, 0x080601, 0x090601, 0x080401, 0x080401, 0x070401, 0x070401, 0x080501, 0x080601, 0x070500, 0x080601, 0x0a0702, 0x0a0702, 0x0a0602, 0x0b0702, 0x0b0803, 0x090702, 0x070601, 0x070501, 0x070401, 0x050400, 0x050400, 0x040400, 0x030400, 0x040500, 0x030400, 0x030400, 0x030400, 0x020300, 0x010200, 0x010200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x020201, 0x020200, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x010200, 0x030301, 0x030301, 0x030301, 0x030300, 0x030400, 0x030400, 0x030400, 0x040500, 0x050500, 0x060400, 0x090500, 0x0a0702, 0x0c0904, 0x0d0802, 0x0c0803, 0x0a0602, 0x080500, 0x070500, 0x070400, 0x070400, 0x070400, 0x070400, 0x070300, 0x070300, 0x080401, 0x080401, 0x090502, 0x080401, 0x080401, 0x080401, 0x080401, 0x090502, 0x090602, 0x090702, 0x090702, 0x090802, 0x0d0802, 0x0e0903, 0x100a03, 0x110a02, 0x120902, 0x130a03, 0x130a03, 0x130a03, 0x150b04, 0x160c03, 0x150b02, 0x140b02, 0x130a01, 0x130a02, 0x140b03, 0x150b03, 0x150c04, 0x130a02, 0x110a02, 0x110a04, 0x0e0904, 0x0c0703, 0x0b0702, 0x0a0701, 0x0a0701, 0x0a0701, 0x090701, 0x080601, 0x080601, 0x090501, 0x0a0501, 0x0a0601, 0x090601, 0x090501, 0x090401, 0x090401, 0x090401, 0x090401, 0x090401, 0x090401, 0x080401, 0x080401, 0x090502, 0x0a0502, 0x0b0602, 0x0c0904, 0x0e0a05, 0x0d0904, 0x090703, 0x080702, 0x080501, 0x080401, 0x080401, 0x080401, 0x080500, 0x080601, 0x090601, 0x090601, 0x090701, 0x090702, 0x090702, 0x0a0803, 0x0b0803, 0x0b0802, 0x090702, 0x070601, 0x070500, 0x080400, 0x060300, 0x050400, 0x050400, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030300, 0x030201, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030300, 0x030400, 0x020300, 0x030400, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x040500, 0x060400, 0x080500, 0x090601, 0x0b0602, 0x0e0803, 0x0e0903, 0x0d0803, 0x0b0703, 0x070501, 0x070501, 0x080401, 0x080401, 0x080401, 0x080401, 0x080401, 0x080401, 0x080401, 0x080401, 0x090502, 0x090501, 0x090501, 0x080501, 0x090602, 0x090702, 0x090702, 0x0b0803, 0x0b0803, 0x0b0903, 0x0d0902, 0x0f0b02, 0x110b03, 0x130c04, 0x130c04, 0x130b04, 0x140b04, 0x150b04, 0x170d04, 0x180e04, 0x170d03, 0x150b02, 0x140b02, 0x150c03, 0x160c03, 0x160d03, 0x170d04, 0x150c03, 0x130a03, 0x120a03, 0x100a04, 0x0d0803, 0x0c0602, 0x0b0602, 0x0b0702, 0x090702, 0x080801, 0x090702, 0x090702, 0x0a0702, 0x0a0602, 0x0a0702, 0x0a0702, 0x090601, 0x090601, 0x090601, 0x090601, 0x090501, 0x090601, 0x090501, 0x080601, 0x080601, 0x0a0602, 0x0a0602, 0x0c0703, 0x100a03, 0x110b05, 0x0e0905, 0x0a0803, 0x090802, 0x080702, 0x070601, 0x060500, 0x060501, 0x060500, 0x080601, 0x0a0602, 0x0a0603, 0x0a0703, 0x0a0803, 0x0b0703, 0x0c0703, 0x0c0703, 0x0b0803, 0x090803, 0x070702, 0x080501, 0x080401, 0x080500, 0x060500, 0x050400, 0x050500, 0x040401, 0x030301, 0x030301, 0x030301, 0x030301, 0x030300, 0x030300, 0x040400, 0x030300, 0x030301, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030301, 0x030400, 0x030400, 0x030500, 0x030400, 0x030400, 0x040400, 0x040400, 0x040500, 0x040500, 0x040500, 0x050400, 0x070401, 0x080500, 0x090601, 0x0c0703, 0x0f0803, 0x100a03, 0x100903, 0x0d0803, 0x0a0703, 0x080602, 0x080501, 0x090501, 0x090502, 0x080401, 0x080501, 0x090502, 0x090502, 0x0a0602, 0x0a0602, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0803, 0x0b0803, 0x0b0803, 0x0b0803, 0x0d0904, 0x0f0a03, 0x110c03, 0x130c04, 0x140c05, 0x140c04, 0x140c04, 0x150c05, 0x170d04, 0x190e05, 0x1a0e04, 0x190e05, 0x170d04, 0x170d04, 0x180d04, 0x180d04, 0x190e05, 0x190e05, 0x180d04, 0x140b03, 0x130a03, 0x120b04, 0x0e0903, 0x0c0802, 0x0b0802, 0x0a0803, 0x090803, 0x080702, 0x080702, 0x090702, 0x0a0702, 0x0a0702, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0803, 0x090702, 0x0a0702, 0x0b0603, 0x0e0804, 0x120a03, 0x120b04, 0x0e0904, 0x0b0804, 0x0a0802, 0x0a0702, 0x090601, 0x080500, 0x080501, 0x090602, 0x090702, 0x0a0702, 0x0b0703, 0x0b0702, 0x0b0701, 0x0d0802, 0x0e0802, 0x0e0802, 0x0c0802, 0x0a0802, 0x080703, 0x080702, 0x090601, 0x080500, 0x060500, 0x050400, 0x050400, 0x040500, 0x030400, 0x030400, 0x030300, 0x030400, 0x020400, 0x020400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x020201, 0x030301, 0x030301, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030301, 0x020201, 0x020200, 0x010100, 0x010100, 0x020200, 0x030301, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030300, 0x050400, 0x050500, 0x040500, 0x040500, 0x050400, 0x050400, 0x070400, 0x080500, 0x090601, 0x0c0703, 0x0f0803, 0x120b02, 0x120a03, 0x100a03, 0x0c0803, 0x0a0802, 0x0a0702, 0x090601, 0x080500, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0803, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0703, 0x0b0803, 0x0c0903, 0x0b0803, 0x0c0803, 0x0d0804, 0x0e0904, 0x100a04, 0x130c04, 0x150c05, 0x150b05, 0x150c05, 0x150c04, 0x160d04, 0x180d04, 0x1c0f06, 0x1c0f06, 0x1b0e06, 0x1a0e05, 0x190d05, 0x1a0d05, 0x1b0e06, 0x1b0e06, 0x1c0e06, 0x1a0d05, 0x150c03, 0x140b04, 0x130b04, 0x110a04, 0x0d0903, 0x0c0902, 0x0b0802, 0x090803, 0x080702, 0x080702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0b0803, 0x0b0703, 0x0b0803, 0x0a0703, 0x0a0702, 0x0a0702, 0x0a0703, 0x0a0702, 0x0b0702, 0x0c0703, 0x110a05, 0x130b04, 0x120b03, 0x0e0903, 0x0c0903, 0x0b0803, 0x0a0802, 0x0a0702, 0x090601, 0x0a0602, 0x0a0703, 0x0b0702, 0x0b0602, 0x0c0702, 0x0d0802, 0x0e0802, 0x110a04, 0x120a04, 0x110903, 0x0f0903, 0x0b0801, 0x080802, 0x090702, 0x090601, 0x070601, 0x070400, 0x070300, 0x060300, 0x040400, 0x040500, 0x040500, 0x030400, 0x030400, 0x020400, 0x020400, 0x020400, 0x020400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x020300, 0x020300, 0x010200, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x030201, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010200, 0x010200, 0x020200, 0x020200, 0x020200, 0x020300, 0x030300, 0x030400, 0x030400, 0x030400, 0x040500, 0x040500, 0x030400, 0x030500, 0x030500, 0x040500, 0x050400, 0x050400, 0x050400, 0x040500, 0x050400, 0x060400, 0x080401, 0x080401, 0x080601, 0x0a0601, 0x0c0703, 0x0f0803, 0x130b02, 0x140b03, 0x130b04, 0x0e0802, 0x0b0802, 0x0b0803, 0x090701, 0x0a0702, 0x0b0803, 0x0a0702, 0x0a0702, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0802, 0x0a0802, 0x0a0702, 0x0b0803, 0x0b0801, 0x0c0902, 0x0d0802, 0x0d0802, 0x0f0903, 0x120b05, 0x140c05, 0x150c05, 0x170c06, 0x160c05, 0x160d04, 0x170d04, 0x1a0e06, 0x1d1007, 0x1f1108, 0x1d0f07, 0x1c0e07, 0x1b0e06, 0x1b0d05, 0x1c0d06, 0x1d0f08, 0x1d0f08, 0x1c0e07, 0x170d04, 0x150c03, 0x140c04, 0x120b04, 0x0f0a03, 0x0d0903, 0x0c0802, 0x0c0703, 0x0b0603, 0x090702, 0x0a0702, 0x0a0803, 0x0a0702, 0x0b0702, 0x0a0501, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0702, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0703, 0x0a0703, 0x0b0703, 0x0f0903, 0x120b04, 0x150c05, 0x140b04, 0x100903, 0x0d0903, 0x0c0902, 0x0c0903, 0x0a0803, 0x0a0702, 0x0a0703, 0x0b0603, 0x0b0703, 0x0d0703, 0x0f0802, 0x100a02, 0x120a03, 0x130b03, 0x130a03, 0x130a03, 0x110903, 0x0d0802, 0x090801, 0x0a0802, 0x090702, 0x080601, 0x080400, 0x080301, 0x070300, 0x050400, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030500, 0x040500, 0x030400, 0x030400, 0x020300, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020300, 0x030300, 0x030300, 0x020300, 0x020300, 0x020300, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000001, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x030300, 0x030401, 0x030301, 0x020400, 0x020400, 0x030400, 0x030400, 0x020400, 0x030400, 0x030400, 0x040400, 0x040400, 0x040400, 0x050400, 0x040400, 0x050500, 0x040400, 0x050400, 0x060400, 0x070300, 0x080401, 0x080501, 0x090602, 0x0a0602, 0x0c0603, 0x0f0802, 0x130a02, 0x160d04, 0x140b03, 0x110903, 0x0d0803, 0x0b0803, 0x0b0703, 0x0b0803, 0x0b0703, 0x0b0703, 0x0b0703, 0x0b0703, 0x0b0703, 0x0c0803, 0x0b0802, 0x0c0803, 0x0b0702, 0x0b0702, 0x0c0803, 0x0d0904, 0x0e0903, 0x0e0903, 0x100b05, 0x140c06, 0x150c05, 0x160c05, 0x190d06, 0x180e05, 0x190e05, 0x1a0e05, 0x1c0f06, 0x1e1107, 0x201209, 0x1f1008, 0x1e0f07, 0x1c0e07, 0x1c0e06, 0x1e1008, 0x1e1008, 0x1f1008, 0x1d0f07, 0x1a0f06, 0x170d04, 0x140b04, 0x130b05, 0x0f0a03, 0x0e0903, 0x0d0803, 0x0c0703, 0x0b0602, 0x0a0602, 0x0b0702, 0x0a0702, 0x0a0702, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0c0702, 0x0c0804, 0x0d0803, 0x0d0703, 0x0c0804, 0x0d0803, 0x0e0902, 0x110a03, 0x130b04, 0x160d04, 0x140b04, 0x110a04, 0x0e0802, 0x0d0802, 0x0c0803, 0x0c0803, 0x0c0803, 0x0c0804, 0x0d0704, 0x0e0804, 0x100903, 0x100a02, 0x110a02, 0x130b03, 0x140b05, 0x140b04, 0x140a03, 0x120a04, 0x0f0903, 0x0b0802, 0x0a0802, 0x0a0703, 0x080702, 0x080601, 0x070501, 0x070401, 0x050500, 0x030500, 0x040400, 0x040500, 0x040500, 0x050400, 0x050400, 0x040400, 0x050500, 0x040500, 0x030400, 0x030400, 0x030400, 0x030400, 0x030401, 0x030401, 0x040401, 0x030300, 0x040400, 0x040401, 0x030301, 0x030301, 0x030301, 0x030300, 0x030300, 0x030301, 0x040301, 0x040401, 0x040400, 0x020400, 0x020400, 0x020300, 0x020300, 0x020200, 0x020200, 0x010100, 0x010100, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000001, 0x000001, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x030301, 0x030301, 0x030301, 0x030301, 0x020401, 0x030400, 0x040300, 0x040401, 0x030401, 0x030400, 0x040500, 0x050500, 0x050400, 0x040400, 0x040500, 0x040400, 0x050400, 0x060400, 0x080401, 0x080401, 0x080401, 0x080401, 0x080501, 0x090602, 0x0a0603, 0x0b0603, 0x0f0802, 0x140b02, 0x160c03, 0x160d04, 0x140b04, 0x100a03, 0x0d0803, 0x0c0704, 0x0c0703, 0x0c0703, 0x0b0602, 0x0c0703, 0x0b0602, 0x0c0703, 0x0c0703, 0x0c0804, 0x0c0703, 0x0b0602, 0x0d0703, 0x0e0905, 0x0f0a05, 0x0f0a04, 0x0f0a04, 0x110b05, 0x140b05, 0x150b04, 0x190e05, 0x1b0e05, 0x1b0f06, 0x1c0f07, 0x1b0e05, 0x1d0f07, 0x201209, 0x201308, 0x1f1209, 0x1f1108, 0x1e1008, 0x1d0f07, 0x1e1108, 0x1f1209, 0x201209, 0x1f1108, 0x1d0f07, 0x1a0e06, 0x150b04, 0x130b04, 0x110a04, 0x0e0903, 0x0d0802, 0x0c0803, 0x0b0803, 0x0c0703, 0x0c0703, 0x0b0602, 0x0c0703, 0x0c0703, 0x0c0703, 0x0c0703, 0x0c0703, 0x0c0703, 0x0c0804, 0x0d0907, 0x0f0704, 0x0f0804, 0x0d0a05, 0x0e0a03, 0x110a02, 0x120a03, 0x160b04, 0x180e05, 0x150b04, 0x120a03, 0x100903, 0x0f0803, 0x0d0703, 0x0e0804, 0x0e0804, 0x0e0804, 0x100804, 0x110a04, 0x110a03, 0x120b03, 0x130b03, 0x150c04, 0x150c06, 0x150b06, 0x150b03, 0x130a04, 0x100903, 0x0e0903, 0x0b0602, 0x0a0702, 0x090702, 0x080702, 0x080601, 0x070500, 0x050400, 0x050400, 0x050501, 0x050400, 0x050400, 0x040400, 0x050400, 0x050400, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x030400, 0x030401, 0x030401, 0x040401, 0x040300, 0x040401, 0x040401, 0x040401, 0x040401, 0x040401, 0x040500, 0x050500, 0x050400, 0x050401, 0x050401, 0x040400, 0x020400, 0x030401, 0x020201, 0x020300, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010102, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x020200, 0x030301, 0x020200, 0x020200, 0x030301, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030301, 0x030301, 0x030301, 0x040402, 0x040402, 0x050400, 0x040400, 0x040500, 0x040500, 0x040500, 0x040500, 0x050400, 0x070300, 0x080300, 0x080401, 0x080401, 0x080401, 0x090502, 0x090602, 0x0a0703, 0x0a0603, 0x0b0602, 0x0e0802, 0x130a02, 0x170d04, 0x1a0e05, 0x170d04, 0x130b03, 0x110a04, 0x0f0805, 0x0d0804, 0x0c0702, 0x0d0804, 0x0d0804, 0x0c0703, 0x0c0703, 0x0c0702, 0x0d0802, 0x0d0803, 0x0e0803, 0x100904, 0x110a05, 0x110b05, 0x110a05, 0x110a04, 0x140c05, 0x150c04, 0x170d04, 0x1a0e06, 0x1c0f07, 0x1d1007, 0x1d1007, 0x1d1007, 0x1f1108, 0x211308, 0x201408, 0x201408, 0x201308, 0x1e1207, 0x1f1208, 0x20130a, 0x22140b, 0x22130a, 0x211209, 0x1f1108, 0x1c0f07, 0x170d05, 0x150c04, 0x130b04, 0x110a04, 0x100a04, 0x0e0903, 0x0e0903, 0x0e0903, 0x0d0802, 0x0d0803, 0x0d0803, 0x0d0803, 0x0e0903, 0x0d0803, 0x0d0803, 0x0d0903, 0x0e0903, 0x100804, 0x160902, 0x120802, 0x0f0904, 0x100a03, 0x120a03, 0x140b03, 0x180e05, 0x190f06, 0x160c04, 0x130a03, 0x120a04, 0x100904, 0x0f0604, 0x100705, 0x0f0704, 0x100705, 0x100a04, 0x120b04, 0x130b04, 0x150c04, 0x150c03, 0x160d04, 0x170d05, 0x170d04, 0x160c03, 0x130a03, 0x110a04, 0x0f0903, 0x0c0701, 0x0b0702, 0x0b0803, 0x0b0803, 0x090601, 0x080500, 0x080500, 0x070500, 0x080501, 0x080500, 0x070500, 0x060400, 0x060400, 0x050400, 0x060400, 0x050500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040400, 0x050400, 0x050500, 0x040500, 0x040500, 0x040500, 0x040500, 0x060401, 0x060501, 0x060501, 0x070502, 0x070501, 0x050400, 0x030500, 0x030400, 0x030301, 0x030400, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010101, 0x010101, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030301, 0x030300, 0x030200, 0x030301, 0x040301, 0x030400, 0x030400, 0x040500, 0x030400, 0x030400, 0x040301, 0x040301, 0x040401, 0x040401, 0x040301, 0x040402, 0x040402, 0x040402, 0x040402, 0x040500, 0x040500, 0x040400, 0x040400, 0x050400, 0x060401, 0x070401, 0x090401, 0x090401, 0x090401, 0x090401, 0x0a0502, 0x0a0503, 0x0a0602, 0x0b0702, 0x0b0602, 0x0c0703, 0x0d0802, 0x130a03, 0x190d04, 0x1d0f07, 0x1b0e06, 0x150b02, 0x130a04, 0x110904, 0x100803, 0x0e0802, 0x0d0903, 0x0d0802, 0x0d0803, 0x0d0803, 0x0d0903, 0x0e0902, 0x0f0903, 0x100903, 0x110a03, 0x110a04, 0x120b05, 0x120b04, 0x120b03, 0x140d04, 0x160d03, 0x180e05, 0x1c0f07, 0x1d0f08, 0x1e1007, 0x1e1007, 0x201108, 0x231208, 0x241309, 0x24140a, 0x25150a, 0x231408, 0x221306, 0x221308, 0x231309, 0x25150b, 0x25140b, 0x231309, 0x201207, 0x1d1006, 0x190e05, 0x160d04, 0x140b03, 0x130a03, 0x110a03, 0x110a04, 0x100903, 0x0d0802, 0x0d0903, 0x0e0903, 0x0d0802, 0x0d0802, 0x0e0903, 0x0d0903, 0x0e0903, 0x0e0902, 0x100901, 0x180c02, 0x3b291c, 0x231509, 0x0e0701, 0x110a04, 0x130a03, 0x160c03, 0x1b0f06, 0x1a0f06, 0x160c03, 0x140a03, 0x130a04, 0x110a04, 0x110904, 0x100803, 0x110904, 0x110904, 0x110b05, 0x120b04, 0x140c04, 0x160c03, 0x170d04, 0x190e05, 0x180e04, 0x180e04, 0x160c03, 0x140b03, 0x120a02, 0x100903, 0x0e0802, 0x0b0701, 0x0b0803, 0x0b0803, 0x0a0702, 0x090601, 0x090601, 0x090601, 0x090601, 0x090601, 0x090501, 0x080501, 0x070400, 0x070400, 0x080400, 0x050500, 0x040500, 0x040500, 0x040500, 0x040500, 0x050400, 0x050400, 0x060400, 0x060300, 0x060400, 0x050400, 0x050400, 0x050400, 0x060501, 0x090502, 0x090502, 0x090602, 0x090501, 0x080500, 0x060500, 0x040500, 0x030400, 0x040400, 0x030400, 0x020200, 0x020200, 0x010100, 0x010100, 0x020100, 0x020100, 0x020100, 0x020100, 0x010100, 0x000001, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x030301, 0x030301, 0x030301, 0x040300, 0x030200, 0x040300, 0x040300, 0x040400, 0x030400, 0x030400, 0x030400, 0x030400, 0x050302, 0x050402, 0x050402, 0x050402, 0x050401, 0x040500, 0x030500, 0x030500, 0x040500, 0x030500, 0x040500, 0x050400, 0x060400, 0x070400, 0x080300, 0x080300, 0x080401, 0x090401, 0x090401, 0x0a0502, 0x0a0502, 0x0b0603, 0x0b0602, 0x0c0702, 0x0c0703, 0x0c0702, 0x0e0a02, 0x130a02, 0x1a0d04, 0x1f1108, 0x1f1108, 0x190d04, 0x140a03, 0x120904, 0x110903, 0x100a03, 0x0f0903, 0x0f0903, 0x0f0903, 0x100904, 0x100a03, 0x0f0a02, 0x110a02, 0x110a03, 0x110a03, 0x110a04, 0x120b05, 0x130c04, 0x130c04, 0x150c04, 0x170d03, 0x1a0e05, 0x1d0f08, 0x1e0f08, 0x1e1008, 0x211209, 0x221108, 0x241309, 0x26140a, 0x28160c, 0x27160a, 0x261508, 0x251406, 0x251507, 0x251508, 0x261609, 0x271509, 0x261408, 0x221409, 0x1f1207, 0x1b0f06, 0x170d04, 0x140b03, 0x130a03, 0x130a03, 0x120a04, 0x110a04, 0x0f0903, 0x0e0903, 0x0f0a04, 0x0e0903, 0x0f0903, 0x100a04, 0x100a04, 0x100a04, 0x0f0a04, 0x0d0a04, 0x150b03, 0x29190d, 0x1a0e04, 0x0e0904, 0x120a04, 0x140b03, 0x190c03, 0x1d1006, 0x1c0f06, 0x170d04, 0x140b03, 0x130a03, 0x120a02, 0x110a02, 0x110a02, 0x110a02, 0x110a02, 0x110b04, 0x130b04, 0x150c03, 0x180d04, 0x1b0e06, 0x1b0f06, 0x1b1005, 0x1a1005, 0x170d04, 0x140b04, 0x120a03, 0x110a02, 0x0f0802, 0x0c0802, 0x0a0702, 0x0a0703, 0x0b0803, 0x0a0702, 0x090702, 0x090702, 0x080601, 0x080601, 0x080601, 0x080601, 0x080500, 0x080400, 0x090400, 0x060500, 0x050601, 0x040500, 0x040500, 0x050501, 0x070300, 0x080401, 0x080401, 0x090401, 0x080401, 0x080401, 0x090502, 0x0a0502, 0x0b0603, 0x0b0603, 0x0b0603, 0x0b0703, 0x090601, 0x080500, 0x070500, 0x040500, 0x050500, 0x050400, 0x030300, 0x020200, 0x030301, 0x030301, 0x030200, 0x030200, 0x020100, 0x020100, 0x020100, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010102, 0x010101, 0x010101, 0x010101, 0x020201, 0x010100, 0x020200, 0x020200, 0x030200, 0x020200, 0x030301, 0x030401, 0x020301, 0x020300, 0x030300, 0x030300, 0x040400, 0x040400, 0x050400, 0x050400, 0x040300, 0x040300, 0x050400, 0x050400, 0x050400, 0x050400, 0x050401, 0x050500, 0x040500, 0x040500, 0x040400, 0x050400, 0x050500, 0x060500, 0x080500, 0x080400, 0x080300, 0x070300, 0x080401, 0x080401, 0x080401, 0x0a0501, 0x0a0602, 0x0a0702, 0x0b0803, 0x0b0702, 0x0b0803, 0x0b0803, 0x0d0902, 0x110902, 0x140b02, 0x180d05, 0x1e1108, 0x22120a, 0x1e0f07, 0x170b04, 0x130a04, 0x110a04, 0x110905, 0x120a05, 0x110a04, 0x110a04, 0x110a04, 0x110a04, 0x110a04, 0x110a04, 0x120b05, 0x130c06, 0x130c06, 0x130b05, 0x150b04, 0x150b05, 0x160b05, 0x190d06, 0x1c0f06, 0x1e1008, 0x201109, 0x21120a, 0x21130a, 0x221309, 0x241309, 0x26150a, 0x29170a, 0x29170a, 0x281608, 0x261406, 0x271508, 0x28160a, 0x28170a, 0x28160a, 0x271509, 0x25140a, 0x211208, 0x1d1007, 0x1a0f05, 0x170d06, 0x140a04, 0x140b05, 0x130a05, 0x120a04, 0x110a03, 0x110b03, 0x110a04, 0x0f0a05, 0x110904, 0x120a04, 0x100a06, 0x0f0a06, 0x100a05, 0x0f0a04, 0x110a04, 0x100903, 0x110a04, 0x120b04, 0x130b04, 0x150b03, 0x1b0e05, 0x1f1107, 0x1c0f06, 0x180c04, 0x150b04, 0x130a04, 0x120a04, 0x130a03, 0x120a03, 0x130a03, 0x130a03, 0x140b03, 0x150c04, 0x180e05, 0x1c0e07, 0x1e1008, 0x1d1007, 0x1e1007, 0x1c0f06, 0x180d04, 0x150c03, 0x120a03, 0x110903, 0x100903, 0x0e0804, 0x0c0704, 0x0b0703, 0x0b0602, 0x0b0602, 0x0a0702, 0x090702, 0x090702, 0x090702, 0x090601, 0x070601, 0x080601, 0x090601, 0x080400, 0x070400, 0x070401, 0x080401, 0x070401, 0x070401, 0x080300, 0x090401, 0x090501, 0x090601, 0x0a0501, 0x0a0501, 0x0a0501, 0x0c0502, 0x0d0503, 0x0d0603, 0x0e0803, 0x0d0802, 0x0a0802, 0x090601, 0x080500, 0x070401, 0x070300, 0x060300, 0x040301, 0x040301, 0x030301, 0x030301, 0x020300, 0x030300, 0x030201, 0x020200, 0x020200, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000001, 0x000000, 0x010101, 0x010101, 0x020200, 0x020200, 0x020200, 0x020100, 0x030200, 0x030200, 0x030300, 0x050400, 0x050400, 0x050300, 0x060200, 0x060200, 0x060200, 0x060300, 0x060300, 0x070300, 0x060300, 0x060300, 0x060300, 0x050400, 0x050400, 0x050400, 0x050400, 0x040500, 0x040500, 0x050500, 0x050400, 0x050400, 0x060400, 0x070500, 0x080500, 0x090500, 0x090501, 0x080501, 0x080501, 0x090502, 0x0a0602, 0x0b0602, 0x0a0601, 0x0a0702, 0x0a0702, 0x0b0702, 0x0b0803, 0x0c0802, 0x0f0902, 0x120a03, 0x130a05, 0x170c05, 0x1e1007, 0x241409, 0x231308, 0x1c0e05, 0x160b04, 0x120a04, 0x120905, 0x110a04, 0x120b04, 0x110a04, 0x120b04, 0x120b05, 0x120b05, 0x130c06, 0x130c06, 0x130c06, 0x130c05, 0x130c04, 0x150d06, 0x150b05, 0x160b05, 0x1a0d06, 0x1c0f07, 0x1f1108, 0x22130a, 0x23140a, 0x241409, 0x241408, 0x251508, 0x271609, 0x2a180a, 0x2a180a, 0x291709, 0x271507, 0x271507, 0x281608, 0x281609, 0x291709, 0x281609, 0x261509, 0x221308, 0x1e1007, 0x1b0f06, 0x180d05, 0x160b05, 0x150c05, 0x140b05, 0x130a05, 0x130a05, 0x130b05, 0x130a04, 0x140a03, 0x0f0702, 0x0f0a06, 0x100b07, 0x110a04, 0x120a03, 0x120b04, 0x120b05, 0x120b05, 0x130b05, 0x120a04, 0x140b04, 0x170d04, 0x1e1007, 0x211207, 0x1e1007, 0x190d04, 0x170c05, 0x140b04, 0x140b04, 0x130a03, 0x130a03, 0x140b04, 0x140b04, 0x160d04, 0x180e05, 0x1b0f06, 0x1e1008, 0x1f1108, 0x1f1208, 0x1f1108, 0x1d0f07, 0x190e06, 0x160c04, 0x130a03, 0x120a03, 0x110a04, 0x100805, 0x0d0804, 0x0c0703, 0x0b0602, 0x0c0803, 0x0b0703, 0x0a0602, 0x0a0601, 0x0a0602, 0x0a0501, 0x090601, 0x090601, 0x0a0702, 0x080601, 0x080401, 0x080401, 0x080501, 0x080401, 0x080401, 0x090402, 0x0a0502, 0x0b0602, 0x0b0602, 0x0b0702, 0x0c0703, 0x0e0803, 0x0f0702, 0x0f0803, 0x110905, 0x100a03, 0x0e0902, 0x0b0802, 0x090601, 0x080500, 0x080401, 0x070300, 0x070301, 0x060401, 0x050300, 0x050400, 0x040400, 0x030400, 0x030400, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x030200, 0x050400, 0x060300, 0x070300, 0x070300, 0x080300, 0x080300, 0x080300, 0x070300, 0x080300, 0x070300, 0x070300, 0x080401, 0x080401, 0x070400, 0x050500, 0x050500, 0x050500, 0x050500, 0x050500, 0x050501, 0x060401, 0x070401, 0x070400, 0x070500, 0x080500, 0x090500, 0x090501, 0x090500, 0x090601, 0x090601, 0x090601, 0x0a0702, 0x0a0601, 0x0b0602, 0x0a0602, 0x0b0803, 0x0b0803, 0x0c0803, 0x0e0903, 0x110a02, 0x120b03, 0x140b06, 0x170b05, 0x1e1006, 0x261508, 0x271609, 0x211107, 0x190d04, 0x150b05, 0x140a05, 0x130a04, 0x130a03, 0x130a03, 0x130b04, 0x140b04, 0x140b05, 0x140b05, 0x150c06, 0x150c06, 0x130d05, 0x140d05, 0x150d06, 0x150c03, 0x180e05, 0x1b0f06, 0x1c0f07, 0x1f1208, 0x231409, 0x251508, 0x261507, 0x261607, 0x271507, 0x291608, 0x2c190b, 0x2d1a0c, 0x2b180a, 0x291709, 0x291709, 0x2a180a, 0x2a190a, 0x2a180a, 0x291709, 0x271508, 0x231307, 0x1f1106, 0x1b0e05, 0x180d04, 0x170d04, 0x160c04, 0x150b04, 0x140b04, 0x140b06, 0x140b06, 0x140a05, 0x1a0d05, 0x352417, 0x27170a, 0x120902, 0x130c06, 0x130b05, 0x130b04, 0x140b04, 0x140b04, 0x150b04, 0x140a04, 0x160c03, 0x1a0e05, 0x211108, 0x231208, 0x1f1108, 0x1a0d04, 0x180d04, 0x150c04, 0x140b04, 0x140b03, 0x140b04, 0x150c04, 0x160d05, 0x170e04, 0x1b1107, 0x1f1108, 0x221208, 0x24140a, 0x241409, 0x231309, 0x1f1008, 0x1a0e06, 0x160c04, 0x140a03, 0x120903, 0x100903, 0x0f0804, 0x0e0803, 0x0c0703, 0x0c0703, 0x0b0603, 0x0c0703, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0702, 0x090702, 0x090601, 0x0a0601, 0x090702, 0x0a0702, 0x0a0702, 0x0b0703, 0x0b0602, 0x0b0602, 0x0d0702, 0x0f0903, 0x110a04, 0x120b05, 0x120a04, 0x130a04, 0x130b05, 0x120b03, 0x0e0a02, 0x0c0803, 0x0a0702, 0x080500, 0x080401, 0x070300, 0x080401, 0x080401, 0x070401, 0x060400, 0x050400, 0x050300, 0x050400, 0x040400, 0x030401, 0x030301, 0x030301, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020200, 0x020200, 0x020200, 0x030200, 0x030200, 0x020200, 0x030301, 0x050400, 0x050400, 0x070300, 0x080401, 0x090401, 0x090401, 0x090401, 0x080300, 0x090401, 0x080401, 0x070300, 0x080401, 0x080401, 0x070401, 0x070401, 0x070401, 0x070401, 0x070401, 0x060401, 0x070401, 0x080401, 0x080401, 0x080401, 0x090501, 0x0a0501, 0x0a0501, 0x0a0501, 0x0a0602, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0c0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0c0803, 0x0d0802, 0x100902, 0x120a02, 0x120b03, 0x140c05, 0x180d05, 0x1f1006, 0x271509, 0x2b180b, 0x271508, 0x1e1006, 0x180d05, 0x150b05, 0x130a05, 0x130a05, 0x140b06, 0x140b06, 0x150c06, 0x140b04, 0x150c05, 0x150c05, 0x150c05, 0x150d05, 0x150c05, 0x160c04, 0x180c04, 0x1a0f06, 0x1b0f06, 0x1d1007, 0x201309, 0x231409, 0x27160a, 0x271609, 0x281608, 0x2a1709, 0x2b190b, 0x2f1c0d, 0x301d0f, 0x2e1b0c, 0x2b180a, 0x2b190a, 0x2c1a0a, 0x2e1c0c, 0x2e1c0c, 0x2b190a, 0x291709, 0x251507, 0x201208, 0x1c0f07, 0x190d05, 0x170d04, 0x160c03, 0x160c03, 0x150b03, 0x160b04, 0x150c07, 0x140b05, 0x1b0d05, 0x3e2c1d, 0x2d1c0e, 0x120802, 0x140d07, 0x150c05, 0x150c04, 0x160d05, 0x160c04, 0x160c04, 0x170c05, 0x180d05, 0x1d1007, 0x241309, 0x241307, 0x201108, 0x1c0f06, 0x190d04, 0x160d04, 0x150c04, 0x160c03, 0x160c03, 0x170d04, 0x170d05, 0x190f05, 0x1d1107, 0x201207, 0x251408, 0x261509, 0x261509, 0x251309, 0x201108, 0x1b0f06, 0x170d05, 0x150a04, 0x130904, 0x120904, 0x100904, 0x0e0802, 0x0d0803, 0x0c0703, 0x0c0704, 0x0b0804, 0x0b0803, 0x0b0703, 0x0a0702, 0x0b0702, 0x0b0702, 0x0b0602, 0x0a0602, 0x0a0601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0703, 0x0c0804, 0x0f0904, 0x120a04, 0x120b05, 0x120a05, 0x130a03, 0x140b03, 0x140b02, 0x140b04, 0x120b03, 0x100a02, 0x0d0803, 0x0b0703, 0x090601, 0x080401, 0x080401, 0x080401, 0x080401, 0x080301, 0x080401, 0x080401, 0x070300, 0x060300, 0x050400, 0x040400, 0x030301, 0x030401, 0x030300, 0x030300, 0x020300, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000001, 0x000001, 0x010101, 0x000000, 0x010101, 0x020201, 0x020200, 0x020200, 0x030200, 0x020200, 0x030200, 0x020200, 0x020200, 0x030301, 0x040401, 0x050300, 0x070300, 0x090401, 0x0b0502, 0x0a0502, 0x090502, 0x090502, 0x090502, 0x080401, 0x090401, 0x090502, 0x090502, 0x090502, 0x080401, 0x080401, 0x080401, 0x080401, 0x070300, 0x080401, 0x080401, 0x080401, 0x090401, 0x090501, 0x090501, 0x0a0602, 0x0a0602, 0x0a0702, 0x0a0702, 0x0b0803, 0x0b0803, 0x0b0702, 0x0c0501, 0x0b0602, 0x0c0702, 0x0c0702, 0x0c0802, 0x0e0902, 0x110903, 0x130a04, 0x130b04, 0x150c04, 0x190d05, 0x201007, 0x27150a, 0x2d190b, 0x2b1609, 0x231308, 0x1a0e05, 0x160c05, 0x150b06, 0x160a05, 0x160b05, 0x150c07, 0x140c06, 0x150c05, 0x160c06, 0x160d05, 0x160d05, 0x170d06, 0x170c05, 0x180d04, 0x1b0e06, 0x1d1008, 0x1c0e06, 0x1e1108, 0x211309, 0x25150a, 0x29170b, 0x29170a, 0x2a180a, 0x2b180a, 0x2d1a0c, 0x311e0f, 0x332010, 0x311e0e, 0x2e1b0c, 0x2d1a0c, 0x2f1c0d, 0x301d0e, 0x2f1c0d, 0x2f1b0c, 0x2b190a, 0x271608, 0x221308, 0x1e1109, 0x1c0f06, 0x1f1107, 0x1f1208, 0x180d04, 0x160c04, 0x170c04, 0x150c06, 0x150b06, 0x160b04, 0x150901, 0x150b04, 0x150d07, 0x160c07, 0x170c04, 0x170d04, 0x170d04, 0x180d04, 0x180d04, 0x180d04, 0x1a0e06, 0x201109, 0x26150b, 0x261408, 0x221208, 0x1e0f07, 0x1b0e06, 0x180d05, 0x160d05, 0x160d04, 0x170d04, 0x180e05, 0x180e06, 0x1c1007, 0x211209, 0x231408, 0x261609, 0x28160a, 0x281609, 0x261409, 0x211108, 0x1c0f07, 0x190e06, 0x160b04, 0x140b04, 0x130a04, 0x110a04, 0x0f0902, 0x0e0903, 0x0d0804, 0x0c0804, 0x0b0804, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0804, 0x0b0703, 0x0a0602, 0x0b0603, 0x0c0603, 0x0a0602, 0x0a0702, 0x0a0702, 0x0b0803, 0x0c0803, 0x0d0903, 0x100a04, 0x120a04, 0x130a04, 0x140a05, 0x150b05, 0x160b05, 0x180d04, 0x160c03, 0x140a04, 0x130b03, 0x100a03, 0x0d0904, 0x0c0804, 0x0a0702, 0x090501, 0x090502, 0x080401, 0x080401, 0x090401, 0x080401, 0x070300, 0x080300, 0x070300, 0x060300, 0x050400, 0x040400, 0x030300, 0x030400, 0x020400, 0x020400, 0x020300, 0x020200, 0x020200, 0x020100, 0x020100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010102, 0x010102, 0x000000, 0x000000, 0x010101, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x020200, 0x030301, 0x030400, 0x040301, 0x060300, 0x070300, 0x090401, 0x0b0502, 0x0b0502, 0x0b0602, 0x0a0502, 0x0a0603, 0x0a0602, 0x0a0602, 0x0a0502, 0x0a0502, 0x0a0602, 0x090602, 0x090501, 0x090501, 0x080500, 0x080401, 0x080401, 0x080401, 0x080401, 0x090502, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0b0803, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0603, 0x0c0703, 0x0c0703, 0x0c0802, 0x0d0903, 0x0e0903, 0x100b05, 0x120b05, 0x140b06, 0x160b05, 0x190c05, 0x1f1007, 0x251408, 0x2d180a, 0x2e180b, 0x261509, 0x1d0f05, 0x190e05, 0x190c05, 0x180b04, 0x180b04, 0x170c03, 0x110500, 0x160c03, 0x170d05, 0x170d04, 0x180d04, 0x170d05, 0x170d04, 0x180e05, 0x1a0e06, 0x1c0e06, 0x1e0f08, 0x1f1209, 0x221409, 0x26160a, 0x29170a, 0x2a180a, 0x2b190a, 0x2d1a0b, 0x2e1b0c, 0x331f10, 0x362110, 0x341f0d, 0x301d0d, 0x2f1c0d, 0x301d0e, 0x311e0f, 0x311d0c, 0x301c0b, 0x2d1a0c, 0x291709, 0x251508, 0x201208, 0x1d1006, 0x25150b, 0x27160c, 0x1b0f05, 0x160d05, 0x170c06, 0x160b05, 0x170c06, 0x160b06, 0x170c05, 0x180d05, 0x170d04, 0x170d04, 0x170d05, 0x180e05, 0x180f06, 0x180d05, 0x190c04, 0x190d05, 0x1c0f07, 0x23130a, 0x28160b, 0x261508, 0x221108, 0x1f1007, 0x1b0e06, 0x180d06, 0x170c05, 0x170d04, 0x180e05, 0x190e05, 0x1a0f06, 0x1f1108, 0x241309, 0x251509, 0x271509, 0x291608, 0x281608, 0x261408, 0x221208, 0x1d0e07, 0x1b0d06, 0x170c03, 0x150b03, 0x140b04, 0x120a03, 0x100903, 0x0f0903, 0x0e0a04, 0x0b0904, 0x0b0903, 0x0c0904, 0x0b0803, 0x0b0803, 0x0b0704, 0x0b0804, 0x0b0704, 0x0b0704, 0x0b0703, 0x0b0703, 0x0c0803, 0x0d0904, 0x0d0904, 0x0e0904, 0x110a02, 0x130b03, 0x140a03, 0x150b02, 0x160b04, 0x170b05, 0x1a0c05, 0x1b0e06, 0x170d04, 0x150a04, 0x120a03, 0x0f0a05, 0x0d0a05, 0x0c0904, 0x0b0803, 0x090601, 0x090502, 0x090502, 0x090401, 0x090401, 0x090301, 0x090401, 0x090401, 0x080300, 0x070300, 0x060400, 0x050400, 0x050300, 0x040400, 0x020400, 0x030400, 0x030300, 0x030301, 0x030200, 0x030200, 0x020100, 0x020200, 0x020200, 0x010100, 0x000000, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x030200, 0x020200, 0x010100, 0x020200, 0x030301, 0x030301, 0x030400, 0x030400, 0x050300, 0x070300, 0x080401, 0x0a0502, 0x0b0602, 0x0c0703, 0x0c0804, 0x0c0703, 0x0b0601, 0x0a0701, 0x0b0802, 0x0a0703, 0x0a0603, 0x0a0603, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0602, 0x0a0602, 0x0a0502, 0x0a0602, 0x0a0602, 0x0a0702, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0804, 0x0b0803, 0x0c0703, 0x0c0703, 0x0c0703, 0x0c0704, 0x0c0703, 0x0c0703, 0x0d0804, 0x0e0904, 0x0f0a04, 0x120b05, 0x130b06, 0x140b06, 0x160c06, 0x190d06, 0x1e0f07, 0x231206, 0x2b180a, 0x311c0e, 0x2c180b, 0x231206, 0x1e0f05, 0x1b0d05, 0x170d07, 0x160c05, 0x1e0d01, 0x47342a, 0x23140a, 0x150c02, 0x160e04, 0x190e05, 0x180d06, 0x180e05, 0x1b0e06, 0x1c0f07, 0x1d0f07, 0x1f1008, 0x211309, 0x241509, 0x28170b, 0x2a180a, 0x2b190b, 0x2d1a0b, 0x2e1b0b, 0x301c0c, 0x35200f, 0x392210, 0x37200e, 0x362110, 0x321e0f, 0x311e0e, 0x341f0f, 0x35200f, 0x341f0f, 0x301c0e, 0x2c1a0b, 0x281709, 0x24140a, 0x201409, 0x201207, 0x201107, 0x1d1007, 0x1a0f07, 0x180e06, 0x180d05, 0x180d05, 0x170d05, 0x170d04, 0x180e04, 0x180e05, 0x190f06, 0x190e05, 0x1b0f06, 0x1b0e06, 0x1c0f07, 0x1c0f07, 0x1c0f07, 0x1f1107, 0x27150a, 0x29160a, 0x261509, 0x221208, 0x1f1007, 0x1c0e06, 0x1a0f06, 0x180e06, 0x1a0f06, 0x1b0f06, 0x1c0f06, 0x1e1108, 0x231308, 0x261509, 0x28160a, 0x2a180a, 0x2b180a, 0x291709, 0x261409, 0x211208, 0x1d0f07, 0x1b0d05, 0x180d05, 0x160c03, 0x150b03, 0x130a03, 0x120a04, 0x110a04, 0x0f0a04, 0x0e0903, 0x0d0903, 0x0e0a04, 0x0d0904, 0x0d0804, 0x0c0904, 0x0c0904, 0x0c0904, 0x0c0904, 0x0c0803, 0x0e0903, 0x0e0903, 0x0f0903, 0x100a04, 0x110a04, 0x130b03, 0x140b04, 0x160c03, 0x170c04, 0x180d05, 0x1b0e06, 0x1d0f07, 0x1c0f07, 0x180e05, 0x150c05, 0x130b04, 0x100a04, 0x0d0903, 0x0b0903, 0x0b0803, 0x0b0803, 0x0a0702, 0x090502, 0x090501, 0x090501, 0x080500, 0x090501, 0x090502, 0x090502, 0x080401, 0x070401, 0x060501, 0x070401, 0x050400, 0x050400, 0x040300, 0x040300, 0x040301, 0x040301, 0x050401, 0x030200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x030200, 0x030200, 0x020100, 0x020200, 0x030301, 0x030301, 0x030300, 0x040400, 0x040400, 0x060300, 0x070300, 0x080400, 0x090601, 0x0b0702, 0x0d0804, 0x0f0904, 0x100903, 0x0e0801, 0x0c0801, 0x0c0902, 0x0b0803, 0x0b0703, 0x0b0703, 0x0b0702, 0x0b0702, 0x0b0703, 0x0b0703, 0x0b0702, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0703, 0x0c0803, 0x0b0703, 0x0b0703, 0x0b0802, 0x0c0902, 0x0c0702, 0x0d0803, 0x0d0803, 0x0e0803, 0x0f0904, 0x0f0905, 0x100906, 0x100a05, 0x110b05, 0x120b05, 0x130b06, 0x140b06, 0x150b04, 0x180d05, 0x1d0f07, 0x221207, 0x2b180a, 0x341d0f, 0x321b0c, 0x2b1608, 0x231206, 0x1d0f05, 0x1a1007, 0x190e06, 0x1f0e02, 0x433127, 0x231309, 0x170c03, 0x170e05, 0x180d05, 0x1a0d06, 0x1a0e06, 0x1b0e06, 0x1d1008, 0x22140b, 0x201109, 0x221309, 0x26160a, 0x2a170a, 0x2c190b, 0x2d1a0c, 0x2e1b0c, 0x301d0c, 0x331f0d, 0x38210f, 0x3c2410, 0x3c230f, 0x3a2310, 0x36210f, 0x35200f, 0x372110, 0x362010, 0x362010, 0x331d0f, 0x2f1b0c, 0x2a180a, 0x261509, 0x221409, 0x201308, 0x1f1108, 0x1d1008, 0x1c0f07, 0x1a0f06, 0x1a0e05, 0x1a0e05, 0x190e05, 0x190f05, 0x190f06, 0x180e05, 0x1a1007, 0x1b1008, 0x1e1007, 0x1f1108, 0x1d1007, 0x1d1008, 0x1d1007, 0x221207, 0x2b170a, 0x2c180a, 0x261609, 0x221408, 0x1f1107, 0x1d0f07, 0x1c0f07, 0x1c0f07, 0x1d0f07, 0x1e1007, 0x1f1108, 0x221309, 0x261409, 0x28160a, 0x2b180b, 0x2d190b, 0x2e190b, 0x2a1709, 0x271509, 0x211208, 0x1e0f08, 0x1c0e06, 0x190d04, 0x170d04, 0x160c03, 0x140b02, 0x120b03, 0x120b03, 0x110a04, 0x110904, 0x0f0902, 0x0f0902, 0x0f0903, 0x0f0903, 0x0f0904, 0x0e0903, 0x0e0903, 0x0f0903, 0x0f0903, 0x100903, 0x110a02, 0x110903, 0x120a03, 0x130a04, 0x140b04, 0x150b03, 0x170c03, 0x190d05, 0x1c0f06, 0x201208, 0x201209, 0x1c1007, 0x180e04, 0x150c03, 0x120b03, 0x100a03, 0x0d0802, 0x0d0902, 0x0b0802, 0x0b0803, 0x0a0702, 0x090601, 0x0a0702, 0x090601, 0x090601, 0x080500, 0x080501, 0x080401, 0x080401, 0x080401, 0x080401, 0x080501, 0x080501, 0x070400, 0x060400, 0x050400, 0x040300, 0x040300, 0x040400, 0x040400, 0x030301, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x040200, 0x030200, 0x020100, 0x020300, 0x030401, 0x030200, 0x040300, 0x050400, 0x050400, 0x070300, 0x070300, 0x080500, 0x090601, 0x0a0602, 0x0c0703, 0x100a04, 0x120b03, 0x120a02, 0x100a04, 0x0f0a04, 0x0e0903, 0x0d0802, 0x0c0802, 0x0c0703, 0x0c0702, 0x0c0702, 0x0c0803, 0x0c0703, 0x0c0703, 0x0c0703, 0x0b0602, 0x0c0703, 0x0c0703, 0x0d0804, 0x0c0703, 0x0d0804, 0x0c0903, 0x0c0902, 0x0d0802, 0x0e0903, 0x0f0903, 0x110a02, 0x110a03, 0x110a04, 0x110a04, 0x120b05, 0x120b05, 0x120b05, 0x140b06, 0x140a05, 0x150c03, 0x190e05, 0x1c0f07, 0x211208, 0x2a170a, 0x351d0f, 0x391f0e, 0x321a0b, 0x281508, 0x201207, 0x1d1004, 0x1c0f04, 0x190d04, 0x100600, 0x170d03, 0x1a0e06, 0x1b0e08, 0x1b0e06, 0x1b0e07, 0x1c0f07, 0x1c0e07, 0x1d0f07, 0x201209, 0x1f1108, 0x23150a, 0x28170a, 0x2b180a, 0x2e1a0c, 0x2f1c0d, 0x301d0d, 0x34200f, 0x36210f, 0x3b230f, 0x3f2510, 0x3f2510, 0x3c2410, 0x392210, 0x382110, 0x382111, 0x392212, 0x392112, 0x36200f, 0x311d0c, 0x2c1a0b, 0x29170a, 0x241509, 0x211409, 0x1f120a, 0x1f1009, 0x1e1007, 0x1d0f07, 0x1c0f06, 0x1c0f06, 0x1d1007, 0x1c1007, 0x1b1007, 0x1a0f06, 0x1b1108, 0x1c1007, 0x22120a, 0x2d1f16, 0x1e1007, 0x1e1007, 0x1f1107, 0x261508, 0x2e190b, 0x2d180b, 0x27160a, 0x23150a, 0x201207, 0x1e1008, 0x1d1008, 0x1d0f08, 0x1e1008, 0x1f1008, 0x221208, 0x25140a, 0x28160a, 0x2b190b, 0x2e1b0c, 0x311b0d, 0x2f1a0c, 0x2a170a, 0x27150a, 0x221309, 0x1e0f08, 0x1d0f07, 0x1b0e05, 0x180d04, 0x170d04, 0x150c03, 0x140b04, 0x130a03, 0x130a04, 0x130a05, 0x120b03, 0x120a02, 0x120b03, 0x120b05, 0x120b05, 0x110a04, 0x110a04, 0x120a05, 0x120a05, 0x120903, 0x120902, 0x130a03, 0x140a04, 0x160b05, 0x160c03, 0x170d04, 0x1a0d05, 0x1e1008, 0x201208, 0x231409, 0x22130a, 0x1d1007, 0x190f05, 0x150c03, 0x120b02, 0x100a02, 0x0e0903, 0x0d0902, 0x0c0902, 0x0b0802, 0x0b0803, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x090602, 0x090502, 0x090502, 0x090502, 0x080401, 0x090601, 0x090500, 0x090400, 0x070500, 0x050400, 0x050400, 0x050300, 0x040400, 0x030500, 0x040400, 0x030400, 0x030300, 0x030400, 0x020300, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x030200, 0x040300, 0x030300, 0x030301, 0x050400, 0x050400, 0x070300, 0x080400, 0x080500, 0x090601, 0x090601, 0x0a0702, 0x0c0802, 0x100a03, 0x130a04, 0x140a03, 0x140b03, 0x120b04, 0x110b05, 0x0f0a04, 0x0e0a03, 0x0f0903, 0x0f0903, 0x0f0903, 0x0f0903, 0x0f0903, 0x0e0802, 0x0c0702, 0x0c0703, 0x0c0703, 0x0d0805, 0x0c0804, 0x0b0703, 0x0c0803, 0x0b0803, 0x0d0804, 0x0f0a04, 0x110904, 0x110904, 0x110a04, 0x130a03, 0x120b03, 0x0e0903, 0x0e0903, 0x130b04, 0x130b04, 0x150a04, 0x150a04, 0x150c05, 0x180e07, 0x1c1008, 0x201107, 0x291609, 0x351d0d, 0x3c200f, 0x381d0c, 0x2e1809, 0x251406, 0x1e1104, 0x1c0f06, 0x190e05, 0x180f06, 0x1a0e06, 0x1b0e06, 0x1b0e06, 0x1c0e06, 0x1c0d06, 0x1d0e07, 0x1d0f06, 0x1e1008, 0x1f1108, 0x201209, 0x25140a, 0x28170a, 0x2b180b, 0x2d1a0c, 0x301d0d, 0x32200d, 0x362310, 0x38220f, 0x3e2410, 0x432712, 0x422612, 0x3f2411, 0x3c230f, 0x3b220f, 0x3c2310, 0x3d2212, 0x3c2211, 0x38210f, 0x341f0e, 0x2e1c0c, 0x2b1a0a, 0x271809, 0x231608, 0x201309, 0x1f1209, 0x1f1108, 0x1f1108, 0x1e1108, 0x1d1007, 0x1c1007, 0x1c1108, 0x201105, 0x1f1005, 0x1b110a, 0x1e1008, 0x1e1008, 0x20120a, 0x201209, 0x211209, 0x211208, 0x29180a, 0x311b0d, 0x2f1a0b, 0x281609, 0x251609, 0x211308, 0x1f1209, 0x1e1108, 0x1f1109, 0x1f100a, 0x211209, 0x251509, 0x281609, 0x2a180a, 0x2f1a0c, 0x331c0c, 0x331d0d, 0x321b0c, 0x2d180b, 0x271609, 0x221308, 0x1e1107, 0x1d1007, 0x1b0e05, 0x190d04, 0x170d04, 0x150c04, 0x150c05, 0x140b04, 0x150c05, 0x140b04, 0x130b04, 0x130a03, 0x130b04, 0x130a04, 0x130a04, 0x130a03, 0x130a04, 0x130b04, 0x130b04, 0x130b04, 0x140b04, 0x140b04, 0x150c04, 0x160d04, 0x180e05, 0x180e05, 0x1c0f07, 0x24130a, 0x261409, 0x251409, 0x211309, 0x1b1006, 0x180e05, 0x150c04, 0x130b03, 0x110a02, 0x100a02, 0x0f0901, 0x0f0902, 0x0d0802, 0x0c0802, 0x0c0702, 0x0b0803, 0x0a0702, 0x0a0702, 0x080702, 0x090602, 0x090602, 0x090602, 0x0a0702, 0x090602, 0x070601, 0x090601, 0x090601, 0x080500, 0x080400, 0x080401, 0x080401, 0x070401, 0x040300, 0x030302, 0x030301, 0x030301, 0x020300, 0x020300, 0x020201, 0x020200, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x020202, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030300, 0x040300, 0x030200, 0x030301, 0x040400, 0x040300, 0x070300, 0x070400, 0x090601, 0x0a0702, 0x0a0702, 0x0b0803, 0x0c0903, 0x100a03, 0x140a04, 0x150a03, 0x140b03, 0x140b04, 0x140c05, 0x120c05, 0x110b05, 0x120b05, 0x110a04, 0x110a04, 0x110a04, 0x110a04, 0x110a04, 0x0f0903, 0x0e0803, 0x0d0804, 0x0d0804, 0x0d0803, 0x0d0903, 0x0d0a03, 0x0f0a05, 0x100905, 0x110a04, 0x120b05, 0x120a04, 0x120b05, 0x110b06, 0x120904, 0x23150b, 0x23150d, 0x130802, 0x140a03, 0x160b05, 0x150a04, 0x150c05, 0x180d07, 0x1c0f08, 0x211107, 0x281609, 0x331c0c, 0x3f2210, 0x3f2210, 0x341c0b, 0x2a1608, 0x211306, 0x1f1007, 0x1c0d05, 0x1b0e06, 0x1c0f07, 0x1b0e06, 0x1c0e07, 0x1d0e07, 0x1d0e07, 0x1d0e07, 0x1e1007, 0x1e1007, 0x1f1108, 0x22130a, 0x27150b, 0x2a180b, 0x2c1a0c, 0x2e1c0e, 0x321f0f, 0x35210e, 0x37210e, 0x392210, 0x402612, 0x462914, 0x462914, 0x422612, 0x3f2410, 0x3f2511, 0x3f2411, 0x402512, 0x3e2311, 0x3b2111, 0x372110, 0x311e0e, 0x2c1b0b, 0x2a190a, 0x261709, 0x22150a, 0x21130a, 0x21130a, 0x201209, 0x1f1209, 0x1f1209, 0x1f1209, 0x1e0f06, 0x322013, 0x312013, 0x1d1007, 0x201107, 0x1f1108, 0x1f1108, 0x1e1108, 0x1f120a, 0x23150b, 0x2c190c, 0x341d0e, 0x311b0c, 0x29170a, 0x261608, 0x231408, 0x211309, 0x201309, 0x1f1209, 0x21130b, 0x23150b, 0x28160a, 0x2c180a, 0x2f1a0d, 0x331c0d, 0x371e0d, 0x361d0d, 0x331b0c, 0x2f190c, 0x28170a, 0x221408, 0x201208, 0x1e1107, 0x1c0f06, 0x1a0e05, 0x180e05, 0x160d05, 0x160d06, 0x160d06, 0x150c06, 0x160d06, 0x150c05, 0x150b05, 0x150c05, 0x150c05, 0x150b05, 0x140b04, 0x140b04, 0x140b04, 0x140c04, 0x140b04, 0x150c05, 0x160d04, 0x170e05, 0x190f06, 0x1b0f07, 0x1c1007, 0x22130a, 0x28150c, 0x29160b, 0x26150a, 0x201208, 0x1b1007, 0x170e05, 0x150c05, 0x140b04, 0x120b03, 0x120b03, 0x110a02, 0x110a02, 0x0f0903, 0x0d0802, 0x0c0802, 0x0c0803, 0x0c0904, 0x0c0904, 0x0a0803, 0x090802, 0x090803, 0x090702, 0x090702, 0x090803, 0x080702, 0x080601, 0x080500, 0x080500, 0x090501, 0x080401, 0x070300, 0x080401, 0x060400, 0x040301, 0x030301, 0x030302, 0x030401, 0x030400, 0x030301, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030300, 0x040300, 0x040301, 0x040401, 0x040400, 0x050400, 0x070300, 0x080500, 0x0a0601, 0x0a0702, 0x0b0803, 0x0b0803, 0x0c0802, 0x100903, 0x130a03, 0x150a03, 0x160c03, 0x160c04, 0x140b03, 0x140b04, 0x130b04, 0x130a04, 0x120a04, 0x130a04, 0x130a04, 0x120a03, 0x120a03, 0x120a03, 0x110a04, 0x100a04, 0x100a03, 0x0f0a02, 0x0e0a01, 0x0e0a01, 0x100a03, 0x110a04, 0x110a04, 0x110a03, 0x100b02, 0x120b03, 0x110c08, 0x120904, 0x2f1d13, 0x2f1d14, 0x120601, 0x150903, 0x150a05, 0x150b05, 0x160d04, 0x180e05, 0x1d1007, 0x211208, 0x271608, 0x321a0b, 0x3f2210, 0x432512, 0x3a1e0c, 0x2e1808, 0x251407, 0x28170e, 0x2c1a13, 0x1c0e06, 0x1c1007, 0x1d1008, 0x1e0f08, 0x1e0f08, 0x1d1008, 0x1d1008, 0x1d1007, 0x1d1007, 0x1f1108, 0x221309, 0x27160b, 0x2b190c, 0x2d1b0d, 0x301e0f, 0x362111, 0x3a2110, 0x3c2110, 0x3c2211, 0x422712, 0x492b16, 0x4a2b16, 0x482915, 0x422610, 0x412510, 0x422611, 0x432613, 0x422412, 0x3e2211, 0x3a2111, 0x341f0f, 0x2e1b0d, 0x2a1909, 0x271709, 0x24170b, 0x22150a, 0x221409, 0x201309, 0x201309, 0x211309, 0x211309, 0x211309, 0x27170c, 0x261608, 0x1f1005, 0x21140c, 0x22140a, 0x211409, 0x1f1107, 0x1f1209, 0x27170c, 0x301c0d, 0x361e0e, 0x321b0c, 0x2a1709, 0x261607, 0x241408, 0x211308, 0x201308, 0x201408, 0x221409, 0x25160a, 0x2a170a, 0x2f190b, 0x331c0d, 0x371e0d, 0x3a1f0e, 0x391f0e, 0x361c0e, 0x2e180a, 0x291709, 0x241508, 0x211308, 0x1f1208, 0x1d1007, 0x1a0f05, 0x180e05, 0x170e05, 0x160d05, 0x160d05, 0x150c04, 0x150c04, 0x160b04, 0x160b05, 0x160b05, 0x150a04, 0x160b04, 0x160c04, 0x160d05, 0x170d05, 0x170d05, 0x170d05, 0x180e05, 0x1a0e05, 0x1a0f06, 0x1c0f06, 0x1d0f07, 0x221309, 0x27160c, 0x2b190e, 0x29160b, 0x25140a, 0x1f1107, 0x1b1006, 0x170d04, 0x150c03, 0x130a03, 0x130a03, 0x130a03, 0x120a03, 0x110a03, 0x110a04, 0x100a04, 0x0e0903, 0x0d0802, 0x0d0802, 0x0c0902, 0x0c0902, 0x0b0903, 0x0a0904, 0x090802, 0x090802, 0x080702, 0x080702, 0x090702, 0x090601, 0x090601, 0x090602, 0x090601, 0x080500, 0x080500, 0x080500, 0x060401, 0x040300, 0x030300, 0x030401, 0x030400, 0x040501, 0x030300, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x020201, 0x030300, 0x040300, 0x040301, 0x040402, 0x050400, 0x050400, 0x080401, 0x090400, 0x0b0602, 0x0c0703, 0x0c0703, 0x0c0804, 0x0b0802, 0x100a03, 0x130a03, 0x150a03, 0x170d03, 0x190e05, 0x180d04, 0x170c04, 0x170c05, 0x150c05, 0x140b04, 0x150b05, 0x140a04, 0x140b03, 0x140b03, 0x150c05, 0x140b04, 0x120a03, 0x110a02, 0x100a02, 0x0e0a02, 0x0f0b03, 0x100b04, 0x110b05, 0x120b04, 0x120b03, 0x130b03, 0x130b02, 0x140c04, 0x150b04, 0x160901, 0x140801, 0x150a04, 0x150b04, 0x160b05, 0x160c05, 0x170e05, 0x190e06, 0x1f1008, 0x251509, 0x281609, 0x321b0c, 0x3f210f, 0x452611, 0x3f220e, 0x331a0a, 0x291608, 0x28160b, 0x27160c, 0x1d1006, 0x1e1109, 0x1f1209, 0x201209, 0x201209, 0x1f1009, 0x1e1008, 0x1f1108, 0x1f1108, 0x1f1108, 0x221409, 0x29170b, 0x2b190b, 0x2e1e0e, 0x321f0f, 0x3b2311, 0x422714, 0x3d230f, 0x3d2310, 0x442713, 0x4b2b16, 0x4e2d17, 0x512f1a, 0x472813, 0x442712, 0x462813, 0x472814, 0x472814, 0x432512, 0x3e2310, 0x37200f, 0x311e0e, 0x2f1c0d, 0x2e1d0f, 0x25170b, 0x24170b, 0x23150a, 0x22160a, 0x23150a, 0x24160b, 0x24160b, 0x25160c, 0x22140b, 0x2a190b, 0x352213, 0x231309, 0x211409, 0x221307, 0x302015, 0x322216, 0x2a1708, 0x351f0f, 0x3a200f, 0x341d0c, 0x2b1809, 0x281808, 0x261608, 0x241509, 0x221508, 0x241609, 0x2b1a0d, 0x281709, 0x2c1a0b, 0x311c0e, 0x371e0e, 0x3c210f, 0x3e220f, 0x3a1f0e, 0x371e0e, 0x30190b, 0x291709, 0x251608, 0x221409, 0x1f1209, 0x1e1108, 0x1b1006, 0x190f06, 0x180f06, 0x180f05, 0x180e05, 0x170d04, 0x180e05, 0x170d04, 0x170d04, 0x170d04, 0x170d04, 0x160d04, 0x170d04, 0x180e05, 0x1a0e06, 0x1b0e06, 0x1c0f07, 0x1c0f06, 0x1d0f06, 0x1f1107, 0x201208, 0x231408, 0x28170a, 0x2c190c, 0x2e1b0c, 0x29170a, 0x25140a, 0x201107, 0x1a0f06, 0x170d04, 0x160c03, 0x150b02, 0x140b03, 0x130a03, 0x130a03, 0x120a03, 0x110a04, 0x120a05, 0x110a04, 0x0e0903, 0x0e0903, 0x0d0902, 0x0c0902, 0x0d0902, 0x0c0902, 0x0d0903, 0x0c0902, 0x0c0802, 0x080702, 0x090702, 0x0a0702, 0x0a0702, 0x090601, 0x080601, 0x0a0702, 0x090601, 0x080501, 0x070501, 0x050400, 0x040400, 0x040401, 0x030301, 0x030400, 0x030400, 0x020200, 0x030301, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x020201, 0x010101, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010200, 0x020200, 0x030401, 0x030301, 0x040300, 0x040401, 0x040501, 0x050400, 0x070401, 0x080401, 0x0a0501, 0x0b0703, 0x0c0803, 0x0d0804, 0x0d0804, 0x0d0903, 0x0f0a03, 0x120a03, 0x140a03, 0x180c03, 0x1b0e05, 0x1c0f07, 0x1b0e06, 0x1a0d05, 0x170d05, 0x160c04, 0x160c05, 0x160c05, 0x160c04, 0x160c04, 0x160c05, 0x150c05, 0x140b05, 0x140b03, 0x120b03, 0x100b04, 0x110b04, 0x110b05, 0x110b05, 0x120b04, 0x130a03, 0x140a03, 0x130a02, 0x150b03, 0x150c04, 0x130c06, 0x130c05, 0x130b03, 0x140b04, 0x160c05, 0x170c06, 0x190f06, 0x1b0f07, 0x201109, 0x251409, 0x28160a, 0x311a0c, 0x40200f, 0x482712, 0x452612, 0x3b1f0f, 0x2f1a0c, 0x27150a, 0x231308, 0x211308, 0x231309, 0x211208, 0x211208, 0x211209, 0x21110a, 0x201109, 0x1f1108, 0x201007, 0x200f05, 0x231409, 0x29180b, 0x2d1b0d, 0x332010, 0x37200e, 0x432815, 0x4a2c19, 0x3f230d, 0x402611, 0x462914, 0x4d2d16, 0x543119, 0x56331c, 0x4a2a13, 0x492914, 0x4a2a15, 0x4b2a16, 0x4b2a15, 0x462812, 0x412510, 0x3a220f, 0x352010, 0x311e0f, 0x2f1e0f, 0x281a0d, 0x27180d, 0x25170b, 0x24170b, 0x24160b, 0x25170c, 0x27170d, 0x29180c, 0x241305, 0x443124, 0x634d3d, 0x240d00, 0x25150b, 0x261408, 0x2d1e11, 0x301f12, 0x2d1a0c, 0x372010, 0x3b200f, 0x341c0c, 0x2d190b, 0x29180a, 0x281809, 0x27170a, 0x271709, 0x2a180a, 0x342113, 0x2b190b, 0x2f1c0c, 0x351e0d, 0x3b200f, 0x402311, 0x3f2210, 0x3c200f, 0x381d0e, 0x31190c, 0x2a1709, 0x261508, 0x231509, 0x21130a, 0x20130a, 0x1d1107, 0x1a1007, 0x1a1007, 0x1a0f06, 0x1a0f06, 0x1a0f06, 0x1a0f05, 0x1a0f06, 0x1a0f06, 0x1a0f06, 0x1a0f07, 0x1a0f06, 0x1a0f06, 0x1b0f06, 0x1c0f06, 0x1d0f07, 0x1d1007, 0x1e1109, 0x1f1108, 0x211307, 0x241508, 0x29180a, 0x2e1b0c, 0x311c0d, 0x2e1b0b, 0x29170a, 0x241309, 0x1d1006, 0x190f05, 0x170d04, 0x170d04, 0x170d04, 0x160c04, 0x140b03, 0x140b03, 0x130a03, 0x120a04, 0x110a04, 0x110a04, 0x100a04, 0x0f0a04, 0x0f0a04, 0x0e0a03, 0x0e0903, 0x0d0803, 0x0d0802, 0x0d0803, 0x0d0803, 0x0b0803, 0x0b0703, 0x0a0702, 0x0a0702, 0x0a0702, 0x090702, 0x090702, 0x0a0702, 0x090601, 0x080601, 0x070501, 0x050300, 0x050501, 0x040401, 0x030401, 0x030400, 0x030401, 0x030301, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020300, 0x030400, 0x030400, 0x030301, 0x040402, 0x040401, 0x040400, 0x060400, 0x080401, 0x090502, 0x0a0502, 0x090803, 0x0b0904, 0x0c0804, 0x0f0804, 0x0f0903, 0x0f0a02, 0x110b02, 0x130a03, 0x190c04, 0x1c0f06, 0x1e1108, 0x1e1007, 0x1c0e05, 0x1a0e05, 0x190e04, 0x170d04, 0x170d04, 0x170d04, 0x150b04, 0x150b04, 0x140b05, 0x150c05, 0x150c03, 0x140c04, 0x130c04, 0x120b03, 0x130a03, 0x140b04, 0x140b04, 0x140a04, 0x150a04, 0x140b04, 0x140b04, 0x150c05, 0x160b05, 0x150b04, 0x150c03, 0x150c05, 0x170b06, 0x170c06, 0x190f06, 0x1d1008, 0x22110a, 0x241209, 0x271609, 0x301a0c, 0x3c1f0d, 0x492712, 0x4b2913, 0x422311, 0x341b0d, 0x2a180c, 0x27150a, 0x281609, 0x2b190c, 0x28160a, 0x25140a, 0x221308, 0x21130a, 0x20120a, 0x1e0f07, 0x302016, 0x38281d, 0x241308, 0x29190b, 0x2f1d0d, 0x382310, 0x38210e, 0x4d311f, 0x5a3a27, 0x44240e, 0x432813, 0x4a2c16, 0x513016, 0x59351b, 0x5b371d, 0x4f2e15, 0x4d2d16, 0x4f2d17, 0x512e18, 0x502e16, 0x482b14, 0x432813, 0x3d2312, 0x382112, 0x321e0f, 0x2b1a0b, 0x2c1a0e, 0x2a1a0d, 0x28180b, 0x27190d, 0x27190d, 0x28180d, 0x29180d, 0x2d1d0f, 0x2c1b0c, 0x2a1709, 0x2a1809, 0x2a180a, 0x311d10, 0x362216, 0x241407, 0x27170b, 0x321d10, 0x392111, 0x3a200f, 0x351d0d, 0x2f1a0d, 0x2b190c, 0x2a180c, 0x29180d, 0x29180d, 0x29180a, 0x2c1a0c, 0x2e1c0e, 0x331d0f, 0x3a1f0f, 0x3f2310, 0x432613, 0x422512, 0x3e2211, 0x391e0f, 0x351e0f, 0x2f1b0d, 0x271508, 0x241509, 0x211408, 0x201208, 0x1e1108, 0x1d1008, 0x1d1008, 0x1c0f06, 0x1d0f07, 0x1d1007, 0x1d0f07, 0x1c0f07, 0x1d1007, 0x1d1008, 0x1d1007, 0x1d1007, 0x1d1008, 0x1d1008, 0x1e1008, 0x1f1108, 0x1f1208, 0x1f1209, 0x211309, 0x251508, 0x291809, 0x2f1a0c, 0x341d0e, 0x341d0e, 0x2f1b0d, 0x28170b, 0x211308, 0x1d1006, 0x1a0f05, 0x180e05, 0x180e05, 0x180e05, 0x170d04, 0x160c03, 0x140b02, 0x130c03, 0x130c04, 0x130b03, 0x120a03, 0x120a03, 0x110a03, 0x110a03, 0x110a02, 0x0f0903, 0x0d0804, 0x0d0805, 0x0d0905, 0x0d0805, 0x0c0704, 0x0d0804, 0x0c0804, 0x0b0803, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0702, 0x090601, 0x0a0601, 0x080401, 0x060400, 0x040300, 0x030400, 0x040402, 0x030301, 0x030301, 0x030301, 0x030301, 0x020200, 0x010101, 0x010101, 0x010101, 0x020200, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x020202, 0x020201, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x030300, 0x040400, 0x030300, 0x030300, 0x040301, 0x050401, 0x050400, 0x050400, 0x080401, 0x090502, 0x0a0602, 0x0a0803, 0x0c0904, 0x0f0904, 0x120a04, 0x120b03, 0x120b03, 0x130a03, 0x130a02, 0x180c04, 0x1c0e06, 0x201209, 0x22130a, 0x201108, 0x1d1007, 0x1c0f07, 0x1b0e06, 0x1a0e06, 0x190e05, 0x170e04, 0x160e05, 0x160d06, 0x160d05, 0x160d04, 0x150d04, 0x140d05, 0x140d05, 0x140d05, 0x140d05, 0x140d05, 0x140d05, 0x140d05, 0x150c05, 0x160d06, 0x160c05, 0x160b05, 0x160c04, 0x160c03, 0x160c04, 0x170c05, 0x180d05, 0x1b0f06, 0x1e1008, 0x221209, 0x251309, 0x2a170a, 0x311b0b, 0x371f0b, 0x442611, 0x4f2b17, 0x492815, 0x3a1e0d, 0x301a0c, 0x2b180a, 0x2a180a, 0x2c1a0c, 0x2a180c, 0x27160b, 0x24140a, 0x20130a, 0x20130b, 0x21140a, 0x29190e, 0x2d1c11, 0x29170d, 0x2c1b0d, 0x321e0f, 0x3b2414, 0x3f2714, 0x412510, 0x482912, 0x51321b, 0x4b2d16, 0x4d2e18, 0x54311a, 0x5a351b, 0x5a351b, 0x553218, 0x523018, 0x532f19, 0x55311a, 0x543118, 0x4f2e16, 0x492b14, 0x432713, 0x3d2413, 0x382112, 0x321e10, 0x2f1c10, 0x2e1b10, 0x2c1b0e, 0x2b1b0e, 0x2a1a0d, 0x2a190b, 0x2b1a0d, 0x2b1b0c, 0x2b1b0c, 0x2c1a0c, 0x2c1a0c, 0x2c1a0c, 0x321e10, 0x382315, 0x2a1909, 0x2c1a0b, 0x372010, 0x3e2413, 0x3c220f, 0x382010, 0x341f11, 0x301a0c, 0x2d190d, 0x2c190d, 0x2e1708, 0x2e180a, 0x2e1b0d, 0x351c0b, 0x371e0d, 0x382112, 0x402514, 0x452814, 0x452612, 0x402310, 0x391f0d, 0x382211, 0x342010, 0x281708, 0x261708, 0x241508, 0x221408, 0x211309, 0x1f1209, 0x1f1209, 0x1f1108, 0x1e1108, 0x1f1108, 0x201209, 0x1f1108, 0x1f1108, 0x1f1208, 0x1f1209, 0x1f1209, 0x1f1209, 0x1f1208, 0x201308, 0x211409, 0x231408, 0x251509, 0x27160b, 0x2a170b, 0x2f1b0d, 0x351f0f, 0x382111, 0x341e0f, 0x2d190b, 0x26160a, 0x201207, 0x1e1007, 0x1c0e05, 0x1b0d06, 0x180e05, 0x180e05, 0x180e05, 0x180e05, 0x160c03, 0x150c03, 0x150c04, 0x140b04, 0x140b04, 0x130c02, 0x120b02, 0x120b01, 0x120a01, 0x100a02, 0x100a04, 0x0f0904, 0x0f0905, 0x0f0805, 0x0d0804, 0x0e0905, 0x0d0804, 0x0c0904, 0x0b0803, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0702, 0x090601, 0x080500, 0x070501, 0x050401, 0x050400, 0x040501, 0x040400, 0x030401, 0x030400, 0x030301, 0x020200, 0x020200, 0x010101, 0x010101, 0x020200, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x030301, 0x030400, 0x040301, 0x040301, 0x040300, 0x050400, 0x050400, 0x050400, 0x050400, 0x080401, 0x080502, 0x0a0602, 0x0a0802, 0x0d0903, 0x100904, 0x130a04, 0x150b04, 0x150b05, 0x140b03, 0x140b02, 0x170b03, 0x1b0d05, 0x1f1108, 0x23130a, 0x24130a, 0x211208, 0x1f1007, 0x1e1007, 0x1e1008, 0x1c0f06, 0x1a0f05, 0x180e05, 0x180f06, 0x170e05, 0x170d04, 0x170d04, 0x160d04, 0x150d05, 0x140c05, 0x140d05, 0x150e06, 0x150e06, 0x140d05, 0x150c05, 0x140b04, 0x150b05, 0x160b05, 0x160c04, 0x170d03, 0x170d03, 0x190d04, 0x1b0e06, 0x1d1007, 0x201108, 0x23120a, 0x27160a, 0x2a170c, 0x2e190e, 0x351c0b, 0x3e1c07, 0x4f2916, 0x512b16, 0x462611, 0x3a1f0d, 0x321c0c, 0x2c190a, 0x2b180a, 0x2b190b, 0x28170b, 0x26150a, 0x28170a, 0x28180c, 0x26170b, 0x27180b, 0x29170a, 0x2c190d, 0x301d0f, 0x342010, 0x3b2313, 0x422815, 0x442813, 0x4b2c16, 0x523118, 0x553219, 0x533118, 0x59341b, 0x60371e, 0x61391d, 0x5d361a, 0x5a3419, 0x5a331a, 0x5d361c, 0x5c351a, 0x553117, 0x4e2e16, 0x482b15, 0x422713, 0x3d2413, 0x392214, 0x341e11, 0x321d11, 0x2f1d0f, 0x2f1d0f, 0x2d1b0d, 0x39271a, 0x2e1b0c, 0x301e0f, 0x2d1c0c, 0x2e1e0e, 0x2f1d0e, 0x2f1c0d, 0x2f1d0f, 0x2d1a0c, 0x2e1d0f, 0x301e10, 0x3c2212, 0x422611, 0x3d2210, 0x361f0e, 0x341e0f, 0x311c0f, 0x2d1a0d, 0x2b1200, 0x684531, 0x65432f, 0x2c0e00, 0x6c4f3c, 0x593b28, 0x3c1e08, 0x442612, 0x492a15, 0x472814, 0x402410, 0x381f0d, 0x331d0c, 0x2e1b0b, 0x2a180a, 0x28180a, 0x271609, 0x241407, 0x231308, 0x211208, 0x211309, 0x211308, 0x201207, 0x201208, 0x201208, 0x211309, 0x221309, 0x211308, 0x211208, 0x211309, 0x221409, 0x241409, 0x241509, 0x251609, 0x261608, 0x291608, 0x2c180a, 0x301a0c, 0x381f10, 0x3d2210, 0x392110, 0x321d0e, 0x2b180a, 0x261509, 0x221208, 0x201108, 0x1e1007, 0x1d0e07, 0x190f06, 0x180e05, 0x190f06, 0x190f06, 0x170d05, 0x160d04, 0x150c03, 0x150c04, 0x140b04, 0x130c02, 0x120b01, 0x120b01, 0x120b01, 0x120b02, 0x110a03, 0x110903, 0x110a04, 0x100904, 0x0e0904, 0x0e0904, 0x0d0803, 0x0c0903, 0x0c0903, 0x0b0803, 0x0b0803, 0x0a0703, 0x0a0702, 0x090601, 0x080500, 0x070500, 0x060500, 0x050401, 0x040400, 0x050501, 0x040401, 0x030300, 0x030301, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010100, 0x020201, 0x030301, 0x030400, 0x030301, 0x040301, 0x040300, 0x050400, 0x060400, 0x070300, 0x070401, 0x060501, 0x070602, 0x090702, 0x0b0802, 0x0d0902, 0x120a05, 0x140a04, 0x150b05, 0x170b04, 0x170c03, 0x150c03, 0x180c04, 0x1a0d05, 0x1f1007, 0x241209, 0x27150b, 0x261508, 0x241308, 0x231308, 0x211207, 0x1f1107, 0x1d1007, 0x1c0f05, 0x1b0f06, 0x1b0f06, 0x1b0f06, 0x1b0d06, 0x1a0d05, 0x180e05, 0x160c05, 0x160c06, 0x160d06, 0x160d06, 0x150d06, 0x150c05, 0x150d06, 0x150c05, 0x170c06, 0x170d05, 0x170d04, 0x180d04, 0x1c0f05, 0x1c0f05, 0x1c0c03, 0x200f07, 0x25140b, 0x261408, 0x261609, 0x2a170a, 0x3c1e0d, 0x644330, 0x532c13, 0x592f16, 0x532d16, 0x462411, 0x3b1f0e, 0x321c0d, 0x2d1a0c, 0x2a180a, 0x29180c, 0x251306, 0x493425, 0x483425, 0x291506, 0x2b190c, 0x2e1b0e, 0x321d0e, 0x33200f, 0x372210, 0x3d2613, 0x442814, 0x492b16, 0x502f19, 0x5b351d, 0x5f381e, 0x5b361b, 0x62381f, 0x673b21, 0x693c1e, 0x653b1c, 0x63381b, 0x64381d, 0x6b3f22, 0x6a3f22, 0x5c361b, 0x553219, 0x4d2e17, 0x472b16, 0x422714, 0x3e2413, 0x3a2213, 0x382213, 0x382314, 0x332012, 0x301d0f, 0x342113, 0x362211, 0x3b2617, 0x311c0e, 0x311e0f, 0x341f11, 0x361f11, 0x351f10, 0x3b2415, 0x392414, 0x392010, 0x452615, 0x482a14, 0x3e2310, 0x3a2212, 0x341f0e, 0x321c0d, 0x2e1c0e, 0x2f1b0b, 0x4e2e1c, 0x4e2d1b, 0x391e0d, 0x472a16, 0x482812, 0x54321c, 0x593822, 0x4a2912, 0x472812, 0x3f2511, 0x372110, 0x321d0d, 0x2e1a0c, 0x2c190c, 0x2a190d, 0x271608, 0x261508, 0x251508, 0x241309, 0x241409, 0x241409, 0x251409, 0x251409, 0x241409, 0x241409, 0x25150a, 0x25150a, 0x25150a, 0x251509, 0x261609, 0x28160a, 0x29170a, 0x291709, 0x2b180a, 0x2d190b, 0x321b0d, 0x381e0f, 0x402411, 0x402410, 0x392010, 0x301c0e, 0x2a1709, 0x28150a, 0x251309, 0x221109, 0x201109, 0x1d0f08, 0x1a1007, 0x1a1007, 0x1a1007, 0x190f06, 0x180f05, 0x170f05, 0x170e05, 0x160d04, 0x160d04, 0x150c05, 0x140c04, 0x140b04, 0x140b04, 0x130b03, 0x130a03, 0x130a03, 0x120904, 0x120904, 0x0f0a04, 0x0e0903, 0x0e0903, 0x0d0a03, 0x0d0a03, 0x0c0905, 0x0b0803, 0x0a0702, 0x0a0702, 0x080700, 0x070601, 0x070500, 0x080500, 0x070501, 0x050402, 0x050402, 0x040301, 0x030201, 0x030400, 0x020300, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000100, 0x010100, 0x020200, 0x020100, 0x010100, 0x010100, 0x010101, 0x010100, 0x010100, 0x010200, 0x020300, 0x030400, 0x040301, 0x030200, 0x050201, 0x040300, 0x040500, 0x040400, 0x060400, 0x080401, 0x080401, 0x080401, 0x080502, 0x090701, 0x0c0903, 0x0e0904, 0x120b04, 0x140b03, 0x150b03, 0x170d04, 0x180d04, 0x190d04, 0x190c05, 0x1a0d05, 0x1d1007, 0x221209, 0x27150a, 0x29170b, 0x281609, 0x261408, 0x241309, 0x231408, 0x211207, 0x1e1006, 0x1d1007, 0x1d1007, 0x1c0f06, 0x1c0e05, 0x1b0e05, 0x1a0e06, 0x1a0d05, 0x190c05, 0x180c04, 0x170b04, 0x180c06, 0x160c06, 0x160c06, 0x170c06, 0x170c06, 0x180d06, 0x1a0e06, 0x1c0f06, 0x1c1005, 0x1b0c02, 0x3b291b, 0x352516, 0x211009, 0x241408, 0x27160a, 0x2a1608, 0x3d2210, 0x765642, 0x593016, 0x653619, 0x64341a, 0x512913, 0x422411, 0x391e0f, 0x321c0e, 0x2e190c, 0x2c190d, 0x2c190c, 0x392013, 0x3b2215, 0x301b0d, 0x301d0f, 0x331e10, 0x37200f, 0x392310, 0x3c2510, 0x412712, 0x482a16, 0x4f2e18, 0x57321a, 0x61371e, 0x64381e, 0x64391e, 0x6a3c1f, 0x714021, 0x744022, 0x6f3e1f, 0x6c3d1d, 0x6b3d1d, 0x704121, 0x6c3f1f, 0x653b1d, 0x5d361b, 0x553319, 0x4d2f16, 0x492b13, 0x422713, 0x3f2514, 0x3d2512, 0x392414, 0x372213, 0x372212, 0x352010, 0x372212, 0x36210f, 0x3a2412, 0x3b2412, 0x402716, 0x432919, 0x36200f, 0x3a2212, 0x392312, 0x3c2311, 0x4a2b16, 0x4c2b16, 0x422612, 0x392211, 0x342010, 0x331e0d, 0x321e0f, 0x321e10, 0x331c0d, 0x371e0c, 0x3d2311, 0x462815, 0x4b2a15, 0x523019, 0x53321d, 0x4d2b15, 0x482a13, 0x3e2411, 0x372111, 0x341e0e, 0x301c0d, 0x2d1a0c, 0x2b180b, 0x29160a, 0x28160a, 0x27160a, 0x27170a, 0x27170a, 0x28160a, 0x28160a, 0x28170a, 0x27170a, 0x271608, 0x271608, 0x271608, 0x281709, 0x291709, 0x2a170a, 0x2b180a, 0x2c190a, 0x2d1a0c, 0x2f1a0c, 0x331c0e, 0x391f0f, 0x3f2311, 0x432712, 0x3f2510, 0x361d0d, 0x2f1a0d, 0x2a170b, 0x29160a, 0x27140a, 0x231209, 0x211209, 0x1e1108, 0x1d1108, 0x1b1007, 0x1a1007, 0x1a1007, 0x190f06, 0x180f06, 0x190f06, 0x180f06, 0x180e05, 0x170d05, 0x160d05, 0x150c05, 0x150b06, 0x150b05, 0x140b04, 0x140b04, 0x140b04, 0x130a05, 0x110a05, 0x0f0903, 0x0d0803, 0x0d0804, 0x0d0904, 0x0d0a03, 0x0c0903, 0x0b0803, 0x0a0702, 0x080702, 0x070601, 0x070601, 0x080501, 0x080500, 0x070401, 0x050401, 0x040301, 0x030301, 0x030400, 0x030400, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010201, 0x010100, 0x020100, 0x020100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010100, 0x020300, 0x030400, 0x030400, 0x040301, 0x040201, 0x050201, 0x040400, 0x040500, 0x040500, 0x060400, 0x070300, 0x070300, 0x080401, 0x090502, 0x090701, 0x0b0803, 0x0d0803, 0x100a03, 0x140b03, 0x150c03, 0x170d04, 0x1a0e05, 0x1b0e06, 0x1b0d06, 0x1b0e06, 0x1c0f06, 0x201208, 0x26140a, 0x2a180b, 0x2c190b, 0x2a170a, 0x26150a, 0x26150a, 0x251409, 0x221209, 0x1f1108, 0x1d1007, 0x1e1007, 0x1e1008, 0x1e0f08, 0x1d0f08, 0x1d0f07, 0x1b0e06, 0x1b0e06, 0x1b0d06, 0x1a0d06, 0x180c06, 0x170c06, 0x170c06, 0x180d07, 0x1b0e07, 0x1d0f08, 0x1d1008, 0x1c0f07, 0x1a0a03, 0x413225, 0x3b2e20, 0x1c0d07, 0x241508, 0x27160b, 0x2c190e, 0x341c0c, 0x3d1900, 0x552c15, 0x69381d, 0x6a3719, 0x592f14, 0x482a10, 0x3e230d, 0x361e0e, 0x321d0e, 0x311e10, 0x321d0f, 0x341d0f, 0x341d0f, 0x361f10, 0x372011, 0x382010, 0x3c2312, 0x3f2713, 0x412813, 0x462a15, 0x4d2e18, 0x54321b, 0x5d361e, 0x663b21, 0x6c3e22, 0x6f3f21, 0x754322, 0x7b4725, 0x7f4726, 0x7b4625, 0x764421, 0x744221, 0x754322, 0x724221, 0x6c3e1e, 0x663c1d, 0x5d381c, 0x563419, 0x513016, 0x4a2c17, 0x452916, 0x442814, 0x3e2714, 0x3d2612, 0x3d2712, 0x3c2612, 0x3c2611, 0x3d2512, 0x422916, 0x432a16, 0x402613, 0x3e2413, 0x392413, 0x382413, 0x372512, 0x402611, 0x55301b, 0x58341d, 0x4a2915, 0x402413, 0x3a2212, 0x3a2413, 0x3e2718, 0x361f10, 0x382211, 0x3c2411, 0x432713, 0x4c2c17, 0x522f18, 0x543117, 0x533018, 0x533018, 0x4d2d15, 0x3f2411, 0x382112, 0x341f10, 0x2f1d0e, 0x2c1b0c, 0x2b190c, 0x2a180c, 0x2a180c, 0x2a180c, 0x2b190d, 0x2a190c, 0x2a180a, 0x29170a, 0x2a180b, 0x29180b, 0x29180a, 0x2a180a, 0x2a180a, 0x2b190a, 0x2c190b, 0x2c1a0c, 0x2e1b0d, 0x2f1c0e, 0x311d0f, 0x331e10, 0x392011, 0x412412, 0x472914, 0x452812, 0x3d230f, 0x361d0e, 0x301b0e, 0x2b180c, 0x29170b, 0x27160a, 0x251309, 0x22130a, 0x1f1108, 0x1e1108, 0x1d1007, 0x1b1107, 0x1a1007, 0x191007, 0x190f06, 0x190f06, 0x190f06, 0x190f06, 0x190f05, 0x170d04, 0x170d05, 0x160c06, 0x150b05, 0x140b04, 0x130a03, 0x140b04, 0x140b06, 0x120b05, 0x120b05, 0x0f0a04, 0x0e0905, 0x0d0904, 0x0d0a03, 0x0c0903, 0x0b0803, 0x0a0702, 0x090702, 0x080601, 0x080601, 0x080601, 0x080501, 0x080300, 0x060300, 0x040301, 0x040402, 0x030400, 0x030400, 0x030401, 0x020201, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x020100, 0x020100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010100, 0x030400, 0x030400, 0x020300, 0x030201, 0x040301, 0x050300, 0x040400, 0x040500, 0x050400, 0x070401, 0x080401, 0x080401, 0x090502, 0x090502, 0x090702, 0x0b0803, 0x0c0703, 0x100904, 0x130a03, 0x150b02, 0x170c04, 0x1b0e05, 0x1d0e05, 0x1e0e06, 0x1c0e06, 0x1c0f06, 0x1f1007, 0x241308, 0x29170b, 0x2e1a0d, 0x2e1a0c, 0x2a170a, 0x271509, 0x27140a, 0x25140a, 0x22130a, 0x201109, 0x1f1008, 0x1f1009, 0x1f1009, 0x1e0f08, 0x1e1008, 0x1d1007, 0x1b0f06, 0x1b0e06, 0x1b0e06, 0x1a0d05, 0x1a0d06, 0x1a0d05, 0x1b0e06, 0x1f0f08, 0x1f0f08, 0x1d1008, 0x1e1109, 0x1d0e05, 0x160700, 0x1a0e05, 0x21140c, 0x25160b, 0x271509, 0x2c180d, 0x361e10, 0x432411, 0x562d16, 0x68371b, 0x723e18, 0x643719, 0x4f2c18, 0x432612, 0x3b220f, 0x361f0e, 0x351f10, 0x36200f, 0x37200f, 0x382010, 0x3b2211, 0x3d2311, 0x3e2311, 0x412513, 0x432814, 0x462a15, 0x4c2c16, 0x523019, 0x5b361e, 0x633a1f, 0x6a3d20, 0x734221, 0x7a461f, 0x7f4a22, 0x854d25, 0x894e26, 0x864d26, 0x814a24, 0x87512d, 0x7f4925, 0x7d4724, 0x774420, 0x6f3f1e, 0x683d1e, 0x61391c, 0x5c361a, 0x54311a, 0x502e19, 0x4e2c16, 0x492b16, 0x452a15, 0x432813, 0x442814, 0x442813, 0x442814, 0x442713, 0x442913, 0x432914, 0x412715, 0x402714, 0x3f2916, 0x3f2a13, 0x4e2e17, 0x684029, 0x553018, 0x4a2912, 0x442712, 0x402612, 0x3f2512, 0x3e2513, 0x3a2110, 0x3d2311, 0x412612, 0x482a15, 0x522f19, 0x59331a, 0x5e361c, 0x5c3519, 0x583218, 0x4f2d16, 0x432714, 0x3a2213, 0x341f11, 0x2f1d0e, 0x2e1c0e, 0x2d1b0e, 0x2c190c, 0x2c190b, 0x2c190b, 0x2b190b, 0x2b190b, 0x2b190a, 0x2c1a0b, 0x2c1a0c, 0x2d190c, 0x2c190b, 0x2c1a0c, 0x2d1a0c, 0x2f1b0e, 0x301c0f, 0x301d0f, 0x321e0f, 0x331e0f, 0x362011, 0x3a2212, 0x402412, 0x4a2a15, 0x4c2b15, 0x442610, 0x3b210e, 0x351c0e, 0x301b0e, 0x2c190b, 0x29170a, 0x271509, 0x261509, 0x23140a, 0x21130a, 0x1e1108, 0x1e1108, 0x1d1007, 0x1b1007, 0x1b1007, 0x1b1008, 0x1a1007, 0x190f06, 0x180f06, 0x190f05, 0x1b0f05, 0x20130a, 0x190f05, 0x160b04, 0x150b04, 0x140b04, 0x140b05, 0x140b06, 0x130b04, 0x120b04, 0x110a05, 0x100a04, 0x0e0a04, 0x0d0902, 0x0c0903, 0x0c0904, 0x0a0803, 0x0b0702, 0x0a0702, 0x090601, 0x080601, 0x070501, 0x080401, 0x060200, 0x040300, 0x040301, 0x030300, 0x030400, 0x030300, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x030301, 0x030400, 0x030400, 0x020300, 0x040301, 0x040301, 0x040300, 0x040500, 0x040500, 0x060401, 0x080402, 0x080500, 0x080500, 0x080500, 0x090601, 0x090702, 0x0a0703, 0x0b0603, 0x0f0703, 0x130a04, 0x140b03, 0x190d04, 0x1d0f06, 0x201007, 0x221008, 0x201108, 0x1e1107, 0x201107, 0x241209, 0x27160a, 0x2f1a0c, 0x321c0d, 0x301a0b, 0x2c170a, 0x2a160a, 0x28160a, 0x26150a, 0x241309, 0x201209, 0x201208, 0x201209, 0x20110a, 0x1f1209, 0x1f1209, 0x1e1108, 0x1c0f06, 0x1c0e07, 0x1c0f06, 0x1c0f06, 0x1d1007, 0x1d1007, 0x201108, 0x1f1108, 0x1e1109, 0x1f1005, 0x322214, 0x332517, 0x1d0e08, 0x221609, 0x25160d, 0x321c0f, 0x3d2313, 0x3b200f, 0x462612, 0x562e16, 0x713d15, 0xc4925f, 0x895a32, 0x562d14, 0x4c2b13, 0x422711, 0x3d230f, 0x3c2210, 0x3d2410, 0x3d2411, 0x3f2513, 0x412613, 0x422713, 0x442814, 0x462914, 0x492b15, 0x4e2e16, 0x543018, 0x5b341b, 0x633a1f, 0x6b3e1f, 0x73421f, 0x834f29, 0xac764a, 0x8f5428, 0x94572b, 0x985a2c, 0x95592b, 0x905429, 0x995e36, 0x8b5028, 0x8a5029, 0x844b26, 0x7c4723, 0x744422, 0x6d4020, 0x673c1c, 0x5e371c, 0x5b351b, 0x633c22, 0x56331a, 0x4e2f18, 0x4c2d16, 0x4d2e17, 0x4e2f18, 0x4e2f17, 0x4e2f16, 0x4d2f16, 0x4c2e17, 0x492c17, 0x492d18, 0x492b17, 0x482a13, 0x543018, 0x5e351c, 0x5b341a, 0x56331a, 0x4b2d15, 0x452a13, 0x462914, 0x412612, 0x402612, 0x432712, 0x482a15, 0x4f2f19, 0x59331c, 0x60371c, 0x65391c, 0x64381c, 0x5b3218, 0x502d15, 0x452813, 0x3e2512, 0x372010, 0x321e0f, 0x301d0f, 0x2f1c0e, 0x2e1b0d, 0x2f1d0e, 0x2f1c0e, 0x2f1b0d, 0x311b0d, 0x321c0c, 0x2f1d0d, 0x2e1d0d, 0x2f1c0e, 0x2f1c0e, 0x2f1c0d, 0x301c0e, 0x331d10, 0x351f11, 0x35200f, 0x382110, 0x3b2210, 0x3e2311, 0x422611, 0x4b2a14, 0x532f18, 0x4d2b15, 0x402410, 0x3a200f, 0x351d0e, 0x301b0e, 0x2c190b, 0x2a180a, 0x29170a, 0x27160a, 0x24150a, 0x221409, 0x201209, 0x1f1209, 0x1e1108, 0x1e1109, 0x1e1008, 0x1d1008, 0x1b1008, 0x1a1007, 0x180f06, 0x190f06, 0x1e1007, 0x24150c, 0x1d1108, 0x180d05, 0x170b05, 0x160b05, 0x150c05, 0x150c07, 0x140b04, 0x130c04, 0x130c05, 0x120b05, 0x110a04, 0x0f0a04, 0x0d0904, 0x0c0904, 0x0c0904, 0x0b0602, 0x0b0703, 0x0a0702, 0x080601, 0x070500, 0x0a0501, 0x070300, 0x060300, 0x040400, 0x040400, 0x030400, 0x030300, 0x030301, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x020100, 0x020100, 0x010100, 0x000200, 0x010100, 0x010101, 0x020201, 0x030401, 0x030400, 0x030400, 0x030301, 0x040301, 0x040301, 0x040400, 0x040501, 0x060501, 0x070402, 0x080402, 0x080500, 0x080500, 0x080500, 0x090601, 0x0a0702, 0x0b0703, 0x0c0604, 0x0d0702, 0x120a04, 0x140b04, 0x180d04, 0x1e0f06, 0x211007, 0x231207, 0x231308, 0x211307, 0x211208, 0x23120a, 0x261509, 0x2d180a, 0x341d0d, 0x361e0e, 0x321b0b, 0x2e190a, 0x2c180a, 0x29160a, 0x271409, 0x231409, 0x231408, 0x221308, 0x211308, 0x201209, 0x21130a, 0x21130a, 0x1f1108, 0x1e0f07, 0x1e1007, 0x1e1007, 0x1e1108, 0x1e1108, 0x211207, 0x201309, 0x20130b, 0x211004, 0x3c2b1c, 0x3f2e1e, 0x200e06, 0x241708, 0x24140a, 0x402819, 0x583b28, 0x412410, 0x462510, 0x582e18, 0x703b1f, 0x925c32, 0x7e4822, 0x64361d, 0x542e15, 0x4a2a14, 0x452813, 0x442814, 0x442813, 0x432713, 0x442813, 0x442913, 0x452a14, 0x482b15, 0x4b2d15, 0x4f2f16, 0x553218, 0x5a351b, 0x63391e, 0x6b3f21, 0x734221, 0x7c4824, 0x875025, 0x975c2c, 0x985b29, 0x9f612f, 0xa3642f, 0xa36331, 0x9e5e2f, 0x98592b, 0x97592d, 0x96582d, 0x8e532a, 0x874e27, 0x804b26, 0x774623, 0x704220, 0x683c1e, 0x64391c, 0x693f21, 0x5e381b, 0x593719, 0x573518, 0x583618, 0x583618, 0x583519, 0x5a371c, 0x5b371c, 0x58331b, 0x55321b, 0x503017, 0x5c361f, 0x714a33, 0x5e351c, 0x63371c, 0x63381b, 0x5e371c, 0x553016, 0x512d14, 0x4e2e17, 0x472a16, 0x492d18, 0x4f311b, 0x4d2e19, 0x542f18, 0x5f341b, 0x663a21, 0x683a1d, 0x68371b, 0x65371a, 0x553018, 0x482b15, 0x452b15, 0x3e2514, 0x3d2817, 0x341f10, 0x341e10, 0x331d0f, 0x321e0e, 0x331e0f, 0x321c0d, 0x392212, 0x4c3423, 0x321f0e, 0x2f1d0e, 0x301d0f, 0x311e0f, 0x321d0e, 0x341e0f, 0x351f10, 0x372010, 0x3b210f, 0x3d2410, 0x402410, 0x462712, 0x4d2c15, 0x563119, 0x563118, 0x4b2b14, 0x3f2412, 0x3b2110, 0x361d0e, 0x311c0e, 0x2d1a0c, 0x2b190b, 0x29170a, 0x28170b, 0x24150a, 0x221509, 0x22140a, 0x201309, 0x1f1209, 0x1f1209, 0x1f1109, 0x1e1109, 0x1d1108, 0x1b1007, 0x190f06, 0x1a0f06, 0x1c0d06, 0x1e0d06, 0x1c0e07, 0x1b0e07, 0x190d06, 0x160b05, 0x150b05, 0x150b06, 0x140b04, 0x140c04, 0x140d06, 0x130c06, 0x110a04, 0x100a04, 0x0e0905, 0x0c0804, 0x0d0904, 0x0c0703, 0x0b0702, 0x0a0702, 0x090601, 0x080501, 0x080400, 0x080400, 0x070400, 0x040400, 0x040400, 0x030400, 0x030300, 0x030301, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x030201, 0x030400, 0x030400, 0x020300, 0x030200, 0x050401, 0x050400, 0x050400, 0x040401, 0x050401, 0x080401, 0x080401, 0x080401, 0x080401, 0x090601, 0x090601, 0x0a0701, 0x0a0702, 0x0b0603, 0x0b0603, 0x0c0702, 0x100903, 0x140b02, 0x170d04, 0x1c0f06, 0x211008, 0x221308, 0x251507, 0x251406, 0x241408, 0x221408, 0x251508, 0x2a170a, 0x331b0d, 0x3a1f0e, 0x381e0d, 0x351c0c, 0x311a0c, 0x2e180c, 0x2b160b, 0x28150a, 0x261408, 0x261408, 0x251407, 0x241409, 0x221309, 0x221309, 0x201308, 0x201208, 0x1f1208, 0x1f1209, 0x1f1109, 0x1f120a, 0x211308, 0x22140b, 0x23140d, 0x28150a, 0x251307, 0x231306, 0x25160b, 0x27180c, 0x2a190b, 0x2f190a, 0x3d2110, 0x402410, 0x462713, 0x572e16, 0x68371c, 0x753d1a, 0x844924, 0x804b2b, 0x623519, 0x573219, 0x513018, 0x4e2d14, 0x4b2b16, 0x4b2c17, 0x492b16, 0x492c15, 0x4d2e16, 0x513019, 0x543219, 0x59341a, 0x5f371c, 0x653a1e, 0x6c3f20, 0x754623, 0x7d4a26, 0x885029, 0x93582c, 0x9b5d2f, 0xa36430, 0xac6b36, 0xb47238, 0xb47236, 0xb06f34, 0xac6c33, 0xaa6832, 0xa96632, 0xa36230, 0x9b5b2d, 0x91552a, 0x864f27, 0x7c4924, 0x754422, 0x704120, 0x6c3f1e, 0x693e1e, 0x693e1e, 0x683d1e, 0x683d1e, 0x673d1e, 0x683f20, 0x683f20, 0x6b3f23, 0x653b1e, 0x613a1c, 0x6e4729, 0x693f20, 0x7b4f31, 0x764626, 0x6e3d1b, 0x845634, 0x6a3e1e, 0x6e4225, 0x6f4326, 0x5a351b, 0x4f2d17, 0x58341c, 0x5b361b, 0x543115, 0x7f5030, 0x7d4b29, 0x663b1e, 0x6b3d1e, 0x724122, 0x885837, 0x552f15, 0x482b18, 0x432710, 0x402713, 0x3e2615, 0x392112, 0x3a2213, 0x3a2112, 0x372010, 0x372110, 0x34200f, 0x382210, 0x3f2815, 0x36210e, 0x34200f, 0x342011, 0x362012, 0x362012, 0x392212, 0x3a2211, 0x3d2311, 0x3f2412, 0x402612, 0x462914, 0x502c16, 0x5c321b, 0x5f351d, 0x543017, 0x472812, 0x3f2411, 0x3c2110, 0x371e0e, 0x321d0e, 0x2f1c0d, 0x2d1b0e, 0x2b190d, 0x2a190c, 0x27170a, 0x241609, 0x231509, 0x221509, 0x221409, 0x221409, 0x201208, 0x1f1209, 0x1f1108, 0x1d1007, 0x1d1007, 0x1d1007, 0x1d1008, 0x1e0f08, 0x1d0e07, 0x1b0e06, 0x180e05, 0x170d04, 0x160b05, 0x160b05, 0x150b05, 0x140b04, 0x130c05, 0x130c06, 0x110b05, 0x0f0a04, 0x0e0905, 0x0f0805, 0x0f0704, 0x0c0803, 0x090803, 0x080702, 0x0a0702, 0x090601, 0x070601, 0x080500, 0x080401, 0x050400, 0x040500, 0x030400, 0x030401, 0x040301, 0x030301, 0x020200, 0x010100, 0x010101, 0x020101, 0x010100, 0x010100, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x020100, 0x020100, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030301, 0x030301, 0x030400, 0x030400, 0x020200, 0x040301, 0x050401, 0x050400, 0x050400, 0x050501, 0x060400, 0x080401, 0x080401, 0x070500, 0x090601, 0x090601, 0x0a0702, 0x0a0702, 0x0b0602, 0x0b0703, 0x0b0603, 0x0d0702, 0x110903, 0x140b03, 0x160c03, 0x1b0d05, 0x1f1008, 0x211308, 0x251508, 0x281608, 0x271609, 0x261508, 0x261507, 0x291609, 0x30190a, 0x391e0d, 0x3c200f, 0x3b1f0f, 0x371d0d, 0x321b0c, 0x2f1a0c, 0x2d180b, 0x2a160a, 0x28160a, 0x271509, 0x27150a, 0x26150a, 0x251509, 0x241509, 0x231409, 0x23140b, 0x231107, 0x231007, 0x21130a, 0x21130c, 0x21130c, 0x241204, 0x392212, 0x382316, 0x2b190d, 0x2a190b, 0x2b1a0c, 0x2f1c0d, 0x331f10, 0x382111, 0x3f2412, 0x482a16, 0x552e15, 0x65371b, 0x77411f, 0x8a4e28, 0x894e2a, 0x743f1e, 0x663a1d, 0x5d3619, 0x5a3214, 0x553015, 0x52301a, 0x52311a, 0x523118, 0x56341a, 0x5b361b, 0x62391e, 0x673b1f, 0x6e3f20, 0x744221, 0x7b4823, 0x854e25, 0x8e522a, 0x985a2f, 0xa26231, 0xad6d34, 0xb77739, 0xbd7c3c, 0xc2823c, 0xc58940, 0xc58a42, 0xbf803a, 0xbf7b39, 0xc07a3b, 0xba7335, 0xb26b33, 0xa76433, 0x995a2d, 0x8b5128, 0x844c26, 0x7e4721, 0x7b4522, 0x7b4723, 0x794721, 0x784722, 0x784724, 0x774824, 0x754724, 0x734522, 0x744421, 0x744621, 0x6f431d, 0x855836, 0x794a26, 0x74431e, 0x7b4a25, 0x7a4822, 0x7f4d27, 0x73411e, 0x7e4d2e, 0x804f30, 0x61351b, 0x583015, 0x774d2e, 0x6d4123, 0x623313, 0x8d5834, 0x8f5834, 0x714021, 0x703f20, 0x6b3e1e, 0x663d1d, 0x533017, 0x492c18, 0x472912, 0x432711, 0x3e2411, 0x3e2414, 0x3e2413, 0x3e2313, 0x3d2313, 0x392212, 0x382211, 0x382211, 0x382110, 0x382312, 0x382211, 0x3a2211, 0x3a2311, 0x3a2212, 0x3d2412, 0x3e2412, 0x412613, 0x422715, 0x482a17, 0x512d18, 0x5d331b, 0x65381d, 0x5f361a, 0x502e14, 0x452813, 0x402613, 0x3d2312, 0x381f0f, 0x341e10, 0x311d0f, 0x2e1c0d, 0x2c1a0b, 0x2b190c, 0x29180c, 0x28170a, 0x27170a, 0x25160a, 0x25150a, 0x231409, 0x22140a, 0x201209, 0x201209, 0x201208, 0x201209, 0x1f1209, 0x1f1209, 0x1f1108, 0x1e0f08, 0x1c0f07, 0x180e05, 0x180e05, 0x180d05, 0x170c06, 0x160d06, 0x140b04, 0x140b05, 0x120b05, 0x110b05, 0x0f0a04, 0x100a04, 0x100905, 0x0f0704, 0x0d0804, 0x0b0803, 0x090803, 0x0a0702, 0x0a0702, 0x090702, 0x090601, 0x080501, 0x070401, 0x050500, 0x040400, 0x040401, 0x040301, 0x030300, 0x020200, 0x010100, 0x010100, 0x010100, 0x020100, 0x010100, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x020100, 0x030200, 0x020100, 0x020100, 0x010100, 0x000000, 0x010100, 0x030301, 0x030400, 0x020300, 0x030301, 0x020200, 0x030300, 0x050400, 0x050400, 0x050400, 0x050400, 0x050500, 0x070401, 0x080401, 0x080601, 0x080702, 0x070601, 0x090702, 0x0a0702, 0x0b0702, 0x0b0602, 0x0b0603, 0x0d0603, 0x0e0602, 0x110903, 0x130a03, 0x150b03, 0x1a0d05, 0x1d0f07, 0x211308, 0x261508, 0x2a180a, 0x2c180a, 0x2b170a, 0x291708, 0x291709, 0x2e180a, 0x361c0d, 0x3d2010, 0x3f210f, 0x3e200d, 0x371d0b, 0x351d0e, 0x321b0d, 0x2e180b, 0x2b170a, 0x29160a, 0x281609, 0x281609, 0x281609, 0x281609, 0x261508, 0x261204, 0x462f21, 0x442c1e, 0x251104, 0x22120a, 0x1d0d04, 0x3e2e1f, 0x533e2d, 0x2c1505, 0x2d1b0d, 0x321e10, 0x331e0f, 0x341e0e, 0x362111, 0x3b2211, 0x422512, 0x492916, 0x542e15, 0x64371b, 0x794220, 0x905128, 0x97562a, 0x8a4d21, 0x7a441f, 0x6f3e1a, 0x7c4c2a, 0x704325, 0x5e351a, 0x5e371c, 0x5f371b, 0x633a1d, 0x663c1f, 0x6e4322, 0x744522, 0x7c4922, 0x834d24, 0x8d5229, 0xa06334, 0xa96736, 0xab6936, 0xad6c33, 0xc08240, 0xca8c46, 0xbe8139, 0xc4873b, 0xd49e50, 0xcf974d, 0xbf823a, 0xbb7936, 0xbb7936, 0xbb7c35, 0xad6e2a, 0xab6e30, 0xa56c30, 0xa26b32, 0x9b642a, 0x9c6730, 0x996530, 0x8e5821, 0x935b25, 0x8f5623, 0x894e1b, 0x8d5321, 0x834b1e, 0x7f481f, 0x844b24, 0x874e28, 0x854e28, 0x854e24, 0x875128, 0x885129, 0x875028, 0x865027, 0x7f4b23, 0x794621, 0x76431f, 0x7e4b28, 0x6b3d1f, 0x643b1d, 0x693d1a, 0x6d3e1c, 0x824e2a, 0x92562c, 0x8a4e26, 0x7f4825, 0x7a4826, 0x6c3f1f, 0x5e3819, 0x55331a, 0x502f1a, 0x52331c, 0x51311b, 0x452813, 0x452a16, 0x432714, 0x412613, 0x3e2412, 0x3b2311, 0x3b2412, 0x3b2414, 0x3a2314, 0x3a2513, 0x3d2512, 0x3f2411, 0x3e2410, 0x402612, 0x422713, 0x452814, 0x462915, 0x4a2b15, 0x512e18, 0x5d331b, 0x69391e, 0x693a1d, 0x5c3317, 0x4d2c13, 0x442814, 0x3f2514, 0x3c2212, 0x382010, 0x351f10, 0x321d0f, 0x311d0d, 0x2e1b0c, 0x2b190c, 0x2c180b, 0x2c1709, 0x2a170a, 0x29170a, 0x27160b, 0x26150b, 0x24150a, 0x221409, 0x221409, 0x221409, 0x221409, 0x22130a, 0x21120a, 0x201209, 0x1f1008, 0x1d1007, 0x1a0f06, 0x1a0e06, 0x1a0e06, 0x190d05, 0x170d04, 0x150c05, 0x140b04, 0x140b04, 0x120b04, 0x100a04, 0x110a04, 0x110a04, 0x0f0703, 0x0f0704, 0x0c0803, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0602, 0x090601, 0x080400, 0x070300, 0x050300, 0x040300, 0x040300, 0x030200, 0x030300, 0x030400, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010102, 0x010101, 0x020202, 0x020202, 0x030200, 0x020100, 0x020100, 0x040100, 0x020100, 0x010100, 0x010100, 0x020200, 0x030301, 0x030400, 0x030400, 0x030301, 0x020201, 0x040401, 0x050400, 0x050400, 0x050400, 0x060500, 0x060501, 0x070401, 0x080500, 0x090702, 0x080701, 0x080801, 0x0a0803, 0x0b0703, 0x0b0603, 0x0a0602, 0x0d0603, 0x0f0605, 0x0f0703, 0x110903, 0x130a03, 0x150b04, 0x170d04, 0x1c0f07, 0x201207, 0x251508, 0x2c1709, 0x2f190b, 0x2f190c, 0x2c190a, 0x291709, 0x2d180a, 0x351b0c, 0x3c200f, 0x422410, 0x442410, 0x40210e, 0x3b1f0f, 0x371d0e, 0x331b0d, 0x2f190c, 0x2c180a, 0x2b180a, 0x2b1809, 0x2b1809, 0x2a1809, 0x291709, 0x291809, 0x392112, 0x493120, 0x281809, 0x26170a, 0x322216, 0x301d10, 0x392517, 0x291809, 0x301d0f, 0x331d0d, 0x301502, 0x382010, 0x3b2211, 0x442612, 0x4b2a16, 0x4d2c18, 0x563017, 0x673a1c, 0x7d4623, 0x96572a, 0xaf6d37, 0xa4632d, 0x8d4f24, 0x834b23, 0x804823, 0x764121, 0x6d3e1e, 0x6b3e1e, 0x6c3e1e, 0x704022, 0x734223, 0x794623, 0x804b25, 0x8a4f26, 0x94562a, 0x9a5b2b, 0xa7662d, 0xb27032, 0xaf702e, 0xba8137, 0xc48c3d, 0xc08937, 0xc48e3c, 0xd5a048, 0xe3b85c, 0xd7ae55, 0xdeb45f, 0xe1b766, 0xe4bc6b, 0xe8c471, 0xe3bd6a, 0xe8c16c, 0xecc66f, 0xebc671, 0xdfba69, 0xefcd7c, 0xefd081, 0xe7c97a, 0xe8c77b, 0xd5b26c, 0xc8a460, 0xc69e58, 0xbc9450, 0xad803f, 0x9e6c2f, 0x98632b, 0x8f551b, 0x93561e, 0x965925, 0x995b29, 0x9c5d2c, 0x995c2a, 0x905526, 0x885025, 0x844e26, 0x86512a, 0x8e5a32, 0x754522, 0x784723, 0x7b481e, 0x8f572b, 0x9c5f33, 0x9a5d32, 0x8b4f25, 0x7f4b24, 0x71401f, 0x613a1e, 0x5a351c, 0x573119, 0x59371f, 0x58351e, 0x4e2d18, 0x4d2e1a, 0x492b16, 0x422612, 0x402511, 0x3f2513, 0x3f2514, 0x3e2514, 0x3f2613, 0x3f2813, 0x3f2813, 0x422812, 0x422711, 0x442913, 0x482b15, 0x4a2b17, 0x4c2c16, 0x613f25, 0x5c351a, 0x66391e, 0x6f3d1e, 0x66381b, 0x573018, 0x4b2b15, 0x442714, 0x3f2312, 0x3c2213, 0x382111, 0x361f10, 0x341e10, 0x331d0f, 0x301d0e, 0x2d1b0e, 0x2f1a0b, 0x3f2717, 0x311d0f, 0x2a180a, 0x29180c, 0x27160d, 0x25160c, 0x23160b, 0x23150a, 0x23150a, 0x23150a, 0x241309, 0x23130a, 0x21130a, 0x1f1108, 0x1e1007, 0x1d1007, 0x1c0f06, 0x1b0e06, 0x1b0e06, 0x170d04, 0x160c04, 0x140b04, 0x140b04, 0x130b03, 0x120b03, 0x120b05, 0x120a04, 0x100803, 0x100704, 0x0d0704, 0x0a0803, 0x0b0803, 0x0a0702, 0x0b0602, 0x090601, 0x080501, 0x080300, 0x070300, 0x060300, 0x050401, 0x040301, 0x030301, 0x030400, 0x030400, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020201, 0x020201, 0x020201, 0x020100, 0x020100, 0x010100, 0x020100, 0x010100, 0x010100, 0x020200, 0x030300, 0x030401, 0x040301, 0x030300, 0x040301, 0x040402, 0x050401, 0x050400, 0x050400, 0x050400, 0x060500, 0x070500, 0x080500, 0x090601, 0x090702, 0x090702, 0x090702, 0x0a0702, 0x0b0602, 0x0c0502, 0x0b0602, 0x0c0603, 0x0e0805, 0x0f0804, 0x110a03, 0x130b04, 0x140b04, 0x160c04, 0x1b0e06, 0x1f1107, 0x241508, 0x2c180a, 0x301a0c, 0x311b0d, 0x301a0c, 0x2f1a0d, 0x2f190c, 0x341b0c, 0x3a1f0d, 0x432510, 0x4a2712, 0x492713, 0x432412, 0x3d210f, 0x3c2111, 0x351d0d, 0x301b0d, 0x2f1a0b, 0x2d190b, 0x2c1a0c, 0x2e1b0c, 0x2e1a0b, 0x2d1a0c, 0x2c1708, 0x2c1608, 0x28180d, 0x29190d, 0x301f11, 0x27170c, 0x28160c, 0x39230e, 0x361f0d, 0x381f0e, 0x6d4d37, 0x4a2a13, 0x412413, 0x56341a, 0x54311b, 0x4f2b14, 0x5a3016, 0x6d3c20, 0x824a25, 0x9b5c2b, 0xb16e32, 0xb16c32, 0x9f5c2c, 0x915529, 0x895028, 0x814b25, 0x7d4924, 0x7e4925, 0x7e4926, 0x7c4623, 0x7d4622, 0x824924, 0x925829, 0xa86d31, 0xb47a38, 0xbb823d, 0xcb9449, 0xd49f4e, 0xddaa55, 0xeabb5f, 0xf0c662, 0xefc55f, 0xf2c963, 0xf8d069, 0xf3cc65, 0xf4ce6a, 0xf3d06e, 0xf8d475, 0xf4cf73, 0xecc56c, 0xeac368, 0xecc466, 0xe7c060, 0xebc369, 0xcca657, 0xc49e53, 0xd0ac5e, 0xe5c570, 0xf7da80, 0xf5d57c, 0xf3d37b, 0xf6d77d, 0xfbdd82, 0xf2d177, 0xe8c36e, 0xeeca79, 0xe4c274, 0xdab46b, 0xc59956, 0xbb894b, 0xae7536, 0xa56627, 0x9f5c26, 0x9c5c29, 0x9a5e2c, 0x935a2b, 0x92582b, 0x8f562a, 0x8e5528, 0x8e5627, 0x92582b, 0x93562c, 0x93542a, 0x95582f, 0x874e2c, 0x784324, 0x774929, 0x6f4426, 0x5f371c, 0x5a361b, 0x563218, 0x533119, 0x4f2f1a, 0x4b2d17, 0x482a15, 0x472b16, 0x472c17, 0x432714, 0x432714, 0x432813, 0x442914, 0x442b14, 0x462a15, 0x472b16, 0x4d2d15, 0x502f18, 0x50301a, 0x53311a, 0x5d381d, 0x67391b, 0x723f20, 0x703e1f, 0x62351b, 0x563018, 0x4a2a16, 0x432815, 0x402512, 0x3d2412, 0x3a2311, 0x382110, 0x361f10, 0x331e10, 0x311e10, 0x301d0f, 0x321c0d, 0x392212, 0x301c0e, 0x2b190b, 0x2a180c, 0x29180c, 0x28180c, 0x27180b, 0x26170b, 0x27160c, 0x27160c, 0x25160b, 0x25130b, 0x201409, 0x1e1308, 0x1f1008, 0x1d1007, 0x1d1007, 0x1c0f06, 0x1a0e06, 0x170d05, 0x160c05, 0x150c05, 0x140b05, 0x140b05, 0x140c05, 0x120b05, 0x110b05, 0x110904, 0x100804, 0x0e0803, 0x0b0803, 0x0b0803, 0x0a0702, 0x0b0703, 0x090702, 0x080501, 0x080500, 0x080401, 0x070400, 0x040400, 0x040301, 0x030200, 0x030301, 0x030401, 0x020300, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030300, 0x030400, 0x030400, 0x030300, 0x030300, 0x040300, 0x060502, 0x050401, 0x050400, 0x060501, 0x060501, 0x050501, 0x070500, 0x090601, 0x090601, 0x0a0702, 0x0a0702, 0x0a0803, 0x0b0703, 0x0b0602, 0x0c0502, 0x0c0603, 0x0c0703, 0x0e0804, 0x110a04, 0x110a04, 0x120b03, 0x140c04, 0x160c03, 0x190d04, 0x1d1007, 0x231307, 0x2a1709, 0x2f1a0b, 0x331c0e, 0x341d0f, 0x341d0f, 0x331c0e, 0x341b0c, 0x391e0e, 0x412310, 0x4c2913, 0x4e2b15, 0x4a2914, 0x432511, 0x3f2210, 0x3a1f0e, 0x351d0d, 0x331c0e, 0x321c0e, 0x301c0e, 0x301b0d, 0x331c0d, 0x2f1b0e, 0x341e10, 0x321c0e, 0x2d190c, 0x2c190e, 0x2b180b, 0x2c190d, 0x2e1304, 0x84664d, 0x533926, 0x3c1f09, 0x734e35, 0x532d12, 0x502f18, 0x613a1d, 0x5f341b, 0x754a2e, 0x80512e, 0x7d4a25, 0x874f26, 0x9e5f2e, 0xb57237, 0xbf7a3a, 0xb06c30, 0xa1612c, 0x9a5b2c, 0x95572a, 0x905126, 0x8d5024, 0x8e5224, 0x9c6230, 0xaa743d, 0x9e692c, 0xc08943, 0xd39d49, 0xe1ac54, 0xebb960, 0xebbb60, 0xecbe60, 0xf2c665, 0xedc260, 0xf0c664, 0xf6cb63, 0xf1c65c, 0xf7ca65, 0xeebd5b, 0xeabb5a, 0xe5b85b, 0xedc068, 0xe6b762, 0xe7b561, 0xdcaa57, 0xdaa954, 0xddac56, 0xdeaf5a, 0xe6b765, 0xdeae5f, 0xd8a859, 0xd5a754, 0xe6bb60, 0xe9bc5d, 0xebbe5a, 0xe6bc56, 0xe9c561, 0xecc867, 0xe0bb5f, 0xf0cd75, 0xf9da83, 0xecd178, 0xf8dc83, 0xefd27d, 0xefd282, 0xe1c173, 0xd2ab62, 0xc08e4d, 0xab6d2e, 0xa56025, 0xa25d23, 0x9f612d, 0x9e6333, 0xa66835, 0xa76834, 0x9d6030, 0x995c2d, 0x9f6333, 0x91562d, 0x7e4826, 0x85522f, 0x7d4e2c, 0x683d21, 0x623c1e, 0x60391c, 0x5d391d, 0x543218, 0x4f2f17, 0x4e2f19, 0x4e311b, 0x4e321c, 0x482c16, 0x492d18, 0x492d17, 0x482d17, 0x4a2e17, 0x4d2f18, 0x502f18, 0x633d22, 0x60391e, 0x5a341a, 0x5f361b, 0x673a1e, 0x754121, 0x7a4424, 0x6d3d1f, 0x5b351a, 0x513018, 0x472b16, 0x422914, 0x402713, 0x3f2514, 0x3b2312, 0x392212, 0x382112, 0x352012, 0x321f11, 0x321d0f, 0x331d0e, 0x311b0d, 0x2e1a0c, 0x2d1a0c, 0x2d1a0c, 0x2b180c, 0x2b190c, 0x2a190b, 0x29180b, 0x2a170c, 0x28170b, 0x271608, 0x28120b, 0x221309, 0x201408, 0x211109, 0x1f1108, 0x1c0f06, 0x1c0f06, 0x1b0e06, 0x170d04, 0x160d04, 0x150c04, 0x150c04, 0x150c05, 0x150c05, 0x120c05, 0x110b05, 0x110a04, 0x100903, 0x0e0802, 0x0c0803, 0x0b0803, 0x0b0803, 0x0b0803, 0x0a0803, 0x090601, 0x080601, 0x080401, 0x070401, 0x050500, 0x040300, 0x030301, 0x030301, 0x030301, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010200, 0x030300, 0x030301, 0x030301, 0x030401, 0x030400, 0x040500, 0x040500, 0x040500, 0x040500, 0x050400, 0x060501, 0x060501, 0x070401, 0x070501, 0x070601, 0x070601, 0x080702, 0x090803, 0x0a0702, 0x0a0702, 0x0b0602, 0x0c0703, 0x0c0703, 0x0e0803, 0x100903, 0x120b05, 0x120b04, 0x120b03, 0x140c04, 0x160c03, 0x1a0d04, 0x1c0f05, 0x211307, 0x271609, 0x2d190a, 0x341d0e, 0x371d0f, 0x381e10, 0x391e0f, 0x381e0d, 0x391d0f, 0x3f2110, 0x482812, 0x4e2b13, 0x502c14, 0x4b2a13, 0x452611, 0x402410, 0x3c210f, 0x3a1f0f, 0x371d0e, 0x341b0b, 0x361e0e, 0x3a200d, 0x51311c, 0x4d2f1b, 0x412716, 0x331c0d, 0x321c10, 0x351e10, 0x361e11, 0x351c0e, 0x462a16, 0x3e2310, 0x3f230e, 0x59371e, 0x512e14, 0x513018, 0x60381c, 0x67381b, 0x6e3e1e, 0x915d34, 0x956136, 0x8a5024, 0xa56632, 0xbc7a37, 0xcb883e, 0xc37e3a, 0xb26d34, 0xa6602d, 0xab6833, 0xb67840, 0xad7237, 0xbd8542, 0xd09b4e, 0xd7a553, 0xdba956, 0xe0ad55, 0xe6b355, 0xdaa84c, 0xe4b356, 0xe2b152, 0xe8b85a, 0xedbd5f, 0xeec061, 0xecc15e, 0xf6c863, 0xe9b958, 0xe2b059, 0xd9a151, 0xc58d41, 0xbe8a45, 0xb68343, 0xaa773a, 0xa7793d, 0xab7c41, 0x9c6c31, 0xa4753a, 0xa87a3c, 0xb98b49, 0xb38541, 0xb98a4a, 0xa7793b, 0xb88a45, 0xc4954a, 0xd3a353, 0xdaaa55, 0xd7a953, 0xd5a751, 0xdfb05a, 0xe8bd64, 0xf0c66d, 0xf0c56d, 0xf3cb6c, 0xedc768, 0xecc971, 0xddbb68, 0xdebd6e, 0xe4c176, 0xe8cb7f, 0xe2ca84, 0xcda96a, 0xba8a4a, 0xaf712b, 0xb36f2d, 0xb97435, 0xb57135, 0xab6a35, 0xa26430, 0x995b2d, 0x8a5227, 0x834d1f, 0x7d4a23, 0x724423, 0x6d4120, 0x6e4323, 0x774e31, 0x5f391d, 0x633f24, 0x54341b, 0x52341b, 0x503119, 0x4f311a, 0x4e311a, 0x4f3118, 0x4f3018, 0x503118, 0x543219, 0x58341a, 0x633b1f, 0x643a1e, 0x63381d, 0x6c3c1d, 0x784221, 0x7d4624, 0x774423, 0x673b1c, 0x573418, 0x4f2f17, 0x482a15, 0x472814, 0x472915, 0x402614, 0x3d2413, 0x3a2313, 0x392213, 0x372112, 0x352010, 0x341f0f, 0x341f0e, 0x331e0d, 0x321c0e, 0x301b0d, 0x2f1b0d, 0x2f1a0d, 0x2f1a0c, 0x2f1b0c, 0x2d1a0c, 0x2a180b, 0x29170a, 0x281709, 0x28150e, 0x25140c, 0x211409, 0x20130a, 0x1f1209, 0x1d1007, 0x1d1007, 0x1a0d06, 0x180d04, 0x170d03, 0x180e04, 0x170d04, 0x160d04, 0x150c05, 0x120c04, 0x120c05, 0x110a04, 0x0f0903, 0x0d0802, 0x0c0804, 0x0a0702, 0x0a0702, 0x090803, 0x090803, 0x080702, 0x070601, 0x080501, 0x070500, 0x050500, 0x050400, 0x040400, 0x030400, 0x030400, 0x030400, 0x020300, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x010100, 0x010100, 0x010100, 0x020200, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x030300, 0x040300, 0x040300, 0x040301, 0x040301, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x050501, 0x050501, 0x070401, 0x080401, 0x080501, 0x090601, 0x090702, 0x0a0702, 0x0a0702, 0x0b0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0e0802, 0x100903, 0x100903, 0x120b05, 0x120a03, 0x120b03, 0x140c04, 0x160c03, 0x1a0d04, 0x1b0e04, 0x1e1106, 0x231408, 0x2a1608, 0x331b0c, 0x391f0f, 0x3c2010, 0x3d2010, 0x3b200f, 0x3b1f10, 0x3c200f, 0x432510, 0x4e2b12, 0x583016, 0x572f13, 0x512c12, 0x492811, 0x41240f, 0x462c18, 0x513623, 0x4b301d, 0x3b200c, 0x3e220d, 0x714d34, 0x502f19, 0x3c1f0b, 0x3f2616, 0x392111, 0x422717, 0x422617, 0x392312, 0x372112, 0x3b2312, 0x412712, 0x462913, 0x4f2f18, 0x533319, 0x5c3418, 0x7a4b26, 0x784522, 0x7f4922, 0x8b5125, 0x9a5c2d, 0xb06e35, 0xc27e39, 0xd28d41, 0xca843e, 0xa96228, 0xad6a2e, 0xcd914c, 0xd8a156, 0xd9a454, 0xe3b05d, 0xe5b65b, 0xe0b158, 0xd2a052, 0xd5a24e, 0xdfae4f, 0xddad4f, 0xd7a64c, 0xd8a54e, 0xd6a34f, 0xd4a151, 0xc69244, 0xc59043, 0xba833b, 0xad7231, 0x9e5e22, 0x955821, 0x7f4615, 0x6c380b, 0x602f05, 0x562801, 0x491b00, 0x491b00, 0x4b2000, 0x4c2000, 0x512200, 0x562300, 0x572700, 0x562b02, 0x522907, 0x4f2702, 0x572f09, 0x633911, 0x774e21, 0x7f5223, 0x885825, 0x9e6f33, 0xb68741, 0xc59549, 0xd1a252, 0xd8aa52, 0xecc161, 0xf1c764, 0xf3c86a, 0xd8ab5a, 0xcca254, 0xdfbd6e, 0xe2ca7f, 0xf2e095, 0xf6e7a3, 0xeeda9f, 0xd7b77c, 0xc2914e, 0xbb7e38, 0xb57130, 0xaf6d2f, 0xa2632e, 0xb1753e, 0xc78c54, 0x8f5628, 0x7d4a24, 0x764722, 0x724422, 0x744827, 0x663d1f, 0x694326, 0x5c381c, 0x59371b, 0x59371b, 0x58371b, 0x57361b, 0x56351b, 0x56351a, 0x58351a, 0x5c361d, 0x5f391f, 0x643b1e, 0x673b20, 0x6d3e22, 0x7b4422, 0x854925, 0x814825, 0x734121, 0x60371b, 0x553218, 0x502e17, 0x4f2d19, 0x573521, 0x563520, 0x422914, 0x3e2511, 0x3d2412, 0x3b2312, 0x3a2311, 0x382210, 0x362110, 0x362110, 0x35200f, 0x341f0e, 0x331d0e, 0x331d0f, 0x331c0f, 0x361e0f, 0x392212, 0x321d0e, 0x2c190b, 0x29170a, 0x28170d, 0x26170c, 0x241205, 0x231205, 0x21140b, 0x1f1209, 0x1d1007, 0x1c0f07, 0x1b0e06, 0x180d04, 0x180e04, 0x190f05, 0x180e05, 0x170d05, 0x150c05, 0x130c04, 0x110b03, 0x110a04, 0x100903, 0x0e0903, 0x0c0804, 0x0c0904, 0x0b0904, 0x0b0803, 0x0a0803, 0x0a0702, 0x0a0702, 0x090601, 0x070500, 0x050500, 0x050400, 0x050400, 0x040401, 0x030401, 0x030301, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 
-  0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020201, 0x040300, 0x040200, 0x040300, 0x040301, 0x050402, 0x040500, 0x040500, 0x040500, 0x050601, 0x040501, 0x050601, 0x060601, 0x070401, 0x080401, 0x080601, 0x090702, 0x0a0702, 0x090601, 0x0a0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0f0803, 0x120b05, 0x110a04, 0x120a04, 0x120a03, 0x120b03, 0x140b04, 0x170d04, 0x1a0d05, 0x1c0f05, 0x1e1108, 0x211207, 0x281507, 0x30190a, 0x391d0f, 0x3f2110, 0x402210, 0x402311, 0x3f2212, 0x3d2210, 0x412410, 0x4e2a13, 0x5a2e15, 0x6a3d20, 0x6f452a, 0x4f2b11, 0x492a14, 0x452810, 0x4f321b, 0x553925, 0x3e220c, 0x3f2411, 0x3f210d, 0x402410, 0x3f2512, 0x412612, 0x3d2410, 0x3f2311, 0x462612, 0x54361f, 0x452713, 0x412713, 0x462913, 0x4d2e18, 0x55311a, 0x5a3519, 0x633718, 0x956338, 0x8d572f, 0x874d29, 0x985b2b, 0xa96833, 0xb36d35, 0xb16a2e, 0xc7823c, 0xcc893f, 0xbf7f3b, 0xd4994d, 0xe3ae55, 0xe1af56, 0xddab54, 0xe2b158, 0xe1b258, 0xddae55, 0xd4a24d, 0xd09e4d, 0xcf9e50, 0xbc8d47, 0x9a6d33, 0x8d602b, 0x815423, 0x714012, 0x693605, 0x693608, 0x693209, 0x6b350d, 0x7f4a1e, 0x865125, 0x78461f, 0x683e1e, 0x5f3c1d, 0x5d3c1e, 0x674224, 0x694422, 0x6d4826, 0x6d4827, 0x734d2a, 0x754c2a, 0x6f4a28, 0x644424, 0x4f3312, 0x422710, 0x3d220d, 0x3f220b, 0x3a1700, 0x411b01, 0x431a00, 0x4d2100, 0x5a2900, 0x673509, 0x744314, 0x855521, 0xa87839, 0xc49247, 0xd4a64f, 0xe7ba61, 0xf3c86f, 0xf4cd72, 0xe4c268, 0xdcb860, 0xe0c374, 0xe5d48f, 0xefe19e, 0xf6e5a3, 0xe6cd8e, 0xcca362, 0xc1873d, 0xb7752e, 0xc07c38, 0xc78748, 0x9d612b, 0x8d5528, 0x7f4d22, 0x784823, 0x724422, 0x6c4121, 0x683f1f, 0x663f20, 0x643d1f, 0x643f20, 0x643e20, 0x603b1f, 0x5d3b1f, 0x5d3a1e, 0x5f3b1f, 0x643c21, 0x693f22, 0x6f4020, 0x744121, 0x7e4725, 0x8a4c27, 0x8b4f29, 0x7f4824, 0x704021, 0x61391e, 0x55321a, 0x4f3019, 0x4c2e18, 0x4c2e18, 0x4a2c15, 0x432913, 0x402711, 0x3e2510, 0x3d2411, 0x3c2411, 0x3b2311, 0x392210, 0x382211, 0x372110, 0x35200f, 0x35200f, 0x361f10, 0x371f11, 0x3b2212, 0x3f2514, 0x351e0e, 0x2d1a0b, 0x2b190b, 0x2a170c, 0x2c1803, 0x57381c, 0x4c2f18, 0x231208, 0x20120a, 0x1e1108, 0x1c0f07, 0x1c0f07, 0x190e05, 0x180e05, 0x180e05, 0x180e05, 0x170d05, 0x140b04, 0x130c04, 0x120c04, 0x120b04, 0x110a04, 0x0e0903, 0x0c0804, 0x0c0903, 0x0b0903, 0x0c0904, 0x0b0803, 0x0b0803, 0x0b0803, 0x090702, 0x080601, 0x060500, 0x050400, 0x050401, 0x040402, 0x040401, 0x030301, 0x030301, 0x020200, 0x020200, 0x010100, 0x010100, 
-  0x010100, 0x020200, 0x020200, 0x010100, 0x020200, 0x020200, 0x010100, 0x020200, 0x020300, 0x030400, 0x030400, 0x030400, 0x040300, 0x060201, 0x040301, 0x040301, 0x040401, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x050600, 0x050500, 0x070500, 0x080500, 0x080601, 0x090702, 0x090601, 0x0a0702, 0x0a0702, 0x0b0602, 0x0c0703, 0x0c0702, 0x0e0802, 0x100902, 0x110a04, 0x110b05, 0x110c06, 0x110b05, 0x130b02, 0x140b02, 0x160d04, 0x190f05, 0x1c0f06, 0x1e1007, 0x231207, 0x251306, 0x2d180a, 0x371c0d, 0x3d210f, 0x432411, 0x462611, 0x452612, 0x432412, 0x422310, 0x4d2913, 0x5a3017, 0x65361b, 0x66381c, 0x5c3217, 0x542e17, 0x4e2b13, 0x4b2910, 0x472711, 0x432611, 0x462914, 0x482a16, 0x4b2f19, 0x452a14, 0x422611, 0x412611, 0x422712, 0x472914, 0x4c2d17, 0x53341e, 0x4d301a, 0x4e2e16, 0x553217, 0x5a351a, 0x60391b, 0x6c401f, 0x7c4721, 0x8c5226, 0x95582d, 0x9f5d2e, 0xac6832, 0xa7642b, 0xb97b39, 0xd79c4d, 0xd8a049, 0xdfa74f, 0xdba24b, 0xd49c44, 0xd39e47, 0xdeaa51, 0xdfae58, 0xc99d50, 0xc0954f, 0xb58847, 0x855c28, 0x674018, 0x4f2805, 0x3a1200, 0x3a1901, 0x44250d, 0x5c3a21, 0x704a2c, 0x7e552d, 0x895f33, 0x906237, 0xa06f3f, 0xbe8b51, 0xab7943, 0x96673b, 0x90663c, 0x8a6237, 0xa37846, 0xb28448, 0xa97943, 0xa57546, 0xa07342, 0xa27240, 0x9a6c3e, 0x8f663e, 0x875e36, 0x7e5732, 0x775231, 0x7e5b37, 0x74502e, 0x7e5837, 0x77522f, 0x694623, 0x5b371a, 0x4f2c0f, 0x431f03, 0x471f07, 0x4c1c00, 0x5e2e03, 0x754211, 0x976429, 0xb17f3a, 0xc79a50, 0xe8be6a, 0xe7bc64, 0xf5d074, 0xf1d073, 0xe0bd66, 0xd4b466, 0xf3de93, 0xfbeba5, 0xf4e09d, 0xe3c27f, 0xcf9e59, 0xb3742d, 0xa7662b, 0xb17840, 0xbe8851, 0x854f24, 0x7e4c26, 0x7b4b27, 0x784a24, 0x744824, 0x724724, 0x714522, 0x714423, 0x6f4322, 0x673f1f, 0x684021, 0x6b4122, 0x704323, 0x734524, 0x784623, 0x834a25, 0x8f5129, 0x95542c, 0x8d5029, 0x7b4523, 0x774726, 0x6b4326, 0x57331a, 0x53321a, 0x4e3019, 0x482c17, 0x452a15, 0x442914, 0x432813, 0x422713, 0x402512, 0x3f2512, 0x3e2411, 0x3e2412, 0x3c2312, 0x3a2311, 0x392110, 0x392110, 0x3a200f, 0x3b2110, 0x3c2211, 0x3b2211, 0x351e0e, 0x2f1b0c, 0x2c1a0c, 0x29190b, 0x381f09, 0x704726, 0x603c20, 0x221106, 0x20130a, 0x1e1108, 0x1d1008, 0x1d1008, 0x1b0f07, 0x190f06, 0x180e05, 0x180e05, 0x160d05, 0x140b05, 0x130b04, 0x130c04, 0x120b05, 0x110a04, 0x100a04, 0x0e0903, 0x0c0902, 0x0c0903, 0x0c0904, 0x0b0803, 0x0b0803, 0x0a0702, 0x090702, 0x080501, 0x080401, 0x080401, 0x070401, 0x040500, 0x040500, 0x030400, 0x030400, 0x030400, 0x020200, 0x010100, 0x010100, 
-  0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x030301, 0x030400, 0x030400, 0x030400, 0x030400, 0x030300, 0x030300, 0x040400, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x050501, 0x050500, 0x060500, 0x060500, 0x080601, 0x090601, 0x0a0702, 0x0a0702, 0x090702, 0x0a0702, 0x0b0703, 0x0b0703, 0x0c0703, 0x0d0803, 0x0f0903, 0x110a02, 0x110a03, 0x120b05, 0x130d07, 0x120c06, 0x140c03, 0x160c03, 0x170d05, 0x190f05, 0x1b1006, 0x1d1007, 0x241408, 0x2f1c10, 0x2d170a, 0x341b0c, 0x3b2010, 0x412310, 0x472813, 0x4b2913, 0x4b2914, 0x482713, 0x4b2813, 0x552d15, 0x623317, 0x69391b, 0x67381a, 0x61341a, 0x5b3117, 0x562f15, 0x502d15, 0x4c2b14, 0x502f19, 0x4b2c17, 0x4a2d15, 0x4a2d14, 0x482b14, 0x472a14, 0x472b15, 0x4b2d18, 0x4e2f16, 0x55341a, 0x543017, 0x664126, 0x633d1e, 0x633c1a, 0x6e411d, 0x804b27, 0x8e532a, 0x975a2a, 0x8e5020, 0x965523, 0xad7137, 0xcd9754, 0xe4b264, 0xebba62, 0xedb75a, 0xe7ab4a, 0xdca143, 0xd69f49, 0xcc9744, 0xc18e45, 0xa4783f, 0x7a5428, 0x53300c, 0x411e05, 0x391501, 0x482913, 0x573920, 0x6c4e31, 0x6b4c2a, 0x71512e, 0x7e5936, 0x8f663c, 0x9e703f, 0xa27240, 0xa67340, 0xa57235, 0xa6732e, 0xaa7639, 0xa5723b, 0xa4723d, 0xaa7942, 0xaa7d40, 0xbe8e49, 0xb88644, 0xb48246, 0xa4763e, 0xaa7c40, 0xa47339, 0x9b6a3a, 0x936637, 0xa0733d, 0x916336, 0x96693b, 0x9d6e3b, 0x9f713e, 0xa17342, 0x9b6d3e, 0x9a6d41, 0x8c603a, 0x76512f, 0x6c4827, 0x61401d, 0x503013, 0x4a260e, 0x562907, 0x6b360e, 0x7d410f, 0x9d6428, 0xb07f38, 0xcc9f54, 0xe5bc6a, 0xf9d27a, 0xf2cd70, 0xeecb6a, 0xf0d378, 0xebd789, 0xf9eca8, 0xfbefb2, 0xe4cb91, 0xc09156, 0xb0742f, 0xb87b3f, 0x995e2d, 0x92582b, 0x8e562c, 0x8a532a, 0x855229, 0x824f28, 0x7e4c25, 0x82512c, 0x83532e, 0x754722, 0x754724, 0x794925, 0x7e4b27, 0x814c29, 0x864e29, 0x93552b, 0x9d5c30, 0x99592d, 0x8a4f27, 0x784523, 0x6d3e1f, 0x623a1f, 0x5b371e, 0x58351c, 0x52331b, 0x4d2f19, 0x492d18, 0x462b15, 0x452a15, 0x442914, 0x422714, 0x422713, 0x422613, 0x422613, 0x3f2512, 0x3d2412, 0x3d2312, 0x3c2211, 0x3c2211, 0x3b200f, 0x391f0f, 0x371e0f, 0x341d0f, 0x321c0f, 0x2f1c0d, 0x2d1c0d, 0x2e1d0d, 0x371e07, 0x321b06, 0x25160a, 0x21130a, 0x1f1108, 0x1e1108, 0x1e1008, 0x1c1008, 0x191007, 0x180e05, 0x180e05, 0x170e05, 0x150c05, 0x140b04, 0x130c04, 0x130c05, 0x120b05, 0x110a04, 0x0e0903, 0x0d0903, 0x0d0a04, 0x0d0a05, 0x0b0803, 0x0b0904, 0x0c0904, 0x090803, 0x090702, 0x0a0602, 0x080401, 0x070401, 0x050400, 0x040500, 0x040500, 0x030400, 0x030400, 0x030300, 0x010100, 0x010100, 
-  0x020200, 0x010100, 0x020200, 0x030300, 0x030300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x040500, 0x060501, 0x060501, 0x070501, 0x070500, 0x080601, 0x090501, 0x0a0702, 0x0b0803, 0x0a0702, 0x0a0602, 0x0b0703, 0x0b0703, 0x0c0703, 0x0d0804, 0x0d0904, 0x100a04, 0x110a02, 0x120b02, 0x130b04, 0x140c06, 0x130b05, 0x140b03, 0x160d04, 0x180e05, 0x1a0e05, 0x1b1006, 0x1d1007, 0x241408, 0x2e1a0e, 0x2b1609, 0x2f1a0c, 0x371e0e, 0x402310, 0x492813, 0x4f2b14, 0x512d14, 0x502c16, 0x4e2b14, 0x502a13, 0x603318, 0x713f20, 0x713c1c, 0x6f3b1c, 0x66371b, 0x5d331a, 0x563018, 0x522e18, 0x512d18, 0x512f18, 0x512f16, 0x553116, 0x583419, 0x532f16, 0x512f17, 0x523118, 0x57351a, 0x5b3619, 0x5d371a, 0x6c4326, 0x6f4022, 0x784524, 0x814b27, 0x854d27, 0x8a5025, 0xa76d38, 0xae743d, 0xbb884b, 0xca9852, 0xd8a65c, 0xcd9a4a, 0xe4b25a, 0xe5af54, 0xe2a64f, 0xc88f43, 0xac7e3e, 0x734f21, 0x4d2907, 0x391000, 0x432310, 0x54361e, 0x654428, 0x6e4c2b, 0x7b5731, 0x845f35, 0x8e6c3d, 0x87653b, 0x7a5434, 0x794f29, 0x966b39, 0x936537, 0x8c5d2f, 0x996d36, 0xbb9557, 0xdab777, 0xd1a86a, 0xb68546, 0xb3823f, 0xcb9b55, 0xb98a46, 0xc5944f, 0xb88744, 0xb38248, 0x8d5d2b, 0xc6a064, 0xbe924f, 0xba8644, 0xbc8c47, 0xc39250, 0xb5844b, 0xa9763e, 0xb9854a, 0xa87841, 0x916536, 0x9c703f, 0xa2753d, 0xa17340, 0xa77445, 0x9b6939, 0xb1814d, 0x8a5d30, 0x845a31, 0x7d542a, 0x6b421f, 0x5d3417, 0x562c07, 0x5f3006, 0x683707, 0x81501a, 0xa67a3b, 0xc79951, 0xe3b665, 0xf5d175, 0xf2d374, 0xeccd72, 0xf0db8f, 0xfcf2b3, 0xfdf2bb, 0xecd6a2, 0xc49b65, 0xaa6d27, 0xa6682b, 0xa26531, 0x9a6031, 0x945d2f, 0x8e592d, 0x8b572e, 0x87542a, 0x825127, 0x815028, 0x814f29, 0x85522c, 0x8a542d, 0x8f552d, 0x98592e, 0xa46132, 0xa66233, 0x995a2c, 0x874e27, 0x784626, 0x6f4023, 0x643c21, 0x5d381e, 0x5b371d, 0x56351b, 0x51321a, 0x4d2f19, 0x492e17, 0x472c16, 0x472c16, 0x462b15, 0x452a15, 0x462914, 0x452814, 0x422613, 0x402613, 0x412513, 0x402512, 0x3e2312, 0x3d2211, 0x3b2010, 0x381f11, 0x351e11, 0x341d10, 0x341e0e, 0x321d0d, 0x2c1b0e, 0x28170b, 0x271509, 0x24140a, 0x201208, 0x1f1208, 0x1e1108, 0x1e1008, 0x1c1008, 0x190f06, 0x180e06, 0x180e05, 0x170e05, 0x160c03, 0x150c04, 0x150c05, 0x140c04, 0x130b05, 0x120b05, 0x100a04, 0x0e0903, 0x0d0a04, 0x0d0905, 0x0c0804, 0x0b0703, 0x0b0803, 0x0a0803, 0x0a0803, 0x0a0702, 0x090502, 0x080401, 0x070400, 0x040400, 0x040500, 0x040300, 0x030300, 0x030300, 0x020200, 0x010100, 
-  0x020200, 0x030201, 0x030301, 0x030400, 0x020400, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x040500, 0x040500, 0x040500, 0x050400, 0x050400, 0x060400, 0x060300, 0x040500, 0x050500, 0x060501, 0x070501, 0x080501, 0x090601, 0x090601, 0x090601, 0x0b0803, 0x0a0803, 0x0a0602, 0x0a0602, 0x0c0603, 0x0c0703, 0x0c0703, 0x0d0804, 0x0e0904, 0x100a04, 0x110a03, 0x120b03, 0x140b04, 0x140b05, 0x140b05, 0x140b03, 0x170d04, 0x190e05, 0x1b0e06, 0x1c0f06, 0x1f1007, 0x221206, 0x251306, 0x291608, 0x2a1809, 0x341c0d, 0x3e210e, 0x472712, 0x502c14, 0x532f15, 0x532f15, 0x522d15, 0x522e15, 0x5c3217, 0x6e3d1e, 0x763f1d, 0x78401f, 0x733e1d, 0x6c3a1c, 0x63361b, 0x5e341b, 0x5c331a, 0x5c331b, 0x60371b, 0x6e4528, 0x7b5034, 0x643619, 0x60361b, 0x5e381b, 0x653d1e, 0x6b3f1e, 0x724320, 0x764524, 0x7b4926, 0x7d4825, 0x7e4b24, 0x855226, 0x9d6b33, 0xbd8a45, 0xce9951, 0xc3914d, 0xc08f45, 0xca984c, 0xcd964d, 0xd89f54, 0xcf964d, 0xa76f34, 0x754219, 0x471700, 0x543319, 0x604125, 0x6c4d30, 0x775737, 0x785633, 0x835e38, 0x825c33, 0x896239, 0x825a33, 0x714b26, 0x734e26, 0x8b6434, 0xac8146, 0xd5a85f, 0xd2a553, 0xe0b15e, 0xebc16a, 0xedca7c, 0xc4a46a, 0x966c38, 0xb68547, 0xc99851, 0xd3a557, 0xcb9b50, 0xb98746, 0xaf8042, 0x976c3d, 0x774912, 0xdfc37b, 0xe1c57a, 0xc79447, 0xdba956, 0xcd9d53, 0xd2a35b, 0xca9c55, 0xc69656, 0x8a5d2b, 0x693e18, 0xb18b58, 0xd8b46c, 0xd3af68, 0xbd9654, 0xab7e43, 0xae7b43, 0xa56f3d, 0xa5703d, 0xb07e44, 0xad7e48, 0x906437, 0x825931, 0x6b4423, 0x542f12, 0x522a0b, 0x5e2d05, 0x743d0e, 0x986229, 0xc28f46, 0xddb05d, 0xf2cb77, 0xf4d47c, 0xf6d881, 0xf6e29a, 0xfdf2b7, 0xfef3ba, 0xe7d198, 0xbf975d, 0xa96e2b, 0xab6c31, 0xa76b34, 0x9f6532, 0x9b6131, 0x975e2e, 0x986130, 0x905a2c, 0x925b2e, 0x945b2e, 0x9a5e31, 0x9f6132, 0xa76533, 0xb16b37, 0xab6836, 0x9a5b2d, 0x884f29, 0x7a4728, 0x714123, 0x673e20, 0x613b20, 0x5d381d, 0x59351c, 0x55341c, 0x50311a, 0x4e3019, 0x4d2e18, 0x4c2d18, 0x4b2c17, 0x492b16, 0x4a2b16, 0x492915, 0x462813, 0x432713, 0x432713, 0x422513, 0x402514, 0x3e2312, 0x3c2111, 0x3a2111, 0x372012, 0x361f10, 0x3c2613, 0x352010, 0x2d1909, 0x28170b, 0x26150b, 0x241409, 0x221409, 0x201308, 0x1f1209, 0x1e1108, 0x1d1008, 0x1a1007, 0x190f06, 0x190f06, 0x170e05, 0x180d04, 0x170d04, 0x160d05, 0x150c05, 0x140b05, 0x130b04, 0x120b04, 0x0f0b03, 0x0e0a03, 0x0e0905, 0x0d0804, 0x0c0703, 0x0b0602, 0x0a0802, 0x0a0802, 0x0a0702, 0x090702, 0x090501, 0x090301, 0x040400, 0x040500, 0x050400, 0x030300, 0x030401, 0x020200, 0x010100, 
-  0x030200, 0x030301, 0x030300, 0x040401, 0x030301, 0x040400, 0x040400, 0x040400, 0x040400, 0x040400, 0x050400, 0x050400, 0x050400, 0x070400, 0x070400, 0x080401, 0x080401, 0x070501, 0x070501, 0x080401, 0x0a0502, 0x0a0602, 0x090601, 0x090601, 0x0a0702, 0x0a0702, 0x0a0601, 0x0a0602, 0x0b0602, 0x0c0703, 0x0c0704, 0x0c0804, 0x0d0804, 0x0f0804, 0x100904, 0x120a04, 0x120c04, 0x140b06, 0x150b07, 0x150c05, 0x150c03, 0x170d04, 0x190f06, 0x1b0f06, 0x1e0f07, 0x1f0f07, 0x211006, 0x231207, 0x261408, 0x291609, 0x311a0c, 0x3a1f0e, 0x442511, 0x4e2b14, 0x542f16, 0x572f17, 0x583018, 0x583018, 0x5c3118, 0x663518, 0x743e1d, 0x7f4421, 0x804420, 0x7c4121, 0x753d1f, 0x6f3c1d, 0x6b3b1c, 0x69391c, 0x6d3f21, 0x6f4021, 0x734221, 0x794625, 0x734222, 0x704422, 0x754523, 0x804a25, 0x91572f, 0x88502b, 0x723f1b, 0x84552a, 0x9e6d38, 0xb68347, 0xc6924f, 0xc8964b, 0xc29045, 0xc7944b, 0xc8954b, 0xc6924f, 0xa8743b, 0x895526, 0x784019, 0x78421a, 0x86572f, 0x815b36, 0x87613a, 0x846036, 0x805f33, 0x815f35, 0x77542f, 0x6b4a2d, 0x6c4b2a, 0x8a643c, 0xaa844e, 0xbe9853, 0xd1a75d, 0xd0a156, 0xcd9d4f, 0xd3a44d, 0xe7b659, 0xe3b662, 0xab8543, 0x7b5429, 0x916636, 0xab7d43, 0xbd8c4c, 0xc8974f, 0xd2a254, 0xdfb15e, 0xcb9d52, 0xad7b41, 0x6c401b, 0xb98d43, 0xebcd77, 0xf4e59a, 0xc69a4c, 0xd49f50, 0xd2a154, 0xd4a959, 0xdfb161, 0xd3a45b, 0xaa7d43, 0x754c25, 0x5a3003, 0x916d35, 0xd5ad65, 0xf2cb72, 0xf3cf7e, 0xe5c678, 0xceaf66, 0xc3a164, 0xba9255, 0xb08141, 0xaa743a, 0xb77f48, 0xa87944, 0x886132, 0x724e27, 0x5d3922, 0x543210, 0x5b320c, 0x6d380d, 0x8c551e, 0xae7a36, 0xdfb060, 0xf3cf79, 0xf2d57c, 0xf2d27f, 0xf2dc95, 0xfef6ba, 0xfdf1bc, 0xe5cb95, 0xc49152, 0xb47632, 0xb87839, 0xb06f38, 0xa96b34, 0xb17439, 0xab6d38, 0xa96b38, 0xa46632, 0xad6d38, 0xb5743d, 0xb9753a, 0xb97339, 0xaa6833, 0x995b2e, 0x8a522b, 0x7f4a28, 0x754525, 0x6c4021, 0x663e21, 0x603b1f, 0x5b391e, 0x58371d, 0x55351c, 0x54341a, 0x523217, 0x503018, 0x4f2f19, 0x4e2e18, 0x4c2c16, 0x4c2c17, 0x4a2b16, 0x482915, 0x452814, 0x442814, 0x412613, 0x3f2413, 0x3d2212, 0x3c2112, 0x3a2213, 0x382112, 0x372210, 0x311e0e, 0x2d1a0a, 0x29170a, 0x27170b, 0x26160a, 0x24140a, 0x211409, 0x201309, 0x1f1209, 0x1e1108, 0x1c1007, 0x1a0e05, 0x190f06, 0x180e05, 0x180e05, 0x170e05, 0x160d05, 0x160d04, 0x150c03, 0x140b04, 0x130b04, 0x120c03, 0x110b04, 0x0f0a05, 0x0f0805, 0x0e0704, 0x0e0704, 0x0b0803, 0x0a0803, 0x090803, 0x0a0602, 0x0a0501, 0x080401, 0x050400, 0x040500, 0x040400, 0x030400, 0x030400, 0x020300, 0x020200, 
-  0x020200, 0x030300, 0x030400, 0x040401, 0x050401, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x060300, 0x080301, 0x080401, 0x070300, 0x080401, 0x080401, 0x080401, 0x090401, 0x090401, 0x0a0602, 0x090701, 0x0a0702, 0x0a0702, 0x0a0702, 0x090601, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0703, 0x0c0804, 0x0e0905, 0x100903, 0x110904, 0x130a05, 0x140c03, 0x150b04, 0x160a05, 0x150a01, 0x160c03, 0x170d04, 0x1a0e05, 0x1b0e06, 0x1e1007, 0x211008, 0x221108, 0x231208, 0x27160b, 0x2b170c, 0x301a0c, 0x371d0d, 0x402311, 0x492913, 0x532e16, 0x593018, 0x5f331a, 0x61351b, 0x62351a, 0x66361a, 0x733c1c, 0x854824, 0x8b4c25, 0x894b23, 0x864924, 0x804722, 0x7c4622, 0x7c4624, 0x794523, 0x794523, 0x7f4a27, 0x945d36, 0x8d562d, 0x895229, 0x8d552c, 0x90572c, 0x8f5528, 0x8e592b, 0x956431, 0xa47339, 0xb48445, 0xb28241, 0xb37f3e, 0xb6813c, 0xc69247, 0xce9e56, 0xa4753d, 0x7a4b23, 0x603110, 0x683a17, 0x87572c, 0xab7843, 0xb07e45, 0x976f3d, 0x8a6537, 0x825e36, 0x734d31, 0x6c462a, 0x9e7948, 0xb99151, 0xc09852, 0xce9e54, 0xdcae5d, 0xd0a55c, 0xb38a4b, 0xb98f4c, 0xc79647, 0xd09e47, 0xcfa354, 0x896337, 0x744e2f, 0x986f41, 0xaa7e46, 0xb28343, 0xc2914a, 0xd2a153, 0xd8a955, 0xdfb45a, 0xd5a652, 0x936832, 0x8a602e, 0xd9a74d, 0xe6bd61, 0xfae69e, 0xd8bb78, 0xb9843a, 0xcd9d55, 0xdab162, 0xe4b666, 0xe2b264, 0xcc9c53, 0xac7a3f, 0x885830, 0x5b2b0e, 0x582600, 0xb18545, 0xe7be67, 0xe7c264, 0xe3bf69, 0xf0d27f, 0xf1d786, 0xe5c881, 0xd2b275, 0xb79554, 0xa87740, 0xa36f42, 0xa97743, 0x98683c, 0x8a6037, 0x704b2a, 0x5b3517, 0x5c310c, 0x744214, 0x975e23, 0xb8833c, 0xeabc68, 0xf5d076, 0xf5d87f, 0xfae392, 0xfaecab, 0xfff6c1, 0xf9ebb2, 0xddbe7d, 0xc69042, 0xb87834, 0xb8763c, 0xba773a, 0xb3743a, 0xaf713a, 0xb5753d, 0xbe793c, 0xc47f3f, 0xce8946, 0xc88442, 0xb27339, 0x9c6130, 0x8e572b, 0x845029, 0x7a4a27, 0x714423, 0x6a4021, 0x633e21, 0x5f3c20, 0x5d3b20, 0x5b391e, 0x5a371d, 0x58361b, 0x553419, 0x53311a, 0x54311b, 0x59351f, 0x502e19, 0x4f2d19, 0x4d2b17, 0x492a16, 0x462914, 0x432813, 0x402513, 0x3f2412, 0x3d2211, 0x3c2211, 0x392311, 0x362110, 0x311d0e, 0x2d1a0c, 0x29170a, 0x29180b, 0x28170b, 0x26150a, 0x221409, 0x201308, 0x201208, 0x201209, 0x1f1108, 0x1d1007, 0x1a0f06, 0x190f06, 0x170e05, 0x170e05, 0x170e05, 0x170e05, 0x160d03, 0x150c04, 0x140b04, 0x130a03, 0x120a03, 0x110a04, 0x100904, 0x100805, 0x100805, 0x0d0804, 0x0a0803, 0x090803, 0x0a0702, 0x0a0502, 0x080401, 0x060501, 0x050400, 0x040500, 0x030400, 0x030400, 0x020300, 0x020200, 
-  0x020200, 0x030400, 0x030400, 0x040400, 0x050300, 0x060400, 0x060400, 0x060500, 0x070501, 0x070601, 0x070601, 0x060500, 0x080501, 0x090501, 0x090601, 0x090601, 0x090601, 0x090602, 0x090601, 0x090601, 0x0a0501, 0x0a0602, 0x0a0702, 0x0a0702, 0x0a0702, 0x090601, 0x0a0702, 0x0b0803, 0x0b0803, 0x0b0803, 0x0c0803, 0x0e0803, 0x0f0903, 0x100903, 0x100a04, 0x120c06, 0x150c03, 0x150c04, 0x150b06, 0x160b03, 0x160c03, 0x180d04, 0x1b0e06, 0x1c0e06, 0x1e1007, 0x211008, 0x221108, 0x231208, 0x27150b, 0x2a170a, 0x2e190b, 0x351d0d, 0x3c2110, 0x452612, 0x4e2b14, 0x5a3218, 0x64371a, 0x69391b, 0x693a1b, 0x6e3c1d, 0x78401f, 0x864724, 0x925128, 0x99582b, 0x9a582b, 0x9b5b2f, 0x92552a, 0x93562b, 0x985c31, 0xa56a3e, 0x93572b, 0x975b2e, 0x9f6132, 0xa66637, 0x9e6030, 0x8c5423, 0x9e6a37, 0xa37135, 0xc59450, 0xc18f4a, 0xc18e48, 0xbd8d45, 0xb58543, 0xb7874c, 0x9d6e39, 0x7b5228, 0x542c0d, 0x5b3518, 0x7b4f2a, 0x9e6b3b, 0xb07c43, 0xb78544, 0xbb894c, 0x92673a, 0x7e552d, 0x96703a, 0xa2804e, 0x4a2507, 0x8f6a39, 0xd4a253, 0xcf9a48, 0xc28e43, 0xb18843, 0x6d4d27, 0x4d1d00, 0xa88341, 0xe0b765, 0xcda05e, 0x795329, 0x85603a, 0x9b7345, 0xa27845, 0xb98b4a, 0xc6974e, 0xc39247, 0xc29246, 0xc19143, 0xcb9c51, 0xc0914f, 0x82572b, 0xc3934c, 0xdfaf51, 0xe4b555, 0xe8cb81, 0xf0dfa2, 0xb28743, 0xba8744, 0xce9f56, 0xd2a454, 0xddaf5b, 0xdbab55, 0xd7a556, 0xc18f4e, 0x8f6032, 0x653a1e, 0x592a08, 0xa37739, 0xe2b362, 0xe9bc63, 0xe5b95c, 0xddb15a, 0xeac26c, 0xf1ce73, 0xf1cf7a, 0xe9cc7c, 0xceb069, 0xb68b4e, 0xaa793e, 0xab7b43, 0xa57340, 0x996a3d, 0x835830, 0x714823, 0x673712, 0x773e0e, 0x9a6123, 0xc28e43, 0xdeb262, 0xf5d181, 0xfadf8b, 0xf1de8d, 0xfaebaa, 0xfff8c1, 0xf5e0a8, 0xd6ac65, 0xc78a33, 0xca8638, 0xc6833a, 0xd2914f, 0xc98745, 0xcf8a42, 0xd38d45, 0xcd8841, 0xc17e3a, 0xbd7f43, 0xa26733, 0x955e2f, 0x8c572e, 0x82502b, 0x774926, 0x714524, 0x6b4222, 0x664021, 0x643f22, 0x633d22, 0x613c20, 0x5d391f, 0x5c381e, 0x5a361d, 0x5a351c, 0x5d3821, 0x56311b, 0x532f1b, 0x502d19, 0x4c2c18, 0x4a2b16, 0x472914, 0x442815, 0x422613, 0x412612, 0x412814, 0x39230f, 0x36200e, 0x331d0f, 0x301b0d, 0x2d1a0c, 0x2b190d, 0x2b190d, 0x27160a, 0x24150a, 0x24160a, 0x241509, 0x211308, 0x201209, 0x1f1108, 0x1d1007, 0x1b0f06, 0x1a0f05, 0x1a0e05, 0x1a0f05, 0x190e05, 0x180e05, 0x160d04, 0x150c04, 0x140b04, 0x130a03, 0x120a04, 0x110a04, 0x100805, 0x100805, 0x0d0804, 0x0b0803, 0x090803, 0x0a0702, 0x0a0602, 0x080401, 0x070401, 0x040500, 0x040500, 0x040500, 0x030400, 0x030300, 0x020200, 
-  0x020201, 0x030400, 0x020400, 0x050300, 0x070300, 0x070400, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0802, 0x0a0702, 0x0a0602, 0x0a0501, 0x0a0602, 0x0a0601, 0x0a0602, 0x0b0703, 0x0b0703, 0x0c0703, 0x0c0703, 0x0b0703, 0x0c0703, 0x0e0903, 0x110a02, 0x110a02, 0x110a03, 0x120b05, 0x120c05, 0x120300, 0x140802, 0x120c08, 0x160b07, 0x160c03, 0x180c04, 0x1b0d05, 0x1d0e07, 0x1f1008, 0x23120a, 0x221108, 0x241309, 0x27150a, 0x2a180a, 0x301c0e, 0x331c0d, 0x3a2010, 0x412512, 0x492914, 0x5b361d, 0x693c1f, 0x703d1e, 0x703d1c, 0x75401f, 0x7e441f, 0x8b4c24, 0x97552a, 0xa46030, 0xb36d3a, 0xad6934, 0xaa6633, 0xac6933, 0xb9773d, 0xc48349, 0xa96931, 0xa96a36, 0xaa6935, 0xa4642d, 0xad7338, 0xb47e41, 0xbc8947, 0xd09f57, 0xca994d, 0xc9954a, 0xcd964e, 0xd5a05a, 0xa97c40, 0x653c14, 0x4b200c, 0x58301b, 0x724c2b, 0x8c6337, 0xa1713e, 0xb38047, 0xb68345, 0xb98749, 0xb27f48, 0x7b502b, 0x643816, 0xa1793b, 0xdcb86c, 0xc7a96f, 0x472002, 0x9e723a, 0xdcaa52, 0xbf954c, 0x634627, 0x361606, 0x8f6536, 0xc59851, 0xcaa865, 0x815d35, 0x8f673f, 0x9a7240, 0xa07540, 0xbc8e4c, 0xcfa051, 0xc6954c, 0xaa7a39, 0x9e743a, 0xb88e4f, 0xae7e38, 0x9a6e3a, 0x8a5b2c, 0xd29b4b, 0xe8bb60, 0xeabb5f, 0xe4bf67, 0xf8e6a0, 0xbe9d62, 0xaa7637, 0xaf7e3e, 0xb48b42, 0xd4ad5d, 0xdcb15d, 0xeabd66, 0xeabe67, 0xcfa056, 0xa17137, 0x805629, 0x63300f, 0x956734, 0xdaad5f, 0xecc36b, 0xb69351, 0x8e652d, 0xd4ab5c, 0xe7bb60, 0xecc764, 0xf0cd77, 0xae8653, 0x99703a, 0xcaa868, 0xc59f5e, 0xbc8a4c, 0xb37e44, 0xad7b46, 0x815629, 0x663d18, 0x6a3712, 0x8a4714, 0xae6626, 0xc0853c, 0xe2b663, 0xf7d47f, 0xfadc8a, 0xf5e499, 0xfaf0b6, 0xfef3b7, 0xeccf8c, 0xd8a052, 0xd19238, 0xdc9948, 0xd89444, 0xe1a04f, 0xde9d4e, 0xcd8c42, 0xc0803d, 0xb37639, 0xa76b33, 0x9d6430, 0x965f31, 0x8d582f, 0x83512a, 0x7b4b27, 0x734623, 0x6d4321, 0x6b4221, 0x694021, 0x663e20, 0x633c20, 0x623a20, 0x60391e, 0x5f381d, 0x5b351b, 0x57321b, 0x55321c, 0x522f1b, 0x502d19, 0x4d2d18, 0x4a2a16, 0x492a18, 0x462915, 0x422712, 0x3f2511, 0x3a2211, 0x382111, 0x351f10, 0x331d0f, 0x301b0e, 0x2d190c, 0x2a170b, 0x28170a, 0x271709, 0x29180b, 0x322113, 0x24150a, 0x211308, 0x201208, 0x201209, 0x1e1108, 0x1d1007, 0x1d1007, 0x1c0f06, 0x1c0f06, 0x1a0f06, 0x170d04, 0x150c03, 0x140b03, 0x150c04, 0x140b03, 0x130a04, 0x110a05, 0x0f0805, 0x0e0905, 0x0c0904, 0x080702, 0x090702, 0x090601, 0x090502, 0x070401, 0x040500, 0x030500, 0x030400, 0x030400, 0x030400, 0x020200, 
-  0x020200, 0x030400, 0x030400, 0x050300, 0x070300, 0x080500, 0x090601, 0x0a0702, 0x0a0802, 0x0a0702, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0803, 0x0b0803, 0x0c0904, 0x0b0803, 0x0c0703, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0c0703, 0x0d0704, 0x0d0703, 0x0e0703, 0x0f0803, 0x100a02, 0x110a00, 0x110a02, 0x110a02, 0x110a03, 0x190b01, 0x4c3427, 0x301d12, 0x130904, 0x190b05, 0x180d04, 0x190d05, 0x1b0c05, 0x1e0e07, 0x1f1007, 0x221109, 0x24130b, 0x26150b, 0x27160b, 0x2b180b, 0x2e1b0d, 0x321c0e, 0x371f10, 0x3f2311, 0x462712, 0x512e16, 0x5f3519, 0x6e3d1f, 0x7a4425, 0x7c4421, 0x8e522a, 0x9f5f32, 0xa46232, 0xae6934, 0xbf793d, 0xc17c3b, 0xc88443, 0xc88344, 0xc98540, 0xc88640, 0xbf7e3e, 0xb27135, 0xa6692b, 0xc08a46, 0xc59149, 0xcc994d, 0xd19f4e, 0xd8a753, 0xd4a350, 0xe3b061, 0xc7944e, 0x966432, 0x663513, 0x64381c, 0x7b512d, 0x96693d, 0x96663c, 0x96653b, 0x916336, 0x9e6f3c, 0xa87740, 0xac7c44, 0xa3733a, 0x9a713a, 0x614110, 0x572a00, 0x89601f, 0xe2bf7a, 0xa48957, 0x552800, 0xc69654, 0x9c7745, 0x452912, 0x8f6940, 0xb48245, 0xbc9054, 0x835e35, 0x9c7140, 0xa37741, 0xb1834b, 0xbf914b, 0xcf9f4f, 0xc49445, 0xb98848, 0x895b2a, 0xa07b43, 0xf0d694, 0xb69860, 0x875624, 0x673d19, 0x8b5b2a, 0xc19145, 0xe4b75e, 0xe7ba5b, 0xd2b368, 0xa47a47, 0x9b6d38, 0x7b4f1e, 0xe0c58a, 0xf8e19b, 0xca9f56, 0xe1b461, 0xecc468, 0xefc76d, 0xd8aa5d, 0xbc894b, 0x9d6d3d, 0x6c3914, 0x92622b, 0xe0b666, 0xf5d585, 0x977a47, 0x623913, 0xc6a059, 0xdfb15a, 0xa37738, 0x5b2400, 0xd5b975, 0xfbe9a0, 0xf8e39e, 0xcfa969, 0xbf8947, 0xcd9756, 0xba8549, 0xab7942, 0x9b6a39, 0x875224, 0x8c501e, 0xa15e22, 0xb06b26, 0xd59e50, 0xf2cb74, 0xfad97e, 0xf7db81, 0xfdebaa, 0xfff7c5, 0xfaecb2, 0xe5c37c, 0xe0a84f, 0xe6a54a, 0xe8ab53, 0xe1a64f, 0xd39844, 0xc78c40, 0xc08442, 0xb5783a, 0xb4793d, 0xa97039, 0x99622f, 0x935f2e, 0x87552a, 0x7c4c26, 0x774b25, 0x744826, 0x714523, 0x6d4221, 0x6a3f21, 0x673d20, 0x673e20, 0x6a4225, 0x5d371c, 0x59351b, 0x57341e, 0x54321e, 0x53301c, 0x512f1a, 0x4e2d18, 0x4c2c1a, 0x482b18, 0x432714, 0x3f2412, 0x3c2313, 0x392112, 0x372010, 0x341e10, 0x321b0e, 0x2e190c, 0x2a180b, 0x2a180b, 0x28180a, 0x281708, 0x2b190c, 0x25150a, 0x221408, 0x221309, 0x211309, 0x21130a, 0x201209, 0x1f1209, 0x1e1108, 0x1c0f06, 0x190f05, 0x180e05, 0x170e05, 0x160d04, 0x160d03, 0x150c03, 0x130a03, 0x120b06, 0x100906, 0x0e0905, 0x0c0804, 0x090702, 0x090702, 0x0a0601, 0x090401, 0x060401, 0x040500, 0x030500, 0x030400, 0x030400, 0x020300, 0x010100, 
-  0x030200, 0x040301, 0x030200, 0x040400, 0x050400, 0x080401, 0x080502, 0x080703, 0x090802, 0x0b0803, 0x0c0904, 0x0d0805, 0x0f0904, 0x100903, 0x0f0903, 0x0d0802, 0x0d0803, 0x0d0804, 0x0e0804, 0x0f0804, 0x0f0603, 0x0e0603, 0x0c0703, 0x0c0703, 0x0c0704, 0x0c0703, 0x0d0803, 0x0d0802, 0x0e0902, 0x100901, 0x110a01, 0x110a02, 0x110a02, 0x120b05, 0x110904, 0x180a02, 0x483122, 0x2d1a0e, 0x130b05, 0x180c03, 0x1a0d05, 0x1a0d05, 0x1b0d05, 0x1c0e05, 0x1f1007, 0x211109, 0x221008, 0x27150b, 0x2a180c, 0x2c190b, 0x2d1a0c, 0x321c0f, 0x381f10, 0x3e210f, 0x432612, 0x4c2b16, 0x5c3419, 0x6d3c1d, 0x794223, 0x824722, 0x9e5e34, 0xa76435, 0xa86634, 0xb16b35, 0xc67d3e, 0xd28e47, 0xe0a45a, 0xd7964d, 0xda964a, 0xdc984c, 0xc17d36, 0xcf9448, 0xe0aa57, 0xd09c4b, 0xc59245, 0xd6a654, 0xe8ba64, 0xe3b15c, 0xd8a456, 0xca9656, 0x87531f, 0x733f17, 0x7c4b27, 0x9a6a3f, 0x9a6a3b, 0x98693b, 0x99683c, 0x99693d, 0x93683a, 0x926739, 0x906438, 0x7c532a, 0x886236, 0xaa8552, 0xb6935d, 0xb18d50, 0x8e5c25, 0xcba55e, 0xcdb272, 0x5c360d, 0xbd9460, 0x674426, 0x8c6940, 0xaf7f45, 0xa4763e, 0x845c33, 0x956c3e, 0xa0743f, 0xb6884a, 0xc6974f, 0xca9b4b, 0xcc9d4d, 0xc19245, 0xb7883f, 0x8c6032, 0x6e3f00, 0xd2b97e, 0xefe0a8, 0xad844a, 0x896333, 0x4b2410, 0x7f5528, 0xe5be6c, 0xe4c375, 0x7a4e1c, 0xa3713c, 0x805022, 0xaf9155, 0xfdeaa6, 0xc1a76f, 0xb78543, 0xd5a559, 0xddb15d, 0xe7bc67, 0xe7ba66, 0xdcac5c, 0xc99756, 0xa1703f, 0x6e3c11, 0x986d2d, 0xe3bf6f, 0xecd78b, 0x825c29, 0x603510, 0xc79955, 0xa67639, 0xb5874b, 0xd4a759, 0xc59a50, 0xb38543, 0xa26f2b, 0xb98848, 0xc39352, 0xbf8a4a, 0xc89253, 0xcb9659, 0xb58248, 0x96632e, 0x834c1e, 0x8f501b, 0xb76e2c, 0xca8938, 0xe6b55e, 0xfbd176, 0xfcdf86, 0xf9e9a4, 0xfef7c6, 0xfff6c7, 0xf4d899, 0xebbb5f, 0xecb554, 0xe5af52, 0xdca64b, 0xd19a47, 0xca9146, 0xc0863f, 0xba7f3c, 0xb07639, 0xa46b34, 0x9b632e, 0x935e2d, 0x89582c, 0x81522a, 0x7b4d28, 0x784926, 0x744624, 0x704322, 0x6d4120, 0x6e4021, 0x6a3e21, 0x5f391d, 0x5a361d, 0x59351f, 0x57331d, 0x55321c, 0x54311b, 0x512f1a, 0x4c2d18, 0x482c19, 0x462816, 0x432614, 0x3e2314, 0x381906, 0x341907, 0x341e10, 0x311a0c, 0x2f180b, 0x2b170b, 0x2a1809, 0x29170a, 0x28170b, 0x25140a, 0x26160a, 0x251508, 0x25140a, 0x25140a, 0x25140a, 0x231309, 0x21130a, 0x1f1109, 0x1c0d06, 0x1b0f06, 0x1a0f05, 0x190e05, 0x190e05, 0x180d04, 0x150c03, 0x140b02, 0x130b04, 0x110a04, 0x0e0804, 0x0c0703, 0x0a0702, 0x090601, 0x090601, 0x080401, 0x050501, 0x040500, 0x040500, 0x030400, 0x030401, 0x030301, 0x010100, 
-  0x030301, 0x040301, 0x040300, 0x030400, 0x040500, 0x060400, 0x090502, 0x090603, 0x090703, 0x0b0803, 0x0d0904, 0x0f0905, 0x110a04, 0x120a04, 0x120a04, 0x110a04, 0x110a04, 0x110a04, 0x120a05, 0x120a05, 0x130a05, 0x120905, 0x100905, 0x100905, 0x100904, 0x0f0703, 0x0e0903, 0x0f0903, 0x100902, 0x100901, 0x110a02, 0x110a02, 0x120b03, 0x130b05, 0x130a06, 0x120c08, 0x110400, 0x160a03, 0x140d09, 0x190d06, 0x1b0d05, 0x1c0d06, 0x1c0e06, 0x1d0f06, 0x1e1108, 0x251308, 0x382418, 0x281304, 0x29170a, 0x2b180a, 0x2e1b0d, 0x331d0f, 0x381e0f, 0x3c2111, 0x402412, 0x482712, 0x5b3318, 0x7b4b2e, 0x774322, 0x8e542f, 0x905026, 0x9f5b2e, 0xa96533, 0xb87339, 0xcf8a45, 0xe0a250, 0xe9b55d, 0xe3ab53, 0xe4a14f, 0xd59142, 0xd29a45, 0xeab75c, 0xd9a64b, 0xd6a349, 0xe5b55d, 0xd6a753, 0xd4a253, 0xb98645, 0x8a5524, 0x81461e, 0x945a2e, 0x9f693a, 0xa77544, 0xa2713d, 0xa57341, 0x986c38, 0x956837, 0x976b3e, 0x8a5e36, 0x7f562d, 0x805a2f, 0x76512c, 0x6e4823, 0x724a26, 0x7a552f, 0xc4a361, 0xcba769, 0xa98241, 0xd9bb7a, 0x927445, 0x82603d, 0x5d3a1c, 0xb2854b, 0xc3944f, 0x9c7544, 0x825e38, 0x936a37, 0xbb8e4c, 0xc89951, 0xc99a4a, 0xd0a151, 0xbf9044, 0xc39345, 0xc39442, 0x9c7138, 0x5b2a00, 0x946f45, 0xf0dba6, 0xa88a57, 0x9a723a, 0x7e5631, 0x6d4112, 0xceab5c, 0xd4b86c, 0x946b3c, 0xa47438, 0x6a3900, 0xdfbe70, 0xf3df93, 0x9f7840, 0xb5894a, 0xdfb165, 0xdcad5d, 0xd6a95d, 0xedc56d, 0xe6bd63, 0xe2b460, 0xc69451, 0x906136, 0x541f00, 0xa57a37, 0xf2d984, 0xd7c17b, 0x632e00, 0x90672e, 0xd6ac62, 0xf2c674, 0xdaaa5b, 0xb5803a, 0xc69e5e, 0xe3c781, 0xeacf88, 0xeacb86, 0xc7974e, 0xd8a75e, 0xcd9b53, 0xd29e59, 0xc99555, 0xac7a3e, 0x935c28, 0x96541f, 0xae672b, 0xc27a2d, 0xd49b4a, 0xf2ce76, 0xfee592, 0xfbe79f, 0xfcf0b7, 0xfff8cb, 0xfce9b1, 0xefcb75, 0xe8b94d, 0xe5b254, 0xdea952, 0xd5a24a, 0xcc9846, 0xc48e40, 0xbb843c, 0xb17a3a, 0xa87035, 0xa06a31, 0x96632f, 0x8d5c2d, 0x87552a, 0x814e26, 0x7c4a26, 0x764725, 0x724423, 0x704123, 0x6a3e20, 0x653d20, 0x5f3a20, 0x5b371e, 0x5a351d, 0x58341b, 0x57321c, 0x53301c, 0x4f2f1a, 0x4b2c18, 0x482816, 0x422615, 0x42230d, 0x734b2f, 0x67442b, 0x311705, 0x321c0f, 0x301a0d, 0x2e1a0d, 0x2d190b, 0x2c190c, 0x2a180b, 0x29180b, 0x28170a, 0x28160a, 0x28160a, 0x27150a, 0x26150a, 0x251409, 0x221309, 0x201209, 0x1d0f07, 0x1d1007, 0x1d1007, 0x1c0f06, 0x1c0e06, 0x1a0e06, 0x180e05, 0x150c04, 0x140c05, 0x100a04, 0x0d0804, 0x0c0703, 0x0a0702, 0x0a0702, 0x090601, 0x080401, 0x050501, 0x040500, 0x030400, 0x030400, 0x030401, 0x020201, 0x010100, 
-  0x030300, 0x040300, 0x040300, 0x040400, 0x040500, 0x050501, 0x080401, 0x0a0502, 0x090702, 0x0c0904, 0x0f0a04, 0x120a05, 0x130b04, 0x140b04, 0x140a04, 0x140a04, 0x140b04, 0x140b04, 0x140b04, 0x130a04, 0x130a04, 0x130a04, 0x130a04, 0x130a05, 0x120a04, 0x110a03, 0x110a04, 0x110a04, 0x110a03, 0x110a02, 0x120a03, 0x110a02, 0x120b03, 0x130a05, 0x130a06, 0x130c07, 0x150c04, 0x170c04, 0x180b04, 0x1c0d05, 0x1c0d06, 0x1d0e07, 0x1d0f07, 0x1e1007, 0x1d1007, 0x28170a, 0x523c2f, 0x443124, 0x2a1708, 0x2d190b, 0x2f1b0d, 0x321c0f, 0x371d0e, 0x3b2111, 0x3e2412, 0x472711, 0x562f14, 0x6f4326, 0x703e1d, 0x824a26, 0x905129, 0xa15f30, 0xaf6c37, 0xc07b3d, 0xd79549, 0xecb25a, 0xf9c466, 0xe8ac51, 0xd49e48, 0xe9bf68, 0xf3ce6f, 0xf0ca69, 0xedc365, 0xe2b256, 0xdea854, 0xbc8341, 0xa06734, 0x7d4a1f, 0x825028, 0xaa743e, 0xca9053, 0xb27a40, 0xb47f48, 0xa9753e, 0xa16b3e, 0x8c5932, 0x875428, 0xa37240, 0x9f7037, 0xb08044, 0xbc8c4c, 0xbc9450, 0xb38f4f, 0x9c743e, 0x7e5326, 0x623708, 0xb39562, 0xae8b56, 0xc7a967, 0xc2a66c, 0x481a00, 0x7f582c, 0xc6934d, 0xc39657, 0x967048, 0x73502f, 0xa37944, 0xcb9b53, 0xc39446, 0xc4954a, 0xb5873f, 0xae7f3a, 0xb9883f, 0xce9c4d, 0xaa7f3d, 0x6c4624, 0x693f19, 0x9b774a, 0x684018, 0x9f7036, 0xca9e5a, 0xdab36b, 0xd7ac5c, 0xd9ac58, 0xeac57e, 0xcbb17a, 0x6f4a2a, 0x977234, 0xd5b56c, 0xb68447, 0xc19454, 0xc99b55, 0xc89950, 0xd3a756, 0xe9c16b, 0xecc56f, 0xf0c469, 0xddad59, 0xbc8b4d, 0x855730, 0x6d3c06, 0xcfaa59, 0xf9e895, 0xb39158, 0x632800, 0xd0aa69, 0xedcb73, 0xe2bd6a, 0xeace85, 0xddc27f, 0xb29054, 0xa57939, 0xb88b46, 0xcc9b50, 0xdbab5e, 0xd6a656, 0xd4a151, 0xdda859, 0xd59f54, 0xc18b49, 0xac763a, 0x9c6127, 0xa86226, 0xc17831, 0xd2943f, 0xf1c873, 0xffe59c, 0xfdeca6, 0xf9eeb0, 0xfef5ce, 0xfef1c2, 0xf5d68e, 0xe9bf5e, 0xe6b64f, 0xe2af51, 0xdba84f, 0xd29f48, 0xc89442, 0xbf8a3e, 0xb68039, 0xac7634, 0xa16e30, 0x98652d, 0x95602e, 0x955e31, 0x8a532b, 0x824f28, 0x784825, 0x724423, 0x6e4122, 0x6a3f21, 0x643c21, 0x603b21, 0x5e371d, 0x60381d, 0x5b361e, 0x55321e, 0x502f1a, 0x4d2c18, 0x492916, 0x432716, 0x43220a, 0x7d5335, 0x724c32, 0x341905, 0x341e10, 0x331c0d, 0x321b0d, 0x311b0d, 0x2f1a0c, 0x2d190b, 0x2c190b, 0x2c190b, 0x2c190b, 0x2a180b, 0x29170a, 0x271609, 0x251508, 0x231307, 0x211107, 0x1f1108, 0x1f1108, 0x201209, 0x1f1108, 0x1e0e07, 0x1b0d06, 0x180d05, 0x150b04, 0x130b05, 0x0f0a04, 0x0d0803, 0x0c0703, 0x090601, 0x090601, 0x090501, 0x080401, 0x040400, 0x040500, 0x030400, 0x030400, 0x030301, 0x020201, 0x010100, 
-  0x030300, 0x040200, 0x040300, 0x050400, 0x050500, 0x050601, 0x060501, 0x090502, 0x080602, 0x0c0804, 0x0e0802, 0x120a04, 0x140a03, 0x160c03, 0x160c04, 0x170b04, 0x180b04, 0x170c04, 0x160c04, 0x150b03, 0x130a02, 0x150a03, 0x170a04, 0x150a04, 0x140a03, 0x120a02, 0x120a03, 0x120a04, 0x120b04, 0x120b05, 0x120b04, 0x130b04, 0x130a04, 0x140b06, 0x140b06, 0x160a04, 0x160c05, 0x170d04, 0x190c03, 0x1c0d06, 0x1f0e07, 0x1e0e07, 0x1c0d05, 0x1f1208, 0x1f1208, 0x221107, 0x251005, 0x342013, 0x311b0e, 0x2e180b, 0x301b0e, 0x331c0f, 0x381e0f, 0x3c2110, 0x3f2410, 0x50321c, 0x64412a, 0x5b3013, 0x6c3d1d, 0x7c4724, 0x90532a, 0xa46432, 0xb47139, 0xc58040, 0xd89649, 0xebb158, 0xedb75b, 0xe0a94e, 0xebbc60, 0xedc76a, 0xf0ce6e, 0xf4d16e, 0xf7cc6d, 0xf0bd61, 0xd69d4f, 0x9e6334, 0x77421e, 0x88572e, 0xa87645, 0xb07c42, 0xb27d3e, 0xa36c37, 0x976031, 0x9c6532, 0x9e6733, 0xbb8644, 0xb17939, 0xab763c, 0xa9763e, 0x9c6b36, 0x916534, 0x936e37, 0xbc9758, 0xdfb66e, 0xc09b59, 0x926838, 0x6b4620, 0x8f6d42, 0xc0a067, 0xb59c66, 0x5c3617, 0x986d34, 0xd1a15e, 0xa9814e, 0x8f673b, 0x91693a, 0xb68a48, 0xcf9f50, 0xbe8f46, 0xa2743a, 0x91642f, 0x8b5f24, 0xd7bb7d, 0xc8a562, 0xb18441, 0x7e542e, 0x78542f, 0x84562f, 0xad813d, 0xe5b766, 0xbc9554, 0x91713e, 0x835f32, 0x7a541e, 0xa18146, 0xefd494, 0xead79e, 0x9a7d4c, 0x9e6d2e, 0xb48247, 0xc59457, 0xad7d40, 0xbf995e, 0xd2a963, 0xdbad5b, 0xedc46d, 0xebc268, 0xe1b35d, 0xdeab5e, 0xba874a, 0x72421e, 0x9f6f34, 0xecd27c, 0xe9cf86, 0x895a27, 0x784f24, 0xe2c276, 0xcda758, 0xdbb46e, 0xae7936, 0xa86826, 0xb57c3b, 0xc39752, 0xd7b26a, 0xdcbc6f, 0xdebe6e, 0xdfbb6b, 0xdab05e, 0xd6a14d, 0xdea556, 0xd7a256, 0xcc9550, 0xbc8141, 0xb87434, 0xc88037, 0xd49744, 0xefc374, 0xfde196, 0xfeeba6, 0xfdeeb3, 0xfdf7c8, 0xfff9cd, 0xf6e2a2, 0xebc569, 0xecbe5e, 0xe6b75a, 0xdfae52, 0xd7a54b, 0xce9a46, 0xc58e3f, 0xb98339, 0xae7934, 0xa56f32, 0xa36a34, 0xae7342, 0x975c2e, 0x8c572b, 0x7e4e26, 0x764825, 0x734524, 0x704425, 0x673f22, 0x643c22, 0x62391e, 0x734d30, 0x5d3920, 0x53321d, 0x4f301b, 0x4c2c18, 0x492914, 0x452815, 0x412614, 0x3f1d05, 0x3c1e07, 0x382112, 0x381f10, 0x361c0d, 0x341c0f, 0x341d0f, 0x331d0f, 0x321c0e, 0x301b0c, 0x301a0c, 0x2e1a0c, 0x2c190b, 0x291709, 0x29180a, 0x271609, 0x251508, 0x241409, 0x24140a, 0x22140a, 0x21130a, 0x201209, 0x1d0e07, 0x1b0c05, 0x180b05, 0x140a04, 0x110a04, 0x0e0904, 0x0c0703, 0x0b0703, 0x0a0601, 0x090601, 0x080400, 0x070300, 0x040400, 0x040500, 0x030400, 0x040400, 0x040301, 0x040301, 0x030200, 
-  0x030401, 0x030301, 0x040301, 0x060300, 0x050300, 0x050500, 0x060300, 0x090401, 0x090602, 0x0b0804, 0x0d0804, 0x110904, 0x150a03, 0x180c04, 0x1a0e05, 0x1b0e05, 0x1c0e05, 0x1c0f06, 0x1b0e05, 0x190d05, 0x180d05, 0x190d05, 0x1a0d04, 0x190d04, 0x180c04, 0x160c03, 0x150c03, 0x150b03, 0x140c05, 0x140c05, 0x130b04, 0x140b03, 0x140b04, 0x150c06, 0x150c06, 0x160b05, 0x160c07, 0x180d05, 0x1a0d04, 0x1c0e07, 0x1f0e08, 0x27160d, 0x34241c, 0x22120a, 0x22140c, 0x21130a, 0x26150b, 0x2a1609, 0x2f1a0c, 0x31190d, 0x341b0e, 0x341c0f, 0x4a2d1b, 0x462915, 0x412410, 0x4a2a15, 0x56331b, 0x5e351a, 0x6d3d1e, 0x7d4825, 0x90542b, 0xa36432, 0xb67139, 0xc78141, 0xde9a4e, 0xe4a550, 0xdfac51, 0xf1c164, 0xdca94e, 0xeabb60, 0xf8d170, 0xf2c865, 0xe3ae51, 0xd99f4e, 0xb57f3f, 0x895328, 0x976739, 0x996a3c, 0x946233, 0xa26e3b, 0xa46f3a, 0x8f592f, 0x8e5a2a, 0xbb8346, 0xc7914c, 0xd6a55a, 0xce9a5e, 0x9a6b3f, 0x704522, 0x5d361a, 0x4d290c, 0x4c2912, 0x442005, 0x815e32, 0xc39f5e, 0xd3b26e, 0x96733c, 0x572a00, 0xbb9a62, 0x997b4a, 0x835a32, 0xbf934b, 0xd2aa6b, 0x9b7242, 0x9a7039, 0xb48749, 0xd1a353, 0xcc9d4b, 0xae7e3d, 0x85572e, 0x8d6435, 0xc69a50, 0xf5df97, 0xc6b078, 0xa47637, 0x7f5327, 0xa98154, 0x7b532d, 0xb78d4a, 0xc29b59, 0x5d300f, 0x6a4321, 0x6f4c2e, 0x503119, 0x2a0000, 0x765328, 0xead493, 0xe1ca8c, 0xaa7b42, 0xa17339, 0xa4773a, 0x986d37, 0xeed492, 0xf3e7ab, 0xccaa64, 0xdbac57, 0xf0c36a, 0xe3b85d, 0xe8b764, 0xd39e56, 0xab7840, 0x632700, 0xcaa55a, 0xfdea9b, 0xc8a461, 0x8a6031, 0xdbb372, 0xbd8d42, 0xc58b46, 0xb8813a, 0xcea55b, 0xf0d282, 0xfde58e, 0xf1d67b, 0xe9cb71, 0xf9df86, 0xffed99, 0xfbeb9b, 0xecd283, 0xddb05f, 0xdda552, 0xe5af63, 0xe1ab65, 0xd29954, 0xc0803c, 0xc88539, 0xdda146, 0xe9b95e, 0xfcdc92, 0xfeeeaa, 0xfbf0b7, 0xfdf5ca, 0xfffad2, 0xfbe9b0, 0xf4d17a, 0xefc462, 0xecbe62, 0xe3b459, 0xdbaa4e, 0xd19d47, 0xc79142, 0xc28b40, 0xbd8441, 0xac7036, 0xa36731, 0x9e6230, 0x925a2e, 0x87542b, 0x7e4d27, 0x774826, 0x724626, 0x6c4020, 0x673b1c, 0x633b21, 0x5f391e, 0x58341c, 0x54321d, 0x502f1b, 0x502d17, 0x4d2a13, 0x462815, 0x402616, 0x3e2313, 0x3b2313, 0x3a2213, 0x3b2010, 0x3a1f0f, 0x391e0f, 0x391f10, 0x381f11, 0x361e10, 0x341d0f, 0x321c0e, 0x301b0d, 0x2d190b, 0x2a180a, 0x2a1709, 0x291509, 0x28170b, 0x28170b, 0x28160b, 0x25160b, 0x22140a, 0x201209, 0x1c0f07, 0x190d05, 0x160b05, 0x120a03, 0x100a05, 0x0d0804, 0x0c0703, 0x0b0602, 0x0a0602, 0x080401, 0x070400, 0x080401, 0x040400, 0x040400, 0x040400, 0x040300, 0x040300, 0x040301, 0x020200, 
-  0x030301, 0x030301, 0x050402, 0x060401, 0x050400, 0x060501, 0x070401, 0x080401, 0x080501, 0x090603, 0x0b0704, 0x0f0904, 0x130903, 0x160b03, 0x1b0e06, 0x1e1006, 0x1f1005, 0x1e0f05, 0x1d0e05, 0x1d0f06, 0x1d0f07, 0x1d0f07, 0x1c0e05, 0x1c0e05, 0x1c0e05, 0x1a0d04, 0x1a0e05, 0x180d04, 0x170d04, 0x160c04, 0x150c04, 0x150c03, 0x150b03, 0x150b04, 0x160b05, 0x170c03, 0x170d04, 0x190f06, 0x190f07, 0x1a0e07, 0x1d0e06, 0x28160d, 0x38281f, 0x211008, 0x22140b, 0x23140a, 0x27160a, 0x2b180b, 0x2e1b0d, 0x331d10, 0x361e0e, 0x301a08, 0x5e4431, 0x573b29, 0x40210e, 0x4a2a15, 0x532f17, 0x60371c, 0x6f3f1e, 0x7f4926, 0x91552b, 0xa36231, 0xb6723a, 0xc68040, 0xc7883c, 0xeabc65, 0xe9bc61, 0xe2b054, 0xe7b75a, 0xf0c265, 0xf3c566, 0xf4c164, 0xe0a34e, 0xaa6927, 0x98602f, 0x976537, 0x9b6d40, 0x80522b, 0x8b592e, 0xba8349, 0xbb823f, 0xb58240, 0xcf9b57, 0xbe894a, 0xcba15f, 0xd9b772, 0x845c34, 0x744a27, 0x81562a, 0xa17a45, 0xa27c46, 0x956d41, 0x816138, 0x4d3010, 0x3e1500, 0xbba265, 0xcfb476, 0x75471b, 0xb79058, 0x937342, 0x996d3b, 0xe1b76a, 0xc6a163, 0x966b3b, 0xb18448, 0xc59451, 0xd2a254, 0xbe9049, 0x8e6432, 0x886330, 0xd2a760, 0xc89747, 0xe7c77e, 0xe2d399, 0x7f572c, 0x613917, 0x815634, 0x774b1b, 0xc9a05e, 0xe1c483, 0xa97f44, 0xb38247, 0xae814a, 0x926d42, 0x5a3520, 0x7b541f, 0xdfbf71, 0xab8748, 0xa9773d, 0x9b6f38, 0x926436, 0xa0743b, 0xe8c46b, 0xead48e, 0xeddb9a, 0xbb934f, 0xdaac58, 0xeec265, 0xdfb159, 0xe1ac5e, 0xc6924d, 0x74431b, 0x93652b, 0xf8e39a, 0xe3ca84, 0x9a6c2e, 0xf1d087, 0xcea35c, 0xac7633, 0xd5ac60, 0xf8d67c, 0xeacc7a, 0xc59f5a, 0xa26b29, 0x9c5d12, 0xab7a30, 0xcfae5c, 0xf5d983, 0xffef98, 0xf8e794, 0xe7cc7d, 0xe5b567, 0xe7b668, 0xe6b669, 0xd9a863, 0xcf9553, 0xd28f45, 0xdb9e4b, 0xe8b95f, 0xf8d987, 0xffeca8, 0xfeeeb2, 0xfef5c5, 0xfffcd3, 0xfdeeb8, 0xf7d585, 0xf2cc6f, 0xedc166, 0xe8b65c, 0xddab51, 0xd49e49, 0xcf9746, 0xc78c43, 0xb77b3b, 0xae7238, 0xa56933, 0x965d2f, 0x8d592b, 0x855127, 0x7d4b26, 0x764723, 0x804f2d, 0x906240, 0x643a1d, 0x5d381f, 0x58341d, 0x55321c, 0x512d19, 0x5a3520, 0x6a4733, 0x452613, 0x422514, 0x402412, 0x3e2311, 0x3e2311, 0x3d2210, 0x3d2210, 0x3d2110, 0x3c210f, 0x3b2010, 0x392011, 0x361e10, 0x331d0f, 0x311b0d, 0x301a0d, 0x2e190c, 0x2d180b, 0x2c180c, 0x2b180c, 0x2b190c, 0x29170a, 0x261609, 0x221409, 0x1e1108, 0x1b0e06, 0x170c04, 0x140b03, 0x100a03, 0x0e0904, 0x0c0703, 0x0b0703, 0x0a0702, 0x090601, 0x080401, 0x080401, 0x080401, 0x050400, 0x050400, 0x040301, 0x040200, 0x040300, 0x030300, 0x010100, 
-  0x040300, 0x040300, 0x050401, 0x050400, 0x050400, 0x050501, 0x060501, 0x080501, 0x090601, 0x080703, 0x0a0704, 0x0e0803, 0x110902, 0x120a02, 0x180d04, 0x1e1007, 0x231107, 0x221107, 0x201006, 0x211106, 0x221107, 0x211107, 0x1f1007, 0x1f1007, 0x1f1007, 0x1f1007, 0x1e1007, 0x1d1006, 0x1c0f06, 0x1a0e05, 0x190d04, 0x1a0d04, 0x180d04, 0x180d05, 0x170c04, 0x190d05, 0x1a0e06, 0x1c0e06, 0x201007, 0x221208, 0x1d1007, 0x201006, 0x1f0e03, 0x221309, 0x25150b, 0x27160a, 0x29170b, 0x2b190b, 0x2f1b0e, 0x331d0f, 0x371f0f, 0x3c210f, 0x422510, 0x3f220e, 0x432715, 0x4a2b16, 0x553119, 0x623a1d, 0x714120, 0x824b27, 0x93562b, 0xa56332, 0xb6713a, 0xb16e2d, 0xc59144, 0xe5ba63, 0xe3b459, 0xe7b85b, 0xedc15f, 0xe9b859, 0xe9af59, 0xdc9e4f, 0xe1a156, 0xbc7f40, 0xa16e3d, 0x926335, 0x8b5f32, 0x7a4e2b, 0x643511, 0xaa7a47, 0xd19e5a, 0xc39753, 0xa87a4a, 0x8e6431, 0xd8b675, 0x8c6538, 0x71421b, 0xa48151, 0xd6b473, 0xd3a761, 0xbf9051, 0xb3905c, 0xb19565, 0xaa8c5e, 0x5f4325, 0x442600, 0xd4bb81, 0x9a7a4d, 0x9a7340, 0x7c5b2e, 0xb0864b, 0xeccb81, 0xb28e52, 0x8e6232, 0xc09352, 0xc5954f, 0xc3924a, 0xa2733e, 0x885d30, 0xbf924d, 0xa3783c, 0xa57438, 0xc79848, 0xe9d58e, 0xc9b57c, 0xa0743c, 0xb28547, 0xaf7e38, 0xe6bf67, 0xfbec9e, 0xddc380, 0xb48040, 0xb38348, 0x996f44, 0x754721, 0xc08d40, 0xebc269, 0xdeb569, 0xaf8043, 0x885a2b, 0x8f6034, 0xcfaa5d, 0xf0d47e, 0xe8cd81, 0xcfb977, 0xead38d, 0xcca356, 0xe9b967, 0xdfae60, 0xe0ad5f, 0xdca85c, 0xa67643, 0x824600, 0xdfc381, 0xf5e49d, 0xa87b3c, 0xebce81, 0xb38745, 0xcea863, 0xfdda87, 0xcda559, 0x9d6921, 0xa16521, 0xb57f36, 0xbc833d, 0xad712d, 0xa3621a, 0xb47932, 0xe6c971, 0xfdeb94, 0xfbe89b, 0xf7e397, 0xe7c477, 0xeabb70, 0xe6bd74, 0xeac279, 0xdba55f, 0xd29549, 0xdfa44a, 0xecba5b, 0xf5d27c, 0xfbe9a0, 0xfef0b0, 0xfef3c2, 0xfffad4, 0xfef3cb, 0xf8e09d, 0xf4d075, 0xf2c56a, 0xecbc5f, 0xe2b154, 0xd9a24d, 0xd09645, 0xd2964d, 0xbf8340, 0xae7237, 0xa06733, 0x966030, 0x8c582b, 0x835027, 0x7b4a23, 0x7c4b27, 0x815130, 0x663b1e, 0x5f391f, 0x59361c, 0x56341b, 0x53301b, 0x532e18, 0x54311c, 0x482915, 0x442714, 0x432612, 0x422613, 0x412512, 0x412512, 0x412411, 0x402411, 0x3f2411, 0x3e2311, 0x3b2111, 0x381f10, 0x351d0e, 0x331c0d, 0x321c0d, 0x321c0e, 0x321c0d, 0x301c0d, 0x2e1a0b, 0x2c1a0b, 0x2a180a, 0x26170b, 0x211309, 0x1e1008, 0x1a0e06, 0x160b04, 0x130a02, 0x0f0a03, 0x0d0904, 0x0c0703, 0x0b0803, 0x090702, 0x090601, 0x080401, 0x070300, 0x070300, 0x050400, 0x050400, 0x050401, 0x040300, 0x040300, 0x030401, 0x010100, 
-  0x050401, 0x050401, 0x050401, 0x050402, 0x050501, 0x040600, 0x070601, 0x090601, 0x090602, 0x090804, 0x0a0804, 0x0d0803, 0x100903, 0x120a04, 0x160c04, 0x1d0f06, 0x221107, 0x251408, 0x261509, 0x261408, 0x251306, 0x251407, 0x261408, 0x251408, 0x251307, 0x241206, 0x231307, 0x221207, 0x211107, 0x1f1107, 0x1e0f06, 0x1e0f06, 0x1c0e05, 0x1b0e05, 0x1a0e05, 0x1b0e09, 0x1c0f0a, 0x1c0903, 0x3e281f, 0x493329, 0x190b03, 0x1f1208, 0x211208, 0x221309, 0x2a190e, 0x322115, 0x2a1709, 0x2c190b, 0x301b0d, 0x361c10, 0x381b0b, 0x61412e, 0x563725, 0x40220f, 0x472916, 0x4e2c16, 0x5a3419, 0x663b1d, 0x754321, 0x874e28, 0x995b30, 0xa56538, 0x9d5922, 0xc68e4b, 0xd5a153, 0xdfa853, 0xe6b55b, 0xe5b559, 0xefbc60, 0xe6ae5a, 0xbe7f3b, 0xa76626, 0xc38749, 0xab7540, 0x92653a, 0x8d6034, 0x966b3a, 0x815832, 0x6b4528, 0x583216, 0x6c4823, 0x583d1e, 0x612f0d, 0xbb965a, 0xb18f59, 0x6b3a19, 0xb38c55, 0xc6a060, 0xd2af6d, 0x906834, 0x714819, 0x9b7d4e, 0xa28452, 0x9c825b, 0xa5895e, 0x613f21, 0x90774c, 0xbba16e, 0x916d41, 0x76552e, 0xbf9857, 0xebd08a, 0xa98349, 0xa0733f, 0xca9d56, 0xcf9e52, 0xc19145, 0x9a6d35, 0x7b5228, 0x744c25, 0x44210b, 0x5a3919, 0xac7a39, 0xc7994c, 0xddc078, 0xdca85a, 0xdaad54, 0xe0b45b, 0xefc464, 0xf3da87, 0xffefa8, 0xb4995f, 0xa97b42, 0x94693c, 0xb98c4d, 0xdea854, 0xd8a554, 0xf1c972, 0xf0c96f, 0xe4b766, 0xeac676, 0xf2cf72, 0xf4d786, 0xfce9a4, 0xa08956, 0xa08354, 0xc19759, 0xcb9d4e, 0xe3b662, 0xdfb15c, 0xe1af5d, 0xc59253, 0x8b4e17, 0xc09b5c, 0xfdeea6, 0xbb9757, 0xd8b36a, 0xa67634, 0xf6d382, 0xd1ad63, 0x995a1b, 0xb98842, 0xddbb68, 0xefd57c, 0xedc970, 0xebc56c, 0xd9af5b, 0xbc8233, 0xb5792b, 0xefd67c, 0xead283, 0xe9d38b, 0xfdf1a6, 0xedd68e, 0xe9c579, 0xf2c77a, 0xeebf75, 0xe3ae60, 0xdba151, 0xe3aa53, 0xecbb59, 0xf5ce75, 0xfee8a1, 0xfdf1b6, 0xfef4c4, 0xfff9d7, 0xfff5cf, 0xf9e4a0, 0xf7d57d, 0xf1c86a, 0xebbe5e, 0xe4b255, 0xdda64e, 0xdfa654, 0xc98e42, 0xb77d3a, 0xa96f36, 0x9e6731, 0x925d2d, 0x87542a, 0x7d4f29, 0x754827, 0x6c3f1f, 0x653d22, 0x60391f, 0x5b371d, 0x57341b, 0x532f19, 0x512d17, 0x4d2b16, 0x4b2b17, 0x482914, 0x462914, 0x452913, 0x442712, 0x442712, 0x442712, 0x422611, 0x402511, 0x3f2411, 0x3d2211, 0x3b2010, 0x381e0d, 0x361e0d, 0x361e0d, 0x351e0e, 0x351e0e, 0x331d0f, 0x301c0e, 0x2d1a0b, 0x29170a, 0x24150a, 0x201208, 0x1c0f07, 0x180d06, 0x150a04, 0x120c03, 0x0e0a03, 0x0c0903, 0x0b0703, 0x090702, 0x070702, 0x080601, 0x070300, 0x080300, 0x070400, 0x050400, 0x050400, 0x050401, 0x040300, 0x030300, 0x030401, 0x020200, 
-  0x060402, 0x050402, 0x050402, 0x050402, 0x050602, 0x050601, 0x060601, 0x090702, 0x0a0702, 0x090803, 0x090703, 0x0c0903, 0x0f0903, 0x120a04, 0x150a04, 0x1a0d04, 0x1f1005, 0x241207, 0x271509, 0x291608, 0x2a1709, 0x2a1809, 0x2a1809, 0x2b1809, 0x291708, 0x281708, 0x281609, 0x271509, 0x261509, 0x241409, 0x231208, 0x221107, 0x211107, 0x1f1107, 0x1d1007, 0x1e0f03, 0x170700, 0x1d1108, 0x221209, 0x241308, 0x201209, 0x21130a, 0x231309, 0x251309, 0x271305, 0x301d0f, 0x2d1a0c, 0x2e1b0d, 0x311c0d, 0x351e10, 0x3a2010, 0x4d2c18, 0x472814, 0x452715, 0x4c2b16, 0x5a361f, 0x60361a, 0x6e3f1f, 0x7b4722, 0x8e522a, 0x97592e, 0x804113, 0xb17f41, 0xdaa75d, 0xd7a24f, 0xd9a550, 0xdfa953, 0xdfaa4f, 0xd69b4b, 0xb07232, 0xa0622b, 0xa96f3a, 0x9e6934, 0x8a5c2e, 0x795029, 0x885c33, 0x936a40, 0x7a532f, 0x704a28, 0x855c38, 0x865c3a, 0x5b3c24, 0x8e6130, 0xdab678, 0x906b3a, 0x643a16, 0xc1965a, 0xcb9f58, 0xe2bc74, 0xb08548, 0x6d4725, 0x3a1500, 0x78582b, 0xa4804b, 0xa4875b, 0x95774b, 0x593715, 0xbb9b6a, 0x97724b, 0x6d4c2a, 0xc59e5b, 0xe0c787, 0xa67e45, 0xa87b41, 0xd8aa5f, 0xdcad5d, 0xd2a350, 0xc1944d, 0x956c38, 0x765130, 0x482b12, 0x6a411c, 0xb98747, 0xc38d3c, 0xc1913a, 0xe4b458, 0xe0b05e, 0xcda258, 0x937233, 0x927239, 0xc3a770, 0xa98751, 0xa77941, 0x80542b, 0xa7814e, 0x815c2d, 0x8c6132, 0xb89050, 0xe1b661, 0xefc063, 0xf4d070, 0xf4d26f, 0xf5df87, 0xeadb9a, 0x8c612e, 0x895429, 0xa9773c, 0xdeb364, 0xf4ce75, 0xefc76e, 0xe7b762, 0xd2a059, 0x9d6434, 0xa97a3a, 0xf8e6a0, 0xcaad6b, 0xce9b5a, 0xbd914b, 0xe5be72, 0x935c1f, 0xb68644, 0xeec770, 0xeec96d, 0xecc56a, 0xdeb052, 0xdfb458, 0xf4d983, 0xe6c67c, 0xb87d32, 0xcda256, 0xf9e798, 0xcca758, 0xddba6d, 0xf5e7a0, 0xf8e39f, 0xf2cb7e, 0xf0c879, 0xedc273, 0xe5b564, 0xe0ab56, 0xe6b057, 0xefbf5f, 0xf4ce75, 0xfde79e, 0xfff0b8, 0xfef1c2, 0xfdf9d4, 0xfff6cf, 0xfce6a6, 0xf7d57e, 0xf2c867, 0xe9bc5a, 0xe3b053, 0xdaa34d, 0xce9547, 0xc28941, 0xb27838, 0xa56c33, 0x97622f, 0x8c572a, 0x815129, 0x774a26, 0x6f4322, 0x673e22, 0x623b20, 0x5c371d, 0x59361c, 0x553119, 0x522f1a, 0x4e2e19, 0x4d2d17, 0x4b2c16, 0x4b2b16, 0x4b2c17, 0x4a2b16, 0x492a15, 0x492a15, 0x442812, 0x402610, 0x3f2410, 0x3e2310, 0x3d2210, 0x3b210f, 0x3b2110, 0x3b2110, 0x39210f, 0x361f0f, 0x341d0f, 0x311c0e, 0x2c190c, 0x271509, 0x221308, 0x1e1107, 0x190d05, 0x160c05, 0x140b04, 0x110b02, 0x0d0a02, 0x0c0903, 0x0b0703, 0x090803, 0x070601, 0x080601, 0x080401, 0x080401, 0x080401, 0x050400, 0x060501, 0x040401, 0x040300, 0x030300, 0x030401, 0x030301, 
-  0x040500, 0x040500, 0x050501, 0x060501, 0x060500, 0x060500, 0x080500, 0x0a0701, 0x0b0802, 0x0b0802, 0x0b0702, 0x0c0703, 0x0e0903, 0x110a02, 0x140b03, 0x180c03, 0x1c0e05, 0x1f1006, 0x241308, 0x291608, 0x2e190a, 0x2f1a0a, 0x301a0c, 0x30190b, 0x301a0c, 0x2f1a0c, 0x2d190a, 0x2c180a, 0x2a180a, 0x29170a, 0x281609, 0x271407, 0x261508, 0x241408, 0x221307, 0x28150b, 0x493428, 0x251408, 0x1f140d, 0x231308, 0x241409, 0x241308, 0x221307, 0x2d1b11, 0x473327, 0x2d1707, 0x301b0e, 0x321c0d, 0x3c2614, 0x39210f, 0x3c2110, 0x583c25, 0x4c2e17, 0x4c2a15, 0x582f18, 0x6a4127, 0x663b1c, 0x744221, 0x854f28, 0x8a4f28, 0x895428, 0xb98748, 0xb48240, 0xbe8c3e, 0xce9b49, 0xc18a41, 0xd19749, 0xd2994e, 0x9a5e26, 0x965d2a, 0xa4703b, 0xa37140, 0x9b6b3b, 0x8d6235, 0x8c6337, 0x966d3d, 0x966d3f, 0x7c5330, 0x704d2c, 0x76512e, 0x8d6542, 0x6b4826, 0xaa7f46, 0xe3c585, 0x956e39, 0x784f26, 0x6e431a, 0x966a35, 0xeacd89, 0xd0ae6e, 0x976a31, 0x654423, 0x482519, 0x7b582e, 0xbb955c, 0xb5955d, 0x694926, 0xad905c, 0x866642, 0x4e2200, 0xc29e5a, 0xe1c789, 0xae884a, 0xb58545, 0xd0a158, 0xdbad5b, 0xd9ac57, 0xc39449, 0xa1783e, 0x67441e, 0x80572e, 0xbf9050, 0xd09d4f, 0xca9b48, 0xdcb368, 0xb99353, 0x78522a, 0x8e6338, 0x9f7844, 0x845d31, 0xa1723d, 0xbf9050, 0xcd9e5b, 0xb88b53, 0x6d421b, 0x5f3b18, 0x65411f, 0x4d2813, 0x5c3611, 0xb78e4f, 0xdcb05d, 0xe3b555, 0xf1d580, 0xf5ebae, 0xbba174, 0x9b672a, 0xb48647, 0xeabf6d, 0xf4d178, 0xf6d073, 0xecbe68, 0xd8a55c, 0xab7742, 0xa9702a, 0xf2dc92, 0xcab174, 0xc08c49, 0xd3a458, 0xbe8b49, 0xab7532, 0xe3bb63, 0xeac569, 0xcba255, 0xc28f44, 0xb37d35, 0xa06217, 0xd3b369, 0xfef2aa, 0xd4aa62, 0xbc8036, 0xf8e398, 0xefdd99, 0xdbb066, 0xd6ac60, 0xd6ac5e, 0xe3b966, 0xf1cc78, 0xf2cb78, 0xf1c473, 0xebba69, 0xe7b561, 0xe8b55b, 0xefc063, 0xf5d179, 0xfde9a3, 0xfff2be, 0xfdf4c7, 0xfdf8d6, 0xfff6cf, 0xfae3a2, 0xf6d278, 0xedc663, 0xe7b756, 0xe1a951, 0xd29c4b, 0xca8f43, 0xd79e58, 0xb98042, 0x9b6530, 0x905b2d, 0x845329, 0x7b4c25, 0x724421, 0x6a3f24, 0x643d21, 0x5f391e, 0x5b361d, 0x58341a, 0x553218, 0x533118, 0x523018, 0x522f18, 0x512e18, 0x502e18, 0x503018, 0x4e2e17, 0x4a2b16, 0x452813, 0x422710, 0x40250f, 0x3e230e, 0x3f240f, 0x3f2410, 0x3f2311, 0x3e2312, 0x3b2111, 0x391f10, 0x351c0f, 0x2e1a0c, 0x29180a, 0x251409, 0x201208, 0x1c0f06, 0x190e05, 0x170d04, 0x140b03, 0x0f0a02, 0x0d0903, 0x0b0904, 0x080803, 0x090702, 0x090601, 0x090601, 0x080400, 0x080401, 0x080401, 0x060400, 0x050400, 0x040401, 0x030400, 0x040300, 0x040300, 0x030300, 
-  0x050601, 0x060501, 0x060501, 0x060501, 0x060500, 0x080601, 0x0a0702, 0x0b0803, 0x0b0803, 0x0b0703, 0x0c0703, 0x0d0804, 0x0f0903, 0x110a02, 0x130a03, 0x170b02, 0x1a0c04, 0x1d0f06, 0x211106, 0x261407, 0x2d190b, 0x321c0b, 0x341c0b, 0x361c0c, 0x361c0d, 0x351c0e, 0x351d0d, 0x331d0c, 0x311c0d, 0x311b0c, 0x2f190c, 0x2e180b, 0x2b170a, 0x2a160a, 0x281609, 0x2c190b, 0x503a2b, 0x2c190a, 0x24150a, 0x261306, 0x301f15, 0x322016, 0x231406, 0x2a180b, 0x3d291c, 0x321c0d, 0x321c0f, 0x341e0f, 0x39220f, 0x3a2210, 0x3c2212, 0x412611, 0x492b14, 0x502f18, 0x623a20, 0x693d1e, 0x6f401f, 0x7b4724, 0x784723, 0x592908, 0xb99156, 0xdaad64, 0xb88a45, 0xc38f45, 0xc99046, 0xc08642, 0xbe8747, 0x8a5420, 0x8f592d, 0x976436, 0x8d5f33, 0x8b5e34, 0x8a5d33, 0x8e6235, 0x8b5f34, 0x8a6236, 0x8a6436, 0x7d562f, 0x7d5a36, 0x7c5832, 0x714b2a, 0x6d4a2a, 0xad8246, 0xe1c689, 0x8d6a3d, 0x6f4c29, 0x79502e, 0x4f2800, 0xb9965d, 0xddc788, 0xa97d3d, 0x714d27, 0x785633, 0x51290d, 0x987642, 0xdab875, 0x8e6e46, 0xa48550, 0xae8c51, 0xa87e40, 0xd5b263, 0xe4cb89, 0xaa8445, 0xc1934d, 0xcfa253, 0xdeb15b, 0xd7a956, 0xc0934d, 0x7c562a, 0x714827, 0xb58745, 0xdcad5b, 0xdcb458, 0xe2ba74, 0x9c7e55, 0x4c2900, 0x9b7236, 0xcaa05f, 0xcb9f57, 0xce9c4a, 0xc59651, 0xab8042, 0xc29655, 0xcb9c5b, 0xb5874b, 0xb08548, 0x9c7344, 0x86603c, 0x83643d, 0x523212, 0x6a4316, 0xb48443, 0xe4b75f, 0xf5dd92, 0xfbf3c3, 0xc9b58a, 0xaf7f34, 0xecc36e, 0xeecb6f, 0xf2d073, 0xe8bc6a, 0xd2a059, 0xab7741, 0xb07933, 0xefd37f, 0xdfcc88, 0xa27633, 0xe3b463, 0xba7e32, 0xca9a45, 0xebc86b, 0xc59a53, 0xae742e, 0xe4b159, 0xc68940, 0xcd9c54, 0xfde99e, 0xf8e9a2, 0xe0ae67, 0xbc7f38, 0xebce83, 0xfff4b8, 0xfade93, 0xf5d17f, 0xf3ca76, 0xf4cb76, 0xf9d580, 0xfcd884, 0xf7cf7d, 0xf1c674, 0xf1c571, 0xe9bd65, 0xe9bb5f, 0xf1c767, 0xf6d882, 0xfeeaa9, 0xfef2bd, 0xfcf6cc, 0xfef8df, 0xfff7cf, 0xf7e49d, 0xf2ce70, 0xf0c15f, 0xe5b358, 0xd9a54b, 0xcf9645, 0xd0974c, 0xbb8241, 0xa46d36, 0x966030, 0x8a582c, 0x804f25, 0x804f27, 0x724422, 0x663f20, 0x633c1f, 0x5f391f, 0x5b371d, 0x59361b, 0x58341a, 0x58341b, 0x57341b, 0x56331b, 0x543119, 0x56341b, 0x53331b, 0x4b2b16, 0x472814, 0x452813, 0x442713, 0x442712, 0x432611, 0x442611, 0x422511, 0x3f2310, 0x3c2110, 0x381e0e, 0x321b0d, 0x2b180a, 0x261609, 0x211308, 0x1e1108, 0x1c0f06, 0x180d04, 0x150c03, 0x130b03, 0x0f0a03, 0x0d0904, 0x0a0803, 0x080802, 0x090803, 0x090602, 0x080500, 0x070401, 0x070401, 0x080401, 0x060400, 0x050400, 0x040401, 0x030400, 0x040300, 0x040300, 0x030400, 
-  0x050500, 0x060400, 0x070401, 0x070501, 0x090601, 0x0b0803, 0x0b0803, 0x0c0904, 0x0d0805, 0x0c0704, 0x0c0703, 0x0e0804, 0x100903, 0x120a02, 0x130a03, 0x160b02, 0x190c03, 0x1c0e06, 0x201107, 0x251407, 0x2a1709, 0x2f1a0a, 0x351d0b, 0x3a1f0e, 0x3a1e0d, 0x391d0d, 0x3a1e0c, 0x3a1f0e, 0x391f0e, 0x381e0d, 0x361c0c, 0x351c0d, 0x331b0d, 0x321b0d, 0x30190b, 0x2c1809, 0x271201, 0x28180a, 0x2b1c11, 0x2b1a0e, 0x2b180b, 0x372418, 0x281809, 0x2a180a, 0x2f1a09, 0x362010, 0x351e0f, 0x382110, 0x39210f, 0x3c2311, 0x3d2413, 0x432713, 0x513016, 0x5a3213, 0x764928, 0x794621, 0x804923, 0x7b4823, 0x4c1f00, 0x70522e, 0xa87d44, 0xcd9b51, 0xc6954d, 0xb57f3d, 0xce964e, 0xb58141, 0x6c3913, 0x7b4c26, 0x8b5d33, 0x895e34, 0x8d6236, 0x855b2f, 0x956a3b, 0x9b6d3a, 0x906434, 0x885f35, 0x8d653c, 0x7c542b, 0x704b27, 0x75502d, 0x7b572f, 0x613d1d, 0xae7f3f, 0xe0c683, 0xa4895b, 0x46240c, 0x614024, 0x51310b, 0xcdaf76, 0xdbc791, 0xc49b5f, 0x77532f, 0x9f7a47, 0x754f2b, 0x603c18, 0xc9a25e, 0xc59b56, 0xc1934c, 0xd4a959, 0xc0994f, 0xad8e51, 0x947e54, 0xa68047, 0xcba052, 0xd8ac57, 0xe2b45c, 0xc7994a, 0xa57b3f, 0x936f43, 0xb88c55, 0xc99b52, 0xefc46f, 0xecc875, 0xad9263, 0x69431d, 0xbc8b4b, 0xd7a44d, 0xdcb963, 0xe5ce8d, 0xccad6d, 0xc99e50, 0xbc8e4d, 0xae8147, 0xb28847, 0xb78e4f, 0x946b40, 0x71451f, 0xbb9847, 0xf2d37f, 0xdec892, 0x6d5b44, 0x4d2000, 0xcca156, 0xe8bd5b, 0xe4cb88, 0xf9f1c2, 0xc6a263, 0xdbb15b, 0xf5d374, 0xfbdc80, 0xf3cd7b, 0xd6a75d, 0xaa753a, 0x9d672a, 0xe0b96b, 0xfee794, 0xecd27c, 0xf6d577, 0xca9c48, 0xe0b661, 0xd9b05f, 0xa96f32, 0xe4b763, 0xdfab53, 0xb67933, 0xe6c36e, 0xf9ed9e, 0xdcbc72, 0xe5b56e, 0xc79248, 0xe9c673, 0xfdefab, 0xf0cd7f, 0xf4cb78, 0xf5cb77, 0xf6cf78, 0xf8d47d, 0xfcda83, 0xf8d57f, 0xf2cd77, 0xf4cd79, 0xf3cc7a, 0xedc26e, 0xf0c366, 0xf8d075, 0xfad989, 0xfde8a6, 0xfff3c6, 0xfcf7d4, 0xfefbdd, 0xfef7d0, 0xf7de96, 0xf1cb65, 0xe9bf5c, 0xe1af53, 0xd6a249, 0xc99140, 0xbc813c, 0xaf7639, 0x9d6730, 0x905c2c, 0x865325, 0x9c673c, 0x804f29, 0x6f4422, 0x6a3f1e, 0x663b1d, 0x633b1e, 0x61391e, 0x5f371e, 0x5e371d, 0x5b371c, 0x59351c, 0x57331b, 0x553218, 0x523017, 0x4d2c15, 0x4a2b16, 0x492a15, 0x492915, 0x492a15, 0x482914, 0x462712, 0x442611, 0x3f230f, 0x3b200e, 0x361c0d, 0x2e190b, 0x281709, 0x221408, 0x201207, 0x1d1007, 0x1a0e05, 0x160c03, 0x140b04, 0x120a03, 0x0e0903, 0x0c0904, 0x0a0803, 0x090802, 0x080702, 0x080601, 0x070601, 0x060501, 0x070501, 0x080401, 0x060300, 0x040300, 0x040402, 0x040400, 0x040300, 0x040300, 0x030400, 
-  0x040500, 0x070400, 0x080401, 0x090501, 0x0a0702, 0x0b0803, 0x0c0804, 0x0d0804, 0x0c0703, 0x0c0703, 0x0e0802, 0x100902, 0x110a02, 0x130a03, 0x130a03, 0x150b02, 0x180c03, 0x1b0f06, 0x1e1006, 0x231306, 0x281608, 0x2c1809, 0x321b0c, 0x3a1f0e, 0x3d200e, 0x3d210d, 0x3e200d, 0x3f210d, 0x3e210d, 0x3c210c, 0x3c210d, 0x3b200e, 0x3b200e, 0x3a1f0e, 0x391e0e, 0x371c0c, 0x311c0e, 0x2a190c, 0x2b1a0e, 0x2a1a0d, 0x2b190a, 0x2e180b, 0x2d1b0c, 0x301d0e, 0x321d0e, 0x341d0e, 0x381e0e, 0x3c2211, 0x3f2413, 0x412612, 0x412812, 0x4b2b16, 0x8a6143, 0x764726, 0x71401c, 0x7a441d, 0x824b27, 0x6c4420, 0xa38251, 0xac824c, 0xaf7e3f, 0xc8954b, 0xb88140, 0xb7823e, 0xaf8044, 0x653816, 0x754c29, 0x825830, 0x754e26, 0x794f2c, 0x86572c, 0xa0713e, 0x9f743f, 0x956b37, 0x8b6033, 0x8b6039, 0x885d35, 0x82582b, 0x78522c, 0x6f4a26, 0x876238, 0x815a30, 0xbf8948, 0xaf8d53, 0xd6b77f, 0x8c6d3d, 0x725229, 0x906d41, 0xc3a46c, 0xbe9f6b, 0xb7955f, 0x754f2e, 0x8c663a, 0x876033, 0xb4864b, 0xdaaa5e, 0xd1a256, 0xb48b4c, 0x916e38, 0x6f4d27, 0x613e21, 0x87653a, 0xb78c4b, 0xd3a753, 0xdbad57, 0xdfb15c, 0xba8d49, 0x7e5421, 0xc49e63, 0xcea35a, 0xeeca78, 0xedc973, 0xe9cb8b, 0x5b4331, 0x9a763f, 0xae7e3f, 0xb78840, 0xdaad56, 0xedcc7e, 0xf6e7ab, 0xdbc080, 0xc2944a, 0xae8143, 0xa47a45, 0x775025, 0xa57a44, 0xcf9f4f, 0xf1c96b, 0xf9dc7f, 0xfdeba6, 0xead9a8, 0x614427, 0xa57e46, 0xf1c36b, 0xdaab52, 0xf4e7b4, 0xe1cd9a, 0xd6aa55, 0xecc76b, 0xf9da7c, 0xfadc84, 0xefc670, 0xbf8b4a, 0x632c00, 0x885d2a, 0xba9855, 0xe9c774, 0xf8da7d, 0xf1d074, 0xf0d177, 0xc19849, 0xa66621, 0xe9c174, 0xe3b362, 0xaa7227, 0xe6c06e, 0xf2e18f, 0xddb165, 0xe6b56b, 0xc49146, 0xf2d789, 0xfbeda3, 0xebc26d, 0xf1c36c, 0xf5c770, 0xf0c46b, 0xf4cc73, 0xffdd83, 0xfcda7f, 0xfbd87f, 0xf2cd77, 0xf3cd7a, 0xf7d081, 0xf2ca78, 0xf3ca73, 0xf8ce76, 0xf8d785, 0xfee8a9, 0xfef3bb, 0xfdf6cc, 0xfffbdc, 0xfff5c8, 0xf5dc8c, 0xedc65e, 0xe9bb59, 0xeec05f, 0xdda850, 0xc3883c, 0xb87f3b, 0xa97334, 0x98652e, 0x8f5b2c, 0x885226, 0x7d4a24, 0x74441f, 0x7d4a2a, 0x804f2f, 0x6f3f1f, 0x693c20, 0x653a20, 0x62391f, 0x5f381d, 0x5c371c, 0x59351b, 0x573318, 0x533116, 0x502e17, 0x4f2e17, 0x4e2e16, 0x4d2d16, 0x4d2d16, 0x4b2a15, 0x472712, 0x422410, 0x3c200e, 0x371d0d, 0x311a0c, 0x2b180a, 0x251608, 0x211408, 0x1e1207, 0x1c0f06, 0x180e04, 0x150b03, 0x130a03, 0x110a03, 0x0d0a04, 0x0c0904, 0x0b0803, 0x090800, 0x090701, 0x090601, 0x090601, 0x080501, 0x080401, 0x080401, 0x060300, 0x040300, 0x040402, 0x040401, 0x040300, 0x040300, 0x030400, 
-  0x060501, 0x080401, 0x090501, 0x090602, 0x0a0803, 0x0c0904, 0x0d0905, 0x0d0804, 0x0e0805, 0x0f0903, 0x110902, 0x120a02, 0x130a02, 0x130a02, 0x140b03, 0x170c03, 0x190e04, 0x1c1007, 0x1e1006, 0x221104, 0x251506, 0x291709, 0x2f190c, 0x351d0d, 0x3c200e, 0x41230f, 0x44230f, 0x452410, 0x442410, 0x432410, 0x42240f, 0x422410, 0x42240f, 0x41230f, 0x452713, 0x5c3d2b, 0x3b200f, 0x331b09, 0x3f2919, 0x331e11, 0x301b0d, 0x382112, 0x3d2516, 0x351e0d, 0x362010, 0x381f10, 0x3a2010, 0x3d2312, 0x412614, 0x472914, 0x4c2c13, 0x512f18, 0x653b1d, 0x6d3d1d, 0x73411f, 0x794825, 0x532409, 0x7a5c35, 0xd2a969, 0xb5823e, 0xba8844, 0xb78743, 0xbf8c42, 0xa7773a, 0x5c2f09, 0x6b4527, 0x734d2a, 0x7b532f, 0x79512c, 0x714528, 0x7a4b27, 0xc79752, 0xe1b362, 0xdbb163, 0xd3aa64, 0xb6884a, 0xa97f3d, 0xd5ae6e, 0x8f6c3e, 0x65411c, 0x724e2c, 0x9b7037, 0xc69454, 0x58310d, 0x997a4d, 0xc19b65, 0xb08b4a, 0x8d6834, 0x734b25, 0x7a562c, 0x613f19, 0x866439, 0xb79253, 0xc69854, 0xbc8b45, 0xaa7c45, 0x7b532e, 0x4f2d12, 0x684726, 0x997342, 0xa77f47, 0xb78b4c, 0xc6974d, 0xd9ab56, 0xdcaf56, 0xdcae5c, 0xb28646, 0x865f30, 0xdab16d, 0xc89c52, 0xe9c16b, 0xe7c56e, 0xe5cf91, 0x6f4d2c, 0x552f18, 0x3a1d0a, 0x452408, 0x845927, 0xc19749, 0xf5e3a3, 0xfdf8c7, 0xceb377, 0xb0823c, 0x7e532c, 0xa37642, 0xcc9d48, 0xf2cd71, 0xfad780, 0xcbac68, 0x846a3d, 0x8f7751, 0x724829, 0xa37a45, 0xf1ca73, 0xe1b656, 0xf3e0a8, 0xece1b6, 0xd3a553, 0xebc468, 0xfadb7d, 0xfbe285, 0xfbd87b, 0xdbac60, 0xa3753c, 0x805229, 0x622d00, 0x75430e, 0xb28a49, 0xe7c070, 0xfbde88, 0xf5df8f, 0xd2b26e, 0xbc8f48, 0xe9bd6a, 0xc39143, 0xca954d, 0xf5d382, 0xd2ab5c, 0xc7984b, 0xe7c16f, 0xffeda1, 0xfcf1ae, 0xeecd79, 0xf7cd72, 0xf3c569, 0xe8b75b, 0xecbc5f, 0xf0c669, 0xecc465, 0xf2c86a, 0xeec970, 0xeecc7a, 0xf6d685, 0xf7d483, 0xf1c876, 0xefc46d, 0xf5ca73, 0xf9d684, 0xfee7a0, 0xfef1b8, 0xfdf5ca, 0xfffcdd, 0xfef2c3, 0xf2d175, 0xefc258, 0xebbd58, 0xdda64d, 0xce9444, 0xc2883f, 0xb57c39, 0xa36c32, 0x97602e, 0x8d572a, 0x844f26, 0x9f6739, 0xa36836, 0x834821, 0x764324, 0x6f4123, 0x6e3d20, 0x6a3c1e, 0x613a20, 0x5e381e, 0x5c361b, 0x5a351a, 0x59341a, 0x58331a, 0x553218, 0x533116, 0x503017, 0x4d2e14, 0x4b2c15, 0x462813, 0x3e220f, 0x381f0e, 0x321c0e, 0x2c190b, 0x29170a, 0x241508, 0x201408, 0x1d1107, 0x1b0e06, 0x170d04, 0x140b03, 0x130b04, 0x110a03, 0x0d0904, 0x0c0904, 0x0b0803, 0x0a0802, 0x0b0702, 0x0a0702, 0x090601, 0x090502, 0x080401, 0x080401, 0x060300, 0x050300, 0x040401, 0x040400, 0x040300, 0x040400, 0x030400, 
-  0x060400, 0x080500, 0x080601, 0x080702, 0x0b0803, 0x0e0a05, 0x0f0905, 0x100905, 0x100805, 0x120903, 0x120902, 0x130a03, 0x130b03, 0x140c02, 0x170c04, 0x1a0d04, 0x1c0e05, 0x1e0e06, 0x28150b, 0x2d190d, 0x261407, 0x271508, 0x2d180a, 0x301b0b, 0x371d0c, 0x3d1f0c, 0x442310, 0x492613, 0x4a2712, 0x4a2812, 0x4a2812, 0x4c2a13, 0x4b2a13, 0x4a2914, 0x492913, 0x4b2a16, 0x402410, 0x442a18, 0x503725, 0x371f10, 0x361e0f, 0x483120, 0x523827, 0x381e0b, 0x3b2210, 0x3d2213, 0x3d2312, 0x412513, 0x462915, 0x4e2e17, 0x543115, 0x5a371e, 0x643a1e, 0x70401e, 0x7a4925, 0x55290d, 0x624a28, 0xa47f4c, 0xaf7e3b, 0xbb8942, 0xb98641, 0xbc8a42, 0xc99753, 0x7b4c20, 0x714726, 0x7e572f, 0x714825, 0x734c26, 0x855d33, 0x764c2c, 0x5d3619, 0x986830, 0xcd9b55, 0xa97e41, 0x9b753c, 0x956a35, 0xa97b41, 0xcfa763, 0xb79864, 0x664622, 0x634021, 0x926731, 0x9b7546, 0x5e462e, 0x2c1100, 0x543213, 0x5e3e1d, 0x604123, 0x603d25, 0x623e26, 0xa47d4b, 0xd7aa61, 0xdeaf69, 0x936730, 0x764b22, 0x643c1a, 0x694522, 0x6e4a26, 0x865f35, 0xaf854e, 0xa67c3d, 0xb58745, 0xcb9c50, 0xdeb05b, 0xd9ae53, 0xd4a656, 0xaf8342, 0x8d6738, 0xd7ac62, 0xbf9145, 0xac8342, 0xd9b462, 0xf5db98, 0xb79661, 0x956b3b, 0x805d35, 0x673f1a, 0x492204, 0x582600, 0xb99a64, 0xfff7c4, 0xede2b0, 0x946a30, 0x784d23, 0xc6994b, 0xe5bd64, 0xe8c87d, 0x9d7f4e, 0x79481e, 0x906333, 0x93692f, 0x7a4916, 0xc09b5b, 0xf8d47c, 0xe0b35c, 0xf2dea1, 0xefe7b7, 0xc7994a, 0xeac265, 0xf9db7e, 0xfbe285, 0xfddd80, 0xf1c871, 0xe5b564, 0xd8a55d, 0xb8864d, 0x8e6035, 0x693106, 0x834e16, 0xba914b, 0xeecf7f, 0xffeb9d, 0xebd78e, 0xd9bb70, 0xe1b065, 0xb97c2e, 0xce9a48, 0xefc670, 0xf8d47a, 0xf5cf76, 0xd5af62, 0xf1dc95, 0xf6df87, 0xf8d676, 0xdaab53, 0xe3bd6a, 0xf8e28b, 0xf2da8b, 0xf0d787, 0xf2d27f, 0xf6dd95, 0xfbefb6, 0xfaeaaa, 0xf5d386, 0xf7ce7e, 0xefc76f, 0xedc168, 0xf3c56c, 0xf5d079, 0xfce79e, 0xfef1b7, 0xfcf7cd, 0xfffcdc, 0xf9e7ac, 0xe9c35e, 0xe8b852, 0xdfa74a, 0xd69c47, 0xc88d40, 0xbb803a, 0xad7336, 0xa16832, 0x965e2c, 0x8c5426, 0xb37843, 0xbb7d41, 0xb17546, 0x7d4622, 0x764521, 0x844e2c, 0x8b5837, 0x643a1e, 0x63391e, 0x613a1b, 0x60381c, 0x60361b, 0x61371a, 0x62381b, 0x573218, 0x512f16, 0x4c2d12, 0x482a13, 0x412410, 0x3a200d, 0x341d0d, 0x2f1b0d, 0x2a170b, 0x271609, 0x241409, 0x1f1208, 0x1c0f07, 0x1b0d06, 0x170c03, 0x130b02, 0x130c04, 0x100a03, 0x0e0903, 0x0b0802, 0x0b0803, 0x0a0702, 0x0b0602, 0x0b0602, 0x090601, 0x080501, 0x080401, 0x070300, 0x070300, 0x050400, 0x050400, 0x040400, 0x030400, 0x030400, 0x030400, 
-  0x070300, 0x090601, 0x0a0702, 0x0b0803, 0x0d0905, 0x0f0a04, 0x0f0903, 0x110904, 0x120905, 0x120902, 0x130a01, 0x140b02, 0x160c04, 0x170d04, 0x190d04, 0x1c0e05, 0x1d0f06, 0x1e0e05, 0x28160c, 0x2e1a0f, 0x251207, 0x261408, 0x291709, 0x2c190a, 0x301a09, 0x381e0c, 0x3e210e, 0x452511, 0x4d2913, 0x522c14, 0x542c13, 0x542d14, 0x522d14, 0x512d16, 0x4e2c15, 0x4d2a12, 0x482a15, 0x472913, 0x432610, 0x3f2613, 0x3d2513, 0x3e230f, 0x3f1e08, 0x40230f, 0x402311, 0x422614, 0x432614, 0x472914, 0x4d2d16, 0x553318, 0x5a371d, 0x643a1e, 0x75401e, 0x7f4d28, 0x5e310b, 0x917b53, 0xe5c786, 0xb98b45, 0xad7832, 0xb07938, 0xc28e46, 0xcc9b58, 0x7f5326, 0x7b5132, 0x78512d, 0x7e5931, 0x7b512d, 0x76502b, 0x7c572f, 0x6e4a29, 0x55341d, 0x7d4f21, 0xc29957, 0x7d5e3a, 0x634c34, 0x573c1f, 0x411e05, 0x5e3d19, 0x9a7a4c, 0x906a3c, 0x714d2c, 0x462306, 0x866338, 0x906e45, 0x694b2c, 0x6c4f2f, 0x66492c, 0x5b3d29, 0x856538, 0xc69d54, 0xd5a658, 0xb8884a, 0x8a6038, 0x654323, 0x7a542f, 0x835a32, 0x8f653a, 0x8f6638, 0x916936, 0x9e723b, 0xc09455, 0xcc9f56, 0xc89a49, 0xdaae57, 0xddb358, 0xd1a354, 0xb58848, 0x79542b, 0xb28440, 0xcd9e58, 0x624626, 0xb78e4d, 0xf3cf83, 0xead38f, 0xaa8955, 0x986b3b, 0xb79d6d, 0x977b53, 0x421900, 0x612d00, 0xdec58c, 0xfff6b8, 0xb49865, 0xb3833e, 0xe4bb59, 0xeaca7c, 0x765731, 0x6a3e1e, 0x96693a, 0x8f5e30, 0xa36f3b, 0xa4723c, 0xe5bf71, 0xf7d37f, 0xb88c46, 0xd5c287, 0xefdfa5, 0xc69646, 0xeac165, 0xf9da7d, 0xfbe083, 0xfbda7b, 0xf0c86d, 0xeec16a, 0xedbf69, 0xe2b060, 0xd7a35d, 0xc69758, 0x9c6d3d, 0x81420e, 0x9d6423, 0xd7af67, 0xfae28e, 0xfde999, 0xecd187, 0xd1a75e, 0xc89244, 0xd69f4c, 0xd2a148, 0xc68d38, 0xc88530, 0xd7a954, 0xf5cf71, 0xe7b75a, 0xc28c36, 0xe4c572, 0xfff6a3, 0xfff9b3, 0xfef9b1, 0xfef1a6, 0xfef4b3, 0xfcf8bf, 0xf4e3a0, 0xefca7b, 0xf9d283, 0xf7d282, 0xecc36a, 0xeab65d, 0xedbd5f, 0xf3cf75, 0xffe79c, 0xfdf0b4, 0xfcf7cc, 0xfff6d3, 0xf6e19d, 0xebc05f, 0xe6b04d, 0xdda448, 0xcf9543, 0xc2883c, 0xb57b39, 0xac7238, 0x9f652f, 0x94592b, 0x8b5226, 0x905424, 0x985a30, 0x8d512d, 0x824b26, 0x7d4823, 0x7a4725, 0x6c3e1e, 0x6a3e1f, 0x683f1f, 0x663d1e, 0x66391a, 0x6c3f1d, 0x835939, 0x5b3419, 0x502d14, 0x492b11, 0x432511, 0x3c2210, 0x371e0d, 0x301b0c, 0x2b190b, 0x29160a, 0x271509, 0x231208, 0x1e1108, 0x1b0e06, 0x1a0d05, 0x170c03, 0x130b02, 0x120b03, 0x100a02, 0x0e0903, 0x0d0802, 0x0b0803, 0x0b0703, 0x0a0602, 0x0b0602, 0x090601, 0x080501, 0x080401, 0x080401, 0x070300, 0x050400, 0x050400, 0x040400, 0x030400, 0x030400, 0x030400, 
-  0x080401, 0x090601, 0x0a0702, 0x0c0803, 0x0e0904, 0x0f0903, 0x100902, 0x120903, 0x130a04, 0x130a02, 0x140b01, 0x160c03, 0x190d04, 0x1b0d05, 0x1b0e05, 0x1d0f06, 0x1d0f06, 0x1d1006, 0x1e1205, 0x211306, 0x221309, 0x241409, 0x281608, 0x291809, 0x2e190a, 0x341d0d, 0x391e0d, 0x3f220e, 0x4a2711, 0x542b14, 0x5a2e14, 0x592f14, 0x582f15, 0x572f16, 0x562f16, 0x562f15, 0x543018, 0x542e16, 0x522e14, 0x4b2b15, 0x472a14, 0x45270f, 0x5c3c29, 0x563724, 0x52331e, 0x4c2b15, 0x51301a, 0x543019, 0x573217, 0x5d371a, 0x653c1f, 0x784522, 0x874f29, 0x754727, 0x4e2500, 0xcaad70, 0xc6a060, 0xbc873f, 0xaf7a39, 0xae7838, 0xb68346, 0x7a4e21, 0x694528, 0x755334, 0x603f20, 0x6c4827, 0x7a502e, 0x734a2a, 0x6a4426, 0x6a4829, 0x56371d, 0x7f501f, 0xcda563, 0xbfa26d, 0x5c3a18, 0x886137, 0x8d6739, 0x8b6a43, 0x9e805a, 0x7c6035, 0x886b3a, 0xaa844c, 0xbb9456, 0x7f6234, 0x694931, 0x5f4429, 0x644322, 0xa98044, 0xca994e, 0xca974e, 0x946a32, 0x5b3a19, 0x6f5128, 0x855f33, 0x8d6533, 0x966d38, 0xa27841, 0x996f3a, 0x9d713a, 0xaf8246, 0xc49856, 0xddb063, 0xcc9e50, 0xd1a450, 0xdeb259, 0xd6a658, 0xbd8e49, 0x7b562a, 0x96693a, 0xca9c5e, 0x715839, 0x542e0c, 0xb18a4a, 0xeccc82, 0xefd68f, 0xe7d399, 0xe8d7a4, 0xa28250, 0x80582f, 0x471a00, 0x97743e, 0xf7dd8c, 0xe5c573, 0xe3b356, 0xf0cc6e, 0xbda062, 0x885f31, 0x946b40, 0x997445, 0xbf9453, 0xc18f4e, 0xdcad5d, 0xf2ca70, 0xe3bf77, 0x724416, 0xd6be7c, 0xe2c783, 0xbe8c3b, 0xf1c86e, 0xf9da7a, 0xf6d677, 0xf7d473, 0xf0c76b, 0xeec36b, 0xf2cb71, 0xe9bf66, 0xebba67, 0xe0ad63, 0xcd995a, 0xb27d43, 0xa16a34, 0x915011, 0xb47b38, 0xe4c272, 0xfee999, 0xf9e99d, 0xeccf83, 0xe4b865, 0xe8b667, 0xebb564, 0xd19846, 0xca8c3a, 0xd49941, 0xd89842, 0xe6b75d, 0xf2d376, 0xe4bc64, 0xeeca78, 0xeaca76, 0xedcb71, 0xf6e291, 0xfff3aa, 0xf5d585, 0xf4ca70, 0xf8d27c, 0xf6d07d, 0xf5cd77, 0xebb864, 0xe7b156, 0xecb95d, 0xf3c973, 0xfee39b, 0xfcf0b0, 0xfdf7cb, 0xfff7d0, 0xf1d58f, 0xe4b657, 0xe2ab4d, 0xd69d48, 0xc98e3e, 0xbc8039, 0xb37635, 0xb87b3f, 0xad6f39, 0x9d6231, 0x975b2b, 0x925326, 0xa06136, 0x8d532c, 0x784725, 0x734523, 0x724321, 0x6f4221, 0x6f4220, 0x6c3f1f, 0x693c1d, 0x663a1a, 0x643b1c, 0x553016, 0x4c2b14, 0x452811, 0x3f2211, 0x392010, 0x331d0d, 0x2d1a0b, 0x2a180a, 0x27160a, 0x251309, 0x221108, 0x1e1007, 0x1b0f06, 0x1a0d05, 0x170c04, 0x140c03, 0x120b03, 0x110b02, 0x0f0a03, 0x0e0903, 0x0c0703, 0x0b0704, 0x0b0602, 0x0b0602, 0x090601, 0x090502, 0x080401, 0x080401, 0x070401, 0x050400, 0x050400, 0x040400, 0x030400, 0x030400, 0x030400, 
-  0x080401, 0x080601, 0x0a0702, 0x0d0804, 0x0f0804, 0x100903, 0x120902, 0x120902, 0x120a03, 0x140a01, 0x160c02, 0x170d03, 0x1a0d04, 0x1c0e05, 0x1d0f06, 0x1e1006, 0x1f1006, 0x211208, 0x221308, 0x231309, 0x241209, 0x25130a, 0x271508, 0x291709, 0x2d180a, 0x311a0b, 0x361c0c, 0x3b1f0c, 0x44230e, 0x502913, 0x592d15, 0x5e3216, 0x5e3217, 0x5e3217, 0x5e3216, 0x5f3316, 0x5e3319, 0x61341a, 0x5f3317, 0x593217, 0x553017, 0x512f15, 0x5a3721, 0x55341d, 0x694831, 0x532f15, 0x633e25, 0x5f391d, 0x63391b, 0x683e1f, 0x71401f, 0x8e532c, 0x8e5934, 0x3f0000, 0x937346, 0xaa814b, 0xa36e32, 0xb3803d, 0xae7d36, 0xcf9e56, 0x906433, 0x5d351a, 0x724f31, 0x5f3d20, 0x674425, 0x774d29, 0x906332, 0x82582a, 0x724a29, 0x755130, 0x654428, 0x8e5f2c, 0xb38946, 0xd2b576, 0x735732, 0x927046, 0x734922, 0x936d3f, 0xc7a16e, 0xb48b51, 0xcba15c, 0xb59052, 0x7d5e35, 0x68492a, 0x574020, 0x8a6537, 0xc29153, 0xcc9950, 0x9c6e34, 0x6b4326, 0x59391d, 0x704e27, 0x825b31, 0x916734, 0xa87b42, 0xa67b49, 0x8e6538, 0x9a6f38, 0xb58a49, 0xb38849, 0xad7f3b, 0xc09245, 0xb78840, 0xc79849, 0xd0a24c, 0xcf9d4d, 0xc6954a, 0x956e38, 0x734826, 0xb28549, 0x9d7c4e, 0x1e0000, 0x391500, 0x845d33, 0xb29055, 0xbba26c, 0x8f6e45, 0xa98044, 0xae844e, 0x654425, 0x633607, 0xd9af5c, 0xecc662, 0xecc05c, 0xecce7d, 0xa9874e, 0xc49756, 0xb1854f, 0x471b00, 0x9f7a43, 0xd1a55c, 0xcda053, 0xbf9456, 0x795229, 0x531f00, 0xe6c97f, 0xd3b065, 0xce9b4a, 0xecc169, 0xf6d573, 0xf5d16f, 0xf2cb6a, 0xf1c66d, 0xe2b462, 0xe5b460, 0xdead5a, 0xe0af5e, 0xdca85b, 0xd19b50, 0xd6a055, 0xdfaa5f, 0xd09b59, 0xa96f35, 0x98560a, 0xca9e59, 0xf5da87, 0xfdec97, 0xf4e291, 0xe8c674, 0xebbe6a, 0xcf9a4a, 0xeac16e, 0xe5bd69, 0xddae5a, 0xd5a652, 0xd0a14d, 0xdead57, 0xe9bd62, 0xebb85f, 0xe4b258, 0xf7de8e, 0xfeeea1, 0xf3d07f, 0xf2c76f, 0xf2c972, 0xeec06b, 0xf2ca74, 0xf1c571, 0xe5b059, 0xdfa44c, 0xe3aa4c, 0xf0c46e, 0xffe9a4, 0xfdf4bc, 0xfef9d2, 0xfdefbf, 0xeac675, 0xe3af53, 0xdca34b, 0xd99d49, 0xc88940, 0xbd7c36, 0xcd8c4a, 0xc68447, 0xa7662f, 0xa06030, 0x985a2b, 0x96572c, 0x8f532a, 0x7f4b26, 0x7a4926, 0x7c4821, 0x784722, 0x754320, 0x704020, 0x683c1f, 0x5f371c, 0x553116, 0x4e2d16, 0x472914, 0x412510, 0x3c2010, 0x341e0e, 0x301c0d, 0x2a180a, 0x271609, 0x25140a, 0x24120a, 0x201008, 0x1d0f06, 0x1c0f06, 0x1b0e06, 0x170c04, 0x140c02, 0x120b03, 0x120a03, 0x110a02, 0x0e0903, 0x0d0804, 0x0b0603, 0x0a0602, 0x0a0602, 0x0a0702, 0x090502, 0x080401, 0x080401, 0x080401, 0x050400, 0x050400, 0x040400, 0x040500, 0x030400, 0x030400, 
-  0x090501, 0x0a0702, 0x0b0802, 0x0d0903, 0x0e0903, 0x100903, 0x120a03, 0x130a02, 0x140a02, 0x140b02, 0x150c03, 0x190d04, 0x1c0e06, 0x1d0e06, 0x1d0f06, 0x211007, 0x231208, 0x251408, 0x261308, 0x271308, 0x261408, 0x261508, 0x291709, 0x28170a, 0x2b1709, 0x30190a, 0x351b0c, 0x3b1e0e, 0x452411, 0x4b2611, 0x502911, 0x582f13, 0x613417, 0x643517, 0x643619, 0x643718, 0x663618, 0x67371c, 0x693a1c, 0x6a3a19, 0x65381a, 0x60361a, 0x593217, 0x553016, 0x542f14, 0x5b3419, 0x62391b, 0x6c3f1f, 0x714321, 0x764622, 0x824926, 0x854d28, 0x673a14, 0xa68a5c, 0xc19b68, 0x9e6b34, 0xa57437, 0xb2803d, 0xce9b4f, 0xa4783e, 0x5d3718, 0x6e4c2c, 0x5f4124, 0x6c4828, 0x79512d, 0x764b29, 0x986731, 0xad7f45, 0x845a32, 0x7c5734, 0x59351c, 0xa6783b, 0xcb9c54, 0xa2773f, 0xae9055, 0xd9bc7f, 0x59391d, 0x563718, 0x6a421a, 0x744c29, 0x674628, 0x5f4427, 0x583e26, 0x5f3e28, 0xa57e47, 0xdaa75e, 0xc69452, 0x8d6332, 0x5c391d, 0x5f4025, 0x71522b, 0x835d34, 0x916738, 0xa47942, 0x9a7042, 0x7c572a, 0xb37f47, 0xbf904d, 0xc69f59, 0xddbd7b, 0xd8bd7e, 0xb58c44, 0xba893e, 0xcf9b4b, 0xcb9a48, 0xbf8f41, 0xbd8c44, 0xb08444, 0x6f4b23, 0x7c4f26, 0xa77a43, 0x856035, 0x5e4126, 0x3e1502, 0x4e2503, 0x61330d, 0xa57845, 0xbe9351, 0xc79656, 0x87653a, 0x592d13, 0xc5974c, 0xeabb58, 0xe9c05f, 0xe4cd86, 0xa87d45, 0xc29451, 0xcfa15e, 0x997143, 0x4b2008, 0x5d330a, 0x77491f, 0x7d5028, 0x81542b, 0x7c5931, 0xebce85, 0xc09449, 0xd8a856, 0xf8d276, 0xf5d373, 0xf6d372, 0xf7cf6f, 0xe7b865, 0xd6a55c, 0xcb9a55, 0xbf8c47, 0xd2a95f, 0xe6c57d, 0xe0bb74, 0xdcaa60, 0xe0a75c, 0xe6b869, 0xe9b56b, 0xc99251, 0xab6922, 0xba8035, 0xe2bd6a, 0xfdea94, 0xf8e999, 0xe6c273, 0xd19d4d, 0xc79041, 0xe7bd6a, 0xf7d77f, 0xfbe490, 0xfce99e, 0xfeeda9, 0xfde997, 0xe5b762, 0xd6ac55, 0xffed9d, 0xfeeca0, 0xf2d07d, 0xf4c972, 0xf0c671, 0xefbe6c, 0xefc470, 0xf1cb77, 0xedba65, 0xdb9d4b, 0xd89842, 0xe1a547, 0xf0cb7b, 0xfeeda9, 0xfcefb5, 0xfff5ca, 0xfbe9b5, 0xe7be68, 0xe0a74d, 0xe4a951, 0xcf9343, 0xc6873d, 0xc07e3a, 0xb57132, 0xaa6830, 0xa76533, 0x9f5d30, 0x98592d, 0x92562a, 0x8b5128, 0x874f28, 0x804922, 0x7c4621, 0x764321, 0x6e3e1f, 0x64391e, 0x5a341b, 0x533019, 0x4a2a15, 0x432613, 0x3e2311, 0x391f10, 0x311c0d, 0x2c1a0b, 0x29170a, 0x27160a, 0x24140b, 0x21130a, 0x1f1209, 0x1d1007, 0x1b0e06, 0x190e04, 0x160c03, 0x140b02, 0x130a03, 0x120a03, 0x110a02, 0x100a03, 0x0e0804, 0x0b0603, 0x0a0602, 0x0a0501, 0x0b0602, 0x0a0502, 0x0a0502, 0x080401, 0x070401, 0x050400, 0x050400, 0x030400, 0x030400, 0x030400, 0x030400, 
-  0x0a0702, 0x0a0702, 0x0c0901, 0x0d0903, 0x0e0902, 0x110a03, 0x130a03, 0x130a03, 0x140a02, 0x150c03, 0x170e04, 0x1a0d04, 0x1c0e05, 0x1d0f05, 0x201005, 0x231207, 0x251407, 0x261407, 0x271408, 0x281509, 0x281609, 0x281709, 0x281809, 0x2a180a, 0x2d180b, 0x331a0d, 0x361b0d, 0x3a1e0e, 0x482815, 0x492612, 0x4a260f, 0x4f2a11, 0x5a3115, 0x633518, 0x68381a, 0x6e3b1b, 0x713913, 0x723b16, 0x814c2c, 0x7a4422, 0x72401d, 0x6e3e1e, 0x683b1e, 0x65391f, 0x66391e, 0x6a3a1e, 0x703e1f, 0x784322, 0x7e4825, 0x854b26, 0x8a5129, 0x6a3a14, 0x7f6134, 0xe2c281, 0xaa7d3d, 0xaa773b, 0x9f6d33, 0xc08c45, 0xbb8c4b, 0x5a3417, 0x6c4e2d, 0x694928, 0x6c4525, 0x7d542a, 0x754d2c, 0x6c4221, 0xb18448, 0xb68a4f, 0x7e582e, 0x654623, 0x3e230d, 0xa2763e, 0xc29651, 0x80592d, 0xbb9d62, 0xe1cc8f, 0x4c351e, 0x2f2512, 0x3e341f, 0x4b371f, 0x604732, 0x563c2b, 0x70542f, 0xb68d4d, 0xcd9952, 0xb6894c, 0x704a23, 0x5d3920, 0x6a4623, 0x79542a, 0x846034, 0x8a6535, 0x916b3b, 0x845f2f, 0x6d431c, 0xb88a4c, 0xca9f5c, 0x82592c, 0x552d0e, 0x674915, 0xc7b27a, 0xdbbd82, 0xb28137, 0xd19e4d, 0xd4a350, 0xd3a554, 0xca9a4f, 0xbc8d47, 0x9f7440, 0x5f2e00, 0xc29a5e, 0xd9b573, 0xb99251, 0xac8448, 0xac8253, 0xb78a51, 0xbb8c4a, 0xba8946, 0xc08f50, 0x977044, 0x704a28, 0xc8984a, 0xe3b458, 0xe7c26c, 0xe6cf93, 0xb27f47, 0xb58246, 0xd19f58, 0xc69650, 0xb68952, 0x9e7141, 0xad7f44, 0xd2a35d, 0xd7a85d, 0xcca05d, 0xc7a166, 0xae7d33, 0xe6bc64, 0xfad676, 0xf3ce6e, 0xf2ca6c, 0xe8bc68, 0xc59650, 0xb18142, 0xb1803f, 0xd9ad60, 0xdbb562, 0xe4c97d, 0xf3e4a1, 0xeddda0, 0xe5b568, 0xe9ba65, 0xf2c46e, 0xefbe6b, 0xdca456, 0xc08036, 0xab6816, 0xd7a454, 0xfadf89, 0xfdee9e, 0xe9c87c, 0xdca252, 0xd09141, 0xca903d, 0xd1a250, 0xdbb468, 0xe0be74, 0xdfb769, 0xd7ad62, 0xf4e194, 0xfef1a1, 0xfcefa1, 0xf4d27e, 0xf8cc76, 0xf4ce78, 0xebc36e, 0xedbf6b, 0xf0c270, 0xecbf68, 0xe3ab5a, 0xd18e41, 0xd28a36, 0xd99c47, 0xf5d287, 0xfee89f, 0xfaecb6, 0xfffcd7, 0xf8dfa5, 0xe2ad54, 0xdfa54a, 0xda9b46, 0xd29042, 0xcd8842, 0xbf7a3a, 0xb57036, 0xae6933, 0xa56230, 0x9e5e2d, 0x985929, 0x96582b, 0x92572d, 0x824a24, 0x7a4521, 0x714020, 0x683a1d, 0x5d351a, 0x53321a, 0x4d2d17, 0x472713, 0x422512, 0x3c2111, 0x371e0e, 0x2f1b0c, 0x2b180a, 0x28160a, 0x26150b, 0x23140a, 0x21140b, 0x1f1209, 0x1d1007, 0x1c0f07, 0x180e04, 0x160c03, 0x150b02, 0x140b03, 0x130a03, 0x120b03, 0x110903, 0x0e0804, 0x0b0603, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0502, 0x0a0502, 0x090401, 0x080401, 0x060501, 0x050400, 0x040500, 0x040500, 0x030400, 0x030400, 
-  0x0a0702, 0x0b0802, 0x0d0903, 0x0e0902, 0x100901, 0x120a02, 0x130a03, 0x140b03, 0x150b02, 0x160c03, 0x180d04, 0x1b0d04, 0x1c0f04, 0x1e1005, 0x221205, 0x241306, 0x261406, 0x271406, 0x291608, 0x2a1709, 0x2a180a, 0x2a180a, 0x2b190b, 0x2e190b, 0x31190c, 0x351b0e, 0x361c0d, 0x391e0d, 0x3e200d, 0x43230e, 0x462610, 0x4a2913, 0x522d14, 0x5d3117, 0x663618, 0x703717, 0xa0643e, 0x985c34, 0x844621, 0x854824, 0x824721, 0x854d27, 0x79431e, 0x784323, 0x7a4523, 0x7a4421, 0x7e4823, 0x804822, 0x864c26, 0x935527, 0x8a5329, 0x4e1e00, 0xa5885a, 0xbd9258, 0xb27d3a, 0xa77138, 0xa16c35, 0xbd8c4b, 0x69431c, 0x5f432d, 0x583e25, 0x613f21, 0x7e552c, 0x7f5830, 0x4f2607, 0xa8864e, 0xd6b170, 0x6c4615, 0x744f2d, 0x6c4a2a, 0x482d13, 0x744b23, 0xb4894e, 0x8c663e, 0x897145, 0xd9c086, 0x50351a, 0x584229, 0x524027, 0x59432f, 0x4a3121, 0x7c5b32, 0xbc8c4d, 0xce9d57, 0xa47a43, 0x663d1d, 0x633e1c, 0x714e27, 0x8e6437, 0x966938, 0x936b38, 0x886330, 0x856233, 0x715029, 0xad8245, 0xd29c59, 0xa9834f, 0x865d38, 0x8a6439, 0x583b1e, 0x66431c, 0xdfc68f, 0xc19956, 0xd09e4d, 0xd1a24f, 0xd8aa56, 0xd3a453, 0xc89847, 0xc29348, 0x956a32, 0xab8145, 0xedc378, 0xdeb063, 0xd5a756, 0xcb9e5a, 0xc29552, 0xae8044, 0x9b713a, 0xb38f5e, 0x84603f, 0x825f36, 0xdaad5c, 0xedc873, 0xe4c77b, 0xebdda7, 0xa3763d, 0xac8756, 0xc19f6a, 0xb98844, 0xc6924d, 0xcb9a56, 0xd1a156, 0xddad5a, 0xebb864, 0xca964b, 0x8f561d, 0xcc9c54, 0xefc96e, 0xf7d474, 0xefc768, 0xecbe66, 0xd09f5b, 0x906333, 0xb38b4e, 0xe3bb6d, 0xbd9455, 0x986234, 0x8e5623, 0xba9354, 0xf2e5aa, 0xeeda9d, 0xe6b55d, 0xf2c66e, 0xf2c567, 0xefbe66, 0xedb765, 0xce934a, 0xb97528, 0xcf9441, 0xf0ce7a, 0xffeb99, 0xf2d98a, 0xe9bb6a, 0xe5af5d, 0xe3a858, 0xd99c52, 0xd89d55, 0xc68b3c, 0xeccc78, 0xeccc7f, 0xefd483, 0xfdf3a4, 0xf4d584, 0xeebf6a, 0xf6ca72, 0xf5cb70, 0xefc66f, 0xeab965, 0xf0c46c, 0xecb966, 0xdc9e54, 0xc78136, 0xd38838, 0xdfa856, 0xf8d987, 0xfbe7a2, 0xfbf6cd, 0xfff7d0, 0xf1ce88, 0xe6ad4f, 0xe3a44b, 0xd99642, 0xd18b40, 0xc8813d, 0xbb7536, 0xb36c32, 0xab6631, 0xa2612c, 0xa96937, 0x9c5c2d, 0x8b4f25, 0x7e4924, 0x734121, 0x6a3b20, 0x61361d, 0x553118, 0x4d2e18, 0x482a15, 0x432611, 0x3f2310, 0x3a2010, 0x361c0e, 0x2f1b0d, 0x2a180b, 0x27160a, 0x25140a, 0x22140a, 0x20130a, 0x1f1209, 0x1d1008, 0x1c0f07, 0x1a0e05, 0x170d04, 0x150b02, 0x150b02, 0x140b03, 0x130a03, 0x120a04, 0x0f0805, 0x0b0603, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0603, 0x090401, 0x090401, 0x080401, 0x050400, 0x050400, 0x040500, 0x030400, 0x030400, 0x030400, 
-  0x0a0702, 0x0c0702, 0x0e0802, 0x0f0801, 0x100901, 0x120902, 0x140a03, 0x150b02, 0x160c03, 0x170d04, 0x180e05, 0x1b0d05, 0x1d0e05, 0x1f0f05, 0x221106, 0x251307, 0x271507, 0x281607, 0x2a1709, 0x2b1809, 0x2b190a, 0x2d1a0b, 0x31190b, 0x331a09, 0x361c0c, 0x381d0f, 0x381d0e, 0x391e0d, 0x3c1f0d, 0x3e210c, 0x42240f, 0x482813, 0x4e2b15, 0x562d15, 0x603217, 0x6b3615, 0x935631, 0x9a5a31, 0x8d4d23, 0x904f26, 0x935127, 0xa16236, 0x9a5d32, 0x8d5126, 0x8f5228, 0x8f5228, 0x905429, 0x8e5226, 0x92572b, 0x945b2e, 0x6d3808, 0xaa956a, 0xd6b781, 0xb57c3f, 0xad7639, 0xac7535, 0xb88449, 0x7c5529, 0x5b3d25, 0x593e27, 0x50341e, 0x644224, 0x6e4b28, 0x533319, 0x684318, 0xd7b068, 0xcba965, 0x724817, 0x896032, 0x947144, 0x826a42, 0x573613, 0x7a572f, 0x704f34, 0x856d41, 0xcfb37a, 0x5a3f26, 0x583f25, 0x55412b, 0x402c1a, 0x856338, 0xb98c4d, 0xc79657, 0x875c33, 0x5f3d1f, 0x704b29, 0x7a5229, 0x9c713d, 0xaf8049, 0xa4763e, 0x936936, 0x8e6638, 0x866135, 0x88653a, 0xc89b53, 0xd6ac67, 0x8f6736, 0x865e36, 0x825c2e, 0x745029, 0x926a3b, 0xdec78e, 0xcfac6d, 0xc49243, 0xd4a655, 0xe0b35e, 0xddaf59, 0xdaab55, 0xd7a952, 0xc2964c, 0xb17f3f, 0xce9d50, 0xd5a659, 0xcc9f4e, 0xbf9248, 0xa77a40, 0xa37c48, 0xddc286, 0xd8be88, 0x62422b, 0xa07a46, 0xd7aa5a, 0xcfa554, 0xdabb75, 0xf7eab6, 0xa68556, 0xa38050, 0xf1dfa3, 0xd6bf8b, 0xa97b3e, 0xbd8d48, 0xdaab60, 0xe3b561, 0xebbc68, 0xd1a054, 0xc4954e, 0xf0c070, 0xf5ce74, 0xf4ce72, 0xedc56a, 0xe1b160, 0xbc8851, 0x78522c, 0xe1be75, 0xd7b872, 0xb78344, 0xd09c5f, 0xb2844f, 0x80440e, 0xccaa6b, 0xf9eeb4, 0xe6b969, 0xedbd64, 0xf3c76c, 0xeec168, 0xf3c46f, 0xf2c26e, 0xe1ad5c, 0xc9883b, 0xbd7624, 0xe4bb67, 0xffef9f, 0xf8e59c, 0xe6c176, 0xe7b769, 0xe9b86d, 0xe6b670, 0xd09d52, 0xf5d17c, 0xd49a4a, 0xdcb360, 0xffed98, 0xefc977, 0xe2ae58, 0xd49d48, 0xd8a753, 0xf8dc84, 0xdcb35c, 0xebba62, 0xe6b35f, 0xe1ab5b, 0xce9348, 0xc47d34, 0xcd8837, 0xdfab5a, 0xfdde92, 0xfcecaf, 0xfcf6ca, 0xfeedb9, 0xe9bd69, 0xe0a74a, 0xdd9c45, 0xd69041, 0xce873e, 0xc27c38, 0xb87234, 0xaf6b34, 0xa3632f, 0xa36434, 0x96592c, 0x844d25, 0x754522, 0x693d1e, 0x693e24, 0x663e27, 0x512d14, 0x4a2b15, 0x442712, 0x412510, 0x3d2110, 0x381e0e, 0x351b0e, 0x2d1a0c, 0x2a180b, 0x27160b, 0x24140b, 0x21130a, 0x1f1209, 0x1e1108, 0x1d1008, 0x1c0f07, 0x1a0d05, 0x190c04, 0x160b03, 0x160c03, 0x150a02, 0x140903, 0x120904, 0x100805, 0x0c0704, 0x0b0602, 0x0a0501, 0x0b0602, 0x0a0502, 0x0a0502, 0x080401, 0x080401, 0x060501, 0x040400, 0x050400, 0x040300, 0x040300, 0x040300, 
-  0x0b0703, 0x0d0803, 0x0f0802, 0x100902, 0x110a02, 0x130a03, 0x150b02, 0x150b02, 0x170c03, 0x180d04, 0x1b0e05, 0x1c0e05, 0x1e0e06, 0x211007, 0x231207, 0x251307, 0x271407, 0x281607, 0x2b1708, 0x3d2215, 0x361d10, 0x2b1506, 0x482d21, 0x523628, 0x381b08, 0x3a200f, 0x3a1f0f, 0x3a1f0e, 0x3c1f0c, 0x4b2d1a, 0x492a15, 0x452510, 0x4b2814, 0x532b14, 0x5d3117, 0x693717, 0x7f441d, 0x894920, 0x935126, 0xa66236, 0x9a562a, 0x9d5b2a, 0xb47344, 0xa15d2e, 0xa66130, 0xa56132, 0xa66232, 0xa15f2e, 0x9b6033, 0x703a14, 0x9a7a4f, 0xf2d998, 0xb6894d, 0xb67e39, 0xb07839, 0xc38c46, 0xae7f45, 0x53301c, 0x593f27, 0x4d321e, 0x5b3b23, 0x664527, 0x4e301e, 0x5f3e21, 0xa3753b, 0xc4934e, 0xbd8e46, 0xb48545, 0xb58449, 0xbd945a, 0xceb479, 0xb19566, 0x432202, 0x472300, 0xc1a260, 0xac905b, 0x745338, 0x5d4227, 0x412b1d, 0x8f6b3c, 0xcd9a58, 0xc3975b, 0x694a28, 0x5f3d23, 0x684522, 0x73512a, 0x876035, 0x956a39, 0x9b7039, 0xa57a40, 0x996e3a, 0x845e33, 0x734e27, 0x8a6438, 0xcea45b, 0xdec48a, 0x8e693c, 0x644122, 0x875e35, 0xc59a5b, 0xe1b870, 0xe6c889, 0xbf995f, 0xc7954b, 0xcb9c4d, 0xd9ac57, 0xdaac58, 0xd0a156, 0xd5aa59, 0xdeb25f, 0xcc994f, 0xc89846, 0xd9a955, 0xd8a757, 0xc69951, 0x895f33, 0xc79f5f, 0xf1dea0, 0xa78b55, 0x845a2e, 0xc49456, 0xd0a153, 0xddaf5d, 0xcba256, 0xf8e8ac, 0xd3be8c, 0x673100, 0xb19055, 0xf8e9a9, 0xd6bb88, 0xa6702d, 0xcc9d55, 0xedc46e, 0xefc56c, 0xe6b962, 0xebc068, 0xe8bc66, 0xedc16d, 0xe8be67, 0xe2ba62, 0xdeae60, 0xad7c49, 0x724e27, 0xe5c076, 0xe4cc87, 0xb78945, 0xd3ab68, 0xcb9755, 0xa1683d, 0xb18543, 0xf9e69c, 0xdfba6e, 0xecb85e, 0xf4c96f, 0xf1c770, 0xefc36e, 0xefc16c, 0xf4c671, 0xf0be6b, 0xcd873c, 0xb4691e, 0xdcb365, 0xfeeba2, 0xfaedab, 0xe6c77f, 0xebbd6e, 0xeebb73, 0xca9448, 0xf2d88a, 0xd3a95d, 0xc38636, 0xe7b963, 0xdfa951, 0xe9b25a, 0xdba551, 0xc08a31, 0xf2d981, 0xf5df89, 0xe3b55d, 0xe4af5a, 0xe2af5d, 0xdda85d, 0xc78844, 0xc4792f, 0xcf8635, 0xe8b66a, 0xffe89c, 0xfbecac, 0xfff3c3, 0xf9e19c, 0xe2ae51, 0xdea047, 0xd99641, 0xd28e40, 0xc8833c, 0xbd7838, 0xaf6d35, 0xa26332, 0x96592b, 0x8a5127, 0x7d4a24, 0x6e421f, 0x653c1f, 0x5f361c, 0x572f17, 0x5e3a26, 0x52311d, 0x432410, 0x3f2411, 0x3b220e, 0x381d0e, 0x321b0e, 0x2c1a0b, 0x29180b, 0x261509, 0x24140a, 0x21140b, 0x1f1309, 0x1f1209, 0x1e1008, 0x1c0f07, 0x1b0e06, 0x1a0d05, 0x170c03, 0x150b02, 0x150b03, 0x140a03, 0x120903, 0x100904, 0x0c0703, 0x0b0703, 0x0b0602, 0x0b0602, 0x0a0602, 0x090501, 0x080401, 0x080401, 0x060400, 0x040400, 0x040400, 0x040400, 0x040300, 0x040200, 
-  0x0e0904, 0x100903, 0x110803, 0x100802, 0x110902, 0x130a03, 0x150b03, 0x160c03, 0x170c04, 0x1a0d04, 0x1e0d05, 0x1d0e06, 0x1f0f07, 0x211008, 0x231207, 0x251307, 0x261406, 0x281508, 0x281606, 0x523426, 0x45281b, 0x2e1809, 0x3b1f12, 0x412213, 0x3c1f0c, 0x3c200d, 0x3e210f, 0x3e210f, 0x3f200c, 0x553421, 0x4f2d19, 0x452411, 0x4b2713, 0x532b14, 0x5b3016, 0x653418, 0x774220, 0x804522, 0x8c4d27, 0x97552b, 0x9a572d, 0x9e5a29, 0xa7602a, 0xb06831, 0xb66e35, 0xb7713a, 0xb87239, 0xb6733c, 0x91582f, 0x5d2100, 0xbd995f, 0xd3a863, 0xaf762e, 0xbe8744, 0xb37b3d, 0xc38e52, 0x724b20, 0x614028, 0x53381d, 0x51371c, 0x603f26, 0x5b3e20, 0x4d2e14, 0x875c2f, 0xa37238, 0x9e7038, 0x885d2c, 0x734e24, 0x5a3715, 0x623e18, 0x815a27, 0x9d7a4b, 0xc7a568, 0xd1ad69, 0xba9753, 0x6d4f2a, 0x64482b, 0x50381f, 0x7d552d, 0xca9958, 0xb78c4e, 0x643f1e, 0x664527, 0x654524, 0x634828, 0x71512e, 0x734f29, 0x7e542c, 0x805629, 0x9c6e36, 0xb28344, 0x875f2d, 0x73532d, 0x6e522f, 0xc09551, 0xe3ce96, 0x9b7f4c, 0x725030, 0x573415, 0x80592a, 0xa47e44, 0xad8752, 0xa97b3d, 0xc8994e, 0xc7974e, 0xca9852, 0xad7c3d, 0xa9763e, 0xbb8a46, 0xd2a456, 0xe1b264, 0xcb9d4e, 0xcc9b4a, 0xd6a351, 0xd1a659, 0x77552c, 0x9a753c, 0xe6cf92, 0xb29665, 0xa67b49, 0xad7c46, 0xcda154, 0xe4bb60, 0xe0b65e, 0xf7df93, 0xd7c190, 0x5e350f, 0x825a1d, 0xdfc488, 0xbe9d6c, 0xaf7d36, 0xe0b262, 0xf2ca73, 0xe6bd67, 0xe0b060, 0xe1ae61, 0xd1a256, 0xcc9d4e, 0xd3a14d, 0xd7a753, 0xd6a357, 0xbd8e55, 0x582f09, 0x9f7237, 0xe7ca7e, 0xf3de97, 0xf2d794, 0xc9944d, 0xa37141, 0xba9048, 0xfbe392, 0xd4ad60, 0xd9a24c, 0xe3b65c, 0xf0c86f, 0xf4cc74, 0xf2c56f, 0xefc26a, 0xf6cb70, 0xeeb965, 0xcd8c43, 0xb66a17, 0xd9a65e, 0xfeeaa5, 0xfbeeaf, 0xe2be7e, 0xdfac61, 0xc88c42, 0xe7c97b, 0xe4c073, 0xc47f2f, 0xd7983c, 0xe6b761, 0xf9df93, 0xfee99f, 0xf0d584, 0xe5ca74, 0xfef1a3, 0xf6de94, 0xdfb162, 0xe5b260, 0xe2b165, 0xdba35b, 0xc5803b, 0xc2752e, 0xcc883a, 0xf3cc79, 0xfee795, 0xfbecad, 0xfff2b7, 0xefca78, 0xdfa443, 0xda9a45, 0xd59140, 0xcc853c, 0xbf7b39, 0xb07038, 0x9d6030, 0x8f5429, 0x834b25, 0x774723, 0x693f1d, 0x623a1f, 0x5c361d, 0x522e18, 0x4e2d1b, 0x482916, 0x412312, 0x3c2312, 0x38220d, 0x381d10, 0x301c0d, 0x2d190b, 0x2a190d, 0x281609, 0x251408, 0x21150a, 0x201409, 0x1f1209, 0x1f1108, 0x1e0f06, 0x1b0e05, 0x1b0e06, 0x180d04, 0x160c03, 0x140b03, 0x130a02, 0x120a03, 0x110a03, 0x0c0701, 0x0a0702, 0x0b0702, 0x0b0602, 0x090501, 0x080601, 0x080500, 0x070400, 0x070301, 0x040400, 0x040500, 0x030400, 0x030300, 0x040300, 
-  0x110a04, 0x130a04, 0x130903, 0x140902, 0x140902, 0x150b04, 0x150a05, 0x160c05, 0x180d04, 0x1c0d05, 0x1f0e06, 0x1f0e06, 0x201006, 0x221007, 0x241207, 0x261406, 0x271507, 0x291609, 0x2a180b, 0x2e1606, 0x301a09, 0x301e0e, 0x391e0d, 0x3d1e0d, 0x3f210f, 0x41210e, 0x432310, 0x442311, 0x442411, 0x44230f, 0x462611, 0x482811, 0x4b2912, 0x522c13, 0x582f15, 0x603117, 0x6a381a, 0x763f21, 0x814726, 0x87471d, 0x9d582b, 0xaf6938, 0xb36a30, 0xbc7333, 0xc17738, 0xc57e3b, 0xcc8741, 0xc07f44, 0x8c5021, 0xad8956, 0xdeba79, 0xb77d3b, 0xb9823b, 0xc08b46, 0xbc8b49, 0x8b5f34, 0x684322, 0x6c4a2a, 0x664626, 0x54351d, 0x624426, 0x5a3d20, 0x956c3f, 0x9b6935, 0x8a5f36, 0x5a3a1b, 0x56361c, 0x76532f, 0x79542d, 0x6c4725, 0x7e6033, 0x492709, 0x826437, 0x8c6c3c, 0x614225, 0x64492d, 0x53391f, 0x9e7945, 0xc6944d, 0x9b6d3c, 0x593c1f, 0x684625, 0x6d4828, 0x654a2b, 0x664725, 0x835d35, 0x9a713b, 0xb68a4b, 0xb8884d, 0xb98d51, 0xb58d53, 0x946b3b, 0x77562c, 0x422a16, 0x976e32, 0xd5bc84, 0xb69e6c, 0x8d653c, 0x664c2a, 0x523018, 0x5a3314, 0x896035, 0xa7783c, 0xb38341, 0xb78843, 0xac7c42, 0x7a4c22, 0x976c38, 0xcd9e5e, 0xd1a661, 0xd2a754, 0xd3a24f, 0xc59442, 0xc69241, 0xddae5a, 0x9e7a43, 0x734c23, 0xd9ba7e, 0xa78e60, 0x431300, 0x5c341b, 0xb78a47, 0xefc569, 0xe5c167, 0xe9ce8a, 0x7c5e3b, 0x653b1b, 0x9e794c, 0xdcbe82, 0xa57434, 0xd3a153, 0xecbe64, 0xebc066, 0xe8bc6b, 0xcc9c58, 0x9f6f39, 0xb79352, 0xe7ce87, 0xeccd83, 0xd9a85a, 0xdba758, 0xcd9d5b, 0x8d643d, 0x642c00, 0xa97733, 0xd1a45e, 0xbc8d4d, 0xcd9352, 0x9e6630, 0xcca65a, 0xf3d885, 0xd8b162, 0xe4b765, 0xe8b560, 0xf3c56e, 0xefc36b, 0xebc169, 0xe9bc66, 0xecbf66, 0xf4c96e, 0xf3c070, 0xdb9c56, 0xb86d1e, 0xd29e55, 0xfbe0a1, 0xfbe7ab, 0xdcb86e, 0xc6893d, 0xbe8c43, 0xf1d585, 0xf5db8a, 0xefce74, 0xf3ca6c, 0xecca77, 0xe1c378, 0xe5c777, 0xf2d785, 0xfeeca1, 0xfff1ad, 0xf6df98, 0xe0b465, 0xe9b866, 0xe4b165, 0xd49856, 0xb56d2e, 0xb66b25, 0xd29344, 0xfad97c, 0xfde996, 0xfeeeaf, 0xfde9a6, 0xe8b85e, 0xda9d45, 0xd59140, 0xcb843a, 0xc3803e, 0xb5753d, 0x9a5d2c, 0x8a5127, 0x7d4825, 0x734424, 0x683f1f, 0x60391e, 0x59351c, 0x512f19, 0x492916, 0x422715, 0x3f2415, 0x3c2213, 0x36200f, 0x351c10, 0x31190a, 0x2d1505, 0x2a190d, 0x28180c, 0x261609, 0x22150a, 0x211409, 0x21140b, 0x201209, 0x1e1007, 0x1c0f06, 0x1b0e06, 0x180d04, 0x160d04, 0x140b03, 0x140b03, 0x130b03, 0x110a04, 0x0c0701, 0x0b0703, 0x0b0703, 0x0b0602, 0x0a0601, 0x080601, 0x080601, 0x080400, 0x060300, 0x040400, 0x040500, 0x030400, 0x020300, 0x030300, 
-  0x120a04, 0x150b04, 0x170c04, 0x180d04, 0x170c03, 0x170b04, 0x170b04, 0x180b04, 0x1a0d04, 0x1d0e06, 0x200e05, 0x200f05, 0x221106, 0x231206, 0x251307, 0x261407, 0x281608, 0x2a180a, 0x2c190c, 0x2e1b0a, 0x311c0b, 0x331e0d, 0x3a1f0d, 0x3f2010, 0x402310, 0x45220f, 0x44230f, 0x472511, 0x492713, 0x492714, 0x492813, 0x4c2912, 0x502b14, 0x532e16, 0x562e14, 0x714329, 0x6f3e1f, 0x723c1b, 0x7d3f1b, 0xa56b3c, 0xc2844a, 0xb46d36, 0xb66b31, 0xc27638, 0xc9803b, 0xd08c3c, 0xd79445, 0xb57637, 0x966128, 0xeecf86, 0xcb9f5b, 0xad753b, 0xa16b32, 0xcd9b59, 0x9c7036, 0x512608, 0x684528, 0x6d4b2b, 0x744e2c, 0x583318, 0x694c2d, 0x68472a, 0xa87c42, 0xa67a46, 0x613d20, 0x523015, 0x87673b, 0xcbad68, 0xa67a3f, 0x996738, 0xa6824f, 0x401c00, 0xa0835a, 0x785b3c, 0x654b2f, 0x51391d, 0x936c3b, 0xd19d54, 0xa4793f, 0x4b301e, 0x5b3e20, 0x68482a, 0x5b3e24, 0x725736, 0xa37849, 0xa1703c, 0xa8773f, 0xc08e4f, 0xba8746, 0xbf904c, 0xd8ae69, 0xd1b170, 0xa28553, 0x523617, 0x431600, 0xaa8a55, 0xd9bd7f, 0x9c7544, 0x986e3e, 0xa27843, 0xa77943, 0xa87d43, 0xa87b3f, 0xa9773d, 0xb58644, 0xab8149, 0x6c4c31, 0x3a1f10, 0x75532a, 0xe1c58d, 0xc6a96a, 0xbf8933, 0xcc9a46, 0xcc9a48, 0xcc9b45, 0xb18748, 0x542c08, 0xb59059, 0xa27d4a, 0x845f38, 0x1f0000, 0x8a602d, 0xebc470, 0xf6da85, 0xb69c64, 0x865a2a, 0x9b7241, 0x88633b, 0xbf9a5d, 0xc08c46, 0xe3b359, 0xe3b557, 0xf0c269, 0xe1b369, 0xa2743f, 0xa07740, 0xf1d68c, 0xbba46c, 0x9f7a47, 0xc7984d, 0xe4b460, 0xddae62, 0xc19155, 0xa57442, 0x8e572c, 0x9a6a2c, 0xc9944d, 0xc49056, 0x8a5a22, 0xebc974, 0xdfc071, 0xe1bd73, 0xdfb96e, 0xd5a558, 0xdcb05e, 0xddb660, 0xe5c571, 0xeed382, 0xf0d482, 0xf5d17a, 0xf7cc7a, 0xf1c676, 0xdda660, 0xad6017, 0xce9754, 0xfcdd93, 0xfae49d, 0xdab069, 0xc37e3a, 0xbc853d, 0xdec072, 0xf5d57e, 0xce9841, 0xc9802e, 0xca8330, 0xc6822b, 0xc28131, 0xd3a254, 0xf4d78d, 0xfff1af, 0xf0d793, 0xe7bc68, 0xe5b663, 0xe1ad65, 0xbc7c3a, 0xad6525, 0xbf722a, 0xdca851, 0xfddc80, 0xf9e393, 0xfef3ba, 0xf6d894, 0xdba444, 0xd79445, 0xcb853f, 0xba7737, 0xa86932, 0x95592a, 0x874f26, 0x794624, 0x6e4022, 0x653b1b, 0x5e3519, 0x59321a, 0x5a331d, 0x4f2b18, 0x442616, 0x3e2315, 0x3b2111, 0x352010, 0x311d0f, 0x422816, 0x4b2d19, 0x2e1809, 0x29190c, 0x27170a, 0x24160a, 0x211509, 0x20130a, 0x201209, 0x1f1108, 0x1c0f06, 0x1a0d05, 0x180d05, 0x160c03, 0x140b04, 0x140b04, 0x130b04, 0x110a04, 0x0d0802, 0x0b0703, 0x0b0703, 0x0b0602, 0x0a0601, 0x080601, 0x080500, 0x080401, 0x070400, 0x040400, 0x040500, 0x040500, 0x030400, 0x040300, 
-  0x100a03, 0x150d04, 0x180e04, 0x190f06, 0x1a1007, 0x1d1006, 0x1d0f04, 0x1c0f04, 0x1c0e05, 0x1e0f06, 0x210f05, 0x211006, 0x231106, 0x251207, 0x261407, 0x271507, 0x291608, 0x2c1809, 0x2f190d, 0x301b0a, 0x341c0a, 0x381d0c, 0x3b1e0c, 0x3f2010, 0x40230f, 0x45240f, 0x462612, 0x492711, 0x4d2910, 0x4d2a12, 0x4e2b12, 0x502b12, 0x532c15, 0x552c16, 0x572e16, 0x64381f, 0x653819, 0x6e3b19, 0x854621, 0xbc824f, 0xcc9156, 0xa55c21, 0xc3783e, 0xc47a37, 0xce893d, 0xdb9a43, 0xdb9a4a, 0xa4631d, 0xc59f60, 0xeac57a, 0xbe823c, 0xa06c33, 0x9d6a2f, 0xc5914f, 0x754821, 0x694528, 0x5f3d20, 0x684323, 0x764b26, 0x8b693b, 0x624425, 0x8a6234, 0xb98c47, 0xa9834e, 0x4b260d, 0x6d4c2a, 0xb88f51, 0xc9a25b, 0xc49959, 0x9b6e3b, 0xa57e4e, 0x775126, 0xb48f59, 0x7e5f37, 0x523826, 0x8a6334, 0xcf9d53, 0xa97b40, 0x5c3c27, 0x533a25, 0x5f4226, 0x5e4126, 0x634528, 0xa57b4a, 0x9f733e, 0xc49b60, 0xb88d56, 0x9e7642, 0x86632f, 0x8c6732, 0xac8141, 0xb48747, 0xc39b63, 0xceaf72, 0x826d48, 0x3a1600, 0xc5a16a, 0xcdaf76, 0x9b743e, 0xa5773e, 0xb48246, 0xb48644, 0xb48647, 0xb6894a, 0xad7f44, 0xac8048, 0x926e3f, 0x60442b, 0x330000, 0xcdb784, 0xe5cd96, 0xbd8a35, 0xd19f4a, 0xd0a14b, 0xd1a04c, 0xc3924d, 0x7c572f, 0x70431a, 0xb5824c, 0xae8147, 0x584026, 0x582b05, 0xd7b26d, 0xf1da90, 0x86673a, 0xb4854c, 0xbc904f, 0x7c542b, 0x895d26, 0xca984d, 0xe6b75f, 0xe5b65c, 0xe7b662, 0xcf9f5d, 0x8c5c2b, 0xcea563, 0xe2c987, 0xa4722e, 0xd09850, 0xdbac5c, 0xecc16b, 0xe5ba66, 0xd6a65b, 0xd19f58, 0xd4a258, 0xd6a858, 0xd69e52, 0x976531, 0xc99f55, 0xfad47a, 0xc29851, 0xb6894a, 0xbb9450, 0xe1bf6f, 0xf3d078, 0xfcda7f, 0xf8dd82, 0xf2dc84, 0xecd982, 0xf4e18e, 0xfae396, 0xfae291, 0xf9d581, 0xdca25a, 0xa95a00, 0xc99550, 0xfede96, 0xfae49f, 0xddb16a, 0xc58539, 0xc68b3d, 0xd69c47, 0xd79840, 0xe5a751, 0xe1a44e, 0xe4a74d, 0xe0a854, 0xc68739, 0xc28435, 0xf1d590, 0xfef1b4, 0xe5c47e, 0xe9b968, 0xe0af66, 0xd09850, 0xb47637, 0xb2692b, 0xb86e23, 0xecbe67, 0xfcdf83, 0xfdeeb0, 0xfef1b9, 0xe5b462, 0xd99745, 0xc98441, 0xb67336, 0xa56632, 0x92572b, 0x854d26, 0x774422, 0x6b3c1f, 0x6a3f20, 0x663c20, 0x583017, 0x603921, 0x4e2a14, 0x3f200c, 0x3b2111, 0x3a200e, 0x352010, 0x2d1c0b, 0x533723, 0x724f35, 0x371c07, 0x2a180b, 0x28180b, 0x24170b, 0x211509, 0x201209, 0x201209, 0x1e1007, 0x1c0f06, 0x1a0d05, 0x190d05, 0x150c03, 0x150c04, 0x140b04, 0x120a03, 0x110a04, 0x0d0702, 0x0b0803, 0x0b0702, 0x0b0602, 0x0a0601, 0x090702, 0x070500, 0x080400, 0x070400, 0x040400, 0x030500, 0x030400, 0x030400, 0x040300, 
-  0x0d0902, 0x120a02, 0x150c03, 0x180e05, 0x1d1008, 0x1f1208, 0x221407, 0x231407, 0x231208, 0x231207, 0x221106, 0x221107, 0x241208, 0x261308, 0x271508, 0x291608, 0x2d1709, 0x2f1a0b, 0x321b0d, 0x341b0d, 0x381d0e, 0x3a1e0d, 0x3d210c, 0x40210e, 0x42220f, 0x46240f, 0x482712, 0x4a2a14, 0x4d2a13, 0x512b13, 0x532d13, 0x542e13, 0x572e14, 0x5a2f18, 0x5a3017, 0x592d10, 0x805132, 0x844f2d, 0x995d37, 0x894a1d, 0x965522, 0xa8622b, 0xbc7436, 0xc57f38, 0xd29042, 0xdf9e44, 0xc37e36, 0xbe9049, 0xf4d88d, 0xc9974e, 0xaf7137, 0xa37136, 0xc2904b, 0x9c6c37, 0x6b4323, 0x674426, 0x623f23, 0x664221, 0x74451c, 0xbd995c, 0x82613a, 0xb78c4a, 0xdebb6d, 0xb48d4f, 0x583010, 0xa97f44, 0xbe9451, 0x815320, 0xbd9554, 0xb18f57, 0x754b1c, 0x936c39, 0x886438, 0x4b2c11, 0x876736, 0xcf9d56, 0xb28245, 0x5e3f22, 0x694930, 0x684a2c, 0x5d4228, 0x52381e, 0x906d42, 0xaa7d40, 0xdab778, 0xae8e5b, 0x461e00, 0x492200, 0x3c2011, 0x1f0d08, 0x39210c, 0x5b391b, 0x5b3000, 0x99753f, 0xd2af73, 0xad8f64, 0x634829, 0xc2ab79, 0xc8ae7c, 0xa8824f, 0xa77841, 0xa6773d, 0xa4793f, 0xa78146, 0xa37b46, 0x976f3e, 0x866138, 0x5c3c21, 0x8c6529, 0xeed290, 0xc8aa74, 0xd09d4b, 0xd0a04a, 0xd8a84e, 0xd6a752, 0xd0a155, 0xc99c54, 0xbe904c, 0xd2a257, 0xba8b4a, 0x8b6a3f, 0x4c1e02, 0xbb965f, 0xe5c989, 0x976a38, 0xca9c59, 0xc39650, 0xbc8d4f, 0xb98a48, 0xdcaf5e, 0xdfb05d, 0xe2b75f, 0xdeb15c, 0xbe8d50, 0x815227, 0xac8445, 0xe3cd89, 0xbf924c, 0xcd9645, 0xddae5f, 0xe5b766, 0xe1b366, 0xdaaa5e, 0xe0ab5f, 0xd9a656, 0xc59145, 0x9e6b33, 0xc59d5b, 0xf4ca73, 0xc69f50, 0xd6b86f, 0xeccc7f, 0xe6bd6c, 0xe4ba6a, 0xca9d52, 0xbc8b3f, 0xc29346, 0xd3a458, 0xe1c170, 0xf5e493, 0xfcf3b5, 0xfbf2ac, 0xfee589, 0xfacf76, 0xd79c4b, 0x9e5205, 0xca9652, 0xfbe097, 0xf8df9d, 0xc8914b, 0xecc069, 0xe0ae58, 0xdea249, 0xdd9d47, 0xe7b25b, 0xe2ac52, 0xf2cc75, 0xf0d285, 0xca8f47, 0xc28e46, 0xfcebaf, 0xf3dfa7, 0xdbaa5c, 0xdba658, 0xd6a054, 0xbf8543, 0x9a5921, 0xac5d1b, 0xda9a45, 0xf5cd6e, 0xf6d988, 0xfef2b7, 0xf5d897, 0xd89947, 0xc7813d, 0xb47038, 0xa5632f, 0x93572a, 0x834c27, 0x764421, 0x683b18, 0x784e2f, 0x7d5234, 0x532d14, 0x4c2b15, 0x4f2b13, 0x6f4c35, 0x472812, 0x3a210e, 0x372010, 0x321e0f, 0x311b0a, 0x341907, 0x301a0b, 0x291709, 0x27170b, 0x24160b, 0x22150a, 0x21130a, 0x201209, 0x1e1007, 0x1d0e06, 0x1b0e06, 0x180d05, 0x160c03, 0x150b05, 0x140b05, 0x130b03, 0x110a03, 0x0d0702, 0x0a0703, 0x0a0702, 0x0a0702, 0x0a0702, 0x090702, 0x090601, 0x070400, 0x060501, 0x050401, 0x050400, 0x040400, 0x030400, 0x030400, 
-  0x0c0803, 0x100903, 0x120903, 0x140b02, 0x190e05, 0x1d1006, 0x211307, 0x261609, 0x2a170a, 0x2b180a, 0x2b170a, 0x2a1508, 0x281407, 0x261407, 0x271507, 0x2b170a, 0x2f180c, 0x311a0c, 0x341b0c, 0x371c0c, 0x3b1e0e, 0x3c200d, 0x3e220d, 0x42230e, 0x44240f, 0x482511, 0x4b2711, 0x4e2a12, 0x502c12, 0x542b12, 0x572e15, 0x593017, 0x5d3118, 0x60321a, 0x5f3319, 0x65381c, 0x7d4b2c, 0x7a421e, 0x8e5532, 0x854923, 0x935227, 0xa6602d, 0xb97235, 0xc8823c, 0xd69545, 0xc68a3d, 0xa16012, 0xe7cc82, 0xe5c980, 0xbb7f36, 0xb27c3b, 0xb6813e, 0xc29150, 0x663b1a, 0x704e2d, 0x5e3f1e, 0x624125, 0x59381d, 0x6e4616, 0xe0c383, 0x8a6e46, 0xb58542, 0xe8c47b, 0x876638, 0x7b5b33, 0xbd8e51, 0x936f3a, 0x000000, 0x86663a, 0xcca970, 0x8a6843, 0x5c3c1f, 0x52331f, 0x704c26, 0xbe8e43, 0xcfa059, 0x78542c, 0x53371c, 0x735436, 0x6c4c2c, 0x583f23, 0x5d4222, 0xa27443, 0xb48844, 0xdfcc8d, 0x3f2510, 0x876c45, 0xc6ac75, 0x76572f, 0x573b1f, 0x3c2c11, 0x453520, 0x453120, 0x220000, 0x58350d, 0xaa8654, 0xb68a5d, 0x8b613d, 0xaf9465, 0xdac089, 0xc7b07a, 0xa38957, 0x9d7647, 0x976f3e, 0x966e3e, 0x9d7445, 0x916938, 0xa0763b, 0xd6a459, 0xcca467, 0x9b6f36, 0xd2a04f, 0xd9ae5b, 0xdaad56, 0xdaae57, 0xdaae5a, 0xe0b35e, 0xe0b25f, 0xd7a953, 0xc29249, 0xa77f44, 0x59351a, 0x987141, 0xc9a366, 0xb88648, 0xcc9d52, 0xca9b4e, 0xcf9f50, 0xd9ab58, 0xe2b861, 0xe5ba63, 0xebbf69, 0xe5b662, 0xc59553, 0x643b1b, 0x6f4a1a, 0xc3a567, 0xdec280, 0xc19851, 0xcb9850, 0xc5944f, 0xb68445, 0x9e6b2d, 0xa2702d, 0xa87937, 0xaf8449, 0xd8ae68, 0xd7af61, 0xb58e49, 0xd9b268, 0xf6d37d, 0xe0b969, 0xb67f3e, 0x9e5f1f, 0xa46326, 0xb37033, 0xb26e2d, 0xb57b37, 0xb87b34, 0xcfa455, 0xfcf2a5, 0xfefabe, 0xf4d684, 0xf8d072, 0xf8ca6c, 0xd79244, 0x994a00, 0xcf9f58, 0xfbe79d, 0xe5c383, 0xd19c4d, 0xf5d477, 0xedca65, 0xd49a3d, 0xf3cd75, 0xdcaf59, 0xe4b35a, 0xf3e091, 0xe8cc82, 0xb47626, 0xe4c47e, 0xfae49f, 0xce9d4f, 0xdca658, 0xdba355, 0xc98f47, 0xa2682f, 0xa35a1f, 0xd2873a, 0xe2aa52, 0xf8d479, 0xf8e99f, 0xfef0b5, 0xe0b26c, 0xc67d35, 0xb36d36, 0xa16231, 0x905629, 0x824b26, 0x744223, 0x673d1f, 0x5c3418, 0x5c3217, 0x53301a, 0x492b18, 0x4c2a14, 0x694832, 0x472914, 0x392210, 0x382110, 0x362010, 0x321e0f, 0x2d1c0d, 0x2c1a0b, 0x29180a, 0x28170c, 0x25150b, 0x221409, 0x201209, 0x1f1108, 0x1d0f06, 0x1d0e06, 0x1b0d06, 0x170d04, 0x160c03, 0x160b05, 0x140b05, 0x130b03, 0x110a03, 0x0e0803, 0x0b0803, 0x0a0702, 0x0b0803, 0x0a0803, 0x080702, 0x090601, 0x080500, 0x060400, 0x050400, 0x050400, 0x040400, 0x030400, 0x030400, 
-  0x0d0804, 0x110a04, 0x130a04, 0x120b02, 0x140c02, 0x180d03, 0x1c0e04, 0x231207, 0x281608, 0x2d190a, 0x311b0c, 0x331b0b, 0x311a0b, 0x2e1a0a, 0x2f190a, 0x31190c, 0x32190c, 0x351a0c, 0x371c0c, 0x3a1e0b, 0x3d200b, 0x3f210c, 0x41220e, 0x44240f, 0x462611, 0x4a2713, 0x4c2914, 0x4e2b14, 0x502b14, 0x552d15, 0x5c3016, 0x633419, 0x65341a, 0x663515, 0x68381a, 0x6a391b, 0x6f3b1c, 0x794121, 0x79411e, 0x8b5029, 0xa05f32, 0xa35e29, 0xbb7638, 0xcd8840, 0xd69344, 0xbb772c, 0xc49a5d, 0xf6e399, 0xc8984c, 0xbb803a, 0xbc8940, 0xc89148, 0x8e6131, 0x654121, 0x624020, 0x674223, 0x643e1e, 0x56340e, 0xb58b53, 0xd1ac6a, 0x7c5f36, 0x86571c, 0xd7b573, 0x644828, 0x886c3b, 0xc9a462, 0x7b572a, 0x352212, 0x412915, 0x462605, 0x5e4021, 0x654a2c, 0x674d29, 0xb48345, 0xd19753, 0x9d7445, 0x633e23, 0x725234, 0x6b4b2c, 0x614325, 0x4a2a13, 0x9f7b4a, 0x9b6b37, 0xc19048, 0xd5b376, 0x977749, 0xd5ad6d, 0xd9b87b, 0x896434, 0x926539, 0x885f35, 0x734e25, 0x72512d, 0x6a4c2c, 0x432c17, 0x381100, 0x6c431c, 0x986940, 0x9f6a44, 0x9e6f41, 0xb1905f, 0xc3a46c, 0xceab6f, 0xd4ae73, 0xd5ae6c, 0xd0a35a, 0xc9974f, 0xb98747, 0x8f6430, 0x825729, 0xb48843, 0xcc9d4a, 0xe5bc6c, 0xe1b967, 0xdfb75f, 0xe3b85e, 0xe4b85e, 0xd6a852, 0xd7a952, 0xcf9c4e, 0xc2934b, 0x714d2b, 0x694320, 0xb18347, 0xc4954a, 0xcfa252, 0xd8a857, 0xdfb059, 0xe0b359, 0xe8bf67, 0xeecb70, 0xf6d17a, 0xf1c66d, 0xdcb05c, 0x9d723f, 0x4d280e, 0x6e4116, 0xa3834f, 0xd3b67a, 0xd6b878, 0xceac6c, 0xc09a5e, 0xc19e61, 0xcbac6e, 0xd8b56f, 0xdcb660, 0xcda356, 0xcfa35e, 0xe2b769, 0xcda057, 0xa56a2d, 0x9d5e20, 0xbf8a46, 0xd49a50, 0xdaa053, 0xe5ac5d, 0xc78b3e, 0xdebb73, 0xe9d48f, 0xab6b0e, 0xf3d376, 0xfbf2a0, 0xf3e28e, 0xecbc5a, 0xfccb6d, 0xf4b962, 0xc88443, 0xa25503, 0xdcb069, 0xffe6a0, 0xd6b270, 0xca9b47, 0xf8d06d, 0xe4af50, 0xf1ca75, 0xc79149, 0xc98c3f, 0xf0cd79, 0xf0d784, 0xbc813c, 0xd7a961, 0xffe598, 0xd4a556, 0xdcab58, 0xe4b05a, 0xdea659, 0xb88144, 0x965320, 0xa95e21, 0xbb752b, 0xe7bd68, 0xf8df8c, 0xfef2bb, 0xf5dca2, 0xc98942, 0xb36c34, 0xa06132, 0x8f5629, 0x834c24, 0x744321, 0x663c1e, 0x5d381d, 0x5e3920, 0x4f2e18, 0x472b18, 0x462914, 0x44250d, 0x412713, 0x3c2411, 0x3b220f, 0x382111, 0x342011, 0x2e1e0e, 0x2b1b0c, 0x29190c, 0x28170c, 0x25160b, 0x201409, 0x1e1108, 0x1e1108, 0x1d1007, 0x1c0e06, 0x1a0d05, 0x170e05, 0x160c03, 0x160b05, 0x140a03, 0x120a01, 0x110a01, 0x0e0903, 0x0b0803, 0x0a0703, 0x0a0803, 0x090702, 0x080702, 0x090601, 0x080500, 0x060400, 0x050400, 0x050400, 0x050400, 0x040400, 0x030300, 
-  0x0d0803, 0x110903, 0x120903, 0x130a02, 0x140c02, 0x160c02, 0x190c03, 0x1c0e05, 0x211106, 0x271508, 0x2e190b, 0x341c0d, 0x371e0d, 0x391f0d, 0x3c1f0e, 0x3b1e0c, 0x391d0b, 0x3a1d0b, 0x3b1e0b, 0x3d200c, 0x40210d, 0x41220d, 0x44240f, 0x462611, 0x462712, 0x492812, 0x4d2a15, 0x502c14, 0x522b0f, 0x5a2d10, 0x6e3f1d, 0x6f3916, 0x804b2d, 0x8c5835, 0x713b19, 0x6e3919, 0x75401f, 0x7d4625, 0x864c26, 0x94582c, 0xa66533, 0xa5622c, 0xb57133, 0xca863f, 0xce8b43, 0xbe7c2f, 0xf5df9b, 0xe5ca84, 0xbe8031, 0xbf8641, 0xca9248, 0xba8947, 0x693f20, 0x654327, 0x624022, 0x936c3f, 0x9e774b, 0x5e3b1c, 0xb88c52, 0xbb8c4e, 0x7a572d, 0x84592c, 0xd0af70, 0x7b6239, 0x654319, 0xd8ba78, 0x9f8350, 0x725031, 0x54371e, 0x624a2c, 0x61472c, 0x4a2c1f, 0x986d3b, 0xc79147, 0x9f713b, 0x674225, 0x745030, 0x7d5733, 0x78522a, 0x694621, 0xae8753, 0xbc9356, 0x76512a, 0x89632d, 0xc1934f, 0xd7ac68, 0xb79052, 0x81582d, 0x865c2a, 0x9c6f37, 0xa5763a, 0xb08347, 0x956b35, 0x8c6538, 0x7e5830, 0x74512e, 0x604122, 0x452001, 0x542b06, 0x65390c, 0x764214, 0x8a5428, 0x92602c, 0x946430, 0x8c5f28, 0x886129, 0x734f24, 0x5d381a, 0x886138, 0xb78a4c, 0xc99a4c, 0xd2a34f, 0xdeb765, 0xebc674, 0xe2ba60, 0xe6bd5e, 0xdfb359, 0xdcad57, 0xd4a750, 0xd5a352, 0xd09f4d, 0xb2854b, 0x7e5826, 0xae7d3a, 0xd3a852, 0xe2b560, 0xe1b35f, 0xdbad57, 0xe7bc63, 0xefc86e, 0xeecd70, 0xeac76c, 0xf9d77a, 0xe9c46a, 0xce9b51, 0xab7740, 0x6f4a29, 0x592a00, 0x6f430e, 0x9f8047, 0xc0a062, 0xcbab69, 0xd7b871, 0xeac67a, 0xe5bb6e, 0xd6a956, 0xcf9e55, 0xb58446, 0x975e1f, 0x9e6026, 0xbb8340, 0xdaa555, 0xecb85f, 0xeab75f, 0xecbe66, 0xf6c974, 0xcb974f, 0xc0904f, 0xfbe89e, 0xe7ce7a, 0xfadf78, 0xfbed83, 0xfff29a, 0xeccd76, 0xecb459, 0xeab762, 0xe8ad5e, 0xc07c3a, 0xab5c0d, 0xe3ba74, 0xfee7a0, 0xcfa463, 0xc0812b, 0xd99c48, 0xd1964b, 0xcd8e4c, 0xb06f29, 0xdfb25c, 0xf2d07a, 0xc38a48, 0xd3a45c, 0xffe797, 0xd8aa5a, 0xe8c26d, 0xe6c069, 0xd6a150, 0xc28b48, 0x985e2d, 0x7e400e, 0x955014, 0xbf883e, 0xf4ce7b, 0xfce7a5, 0xfff4c0, 0xdab274, 0xb46f30, 0xa46130, 0x92572c, 0x864d25, 0x784521, 0x6a3d1d, 0x633a1e, 0x5d371c, 0x543117, 0x4a2d17, 0x472b14, 0x4c301a, 0x472c17, 0x462813, 0x442712, 0x3a210e, 0x332011, 0x2e1c0e, 0x2a1a0b, 0x28180c, 0x26160c, 0x23150a, 0x211309, 0x20120a, 0x201209, 0x1e1007, 0x1d0e06, 0x1b0d06, 0x180e05, 0x160c03, 0x140a03, 0x130a03, 0x120a00, 0x110a01, 0x0f0903, 0x0c0803, 0x0b0803, 0x0a0702, 0x090702, 0x080702, 0x090601, 0x080500, 0x060500, 0x050400, 0x050400, 0x060300, 0x070300, 0x040300, 
-  0x0e0902, 0x110902, 0x130a02, 0x140b03, 0x150c03, 0x170d03, 0x180d03, 0x1a0e05, 0x1d0f06, 0x211106, 0x271408, 0x2c1609, 0x321a0b, 0x3a1e0d, 0x422310, 0x452410, 0x462610, 0x45250f, 0x45250e, 0x45250e, 0x45250f, 0x452510, 0x462612, 0x472712, 0x492812, 0x4d2a13, 0x512c12, 0x51290c, 0x734a2e, 0x885a3d, 0x986542, 0x8b5734, 0x753c1e, 0x824924, 0x854c25, 0x8d5832, 0x78401c, 0x804522, 0x8a4e24, 0x955726, 0x9e5c29, 0xa96732, 0xb87538, 0xc48141, 0xb06927, 0xc3995b, 0xf9e9a7, 0xc8974e, 0xb9803b, 0xb67e38, 0xcb934b, 0x85592a, 0x6c4929, 0x5c3c1f, 0x5b3c1f, 0x674421, 0x84613a, 0x563821, 0x88663a, 0xc19556, 0x785025, 0x744b27, 0xbd975d, 0xa38a58, 0x2a0000, 0xa68451, 0xd0bd86, 0x7d6139, 0x72522f, 0x5b3d26, 0x3e2917, 0x8c6a3c, 0xad773b, 0xa87442, 0x634221, 0x5d3f1c, 0x795a33, 0x7b552c, 0x91693b, 0xb18753, 0xa77e4c, 0x714d28, 0x452d12, 0x321e0c, 0x543819, 0x77562c, 0x654820, 0x805a31, 0x946930, 0xa97d3f, 0xb3823f, 0xb3823c, 0xb0803c, 0xb68645, 0xb18447, 0x966b34, 0x8b6136, 0x805a32, 0x7c572d, 0x724e28, 0x603f1c, 0x5c3c1a, 0x66441f, 0x6b4824, 0x684623, 0x6e4c29, 0x7f5a2f, 0x9c723a, 0xb78743, 0xc59143, 0xd29e4b, 0xd8a951, 0xdbb055, 0xe7c06e, 0xe3bb63, 0xddb454, 0xddb057, 0xdaab53, 0xd9ac54, 0xdcab55, 0xdaab50, 0xdaab53, 0xcb9f4c, 0xd4a251, 0xdeb156, 0xe2b45c, 0xdfb35b, 0xe0b55c, 0xe9be63, 0xeec566, 0xf1c96a, 0xf0cb6b, 0xf3d578, 0xf8d881, 0xe5b863, 0xdaa85c, 0xc89955, 0xab7c46, 0x8b5d33, 0x7c4d20, 0x723d0f, 0x6c3600, 0x703900, 0x844e0a, 0x8e5712, 0x91591b, 0x9a6327, 0xa87334, 0xc79149, 0xdea655, 0xe7af5a, 0xe4b157, 0xf2c367, 0xf3c968, 0xf5ce6e, 0xfad178, 0xddab63, 0x965810, 0xc4974e, 0xeac466, 0xfcd876, 0xf7d87d, 0xdfbf71, 0xf8e89c, 0xefd184, 0xebc373, 0xf4c36e, 0xe4ac5d, 0xaf6b2a, 0xa96318, 0xebc883, 0xfce9a4, 0xd9ac69, 0xd59348, 0xda9751, 0xd69c55, 0xcd964b, 0xf2cf79, 0xf0cd7e, 0xbb813b, 0xd1a85a, 0xfee792, 0xbc9142, 0xd3b267, 0xfae191, 0xd6a357, 0xc78d48, 0xac773f, 0x7e4e20, 0x804615, 0xa46422, 0xdeaf5f, 0xfbdd8a, 0xfdf2b7, 0xf4dca1, 0xbf803b, 0xaa652f, 0x9a5a2f, 0x8b5029, 0x7d4724, 0x714223, 0x683d21, 0x60371c, 0x5a341b, 0x513019, 0x4b2d15, 0x462a13, 0x43250e, 0x583821, 0x573923, 0x3a210c, 0x342111, 0x2e1c0d, 0x2b1a0c, 0x28180b, 0x24150a, 0x22150b, 0x22140a, 0x21130a, 0x201209, 0x1e1007, 0x1c0e06, 0x1b0d05, 0x180d05, 0x170d04, 0x150b04, 0x130a03, 0x120a01, 0x110a01, 0x0f0a03, 0x0d0904, 0x0b0803, 0x0b0703, 0x0a0702, 0x090702, 0x090702, 0x070500, 0x060500, 0x060400, 0x050400, 0x050300, 0x050300, 0x040400, 
-  0x0e0803, 0x120902, 0x130a03, 0x140b02, 0x160c03, 0x170c04, 0x190c04, 0x190d04, 0x1b0f04, 0x1e0f06, 0x221006, 0x251306, 0x281607, 0x30190a, 0x3a1e0d, 0x43220e, 0x4a2912, 0x502c13, 0x542e14, 0x552d14, 0x522b13, 0x4e2812, 0x4c2812, 0x4c2912, 0x4c2911, 0x502a13, 0x542c13, 0x552c14, 0x633a1e, 0x6b3e21, 0x68310c, 0x743f21, 0x6f3c1b, 0x804521, 0x864c27, 0x9a6139, 0x82441d, 0x905227, 0x975729, 0x9f5e2e, 0xa7642f, 0xb16e34, 0xbe7c3a, 0xb47437, 0x995100, 0xe2c686, 0xe7cb88, 0xbd7f37, 0xb57c3a, 0xc9934b, 0xb68648, 0x5f3716, 0x614021, 0x603d21, 0x76522c, 0x512e16, 0x442a0b, 0x5c4424, 0x66451a, 0xdcb669, 0x96753d, 0x3a1100, 0x8a6939, 0xccb483, 0x4b321a, 0x491d00, 0xb99c68, 0xc6a976, 0x725535, 0x4a301e, 0x775a36, 0xb07f43, 0xaa773b, 0x714c2a, 0x634325, 0x674826, 0x70512d, 0x4c2c11, 0x543618, 0x5c3b1c, 0x614127, 0x4b3119, 0x4a341d, 0x47331b, 0x3f2a15, 0x573c21, 0x78552f, 0x996c37, 0xaa7b3b, 0xb58541, 0xaf7e39, 0xba8740, 0xb8863e, 0xba883f, 0xc6964b, 0xbd8d47, 0xad7e3d, 0xa47637, 0xaf8242, 0xac7e42, 0xa17640, 0xa07641, 0xa27840, 0xa47940, 0xa67a3f, 0xad803f, 0xbc8c48, 0xc08f47, 0xbe8d40, 0xc99646, 0xcc9a45, 0xddae55, 0xdbad51, 0xd6a856, 0xe5bb64, 0xdfb453, 0xdfb156, 0xdaad55, 0xdeb058, 0xe2b45b, 0xe1b557, 0xe6bb5c, 0xdeb256, 0xddaf55, 0xd3a54e, 0xdfb25c, 0xd3a655, 0xdeb161, 0xdeb05e, 0xdbab57, 0xdfb157, 0xf3cf6f, 0xf7d777, 0xf2d075, 0xf0ca6f, 0xeec66f, 0xe5b564, 0xdcab5f, 0xdba961, 0xd3a15a, 0xbe8d49, 0xba8946, 0xb78841, 0xbc8f4b, 0xd2a25e, 0xd6a05a, 0xe2af62, 0xeaba68, 0xe8b560, 0xedba60, 0xeabb5c, 0xf7ce6e, 0xf9d575, 0xf4d272, 0xf9d374, 0xf5cc74, 0xecbd70, 0xc28a4d, 0x93500d, 0xa26010, 0xbb8239, 0xad7532, 0x974c00, 0xc19653, 0xead696, 0xf8e8a5, 0xf8d986, 0xefbd67, 0xd2974c, 0x9f5006, 0xb17832, 0xf7dd9a, 0xfce8a7, 0xdca85d, 0xdc9e56, 0xd79b50, 0xe9bc65, 0xf6d97f, 0xe0b66b, 0xad7229, 0xdebb70, 0xffe492, 0xc19241, 0xbd934f, 0xfff3a4, 0xdfbe73, 0xc18b46, 0xc28e4b, 0x91612d, 0x723e14, 0x854814, 0xb37b37, 0xf4ce7b, 0xf9e79c, 0xffedb0, 0xdaab68, 0xaf6c2d, 0xa4602f, 0x94552a, 0x854c26, 0x774625, 0x683c1e, 0x5f3417, 0x593119, 0x543118, 0x4e2f18, 0x482b16, 0x442813, 0x422711, 0x3e2511, 0x38210f, 0x341f0e, 0x2f1c0b, 0x2a1a0e, 0x28180d, 0x23160b, 0x20160d, 0x22150c, 0x22140a, 0x201209, 0x1e1008, 0x1c0f06, 0x1a0d04, 0x170d04, 0x150c03, 0x140b02, 0x140b04, 0x120a02, 0x100a02, 0x0f0a04, 0x0d0904, 0x0b0703, 0x0b0602, 0x0b0602, 0x090702, 0x070601, 0x060500, 0x070400, 0x080500, 0x070500, 0x050400, 0x040400, 0x030500, 
-  0x100a03, 0x130a03, 0x130a02, 0x140b02, 0x150c03, 0x180c04, 0x1a0c05, 0x190d04, 0x1a0e05, 0x1d0e06, 0x200f07, 0x211107, 0x241306, 0x2a1608, 0x32190b, 0x391d0b, 0x40220d, 0x4c2810, 0x542e15, 0x5a3117, 0x5e3218, 0x5e3016, 0x5c2f15, 0x582d14, 0x552c12, 0x562d14, 0x582e17, 0x5a3116, 0x5c2f17, 0x643518, 0xb18159, 0x885634, 0x6a3513, 0x7c4425, 0x7b3f1f, 0x7f3f18, 0x93532b, 0xa46231, 0xa25e2b, 0xa96432, 0xb06d32, 0xbe793a, 0xc5813f, 0xa86525, 0xc4985b, 0xf6dd9b, 0xc2924c, 0xb57736, 0xbe8642, 0xddaf66, 0x895d2e, 0x664021, 0x5f3b21, 0x5a3a21, 0x58320f, 0x916a42, 0xc9a66f, 0xa5834b, 0x8d6732, 0xcca865, 0xb59660, 0x381400, 0x5d350e, 0xc2a472, 0xa68e5f, 0x2e0b00, 0x563102, 0xad8552, 0x927245, 0x63482c, 0xa77943, 0xbb8946, 0x81582d, 0x634327, 0x66462a, 0x855f35, 0x835a2d, 0x72502b, 0x654723, 0x704e27, 0x78522b, 0x734e27, 0x79582e, 0x7d5c31, 0x74502b, 0x825b31, 0x8f6231, 0xa06e34, 0xac7938, 0xb6853f, 0xb5843d, 0xbd8a41, 0xc79448, 0xc08f42, 0xbd8d3e, 0xc39245, 0xc8974c, 0xc89649, 0xc79648, 0xc7974d, 0xb0803b, 0xb3823e, 0xb6843e, 0xb28139, 0xbd8b41, 0xc99648, 0xcb9747, 0xcc9846, 0xd8a854, 0xdbaa54, 0xcd9b42, 0xdaa94e, 0xd4a54a, 0xcfa04d, 0xdeb15a, 0xe2b556, 0xe0b255, 0xe1b559, 0xdfb256, 0xdfb356, 0xe4bb5b, 0xe0b757, 0xe2b658, 0xe3b45a, 0xd7a852, 0xdeb05c, 0xd3a656, 0xce9f56, 0xc08e49, 0xc28d45, 0xce9c47, 0xe8bb5f, 0xf8d476, 0xf5d577, 0xf1d176, 0xf0cf76, 0xebc36b, 0xeac069, 0xe6b963, 0xe8b763, 0xdfad59, 0xe4b255, 0xeab759, 0xe8b561, 0xe0af5d, 0xdba754, 0xe4b55f, 0xf1c66e, 0xedc167, 0xeec466, 0xf7cf6e, 0xfbd976, 0xf4d675, 0xfbdd80, 0xf5d276, 0xf6d076, 0xefc570, 0xe9b665, 0xdba65a, 0xc4904d, 0xc68f4d, 0xce9650, 0xbe894a, 0xaf6f2c, 0xb5732c, 0xc58e49, 0xd6a254, 0xf0c067, 0xecba64, 0xd09148, 0x9a4b00, 0xd19f5d, 0xfff1af, 0xf1d692, 0xd1944c, 0xcf913d, 0xeabe64, 0xefc774, 0xbe8b44, 0xab762f, 0xf8d985, 0xeccd81, 0xb87f2f, 0xbe9144, 0xfbe38f, 0xcca358, 0xc2863f, 0xe3a961, 0xb38145, 0x7b4b1f, 0x763e12, 0x8b4c0c, 0xdaac5f, 0xfadd88, 0xfeeda8, 0xf5da9d, 0xc0843e, 0xab662d, 0x9f5b2d, 0x8f5226, 0x7c461f, 0x6d3d1b, 0x784b2d, 0x633b1e, 0x573317, 0x523118, 0x4f2d16, 0x45250f, 0x412713, 0x3e2614, 0x352010, 0x35200f, 0x341f10, 0x2b1a0f, 0x27170c, 0x211204, 0x22160a, 0x23150c, 0x22140a, 0x1f1208, 0x1c0f06, 0x1a0f05, 0x190f05, 0x160d04, 0x140c02, 0x130b02, 0x130a03, 0x120a03, 0x120b03, 0x110a04, 0x0f0a04, 0x0c0702, 0x0b0602, 0x0c0703, 0x0b0703, 0x080702, 0x070601, 0x080501, 0x070500, 0x080501, 0x060400, 0x040400, 0x040500, 
-  0x120b04, 0x140b03, 0x140c02, 0x150d03, 0x160d03, 0x180d04, 0x1a0d05, 0x1a0d05, 0x1b0e05, 0x1e0f07, 0x200f08, 0x211209, 0x251408, 0x281608, 0x2c170a, 0x311909, 0x391e09, 0x3f230b, 0x462710, 0x4d2b11, 0x573116, 0x62361a, 0x67391c, 0x68381b, 0x683619, 0x663518, 0x653418, 0x653516, 0x69381f, 0x6a381b, 0x7b4b29, 0x6e3719, 0x7d4725, 0x773f1f, 0x834822, 0xaa6b38, 0x9b5829, 0xa6612f, 0xbb773a, 0xc17e3e, 0xbb7837, 0xca8540, 0xbe7b3b, 0x9d5c14, 0xe7c781, 0xefcf89, 0xb1742d, 0xb77b3b, 0xd6a55c, 0xd3aa65, 0x6a3c13, 0x6e4928, 0x654224, 0x714d28, 0xb58e5b, 0x9a7544, 0x9b7c52, 0x512f17, 0x4f3219, 0x654e2b, 0xa38a5d, 0x543c1e, 0x49321d, 0x86603a, 0xc9ac73, 0x866b45, 0x3b2013, 0x5a3d25, 0x65492a, 0x967142, 0xb88240, 0xb18346, 0x694424, 0x6a492c, 0x6c4a28, 0x8a602f, 0x8f612e, 0x8c6331, 0x835b2c, 0x8b6130, 0x936732, 0x946833, 0x94692f, 0x9d7238, 0x956837, 0x8e6230, 0x9a6d36, 0xa07034, 0xad7c3a, 0xb78741, 0xb18139, 0xbe8b40, 0xbf8b3f, 0xc69447, 0xc19044, 0xc9984d, 0xc79448, 0xcb984a, 0xcfa04c, 0xdcb058, 0xd0a24e, 0xcb9b49, 0xcc9c48, 0xce9f4c, 0xdeaf5c, 0xcd9d49, 0xd9a853, 0xd7a750, 0xd8aa4f, 0xdcae53, 0xd5a54b, 0xddab51, 0xddae54, 0xe2b45b, 0xdcaf56, 0xdfb256, 0xddae52, 0xdead51, 0xd9a74b, 0xdcac4f, 0xe1b457, 0xdfb355, 0xddb055, 0xdaab58, 0xc8994d, 0xbc8c46, 0xb38343, 0xaa783b, 0xa57235, 0xa97738, 0xba8d47, 0xc5994e, 0xe1b963, 0xf4d274, 0xf8da81, 0xf4d37b, 0xedc76f, 0xf3cd75, 0xeec86e, 0xebc265, 0xecc065, 0xe6b960, 0xe8bd5e, 0xebc162, 0xe8bd63, 0xecbe66, 0xedc66d, 0xf7d47b, 0xefcb71, 0xf2cc6f, 0xf3cc6d, 0xf7d474, 0xf9dc7e, 0xfadd80, 0xf7d478, 0xf7d478, 0xf6d277, 0xf3c86e, 0xf6ca6f, 0xf7cd71, 0xf0c46d, 0xebba6a, 0xebbc6b, 0xe8b666, 0xe6b568, 0xe8b868, 0xe9b961, 0xedbf64, 0xebbe63, 0xe9b160, 0xbd7938, 0xa45e11, 0xeaca86, 0xfff1b2, 0xe6b873, 0xcd9343, 0xdfae5d, 0xc28a44, 0xa96e2c, 0xc89d50, 0xfedc7a, 0xc2954a, 0xa4651f, 0xe1b65c, 0xe9c766, 0xc9a253, 0xcd9e52, 0xdca657, 0xcc9855, 0x996937, 0x6f3d14, 0x7e3f0e, 0xb47c38, 0xf3ca70, 0xf9e08f, 0xffefad, 0xdeb46b, 0xb4702b, 0xae6633, 0x9d5b2a, 0x985d33, 0x7b4620, 0x734322, 0x65391e, 0x5a341b, 0x553318, 0x533114, 0x704d33, 0x55331b, 0x492e1a, 0x341d0d, 0x372214, 0x46301f, 0x2c1a0a, 0x2b1607, 0x513829, 0x321b0e, 0x221309, 0x201309, 0x1e1108, 0x1c0f07, 0x1a0e05, 0x180e04, 0x160d04, 0x140c03, 0x140c03, 0x140b04, 0x140b04, 0x130a03, 0x120a05, 0x100a03, 0x0e0903, 0x0c0702, 0x0c0703, 0x0c0602, 0x0a0702, 0x090601, 0x070601, 0x060500, 0x070400, 0x080401, 0x050400, 0x040400, 
-  0x120a02, 0x140b02, 0x150c03, 0x150e03, 0x170e03, 0x190e05, 0x1b0e05, 0x1b0e05, 0x1e0f05, 0x200f07, 0x231009, 0x24130a, 0x261508, 0x281607, 0x2b180a, 0x311a0a, 0x381e0a, 0x3d220d, 0x3e230f, 0x42240f, 0x4c2911, 0x552f15, 0x5f3519, 0x6a381b, 0x773e1f, 0x7c4020, 0x7a3e1d, 0x753b1e, 0x723c1b, 0x713b1b, 0x6b371b, 0x713a1d, 0x925933, 0x7d4421, 0x884822, 0xc07c4a, 0xa55f2c, 0xc48048, 0xcc8949, 0xc78444, 0xc6813e, 0xcb8740, 0xa46324, 0x976128, 0xedd083, 0xcea156, 0xa96d2f, 0xb7813d, 0xefc372, 0x9c733e, 0x764927, 0x674323, 0x593618, 0x694320, 0x835d35, 0x3e1100, 0x47290b, 0x644527, 0x775733, 0x6c4f26, 0x866538, 0x7d5e31, 0x43250b, 0x260000, 0x6b5031, 0xb6966a, 0x7d5e3a, 0x3f2814, 0x7e5b36, 0xb48242, 0xb8894a, 0x724b27, 0x6b4824, 0x75512d, 0x825c2e, 0x8c6232, 0x8a612e, 0x9d7133, 0xa07033, 0xa27236, 0xa57635, 0xaa7838, 0xa87637, 0xaa7a39, 0xa9793d, 0xa6773b, 0xa27337, 0xaa7a3a, 0xb7853f, 0xb8873e, 0xac7b35, 0xbe8b41, 0xb98539, 0xc08d41, 0xbd8c40, 0xc29245, 0xc7964a, 0xba893e, 0xd0a251, 0xdaad54, 0xd5a54f, 0xcd9b46, 0xd2a34b, 0xd4a64e, 0xd6a851, 0xddaf57, 0xdaab54, 0xdcad54, 0xdfb356, 0xdfb459, 0xdaac54, 0xd1a04b, 0xdeb057, 0xe9bd5f, 0xe2b559, 0xdfb259, 0xdcaf54, 0xe0af55, 0xddad51, 0xe0b255, 0xe7bc60, 0xdeb259, 0xd1a24e, 0xc5964e, 0xae8043, 0x976c38, 0x7c4f28, 0x886131, 0xbe9e61, 0xe2c685, 0xe3cb8f, 0xd9be88, 0xd4af66, 0xe9c467, 0xf5d37c, 0xeecb70, 0xeec66b, 0xebc76c, 0xf5d479, 0xf0cb6e, 0xe5bb5f, 0xeac167, 0xf1cb6d, 0xf0cd70, 0xedc567, 0xeec165, 0xecc66a, 0xf3d276, 0xf8d77c, 0xf8d77b, 0xf3cf72, 0xf9d77b, 0xfce085, 0xfadb7d, 0xf0cb6d, 0xf9d578, 0xfbda7d, 0xf7d377, 0xf3cd70, 0xfbda7d, 0xf6d478, 0xf3cc71, 0xf5cd72, 0xf3c771, 0xf0c76f, 0xf0c86d, 0xf4ca71, 0xf3c76c, 0xe8b762, 0xe3b05f, 0xe6b165, 0xad6d2c, 0xbe803f, 0xfae3a3, 0xf5e1a0, 0xbb8541, 0xc4843c, 0xc1823e, 0xb27e36, 0xf1ca6b, 0xe5bd61, 0xab6e2a, 0xb67f36, 0xe3b85d, 0xdcb25d, 0xedcb79, 0xf8da85, 0xe0b561, 0xc79048, 0xad7840, 0x784b1e, 0x703a10, 0x965919, 0xdbab56, 0xf3cf72, 0xfce89d, 0xf6db8f, 0xc4853b, 0xaf662f, 0xa15d2a, 0x97592d, 0x814a24, 0x744220, 0x6a3c1b, 0x5d361a, 0x54331a, 0x4f2e16, 0x593822, 0x452612, 0x402717, 0x351e0e, 0x3d2414, 0x472b1a, 0x301b0b, 0x2d1b0b, 0x432d1e, 0x321b0e, 0x26160c, 0x201209, 0x1d1108, 0x1c0f07, 0x1c0e06, 0x1b0e05, 0x180e05, 0x160c03, 0x140b03, 0x140b04, 0x140b04, 0x130a03, 0x130a05, 0x120a03, 0x100b03, 0x0d0802, 0x0d0603, 0x0d0603, 0x0a0702, 0x0a0702, 0x080702, 0x070601, 0x070400, 0x080401, 0x050400, 0x040400, 
-  0x130b03, 0x150c03, 0x160c03, 0x170d04, 0x180f05, 0x1a0f05, 0x1c0f06, 0x1c0f04, 0x201006, 0x230f09, 0x23120a, 0x23140b, 0x22140b, 0x27170a, 0x2c1809, 0x2f1a0c, 0x381e0c, 0x422514, 0x3e220f, 0x3e220e, 0x43240f, 0x482711, 0x502c12, 0x5c2f14, 0x70391c, 0x7e4122, 0x844422, 0x854523, 0x854622, 0x874926, 0x7e4222, 0x7e4420, 0x814620, 0x854721, 0xa36438, 0xac6837, 0xa6602d, 0xca8549, 0xc98544, 0xc37f42, 0xcd8e44, 0xcc8a3f, 0xa7621f, 0xd7b877, 0xf5dd90, 0xb78131, 0xa66d31, 0xc69646, 0xd5a559, 0x72451e, 0x7a522d, 0x633f20, 0x79512d, 0x6b4725, 0x542e0f, 0x936a3c, 0xa2773f, 0x93683b, 0xa37c4b, 0x9b7843, 0xbf9c5f, 0xcba866, 0xc3a062, 0xa5854c, 0x6e4d25, 0x6b4825, 0xbc9662, 0x755531, 0xaa7c43, 0xc58e4a, 0x9e723e, 0x6e4724, 0x6e4a25, 0x7f552d, 0x885d2d, 0x8d632f, 0x986c34, 0xa8793a, 0xa77433, 0xb37f3e, 0xae7d3b, 0xab7b37, 0xb48340, 0xb28140, 0x9f6e32, 0xb0823f, 0xb78845, 0xb0803a, 0xba8940, 0xbc8b41, 0xb8863f, 0xb8853f, 0xbd8b40, 0xc08e43, 0xc8974b, 0xc39346, 0xc19245, 0xbc8c3f, 0xc39344, 0xdaab54, 0xdeac52, 0xd4a249, 0xd1a04b, 0xd1a34d, 0xd7a850, 0xdcad54, 0xe0b257, 0xddb156, 0xdcb257, 0xe6bb5f, 0xdfb056, 0xce9c46, 0xd6a74c, 0xdbac4f, 0xddae54, 0xddb056, 0xd9ad52, 0xdcae54, 0xe2b658, 0xddb157, 0xe2ba62, 0xddb15e, 0xc9994d, 0xb28548, 0x906639, 0x70451f, 0xa27a3d, 0xdfba6c, 0xe6c67f, 0xa18b5a, 0x6b512e, 0x6e4b2b, 0xb18746, 0xebc46b, 0xf7d67e, 0xf4d174, 0xf3cf72, 0xf0cd70, 0xf4d272, 0xf6d676, 0xf4d373, 0xf1cd6c, 0xedcb6b, 0xf5d47a, 0xf2c96c, 0xf2c86a, 0xf0ca6d, 0xf3d174, 0xf9db80, 0xf4d67c, 0xf5d377, 0xf0ca70, 0xf6d178, 0xfcde82, 0xf8d97c, 0xfcdd80, 0xf7d577, 0xf8d274, 0xf5d274, 0xf5d87e, 0xfade83, 0xf6d679, 0xf6d677, 0xf4d171, 0xf8d272, 0xfad477, 0xf9d375, 0xf7ce70, 0xf4ca70, 0xebc16c, 0xefc371, 0xd8a35b, 0xa05500, 0xd9b270, 0xffefac, 0xe9c47e, 0xcd8c43, 0xbe7f38, 0xe6bb61, 0xf2cb6f, 0xbf883a, 0xb0742c, 0xdeba6b, 0xe7cb75, 0xc69949, 0xbf8a3e, 0xb88740, 0xc19143, 0xe8b96a, 0xcd9d58, 0x8b5e2f, 0x62320c, 0x874e15, 0xaf7531, 0xedc365, 0xf8dc88, 0xfde99f, 0xd09e57, 0xb06527, 0xa25f2c, 0x915528, 0x834a22, 0x764521, 0x6c3d1c, 0x5f381b, 0x553319, 0x4d2c16, 0x422411, 0x3e2411, 0x392213, 0x362010, 0x402918, 0x4c3222, 0x321c0d, 0x311d0f, 0x2c180a, 0x2b190d, 0x27170c, 0x201209, 0x1d1108, 0x24160d, 0x2a1a10, 0x1d0f06, 0x1b0e06, 0x170d04, 0x160c04, 0x150b05, 0x140b04, 0x140b04, 0x130b04, 0x130b04, 0x130b04, 0x0f0a04, 0x0d0804, 0x0c0704, 0x0b0702, 0x0b0703, 0x0a0602, 0x090501, 0x080500, 0x070400, 0x060501, 0x050400, 
-  0x120b04, 0x150c04, 0x170c03, 0x190e05, 0x1a0e06, 0x1c0f07, 0x1e1107, 0x1f1106, 0x231208, 0x241209, 0x24120a, 0x2d1505, 0x391b03, 0x2d1807, 0x2b190c, 0x301a0a, 0x331c0d, 0x391f0f, 0x391f0e, 0x3b210e, 0x40220e, 0x442510, 0x4a2811, 0x542c14, 0x603116, 0x6a3619, 0x753d1d, 0x804321, 0x8a4926, 0x8e4c29, 0x8e4c29, 0x904d29, 0x935129, 0x97532b, 0x9e592b, 0xa7622f, 0xae6934, 0xc68244, 0xcd8b47, 0xcc8947, 0xd7974f, 0xc8813c, 0xc18943, 0xfdeda4, 0xdcbd79, 0xa67026, 0xaf7736, 0xe0ad57, 0xa77b3e, 0x7a512b, 0x79512a, 0x633e20, 0x714b26, 0x754e28, 0x916230, 0xae7a3f, 0x936837, 0x58381a, 0x381c03, 0x301407, 0x351d03, 0x5a4624, 0x7e683e, 0xa98a54, 0xb28b4e, 0x906836, 0xab8451, 0xa2793e, 0xb98945, 0xc79756, 0x86582a, 0x764e27, 0x7c5429, 0x946733, 0x9c6d32, 0x9d6f33, 0x9c6d32, 0xa67636, 0xb4823e, 0xaf7d39, 0xa97836, 0xa67532, 0xaf7f3b, 0xb68643, 0xa57836, 0xad7e3f, 0xa97a3d, 0xb88a4a, 0xb88947, 0xb58544, 0xb38341, 0xb28240, 0xb88740, 0xbb8941, 0xbb8940, 0xb9883e, 0xc09046, 0xbf8e44, 0xbe8e41, 0xd1a24f, 0xd2a14a, 0xcd9b45, 0xc49242, 0xcb9b4c, 0xd09e4d, 0xd3a24c, 0xd9ab51, 0xdcb055, 0xd7a951, 0xd9aa4f, 0xd8a94d, 0xd6a64c, 0xdaaa4e, 0xd9aa4e, 0xddb055, 0xe1b558, 0xdeb256, 0xdfb358, 0xe0b557, 0xddb256, 0xdcb059, 0xd3a456, 0xbb8d47, 0x956c37, 0x794e27, 0xb38645, 0xe1b75e, 0xd6b364, 0x6a492b, 0x6a411c, 0x976d41, 0xa97c45, 0xcf9f57, 0xe7be68, 0xf7d680, 0xf4d479, 0xf5d379, 0xf5d379, 0xf2d074, 0xf4d374, 0xf4d474, 0xf4d271, 0xf1cd6e, 0xeeca6d, 0xf0ca6b, 0xf4cd6f, 0xf5cf72, 0xf4d074, 0xf9da7f, 0xfbde84, 0xf2d176, 0xf3d076, 0xf2ce76, 0xf6d278, 0xf8d67a, 0xf8d87c, 0xf9d87b, 0xf5d376, 0xf8d97e, 0xfbe18b, 0xf7d984, 0xfbd881, 0xfbd97f, 0xfddb7f, 0xfbd87b, 0xfad87b, 0xfad87b, 0xf8d476, 0xf6d377, 0xfad47c, 0xeec471, 0xe2b469, 0xb37535, 0xb16f29, 0xf6d488, 0xfbe49a, 0xcf9b49, 0xd99b44, 0xe9b75b, 0xcfa047, 0xe2b25d, 0xe5b15d, 0xd9af5a, 0xfbdd82, 0xfade83, 0xf4df8c, 0xdfbf78, 0xba8b46, 0xcc9b51, 0xcb9956, 0x9f6d3b, 0x673d19, 0x744019, 0x8d4c16, 0xd7ab56, 0xf9da7f, 0xffeaa2, 0xeecb86, 0xbc7633, 0xaa6531, 0x995a2d, 0x884d24, 0x794721, 0x6d3f1f, 0x5f381d, 0x553218, 0x4c2c16, 0x452916, 0x462b19, 0x3a2214, 0x362012, 0x341e0d, 0x341c0b, 0x331f11, 0x311c0e, 0x2f1a0d, 0x29180d, 0x24150b, 0x20130a, 0x1e1109, 0x23150c, 0x27190f, 0x1e1007, 0x1c0f07, 0x1a0e05, 0x190d05, 0x160c05, 0x160c05, 0x140b04, 0x130a03, 0x140a03, 0x130a04, 0x120a04, 0x0f0904, 0x0d0804, 0x0c0703, 0x0d0804, 0x0b0702, 0x0a0602, 0x080601, 0x060500, 0x060501, 0x060400, 
-  0x0f0903, 0x130b04, 0x150c04, 0x180d05, 0x1b0e06, 0x1e1007, 0x201108, 0x231209, 0x25130a, 0x261506, 0x1f0b05, 0x563b28, 0xad8667, 0x40230e, 0x28170a, 0x311908, 0x2e1b0d, 0x311d0d, 0x361f0f, 0x3a200f, 0x3f210d, 0x44240f, 0x4a2813, 0x512c14, 0x583017, 0x5d3217, 0x653518, 0x6c391a, 0x773e1d, 0x844523, 0x8f4b28, 0x9c552b, 0xa55d2f, 0xaa6133, 0xaf6733, 0xb86f38, 0xc3793f, 0xc47c3a, 0xcf8a43, 0xd6944a, 0xd6974c, 0xc17531, 0xbd8d42, 0xf7e59d, 0xbf8c51, 0x9f6b2c, 0xbe8640, 0xe7b35f, 0x785225, 0x724d28, 0x704a25, 0x603d1d, 0x62401c, 0xb9884c, 0xa16f36, 0x643b17, 0x492a19, 0x4b3016, 0x523519, 0x5b4122, 0x5a4222, 0x402610, 0x250300, 0x130000, 0x52381d, 0x907140, 0x906534, 0xa47232, 0xba8c4f, 0x966e3c, 0x845b2b, 0x7b5229, 0x8c6130, 0xa57638, 0xa67433, 0xa37234, 0xa67535, 0xad7d37, 0xb07f37, 0xb08039, 0xac7d3c, 0xa37439, 0x9c6e34, 0x976b33, 0x926731, 0x8d6231, 0x83592c, 0x936b3b, 0x8c6331, 0x946935, 0x9e723b, 0xa2733b, 0xa97939, 0xae7c3d, 0xb58541, 0xb2823c, 0xb4853c, 0xb1823a, 0xae7f38, 0xb5853c, 0xb8883f, 0xc29149, 0xaf7e37, 0xb28038, 0xc28f43, 0xcc9846, 0xd3a24b, 0xd4a44c, 0xd4a24b, 0xdbaa52, 0xd7a850, 0xd7a950, 0xe0b257, 0xdaad53, 0xd8ae53, 0xe3b85c, 0xe5b95b, 0xdeb357, 0xe3b75a, 0xdcb052, 0xd4a650, 0xbf8e46, 0xa17640, 0x754e22, 0xb68a49, 0xdbad56, 0xdcb365, 0x85623f, 0x825d34, 0xa1753d, 0xb8894a, 0xc4944c, 0xd7a757, 0xe0b55e, 0xefcb72, 0xf4d476, 0xf4d476, 0xf2d173, 0xf6d576, 0xf4d171, 0xf4d171, 0xf2d072, 0xf5d173, 0xeeca6a, 0xf4d273, 0xf5d173, 0xf0ca6c, 0xefc96c, 0xf3d175, 0xf5d57b, 0xf8d77c, 0xf8d87e, 0xf9da81, 0xf5d073, 0xf7d374, 0xf8d374, 0xf3cb6d, 0xf2ca6f, 0xf8d37a, 0xf6d581, 0xf8d984, 0xf8d67d, 0xefcd71, 0xfbda7b, 0xfddd7c, 0xfadc7c, 0xfbde80, 0xfcde83, 0xfadc81, 0xf8d67c, 0xf6cf77, 0xf6ca77, 0xdaa45a, 0x984d06, 0xcb994b, 0xfde393, 0xeccb76, 0xebb451, 0xe7b04f, 0xf2c761, 0xfdde7f, 0xf0c66f, 0xd8a655, 0xdfb968, 0xdfc172, 0xf2d98e, 0xfff2a7, 0xfbea9d, 0xd4b16a, 0xb27939, 0xb68144, 0x895f32, 0x56270c, 0x733608, 0xbc8c42, 0xf5d172, 0xfae096, 0xfeeaa4, 0xd29c57, 0xaf692e, 0xa15e2e, 0x8d5126, 0x7e4923, 0x6e4020, 0x5f381d, 0x553117, 0x52321c, 0x442815, 0x412515, 0x3a2113, 0x382113, 0x372010, 0x351f0f, 0x311e10, 0x311c0d, 0x2a1202, 0x29180c, 0x25160c, 0x23140a, 0x21140a, 0x1f1108, 0x1e1107, 0x1e1108, 0x1e1108, 0x1e1006, 0x1c0f05, 0x190e06, 0x170d04, 0x160c05, 0x150b05, 0x140a04, 0x140a03, 0x130903, 0x120a04, 0x120a04, 0x0f0904, 0x0d0804, 0x0c0804, 0x0b0803, 0x090803, 0x070702, 0x080601, 0x080401, 
-  0x0d0803, 0x110a04, 0x130b04, 0x160c04, 0x190d04, 0x1c0f06, 0x1f1108, 0x221308, 0x261408, 0x261508, 0x27170b, 0x381e0d, 0x5f412d, 0x371e0b, 0x2d190a, 0x301a0a, 0x2e1b0b, 0x311d0c, 0x361f0f, 0x3b1f0e, 0x4f2e19, 0x53311a, 0x4b2712, 0x502b14, 0x552f16, 0x583017, 0x5b3217, 0x603319, 0x68371b, 0x733c1d, 0x7d4121, 0x8f4d24, 0xa75f2f, 0xb96d3a, 0xc77d42, 0xc67c3f, 0xcf8641, 0xd0893f, 0xd69346, 0xe1a24e, 0xcf8f3f, 0xc18236, 0xe2ca88, 0xefd28e, 0xab6d2a, 0x9f6a2e, 0xcf9b4c, 0xcb9b51, 0x633c1c, 0x6a4727, 0x644224, 0x4c2a0b, 0x9b713d, 0xc08c4b, 0x7b5227, 0x4c351c, 0x4f3416, 0x88653e, 0x936d43, 0x805831, 0x916c41, 0xa27f50, 0x7c5e39, 0x402919, 0x2c2210, 0x442b0d, 0x9b6c35, 0xb47f42, 0xa87f50, 0x6c481f, 0x875f34, 0x8d6130, 0x956530, 0xa87637, 0xae7c3b, 0xa67536, 0xaf7e3a, 0xb1813a, 0xac7c38, 0xa87a3b, 0x9b7038, 0x875f30, 0x754e24, 0x79522b, 0x7c542f, 0x75502b, 0x674523, 0x6e4b25, 0x805930, 0x875d33, 0x81562a, 0x8f6535, 0x9e733d, 0x956833, 0x9e7239, 0xaa7e41, 0xa87b3c, 0xa4793b, 0xa07439, 0xa3763b, 0xaa7b3e, 0xbb8c4f, 0xb68849, 0xb0803d, 0xb9873d, 0xc89445, 0xd8a551, 0xd6a550, 0xd09f4a, 0xcb9a48, 0xd6a756, 0xd3a554, 0xdeb05c, 0xdeb25d, 0xe1b861, 0xe4ba5e, 0xe4b859, 0xddb053, 0xdfb159, 0xd8ab51, 0xc49549, 0xa7783e, 0x77512a, 0xa38249, 0xdbb25d, 0xe9c26f, 0xa6834e, 0x835934, 0x9e743e, 0xb08145, 0xcd9e53, 0xe1b25f, 0xdeae5c, 0xddaf5e, 0xe5bb63, 0xebc46a, 0xefc96b, 0xecc867, 0xf6d370, 0xf4d26e, 0xf0ce6d, 0xf7da7e, 0xf5d57a, 0xeecb6e, 0xf6d677, 0xf7d577, 0xf4cf72, 0xf6d073, 0xf4d173, 0xf8d679, 0xf5d074, 0xf5d077, 0xf7d37c, 0xe9c068, 0xeec56b, 0xefc36a, 0xebbd65, 0xe5b45e, 0xe5b664, 0xe4ba6b, 0xe2bc6b, 0xf5d17a, 0xfad479, 0xfbd87a, 0xfadb7b, 0xf7da7b, 0xfbde81, 0xfce085, 0xfbdd83, 0xf9d97f, 0xf7d37a, 0xf5cb71, 0xeab864, 0xac7033, 0x9b5b0f, 0xe6bc6a, 0xfde590, 0xe8be5f, 0xecba53, 0xeec463, 0xd1a759, 0xba843d, 0xb67831, 0xb57530, 0xa66821, 0x9f6828, 0xbf9c61, 0xeed58c, 0xffed9e, 0xdcb76f, 0xb57c36, 0x9e6e3b, 0x593113, 0x602e06, 0xa3692b, 0xecbf67, 0xf6d887, 0xfff0ac, 0xe7bf7a, 0xb3702c, 0xa6622f, 0x905426, 0x824a24, 0x714220, 0x62391c, 0x5f381e, 0x54311a, 0x452713, 0x402412, 0x3c2312, 0x382211, 0x382110, 0x351f0f, 0x311e10, 0x372112, 0x533e30, 0x2b180a, 0x27160b, 0x271609, 0x261509, 0x23140a, 0x211408, 0x201208, 0x201209, 0x1f1108, 0x1e1006, 0x1b0e06, 0x190d04, 0x180c05, 0x160b06, 0x150b03, 0x150a02, 0x150903, 0x150902, 0x140902, 0x120a02, 0x110a03, 0x100903, 0x0d0803, 0x0b0803, 0x0a0802, 0x0a0702, 0x0a0702, 
-  0x0b0803, 0x0f0904, 0x120a05, 0x140a03, 0x150c03, 0x190e04, 0x1b0f06, 0x1e1106, 0x241306, 0x26150b, 0x28180b, 0x2a180c, 0x240e05, 0x2e1a0b, 0x301b0b, 0x301c0d, 0x321c0a, 0x331e0d, 0x371f10, 0x3c1f0e, 0x4d2b16, 0x54311a, 0x4b2712, 0x4f2a14, 0x542d16, 0x572f17, 0x573017, 0x593119, 0x60341b, 0x68381c, 0x723d20, 0x7e4423, 0x9d592f, 0xad6232, 0xbc7238, 0xc98240, 0xd49044, 0xde9d4d, 0xedb35e, 0xeaaf57, 0xcc8434, 0xdbac61, 0xfff9ba, 0xe1be7e, 0xae732e, 0xac7537, 0xe8b764, 0xa4793e, 0x6a4225, 0x5c3b1a, 0x52361f, 0x603e1f, 0xbb8948, 0xa77a41, 0x542f15, 0x543015, 0xa27e4b, 0xb28a55, 0x6f4a22, 0x734e25, 0x987344, 0xa6824c, 0xbf9a62, 0x957646, 0x3a1b12, 0x72512d, 0xa97539, 0xc49251, 0x7d5a32, 0x644421, 0x815a30, 0x926430, 0xa27136, 0xab7937, 0xb2813e, 0xac7c39, 0xb3833f, 0xa37233, 0x9a6a32, 0x8a5f2e, 0x7a542b, 0x6a4924, 0x704f2e, 0x664324, 0x6c4822, 0x724e25, 0x734e29, 0x754f28, 0x7f552b, 0x7d522a, 0x724923, 0x764e22, 0x8b6333, 0x845c30, 0x825b2f, 0x8d6536, 0x8f6737, 0x865f33, 0x825b2e, 0x8f6536, 0x9b713c, 0x986b33, 0x966a32, 0xbc8d4b, 0xb88740, 0xbd8b40, 0xd29f51, 0xca9747, 0xcc9b4b, 0xc29247, 0xba8a45, 0xaf803b, 0xc19246, 0xcda052, 0xd8ae59, 0xe3ba5f, 0xdbb152, 0xdcae51, 0xdbab56, 0xd0a14f, 0xb88949, 0x895d35, 0x614116, 0xd6b66d, 0xe2bb63, 0xe1c47c, 0x765233, 0x966a3c, 0xaf8044, 0xc6974f, 0xddaf59, 0xdfb157, 0xcc9c4d, 0xb08242, 0xcda158, 0xd7a756, 0xdcaf5a, 0xf5cb6d, 0xf2cd6b, 0xf6d472, 0xf4d676, 0xf5dc81, 0xf2d67c, 0xf5d57a, 0xf1d273, 0xeecb6e, 0xeecb6e, 0xf2ce70, 0xf2cd6f, 0xf1ca6d, 0xeabd63, 0xe3b55e, 0xe4b563, 0xd7a357, 0xd9a65b, 0xdbac60, 0xd4a557, 0xddac5d, 0xd6a558, 0xdcad62, 0xd9a95e, 0xdaa95b, 0xe1b562, 0xf3ca75, 0xf6d67c, 0xfcdf85, 0xfbdd88, 0xf9da81, 0xf9db80, 0xfbdc83, 0xfbd980, 0xf3cf76, 0xefc066, 0xd2984b, 0x97581f, 0xc08a3d, 0xf8dc89, 0xf3d480, 0xe5b14c, 0xcb9443, 0xca9044, 0xdaab5d, 0xe1b669, 0xe6ba6d, 0xdeb165, 0xc7914e, 0x985912, 0x895a18, 0xe4ca7f, 0xf9df8b, 0xb4813c, 0xae7744, 0x734b26, 0x522802, 0x9b591f, 0xd8a354, 0xf6d77f, 0xfcecaa, 0xf8dd9c, 0xbd823b, 0xa96430, 0x945629, 0x834a23, 0x72421f, 0x653a1c, 0x6a4025, 0x5a341b, 0x4a2a15, 0x452813, 0x40240d, 0x3c220d, 0x3a2210, 0x38200f, 0x341e0f, 0x382112, 0x523d2e, 0x2d1808, 0x2b190b, 0x2b1809, 0x281608, 0x261609, 0x251507, 0x221206, 0x211209, 0x201108, 0x1f1209, 0x1e1108, 0x1c0f07, 0x1c0e07, 0x1b0d07, 0x1a0d05, 0x190d04, 0x190c03, 0x190c04, 0x190c04, 0x170c03, 0x150b02, 0x140b03, 0x120a04, 0x0f0a03, 0x0c0802, 0x0b0803, 0x0a0702, 
-  0x0a0702, 0x0d0802, 0x120904, 0x130a03, 0x130a03, 0x150b03, 0x180d04, 0x1c0f07, 0x201108, 0x231209, 0x27150b, 0x29170b, 0x2b180b, 0x2d1a0c, 0x2e1b0d, 0x311d0e, 0x351e0e, 0x351e10, 0x391f10, 0x3f210f, 0x45220f, 0x482511, 0x4b2814, 0x4d2b16, 0x512d17, 0x542d17, 0x572e19, 0x5a311b, 0x60341b, 0x68391c, 0x733e20, 0x7d4321, 0x8c4d26, 0xa05b2f, 0xaf6830, 0xc17b3b, 0xd48d46, 0xde9d4a, 0xecb259, 0xecae58, 0xcb7f30, 0xd0a159, 0xfbeaa7, 0xcd9b56, 0xaa7031, 0xc48e49, 0xeab868, 0x7f5426, 0x633f22, 0x5b3d22, 0x452e1b, 0x7a5427, 0xbd8f4d, 0x7d572f, 0x533117, 0x8d683f, 0xc29557, 0x7f5120, 0x8e663b, 0x5b3e1e, 0x472d15, 0x5c4022, 0x7c582e, 0xa1814d, 0x664a31, 0x916b39, 0xaf7839, 0xb5844a, 0x613f1a, 0x654523, 0x785028, 0x90642e, 0x9e6e32, 0xaa7936, 0xb17f39, 0xbc8843, 0xaf7d39, 0xa07037, 0x865c2b, 0x714c25, 0x613f24, 0x613f23, 0x79532a, 0xa8824a, 0xc29a60, 0xcca163, 0xcea366, 0xc69f64, 0xc19d63, 0xb8975f, 0xaf8f5d, 0xae9769, 0x876943, 0x5f3c1a, 0x7d5e39, 0x917145, 0x977642, 0x997440, 0x976f3c, 0x9f7844, 0xa58146, 0xa28049, 0xa78857, 0xb18f5d, 0xaf8043, 0xb1803e, 0xbc8943, 0xc48e44, 0xbe8b45, 0xaf8241, 0x8e6030, 0x987545, 0xd0b176, 0xbb8a44, 0xcfa04d, 0xe2b961, 0xe2ba60, 0xd6a84e, 0xd4a24c, 0xc39149, 0xa3763f, 0x6b431e, 0x9c7f4a, 0xe0c06e, 0xecca7b, 0xb8a06b, 0x794e29, 0x9d713a, 0xc79852, 0xd5a758, 0xd4a455, 0xcb9c4e, 0xaa7a3e, 0x734a1c, 0xdcc087, 0xcfa45e, 0xcc9b49, 0xeabb5f, 0xf2c969, 0xf3d172, 0xfae084, 0xf9e185, 0xf4d578, 0xf6d67a, 0xfadb80, 0xf3cf74, 0xf5d274, 0xf4cf71, 0xefc366, 0xdaa852, 0xd8a456, 0xd29e52, 0xc2904b, 0xb88447, 0xbc8944, 0xc4974e, 0xcea862, 0xdcb970, 0xdebf75, 0xe2c277, 0xe0bc70, 0xdbae62, 0xd5a553, 0xdca553, 0xe9be68, 0xf9d379, 0xfcde85, 0xfbdb82, 0xf9db80, 0xfcde87, 0xfcde86, 0xfad97e, 0xf6cd70, 0xebb762, 0xbb8242, 0x92520f, 0xe3be70, 0xfeeb9d, 0xe6ba61, 0xeab053, 0xe6b057, 0xf4cc73, 0xf1d076, 0xe7c26b, 0xe8c473, 0xfad784, 0xd7a85a, 0x824c17, 0x825d27, 0xf4d883, 0xddb96b, 0xb67e42, 0x916336, 0x522905, 0x9f6028, 0xc4863d, 0xefcb75, 0xfbe59f, 0xfff0b5, 0xd1a362, 0xaa642d, 0x9a592e, 0x844924, 0x744220, 0x663b1e, 0x60341c, 0x5c341b, 0x503019, 0x4b2912, 0x5f3d29, 0x553624, 0x3b200c, 0x3b2010, 0x361f10, 0x331e10, 0x2d1808, 0x301c0d, 0x301b0c, 0x2e1a0b, 0x2a1809, 0x291709, 0x281608, 0x251407, 0x241307, 0x231208, 0x221208, 0x221208, 0x211107, 0x211007, 0x200f07, 0x1f0f05, 0x1f0f05, 0x1e0f06, 0x1d0f07, 0x1d0f08, 0x1c0e07, 0x180d04, 0x140b02, 0x130b04, 0x0f0a03, 0x0c0902, 0x0b0802, 0x090702, 
-  0x0a0702, 0x0a0701, 0x100903, 0x120a04, 0x120a03, 0x140b04, 0x160c04, 0x180d05, 0x1c0e06, 0x1f1008, 0x221209, 0x26150a, 0x28160a, 0x2a180b, 0x2b190d, 0x2f1c0e, 0x341e0f, 0x371f10, 0x3b200f, 0x452614, 0x4c2a16, 0x492612, 0x4c2914, 0x4f2c16, 0x522d16, 0x5b321b, 0x5d3018, 0x5d2f16, 0x63351d, 0x6b3a1f, 0x743f22, 0x844b29, 0x8c4d26, 0x9a562a, 0xb6703b, 0xcc864b, 0xcc843e, 0xda9745, 0xebac54, 0xd89541, 0xbf7322, 0xe0c583, 0xf2d890, 0xc1843c, 0xa97336, 0xd19a50, 0xcb9950, 0x764b23, 0x634327, 0x573b25, 0x331309, 0x8a642d, 0xd0aa63, 0x5e3f20, 0x3e1607, 0xb78d54, 0xbd8a47, 0xa1753c, 0xa07a44, 0x4d2b14, 0x4b331d, 0x381f0f, 0x45281a, 0x543a20, 0x72522f, 0x9e7138, 0xcc9b5a, 0xa27843, 0x603c1c, 0x654222, 0x81572c, 0x9c6e35, 0x9e6e33, 0x9c6b2e, 0xab7a38, 0xb27f3b, 0xa57034, 0x8f652e, 0x74532b, 0x583518, 0x88663a, 0xae8346, 0xbf8c49, 0xc08d4d, 0xb6864c, 0x9e703e, 0x906838, 0x926f3f, 0xb18c54, 0xcda664, 0xd2ab65, 0xf3d999, 0x937f59, 0x1c0000, 0x47351e, 0x725934, 0xa6834c, 0xd6a761, 0xdaa95a, 0xe0b465, 0xe2ba66, 0xefd085, 0xe6cd8f, 0xb79c72, 0xa17440, 0xb78442, 0xb4833d, 0xba8840, 0xb18241, 0x9e7442, 0x73471e, 0xc3a065, 0xf3e2ab, 0xb99056, 0xc09240, 0xc99b4b, 0xd0a350, 0xd4a550, 0xc59443, 0xb88947, 0x996f40, 0x562900, 0xc9aa6c, 0xdab662, 0xedd08b, 0x8c6a42, 0x8e6332, 0xb18342, 0xd2a156, 0xd4a457, 0xcd9e52, 0xbc8a4e, 0x82572e, 0x966e2b, 0xf7e1a8, 0xdac492, 0xc69241, 0xcf9d49, 0xe9be62, 0xf3cb6c, 0xf2d375, 0xf4d77a, 0xf2cf71, 0xf5d175, 0xf6d279, 0xecc268, 0xf0c668, 0xecbf63, 0xe2ae55, 0xd29d50, 0xba8447, 0xa06a31, 0x955c1d, 0xb4863d, 0xe7c773, 0xfae48e, 0xfeeb9b, 0xf8e498, 0xf0de94, 0xf2e099, 0xf9eaa3, 0xfaefa5, 0xf6e7a2, 0xecd796, 0xdebc76, 0xe3b569, 0xf4d179, 0xfcdc81, 0xfce089, 0xfde28f, 0xfde38b, 0xfce084, 0xf9d377, 0xe9b65e, 0xd49c53, 0x824504, 0xb98945, 0xfde59e, 0xf1d88c, 0xeab354, 0xcf923c, 0xe7b766, 0xd0a95d, 0xd2a65c, 0xdaae5e, 0xcbaa56, 0xf8d27b, 0xca984f, 0x6b3504, 0xbb9853, 0xf5d17a, 0xb07e3d, 0x9a6837, 0x5e3315, 0x783e13, 0x99571a, 0xe0b768, 0xf8dc8d, 0xfeeeae, 0xe8c788, 0xab6729, 0x9c582b, 0x884c28, 0x7a4625, 0x6b3c1b, 0x643619, 0x5f361c, 0x563319, 0x512e16, 0x573520, 0x4e301c, 0x3e2311, 0x3e2313, 0x3a2112, 0x372011, 0x351f10, 0x341e10, 0x341d0f, 0x311b0d, 0x2e190b, 0x2c170a, 0x2a170a, 0x2d1a0d, 0x2b180b, 0x2a1609, 0x2b1609, 0x2b1609, 0x2a1609, 0x29160a, 0x28150a, 0x261509, 0x251409, 0x241309, 0x201107, 0x1d0f07, 0x190d05, 0x150b02, 0x130a03, 0x120b03, 0x0e0a03, 0x0b0802, 0x0a0702, 0x090601, 
-  0x0a0702, 0x0a0702, 0x0d0702, 0x110a05, 0x120b05, 0x120b04, 0x140b05, 0x160b04, 0x180d04, 0x1a0e05, 0x1d1007, 0x211208, 0x241309, 0x27150b, 0x29180d, 0x2b190d, 0x301c0e, 0x361e0f, 0x3a2010, 0x402412, 0x462714, 0x472713, 0x4a2915, 0x4e2c15, 0x522d15, 0x5f361d, 0x704329, 0x7a4d33, 0x653516, 0x6e3c1b, 0x774121, 0x884e2b, 0x8d4f27, 0x99562b, 0xb16b39, 0xc17b41, 0xca823d, 0xda9846, 0xecab55, 0xd68f3a, 0xdaa862, 0xfff4ae, 0xe4c075, 0xb47732, 0xb07a39, 0xe2ad61, 0xa0723a, 0x714928, 0x5a3b1e, 0x5b3c22, 0x553725, 0x906a30, 0xd6b46d, 0x523619, 0x482816, 0xa4793c, 0xdcaa61, 0xd3b276, 0xc1ab7a, 0x6d3c10, 0x755127, 0x6d4a25, 0x513822, 0x452e20, 0x87603b, 0xa7763a, 0xcca05d, 0x724d24, 0x5a3719, 0x79522c, 0x895b2c, 0x9a6a2e, 0xa06f33, 0x9a692d, 0x9d6c2d, 0xa47434, 0x8c612d, 0x6e4b27, 0x502e17, 0x926f44, 0xd5a763, 0xcc984e, 0xca9a56, 0xb48b55, 0x6e4c2a, 0x391e08, 0x2b1504, 0x200000, 0x290000, 0x6f4b25, 0x9b692b, 0xccab6e, 0x7c6442, 0x452b16, 0x2b1d0b, 0x0e0000, 0x3b1202, 0x926631, 0xc79542, 0xca9f48, 0xdaae57, 0xedcf87, 0xb69e6e, 0x521700, 0xa0713c, 0xb78343, 0xb78542, 0xb3823f, 0x9e733d, 0x77532f, 0x714c23, 0xcfaa63, 0xf1e2a9, 0xd5bd8d, 0xb18436, 0xc0914a, 0xc8974d, 0xd4a555, 0xc39348, 0xa97d41, 0x845e38, 0x684626, 0xdab470, 0xe0bc6b, 0xd4b778, 0x794e21, 0x9f713d, 0xc0904c, 0xd3a150, 0xd9a957, 0xc99b52, 0x9d6b3b, 0x693d16, 0xbc8d39, 0xf3da98, 0xf0e3b5, 0xc39551, 0xc59148, 0xdaab58, 0xeec265, 0xf6d274, 0xfad97c, 0xf5d071, 0xefc96b, 0xecc36a, 0xe7b85e, 0xebbb63, 0xe1ae5b, 0xce984e, 0xad783d, 0x88531f, 0xa47636, 0xdeb467, 0xf9db81, 0xffe789, 0xeccd79, 0xc19650, 0xa7712b, 0x975e17, 0x965f21, 0xad7e41, 0xd1ad65, 0xf1da8d, 0xfef6af, 0xfdf6bb, 0xf0dbab, 0xe3bb6b, 0xf5d076, 0xfcde88, 0xfee491, 0xfbe28a, 0xfae084, 0xfbd980, 0xf0c46b, 0xdba858, 0xa36d33, 0x925200, 0xedce8d, 0xfff0b1, 0xcea059, 0xbd7e32, 0xca954a, 0xae7d41, 0x783e04, 0xb18547, 0xd7a75b, 0xdcb25d, 0xebbc63, 0x965f2a, 0x83591b, 0xf4d279, 0xcca35e, 0xa96f36, 0x794a25, 0x5c2f09, 0x7f3f08, 0xc99c55, 0xfbdf88, 0xfae99e, 0xf8df9e, 0xb67b3b, 0x9d5827, 0x8f522b, 0x814824, 0x88502a, 0x814d2b, 0x6a3c1d, 0x63381a, 0x623a21, 0x512c14, 0x492813, 0x432714, 0x402513, 0x3f2311, 0x3e2110, 0x3b210f, 0x39200f, 0x371f10, 0x361f0e, 0x351e0d, 0x331c0b, 0x331a0b, 0x361c0d, 0x361d0e, 0x361c0d, 0x361d0d, 0x351c0d, 0x331c0e, 0x301a0d, 0x2c180b, 0x29160a, 0x26160a, 0x221207, 0x1e1006, 0x1a0d04, 0x160c03, 0x130a02, 0x120b04, 0x0f0903, 0x0c0904, 0x0b0803, 0x0a0702, 0x090602, 
-  0x090702, 0x0a0702, 0x0b0703, 0x0d0804, 0x0f0a05, 0x110a05, 0x130b05, 0x150c06, 0x160c05, 0x170c04, 0x1a0e05, 0x1d1007, 0x201007, 0x24130a, 0x25140c, 0x29170d, 0x2c180c, 0x321c0e, 0x361e0f, 0x3a1f10, 0x3e2212, 0x432513, 0x472815, 0x4c2c17, 0x522f18, 0x583118, 0x693d23, 0x76492f, 0x6a391c, 0x703d1e, 0x794222, 0x844926, 0x8b4d25, 0x99572d, 0xa76331, 0xb97136, 0xce8640, 0xe09f4d, 0xeaac58, 0xd58f3c, 0xe4bf7c, 0xfff2ad, 0xcc9d53, 0xb77d3e, 0xc1873e, 0xe3b264, 0x734d25, 0x5f3b21, 0x654223, 0x75512c, 0x7d5e40, 0x845b25, 0xd3ae69, 0x674a2a, 0x4c301a, 0x744c23, 0xb8833f, 0xd7b375, 0xd6c492, 0x865b31, 0x755029, 0x754f2a, 0x6a4727, 0x51341b, 0xa07545, 0xc4914d, 0xa9804a, 0x563218, 0x61401e, 0x875d2e, 0x956330, 0x9c6a2f, 0xa27033, 0xa27232, 0xa17134, 0x95662f, 0x7b5429, 0x5d3b1f, 0x634726, 0xd3b47a, 0xbf8f48, 0xc99b52, 0xdcbb7d, 0x664c29, 0x472a1a, 0x553a21, 0x533c20, 0x422f18, 0x251608, 0x1a0000, 0x835b2d, 0xc9a76a, 0x7d5f39, 0x684523, 0x503718, 0x3a2917, 0x271404, 0x6d4822, 0xbd8845, 0xc89647, 0xcd9a46, 0xe7cc87, 0xd0ba8a, 0x805225, 0x926634, 0xa2763e, 0xa0743b, 0xa3743c, 0x8e6738, 0x59371a, 0x987643, 0xdaaf5f, 0xf0d58e, 0xefe3b7, 0xa97f40, 0xa6793c, 0xbd8e48, 0xc9994e, 0xc1924d, 0xa27842, 0x583416, 0x8d6f42, 0xd3ab5d, 0xe7c175, 0xab8f5e, 0x855828, 0xa07039, 0xc19148, 0xd9a957, 0xca9a4f, 0xa5773c, 0x744f28, 0x76501d, 0xcc9e49, 0xedd17b, 0xfdf3be, 0xcaac7b, 0xb8853d, 0xd8a85c, 0xeabf65, 0xefca6d, 0xf4d175, 0xf5cf70, 0xf2cb6e, 0xedc268, 0xebba62, 0xddad5b, 0xce9b54, 0xab783f, 0x7b4b15, 0xbb8c47, 0xf2cb73, 0xfee588, 0xffe78c, 0xd5b464, 0x895a1a, 0x80491d, 0x925f2f, 0x935d2f, 0x824920, 0x793601, 0x863e00, 0xad6d24, 0xdfb55e, 0xfbe697, 0xfcf4c2, 0xd6b170, 0xf1c46e, 0xfcdc82, 0xfde18a, 0xfde188, 0xf9dc81, 0xfee08c, 0xf7d57f, 0xedbf6a, 0xca934f, 0x8a4900, 0xc59b5b, 0xfff0b1, 0xeacb83, 0xc2823f, 0xdda75b, 0xe3ae63, 0xbf854a, 0xaa7533, 0xf3ca74, 0xe9c467, 0xe7b75e, 0xa87139, 0x7f4e16, 0xedd07a, 0xefca80, 0xc58643, 0x996636, 0x5e330e, 0x7e3b0f, 0xac7534, 0xf2d17b, 0xf7de8a, 0xfee7a2, 0xcc9b59, 0x9f5e26, 0x96572a, 0x8b4a22, 0xb27143, 0xa2673f, 0x753f1b, 0x83512f, 0x603417, 0x573117, 0x4f2e17, 0x4a2a16, 0x462713, 0x4a2915, 0x4d2c17, 0x472813, 0x432511, 0x432410, 0x422310, 0x42230f, 0x43240f, 0x452310, 0x452311, 0x442412, 0x402211, 0x3c200f, 0x391e0d, 0x331b0b, 0x2c1709, 0x271507, 0x241307, 0x201107, 0x1d0f06, 0x1a0e05, 0x170d04, 0x140b02, 0x120a02, 0x110a04, 0x0e0904, 0x0a0904, 0x0a0803, 0x0a0702, 0x090502, 
-  0x0a0702, 0x0a0703, 0x0b0603, 0x0c0703, 0x0e0904, 0x100a04, 0x120b05, 0x130c06, 0x140c05, 0x140c04, 0x170d05, 0x1a0f06, 0x1c0f07, 0x211008, 0x211104, 0x28160a, 0x2b170e, 0x2d190d, 0x311b0e, 0x341d0f, 0x381f11, 0x3d2212, 0x412414, 0x462916, 0x51301b, 0x5e3720, 0x5f341b, 0x66371f, 0x6e3c1f, 0x77411e, 0x7f4422, 0x8a4c25, 0x9f5f34, 0xa36032, 0xaa6430, 0xbf7738, 0xcd883f, 0xdd9a49, 0xd79546, 0xc27b29, 0xdcbc7a, 0xf6e09d, 0xb57e37, 0xac7338, 0xd5a053, 0xd9a961, 0x663d16, 0x5f3d21, 0x77512b, 0x77512a, 0x755735, 0x5d3400, 0xd3b16e, 0x8c7248, 0x45250f, 0x482a15, 0x774d21, 0x986c33, 0xe0c687, 0xa68655, 0x704b23, 0x6e4a25, 0x6b4225, 0x7d5e35, 0xb18243, 0xce9a54, 0x77532e, 0x634425, 0x7b572e, 0x8f632f, 0x97672f, 0xa57337, 0xad7a3a, 0xa57433, 0x9a6b33, 0x8d602e, 0x724e26, 0x3f0f00, 0xa89467, 0xcfb47c, 0xa87329, 0xd6af6f, 0xc7b27c, 0x572f02, 0x65452a, 0x694728, 0x644322, 0x573c1f, 0x3e2c1a, 0x140404, 0x563a12, 0xc8a868, 0x8d683d, 0x7e5529, 0x704e28, 0x4b321a, 0x291604, 0x59361a, 0xad7d40, 0xd2a14f, 0xcc9746, 0xd2b368, 0xecdead, 0x8e6a41, 0x6f4820, 0x845d32, 0x956935, 0x956937, 0x815b32, 0x4d2a0a, 0xbc9459, 0xd2a24f, 0xe8c26c, 0xf9f1c6, 0xc1a373, 0x8e6026, 0xa77b3f, 0xba8a48, 0xaa7d3d, 0x916a3d, 0x421905, 0xb08e54, 0xcea34e, 0xeac982, 0x8d6a40, 0x976a39, 0xa6773a, 0xc18f44, 0xca984c, 0xb08245, 0x8a6136, 0x553216, 0x99763a, 0xcea450, 0xefcd68, 0xf9eaab, 0xe3d1a5, 0xb6843c, 0xcd9d56, 0xebbf68, 0xecc669, 0xf1ce74, 0xedc96d, 0xf0c76b, 0xf2c46b, 0xe4b35b, 0xcc9950, 0xad7941, 0x7f4e14, 0xc09852, 0xf4cc73, 0xf8d773, 0xfce68b, 0xddc077, 0x754913, 0x98693b, 0xcd9a5c, 0xd29e5a, 0xbb8545, 0xb47d43, 0x9f6936, 0x814b1d, 0x834712, 0xa66320, 0xe5c073, 0xfcf2b2, 0xc8a065, 0xe9b862, 0xfedc7f, 0xfadb82, 0xfce089, 0xfce189, 0xf9da84, 0xf8d67a, 0xefc56a, 0xdba95c, 0xa26a32, 0x9c6217, 0xf1d993, 0xf8e3a2, 0xd49952, 0xe0a759, 0xdaa054, 0xc58947, 0xd09d4b, 0xf2ca69, 0xfbdb7b, 0xe6bb6c, 0xad763f, 0x926026, 0xf2d585, 0xeecb7f, 0xc07f3a, 0xad7640, 0x774a23, 0x75390e, 0x9d5919, 0xe3bb6c, 0xf8d982, 0xfde99d, 0xe6bf78, 0xa96728, 0x9f5c2b, 0x9f5a2a, 0x995425, 0x864821, 0x7b4321, 0x794322, 0x6b3b1b, 0x613719, 0x5a3318, 0x543018, 0x512d17, 0x57331a, 0x5a341c, 0x542e19, 0x532d16, 0x542c15, 0x542b15, 0x542d15, 0x542d16, 0x532d17, 0x4d2a15, 0x462512, 0x3f2211, 0x381e0d, 0x321a0b, 0x2c1708, 0x271507, 0x241307, 0x201107, 0x1e0f06, 0x1a0e05, 0x170d05, 0x150c04, 0x130a03, 0x120a03, 0x0f0a04, 0x0c0904, 0x0b0803, 0x090702, 0x0a0702, 0x0a0501, 
-  0x090601, 0x0a0602, 0x0b0603, 0x0c0703, 0x0d0803, 0x0f0903, 0x110a04, 0x120b05, 0x120b03, 0x130c04, 0x160d06, 0x180e06, 0x170f05, 0x241206, 0x52352a, 0x361c0f, 0x26180a, 0x29170c, 0x2d190d, 0x301b0d, 0x321c0f, 0x371f10, 0x3b2112, 0x3f2414, 0x472815, 0x522d18, 0x5b341e, 0x653820, 0x763f1c, 0xbd7f53, 0x9c5b31, 0x93552e, 0xaa6a3e, 0xac673a, 0xad6630, 0xc37d3b, 0xd08d42, 0xd79344, 0xc98135, 0xd09754, 0xfae5a0, 0xe5c37e, 0x9f6720, 0xa66f32, 0xe4b25e, 0xb98c4b, 0x7e5734, 0x624222, 0x704b27, 0x6a4522, 0xb29465, 0x4c2105, 0xbe9c5d, 0xbea568, 0x462207, 0x39250e, 0x412814, 0x421609, 0x8f6f3d, 0xcfae72, 0x704b25, 0x694522, 0x542e17, 0xa98149, 0xc18e45, 0xc09454, 0x60401a, 0x6c4c27, 0x815a2f, 0x8d602e, 0x966830, 0x97682e, 0xa47435, 0x95682a, 0x895f2d, 0x7e572b, 0x654625, 0x2d0000, 0xc5ae79, 0xad8b57, 0xa36e25, 0xdbbe83, 0xcdb787, 0x6e3f0e, 0x674726, 0x76522d, 0x7c5730, 0x74532d, 0x5b3f21, 0x37230e, 0x321500, 0xaf8d5d, 0x896239, 0x7c5226, 0x7e582f, 0x5f4025, 0x3e2914, 0x44240a, 0x926530, 0xcf9f4d, 0xd3a452, 0xcaa04d, 0xf3e1ad, 0xb29a74, 0x683d0e, 0x7e562e, 0x8f6333, 0x8d6234, 0x714c29, 0x6b4d27, 0xd0a664, 0xce9e48, 0xdeb45a, 0xf3e4ac, 0xe1d0a7, 0x8d5f20, 0x946832, 0x9f7037, 0x9b6e36, 0x7d572f, 0x502d10, 0xc8a163, 0xd5ac5b, 0xdbbc7d, 0x7c5227, 0x8d6230, 0xb18242, 0xc49147, 0xc08d46, 0xa57941, 0x7b552c, 0x59350f, 0xb48c49, 0xd5ab56, 0xf2cf6b, 0xedd688, 0xf7edc3, 0xc29c62, 0xc69452, 0xe4b763, 0xf0c86d, 0xf1cd71, 0xf1cc6f, 0xedc164, 0xe7b760, 0xd6a455, 0xb48144, 0x7c4817, 0xbc9355, 0xeec773, 0xf3d072, 0xf7d978, 0xf2da88, 0x906c39, 0x9a6c3e, 0xc49456, 0xe0af62, 0xe3b15f, 0xd8a455, 0xcc964c, 0xc48e4b, 0xbc854a, 0x965e2b, 0x7c3902, 0xa97535, 0xf6e39e, 0xc9a264, 0xe0ab57, 0xf7d275, 0xfedd83, 0xfadc83, 0xfbe48d, 0xf6d782, 0xf4d073, 0xf8cf72, 0xe6b461, 0xc48d4a, 0x864700, 0xcaa863, 0xffefac, 0xd6a960, 0xd6994c, 0xcb8e4f, 0xaa7331, 0xeec165, 0xf3c463, 0xe2b961, 0xc49951, 0xa67239, 0xa0702e, 0xfad883, 0xe3bc69, 0xc2853a, 0xb98045, 0x906134, 0x642f06, 0x934d12, 0xcb9d52, 0xfad77c, 0xf9e492, 0xf1cf83, 0xb06e2b, 0xad6430, 0xb46d39, 0x975527, 0x854a23, 0x7b4421, 0x7d4726, 0x794425, 0x6f3e20, 0x67391d, 0x64361c, 0x613520, 0x61351b, 0x63361b, 0x61371a, 0x63381a, 0x62351b, 0x5e331a, 0x5b321a, 0x552d17, 0x4e2915, 0x452410, 0x3c1f0d, 0x361c0d, 0x30190b, 0x2b1608, 0x281508, 0x241308, 0x1f1106, 0x1d1006, 0x1b0e05, 0x180d04, 0x150b03, 0x130a03, 0x120b03, 0x100a03, 0x0d0803, 0x0c0803, 0x0b0802, 0x0a0702, 0x0a0702, 0x0a0501, 
-  0x080500, 0x0a0702, 0x090602, 0x0b0703, 0x0c0804, 0x0d0804, 0x0f0a04, 0x110a04, 0x120b04, 0x120b04, 0x140c04, 0x150c05, 0x160d04, 0x1e0f04, 0x361d14, 0x2d150a, 0x241609, 0x28170c, 0x2b180d, 0x2d1a0d, 0x2d190c, 0x321c0e, 0x361f11, 0x392214, 0x402515, 0x4a2a17, 0x542f1b, 0x5e321b, 0x7f4e2e, 0x955b32, 0x8e5129, 0x854a25, 0x8c4d23, 0x9d582c, 0xb16934, 0xc8833d, 0xdb9a48, 0xe1a04e, 0xca8236, 0xe6bd7d, 0xfff2ae, 0xd1a359, 0x9f6828, 0xb27c3b, 0xe3b25e, 0x89602c, 0x634024, 0x5a3b1e, 0x603f21, 0x603b1a, 0xaf8b56, 0x56341c, 0x916836, 0xe2c27d, 0x785933, 0x4f3420, 0x412e15, 0x2d1a11, 0x6e481b, 0xdbbd7b, 0xa4885b, 0x623d1a, 0x624322, 0xb58544, 0xc18e47, 0x967543, 0x614220, 0x704d27, 0x7d552a, 0x885c2b, 0x90622e, 0x9b6c33, 0xb18343, 0x9a6c30, 0x83592b, 0x744f28, 0x583b20, 0x3a1a01, 0xc9a96d, 0xa1763a, 0xa16e2a, 0xcca970, 0xe9dba9, 0x896233, 0x6c471a, 0x6b4522, 0x764f2a, 0x724d29, 0x704e2d, 0x5d4225, 0x39220d, 0x58371e, 0x744f28, 0x845a2f, 0x865b2f, 0x734f2d, 0x52391e, 0x341600, 0x7f542d, 0xc49247, 0xcfa54f, 0xd3a04b, 0xecd193, 0xdac79c, 0x6e440e, 0x785027, 0x835b2f, 0x845b32, 0x60381a, 0x9e7e4b, 0xd2a960, 0xd4a64c, 0xdaad56, 0xe6c87d, 0xf5e8bd, 0xa5824f, 0x906331, 0x956937, 0x956b3b, 0x714d28, 0x76552d, 0xcda25f, 0xdfbb6f, 0xbfa16c, 0x7f5428, 0x90652f, 0xbc8c49, 0xcd9a52, 0xba8947, 0x9f7440, 0x6c4824, 0x795627, 0xc4974e, 0xdab156, 0xefcd6c, 0xefcf71, 0xfaf2c2, 0xd8c39c, 0xbf8c47, 0xd3a556, 0xebbf66, 0xeec568, 0xebc163, 0xe1b259, 0xd7a452, 0xbd8a4b, 0x815122, 0x947141, 0xe3bf75, 0xf4cd72, 0xf1cf71, 0xfbe18a, 0xc2a96a, 0x936437, 0xbe8d53, 0xcb9952, 0xdcab5b, 0xe4b55e, 0xeabb60, 0xeab862, 0xdaa556, 0xdda45c, 0xba8349, 0x7e471b, 0x833e00, 0xdcbc78, 0xc9a563, 0xdaa353, 0xf4c96f, 0xfad77d, 0xfadb80, 0xf8e08a, 0xfde28f, 0xf3d277, 0xf6ce70, 0xe6b35d, 0xd09a4f, 0x88501d, 0xa27232, 0xfae7a2, 0xeacb88, 0xce8d43, 0xa56930, 0xbf9248, 0xf2cb71, 0xb28642, 0x906027, 0x9c6634, 0xa06935, 0xc69a53, 0xf6cd77, 0xc2994a, 0xd9a95c, 0xbe8448, 0xa1703c, 0x62310f, 0x89491b, 0xaf7835, 0xf0c76b, 0xf5da82, 0xf9db8e, 0xc18744, 0xb76a30, 0xad6530, 0x9b5928, 0x8d5026, 0x834924, 0x854b27, 0x7d421c, 0x79411d, 0x79411e, 0x7a4220, 0x7b421f, 0x794119, 0x77401d, 0x733f1f, 0x6a3b1b, 0x623519, 0x5a3016, 0x512b14, 0x492612, 0x422211, 0x3a1e0d, 0x351b0c, 0x30190c, 0x2b160a, 0x271508, 0x251408, 0x211207, 0x1d0f05, 0x1a0e04, 0x180d04, 0x160c03, 0x130a03, 0x120a03, 0x110b03, 0x0e0903, 0x0c0703, 0x0c0703, 0x0b0802, 0x0a0702, 0x090601, 0x090400, 
-  0x060501, 0x0a0702, 0x0a0702, 0x0a0702, 0x0b0803, 0x0d0804, 0x0d0804, 0x0e0903, 0x120b05, 0x130c06, 0x130c04, 0x140d05, 0x170c06, 0x190d07, 0x191006, 0x1f1208, 0x23120a, 0x24140a, 0x27170c, 0x2a190c, 0x2b190c, 0x2f1c0d, 0x341e10, 0x382013, 0x3e2315, 0x452816, 0x4e2b17, 0x542e19, 0x6f472d, 0x6b4124, 0x6f3e21, 0x814b29, 0x894c27, 0x9b582f, 0xaf6733, 0xc57e39, 0xdf9f4b, 0xdd9e51, 0xb5712d, 0xc69f5d, 0xfae399, 0xb98543, 0x976128, 0xc89349, 0xdcad5f, 0x6d4720, 0x5a3a20, 0x5d3d1d, 0x5e3e24, 0x5f3918, 0xa07545, 0x4d3214, 0x70451e, 0xb9965a, 0xd2af72, 0x664220, 0x4d2e14, 0x3e271b, 0x3d1e00, 0xb99b63, 0xb69768, 0x532e06, 0x89663a, 0xb68442, 0xc49859, 0x684b27, 0x604123, 0x765129, 0x7e5628, 0x8b5f2e, 0x8e602c, 0x9d6d34, 0xad7c3c, 0x9f6f30, 0x936637, 0x744e28, 0x593d1f, 0x402409, 0xb48b51, 0xa07034, 0xa47034, 0xae7c3a, 0xebdaa0, 0xd2c493, 0x7a5320, 0x754e26, 0x78542d, 0x66431f, 0x674424, 0x6a4b29, 0x6a4b2c, 0x6a482c, 0x724f29, 0x875c2f, 0x8e6232, 0x7b532c, 0x5f4120, 0x391f0e, 0x694222, 0xad7e40, 0xcc9d4c, 0xca9542, 0xdab86c, 0xf0e1ae, 0x8b6c44, 0x7b5127, 0x886036, 0x7a522a, 0x552b07, 0xbd955c, 0xcfa250, 0xe5b75c, 0xd9aa51, 0xdaaf54, 0xf5e4ab, 0xc8b284, 0x92642e, 0x855b30, 0x835b33, 0x5b3717, 0xa27c4a, 0xc89b51, 0xe6c980, 0x96794f, 0x8d6233, 0xa17538, 0xc59349, 0xc08e48, 0xa7793f, 0x8b643a, 0x512a0a, 0xa98244, 0xd0a254, 0xe7c069, 0xefcb6f, 0xe7c160, 0xf2e1a3, 0xeee5c4, 0xbb9153, 0xc99650, 0xe2b360, 0xefc267, 0xedbe64, 0xdcaa56, 0xcd984e, 0xa97845, 0x693e10, 0xcbad6c, 0xebc974, 0xf2cd6f, 0xf3d276, 0xf5dd92, 0x937344, 0xab7a45, 0xc3924f, 0xd6a559, 0xeabb6a, 0xf0c56b, 0xefc568, 0xf0c46a, 0xe4b560, 0xe2ae5e, 0xce9a53, 0xa47037, 0x773300, 0xc89d5e, 0xcda460, 0xdca958, 0xf3c870, 0xfadb82, 0xf9dd84, 0xf8dd85, 0xfadd88, 0xfbdd82, 0xf8d575, 0xf0c269, 0xddab5d, 0xa67239, 0x7c4100, 0xeed290, 0xf7e4a2, 0xc48b45, 0x945d21, 0xe2b665, 0xe6c472, 0x946831, 0xa2713e, 0xb17941, 0xab7732, 0xf2cb78, 0xdbb264, 0xa58449, 0xf1d38c, 0xc08c4d, 0xa9743d, 0x693a1b, 0x733a13, 0x94541d, 0xdbaf59, 0xf7d57d, 0xffe99f, 0xdaae68, 0xbd7230, 0xb56b33, 0xab652f, 0xa05d2b, 0x975529, 0x9a592a, 0xa96a39, 0x8e5023, 0x8d4f25, 0x8c4d23, 0x915122, 0xa5683a, 0x7e451f, 0x6d391c, 0x603318, 0x552d14, 0x4d2811, 0x452512, 0x3e2111, 0x391e0e, 0x341b0c, 0x2f190b, 0x2c180a, 0x28160a, 0x25140b, 0x211208, 0x1d1006, 0x1b0d05, 0x180d03, 0x150c03, 0x140b03, 0x130b03, 0x110b03, 0x0f0a03, 0x0d0802, 0x0c0703, 0x0b0602, 0x0a0701, 0x090701, 0x090601, 0x090400, 
-  0x060501, 0x090702, 0x0a0702, 0x0a0703, 0x0b0804, 0x0d0905, 0x0d0804, 0x0e0804, 0x110a04, 0x120b05, 0x130c06, 0x130c05, 0x150c06, 0x180c05, 0x1a0e05, 0x1c1007, 0x1d1008, 0x1f120a, 0x22140a, 0x27160a, 0x2a180b, 0x2d1a0c, 0x331e0f, 0x371f11, 0x3c2113, 0x412514, 0x472915, 0x4d2c18, 0x512d13, 0x593117, 0x693c22, 0x7c4928, 0x844826, 0x97542d, 0xad6430, 0xc3783a, 0xd89649, 0xb87735, 0x955418, 0xd6b471, 0xf3d280, 0xa06b33, 0x96602b, 0xd29b4b, 0xc79a51, 0x5b3918, 0x614222, 0x7b572f, 0x523219, 0x6a4521, 0xb38855, 0x3a2307, 0x674423, 0x68401d, 0xb3935f, 0xceab6c, 0x98794d, 0x6c5231, 0x452a12, 0x845e33, 0x886438, 0x4a270f, 0xac814a, 0xac7d3a, 0xd0af76, 0x694b24, 0x614221, 0x825c30, 0x895f2f, 0x865b2a, 0x8b5f2b, 0x93652d, 0xa57639, 0x9f6f33, 0x845a2b, 0x6d4a24, 0x5c3f21, 0x381b07, 0x906233, 0x986733, 0xa37439, 0xa87534, 0xbe904b, 0xefdba6, 0xd8c99b, 0x916d41, 0x896230, 0x7a572d, 0x73502b, 0x76522d, 0x7e5830, 0x734e2a, 0x724f29, 0x926534, 0x966936, 0x80572c, 0x6b4a26, 0x492e1b, 0x4d2a07, 0x916733, 0xd09b50, 0xcf9e4a, 0xd3a84d, 0xf6e3ab, 0xb8a27a, 0x754913, 0x886034, 0x6b441e, 0x7b572f, 0xcfa164, 0xc79745, 0xd3a554, 0xe2b256, 0xdeac4f, 0xe9ce84, 0xe9daae, 0xa07441, 0x7f572d, 0x704c28, 0x4e2400, 0xbf9a61, 0xcfa459, 0xe1c783, 0x7d5932, 0x916734, 0xaf813f, 0xcc984c, 0xbc8d4a, 0x966d3a, 0x6a4927, 0x5c3913, 0xc99d50, 0xdbb262, 0xac8b4c, 0xe4bc6f, 0xecc569, 0xe8c979, 0xfcf4ca, 0xc0a67d, 0xb9823b, 0xd09d50, 0xdaa952, 0xe2b059, 0xcf994b, 0xbd8a48, 0x8e5f33, 0x8a6a3a, 0xe2c57a, 0xf0cd74, 0xf4cf71, 0xf0d27c, 0xe2ce8f, 0x8a5f31, 0xaa7a42, 0xc28f49, 0xdeac5f, 0xebbf67, 0xf2ca6a, 0xf5ce71, 0xf3cc6e, 0xf1c76c, 0xefc16a, 0xe6b360, 0xd49e55, 0x905b2a, 0x95622c, 0xb48543, 0xe8b966, 0xf3cb72, 0xfce089, 0xfce48f, 0xfde187, 0xf6d67c, 0xf9dc81, 0xfadb7c, 0xf7ce73, 0xe7b761, 0xc58e47, 0x7a4000, 0xd7b26c, 0xfff1a7, 0xba9151, 0x713900, 0xd0a253, 0xe3bc6a, 0x9f6e36, 0xb27c44, 0xa77030, 0xe0bb6e, 0xfde18a, 0xc5a053, 0xa48851, 0xfbe9a1, 0xc69b55, 0xb07943, 0x744725, 0x612f08, 0x854113, 0xce9f52, 0xf9d47e, 0xfdeaa3, 0xecca84, 0xc68138, 0xc27a37, 0xc8803f, 0xc27b3c, 0xb77035, 0xac662f, 0xa05e2c, 0x925226, 0x8e4f26, 0x8a4a21, 0x894820, 0x864b24, 0x6b3817, 0x5b3118, 0x522d15, 0x492712, 0x42230f, 0x3c2010, 0x361d10, 0x321b0c, 0x2e1809, 0x2a1709, 0x271508, 0x241308, 0x201209, 0x1e1007, 0x1c0e06, 0x1a0d05, 0x160c03, 0x140b03, 0x130b03, 0x120a03, 0x100b04, 0x0d0a03, 0x0b0802, 0x0b0602, 0x0b0603, 0x0a0702, 0x090601, 0x090601, 0x080400, 
-  0x060500, 0x0a0702, 0x0a0702, 0x0b0702, 0x0c0703, 0x0c0704, 0x0c0803, 0x0e0803, 0x110904, 0x120b05, 0x130b07, 0x140a08, 0x140b07, 0x170d04, 0x1b0e05, 0x1c0f07, 0x261206, 0x291308, 0x221309, 0x24140b, 0x28170b, 0x2c1a0c, 0x372113, 0x361f10, 0x392011, 0x3f2314, 0x472915, 0x4a2b17, 0x4c2c17, 0x543019, 0x5d351c, 0x714024, 0x864d2c, 0x91522a, 0xa86130, 0xbf753a, 0xd38f46, 0xb87233, 0xbb8a4e, 0xfce99f, 0xe5c06e, 0x8f5723, 0xa06a32, 0xe2aa55, 0xa57c3f, 0x4a3019, 0x613d1c, 0x855a2f, 0x553613, 0x7d5426, 0xab804b, 0x331800, 0x654527, 0x855c2e, 0x684117, 0x92703b, 0xbe9860, 0xb9955c, 0xa27642, 0x9c713f, 0x6a4827, 0x603e23, 0xba8e51, 0xbc9151, 0xbf9e6b, 0x68461d, 0x5b3c1e, 0x876131, 0x8c6028, 0x83582a, 0x835826, 0x8f622b, 0x94652e, 0xa06e36, 0x875a28, 0x714d27, 0x5b3e1e, 0x341a0d, 0x694726, 0x8f6337, 0x9a6c37, 0x9f6f36, 0xa46f2f, 0xaf8340, 0xe2c78e, 0xe6d099, 0xa88f63, 0x704716, 0x744e24, 0x76522e, 0x835b32, 0x83592f, 0x79562e, 0x9c6e3a, 0xa06f39, 0x885c2c, 0x755029, 0x4e3218, 0x371b06, 0x7a5025, 0xbe8c47, 0xc6973f, 0xcd9b3f, 0xe7cc8e, 0xe0d0a3, 0x885b24, 0x7c562d, 0x502500, 0xa98750, 0xd9ac61, 0xc1954d, 0x764d20, 0xd8a954, 0xe4b056, 0xdeb960, 0xf7ecc1, 0xb79a76, 0x794f1e, 0x694824, 0x643f1f, 0xd1b06b, 0xe2bd71, 0xcaae78, 0x7a5224, 0x8d6330, 0xb68744, 0xcc9a4e, 0xac8142, 0x876136, 0x4d2c16, 0x8a6a37, 0xd7a859, 0xd2b169, 0x583018, 0xb68b50, 0xe6bf69, 0xe5be63, 0xf7e9b5, 0xe5d8b1, 0xaf7a3b, 0xbd8840, 0xcf9a4b, 0xd6a351, 0xcb954b, 0xa97a41, 0x784c25, 0xb2965c, 0xe2c076, 0xedc86c, 0xf1c767, 0xf7e293, 0xd2bf8c, 0x91612c, 0xbf8f50, 0xd4a053, 0xe3b45e, 0xf0c96e, 0xefc86b, 0xefc76a, 0xf5cc70, 0xefc368, 0xf1c469, 0xe9b660, 0xdca757, 0xbd8949, 0x97612b, 0xbe8a48, 0xe6b863, 0xf1c96d, 0xf9da81, 0xfbe38c, 0xfce188, 0xfadd82, 0xfcdd83, 0xf9d57b, 0xf6cd70, 0xe5b45b, 0xd39b4d, 0x7f4b1b, 0xae8440, 0xffeda3, 0xd3b97d, 0x672a00, 0xae7f3c, 0xdbb160, 0xbb934a, 0xc8a258, 0xe3c06e, 0xfce288, 0xfeec9a, 0xc9a861, 0xab8b52, 0xfee89b, 0xc59953, 0xb27941, 0x7f5127, 0x5b2d0d, 0x793b0d, 0xbd8945, 0xeec46c, 0xf3d78f, 0xf9e09c, 0xd79d4c, 0xd49044, 0xd08942, 0xcb823e, 0xbe7739, 0xa55f29, 0x955326, 0x894a26, 0x7f441f, 0x7b411c, 0x7c411f, 0x6d3819, 0x5e3217, 0x532e15, 0x4c2913, 0x422411, 0x3b210f, 0x391e10, 0x331c0f, 0x2e1a0c, 0x2a180a, 0x27150a, 0x25140a, 0x221209, 0x1e1106, 0x1c0f06, 0x1a0d05, 0x180d04, 0x150b04, 0x130b04, 0x120b03, 0x120b03, 0x100a04, 0x0c0904, 0x0c0703, 0x0b0602, 0x0b0702, 0x0a0702, 0x090601, 0x090501, 0x080401, 
-  0x070601, 0x090702, 0x0a0702, 0x0a0602, 0x0b0603, 0x0c0704, 0x0d0804, 0x0f0903, 0x120a04, 0x120b05, 0x130c06, 0x140a07, 0x150b07, 0x160d05, 0x190e06, 0x1d0900, 0x523322, 0x503221, 0x210d02, 0x21130c, 0x27160e, 0x2a190b, 0x301d0e, 0x321e0f, 0x361f0f, 0x3a2212, 0x412612, 0x432814, 0x482b17, 0x502f19, 0x59341c, 0x693b1f, 0x794322, 0x894d28, 0x9d592b, 0xb36c33, 0xb97539, 0xa2632c, 0xb28248, 0xfde999, 0xdfb86b, 0x8e5623, 0x9b6429, 0xd8a252, 0x825d2e, 0x452f1e, 0x5d3d1f, 0x7c5328, 0x623f1a, 0x9c703e, 0xc49356, 0x684322, 0x4f3417, 0x8b612f, 0x906031, 0x8d602b, 0x673f0b, 0x684418, 0x7e5727, 0x6b4423, 0x5e3e23, 0x7d5a2f, 0xb48743, 0xc8a062, 0x957445, 0x5b3b17, 0x654524, 0xa27b44, 0x9d7134, 0x895d28, 0x92652c, 0x95672f, 0x93632c, 0x99672f, 0x936633, 0x744f27, 0x5c4021, 0x412d16, 0x2d1502, 0x5b3b1c, 0x81582c, 0x966736, 0x996a36, 0x9d6c30, 0x9c681c, 0xbe9752, 0xe6cb90, 0xd4c392, 0x8a724d, 0x674108, 0x855e33, 0x916333, 0x875e2f, 0x906733, 0xa4733a, 0x9a6a35, 0x8c6336, 0x5d3f20, 0x321a07, 0x5b391c, 0xa3743e, 0xd4a152, 0xb58235, 0xdab269, 0xf1e5b7, 0xa38055, 0x653e17, 0x5c3709, 0xc9a460, 0xdeb160, 0xbe9a57, 0x491b16, 0xbf9450, 0xe2b55e, 0xddb252, 0xefdca6, 0xddd1af, 0x764c16, 0x563517, 0x88673e, 0xd6af66, 0xeac97d, 0xa28556, 0x7b5227, 0x926636, 0xb28440, 0xc09148, 0xab7c40, 0x77572e, 0x3b1903, 0xb9924b, 0xdcb15f, 0xac925d, 0x230000, 0x895c30, 0xd6af61, 0xe3be60, 0xeed38a, 0xf9f2c7, 0xb59063, 0xb17c3b, 0xc59049, 0xd2a34d, 0xc2914b, 0xa47643, 0x6a4219, 0xc4ad6b, 0xe0bc6e, 0xf0c96d, 0xebc261, 0xf6e396, 0xc2af7e, 0x996732, 0xad7d42, 0xd9a95a, 0xf1c96c, 0xf7d57a, 0xf8d57a, 0xf5cf72, 0xf2ca6c, 0xf1c667, 0xf2c667, 0xe1ad58, 0xd29d4e, 0xdaa65d, 0xd29d55, 0xd9a357, 0xe4b05d, 0xe8bc61, 0xfbd87f, 0xfadf85, 0xfae083, 0xf7d67c, 0xf5cc75, 0xedc36b, 0xf9cd72, 0xe4b159, 0xd19d4d, 0x8a5925, 0x885315, 0xf1d790, 0xf2e098, 0x986527, 0x815826, 0xebcc80, 0xfde697, 0xfde898, 0xfde48a, 0xfbe18a, 0xfee699, 0xab8646, 0xb3904e, 0xfcdd89, 0xcb994f, 0xbb8144, 0x8e5f2f, 0x603311, 0x753c11, 0xad7635, 0xe7b360, 0xe6c279, 0xffeca2, 0xe2b061, 0xd38d40, 0xc8803c, 0xbb7132, 0xac652c, 0x9a5728, 0x8b4e27, 0x7b4221, 0x703d1b, 0x6d3c1d, 0x6a391d, 0x5f3219, 0x542e17, 0x4c2a14, 0x462511, 0x3d2110, 0x361f0f, 0x341c0e, 0x2f190c, 0x2a170a, 0x271509, 0x251409, 0x221209, 0x1f1108, 0x1b1005, 0x180e04, 0x160d04, 0x150c03, 0x140a03, 0x120a03, 0x120b03, 0x110a02, 0x0f0904, 0x0c0904, 0x0c0703, 0x0b0702, 0x0a0702, 0x090702, 0x090601, 0x090601, 0x090502, 
-  0x080702, 0x0a0702, 0x0b0803, 0x0b0703, 0x0c0704, 0x0c0805, 0x0d0905, 0x0f0a03, 0x110904, 0x120b05, 0x130c06, 0x140b06, 0x150b04, 0x170c03, 0x170d07, 0x180c07, 0x321d10, 0x341f11, 0x1d1308, 0x20150d, 0x261609, 0x2c1b0a, 0x2e1d0d, 0x301d0e, 0x331e0f, 0x372111, 0x3b2412, 0x3f2615, 0x452a17, 0x4d2d18, 0x56321b, 0x64391e, 0x784626, 0x854c29, 0x97562a, 0xad6934, 0xa0602f, 0x824815, 0x9a723b, 0xf7da85, 0xcca055, 0x9c662f, 0xb8823d, 0xe2af5e, 0x705028, 0x402c18, 0x593d20, 0x6f4824, 0x5d391c, 0x583410, 0xb1894e, 0xaf8a56, 0x3d0f00, 0x744e29, 0x916025, 0xcca75f, 0x987e4e, 0x472411, 0x714c2c, 0x6c4a29, 0x5b411d, 0x987144, 0xad7c40, 0xcda86d, 0x765831, 0x5a3d20, 0x5f3d1b, 0x956c38, 0x9d733e, 0x92632f, 0x9c6b31, 0x95672f, 0x94642e, 0x94632c, 0x936531, 0x81582e, 0x604121, 0x523a1e, 0x332210, 0x2b1503, 0x42280b, 0x73522a, 0x996b37, 0xa9753a, 0xad7a3a, 0xad7933, 0xb48539, 0xdbbd81, 0xf1e2ae, 0xbcad84, 0x8c6638, 0xa27240, 0x976635, 0x8e612f, 0x9f6e37, 0xa06e34, 0x996d39, 0x6a4824, 0x452c16, 0x3f260e, 0x876035, 0xbf8c44, 0xb78436, 0xca9944, 0xf5e5b3, 0xc5af8a, 0x562800, 0x7d5930, 0xd6ac62, 0xe8be6c, 0x8a7142, 0x2d0409, 0x9b733f, 0xdbb159, 0xe5b65e, 0xe6c578, 0xf5ebbf, 0x8d7151, 0x360000, 0xa88a54, 0xd5ac5d, 0xe8c780, 0x836035, 0x7e5427, 0x9a6e3b, 0xb58845, 0xad8140, 0xa27642, 0x684c26, 0x77572e, 0xca9d51, 0xd9b46c, 0x735e41, 0x1e0000, 0x724622, 0xc49c56, 0xeac666, 0xeec66c, 0xf9f0b4, 0xd5c098, 0xaa7433, 0xbf8644, 0xcf9d4a, 0xbe8d4c, 0x95693c, 0x6c451b, 0xcfb873, 0xd9b360, 0xebc366, 0xe7be5d, 0xf9e79b, 0xb5a070, 0x9e6a34, 0xa9773e, 0xe0b161, 0xefc969, 0xfad97c, 0xf6d277, 0xf1c96c, 0xf0c66a, 0xf7cb70, 0xefc167, 0xd6a455, 0xcb9851, 0xd2a058, 0xcc994e, 0xc99449, 0xd19d4d, 0xdaa954, 0xecc26e, 0xf8d67d, 0xfbdc80, 0xf8d478, 0xf1c56c, 0xf2c46b, 0xeec068, 0xeab761, 0xd8a354, 0xa7763a, 0x6d3200, 0xd0ad62, 0xfdea9c, 0xca9955, 0x915f29, 0x896432, 0xac8e53, 0xa98548, 0xe1bb62, 0xfee78e, 0xf4db8e, 0x946427, 0xbd964d, 0xf7ce76, 0xcb944b, 0xbe8447, 0xa16f3c, 0x73421d, 0x783a0e, 0xa9702d, 0xeec06b, 0xe4bf6c, 0xfce89b, 0xe4b56d, 0xcc8337, 0xc17738, 0xb26830, 0xa55f2d, 0x905127, 0x7d4521, 0x723d1e, 0x653718, 0x5d351a, 0x5a321a, 0x542f1a, 0x4e2c18, 0x462612, 0x41200c, 0x3a1f0e, 0x321e0f, 0x2e1a0d, 0x2a1709, 0x271609, 0x251409, 0x231309, 0x211208, 0x1d1007, 0x190f05, 0x180e05, 0x150c03, 0x140b04, 0x140a04, 0x130b03, 0x120b03, 0x110a03, 0x100904, 0x0d0804, 0x0c0703, 0x0b0702, 0x090803, 0x090702, 0x090601, 0x090601, 0x090501, 
-  0x080702, 0x0b0803, 0x0b0803, 0x0a0803, 0x0b0804, 0x0c0805, 0x0d0a05, 0x0e0a04, 0x110a04, 0x120b05, 0x140c05, 0x140b04, 0x140c05, 0x170d03, 0x190d03, 0x170e08, 0x180d08, 0x1a0e07, 0x1d1309, 0x231409, 0x27160a, 0x2a1a0c, 0x2d1b0c, 0x2f1c0d, 0x331d0f, 0x361f11, 0x3a2312, 0x3d2613, 0x432814, 0x4d2d17, 0x56331a, 0x633a1e, 0x734221, 0x834a27, 0x97562b, 0xac6634, 0x975d2e, 0x814405, 0xd6c188, 0xf6d584, 0xba8640, 0x935d27, 0xc7904a, 0xd8a85b, 0x5e3f1f, 0x412a14, 0x5a3f23, 0x67431e, 0x694523, 0x45230d, 0x7b592a, 0xd7b577, 0x684b2a, 0x532f0f, 0x8a5a24, 0xd4b16d, 0xc2a670, 0x6e4616, 0x7c5528, 0x634221, 0x3f250d, 0x9a7340, 0xaa7a40, 0xb18d57, 0x513412, 0x4d321a, 0x6d4a2a, 0x895e2f, 0x8b6433, 0x946531, 0x9c6a2d, 0x94662e, 0x8e5f2a, 0x92622b, 0x956731, 0x865b2e, 0x6d4925, 0x694526, 0x51391e, 0x261603, 0x2a180e, 0x361f0c, 0x63421e, 0x976c39, 0xb4843f, 0xbc8c43, 0xbb863f, 0xbc8639, 0xd1ac6b, 0xf4e5ae, 0xe1d5a7, 0x97774d, 0x986731, 0x986a37, 0x9e6f39, 0xa9793f, 0x976a33, 0x7d5830, 0x51351b, 0x2e1807, 0x68492a, 0xaf7e3d, 0xc79243, 0xc7933d, 0xe6cc92, 0xe1d6b3, 0x501e00, 0xa47b4b, 0xd8ac5d, 0xd2aa61, 0x3a2818, 0x220b01, 0x81552e, 0xd0a353, 0xdcb158, 0xdcad52, 0xf5e1a8, 0xb9a987, 0x2a0000, 0xba9957, 0xe1ba69, 0xd3b577, 0x7a4d1e, 0x936830, 0xa5783d, 0xa97b3b, 0x996f38, 0x77552f, 0x462200, 0xad874f, 0xd2a658, 0xd0b173, 0x422a1a, 0x31200e, 0x663d1b, 0xab8043, 0xe6bf66, 0xe7bc58, 0xf0d68d, 0xf1e6b8, 0xab824a, 0xaf793b, 0xbb8947, 0xa67841, 0x876036, 0x6a4418, 0xd2b270, 0xddb45e, 0xedc567, 0xeac261, 0xf6e69d, 0xac9767, 0xa66f37, 0xb17c41, 0xcf9c4e, 0xe9bd60, 0xf1ca6b, 0xf1c669, 0xecbf62, 0xe5b75f, 0xe1b25f, 0xd9a959, 0xd6a55a, 0xce9d59, 0xcb9b53, 0xd09e53, 0xcd9951, 0xca984a, 0xd4a153, 0xd7a75a, 0xe8bb67, 0xf7d075, 0xfbd87a, 0xf4cf71, 0xf4cc70, 0xecc068, 0xe5b45e, 0xdda456, 0xba8645, 0x69360f, 0xa98141, 0xfcea99, 0xdcb567, 0xcc924d, 0xb07a3f, 0x7d4c1d, 0x7c4602, 0xdcae57, 0xffe38d, 0xddba70, 0x844c0a, 0xd5ab5e, 0xe5b763, 0xb17a38, 0xc18747, 0xb57f45, 0x915a28, 0xa66228, 0xbd7730, 0xf0c671, 0xf2d075, 0xfae397, 0xeccc83, 0xbe772a, 0xb56c31, 0xa8602c, 0x9c5b2b, 0x8a4e25, 0x7a411f, 0x744021, 0x6f4427, 0x522c13, 0x4f2c17, 0x4d2c17, 0x4b2b17, 0x46240e, 0x5e3b27, 0x422310, 0x2f1b0b, 0x2c190c, 0x28160a, 0x26150a, 0x241309, 0x211308, 0x1e1106, 0x1b0f06, 0x190f05, 0x180e04, 0x160c04, 0x150b05, 0x140a04, 0x130b03, 0x120b03, 0x110a03, 0x100904, 0x0d0804, 0x0c0703, 0x0b0703, 0x090803, 0x090802, 0x0a0702, 0x090601, 0x090501, 
-  0x080702, 0x090702, 0x0a0803, 0x0b0803, 0x0c0804, 0x0d0a05, 0x0e0a05, 0x0f0a04, 0x110a04, 0x120b04, 0x130b04, 0x140b04, 0x140c05, 0x160d03, 0x190d02, 0x190e04, 0x1b1007, 0x1d1208, 0x201309, 0x231309, 0x26160c, 0x29190d, 0x2c1a0c, 0x2f1c0d, 0x321d0d, 0x382010, 0x3a1e10, 0x3e2412, 0x422812, 0x513018, 0x5a351c, 0x623a1c, 0x6f401d, 0x7e4825, 0x905129, 0xa26031, 0x874c1f, 0x996c3a, 0xf7e7a4, 0xe5be71, 0xa26c30, 0x885523, 0xd29c54, 0xc1944f, 0x5e3e23, 0x452c19, 0x52391b, 0x63401c, 0x805834, 0x64411c, 0x61390d, 0xba955d, 0xa88958, 0x300000, 0x7d4f23, 0xb7884d, 0xdec385, 0x6f4a1a, 0x744a26, 0x5c3d1d, 0x472f17, 0xac8245, 0xb48345, 0x8d693c, 0x483016, 0x422918, 0x604224, 0x90622f, 0x885c25, 0x906331, 0xa8743a, 0x9d6d32, 0x986832, 0x996936, 0x906330, 0x7c5125, 0x6d4926, 0x664523, 0x5b3e20, 0x412b15, 0x27170a, 0x211305, 0x2a1907, 0x523519, 0x986f3e, 0xba8a47, 0xbb8a3f, 0xc08f45, 0xba893e, 0xc0934b, 0xe7d29a, 0xf1e8be, 0xa68f68, 0x8b5a1f, 0x8b602f, 0x9f723d, 0x996832, 0x845c2f, 0x5a3e22, 0x392413, 0x482e16, 0x996a38, 0xc99547, 0xc99845, 0xd4ad67, 0xf2e7c1, 0x795d48, 0xb5884a, 0xdbad5b, 0xae8c52, 0x331a12, 0x251408, 0x663d1e, 0xb28645, 0xdfb25a, 0xd9a84b, 0xeac77c, 0xe2d3a4, 0x57371a, 0xc99f54, 0xedc978, 0xab8e5b, 0x86592c, 0x9e7134, 0xab7d3c, 0xaa7b40, 0x956c3b, 0x64482a, 0x5b3b1a, 0xc69f59, 0xddb766, 0xad9260, 0x5d3e25, 0x4a341f, 0x472609, 0x885d2d, 0xd5ad5b, 0xecc15c, 0xe7c46b, 0xfcf3c0, 0xc1a87c, 0xa57130, 0xad7c44, 0x976b39, 0x845e32, 0x633c14, 0xc8a361, 0xddb45d, 0xeac162, 0xe8bc5c, 0xf4e7a1, 0xb49f6f, 0xa36c33, 0xc9944e, 0xdba955, 0xf1c568, 0xf7cf70, 0xf5cb6c, 0xe9ba62, 0xce9e55, 0xae823f, 0xddb465, 0xe8ca77, 0xe4cb7f, 0xd7c27d, 0xd6be76, 0xdec784, 0xe6ce8a, 0xebcd88, 0xd4a961, 0xe3b460, 0xf2ca6f, 0xfad679, 0xf5d173, 0xf3cb6f, 0xe5b761, 0xe2af5a, 0xcc974a, 0xb27b3e, 0x73431d, 0x7e551b, 0xf3df90, 0xe2c57e, 0xd39a4a, 0xd29b52, 0xa87338, 0xad7e37, 0xf3cf70, 0xfcde89, 0xb58949, 0x996d31, 0xe9bd6b, 0xb7873d, 0xb47d3a, 0xc48b47, 0xb98247, 0xac6d31, 0xce833e, 0xc67932, 0xd2a555, 0xfada7f, 0xfae18f, 0xf2d487, 0xb46f2a, 0xaf6630, 0xa15d2d, 0x9a5d30, 0x804823, 0x723e1e, 0x6a3a1c, 0x613b21, 0x4d2b14, 0x482814, 0x462715, 0x44250c, 0x44220e, 0x5f3c24, 0x4b2b17, 0x2f1908, 0x29180a, 0x27160a, 0x251509, 0x231409, 0x201308, 0x1d1007, 0x1c0e06, 0x1a0e05, 0x170e05, 0x150c04, 0x150b05, 0x140a04, 0x130b04, 0x120b04, 0x120a04, 0x110904, 0x0e0804, 0x0d0704, 0x0c0703, 0x0a0702, 0x0a0703, 0x0a0601, 0x090600, 0x070601, 
-  0x070601, 0x080702, 0x080702, 0x0b0803, 0x0c0803, 0x0b0903, 0x0d0903, 0x100a04, 0x120b05, 0x120b04, 0x140b04, 0x140b04, 0x150c04, 0x170d04, 0x180e05, 0x190f06, 0x1b1107, 0x1c1208, 0x1f130a, 0x22150a, 0x26160c, 0x29170c, 0x2b190c, 0x2c1a0d, 0x2e1b0b, 0x392313, 0x493120, 0x3e230f, 0x462914, 0x4b2b17, 0x57321d, 0x613a1d, 0x6b401d, 0x7a4624, 0x884c24, 0x9d5d32, 0x875029, 0x82501f, 0xe0c986, 0xdbae62, 0x905b23, 0x895823, 0xe1ae61, 0xb48b49, 0x56381d, 0x422d1b, 0x49341c, 0x523419, 0x6c4420, 0x7b5328, 0x795226, 0x885b2a, 0x815e33, 0x3a1f0d, 0x52300f, 0x915f20, 0xe4c57e, 0xab935e, 0x5f340b, 0x523719, 0x5e4428, 0xa97b44, 0xb38749, 0x84633b, 0x462b12, 0x654422, 0x926735, 0xbe9457, 0xb7965b, 0x966a31, 0x996a30, 0x9c6c30, 0x875722, 0x875827, 0x8c5f30, 0x7b5228, 0x65451e, 0x5d3e1f, 0x644224, 0x5c4020, 0x46341d, 0x31220f, 0x211005, 0x271003, 0x3c1f0a, 0x835f35, 0xb0834b, 0xbc8944, 0xc18f45, 0xbf8e43, 0xb5853b, 0xdcc795, 0xf7ecbf, 0xa78a5c, 0x80501a, 0x936635, 0x976732, 0x8b6133, 0x5d4020, 0x432f1b, 0x361f0b, 0x845630, 0xb98741, 0xc89846, 0xc79747, 0xf1e0ab, 0xb7a27b, 0xbc8a40, 0xddb061, 0x755831, 0x543924, 0x342211, 0x3b1d06, 0x886031, 0xd5a656, 0xd9aa4e, 0xdfb760, 0xf3e0a5, 0xa58d64, 0xcba04f, 0xe7c77a, 0x7c5d36, 0x805728, 0xa47539, 0xac7d3b, 0xa2753b, 0x8c6839, 0x4a2e15, 0x8f6f3f, 0xcfa356, 0xe2be71, 0x81633e, 0x745536, 0x5a412a, 0x290d04, 0x664022, 0xb58e4b, 0xedc05f, 0xe6bc57, 0xf6e6a8, 0xe4d8b4, 0xa67434, 0xb17e44, 0x986b3b, 0x89643a, 0x562f0c, 0xad8141, 0xdab35d, 0xe1b758, 0xe1b354, 0xf5e7a1, 0xc0aa7b, 0xa87034, 0xc99548, 0xe6b75d, 0xeec566, 0xf4ce6f, 0xf3ca6b, 0xe4b45f, 0xb38348, 0x643d19, 0x95733e, 0xbf9d59, 0xeccd7c, 0xfee992, 0xfce990, 0xfff2a4, 0xebd895, 0xa28a55, 0xb48747, 0xdeaf5d, 0xf2ca6c, 0xf8d373, 0xf2ca6c, 0xefc269, 0xe0b160, 0xd7a357, 0xc68a47, 0xb27a40, 0x7d4e26, 0x683800, 0xe5cd86, 0xedd795, 0xc38b3a, 0xc8914e, 0x9e652e, 0xd3a558, 0xffe487, 0xdfc074, 0x915416, 0xc9a459, 0xf2d682, 0xb88943, 0xd59a4b, 0xc88f46, 0xb0743a, 0xad6d34, 0xa45e21, 0xa75f21, 0xbb853c, 0xf7cf75, 0xf5d67b, 0xf4d27f, 0xb27232, 0xa65f2d, 0x955528, 0x854b23, 0x77411e, 0x6c3916, 0x633515, 0x532f17, 0x4a2a15, 0x422612, 0x402316, 0x3d2114, 0x3c2111, 0x3e230e, 0x391e0d, 0x2e190a, 0x29180b, 0x28170a, 0x251408, 0x221308, 0x201208, 0x1d1007, 0x1c0e06, 0x190f05, 0x170e04, 0x150c04, 0x140b04, 0x150a04, 0x130a03, 0x130c05, 0x110a04, 0x110904, 0x0f0604, 0x0e0603, 0x0d0603, 0x0d0603, 0x0b0603, 0x0a0602, 0x090700, 0x070600, 
-  0x080601, 0x080601, 0x090702, 0x0a0803, 0x0b0803, 0x0d0802, 0x0f0903, 0x120b05, 0x120b05, 0x130b04, 0x150c05, 0x140b04, 0x150b03, 0x160c03, 0x190f06, 0x1a1006, 0x1b1107, 0x1d1209, 0x1e1006, 0x1f0c01, 0x25160c, 0x26160b, 0x28170a, 0x29190c, 0x2d1b0d, 0x331f11, 0x452f1e, 0x472c1a, 0x513220, 0x51311b, 0x552f16, 0x5f3519, 0x6a3d20, 0x764321, 0x975d35, 0x8f542a, 0x714320, 0x7e5021, 0xe7ca82, 0xd0a055, 0x925b27, 0xa8763a, 0xf2c16e, 0xad8445, 0x5a3d21, 0x442e18, 0x4b331c, 0x56341b, 0x90693c, 0x6c4421, 0x6e4820, 0x623c1e, 0x442511, 0x3b1f0a, 0x704f2a, 0x8d5721, 0xbd8b4f, 0xeed290, 0x876d45, 0x371600, 0x6b4e28, 0x9b6c34, 0xbb975b, 0x735638, 0x63472d, 0xb38851, 0xc18942, 0xd4a560, 0xe7cf8d, 0xa68349, 0x9d6a2c, 0x9a6a31, 0x8f6230, 0x885c2c, 0x865c2e, 0x7b542d, 0x5d3a17, 0x8e6e42, 0xb09063, 0x64462a, 0x583f1e, 0x553d21, 0x45301c, 0x301e0f, 0x261306, 0x311605, 0x654426, 0x9c6f3c, 0xb88743, 0xb98842, 0xac7a36, 0xac7626, 0xdfcc97, 0xeaddac, 0x9b7038, 0x976931, 0x9b6e34, 0x976c38, 0x76522a, 0x513a23, 0x230e00, 0x6f4927, 0xa7783e, 0xc99648, 0xc18e3d, 0xd8b76f, 0xe6ce8e, 0xcf9c4b, 0xd0a861, 0x53331d, 0x62482a, 0x3f2d12, 0x1c0901, 0x5a391a, 0xb68845, 0xdbaa54, 0xdcb35d, 0xeacb84, 0xe6c47f, 0xd4ab5b, 0xccae6e, 0x6c4622, 0x865d2c, 0xaf8142, 0xb48643, 0x9b7037, 0x79562d, 0x411e06, 0xbd9a59, 0xd0a956, 0xd8b677, 0x61381a, 0x664524, 0x50321b, 0x000000, 0x210000, 0x7e5a2c, 0xe5bc63, 0xe7bb55, 0xeacb7c, 0xfaf4d2, 0xb8976c, 0xae7739, 0x94683a, 0x835f38, 0x4f2b0f, 0x9a6b36, 0xd1a757, 0xe4b95b, 0xdcaf4f, 0xf7e39b, 0xcbb787, 0xab7230, 0xcb974a, 0xe3b45b, 0xecc164, 0xf1c96c, 0xeec667, 0xdbab56, 0xbe8d4f, 0x754b29, 0x3a0000, 0x855323, 0xca9b49, 0xf7d66e, 0xf7da74, 0xfce994, 0xbda76c, 0x7e4e17, 0xb98547, 0xdaaa59, 0xf1c96c, 0xf4cc6c, 0xebbe66, 0xdcad60, 0xaf7f38, 0xcc9c4b, 0xe3be71, 0xc39a5b, 0x966632, 0x662f00, 0xd7bc77, 0xf5e39e, 0xc18e45, 0xb77b41, 0xa57133, 0xf1cd72, 0xffe385, 0xb49049, 0x743d00, 0xb0803f, 0xf3d484, 0xf8de8a, 0xddac59, 0xd69d4f, 0xc18445, 0xa96f3a, 0x834b1c, 0x925320, 0xb0732f, 0xebbb61, 0xedca6e, 0xfce193, 0xbc884b, 0x9e5a27, 0x905228, 0x7f4923, 0x713c16, 0x996846, 0x7a4e31, 0x4f2a12, 0x492914, 0x442512, 0x3f220e, 0x3e240d, 0x361f11, 0x311c0f, 0x2f1a0c, 0x2b190b, 0x29180c, 0x271609, 0x261508, 0x211307, 0x1f1106, 0x1c0f06, 0x1c0e06, 0x190e05, 0x170e05, 0x160d05, 0x140b04, 0x140903, 0x130a03, 0x130c05, 0x110a04, 0x110904, 0x110705, 0x0f0604, 0x0e0502, 0x0e0603, 0x0b0603, 0x090601, 0x090700, 0x060600, 
-  0x0a0702, 0x0a0702, 0x0a0702, 0x0a0902, 0x0c0802, 0x0f0903, 0x120a04, 0x120b04, 0x130a05, 0x140b04, 0x150c05, 0x150b05, 0x160c04, 0x170d04, 0x190f06, 0x1a1006, 0x1c1208, 0x1d1007, 0x312016, 0x443227, 0x241105, 0x2e1e14, 0x301f14, 0x2a180c, 0x2e1c0f, 0x311c0e, 0x341a0c, 0x3e2313, 0x452711, 0x5e3a20, 0x78502e, 0x724827, 0x6d3f22, 0x7c4925, 0x995e33, 0x844e23, 0x683306, 0xc7a96e, 0xffe998, 0xc19048, 0x895223, 0xac7938, 0xecbe6a, 0x966e39, 0x583a1c, 0x472e17, 0x5b3c1d, 0x72461f, 0x986a36, 0x76512e, 0x5a3b1f, 0x492b15, 0x533315, 0xa0773e, 0xb78446, 0xb48042, 0xb07b44, 0x9e7e49, 0x745935, 0x3b210c, 0x75552d, 0xa17438, 0xc2a165, 0x4f351b, 0x4e361e, 0x856034, 0x95662f, 0x81541e, 0xc2a369, 0xcfb478, 0x8f591d, 0x986730, 0x875a28, 0x885e2f, 0x775127, 0x5e391b, 0x765427, 0xdbb873, 0xa0855b, 0x543413, 0x603f20, 0x694928, 0x593d1f, 0x4b351a, 0x382810, 0x251405, 0x2d1404, 0x523218, 0x8f6537, 0xb48243, 0xab7a3b, 0xb48038, 0xb98e43, 0xf3e3ac, 0xbca273, 0x966726, 0xa17438, 0x966b32, 0x926836, 0x624626, 0x271503, 0x573a1e, 0x926538, 0xc59148, 0xc89543, 0xca9847, 0xd3ae63, 0xdaac5d, 0xa5814b, 0x5d3921, 0x664829, 0x4a341a, 0x190d05, 0x40240f, 0x9f743f, 0xdbab5a, 0xd7aa57, 0xd5ad5a, 0xdfb463, 0xd7af64, 0x9f8351, 0x744b24, 0x916632, 0xac7e3f, 0xaa7f40, 0x916738, 0x6b4423, 0x7a5a31, 0xd2aa5d, 0xe1bf6d, 0xf1db9b, 0xc0af81, 0xc2b284, 0xbfb184, 0xbcad82, 0xbaa67d, 0xb69862, 0xe6c36b, 0xe9c361, 0xdfb759, 0xf7ebbb, 0xd7cba6, 0x9e6a2b, 0x936636, 0x8b633a, 0x482c12, 0x71421d, 0xc39a55, 0xe9be60, 0xdfb34f, 0xf3d98f, 0xdaca9a, 0xad7734, 0xc6934b, 0xd7a753, 0xebbe64, 0xf4ca6e, 0xf4cb6e, 0xe7b661, 0xc08f4a, 0x93693b, 0x50290e, 0x8b6331, 0xd2a551, 0xf6d26e, 0xfad878, 0xfdea97, 0xc4ab71, 0xac7943, 0xc39051, 0xd9a958, 0xecc167, 0xecbf66, 0xd7a55b, 0xa7773b, 0xcfaa61, 0xe1b660, 0xe8c977, 0xf7e091, 0xb28346, 0x7c410f, 0xc09c55, 0xf8e49b, 0xc59552, 0x8a5321, 0x8b612b, 0xd9b358, 0xf3d37b, 0xf3d788, 0xab894b, 0x520800, 0xa47837, 0xf6da84, 0xfae394, 0xe1b468, 0xc08541, 0x9f6936, 0x714119, 0x7f4714, 0xa66828, 0xe4b760, 0xf1cd73, 0xfee69f, 0xd0a464, 0x9e5c27, 0x92532b, 0x7e4a24, 0x703f1d, 0x7e4f2f, 0x673c20, 0x4f2c16, 0x53331e, 0x573623, 0x5d432b, 0x866e4c, 0x2c0d01, 0x2f1c0f, 0x2c1a0d, 0x2b190b, 0x29170a, 0x28160a, 0x251508, 0x211307, 0x1f1207, 0x1d1007, 0x1c0f06, 0x190f05, 0x180e05, 0x160d05, 0x150b05, 0x140a03, 0x140b04, 0x130c05, 0x110a05, 0x120904, 0x110705, 0x0f0503, 0x0e0503, 0x0e0603, 0x0a0603, 0x090601, 0x090700, 0x070600, 
-  0x0a0702, 0x0a0702, 0x0b0803, 0x0b0902, 0x0d0902, 0x110a04, 0x120903, 0x120a03, 0x130b05, 0x140b05, 0x150c05, 0x150a04, 0x160c04, 0x180d05, 0x190f06, 0x190f06, 0x1b1107, 0x1d0e05, 0x39271c, 0x554135, 0x230e00, 0x36261c, 0x39271c, 0x2b180a, 0x301c0e, 0x331c0d, 0x513929, 0x3b230e, 0x4a2f19, 0x734e37, 0x926743, 0x8b613b, 0x6a3a1b, 0x824e27, 0x985c2e, 0x8c5428, 0x824018, 0xd3b675, 0xfae694, 0xb17e3d, 0x814a1f, 0xb48340, 0xecc06d, 0x825a2e, 0x51361c, 0x482f1e, 0x664622, 0x8e6031, 0x8e5e2c, 0x67431e, 0x482a16, 0x614223, 0xa67946, 0xb17b3b, 0xb37739, 0x885e2a, 0x654320, 0x583418, 0x6d4c2b, 0x402912, 0x785430, 0xb48b4b, 0xcaad6d, 0x492c0c, 0x331e0d, 0x2c1202, 0x3e240f, 0x2e0000, 0xb2945f, 0xd6bf88, 0x7d521a, 0x9a6730, 0x885b28, 0x865d2d, 0x6b4821, 0x421800, 0xc3a260, 0xdab871, 0x5c3f28, 0x684b23, 0x6e4826, 0x734e26, 0x6c4821, 0x593c1d, 0x513a1f, 0x3d2b15, 0x261709, 0x291507, 0x53321a, 0x926837, 0xb18140, 0xaf7e3c, 0xb07c2b, 0xdec288, 0xdfcb9d, 0x8d6027, 0x93622f, 0x946633, 0x9c6f3a, 0x77542c, 0x3b2712, 0x381e06, 0x855a34, 0xb78441, 0xc89744, 0xc58e43, 0xc89444, 0xdcb167, 0x785630, 0x6c4725, 0x654423, 0x50361e, 0x312312, 0x270b00, 0x7e572e, 0xce9f54, 0xd4a451, 0xd6a852, 0xd4a554, 0xe0bb74, 0x785a32, 0x855b2d, 0x9e7139, 0xaa7d3f, 0x9c723a, 0x78512a, 0x4f2909, 0xb28f57, 0xcea150, 0xc8a057, 0xbb9f65, 0xc7ac76, 0xccae76, 0xcbaf74, 0xcaac70, 0xcdb072, 0xcfab64, 0xe6c26a, 0xe9c465, 0xe4ba5b, 0xeace87, 0xf6f0cd, 0xaa8559, 0x966633, 0x906537, 0x533b22, 0x481e08, 0x9a743e, 0xe1b45a, 0xe6ba53, 0xefd182, 0xece0ad, 0xb7884a, 0xbc8847, 0xd4a153, 0xe4b45d, 0xf1c66b, 0xf3ca6c, 0xeab960, 0xcb994e, 0x9a6f3c, 0x5a3219, 0x986e35, 0xd7a752, 0xf1cb70, 0xf7d77b, 0xfbec9b, 0xceb881, 0xa36e33, 0xc2904c, 0xe5b765, 0xe9bd64, 0xe6b862, 0xb98745, 0xab8246, 0xfad580, 0xa78145, 0xa88347, 0xdeb973, 0xb07f47, 0x845219, 0xbd9145, 0xfae195, 0xca9c5b, 0x8f5e29, 0x5b300f, 0x704007, 0xc39c4f, 0xfae08e, 0xfde69a, 0xaf9258, 0x4c0000, 0xb79255, 0xffe799, 0xedc97b, 0xba823c, 0xa06b39, 0x794a23, 0x7b4413, 0xa05d22, 0xd8ac57, 0xf4cf70, 0xfce394, 0xdcb36e, 0xa05e27, 0x91522a, 0x7e4924, 0x704122, 0x6a3c20, 0x5a3117, 0x4e2c17, 0x4f2e18, 0x4d2f1a, 0x442614, 0x472e1c, 0x321b0d, 0x311f10, 0x2d1a0c, 0x2b180a, 0x2a180a, 0x28160b, 0x241408, 0x201207, 0x1f1207, 0x1d0f07, 0x1d0f06, 0x1a0f05, 0x170e04, 0x150c04, 0x150b04, 0x130903, 0x130a03, 0x130c05, 0x110a04, 0x110804, 0x100704, 0x0e0603, 0x0d0603, 0x0d0603, 0x0a0703, 0x080702, 0x080600, 0x080500, 
-  0x0a0602, 0x0b0602, 0x0c0703, 0x0d0803, 0x0e0903, 0x100a04, 0x110a04, 0x120b03, 0x130c06, 0x150c06, 0x150c04, 0x160c03, 0x170c03, 0x1a0d07, 0x1a0e06, 0x180a00, 0x201109, 0x23130a, 0x251307, 0x240f00, 0x2a180b, 0x29160a, 0x2b180b, 0x2f1b0c, 0x351f0e, 0x462e1e, 0x3c2312, 0x412715, 0x422511, 0x44230d, 0x4e290f, 0x62391c, 0x704123, 0x7e4823, 0x985f30, 0x945c32, 0x7f411b, 0xa27c47, 0xf1cc82, 0xa36d2e, 0x7e481d, 0xc99b53, 0xe7be6e, 0x6b4620, 0x4b3219, 0x432b19, 0x4f3115, 0x744722, 0x66441f, 0x5a3b1d, 0x694a23, 0xb68955, 0x976635, 0x956634, 0x886234, 0x755b33, 0x553721, 0x6a4826, 0x7d5b34, 0x473318, 0x674326, 0xaf894c, 0xddc07e, 0x6a471e, 0x583a21, 0x4a3319, 0x462f1a, 0x512603, 0xc4a366, 0xd1bb84, 0x7a4512, 0x8f602a, 0x8d5e2a, 0x875d2c, 0x664520, 0x624123, 0xe4c67c, 0xcaad66, 0x643d20, 0x6e5123, 0x80572e, 0x986b35, 0x9f7138, 0x79532b, 0x634323, 0x54381d, 0x3d2b14, 0x1f1307, 0x2c170b, 0x634426, 0xa5753e, 0xb4823f, 0xa77532, 0xcaa161, 0xecd9a6, 0x93703d, 0x8e612b, 0x916331, 0x936530, 0x875e31, 0x543c1b, 0x240b00, 0x6b4524, 0x9f7137, 0xc59348, 0xcb974d, 0xd4a553, 0xc9a15f, 0x623d21, 0x79532e, 0x73502b, 0x654627, 0x4d351d, 0x220f00, 0x5d391c, 0xb18347, 0xd7a957, 0xca9846, 0xdfb35f, 0xd4b575, 0x643c18, 0x885e2a, 0xa7773c, 0xa7783c, 0x896332, 0x634222, 0x5b3b1d, 0xcea665, 0xcb9e51, 0xad8b57, 0x120000, 0x3a0000, 0x461b00, 0x3f0f00, 0x492200, 0x452100, 0x5a3402, 0x996f3d, 0xeac06e, 0xebc669, 0xe7c464, 0xfdf2c7, 0xc7b698, 0x956123, 0x956a3a, 0x5d4126, 0x2a0b00, 0x77552b, 0xd0a054, 0xdcb04e, 0xe7c066, 0xfaf0bb, 0xbf9e6a, 0xba8241, 0xc8954e, 0xdba756, 0xe0ae57, 0xe4b65e, 0xe0ad58, 0xc8944e, 0x966a3a, 0x562d0e, 0x9e733b, 0xe0af5c, 0xf0ca6d, 0xf5d476, 0xfeefa4, 0xd6c38d, 0x946129, 0xc3904d, 0xd9a958, 0xe2b45d, 0xe5b563, 0xab7b3f, 0x95682b, 0xe3ba69, 0xb99d61, 0x360000, 0x8c5e2d, 0xb38148, 0x794819, 0xbe9245, 0xf9dc89, 0xc99653, 0xca934a, 0xc18f49, 0x916534, 0x502200, 0xa47d3d, 0xe9ca7a, 0xfdea9d, 0xc6a66c, 0x753f02, 0xd0ab60, 0xefc470, 0xb9843d, 0xa46c3e, 0x784921, 0x724216, 0xa56427, 0xd6a756, 0xfad878, 0xfce291, 0xe7c17b, 0xa35f27, 0x905329, 0x7e4725, 0x6f4021, 0x673b21, 0x573019, 0x4e2d18, 0x482914, 0x422511, 0x3d2210, 0x361d0e, 0x341d10, 0x362013, 0x2f1a0c, 0x2a180b, 0x2a180c, 0x28160b, 0x301c0f, 0x362112, 0x211106, 0x1e1009, 0x1e0e06, 0x1c0d06, 0x180d05, 0x160b05, 0x150a05, 0x140903, 0x130a03, 0x130b05, 0x120b05, 0x0f0903, 0x100804, 0x0e0704, 0x0d0703, 0x0c0703, 0x0b0703, 0x0a0702, 0x090601, 0x080500, 
-  0x0a0602, 0x0b0602, 0x0d0804, 0x0e0904, 0x0f0903, 0x110a04, 0x110a04, 0x120b03, 0x130c05, 0x140b04, 0x160c04, 0x170d03, 0x180d06, 0x1b0c06, 0x2a180c, 0x463526, 0x251409, 0x23140b, 0x26160b, 0x29180b, 0x2a170b, 0x2a170c, 0x2b190d, 0x301c0e, 0x351e0f, 0x392212, 0x452d1b, 0x432815, 0x492f1b, 0x4a2d19, 0x4e2d18, 0x613921, 0x704121, 0x844b25, 0x96582d, 0x77421f, 0x622b0c, 0xbfa264, 0xebc473, 0x9f6026, 0x875227, 0xc79a52, 0xd9b066, 0x5c3919, 0x4b321c, 0x563820, 0x6a451f, 0x6d4322, 0x563820, 0x634421, 0xbe9454, 0xb1813f, 0x8e6837, 0x3d2110, 0xa38650, 0xe3c887, 0x5c472b, 0x4e3417, 0x684926, 0x553d1d, 0x381d01, 0x815925, 0xe0be7d, 0x997b49, 0x441e00, 0x4a2f19, 0x472916, 0x8f6134, 0xca9b58, 0xab8751, 0x835227, 0x835a26, 0x805323, 0x7c532a, 0x583615, 0x7c5f38, 0xe8c77a, 0xab8a46, 0x613e24, 0x6d4b21, 0x845c2c, 0x9e6e35, 0xab783b, 0x9d7136, 0x81582b, 0x6c4a26, 0x50381c, 0x312213, 0x150401, 0x472f17, 0x7f542a, 0xae7e41, 0xac7a39, 0xbd8e47, 0xedd49a, 0x9e7e4c, 0x845721, 0x946733, 0x94652e, 0x8d6130, 0x6b4d28, 0x321d0c, 0x4c2e15, 0x8a6031, 0xc3924d, 0xc89448, 0xdaad5b, 0x9a7645, 0x673f1f, 0x80562b, 0x8a6132, 0x805a30, 0x654725, 0x362410, 0x371c08, 0x875f36, 0xcb9b52, 0xce9a43, 0xe3b86a, 0xaf905d, 0x6d461d, 0x906631, 0xb18245, 0x9d7038, 0x77552c, 0x4b2b11, 0x8e6f40, 0xcda355, 0xd4a967, 0x7f6344, 0x472b1b, 0x4f3523, 0x46301e, 0x422d1e, 0x39271a, 0x302216, 0x260f06, 0x704b2c, 0xd0a85c, 0xf0c666, 0xe3bd5d, 0xf0da9a, 0xece4c0, 0x9e703d, 0x906135, 0x6d4f2c, 0x2b1807, 0x54361b, 0x9e7640, 0xdfb25a, 0xe5b858, 0xf9e9ae, 0xdcd1a4, 0xb98b40, 0xbb8c49, 0xbd8c48, 0xd6a156, 0xd5a04f, 0xce994c, 0xb58242, 0x92673a, 0x582e10, 0x9c6f32, 0xdba853, 0xefc868, 0xf2d06e, 0xfdeda0, 0xd0bc85, 0x9b6830, 0xc18f49, 0xe3b560, 0xe5b75f, 0xe4b45e, 0xac7c43, 0x632400, 0xc5a45f, 0xe0cb86, 0x9d6e38, 0xbb8a4b, 0xb6864d, 0x733b0e, 0xd2a451, 0xebc869, 0xb8823c, 0xd9a150, 0xd59d4e, 0xb07e3d, 0x82592b, 0xa5793a, 0xb9862f, 0xeace7f, 0xfff2aa, 0xba9c5d, 0x885515, 0xe7bb64, 0xc89647, 0xa46e3c, 0x774b23, 0x5d3108, 0x985a1e, 0xca9a4d, 0xf9d576, 0xfce18e, 0xeeca81, 0xa7652c, 0x915328, 0x804724, 0x6d3f1f, 0x62361c, 0x573019, 0x4e2d18, 0x492a15, 0x452814, 0x442815, 0x3c2211, 0x381f11, 0x341d0f, 0x301a0d, 0x2c1a0c, 0x2b190d, 0x251308, 0x482e1d, 0x5a402c, 0x220f00, 0x1d1008, 0x1c0e07, 0x1b0d05, 0x180d04, 0x160c04, 0x150a04, 0x140a03, 0x130a03, 0x130b04, 0x120b05, 0x0f0903, 0x100804, 0x0e0804, 0x0d0804, 0x0c0703, 0x0a0702, 0x090702, 0x090702, 0x080500, 
-  0x0b0703, 0x0c0704, 0x0d0804, 0x0f0904, 0x110a04, 0x110a04, 0x120a04, 0x130a03, 0x140b03, 0x150b03, 0x170d04, 0x190d05, 0x1b0f07, 0x1d0e06, 0x2b170a, 0x402e1f, 0x251406, 0x251509, 0x28170b, 0x2a180c, 0x2c180c, 0x2d190d, 0x2f1b0e, 0x321d0f, 0x372011, 0x392111, 0x49301e, 0x412611, 0x432914, 0x462812, 0x56351f, 0x5d371b, 0x754621, 0x995f34, 0xa05e2f, 0x83461f, 0x7f4e1f, 0xf3db94, 0xeac87d, 0x9b6226, 0x814c1f, 0xc89b52, 0xcda560, 0x411f04, 0x452e1a, 0x58371c, 0x7c5125, 0x724b2c, 0x3d1a00, 0xb89255, 0xb48144, 0x9b6b37, 0x553b1c, 0x000000, 0x4b2b00, 0xc8a669, 0x84663c, 0x44220f, 0x634428, 0x5c4023, 0x3d2916, 0x4e2502, 0x9d763b, 0xd7b376, 0xa98758, 0x8a683a, 0x9e723e, 0xad773b, 0xa8783f, 0x744b20, 0x87582a, 0x895d27, 0x7a5123, 0x6b4623, 0x442407, 0x7c6138, 0xe7c274, 0xb79455, 0x59391f, 0x6f4d28, 0x875e2b, 0xa47136, 0xae7a38, 0xad7d39, 0x9c6c34, 0x82582b, 0x614220, 0x432f19, 0x291a0f, 0x2a1505, 0x714922, 0x9f713b, 0xb17e3c, 0xba883d, 0xe8cc8a, 0x9b7949, 0x895e2a, 0x976b36, 0xa06f36, 0x986a34, 0x78552b, 0x473219, 0x2d1605, 0x754e2c, 0xb38344, 0xca974b, 0xd6ac61, 0x633e1f, 0x7d532d, 0x9a6c36, 0xa7783b, 0x976a32, 0x7a5528, 0x442e13, 0x160300, 0x65452c, 0xb18249, 0xcb9946, 0xe5be77, 0x876641, 0x714c21, 0x8b612e, 0x9f7136, 0x926935, 0x6e4d2c, 0x452105, 0xb79154, 0xcea24c, 0xcfab6c, 0x634427, 0x785733, 0x7d5a35, 0x7d5b35, 0x745430, 0x6f5131, 0x5f432a, 0x2f1709, 0x4b2c13, 0xa17c46, 0xecc26b, 0xe5b95b, 0xe1c068, 0xfbf2c0, 0xb89e76, 0x915f2e, 0x805c32, 0x533c25, 0x2d0e00, 0x684424, 0xbf924b, 0xe3b256, 0xeace7c, 0xf9f3c7, 0xc29d6a, 0xb07c38, 0xaa783b, 0xc08f4e, 0xc49149, 0xb98644, 0xab7a43, 0x8a6037, 0x572e11, 0x9d6f37, 0xd3a051, 0xf3cb6c, 0xf3d06a, 0xfded9b, 0xd0bd84, 0xa27036, 0xc5934a, 0xe4b75f, 0xe7ba62, 0xe4b35b, 0xc18f52, 0x6f3a16, 0x9b733c, 0xf9e29e, 0xd6be81, 0xba8a4f, 0xa2703c, 0xa57932, 0xeec160, 0xc1974d, 0xad7535, 0xd1984a, 0xd49c4f, 0xa56f34, 0xd5af62, 0xf0cb7b, 0x7f531c, 0xb98740, 0xf0dc8c, 0xf3e093, 0x91652d, 0xc09349, 0xcd9a4f, 0x9e6935, 0x794d26, 0x572f0c, 0x8b501a, 0xbc8a42, 0xf8d273, 0xf9dc84, 0xf1ce82, 0xad6e33, 0x965628, 0x844925, 0x704021, 0x63381d, 0x58311a, 0x4f2e18, 0x4a2b16, 0x482915, 0x462915, 0x3f2312, 0x3d2212, 0x392010, 0x331e0f, 0x2d1b0d, 0x2a190c, 0x27160c, 0x2b180c, 0x2f1b0c, 0x201206, 0x1d1007, 0x1e0d05, 0x1b0c05, 0x170c03, 0x160d05, 0x150a04, 0x150a04, 0x140a04, 0x130b05, 0x120b05, 0x0f0a03, 0x100804, 0x0e0704, 0x0c0703, 0x0b0603, 0x0a0702, 0x080702, 0x080702, 0x070500, 
-  0x0b0702, 0x0c0703, 0x0d0804, 0x0f0803, 0x100903, 0x120a05, 0x130a05, 0x130a03, 0x140b02, 0x150c03, 0x180e05, 0x1a0e06, 0x1d1006, 0x1f1009, 0x200f08, 0x1f0d01, 0x261508, 0x2d180a, 0x2c170b, 0x2d180c, 0x2f190c, 0x311b0d, 0x341d0f, 0x351e0f, 0x392011, 0x3b2110, 0x3f230e, 0x402511, 0x462916, 0x603e28, 0x66422a, 0x62391e, 0x7a4928, 0x995d33, 0xac6935, 0x9f5e30, 0x8a4e20, 0xd9ba7c, 0xe2bf78, 0x9e672d, 0x865222, 0xd2a55a, 0xbe9856, 0x351302, 0x3d2915, 0x53351c, 0x7d5228, 0x552f11, 0x87673b, 0xca9c59, 0xa57036, 0x704b25, 0x462f1d, 0x412e17, 0x3c2213, 0x855b2c, 0x9d6d36, 0x7e592a, 0x664421, 0x604124, 0x4f341d, 0x391e09, 0x4d2303, 0x875e32, 0xb68d55, 0xb1864c, 0x9d6c33, 0x8f6231, 0x65411c, 0x6c4621, 0x805425, 0x885b27, 0x7d5526, 0x694623, 0x3f240c, 0x674724, 0xd1a862, 0xd1b374, 0x5d3b18, 0x674926, 0x865a2c, 0xaa793a, 0xb6843f, 0xa57639, 0xa17138, 0x8d6230, 0x73502c, 0x51371b, 0x3f2b17, 0x291000, 0x8a6038, 0x976833, 0xb4813d, 0xc49249, 0xe5c480, 0x90693c, 0x855a2b, 0x92662f, 0xa27136, 0xa5733d, 0x855b2e, 0x5b4222, 0x1b0600, 0x664228, 0xa0733a, 0xd8a95d, 0xbe985d, 0x5b3617, 0x8b5f32, 0xab7b3d, 0xb88542, 0xa37336, 0x936a36, 0x664a27, 0x1c0d02, 0x442c1b, 0x916740, 0xd3a75d, 0xdcbb78, 0x744f2d, 0x815b31, 0x825a2d, 0x976c36, 0x8d6635, 0x613d1f, 0x77562e, 0xc99e58, 0xcca156, 0xa98b5c, 0x714b25, 0x946736, 0x9d703b, 0xa87a41, 0xa77b41, 0xa77b44, 0x855f36, 0x503721, 0x341806, 0x744e26, 0xdcb464, 0xe5b85d, 0xddb555, 0xf4e09f, 0xe2d6ac, 0x8b5f21, 0x8e5e34, 0x704e2d, 0x3a220b, 0x49240b, 0x81572b, 0xd09e54, 0xdbb052, 0xf3e4a7, 0xebdeb3, 0xb28648, 0xa87737, 0x966c37, 0xa3753d, 0xba894f, 0x9f7140, 0x7a532e, 0x400000, 0xbb934c, 0xe2b358, 0xf2cb67, 0xf3ce67, 0xfcea99, 0xd8c88d, 0x9a692c, 0xcc994f, 0xebbb63, 0xe9bb62, 0xeab962, 0xd9a95d, 0x9a6f3c, 0x5d1c00, 0xc1a166, 0xfaeba8, 0xf0e1a1, 0xe9d18c, 0xf0cd7b, 0xc49c4e, 0x91612a, 0xc9944b, 0xcf9649, 0xcf974d, 0xa26d29, 0xefc66f, 0xedc879, 0x7b4d20, 0x5d2700, 0xab813c, 0xfce69a, 0xd4ba77, 0x9f702f, 0xd39f56, 0xa57136, 0x8a5d2e, 0x58310f, 0x7d4514, 0xb47f3c, 0xf9cf71, 0xf8da7f, 0xf8d88a, 0xb77a3e, 0x9a5928, 0x8a4d28, 0x724121, 0x63381d, 0x58311a, 0x4e2d18, 0x492a15, 0x492915, 0x452713, 0x412412, 0x402413, 0x3d2211, 0x351f0f, 0x2d1c0c, 0x28180a, 0x25150a, 0x21130b, 0x201007, 0x1e1109, 0x1d100a, 0x1e0c05, 0x1b0c05, 0x170c03, 0x160c04, 0x150a04, 0x140903, 0x130a03, 0x140c05, 0x110a04, 0x0f0903, 0x0f0804, 0x0e0804, 0x0c0703, 0x0d0704, 0x0b0703, 0x0a0803, 0x0a0702, 0x090601, 
-  0x0b0702, 0x0d0704, 0x0e0804, 0x100904, 0x110a04, 0x130b05, 0x130b05, 0x130a03, 0x140b02, 0x170d04, 0x190e05, 0x1c0f06, 0x1f1006, 0x201109, 0x20120b, 0x221309, 0x271608, 0x422514, 0x432313, 0x321a0c, 0x311b0d, 0x351c0d, 0x371e0e, 0x391e0e, 0x3b200f, 0x3d2211, 0x442814, 0x442716, 0x462615, 0x512d16, 0x593217, 0x653a1e, 0x784424, 0x8a4e27, 0xa16336, 0x7b4721, 0x652500, 0xb28f56, 0xcfa965, 0x995f2a, 0x8f5b27, 0xdfb063, 0xba9452, 0x412510, 0x3b2813, 0x543319, 0x6d4620, 0x452000, 0xbf985d, 0xb07e3f, 0xad7e42, 0x4e2e11, 0x483119, 0x533619, 0x3e2913, 0x57381a, 0x956631, 0xcba05a, 0x896431, 0x61401c, 0x4f3218, 0x6d4e30, 0x4a2f16, 0x351903, 0x330b00, 0x3a1800, 0x492b12, 0x4d3014, 0x68451e, 0x825628, 0x805324, 0x8c5f2d, 0x845a27, 0x6a4822, 0x452c15, 0x4b2a0e, 0x9d743b, 0xdcc080, 0x7b5833, 0x5e401f, 0x7e552a, 0x9e6e33, 0xa67534, 0x976a34, 0x926633, 0x8b6331, 0x7e5732, 0x5d3f20, 0x473218, 0x340f00, 0xbe945b, 0xac7c40, 0xb47f38, 0xc99852, 0xd9b878, 0x7e5527, 0x80552a, 0x956733, 0x9e6d2f, 0x996934, 0x926839, 0x674924, 0x281507, 0x50311b, 0x916332, 0xdcaf67, 0x99784b, 0x6d4622, 0x875c2a, 0xb98741, 0xc28f41, 0xad7d3b, 0x986d35, 0x714f2a, 0x402d19, 0x230a00, 0x7d5533, 0xc09858, 0xc8aa71, 0x65401a, 0x745026, 0x7b552b, 0x8d6637, 0x7f5931, 0x4c1d00, 0xb8965c, 0xcc9f4e, 0xdab876, 0x836645, 0x8e5e34, 0x9b6b38, 0xaa793f, 0xbe8b48, 0xc08e49, 0xb88646, 0x9c7239, 0x674f2d, 0x250803, 0x6a4425, 0xbd924e, 0xe4b75f, 0xdbad51, 0xe3c16f, 0xfbf2b8, 0xb89f6b, 0x905c24, 0x8d6134, 0x684927, 0x3b1802, 0x613a1c, 0x8d6033, 0xca9c51, 0xddb660, 0xf5e8ae, 0xeae0ac, 0xae8e5d, 0x946227, 0x956835, 0x9a6937, 0x8f6035, 0x6d451c, 0xad905c, 0xf5ce73, 0xf2ca5f, 0xf3cc64, 0xefc863, 0xf8e491, 0xe4d699, 0x96672a, 0xba8644, 0xd6a551, 0xe2b45b, 0xebbc64, 0xe4b460, 0xce9f59, 0x8e6030, 0x592800, 0x95713c, 0xc1a266, 0xc3a364, 0x8d6a36, 0x774918, 0xc18f47, 0xdba854, 0xd09b4c, 0xcc914a, 0xc79344, 0xd5a758, 0xa37433, 0xc4904d, 0x8f6333, 0x572700, 0xd4b16c, 0xf9e295, 0xa47d42, 0xab7632, 0xc68f44, 0xa37339, 0x643d16, 0x7f461a, 0xa9702d, 0xefc56a, 0xf5d67b, 0xf8d989, 0xb67e3e, 0x995628, 0x884c26, 0x724121, 0x64381e, 0x57301a, 0x4e2b15, 0x4a2a15, 0x4a2b16, 0x4e2a14, 0x623923, 0x4c2813, 0x3c2310, 0x351f10, 0x2e1a09, 0x281508, 0x25130a, 0x24130a, 0x231108, 0x1f1008, 0x1d0f09, 0x1c0d06, 0x1b0d05, 0x170c04, 0x160c04, 0x150a04, 0x140a04, 0x140b04, 0x130b04, 0x120a04, 0x100904, 0x0f0704, 0x0d0804, 0x0c0803, 0x0b0703, 0x0a0703, 0x0a0702, 0x0a0702, 0x090601, 
-  0x0c0703, 0x0e0804, 0x100805, 0x110905, 0x110a04, 0x130b05, 0x140b04, 0x140b03, 0x150c03, 0x180e05, 0x1b0e05, 0x1e1007, 0x201008, 0x221209, 0x22130a, 0x251309, 0x271305, 0x58321c, 0x643b26, 0x341a09, 0x311c0f, 0x361d10, 0x382011, 0x3b2010, 0x3c210f, 0x412311, 0x472713, 0x4a2814, 0x522e19, 0x5f381e, 0x653c1f, 0x6c3f20, 0x7c4723, 0x8e5229, 0x96582c, 0x673308, 0x81532a, 0xf3d994, 0xceac6b, 0x905923, 0x8b5621, 0xddad65, 0xb99253, 0x4a2d17, 0x402914, 0x634226, 0x5b3c1d, 0x7b5934, 0xb7894f, 0xb68141, 0xbf9253, 0x563314, 0x533720, 0x5b3e20, 0x614525, 0x341c09, 0x472505, 0xad844c, 0xd9b276, 0x805d35, 0x4d2f11, 0x6c4c2a, 0x795733, 0x58381d, 0x4f341e, 0x493019, 0x54391f, 0x5f4020, 0x825c30, 0x906330, 0x885927, 0x8d5e2b, 0x8b5f2a, 0x704d26, 0x4d311c, 0x331b08, 0x6f461f, 0xc5aa6d, 0xaf9964, 0x6c3f1b, 0x744d27, 0x8f6533, 0x9e7037, 0x8f6432, 0x885c30, 0x886033, 0x734f28, 0x5c4124, 0x432e17, 0x5e3f17, 0xd0a764, 0xb4803d, 0xb67e3c, 0xd1a258, 0xb7935e, 0x82592f, 0x7c5226, 0x996a33, 0xa57434, 0x986a35, 0x916735, 0x866133, 0x4b321b, 0x341902, 0x81562d, 0xdab16d, 0x836136, 0x724b22, 0x9a6f35, 0xcb984a, 0xc49241, 0xbe8e43, 0xa87d3a, 0x815a2c, 0x5c4325, 0x1e0800, 0x5c371a, 0xd3ac70, 0xbc9c6b, 0x5f3c16, 0x6b4926, 0x74512e, 0x6e4b27, 0x5b3619, 0x957347, 0xcea864, 0xd2a555, 0xf1da9d, 0xab936e, 0x97672a, 0x9e6f34, 0xb2803f, 0xca964b, 0xc49348, 0xad7c3f, 0x9c7241, 0x69502f, 0x290800, 0x9e794c, 0xb98c48, 0xdbaf5b, 0xd7a751, 0xdbac4a, 0xedd588, 0xf2e3a8, 0xa78a55, 0x8b5d26, 0x8c5f37, 0x714c2c, 0x3d1b01, 0x593218, 0x885c30, 0xba893e, 0xd1a64e, 0xf0de99, 0xf8eeb6, 0xd3c492, 0xb9a36b, 0xb0995f, 0xbda666, 0xddc479, 0xf6d97e, 0xf4ce6b, 0xe4bc5f, 0xeec364, 0xecc15c, 0xf4d982, 0xf5eaaa, 0xa27a42, 0xae793d, 0xd09f4f, 0xe4b45d, 0xebbf63, 0xe6ba5f, 0xdfb05e, 0xcd9b55, 0x9e7139, 0x7d4e1f, 0x6b390b, 0x6d3d10, 0x835526, 0xb38143, 0xdba456, 0xdca753, 0xd49f52, 0xcf964a, 0xd19e4e, 0x925e25, 0xbb8741, 0xe1a959, 0xae7c44, 0x320000, 0x996e32, 0xf8d787, 0xcba660, 0xa36c2e, 0xd2994c, 0xa9783d, 0x5e3812, 0x804b1e, 0xb87a32, 0xecc265, 0xf6d77a, 0xfddf8d, 0xc08e4b, 0x954f26, 0x834924, 0x703e1f, 0x61371e, 0x542e18, 0x593620, 0x543421, 0x442316, 0x603b1f, 0x9e714b, 0x5b341a, 0x391f15, 0x321c0d, 0x3e2a1b, 0x3d2a1d, 0x231007, 0x23120a, 0x221109, 0x1f1108, 0x1d0e07, 0x1d0e06, 0x1b0d05, 0x180d05, 0x160c03, 0x150a02, 0x140b04, 0x130a03, 0x130a03, 0x120a03, 0x110a04, 0x100804, 0x0c0804, 0x0b0803, 0x0b0704, 0x0b0703, 0x0a0702, 0x090601, 0x090601, 
-  0x0c0703, 0x0e0803, 0x100803, 0x110a04, 0x130b04, 0x140b04, 0x130a04, 0x140b04, 0x170d04, 0x1a0e05, 0x1d0f06, 0x201007, 0x211008, 0x231209, 0x24130a, 0x251408, 0x2a1507, 0x462411, 0x4e2a17, 0x33190a, 0x371f12, 0x3b2112, 0x3a2010, 0x3d2212, 0x482a18, 0x4c2a18, 0x4a2614, 0x4d2911, 0x735036, 0x633a1c, 0x6b3c1c, 0x774422, 0x814b26, 0x915326, 0xb16e3a, 0x985927, 0xa16e3f, 0xfce69e, 0xcca565, 0x8b521f, 0x875118, 0xddaf65, 0xaf884d, 0x4b2a12, 0x452912, 0x4b3117, 0x381d07, 0x9d7848, 0x915b22, 0xc08e50, 0xd1a768, 0x6a4820, 0x5d3d21, 0x5b3d1d, 0x604220, 0x54371e, 0x391e10, 0x3d1a00, 0x8c683b, 0x7d582e, 0x68451f, 0x745028, 0x845c32, 0x79522b, 0x734e2a, 0x6d4a26, 0x6e4923, 0x764f26, 0x835829, 0x8a5b28, 0x875926, 0x90602d, 0x8e602e, 0x724d26, 0x53381f, 0x2d1c0c, 0x482b14, 0x896432, 0xdbc383, 0x896e40, 0x764c23, 0x7d5629, 0x906534, 0x8c6437, 0x8a6138, 0x7e5530, 0x6d4d23, 0x583f21, 0x240000, 0x9b7a41, 0xd1a561, 0xaf7934, 0xb9853f, 0xd5a861, 0x7a542d, 0x845a31, 0x855a29, 0x9a6c35, 0xa4733a, 0x966730, 0x9b6f35, 0xaa8048, 0x755229, 0x3a210a, 0x644021, 0xc09a65, 0x825f34, 0x7c5528, 0xad7f3d, 0xc99746, 0xb3813a, 0xbb8b3e, 0xb98b3d, 0x9f7236, 0x734f28, 0x422d17, 0x300400, 0xb5935f, 0xa6895b, 0x65431a, 0x6d4b26, 0x68472d, 0x705238, 0x8e6e47, 0x967147, 0x764c21, 0x7e5524, 0xa89065, 0xdbc396, 0xc6a26c, 0xa97638, 0xca964b, 0xd5a24b, 0xd09f4f, 0xad7e43, 0x8d643b, 0x5f422a, 0x7c5e3d, 0xae8453, 0xa4733b, 0xab8145, 0xad8244, 0xb3843d, 0xbd924b, 0xccb272, 0xdac38b, 0xc2a87d, 0x8b643b, 0x8c6439, 0x745332, 0x462915, 0x47230a, 0x714824, 0x8c632a, 0xb28432, 0xd6b86f, 0xecdd9d, 0xf2e09d, 0xf2de95, 0xecd384, 0xdfbf6b, 0xd2ad56, 0xb99349, 0x805a28, 0xc69c54, 0xe2b24e, 0xe4be63, 0xfff5b4, 0xbfa470, 0xa5702f, 0xcf9d53, 0xdbaa57, 0xe7bc62, 0xeec767, 0xe4b85d, 0xddab58, 0xd2a252, 0xcb9a4e, 0xc18f46, 0xbd8b43, 0xc59247, 0xcc9749, 0xdaa252, 0xdaa351, 0xdfaa58, 0xc18b3e, 0xa06a2d, 0xc59148, 0xe0aa54, 0xd59a4f, 0xb27c40, 0x6a3f1c, 0x6c3b0a, 0xdeb569, 0xe3bc6d, 0x9b6828, 0xaf793c, 0x976836, 0x553314, 0x73451c, 0xb47630, 0xe4b55c, 0xf8da7d, 0xfce08b, 0xc2914d, 0x924f26, 0x814824, 0x6d3d1e, 0x5e351c, 0x522f18, 0x57341d, 0x51311c, 0x442613, 0x482711, 0x573216, 0x482610, 0x392012, 0x331d0f, 0x331f10, 0x2f1d10, 0x241208, 0x231209, 0x23120a, 0x21120a, 0x1d0e07, 0x1c0d06, 0x1a0d05, 0x180d04, 0x160c03, 0x160b03, 0x140a04, 0x130a03, 0x130a03, 0x120a03, 0x110a04, 0x100903, 0x0c0802, 0x0b0803, 0x0c0803, 0x0b0803, 0x0a0702, 0x0a0702, 0x090601, 
-  0x0d0804, 0x0e0802, 0x100903, 0x120a03, 0x130a03, 0x140b04, 0x150b04, 0x160c03, 0x190d05, 0x1c0e06, 0x1e1007, 0x211008, 0x231108, 0x241309, 0x25140a, 0x281608, 0x2c1709, 0x2e170d, 0x301a0c, 0x341b10, 0x3b2012, 0x412411, 0x442513, 0x432412, 0x4e2c18, 0x532e19, 0x4f2b18, 0x512e18, 0x573216, 0x63381a, 0x73411f, 0x844b23, 0x8c4f22, 0x985929, 0xaa6b39, 0x8d5328, 0x783d11, 0xd0af6e, 0xcb9a58, 0x9d6434, 0x9e6a2d, 0xe8bb6a, 0xa98448, 0x5e3a1c, 0x684728, 0x4a3117, 0x563c22, 0xa47948, 0x98622d, 0x855926, 0x745328, 0x63411c, 0x674522, 0x674521, 0x604323, 0x614221, 0x654421, 0x5a4021, 0x644321, 0x6f4821, 0x7a542e, 0x81562c, 0x85592e, 0x7b5127, 0x7a522a, 0x734c24, 0x7e572b, 0x895f2e, 0x825524, 0x946536, 0x845624, 0x895d29, 0x845827, 0x7b5327, 0x614320, 0x412c17, 0x220f03, 0x5a2904, 0xae8a56, 0xddcb90, 0x997c4f, 0x80521e, 0x805427, 0x77532b, 0x704f26, 0x755128, 0x6c4926, 0x431a05, 0x755830, 0xd4af6c, 0xbc8c4a, 0xac7938, 0xbf934f, 0x89683a, 0x724b26, 0x8a6233, 0x8c622e, 0x946631, 0x9c6b34, 0xa07034, 0x96682d, 0xb38544, 0xac8346, 0x604421, 0x422513, 0x8c6d4b, 0x815b31, 0x916632, 0xb17f3b, 0xcb9848, 0xb38239, 0xbf8e42, 0xc39142, 0xb78844, 0x926737, 0x62431f, 0x210000, 0x7d6143, 0x7b5e40, 0x623e1d, 0x734e2f, 0x5c4023, 0x341f0e, 0x442c16, 0x3d2107, 0x472817, 0x4c2c19, 0x3c1000, 0x4d2a02, 0x76522b, 0xb78442, 0xd19d4c, 0xdeaa4f, 0xd9a852, 0xb68746, 0x7b5930, 0x432a19, 0x422916, 0x3d1600, 0x47220b, 0x380f01, 0x331203, 0x381a0b, 0x3c1600, 0x3d0000, 0x4a2a02, 0x715b3e, 0x795530, 0x96693a, 0x8f6536, 0x815f36, 0x644829, 0x422612, 0x492410, 0x51260c, 0x5c2c00, 0x6b3c03, 0x794f27, 0x7b562d, 0x714b22, 0x60370e, 0x572e0a, 0x401100, 0x380601, 0x845e31, 0xdfaf57, 0xdcad42, 0xf8e9a4, 0xe3d6a3, 0xa1732e, 0xb48343, 0xc39349, 0xd2a355, 0xd8ab53, 0xe1b359, 0xeabc62, 0xe4b85e, 0xdfb159, 0xe0ae59, 0xe5b15d, 0xe4b25a, 0xedbc63, 0xe1af58, 0xe5b15c, 0xcf9b47, 0xc18e43, 0xd09e4d, 0xe0ad55, 0xe4b059, 0xdca752, 0xc58f49, 0x9c6936, 0x552300, 0xa37439, 0xf1cb7b, 0xa07735, 0x9a672f, 0x926432, 0x5b3719, 0x633612, 0xa06225, 0xe0ac5a, 0xfcdb7f, 0xfde087, 0xc4934c, 0x904e24, 0x824924, 0x713f1f, 0x62381d, 0x57331b, 0x502c14, 0x482812, 0x432814, 0x3f2516, 0x3c1f10, 0x3b2110, 0x372112, 0x341d0f, 0x2c180a, 0x281607, 0x271509, 0x25130b, 0x23130b, 0x201209, 0x1e0f08, 0x1c0e06, 0x1a0e05, 0x180e05, 0x160c03, 0x170b03, 0x140a04, 0x130a03, 0x130a03, 0x130a04, 0x110a04, 0x0f0903, 0x0c0802, 0x0c0802, 0x0c0703, 0x0b0702, 0x0a0702, 0x0a0702, 0x090601, 
-  0x0d0804, 0x0f0903, 0x110a04, 0x120a03, 0x130a03, 0x140b04, 0x160c03, 0x180e05, 0x1b0e06, 0x1e0f08, 0x211008, 0x231009, 0x251209, 0x261409, 0x261609, 0x291709, 0x2e190a, 0x34190c, 0x341c0c, 0x371c0f, 0x371a0d, 0x543725, 0x684733, 0x47230d, 0x4e2a15, 0x583018, 0x583017, 0x583119, 0x5d321a, 0x6f3e20, 0x7a431d, 0x975c30, 0xab6c3e, 0x9c5b2b, 0x915b30, 0x512809, 0x582900, 0xd6a867, 0xbe8b47, 0x945f2e, 0x9e6a2e, 0xebc070, 0xa78247, 0x66411f, 0x704c27, 0x492c12, 0x7f5e3a, 0xa77743, 0x946434, 0x583716, 0x4b3118, 0x603e1f, 0x73502b, 0x6b4925, 0x694723, 0x65431e, 0x6d4b24, 0x764f28, 0x875f35, 0x7b562b, 0x6d4b24, 0x7e552c, 0x865a2d, 0x885c2f, 0x7c5025, 0x774c21, 0x7e5425, 0x8b612b, 0x875b29, 0x875829, 0x845625, 0x895e2b, 0x825726, 0x815726, 0x745227, 0x54391e, 0x31200f, 0x2f1306, 0x5e3607, 0xb18f5b, 0xe3c88b, 0xc8a96e, 0x936d3d, 0x6d4423, 0x623a1d, 0x562f07, 0x633c16, 0x9b7b49, 0xd5af70, 0xb78b4c, 0xaa783a, 0xac7d42, 0x825e33, 0x482a0f, 0x835e33, 0x815829, 0x946834, 0x9a6d32, 0xa47435, 0xa57636, 0x9e6d36, 0xb0803e, 0xc1954d, 0x866330, 0x54371d, 0x614122, 0x9b7341, 0xa57738, 0xc18e43, 0xd2a04c, 0xd1a34c, 0xbe8d3c, 0xc69245, 0xad7e36, 0x966833, 0x845d2b, 0x674729, 0x371b08, 0x5b3c1e, 0x7a552c, 0x825b2f, 0x805c2e, 0x6c4a2a, 0x624429, 0x5c4123, 0x5b4125, 0x5d4328, 0x694729, 0x79522d, 0x9f733b, 0xbe883f, 0xc99644, 0xd7a149, 0xd5a24a, 0xbb8a40, 0xa5773c, 0x90693d, 0x6f4c2b, 0x694a2b, 0x5d4225, 0x5a3b26, 0x56371c, 0x634328, 0x6e4926, 0x744e2a, 0x79542c, 0x8f6734, 0xb28346, 0xbb8946, 0xb48342, 0xa4763d, 0x926836, 0x846032, 0x7c5932, 0x724c2d, 0x664426, 0x593a1c, 0x5f3d22, 0x603d24, 0x623f27, 0x6a492c, 0x715130, 0x593d23, 0x280e00, 0x4f2d0f, 0xb88d46, 0xddaa45, 0xdbbe6c, 0xfbf6c5, 0xc4a976, 0xae7d37, 0xad7c3e, 0xb78341, 0xd09a4d, 0xd8a451, 0xe2b25b, 0xe3b25a, 0xe3b35a, 0xe6b95d, 0xf1c669, 0xeac063, 0xf3ca6b, 0xf2c96a, 0xe9bc5f, 0xecbb62, 0xedbb60, 0xe6b458, 0xe2b059, 0xe8ba5c, 0xebbd5d, 0xdfab5a, 0xba8244, 0x5d3409, 0x6f3d0c, 0xe2b96b, 0xd1a659, 0xaf7938, 0xa87338, 0x7b4e28, 0x653811, 0x9b6226, 0xd8a352, 0xf7d272, 0xfada7e, 0xc7964d, 0x914d22, 0x864b26, 0x784323, 0x6a3d21, 0x5b341c, 0x512d16, 0x4a2a16, 0x462815, 0x422713, 0x4b331e, 0x412815, 0x371d10, 0x341d0f, 0x301c0e, 0x2b190b, 0x291709, 0x25140a, 0x23120a, 0x201108, 0x1d0e07, 0x1d0e06, 0x1a0f06, 0x170d04, 0x170d04, 0x170b03, 0x150b05, 0x140b04, 0x140b04, 0x130a04, 0x100903, 0x0f0903, 0x0d0903, 0x0d0903, 0x0d0703, 0x0b0703, 0x0a0702, 0x0a0702, 0x090601, 
-  0x0e0903, 0x100a04, 0x120a04, 0x130b03, 0x140b02, 0x160c03, 0x170d04, 0x1a0e05, 0x1d0f07, 0x200f07, 0x211007, 0x231208, 0x251409, 0x271509, 0x291709, 0x2c170a, 0x31190c, 0x351b0e, 0x361c0e, 0x371d0e, 0x3a1e10, 0x402312, 0x472714, 0x4b2814, 0x502a13, 0x60371e, 0x5f371b, 0x5b3118, 0x613315, 0x713b1a, 0x844721, 0xa76637, 0xa46637, 0xa05d2e, 0x9d6130, 0x653314, 0x926b35, 0xf6cc7f, 0xa7773e, 0x845321, 0x8a551f, 0xeac676, 0xb58f4f, 0x69401d, 0x754f28, 0x654426, 0x5b3b1a, 0x765028, 0x603e1d, 0x53361a, 0x624121, 0x6d4824, 0x704923, 0x6f4a22, 0x755124, 0x7f5929, 0x865d30, 0x82572c, 0x7c5429, 0x7a572d, 0x6b4921, 0x6f4b23, 0x855a2d, 0x906332, 0x895d2d, 0x845727, 0x8f622e, 0x825725, 0x7f5121, 0xa17039, 0x8c5f2b, 0x885d2a, 0x8f612e, 0x875c2c, 0x704b22, 0x624323, 0x52381e, 0x311d0d, 0x230b01, 0x411900, 0x7f5d2e, 0xbe9c60, 0xd2ab68, 0xc79c5b, 0xbb9254, 0xbe995f, 0xcba565, 0xcaa563, 0xa47b41, 0x90612d, 0x926735, 0x6e4d29, 0x3d1b0b, 0x604222, 0x7c582b, 0x895f2d, 0x9e6f37, 0xa37234, 0xa07133, 0x9c6e32, 0xa97c3f, 0x9b6e30, 0xac8042, 0x916831, 0x8e6533, 0x926935, 0x996e35, 0xa57738, 0xbc8b3f, 0xc99842, 0xd7a74f, 0xc99948, 0xba873b, 0xb5833c, 0xa57537, 0x9c7037, 0x966f3b, 0x7a582e, 0x7d572b, 0x946933, 0xaa7b3e, 0x9e7037, 0x946b38, 0x855f31, 0x805b2f, 0x886236, 0x825c2f, 0x936735, 0xa27136, 0xb8843f, 0xc28e41, 0xcf9c49, 0xdca950, 0xd8a54d, 0xca9643, 0xce9a4e, 0xb28240, 0x986c36, 0x835c2c, 0x866031, 0x91693a, 0x815829, 0xa57941, 0xb18140, 0xa7763a, 0xb3813e, 0xc39143, 0xcf9d4b, 0xd19f4d, 0xcf9d4d, 0xcf9f51, 0xbd8f49, 0xac7f42, 0x9a6d36, 0x9f713c, 0xa2743f, 0x9e703c, 0xa37543, 0x9b6e3f, 0x906339, 0x8c6238, 0x8c6336, 0x846035, 0x55391d, 0x311001, 0x653f14, 0xc59444, 0xd7a642, 0xebd697, 0xfdf6c5, 0xcfb580, 0xab772d, 0xbb8643, 0xb78341, 0xc28c46, 0xcb9547, 0xcf9a4a, 0xd9a84f, 0xe2b45a, 0xe6b961, 0xe4b65f, 0xeec367, 0xf2ca6a, 0xeec465, 0xebbc60, 0xebba5d, 0xe5b558, 0xebbe60, 0xf3cb6a, 0xf1c768, 0xdaa956, 0xbe8640, 0x936330, 0x522404, 0x906933, 0xd9a858, 0xc48c47, 0xb57f43, 0x86592c, 0x6c3e16, 0xa5692e, 0xd0994a, 0xf3cb6b, 0xf8d477, 0xce9e55, 0x925022, 0x874a27, 0x794522, 0x693c1f, 0x5c341b, 0x523016, 0x4c2d16, 0x492c17, 0x3f1f0a, 0x725a41, 0x574029, 0x36190d, 0x361f11, 0x341e10, 0x2e1a0d, 0x2a1809, 0x261609, 0x221308, 0x1f1107, 0x1e1007, 0x1d0f06, 0x1b0e05, 0x190c04, 0x170d04, 0x160c03, 0x140b04, 0x140b04, 0x130a03, 0x120a03, 0x110a02, 0x100903, 0x0d0903, 0x0b0902, 0x0b0703, 0x0c0703, 0x0b0602, 0x0a0702, 0x090601, 
-  0x110a04, 0x120b05, 0x130c04, 0x140b03, 0x150c03, 0x170d04, 0x190e05, 0x1d0f06, 0x200f07, 0x211008, 0x221108, 0x26140a, 0x27150a, 0x29170b, 0x2c190b, 0x2e180b, 0x321a0e, 0x351b0f, 0x371d10, 0x381e10, 0x3b2010, 0x3e2211, 0x442511, 0x4b2814, 0x532d16, 0x583015, 0x5b3017, 0x5c3117, 0x794d2c, 0x93603a, 0x91562c, 0x9c5b2e, 0x985825, 0xa96230, 0xa96634, 0x8e5028, 0x996c37, 0xf0c97a, 0xa7783a, 0x885327, 0x84501b, 0xe6c474, 0xbe9754, 0x6c441e, 0x6c4520, 0x613f21, 0x492d12, 0x472c10, 0x4d341c, 0x593b1e, 0x6f4c29, 0x7c562e, 0x7a5128, 0x7b5127, 0x7f562b, 0x81592f, 0x835b32, 0x764f25, 0x704c24, 0x6f4d28, 0x6f4d2a, 0x6f4926, 0x7a532c, 0x815929, 0x966936, 0x8f602d, 0x906229, 0x8f6129, 0x8e602f, 0x9b6c35, 0x8e622f, 0x845929, 0x8f612d, 0x8d602d, 0x7e572b, 0x6a4622, 0x6b4826, 0x4f351b, 0x30200f, 0x1a0c03, 0x210502, 0x3a1500, 0x4e2c06, 0x78572c, 0x906c39, 0x94713f, 0x916a36, 0x815522, 0x80562c, 0x6a4524, 0x492c16, 0x4b311c, 0x5e4221, 0x6d4d29, 0x835b2d, 0x9a6d34, 0xad7d3a, 0xa67530, 0xb38341, 0xae8043, 0x996b32, 0xac7e46, 0xa97d42, 0x956830, 0xa07238, 0xb38444, 0x9f702f, 0xa37332, 0xb5843a, 0xca9945, 0xce9d46, 0xdcad59, 0xbb8b3f, 0xaf7e38, 0xa97a39, 0x9f7235, 0xa4793b, 0xa27a3e, 0xa0743c, 0xa27334, 0xaa7a39, 0xa87838, 0xa17335, 0xa2763a, 0x986d33, 0x9e7338, 0xa57937, 0xaa7b37, 0xb9863f, 0xb9843d, 0xc59044, 0xcf9b47, 0xd09d46, 0xd19d48, 0xd19c4a, 0xd19e4d, 0xbd8a40, 0xb5843f, 0xac7e3b, 0xb3843f, 0xb4863d, 0xba8b41, 0xc49347, 0xcc994b, 0xbf8b42, 0xc89446, 0xd29e49, 0xd8a64d, 0xdaa84f, 0xd1a047, 0xd2a24c, 0xd1a150, 0xd2a154, 0xc49147, 0xc18f46, 0xc08e46, 0xc4924b, 0xbd8c46, 0xb07f3d, 0xb28143, 0xb68446, 0xb88545, 0xb58444, 0x9c7340, 0x573719, 0x421b00, 0x754a1d, 0xbe8643, 0xd8a545, 0xf1dc96, 0xfef6bb, 0xddcc8d, 0xb79454, 0xa16e33, 0x9a682c, 0xa67935, 0xcb9d4d, 0xe7b95f, 0xefc367, 0xe9bf63, 0xdfb359, 0xe8bc60, 0xeec565, 0xecc163, 0xe3b558, 0xe4b658, 0xe5b85a, 0xe6ba5b, 0xf3ca6b, 0xe9c060, 0xddae54, 0xd59e4d, 0xca944e, 0x90622f, 0x4b1e00, 0x805020, 0xa47038, 0xa4743c, 0x7a5027, 0x6a3d13, 0xaa6f30, 0xd09847, 0xf2cb69, 0xf8d577, 0xd0a054, 0x9c5c28, 0x8c4d26, 0x7e461f, 0x6e3d1d, 0x5f351a, 0x553216, 0x4f2f16, 0x472a16, 0x442719, 0x3e210e, 0x3d220f, 0x3a2014, 0x382012, 0x341d0f, 0x2f1b0d, 0x2b180a, 0x271609, 0x231308, 0x201107, 0x1e1007, 0x1d0f06, 0x1b0e05, 0x190d04, 0x170d04, 0x150c03, 0x130a03, 0x130a03, 0x130a03, 0x130b03, 0x120b03, 0x110a04, 0x0d0903, 0x0c0903, 0x0c0703, 0x0c0603, 0x0b0602, 0x0b0703, 0x090601, 
-  0x110a03, 0x130c04, 0x130b04, 0x130b03, 0x160c03, 0x180e05, 0x1a0f06, 0x1d1007, 0x211008, 0x221009, 0x241309, 0x26140a, 0x28160b, 0x29160a, 0x2c170a, 0x2f180b, 0x321a0e, 0x351b0e, 0x371d0f, 0x391f0f, 0x3c2110, 0x402311, 0x462713, 0x4d2a16, 0x5c351e, 0x5f361b, 0x65391e, 0x603218, 0x714122, 0x804a28, 0x915a35, 0x91572f, 0x955629, 0xad6835, 0x9f602f, 0x71421f, 0x5d2902, 0xc69859, 0xa7763b, 0x82522a, 0x75410c, 0xdfbd72, 0xb99353, 0x5f3514, 0x5f3e1f, 0x614024, 0x5f4124, 0x5c3f20, 0x5c3d21, 0x5a3c1d, 0x6c4a25, 0x7c562d, 0x785127, 0x714c26, 0x664323, 0x603e22, 0x634324, 0x624321, 0x674626, 0x5e411f, 0x644724, 0x6b4a26, 0x694924, 0x6e4b21, 0x825929, 0x91632f, 0xa27235, 0x9f6e30, 0x8f612e, 0x885926, 0x875a29, 0x86592a, 0x8e5f2a, 0x96682f, 0x946834, 0x7f562a, 0x795127, 0x6c4b24, 0x563c1e, 0x3c2715, 0x301e12, 0x28180b, 0x27160b, 0x0e0000, 0x240b02, 0x452a0f, 0x503218, 0x43230d, 0x331a06, 0x3a2613, 0x563c22, 0x6b4d2b, 0x75522d, 0x7d562d, 0x8e6331, 0x9d7034, 0xb0813d, 0xb1813b, 0xab7b34, 0xbc8c46, 0xab7d3f, 0x9d7134, 0xac8041, 0xa67537, 0xaa7938, 0xb5843e, 0xba8942, 0xb07e37, 0xb9883d, 0xc39240, 0xca9843, 0xcc9c49, 0xce9f52, 0xa4752f, 0xa17334, 0xa37535, 0xa97a36, 0xa77735, 0xb08040, 0xb78943, 0xad8037, 0xac7c35, 0xae7c36, 0xb6853e, 0xb18139, 0xa77730, 0xb4833b, 0xbf8e42, 0xc79546, 0xc18e3f, 0xc4913e, 0xcd9b45, 0xd19e49, 0xcc9946, 0xd3a14f, 0xcb9848, 0xd5a251, 0xc99646, 0xc79342, 0xc79342, 0xce9a49, 0xd5a04e, 0xcb9647, 0xcc974c, 0xcf994a, 0xcf9b48, 0xd4a24a, 0xd8a74c, 0xddab4f, 0xdaa84d, 0xd5a34b, 0xdeab54, 0xdca950, 0xd59f49, 0xd49f4a, 0xd8a34f, 0xd7a44f, 0xddaa55, 0xd3a04d, 0xcd9849, 0xc99245, 0xca9346, 0xcf9747, 0xc5944a, 0x9e7541, 0x522e0e, 0x4a2207, 0x6d4216, 0x966728, 0xc39544, 0xe0c06e, 0xf3e096, 0xf7e99e, 0xe8d894, 0xd9c588, 0xdec588, 0xd8ba7a, 0xcfa555, 0xdfaf5c, 0xe6b65f, 0xe4b55a, 0xebbe62, 0xeec264, 0xe9be60, 0xe9bd5f, 0xe6ba5b, 0xf2c768, 0xf3c96a, 0xedc465, 0xe4b95b, 0xdfaf57, 0xdfab55, 0xd59d4d, 0xbd8743, 0xa97c3d, 0xad7a42, 0xb68144, 0xa57439, 0x744823, 0x6e4017, 0xb17635, 0xdca550, 0xf4cd6a, 0xfad87b, 0xe4b465, 0xa86830, 0x945227, 0x91562c, 0x7a4622, 0x64381b, 0x573317, 0x58361e, 0x492c14, 0x452817, 0x402415, 0x3c2211, 0x3b2111, 0x391f10, 0x351e0f, 0x301a0d, 0x2b180a, 0x271609, 0x241308, 0x221208, 0x201108, 0x1d0f06, 0x1b0e05, 0x1a0d05, 0x180d04, 0x150c03, 0x140b04, 0x140b04, 0x140a04, 0x130b04, 0x120b03, 0x110a04, 0x0e0a03, 0x0c0903, 0x0c0703, 0x0c0703, 0x0b0602, 0x0a0702, 0x090601, 
-  0x110a02, 0x140c04, 0x140b04, 0x140b03, 0x160c03, 0x190e05, 0x1b0e06, 0x1d1007, 0x211008, 0x221009, 0x241209, 0x26140a, 0x28150b, 0x29150a, 0x2d170a, 0x2f180c, 0x331a0e, 0x351b0e, 0x381e0f, 0x391f0e, 0x3c2211, 0x402411, 0x472612, 0x4e2a16, 0x552e16, 0x61381d, 0x704324, 0x643518, 0x693a1b, 0x723d1e, 0x78411f, 0x844924, 0x95572b, 0xad6b32, 0x9b5f2e, 0x52270b, 0x5d3409, 0xddb370, 0xa57842, 0x6f431b, 0x84521f, 0xeac97b, 0xbc9a58, 0x5c3716, 0x593e21, 0x5d3c1f, 0x5d3e20, 0x5d3f20, 0x664526, 0x604122, 0x6b4925, 0x6f4d26, 0x6c4923, 0x6f4c28, 0x613d19, 0x57340f, 0x623e1a, 0x714d26, 0x7a572d, 0x5c3913, 0x451f00, 0x502f16, 0x664729, 0x614320, 0x674622, 0x7d5224, 0xb17f40, 0xb28141, 0x885c29, 0x8e602d, 0x8f602c, 0x895c2b, 0x8a5a25, 0xa47337, 0x9e6f33, 0x916431, 0x8a602e, 0x805729, 0x734f29, 0x4d3216, 0x452f18, 0x4d381f, 0x392913, 0x322312, 0x2f210f, 0x332414, 0x42301e, 0x4b341d, 0x563a1e, 0x624626, 0x624321, 0x704c25, 0x81582c, 0x845a2c, 0x906632, 0x976b36, 0x986b34, 0xa2753a, 0xaf8142, 0xa57431, 0x9e7130, 0xa77b3a, 0xb78846, 0xbc8c48, 0xab7b37, 0xa4732e, 0xb5833c, 0xb7863c, 0xb38337, 0xb88539, 0xc49143, 0xbc8c3e, 0xbb8c40, 0xaf7f3c, 0xa27538, 0xa97b3b, 0xb98944, 0xb78743, 0xa87838, 0xa67935, 0xb38745, 0xb68947, 0xb98842, 0xbb893f, 0xc19045, 0xbd8d44, 0xb4833d, 0xb48340, 0xbb8a44, 0xc59345, 0xc89645, 0xcb9a4b, 0xc59549, 0xc8984e, 0xcb9a50, 0xc7974c, 0xcd9c4f, 0xca9949, 0xce9b48, 0xc99845, 0xc89646, 0xc79345, 0xc59246, 0xc39145, 0xca974a, 0xce9c4d, 0xd3a450, 0xd0a04b, 0xd1a04a, 0xd6a44d, 0xd6a44d, 0xd6a34e, 0xce9a49, 0xc89544, 0xd19d4b, 0xd3a04c, 0xddaa54, 0xd8a54e, 0xdda953, 0xd3a04c, 0xc99648, 0xca974d, 0xc59148, 0xc7954c, 0xae7e41, 0x976e3f, 0x694721, 0x472104, 0x492006, 0x572d0d, 0x7b4d0f, 0x8f5e1d, 0xa38143, 0xb9a164, 0xbca56b, 0x988250, 0x825f32, 0xc0914d, 0xd29e50, 0xe5b45d, 0xeabb5f, 0xe7ba5d, 0xedc063, 0xecc163, 0xeac062, 0xeec364, 0xf3cb6b, 0xefc767, 0xeec464, 0xe6b95c, 0xdaab53, 0xddae55, 0xd6a44e, 0xcb9549, 0xd19c4d, 0xd19a4c, 0xc9924e, 0xac7b41, 0x7c502d, 0x75471e, 0xae7332, 0xd79f4b, 0xf0c967, 0xfad97e, 0xe4b466, 0xb26f35, 0x9f5b2c, 0xa6683b, 0x824b25, 0x663a1d, 0x563318, 0x523018, 0x4b2b15, 0x462912, 0x412612, 0x3d2310, 0x3c210e, 0x391f0f, 0x351d0e, 0x311b0d, 0x2d190b, 0x271609, 0x241309, 0x231208, 0x211008, 0x1d0f06, 0x1b0e05, 0x1a0d05, 0x180e05, 0x160d04, 0x150c04, 0x130a04, 0x130a03, 0x130b03, 0x120b04, 0x110a04, 0x0e0a03, 0x0c0903, 0x0c0804, 0x0c0703, 0x0b0602, 0x0b0803, 0x0a0702, 
-  0x130b04, 0x150c04, 0x170c04, 0x160c03, 0x170e05, 0x1a0f06, 0x1c1007, 0x1f1109, 0x221109, 0x241209, 0x251309, 0x28160b, 0x2a170c, 0x2b170a, 0x30190c, 0x331a0d, 0x361b0f, 0x381d0f, 0x392110, 0x3b2112, 0x402211, 0x432410, 0x482714, 0x4f2a14, 0x5c3319, 0x603414, 0x784829, 0x774728, 0x6a3a17, 0x723f1c, 0x7a4621, 0x884a25, 0x99582a, 0xb06a2f, 0xac6b35, 0x793e19, 0x9c6e39, 0xfcda8c, 0xa8854a, 0x744219, 0x8f5b1c, 0xebcc7a, 0xb99857, 0x603d18, 0x543b1d, 0x57381b, 0x563917, 0x452909, 0x52381c, 0x5d3f22, 0x664622, 0x674622, 0x5e3f20, 0x5e3b1d, 0xab8656, 0xad8247, 0xbd8f4f, 0xcb9d56, 0xd6ae67, 0xd2b573, 0xb79f66, 0x896b3f, 0x5f3200, 0x583719, 0x583b1c, 0x704a23, 0x8f6228, 0xaa7b40, 0x865927, 0x875a29, 0x8f612d, 0x91612e, 0x95652d, 0xa27132, 0xa97837, 0x9f6f32, 0x9b6e32, 0x855928, 0x7f592e, 0x6a4c26, 0x563b1c, 0x553c1d, 0x533b1f, 0x523a1f, 0x573d1f, 0x5d4121, 0x664827, 0x6a4b2c, 0x6c4b2a, 0x70502a, 0x755430, 0x78522f, 0x8c6535, 0x906836, 0x896130, 0x855d2e, 0x7f5628, 0x8d6531, 0x936a30, 0xab7b3e, 0x9d7032, 0x9b7031, 0xa07034, 0xb78b49, 0xb88c46, 0xae7f40, 0xaf7e38, 0xb98639, 0xb68438, 0xb68437, 0xbe8c3f, 0xbe8d41, 0xaf7e34, 0xb1803c, 0x9b6d31, 0x9f7339, 0xa67839, 0xaa7d3c, 0xa2773b, 0xa37539, 0x986c33, 0x956a34, 0xa27537, 0xac7e39, 0xb58743, 0xb48741, 0xa97d3a, 0x9f7339, 0x986b33, 0xb17f40, 0xbe8e47, 0xb58640, 0xb68545, 0xb58546, 0xad7f3e, 0xaa7d3d, 0xb1833f, 0xbb8c44, 0xba8b43, 0xb58842, 0xb88a46, 0xac7b3b, 0xac7c3d, 0xb48441, 0xc08f49, 0xbd8d46, 0xc7974f, 0xbb8c41, 0xbb8b41, 0xc89848, 0xd0a04e, 0xc99a4b, 0xbe8e46, 0xba8943, 0xbe8d46, 0xbc8a41, 0xd19f51, 0xcf9c4b, 0xca9748, 0xbd8c44, 0xbf8f49, 0xc0904c, 0xb58849, 0xb08047, 0xa2743c, 0x9f743f, 0xa47941, 0x926b38, 0x6d4d28, 0x492a10, 0x391904, 0x422108, 0x431800, 0x4b1800, 0x62340d, 0x83572f, 0xa47441, 0xb88543, 0xd3a051, 0xe4b55b, 0xe3b358, 0xdfae53, 0xe6b85c, 0xedc265, 0xedc565, 0xf0c767, 0xeec768, 0xecc565, 0xe7bc5d, 0xdfb053, 0xdaac4e, 0xdfb254, 0xd9a752, 0xcc9849, 0xcb954b, 0xcb9549, 0xc58f4a, 0xa3723e, 0x6d421e, 0x673a16, 0xaa6d2c, 0xd5a14c, 0xf3cd6d, 0xf7d37a, 0xd6a75b, 0xad662c, 0x9e5b2b, 0x8d4f23, 0x7a441f, 0x663b1b, 0x593417, 0x522f18, 0x4f2d19, 0x482b16, 0x422713, 0x402412, 0x3c2211, 0x371f10, 0x331c0e, 0x301a0e, 0x2b170a, 0x271509, 0x251308, 0x231108, 0x211008, 0x1f1007, 0x1d0f06, 0x1b0e05, 0x170e04, 0x160e04, 0x150d04, 0x140b03, 0x140b04, 0x130b05, 0x120b04, 0x110a04, 0x0f0a04, 0x0e0904, 0x0d0703, 0x0c0602, 0x0a0602, 0x0a0702, 0x0a0702, 
-  0x140b04, 0x170d04, 0x1a0d04, 0x180d04, 0x190f05, 0x1b1006, 0x1e1108, 0x211309, 0x231209, 0x241208, 0x261409, 0x2b180c, 0x2d1a0c, 0x2e180b, 0x341a0d, 0x361c0e, 0x381d0f, 0x3b1f0f, 0x3b230c, 0x3c1e0f, 0x3f1f0f, 0x4a2d17, 0x4c2a15, 0x4f280f, 0x784f35, 0x7f5336, 0x6b3a19, 0x704020, 0x734121, 0x754322, 0x774321, 0x884b25, 0x9a5b2b, 0xb36e35, 0xad6b35, 0x824823, 0x925c2f, 0xe4ba74, 0xaf8748, 0x804b27, 0xa06f2f, 0xf5d887, 0xbc9e5f, 0x623e15, 0x51311a, 0x503217, 0x85603a, 0xab855a, 0x533002, 0x513317, 0x5c3d1f, 0x5d3f1f, 0x4c3016, 0x5e442c, 0x957954, 0x5a3c1b, 0x704d28, 0x8d6530, 0x976931, 0xab7c3c, 0xcfac6c, 0xf1e0a5, 0xd1c28f, 0x745021, 0x593712, 0x6a4826, 0x704b24, 0x895e2e, 0x8e6130, 0x7c5120, 0x855929, 0x91612c, 0x9c6a30, 0xa17032, 0xae7c3b, 0xbd8b4a, 0x9a692d, 0x905d2b, 0x89602d, 0x7e5c2c, 0x73532b, 0x5a3b20, 0x50310b, 0x614827, 0x684b29, 0x755330, 0x7c572d, 0x79572f, 0x6f4f2a, 0x6c4c29, 0x6a4b2a, 0x654526, 0x74512c, 0x8b6336, 0x7d592c, 0x7c572f, 0x7d5830, 0x7d582f, 0x866231, 0x9e713a, 0x9d743d, 0x86612b, 0x8c622e, 0x93682b, 0x986e31, 0xac7f3c, 0xb2823c, 0xb7883e, 0xbc893e, 0xb8873b, 0xb6863a, 0xb28038, 0xb4853e, 0xaf803c, 0x976c32, 0x8d6531, 0x996d37, 0x8e632c, 0x86612d, 0x8e6432, 0x8c6434, 0x7c592c, 0x7e5928, 0x916833, 0x956934, 0x976a37, 0x906633, 0x7f5829, 0x856232, 0x896432, 0x956d39, 0x946834, 0x986a38, 0x9b6f3c, 0x99703a, 0x8f6636, 0x946938, 0x966a37, 0x956b37, 0x966c35, 0xa2733a, 0xa4753e, 0x9e723d, 0x9e6f38, 0xab7b41, 0xa47439, 0xa97a44, 0xa27439, 0xa4753d, 0xaa7b3c, 0xac7d3f, 0xad7e42, 0xa8783f, 0xa6773e, 0xa6773e, 0xa9793e, 0xb58544, 0xbc8b46, 0xb58243, 0xa87740, 0xb48548, 0xb68549, 0xa37337, 0xa3723f, 0xa07439, 0x966c36, 0x9a6b38, 0xa7753f, 0xa67842, 0x8f6735, 0x866034, 0x845e35, 0x865f34, 0x92693a, 0xa67743, 0xac7b43, 0xab7a41, 0xb88647, 0xbb8944, 0xc29249, 0xbc8c41, 0xc7964c, 0xe2b25c, 0xecc260, 0xefc869, 0xedc364, 0xe8bf60, 0xecc264, 0xe8bc5d, 0xe4b559, 0xe2b358, 0xe4b458, 0xdda754, 0xc79246, 0xb5823f, 0xe7b86a, 0xcb994e, 0xa3723e, 0x754c28, 0x5f3311, 0xb0732f, 0xe2b058, 0xf5cf71, 0xf6d17a, 0xd9ab60, 0xb26b30, 0xa05e2d, 0x8c4e25, 0x774421, 0x693f22, 0x5d371c, 0x54311b, 0x532f18, 0x4c2d18, 0x482914, 0x452511, 0x402310, 0x3f210e, 0x381d0d, 0x311a0c, 0x2c1708, 0x271508, 0x251307, 0x231107, 0x201007, 0x1f1108, 0x1d0f07, 0x1c0f06, 0x180f04, 0x170f04, 0x150d03, 0x150c03, 0x140b04, 0x130b05, 0x120b05, 0x110a04, 0x100903, 0x0f0803, 0x0e0603, 0x0c0602, 0x0b0602, 0x0a0702, 0x0a0702, 
-  0x140b04, 0x170d05, 0x180c04, 0x170c03, 0x190e05, 0x1c0f06, 0x1e1006, 0x201207, 0x221207, 0x231308, 0x261408, 0x281609, 0x2a170a, 0x2c170a, 0x311b0d, 0x341b0d, 0x361c0d, 0x381e0e, 0x3c1e0b, 0x54321a, 0x5a3920, 0x4b2b16, 0x4c2913, 0x522d16, 0x572e15, 0x5f3317, 0x5e3216, 0x62361b, 0x6b3d20, 0x6e3d1f, 0x774421, 0x894e27, 0x995c2d, 0xb2713a, 0xa06432, 0x5d2f15, 0x491300, 0xb48649, 0xbc8847, 0x7b4923, 0x91622a, 0xf0d385, 0xc8ac68, 0x633c15, 0x4f321a, 0x443016, 0x613d15, 0xd8b476, 0xceb57d, 0x603f14, 0x533115, 0x5a3e1e, 0x533b1e, 0x38210e, 0x000000, 0x000000, 0x000000, 0x2c1604, 0x6b4a27, 0x926132, 0x975f1e, 0xb89359, 0xf3e1a7, 0xe0ce99, 0x744c24, 0x65451b, 0x674821, 0x714b23, 0x906837, 0x8d6534, 0x7c5124, 0x91602d, 0x9f6c33, 0x99672b, 0xa06d2d, 0xab7837, 0xa27134, 0x9a6732, 0x7b5222, 0x6a4a23, 0x583715, 0x775832, 0x9b8158, 0x4f3517, 0x614425, 0x704d29, 0x7e592f, 0x735227, 0x71512b, 0x654522, 0x533619, 0x462c14, 0x4b3018, 0x533316, 0x634118, 0x6a4721, 0x65401c, 0x68451b, 0x6e4c1c, 0x7d582b, 0x78572b, 0x6e4f27, 0x85663d, 0xa58958, 0x875e2a, 0xa27534, 0xa37633, 0xb38542, 0xbb8941, 0xb6853a, 0xaf7f35, 0xab7b36, 0xac7d38, 0xac7e3b, 0xa1773e, 0x8d6737, 0x835c2b, 0x755523, 0x704c20, 0x795025, 0x724716, 0x694310, 0x663f11, 0x6e461f, 0x724e24, 0x7c5a2f, 0x876239, 0x947245, 0x855f31, 0x7d5326, 0x7d5122, 0x845825, 0x83551e, 0x855721, 0x8a5c2a, 0x835524, 0x86582b, 0x8a5b2d, 0x926532, 0x8e642f, 0x8d6331, 0x83592a, 0x795228, 0x6f4518, 0x956d3d, 0xa6814c, 0x966e3f, 0x946a39, 0x8c602f, 0x8f632c, 0x8b5d2a, 0x8f602e, 0x936532, 0x9b6934, 0xa16f39, 0xa8763d, 0xae7b3c, 0xa77637, 0x976a31, 0x9b6f37, 0x9d7038, 0x9c713d, 0xaa8752, 0x9d713f, 0x9f7337, 0xa3783f, 0x9c7037, 0x9b6f37, 0x94662d, 0x92632d, 0x956533, 0x8d5e2c, 0x8a5a27, 0x93632d, 0xa17037, 0x9e6b2a, 0xb07b33, 0xc79048, 0xba7f37, 0xb0742c, 0xbe863c, 0xbc873f, 0xcf9f4d, 0xe7b95c, 0xdeb158, 0xdfb257, 0xe5b95d, 0xe5ba5c, 0xeabf61, 0xeabe61, 0xe0b059, 0xd9a651, 0xd6a14c, 0xbe863d, 0xd3a459, 0xf2c572, 0xae7e40, 0x956535, 0x774f2c, 0x5b330b, 0xbd8138, 0xe6b35a, 0xf4cd6f, 0xfada83, 0xdeb367, 0xb77134, 0xa2602c, 0x985928, 0x8d562b, 0x6e3f22, 0x60361b, 0x573116, 0x532e18, 0x4f2d1a, 0x4c2b16, 0x51311d, 0x43230d, 0x664631, 0x492c1c, 0x311707, 0x2c1709, 0x281608, 0x261408, 0x241308, 0x211107, 0x1f1107, 0x1f1108, 0x1c0f06, 0x1a0f06, 0x170e04, 0x160d03, 0x150b02, 0x140b02, 0x130a03, 0x130b04, 0x120b04, 0x110a04, 0x0f0903, 0x0d0802, 0x0c0702, 0x0b0602, 0x0b0703, 0x0a0702, 
-  0x120b03, 0x140b04, 0x140b04, 0x140b02, 0x160c03, 0x190d05, 0x1b0e05, 0x1c0f06, 0x1c0f05, 0x1e1107, 0x211207, 0x241208, 0x241308, 0x261409, 0x2a170a, 0x2f1a0b, 0x331c0b, 0x341e0e, 0x310d0a, 0x7d5b3d, 0x876343, 0x3e1500, 0x462611, 0x4a2814, 0x4b2813, 0x4f2912, 0x57311a, 0x5a341d, 0x5c331a, 0x67371b, 0x784623, 0x8b532b, 0x915727, 0xa76630, 0xa26635, 0x592f13, 0x5c3315, 0xe4bc7b, 0xcc9e5a, 0x824f22, 0x7a4a14, 0xdab96e, 0xceb067, 0x653a17, 0x4b3217, 0x412a16, 0x3c1906, 0x7f5a23, 0xe2c586, 0xe1c88d, 0x76582f, 0x5c3e1c, 0x5b4020, 0x4e361b, 0x452f18, 0x382312, 0x251609, 0x100600, 0x2b1603, 0x71502a, 0x956731, 0x9e6623, 0xaa7b3c, 0xf0e0a4, 0xd8c18b, 0x623603, 0x593e1c, 0x613f1c, 0x7c5326, 0x845b2c, 0x7c5024, 0x8c5c29, 0x9c6a31, 0x9f6d34, 0xa57235, 0xaa7737, 0x976a2c, 0x8d632f, 0x694825, 0x4e341d, 0x492406, 0xcca964, 0xe7ca90, 0x553a22, 0x523717, 0x674a24, 0x6f4f2e, 0x604125, 0x63482b, 0xa6855e, 0xa78154, 0xab824d, 0xa37a41, 0xa57f49, 0xb28e58, 0xbd9c62, 0xc2a368, 0xc3a66e, 0xc1a272, 0x755431, 0x644824, 0x381c01, 0x7e6541, 0xf2e3ac, 0xbfa874, 0x8e6531, 0x996f35, 0x99692d, 0xaf813c, 0xba8a3f, 0xb18135, 0xb38338, 0xb28139, 0xa97836, 0x936a38, 0x674726, 0x8a6b4b, 0xb59465, 0xbe9d65, 0xb79d67, 0xb9a26c, 0xbba86f, 0xbea975, 0xbfaa6f, 0xb39a69, 0x614632, 0x8e7049, 0xe4cb8e, 0xe3d193, 0xcfbb85, 0xc2af76, 0xbfaa70, 0xc4af76, 0xc3ad75, 0xc2a972, 0xbca36f, 0xbca46e, 0xbea873, 0xbfa876, 0xbea772, 0xb99f66, 0xb9a068, 0xb6a16b, 0xc3ab70, 0xe7cd82, 0xceb478, 0x4e2501, 0x8d6e46, 0xb19868, 0xbca877, 0xb9a673, 0xb8a675, 0xb9a478, 0xb8a26d, 0xbea670, 0xc1a974, 0xc3af79, 0xc6b17b, 0xc9b579, 0xd5be7f, 0xdac687, 0xe5d38b, 0xebdc95, 0x88683a, 0x8c6031, 0x845b2b, 0xb48f4f, 0xd2af64, 0xd4b772, 0xc7b072, 0xbfac71, 0xc0ae71, 0xbfaa6e, 0xc2ae74, 0xc8b47c, 0xcbba83, 0xd0be85, 0xd4bd7f, 0xcfb475, 0xd2b275, 0xdab36f, 0xd2a654, 0xcc9c47, 0xc9984b, 0xcb994b, 0xdcac5b, 0xe2b25d, 0xe0b258, 0xe5b95c, 0xeabf60, 0xdeac53, 0xcc984b, 0xb6853b, 0xd19c4a, 0xebbc63, 0xaf833f, 0x8e5b31, 0x936437, 0x704925, 0x643d12, 0xca8f40, 0xe1af56, 0xf0ca6a, 0xfddf88, 0xdcb266, 0xb2682b, 0xa25f2b, 0xac6c39, 0xae7343, 0x703911, 0x865837, 0x7c5232, 0x542f16, 0x51301c, 0x4d2b16, 0x442209, 0x412410, 0x422512, 0x391e0f, 0x311b0e, 0x2c180d, 0x291709, 0x271507, 0x251408, 0x221308, 0x201208, 0x1f1208, 0x1d1007, 0x1b0f06, 0x1a0f06, 0x180e04, 0x170d03, 0x150c03, 0x130a03, 0x130a04, 0x120a02, 0x110a02, 0x100a04, 0x0d0802, 0x0c0702, 0x0b0703, 0x0b0803, 0x0a0702, 
-  0x0f0a02, 0x100a02, 0x110c03, 0x120b04, 0x130b05, 0x140b04, 0x160b04, 0x180c05, 0x180e05, 0x1a0f06, 0x1d1007, 0x1e1108, 0x201109, 0x22130a, 0x25160a, 0x281709, 0x2e190b, 0x331a0d, 0x341d0f, 0x3a1c0a, 0x3b1c06, 0x3e220e, 0x402310, 0x412312, 0x432513, 0x452511, 0x512f1a, 0x53301a, 0x562f16, 0x673a1e, 0x865533, 0x7e471d, 0xa0683a, 0xa5652f, 0xa36533, 0x73401f, 0x7f4b21, 0xf0c984, 0xca9f5b, 0x955d2c, 0x83521f, 0xd6b166, 0xd1b367, 0x633613, 0x4a311a, 0x4f3019, 0x53371b, 0x502b0d, 0x7b4d17, 0xe7ce8d, 0xb09661, 0x542c0c, 0x604023, 0x624322, 0x573a1f, 0x4b321b, 0x3d2a15, 0x2c1c0c, 0x1c0b03, 0x3b2009, 0x734e23, 0x9d6b33, 0x9d6323, 0xb08b4d, 0xf9ebad, 0xab9367, 0x572d00, 0x5b3b1a, 0x785128, 0x7b4f24, 0x825628, 0x91632f, 0x91612a, 0x95642d, 0x9a682e, 0xa37135, 0x996a33, 0x7b5528, 0x54381c, 0x371500, 0xa18045, 0xe6c070, 0xe2c58b, 0x6d5531, 0x4e3117, 0x6b4b29, 0x614020, 0x4d341b, 0x362211, 0x3e2815, 0x5e411e, 0xb0844c, 0xd19d58, 0xb98945, 0xb98e4d, 0xc7a05a, 0xe7c37c, 0x967949, 0x82623a, 0x70502a, 0x5b3f1f, 0x3c2515, 0x593a08, 0xd8bf85, 0xf6ecbc, 0xb99f73, 0x8d602b, 0x86622e, 0x966b30, 0xac7c38, 0xb9883d, 0xb6843a, 0xb6853e, 0xa6793c, 0x73522a, 0x3a2615, 0x483524, 0x785b38, 0xc4a165, 0xeac77f, 0xe1be77, 0xdcbb73, 0xe2c57c, 0xc6ae73, 0x716040, 0x2a0f07, 0x96754d, 0xc5a362, 0xc7aa69, 0xcfb379, 0xcab277, 0xc8b178, 0xc7b27b, 0xd5be82, 0xd9bd79, 0xddbf7a, 0xf0d386, 0xf0d689, 0xd7bc7d, 0xd0b579, 0xd0b26f, 0xccaf6d, 0xd7be7b, 0xeed088, 0xe8cf83, 0xd3bd80, 0x2d0000, 0x472f1a, 0x76603e, 0xbba470, 0xf0d68c, 0xf2da8a, 0xf6e093, 0xf6de8e, 0xe6ce86, 0xe3cd8b, 0xe0cc8e, 0xdec789, 0xd7be7c, 0xd7be7b, 0xead38b, 0xfae68a, 0xe4d381, 0x8a6532, 0x906435, 0x664223, 0x583b17, 0x8c6e3a, 0xc9ad67, 0xf9de87, 0xfae08b, 0xfbe390, 0xfde694, 0xe6d08b, 0xe3ce92, 0xe6d39a, 0xe9d69c, 0xead897, 0xf1df9a, 0xfbeba6, 0xfdf4b3, 0xf8efb6, 0xe6d399, 0xcca55d, 0xbb873e, 0xc2914a, 0xd6a456, 0xdbaa54, 0xe4b75b, 0xe9bd61, 0xdaa750, 0xb78244, 0x71400e, 0xd9a755, 0xd09f50, 0x804e21, 0xa1703c, 0x9d6e3c, 0x764d28, 0x6d4418, 0xca913f, 0xe7b65d, 0xf6d272, 0xfcdc83, 0xd4a85b, 0xb4692d, 0xa7622e, 0x975527, 0x864b22, 0x764220, 0x784828, 0x704424, 0x5e3518, 0x583118, 0x5e381f, 0x7b5a43, 0x412309, 0x3b2110, 0x381f10, 0x341c0e, 0x31190b, 0x2b1709, 0x291609, 0x261509, 0x241409, 0x221409, 0x201208, 0x1e1108, 0x1d1007, 0x1c0f07, 0x1a0e05, 0x180d04, 0x160c03, 0x130a02, 0x130a03, 0x130a03, 0x110902, 0x100a03, 0x0e0903, 0x0d0803, 0x0b0703, 0x0a0702, 0x090601, 
-  0x0d0804, 0x100903, 0x110b03, 0x120b05, 0x130c05, 0x130b04, 0x140a04, 0x160b04, 0x160d04, 0x180d05, 0x1b0e05, 0x1e1007, 0x1f1108, 0x201209, 0x221409, 0x261609, 0x29170a, 0x2b180a, 0x2e1b0c, 0x311b0e, 0x351e0f, 0x39200f, 0x3c200f, 0x3d2112, 0x3e2214, 0x3e2313, 0x462815, 0x502f1b, 0x532d15, 0x5f341b, 0x693b1f, 0x73411d, 0x884d21, 0x9e6130, 0x985f33, 0x65381a, 0x603411, 0xb1844c, 0xc4914f, 0x895629, 0x78461a, 0xc4a15c, 0xdabd71, 0x6f411c, 0x4f321a, 0x50331a, 0x694524, 0x44280f, 0x481d00, 0xb18f53, 0xdcc27d, 0x5a340f, 0x5e3e23, 0x674323, 0x5d3f21, 0x543a1e, 0x4c341a, 0x3e2b15, 0x2a1909, 0x1c0e03, 0x492a13, 0x8c5d2c, 0x9c6a2e, 0x945b13, 0xcdb47e, 0xefe1ab, 0x7c562d, 0x5c3917, 0x674920, 0x764c25, 0x704720, 0x855824, 0x9a6b33, 0x98672f, 0x90612c, 0x8c5f29, 0x8b6130, 0x684523, 0x4b2f18, 0x553615, 0xe5c275, 0xc6a159, 0xe1c58e, 0x8c724b, 0x402201, 0x5f3f22, 0x624322, 0x583d20, 0x3e2915, 0x1f1006, 0x050000, 0x4d2505, 0x8b5d30, 0x8e622c, 0x855925, 0xaa7b3b, 0xb68f57, 0x120000, 0x4c2f13, 0x644421, 0x664826, 0x402a16, 0x5a3815, 0xa1702e, 0xdfce9b, 0xf3e6b5, 0xaf8c5d, 0x71501f, 0x916835, 0x9f6e35, 0xb07f38, 0xb3813a, 0xaf7e3b, 0x8e642c, 0x6d4f2a, 0x3e2a16, 0x180802, 0x220000, 0x75471b, 0xa8783b, 0xaa7a38, 0xa97831, 0xc9a35f, 0x563f29, 0x000000, 0x000000, 0x906b43, 0xb28854, 0x6b461f, 0x461b00, 0x250000, 0x0f0000, 0x000000, 0x3d0c00, 0x996d34, 0xad7e38, 0xcd9f4b, 0xe3b961, 0x9c844a, 0x000000, 0x350f00, 0x381200, 0x340c00, 0x6d5334, 0xa88a58, 0xd0b37c, 0x54371a, 0x4e321a, 0x1f0000, 0x693200, 0xbf9045, 0xe1b64f, 0xe7bd54, 0xeecc73, 0x957c47, 0x470000, 0x4c1900, 0x4e1800, 0x440600, 0x471300, 0x633400, 0xb69452, 0xe4c87a, 0x8e6732, 0x8d6031, 0x7c5532, 0x593b22, 0x190000, 0x643a00, 0xdfb662, 0xeec561, 0xe7bc57, 0xf2d57c, 0x735621, 0x441000, 0x502a00, 0x573100, 0x583600, 0x76541b, 0xb08a45, 0xe3bf6f, 0xf4de94, 0xfcf7c5, 0xf7efc5, 0xdcba76, 0xc9964a, 0xb5803d, 0xc18f4d, 0xd4a452, 0xe0b25a, 0xcc9b4b, 0x855622, 0x90632f, 0xe7b65d, 0xae7e3b, 0x8f5a2b, 0xaf7e43, 0xa1703c, 0x7c4f2a, 0x764819, 0xbf8835, 0xe9b95f, 0xf1cc6a, 0xfadc7e, 0xdcaa5f, 0xb66f31, 0xaa6330, 0x98562b, 0x8a4f27, 0x7d4722, 0x713f1e, 0x6a3b1d, 0x63361a, 0x5d321a, 0x5b341c, 0x63422d, 0x452511, 0x402511, 0x3d2210, 0x391f0e, 0x341c0c, 0x301a0c, 0x2c170a, 0x291709, 0x261608, 0x241509, 0x22130a, 0x211209, 0x1f1108, 0x1f1007, 0x1d0e07, 0x1b0e06, 0x180d04, 0x140b03, 0x130a04, 0x130a05, 0x110904, 0x100a04, 0x0e0904, 0x0c0703, 0x0b0602, 0x0a0702, 0x090601, 
-  0x0c0703, 0x0e0803, 0x100903, 0x110a04, 0x130c05, 0x140b04, 0x140a04, 0x150a04, 0x140b02, 0x160d04, 0x1a0d05, 0x1c0e05, 0x1e1007, 0x201209, 0x221309, 0x251409, 0x29170b, 0x2a180b, 0x2c1a0c, 0x301b0d, 0x331d0e, 0x361e0f, 0x381e0f, 0x3a1f11, 0x3b1f11, 0x3c2012, 0x462a18, 0x51321f, 0x4e2b13, 0x573017, 0x60341b, 0x6d3c1d, 0x814823, 0x8c5129, 0x89532c, 0x47240b, 0x2d0400, 0x8d6438, 0xd3a15f, 0x875625, 0x74411d, 0xb08f51, 0xe3c97b, 0x794e1f, 0x54351b, 0x4a3119, 0x7e5833, 0x664423, 0x301203, 0x704b1b, 0xeace80, 0x98804a, 0x4e2a11, 0x694729, 0x614021, 0x674524, 0x573818, 0x453016, 0x382610, 0x1c0f03, 0x250e03, 0x6b4724, 0x996636, 0x906123, 0x906224, 0xeeddae, 0xc8b687, 0x603300, 0x523619, 0x5f3e1c, 0x6e4925, 0x865c2c, 0x9b6e34, 0x93652d, 0x86592b, 0x7c5328, 0x6a4720, 0x51361a, 0x341000, 0xa88752, 0xe7c982, 0x8e5d16, 0xe3c68b, 0xa68d60, 0x3d1c00, 0x583d21, 0x67492a, 0x604325, 0x4e361f, 0x372412, 0x140000, 0x785639, 0x885d34, 0x8e6531, 0x895c26, 0xbe9352, 0xb0905b, 0x462813, 0x543a1d, 0x634525, 0x5c4020, 0x412913, 0x5d3e1c, 0x9e6d36, 0xa47931, 0xe6d3a1, 0xedddb3, 0xa08255, 0x7e5526, 0x8f6332, 0x9a6f37, 0xad7f3e, 0xa37335, 0x8f642b, 0x78552a, 0x593e22, 0x3d2917, 0x321500, 0x9d7043, 0xa57539, 0xa5793a, 0xaf833e, 0xc4a05f, 0x442d1b, 0x352918, 0x1c0702, 0x8b6233, 0x9d754b, 0x3c2215, 0x3f2b19, 0x3f2a1a, 0x3a2517, 0x130300, 0x66472e, 0xb08148, 0xc8984d, 0xca9b44, 0xe1b963, 0x9f8a53, 0x391911, 0x523922, 0x4e3520, 0x311e10, 0x020000, 0x492b13, 0xb79969, 0x68492b, 0x68492e, 0x291105, 0x754d26, 0xaf823d, 0xdfb456, 0xe9bd5d, 0xedce7f, 0x998559, 0x522705, 0x5a381b, 0x5b3b1b, 0x593a1d, 0x442512, 0x260600, 0x4d2805, 0xb7975e, 0x966b3b, 0x986a39, 0x815a2f, 0x6d4e2a, 0x3d2212, 0x845a28, 0xcea051, 0xf5c869, 0xedc463, 0xf5dd8e, 0x86663c, 0x66401b, 0x654123, 0x5c3a20, 0x452511, 0x300700, 0x3d1000, 0x855b2b, 0xdeae5d, 0xf0cd77, 0xf6ebb0, 0xfbf6c2, 0xd6b46e, 0xb58440, 0x9d703a, 0xa8753c, 0xd0a04f, 0xbd8b47, 0x824f21, 0xce9f4f, 0xe8b761, 0x9c6b32, 0xc29050, 0xc28d51, 0xa7743e, 0x794d27, 0x855725, 0xd39b47, 0xf0c060, 0xf0c963, 0xf6d373, 0xd7a155, 0xb97232, 0xae6833, 0x9c592c, 0x905227, 0x864c25, 0x7b4522, 0x713f1f, 0x673a1c, 0x60351c, 0x593218, 0x512d13, 0x4b2a15, 0x452712, 0x412511, 0x3d2211, 0x381e0e, 0x321d0e, 0x301b0d, 0x2d190b, 0x2b1709, 0x281609, 0x26140a, 0x241309, 0x211208, 0x1e1108, 0x1e1007, 0x1c0e06, 0x190d05, 0x150c03, 0x140a02, 0x120903, 0x120a04, 0x100903, 0x0e0903, 0x0c0703, 0x0b0602, 0x0b0803, 0x090601, 
-  0x0b0602, 0x0b0602, 0x0d0803, 0x0f0904, 0x110a04, 0x120b04, 0x130a03, 0x140a03, 0x140b03, 0x160c04, 0x180d04, 0x1b0e06, 0x1d0f07, 0x1f1108, 0x211209, 0x241309, 0x27160a, 0x29170b, 0x2a180b, 0x2d1a0c, 0x2f1b0c, 0x311c0d, 0x341d0e, 0x371e0f, 0x3a1f11, 0x3c2111, 0x3d220f, 0x462915, 0x4c2c16, 0x532f17, 0x5b3318, 0x6a3c1d, 0x7f4c28, 0x925b35, 0x8d562d, 0x764927, 0x542900, 0xcc9f61, 0xe0ac62, 0x895621, 0x7a4921, 0xa8864b, 0xecd182, 0x82582a, 0x4e3016, 0x442d14, 0x795530, 0x966c42, 0x2c1400, 0x310b00, 0xb49255, 0xdbbd79, 0x4f2f06, 0x593b20, 0x5f3e1d, 0x7c552e, 0x694621, 0x4b3416, 0x422e14, 0x27180b, 0x100302, 0x452608, 0x996833, 0x946529, 0x834f0e, 0xb69a6f, 0xf5e6b4, 0x816036, 0x573415, 0x5a3e1d, 0x67441f, 0x774f28, 0x7f5524, 0x8e6330, 0x795024, 0x6c4a22, 0x5a3d20, 0x432c11, 0x522e09, 0xdebe7a, 0xb5975c, 0x7e4200, 0xdbbd82, 0xbaa270, 0x4c2900, 0x53391d, 0x604223, 0x644526, 0x4f341a, 0x432c16, 0x180000, 0xa17d57, 0x9e7346, 0x875e28, 0x97672f, 0xd0a764, 0xaf925f, 0x472b0c, 0x563a1b, 0x563c1f, 0x553c1f, 0x442e15, 0x55391a, 0x986e3e, 0x946628, 0xae7e37, 0xecdeb2, 0xe9dbb3, 0x9a7a55, 0x6f4a1d, 0x78542a, 0x7e5728, 0x996e35, 0x91662f, 0x87602f, 0x684924, 0x4f371d, 0x351800, 0x9c7144, 0xa4763b, 0xa97e3e, 0xb68942, 0xc5a262, 0x583d21, 0x412e18, 0x100000, 0xa07c4f, 0xac8b61, 0x4f2d18, 0x62421f, 0x63472a, 0x5b4226, 0x362312, 0x634420, 0xb0823f, 0xd2a34d, 0xd0a145, 0xdebb69, 0xab9660, 0x6c4728, 0x7f5930, 0x79542f, 0x5d4127, 0x372012, 0x371c03, 0xaa8e5d, 0x6a4a2a, 0x68472f, 0x230e06, 0x7f5c2f, 0xc4974c, 0xe2b65a, 0xe5ba59, 0xe6c877, 0xab9160, 0x81542c, 0x7f562e, 0x80592d, 0x895e33, 0x855b38, 0x573d21, 0x431500, 0xae8852, 0x9b6f3b, 0x9f7137, 0x9a7040, 0x71502a, 0x42260f, 0x8c5e26, 0xd4a350, 0xefc163, 0xeec865, 0xf8e392, 0x997744, 0x8d622c, 0x8d6234, 0x8f6436, 0x805a30, 0x664526, 0x44260d, 0x3a1a00, 0x865c34, 0xe2b166, 0xebc567, 0xf6e097, 0xfaeeae, 0xc89d59, 0xaa753b, 0x8c5d32, 0xa07136, 0x986532, 0xac7a38, 0xecbb5c, 0xb88846, 0x9c6d2f, 0xe4b161, 0xbe8949, 0xb68447, 0x7e522a, 0x905f2a, 0xd39848, 0xf0be5f, 0xf6ce6a, 0xf7d071, 0xca9043, 0xbf7736, 0xb36d34, 0xa05c2d, 0x965428, 0x8a4d24, 0x7f4621, 0x76421f, 0x6b3c1c, 0x64371d, 0x5d351a, 0x563217, 0x502d16, 0x4c2b14, 0x472913, 0x412612, 0x3c2211, 0x35200f, 0x321d0e, 0x311b0d, 0x30190c, 0x2d170a, 0x2a150a, 0x27150a, 0x241409, 0x1f1208, 0x1e1008, 0x1d0f06, 0x1b0e06, 0x170d04, 0x150b03, 0x130a03, 0x130b04, 0x110a03, 0x100a04, 0x0e0804, 0x0b0602, 0x0a0702, 0x090702, 
-  0x0a0702, 0x0b0602, 0x0c0703, 0x0d0803, 0x0e0903, 0x110a04, 0x120a04, 0x130a03, 0x140a04, 0x160b04, 0x170d04, 0x190e06, 0x1c0e07, 0x1e1008, 0x21120a, 0x221108, 0x251309, 0x28160b, 0x2a180c, 0x2a180b, 0x2c190b, 0x2e1a0c, 0x311c0e, 0x351e0f, 0x381f10, 0x3a200f, 0x3c2110, 0x432614, 0x482814, 0x512e18, 0x58331a, 0x5f361b, 0x6d3e1e, 0x7c4720, 0x91572c, 0x804c25, 0x64350d, 0xb5864d, 0xdba35c, 0x945e29, 0x7e4e25, 0x98773e, 0xedd585, 0x8d6635, 0x513318, 0x573b1f, 0x5e3d1d, 0xb88957, 0x724f27, 0x0f0000, 0x562f0c, 0xc49d62, 0xac8554, 0x432200, 0x5a3c1d, 0x6f4c27, 0x6e4c28, 0x533a1b, 0x463117, 0x2f1e0f, 0x000000, 0x8e6d3d, 0xb6884a, 0x8f5d27, 0x895927, 0x895514, 0xebd8aa, 0xc4ae82, 0x501f00, 0x573b20, 0x5e3e1d, 0x644121, 0x7c5529, 0x896030, 0x744f27, 0x604320, 0x4d3519, 0x380b00, 0xa0824d, 0xe2c583, 0x885b25, 0x865114, 0xcdaf77, 0xcdb582, 0x5e350b, 0x5d4023, 0x5f3f20, 0x674726, 0x563b1f, 0x412a13, 0x160000, 0x9e784d, 0xa47640, 0x95672f, 0x8f5d29, 0xcda562, 0xae915e, 0x462c09, 0x52381d, 0x543e24, 0x4d371d, 0x4a321c, 0x493218, 0x967143, 0x976933, 0xa97731, 0xb98f4b, 0xf1e4ba, 0xe5d6ab, 0x8e7042, 0x5e3a13, 0x664421, 0x7b5628, 0x8e6632, 0x855e2a, 0x684821, 0x50381e, 0x341903, 0x956b41, 0x9f7339, 0xac8040, 0xbf9249, 0xccaa6d, 0x664824, 0x573c22, 0x1f0400, 0x8f6d48, 0x886946, 0x72502d, 0x6f4d25, 0x6d4d2c, 0x6c4c2c, 0x422a1b, 0x6a4a26, 0xa7793d, 0xcf9f47, 0xc29236, 0xe1c276, 0xb6a26d, 0x734c25, 0x90693d, 0x906a3e, 0x6a4d2e, 0x4b3520, 0x3e2207, 0x967b52, 0x67492e, 0x684930, 0x250f08, 0x775328, 0xb78b42, 0xe2b65d, 0xebc262, 0xe8c775, 0xac8e5c, 0x88592e, 0x7f552d, 0x82592e, 0x946a36, 0x9b713a, 0x856035, 0x4f2a0a, 0xa68251, 0x9a6e3e, 0xa4763a, 0x966a39, 0x7b5531, 0x4a2c14, 0x97682d, 0xd7a751, 0xf6cd6c, 0xf0cb70, 0xf7de8f, 0x9b7441, 0x97683a, 0x9b6d3c, 0xa5743f, 0xa0723d, 0x885e35, 0x694425, 0x452207, 0x491e00, 0xa37940, 0xecbf6a, 0xeac364, 0xf6e79e, 0xebd491, 0xad7936, 0x906436, 0x8c5f2f, 0x825021, 0xc28e41, 0xc79549, 0x794719, 0xb7833e, 0xbe8b40, 0xab783c, 0xb7864a, 0x7f5025, 0x9a662c, 0xcc8e42, 0xe4b254, 0xedc665, 0xf7cf74, 0xc5893d, 0xc67d3b, 0xb76f35, 0xa45f2d, 0x975528, 0x8c4e24, 0x824823, 0x78421f, 0x6c3c1c, 0x65381e, 0x5f351a, 0x573117, 0x512d16, 0x4d2a10, 0x4a2a13, 0x462915, 0x3f2412, 0x3a2111, 0x361f0f, 0x341d0e, 0x331c0e, 0x301a0c, 0x2c180a, 0x291609, 0x27150a, 0x23130a, 0x211109, 0x1f1007, 0x1b0f06, 0x180d04, 0x160c03, 0x140903, 0x140a03, 0x120a03, 0x100902, 0x0e0804, 0x0b0703, 0x0a0702, 0x0a0702, 
-  0x0a0702, 0x0a0602, 0x0b0703, 0x0c0704, 0x0e0803, 0x110a04, 0x110a04, 0x130a04, 0x140a03, 0x150b04, 0x160c04, 0x180e05, 0x1a0e06, 0x1d0e07, 0x1f1007, 0x2d1c11, 0x2d1a0f, 0x25130a, 0x27160c, 0x29170b, 0x2a180b, 0x2c190c, 0x2f1b0d, 0x331d0f, 0x381f10, 0x3f2515, 0x452917, 0x412210, 0x452513, 0x4c2a16, 0x532f19, 0x5a331d, 0x65391d, 0x774320, 0x8e542b, 0x71401e, 0x4b2913, 0x592c0c, 0xb98043, 0xa16934, 0x794823, 0x896531, 0xf1da85, 0xa68248, 0x523112, 0x593b1f, 0x4c2f10, 0x896135, 0xc1935c, 0x3b2006, 0x2a1a07, 0x633b15, 0xbd915c, 0xac8b57, 0x53340d, 0x583a19, 0x5d3e1c, 0x573b20, 0x4b341b, 0x311f0d, 0x000000, 0xb99253, 0xac8144, 0x926031, 0x96652c, 0x895010, 0xb99e6f, 0xf4e4b3, 0x7c5d30, 0x4c2f18, 0x472d15, 0x573c1a, 0x745125, 0x724b20, 0x5f3d1d, 0x4c3116, 0x432b0e, 0x592d00, 0xdcbf77, 0xb49258, 0x8b5b27, 0x86551c, 0xbe9b65, 0xd8c089, 0x5b3105, 0x5f4124, 0x5d3d1e, 0x5d3e1e, 0x62452a, 0x442d18, 0x0a0000, 0x9f794b, 0xaa7a42, 0x9c6c32, 0x8a5924, 0xcfa65f, 0xae905c, 0x4f3314, 0x4e361c, 0x4a341a, 0x4a341d, 0x442d1b, 0x462f16, 0x9a6f3f, 0x9a6d35, 0xa77a3b, 0xb47f2e, 0xbc9354, 0xf0e3b1, 0xe1cf9a, 0x86663d, 0x5e3d1c, 0x6c4923, 0x825d2f, 0x815b2b, 0x6e4d25, 0x4f381e, 0x321703, 0x936d42, 0x9c7037, 0xae7f3d, 0xc89b52, 0xd1b173, 0x6e4c24, 0x5f4324, 0x4a331f, 0x382111, 0x533920, 0x815c33, 0x845a2f, 0x825931, 0x765429, 0x432a13, 0x72512c, 0xa87c40, 0xce9d47, 0xc6953b, 0xe2c47c, 0xb9a673, 0x754b1f, 0x90693a, 0x9c7342, 0x805b31, 0x6d4d2d, 0x53371e, 0x42230d, 0x63452e, 0x614429, 0x230803, 0x835f35, 0xb58747, 0xc7994d, 0xe0b85d, 0xe9ca76, 0xaa8f5b, 0x895d30, 0x835a30, 0x845a2f, 0xa0703a, 0xa5763b, 0x9d693b, 0x7c522d, 0x755028, 0x9c6f41, 0xa5763f, 0x946737, 0x875e35, 0x52321a, 0x93662d, 0xd2a34e, 0xf3cc6a, 0xecc567, 0xf1d37c, 0x9e753d, 0x8a5c30, 0x966a34, 0xb08044, 0xc0904e, 0xa97b3f, 0x896134, 0x624122, 0x3d1b00, 0x71471a, 0xe1b367, 0xf0c664, 0xe8c468, 0xfceea5, 0xb9985b, 0x9b6635, 0x966430, 0xa77238, 0xc28c45, 0x7f4d20, 0x855623, 0xca934c, 0xa47036, 0xae7d46, 0xa3723e, 0x845023, 0xb47937, 0xd39647, 0xefbe5f, 0xf3cd6c, 0xf2c870, 0xc7883e, 0xc97e3c, 0xbb7035, 0xab6331, 0x9b592b, 0x8f5027, 0x854a25, 0x794220, 0x6e3c1c, 0x66371c, 0x5f3418, 0x583117, 0x542e15, 0x744e34, 0x54321b, 0x452712, 0x412512, 0x3d2313, 0x3a2010, 0x361d0d, 0x331d0e, 0x311b0e, 0x2b180a, 0x2a170b, 0x29160b, 0x27140a, 0x24120a, 0x201109, 0x1d1007, 0x1a0e05, 0x180d04, 0x150b03, 0x140a03, 0x130b04, 0x110a03, 0x0f0904, 0x0c0703, 0x0b0802, 0x0a0803, 
-  0x090702, 0x0a0702, 0x0b0602, 0x0c0703, 0x0d0704, 0x100804, 0x100a03, 0x120a04, 0x140b04, 0x140b04, 0x150c05, 0x170d04, 0x1a0e06, 0x1d0f07, 0x1c0b02, 0x38271c, 0x352318, 0x231108, 0x26150c, 0x28170d, 0x2c1a0e, 0x2a180b, 0x2d1a0c, 0x311c0e, 0x361d0f, 0x3b2112, 0x422515, 0x442512, 0x412413, 0x452714, 0x502e17, 0x59331c, 0x61371b, 0x73421f, 0x8a5229, 0x854d28, 0x573313, 0x683f1b, 0xcf954f, 0xa76d36, 0x87562f, 0x805423, 0xedd57e, 0xb39051, 0x593212, 0x523821, 0x54391d, 0x250000, 0xb38a55, 0xa37e4f, 0x000000, 0x3c2210, 0x623c10, 0xc1995c, 0xc5a067, 0x73562f, 0x593c1f, 0x563b1f, 0x50361c, 0x301f0e, 0x0b0000, 0xc89e5c, 0x986f38, 0x966734, 0xa36f34, 0x93612a, 0x906129, 0xeddca9, 0xc9b482, 0x512500, 0x3b250f, 0x523919, 0x6c4925, 0x684421, 0x54371c, 0x432c13, 0x3c1400, 0xb08a53, 0xddbc78, 0x865720, 0x9d6e37, 0x8c5d28, 0xac8650, 0xe1cb91, 0x613f1d, 0x55381d, 0x5c4123, 0x583d20, 0x563b23, 0x422817, 0x180000, 0x9b7448, 0xa3743e, 0x92652b, 0x8b5b24, 0xd1a55b, 0xb09059, 0x583618, 0x4e361b, 0x4a3217, 0x4f3821, 0x382513, 0x462d15, 0xa07240, 0x9f7137, 0xa07335, 0xb07d39, 0xb27c32, 0xb9904c, 0xf1e2ac, 0xe1ce99, 0x825f33, 0x6d492a, 0x654522, 0x6a4b24, 0x694925, 0x4b351a, 0x2a0c00, 0x9a7648, 0xa2773e, 0xad7d3b, 0xc89e58, 0xd8bc7e, 0x704c24, 0x604423, 0x684929, 0x6f502c, 0x77542d, 0x8f6836, 0x936837, 0x885c32, 0x74532a, 0x402b15, 0x75512c, 0xa3763b, 0xcd9c48, 0xd0a046, 0xe6c87f, 0xb8a674, 0x704819, 0x815c30, 0xa77e48, 0xa1773e, 0x926839, 0x90673a, 0x7e5933, 0x724e30, 0x5b3f28, 0x210905, 0x856131, 0xba8b48, 0xd0a055, 0xe5bb5f, 0xeaca74, 0xac915d, 0x84582d, 0x895f32, 0x8f6536, 0xa06e38, 0x9b6d37, 0x966331, 0x946536, 0x906436, 0xa5773e, 0xad7c42, 0x976938, 0x8d6336, 0x5a381f, 0x82561e, 0xce9c4d, 0xf3c96a, 0xeabe5b, 0xefc970, 0xa0733a, 0x8a5c2f, 0x996a34, 0xa87639, 0xc5924d, 0xbc8845, 0x946735, 0x714d2c, 0x3b2008, 0x4a2100, 0xb88d4c, 0xf1c467, 0xe6b857, 0xf7e08e, 0xdec681, 0x9c662c, 0x9f6a34, 0xa46f36, 0x90602c, 0x76441e, 0xbf8d4b, 0xc3914b, 0xa57039, 0xb38047, 0x8d5e2c, 0x7f4c1f, 0xc5873c, 0xd89d46, 0xebbb5b, 0xf9d575, 0xeabe68, 0xc8853c, 0xcb803d, 0xbf7336, 0xb06632, 0xa05c2a, 0x935327, 0x894c26, 0x7d4421, 0x713e1d, 0x69391d, 0x613519, 0x593217, 0x572f15, 0x6a4328, 0x532f17, 0x462612, 0x492b19, 0x442715, 0x3b200e, 0x371d0d, 0x361d0e, 0x3f210f, 0x4e2b15, 0x341a09, 0x29150b, 0x27140c, 0x24120b, 0x201108, 0x1e1007, 0x1b0e06, 0x190d05, 0x160c03, 0x140a02, 0x130a04, 0x120a04, 0x0f0a04, 0x0d0902, 0x0c0802, 0x0a0802, 
-  0x090702, 0x090702, 0x0a0601, 0x0b0603, 0x0c0703, 0x0d0703, 0x100903, 0x110a04, 0x120a04, 0x130a03, 0x140b04, 0x160d05, 0x180e05, 0x1a0f06, 0x1c0f07, 0x1c0d04, 0x1e0f06, 0x23120a, 0x24130b, 0x25140b, 0x27150b, 0x29170b, 0x2b180b, 0x2f1a0c, 0x341d0f, 0x381e10, 0x3c1f13, 0x3f220f, 0x3f240f, 0x432815, 0x4b2a16, 0x56321b, 0x62391e, 0x724020, 0x874c26, 0x8d5329, 0x70451f, 0x77491f, 0xd69c57, 0xa46c33, 0x89582f, 0x7f4f1c, 0xe6cb75, 0xcead65, 0x684017, 0x482e17, 0x533720, 0x301c12, 0x593912, 0xc79e66, 0x765936, 0x150000, 0x3c230c, 0x5f3808, 0xba9058, 0xaa8859, 0x46290d, 0x55391e, 0x4d331b, 0x301f0f, 0x301300, 0xd0a661, 0x8d632f, 0x85582a, 0x9b6932, 0x97652e, 0x845316, 0xba9e6a, 0xf5e5ad, 0x826037, 0x412607, 0x4f321b, 0x5d3d1e, 0x5d3e1d, 0x4b3116, 0x412512, 0x633b12, 0xe3c174, 0xab834b, 0x7f511f, 0xa4753b, 0x986830, 0x9b773e, 0xebd69d, 0x7b5c38, 0x5a3919, 0x5d3e1f, 0x5c3f22, 0x523921, 0x3f2613, 0x1e0500, 0x946f44, 0x9f733f, 0x926830, 0x8a5d25, 0xdfb56a, 0xb1935d, 0x573513, 0x594021, 0x52381c, 0x4c351d, 0x3b2916, 0x452c14, 0x956636, 0x9d7038, 0x9f723a, 0x986930, 0x926836, 0x9a6728, 0xc39551, 0xf4e8b3, 0xd6c397, 0x7d572f, 0x664627, 0x52381c, 0x5a4025, 0x48311a, 0x2e0d00, 0x9e7748, 0x9e7238, 0xad7d3c, 0xb78d4b, 0xd3ba81, 0x623f1b, 0x684b29, 0x77532a, 0x946b34, 0xa2763c, 0xa07338, 0x9a6e38, 0x81582e, 0x6d4e29, 0x35200e, 0x79562e, 0xa97c3f, 0xc79747, 0xcd9d44, 0xe8c97f, 0xb8a673, 0x724b1e, 0x795529, 0xa77b3f, 0xc1904b, 0xb38241, 0xae7b3e, 0x9e713f, 0x79512d, 0x62442a, 0x291108, 0x8d6836, 0xb5853e, 0xd1a14f, 0xe1b454, 0xe7c36c, 0xaa8c58, 0x84572c, 0x896033, 0x976b3c, 0x986a39, 0x79542a, 0x9f7f50, 0xb5905e, 0x946432, 0xb07f42, 0xb98946, 0x996b35, 0x855b31, 0x593920, 0x895f2a, 0xbe883c, 0xe3b459, 0xecbf5b, 0xf3d073, 0xa77a3e, 0x936131, 0xb8854b, 0xbf8e4a, 0xc39048, 0xce9852, 0xad7c41, 0x7c552c, 0x462d16, 0x3b1e05, 0x8a6029, 0xe6ba61, 0xebbd5e, 0xeeca73, 0xf2dd8f, 0xa27337, 0xa9733b, 0x784819, 0x6c3c1a, 0xa57635, 0xd39d53, 0x9d6b30, 0xb37c44, 0xb37d46, 0x85572c, 0x7a4b1f, 0xcc8e3e, 0xdfa447, 0xefc261, 0xfcdd82, 0xeabd6a, 0xcf8c42, 0xd18740, 0xc47937, 0xb66c32, 0xa8622b, 0x9a5728, 0x8e4f27, 0x814620, 0x75401c, 0x6d3c1f, 0x64381c, 0x5c351a, 0x56311a, 0x4e2b13, 0x4a2a15, 0x472714, 0x452512, 0x44240f, 0x3d2110, 0x361f10, 0x341c0d, 0x532e16, 0x95684a, 0x462814, 0x281509, 0x27160c, 0x25130a, 0x201108, 0x1e1007, 0x1b0e05, 0x190d04, 0x170d03, 0x150b02, 0x140b04, 0x120b04, 0x100a03, 0x0e0803, 0x0c0801, 0x0b0803, 
-  0x090702, 0x0a0702, 0x0a0602, 0x0b0602, 0x0c0703, 0x0c0803, 0x0f0903, 0x0f0903, 0x110a04, 0x130b05, 0x140b04, 0x150d06, 0x160d05, 0x170d04, 0x1a0f07, 0x1b0f07, 0x1e1009, 0x23120a, 0x23120a, 0x25140c, 0x27140c, 0x28160d, 0x2a180c, 0x2b1709, 0x432d20, 0x432b1d, 0x381f0d, 0x3e230e, 0x3e2411, 0x422415, 0x482511, 0x54311a, 0x60371d, 0x734222, 0x864c27, 0x875029, 0x5c3218, 0x532d10, 0x9c6b39, 0x9d6835, 0x875427, 0x85501f, 0xe1c171, 0xdfc277, 0x774d1c, 0x4c341b, 0x4d321a, 0x4b361e, 0x331504, 0x7f5b2e, 0xc19562, 0x6f4e30, 0x260a00, 0x2b1602, 0x4e2b0b, 0x63421f, 0x503617, 0x593823, 0x50361f, 0x291809, 0x4d2f0a, 0xd1a55e, 0x865a27, 0x704823, 0x80562b, 0x91622d, 0x8c6130, 0x8a5a15, 0xeddba4, 0xc5ae7e, 0x491e00, 0x4e331e, 0x54381c, 0x53381b, 0x4b3016, 0x3f0a00, 0xb8955a, 0xd9bc74, 0x7e4c12, 0x8c6130, 0x956a32, 0x9b6a35, 0x976d2f, 0xf1da9e, 0x967d52, 0x5f3812, 0x6d4b29, 0x664525, 0x583b20, 0x4a301a, 0x230e00, 0x957347, 0x9a703c, 0x8d612a, 0x82551b, 0xd6ae66, 0xb29561, 0x53310f, 0x584022, 0x5b4024, 0x4e371f, 0x3a2814, 0x492e14, 0x906435, 0x916831, 0x936a34, 0x916b38, 0x896c46, 0x523419, 0x99671d, 0xc5a067, 0xf9edbb, 0xc4b080, 0x69451a, 0x583b1e, 0x553c21, 0x493019, 0x331200, 0xa17a49, 0x9f7338, 0xa97939, 0xbc9351, 0xd3bb82, 0x593715, 0x5f4120, 0x815a2f, 0xa6753b, 0xae7d3b, 0xa67436, 0xa67842, 0x855d31, 0x624524, 0x372314, 0x7a562b, 0xa97b3e, 0xcd9f4f, 0xc99940, 0xe3c377, 0xb6a26e, 0x6e461c, 0x7d572f, 0xae8043, 0xbf8b41, 0xc69149, 0xb48341, 0x9b713f, 0x7f5832, 0x654327, 0x301403, 0x8d6737, 0xbc8d47, 0xdbac54, 0xe1b350, 0xe5be6b, 0xa98a5a, 0x794c27, 0x80562f, 0x875c31, 0x896335, 0x2a0000, 0xb29d67, 0xc1a66b, 0x95632e, 0xac7a3e, 0xbb8a47, 0x9f7339, 0x855d34, 0x52341b, 0x8b6330, 0xc69246, 0xe2b157, 0xe9bd5b, 0xf6d77d, 0xa57e44, 0x845529, 0xa47239, 0xc39149, 0xd09e50, 0xcb9548, 0xb38040, 0x886033, 0x50371e, 0x2f1000, 0x7b4f1d, 0xdeb15d, 0xe9bb5e, 0xedc266, 0xf8e08b, 0xac8244, 0xab6f38, 0x955f2b, 0x986a2b, 0xe4b45d, 0xb6843e, 0xa7723a, 0xb87f45, 0xa66e39, 0x784c27, 0x76451a, 0xca893a, 0xdea64a, 0xf3c96b, 0xffe088, 0xe1b25e, 0xd59244, 0xd89044, 0xcc833b, 0xc17535, 0xb76f33, 0xa9622d, 0x9a5627, 0x96562a, 0x8d5128, 0x763f1e, 0x6b3d1d, 0x63381b, 0x5c331a, 0x532f17, 0x4d2c16, 0x492815, 0x452411, 0x422513, 0x3d2212, 0x371d0f, 0x361c0f, 0x3d1f0d, 0x492812, 0x331b0b, 0x2b180c, 0x291608, 0x261409, 0x211208, 0x1e1008, 0x1c0e07, 0x1a0d05, 0x160c03, 0x160c03, 0x140b03, 0x120b03, 0x110a04, 0x0f0903, 0x0d0802, 0x0b0803, 
-  0x090702, 0x0a0702, 0x0b0602, 0x0a0602, 0x0b0603, 0x0d0803, 0x0d0802, 0x0e0903, 0x100903, 0x120b05, 0x130b04, 0x150b04, 0x150c05, 0x160c05, 0x190e05, 0x1c0f06, 0x1e1007, 0x211008, 0x23120a, 0x24130b, 0x26130c, 0x27150c, 0x29180d, 0x2c190b, 0x321c0e, 0x351e0f, 0x361f11, 0x3b2012, 0x3d2011, 0x543620, 0x77573c, 0x522d13, 0x5f371b, 0x714120, 0x834c25, 0x865028, 0x4f2a14, 0x391c0a, 0x673911, 0x9c6430, 0x966030, 0x814816, 0xcda961, 0xe9ce83, 0x7a4d1d, 0x452d18, 0x462c17, 0x5c401f, 0x5d3c23, 0x553013, 0x855a30, 0xc49962, 0x916f43, 0x44280e, 0x321d07, 0x50371d, 0x54381b, 0x583b1e, 0x4c3319, 0x261406, 0x68491f, 0xcea25a, 0x8a5b2a, 0x603f21, 0x553617, 0x865c2c, 0x835726, 0x7f5018, 0xb79864, 0xefdda9, 0x67472b, 0x442c0c, 0x4c3217, 0x4a3018, 0x472a11, 0x6b471b, 0xe7c77e, 0x9e7944, 0x7f5732, 0x734f28, 0x916530, 0x916130, 0x9b6a27, 0xead092, 0xaf9969, 0x563006, 0x604223, 0x57391d, 0x50351c, 0x49301a, 0x230e00, 0x8c693e, 0x9a6e38, 0x986930, 0x8e5e24, 0xcca35e, 0xae905f, 0x4e2d0f, 0x50391e, 0x52391f, 0x49341b, 0x392611, 0x4e3016, 0x936638, 0x906530, 0x926630, 0x9e7441, 0x90714a, 0x000000, 0x694725, 0xa8732c, 0xcdaa6b, 0xf5e8b1, 0xaf9a72, 0x543006, 0x4b351b, 0x452f1b, 0x391904, 0x9d7544, 0x9e7237, 0xa77637, 0xbb914d, 0xd4bc81, 0x59391b, 0x5b3e1f, 0x7b532a, 0x9c6d35, 0xb3813b, 0xad7b38, 0xa4743a, 0x835c2c, 0x5e4223, 0x2d190d, 0x7b572b, 0xac7e40, 0xcc9f4c, 0xd6a74b, 0xe4c273, 0xb19d68, 0x724b1f, 0x7f582c, 0xb68747, 0xc99649, 0xbb873b, 0xc08b43, 0x92642b, 0x855d35, 0x664527, 0x321805, 0x8d6739, 0xab7d3c, 0xcda047, 0xdbaf4b, 0xe7c26d, 0xa18555, 0x69360a, 0x754721, 0x84532a, 0x6c4019, 0x603b0d, 0xd9bf7d, 0xb59d66, 0x9b6a33, 0xa37139, 0xab7b3f, 0x986e37, 0x7c562e, 0x503219, 0x7e5826, 0xc08f45, 0xe3b55b, 0xe4b857, 0xf3d57c, 0x9e783f, 0x8f6236, 0xa5723d, 0xbe8a47, 0xcb994b, 0xca9648, 0xaa783e, 0x835a32, 0x573a20, 0x3a1702, 0x7d4e1b, 0xd9aa59, 0xe8ba60, 0xeec564, 0xf9dc86, 0xbd9354, 0x96622e, 0x7f4d21, 0xc1924b, 0xf5c471, 0xad7a3a, 0xb87c40, 0xb77c3f, 0xa36e3b, 0x724624, 0x834f1e, 0xd2913d, 0xe5b354, 0xf3ca67, 0xfcd778, 0xe3b157, 0xe09d4a, 0xdc9545, 0xd1873c, 0xc97d38, 0xbe7333, 0xb46a30, 0xaf6630, 0xa55d2b, 0x9c5728, 0x864922, 0x794521, 0x6f3f1e, 0x68391b, 0x5e3418, 0x563018, 0x4f2c17, 0x482714, 0x452715, 0x42200b, 0x512f1d, 0x472919, 0x351c0e, 0x31190c, 0x321a0c, 0x2f180b, 0x28150a, 0x26150a, 0x221308, 0x1f1108, 0x1d0f08, 0x1a0e06, 0x180d03, 0x160d03, 0x140b03, 0x130b04, 0x120b04, 0x100903, 0x0d0802, 0x0b0803, 
-  0x080601, 0x0a0702, 0x0a0702, 0x0a0602, 0x0a0602, 0x0d0804, 0x0d0802, 0x0e0903, 0x100903, 0x110a04, 0x130b06, 0x140b06, 0x150b06, 0x150b04, 0x170d04, 0x1a0f06, 0x1c0f07, 0x1e0f08, 0x21110a, 0x24120b, 0x26130c, 0x26140b, 0x28160c, 0x2b190c, 0x2e1a0c, 0x331c0f, 0x361e11, 0x3b2113, 0x3e2110, 0x4c2d18, 0x604027, 0x552f15, 0x60371c, 0x6c3e1e, 0x7a4521, 0x89532a, 0x76492a, 0x562e13, 0x946434, 0xc68b4d, 0xa0632f, 0x8d5623, 0xbb8e4b, 0xf0d17e, 0x845b2a, 0x4b2e19, 0x452d18, 0x5c3e1e, 0x5d3d21, 0x472b14, 0x51320d, 0x91622d, 0xb48551, 0x593b19, 0x442b15, 0x50361a, 0x56381f, 0x5d3f1f, 0x51371d, 0x210200, 0x876736, 0xc8a05d, 0x9e6f39, 0x685031, 0x2a0d01, 0x835c32, 0x906430, 0x8c612e, 0x87570f, 0xe8d4a4, 0xb9a57f, 0x3c0d00, 0x452d14, 0x482b16, 0x300600, 0xb89757, 0xd2b46d, 0x8c5c2d, 0x6a5132, 0x5a3d24, 0x865a2c, 0x926631, 0x996420, 0xddc285, 0xc2b07c, 0x63390e, 0x664827, 0x593c20, 0x4c321a, 0x3f2912, 0x1f0600, 0x89673d, 0x936835, 0x986b33, 0x946428, 0xcaa15f, 0xab8f60, 0x4f2c11, 0x533a22, 0x4d371f, 0x49331b, 0x3e2817, 0x4b2f15, 0x8f6537, 0x845926, 0x8a5e2e, 0xac8247, 0xa38153, 0x000000, 0x30170b, 0x704c23, 0xa16d27, 0xcbac72, 0xf6e4b0, 0xa89164, 0x4d2c0b, 0x48311c, 0x3b1a03, 0xa07949, 0xa1723b, 0xad7c3e, 0xb88f4c, 0xd3bb81, 0x664422, 0x5d3f1d, 0x7b542b, 0x9c6f37, 0xb1803c, 0xb88640, 0xaf7e41, 0x825a2b, 0x634424, 0x2e1c0d, 0x7f592b, 0xa97b3d, 0xc89b4b, 0xca9c40, 0xe9c878, 0xb19c68, 0x774d1f, 0x886031, 0xa97b3d, 0xce9b50, 0xc79444, 0xc38f41, 0xb88644, 0x8e6333, 0x644424, 0x2c1200, 0x8c683b, 0xb0823f, 0xce9f48, 0xdaab4a, 0xebc971, 0xd4bf7c, 0xbaa46d, 0xc0a66c, 0xc7ae71, 0xceba7d, 0xdebc6d, 0xecd27f, 0xab9562, 0x905e2d, 0xad7c42, 0xab7a3f, 0x8d6230, 0x79522c, 0x51331c, 0x7e5526, 0xb98a40, 0xd9a952, 0xe4bb5e, 0xf6dd86, 0xa27d44, 0x966635, 0xab7a3d, 0xc2904b, 0xc59048, 0xcc984c, 0xa57539, 0x815730, 0x614224, 0x3a1b02, 0x8c5921, 0xd5a657, 0xecbf64, 0xe4ba5b, 0xf6d377, 0xc49b57, 0x8e582a, 0x6e4923, 0x8c5d27, 0xe3b261, 0xae7c3d, 0xa36b37, 0xa96d36, 0xa4713b, 0x714421, 0x9d662b, 0xda9b48, 0xe9b654, 0xeec85f, 0xfad373, 0xe1ac54, 0xe1a049, 0xe29f49, 0xde9848, 0xcb7e36, 0xc17536, 0xb66c33, 0xb86d36, 0xb2642c, 0xbd7138, 0x9e5827, 0x894b23, 0x7e4622, 0x75411e, 0x6a3b1b, 0x613619, 0x563018, 0x502d17, 0x4d2a13, 0x47240c, 0x52311d, 0x492b19, 0x371c0c, 0x351c0f, 0x321a0c, 0x2f190b, 0x2a1509, 0x26150a, 0x231309, 0x1f1108, 0x1d1007, 0x1a0e05, 0x180d03, 0x170d03, 0x150c03, 0x140b03, 0x110b03, 0x0f0a03, 0x0d0802, 0x0c0803, 
-  0x090601, 0x0a0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0d0803, 0x0e0903, 0x100903, 0x110a04, 0x130b06, 0x140a06, 0x140a06, 0x150b04, 0x160d04, 0x180e05, 0x1c0f08, 0x1e0f08, 0x20110a, 0x23120a, 0x26120c, 0x26140b, 0x29170c, 0x2c1a0e, 0x2d1a0c, 0x331c0f, 0x371f11, 0x3c2212, 0x422613, 0x492913, 0x4d2a14, 0x553119, 0x5e361b, 0x6b3c1e, 0x77421f, 0x875129, 0x6f4322, 0x522f15, 0x7d522a, 0xba824a, 0xa16630, 0x97602d, 0xa37333, 0xf3d682, 0x9e7a44, 0x533018, 0x4b331a, 0x6c4926, 0x6f4a2b, 0x452c12, 0x5b3918, 0x9a6936, 0x875b2d, 0x3e230a, 0x472e19, 0x4b3318, 0x4c3119, 0x583c1f, 0x4b331b, 0x170000, 0xa28049, 0xc19a58, 0xb38249, 0x5b4629, 0x000000, 0x523417, 0x896135, 0x8b6130, 0x8a5a28, 0xb29564, 0xeddea7, 0x6d4e2a, 0x462608, 0x3e240b, 0x6c4922, 0xe2bf79, 0x97753f, 0x8e6641, 0x332314, 0x412716, 0x7d5126, 0x93672f, 0x986323, 0xd1b278, 0xd6c595, 0x5e3100, 0x5e4123, 0x573c20, 0x4a3219, 0x3c2a13, 0x180000, 0x8b6b44, 0x8e6739, 0x865d29, 0x89581d, 0xcca363, 0xad9363, 0x502d0f, 0x52391f, 0x4a351a, 0x463017, 0x3f2a19, 0x452b15, 0x8b6238, 0x875e2d, 0x8c602f, 0xae8444, 0xab8753, 0x180000, 0x190a02, 0x311b0c, 0x724b26, 0xa16924, 0xd6b980, 0xf4e5b5, 0x9e855d, 0x3c1f00, 0x381b05, 0x9a7444, 0x966932, 0xaa7b3d, 0xbe9754, 0xd5bd84, 0x6f4a25, 0x6a4924, 0x865c30, 0x9b6c32, 0xaf7c3a, 0xb98641, 0xaa793c, 0x895e2e, 0x735130, 0x3a2818, 0x805a2c, 0xa87c3d, 0xc19345, 0xc19339, 0xe8c97c, 0xb49f6b, 0x73481b, 0x8e6739, 0xa27438, 0xbc8940, 0xcb9849, 0xbf8c40, 0xbf8c47, 0x936732, 0x664626, 0x2f1506, 0x8b683b, 0xaf823e, 0xce9f49, 0xdfb050, 0xd7b055, 0xe2cb7c, 0xddc980, 0xe2cd83, 0xe3cd85, 0xe6d289, 0xe4c270, 0xe7c979, 0xa98d5a, 0x976330, 0xa9763b, 0xa47336, 0x916534, 0x754f28, 0x482b11, 0x936937, 0xc49647, 0xe2b457, 0xe2b75c, 0xf5da8a, 0x9f7b48, 0x926336, 0xa6753d, 0xc18e50, 0xb68142, 0xc08c43, 0xbb8946, 0x936737, 0x6b4b2b, 0x3b1b04, 0x9b662c, 0xd4a353, 0xedbf64, 0xe0b557, 0xf5d172, 0xc59c56, 0x915b2e, 0x704b26, 0x805427, 0xc79449, 0xb88547, 0x945f2f, 0xa76e3c, 0x976633, 0x734420, 0xac722c, 0xd99c45, 0xf0bf5e, 0xefc761, 0xf3c669, 0xd99e4b, 0xdf9b48, 0xe19d4b, 0xdf9a4f, 0xc17531, 0xb76d31, 0xaa622d, 0xa45e2b, 0xa65e2b, 0xad6631, 0x9d5829, 0x8f4f28, 0x894b27, 0x834924, 0x7a4421, 0x703e1d, 0x66381b, 0x5e3318, 0x573017, 0x512d15, 0x492811, 0x432411, 0x3f2211, 0x3b200e, 0x371d0d, 0x311a0c, 0x2e180b, 0x29160a, 0x251409, 0x221209, 0x1f1108, 0x1c0f06, 0x190d04, 0x160c03, 0x150c04, 0x140b04, 0x120a03, 0x0f0a03, 0x0d0802, 0x0b0702, 
-  0x090601, 0x0a0501, 0x0a0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0d0802, 0x0d0802, 0x100903, 0x110a04, 0x130b05, 0x140b06, 0x140a06, 0x160c05, 0x160d04, 0x170d04, 0x1c0f07, 0x1d0e07, 0x1f1008, 0x221109, 0x24110b, 0x27140b, 0x28160a, 0x2a180b, 0x2e1c0e, 0x321c0e, 0x351e10, 0x3b2110, 0x4d301e, 0x51301b, 0x4f2c15, 0x543018, 0x5d351b, 0x6d3e1f, 0x86512e, 0x8a532d, 0x6e3f21, 0x3b1e08, 0x3f1400, 0x8f5b2c, 0x9e672f, 0x945c29, 0x8f5b21, 0xeacd7c, 0xba9c5e, 0x471f00, 0x452f18, 0x614120, 0x6c492a, 0x442a11, 0x6f4520, 0xb88750, 0x684421, 0x41250f, 0x412605, 0x463117, 0x473018, 0x4a3019, 0x3f2a15, 0x100000, 0xb79154, 0xb68d4d, 0xb08046, 0x432f17, 0x000000, 0x241002, 0x593914, 0x7f562a, 0x845b2b, 0x8e5a1b, 0xead49f, 0xb6a075, 0x3b0600, 0x391300, 0xbc9756, 0xcbab6c, 0x82562b, 0x745637, 0x000000, 0x2f1708, 0x784c23, 0x8f632b, 0x9a652b, 0xc49e66, 0xe6d3a5, 0x664013, 0x50341b, 0x4f371c, 0x3f2b12, 0x372612, 0x170000, 0x7f603c, 0x855e31, 0x895f2c, 0x85541b, 0xcaa364, 0xac9263, 0x563312, 0x553b1e, 0x503a1e, 0x4e381d, 0x3a2615, 0x3f2511, 0x7b542f, 0x8c6434, 0x946731, 0xb98d49, 0xb38f58, 0x341708, 0x2b1e13, 0x100401, 0x3b2418, 0x764e29, 0xa9742a, 0xe2c38d, 0xf0e5b4, 0x836f4d, 0x220000, 0x977247, 0x9c6f3b, 0xa17137, 0xbc9654, 0xd6bd83, 0x6f4823, 0x6d4923, 0x8e6231, 0xa16f34, 0xb17e3c, 0xb07e3c, 0x9d6d33, 0x885d2e, 0x714c2b, 0x332010, 0x7e5a2e, 0xa67a3c, 0xbd8f42, 0xbe8f37, 0xe1c57e, 0xb9a675, 0x6d4215, 0x815a2e, 0xa97b3f, 0xba873e, 0xc28e41, 0xc38e43, 0xae7b35, 0x9a6f38, 0x664728, 0x31190e, 0x8a673a, 0xa97c3a, 0xc29440, 0xdfb052, 0xcea152, 0x7e5a2d, 0x491900, 0x562b00, 0x593100, 0x5e3b10, 0x643e07, 0xd3b87c, 0xa9915e, 0x9d6c34, 0xa47036, 0xa87539, 0x936632, 0x77502b, 0x40260f, 0x7f5626, 0xbd9041, 0xe4b759, 0xe0b558, 0xefd584, 0x947441, 0x825529, 0xa1723b, 0xba8746, 0xb6843f, 0xbf8b45, 0xb78242, 0x996a36, 0x714e2d, 0x3e1c06, 0xa87334, 0xd2a04d, 0xe9bc61, 0xe6bd5f, 0xf8d475, 0xc19852, 0x905c2d, 0x78522e, 0x653e18, 0xb07a3a, 0xac763d, 0x956230, 0x9f6a3a, 0x8a5a30, 0x74421a, 0xca9040, 0xe0a64b, 0xf3c665, 0xf7ce6b, 0xe7b45c, 0xcd8c3e, 0xd99045, 0xcf853d, 0xc17836, 0xb76c32, 0xae6730, 0x9f5c2a, 0x965529, 0x8f5026, 0x8d4e23, 0x894b23, 0x834722, 0x814520, 0x7f441f, 0x7b431f, 0x76401e, 0x703d1d, 0x6a391b, 0x65371a, 0x603318, 0x582f15, 0x512c15, 0x492713, 0x422410, 0x3d210e, 0x381e0f, 0x331c0d, 0x2e190c, 0x2a1609, 0x261409, 0x23130a, 0x1f1108, 0x1b0e05, 0x180d04, 0x160c05, 0x140b04, 0x120a03, 0x100a03, 0x0e0802, 0x0c0702, 
-  0x070500, 0x080500, 0x080501, 0x0a0601, 0x0b0602, 0x0c0703, 0x0d0802, 0x0e0802, 0x100903, 0x110a04, 0x130b06, 0x140b06, 0x140a06, 0x160b04, 0x160d04, 0x180e05, 0x1c0e07, 0x1e0f07, 0x201108, 0x23110a, 0x26130b, 0x27150a, 0x29170b, 0x2b1a0c, 0x301d0e, 0x372113, 0x372011, 0x3c2312, 0x442512, 0x4c2a15, 0x553017, 0x583016, 0x5f3417, 0x6c3d1c, 0x814c29, 0x8c522b, 0x90562f, 0x5f3417, 0x592e0a, 0xc18b54, 0xb47f47, 0x915a27, 0x804a17, 0xd4b368, 0xd5ba6f, 0x563007, 0x49301c, 0x51371b, 0x4e341a, 0x432b14, 0x774c23, 0x8d5d2e, 0x492805, 0x775d3d, 0xa68d67, 0x391c00, 0x493219, 0x472f17, 0x3a2716, 0x190000, 0xbf9755, 0xa87d3e, 0xb0844c, 0x35230c, 0x130903, 0x1d0f03, 0x452b11, 0x815b32, 0x8b6231, 0x8b5b23, 0xba9768, 0xe5d099, 0x4b2900, 0x5c3f1a, 0xdebe76, 0x99723c, 0x936b40, 0x44301b, 0x0d0502, 0x3b2614, 0x7c542b, 0x926535, 0x915f28, 0xb3894f, 0xeddba8, 0x785a34, 0x4d2e16, 0x4f391f, 0x402d14, 0x392818, 0x140000, 0x7d603a, 0x855e2f, 0x966932, 0x87561c, 0xc6a062, 0xa88e5f, 0x593716, 0x5a3e22, 0x533c22, 0x4f3a1f, 0x382614, 0x39230f, 0x7f5934, 0x8a6231, 0x966b33, 0xbd954f, 0xb4935d, 0x3a1d05, 0x3e2d1a, 0x2a1d10, 0x140501, 0x412a18, 0x875b2f, 0xa97329, 0xddc691, 0xe7d9ac, 0x543f26, 0x916b42, 0xa8783f, 0xb88645, 0xbb934f, 0xd6be84, 0x6b4522, 0x6b4822, 0x8d612f, 0xa77538, 0xa57333, 0xa07032, 0x9a6d37, 0x82592c, 0x6b4828, 0x362416, 0x7b572c, 0xa07539, 0xbf9045, 0xc2923d, 0xe3c784, 0xbaa87b, 0x663b09, 0x815b2d, 0xaa7b3e, 0xbd8a41, 0xc08b3e, 0xce9a49, 0xbc8b42, 0x8b612e, 0x604225, 0x281106, 0x866238, 0xa47838, 0xbf913e, 0xd5a648, 0xe1bc68, 0x8b734b, 0x422317, 0x4e311b, 0x462b1b, 0x392113, 0x2b0000, 0x937450, 0xa78559, 0x8e612b, 0x976532, 0xa27036, 0x9e7138, 0x7b532b, 0x422713, 0x84572b, 0xb8883f, 0xdfb057, 0xd9b053, 0xf1dd89, 0x967a46, 0x8c6136, 0x986b36, 0xba8a46, 0xca954a, 0xc08b45, 0xa4723b, 0x936637, 0x765131, 0x442202, 0xc18e46, 0xdba955, 0xebbf62, 0xedc566, 0xf9d676, 0xb68d48, 0x9a6638, 0x7f5732, 0x583717, 0xa16d38, 0x996530, 0xa26f3b, 0x996637, 0x764a25, 0x7f5020, 0xe8b35d, 0xe4af52, 0xf0c361, 0xf7cd6c, 0xdba856, 0xc9863d, 0xcf8440, 0xc37738, 0xb46d33, 0xa9622e, 0x9e5b2a, 0x955426, 0x8c4e25, 0x834823, 0x7c4420, 0x78411f, 0x723f1e, 0x6f3d1b, 0x6f3c1b, 0x6e3c1d, 0x69391b, 0x65361a, 0x613419, 0x5e3318, 0x5e3317, 0x5a3116, 0x552f15, 0x4f2b14, 0x492914, 0x442611, 0x402411, 0x3c210f, 0x371e0d, 0x311a0b, 0x2b1809, 0x261408, 0x221408, 0x1d1107, 0x1b0f05, 0x170d04, 0x150c03, 0x130b03, 0x110a03, 0x0f0802, 0x0d0703, 
-  0x050500, 0x060500, 0x070601, 0x090601, 0x0a0602, 0x0b0602, 0x0c0702, 0x0d0803, 0x0f0903, 0x110a04, 0x140b06, 0x140b06, 0x150b06, 0x160b05, 0x160b02, 0x180d04, 0x1c0f07, 0x1e1007, 0x201108, 0x241309, 0x27150a, 0x29170b, 0x2c190c, 0x2d1b0d, 0x301c0e, 0x341e10, 0x371f0f, 0x3e2414, 0x452614, 0x4e2c16, 0x5b3116, 0x794d2b, 0x865b38, 0x744221, 0x7e4824, 0x915428, 0xa56231, 0x7f4a23, 0x75471f, 0xa9733c, 0xa36e39, 0x8b5627, 0x7d4b22, 0xb48e47, 0xeacf79, 0x855f2f, 0x50311b, 0x4f361d, 0x422c13, 0x462910, 0x805124, 0x8d5f31, 0x3b1900, 0x9d7b4d, 0xa08256, 0x371900, 0x4e371f, 0x462e15, 0x352312, 0x290300, 0xc9a05a, 0xa47637, 0xb48c54, 0x311b05, 0x2b1d0e, 0x1d0f03, 0x321d0c, 0x634021, 0x84572b, 0x865d2b, 0x885c23, 0xe7cf96, 0x988358, 0x9b7e4b, 0xc6a267, 0x95642e, 0x805c36, 0x2e1c0f, 0x21140d, 0x2f1b0d, 0x734e26, 0x83562a, 0x8f6028, 0xa77736, 0xefdba5, 0x957b56, 0x472603, 0x4f381f, 0x412c16, 0x372516, 0x050000, 0x8d6f4a, 0x8f6838, 0x9e6f33, 0x8f5e21, 0xc39e60, 0xa99160, 0x553210, 0x54371c, 0x493119, 0x4b351d, 0x342413, 0x382310, 0x7e5a35, 0x906835, 0x966a2f, 0xbc9755, 0xb89b67, 0x47280a, 0x4d361a, 0x402c15, 0x2a1b0d, 0x1f0e02, 0x492815, 0x825827, 0x9a6d2d, 0xe1cb97, 0xd4c193, 0x946a33, 0xac7b37, 0xb8843b, 0xbf954f, 0xd7c085, 0x684321, 0x694621, 0x895d2c, 0xa77637, 0xa27032, 0x916328, 0x916633, 0x7e572d, 0x614224, 0x29190b, 0x805d32, 0xa77c40, 0xb98a3e, 0xbb8a37, 0xe4c884, 0xbaa87a, 0x683e0d, 0x7d582c, 0xae8141, 0xbf8b40, 0xbe8a3b, 0xc89543, 0xbc8b44, 0x845a2a, 0x5d4024, 0x271204, 0x87653a, 0xa57a3b, 0xc39543, 0xd6a84b, 0xe1bb6b, 0x967b50, 0x634126, 0x684729, 0x66452a, 0x624324, 0x371c07, 0x65472a, 0x937149, 0x875d2c, 0x916133, 0x9d6d34, 0x9b6c32, 0x7e572e, 0x432913, 0x865a2c, 0xbd8d43, 0xdeae55, 0xdab258, 0xf5e292, 0x907445, 0x7d532c, 0x7e5428, 0x996c35, 0xbc8845, 0xb58042, 0x916331, 0x8e6238, 0x714d2f, 0x61431e, 0xd9ab5e, 0xdfb157, 0xe9be5e, 0xeac162, 0xf3ce70, 0xa57b3b, 0x9d6a37, 0x7f562b, 0x4b2b0e, 0x946532, 0x936131, 0xa16e3b, 0x946234, 0x6f4421, 0x93642c, 0xe5b05a, 0xdead52, 0xebbf5e, 0xf5ca69, 0xcf9b4f, 0xc4803a, 0xc37939, 0xb56b32, 0xa65f2b, 0x9b5726, 0x965628, 0xab6d43, 0x854a22, 0x79411e, 0x723d1d, 0x6d3c1c, 0x67391b, 0x63381a, 0x613519, 0x5e3318, 0x5c3219, 0x583118, 0x542e15, 0x502c16, 0x4e2b14, 0x4c2a13, 0x492913, 0x472813, 0x442712, 0x432611, 0x412510, 0x402510, 0x3d2310, 0x38200e, 0x321d0d, 0x2d1a0b, 0x29180a, 0x231608, 0x201307, 0x1c1006, 0x180d04, 0x150c03, 0x130b03, 0x100902, 0x0f0803, 
-  0x050500, 0x070601, 0x060500, 0x090702, 0x0a0702, 0x0b0703, 0x0c0704, 0x0d0804, 0x0e0903, 0x120a04, 0x140905, 0x150a05, 0x150b04, 0x160a03, 0x281b13, 0x271a12, 0x190d05, 0x1e1107, 0x201207, 0x241408, 0x271709, 0x2b190b, 0x2f1c0e, 0x311d0f, 0x331e0f, 0x392414, 0x482f1e, 0x412210, 0x482915, 0x563118, 0x633316, 0x8e5e38, 0x986940, 0x7f4723, 0x8a4d27, 0x9d582a, 0xb06831, 0x80471d, 0x593014, 0x603210, 0x78451e, 0x7e4e25, 0x794d25, 0x93682b, 0xf1d67e, 0xa57e44, 0x4e2a0d, 0x52371f, 0x493014, 0x5e3d1f, 0x986635, 0x8f6330, 0x4c2e0c, 0xb08854, 0x66441d, 0x47321a, 0x422b15, 0x493018, 0x372513, 0x422607, 0xcda55e, 0xa87636, 0xb08b51, 0x371c0a, 0x362713, 0x2a1b08, 0x261207, 0x513217, 0x876032, 0x815627, 0x804f19, 0xbe9b63, 0xd3b478, 0xb4874c, 0x9e6e34, 0x9a6b38, 0x56381c, 0x3f2d18, 0x27180e, 0x220f05, 0x6a4824, 0x8f5f31, 0x8f6429, 0xa06a24, 0xe5cd98, 0xac956d, 0x3f1c00, 0x462f19, 0x422c17, 0x382514, 0x0d0000, 0x876644, 0x886132, 0x96672d, 0x986727, 0xc3a064, 0xaa9563, 0x553210, 0x53371b, 0x523b24, 0x442e18, 0x2a1c0e, 0x3c2713, 0x86613a, 0x8a612e, 0x93672b, 0xbe9859, 0xbc9e69, 0x593718, 0x5b3f21, 0x583d1e, 0x412c16, 0x302013, 0x200a01, 0x492d17, 0x744c23, 0x936c33, 0xdec58c, 0xc5a069, 0xad7b38, 0xaa7731, 0xc09755, 0xd9c58c, 0x66441f, 0x6c4821, 0x865a27, 0xa97837, 0xa57335, 0x9a6b30, 0x8c6130, 0x724c26, 0x593e22, 0x2e1c10, 0x7f5d30, 0xab7e41, 0xba8a3d, 0xbf8e3c, 0xe5c87e, 0xb7a574, 0x704718, 0x7a562b, 0xab8040, 0xbb873c, 0xbb893b, 0xad7b32, 0xae7d3e, 0x875e2f, 0x614427, 0x2d190c, 0x866438, 0xa77b3c, 0xc09441, 0xdaab51, 0xe4be6d, 0x957a50, 0x6a4124, 0x6d492b, 0x6f4a29, 0x6d492c, 0x503320, 0x3c2110, 0x6c4d2e, 0x80572b, 0x906335, 0x90652b, 0x8f5e30, 0x72502d, 0x442c18, 0x774f20, 0xaf813a, 0xd8a850, 0xdbb258, 0xf4de8e, 0x927241, 0x7f542d, 0x855d34, 0x906536, 0x95672f, 0x9f703b, 0x8f6131, 0x8f6538, 0x674728, 0x8b6c3e, 0xe2b96f, 0xdaae53, 0xdfb458, 0xe7bc5d, 0xe3b862, 0x8f602c, 0x9b6a37, 0x986e3d, 0x623c19, 0x946935, 0x8f5f2f, 0x956436, 0x83562c, 0x694122, 0x9a6729, 0xcc9141, 0xe2b056, 0xeec467, 0xeec465, 0xbf853d, 0xbf7839, 0xb56d33, 0xa6602d, 0xa36033, 0x935529, 0x894e23, 0x8e552e, 0x7a421e, 0x713d1d, 0x6a3a1a, 0x653718, 0x603418, 0x5c3219, 0x5a3218, 0x573016, 0x532d15, 0x4f2b15, 0x4c2a14, 0x492813, 0x452512, 0x422411, 0x3f2310, 0x3d2210, 0x3c2110, 0x3b200f, 0x3a210f, 0x3c2211, 0x38200e, 0x351e0d, 0x301c0b, 0x2d1a0a, 0x2a1909, 0x271709, 0x221408, 0x201308, 0x1c0f07, 0x180d05, 0x160c03, 0x130b02, 0x110a03, 
-  0x060500, 0x070601, 0x060500, 0x090601, 0x0a0702, 0x0a0702, 0x0c0804, 0x0e0904, 0x0f0a04, 0x120a05, 0x150a05, 0x150a04, 0x160c04, 0x170c04, 0x23160e, 0x24160e, 0x1c1006, 0x211308, 0x241408, 0x271609, 0x29180a, 0x2c1a0c, 0x301e0f, 0x341f0f, 0x36200d, 0x3e2714, 0x4d3320, 0x45250f, 0x52311a, 0x5d351a, 0x6a3b21, 0x6f3b1c, 0x7b421a, 0x904f27, 0xa25a2b, 0xb5662e, 0xd0823f, 0xbc7d43, 0x663713, 0x603214, 0x89582d, 0x7f5024, 0x7c5027, 0x865523, 0xe8cb79, 0xcdab68, 0x6a4218, 0x573920, 0x543a20, 0x4c2d16, 0x875e2d, 0x8b6132, 0x7d572f, 0xa87f4a, 0x4a2909, 0x473016, 0x4a311a, 0x4d341d, 0x322113, 0x5e401d, 0xcda35c, 0xab7836, 0xa9824d, 0x3a220d, 0x3b2b12, 0x35240f, 0x1b0901, 0x41260e, 0x785026, 0x986938, 0x906230, 0x986b2e, 0xcc9959, 0xa06f31, 0x996933, 0x7a552d, 0x4c3017, 0x432f18, 0x301e10, 0x1c0a02, 0x634420, 0x83572c, 0x895e2d, 0x85510a, 0xceb47d, 0xc4ae7f, 0x340300, 0x412c18, 0x402e19, 0x321f0f, 0x120000, 0x7d5b3a, 0x8c6435, 0x93652e, 0x8c5b1d, 0xc5a167, 0xaa9464, 0x502d0f, 0x50361b, 0x5a452b, 0x4a351d, 0x2b1d0d, 0x402a16, 0x8f6940, 0x89622f, 0x896129, 0xb28d52, 0xbe9e69, 0x4f2d03, 0x614424, 0x73552f, 0x614524, 0x4b331c, 0x301f13, 0x120300, 0x4a2f17, 0x7b5226, 0x9d7235, 0xb2884e, 0xa7773a, 0xa47132, 0xbc9455, 0xddc78f, 0x684620, 0x68461f, 0x8d6433, 0xaa783b, 0xaa7738, 0xa27133, 0x976b37, 0x6d4923, 0x52391f, 0x27150b, 0x835f30, 0xac7d3d, 0xb9893e, 0xb78736, 0xdec178, 0xb4a171, 0x724a1e, 0x7f5b32, 0xa67b3d, 0xbe8a43, 0xb68339, 0xa57432, 0x9a6c30, 0x896333, 0x5c4125, 0x2b160a, 0x805d32, 0x9d7034, 0xbe8f40, 0xcb9b43, 0xe3c06f, 0x987e52, 0x794f2e, 0x7c5430, 0x825a33, 0x7b552d, 0x7a542f, 0x734f29, 0x805e35, 0x7d5930, 0x8b673a, 0xc4a46c, 0x875833, 0x704c2a, 0x39210c, 0x885f33, 0xb88942, 0xd7a64e, 0xd3a74f, 0xf0d683, 0x987741, 0x7f542c, 0x875c32, 0x9e7341, 0xa1743c, 0x966836, 0x8c6134, 0x896336, 0x542e1b, 0xb49658, 0xdfb768, 0xd0a34f, 0xd9ae53, 0xe5b556, 0xc0914a, 0x85562b, 0x83592f, 0x7e562b, 0x81572b, 0x916535, 0x895d2c, 0x926438, 0x6c4627, 0x4e280e, 0xbc8947, 0xd99f4d, 0xe5b45a, 0xeac163, 0xe7bb62, 0xba7c37, 0xb87036, 0xa8622d, 0x995629, 0x8f5229, 0x854c25, 0x7b4421, 0x743e1c, 0x6f3c1d, 0x68391c, 0x63361a, 0x5f3318, 0x5a3117, 0x563016, 0x522e16, 0x4f2c16, 0x4d2a15, 0x482813, 0x452612, 0x432311, 0x3f210f, 0x3c200f, 0x3a1f10, 0x371e0e, 0x361d0e, 0x341c0e, 0x341d0e, 0x341e0f, 0x2f1b0b, 0x2c190a, 0x29180a, 0x261609, 0x241508, 0x201206, 0x1f1106, 0x1c1006, 0x190e05, 0x180d04, 0x160c03, 0x150b04, 0x130b05, 
-  0x060500, 0x080601, 0x090601, 0x0a0702, 0x0a0702, 0x0b0803, 0x0c0904, 0x0d0905, 0x0f0a04, 0x120a04, 0x140a03, 0x160b05, 0x180d05, 0x1b0e05, 0x1c0e05, 0x1e1007, 0x201308, 0x231307, 0x261508, 0x281609, 0x2a1809, 0x2e1b0c, 0x321d0e, 0x38200e, 0x3e230f, 0x42250f, 0x462710, 0x502c16, 0x5a341c, 0x603318, 0x703b1d, 0x7e441f, 0x945227, 0xab622f, 0xbf7136, 0xd0813c, 0xe8994a, 0xe49c52, 0x965a25, 0x8d5627, 0xb37b40, 0x855228, 0x764a23, 0x7c4d18, 0xd2b76b, 0xebd183, 0x865f28, 0x4b2e11, 0x4f361e, 0x462b17, 0x7a562c, 0x8b6034, 0x81572a, 0x7c5627, 0x492e17, 0x4a3317, 0x50361d, 0x472e18, 0x271208, 0x825e2f, 0xc69853, 0xb38341, 0x9f7c49, 0x372005, 0x3c2911, 0x392711, 0x221306, 0x2b1605, 0x674323, 0x895e30, 0x8d602e, 0x8a5f2b, 0xa9773e, 0x9c6c37, 0x936939, 0x54351b, 0x4e351c, 0x432e16, 0x321f0d, 0x130501, 0x5d3f1e, 0x744a21, 0x7e5528, 0x81511d, 0xb89760, 0xd6c18c, 0x3c1400, 0x3b2714, 0x342611, 0x342211, 0x140000, 0x84603b, 0x8e6434, 0x976a35, 0x8d5c22, 0xc3a067, 0xa89362, 0x4a2706, 0x4e361c, 0x4d381d, 0x49351c, 0x2e2010, 0x432d17, 0x8c683e, 0x8c6634, 0x845c26, 0xae8b51, 0xc1a36d, 0x543004, 0x614424, 0x6f4f26, 0x715128, 0x5c3f1f, 0x422f1c, 0x21160e, 0x1f0b03, 0x5b3b23, 0x966a3b, 0xa77b40, 0xa2743b, 0x9e6e36, 0xac8344, 0xd4bc82, 0x7b5931, 0x6c4b23, 0x7c5626, 0xa47338, 0xae7b3c, 0xa87735, 0x956933, 0x6f4b26, 0x523921, 0x220f07, 0x856132, 0xb08040, 0xb5843b, 0xb68536, 0xdcc079, 0xaf9c6d, 0x734c21, 0x7a5730, 0x9c7135, 0xb6823d, 0xb8853c, 0xa97938, 0x9f733a, 0x805d30, 0x54391f, 0x281105, 0x866236, 0xa37539, 0xbe8d41, 0xd2a04c, 0xe3bf71, 0x9d8356, 0x7b4f29, 0x7f552c, 0x865a31, 0x8a5d35, 0x885d33, 0x906739, 0x865f2f, 0x603c18, 0x9d7c47, 0xcdae71, 0x7f5329, 0x734f28, 0x381f0a, 0x895e30, 0xb6853d, 0xcd9a43, 0xd3a44b, 0xeece79, 0x94723e, 0x76502c, 0x84592e, 0x9c6f3d, 0x9d6f3b, 0x7f5224, 0x7b522a, 0x785633, 0x522c14, 0xd4ae62, 0xd2a54d, 0xcda048, 0xd9ab51, 0xcfa14a, 0x91622a, 0x8f6438, 0x825f36, 0x653d1a, 0x895b2c, 0x9a6d34, 0x8f6135, 0x835932, 0x54361d, 0x533111, 0xd2a054, 0xdea853, 0xe1b358, 0xe8bf61, 0xd5a75a, 0xb06e30, 0xaf6732, 0xa15f2f, 0x90542b, 0x804823, 0x79441f, 0x73411e, 0x6c3d1c, 0x643819, 0x603618, 0x5c3219, 0x583118, 0x542f17, 0x502d16, 0x4c2b15, 0x492a15, 0x452713, 0x422511, 0x402310, 0x3f2210, 0x3c200f, 0x391f0f, 0x361e0e, 0x331d0d, 0x321c0e, 0x301b0d, 0x2f1b0d, 0x2e1a0d, 0x2b190c, 0x28170a, 0x25160a, 0x211409, 0x1f1208, 0x1e1006, 0x1b0f05, 0x180e04, 0x160d04, 0x150b02, 0x140a02, 0x130a04, 0x110a04, 
-  0x060500, 0x090601, 0x090601, 0x090702, 0x090702, 0x0b0803, 0x0c0904, 0x0d0a05, 0x0f0a04, 0x130b04, 0x150a04, 0x160b05, 0x190e05, 0x1c0f06, 0x1d1008, 0x201209, 0x211308, 0x251508, 0x261407, 0x291709, 0x2d1b0c, 0x311c0e, 0x371f0f, 0x3e2210, 0x462611, 0x4c2a13, 0x542c12, 0x6e4027, 0x845338, 0x733915, 0x905124, 0xb36f3a, 0xba7039, 0xc77938, 0xd58640, 0xd98b41, 0xda8e41, 0xcd843f, 0x8e5121, 0x794921, 0x905f2f, 0x774822, 0x795026, 0x77491a, 0xb08b49, 0xf4da87, 0x9b7339, 0x573619, 0x51361f, 0x4a321b, 0x684323, 0x83572c, 0x6c451f, 0x58381a, 0x3e2815, 0x473215, 0x50371c, 0x452d17, 0x1d0000, 0x9f753b, 0xbe8f49, 0xc19552, 0x967545, 0x443014, 0x412c18, 0x3c2812, 0x2b1d0b, 0x110500, 0x452c17, 0x6a4720, 0x996e3d, 0xa0713c, 0x936530, 0xa3713a, 0x805c32, 0x39220f, 0x412b14, 0x412c13, 0x34210d, 0x0c0504, 0x543719, 0x7c532a, 0x815729, 0x815525, 0xa27a46, 0xe1cb94, 0x52361c, 0x3b2612, 0x32240d, 0x35210e, 0x1e0b00, 0x825c35, 0x895f2d, 0x8e622c, 0x8d5d22, 0xc29f65, 0xa99362, 0x452100, 0x473019, 0x49331e, 0x47331d, 0x322314, 0x402913, 0x785831, 0x825b2a, 0x91642c, 0xb49358, 0xc3ab74, 0x5c380d, 0x5b3e1f, 0x6a4a23, 0x76552f, 0x664725, 0x543b1e, 0x3c2814, 0x261406, 0x331c10, 0x634228, 0x98713c, 0x976b34, 0x956833, 0xb18747, 0xceb275, 0x755125, 0x77542c, 0x7b5527, 0x9d6f32, 0xb1803b, 0xb68640, 0x8b6029, 0x714c28, 0x543a21, 0x231009, 0x856232, 0xb38543, 0xb18139, 0xb48337, 0xd1b570, 0xa79463, 0x6b4418, 0x745129, 0x9b7136, 0xb7843d, 0xbb8a3d, 0xb2823b, 0x966a33, 0x714d27, 0x60442a, 0x331d0c, 0x886335, 0xa97a3c, 0xbb8a3e, 0xc6933f, 0xdbb66a, 0xa18558, 0x81532d, 0x865b32, 0x8a5d34, 0x8c6239, 0x78522e, 0x704c2a, 0x714c2b, 0x643f1a, 0xcaa35a, 0xbe9e61, 0x7e5328, 0x77502e, 0x3a210c, 0x7a4f21, 0xb07e37, 0xd5a14b, 0xd3a246, 0xe5bf6c, 0x836035, 0x654529, 0x825b30, 0x986a38, 0x996a3a, 0x7d512a, 0x724b29, 0x573720, 0x8f6d37, 0xddaf5a, 0xd9a951, 0xd2a349, 0xcb9a47, 0xa27537, 0x7a4f27, 0x896035, 0x6e492a, 0x764e21, 0x895a2b, 0x9b6e36, 0x9e6c3d, 0x7a532f, 0x482b14, 0x765328, 0xd7a450, 0xdca852, 0xe5b85d, 0xefc668, 0xba8a46, 0xa9632e, 0xa6612e, 0x985a2c, 0x875028, 0x7b4623, 0x784422, 0x6c3c1c, 0x64371b, 0x5c3319, 0x5a3118, 0x552e17, 0x512d16, 0x4d2b15, 0x4a2a15, 0x462813, 0x422611, 0x40240f, 0x3e220e, 0x3e210f, 0x3c210e, 0x391f0d, 0x341c0b, 0x321c0b, 0x301c0a, 0x2d1a0a, 0x2c1a0a, 0x2a180a, 0x29170a, 0x28160a, 0x261508, 0x231408, 0x1f1308, 0x1d1007, 0x1b0e06, 0x170d04, 0x160c03, 0x150c03, 0x130b03, 0x120a02, 0x100902, 0x0e0803, 
-  0x080401, 0x090501, 0x0a0602, 0x090601, 0x0a0702, 0x0c0804, 0x0c0805, 0x0e0904, 0x120b04, 0x140b06, 0x150b06, 0x170d06, 0x1b0f06, 0x1d1006, 0x201208, 0x231309, 0x251508, 0x281607, 0x291709, 0x2c1a0b, 0x311d0d, 0x381f0f, 0x3e2211, 0x452612, 0x522c14, 0x5c3116, 0x6e3819, 0x804320, 0x8f4d24, 0x9a5529, 0xaf6834, 0xca8246, 0xbe7439, 0xbd7134, 0xbe7133, 0xbe7132, 0xbe7130, 0xbd7437, 0x844d24, 0x4f2a11, 0x4b2508, 0x6b411e, 0x825529, 0x88582b, 0x8e5e22, 0xf0d281, 0xc09d5a, 0x6a411d, 0x4b3219, 0x4a341e, 0x56371c, 0x6d4623, 0x6e4622, 0x442b0f, 0x432e19, 0x4b3219, 0x4c3118, 0x3d2814, 0x1f0000, 0xb38949, 0xb78844, 0xbc8a4a, 0x7f5e34, 0x4d371c, 0x3e2b15, 0x382510, 0x2c1d0c, 0x190b04, 0x231204, 0x5e3e1c, 0x84592e, 0x9a6a38, 0x9a6932, 0xa6763e, 0x53371e, 0x3f2c15, 0x422c16, 0x4c341c, 0x3a2611, 0x130802, 0x4c3117, 0x7a5129, 0x7f5729, 0x7f5423, 0x916531, 0xe4cb92, 0x6f5839, 0x3b200a, 0x47321a, 0x432e17, 0x260901, 0x866538, 0x8f6634, 0x90622f, 0x845419, 0xc2a064, 0xb59b66, 0x4b290a, 0x4b341c, 0x4e3721, 0x452e1a, 0x281b09, 0x422b16, 0x87633b, 0x815929, 0x8c632b, 0xb38f54, 0xc5ab74, 0x5f3b11, 0x5c4020, 0x644623, 0x6b4927, 0x775531, 0x6b4a25, 0x5c3e1e, 0x3f2a13, 0x231406, 0x351f0f, 0x664629, 0x9f7643, 0x9b6d32, 0xb38743, 0xcfac73, 0x6d4a1f, 0x694724, 0x7c582b, 0xa7783a, 0xb28037, 0xb07f39, 0x946833, 0x714c26, 0x583d22, 0x23130b, 0x825d2a, 0xaa7d39, 0xb7873e, 0xac792f, 0xd2b26f, 0xae9968, 0x734b1f, 0x896436, 0xa2743a, 0xb2823b, 0xc09044, 0xad7e38, 0x946a32, 0x714f28, 0x5e4126, 0x321806, 0x8d6737, 0xa17239, 0xae7f38, 0xb88533, 0xd8b46c, 0xa4875c, 0x7e502b, 0x80562f, 0x855b32, 0x815b2f, 0x78552b, 0x684624, 0x623d24, 0x9d763a, 0xe8c26d, 0xa68552, 0x6f4723, 0x6e4b2c, 0x3b210d, 0x845c26, 0xb38338, 0xcf9d47, 0xcf9d44, 0xe7bf69, 0x7f5e36, 0x624023, 0x79552d, 0x875c2f, 0x946837, 0x855a31, 0x6c462a, 0x5b340e, 0xd4ac5b, 0xca9a46, 0xc19041, 0xc4963f, 0xab7c37, 0x6a3d1d, 0x77512e, 0x76522b, 0x5c381f, 0xa57a43, 0x986b39, 0x8a5a2c, 0x9d6e3d, 0x74502b, 0x391a0b, 0x9d7239, 0xcc9747, 0xd6a551, 0xdcb053, 0xe9bc66, 0xaf783d, 0xaa6531, 0x9d5b2b, 0x8c5026, 0x7e4822, 0x764221, 0x6e3d1d, 0x673a1d, 0x60331b, 0x593019, 0x542f17, 0x522d14, 0x4e2b16, 0x4a2a15, 0x472813, 0x432512, 0x3f2410, 0x3d220f, 0x3e2211, 0x3b2010, 0x39200e, 0x371e0c, 0x3a200b, 0x361e09, 0x2d1a0a, 0x2c190a, 0x2a190b, 0x28170a, 0x27150a, 0x27150a, 0x241308, 0x201208, 0x1c1007, 0x1a0f06, 0x180d05, 0x160b03, 0x150b04, 0x140b03, 0x120a02, 0x100a04, 0x0d0804, 0x0c0703, 
-  0x080401, 0x090502, 0x090502, 0x0a0601, 0x0a0702, 0x0c0805, 0x0e0805, 0x0f0a04, 0x130a03, 0x140a04, 0x170c06, 0x1a0e05, 0x1c1007, 0x1f1107, 0x231408, 0x271509, 0x2a170a, 0x2e1a0a, 0x321d0c, 0x371f0e, 0x3f220f, 0x462711, 0x4e2b14, 0x5a3016, 0x6a3619, 0x7c3f22, 0x904d2a, 0x955129, 0x99542a, 0x9b572b, 0x935327, 0x8d4f23, 0x8e4e24, 0x914e24, 0x955025, 0x9f5927, 0xae6530, 0xb97031, 0xa4682f, 0x6b3d18, 0x6a3e16, 0x88592d, 0x815225, 0x895c2f, 0x7f4d18, 0xd3af67, 0xdbbc71, 0x77481d, 0x482f17, 0x45311b, 0x472e16, 0x502f12, 0x855f35, 0x4b3216, 0x452e17, 0x573c1d, 0x4b3214, 0x3a2a13, 0x2d0100, 0xc39047, 0xa57434, 0x9c6a30, 0x694921, 0x463215, 0x3c2c15, 0x362511, 0x322212, 0x27180c, 0x140500, 0x513216, 0x845a2d, 0x8d5e2a, 0xa26f37, 0x8e6638, 0x311b06, 0x3c2a13, 0x3b2710, 0x4c351d, 0x44311a, 0x211306, 0x3d230b, 0x734a22, 0x795024, 0x774e20, 0x7e5116, 0xdcc28a, 0x947e5a, 0x351200, 0x4b341d, 0x493317, 0x2a0100, 0x8e6a40, 0x906635, 0x8b5f2f, 0x805020, 0xbc9c64, 0xb79d6a, 0x4b2907, 0x4a2e15, 0x503b1d, 0x412f17, 0x281c0f, 0x462e18, 0x956d41, 0x855827, 0x956930, 0xa8804a, 0xc4aa75, 0x603a11, 0x5b3c1f, 0x624522, 0x684821, 0x755128, 0x7a5429, 0x734f27, 0x5c3f21, 0x3c2713, 0x210e05, 0x371e12, 0x73522e, 0xac7f44, 0xbb8d43, 0xc8a265, 0x71532c, 0x634324, 0x7b5527, 0xa27436, 0xac7a37, 0xa37334, 0x8c632f, 0x6f4c25, 0x5a3e21, 0x291703, 0x896537, 0xad8442, 0xb88d40, 0xa57626, 0xd1b26e, 0xb9a675, 0x653b11, 0x7f572e, 0x9d703a, 0xa57534, 0xb1813a, 0xb6853f, 0x976a32, 0x745029, 0x5a3d27, 0x2d1005, 0x996f3b, 0xa9793d, 0xaf7e35, 0xb37f2e, 0xdbba74, 0xa4895e, 0x74441c, 0x774a26, 0x7a4b24, 0x82542a, 0x7e512f, 0x724725, 0x8e6a34, 0xdbaf58, 0xdfb968, 0x82633d, 0x5d4020, 0x593f23, 0x31160c, 0x91682e, 0xc59340, 0xcd9b43, 0xc89541, 0xdab561, 0x6d4f25, 0x58300a, 0x6d431d, 0x7b5026, 0x7d5324, 0x683e0a, 0x6e491b, 0xca9f58, 0xdbaa55, 0xbf8c3d, 0xc29144, 0xa8793a, 0x603e19, 0x6a4a29, 0x7c592f, 0x7f552e, 0x5d361b, 0xa47a40, 0x9e733c, 0x865930, 0x8b6139, 0x6c4b2b, 0x46250b, 0xbf8f49, 0xcc9446, 0xd5a54f, 0xdbae53, 0xd4a356, 0x9e612b, 0xa86331, 0x965528, 0x864c24, 0x784521, 0x6d3e1e, 0x673a1b, 0x62391c, 0x5a331b, 0x552e15, 0x593216, 0x583215, 0x4e2a14, 0x482812, 0x442611, 0x412311, 0x3e220f, 0x3b200f, 0x3d2313, 0x371f0f, 0x341c0f, 0x2d0400, 0x8b6f4d, 0x745c3c, 0x200300, 0x2b180b, 0x28170a, 0x26160a, 0x26140a, 0x241309, 0x211107, 0x1e1007, 0x190f06, 0x170d04, 0x160c03, 0x150b03, 0x130a03, 0x120b03, 0x0f0a02, 0x0d0803, 0x0c0703, 0x0b0602, 
-  0x080401, 0x080401, 0x090502, 0x0a0702, 0x0c0703, 0x0e0804, 0x100804, 0x130b04, 0x150c04, 0x160b05, 0x1a0d05, 0x211309, 0x221408, 0x241408, 0x281608, 0x2c1709, 0x321a0b, 0x381e0c, 0x3e220e, 0x472610, 0x4f2a13, 0x5a2f16, 0x64341a, 0x6c3a1d, 0x753e1e, 0x7f4222, 0x884826, 0x814421, 0x79401c, 0x75401d, 0x723f1e, 0x6c3a1c, 0x723b1d, 0x7d4121, 0x884925, 0x975327, 0xa86030, 0xb66d32, 0xad6f32, 0x70401b, 0x6c411c, 0x7d5029, 0x71441b, 0x7d5128, 0x825528, 0xa67b3f, 0xeace7e, 0x916832, 0x4a2c15, 0x422f18, 0x3e2914, 0x3b1f02, 0xb28e5b, 0x5a4123, 0x392510, 0x4e371a, 0x473017, 0x291d11, 0x270000, 0xc7914a, 0x946027, 0xbc8c4d, 0x79552d, 0x3f2915, 0x392716, 0x362510, 0x35260e, 0x31220f, 0x1b0a02, 0x39210c, 0x785127, 0x97662d, 0xb17e46, 0x604020, 0x3c2811, 0x382712, 0x3d2a13, 0x4a331b, 0x3f2c15, 0x2c1d0d, 0x321a07, 0x69421f, 0x835b33, 0x785125, 0x663900, 0xc9ad7a, 0xb69f73, 0x340300, 0x4b351c, 0x422c17, 0x140000, 0xab8653, 0x926936, 0x885b2b, 0x935f24, 0xba9960, 0xc5b07c, 0x260000, 0x41230f, 0x4d381f, 0x402f17, 0x1b0500, 0x5b4223, 0x9a7546, 0x855a2a, 0x93682f, 0xaa8856, 0xdecf9f, 0x472c00, 0x4f321a, 0x56391d, 0x6b4b28, 0x6c4922, 0x7b562c, 0x755024, 0x704f2b, 0x563b20, 0x3f2c18, 0x1f0c04, 0x3f2714, 0x8b653c, 0xbf9050, 0xcba767, 0x6d5230, 0x705030, 0x815827, 0x9e6f32, 0xa57335, 0x9b6b33, 0x835c2b, 0x684b23, 0x553623, 0x310100, 0xb08445, 0xbc8b41, 0xbf8e40, 0xc08f3e, 0xd5b268, 0xd5c68f, 0x6b481b, 0x744d1e, 0x9a6f39, 0xac7d3c, 0xb07f37, 0xb5823a, 0x9f7039, 0x7a542f, 0x4a2d14, 0x340d00, 0xb7894a, 0xb7883e, 0xc89745, 0xc28d3a, 0xdbbb70, 0xc8b177, 0xaf935e, 0xaa8f5c, 0xa68955, 0xaf9058, 0xb8985b, 0xcca762, 0xe1b660, 0xe1b054, 0xcba25e, 0x634324, 0x5e4329, 0x41231c, 0x462a0f, 0xb58b41, 0xd8a451, 0xe2af55, 0xcb933c, 0xd6ad5d, 0xae9a67, 0xb09e6e, 0xb29966, 0xad9460, 0xb8a16a, 0xc6aa6e, 0xe8bf70, 0xf0c46b, 0xd7a552, 0xc59046, 0x9a7036, 0x503013, 0x604024, 0x78562f, 0x7d5731, 0x8b6036, 0x754c27, 0xa97c3c, 0xb08244, 0x81542c, 0x7b512f, 0x624028, 0x734f21, 0xdba855, 0xd09945, 0xd0a348, 0xdcad59, 0xbe8b49, 0x945525, 0xa56236, 0x8e4f26, 0x804823, 0x724220, 0x673a1d, 0x613719, 0x5b3418, 0x54311b, 0x4a2407, 0x805b42, 0x825f46, 0x451e01, 0x462610, 0x42250f, 0x3f2210, 0x3d210f, 0x381e0d, 0x351e0d, 0x321d0c, 0x2f1c0f, 0x311908, 0x4a2f16, 0x402812, 0x291809, 0x281609, 0x261508, 0x241409, 0x241309, 0x221208, 0x1f1107, 0x1c0f06, 0x190e05, 0x160c03, 0x150b02, 0x140b03, 0x120a03, 0x110a02, 0x0e0901, 0x0d0803, 0x0c0703, 0x0a0702, 
-  0x080500, 0x090601, 0x0a0702, 0x0b0703, 0x0d0804, 0x100805, 0x120904, 0x140a03, 0x170d04, 0x1a0d05, 0x1e0f06, 0x241407, 0x281608, 0x2a1809, 0x321b0a, 0x391d0b, 0x40220f, 0x482512, 0x502a14, 0x572f17, 0x5b3219, 0x5f321a, 0x613119, 0x5e3218, 0x5d3318, 0x5c3116, 0x5b2e14, 0x5a2e15, 0x582f16, 0x5b3117, 0x603519, 0x663819, 0x6e3b1c, 0x78401e, 0x80451f, 0x8f4c22, 0xa36027, 0xa8612f, 0xa86a34, 0x6e3f1d, 0x49240a, 0x542c0d, 0x673c18, 0x7a4e26, 0x85592e, 0x7f4e16, 0xe5cb7e, 0xba9c5c, 0x543011, 0x432e19, 0x3b2715, 0x250b00, 0xae8853, 0x71532c, 0x34220f, 0x44301a, 0x482e14, 0x51361b, 0xa37e46, 0xd5a65f, 0x7c4d11, 0xe7cb84, 0xa99661, 0x2e0000, 0x3f2915, 0x463018, 0x433015, 0x3b2912, 0x2b1909, 0x200b00, 0x5e3a1a, 0x9e6d35, 0x9d723e, 0x3f2209, 0x4b361c, 0x432d13, 0x563c22, 0x563c21, 0x3f2b12, 0x32230f, 0x261204, 0x543418, 0x7c552f, 0x81592e, 0x69410e, 0xaf8f5e, 0xd2bc8a, 0x431500, 0x3d280e, 0x55361f, 0x947047, 0xc2995c, 0x926130, 0x9d6934, 0x9b6a2f, 0xa78046, 0xe4cd98, 0x998865, 0x6c5a41, 0x48321d, 0x59402a, 0x694d31, 0xbd9c6d, 0xbd9158, 0x8e5d28, 0x91632a, 0x9d6c32, 0xe6d29f, 0xb7a77f, 0x725a3b, 0x634729, 0x5c3b1e, 0x654422, 0x7e5d34, 0x8c673c, 0x684419, 0x624221, 0x5a3f1e, 0x443017, 0x2e190c, 0x38190b, 0x88643a, 0xd5b67b, 0x6c502b, 0x66431f, 0x916633, 0xa47334, 0xae7b3a, 0x9a6b30, 0x7c562a, 0x593d1d, 0x725336, 0x997943, 0xca9e57, 0xb4833e, 0xad7d39, 0xb2823c, 0xbb9145, 0xe5d394, 0xd1bc85, 0xa2804f, 0x91672b, 0xad7f3b, 0xbd8c40, 0xb07f38, 0x936937, 0x6b4929, 0x745634, 0xa37a48, 0xba8746, 0xb5843d, 0xbb863e, 0xb78036, 0xc19a4e, 0xe0c987, 0xe9d28d, 0xe7cf8b, 0xe3c984, 0xedcf85, 0xeece7a, 0xe1bb66, 0xe5ba65, 0xd9a954, 0xa27b40, 0x614228, 0x65482b, 0x876841, 0xc09454, 0xd0a04d, 0xcc9749, 0xc6903b, 0xca9744, 0xcda75d, 0xe2cc8d, 0xe6d296, 0xe8d292, 0xe8d192, 0xe5ce8c, 0xd8ba79, 0xc29751, 0xaa7e39, 0x916b33, 0x66461b, 0x42240d, 0x674724, 0x845e35, 0x79522d, 0x744b29, 0x7e552d, 0x734a1f, 0xcb964f, 0xa9783d, 0x82552d, 0x7c5431, 0x502e18, 0x9d7438, 0xe1aa52, 0xe2b154, 0xdfb759, 0xe0b362, 0xa47039, 0x915328, 0x94552c, 0x854a25, 0x7a4422, 0x6f3e1e, 0x6c3d1e, 0x64381b, 0x593218, 0x532e17, 0x4c2914, 0x4e2c16, 0x4f2e18, 0x442412, 0x422512, 0x402410, 0x3d2110, 0x3a200e, 0x371e0d, 0x341e0d, 0x311c0d, 0x2e1b0c, 0x2d1c0a, 0x29130d, 0x28130f, 0x261809, 0x261609, 0x261308, 0x241208, 0x211209, 0x1f1108, 0x1d1007, 0x1b0e05, 0x170d05, 0x160b04, 0x140b02, 0x140b03, 0x120a03, 0x100901, 0x0e0a01, 0x0d0803, 0x0b0803, 0x0a0702, 
-  0x090501, 0x090602, 0x0a0702, 0x0c0703, 0x0f0905, 0x120906, 0x130904, 0x170c04, 0x1a0f05, 0x1e1007, 0x241308, 0x291608, 0x2e190a, 0x351e0c, 0x3e220f, 0x452510, 0x4c2a14, 0x512b16, 0x542c17, 0x552d16, 0x522b14, 0x4f2a14, 0x4b2913, 0x472813, 0x472815, 0x4a2815, 0x462611, 0x4a2915, 0x4e2b14, 0x552e14, 0x5b3117, 0x62351b, 0x6b391a, 0x743d1d, 0x7a401e, 0x8a4d26, 0xc1864b, 0x9d5c2a, 0x9d5d29, 0x945c2f, 0x643615, 0x6b401b, 0x81532a, 0x754b21, 0x84592d, 0x714413, 0xceb069, 0xddc67b, 0x68411c, 0x452d1a, 0x402b1a, 0x0c0000, 0xa57f4b, 0x9d7a48, 0x2d1200, 0x2f1802, 0x896a45, 0xbe9864, 0xbe995d, 0x7f5e2c, 0x562800, 0xb29965, 0xdfc98c, 0xaf9265, 0x4f371c, 0x493018, 0x4b351c, 0x442f16, 0x392510, 0x1e0e02, 0x310300, 0xb28554, 0x9c794e, 0x391900, 0x4e381b, 0x51371b, 0x583b1d, 0x583b1e, 0x4b351a, 0x3b2a14, 0x241407, 0x412813, 0x6e4925, 0x865c30, 0x775025, 0x956c3b, 0xe6d2a4, 0x6f5033, 0x301800, 0x896748, 0x99744c, 0x6a4624, 0x603d20, 0x6b4722, 0x694627, 0x5c360f, 0x8c714a, 0xc9b385, 0xb6a279, 0x483315, 0x70543b, 0x9c7850, 0xa48153, 0x845929, 0x774d29, 0x754e28, 0x7b4c21, 0x846338, 0xbda375, 0xc1a375, 0x8c7148, 0x5d3f19, 0x674624, 0x734f23, 0x886231, 0x8c6638, 0x754e26, 0x6b4722, 0x5f4321, 0x422a17, 0x271107, 0x371100, 0xb0956b, 0x836643, 0x704a1f, 0x8b612d, 0xa37133, 0xb4813c, 0xa67534, 0x81592c, 0x46270e, 0x92714b, 0x937343, 0x6d4b27, 0x63441b, 0x62441e, 0x6c4924, 0x684012, 0x705830, 0xa99265, 0xa28558, 0x946d39, 0xaf8140, 0xbd8c40, 0xb3813b, 0x7f582b, 0x462b15, 0x8e6c46, 0x835f35, 0x5b3614, 0x614020, 0x694322, 0x653e1c, 0x663f16, 0x5f3807, 0x653d09, 0x6e4415, 0x70440d, 0x7a5321, 0x805c2c, 0x745024, 0x755025, 0x764f21, 0x62421d, 0x64492e, 0x4a2f19, 0x826540, 0x825e32, 0x5c3910, 0x67471e, 0x644016, 0x69471e, 0x633f14, 0x4d2400, 0x4e2700, 0x532b00, 0x562900, 0x552b00, 0x451500, 0x401800, 0x361000, 0x3e200c, 0x5d3f21, 0x795233, 0x805831, 0x714f29, 0x744c29, 0x845a2e, 0x7c532e, 0x704318, 0xc28e45, 0x8b5c2d, 0x835a34, 0x6f4d2e, 0x462202, 0xbe8f47, 0xdca64f, 0xe9bc5d, 0xe6c060, 0xcea255, 0x8d5524, 0x93572d, 0x8a4f27, 0x7d4622, 0x74411f, 0x683716, 0x805234, 0x6f4328, 0x573016, 0x532d15, 0x4a2814, 0x432514, 0x412410, 0x412414, 0x3e2213, 0x3c2111, 0x3b2011, 0x38200f, 0x351f0f, 0x341e0e, 0x311b0c, 0x31190b, 0x2c1a0c, 0x291909, 0x281708, 0x261609, 0x251509, 0x251409, 0x221208, 0x1f1108, 0x1d1007, 0x1b0e06, 0x190d05, 0x160c04, 0x150b04, 0x140a01, 0x130a02, 0x120a03, 0x0f0a01, 0x0d0901, 0x0c0803, 0x0a0702, 0x0a0702, 
-  0x0a0603, 0x0a0702, 0x0b0803, 0x0e0803, 0x130a05, 0x150a04, 0x180c04, 0x1d0f06, 0x201106, 0x261509, 0x2d190b, 0x331c0e, 0x381e0f, 0x3e2211, 0x432412, 0x432510, 0x42240e, 0x42230f, 0x412111, 0x412210, 0x41220f, 0x3f2210, 0x3e230f, 0x3e2310, 0x412414, 0x452714, 0x432410, 0x482714, 0x4e2a15, 0x522c12, 0x593117, 0x643616, 0x824d29, 0x824827, 0x7a401e, 0x824824, 0x965b30, 0x935827, 0x915427, 0x995b2d, 0x75411c, 0x714520, 0x82512a, 0x663c1a, 0x7e542a, 0x6a421b, 0x9f7e3e, 0xf2db88, 0x8d6e3e, 0x472816, 0x46321c, 0x220400, 0x876738, 0xbf9658, 0x452400, 0x311f0f, 0x3d240e, 0x402207, 0x340d00, 0x2e1605, 0x2c1909, 0x140000, 0x4c3114, 0x6c5133, 0x472e16, 0x412c14, 0x4a3418, 0x473117, 0x452e16, 0x2f1e0d, 0x180000, 0x715433, 0x694c2e, 0x4e341a, 0x523919, 0x56391c, 0x674725, 0x644624, 0x52391b, 0x3d2a12, 0x2b1d0c, 0x251305, 0x5a3c1f, 0x7b5427, 0x895d2f, 0x7f4d10, 0xdac699, 0xb19e78, 0x270000, 0x130000, 0x0f0000, 0x2c1a10, 0x2a190f, 0x322114, 0x372618, 0x2d1c0e, 0x1c0000, 0x190000, 0x341300, 0x402d1d, 0x170300, 0x200000, 0x240000, 0x341c0a, 0x372113, 0x352115, 0x3a2615, 0x2f1503, 0x120000, 0x391b00, 0x5a3c19, 0x785631, 0x714d25, 0x714d24, 0x755024, 0x8d6536, 0x8d6433, 0x795326, 0x6f4c26, 0x5a3c1f, 0x402a16, 0x311906, 0x4d311c, 0x6c4a27, 0x7e5528, 0x885d2d, 0x97692d, 0xb37f39, 0xb68339, 0x986c33, 0x5d3d1d, 0x1d0000, 0x270000, 0x2e160d, 0x231208, 0x23100b, 0x24100b, 0x29140a, 0x2f0f01, 0x2f0000, 0x543111, 0x876032, 0xa57738, 0xbc8b41, 0xb48039, 0x9e7440, 0x604426, 0x030000, 0x260e0b, 0x29150d, 0x2e170d, 0x2d170a, 0x2d190a, 0x311d0f, 0x301b0d, 0x2b1305, 0x2e1809, 0x331d0d, 0x341908, 0x361606, 0x3f2412, 0x43250c, 0x492b13, 0x654427, 0x735130, 0x4b3017, 0x2c0f00, 0x2f1405, 0x331b0d, 0x2e1609, 0x341e10, 0x311b0c, 0x3b200d, 0x3c2510, 0x392512, 0x3c2515, 0x3a2917, 0x3d2913, 0x4e331c, 0x5c3b21, 0x6e4a2a, 0x7f5933, 0x845c33, 0x78512b, 0x714e2b, 0x75502a, 0x895f31, 0x906132, 0x7c4e1f, 0xae7839, 0xa97735, 0x80542e, 0x815932, 0x5e3f25, 0x68461e, 0xdba756, 0xca9542, 0xdbaf57, 0xddb35b, 0xab7d3d, 0x93552a, 0x96592d, 0x874d26, 0x794421, 0x6e3f1f, 0x64391d, 0x5e3418, 0x5a3115, 0x553117, 0x512d15, 0x4a2914, 0x442511, 0x412512, 0x3f2313, 0x3d2214, 0x3b2112, 0x392010, 0x371f11, 0x341e0f, 0x311c0d, 0x301b0c, 0x2f190b, 0x2c180a, 0x29170a, 0x261609, 0x251509, 0x251409, 0x221208, 0x1f1208, 0x1d1007, 0x1b0e06, 0x190e05, 0x170d04, 0x160c03, 0x150b04, 0x140b02, 0x130a02, 0x120a03, 0x100903, 0x0e0804, 0x0c0703, 0x0a0702, 0x0a0702, 
-  0x0a0602, 0x0c0702, 0x0e0903, 0x110a03, 0x150b03, 0x190d05, 0x1f1007, 0x241209, 0x28150a, 0x2d190e, 0x311b0f, 0x331d0f, 0x331d0e, 0x341e0e, 0x341e0e, 0x321c0c, 0x301b0c, 0x2f1a0d, 0x30190b, 0x31190a, 0x311c0c, 0x321e0c, 0x38200e, 0x3c210f, 0x3e2111, 0x3f2215, 0x422412, 0x452511, 0x4d2914, 0x5c361e, 0x582d12, 0x5f3015, 0x6e3d1e, 0x713d1f, 0x6f3e1e, 0x723d1a, 0x824b23, 0xa46d45, 0x874b1f, 0x985a2f, 0x744120, 0x442004, 0x522f16, 0x523014, 0x6b481e, 0x6e471f, 0x6e400e, 0xdfc778, 0xc5ad69, 0x4f2305, 0x493319, 0x3e2b18, 0x52300e, 0xc19253, 0x886438, 0x37210c, 0x392811, 0x372410, 0x382611, 0x322310, 0x2e210f, 0x2d1e0b, 0x2a1b0b, 0x392612, 0x453118, 0x452f18, 0x4c321a, 0x4f361d, 0x4b321b, 0x3f2a17, 0x311d0c, 0x270d00, 0x422a0f, 0x52391d, 0x5e3f21, 0x69441e, 0x744e24, 0x6e4b23, 0x5d401e, 0x452f16, 0x352611, 0x1b0c02, 0x3f2614, 0x734f25, 0x845625, 0x804f1b, 0xa78b5e, 0xe5d6a7, 0x614626, 0x301a08, 0x2b1e0f, 0x2a1e0c, 0x302111, 0x311e13, 0x2f1e10, 0x301f0f, 0x382412, 0x452e17, 0x50351c, 0x52371f, 0x4a341c, 0x473016, 0x473019, 0x462e1b, 0x412916, 0x392312, 0x3d2613, 0x46311b, 0x412e1b, 0x47301c, 0x56381c, 0x6d4a22, 0x875f31, 0x81582c, 0x794f26, 0x7f5525, 0x8f6531, 0x835b2a, 0x765023, 0x714e27, 0x5d4020, 0x52371e, 0x4e3116, 0x6d4a24, 0x7c5329, 0x825727, 0x996a2e, 0xb5813b, 0xc48f43, 0xa77735, 0x875e2d, 0x65441e, 0x553a1e, 0x4e381f, 0x48321a, 0x4c351f, 0x513820, 0x573c1f, 0x664827, 0x7a5932, 0x835e31, 0x8c6131, 0x98682e, 0xae7d3b, 0xa87636, 0xb08240, 0xbb9254, 0x906d3e, 0x73522c, 0x74522c, 0x634222, 0x56371d, 0x53361f, 0x5c3d23, 0x654528, 0x745333, 0x6e4c29, 0x684624, 0x6e4a2a, 0x744e2b, 0x76502e, 0x815831, 0x845a2f, 0x8c5f31, 0x8e6132, 0x7d552f, 0x724e2e, 0x724f2d, 0x6a482a, 0x6b4a2d, 0x6d4b2c, 0x6f4d29, 0x7a5532, 0x714e2b, 0x72502f, 0x724d2e, 0x755130, 0x785432, 0x7d5932, 0x815a32, 0x815a30, 0x855b30, 0x895b30, 0x7e532b, 0x785029, 0x905f33, 0x845628, 0x956430, 0xc28a3d, 0xbe893d, 0x835423, 0x885d33, 0x734e2f, 0x43240e, 0xa0793b, 0xe3ae58, 0xd9a751, 0xdbb157, 0xd3a75c, 0x925e29, 0x9e6031, 0x96582a, 0x864b26, 0x754322, 0x693c1e, 0x5e351a, 0x5d341a, 0x5e3419, 0x5c351a, 0x522d14, 0x492812, 0x442512, 0x402314, 0x3e2313, 0x3b2311, 0x372010, 0x341e11, 0x331d0f, 0x3c2110, 0x3c2312, 0x2e190b, 0x2c180b, 0x2a180a, 0x28160a, 0x26160a, 0x25140a, 0x231208, 0x211208, 0x1f1108, 0x1c0f06, 0x190e05, 0x170d04, 0x160c03, 0x140b02, 0x130a02, 0x120a01, 0x120a03, 0x110a03, 0x100903, 0x0d0803, 0x0c0703, 0x0a0702, 0x090601, 
-  0x0b0702, 0x0e0802, 0x120a04, 0x150c04, 0x180e04, 0x1d1007, 0x211209, 0x25130a, 0x27140b, 0x28150b, 0x28150a, 0x281509, 0x261508, 0x251609, 0x251509, 0x241508, 0x241409, 0x261608, 0x271807, 0x2c180d, 0x30160a, 0x2b0900, 0x3a1f12, 0x3e2014, 0x40240f, 0x3f2411, 0x412514, 0x442412, 0x4e2c18, 0x6c4832, 0x6b4625, 0x7c5530, 0x5f3212, 0x603416, 0x63371c, 0x68391c, 0x804d2a, 0x885532, 0x7d451e, 0x92532b, 0x90562e, 0x5a3114, 0x492710, 0x5c391b, 0x65431f, 0x7b532e, 0x724622, 0xaa8c4c, 0xedd586, 0x815f32, 0x56381b, 0x4f3821, 0x3a1b06, 0x86592d, 0xb68953, 0x603e18, 0x432813, 0x4b341a, 0x4c341c, 0x4c341d, 0x463019, 0x452f19, 0x48331d, 0x4b3316, 0x543a1b, 0x553d20, 0x563a1e, 0x583b1c, 0x553a1c, 0x543a1c, 0x4c341a, 0x49311a, 0x55391d, 0x5d3e1e, 0x664423, 0x724d25, 0x815628, 0x7e562a, 0x674621, 0x4c3318, 0x3e2c14, 0x28190a, 0x200902, 0x5d3e20, 0x83582e, 0x825728, 0x7d4603, 0xdcc898, 0xbbaf84, 0x380000, 0x422b19, 0x43311b, 0x49361d, 0x50391e, 0x533a21, 0x543b21, 0x593d20, 0x664524, 0x714d26, 0x6f4d25, 0x6a4b24, 0x6f4d26, 0x603f1d, 0x5d3f1f, 0x5a3d1e, 0x5a3f1f, 0x5c4122, 0x5d3f1e, 0x654321, 0x634122, 0x694727, 0x6d4923, 0x80562e, 0x8c6234, 0x8a6029, 0x855b27, 0x84592c, 0x845a2c, 0x835a2d, 0x754e24, 0x6c4720, 0x63421d, 0x67461e, 0x7f5a2c, 0x875e2b, 0x8d602a, 0x9d6c32, 0xa16d2e, 0xac7732, 0xab7839, 0xa06d33, 0x996a34, 0x7d552a, 0x67441f, 0x6a4722, 0x78552a, 0x745127, 0x7a532a, 0x82572e, 0x855a2d, 0x895e2d, 0x966732, 0xa57436, 0xad7c39, 0xa37432, 0xa57331, 0xae7c3d, 0xb18549, 0x9e7234, 0xac7c3f, 0xa1743d, 0x8c622f, 0x8d6433, 0x7f562c, 0x7c5128, 0x83582d, 0x8d6032, 0x855a2c, 0x865d31, 0x855a2d, 0x7e552a, 0x8a5d2f, 0xa07039, 0xa87639, 0xaf7c3e, 0x9f6e38, 0x85592a, 0x7f5429, 0x714b27, 0x714d2c, 0x744e2a, 0x865f34, 0x7a542e, 0x7a532d, 0x7a5227, 0x7a5226, 0x845b30, 0x875c37, 0x794e22, 0x815529, 0x81572a, 0x895d2c, 0x966731, 0x95662f, 0x8f632e, 0x946730, 0xb17b37, 0xd19645, 0xbd853e, 0x7f4e1f, 0x83552d, 0x80572f, 0x6a492d, 0x4a230e, 0xcb9a4e, 0xdba750, 0xd9aa54, 0xdaaf58, 0xbe8f4f, 0x935727, 0xa36332, 0x925428, 0x824a26, 0x704020, 0x63381c, 0x593319, 0x5c371e, 0x5d371f, 0x623e26, 0x54311a, 0x472712, 0x432512, 0x3f240f, 0x3b230e, 0x382211, 0x361e11, 0x30180e, 0x301b0c, 0x3e2513, 0x422918, 0x2c1709, 0x2b190b, 0x29170a, 0x27160a, 0x26150b, 0x25140a, 0x231208, 0x201108, 0x1e0f07, 0x1b0e06, 0x190e05, 0x170d04, 0x160c03, 0x140b02, 0x140b03, 0x120a03, 0x120b03, 0x100903, 0x0f0803, 0x0c0703, 0x0b0602, 0x0a0702, 0x080500, 
-  0x0e0803, 0x120a03, 0x140a04, 0x160c04, 0x1a0e05, 0x1c0f07, 0x1c0f07, 0x1d0f07, 0x1c0f06, 0x1c1006, 0x1d0f06, 0x1d0f06, 0x1d1006, 0x1d1007, 0x1d1007, 0x1f1108, 0x231209, 0x261409, 0x251708, 0x270f07, 0x603c22, 0x8a623e, 0x48220c, 0x3c1d13, 0x3e2310, 0x402212, 0x402414, 0x432514, 0x462613, 0x421c04, 0x7a5734, 0x926b42, 0x572b07, 0x684024, 0x61371c, 0x5b3218, 0x683a1c, 0x693918, 0x734020, 0x864925, 0x995b2d, 0x784722, 0x5e381c, 0x704a27, 0x644021, 0x754e2b, 0x7b5729, 0x7b4b1c, 0xe9cf80, 0xc0a464, 0x63391c, 0x543820, 0x4b2f19, 0x432103, 0x9d713e, 0xc0965f, 0x8d714a, 0x4c3516, 0x3c240a, 0x4b331b, 0x4e371e, 0x432f17, 0x47311b, 0x4c3118, 0x4b2d11, 0x543719, 0x5f3e19, 0x624220, 0x5f4122, 0x62401f, 0x4a2806, 0x4d341a, 0x624227, 0x704a25, 0x855e2d, 0x80562a, 0x8b5f30, 0x845b2d, 0x6f4d26, 0x53371a, 0x442c16, 0x382510, 0x1f1002, 0x361d0c, 0x6b4525, 0x7a4f25, 0x815021, 0x956f41, 0xead7a9, 0xa79671, 0x492600, 0x432b15, 0x4c3620, 0x563d22, 0x604223, 0x60401f, 0x6f4d27, 0x7e572c, 0x825727, 0x805729, 0x7c5128, 0x85562a, 0x8d6032, 0x7c5329, 0x714b22, 0x724d24, 0x704a22, 0x734c25, 0x734c23, 0x744f26, 0x744e25, 0x785028, 0x7b5128, 0x8e6435, 0x996e39, 0x936735, 0x84592b, 0x7f5427, 0x885e2f, 0x865d2e, 0x7c5528, 0x80592d, 0x7d5527, 0x865c2a, 0x8f612a, 0x99682d, 0xa06d30, 0xa06c31, 0xa16f2e, 0xa16f32, 0xa67436, 0xa57433, 0xa47437, 0x926730, 0x835a29, 0x835a2b, 0x805729, 0x896030, 0x916534, 0x8f622f, 0x956730, 0xa57535, 0xa77533, 0xa26f2f, 0xa67635, 0xa37335, 0xa37238, 0x9e6e32, 0xa16f32, 0xa47034, 0xa37137, 0xa07032, 0xb48543, 0xaf7f44, 0x946429, 0xa07035, 0xa7773c, 0x9e7035, 0x986b33, 0x986933, 0x926734, 0x916530, 0x996a31, 0xaf7e3c, 0xba8740, 0xb68441, 0xac7b3c, 0xac7c40, 0x8c6333, 0x7a542a, 0x825b2e, 0x906538, 0x744d29, 0x734a23, 0x946e3e, 0xa28454, 0x7d572d, 0x7c4f25, 0xa5793d, 0xbf944f, 0xa77638, 0xc09a5f, 0xe0c988, 0xe4d393, 0xebd496, 0xe5bc73, 0xdfa852, 0xcf964c, 0x774518, 0x84572b, 0x905f36, 0x744d2d, 0x54341d, 0x7b5425, 0xcf9648, 0xcd9b4a, 0xcc9d4d, 0xd4a557, 0xa36f34, 0x9f5f2c, 0x9f5e2d, 0x8c4f27, 0x7c4824, 0x6e3e1e, 0x61371b, 0x56321b, 0x4f2d17, 0x482710, 0x462712, 0x452713, 0x422513, 0x402412, 0x3d2310, 0x382111, 0x351e10, 0x422816, 0x4b3321, 0x2f180a, 0x2e190b, 0x2c180a, 0x2c190a, 0x2a170a, 0x28170a, 0x26150a, 0x25140a, 0x241209, 0x231108, 0x1f1008, 0x1d0e07, 0x1b0e06, 0x190e05, 0x160d04, 0x140b02, 0x140b02, 0x130a02, 0x110a02, 0x110a03, 0x100904, 0x0d0804, 0x0c0703, 0x0b0602, 0x0a0702, 0x090601, 
-  0x0e0903, 0x100a03, 0x120a04, 0x140a03, 0x150a03, 0x150a03, 0x160a04, 0x160b04, 0x150c04, 0x160d04, 0x190e05, 0x1b0e06, 0x1c0f07, 0x1d0f08, 0x1f1008, 0x211109, 0x24120a, 0x27140b, 0x26170b, 0x210802, 0x6b452a, 0xa47852, 0x4a240a, 0x3b1c10, 0x3e2114, 0x402213, 0x402212, 0x3e1e04, 0x3e1f0c, 0x432614, 0x49260c, 0x4e2611, 0x4f2a14, 0x5c381f, 0x563117, 0x5a3218, 0x64391d, 0x64391e, 0x693a1c, 0x77401e, 0x8e5229, 0x76411f, 0x4a2810, 0x482a0f, 0x452711, 0x5b3918, 0x754e25, 0x6b3309, 0xbea35d, 0xebd589, 0x865b33, 0x5d3b1d, 0x583f24, 0x432e1a, 0x442200, 0x936e41, 0xc6a56b, 0xaf8b59, 0x917049, 0x6a4c2c, 0x5c391b, 0x55361e, 0x402a10, 0x5e3e23, 0x986d40, 0x8c6232, 0x886138, 0x613f1c, 0x684119, 0x9b7346, 0x967c52, 0x512e08, 0x634025, 0x734f26, 0xa1733e, 0x936436, 0x835a2d, 0x7c5328, 0x78532c, 0x694726, 0x4e3218, 0x412b13, 0x36220d, 0x260d00, 0x452814, 0x623e22, 0x794f29, 0x8d5d27, 0xac8758, 0xebd9a2, 0xbeae7e, 0x614522, 0x401300, 0x432302, 0x63401c, 0x6c4923, 0x6d4a20, 0x855d2e, 0x875c2b, 0x875d2d, 0x8f6231, 0x8c5d29, 0x8d602c, 0x8b5f2d, 0x85592a, 0x7f5428, 0x875c32, 0x7c5226, 0x7d5628, 0x7e5729, 0x7c5528, 0x785024, 0x744e22, 0x734c1f, 0x784d1f, 0x7c5121, 0x895f2e, 0x916735, 0x8a5f2d, 0x855927, 0x885f2e, 0x8b6132, 0x805627, 0x855926, 0x96652d, 0xa47033, 0xa57232, 0xa36f31, 0xa67433, 0x9c6c2d, 0x95652b, 0x9d6e33, 0x96672d, 0x986b34, 0x8a602e, 0x875c2b, 0x8b5e2a, 0x9b6e30, 0xa17334, 0xa67638, 0xa87737, 0xa97734, 0xa97732, 0xad7c3a, 0xa9783a, 0xb38342, 0x9c6c2b, 0xa67534, 0xad7b38, 0xa87737, 0x9a6a2e, 0xa06f35, 0xa27234, 0xa77735, 0xa87735, 0xae7d39, 0xb68440, 0xa97735, 0xaa7836, 0xad7b3a, 0xa67737, 0xa87839, 0xb48441, 0xbb8b44, 0xb9863f, 0xb88541, 0xb27f3d, 0xa57234, 0x9b6d37, 0x936833, 0x8e6333, 0x916332, 0x815831, 0x926832, 0xd6ac64, 0xe7c586, 0xa27142, 0x784b21, 0xc39a5b, 0xfbe090, 0xe5c075, 0xb08443, 0xd6b36e, 0xd5b26d, 0xbe965a, 0xa67638, 0x7c511d, 0x8e5f2b, 0xba863f, 0xb68241, 0x86582c, 0x6d462a, 0x452112, 0xa97738, 0xc08a3c, 0xca9b4d, 0xc6984c, 0xbc8b46, 0x9f612a, 0xac6934, 0x945527, 0x844822, 0x774422, 0x6d3e1d, 0x5f361a, 0x53301a, 0x4c2a16, 0x51311d, 0x482814, 0x412411, 0x3e2414, 0x3d2213, 0x372110, 0x351f10, 0x321b0b, 0x48311f, 0x5a4330, 0x2b1407, 0x2b190e, 0x2a190c, 0x2b1908, 0x281609, 0x27160a, 0x25140a, 0x241309, 0x231309, 0x211209, 0x200f07, 0x1c0e05, 0x190e05, 0x170d04, 0x160d04, 0x140b03, 0x130a03, 0x120a02, 0x110a02, 0x100a04, 0x0f0905, 0x0c0804, 0x0b0702, 0x0a0702, 0x090601, 0x090601, 
-  0x0d0803, 0x0d0803, 0x0e0803, 0x100903, 0x110903, 0x120a03, 0x120a04, 0x130a04, 0x130a03, 0x150b02, 0x180d04, 0x1a0d05, 0x1c0e06, 0x1e0f08, 0x1f1109, 0x221209, 0x25130a, 0x29150a, 0x29180b, 0x2c180f, 0x2f1206, 0x2d0400, 0x381d09, 0x381f10, 0x3c2113, 0x3c2012, 0x341400, 0x8e694a, 0x80583c, 0x3e1908, 0x412412, 0x442510, 0x4d2e19, 0x4e2d18, 0x4f2d18, 0x633e24, 0x5f371b, 0x593316, 0x623717, 0x82512d, 0x844b21, 0x85502c, 0x452810, 0x231001, 0x452811, 0x59361c, 0x7d5430, 0x7f5225, 0x8d6428, 0xf2df8e, 0xb99b5f, 0x69401e, 0x54381f, 0x53391f, 0x493118, 0x3c2a14, 0x3f2500, 0x6a4825, 0x8b6a41, 0x84613a, 0x8b643b, 0x886339, 0x563614, 0xa77c49, 0xa16d38, 0xac8044, 0x906d42, 0x351601, 0x523115, 0x906737, 0xe7cf94, 0x937b50, 0x633410, 0x674623, 0x84592c, 0x845b2e, 0x6f4a25, 0x6d4823, 0x75512b, 0x704f29, 0x5d3f1d, 0x51371c, 0x462e16, 0x39230f, 0x240e01, 0x321a0a, 0x492c18, 0x5b3618, 0x784916, 0xa0753f, 0xdac088, 0xe1cc92, 0xc6ad74, 0xc09c62, 0xbda171, 0x694824, 0x694522, 0x7c5328, 0x865b27, 0x8e622a, 0xa07036, 0xa37239, 0x946530, 0x90642e, 0x885e29, 0x875d2c, 0x885f2f, 0x845c2b, 0x815829, 0x7e5427, 0x7c5328, 0x7b5328, 0x744e26, 0x744d23, 0x865b2f, 0x7f5325, 0x835727, 0x8f6430, 0x976c3c, 0x8b5f2e, 0x815625, 0x875b2a, 0x885b28, 0x9a6c36, 0x99682f, 0xa17031, 0xa47231, 0x9b672c, 0x9f6b31, 0x94622c, 0x966630, 0x976a2f, 0x996b32, 0x976a32, 0x936732, 0x90642f, 0x936430, 0xa47437, 0xad7d3e, 0xa47336, 0xab7b3b, 0xbc8d44, 0xcc9f52, 0xae7f3a, 0xac7b38, 0xb88744, 0xb07f3e, 0xaa7839, 0xb3833c, 0xb7873e, 0xaf7f3b, 0xb3833f, 0xbc8d47, 0xa57632, 0xa67632, 0xba8a43, 0xb5843d, 0xbb8942, 0xc19047, 0xc19148, 0xb3823b, 0xae7d39, 0xba8944, 0xbb8c45, 0xb98941, 0xb8873e, 0xb4833c, 0x9d6b30, 0x9d6c35, 0x96682f, 0x906432, 0x8a6133, 0x784e29, 0xc8944c, 0xd39e46, 0x91662b, 0x8c5e2d, 0x7b5027, 0x461f00, 0xa28047, 0xefc670, 0xc39950, 0x561c00, 0x815526, 0x8b5d32, 0x69431d, 0x82542b, 0xc38747, 0xd59752, 0xa6703b, 0x784a27, 0x5e3b23, 0x734d21, 0xc58c43, 0xc18d41, 0xd5a656, 0xc8994e, 0xa06c32, 0xa76532, 0xa3612e, 0x8c4f22, 0x884e27, 0x764120, 0x693b1b, 0x5c3419, 0x502e18, 0x462611, 0x5b3d2a, 0x472a17, 0x3c210f, 0x3a2212, 0x382010, 0x351f0e, 0x341e0f, 0x321c0d, 0x2f1808, 0x281302, 0x2a190a, 0x2a180a, 0x2a180b, 0x29160b, 0x27160a, 0x251408, 0x241309, 0x241309, 0x221309, 0x1f1108, 0x1e0f07, 0x1b0d05, 0x180e05, 0x170d04, 0x160c03, 0x140b04, 0x130a03, 0x130a03, 0x120902, 0x100804, 0x0e0804, 0x0c0703, 0x0a0701, 0x0a0702, 0x090601, 0x080601, 
-  0x090502, 0x0a0502, 0x0a0502, 0x0b0602, 0x0d0804, 0x0e0903, 0x110a04, 0x120b05, 0x140b03, 0x160c03, 0x190e05, 0x1c0e06, 0x1d0f07, 0x1e1108, 0x201208, 0x241308, 0x27150a, 0x2a170b, 0x2d180b, 0x301a0e, 0x311c11, 0x301b10, 0x321d0e, 0x351f0e, 0x3a2010, 0x3c1f14, 0x3d1f0e, 0x643f24, 0x683f25, 0x472613, 0x4a2f1d, 0x3e210f, 0x472a17, 0x4d2f1d, 0x4d2f1c, 0x4a270f, 0x542e13, 0x5e361b, 0x643819, 0x80512d, 0x784224, 0x844b28, 0x724322, 0x532b14, 0x6c4527, 0x643e27, 0x6b4721, 0x906432, 0x8e571f, 0xd5bc6d, 0xe4d281, 0x794c23, 0x52331b, 0x51361f, 0x6f502c, 0x987549, 0x301004, 0x000000, 0x160000, 0x391900, 0x52341c, 0x4f2f12, 0x8d6235, 0x9f6c35, 0x94652c, 0x613f18, 0x3e2507, 0x513b1e, 0x371f0f, 0x603200, 0xc6a870, 0xe4d69b, 0x785226, 0x7c4d28, 0x755128, 0x6f4c27, 0x724c27, 0x734d27, 0x704b26, 0x6f4b26, 0x6a4824, 0x593a1a, 0x4d3317, 0x402a12, 0x382411, 0x251407, 0x1c0a03, 0x392012, 0x4b2a19, 0x603516, 0x703e03, 0x936d3e, 0xa07e4c, 0x886537, 0x6c512e, 0x583816, 0x714d28, 0x7a5128, 0x7c5225, 0x805426, 0x8c5e2c, 0x9d6d3b, 0x895825, 0x875726, 0x895b2d, 0x895e2f, 0x85592a, 0x895d2e, 0x835729, 0x7e5225, 0x7d5326, 0x7c5228, 0x754d23, 0x7d5528, 0x8b602f, 0x845926, 0x8c622e, 0x825826, 0x845929, 0x875d2d, 0x855a29, 0x8e612e, 0x91622d, 0x95662e, 0x926228, 0xa5753a, 0x9f6e32, 0x8e5c26, 0x99672e, 0x96652c, 0x98682f, 0x92652a, 0x986a2f, 0x966830, 0x8c5f29, 0x95692f, 0x9a6b33, 0x9f6e36, 0x966628, 0xb58544, 0xa67634, 0xa1722a, 0xcea052, 0xbe8f45, 0xa67230, 0xb17e3b, 0xa47330, 0xa97934, 0xb18239, 0xb3833c, 0xa67630, 0xa87832, 0xae7d38, 0xa47431, 0xb0813d, 0xac7d38, 0xab7a36, 0xac7b35, 0xb6853c, 0xcc9e53, 0xd3a65b, 0xc6984d, 0xb5853d, 0xb2833c, 0xb88743, 0xb7863f, 0xbb8941, 0xb38240, 0x9d6d31, 0x976936, 0x875c2f, 0x724a25, 0x976a34, 0xcb9142, 0xbb8a46, 0x4a2907, 0x916a42, 0xa57846, 0x714e26, 0x3a0000, 0xa47738, 0xdaae5c, 0x78552b, 0x6c4b27, 0xb78a4e, 0xc39659, 0xcd9a58, 0xb37d40, 0x825223, 0x8a5b2e, 0x7c4e2d, 0x492512, 0xb4823f, 0xce9242, 0xbe8b3e, 0xc79948, 0xba8a41, 0x8f5527, 0xa36130, 0x975727, 0x884b1f, 0xb27a55, 0x7f4c2c, 0x633619, 0x573017, 0x4f2d17, 0x472813, 0x3e210c, 0x3b210f, 0x382011, 0x351f10, 0x331d0d, 0x321c0c, 0x311a0d, 0x2f1a0d, 0x2e1b0c, 0x2b1a0c, 0x29180c, 0x2a1709, 0x291608, 0x27160b, 0x241409, 0x221208, 0x211308, 0x201208, 0x1f1108, 0x1e1006, 0x1c0e05, 0x190d05, 0x160c03, 0x160c03, 0x150b02, 0x140b04, 0x130a03, 0x130a03, 0x120902, 0x110804, 0x0f0704, 0x0c0703, 0x0b0802, 0x0a0702, 0x0a0601, 0x080500, 
-  0x090501, 0x090501, 0x0a0502, 0x0b0603, 0x0d0703, 0x0f0904, 0x110a04, 0x120b04, 0x140b03, 0x150c03, 0x180d05, 0x1b0e06, 0x1e1107, 0x211107, 0x241308, 0x271508, 0x281609, 0x2a180a, 0x2e180c, 0x311a0a, 0x331a0a, 0x311a0d, 0x311a0d, 0x341b0e, 0x381d10, 0x3a1d11, 0x3e1f11, 0x3c1d0f, 0x371d0e, 0x402614, 0x492f1c, 0x3a2010, 0x3b2011, 0x3c200f, 0x3e210e, 0x4a2a16, 0x552f18, 0x5e361e, 0x663b20, 0x6c3e1e, 0x6b3b1b, 0x7a4421, 0x754723, 0x44260f, 0x482910, 0x46240c, 0x532e10, 0x83582a, 0x97652e, 0xab833d, 0xf6e38e, 0xaf9358, 0x5f3a1b, 0x4c351e, 0x3c2011, 0x775027, 0x966a37, 0x765029, 0x724d27, 0x8b6139, 0x563818, 0x754e28, 0xaa733a, 0x966431, 0x6c4a24, 0x392212, 0x472e15, 0x674525, 0x5f4027, 0x4b2809, 0x845716, 0xe3d192, 0xc9b57e, 0x844c16, 0x6b451f, 0x623f22, 0x7a542a, 0x79532b, 0x6b4823, 0x6a4624, 0x654222, 0x5e3e1e, 0x513618, 0x472e14, 0x4a331b, 0x442f17, 0x3d2915, 0x2e1c0b, 0x271506, 0x392310, 0x432812, 0x320900, 0x2c0100, 0x351e0a, 0x4c301d, 0x644323, 0x785227, 0x7a5225, 0x7a5127, 0x80562a, 0x7e5320, 0x976c36, 0xa1763d, 0x90632d, 0x8f632f, 0x8d622d, 0x90632c, 0x976831, 0x8b5e2a, 0x8e622d, 0x865b2a, 0x84592e, 0x7a5326, 0x805928, 0x8a602d, 0x875d2b, 0x875e2b, 0x855b2b, 0x80572a, 0x895f32, 0x855929, 0x8f6433, 0x895b28, 0x92632e, 0x8e5f28, 0x966730, 0x986930, 0x8f602a, 0x9f7134, 0xa27130, 0xa27334, 0x9f7135, 0x986a2e, 0x9e7037, 0x93642e, 0x97692f, 0xa27233, 0x9e6c31, 0xa37236, 0xaf7e39, 0xa97735, 0x9d6d32, 0xa37432, 0xb4843e, 0xc29148, 0xb2823a, 0xa57333, 0x9d6c31, 0xa17133, 0xa67534, 0xaf7e3b, 0xb1813c, 0xb5853e, 0xa47430, 0xab7c37, 0xb4843e, 0xb0803b, 0xad7d3a, 0xad7c39, 0xb08039, 0xb5863e, 0xbd9047, 0xbb8d47, 0xb08342, 0x9a6d31, 0xa37437, 0xb78545, 0xbb8b49, 0x9c6d33, 0x8c6034, 0x7a502a, 0x7f5326, 0xcc974b, 0xc79248, 0x765028, 0x402509, 0x88653b, 0x996e3a, 0xaa7b45, 0x613f21, 0x5c3010, 0xc59345, 0xb68749, 0x5c2f15, 0x946635, 0xb4834a, 0x77491c, 0x744d26, 0x83522a, 0xa77243, 0x7e552f, 0x72491f, 0xd49a4a, 0xd49c4b, 0xcd9b4c, 0xcfa051, 0xad7b40, 0x8f4f24, 0x995729, 0x8d4e25, 0x814721, 0x7a421e, 0x6a3a1a, 0x5d3319, 0x572f16, 0x4f2b14, 0x4c2a15, 0x462815, 0x3b2211, 0x351f10, 0x311d0e, 0x2f1b0a, 0x2e1b0b, 0x2d1a0c, 0x2c190b, 0x2c190b, 0x2d1607, 0x2a1001, 0x2a1709, 0x271709, 0x261607, 0x211407, 0x1f1307, 0x211309, 0x1f1108, 0x1d0f06, 0x1c0e06, 0x1a0d05, 0x170d04, 0x150b03, 0x150b02, 0x150b02, 0x130a03, 0x120902, 0x120a02, 0x110902, 0x0f0803, 0x0c0804, 0x0b0803, 0x0a0701, 0x0a0702, 0x0a0702, 0x080500, 
-  0x080601, 0x090601, 0x090501, 0x0c0602, 0x0f0804, 0x110a03, 0x110902, 0x130b03, 0x140b03, 0x160c03, 0x180d04, 0x1d1007, 0x201207, 0x241307, 0x251307, 0x291305, 0x361804, 0x381b03, 0x2e190d, 0x2b1a0c, 0x2d1a0a, 0x2c190b, 0x2e1a0b, 0x301a0e, 0x321b0f, 0x341d0d, 0x381e0d, 0x3d200f, 0x3b2010, 0x371f11, 0x371e0f, 0x382112, 0x381f12, 0x391f10, 0x3d2312, 0x422613, 0x482810, 0x4f2d15, 0x5c3921, 0x593118, 0x61361d, 0x733e21, 0x7f4b26, 0x61391b, 0x361a08, 0x3f220c, 0x4c280f, 0x7a4f2a, 0x976a32, 0x8b581c, 0xd4ba6e, 0xe7d686, 0x7d532d, 0x462915, 0x442e1c, 0x3c200b, 0x8d663b, 0x7e5128, 0x976437, 0xa47043, 0x462604, 0x946737, 0xa76f36, 0x8a6233, 0x361c09, 0x472a0b, 0x9a7141, 0x8a5f33, 0x744e27, 0x321a04, 0x592e05, 0xa77a3f, 0xebd692, 0x977b4a, 0x673c1a, 0x5e3e1d, 0x704a28, 0x6a4827, 0x553817, 0x5c4021, 0x634325, 0x5c3c20, 0x5c4023, 0x52381b, 0x543a1c, 0x53381a, 0x4f3517, 0x553b1d, 0x50371a, 0x503519, 0x513216, 0x543619, 0x5b3c1d, 0x5e3e1c, 0x60421c, 0x6e4b25, 0x7a5128, 0x7c5327, 0x7b5225, 0x855b2f, 0x7d5529, 0x7a5327, 0x795125, 0x7a542a, 0x714d23, 0x7a5429, 0x855a2c, 0x936431, 0xa1733c, 0x93662d, 0x986d39, 0x7e5426, 0x764f24, 0x774f24, 0x774e22, 0x795124, 0x7e5528, 0x825729, 0x774e22, 0x81582b, 0x825828, 0x805525, 0x815625, 0x8c5d29, 0x956630, 0x8f612b, 0x94672e, 0x976a36, 0x90622a, 0x9a692f, 0x9a692f, 0x96682a, 0xa5773a, 0x95672b, 0x996931, 0xa27134, 0xad7c36, 0xa87534, 0xa37033, 0x9c6c2d, 0x996b33, 0x8c612d, 0x805623, 0x7b4f1f, 0x91642d, 0x95692b, 0xa07335, 0xa47536, 0xac7c38, 0xb1823b, 0xb38338, 0xbf9040, 0xca9847, 0xc29145, 0xb6853b, 0xb9883c, 0xba8a3e, 0xb4843c, 0xa97a36, 0xa0712f, 0xa57435, 0x976529, 0x865822, 0x8c6235, 0x7f572b, 0x936a31, 0x8b5b1e, 0x95672f, 0x966a35, 0x7f532c, 0x704820, 0xbf8e48, 0xd59e4d, 0xaa7b3c, 0x724b21, 0x66421f, 0x926d3e, 0xcea461, 0xbc8c48, 0x966736, 0x5b341b, 0x9a672a, 0xc5924c, 0x7e582e, 0x5b2d07, 0xb07c46, 0x926435, 0x79502b, 0x9b693b, 0xa26c3b, 0x623716, 0xb38042, 0xd69d47, 0xd9a950, 0xc49443, 0xc8994e, 0x925a2c, 0x9e5d2d, 0x9a562a, 0x884b26, 0x794220, 0x6e3b1c, 0x63361c, 0x5b3319, 0x562f15, 0x532d16, 0x542f19, 0x482714, 0x3d2210, 0x351e0e, 0x2f1b0c, 0x2c190a, 0x2b190b, 0x2b190b, 0x2b180a, 0x241001, 0x553e2b, 0x694f3b, 0x1f0900, 0x23160d, 0x23130a, 0x1f1208, 0x1f1308, 0x1f1108, 0x1d0f07, 0x1c0e06, 0x1b0c05, 0x180d04, 0x160c03, 0x150a04, 0x150b03, 0x150b02, 0x130a03, 0x120902, 0x100801, 0x0f0901, 0x0d0903, 0x0a0702, 0x0a0702, 0x0a0701, 0x0a0702, 0x090601, 0x070500, 
-  0x080500, 0x090601, 0x0a0702, 0x0c0802, 0x0e0803, 0x110a04, 0x120b03, 0x130c04, 0x140b02, 0x160c03, 0x1a0d05, 0x1e1007, 0x211109, 0x231307, 0x211206, 0x3e2009, 0x906033, 0x80512a, 0x2f1606, 0x27150b, 0x2b1709, 0x29180b, 0x291709, 0x2c190b, 0x2f190c, 0x301a0c, 0x331907, 0x513624, 0x422717, 0x371e10, 0x382011, 0x3a2112, 0x3b1f10, 0x3f2210, 0x3d2110, 0x3c1c07, 0x422106, 0x442610, 0x462815, 0x4e2b16, 0x5c331b, 0x6b3b1e, 0x804824, 0x9a613c, 0x6a3c1e, 0x5e381c, 0x5f3a1a, 0x663c1f, 0x8c5f2f, 0x855325, 0xa47c3b, 0xf7e48c, 0xb1955c, 0x5a3019, 0x462f19, 0x4f321e, 0x3b210b, 0x442307, 0x80522a, 0x774b26, 0x4a2d10, 0x815326, 0xa26c38, 0x6c4a25, 0x260900, 0x916c3e, 0x966b3a, 0x764a20, 0x68421f, 0x351f0d, 0x270e01, 0x6b3b02, 0xbd9754, 0xddc480, 0x6f4d22, 0x5d3817, 0x6f4927, 0x724a28, 0x7c5a30, 0x735024, 0x755128, 0x5f3c17, 0x55361c, 0x53381d, 0x4c2e16, 0x5d3b1f, 0x5f4022, 0x5d411d, 0x654620, 0x6c4925, 0x734e28, 0x724c25, 0x7a532a, 0x7c552a, 0x765027, 0x815731, 0x79532b, 0x6d4924, 0x694422, 0x694621, 0x60401f, 0x533417, 0x4f2e12, 0x542e10, 0x542e02, 0x5e3a07, 0x6d461a, 0x794e25, 0x895c2a, 0x946831, 0x7f5423, 0x81572b, 0x775026, 0x7a542c, 0x775128, 0x795126, 0x7f5628, 0x7e5326, 0x7e552a, 0x7e5424, 0x7c5326, 0x7f5426, 0x835825, 0x8c5d23, 0x9f6e33, 0x9f7237, 0xa1763d, 0x976a37, 0x8e632b, 0x8b5c25, 0x9c6932, 0xa17033, 0xa27233, 0xa57436, 0xa8763a, 0xa57435, 0xac7d3b, 0xb8894b, 0xa07139, 0x835722, 0x79501d, 0x835c29, 0x896734, 0x937240, 0x926d36, 0x916a36, 0x845925, 0x845720, 0x95672d, 0xa67737, 0xb6863e, 0xb7893c, 0xc28f42, 0xb58338, 0xb1803b, 0xbc8940, 0xb07e39, 0x9a6d36, 0x865d2d, 0x875d29, 0xa98147, 0xb2915a, 0x976f3d, 0x986533, 0xb48f50, 0xe1c882, 0xd9bd7f, 0xa07943, 0x855c2e, 0x68401f, 0x9e733a, 0xd49c4c, 0xb5833d, 0x7a4f24, 0x8d6435, 0x956c3b, 0x70461f, 0xb99157, 0xd7a458, 0xa06d35, 0x693f1c, 0x996330, 0xc79146, 0x9a6c35, 0x9e6c3a, 0xa6723a, 0x855629, 0x8f5e34, 0x86572c, 0x734a25, 0x7d4c25, 0xd79f56, 0xd3a14d, 0xd6a853, 0xd8a858, 0xaa7b3d, 0x904f21, 0xa35e2d, 0x97562b, 0x854a23, 0x703c1c, 0x65371c, 0x5f3219, 0x593017, 0x542d14, 0x4e2b14, 0x4a2a13, 0x422511, 0x3c2211, 0x341e0d, 0x2d1a0b, 0x2a1809, 0x29170b, 0x291909, 0x2b1505, 0x290f00, 0x382515, 0x402b1d, 0x251205, 0x22140a, 0x1f1308, 0x1e1107, 0x1d0f06, 0x1c0e05, 0x1c0d06, 0x1b0d06, 0x180e05, 0x160d04, 0x150c03, 0x140b02, 0x130a03, 0x130a03, 0x120a03, 0x110901, 0x100901, 0x0f0802, 0x0d0802, 0x0c0703, 0x0b0602, 0x090702, 0x090601, 0x090502, 0x070501, 
-  0x090601, 0x090702, 0x0a0702, 0x0c0702, 0x0d0802, 0x110a03, 0x120b03, 0x130c04, 0x150c03, 0x160d04, 0x190e05, 0x1d0f07, 0x1e1008, 0x211208, 0x211105, 0x3f230b, 0x7f522a, 0x6f4321, 0x2e1304, 0x26140a, 0x29160c, 0x28180e, 0x28180b, 0x29180b, 0x2b180b, 0x2c190c, 0x2e1a0d, 0x341d0d, 0x341d0e, 0x341d0f, 0x351d0c, 0x351905, 0x5c3d2c, 0x8b6c56, 0x340d00, 0x6a4b36, 0x664531, 0x3f1c07, 0x482b1a, 0x573721, 0x603b22, 0x663719, 0x7e4623, 0x92542b, 0x77401d, 0x5f3517, 0x5d391c, 0x4a260b, 0x734d25, 0x906232, 0x814e17, 0xd5b76d, 0xecd787, 0x825928, 0x472a11, 0x533722, 0x583a1f, 0x4c2b0d, 0x8a5e30, 0x5c3917, 0x4a2e13, 0x7c4e25, 0xa37142, 0x4d2e14, 0x432606, 0xb38550, 0x78502b, 0x5a3a1c, 0x432c12, 0x47331a, 0x352311, 0x40210b, 0x815218, 0xcdab66, 0xccb67a, 0x613907, 0x593912, 0x784f2c, 0xb48758, 0xb68851, 0xbb9459, 0xccad78, 0x705230, 0x6b4b2a, 0x8a683d, 0x7d5a30, 0x623b14, 0x5f3d1f, 0x624120, 0x6d4920, 0x744e24, 0x6c4720, 0x714c25, 0x734f26, 0x6f4a23, 0x704824, 0x644321, 0x563a1c, 0x4e3218, 0x4f3216, 0x5c3c1c, 0x7e5c34, 0x987243, 0xb19159, 0xbca06a, 0xb89c6b, 0xa58657, 0x8a6231, 0x724308, 0x825523, 0x85592e, 0x765026, 0x765229, 0x744e25, 0x7d552d, 0x81582d, 0x7f5629, 0x7e5425, 0x845a29, 0x83592c, 0x784e25, 0x70471b, 0xc3995e, 0xc3a471, 0x916128, 0x9e753a, 0x9d7239, 0x94662f, 0x9c733c, 0xa1763d, 0xa07030, 0xa57334, 0xa27132, 0x9f6c2e, 0x9f6d30, 0x996a32, 0x8b5f29, 0x7e5321, 0x845b2d, 0xa27b49, 0xb5925a, 0xd0b577, 0xdcc584, 0xe4cd8a, 0xe8d38c, 0xe3cc8b, 0xd5be80, 0xbca066, 0x94713a, 0x885823, 0x8b5827, 0x9f7035, 0xb58841, 0xaf7f39, 0xbc8c4a, 0xab7834, 0x9d6c33, 0x754b27, 0x5e3715, 0xac894c, 0xebcf84, 0xf3dfa1, 0xe7d79f, 0xb6975a, 0xc19754, 0x9d7c4a, 0xa68b58, 0x825f35, 0x643c1a, 0x785a32, 0xd09e52, 0xc48f46, 0x835528, 0x855b2f, 0x7a4e20, 0x8b5e2e, 0x916633, 0x663913, 0xae7a38, 0xb67f3a, 0x8f5e30, 0xab7237, 0xd29647, 0x96602a, 0xb38247, 0xb88748, 0x88522e, 0x9a6637, 0x895a2c, 0x623310, 0xb88849, 0xd49c52, 0xcf9c4e, 0xd3a352, 0xc9974c, 0x925929, 0x9d5c29, 0x965227, 0x884822, 0x79411d, 0x6b3b1c, 0x61351b, 0x5c3219, 0x583018, 0x522e17, 0x4c2a15, 0x462712, 0x412411, 0x3a2110, 0x321e0d, 0x2b1a0b, 0x29180b, 0x291607, 0x230c02, 0x4d3b2b, 0x6c5845, 0x1d0000, 0x220f04, 0x24140a, 0x21130a, 0x1e1206, 0x1e1007, 0x1c0e06, 0x1c0f06, 0x1d0f07, 0x190d05, 0x170d04, 0x150c03, 0x140b02, 0x140b02, 0x130b03, 0x120a03, 0x110a02, 0x0f0902, 0x0e0801, 0x0c0702, 0x0c0703, 0x0c0703, 0x0a0702, 0x080601, 0x090602, 0x080401, 0x060401, 
-  0x0a0702, 0x0a0702, 0x0a0803, 0x0d0903, 0x0e0903, 0x110a03, 0x110a02, 0x120b03, 0x130a03, 0x140b02, 0x170d04, 0x190e05, 0x1c0f05, 0x1f1005, 0x201108, 0x221307, 0x280e01, 0x280f04, 0x23130b, 0x24140d, 0x27130b, 0x27140b, 0x27160c, 0x27170c, 0x28180c, 0x29190d, 0x291a0f, 0x2c1a0c, 0x2c1a0e, 0x331e11, 0x382314, 0x331c0d, 0x482916, 0x492a15, 0x331601, 0x6e503b, 0x704f39, 0x3f1d09, 0x412514, 0x4d2d16, 0x583319, 0x6c3f23, 0x7b4422, 0x93542b, 0x9a5d33, 0x653718, 0x3e1d04, 0x3f2107, 0x4c2e10, 0x794e24, 0x835127, 0x986c2f, 0xf1d983, 0xc6a965, 0x704827, 0x4c2c17, 0x5a371d, 0x48270c, 0x8f6135, 0x8b5c34, 0x492a14, 0x824f27, 0x97622c, 0x452912, 0x694420, 0xb57f46, 0x5d3103, 0x452a0d, 0x503918, 0x492e14, 0x3f2511, 0x2c1d0b, 0x5d3817, 0x925c1b, 0xd6b578, 0xbea672, 0x522600, 0x5b3820, 0x3f1d00, 0x573316, 0x562c0b, 0xad8b5b, 0xc8a469, 0xa37b4d, 0xb28b57, 0xe0bd7e, 0xc5a870, 0x674416, 0x63401e, 0x77542d, 0x6f4b24, 0x664422, 0x654524, 0x62411e, 0x644423, 0x67451e, 0x674521, 0x6a4a28, 0x866137, 0xa07645, 0xa77b49, 0xae804d, 0xa87a45, 0xab844f, 0xaa8b59, 0xbea773, 0xd6c490, 0xe3d29f, 0xd3bd8c, 0x876737, 0x6d4414, 0x764f26, 0x704c24, 0x704a23, 0x734c22, 0x775028, 0x734d26, 0x936839, 0x906633, 0x6d4a24, 0x5e3e21, 0x836030, 0xd3a65e, 0xead49e, 0x8e6f47, 0x6d4416, 0x774e1e, 0xb48e58, 0xa78453, 0x946a33, 0xa87a3a, 0xa67733, 0xa77533, 0x9f6e30, 0x9f7038, 0x845b2a, 0x7e5425, 0xb3894d, 0xc8a164, 0xb89259, 0x906e3f, 0x6b512b, 0x6a5026, 0x7c6030, 0x8f7343, 0xaf995e, 0xdcc983, 0xf3e29f, 0xe9d79b, 0xcbb078, 0x97723a, 0x815514, 0x8f5e2a, 0x936331, 0x926431, 0x96692f, 0x946a39, 0x654324, 0x906b37, 0xb98e49, 0xa27d40, 0xc09650, 0xd7b16d, 0xd1ad69, 0x704a1c, 0x684020, 0x603916, 0x59391a, 0x583a21, 0xb78a49, 0xcf994e, 0x926936, 0x7c532d, 0xa28048, 0xa98b58, 0x885a31, 0x9e6c3b, 0x946a36, 0xc18e3c, 0xd0973f, 0x945e31, 0xb37c3a, 0xd89d46, 0xa26934, 0x6f3e19, 0x78491e, 0x905d30, 0x8a5a2f, 0x734725, 0x8c602c, 0xe2ae58, 0xd09a47, 0xbf8c3f, 0xd09d50, 0xb48143, 0x8f4f24, 0x985927, 0x894a22, 0x874b27, 0x77411f, 0x663619, 0x5f351c, 0x5a3218, 0x542a0c, 0x4f2b10, 0x4a2b16, 0x462714, 0x402311, 0x3a200f, 0x321d0c, 0x2c1a0b, 0x29180b, 0x27170a, 0x24140e, 0x312113, 0x3b2c1d, 0x1f0f06, 0x21130a, 0x22140b, 0x1f1209, 0x1c1006, 0x1d0f06, 0x1b0e05, 0x1e1108, 0x1f130b, 0x180e05, 0x140b03, 0x130a02, 0x130b02, 0x120b02, 0x120b03, 0x110a02, 0x0f0902, 0x0e0903, 0x0d0803, 0x0d0803, 0x0b0602, 0x0a0702, 0x090602, 0x080602, 0x090601, 0x080401, 0x050400, 
-  0x090601, 0x0a0803, 0x0b0803, 0x0c0802, 0x0e0903, 0x100a03, 0x110a02, 0x110a02, 0x120902, 0x130a03, 0x150b02, 0x160c02, 0x170d05, 0x1c0d08, 0x1e0f07, 0x1b1105, 0x1c1007, 0x1e120b, 0x22130b, 0x23140b, 0x25140b, 0x26130b, 0x25140c, 0x26150d, 0x27160c, 0x27170d, 0x27180d, 0x2a180b, 0x29180e, 0x301d10, 0x372011, 0x321a0c, 0x43291b, 0x3a2110, 0x362012, 0x321603, 0x3d1f07, 0x412512, 0x492c1a, 0x4d2a14, 0x573017, 0x64381d, 0x77401e, 0x8c4e23, 0xa6602d, 0x945a2f, 0x593013, 0x643f1c, 0x61391f, 0x553115, 0x88592f, 0x854f1c, 0xbe9a55, 0xf4de8d, 0xa17843, 0x5c3111, 0x684428, 0x573516, 0x6d421d, 0x9b6a3c, 0x53270b, 0x895728, 0xbc8f56, 0x4f2e08, 0x6b411d, 0xaa723a, 0xb89054, 0x7e6234, 0x71431d, 0x7c5b33, 0x866d48, 0x3b1e05, 0x381b06, 0x683d18, 0x8c5721, 0xd7bb7f, 0xa89161, 0x562c00, 0x4a3018, 0x2f1a07, 0x432715, 0x4c2200, 0x805428, 0x784b22, 0x481500, 0x836436, 0xe6cd8f, 0xb19867, 0x5b360c, 0x684826, 0x634323, 0x5b3f23, 0x5d4228, 0x503114, 0x593618, 0x88623a, 0x926a40, 0x8c6337, 0x9f723e, 0x9e6d3b, 0x8e602f, 0x825b30, 0x6f4e29, 0x55341c, 0x3c1403, 0x2a0000, 0x411d00, 0x816e49, 0xd5c89a, 0xe1d3a7, 0x755b3b, 0x6c431c, 0x6f4926, 0x6d4822, 0x6e4920, 0x714f2a, 0x573718, 0x836039, 0xc0a070, 0x5f4426, 0x42250f, 0xaa8147, 0xad7a35, 0xe1c690, 0xc8b688, 0x512000, 0x73522a, 0xdbbb77, 0xbc9e65, 0x835722, 0x9d6f31, 0xb78842, 0xb5843e, 0xaa7c40, 0x7d5428, 0x714d28, 0xc59a5a, 0xbe9351, 0x6b4a1e, 0x321400, 0x321b0d, 0x351f11, 0x331d11, 0x291004, 0x260000, 0x421100, 0x734918, 0xba9658, 0xd1b576, 0xd7be87, 0xedd79b, 0xc5b17e, 0x8c6736, 0x7e5121, 0x764f27, 0x7d582e, 0x75532e, 0x452d14, 0x876437, 0x7f562c, 0x310b04, 0x8c612d, 0xa97835, 0x886531, 0x704e28, 0x80582e, 0x805a30, 0x623f1d, 0xa77b40, 0xd7a252, 0x9b723b, 0x522e11, 0x764a14, 0xc8a56e, 0xf6da9a, 0xb58d52, 0x986529, 0xe4b76c, 0xe2aa56, 0xe2a655, 0x915829, 0xba8337, 0xda9c46, 0xbd8242, 0x8b5b2d, 0x88562e, 0x925f2d, 0x82542d, 0x734419, 0xd6a556, 0xdda54e, 0xd49e48, 0xc49247, 0xb78142, 0x935d2c, 0x965423, 0x8e4e26, 0x7e441e, 0x854a25, 0x844c2a, 0x643619, 0x593117, 0x522a0d, 0x875e3f, 0x765135, 0x46260d, 0x472b16, 0x402412, 0x381f0e, 0x321d0a, 0x281201, 0x1e0200, 0x28160b, 0x25160a, 0x231207, 0x1d0d04, 0x1e130a, 0x20120a, 0x201209, 0x1e1007, 0x1a0f06, 0x1d0f06, 0x1d1007, 0x1a0f05, 0x180e04, 0x150c03, 0x140b04, 0x130b04, 0x120b03, 0x120b03, 0x100b02, 0x0f0b02, 0x0d0802, 0x0b0702, 0x0c0803, 0x0b0602, 0x0a0702, 0x090602, 0x090402, 0x080601, 0x090601, 0x080401, 0x050300, 
-  0x080602, 0x080601, 0x0a0602, 0x0b0601, 0x0c0702, 0x0e0802, 0x0f0902, 0x110a03, 0x110a02, 0x120a03, 0x130a02, 0x140b03, 0x150c03, 0x170d04, 0x1a0e05, 0x1d0f07, 0x1f100a, 0x201108, 0x221107, 0x211209, 0x22130c, 0x23130b, 0x23140b, 0x23130b, 0x25140c, 0x25140b, 0x24140a, 0x27160b, 0x29180d, 0x2a190b, 0x2d190a, 0x321c0d, 0x341c0f, 0x381f11, 0x341d0f, 0x392113, 0x3d2211, 0x3f2411, 0x432612, 0x502e18, 0x583017, 0x633418, 0x733e1c, 0x874920, 0xa15926, 0xa05e2e, 0x5f2f10, 0x5d3719, 0x5b321a, 0x391a05, 0x744a23, 0x845025, 0x844f18, 0xe3cb7c, 0xe0c37a, 0x8b5921, 0x6a3f24, 0x6c4523, 0x663d1a, 0x71431f, 0x673817, 0x985e27, 0xdbb87a, 0x6e532e, 0x633819, 0x8c5321, 0xc9a465, 0xe0c683, 0x8b5621, 0x885e2f, 0xc2a06b, 0xb18855, 0x55320c, 0x3a1b04, 0x693d16, 0x8d6027, 0xd5b97f, 0x94764f, 0x4c2100, 0x442d16, 0x301e07, 0x4a2b18, 0x663c1a, 0x886334, 0x70502e, 0x370000, 0x785b35, 0x886d45, 0x523313, 0x5a3d20, 0x593c1f, 0x3d250c, 0x4b3014, 0x916e42, 0xad8455, 0x8d683f, 0x694321, 0x976b3d, 0x936638, 0x815b35, 0x52361d, 0x311d11, 0x332318, 0x3b2d18, 0x40301a, 0x41301e, 0x332116, 0x170000, 0x471a00, 0xd0bc94, 0xc2b08a, 0x502c00, 0x684623, 0x754f23, 0x7a5429, 0x684727, 0x462b14, 0x684416, 0xc19866, 0x785d40, 0x755833, 0xb88e58, 0x7b4f19, 0xb99358, 0xeedead, 0x937f61, 0x431c00, 0xb69353, 0xb08f54, 0x795123, 0x9e7135, 0xb7863d, 0xb4803a, 0x9f7439, 0x5b3a11, 0xad8a58, 0xbd924e, 0x6e491e, 0x472e1e, 0x674b2c, 0x6f4f2e, 0x664828, 0x614324, 0x6d4d2c, 0x573d24, 0x351f0d, 0x2a1002, 0x4d2900, 0xccaf73, 0xbda675, 0x877254, 0xd8c79a, 0xe9d69e, 0xb69e65, 0x805c2a, 0x71461f, 0x5d391b, 0x41240b, 0x55371c, 0x6a4d2b, 0x51361d, 0xa77f4c, 0x8b602b, 0x654222, 0x755229, 0x6f4726, 0x623c1e, 0xa77c47, 0xcb9549, 0xa77844, 0x46290e, 0x8a6239, 0x946838, 0x522a00, 0x8c6c3c, 0xd7a660, 0xc79750, 0xdaa353, 0xba7d3a, 0xb2773a, 0xb57e3b, 0xe5af4f, 0xc6893f, 0xb6793b, 0xa46d33, 0x9f6932, 0xa06934, 0x7c4a20, 0xb38443, 0xe3ae57, 0xce9744, 0xdaa752, 0xc8964a, 0x945d2a, 0x8a4e21, 0x965627, 0x854922, 0x75411d, 0x6e3710, 0x875735, 0x7d5537, 0x4f2a0f, 0x4f2b15, 0x674228, 0x5b3a22, 0x42240d, 0x412511, 0x3c2312, 0x37200f, 0x2f1303, 0x654c2e, 0x7b6141, 0x1e0300, 0x261607, 0x231408, 0x201109, 0x1e1108, 0x1f1208, 0x1d1108, 0x1b1007, 0x190f05, 0x21140b, 0x22150c, 0x170c03, 0x150c03, 0x140c04, 0x120a03, 0x120b02, 0x110c03, 0x100a03, 0x0e0a03, 0x0c0903, 0x0c0903, 0x0c0803, 0x0b0702, 0x0a0601, 0x0a0602, 0x0a0602, 0x090501, 0x090501, 0x070400, 0x060501, 0x040400, 
-  0x070602, 0x080601, 0x0a0602, 0x0b0703, 0x0c0803, 0x0d0802, 0x0d0802, 0x0f0903, 0x0f0b02, 0x100a02, 0x120a02, 0x130a03, 0x140c03, 0x150d03, 0x170e05, 0x1a0d05, 0x1c0e07, 0x1c0f07, 0x1d1008, 0x1f1009, 0x20110a, 0x21120a, 0x21130a, 0x21130a, 0x22130b, 0x24130b, 0x24140c, 0x25140c, 0x27160c, 0x28180c, 0x2a180c, 0x2d1a0c, 0x311b0e, 0x351e10, 0x351e10, 0x392110, 0x452919, 0x3f2311, 0x432712, 0x4e2d16, 0x562f14, 0x704327, 0x703c1d, 0x854a25, 0x9f5b2b, 0xa45f2c, 0x7f4b25, 0x401d04, 0x3e2008, 0x43220a, 0x5a371b, 0x754722, 0x774217, 0xa57c40, 0xf6e18f, 0xcaa562, 0x804921, 0x744823, 0x7a4c24, 0x764621, 0x6e401a, 0x884c12, 0xcda668, 0xb59d69, 0x3e0000, 0x6e4121, 0x7e4f1e, 0xc3965a, 0x9c6933, 0x73471e, 0x7d4917, 0xb98c52, 0xc6a271, 0x533518, 0x3d2107, 0x693d15, 0x986e39, 0xd8b77d, 0x81683c, 0x472607, 0x4a2e18, 0x351d01, 0x6d441f, 0x9c6f40, 0xd2b580, 0x715c35, 0x4a2000, 0x643c1c, 0x67421e, 0x6a4820, 0x755433, 0x8b6940, 0xab854c, 0xad814e, 0x714927, 0x2f0d00, 0x9f7a4f, 0x95693b, 0x765734, 0x3e2a17, 0x352618, 0x3e2e1f, 0x46331c, 0x5f4326, 0x644829, 0x593f23, 0x533c23, 0x3a2919, 0x000000, 0x957349, 0xb79970, 0x553511, 0x664521, 0x7d5528, 0x7e582a, 0x63431e, 0x5c3c1d, 0x9b6d39, 0x966d36, 0x3a2304, 0x5d4429, 0x927042, 0x875f34, 0xa47739, 0xc0a979, 0x938466, 0x0e0000, 0x8b693c, 0xc8a971, 0x724e2c, 0x8f6430, 0xb4823c, 0xb6823f, 0x926631, 0x56381b, 0x83643d, 0x9c7646, 0x8a6a41, 0x5f3f1e, 0x755330, 0x7b5730, 0x735027, 0x70502a, 0x7c5933, 0x72502a, 0x644625, 0x3c2819, 0x000000, 0x674f2f, 0xe5cd97, 0x927f57, 0x0d0000, 0x9b8861, 0xd7c48d, 0xe1c88c, 0xc7a96d, 0xa8874d, 0x9e7940, 0x9a713e, 0x966e3f, 0xba8e50, 0xb28346, 0x805527, 0x674529, 0x725130, 0x5a3414, 0x9d7845, 0xca9751, 0xab7a40, 0x6a4524, 0x5d3a22, 0x4d2e11, 0x6c4621, 0x714725, 0x3a0000, 0x875f31, 0xbd9050, 0xa66e2d, 0x864e1e, 0x996327, 0xecb65e, 0xefb85a, 0xb07532, 0xb87c40, 0xad7237, 0xad7237, 0xa76f38, 0x92632b, 0xe6b564, 0xcd9640, 0xdba64d, 0xdfab52, 0xc89349, 0x955822, 0xa55f2e, 0x945427, 0x7e451f, 0x713d1b, 0x69371a, 0x613318, 0x562f13, 0x502c16, 0x4f2b14, 0x44220d, 0x3e2311, 0x402511, 0x3d230f, 0x382110, 0x35210e, 0x33190c, 0x573e25, 0x674f35, 0x220d00, 0x241508, 0x211308, 0x201209, 0x1e1108, 0x1c1007, 0x191007, 0x180f06, 0x180e05, 0x1a0f05, 0x190d04, 0x150c03, 0x140c04, 0x120c04, 0x120b03, 0x110c02, 0x0f0c02, 0x0e0903, 0x0d0a05, 0x0c0904, 0x0c0904, 0x0c0703, 0x0b0602, 0x0a0601, 0x0a0601, 0x090601, 0x080501, 0x080401, 0x060400, 0x040500, 0x040500, 
-  0x070601, 0x080601, 0x0a0702, 0x0a0702, 0x0a0803, 0x0c0803, 0x0c0701, 0x0d0802, 0x0e0903, 0x0f0903, 0x110a02, 0x120a03, 0x130b03, 0x140c04, 0x150c05, 0x170c06, 0x180d06, 0x180e06, 0x1a0f07, 0x1c1007, 0x1c1008, 0x1e1108, 0x1f1109, 0x20120a, 0x21120b, 0x21120b, 0x22120b, 0x24130b, 0x25140c, 0x27160d, 0x29170d, 0x2b190c, 0x2e1b0d, 0x321d0f, 0x351e10, 0x392110, 0x422616, 0x402410, 0x462813, 0x4c2b14, 0x532e13, 0x64381c, 0x6a3a1b, 0x7b4522, 0x97572e, 0x9d5525, 0xa96232, 0x864922, 0x73401b, 0x774921, 0x54290f, 0x76461e, 0x8f5529, 0x86441a, 0xcfb56b, 0xf5e08e, 0xb3813f, 0x895224, 0x8a552c, 0x814f27, 0x794a23, 0x734018, 0x9b6831, 0xe0c180, 0x7d6339, 0x380500, 0x6a401c, 0x986931, 0x8e6029, 0x785024, 0x704520, 0x5f3207, 0x926d4c, 0x6c4629, 0x3e2612, 0x381f0d, 0x623910, 0xa0793e, 0xd5ba80, 0x775f3c, 0x512700, 0x462c10, 0x563418, 0x895426, 0xba965f, 0xd6bb7e, 0xb6945d, 0xa67d48, 0xae834f, 0xb48c57, 0xa57f4f, 0x93663c, 0x7f5327, 0x5c3714, 0x270a01, 0x7e623f, 0xa57c4a, 0x8a663b, 0x3d2817, 0x463323, 0x422c16, 0x402a0f, 0x573b1d, 0x7c572c, 0x79552b, 0x634622, 0x4f371b, 0x56412e, 0x6f5135, 0x8c623c, 0x6e481f, 0x583b1e, 0x6e4d26, 0x7f572c, 0x714c22, 0x60421f, 0x6a4826, 0x97662a, 0xbe9e6f, 0x685b46, 0x000000, 0x2f1903, 0x734b28, 0x815a2e, 0x815e34, 0x361802, 0x422918, 0x977244, 0xbe9961, 0x8f6c41, 0x774f1c, 0xb18549, 0xaa7a39, 0x9e733d, 0x613f1f, 0x2a1003, 0x735632, 0xc6aa75, 0xa1885f, 0x654223, 0x78542a, 0x8b6532, 0x805e30, 0x6d4b24, 0x6d4b25, 0x704a1e, 0x5d3e1e, 0x332415, 0x040000, 0x977a4f, 0xd2b880, 0x4c341a, 0x210000, 0x633a05, 0x997b4c, 0xc1a66b, 0xd5b672, 0xdcba73, 0xcea864, 0xbe9253, 0xaa7d3e, 0x7e5225, 0x613e1f, 0x604528, 0x5d3b21, 0xa57d4a, 0xcd9f53, 0xb88747, 0x764d27, 0x7e5a32, 0x8c683f, 0x89613c, 0x966f3d, 0xe4c584, 0x9e814f, 0x582500, 0x5f2400, 0x875319, 0xb17b39, 0xe3ab55, 0xe9af52, 0xb37832, 0xad712f, 0xb47938, 0xb47839, 0xb97b3d, 0x985d22, 0xd1a356, 0xe5b55a, 0xe0a852, 0xd19a45, 0xdfa754, 0xb57a40, 0xa66027, 0xb2652e, 0x925225, 0x7a4420, 0x733e1c, 0x6f3d1e, 0x5c3316, 0x542f13, 0x512c11, 0x6a4327, 0x4e2e17, 0x3c2412, 0x3b2411, 0x37200e, 0x351f0e, 0x311e0e, 0x311e11, 0x2a1305, 0x1e0700, 0x28180a, 0x251608, 0x211307, 0x201209, 0x1d1108, 0x1a1007, 0x170e05, 0x160d04, 0x170e05, 0x160e03, 0x150c03, 0x140c03, 0x120c04, 0x110c04, 0x130b04, 0x100b02, 0x0e0a02, 0x0d0803, 0x0c0904, 0x0b0904, 0x0a0803, 0x0a0702, 0x0a0702, 0x090601, 0x090601, 0x080501, 0x080401, 0x070300, 0x060400, 0x040500, 0x040500, 
-  0x060500, 0x080500, 0x080601, 0x090602, 0x0a0702, 0x0a0702, 0x0b0602, 0x0c0702, 0x0c0803, 0x0e0904, 0x100903, 0x110a02, 0x120a03, 0x120b03, 0x140b04, 0x150c05, 0x150c05, 0x160c06, 0x160d05, 0x180e05, 0x1a1006, 0x1c1007, 0x1e1109, 0x1e1008, 0x20110a, 0x20110a, 0x21120a, 0x24130b, 0x24130b, 0x26150d, 0x28160e, 0x29180c, 0x2c1a0d, 0x2f1c0d, 0x331d0f, 0x382010, 0x402311, 0x432610, 0x482914, 0x4e2a15, 0x542e14, 0x62351b, 0x67391d, 0x6f3a18, 0x9d6036, 0x9c5929, 0xa8602b, 0x9f5e2e, 0x683411, 0x5f3217, 0x4d2410, 0x6b3d17, 0x98632e, 0x8a5424, 0x955e22, 0xeed989, 0xe8cb7b, 0xb47a3a, 0x885125, 0x84512d, 0x84522e, 0x6f3f1f, 0x6e390e, 0xb5844c, 0xd5b678, 0x8d6a42, 0x582b00, 0x542902, 0x4f290e, 0x583316, 0x986f44, 0x976b3b, 0x6c3e10, 0x9f784f, 0x644221, 0x2f190b, 0x251207, 0x5d340a, 0xa7804f, 0xd6bb87, 0x7f6640, 0x4c2200, 0x3b2208, 0x5b381b, 0x6d3d0e, 0x885d2d, 0x9d7442, 0x8f6534, 0x7f542a, 0x6c401a, 0x6b4119, 0x6e481f, 0x4c2f15, 0x21120b, 0x291d0d, 0x947042, 0x90693f, 0x503c1f, 0x3e281c, 0x4a3118, 0x836745, 0x7b6241, 0x674218, 0x89622e, 0x815d2c, 0x6b4c29, 0x442b13, 0x523f30, 0x5b452a, 0x463219, 0x4d341a, 0x664421, 0x79562a, 0x755028, 0x634320, 0x614527, 0x462a17, 0x684416, 0xae8c5c, 0xcab287, 0x513d26, 0x2a180b, 0x65461d, 0x805e2e, 0x916a3b, 0x886439, 0xa2794c, 0x9c723e, 0x865e2e, 0x78522a, 0x755024, 0x956d3e, 0xa97e46, 0x966b35, 0x876233, 0x553c1e, 0x311307, 0x553c22, 0x675031, 0x654521, 0x795328, 0x8e6737, 0x785529, 0x69421a, 0x947139, 0xd4ba7e, 0x9e865a, 0x3e2107, 0x180805, 0x593504, 0xc1975f, 0x87663e, 0x442a1b, 0x371f0b, 0x593414, 0x764214, 0x87551c, 0x9c6c32, 0x9a682c, 0x8f612a, 0x6d471e, 0x54371a, 0x553e1f, 0x51361d, 0x966e3e, 0xca9a50, 0xb78648, 0x764f24, 0x7a542d, 0x845e36, 0xcea66a, 0xac7d45, 0x8d6027, 0xbf9c5f, 0xe7c480, 0xd7b777, 0xceb173, 0xe6c87f, 0xf4c873, 0xe2ac57, 0xb97e35, 0xab6c35, 0xc38741, 0xc5893f, 0xc98b41, 0xb77831, 0xc09045, 0xf0c165, 0xe7b358, 0xd9a14d, 0xc1843d, 0xae7334, 0x975522, 0xb97039, 0xaf632f, 0x8e4e24, 0x77421f, 0x6f3d1c, 0x6a3c1e, 0x583116, 0x502d16, 0x502a15, 0x562b12, 0x472307, 0x3c2410, 0x37220f, 0x35200e, 0x311d0f, 0x2e1c10, 0x2c1c0a, 0x2b1909, 0x271708, 0x261606, 0x251508, 0x211308, 0x1f1209, 0x1d1108, 0x1b0f07, 0x1d1007, 0x1c1007, 0x160c03, 0x150c03, 0x140b02, 0x130c03, 0x120c04, 0x120b06, 0x120b05, 0x100b02, 0x0e0a02, 0x0d0803, 0x0c0703, 0x0b0703, 0x0a0702, 0x0a0702, 0x090601, 0x070601, 0x080601, 0x080401, 0x070300, 0x060300, 0x050400, 0x030400, 0x040400, 
-  0x060400, 0x080501, 0x070500, 0x080502, 0x0a0602, 0x0a0702, 0x0a0601, 0x0a0602, 0x0b0803, 0x0c0803, 0x0e0902, 0x100902, 0x110a02, 0x120b03, 0x120b03, 0x130b04, 0x140c05, 0x140c06, 0x150d06, 0x160d05, 0x170f05, 0x1a0f06, 0x1d1008, 0x251811, 0x20120b, 0x1f1109, 0x22130a, 0x24130a, 0x241209, 0x24130a, 0x27140c, 0x28170c, 0x291a0d, 0x2d1b0c, 0x321c0e, 0x371f0f, 0x422614, 0x472a15, 0x492912, 0x4f2b15, 0x552f15, 0x61351c, 0x66371d, 0x703c1c, 0x83471f, 0x94542a, 0xa45c28, 0xb2672f, 0x9d5e2f, 0x5f2f0f, 0x623514, 0x703a16, 0x925a2d, 0xa26b35, 0x8a4e1c, 0xb58e4d, 0xfbe896, 0xd8af64, 0x955c26, 0x81502b, 0x85502a, 0x7b4b25, 0x6a3d18, 0x844c18, 0xb37a41, 0xc89f68, 0xc09a63, 0xb48751, 0xa5743d, 0xa8723e, 0x9d6a3c, 0x936034, 0x6f451f, 0x9e764b, 0xbe9461, 0x51310d, 0x301d0e, 0x321c0d, 0x6d3e0a, 0xae8650, 0xd8c18d, 0x8a744d, 0x4a1a00, 0x3a210b, 0x4c2f16, 0x553319, 0x522d13, 0x5b371e, 0x6d4929, 0x79542f, 0x735130, 0x583c1e, 0x523b1f, 0x3d2a18, 0x49321f, 0x6e482a, 0x7b5a34, 0x3e2815, 0x332010, 0x664a28, 0xc9a573, 0xd3bf91, 0x9d8862, 0x7c521d, 0x7b5628, 0x64431e, 0x5f4222, 0x583c1f, 0x4f3521, 0x432d16, 0x593c1b, 0x76532b, 0x755325, 0x674621, 0x5f4323, 0x5e4523, 0x593d22, 0x422a17, 0x472d02, 0x886638, 0x85613a, 0x5b3c21, 0x734c24, 0x88612a, 0xc7a56b, 0x8b6635, 0x6d471d, 0x5f3e1e, 0x603f1e, 0x6e4b24, 0x77552c, 0x754e24, 0x9d7342, 0x895e30, 0x855c2d, 0x8b6333, 0x79592e, 0x6d4f2a, 0x674621, 0x856032, 0x885f2e, 0x7f5a2d, 0x694820, 0x976f3f, 0xb38546, 0xc1a66c, 0xb29c6d, 0x492d0a, 0x24160a, 0x613f1b, 0xa07341, 0x7b5831, 0x6d4d2b, 0x66492a, 0x533d25, 0x3f2c18, 0x442d1a, 0x4e3017, 0x553415, 0x4f3116, 0x543924, 0x5c4227, 0x5a3b21, 0x926c39, 0xae7f43, 0xa0753a, 0x6a4723, 0x795629, 0x6d4c28, 0x7e5225, 0xa37032, 0x593207, 0x431e08, 0x65370b, 0x9b7137, 0xc4a163, 0xcbad72, 0xbda069, 0xb98d4a, 0xd9a056, 0xa6692a, 0xbd813d, 0xcb9241, 0xd09343, 0xcc8b3d, 0xcb9442, 0xf4cc6f, 0xe3b155, 0xdea750, 0xd09646, 0xc28542, 0x9c5c2b, 0xaa672c, 0xae6630, 0x9d582a, 0x874921, 0x743f1d, 0x673719, 0x5e3218, 0x552f15, 0x4d2a13, 0x573219, 0x845d3d, 0x714f35, 0x3a2007, 0x36210e, 0x321f0e, 0x2d1b0d, 0x2b1a0e, 0x2a1a07, 0x2a160b, 0x28160b, 0x261607, 0x241407, 0x211307, 0x1f1209, 0x1d1008, 0x1b0e05, 0x26180e, 0x25180f, 0x160a02, 0x140b02, 0x140b03, 0x140b04, 0x130b04, 0x120b05, 0x120b04, 0x100a02, 0x0e0902, 0x0d0804, 0x0c0703, 0x0b0602, 0x0a0702, 0x0a0702, 0x080601, 0x070601, 0x060501, 0x080401, 0x080301, 0x050300, 0x040400, 0x040500, 0x040400, 
-  0x050400, 0x060401, 0x080401, 0x090501, 0x090601, 0x090601, 0x090601, 0x0a0702, 0x0b0602, 0x0c0703, 0x0c0703, 0x0e0703, 0x0f0903, 0x0f0b02, 0x100a04, 0x120b05, 0x120b05, 0x100c03, 0x120c04, 0x150d05, 0x160d06, 0x170d06, 0x1a0f06, 0x261a13, 0x1f120a, 0x1e1008, 0x211108, 0x221109, 0x23120a, 0x24130b, 0x27140c, 0x27160c, 0x28180a, 0x291504, 0x392213, 0x3f2615, 0x3d220e, 0x482a15, 0x492812, 0x4f2b13, 0x532e14, 0x593218, 0x633519, 0x6f3b1a, 0x7d421f, 0x8e4d25, 0xa25b27, 0xb76b2d, 0xcf8444, 0x925024, 0x7b431d, 0x91572e, 0x7d441c, 0x9e6632, 0x9a602f, 0x915215, 0xd4b56d, 0xf5de8d, 0xae7939, 0x794722, 0x85502c, 0x835028, 0x7a4b23, 0x7c481f, 0xb17439, 0xb1783f, 0x8f6132, 0xb28149, 0xaf7840, 0x9c632c, 0xa87039, 0x895c31, 0x2e0900, 0x300000, 0xb99562, 0x9e7b4d, 0x452309, 0x2d1b09, 0x3a2209, 0x653600, 0xaa8351, 0xdcc68d, 0x9f8758, 0x592c00, 0x3f230e, 0x36210c, 0x3a2410, 0x371f0f, 0x4b311a, 0x52371a, 0x5a3e21, 0x6a4925, 0x644523, 0x382512, 0x331e0f, 0x603e1f, 0x7d5e3a, 0x462e16, 0x3c2917, 0x483018, 0x663e18, 0x8f7548, 0xccb385, 0x67400f, 0x725025, 0x7d5d35, 0x694820, 0x805d33, 0x664522, 0x573d20, 0x694722, 0x815b30, 0x74522a, 0x65451e, 0x6b4923, 0x613e16, 0x604119, 0x5e4223, 0x46301e, 0x230f06, 0x2d1b0b, 0x6b482c, 0x724b22, 0x8e6630, 0xc6a76d, 0x5b4426, 0x452e18, 0x664a2b, 0x77572f, 0x755128, 0x7e592a, 0x7f5728, 0x88602f, 0x98723c, 0x764c1e, 0x8f6632, 0x966c31, 0x906836, 0x835c2b, 0x9f7537, 0x9e7138, 0x7d5a2c, 0x513817, 0x835c2d, 0x8f642e, 0x4e2600, 0x57381b, 0x5d432b, 0x260f02, 0x7b5730, 0x845931, 0x583d20, 0x624526, 0x67492a, 0x5e3f20, 0x664728, 0x705334, 0x604425, 0x6e4f30, 0x735231, 0x6e4d2e, 0x634425, 0xa77f4f, 0xb18547, 0x8a6433, 0x57371d, 0x73512e, 0x79562d, 0x5f3c1e, 0x8e612e, 0x996833, 0x885b2a, 0x704a24, 0x59371b, 0x623c1a, 0x623201, 0x612b00, 0x501200, 0x8c5c24, 0xbc813f, 0xa5672f, 0xbd813b, 0xc2883a, 0xc38537, 0xd49642, 0xf2c86f, 0xf1cc6f, 0xe4b25a, 0xd89f4c, 0xe2ad5a, 0xbc813c, 0xba7238, 0xb87032, 0xa25d28, 0x915125, 0x7d4521, 0x6f3b1b, 0x643519, 0x5c3117, 0x562f12, 0x4c2a14, 0x533014, 0x7b5536, 0x583922, 0x3b200b, 0x331f0f, 0x2f1c0d, 0x2b190a, 0x2a180a, 0x291709, 0x29170b, 0x28160a, 0x26140a, 0x231309, 0x211208, 0x201209, 0x1e1007, 0x1c0f06, 0x1b0e06, 0x190f06, 0x150b02, 0x140b03, 0x140b04, 0x130b03, 0x110a03, 0x110a03, 0x0f0a02, 0x0e0903, 0x0d0803, 0x0c0804, 0x0c0703, 0x0b0602, 0x0a0702, 0x090601, 0x080601, 0x060500, 0x060500, 0x070400, 0x070300, 0x040400, 0x040500, 0x030400, 0x030300, 
-  0x050501, 0x060400, 0x080301, 0x080401, 0x080500, 0x080600, 0x090601, 0x090601, 0x0a0702, 0x0b0602, 0x0c0703, 0x0c0703, 0x0d0803, 0x0d0902, 0x0f0a04, 0x110b05, 0x110a04, 0x100c03, 0x120c03, 0x130c04, 0x160d06, 0x160e07, 0x170e08, 0x170d06, 0x1a0e07, 0x1c0f08, 0x1e0f08, 0x211009, 0x23120a, 0x24130b, 0x26150c, 0x27170a, 0x341e12, 0x462f23, 0x452c1b, 0x472e1e, 0x3e210e, 0x452510, 0x4b2812, 0x542f18, 0x552f15, 0x583016, 0x623519, 0x6e3b1b, 0x7c421d, 0x8f4e25, 0xa45d2b, 0xbe7438, 0xc27433, 0xb06b30, 0x71380d, 0x713b1b, 0x6c3516, 0x88502a, 0xa46837, 0x955721, 0xa16a28, 0xeed482, 0xdfc577, 0x93581f, 0x7d4724, 0x87512a, 0x834d27, 0x7c4624, 0x915b25, 0xd59f55, 0x915d2b, 0x633309, 0x673d1b, 0x6d4321, 0x82522a, 0x794a21, 0x7d5f3f, 0x4b341c, 0x654626, 0xb48e5f, 0x4f2f0d, 0x4e3619, 0x452d1a, 0x3f220b, 0x683e0f, 0x9d7641, 0xd6ba7e, 0xb89d67, 0x694016, 0x482d13, 0x462c17, 0x5b3f23, 0x64421f, 0x654223, 0x624320, 0x6e4b24, 0x63411e, 0x402c15, 0x201304, 0x56310b, 0xa8855b, 0x795e3a, 0x492f13, 0x200b00, 0x4a311a, 0x85582d, 0xa37e50, 0x5a3c1b, 0x664621, 0x816036, 0x906d44, 0x744f25, 0x664521, 0x66441f, 0x754e24, 0x774e27, 0x6e4924, 0x8b6331, 0xb78c55, 0xbd9c6b, 0xa0875c, 0x5e411d, 0x50341a, 0x362517, 0x301d13, 0x6e4d2d, 0x734e21, 0x885e25, 0xc3a066, 0x715836, 0x5e4426, 0x6a4c29, 0x6c4725, 0x8f6835, 0xb68d4f, 0xc8a169, 0xb19158, 0xccb074, 0xa28354, 0x6f4617, 0x936935, 0x855c29, 0x8e6636, 0x92692f, 0xa1743b, 0x7f592c, 0x523921, 0x371300, 0x997747, 0xbaa173, 0x6c5133, 0x4b3018, 0x826340, 0x9f7749, 0x552c09, 0x5d4024, 0x583f24, 0x6a4a29, 0x714e2b, 0x714f2e, 0x6d4e2d, 0x654524, 0x704e2b, 0x644521, 0x7b5831, 0xba8a50, 0xb78547, 0x876535, 0x513619, 0x785433, 0x7f5832, 0x604024, 0x533115, 0x875c30, 0x7f5325, 0xdab573, 0xe2c38a, 0x6b4926, 0x522f13, 0x5d371c, 0x9e6d3f, 0x784a23, 0x845229, 0xa1652a, 0xa96e2d, 0xb97c36, 0xc5843d, 0xc98c3e, 0xe8b760, 0xf3cc73, 0xe0b45b, 0xe6b25c, 0xe6b25e, 0xe0ab5a, 0xc3833a, 0xc9823e, 0xb56f30, 0xa35f30, 0x8f4f26, 0x794220, 0x6a3a1a, 0x5f3419, 0x573019, 0x532e12, 0x502a13, 0x57331b, 0x4a260d, 0x3f1d0a, 0x3a2012, 0x311e12, 0x2f1b0e, 0x2c190b, 0x291709, 0x29170a, 0x29170b, 0x271509, 0x241409, 0x211308, 0x201208, 0x1f1008, 0x1d1007, 0x1c0f06, 0x1a0d05, 0x160d04, 0x150c03, 0x140b04, 0x140b04, 0x130b03, 0x120b04, 0x120a04, 0x0f0a02, 0x0f0a04, 0x0d0803, 0x0c0804, 0x0b0602, 0x0a0602, 0x0a0702, 0x090601, 0x080500, 0x080500, 0x070400, 0x050400, 0x050300, 0x040400, 0x040500, 0x030400, 0x030301, 
-  0x040500, 0x050400, 0x060300, 0x070400, 0x080500, 0x080500, 0x090501, 0x090602, 0x090601, 0x0a0702, 0x0b0602, 0x0b0602, 0x0b0702, 0x0c0802, 0x0d0802, 0x0e0903, 0x100a04, 0x0f0a04, 0x120b05, 0x120b04, 0x140b05, 0x150d07, 0x150d08, 0x170e08, 0x190e08, 0x190e08, 0x1f0f09, 0x22110a, 0x23120a, 0x25140b, 0x26160c, 0x221205, 0x372116, 0x4e382c, 0x321a05, 0x391f0c, 0x3f2210, 0x452510, 0x49250f, 0x603c27, 0x5e371f, 0x5b3218, 0x623518, 0x703d1c, 0x7d431d, 0x905025, 0xa55e2b, 0xb1662a, 0xbe7130, 0xcb7e39, 0xad6934, 0x793d16, 0x763d19, 0x783e19, 0x9b6432, 0xa26634, 0x95531e, 0xba8e47, 0xfae794, 0xcca966, 0x8e5521, 0x824c25, 0x8b5629, 0x7e4e24, 0x75421c, 0xac7335, 0xb77a3f, 0x87532a, 0x5f3612, 0x4d2d0e, 0x533114, 0x6c3c0e, 0xc29869, 0x8b6a45, 0x431800, 0xab814f, 0x714b25, 0x5a361d, 0x593b1f, 0x442d12, 0x311c04, 0x532a02, 0x835621, 0xcbaf74, 0xccb279, 0x866636, 0x552b0b, 0x714f32, 0x644321, 0x624121, 0x63421f, 0x6e4b26, 0x6f4c27, 0x553b1e, 0x26170a, 0x4a2708, 0x927149, 0xceb281, 0x987f55, 0x816235, 0x9a713d, 0x84562c, 0x634122, 0x51371a, 0x674723, 0x7c5628, 0x835c2f, 0x89653c, 0x704d29, 0x744f26, 0x6e4b26, 0x5a3b1d, 0x825b30, 0xa47c47, 0x77582e, 0x7f6643, 0xc7ab7b, 0xdac092, 0x7c6a4b, 0x2b1800, 0x402b1a, 0x6a4928, 0x7c5629, 0x885922, 0xb69463, 0x947d5a, 0x4e2e0e, 0x715334, 0xae8754, 0xa27940, 0x6b4b1e, 0x785e3c, 0xc2a06c, 0xbda166, 0xe1cf9a, 0x71552f, 0x9a723e, 0x90682f, 0x926933, 0x946933, 0x9b6f36, 0x865f31, 0x5d4125, 0x280e02, 0x613e16, 0xccb581, 0xdcc691, 0xc3a474, 0xb78d57, 0x7d582f, 0x58391a, 0x6d4a2a, 0x664726, 0x6d4e2b, 0x6a4b2b, 0x64472a, 0x5d4124, 0x624428, 0x684628, 0x9a703f, 0xbf8f54, 0xc49350, 0x946b35, 0x593b21, 0x6c4a2a, 0x825c33, 0x775431, 0x5b3d23, 0x533418, 0x6f4621, 0x6b431a, 0xc39754, 0xc6a16a, 0x8f673d, 0x79532a, 0x795128, 0x996630, 0x7e5121, 0x683718, 0x965e2c, 0xb17936, 0xc58644, 0xb87531, 0xcb9240, 0xf8cb71, 0xf2c86e, 0xeebd64, 0xebb860, 0xf0bd68, 0xd59d4a, 0xda9949, 0xce8940, 0xb87234, 0xa46132, 0x905128, 0x7a4320, 0x693919, 0x5d3216, 0x573018, 0x5b3418, 0x512509, 0x69432a, 0x57351e, 0x3b1f0f, 0x341e0e, 0x2e1b0c, 0x2d1c0c, 0x2b190b, 0x29160a, 0x28170a, 0x251509, 0x241409, 0x211309, 0x1f1208, 0x1e1007, 0x1d1007, 0x1c0f06, 0x1b0f06, 0x180e04, 0x150c03, 0x150c03, 0x140b04, 0x140a04, 0x120a03, 0x110a03, 0x110a04, 0x0f0a02, 0x0e0903, 0x0d0803, 0x0b0702, 0x0a0602, 0x0a0501, 0x0a0702, 0x090601, 0x080500, 0x080400, 0x070400, 0x050300, 0x040300, 0x040400, 0x040500, 0x030300, 0x030301, 
-  0x030401, 0x050402, 0x040402, 0x060301, 0x070300, 0x080401, 0x080401, 0x090502, 0x090601, 0x0a0702, 0x0a0702, 0x0b0702, 0x0c0803, 0x0c0904, 0x0c0803, 0x0d0803, 0x0e0903, 0x0e0904, 0x110a04, 0x120a05, 0x130a05, 0x140b06, 0x150c06, 0x170d07, 0x1a0e08, 0x1c0f08, 0x1f1008, 0x23120a, 0x25140a, 0x26160a, 0x281304, 0x443023, 0x342012, 0x2c1504, 0x331e0f, 0x3a200f, 0x3f2310, 0x442510, 0x492711, 0x4d2811, 0x532c12, 0x5d341b, 0x643619, 0x743f1c, 0x884d25, 0x945326, 0xa55e29, 0xb2672b, 0xc17732, 0xcf8439, 0xd18641, 0x985927, 0x7a421e, 0x76411c, 0x75431b, 0xa06838, 0xa1632e, 0xa46325, 0xd3af68, 0xf8ea9c, 0xbe9754, 0x905521, 0x8d5427, 0x89562a, 0x7d4b24, 0x824620, 0xa56832, 0xac6e33, 0xbb8e5f, 0x825d39, 0x573011, 0x693d1a, 0x945d28, 0x8f602f, 0x624021, 0x916131, 0x855324, 0x764925, 0x5e3a1a, 0x55381b, 0x452a15, 0x291604, 0x492b10, 0x744418, 0xb4955e, 0xe0c283, 0xb4945d, 0x674012, 0x563316, 0x593b1b, 0x5d3e1f, 0x654322, 0x6c4924, 0x644523, 0x4a3219, 0x381f0e, 0x5d3917, 0x916d44, 0xc19e6c, 0xa77c46, 0x7c5023, 0x614126, 0x4e3318, 0x5e4020, 0x755028, 0x875d2d, 0x855c2c, 0x6f4c22, 0x64411c, 0x75502c, 0x5c3b1b, 0x62401a, 0x9b703e, 0x6f461b, 0x220803, 0x000000, 0x663904, 0xb99764, 0xcfb586, 0x3f2914, 0x634a2e, 0x7b5631, 0x8a602d, 0x915f25, 0xb69868, 0xc9bb92, 0x401900, 0x9a7b50, 0x9e7138, 0x67411d, 0x220c0e, 0x0c0000, 0x7c5a37, 0x96682c, 0xd4be86, 0xa6946a, 0x6e4408, 0x936934, 0x8b612a, 0x966933, 0x9b7034, 0x8f6734, 0x755126, 0x583c1f, 0x34180a, 0x592f00, 0x9e7b4c, 0x9b7a51, 0x583612, 0x4f311c, 0x634525, 0x654529, 0x644225, 0x654726, 0x5c4022, 0x5c4023, 0x614325, 0x684929, 0x9a733d, 0xbf8e4c, 0xaa7a40, 0x825f33, 0x573a1c, 0x623e1e, 0x5f3c19, 0x694a29, 0x6c4b2a, 0x543419, 0x4b2c0f, 0x734926, 0xac8249, 0xd09c50, 0x875414, 0x734922, 0x835931, 0x8a5c31, 0x925c33, 0x805028, 0x85552c, 0xa06632, 0xa96f33, 0xa5672d, 0xa86a23, 0xe8b35d, 0xeebd64, 0xedbb63, 0xe8b259, 0xeebb5f, 0xe6b058, 0xe5a851, 0xe09f4a, 0xcd883f, 0xbb7439, 0xa96530, 0x955529, 0x7d4620, 0x6f3c18, 0x653515, 0x6b3d21, 0x865939, 0x4f270d, 0x43230b, 0x3c220f, 0x381f0f, 0x42230c, 0x4a2911, 0x351c0b, 0x2a180c, 0x28160a, 0x271609, 0x24150a, 0x201208, 0x1f1108, 0x1e1007, 0x1c0f06, 0x1c0f07, 0x1c0f06, 0x1a0f05, 0x170e04, 0x160d04, 0x140c03, 0x140b04, 0x130a03, 0x120a03, 0x120b04, 0x110a04, 0x0f0a01, 0x0d0802, 0x0c0702, 0x0b0702, 0x0a0602, 0x0a0602, 0x0a0702, 0x090601, 0x080501, 0x080401, 0x070300, 0x040300, 0x030301, 0x040400, 0x030400, 0x020200, 0x020200, 
-  0x030200, 0x040401, 0x030401, 0x040400, 0x060300, 0x060300, 0x070301, 0x080401, 0x080500, 0x070601, 0x080601, 0x0a0702, 0x0b0703, 0x0a0702, 0x0b0803, 0x0d0802, 0x0d0802, 0x0e0903, 0x100a04, 0x120b05, 0x130a05, 0x140b05, 0x150c05, 0x170c06, 0x1a0e07, 0x1c0f07, 0x201008, 0x23120a, 0x26150a, 0x28170a, 0x260b00, 0x6f5849, 0x473326, 0x2f1805, 0x341d0f, 0x39200e, 0x3d220f, 0x422411, 0x492813, 0x4d2a13, 0x522d14, 0x5a3117, 0x663718, 0x723c17, 0x8c5128, 0x915022, 0xa45c27, 0xb56a2c, 0xc37b33, 0xce863a, 0xca7e36, 0xae6930, 0x673111, 0x5d2c14, 0x5e2d0f, 0x7c4b21, 0xaf773e, 0xa56731, 0xa86927, 0xe4c980, 0xf5e99c, 0xd2a059, 0xa76734, 0x935a2e, 0x8f5429, 0x8a562f, 0x844e28, 0x804c1f, 0x875931, 0x6b4320, 0x583619, 0x563215, 0x946034, 0x89582a, 0x603d19, 0x84552a, 0x9d6a37, 0xb1814f, 0x754b22, 0x83623a, 0x725129, 0x462405, 0x0f0000, 0x3a1906, 0x623009, 0x976f41, 0xd9bc7a, 0xd6ba73, 0x8d6c3a, 0x4c2000, 0x55351c, 0x5f3f21, 0x5e3d1a, 0x64431e, 0x644320, 0x624327, 0x51341c, 0x522b0a, 0x5d2d00, 0x623a18, 0x4e331b, 0x4a3319, 0x5d3e22, 0x654422, 0x775127, 0x7f5526, 0x8a6233, 0x735025, 0x603f1d, 0x5c3b1b, 0x7e592f, 0xbb8f52, 0xa07239, 0xae8c57, 0x523f26, 0x47301b, 0x997241, 0x93662d, 0x88683d, 0x48301a, 0x705232, 0x7d552e, 0x926732, 0x966530, 0xb08d57, 0xeee1b5, 0x6b5940, 0x6b4929, 0xb78b5a, 0x7e5f3a, 0x351a00, 0x52391c, 0x7a562e, 0x8a581c, 0xc49a5c, 0xc1a877, 0x633a08, 0x8e6537, 0x8d622d, 0xa07138, 0x9d7033, 0x8c632d, 0x8b6430, 0x815d2d, 0x664924, 0x53351d, 0x492b14, 0x44290c, 0x583c21, 0x654527, 0x694825, 0x644627, 0x5d4022, 0x634223, 0x6a4a2c, 0x684828, 0x7c5a31, 0xbd9457, 0xb68746, 0x9e753b, 0x66451f, 0x4c2d17, 0x6d4e27, 0x9e7f4d, 0xb39864, 0xc6af78, 0xc4ab79, 0x97794a, 0x8d6d4a, 0x6f4828, 0x976732, 0xc28d48, 0x976631, 0x744d2a, 0x83582d, 0x895828, 0x9d6832, 0x9f6c34, 0x9d6630, 0xa1632e, 0xa0622e, 0x985922, 0xd59f4c, 0xf1bc5f, 0xe3ae57, 0xe1a850, 0xdfab52, 0xeac56f, 0xe6b45d, 0xecab53, 0xdd9b46, 0xcc873c, 0xbd7739, 0xad6830, 0x99592a, 0x844a23, 0x83471f, 0x78421f, 0x5c2f15, 0x532b11, 0x4a2814, 0x412410, 0x3c200d, 0x3b1e08, 0x714627, 0x855736, 0x43220d, 0x2a180c, 0x27160a, 0x251509, 0x221409, 0x1f1208, 0x1e1007, 0x1c0f06, 0x1b0e06, 0x1b0e06, 0x1a0e06, 0x170d04, 0x170d04, 0x160d04, 0x150c02, 0x140b04, 0x140b05, 0x130a04, 0x120b05, 0x100a03, 0x0e0902, 0x0c0701, 0x0c0702, 0x0b0603, 0x0a0602, 0x090601, 0x080601, 0x070501, 0x080401, 0x080301, 0x060300, 0x050400, 0x050301, 0x040401, 0x030200, 0x020200, 0x020200, 
-  0x030200, 0x040400, 0x030500, 0x030500, 0x040500, 0x050400, 0x070300, 0x080401, 0x070500, 0x060500, 0x070500, 0x090601, 0x090601, 0x090601, 0x0a0702, 0x0c0702, 0x0d0802, 0x0d0802, 0x0f0a04, 0x110a04, 0x130a05, 0x140b05, 0x150c05, 0x170d07, 0x1a0e08, 0x1d1008, 0x1f1109, 0x221209, 0x26140a, 0x28160b, 0x2d190c, 0x2b1100, 0x301909, 0x331d0d, 0x331e0d, 0x38200e, 0x3c220f, 0x432412, 0x482611, 0x4c280f, 0x552c11, 0x5f3318, 0x6d3a1b, 0x79401c, 0x884a20, 0x985423, 0xab6229, 0xba6e30, 0xbd7231, 0xbb7132, 0xb56b2f, 0xb76e31, 0x995b2d, 0x6b381a, 0x6e3b1d, 0x763e1b, 0x975d2e, 0xac6f38, 0x9d5d24, 0xb3762e, 0xead492, 0xf2e09e, 0xcb9448, 0x9d5f27, 0x8f552e, 0x855027, 0x855027, 0x794621, 0x7a4824, 0x724424, 0x60391f, 0x573215, 0x8e5c2c, 0x875726, 0x6d4824, 0x673e20, 0x794623, 0x9a6530, 0xb8894e, 0xd2ac6d, 0xcaa367, 0xc19962, 0xa58b5c, 0x3a2a10, 0x230f00, 0x5a370e, 0x805022, 0xbb9d5e, 0xe2c880, 0xbc9e62, 0x624016, 0x58341f, 0x6a492a, 0x5e3c1d, 0x613f1d, 0x79522d, 0x76522b, 0x6a4c29, 0x5b3d1f, 0x56391d, 0x553a1f, 0x5e4124, 0x684623, 0x694721, 0x6f4a21, 0x7a5125, 0x7b5225, 0x6b461b, 0x613f1f, 0x432406, 0xbc955e, 0xbd9055, 0x7a490e, 0xbd9762, 0xe1bf80, 0xbf9a58, 0xb28649, 0x8a673f, 0x3c250c, 0x67482c, 0x936c42, 0x885d2a, 0x825b31, 0x4d2d10, 0x8b612b, 0xe1cb9d, 0xc8b795, 0x290000, 0x927246, 0xc6a065, 0xaa8758, 0x845b2c, 0xa77a42, 0xae7e42, 0xb48644, 0xc09e65, 0x633e12, 0x785329, 0x855c29, 0x976a30, 0x9f7235, 0x8c6329, 0x8e662f, 0x98713c, 0x7f5a29, 0x724e26, 0x714d26, 0x745026, 0x744e27, 0x6d4b26, 0x654625, 0x5a3e20, 0x594020, 0x604122, 0x704e2a, 0xad8550, 0xb98949, 0xb58848, 0x7f5a34, 0x4e301e, 0x533b25, 0x715435, 0xaa8a5d, 0x917447, 0x5d4528, 0x402f15, 0x41341e, 0x624727, 0xa1825d, 0x715636, 0x61360c, 0xa77337, 0xa6733b, 0x724d27, 0x7e542b, 0x794b28, 0x8b5a2c, 0xa7733b, 0x996029, 0xa56934, 0x9a5b25, 0xc78f42, 0xecb55a, 0xe7b155, 0xefb962, 0xe8ab56, 0xe2aa59, 0xfadb88, 0xecbc67, 0xe09e49, 0xd79544, 0xd89549, 0xc17e3c, 0xb06d33, 0x9e5e2c, 0x8e5229, 0x8c4c24, 0x77401d, 0x5a3117, 0x512a14, 0x482612, 0x412310, 0x3c200e, 0x3c210c, 0x654024, 0x663f23, 0x341b07, 0x2a190e, 0x28170b, 0x231409, 0x201309, 0x1e1108, 0x1d1007, 0x1b0e06, 0x1a0d05, 0x190c05, 0x180b05, 0x160b03, 0x170d04, 0x170d04, 0x150c02, 0x140a04, 0x130a06, 0x130a05, 0x120b05, 0x100903, 0x0e0903, 0x0c0701, 0x0c0703, 0x0b0603, 0x0a0702, 0x090702, 0x070601, 0x070501, 0x080300, 0x080301, 0x050300, 0x050400, 0x060400, 0x060302, 0x030201, 0x020200, 0x030301, 
-  0x030200, 0x030200, 0x040400, 0x040500, 0x040500, 0x050400, 0x050400, 0x060400, 0x070500, 0x060601, 0x070501, 0x080500, 0x0a0601, 0x090601, 0x0a0702, 0x0c0702, 0x0c0701, 0x0d0802, 0x100a04, 0x120a05, 0x130a06, 0x140b06, 0x160c05, 0x180d06, 0x1b0f07, 0x1c0f07, 0x1f1109, 0x23120a, 0x26150a, 0x29180c, 0x2b190d, 0x2f1a0d, 0x311b0e, 0x321d0e, 0x341f0e, 0x38200f, 0x3e2312, 0x452613, 0x492610, 0x603a22, 0x73482d, 0x643416, 0x743c1c, 0x80421d, 0x8e4a21, 0xa35d29, 0xb26a2e, 0xaf662b, 0xa65e27, 0x9f5a27, 0xa15c2b, 0xa86129, 0xb16730, 0x8d4e22, 0x643014, 0x6a3817, 0x763c18, 0xac6e36, 0xcc8c49, 0xbf7e40, 0xb57a37, 0xf4e19d, 0xead68e, 0xbc843f, 0x8b5324, 0x844c28, 0x905a2f, 0x814e26, 0x794620, 0x724221, 0x6a4023, 0x623919, 0x955f30, 0x925d31, 0x7f5635, 0x563216, 0x70421e, 0x966136, 0x754217, 0x522500, 0x4d260a, 0x6e502b, 0xb69967, 0xb89467, 0x442412, 0x2c150c, 0x4d2c18, 0x673810, 0x966d38, 0xd4b573, 0xdcbd79, 0xa0804a, 0x694117, 0x603d1a, 0x63411f, 0x65401e, 0x65421d, 0x67451d, 0x704b22, 0x73502a, 0x694724, 0x6a4723, 0x754e28, 0x734e26, 0x785128, 0x7a5026, 0x734a21, 0x6e4922, 0x664321, 0x462a18, 0x94703b, 0x926632, 0x734b22, 0x73481c, 0xa88148, 0xa78248, 0x795937, 0x3f2916, 0x60472a, 0xac875a, 0x8a5c29, 0x9b6f37, 0x634325, 0x1c0500, 0x5a3617, 0xa6824f, 0xebd7a5, 0x85724e, 0x380000, 0x74552f, 0x8d683a, 0x8a602d, 0x9d6d30, 0xaf7d3d, 0xb98944, 0xb88f52, 0x613d14, 0x6a4a24, 0x865d30, 0x8f632f, 0x956b31, 0x997033, 0x966c32, 0x8e6430, 0x8c602e, 0x7b5226, 0x775328, 0x714d24, 0x6e4b26, 0x5a3c1d, 0x563b21, 0x583b22, 0x5d3c23, 0x947346, 0xcfa769, 0xcd9e59, 0x9f713b, 0x6a4723, 0x452712, 0x533620, 0x4f361f, 0x604428, 0x5c3c1f, 0x735734, 0x573e22, 0x523d27, 0x796041, 0x785f3a, 0x866a3c, 0x6f552f, 0x492d14, 0xa2743c, 0xa17039, 0x64411f, 0x724b25, 0x744b24, 0x7b4c27, 0x8f5d2c, 0x9a622e, 0x9b602d, 0xa76c2d, 0xe6ac57, 0xe0a84c, 0xdca349, 0xd9a04a, 0xd49747, 0xc6823c, 0xdb9f4e, 0xd69644, 0xd08b3e, 0xdd9c4f, 0xe09e54, 0xc17c37, 0xb77232, 0xa7642c, 0x96572c, 0x854722, 0x723e1c, 0x5e3418, 0x522b15, 0x482713, 0x402311, 0x3b200f, 0x381f0f, 0x391f0f, 0x31180a, 0x2c180b, 0x28170b, 0x28160a, 0x241408, 0x201208, 0x1c1007, 0x190e06, 0x180d04, 0x170c04, 0x170b05, 0x160b04, 0x160c03, 0x160c03, 0x150c03, 0x150c03, 0x140b04, 0x120a03, 0x120b03, 0x120b03, 0x100a02, 0x0e0903, 0x0c0701, 0x0b0702, 0x0b0602, 0x0a0602, 0x080601, 0x060500, 0x070501, 0x070300, 0x070300, 0x040400, 0x040400, 0x040300, 0x040300, 0x040300, 0x020300, 0x030400, 
-  0x030200, 0x050100, 0x040300, 0x040400, 0x040500, 0x040400, 0x040400, 0x050400, 0x060400, 0x060501, 0x070501, 0x080401, 0x090501, 0x090601, 0x0a0702, 0x0c0702, 0x0c0701, 0x0f0903, 0x110a04, 0x130b05, 0x130a05, 0x150b05, 0x170d06, 0x190e06, 0x1c0f07, 0x1d0f07, 0x1f1009, 0x23130a, 0x27150b, 0x29170b, 0x2b180d, 0x2d1a0d, 0x311c0e, 0x341d0f, 0x361e0e, 0x3a210e, 0x3f2310, 0x482713, 0x4d2812, 0x5e371e, 0x633315, 0x6b3718, 0x7b401c, 0x915028, 0x945025, 0x9d5828, 0x9c5925, 0x985626, 0x925225, 0x935629, 0x935328, 0x965528, 0xa65c2b, 0xac6433, 0x753f1a, 0x59300b, 0x6d3916, 0x965425, 0xc98948, 0xce8c44, 0xa86724, 0xc18d4d, 0xf9e9a5, 0xe9cd84, 0xb4803b, 0x854d21, 0x875129, 0x8a562c, 0x825028, 0x70411b, 0x714422, 0x7b4921, 0x9b5e2f, 0x985d35, 0x835029, 0x8c5f30, 0x8c5b2a, 0x865329, 0x7c562f, 0x72593a, 0x412c17, 0x0f0000, 0x000000, 0x79593a, 0x563c24, 0x372615, 0x2e1a0d, 0x2d1809, 0x542f0f, 0x7b460b, 0xb78f52, 0xe0c57b, 0xd8bb6f, 0xa27e49, 0x684217, 0x5b320d, 0x613c1e, 0x5f3e21, 0x674526, 0x724e2a, 0x66431e, 0x724d27, 0x7e552e, 0x6c441a, 0x764c22, 0x7b5025, 0x714820, 0x6c4621, 0x674421, 0x3b230f, 0x6c4b27, 0x8f643a, 0x66411a, 0x66431b, 0x603e22, 0x3d2414, 0x2c1f09, 0x63472d, 0xbb915e, 0x997039, 0x9c6c39, 0x956b3e, 0x3f2814, 0x2a1205, 0x452a17, 0x6a461c, 0x937549, 0xc5a676, 0x745a3c, 0x41250f, 0x3c2408, 0x7d5c30, 0x9e7339, 0xaf7d3e, 0xbc8b4a, 0x986f3b, 0x664424, 0x664724, 0x795225, 0x825726, 0x8b612b, 0x91652d, 0x9b6e39, 0x8d5f2d, 0x885d2d, 0x6f4925, 0x624426, 0x583c1e, 0x64462a, 0x604123, 0x6c4a26, 0x8e6939, 0xb99151, 0xc9a25c, 0x9c733c, 0x7b562e, 0x492d13, 0x573a19, 0x9f7a49, 0xa58850, 0x745b32, 0x1c0000, 0xb79e69, 0xc0a26d, 0x593e1e, 0x5e442d, 0xb9915f, 0xc4995e, 0xbb9252, 0xc2985b, 0x9e7441, 0xbe924a, 0xb98d4c, 0x5b391c, 0x71492b, 0x744b23, 0x7b4f27, 0x8e5c2e, 0x8f5727, 0x9f672f, 0xd1994e, 0xcc9147, 0xdca24c, 0xd39743, 0xcb8d42, 0xb67733, 0xc2793a, 0xc8813b, 0xc07a36, 0xbf7735, 0xc98441, 0xc27d3b, 0xbf7836, 0xbc7435, 0xae682f, 0x9f5c28, 0x894c20, 0x78431f, 0x66381a, 0x552d14, 0x492711, 0x412410, 0x3b200d, 0x381d0b, 0x341a0c, 0x321b0e, 0x2d180a, 0x2a1608, 0x281609, 0x251309, 0x201109, 0x1d0f07, 0x1a0f06, 0x180d05, 0x160b05, 0x150a04, 0x160b04, 0x160d04, 0x150c04, 0x140c04, 0x130b04, 0x120b04, 0x120b04, 0x120b04, 0x100a03, 0x0e0903, 0x0e0903, 0x0c0701, 0x0b0602, 0x0a0502, 0x0a0602, 0x070500, 0x060500, 0x060400, 0x070300, 0x070300, 0x040400, 0x030500, 0x030300, 0x030200, 0x030200, 0x030300, 0x030301, 
-  0x040200, 0x050100, 0x050200, 0x040400, 0x040500, 0x040500, 0x040500, 0x050500, 0x060400, 0x050400, 0x060401, 0x080401, 0x090501, 0x090601, 0x0a0702, 0x0b0702, 0x0c0701, 0x100902, 0x120b03, 0x130b04, 0x140b04, 0x160c05, 0x170e05, 0x190e05, 0x1b0e06, 0x1e1007, 0x20110a, 0x23130a, 0x26150a, 0x29170b, 0x2c1a0d, 0x2f1b0c, 0x321c0e, 0x361d0f, 0x3a1f10, 0x3f2310, 0x442612, 0x492713, 0x4c2913, 0x5a3118, 0x794a2e, 0x6f3917, 0x80441c, 0x935326, 0x8e4d21, 0x86471c, 0x80451d, 0x7f451e, 0x7c451f, 0x804924, 0x824620, 0x854c23, 0x945427, 0xa95f2b, 0xae6733, 0x894a24, 0x82451c, 0x8c4c24, 0x88491b, 0xae6f32, 0xb26e38, 0x9e5e24, 0xc09657, 0xf9e89f, 0xe3c37b, 0xb87d35, 0x925828, 0x93592d, 0x945c32, 0x88532b, 0x804c27, 0x975b28, 0xb97938, 0xb57b3b, 0xac7238, 0xa96f3b, 0xa36937, 0xa7713c, 0xd7af71, 0xcaa975, 0x582e0d, 0x906c44, 0xa98a5d, 0x472b0f, 0x583419, 0x93673e, 0x8d623a, 0x755130, 0x4b301a, 0x48270b, 0x6a3b14, 0x8c5622, 0xc19a57, 0xe7c87d, 0xdcc077, 0xad8c50, 0x755120, 0x552f0b, 0x5b371d, 0x5d3d21, 0x624120, 0x6c4923, 0x7d552d, 0x7f572d, 0x7c5126, 0x7e5326, 0x754c22, 0x6a441d, 0x62401f, 0x3e2a12, 0x3b1e0b, 0x754e29, 0x653e1a, 0x5e3e1d, 0x4e3720, 0x331a0c, 0x604424, 0xb78c55, 0xa5733d, 0x94622c, 0xa1753e, 0x724e2b, 0x46321c, 0x2e1c10, 0x291909, 0x613f24, 0x663200, 0xb09264, 0xe1d0a1, 0x7f6d50, 0x4c2300, 0x79572f, 0x946932, 0x9c6b30, 0xa97b45, 0x664420, 0x614025, 0x694824, 0x815b2c, 0x946a34, 0x966a2f, 0x93652e, 0x966934, 0x906632, 0x755427, 0x593b1f, 0x5d3e24, 0x664522, 0x7e592e, 0x9b7240, 0xae804a, 0xa4773c, 0x9d743a, 0x714e22, 0x503418, 0x4f3620, 0x603d1b, 0x956d3d, 0xb99154, 0xc3a05a, 0xd1b27a, 0x8f7446, 0xb79958, 0x714b26, 0x5e442c, 0x412b12, 0x6b4010, 0x683d07, 0x623e1a, 0x613a16, 0x724c25, 0x8d6533, 0xa8804b, 0x61411c, 0x734929, 0x774c28, 0x744924, 0x814e27, 0x8c5421, 0xd59e54, 0xdda653, 0xeab460, 0xc1863c, 0xbe803f, 0xa5662e, 0xb06c34, 0xbb7636, 0xb06a31, 0xaa652f, 0xa9642e, 0xa8632f, 0xa6622d, 0xaa652e, 0xae6630, 0xaa632c, 0xb16e38, 0xa66b3b, 0x7e451f, 0x723e1f, 0x5d3318, 0x502c15, 0x452610, 0x3d210c, 0x381f0d, 0x351c0d, 0x341d0e, 0x2d180a, 0x2a1709, 0x291609, 0x25140a, 0x201109, 0x1d0f07, 0x190e06, 0x170d06, 0x150a04, 0x150a04, 0x160b04, 0x150c03, 0x130a03, 0x120a03, 0x110b04, 0x110a04, 0x120b05, 0x110a04, 0x0f0a03, 0x0e0903, 0x0d0802, 0x0c0701, 0x0b0602, 0x0a0502, 0x090501, 0x070500, 0x050400, 0x060400, 0x070300, 0x040200, 0x040400, 0x040500, 0x030300, 0x040300, 0x030200, 0x030301, 0x020200, 
-  0x030100, 0x020100, 0x040300, 0x040400, 0x040500, 0x040500, 0x030400, 0x040500, 0x080401, 0x080401, 0x060501, 0x060500, 0x080501, 0x0a0601, 0x0a0702, 0x0b0702, 0x0d0703, 0x100a04, 0x110a04, 0x130a03, 0x140b04, 0x160c05, 0x170d06, 0x170e07, 0x1a0f07, 0x1e1107, 0x221209, 0x25130a, 0x27150a, 0x2a170a, 0x2f1b0c, 0x321b0e, 0x331c0f, 0x381e10, 0x3d1f0f, 0x462612, 0x4c2b17, 0x4b2812, 0x502a12, 0x62361b, 0x7f4d2f, 0x773d19, 0x854620, 0x86451b, 0x95582c, 0x8b522a, 0x693410, 0x6d3a1b, 0x754020, 0x7e4a28, 0x75411d, 0x7a451f, 0x854b23, 0x975424, 0xaf6631, 0xa36032, 0x6b3310, 0x693619, 0x743c19, 0x85481d, 0xaa6938, 0x9e602e, 0x914e12, 0xc49d59, 0xfaeca5, 0xdfbf79, 0xb47733, 0x995c2e, 0x985e31, 0x91572b, 0x975e2e, 0xbd7b3b, 0xd18f49, 0xb87c3e, 0xab723b, 0xac7341, 0x935d31, 0x8d5324, 0xa57541, 0x876137, 0x431500, 0x6e4727, 0xc39c65, 0xa27848, 0xa36f3b, 0xaf7a42, 0x906036, 0x7f522a, 0x9a7143, 0x6e4e2a, 0x3b1e08, 0x542b12, 0x6c3304, 0x8f5c1f, 0xc8a25d, 0xe7ca7c, 0xe5ca7a, 0xbe9e59, 0x8e6935, 0x6d4019, 0x613c1a, 0x62401d, 0x69441f, 0x7f572e, 0x7c5124, 0x825627, 0x7a5026, 0x6b4420, 0x64401e, 0x50371b, 0x2b1809, 0x452810, 0x6f4b29, 0x573b1f, 0x2c1508, 0x5f4326, 0xb28a54, 0xa8783c, 0x96642e, 0xa7753c, 0x8e6738, 0x523518, 0x573e22, 0x3d2b18, 0x1c0c03, 0x452a17, 0x7e562c, 0x8d5d1c, 0xc6ae81, 0xe7d9ac, 0x917d57, 0x532e00, 0x7c562c, 0x885f31, 0x60401d, 0x4a2f16, 0x644626, 0x6d4a24, 0x7d5628, 0xa07339, 0xa67736, 0x996b34, 0x845829, 0x6f471b, 0x68431c, 0x725029, 0x8d653b, 0x9e7544, 0xb2864b, 0xb88b4c, 0x8a5e2b, 0x6d451f, 0x503318, 0x432e19, 0x5e442d, 0x52381e, 0x8f6733, 0x7d562d, 0x4f2d13, 0x360700, 0x8f7148, 0xdfbc78, 0xa88039, 0x603d1f, 0x62472c, 0x583c24, 0x3d230e, 0x442a13, 0x442a17, 0x4a311b, 0x442a14, 0x432412, 0x512f14, 0x64411f, 0x764f2b, 0x714a25, 0x704724, 0x7e4c21, 0xcc9b51, 0xd09b4b, 0xbf843a, 0xca9148, 0xba7d3b, 0xa4672f, 0x9b5f2f, 0xbc793f, 0xa35f28, 0x995827, 0x935427, 0x925226, 0x925227, 0x925326, 0x955427, 0x9b572a, 0x9d5a28, 0xa76532, 0xa56637, 0x8c4f24, 0x7f4620, 0x68391a, 0x562f17, 0x4c270f, 0x422410, 0x3b200d, 0x361d0c, 0x2f1a0b, 0x2b1809, 0x291709, 0x271609, 0x241409, 0x201209, 0x1c0f07, 0x190d06, 0x160c04, 0x150c03, 0x150c03, 0x140b02, 0x130a03, 0x120b03, 0x120b03, 0x120b03, 0x110a02, 0x110a02, 0x110a02, 0x100901, 0x0f0801, 0x0e0603, 0x0b0602, 0x0a0501, 0x0a0501, 0x090501, 0x060401, 0x050400, 0x050400, 0x040300, 0x040300, 0x040300, 0x040401, 0x040301, 0x040400, 0x030300, 0x030301, 0x020200, 
-  0x030200, 0x020100, 0x030200, 0x030400, 0x030400, 0x040500, 0x040500, 0x040500, 0x070300, 0x080401, 0x060501, 0x050500, 0x080501, 0x0a0601, 0x0a0702, 0x0b0702, 0x0e0704, 0x100a04, 0x120b05, 0x120a03, 0x150b05, 0x180c05, 0x190d07, 0x1a0f08, 0x1c0f07, 0x201007, 0x241309, 0x26150a, 0x28160a, 0x2a170b, 0x2d190b, 0x301b0e, 0x331d10, 0x382011, 0x3e2111, 0x462511, 0x4e2a14, 0x532c13, 0x5b3014, 0x683617, 0x723b17, 0x79411e, 0x7a411e, 0x743914, 0x9c6337, 0x945e36, 0x724125, 0x63341a, 0x64351b, 0x693819, 0x6d3d1e, 0x713f1e, 0x7a4220, 0x834a25, 0x975526, 0xab6735, 0x975b31, 0x713a16, 0x793f1c, 0x814219, 0x945424, 0xbc7a44, 0xae6933, 0xa96721, 0xd7ab69, 0xfaeba4, 0xdfc079, 0xb57c3f, 0x945727, 0xa06335, 0xaa6a34, 0xbe8044, 0xae723b, 0x8f592a, 0x84542a, 0x7d4f27, 0x6c401b, 0x703f1e, 0x71411c, 0x5e3718, 0x58361e, 0x47210d, 0x7d4f22, 0xbc8244, 0x98632f, 0x523011, 0x401d05, 0x51270d, 0x704219, 0xa27445, 0x5f3d1c, 0x432f18, 0x371f0c, 0x4c2610, 0x733f16, 0x8f5f2a, 0xb18b4c, 0xd9b56b, 0xe3c376, 0xd7b86e, 0xab884b, 0x886230, 0x67411b, 0x6c461f, 0x7c5225, 0x835727, 0x7d5225, 0x714921, 0x734e24, 0x61421f, 0x412c19, 0x291508, 0x39230e, 0x241600, 0x543b20, 0xaf8554, 0x986b35, 0x8f602a, 0x996b34, 0x9a6a3d, 0x5e3d1e, 0x523a1e, 0x5b4022, 0x4d361c, 0x362514, 0x1f0900, 0x4d2f17, 0x7d5227, 0x825000, 0xad9260, 0xdac493, 0x967d55, 0x462704, 0x4a2a13, 0x50361a, 0x5a4222, 0x674b25, 0x76522a, 0x855b2c, 0x9b6e33, 0x9d7031, 0x885c2d, 0x784e22, 0x9a7547, 0xa57e47, 0xb78e54, 0xa77b43, 0x986a35, 0x825a24, 0x7a5229, 0x5e381b, 0x54361f, 0x563c22, 0x583f23, 0x41301a, 0x593d1a, 0x996e37, 0x734d22, 0x7a552e, 0x53361e, 0x040000, 0x9f7741, 0xa87e43, 0x5b3c21, 0x65492b, 0x705133, 0x6d4e2b, 0x7f5d35, 0x68482a, 0x694929, 0x704b2a, 0x6c4a29, 0x6c4d2c, 0x664524, 0x6f4c2b, 0x60381a, 0x77461f, 0xc5954b, 0xe9bc62, 0xeec173, 0xbf8a47, 0xa86a27, 0xaa7338, 0x8f5829, 0xa6632f, 0x9b5c2b, 0x905227, 0x8a4d27, 0x854b26, 0x824823, 0x804720, 0x80471f, 0x81461f, 0x844721, 0x884a23, 0x8b4c22, 0x8c4d23, 0x8f512a, 0x824722, 0x6f3d1d, 0x61351a, 0x572e14, 0x4b2913, 0x432512, 0x391e0d, 0x311a0c, 0x2c180a, 0x291709, 0x271508, 0x251409, 0x211209, 0x1d1008, 0x1b0e06, 0x180d04, 0x160c03, 0x140b02, 0x130a02, 0x130a03, 0x120b03, 0x110a03, 0x110a02, 0x0f0902, 0x0f0902, 0x0f0802, 0x0f0802, 0x0d0701, 0x0c0703, 0x0b0602, 0x0a0501, 0x090601, 0x090502, 0x070501, 0x050400, 0x050400, 0x050400, 0x040400, 0x040300, 0x040301, 0x030301, 0x020300, 0x030300, 0x030301, 0x010100, 
-  0x030200, 0x030200, 0x030200, 0x030300, 0x040500, 0x030400, 0x030400, 0x030400, 0x050400, 0x060400, 0x070401, 0x080500, 0x090601, 0x090601, 0x0a0702, 0x0b0703, 0x0f0805, 0x100a04, 0x120b05, 0x130b04, 0x150b05, 0x180c05, 0x1b0e06, 0x1d0f08, 0x1f0f07, 0x221107, 0x251308, 0x271509, 0x29170b, 0x2b180c, 0x2c1a0d, 0x2f1b0d, 0x341d10, 0x3a1f10, 0x3f2210, 0x492712, 0x512b13, 0x5b2f14, 0x663516, 0x6e3a1a, 0x703b1b, 0x6d3b1c, 0x663719, 0x623418, 0x5a2b10, 0x572a0f, 0x6f462d, 0x5b3014, 0x5e3317, 0x61361c, 0x62361b, 0x67391c, 0x6e3d1e, 0x754322, 0x894b21, 0xa55f2e, 0xac6734, 0xa56232, 0x81421d, 0x8a4d26, 0x84471b, 0x90501f, 0xae6e36, 0xa66933, 0xac621d, 0xd1a55b, 0xf8e9a1, 0xe2c37c, 0xb7782f, 0xa66934, 0xb4723e, 0xb27138, 0x9f6130, 0x915a2f, 0x7f4e29, 0x754926, 0x663e1c, 0x6a3f24, 0x673e22, 0x593519, 0x593617, 0x543417, 0x734723, 0x945a2a, 0x6f4624, 0x331d08, 0x50331b, 0x644428, 0x653916, 0x87552c, 0x6b431d, 0x5d3b23, 0x6a472b, 0x4c3318, 0x221100, 0x46210b, 0x56270b, 0x663710, 0x8f622e, 0xba9658, 0xe2c77f, 0xe9d28b, 0x765a33, 0x66401e, 0x7a5225, 0x8a5f2d, 0x815828, 0x6d471d, 0x6f4820, 0x65411d, 0x4c311c, 0x3a2311, 0x301200, 0x67492c, 0xa8814f, 0x926532, 0x845627, 0x835a2e, 0x724d29, 0x4b3307, 0x573e22, 0x5c4026, 0x5d401f, 0x5a3f21, 0x48341e, 0x332110, 0x150000, 0x3a240f, 0x77502c, 0x865320, 0x976d3d, 0xcfb17a, 0x9e8655, 0x775b35, 0x634018, 0x6e4922, 0x744e20, 0x7b5328, 0x805727, 0x8b612d, 0x8b602e, 0x724c26, 0x5f3d18, 0xab8853, 0xaf8448, 0x90622f, 0x774d26, 0x714620, 0x523215, 0xa58751, 0xb99e61, 0x5f401b, 0x5e3f1f, 0x5e4428, 0x3a2712, 0x6d431f, 0xa57b41, 0x84673b, 0x774e28, 0x614023, 0x211304, 0x7b4f29, 0x92673b, 0x583b21, 0x654726, 0x724e2c, 0x674625, 0x6b492a, 0x6b4522, 0x7a562f, 0x6b4a29, 0x583c1e, 0x5a4025, 0x563a21, 0x56351a, 0x6e461f, 0xc18d46, 0xdda54d, 0xd29d4b, 0xc38c41, 0xb77a37, 0xa36d35, 0x7d4a1f, 0x9b602f, 0x9b5b2d, 0x884f27, 0x7f4a24, 0x7a4724, 0x774422, 0x73401e, 0x6f3e1d, 0x6e3e1b, 0x703e1c, 0x703d1c, 0x784321, 0x7b4521, 0x7c441f, 0x804621, 0x7e4522, 0x753f1c, 0x6f3b1a, 0x633618, 0x572f16, 0x4f2c16, 0x3f210e, 0x351c0c, 0x2e180a, 0x2a1608, 0x271508, 0x251408, 0x221309, 0x1f1108, 0x1b0e06, 0x190d05, 0x160b03, 0x140a04, 0x130a03, 0x130a03, 0x120b03, 0x100903, 0x100903, 0x0e0803, 0x0d0802, 0x0c0702, 0x0c0701, 0x0c0702, 0x0c0703, 0x0a0602, 0x090601, 0x090601, 0x090501, 0x060401, 0x050400, 0x050400, 0x040400, 0x040500, 0x030400, 0x030301, 0x020200, 0x030300, 0x030401, 0x020200, 0x010100, 
-  0x030201, 0x040301, 0x030200, 0x030300, 0x030400, 0x040500, 0x030400, 0x030400, 0x040300, 0x050400, 0x070400, 0x080500, 0x090501, 0x090500, 0x0a0702, 0x0c0803, 0x0e0805, 0x0f0903, 0x120b05, 0x130b04, 0x140b04, 0x170d05, 0x1a0e06, 0x1e0f08, 0x1f1008, 0x211308, 0x261407, 0x29160a, 0x29170b, 0x2a180d, 0x2c1a0d, 0x301c0d, 0x371e10, 0x3d200f, 0x42240f, 0x4b2812, 0x552c13, 0x643619, 0x6c3a1b, 0x673416, 0x623217, 0x582e14, 0x522c14, 0x502c16, 0x4a2813, 0x4e2c14, 0x4d2910, 0x542d17, 0x552e19, 0x543016, 0x593118, 0x5d3319, 0x63381a, 0x6c3e1d, 0x7b451f, 0x8f532b, 0x955425, 0xa96432, 0x884b24, 0x65300f, 0x653617, 0x663514, 0x8d5528, 0xa76a2e, 0x995a28, 0xbb7830, 0xe7b969, 0xfbeba2, 0xe2c47d, 0xcd9247, 0xc3813e, 0xbe7c41, 0xb87841, 0xac7140, 0x8e592e, 0x7f4e29, 0x6e4220, 0x724625, 0x673d1e, 0x5e3719, 0x5b361b, 0x523119, 0x532602, 0x9f7445, 0x72522f, 0x4c2c12, 0x603a1c, 0x603e23, 0x653d16, 0xa4713c, 0x93673c, 0x5d381b, 0x744b29, 0x513516, 0x55391b, 0x9c6e42, 0x664322, 0x281502, 0x49250f, 0x5c280d, 0x976931, 0xc9a360, 0x7d592f, 0x5f3b1b, 0x7f582d, 0x805423, 0x7b5224, 0x6e4821, 0x6b441e, 0x5b350c, 0x4e2c0d, 0x7d582f, 0xa7814d, 0x9a7241, 0x895b2d, 0x8f6732, 0x7c5a2f, 0x523013, 0x7a6345, 0xb29c77, 0x51360a, 0x5e3f1f, 0x624221, 0x583c1f, 0x4e371e, 0x442b12, 0x4f3a1e, 0x513b22, 0x291301, 0x614120, 0x825729, 0x936a39, 0xd7ba7f, 0xe9d796, 0x98804f, 0x7c5920, 0x967644, 0x825d2f, 0x805729, 0x805927, 0x815927, 0x664625, 0x4d3520, 0x5b3712, 0x905f2c, 0x84562d, 0x60401f, 0x7e5834, 0x210000, 0x7d6130, 0xd6b772, 0xa28d5e, 0x7c6948, 0x4b3116, 0x46311c, 0x5b341c, 0x947546, 0xcdb07d, 0x643f1e, 0x5f3d26, 0x38200a, 0x86592f, 0x8a5e33, 0x604021, 0x623a0e, 0x764b2a, 0x765331, 0x603e21, 0x724c2b, 0x73502b, 0x54391d, 0x543c25, 0x4c341f, 0x52361e, 0x6f481e, 0xb68442, 0xce9845, 0xc68f45, 0xa06a31, 0xa06930, 0x95612e, 0x74421b, 0x92582b, 0x92552c, 0x834c26, 0x794522, 0x71411f, 0x704322, 0x6f401f, 0x724325, 0x633719, 0x623719, 0x63381b, 0x66391e, 0x643519, 0x663719, 0x6a391a, 0x713d1d, 0x753f1e, 0x834823, 0x864a25, 0x6b3a1a, 0x603417, 0x532d12, 0x46250f, 0x3a1f0c, 0x321b0b, 0x2d1809, 0x291608, 0x271509, 0x24140a, 0x201209, 0x1c0f06, 0x1a0d05, 0x160b04, 0x150a04, 0x130a04, 0x130b03, 0x100903, 0x100904, 0x0f0704, 0x0d0703, 0x0c0703, 0x0b0602, 0x0b0602, 0x0c0703, 0x0b0602, 0x0a0601, 0x090601, 0x090601, 0x080401, 0x060401, 0x050400, 0x040300, 0x050400, 0x040500, 0x030400, 0x020301, 0x020201, 0x040300, 0x030200, 0x020100, 0x020100, 
-  0x030200, 0x030200, 0x030300, 0x030300, 0x030300, 0x030400, 0x030400, 0x030400, 0x040400, 0x050400, 0x070401, 0x080500, 0x090501, 0x090601, 0x0b0803, 0x0d0804, 0x0f0804, 0x110a03, 0x120b04, 0x140b05, 0x150b05, 0x170d05, 0x1a0f06, 0x1d0f08, 0x1f1109, 0x231408, 0x271507, 0x2a1709, 0x2b180b, 0x2b190c, 0x2f1b0d, 0x351e0e, 0x3b1f11, 0x412310, 0x472710, 0x512b13, 0x5b3018, 0x603014, 0x774725, 0x784928, 0x4e230d, 0x47240e, 0x442410, 0x442511, 0x452411, 0x492713, 0x4b2812, 0x4d2a12, 0x4e2b13, 0x4f2c14, 0x512e16, 0x563016, 0x5d3317, 0x6a3c1b, 0x784928, 0x71411f, 0x814a24, 0x985627, 0xab6331, 0x98592c, 0x723912, 0x713e1a, 0x723816, 0x915622, 0xae6d35, 0xbe7838, 0xd8933f, 0xe1b161, 0xfbefaa, 0xeed590, 0xdda656, 0xca8a49, 0xb97940, 0xa26836, 0x8f5a2d, 0x87542c, 0x7c4b2a, 0x784a25, 0x754a28, 0x693f22, 0x613a1b, 0x573417, 0x430700, 0xa88357, 0x8e6e4b, 0x4c260d, 0x97734b, 0x805939, 0x653715, 0xa16937, 0x895b2f, 0x53371a, 0x543317, 0x664425, 0xa17548, 0xab7949, 0x74512f, 0x2c1706, 0x6f4d31, 0x3d2006, 0x6f4220, 0xaa783c, 0x825b2c, 0x5e3b19, 0x704920, 0x7b4f22, 0x774d21, 0x663e17, 0x805f3a, 0xab8757, 0x8b622f, 0xbf9156, 0xb88d54, 0x6e4314, 0x765026, 0x704e2b, 0x492f17, 0x6d4d2a, 0x9d7640, 0xcbb17b, 0xd8c591, 0x856b43, 0x603b18, 0x55391d, 0x45240d, 0x7f6439, 0xd7b97b, 0xaa8a55, 0x735b3a, 0x2d1f0f, 0x472f17, 0x633f20, 0x6b4415, 0xcbb679, 0xfaecae, 0xeee0a5, 0xedd89f, 0x917449, 0x7a5224, 0x845d30, 0x7b552c, 0x5a3f24, 0x3f2c1a, 0x7c5931, 0x96652e, 0x8d6034, 0x573d22, 0x967145, 0x5a3e1f, 0x472613, 0xa07e50, 0xc9ad75, 0xcfbc90, 0x836845, 0x3f290c, 0x2f1d12, 0x170000, 0x9d7849, 0x7a582d, 0x593d28, 0x5d371e, 0x9a6d3a, 0x7d5529, 0x82633c, 0xc2a975, 0xa18556, 0x744a1c, 0x81592d, 0x6a4925, 0x553a1e, 0x53381c, 0x523b1f, 0x4c2f18, 0x714b20, 0xba8a43, 0xdaa657, 0xb88439, 0xa56f35, 0x6e4319, 0x573312, 0x5c3114, 0x8d542c, 0x92542a, 0x804a24, 0x744423, 0x6f4022, 0x663b1e, 0x633a1d, 0x63381c, 0x623619, 0x633a1e, 0x5c3418, 0x593317, 0x5c341b, 0x5a3119, 0x593118, 0x5a3017, 0x5f3118, 0x663518, 0x7e4623, 0x814723, 0x6e3a1a, 0x673619, 0x593115, 0x4c2b11, 0x41250f, 0x391f0d, 0x311b0c, 0x2b180a, 0x29160a, 0x26150a, 0x21130a, 0x1f1008, 0x1b0d06, 0x180c05, 0x170c05, 0x160c05, 0x130a03, 0x100a02, 0x0f0803, 0x0d0703, 0x0d0703, 0x0c0602, 0x0b0703, 0x0b0603, 0x0b0703, 0x0a0602, 0x090601, 0x090501, 0x080500, 0x060400, 0x050400, 0x040400, 0x040400, 0x040500, 0x040500, 0x030400, 0x020300, 0x020201, 0x030200, 0x030200, 0x020100, 0x020100, 
-  0x030301, 0x030301, 0x020300, 0x020300, 0x020200, 0x030401, 0x030500, 0x030400, 0x040500, 0x050400, 0x060400, 0x080500, 0x090602, 0x090601, 0x0a0702, 0x0c0703, 0x0f0803, 0x110a02, 0x120b03, 0x140b04, 0x160b05, 0x180d05, 0x1a0f06, 0x1d0f07, 0x201209, 0x241409, 0x271608, 0x291608, 0x2c180a, 0x2f1a0c, 0x341d0e, 0x3a2010, 0x3e2111, 0x452411, 0x4d2912, 0x562d16, 0x582e18, 0x55270e, 0x805435, 0x8b603f, 0x3e1703, 0x402210, 0x3f2311, 0x3f220e, 0x3e220c, 0x422410, 0x452512, 0x482712, 0x4a2711, 0x4b2813, 0x4c2b15, 0x502d14, 0x592f15, 0x764e31, 0x693e1e, 0x6a3c1b, 0x7e4924, 0x965a2e, 0x9f5a27, 0xad6834, 0x915226, 0x703a19, 0x713a1c, 0x7f4219, 0xa3622e, 0xbf793a, 0xc78239, 0xcd8e3f, 0xe7bd67, 0xfaeea6, 0xf4e09f, 0xe3af62, 0xb97d3c, 0xa36835, 0x8e5931, 0x8c5830, 0x89552f, 0x7d4b24, 0x7d4e26, 0x72431d, 0x865931, 0x734d25, 0x340000, 0x8f704d, 0xae8e67, 0x471700, 0x5c391d, 0x754722, 0x8b5e35, 0x6d4011, 0x6a4320, 0x4b2d15, 0x644429, 0x9e7246, 0x8b5e30, 0x79522d, 0x3e240c, 0x412c17, 0x66452a, 0x755842, 0x714c26, 0xba884a, 0xa07945, 0x623d1a, 0x714922, 0x7f5327, 0x7a5025, 0x5f3b18, 0x5e4326, 0x9e7e54, 0x9e7643, 0x9f6f3a, 0x7f5121, 0x774b22, 0x6f502d, 0x1d0b04, 0x482e1a, 0x75502d, 0x765228, 0x77491e, 0xd3bb84, 0xddc68c, 0x65421a, 0x4d2c0e, 0x7b5a3a, 0xc29a5f, 0xbb8f4d, 0x8c622e, 0x806241, 0x58432f, 0x1e110c, 0x412c1b, 0x58391b, 0x865f2c, 0xc4a973, 0xc9b682, 0x948157, 0x4c2f0e, 0x694824, 0x825c2d, 0x79542c, 0x503721, 0x452e18, 0x916c40, 0x956731, 0x7c5328, 0x7f6749, 0x99784e, 0x95774a, 0x310d00, 0x64482d, 0xab8858, 0xb18d57, 0xaa824a, 0x88673c, 0x5a4025, 0x7c5b34, 0x82572f, 0x6d4e2b, 0x462e16, 0x8a6536, 0x886234, 0x502a06, 0xb18b51, 0xddbe84, 0xb3986f, 0x795126, 0x805931, 0x634327, 0x593f25, 0x573c21, 0x4c2e17, 0x7e5a2f, 0xca9d4f, 0xdaaa50, 0xc7974b, 0xa77436, 0xbf8e52, 0x916a3e, 0x51280d, 0x834f2c, 0x8f512b, 0x82451e, 0x75401d, 0x673c1c, 0x643b1e, 0x5b351a, 0x58341a, 0x573319, 0x552f13, 0x694428, 0x563218, 0x4f2c13, 0x4e2c14, 0x502c15, 0x4d2a12, 0x4f2b13, 0x522c14, 0x582e16, 0x5c2f15, 0x643416, 0x683619, 0x65351a, 0x5b3218, 0x522f13, 0x492a11, 0x402410, 0x371e0d, 0x2f190a, 0x2a1609, 0x261509, 0x24140a, 0x23130b, 0x1d0f07, 0x1a0d05, 0x170d03, 0x160c03, 0x130a03, 0x110a02, 0x0e0903, 0x0c0702, 0x0d0603, 0x0b0602, 0x0a0602, 0x0a0501, 0x090501, 0x080401, 0x080401, 0x080401, 0x070300, 0x050500, 0x040500, 0x030400, 0x040500, 0x040500, 0x030400, 0x020300, 0x030301, 0x030301, 0x020200, 0x010100, 0x010100, 0x020200, 
-  0x020200, 0x030301, 0x030400, 0x030300, 0x030301, 0x030300, 0x030400, 0x030400, 0x040500, 0x050400, 0x060400, 0x070400, 0x080501, 0x090601, 0x0b0702, 0x0c0704, 0x0f0904, 0x110a02, 0x130b04, 0x140b04, 0x160c05, 0x170d04, 0x1a0f05, 0x1d0f07, 0x201209, 0x241408, 0x261607, 0x291709, 0x2f190c, 0x341b0e, 0x381e0f, 0x3d220f, 0x432411, 0x4b2713, 0x4f2b14, 0x512b15, 0x4e2914, 0x492610, 0x411c06, 0x3a1603, 0x3d2111, 0x3d210f, 0x3b200d, 0x402413, 0x492c1a, 0x3f210e, 0x3f2210, 0x422411, 0x452612, 0x4a2a16, 0x482811, 0x4b2a12, 0x4d270a, 0x927153, 0x684328, 0x5e3116, 0x764322, 0x8e572e, 0x925524, 0xa35f2a, 0xab6636, 0x884d28, 0x6c3616, 0x834720, 0x954e1d, 0xb1672a, 0xd28d43, 0xe2a551, 0xe6ac4d, 0xe3b966, 0xf7eaa7, 0xf5e4a0, 0xd7a95d, 0xab7132, 0x8c572e, 0x87512c, 0x87532b, 0x85522d, 0x7d4a25, 0x96643b, 0xb48251, 0xd1a871, 0x7e6038, 0x582f0e, 0xba9063, 0x7a562f, 0x522a14, 0x6a3f18, 0xac7f55, 0xac8a60, 0x7e5c33, 0x90663b, 0x82572e, 0x7b5431, 0x795636, 0x45290f, 0x362210, 0x624328, 0x3f2711, 0x5e432b, 0x502900, 0xb18148, 0xbd9f60, 0x5d3912, 0x744c25, 0x7c5023, 0x734c22, 0x5a3a1b, 0x402912, 0x000000, 0x331300, 0x6c4524, 0x825729, 0x7e5125, 0x7d5e38, 0x1b0a00, 0x1f1006, 0x483018, 0x5f3e1e, 0x6e461a, 0x88612a, 0x997d48, 0x543312, 0x8b6942, 0xc2985d, 0xad7e3f, 0x87612d, 0x5d3f20, 0x331e0c, 0x221509, 0x060200, 0x3d2a1c, 0x5d3f22, 0x7a4b1d, 0x7d4a0f, 0x542a00, 0x3f2000, 0x513921, 0x5e3e1f, 0x7a552b, 0x714f28, 0x50361e, 0x614726, 0x926e41, 0x8f6130, 0x64421e, 0x523b20, 0x513517, 0xb79c69, 0x685132, 0x150000, 0x563e27, 0xa1835d, 0xa7855c, 0xb08b56, 0xa6804d, 0x835d36, 0x6c4d25, 0x553f26, 0x573a1b, 0xa47c45, 0x714b24, 0x845d2f, 0x8b622f, 0x4e2700, 0x421d00, 0x654226, 0x644428, 0x5f4125, 0x634524, 0x573318, 0x8d6532, 0xc79a4a, 0xdfad53, 0xc19045, 0x94632b, 0x895b2a, 0x785127, 0x61371a, 0x804a24, 0x884d27, 0x7f441e, 0x844d2a, 0x734324, 0x5c3418, 0x573317, 0x523016, 0x4f2e17, 0x4d2b15, 0x503019, 0x48270f, 0x472710, 0x452711, 0x442712, 0x452512, 0x442510, 0x452511, 0x4a2815, 0x4a2814, 0x4d2912, 0x532b12, 0x582e15, 0x5b3018, 0x5b3016, 0x563015, 0x4f2c12, 0x462710, 0x3d220e, 0x341d0d, 0x2e190a, 0x29170a, 0x261409, 0x221208, 0x1d0f06, 0x1a0d05, 0x170d04, 0x140b02, 0x130a02, 0x120a03, 0x0f0903, 0x0c0802, 0x0c0703, 0x0b0602, 0x0a0601, 0x0a0602, 0x090501, 0x090502, 0x080401, 0x080401, 0x080401, 0x050500, 0x040500, 0x040500, 0x040500, 0x030400, 0x030400, 0x030400, 0x030301, 0x020200, 0x020200, 0x000000, 0x010100, 0x020200, 
-  0x010100, 0x010100, 0x030300, 0x030300, 0x020201, 0x020300, 0x040500, 0x040500, 0x040500, 0x050400, 0x050400, 0x080500, 0x090501, 0x090602, 0x0a0702, 0x0c0703, 0x100904, 0x120b03, 0x130b04, 0x140b04, 0x150b05, 0x170c04, 0x1a0f05, 0x1c0f07, 0x1f1108, 0x241408, 0x271609, 0x2a1709, 0x311a0c, 0x371c0e, 0x3b200f, 0x40230f, 0x472612, 0x4b2814, 0x4b2914, 0x492811, 0x42240d, 0x3b210c, 0x391f0d, 0x381e10, 0x381f10, 0x3d220f, 0x3d2310, 0x3b2110, 0x432717, 0x3b2110, 0x3a200f, 0x3c210e, 0x462814, 0x543522, 0x43220a, 0x47270f, 0x4a2912, 0x462100, 0x522a0f, 0x5f321c, 0x6a381c, 0x76421f, 0x874c25, 0x985425, 0xa65f2a, 0xb16d36, 0x955829, 0x874718, 0x9e5725, 0xad6129, 0xc67e37, 0xe8a752, 0xe6ad57, 0xdea34d, 0xe4ae58, 0xf4e19d, 0xf4e29f, 0xd0a25d, 0xa16c31, 0x845026, 0x7e4d26, 0x7a4b28, 0x714323, 0x693c17, 0x663603, 0x936838, 0xbe915c, 0x78451e, 0x9a6f42, 0xc8ad77, 0x663e12, 0x573211, 0x64340c, 0xa17950, 0xba8f5c, 0x996e3f, 0x8e663d, 0x795535, 0x4a301b, 0x37200b, 0x684b2f, 0x6f4c2c, 0x3f250e, 0x65492d, 0x431f01, 0x926530, 0xd2b671, 0x69491f, 0x6a4521, 0x6a421a, 0x714a22, 0x664320, 0x53391d, 0x332110, 0x241104, 0x3d210a, 0x77522b, 0x86582c, 0xb99868, 0x604b2c, 0x3b2514, 0x271308, 0x36220a, 0x563717, 0x583617, 0x3e1400, 0x7d5d34, 0xb99057, 0xa07336, 0x9a703a, 0x513618, 0x392316, 0x3d2c1e, 0x312318, 0x25180d, 0x694e2e, 0x7d562f, 0x8a5f2e, 0x75532c, 0x48311b, 0x523620, 0x654526, 0x714d2a, 0x76512a, 0x6a4a2a, 0x462b14, 0x866840, 0x7f5b2e, 0x815c2e, 0x4a3016, 0x573c26, 0x250000, 0x7b623e, 0xc4a678, 0x6f5735, 0x270000, 0x371700, 0x5b412a, 0x583d1f, 0x5b3e1e, 0x593b21, 0x523621, 0x472c18, 0x956f3a, 0xa07238, 0x8a6232, 0x705028, 0x5a391d, 0x68492a, 0x5b4223, 0x51391f, 0x604324, 0x644327, 0x643a1c, 0xa47b40, 0xd2a253, 0xc69343, 0xbe8943, 0x97642f, 0x85572b, 0x6d4722, 0x582f13, 0x7f4e27, 0x874c26, 0x7a4220, 0x703d1b, 0x6c3e1e, 0x60381b, 0x543117, 0x4e2e15, 0x4a2c15, 0x462a15, 0x442712, 0x533724, 0x442814, 0x432814, 0x3e2310, 0x3d2310, 0x3e220f, 0x3c220f, 0x3d2311, 0x412615, 0x412513, 0x412511, 0x462612, 0x492711, 0x4d2914, 0x522c14, 0x532d14, 0x502c14, 0x492912, 0x40230f, 0x381f0d, 0x331c0c, 0x2d180a, 0x281609, 0x231308, 0x1e1005, 0x1b0e05, 0x170d04, 0x150b02, 0x130a03, 0x120a03, 0x100903, 0x0e0803, 0x0c0703, 0x0b0602, 0x0a0702, 0x090601, 0x080501, 0x080401, 0x080401, 0x070401, 0x070300, 0x040400, 0x040500, 0x030400, 0x040401, 0x030301, 0x030400, 0x030400, 0x030301, 0x020200, 0x020200, 0x000000, 0x010100, 0x010100, 
-  0x010100, 0x010100, 0x020300, 0x030300, 0x020200, 0x020300, 0x030400, 0x040500, 0x040500, 0x050400, 0x050400, 0x080500, 0x090501, 0x090602, 0x0a0702, 0x0d0703, 0x100904, 0x120b03, 0x130b04, 0x140b04, 0x160c05, 0x180e06, 0x1a0f06, 0x1d1008, 0x201108, 0x241409, 0x29160a, 0x2d180a, 0x321b0d, 0x381e0f, 0x3c200f, 0x422410, 0x472511, 0x462410, 0x412310, 0x3e210d, 0x381d0d, 0x361c0f, 0x361c0e, 0x351d0d, 0x341b0b, 0x492f1d, 0x503624, 0x341a09, 0x361c0e, 0x361e10, 0x361d0d, 0x452a18, 0x482915, 0x46230e, 0x553421, 0x4e2e1a, 0x452410, 0x46240d, 0x67422a, 0x63381c, 0x673818, 0x6f3f1d, 0x78431d, 0x8a4f27, 0x9c5b2c, 0xb16b33, 0xc1793d, 0xb97539, 0xa25c25, 0xa85d29, 0xb5672a, 0xc57c34, 0xd69444, 0xdd9b46, 0xe2a550, 0xd39a45, 0xe9cf8f, 0xf5e5a5, 0xd0aa6a, 0xa97339, 0x855227, 0x764722, 0x6e4423, 0x653d1f, 0x643d21, 0x623316, 0x72451a, 0x7c4e29, 0x90541f, 0xd9b574, 0xb39b64, 0x572c00, 0x543015, 0x471d00, 0x4b2808, 0x5d3f21, 0x54391e, 0x3f2206, 0x55381f, 0x805c39, 0x875e36, 0x54391e, 0x4e331a, 0x725431, 0x341300, 0x6f4209, 0xd5b573, 0x9d8354, 0x5d3813, 0x603d1b, 0x704821, 0x794f27, 0x603d1a, 0x4f351b, 0x301d0b, 0x2e1a0b, 0x432812, 0x552902, 0xa68759, 0xa48c64, 0x4c2803, 0x4e3319, 0x38220e, 0x3e2611, 0x3c2412, 0x5d4125, 0xad854f, 0x8f602a, 0x835a2c, 0x604323, 0x382616, 0x4e361f, 0x523a1e, 0x3b2511, 0x8b714c, 0x957347, 0x6d4921, 0x7b5732, 0x5a3b1a, 0x6f502f, 0x593e24, 0x583e1d, 0x76522b, 0x734c23, 0x5f4127, 0x4a2f14, 0x987749, 0x866033, 0x735730, 0x260a00, 0x795d38, 0x574223, 0x000000, 0x846a44, 0xc7a66e, 0xa68959, 0x694a25, 0x58340f, 0x5c3614, 0x654025, 0x624121, 0x8c6c39, 0xb38a4e, 0xa2753b, 0x8a6231, 0x4b3013, 0x47301a, 0x5a4126, 0x604327, 0x5f4428, 0x63492d, 0x6e5033, 0x5e370b, 0xb38949, 0xe1af5f, 0xc79446, 0xa26e31, 0x98632d, 0x976833, 0x785029, 0x512c0f, 0x794b29, 0x854b23, 0x7e4823, 0x6b3e1f, 0x603619, 0x563215, 0x502f14, 0x4c2d15, 0x472a13, 0x422712, 0x3d2410, 0x3d2311, 0x3c210e, 0x3e2310, 0x3e2412, 0x3a210f, 0x391f0e, 0x391f0c, 0x39200e, 0x371f0e, 0x381f0f, 0x3a1f0e, 0x3a1f0c, 0x3b1f0d, 0x3e210e, 0x40220f, 0x442511, 0x492812, 0x4a2913, 0x482814, 0x422511, 0x3c210e, 0x381f0e, 0x321c0d, 0x2c190a, 0x251508, 0x201307, 0x1c1006, 0x180e05, 0x160c03, 0x140a03, 0x120902, 0x110a04, 0x0f0803, 0x0d0704, 0x0b0803, 0x0a0702, 0x090601, 0x080501, 0x060501, 0x060501, 0x050400, 0x050400, 0x040500, 0x030400, 0x030400, 0x040402, 0x020200, 0x030400, 0x030400, 0x030301, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x010100, 0x010100, 0x010100, 0x030200, 0x030200, 0x030200, 0x030200, 0x040301, 0x050400, 0x050400, 0x060400, 0x080500, 0x090601, 0x090601, 0x0b0803, 0x0d0804, 0x110a03, 0x110a02, 0x120b03, 0x140b03, 0x150c03, 0x190e05, 0x1b0e06, 0x1d0f07, 0x221108, 0x251307, 0x291609, 0x2f190b, 0x351b0d, 0x3a1e0f, 0x3e210f, 0x41230f, 0x3f210f, 0x3a1e0d, 0x361d0d, 0x341b0c, 0x331a0d, 0x331b0e, 0x321b0d, 0x301a0b, 0x311c0c, 0x341c0d, 0x341b0d, 0x321c0d, 0x321c0d, 0x331b0d, 0x3d2316, 0x3a2011, 0x3a1f0e, 0x462816, 0x4c2f1d, 0x482916, 0x41210e, 0x482711, 0x654028, 0x63361d, 0x65381b, 0x693b18, 0x804d29, 0x844c24, 0x94582b, 0xac6932, 0xc37938, 0xd68f48, 0xc47f3d, 0xa96126, 0xb5682c, 0xba6c2b, 0xc07730, 0xd59143, 0xdb9c4d, 0xcc8d43, 0xb87628, 0xd3b478, 0xf7eaa7, 0xddc17f, 0xb58442, 0x946233, 0x764726, 0x774e2b, 0x724625, 0x734726, 0x6c4423, 0x542f0c, 0x6a3913, 0xa47136, 0xdfbe75, 0xba9a59, 0x78542b, 0x512905, 0x411c00, 0x50321a, 0x5e3f23, 0x745233, 0x8e6742, 0x81562f, 0x5a3a19, 0x281200, 0x8d6c47, 0x8f6a3c, 0x361f09, 0x5c2e00, 0xb89458, 0xcfb881, 0x4f2c00, 0x59371a, 0x6d4622, 0x754a23, 0x653d1a, 0x5b3c1c, 0x4a321b, 0x3b2510, 0x36220d, 0x2f1104, 0x61441d, 0xc5a979, 0x7c5c3a, 0x583a16, 0x56391c, 0x4f371e, 0x351902, 0x9e7342, 0xa1703b, 0x774b21, 0x8a6f49, 0x624f34, 0x37210a, 0x573d20, 0x553e21, 0x523a22, 0x9b7e54, 0x593c15, 0x3b2109, 0x442a16, 0x5b3e22, 0x664525, 0x523619, 0x5a3f20, 0x6a4924, 0x734e28, 0x604024, 0x7e6034, 0x896435, 0x734f26, 0x513a1d, 0x432912, 0x917243, 0xa58a61, 0x210b00, 0x000000, 0x75552b, 0xc5a56d, 0xceb276, 0xc3a86d, 0xbda066, 0xb79358, 0xc09753, 0xcda155, 0xa4783b, 0x77542d, 0x432a0f, 0x472f1d, 0x573c22, 0x4e3621, 0x4b3521, 0x553b22, 0x56361f, 0x724d24, 0xbf924b, 0xdaaa56, 0xbd8b40, 0xac7736, 0xb47e3f, 0x9d6b38, 0x673f1c, 0x572e12, 0x7b4927, 0x7c4826, 0x78411f, 0x744521, 0x603a1c, 0x532f15, 0x4d2c15, 0x472c14, 0x462711, 0x422310, 0x3c2310, 0x3b220d, 0x39200f, 0x362010, 0x36200e, 0x35200e, 0x351f0e, 0x341e0d, 0x361f0d, 0x341e0e, 0x331c0e, 0x331c0d, 0x371e0e, 0x391f0f, 0x361e0d, 0x371e0c, 0x3a1f0d, 0x3a200e, 0x3d210f, 0x412411, 0x452612, 0x442611, 0x3f240e, 0x3a200d, 0x351d0d, 0x2e190b, 0x281608, 0x241307, 0x1f1007, 0x1b0e06, 0x170b04, 0x150b03, 0x130a03, 0x120a04, 0x100903, 0x0c0802, 0x0b0801, 0x0a0702, 0x080601, 0x060501, 0x060501, 0x070401, 0x060400, 0x040400, 0x030300, 0x030301, 0x030301, 0x030301, 0x030301, 0x030400, 0x030400, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x010100, 0x020200, 0x020200, 0x030301, 0x030300, 0x030300, 0x030300, 0x040301, 0x040300, 0x040300, 0x070300, 0x080500, 0x090601, 0x0a0702, 0x0b0803, 0x0d0804, 0x100902, 0x120b03, 0x130b04, 0x150b03, 0x170d03, 0x1a0e05, 0x1c0f06, 0x1f1108, 0x231208, 0x261408, 0x2b1609, 0x301a0c, 0x361d0f, 0x391d10, 0x3a1e0e, 0x381d0c, 0x331a0b, 0x30190a, 0x2e180b, 0x2c180a, 0x2c180a, 0x2d180a, 0x2f1a0c, 0x2e1a0b, 0x2b190a, 0x2d180b, 0x2e180b, 0x2e190b, 0x2d1a0b, 0x2e190b, 0x361f12, 0x331c0e, 0x362011, 0x3c2113, 0x391c07, 0x4e311f, 0x4d2f1c, 0x4c2a15, 0x583017, 0x61371b, 0x5f361a, 0x65391a, 0x774724, 0x824a21, 0x935729, 0xac6830, 0xc37b37, 0xd18b3f, 0xdb964a, 0xd08b42, 0xc77f36, 0xbc702f, 0xba6f32, 0xb6702d, 0xc98640, 0xc98746, 0xa66632, 0x995518, 0xbd9453, 0xf1e09c, 0xe9d290, 0xc79756, 0x96662b, 0x764a26, 0x744a2c, 0x8a5d34, 0xab784a, 0x6c3f1f, 0x502d14, 0x582907, 0x865821, 0xb88c50, 0xc9a66c, 0xcbb075, 0xb69561, 0x987142, 0x896036, 0x835b35, 0x77522d, 0x563820, 0x3a2012, 0x65492a, 0xa07d52, 0xa0784e, 0x533616, 0x3e1805, 0x87581d, 0xdabb7a, 0x90794a, 0x553c22, 0x5a3a1b, 0x6a4520, 0x6a4421, 0x603f1a, 0x613f1e, 0x6a4624, 0x61421f, 0x4b3018, 0x2c0800, 0x5e401e, 0x6f4f29, 0x55371c, 0x4f3418, 0x352307, 0x91693c, 0xb4813f, 0x724e26, 0x3c1900, 0x9d8159, 0xd0ba87, 0x5b451e, 0x5c391d, 0x4f351a, 0x3d2812, 0x371d02, 0x382410, 0x412d19, 0x49321a, 0x573c20, 0x614223, 0x694a2a, 0x664525, 0x654425, 0x664725, 0x654421, 0xba9254, 0x956a36, 0x684826, 0x422a17, 0x53381b, 0x81562b, 0x977b56, 0xad946b, 0x422d15, 0x000000, 0x3b1c00, 0x715022, 0x917240, 0xa98b52, 0xa9854a, 0x976e35, 0x7b5425, 0x4e3112, 0x3f2512, 0x533c22, 0x533d1e, 0x60462e, 0x594126, 0x573e27, 0x4c2f17, 0x8d6d34, 0xd0a454, 0xd9a754, 0xcf9d4f, 0xab7337, 0xa66d31, 0xa6723c, 0x724c25, 0x613b18, 0x814c29, 0x7b4624, 0x6e3e1f, 0x6a3c1b, 0x5e3615, 0x553113, 0x522b10, 0x4b2912, 0x432812, 0x432712, 0x472c17, 0x382110, 0x3b2414, 0x352010, 0x301d0e, 0x301d0d, 0x301c0d, 0x311d0e, 0x311d0d, 0x301b0b, 0x2f190c, 0x2e180c, 0x2e190c, 0x331d0f, 0x301b0c, 0x2e1a0b, 0x301b0a, 0x321b0b, 0x331c0c, 0x351c0d, 0x381d0d, 0x3c200f, 0x402311, 0x402310, 0x3c210f, 0x361d0d, 0x2f190b, 0x291608, 0x261508, 0x221208, 0x1d0f06, 0x180c04, 0x160c03, 0x130a03, 0x110a03, 0x100904, 0x0d0902, 0x0c0902, 0x0a0702, 0x090601, 0x070601, 0x060501, 0x070300, 0x060300, 0x040500, 0x040401, 0x030301, 0x030401, 0x020300, 0x020300, 0x030400, 0x030400, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x010100, 0x020200, 0x020100, 0x020300, 0x030400, 0x020300, 0x030400, 0x030400, 0x040300, 0x040300, 0x070400, 0x080500, 0x090601, 0x0a0702, 0x0b0703, 0x0d0804, 0x100902, 0x120b03, 0x130a03, 0x150c03, 0x180e04, 0x1a0f04, 0x1d1007, 0x1f1108, 0x231208, 0x251307, 0x2c1609, 0x30190d, 0x341c0f, 0x341c0f, 0x311a0c, 0x2e190b, 0x2b170a, 0x29160a, 0x28160b, 0x27170a, 0x271709, 0x281709, 0x2c1a0d, 0x2a190b, 0x281809, 0x28170a, 0x291709, 0x2b1809, 0x2a180a, 0x2b190a, 0x2c190b, 0x2e1a0b, 0x301c0e, 0x331c0f, 0x361d0b, 0x4c311f, 0x4d2e1b, 0x46240f, 0x542e14, 0x6a4326, 0x60391e, 0x6a3f23, 0x6b3c19, 0x824a22, 0x935627, 0xad6a32, 0xc37b3b, 0xc9833b, 0xcf8a3f, 0xda9548, 0xdb9746, 0xbb752f, 0xa95f25, 0xa96128, 0xa76226, 0xb3713a, 0xa96f37, 0x9c632f, 0x9d5a28, 0xa67231, 0xe3cd85, 0xf5e39d, 0xcdb273, 0x9d7038, 0x7e4e28, 0x7b4822, 0x88532c, 0x7b502d, 0x5c391b, 0x503014, 0x4d2a11, 0x542000, 0x6a3d14, 0x987745, 0xa28351, 0x876539, 0x5a3916, 0x462a0e, 0x331801, 0x3a1f0b, 0x84623f, 0x9e7a4f, 0x5b3607, 0xb08956, 0x9b7a4d, 0x2c0300, 0x5d2f01, 0xae8347, 0xd0af75, 0x634725, 0x54351b, 0x623d1e, 0x6c4621, 0x69451e, 0x65401c, 0x69431f, 0x6d4621, 0x664422, 0x4e3219, 0x4b2c17, 0x593a1b, 0x4a3216, 0x462c0f, 0x9f7950, 0xb2824c, 0x7f5121, 0x301b10, 0x2d1d0b, 0x4e2500, 0xb49e6f, 0xc5b182, 0x5e380f, 0x5f401f, 0x533b1f, 0x432e19, 0x47321b, 0x4f381c, 0x55391d, 0x5b3c22, 0x634424, 0x674625, 0x634122, 0x5e4024, 0x563a1c, 0x98723e, 0xb18246, 0x8e632e, 0x573a1f, 0x351c0a, 0x472e15, 0x926c3e, 0x8e6d43, 0x937650, 0xc1a479, 0x846d4a, 0x503a16, 0x4f3920, 0x3a1700, 0x350f00, 0x341000, 0x41230e, 0x52351f, 0x593c24, 0x64462a, 0x5f4626, 0x4c371e, 0x533f28, 0x482f1c, 0x5c3a18, 0xac8749, 0xdbb163, 0xc8974a, 0xb07b3a, 0x9a682d, 0xa26d33, 0x8c5d2b, 0x5c3315, 0x6a3d1c, 0x845126, 0x7d4424, 0x6e3b1d, 0x60371b, 0x5a3519, 0x502f14, 0x502e13, 0x633d27, 0x502e1a, 0x3c220d, 0x402714, 0x4a331d, 0x321d0e, 0x2f1809, 0x2d1909, 0x2e1c0d, 0x2d1a0c, 0x2d1a0c, 0x2d1a0b, 0x2c190b, 0x2b190b, 0x2b180d, 0x2a170d, 0x2a170c, 0x2a170a, 0x2a180b, 0x29190b, 0x2a1a0b, 0x2b190a, 0x2d190b, 0x2f1a0c, 0x311a0c, 0x321a0c, 0x351b0d, 0x3a1f0f, 0x391f10, 0x341d0e, 0x301a0c, 0x2b180a, 0x281609, 0x241408, 0x201107, 0x1c0e05, 0x180c03, 0x140a02, 0x120a03, 0x100903, 0x0e0903, 0x0d0903, 0x0a0803, 0x090601, 0x070500, 0x060500, 0x070400, 0x060300, 0x040500, 0x030400, 0x030400, 0x030400, 0x020300, 0x020300, 0x020300, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x010100, 0x010100, 0x010100, 0x020200, 0x030301, 0x020200, 0x030301, 0x030301, 0x040300, 0x040300, 0x070400, 0x080500, 0x090600, 0x090701, 0x0b0703, 0x0e0804, 0x100902, 0x120a02, 0x130a03, 0x150b03, 0x180d04, 0x1b0e04, 0x1c1005, 0x1f1108, 0x231207, 0x261407, 0x2a1609, 0x2d180b, 0x2d180b, 0x2c170a, 0x291508, 0x261408, 0x251408, 0x251309, 0x241309, 0x251409, 0x241408, 0x251409, 0x251409, 0x251509, 0x251508, 0x26150a, 0x2a180b, 0x311c0e, 0x2d190d, 0x29170b, 0x2a180a, 0x2d1a0c, 0x301b0e, 0x321c0f, 0x371f0e, 0x3a1e09, 0x3f220d, 0x442611, 0x4d2a11, 0x522b12, 0x582f13, 0x5e300d, 0x6e3d1b, 0x834920, 0x915324, 0xac6a34, 0xbb753a, 0xc07938, 0xc9813d, 0xd28c42, 0xe29f4b, 0xdd9c4a, 0xbe7a36, 0xae682d, 0x9e5c29, 0x88481b, 0x925527, 0xa66b37, 0xa46d36, 0x9a622c, 0x9d6022, 0xcaa766, 0xf5e9a3, 0xe2d49a, 0xb8935d, 0x9c6e3c, 0x80512a, 0x79502c, 0x764e2c, 0x6a4024, 0x563720, 0x4d321c, 0x472711, 0x3a1403, 0x280000, 0x2e1004, 0x4b301d, 0x5c3c1f, 0x83613e, 0x7c5329, 0x845d34, 0x654325, 0x9b754c, 0x896336, 0xaf8a5b, 0x644828, 0x2e0500, 0x824e22, 0xbe945d, 0xac8c5a, 0x634228, 0x59381e, 0x65411e, 0x6d4923, 0x65401d, 0x6a4421, 0x6c4520, 0x6e4822, 0x684520, 0x634221, 0x604123, 0x4f361e, 0x8c6c4b, 0xa97848, 0x7a4818, 0x5a3a1f, 0x1d1008, 0x0c0301, 0x4c301c, 0x572d00, 0xbda172, 0xaf9365, 0x613f1d, 0x593d1d, 0x4e3419, 0x4d3217, 0x5f4122, 0x603f20, 0x634123, 0x614322, 0x583b1e, 0x5c4024, 0x4e3217, 0x77562c, 0xb18349, 0x91622d, 0x704e28, 0x3e2001, 0x7b623d, 0x573f23, 0x634720, 0xb68e5c, 0x5d3b15, 0x765d3e, 0xbca071, 0xccae75, 0xcaad78, 0x704c29, 0x613d22, 0x614025, 0x6f4d29, 0x7c5a30, 0x6f4e2c, 0x5b3a1f, 0x6a4d32, 0x60442c, 0x44240e, 0x816030, 0xc69e54, 0xcca055, 0xa7793d, 0x916233, 0x905e29, 0x946735, 0x7d542a, 0x5a3212, 0x743e1b, 0x804926, 0x734120, 0x753f1d, 0x764729, 0x553015, 0x502f15, 0x4a2c14, 0x442710, 0x4d2c17, 0x462814, 0x37200d, 0x321c0d, 0x2e190a, 0x2b1606, 0x4a3527, 0x422f21, 0x2a1709, 0x2a180b, 0x29170a, 0x2a180b, 0x29170a, 0x29170a, 0x28160b, 0x28160c, 0x28160b, 0x28160a, 0x27160a, 0x251709, 0x26170a, 0x271608, 0x281608, 0x281608, 0x291608, 0x2a1609, 0x2c1709, 0x2f1a0c, 0x301b0c, 0x311b0d, 0x301a0c, 0x2d180a, 0x2a1609, 0x261408, 0x231307, 0x1f1006, 0x1c0e06, 0x160b03, 0x120a03, 0x110a02, 0x0e0902, 0x0d0802, 0x0b0702, 0x090601, 0x080500, 0x060500, 0x070400, 0x060300, 0x030301, 0x040402, 0x030301, 0x030301, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x030301, 0x030301, 0x030300, 0x040300, 0x070400, 0x080500, 0x090601, 0x0a0702, 0x0b0702, 0x0d0803, 0x110903, 0x130a03, 0x140a04, 0x160c03, 0x180d04, 0x1b0e04, 0x1d1005, 0x211107, 0x251408, 0x271508, 0x281508, 0x271507, 0x251408, 0x251308, 0x241307, 0x231207, 0x241207, 0x231208, 0x231208, 0x24120a, 0x231209, 0x221208, 0x221308, 0x231308, 0x231308, 0x24140a, 0x28160b, 0x301b0e, 0x2d180c, 0x29170a, 0x29170b, 0x2c190b, 0x2f1a0d, 0x311c0d, 0x361e0d, 0x3b200d, 0x3e2211, 0x432611, 0x492813, 0x512b18, 0x5e3418, 0x9f7250, 0x76421f, 0x834720, 0x925326, 0xa15e2a, 0xb46f36, 0xbd7638, 0xc47c39, 0xcf883f, 0xdf9c4a, 0xe2a14b, 0xe4a152, 0xbd7d3a, 0x834515, 0x783c19, 0x723c19, 0x76441e, 0x955e31, 0x9f6734, 0x9f6833, 0xa06127, 0xb28042, 0xe1c98b, 0xf3e6a8, 0xd8c080, 0xb58a4c, 0x825329, 0x6e4224, 0x684525, 0x614028, 0x593a22, 0x55371b, 0x50341c, 0x452d18, 0x381f06, 0x805d37, 0xae7c45, 0xa2733d, 0x71451a, 0x45240c, 0x5e3e20, 0x7b502a, 0x633a1a, 0x805a34, 0xa68254, 0x3a2207, 0x4a1e06, 0x88571c, 0xd0ae75, 0xa18a5f, 0x3c1600, 0x56381d, 0x633f1e, 0x6e4320, 0x72471d, 0x744a20, 0x6f4520, 0x6e4823, 0x6c4921, 0x63421f, 0x422814, 0x613e22, 0x7c4d22, 0x815429, 0x795a38, 0x301e05, 0x1f110c, 0x3e2912, 0x704618, 0x9d6e36, 0x83663c, 0x55371e, 0x583c21, 0x50361d, 0x51341a, 0x5e3d1d, 0x684723, 0x674723, 0x5c3e1f, 0x50391d, 0x4c351d, 0x694b29, 0xb48b4f, 0x90612a, 0x8a6535, 0x4b2917, 0x7b5c37, 0xcfa86f, 0x8c6d42, 0x280000, 0x90683d, 0x8c683a, 0x593315, 0x2e0300, 0x564024, 0x614627, 0x5b3c1f, 0x694a2e, 0x6c4b2c, 0x765230, 0x724e2d, 0x634427, 0x64472e, 0x624326, 0x755024, 0xb38a4b, 0xd9aa5d, 0xcd9d50, 0x9b6c30, 0x845927, 0x8d602e, 0x96683a, 0x613c1b, 0x54290c, 0xa66a3f, 0x9f6438, 0x6f3c17, 0x66381a, 0x683b19, 0x6f4326, 0x4a2a12, 0x4a2c15, 0x492a16, 0x3f2511, 0x402411, 0x3c220f, 0x36210f, 0x321d0e, 0x361e10, 0x2e1807, 0x473325, 0x402c1f, 0x271408, 0x28170b, 0x28160b, 0x27160a, 0x27160a, 0x271509, 0x27150a, 0x27150b, 0x261409, 0x261409, 0x261509, 0x26160a, 0x26160a, 0x261508, 0x251509, 0x251508, 0x261408, 0x271509, 0x281609, 0x281609, 0x291708, 0x2b1709, 0x2d180a, 0x2d180a, 0x2a1608, 0x261407, 0x241307, 0x211206, 0x1d1007, 0x190e05, 0x140b04, 0x110a03, 0x0e0a03, 0x0d0803, 0x0c0703, 0x0a0702, 0x090702, 0x080601, 0x070501, 0x060300, 0x030301, 0x040401, 0x030300, 0x030301, 0x030301, 0x030201, 0x020201, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x010100, 0x010100, 0x010100, 0x020100, 0x020200, 0x020200, 0x020301, 0x020300, 0x030400, 0x050300, 0x080400, 0x060500, 0x090601, 0x0a0702, 0x0a0701, 0x0c0701, 0x110903, 0x120904, 0x130a03, 0x150c03, 0x180c04, 0x1b0e06, 0x1e1006, 0x221007, 0x241308, 0x251308, 0x241207, 0x231107, 0x211007, 0x211107, 0x201008, 0x200f07, 0x211008, 0x201008, 0x211109, 0x211009, 0x1f1009, 0x1d1008, 0x1f1008, 0x1f1108, 0x1e1207, 0x21130a, 0x25140a, 0x271509, 0x29160a, 0x29170b, 0x2a180c, 0x2c190c, 0x2d1809, 0x301a0c, 0x361e0d, 0x391f0c, 0x3d220f, 0x442410, 0x472613, 0x4f2a16, 0x64381b, 0x794827, 0x77401c, 0x834822, 0x955529, 0xa76331, 0xac6631, 0xb87036, 0xc27937, 0xcc833c, 0xd28b3f, 0xd69241, 0xda9547, 0xd28e46, 0xaf703a, 0x844920, 0x713b18, 0x582d13, 0x5b3113, 0x82522b, 0x9b6736, 0xa16937, 0x985e2a, 0x925714, 0xb6915b, 0xead699, 0xf0df9c, 0xcbaf72, 0x966e3c, 0x704725, 0x5e3e21, 0x593920, 0x56351e, 0x583b24, 0x523520, 0x4b2e1a, 0x57351a, 0x704420, 0x552d0d, 0x482b15, 0x493019, 0x58391d, 0x5c3612, 0x68421f, 0x7a491c, 0xad7e4d, 0xb1926c, 0x200d00, 0x5c300c, 0x8c5d2c, 0xd5b682, 0xa08a60, 0x401b00, 0x4f3219, 0x5e3a1c, 0x7c512a, 0x73471f, 0x70471f, 0x6d4721, 0x6f4925, 0x684422, 0x492e15, 0x341906, 0x6a4322, 0x805326, 0xa88759, 0x654e33, 0x473119, 0x7f5d2b, 0xa06d39, 0x996d3b, 0x3e2305, 0x50351d, 0x53351a, 0x583b20, 0x5f3e20, 0x62411f, 0x684626, 0x5d3d20, 0x4f371e, 0x462f1a, 0x664a24, 0xab8448, 0x9b6d31, 0x946c3c, 0x604122, 0x76552b, 0xa27944, 0x8a622d, 0xbfa469, 0x66512d, 0x270000, 0x64492b, 0x5a3b1f, 0x694a2e, 0x583d25, 0x3d2715, 0x412c18, 0x4f3821, 0x5e4125, 0x6d4c2b, 0x745233, 0x604027, 0x63421d, 0xa47d45, 0xcc9e5b, 0xce9c50, 0xb2813c, 0x986930, 0x966635, 0x986835, 0x886032, 0x5b371c, 0x64381c, 0x824d26, 0x9d6034, 0x885129, 0x643819, 0x5d3418, 0x64381d, 0x5a3117, 0x452814, 0x422611, 0x3f2412, 0x3b2110, 0x3c2210, 0x371f0e, 0x341e0e, 0x331b0a, 0x563b2b, 0x382114, 0x241105, 0x261407, 0x28170c, 0x26150b, 0x26150b, 0x25140b, 0x24130b, 0x251309, 0x241409, 0x231309, 0x221208, 0x231308, 0x26140a, 0x2a190f, 0x241209, 0x231208, 0x201209, 0x201208, 0x211208, 0x221208, 0x241309, 0x251308, 0x251407, 0x261406, 0x281507, 0x291608, 0x291609, 0x271508, 0x241407, 0x221206, 0x1e1007, 0x1b0e06, 0x160c05, 0x130a04, 0x100b02, 0x0d0802, 0x0b0702, 0x0a0702, 0x0a0702, 0x090601, 0x070601, 0x050401, 0x040300, 0x040400, 0x040300, 0x040300, 0x040301, 0x030200, 0x030201, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010100, 0x010100, 
-  0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x030301, 0x020300, 0x020400, 0x060400, 0x080401, 0x060500, 0x090702, 0x0a0702, 0x0b0801, 0x0d0802, 0x100903, 0x120904, 0x130a03, 0x160c03, 0x180d04, 0x1b0e05, 0x1d0f06, 0x1f1108, 0x211008, 0x211007, 0x1f0f07, 0x1d0d06, 0x1d0e06, 0x1c0e06, 0x1c0e06, 0x1c0d06, 0x1d0e07, 0x1d0e07, 0x1d0e07, 0x1c0f06, 0x1d0e07, 0x1e0d07, 0x1d0f09, 0x1c1008, 0x1d1006, 0x201209, 0x24130b, 0x241208, 0x26150b, 0x26150c, 0x2a170c, 0x2c1608, 0x3e2619, 0x3c2112, 0x331c0d, 0x352010, 0x3b210e, 0x42230f, 0x482812, 0x512d14, 0x673d21, 0x693718, 0x763f1c, 0x844821, 0x915125, 0xa66231, 0xac6530, 0xb66d33, 0xc17637, 0xc87d39, 0xcb8239, 0xcf873f, 0xc97f3c, 0xc27936, 0xbe7839, 0xb8753b, 0x90572a, 0x54280f, 0x4a2510, 0x572e12, 0x70421f, 0x87572d, 0x925e31, 0x8e592e, 0x884f21, 0x925f26, 0xc6a96d, 0xf0dd9a, 0xead591, 0xbe9c5f, 0x8a5b2d, 0x6c4324, 0x54371e, 0x4b2f18, 0x4d2f17, 0x54341c, 0x644329, 0x5f3e1e, 0x664122, 0x5e3f22, 0x523619, 0x664024, 0x8d5d39, 0x7f5128, 0x774c24, 0x79471c, 0xb68f5d, 0xb79e6f, 0x321c0c, 0x612902, 0x8c5a2c, 0xdbc28c, 0xb8a77b, 0x462b04, 0x4a2d17, 0x603e21, 0x603d1b, 0x6b451f, 0x724921, 0x6c451f, 0x6a4420, 0x664322, 0x3f2714, 0x341a05, 0x643a18, 0x997142, 0xad8f60, 0x8d6a3b, 0xaf7b40, 0xa97840, 0x613f20, 0x483119, 0x53391f, 0x503218, 0x58391c, 0x5e3e1e, 0x5b3d21, 0x51371e, 0x452e17, 0x49331d, 0x735430, 0xa9814d, 0x94672e, 0x926732, 0x825c34, 0x8d6839, 0x9c743d, 0x885523, 0x96672d, 0xbe9c61, 0xcdb17a, 0x91754f, 0x4f341e, 0x4f361d, 0x6a492b, 0x5d3e22, 0x3e2917, 0x412c18, 0x47321a, 0x583e23, 0x644327, 0x613b1f, 0x805c30, 0xc59c58, 0xe1b367, 0xbb8a47, 0x9b6c31, 0xa47440, 0x946234, 0x81532e, 0x6b4627, 0x462309, 0x764728, 0x874d29, 0x7c4622, 0x6e3d1b, 0x633619, 0x5b331a, 0x593015, 0x6d452b, 0x5c3920, 0x43260f, 0x3f2510, 0x39210f, 0x361f0f, 0x351d0d, 0x331d0d, 0x321d0e, 0x321c0e, 0x321b0d, 0x2a170b, 0x27160c, 0x28180d, 0x27150b, 0x241309, 0x241309, 0x24130a, 0x23120a, 0x211209, 0x201208, 0x1f1208, 0x1e1108, 0x1f1208, 0x201108, 0x1f1007, 0x1f1007, 0x1f1007, 0x1d1007, 0x1d1007, 0x1d1007, 0x1e1006, 0x1f1007, 0x201108, 0x211108, 0x221107, 0x231208, 0x251207, 0x261308, 0x271409, 0x26150a, 0x221208, 0x1e1007, 0x1c0f06, 0x170d05, 0x140b04, 0x110a02, 0x0e0901, 0x0d0802, 0x0a0702, 0x0a0702, 0x090601, 0x070501, 0x050400, 0x040300, 0x050400, 0x040300, 0x040300, 0x040301, 0x030200, 0x030200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x010100, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020300, 0x030400, 0x030400, 0x050300, 0x080401, 0x070500, 0x090702, 0x0a0702, 0x0a0801, 0x0c0802, 0x100903, 0x130a05, 0x120902, 0x160d04, 0x180d04, 0x1a0d05, 0x1c0f06, 0x1c0f06, 0x1c0f06, 0x1b0e05, 0x1b0d06, 0x1a0c05, 0x1a0d05, 0x1a0d05, 0x1a0d05, 0x1a0d05, 0x1a0d05, 0x1a0d05, 0x1a0d05, 0x190d04, 0x1c0e06, 0x1e0e08, 0x1c0b03, 0x170500, 0x1c0f07, 0x1e0f09, 0x20110a, 0x221209, 0x24130a, 0x25140a, 0x2a170c, 0x260c00, 0x654e41, 0x533a2d, 0x301606, 0x361f10, 0x3b210e, 0x422410, 0x4a2913, 0x563016, 0x5e3111, 0x683515, 0x794220, 0x83471f, 0x8e4d1f, 0x9b5524, 0xa55e26, 0xc17940, 0xbb6f34, 0xbf7335, 0xc87d3d, 0xbd7436, 0xb46a31, 0xb66c31, 0xb87033, 0xb46c33, 0xb26f39, 0x99602e, 0x78461f, 0x5e2e14, 0x61331b, 0x592e0e, 0x744822, 0x8c5c32, 0x88562c, 0x7e4b23, 0x864d21, 0x8b5c26, 0xc1a86e, 0xf1de94, 0xe4cd88, 0xa78752, 0x7e5126, 0x6c4424, 0x57361c, 0x583519, 0x5e3a1c, 0x613d1e, 0x5e3d1c, 0x5a3c22, 0x50321a, 0x644323, 0x7a522d, 0x683f1e, 0x5d3716, 0x653b1a, 0x875824, 0xbc9560, 0xb69463, 0x623f23, 0x5c2700, 0x875c2c, 0xdec48c, 0xcab887, 0x5f4e2b, 0x482a0f, 0x4b2f19, 0x553519, 0x69441f, 0x6e4820, 0x704920, 0x734c27, 0x5b3e23, 0x372312, 0x3b1b06, 0x713d12, 0xae8650, 0xae834d, 0x915d31, 0x6b481f, 0x412711, 0x503820, 0x452d12, 0x4e341a, 0x553b20, 0x51391e, 0x493019, 0x472e15, 0x543b1c, 0x805e36, 0xa37c47, 0x865b2b, 0x6e4117, 0x784f23, 0x90673b, 0x8a5f30, 0x815321, 0x815221, 0x885a28, 0x5b3308, 0x614827, 0x8f714c, 0x74512f, 0x6c4b2d, 0x60432a, 0x49301a, 0x4f3722, 0x5b4127, 0x583a24, 0x59341a, 0x855d2a, 0xb08442, 0xbf904b, 0xc79854, 0xb08345, 0x986a32, 0x815120, 0x84562e, 0x7f5531, 0x4e2505, 0x61381a, 0x844e2c, 0x8b4b25, 0x7c4423, 0x723f1f, 0x673a1d, 0x5c3319, 0x582f15, 0x663e24, 0x5b331a, 0x492710, 0x44240c, 0x3d2310, 0x36200f, 0x341f10, 0x311c0e, 0x2f1a0c, 0x2e1b0d, 0x2d1a0b, 0x2a180b, 0x28160b, 0x26150b, 0x25140b, 0x24140a, 0x231309, 0x221309, 0x211109, 0x201108, 0x1d1007, 0x1d1007, 0x1d1007, 0x1c0f06, 0x1b1006, 0x1b0f06, 0x1b0f06, 0x1a0f05, 0x1a0e05, 0x190e05, 0x190e05, 0x1a0e05, 0x1a0d06, 0x1b0e06, 0x1b0e06, 0x1c0e07, 0x1d0f07, 0x1e0f07, 0x1f0f06, 0x201007, 0x221209, 0x231309, 0x211208, 0x1e1007, 0x1d1007, 0x1a0e05, 0x170c03, 0x120a02, 0x100902, 0x0e0802, 0x0b0701, 0x0a0702, 0x090601, 0x080400, 0x060400, 0x040400, 0x050400, 0x040300, 0x040300, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 
-  0x000000, 0x010101, 0x010101, 0x020100, 0x010100, 0x010100, 0x020200, 0x030400, 0x030400, 0x060400, 0x080401, 0x070500, 0x080601, 0x090702, 0x090901, 0x0b0801, 0x0f0903, 0x120a04, 0x130a02, 0x150b02, 0x180c03, 0x1a0d05, 0x190d04, 0x190d04, 0x180d04, 0x170d05, 0x180c04, 0x190c04, 0x180d04, 0x170d04, 0x170d03, 0x160c03, 0x170c03, 0x170d04, 0x180d04, 0x1a0c05, 0x180d06, 0x160902, 0x352319, 0x483429, 0x160801, 0x1d0e08, 0x1f1009, 0x201209, 0x241309, 0x26140a, 0x2a170c, 0x2e180b, 0x2f1605, 0x331909, 0x371c0d, 0x3a1e0f, 0x3d210f, 0x422611, 0x4b2a15, 0x542910, 0x7b4e32, 0x7f4d2d, 0x763e1b, 0x81451d, 0xa26237, 0x9f5829, 0xbc7840, 0xb16b30, 0xaf652c, 0xb36831, 0xb0662e, 0xa75f2a, 0xa9622e, 0xa55f29, 0xa45f2c, 0xa15b2b, 0xa9632e, 0xb26a32, 0xb06e3a, 0x8b5429, 0x5e2f10, 0x54280f, 0x572e17, 0x5d3418, 0x744827, 0x7c4e2a, 0x784925, 0x794923, 0x713702, 0x946b37, 0xd5bf7c, 0xf1e096, 0xdac587, 0xa98a5b, 0x8e5f33, 0x754b23, 0x674323, 0x664223, 0x58391d, 0x593b1e, 0x6f5135, 0x412710, 0x2e1704, 0x3a200d, 0x4b2c15, 0x5f3b1c, 0x6a3e1e, 0x774517, 0xb4844c, 0xb58550, 0x84542b, 0x7a4013, 0x935a20, 0xcbab71, 0xd9c288, 0x9a875d, 0x523715, 0x4d3219, 0x593d21, 0x674221, 0x6c4321, 0x6a421e, 0x694420, 0x553a20, 0x341c0a, 0x532d12, 0x78451b, 0x7d4a17, 0x764f28, 0x442913, 0x4e351b, 0x4c3016, 0x472f18, 0x452f17, 0x48321a, 0x442e17, 0x482c10, 0x6e4f2a, 0xb79160, 0xa17647, 0x73491b, 0x744c20, 0x8c5f30, 0x794e23, 0x785023, 0x7d5429, 0x725029, 0x533616, 0x42280f, 0x39220c, 0x3d2514, 0x4a2d1a, 0x57381e, 0x6d4f32, 0x5a3d23, 0x5d4028, 0x593c28, 0x4d3019, 0x907245, 0xa77e42, 0xc69953, 0xc3954e, 0x9f6f34, 0x8b5d2b, 0x815222, 0x91602f, 0x83542c, 0x633c20, 0x5a2f13, 0x8d552d, 0xa96839, 0x8d4f26, 0x7f4625, 0x764122, 0x734123, 0x65391f, 0x583218, 0x59331a, 0x57351d, 0x4a2a15, 0x4b2b17, 0x55341e, 0x3b210e, 0x351e10, 0x311c0f, 0x271405, 0x291607, 0x2c190c, 0x2c190b, 0x2a180a, 0x28160a, 0x26140b, 0x22130b, 0x201209, 0x211309, 0x1f1108, 0x1f1108, 0x1e1007, 0x1d0e07, 0x1c0e07, 0x1b0e06, 0x1a0d05, 0x190e05, 0x170e05, 0x170e05, 0x170d04, 0x160d03, 0x160d04, 0x160d04, 0x160d04, 0x170c05, 0x160c04, 0x170d04, 0x170d04, 0x180c04, 0x180c04, 0x190c05, 0x1a0d05, 0x1c0f06, 0x1d1007, 0x1e1007, 0x1e1007, 0x1c0f06, 0x1a0d04, 0x180b03, 0x130a01, 0x120a02, 0x0f0902, 0x0b0801, 0x0b0801, 0x0a0702, 0x090501, 0x070401, 0x050300, 0x050400, 0x040300, 0x030200, 0x040301, 0x030200, 0x020100, 0x020200, 0x010200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x030200, 0x040300, 0x050300, 0x080401, 0x080501, 0x0a0702, 0x0a0702, 0x0b0801, 0x0c0701, 0x100903, 0x110a02, 0x130a02, 0x140b02, 0x140a02, 0x150b03, 0x150b03, 0x150c03, 0x150b03, 0x150a03, 0x150a02, 0x150b02, 0x150b03, 0x150b03, 0x150b03, 0x150b02, 0x150b02, 0x140a02, 0x150b03, 0x180c04, 0x170c05, 0x140801, 0x35241b, 0x47352b, 0x170500, 0x1b0d07, 0x1e1008, 0x1f1207, 0x241207, 0x27140a, 0x2a160b, 0x2d180a, 0x311b0c, 0x331c0c, 0x381e0f, 0x3c2010, 0x402210, 0x432610, 0x4b2913, 0x532c13, 0x71482e, 0x744527, 0x723d19, 0x81451f, 0x8f4e25, 0x9a5428, 0xad6834, 0xad6732, 0xa35c28, 0xae6734, 0x9d5625, 0x9f5a29, 0xba7541, 0x985624, 0x915024, 0x9b592c, 0x9f5828, 0xa35a2a, 0x9e5d29, 0xa3602f, 0x985a2d, 0x74401e, 0x532b13, 0x401c0a, 0x461d09, 0x5e3619, 0x714824, 0x7b4b29, 0x7a4a26, 0x7a4722, 0x804912, 0xa2753b, 0xd3b779, 0xf0df9f, 0xe0d095, 0xb99f69, 0x9b713e, 0x8f6037, 0x7b5534, 0x643f1e, 0x745233, 0x63472c, 0x4a311a, 0x452d18, 0x3b2714, 0x2e1905, 0x3a1c07, 0x47250b, 0x663f1b, 0x926333, 0xa97340, 0xac733b, 0xa66d36, 0x91581d, 0x9e7542, 0xd1b47b, 0xd0ba84, 0x968259, 0x53360f, 0x532e08, 0x663f1e, 0x6f4723, 0x653e17, 0x5f3e1e, 0x482f18, 0x371a08, 0x6f3f1c, 0x8d5b30, 0x5f3f20, 0x3f2511, 0x53361e, 0x53361c, 0x52381f, 0x452d17, 0x402810, 0x5f3f1f, 0x966c3e, 0xb1834e, 0xa07240, 0x8f5e2d, 0x81572a, 0x79552a, 0x744e25, 0x66461f, 0x50371a, 0x3b2209, 0x3d2412, 0x422814, 0x4a321d, 0x5b3f25, 0x5f4124, 0x5f4024, 0x604127, 0x604228, 0x56351f, 0x613d21, 0x846332, 0xbea160, 0xd9b877, 0xaa834a, 0x785023, 0x754d28, 0x7d5329, 0x84582c, 0x8f6137, 0x784f2c, 0x5b3114, 0x7c4a20, 0x92552b, 0x9b5a30, 0x9c5c2f, 0x804621, 0x774320, 0x6f3e20, 0x683a20, 0x5f361e, 0x543017, 0x4b2a14, 0x432613, 0x3e2311, 0x52321d, 0x5d402a, 0x371b0c, 0x321c0f, 0x291003, 0x4e3827, 0x3d2817, 0x27130d, 0x281609, 0x271609, 0x271509, 0x26140a, 0x231309, 0x201209, 0x1f1108, 0x1e1007, 0x1e1007, 0x1c0e05, 0x1e0f07, 0x1e0f08, 0x1a0d05, 0x180e05, 0x170c04, 0x160c05, 0x160b04, 0x150b04, 0x160b03, 0x150c02, 0x150b03, 0x140a02, 0x140a04, 0x140a03, 0x140b04, 0x140b03, 0x140b04, 0x150b04, 0x150b04, 0x160c05, 0x160c05, 0x180c06, 0x190e06, 0x1a0e06, 0x1a0e06, 0x1a0d04, 0x180b03, 0x140a02, 0x120a03, 0x100a03, 0x0c0802, 0x0b0801, 0x0a0702, 0x090501, 0x080301, 0x050300, 0x040300, 0x040300, 0x040300, 0x040301, 0x030200, 0x010101, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x020100, 0x030200, 0x040300, 0x050400, 0x070501, 0x080500, 0x090601, 0x0a0702, 0x0a0701, 0x0d0701, 0x0f0902, 0x110a02, 0x120a02, 0x130a03, 0x120902, 0x130902, 0x130a03, 0x130a03, 0x120902, 0x120902, 0x120902, 0x130a03, 0x130a03, 0x130a03, 0x140b04, 0x140b04, 0x130a03, 0x140b04, 0x140b04, 0x160c03, 0x150c05, 0x160c06, 0x140600, 0x140200, 0x1c0d06, 0x1b0e06, 0x1e1008, 0x201108, 0x241309, 0x26140b, 0x28160c, 0x2b170b, 0x2e1a0b, 0x321b0b, 0x371f0f, 0x3d2012, 0x412311, 0x442611, 0x4b2813, 0x512b15, 0x552b0f, 0x623213, 0x713d1a, 0x7e441f, 0x8d4b23, 0x995225, 0xa1592b, 0x9e582d, 0x944f24, 0x945226, 0x8a4922, 0x874a20, 0x915328, 0x854b23, 0x955d37, 0x8e5127, 0x93532c, 0x8d4e25, 0x874c21, 0x8f5026, 0x98582d, 0x985b33, 0x7f4b29, 0x5a2f14, 0x522a0f, 0x4c270f, 0x411d0b, 0x653a24, 0x7e512b, 0x835328, 0x87592d, 0x8a5426, 0x8f5213, 0xaa783c, 0xd0ae72, 0xedd999, 0xeddd9e, 0xcbb67d, 0xaa844f, 0x865b2d, 0x633c1d, 0x5c3923, 0x4e311c, 0x4c341e, 0x593a25, 0x593720, 0x5c3e23, 0x4a2d16, 0x3f210c, 0x391500, 0x492505, 0x643e1c, 0x714722, 0x6e4221, 0x754421, 0x824a19, 0xa48153, 0xcfb47f, 0xcdb47f, 0x977b55, 0x5d3715, 0x683f1d, 0x6d421f, 0x6d4622, 0x623f1e, 0x351900, 0x4f2e12, 0x785433, 0x4b2f16, 0x4c3019, 0x54361d, 0x5c3d20, 0x5f3e20, 0x583a22, 0x835f3e, 0x8a6035, 0x8f6436, 0x74471a, 0x734722, 0x724c27, 0x553514, 0x3b2007, 0x321b0d, 0x3d2414, 0x5b402d, 0x513620, 0x5d3e24, 0x69472a, 0x664326, 0x684526, 0x714d2e, 0x67432a, 0x5c3823, 0x6a4a23, 0x9e7c41, 0xc49b55, 0xdbad63, 0xb08647, 0x815c2d, 0x5b3c1c, 0x694825, 0x734d27, 0x80552e, 0x694522, 0x4f3016, 0x643818, 0x9c5e32, 0xc5834f, 0x955323, 0x864925, 0x7b441e, 0x78411f, 0x733f1f, 0x693a1d, 0x60351b, 0x5a2f15, 0x613a22, 0x5b3720, 0x44220a, 0x43230e, 0x40230f, 0x341b07, 0x341b0e, 0x3d2212, 0x5b3e27, 0x795e49, 0x503a2a, 0x1e0d04, 0x241407, 0x251309, 0x251309, 0x241208, 0x221208, 0x201108, 0x1f1008, 0x1d0f06, 0x1c0e06, 0x1b0d04, 0x21130b, 0x1f120a, 0x170c03, 0x160b04, 0x150a04, 0x150a04, 0x140903, 0x140a03, 0x140a04, 0x150a04, 0x150a04, 0x140a05, 0x130a05, 0x130a04, 0x130a03, 0x130a03, 0x130a04, 0x130b04, 0x130a03, 0x140b04, 0x130a04, 0x140a04, 0x160b04, 0x160c03, 0x170d04, 0x170c04, 0x170a02, 0x140903, 0x130a03, 0x120a03, 0x0e0802, 0x0c0801, 0x0b0801, 0x0a0602, 0x080401, 0x050400, 0x040300, 0x040300, 0x030200, 0x040301, 0x030200, 0x010101, 0x010100, 0x010100, 0x020200, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010100, 0x010100, 0x010100, 0x020100, 0x030300, 0x040400, 0x050400, 0x060501, 0x070500, 0x090601, 0x0a0702, 0x0a0702, 0x0c0701, 0x0f0802, 0x110903, 0x110a03, 0x110903, 0x110903, 0x110903, 0x110903, 0x120a03, 0x110903, 0x120a04, 0x120a04, 0x120a03, 0x110903, 0x120a04, 0x120b04, 0x120b04, 0x120b04, 0x120b05, 0x130c05, 0x140a04, 0x150c05, 0x150c07, 0x150c06, 0x180c06, 0x1a0d04, 0x1b0e06, 0x1d0f08, 0x221009, 0x24120a, 0x25140c, 0x27150c, 0x29170a, 0x2e190a, 0x321b0b, 0x381f10, 0x3e2213, 0x412411, 0x452611, 0x4f2a17, 0x542b16, 0x592f15, 0x643317, 0x703c1b, 0x7c421e, 0x915129, 0x955024, 0x934f23, 0x894720, 0x854721, 0x7d431d, 0x78401e, 0x7e4624, 0x7d4424, 0x703a1b, 0x794522, 0x7d431d, 0x945936, 0x854b27, 0x7b4019, 0x824722, 0x864a26, 0x8b4d25, 0x8d5128, 0x88512b, 0x7e4d2d, 0x542a13, 0x4c260f, 0x6a3c1e, 0x6c3816, 0x834f27, 0x9f6638, 0xa56935, 0x975f2a, 0x905a26, 0x8f5418, 0x9b662a, 0xc4a268, 0xe3cf92, 0xeddc98, 0xdbc481, 0xae9156, 0x7f5d32, 0x683f1f, 0x653e1e, 0x5c3718, 0x6a4729, 0x6d4a29, 0x694625, 0x654324, 0x603e21, 0x603c1e, 0x5f391c, 0x533016, 0x3c220a, 0x331c05, 0x41230a, 0x4f2000, 0x5f3100, 0x8e6c45, 0x906e4d, 0x6a3f1d, 0x6e4520, 0x734721, 0x75481f, 0x81572f, 0x805f40, 0x4b2b0c, 0x533518, 0x4e341b, 0x52341a, 0x603d1f, 0x5f3d1d, 0x604023, 0x492d15, 0x54371e, 0x4b2e14, 0x39230a, 0x3c2711, 0x4a301a, 0x4c321a, 0x53381c, 0x6c4e2f, 0x6a4928, 0x6b4c28, 0x6c4d2a, 0x6b4a29, 0x795431, 0x7f5630, 0x805434, 0x693c1e, 0x6e451f, 0x9b7b44, 0xb38e4c, 0xcda25f, 0xd3a863, 0xb88b48, 0xad7d40, 0x8d612e, 0x865c2e, 0x8a5f33, 0x996b3d, 0x8d643c, 0x5f4128, 0x5b3617, 0x7e4923, 0x93542b, 0x965528, 0xa26335, 0x82461e, 0x774121, 0x703e1e, 0x6e3b1d, 0x6b3b1e, 0x64381d, 0x5c341a, 0x532c13, 0x5d3822, 0x59341c, 0x5f391f, 0x845c40, 0x462815, 0x2e180b, 0x2e1b0f, 0x361e0f, 0x402713, 0x2c0800, 0x210500, 0x25150a, 0x241308, 0x24120a, 0x241207, 0x251409, 0x221208, 0x1f1008, 0x1d0e07, 0x1b0d05, 0x1b0d05, 0x1b0e06, 0x190e05, 0x170c03, 0x150b04, 0x140a04, 0x140a04, 0x150a04, 0x130a03, 0x130a04, 0x130a04, 0x130906, 0x130906, 0x120906, 0x120906, 0x110a05, 0x110a04, 0x120a04, 0x120b05, 0x110a04, 0x100a04, 0x110903, 0x120a04, 0x130a05, 0x130a04, 0x130a03, 0x120902, 0x140a03, 0x140a03, 0x140903, 0x130903, 0x120903, 0x0f0802, 0x0d0701, 0x0b0801, 0x0a0602, 0x080401, 0x050300, 0x040300, 0x040300, 0x030200, 0x040301, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x040301, 0x040500, 0x050400, 0x060501, 0x060500, 0x080501, 0x0a0602, 0x090601, 0x0c0703, 0x0f0702, 0x100702, 0x100803, 0x0f0802, 0x0f0802, 0x0e0802, 0x0f0802, 0x100903, 0x100903, 0x100903, 0x100903, 0x100903, 0x100903, 0x100903, 0x100903, 0x100904, 0x100904, 0x110a05, 0x120b05, 0x130b05, 0x140a04, 0x150b05, 0x140a05, 0x160b05, 0x180c05, 0x1a0d07, 0x1f0f07, 0x200c03, 0x1c0500, 0x25140a, 0x26150a, 0x2b170a, 0x2f190a, 0x321c0c, 0x381f10, 0x3d2112, 0x402311, 0x462610, 0x56301c, 0x582f19, 0x593016, 0x66361a, 0x6f3b1b, 0x7b4320, 0x82441e, 0x965832, 0x9a5d37, 0x7c401b, 0x773f1c, 0x6e3c19, 0x69381a, 0x703d21, 0x6e3c1f, 0x603115, 0x7e4e31, 0x7d4929, 0x6e3b18, 0x6f3a14, 0x925a3a, 0x804926, 0x76401f, 0x79421f, 0x7b431d, 0x8e5530, 0x8d532d, 0x88502e, 0x8b542e, 0xa2683c, 0x6a310c, 0x653414, 0x86481f, 0xa2602c, 0xae703a, 0xa86c37, 0xa16730, 0x9d5f2c, 0x935621, 0x864d0a, 0x9f7640, 0xc8aa67, 0xdfc77b, 0xe5cf86, 0xd7c17e, 0xbba067, 0xa17e4c, 0x926338, 0x89552c, 0x7c5029, 0x6c4621, 0x694522, 0x6d4622, 0x774d29, 0x6d4625, 0x59381c, 0x4e2e17, 0x502c16, 0x4c2d14, 0x4b2c12, 0x4b2708, 0x512b05, 0x65401d, 0x6f4721, 0x6c421d, 0x704520, 0x79502b, 0x987251, 0x643e1a, 0x603d1e, 0x5b391d, 0x59381c, 0x633f1f, 0x694624, 0x68482a, 0x5b3e23, 0x482c18, 0x472c18, 0x543a1f, 0x624526, 0x644121, 0x7b5235, 0x744a28, 0x825731, 0x855a32, 0x825a32, 0x7c5430, 0x7a4f2b, 0x784923, 0x7f5122, 0xa87d42, 0xc29a53, 0xddb86a, 0xd9b368, 0xb98f4c, 0xa2743d, 0x8e5f30, 0x835624, 0x7c5324, 0x855b2e, 0x7f5428, 0x835933, 0x6b4527, 0x5d3517, 0x7a4722, 0x884f27, 0x89502c, 0x834826, 0x77411f, 0x6c3a1b, 0x693b1d, 0x67391c, 0x65381c, 0x62361a, 0x62371c, 0x5f361b, 0x5a3218, 0x654029, 0x502d18, 0x4b2914, 0x4c2a14, 0x573620, 0x341a08, 0x2d180d, 0x2a190b, 0x2b190c, 0x2a160e, 0x3d2615, 0x4c3522, 0x240f07, 0x24130b, 0x23110b, 0x210e03, 0x43342b, 0x291a12, 0x1d0e06, 0x1d0e07, 0x1a0c05, 0x190e05, 0x180e05, 0x160d04, 0x140b03, 0x140b04, 0x130a04, 0x160d05, 0x180d06, 0x130a03, 0x120a05, 0x120a06, 0x110705, 0x100805, 0x110905, 0x100904, 0x0f0903, 0x0e0803, 0x0e0803, 0x0e0803, 0x0e0803, 0x0d0803, 0x0d0702, 0x0f0703, 0x0f0803, 0x0f0803, 0x100a04, 0x100903, 0x110904, 0x120a04, 0x130a03, 0x120a03, 0x110a03, 0x0e0701, 0x0c0701, 0x0a0801, 0x0a0602, 0x080401, 0x050300, 0x050400, 0x040300, 0x040300, 0x030200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x020100, 0x030200, 0x040301, 0x040500, 0x050500, 0x050501, 0x050500, 0x070501, 0x0a0602, 0x0a0702, 0x0c0703, 0x0d0603, 0x0e0603, 0x0d0603, 0x0e0703, 0x0d0703, 0x0c0703, 0x0c0703, 0x0c0702, 0x0c0702, 0x0d0803, 0x0d0803, 0x0d0702, 0x0d0803, 0x0d0803, 0x0f0804, 0x100804, 0x100804, 0x110805, 0x120906, 0x120b05, 0x140c05, 0x150b05, 0x160a04, 0x170b05, 0x170c07, 0x1a0e08, 0x1b0a02, 0x39281e, 0x5a4439, 0x220c00, 0x261509, 0x311a0b, 0x3e2110, 0x361d0d, 0x392011, 0x3c2012, 0x402310, 0x482710, 0x4e2912, 0x542c14, 0x5b3116, 0x643619, 0x6d3a1a, 0x77401d, 0x7f4521, 0x7d431e, 0x78401c, 0x723c1d, 0x6b371a, 0x623010, 0x5f3118, 0x5f321a, 0x5e3217, 0x5d3316, 0x5c3014, 0x5e3116, 0x5d3517, 0x603515, 0x7b4a2d, 0x704020, 0x6b3a1b, 0x6c3d1f, 0x703f1f, 0x804b29, 0x844920, 0x8f5128, 0x99562c, 0x9f5c2b, 0x97582b, 0x7c4019, 0x7e411a, 0x7a4018, 0x7a3e17, 0x9e5d2d, 0xbc7c3f, 0xc88a4c, 0xac723b, 0x905a2c, 0x834f22, 0x7a4216, 0x7b4417, 0x926c3a, 0xbfa366, 0xd9c17d, 0xebd58f, 0xe3cd8e, 0xcdb277, 0xb3905a, 0x9e7544, 0x875d30, 0x7c4c24, 0x79451e, 0x7f4d29, 0x724521, 0x6f4721, 0x714b21, 0x6d4821, 0x69431d, 0x6b4823, 0x694727, 0x603c1e, 0x6b4322, 0x714727, 0x663d1f, 0x5a3316, 0x572d06, 0x694321, 0x6b4623, 0x694320, 0x664121, 0x623e1f, 0x684321, 0x744f2c, 0x6d4925, 0x674424, 0x664425, 0x6f4b28, 0x7d5631, 0x7f562f, 0x7a4e26, 0x8d5e33, 0x885525, 0x895422, 0x8a5927, 0x8e612c, 0xa6773b, 0xca9c59, 0xdbac63, 0xd6ab60, 0xcda45c, 0xb38b4a, 0x8a5c29, 0x845728, 0x7f5529, 0x875c31, 0x8b6133, 0x7a5028, 0x805430, 0x6b401e, 0x633310, 0x834b26, 0x8e5028, 0x864b26, 0x7b4523, 0x76401f, 0x743d1f, 0x6a391e, 0x60351d, 0x5a321b, 0x59331a, 0x5b351b, 0x583117, 0x593117, 0x583118, 0x593116, 0x633b23, 0x502d17, 0x3f2412, 0x361f10, 0x311a0a, 0x311b0c, 0x2b180d, 0x291808, 0x2a180a, 0x210400, 0x695139, 0x93795c, 0x130000, 0x21130a, 0x24120b, 0x221007, 0x211006, 0x1e1007, 0x1e0f07, 0x1c0d06, 0x190d05, 0x180d04, 0x160d04, 0x140b02, 0x140b04, 0x140a04, 0x140a05, 0x140b05, 0x140a04, 0x130b04, 0x120b06, 0x110a06, 0x0f0805, 0x0f0805, 0x100904, 0x0e0802, 0x0d0803, 0x0c0703, 0x0b0603, 0x0c0703, 0x0c0703, 0x0d0804, 0x0c0804, 0x0d0703, 0x0d0603, 0x0d0703, 0x0c0803, 0x0d0803, 0x0e0804, 0x0f0904, 0x100a03, 0x100903, 0x0e0803, 0x0d0802, 0x0c0702, 0x0b0701, 0x0a0601, 0x080401, 0x060300, 0x050400, 0x040300, 0x040300, 0x030201, 0x030201, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x020200, 0x040301, 0x040301, 0x040500, 0x050601, 0x050601, 0x040500, 0x060500, 0x090601, 0x0a0702, 0x0a0601, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0603, 0x0c0703, 0x0b0801, 0x0b0801, 0x0c0701, 0x0d0802, 0x0d0802, 0x0d0802, 0x0d0802, 0x0f0903, 0x100903, 0x110a04, 0x110a03, 0x130a03, 0x150a04, 0x150a04, 0x170c06, 0x180d07, 0x1b0c03, 0x322116, 0x4c372c, 0x240f02, 0x26160a, 0x3d2314, 0x553321, 0x3c200f, 0x3a2011, 0x3c2212, 0x432411, 0x482611, 0x4d2a12, 0x542e14, 0x5c3016, 0x643519, 0x6b391a, 0x733e1c, 0x753f1c, 0x703c1b, 0x69391a, 0x64351a, 0x603014, 0x7c5339, 0x62381f, 0x572e16, 0x582e14, 0x885d43, 0x60361b, 0x542f15, 0x522d10, 0x542f14, 0x542c15, 0x593216, 0x60351a, 0x63371c, 0x67381a, 0x6d3918, 0x753f1d, 0x854924, 0x8e4f26, 0x97562a, 0xa7602f, 0xa96534, 0x9c5f31, 0x7f451c, 0x7f3e0f, 0xa9612a, 0xab632c, 0x864c21, 0x7f4d26, 0x8f5e33, 0x905d31, 0x835129, 0x794822, 0x7f491f, 0x7b410d, 0x804913, 0x93642d, 0xaa8753, 0xccb176, 0xdfc984, 0xebd58e, 0xe1c984, 0xc9b06f, 0xb69b5d, 0xad8b4e, 0xa57c40, 0x9e7035, 0xad7b43, 0xa7733d, 0x9f6b39, 0x8d5c2e, 0x86562e, 0x7b4d29, 0x673d18, 0x835833, 0x704620, 0x66411f, 0x694121, 0x774c26, 0x8b6036, 0x845930, 0x865930, 0x956739, 0x97653b, 0x875830, 0x784a25, 0x7c4e29, 0x774b24, 0x794b21, 0x8c5f30, 0x9e703b, 0x9c6c2f, 0xb38546, 0xc69b57, 0xd4a860, 0xdeb26c, 0xd6a863, 0xc3934c, 0xb48745, 0xa5793e, 0x875729, 0x7e4d22, 0x77471b, 0x7c4f24, 0x885b2e, 0x8c6032, 0x8a5e33, 0x875d34, 0x724423, 0x713f1c, 0x824c24, 0x8b5228, 0x894f25, 0x7f441f, 0x77411f, 0x6c3b1c, 0x68381a, 0x744123, 0x61351b, 0x542f15, 0x552e16, 0x583019, 0x4f2d14, 0x4f2d14, 0x502b10, 0x502d17, 0x542e16, 0x512a10, 0x4c2a14, 0x402411, 0x371c09, 0x533726, 0x593d2b, 0x271304, 0x27170a, 0x271609, 0x271508, 0x2a1708, 0x2b1808, 0x231105, 0x201009, 0x1f1108, 0x1e1008, 0x1c0e07, 0x1b0f07, 0x1b0e06, 0x190d04, 0x170d04, 0x170d04, 0x150c03, 0x130a02, 0x140b04, 0x130a05, 0x130a05, 0x120805, 0x120a04, 0x120b05, 0x110905, 0x100805, 0x0d0804, 0x0c0804, 0x0c0703, 0x0c0703, 0x0b0602, 0x0b0602, 0x0c0703, 0x0b0702, 0x0a0702, 0x0a0702, 0x0b0803, 0x0b0803, 0x0a0702, 0x0b0802, 0x0b0801, 0x0b0801, 0x0a0801, 0x0b0802, 0x0c0702, 0x0d0804, 0x0c0703, 0x0c0703, 0x0c0603, 0x0b0602, 0x090601, 0x080501, 0x070300, 0x050300, 0x040300, 0x030301, 0x020200, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x020200, 0x030200, 0x040301, 0x040500, 0x040500, 0x040500, 0x040500, 0x050500, 0x080500, 0x090601, 0x090601, 0x0a0601, 0x0a0602, 0x0a0602, 0x0a0601, 0x0a0702, 0x0b0702, 0x0b0702, 0x0a0602, 0x0a0601, 0x0a0602, 0x0a0701, 0x0a0702, 0x0b0802, 0x0c0702, 0x0c0702, 0x0d0802, 0x0c0802, 0x0e0802, 0x100903, 0x110a04, 0x120a03, 0x120902, 0x140a03, 0x150a03, 0x160c04, 0x170d07, 0x1b1008, 0x1c0e03, 0x190a00, 0x241508, 0x291709, 0x311a0c, 0x381d0f, 0x381e0e, 0x391f10, 0x3d2211, 0x442512, 0x482612, 0x4c2913, 0x522d14, 0x5b3117, 0x633419, 0x693718, 0x6c3b1b, 0x6a391a, 0x633619, 0x5f3318, 0x5b3018, 0x582e15, 0x653f28, 0x552f18, 0x502b16, 0x4e2912, 0x603922, 0x65402a, 0x502a0f, 0x64412a, 0x55321c, 0x4d2714, 0x502c15, 0x542f16, 0x5c341a, 0x65381c, 0x703d1f, 0x814c2e, 0x763e1b, 0x7f441f, 0x864b26, 0x8f5127, 0x9c5924, 0xb26d34, 0xc27a41, 0xc07b3c, 0xc47d38, 0xac662d, 0x6c3712, 0x4d2108, 0x52280d, 0x70411f, 0x704322, 0x6e411f, 0x905b31, 0xa56936, 0x965c2b, 0x824a23, 0x864f20, 0x82430f, 0x8a531b, 0x9c7036, 0xb38e4e, 0xcdab65, 0xdcbf73, 0xe5c878, 0xe6c87a, 0xdebf74, 0xdfbf75, 0xd3b266, 0xccaa61, 0xc9a761, 0xc6a05d, 0xb58d4f, 0x9e7640, 0x966f3a, 0x986f3c, 0x936835, 0x7f5223, 0x82521f, 0xa16d34, 0xa6763b, 0xa57b42, 0xa67a40, 0xa57338, 0xa97c3f, 0xab8246, 0xb2884d, 0xc29a59, 0xd0ab65, 0xd8b46b, 0xe2bd72, 0xddb166, 0xdeb066, 0xd0a45c, 0xc1944d, 0xae7f3d, 0x9a682e, 0x895825, 0x7c4e24, 0x724420, 0x7f532b, 0x926636, 0x9a6c39, 0x9e6d3d, 0x8a5b32, 0x6d3e19, 0x6e3a13, 0x7f4a20, 0x7c4622, 0x854a26, 0x854b25, 0x7f4821, 0x76431e, 0x6f3e1b, 0x6a3b1b, 0x64371b, 0x62371c, 0x6a3e23, 0x583016, 0x4b2610, 0x6c492f, 0x926d4f, 0x472008, 0x4b2b13, 0x5d3e29, 0x472913, 0x4a2a13, 0x5f391f, 0x58321a, 0x422312, 0x3a2010, 0x39210e, 0x391f0f, 0x2a190b, 0x281708, 0x271507, 0x251409, 0x231207, 0x200f05, 0x201009, 0x1e0f0a, 0x1d0f07, 0x1c0f07, 0x1b0e07, 0x1b0d05, 0x180d05, 0x170d04, 0x160c03, 0x150b04, 0x140b04, 0x140b04, 0x130a03, 0x130a05, 0x130a05, 0x120904, 0x110a04, 0x110a04, 0x100905, 0x0f0905, 0x0d0804, 0x0d0804, 0x0c0703, 0x0c0703, 0x0c0703, 0x0c0703, 0x0b0702, 0x0a0702, 0x090601, 0x090602, 0x090702, 0x090602, 0x090601, 0x090601, 0x0a0602, 0x0a0501, 0x090501, 0x090501, 0x0a0601, 0x0a0601, 0x0a0702, 0x0b0702, 0x0a0602, 0x0a0602, 0x090601, 0x080501, 0x060300, 0x050400, 0x040300, 0x040401, 0x030301, 0x020200, 0x010100, 0x010101, 0x020202, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x030200, 0x040301, 0x030400, 0x040500, 0x040500, 0x040500, 0x050500, 0x050400, 0x070500, 0x080501, 0x090501, 0x0a0702, 0x090601, 0x080601, 0x090601, 0x090601, 0x090601, 0x090601, 0x080600, 0x090701, 0x090702, 0x090602, 0x0a0702, 0x0b0703, 0x0b0702, 0x0c0701, 0x0d0802, 0x0e0802, 0x100903, 0x100a04, 0x110a03, 0x120b03, 0x140b04, 0x150b04, 0x150b03, 0x170d06, 0x180f07, 0x1b1108, 0x1e140a, 0x221508, 0x291607, 0x2b1709, 0x2f1a0d, 0x341c0d, 0x391f10, 0x3e2211, 0x432511, 0x472612, 0x4b2813, 0x502c14, 0x582f16, 0x603319, 0x643519, 0x623519, 0x5c3317, 0x573016, 0x532d15, 0x502b17, 0x4d2a15, 0x49260d, 0x4a2712, 0x492714, 0x452511, 0x53321e, 0x634430, 0x442106, 0x684933, 0x53341f, 0x472510, 0x4a2b14, 0x4a2b14, 0x512d15, 0x5c3118, 0x643519, 0x713e1f, 0x7f4726, 0x804723, 0x78411e, 0x7b411b, 0xa46a40, 0xa1602c, 0xb97034, 0xd68e46, 0xe39e53, 0xc78244, 0xa0602d, 0x7a4521, 0x5b3215, 0x5c3214, 0x4c2609, 0x472201, 0x724828, 0x9d693d, 0x986233, 0x82502a, 0x7d4c20, 0x804d21, 0x73431f, 0x703f19, 0x794415, 0x804711, 0x8b521b, 0x935b22, 0xa06d32, 0xa77a3c, 0xb88f4c, 0xc49952, 0xd0a75e, 0xd8b469, 0xdcbc71, 0xd8b96d, 0xe2c070, 0xe1c072, 0xdfbb6d, 0xd7ae5f, 0xce9f54, 0xd6a659, 0xd9a956, 0xdab161, 0xe5c679, 0xdcb465, 0xce9b4b, 0xc8994a, 0xcfa457, 0xbd8b47, 0xb37f3e, 0xb68441, 0xaf7c3b, 0xac7537, 0xb17839, 0xa86e31, 0x9c6127, 0x9e622d, 0x9c612f, 0x905a2a, 0x87572c, 0x7c4f29, 0x885b34, 0x7b5229, 0x815730, 0x845632, 0x824e20, 0x955d2b, 0x95592d, 0x95562e, 0x95582d, 0x854b23, 0x78431f, 0x71401c, 0x6d3e1c, 0x693a1c, 0x63371a, 0x5d3619, 0x593319, 0x563218, 0x512c14, 0x4c2c17, 0x442817, 0x462810, 0x4b2d14, 0x402111, 0x4b2d17, 0x6b4e39, 0x40230d, 0x402106, 0x7b5840, 0x623f2a, 0x3f1f0e, 0x3b2212, 0x351f0c, 0x311c0d, 0x2b1a0d, 0x291607, 0x261507, 0x221408, 0x211306, 0x1e1206, 0x1d1107, 0x1e1008, 0x1c0f06, 0x1b0e05, 0x1b0e06, 0x1a0d05, 0x180c04, 0x160c03, 0x150b03, 0x140a04, 0x140a04, 0x140b04, 0x130a03, 0x130a05, 0x120904, 0x120a04, 0x110a04, 0x100903, 0x0e0904, 0x0d0804, 0x0d0804, 0x0d0804, 0x0c0703, 0x0b0602, 0x0b0702, 0x0a0602, 0x090601, 0x090601, 0x090601, 0x070601, 0x070601, 0x070500, 0x070601, 0x070500, 0x080401, 0x080401, 0x080401, 0x080401, 0x080400, 0x080501, 0x090501, 0x090501, 0x090602, 0x090601, 0x090601, 0x060500, 0x050400, 0x050400, 0x040300, 0x040401, 0x030201, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x000000, 0x010101, 0x020201, 0x010100, 0x010100, 0x020200, 0x040301, 0x020300, 0x030400, 0x030400, 0x040500, 0x050500, 0x050400, 0x050400, 0x070300, 0x070300, 0x080400, 0x080500, 0x080400, 0x080501, 0x080501, 0x080500, 0x080500, 0x080400, 0x080501, 0x080601, 0x090702, 0x090601, 0x0a0803, 0x0b0702, 0x0b0600, 0x0c0701, 0x0e0802, 0x0f0802, 0x0e0903, 0x100b03, 0x110a02, 0x130a03, 0x140b04, 0x150b03, 0x170d03, 0x190e05, 0x1d1007, 0x211308, 0x241508, 0x281609, 0x2a180a, 0x2e1a0c, 0x331d0f, 0x38200f, 0x3d210f, 0x412410, 0x472512, 0x4b2814, 0x512c16, 0x572f16, 0x5b3017, 0x5c3118, 0x572f16, 0x522d14, 0x4f2b12, 0x4b2812, 0x482615, 0x442512, 0x432610, 0x442412, 0x462612, 0x432714, 0x41230f, 0x3a1c07, 0x3e2313, 0x3b1e07, 0x3d200d, 0x422414, 0x432512, 0x472916, 0x48240c, 0x724d37, 0x6a412a, 0x643415, 0x9f6c4c, 0x764220, 0x6c3b1b, 0x6f3c1c, 0x824b27, 0x9b5e2f, 0xb46f34, 0xce833f, 0xd0853f, 0xb36c31, 0x9f5d2d, 0x92572e, 0x864f29, 0x7a4623, 0x6f3e1e, 0x633515, 0x5f2f0e, 0x552507, 0x4f250a, 0x63381a, 0x693b1b, 0x7e502a, 0x956034, 0x945d30, 0x915a2d, 0x865225, 0x79471c, 0x78461b, 0x7d491c, 0x854f1e, 0x8c531e, 0x905820, 0x925b22, 0x8e571d, 0x894f14, 0x8c531a, 0x9a662c, 0x966326, 0x9c6729, 0x9f682a, 0x9c672b, 0x9f6b2f, 0x9b682b, 0x986529, 0x966428, 0x9b6624, 0xac7033, 0xb77d42, 0x91571e, 0x9b632f, 0x8d5823, 0x925b2a, 0xa06533, 0xa66932, 0xa66930, 0xa76a32, 0xaf723b, 0xa46832, 0xa66933, 0x9e6634, 0x845329, 0x8e603a, 0x926138, 0x7b4925, 0x804b26, 0x92572e, 0x98592b, 0xa1602d, 0x9c5b28, 0x945227, 0x884b22, 0x763f1c, 0x6d3e1e, 0x663a1b, 0x5e3619, 0x5a3419, 0x563218, 0x523117, 0x502e16, 0x4c2c15, 0x4a2a15, 0x462813, 0x3f2611, 0x3c2212, 0x381f11, 0x362112, 0x37200f, 0x341804, 0x392111, 0x3d2211, 0x3d1e0a, 0x3f210e, 0x3e2311, 0x3a2110, 0x361f0f, 0x311c0e, 0x2a180b, 0x281606, 0x241509, 0x201209, 0x1e1106, 0x1d1007, 0x1c0e07, 0x1d0e07, 0x1d0f06, 0x1b0e06, 0x190d05, 0x180d05, 0x170d04, 0x160c04, 0x140b04, 0x130a03, 0x130a03, 0x120904, 0x120904, 0x120903, 0x120903, 0x110903, 0x100a04, 0x0e0903, 0x0d0803, 0x0c0804, 0x0d0804, 0x0c0703, 0x0b0602, 0x0b0602, 0x0a0602, 0x090601, 0x090601, 0x090601, 0x070601, 0x060500, 0x060500, 0x060501, 0x060500, 0x050400, 0x060400, 0x060400, 0x050400, 0x050300, 0x070300, 0x070300, 0x070300, 0x070300, 0x080401, 0x080500, 0x070500, 0x050400, 0x050400, 0x050400, 0x040400, 0x030401, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x030200, 0x030400, 0x030400, 0x040400, 0x050400, 0x040400, 0x040500, 0x050500, 0x050400, 0x050400, 0x050400, 0x050501, 0x060400, 0x070300, 0x060400, 0x050501, 0x050400, 0x050500, 0x050501, 0x070601, 0x070701, 0x070500, 0x090602, 0x0a0702, 0x0b0702, 0x0a0601, 0x0d0702, 0x100903, 0x0f0903, 0x0f0a03, 0x110a03, 0x140a03, 0x140a04, 0x140b03, 0x170c03, 0x1b0e05, 0x1d0f06, 0x221207, 0x241408, 0x271608, 0x291709, 0x2e1a0c, 0x341d0f, 0x371f0f, 0x3c200e, 0x40230f, 0x472511, 0x4b2813, 0x502c15, 0x542e16, 0x552d16, 0x532d14, 0x4e2a12, 0x4a2813, 0x472611, 0x432411, 0x402311, 0x3e220f, 0x3d2310, 0x3e2211, 0x422612, 0x432814, 0x402615, 0x4c3323, 0x381d0e, 0x3a2011, 0x3b2010, 0x3d2212, 0x3f2312, 0x3f2312, 0x442512, 0x4f2b15, 0x583018, 0x592f15, 0x5f3116, 0x683a1e, 0x63371a, 0x653819, 0x6f3c1b, 0x8a4f25, 0xaa652d, 0xc37739, 0xb66a30, 0x9d5928, 0x894d24, 0x804823, 0x814821, 0x824a24, 0x844c27, 0x834b27, 0x7c4420, 0x703c1a, 0x693b1a, 0x633618, 0x52270e, 0x4d240b, 0x683f18, 0x7b4f25, 0x916034, 0x9a6333, 0x955d2b, 0x996536, 0x9c683a, 0x935e2d, 0x955e2f, 0x834f21, 0x835124, 0x7d4a1d, 0x764317, 0x77451c, 0x724219, 0x865121, 0x8f5926, 0x955e29, 0xa26933, 0x98612a, 0x945e24, 0x955f27, 0x925c2a, 0x885324, 0x97602d, 0x9e6830, 0x97612a, 0x9d6732, 0x9f6934, 0xa26932, 0xaf7437, 0xb5793b, 0xa76b33, 0xa66933, 0xa26431, 0xa26531, 0xa0622e, 0x9d612e, 0x9e6435, 0x91592c, 0x884f22, 0x91572b, 0x905427, 0x8f5225, 0x8e5026, 0x8c4a22, 0x8a4b22, 0x844820, 0x904f26, 0xa6693d, 0x6d3b19, 0x5f3419, 0x573219, 0x502f18, 0x4b2d16, 0x4b2b15, 0x492914, 0x482a15, 0x472812, 0x40240f, 0x3c220e, 0x3a2212, 0x372011, 0x32200f, 0x322010, 0x351e10, 0x341f0f, 0x362010, 0x392111, 0x3c2111, 0x3d2111, 0x3b2012, 0x361e11, 0x311c0e, 0x2b1809, 0x281607, 0x231407, 0x1f1108, 0x1e1008, 0x1d0f07, 0x1d0f07, 0x1c0e06, 0x201105, 0x28160c, 0x1e0f06, 0x170d04, 0x160c04, 0x140b04, 0x140b04, 0x130a03, 0x130a04, 0x120905, 0x120a04, 0x120a03, 0x110901, 0x100a02, 0x0f0a03, 0x0d0803, 0x0c0703, 0x0c0704, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0501, 0x0a0601, 0x090702, 0x070500, 0x060500, 0x060501, 0x060501, 0x070401, 0x060300, 0x060300, 0x050400, 0x050400, 0x050400, 0x040300, 0x050300, 0x050300, 0x050300, 0x050300, 0x060400, 0x050500, 0x060501, 0x050400, 0x060400, 0x040400, 0x030400, 0x030300, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020300, 0x020200, 0x030301, 0x040301, 0x040400, 0x040500, 0x030400, 0x040400, 0x050400, 0x040500, 0x030500, 0x040400, 0x050300, 0x040300, 0x030400, 0x030400, 0x040500, 0x040500, 0x060500, 0x070601, 0x070601, 0x080601, 0x080501, 0x0a0802, 0x0b0602, 0x0c0601, 0x0f0802, 0x110904, 0x100a04, 0x100a03, 0x130b03, 0x140b04, 0x140b04, 0x160c03, 0x1b0e05, 0x1e1007, 0x211108, 0x241408, 0x271507, 0x291709, 0x2e1a0c, 0x341d0e, 0x371e0f, 0x3a1f0d, 0x3f220e, 0x452510, 0x4a2812, 0x4e2b14, 0x4f2b15, 0x4f2a15, 0x4b2810, 0x47250f, 0x432510, 0x412411, 0x3d210f, 0x3b200d, 0x3b210f, 0x3a2110, 0x3a2110, 0x3b2110, 0x391f0d, 0x392010, 0x3d2415, 0x361d0d, 0x361e0f, 0x381f0f, 0x381f0e, 0x3b2110, 0x3c2111, 0x402311, 0x492815, 0x54311c, 0x4e2b13, 0x502f16, 0x543017, 0x583018, 0x5c3219, 0x663719, 0x7d421d, 0xa05b28, 0xaf6630, 0x975123, 0x894a21, 0x7d441e, 0x78431f, 0x784420, 0x75411e, 0x76411e, 0x77421e, 0x7b4521, 0x804823, 0x834d26, 0x814c27, 0x834e27, 0x8c552d, 0x8e552e, 0x76401b, 0x66340f, 0x6c3c18, 0x663811, 0x724621, 0x6a401b, 0x734a23, 0x835833, 0x734421, 0x7e4d27, 0x86552e, 0x97683e, 0x8b6037, 0x835730, 0x9c6b3f, 0x8a5828, 0x96622e, 0x98622e, 0x95612c, 0xac7947, 0x9c6937, 0x8b5827, 0x7c4e1f, 0x8e5f30, 0x966732, 0x905f2a, 0x96632e, 0x9a632c, 0xa16a34, 0xa66d33, 0x9a5e28, 0x9a5d27, 0x9f602b, 0xa7642d, 0xb46e35, 0xb16b32, 0xa6622c, 0x9a5a29, 0x8e5126, 0x894f27, 0x844b23, 0x7f4720, 0x7c451f, 0x7b451f, 0x79431f, 0x794220, 0x783c16, 0x8e512b, 0xab6d44, 0x6e3d1b, 0x583016, 0x512f18, 0x4b2b16, 0x442712, 0x412613, 0x412514, 0x402612, 0x3e2413, 0x3a2210, 0x38210f, 0x36200f, 0x341f0f, 0x331d0f, 0x341c10, 0x331c0f, 0x301c0f, 0x311e0d, 0x341f0e, 0x371f10, 0x391e11, 0x381e11, 0x341e10, 0x2f1b0d, 0x2a1808, 0x271608, 0x231307, 0x201108, 0x1d0f07, 0x1c0f06, 0x1c0f06, 0x1a0e04, 0x251609, 0x321f14, 0x1f1207, 0x150c03, 0x140b03, 0x130b04, 0x130b03, 0x120b04, 0x120a05, 0x110903, 0x110a03, 0x100903, 0x100902, 0x0f0902, 0x0d0802, 0x0d0803, 0x0d0804, 0x0b0603, 0x0c0703, 0x0b0602, 0x0b0602, 0x0a0601, 0x0a0602, 0x0a0602, 0x090601, 0x060500, 0x050500, 0x060400, 0x060300, 0x060400, 0x060400, 0x050300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040400, 0x030500, 0x050500, 0x050400, 0x040300, 0x040400, 0x040500, 0x030300, 0x030301, 0x020201, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020100, 0x020200, 0x020200, 0x030301, 0x030200, 0x030300, 0x020300, 0x020300, 0x030300, 0x030200, 0x020400, 0x020400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x030400, 0x040500, 0x060501, 0x060501, 0x070601, 0x070500, 0x080500, 0x090601, 0x0b0703, 0x0b0601, 0x0b0600, 0x100702, 0x110904, 0x110b03, 0x120b03, 0x140c04, 0x140b03, 0x160c03, 0x1b0e05, 0x1e1007, 0x211107, 0x241408, 0x271507, 0x2b180a, 0x2e1a0c, 0x331c0e, 0x361e0e, 0x3a1e0d, 0x3f220d, 0x442410, 0x482713, 0x4a2a14, 0x482813, 0x462511, 0x432410, 0x3f230e, 0x3c210f, 0x3a210f, 0x391f0e, 0x3c2212, 0x3b2313, 0x361f0f, 0x361f0f, 0x351e0f, 0x331c0d, 0x331c0e, 0x321b0e, 0x321c0e, 0x321c0e, 0x361f11, 0x372012, 0x371f10, 0x381e0f, 0x412616, 0x422614, 0x422411, 0x442713, 0x462914, 0x4c2b14, 0x593419, 0x643a1d, 0x653719, 0x804622, 0x9d592c, 0x955226, 0x7e411d, 0x753f1e, 0x6f3c1c, 0x6c3c1c, 0x6c3c1b, 0x69391a, 0x68391b, 0x693a1a, 0x6b3b1b, 0x703d1d, 0x75401e, 0x7d451f, 0x8c4f23, 0x9e5c2a, 0xae6631, 0xac6633, 0x9e5e2f, 0x975a2e, 0x854c22, 0x733f1a, 0x6f3c17, 0x74441e, 0x663611, 0x552b0d, 0x552d0d, 0x663d1d, 0x633c1c, 0x6a4321, 0x75461f, 0x85542b, 0x7e4d23, 0x814e20, 0x7c4c21, 0x7c4f25, 0x966a40, 0x7c4c24, 0x76451e, 0x774820, 0x7a4626, 0x814a25, 0x8d5428, 0x965b29, 0xa2642d, 0xa06227, 0xb67635, 0xb47235, 0x9d5d27, 0xa86731, 0xb36d35, 0xbb6f32, 0xbc7030, 0xad662b, 0x945321, 0x8c5128, 0x7e4822, 0x733f1c, 0x6f3e1c, 0x6c3d1d, 0x6c3c1b, 0x683915, 0x7c4623, 0x8c5431, 0x6a3911, 0x64310f, 0x613315, 0x552f15, 0x4a2b16, 0x442613, 0x432712, 0x3f2412, 0x3a1f0f, 0x351700, 0x361e0e, 0x331f10, 0x321e0e, 0x321e0e, 0x301d0e, 0x301c0e, 0x2e1b0e, 0x2c190a, 0x271009, 0x29170c, 0x2c1b0c, 0x311d0e, 0x321d0f, 0x331c0e, 0x301a09, 0x2e1b0d, 0x2a1709, 0x261608, 0x221307, 0x1f1108, 0x1d0f06, 0x1b0f05, 0x180e04, 0x180e04, 0x1f1107, 0x211105, 0x180f03, 0x130d02, 0x130c04, 0x120b03, 0x120b03, 0x110a04, 0x110a04, 0x110a02, 0x100903, 0x100903, 0x0e0803, 0x0c0702, 0x0c0702, 0x0c0703, 0x0c0703, 0x0b0602, 0x0b0602, 0x0a0602, 0x0a0702, 0x090702, 0x080601, 0x080601, 0x070601, 0x060501, 0x050400, 0x070300, 0x070300, 0x050400, 0x040400, 0x040400, 0x040300, 0x040300, 0x040300, 0x040300, 0x030200, 0x030200, 0x040300, 0x040301, 0x040300, 0x030400, 0x040500, 0x040500, 0x040400, 0x040400, 0x030400, 0x030400, 0x030301, 0x020200, 0x020200, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030200, 0x030200, 0x020200, 0x020200, 0x030200, 0x030200, 0x020200, 0x020300, 0x020300, 0x030300, 0x030400, 0x030400, 0x030400, 0x030500, 0x040500, 0x050501, 0x060501, 0x070602, 0x070500, 0x080500, 0x090601, 0x0a0702, 0x0b0802, 0x0b0801, 0x0f0802, 0x100903, 0x100a03, 0x120a03, 0x130a03, 0x130a03, 0x150b03, 0x1a0d04, 0x1d0f06, 0x211007, 0x251408, 0x281608, 0x2b180a, 0x2e1a0c, 0x331c0d, 0x361d0e, 0x3a1e0d, 0x3f220e, 0x442410, 0x462612, 0x442611, 0x412410, 0x3d220f, 0x3a210d, 0x38200e, 0x361f0e, 0x331e0e, 0x341e0e, 0x341d0e, 0x341e0f, 0x331d0f, 0x321b0d, 0x301c0d, 0x2e1a0c, 0x2e190c, 0x301b0d, 0x2f1b0e, 0x2f1b0e, 0x301a0d, 0x311b0e, 0x331c0f, 0x361e10, 0x3a2214, 0x3b2213, 0x3a2212, 0x3c2211, 0x432817, 0x43230e, 0x674228, 0x764b2d, 0x643413, 0x804422, 0x945229, 0x7f4420, 0x68371d, 0x5f3319, 0x5c3217, 0x5f361a, 0x5c3418, 0x5c3419, 0x5d3318, 0x5e3419, 0x5f351a, 0x62361b, 0x68391c, 0x703f1d, 0x804720, 0x915224, 0x9a592a, 0x955628, 0x8c5024, 0x874c21, 0x884d23, 0x864a23, 0x864b24, 0x8f552a, 0x844c27, 0x784521, 0x75441d, 0x83502a, 0x7a4623, 0x75411d, 0x834e26, 0x854e25, 0x75401a, 0x844d25, 0x7c4821, 0x714018, 0x78471d, 0x7b4a23, 0x79461e, 0x8b5427, 0x8b5128, 0x9d602f, 0xa76731, 0xa05e29, 0xa4612c, 0xaf6b2f, 0xc27c39, 0xba7435, 0xa15f28, 0xa05f2b, 0xa05d29, 0xaa622a, 0xbb7137, 0xab652e, 0x8b4f21, 0x7b4820, 0x6f3f1a, 0x673a1a, 0x62381b, 0x60361b, 0x613517, 0x6c3c1c, 0x784624, 0x895a38, 0x5f3413, 0x5d3419, 0x6c3f22, 0x5d361d, 0x462712, 0x3f2411, 0x462c16, 0x402715, 0x341907, 0x684c35, 0x412817, 0x2c1a0c, 0x2d1b0d, 0x2c1b0c, 0x2c1a0c, 0x2c1c0c, 0x28190a, 0x3b1f08, 0x6f4822, 0x4f2f13, 0x261307, 0x2a180c, 0x2b190d, 0x321c0e, 0x483124, 0x2e1b0e, 0x291709, 0x251608, 0x211308, 0x1f1108, 0x1c0f07, 0x1a0f06, 0x160e03, 0x150d02, 0x180d05, 0x180c03, 0x130d02, 0x130d04, 0x130b03, 0x120b03, 0x120b04, 0x110a04, 0x100903, 0x100902, 0x100903, 0x0e0904, 0x0c0703, 0x0c0703, 0x0c0704, 0x0c0703, 0x0c0703, 0x0b0602, 0x0b0603, 0x0a0502, 0x090502, 0x070602, 0x070601, 0x060500, 0x060501, 0x050400, 0x050400, 0x050400, 0x040400, 0x040300, 0x040300, 0x040300, 0x050301, 0x040300, 0x030200, 0x030200, 0x030200, 0x040301, 0x040301, 0x040301, 0x020200, 0x020300, 0x020300, 0x020300, 0x030400, 0x030400, 0x030400, 0x020200, 0x020200, 0x020200, 0x020200, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020201, 0x010100, 0x010100, 0x010101, 0x020100, 0x030200, 0x020200, 0x020200, 0x020200, 0x020200, 0x030200, 0x030200, 0x030200, 0x030301, 0x030201, 0x030300, 0x040500, 0x030400, 0x040400, 0x030400, 0x050401, 0x050401, 0x060400, 0x080601, 0x090601, 0x090601, 0x080500, 0x0a0701, 0x0b0801, 0x0d0803, 0x0f0a04, 0x100a02, 0x130a03, 0x140a04, 0x140b04, 0x160c03, 0x1b0e05, 0x1d1007, 0x211107, 0x251408, 0x281608, 0x2a1709, 0x2c190a, 0x321c0d, 0x361e0e, 0x3a1f0e, 0x3d210d, 0x412310, 0x422410, 0x3e230f, 0x3b200f, 0x381f0f, 0x341f0f, 0x331e0e, 0x321e0e, 0x301d0e, 0x301c0d, 0x301b0c, 0x301b0d, 0x301a0d, 0x2e1a0c, 0x2d1a0b, 0x2b180b, 0x2b180a, 0x2b190b, 0x2c190c, 0x2c180c, 0x2d1a0c, 0x2e1a0c, 0x301b0d, 0x321c0e, 0x331c0e, 0x341d10, 0x351f11, 0x392312, 0x472e1d, 0x3f2312, 0x4a2814, 0x592e17, 0x693718, 0x824522, 0x894a25, 0x6e3a1b, 0x552c13, 0x4f2c13, 0x502d15, 0x553119, 0x542f17, 0x532e16, 0x542f17, 0x553018, 0x563118, 0x5a3319, 0x603418, 0x693a1b, 0x7a431f, 0x874b24, 0x8b4d25, 0x814621, 0x77411e, 0x743f1e, 0x754120, 0x733f1d, 0x774322, 0x774421, 0x6f3d1f, 0x704020, 0x754320, 0x7a4521, 0x7c4722, 0x7e4822, 0x824c23, 0x864f26, 0x814c24, 0x885027, 0x8b5229, 0x885026, 0x955e33, 0x955f34, 0x864e23, 0x8d5329, 0x905429, 0x915425, 0x935425, 0x945421, 0xae703e, 0xc78955, 0xa35f24, 0xa4602a, 0xa86734, 0x945525, 0x98592b, 0x9e5c2c, 0x9e5927, 0x8f4d1c, 0x7d451f, 0x6e3f1e, 0x663a1b, 0x61381b, 0x5b351a, 0x583119, 0x5b3015, 0x77482e, 0x5f3419, 0x522b0d, 0x5f3118, 0x603319, 0x6d3e22, 0x583017, 0x462713, 0x3f2511, 0x3a210c, 0x331e0e, 0x2e1909, 0x5b412d, 0x3a2414, 0x27170a, 0x28180a, 0x29180a, 0x2a190b, 0x2a1b0b, 0x231108, 0x673f20, 0xc99151, 0x895c2b, 0x260c02, 0x26160c, 0x27170c, 0x2d180b, 0x3e281c, 0x2c180c, 0x291709, 0x251609, 0x211408, 0x1f1108, 0x1c1007, 0x180f05, 0x160e03, 0x130c02, 0x130c04, 0x140b03, 0x120d04, 0x120c05, 0x120a04, 0x110a04, 0x110a04, 0x100904, 0x100904, 0x100a03, 0x0f0903, 0x0c0703, 0x0c0703, 0x0c0704, 0x0c0704, 0x0b0603, 0x0b0602, 0x0b0602, 0x0a0603, 0x090502, 0x070501, 0x060501, 0x060501, 0x050500, 0x050400, 0x050400, 0x050400, 0x040400, 0x030400, 0x040300, 0x040300, 0x050301, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030201, 0x030301, 0x030201, 0x030200, 0x020200, 0x020200, 0x020200, 0x010300, 0x020300, 0x020300, 0x030301, 0x020200, 0x020200, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x020101, 0x030102, 0x020001, 0x020001, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020300, 0x040500, 0x030400, 0x040300, 0x040300, 0x030400, 0x050400, 0x060500, 0x080500, 0x090501, 0x090601, 0x090601, 0x0a0602, 0x0b0602, 0x0e0603, 0x100903, 0x110a01, 0x120a02, 0x130a03, 0x130b04, 0x150c03, 0x190e05, 0x1d0f06, 0x201207, 0x231307, 0x271608, 0x291708, 0x2b190a, 0x301b0d, 0x351d0d, 0x3a1f0e, 0x3c210f, 0x3d220e, 0x3c210d, 0x381f0e, 0x351e0f, 0x321c0e, 0x2f1c0d, 0x2d1a0b, 0x2d1a0b, 0x2d190b, 0x2c190b, 0x2c190a, 0x2b190a, 0x2c190b, 0x2a170a, 0x29170b, 0x2a180c, 0x29160a, 0x28160a, 0x29180a, 0x29180a, 0x2a180b, 0x2b180c, 0x2d190d, 0x2e1a0b, 0x2f1b0c, 0x2f1b0c, 0x2f1b0d, 0x301d0e, 0x341d0f, 0x3b1f11, 0x442411, 0x613721, 0x6d3a1e, 0x7f4321, 0x773e1f, 0x5d2e16, 0x64412c, 0x4a2912, 0x472814, 0x4c2b18, 0x4e2b16, 0x4d2a14, 0x4d2c16, 0x4d2d18, 0x502d17, 0x532f16, 0x593116, 0x653518, 0x763f1f, 0x804623, 0x7c4420, 0x733e1c, 0x6c3c1c, 0x68391b, 0x67391a, 0x653617, 0x673a1c, 0x673c1e, 0x5f3419, 0x60371c, 0x65381c, 0x6a3b1e, 0x6c3d1d, 0x6f3d1d, 0x703e1c, 0x73411f, 0x72421f, 0x6f3f1c, 0x6f401e, 0x73411e, 0x75421d, 0x75441d, 0x7b4720, 0x7e4821, 0x7f4820, 0x814921, 0x814921, 0x8e5830, 0x8b552d, 0x864f23, 0x8b5023, 0x96572a, 0x8d4e23, 0x864a1f, 0x90552a, 0x8c4f24, 0x925121, 0xb2774b, 0x7c4621, 0x673919, 0x603619, 0x5b3318, 0x553017, 0x512d16, 0x502c14, 0x542d16, 0x4f2b14, 0x4f2e13, 0x633b23, 0x522b13, 0x532d15, 0x4d2810, 0x462611, 0x3e230f, 0x3a210f, 0x331e0c, 0x2c1a0b, 0x200f02, 0x261609, 0x25160a, 0x231509, 0x241509, 0x27170a, 0x29190b, 0x271409, 0x563317, 0x986835, 0x68401a, 0x230e04, 0x231408, 0x241609, 0x241508, 0x251406, 0x2b190b, 0x291709, 0x251609, 0x211406, 0x1f1206, 0x1b0f06, 0x170d04, 0x150c03, 0x140a03, 0x130c04, 0x130c04, 0x130c04, 0x120b04, 0x110a05, 0x110906, 0x100805, 0x100805, 0x100805, 0x0d0804, 0x0c0703, 0x0c0703, 0x0c0704, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0603, 0x0a0603, 0x090502, 0x070602, 0x050501, 0x050501, 0x060400, 0x060300, 0x050400, 0x050400, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030201, 0x030301, 0x020201, 0x010101, 0x010101, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x020101, 0x010001, 0x020101, 0x020200, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020201, 0x020200, 0x020300, 0x020400, 0x040500, 0x050400, 0x050400, 0x030400, 0x040400, 0x060400, 0x060400, 0x060400, 0x080501, 0x090601, 0x090601, 0x0a0601, 0x0c0602, 0x0f0803, 0x100902, 0x110a02, 0x120a03, 0x130b03, 0x150b03, 0x1a0e05, 0x1c0e06, 0x1f1207, 0x231409, 0x261508, 0x281608, 0x2b1909, 0x301a0c, 0x361d0f, 0x3b2010, 0x3b200e, 0x381e0e, 0x361d0d, 0x331c0c, 0x301b0c, 0x2e1a0b, 0x2b190a, 0x2b1909, 0x2a1809, 0x2a1709, 0x291709, 0x281608, 0x29170a, 0x2b190c, 0x27150a, 0x27160b, 0x27160b, 0x26150a, 0x26150a, 0x27150b, 0x27160d, 0x29170c, 0x29170c, 0x29180d, 0x29180b, 0x29180a, 0x2a190a, 0x2c1b0d, 0x2d1b0c, 0x301c0d, 0x3b2314, 0x422511, 0x552c15, 0x6a361a, 0x784021, 0x653318, 0x502a13, 0x654531, 0x4c2c18, 0x3e210e, 0x402413, 0x432614, 0x482b16, 0x482a16, 0x482914, 0x4a2914, 0x4f2c15, 0x542f16, 0x603419, 0x6d3b1c, 0x743f1e, 0x703d1c, 0x673718, 0x603518, 0x5c3316, 0x583015, 0x573015, 0x562f14, 0x5a351c, 0x5f3a24, 0x532d15, 0x572d13, 0x5c351b, 0x5b3719, 0x5f3619, 0x61371a, 0x61391b, 0x5f3819, 0x5e3718, 0x5d3618, 0x5f3417, 0x62381a, 0x653c1c, 0x693a17, 0x78431d, 0x764320, 0x764524, 0x6f3e1f, 0x6a3a1b, 0x693b1a, 0x7a4d2e, 0x7d4924, 0x8d5129, 0x894c25, 0x7c451f, 0x723f1a, 0x77411b, 0x86491d, 0x9a6037, 0x743f1d, 0x633619, 0x5b3318, 0x563116, 0x502d13, 0x4a2b13, 0x482913, 0x452712, 0x43250f, 0x512e1a, 0x512c18, 0x472812, 0x492912, 0x623d27, 0x562f16, 0x472711, 0x38200d, 0x321d0c, 0x2d1a0c, 0x27170b, 0x25160a, 0x23150a, 0x211309, 0x201208, 0x22140a, 0x25150b, 0x27180c, 0x2b1907, 0x2e1203, 0x291409, 0x23130a, 0x211208, 0x201208, 0x22140a, 0x25140a, 0x281609, 0x28160a, 0x261609, 0x221407, 0x1e1106, 0x1a0f05, 0x170d04, 0x150c03, 0x140a04, 0x140c04, 0x120b03, 0x110a03, 0x110a04, 0x100905, 0x0f0905, 0x0e0804, 0x0e0804, 0x0e0704, 0x0c0703, 0x0b0602, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0602, 0x090602, 0x090502, 0x080502, 0x060601, 0x050601, 0x050400, 0x070300, 0x070300, 0x050400, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x010100, 0x010100, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x020200, 0x020201, 0x030301, 0x030301, 0x030400, 0x030400, 0x040400, 0x050400, 0x040400, 0x030400, 0x040300, 0x050400, 0x050400, 0x060500, 0x080601, 0x090602, 0x0a0701, 0x0c0703, 0x0d0803, 0x100a04, 0x110a02, 0x120b03, 0x140b04, 0x150c04, 0x190e05, 0x1c0f06, 0x1f1107, 0x221208, 0x251408, 0x271507, 0x2a1709, 0x2f190b, 0x341c0e, 0x381e10, 0x351c0d, 0x321b0c, 0x2f1a0c, 0x2e190b, 0x2b1809, 0x2a1809, 0x291708, 0x271508, 0x271508, 0x271508, 0x271508, 0x261509, 0x261409, 0x251309, 0x251309, 0x241309, 0x241309, 0x241309, 0x241309, 0x25130a, 0x251209, 0x261307, 0x28160b, 0x26170d, 0x27160c, 0x28170b, 0x29180c, 0x29190b, 0x2b1b0c, 0x2e1b0d, 0x331c0d, 0x3f220f, 0x522a13, 0x6b371b, 0x6e3a1e, 0x552c15, 0x452713, 0x3c1f0b, 0x3e2516, 0x392012, 0x3e2312, 0x4c2e1a, 0x422715, 0x3e2310, 0x482a18, 0x4c2d1b, 0x472712, 0x4d2b15, 0x572f17, 0x63351b, 0x68391c, 0x64381b, 0x5a3217, 0x532f16, 0x502e15, 0x4c2b14, 0x4a2b15, 0x4a2a14, 0x4c2c17, 0x4c2c17, 0x58371e, 0x74523a, 0x502a0e, 0x502e16, 0x532e19, 0x542f18, 0x542f17, 0x522e16, 0x532f17, 0x543016, 0x6c462e, 0x5b3319, 0x5a3214, 0x6f4124, 0x7b4b2a, 0x693d1c, 0x5c3315, 0x5c3317, 0x62371d, 0x5e3419, 0x7a5137, 0x714020, 0x81451f, 0x8a4d23, 0x79431e, 0x6c3c1b, 0x743f1a, 0x8f552e, 0x7b411a, 0x6b391a, 0x5d3318, 0x563017, 0x502d14, 0x4a2a12, 0x452912, 0x412612, 0x3d2410, 0x3e2310, 0x4d2d1d, 0x442513, 0x422712, 0x472712, 0x5f3824, 0x623823, 0x603d28, 0x381d0a, 0x2f1b0b, 0x2a190c, 0x24150a, 0x221409, 0x21140a, 0x20120a, 0x201209, 0x21130a, 0x24130c, 0x25120b, 0x21130a, 0x20120a, 0x201308, 0x201107, 0x1e1008, 0x1e1108, 0x201209, 0x221109, 0x241309, 0x27150b, 0x26150a, 0x221408, 0x1f1107, 0x1a0e06, 0x160c04, 0x140b04, 0x150b04, 0x130c04, 0x110a03, 0x110a04, 0x110a04, 0x0f0905, 0x0e0905, 0x0d0804, 0x0c0803, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0501, 0x0a0602, 0x090601, 0x090502, 0x080401, 0x070501, 0x050501, 0x050601, 0x070401, 0x080300, 0x060300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x010100, 0x010100, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x020201, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020201, 0x030300, 0x030400, 0x030400, 0x030300, 0x050400, 0x040500, 0x030400, 0x030400, 0x040500, 0x050500, 0x060500, 0x070601, 0x090601, 0x0a0701, 0x0c0703, 0x0c0703, 0x0e0905, 0x100902, 0x110a02, 0x130b04, 0x160c04, 0x180d04, 0x1c0f06, 0x1e1007, 0x211108, 0x241308, 0x261407, 0x281608, 0x2d190b, 0x311b0d, 0x321b0d, 0x2f1a0b, 0x2c190a, 0x2a180a, 0x281608, 0x281509, 0x271509, 0x251408, 0x241309, 0x241309, 0x241309, 0x231208, 0x231208, 0x231208, 0x231209, 0x221109, 0x221109, 0x221109, 0x24120a, 0x23120a, 0x231005, 0x342014, 0x362114, 0x261306, 0x24150b, 0x26140d, 0x27150d, 0x28160b, 0x28160a, 0x28180a, 0x2c180b, 0x372012, 0x402412, 0x522a13, 0x68371c, 0x603218, 0x492714, 0x3e2413, 0x3b210f, 0x392113, 0x352013, 0x351f10, 0x3b2210, 0x382112, 0x361c0a, 0x523829, 0x5a3e2f, 0x40200b, 0x472713, 0x502b16, 0x5a3019, 0x60351b, 0x593218, 0x4e2c14, 0x482a14, 0x452914, 0x432712, 0x422511, 0x422513, 0x422513, 0x412511, 0x4b2d17, 0x64432f, 0x492711, 0x4a2b16, 0x4a2915, 0x472813, 0x472813, 0x482813, 0x50301c, 0x4d2c14, 0x583620, 0x502d17, 0x512d13, 0x6e4329, 0x73482d, 0x5d351b, 0x532f17, 0x57331a, 0x5e371e, 0x58331b, 0x542f14, 0x5e3011, 0x854f2c, 0x985f37, 0x683613, 0x65381d, 0x703c19, 0x89502c, 0x794220, 0x68391d, 0x583018, 0x502c14, 0x4a2914, 0x442711, 0x412610, 0x3f2310, 0x3c220f, 0x3c210f, 0x3b1e0f, 0x3b2311, 0x422512, 0x462611, 0x45230d, 0x46220e, 0x41220f, 0x38200d, 0x2e1b0c, 0x28180b, 0x201309, 0x201209, 0x201209, 0x1f1209, 0x1f1209, 0x1f1108, 0x201208, 0x211108, 0x21100b, 0x201307, 0x211308, 0x211008, 0x1d0f06, 0x1d0f06, 0x1e1008, 0x201108, 0x221109, 0x25130a, 0x25140a, 0x221409, 0x1f1107, 0x1a0e06, 0x160d04, 0x140b04, 0x130a04, 0x120a03, 0x110a04, 0x110a04, 0x110a04, 0x0f0904, 0x0d0804, 0x0c0703, 0x0c0703, 0x0c0703, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0602, 0x0a0702, 0x090601, 0x080501, 0x060501, 0x060501, 0x050501, 0x040400, 0x060300, 0x070301, 0x060301, 0x040301, 0x040301, 0x040301, 0x040300, 0x030300, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x010100, 0x010100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020100, 0x020100, 0x010100, 0x020200, 0x030300, 0x030300, 0x040301, 0x030200, 0x040301, 0x040500, 0x040500, 0x040400, 0x040301, 0x050501, 0x050400, 0x080501, 0x090601, 0x090701, 0x0a0701, 0x0b0703, 0x0d0805, 0x0f0804, 0x120a03, 0x130a03, 0x160c04, 0x190d04, 0x1b0e06, 0x1e1007, 0x201007, 0x231207, 0x261406, 0x281507, 0x2b1809, 0x2d190a, 0x2b1809, 0x291608, 0x271507, 0x261508, 0x241407, 0x241308, 0x241309, 0x221308, 0x211208, 0x201107, 0x201108, 0x201108, 0x1f1108, 0x1e1007, 0x1e1007, 0x1f1008, 0x1f0f08, 0x201108, 0x201107, 0x1f1008, 0x1e0900, 0x4b372a, 0x463326, 0x210f01, 0x251309, 0x25140a, 0x27150d, 0x27150d, 0x27160a, 0x28180a, 0x2e180b, 0x3d271a, 0x422817, 0x522913, 0x603219, 0x512a12, 0x402210, 0x391f11, 0x371e0e, 0x362012, 0x331d12, 0x311c0e, 0x301c0e, 0x331e11, 0x331e12, 0x321705, 0x371a06, 0x3d2212, 0x412512, 0x4a2714, 0x522c17, 0x552f16, 0x502c15, 0x482813, 0x422513, 0x3e2412, 0x3d2310, 0x3c2110, 0x3b2110, 0x3c2312, 0x3c2310, 0x3c2312, 0x3b1f0f, 0x3e2313, 0x422816, 0x412514, 0x3f2412, 0x3f2412, 0x432816, 0x3e2411, 0x422512, 0x4f2f19, 0x44230d, 0x5a371e, 0x59311b, 0x522b17, 0x4b2713, 0x4c2a16, 0x4c2b17, 0x4f2b17, 0x4d2c17, 0x4e2d18, 0x5b341b, 0x693b1a, 0x693916, 0x603517, 0x5e3318, 0x67381a, 0x693815, 0x6b3a1b, 0x64381d, 0x552e17, 0x492713, 0x432711, 0x3f2410, 0x3e230d, 0x3c200e, 0x39200f, 0x381f0e, 0x381f10, 0x382010, 0x3c200e, 0x42240f, 0x4c2f1c, 0x402411, 0x3b220f, 0x351f0d, 0x2c190b, 0x2b180c, 0x382010, 0x251208, 0x1e1109, 0x1e1108, 0x1e1108, 0x201008, 0x1f1007, 0x1d1007, 0x20110a, 0x24150b, 0x27160d, 0x20110a, 0x1c0f06, 0x1b0e06, 0x1b1007, 0x1d1007, 0x1f1008, 0x211109, 0x231309, 0x231309, 0x1f1007, 0x1b0e05, 0x170c04, 0x150b03, 0x130a03, 0x120a04, 0x110905, 0x110905, 0x100804, 0x0d0704, 0x0d0804, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0702, 0x0a0702, 0x0a0602, 0x0b0603, 0x0a0602, 0x070601, 0x060701, 0x060601, 0x080501, 0x070401, 0x070401, 0x060300, 0x070300, 0x060300, 0x050301, 0x040300, 0x040300, 0x040300, 0x050200, 0x040200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010200, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030300, 0x040401, 0x050401, 0x040301, 0x050401, 0x050400, 0x070400, 0x090601, 0x090701, 0x0a0701, 0x0a0702, 0x0d0704, 0x0f0704, 0x120a04, 0x130a03, 0x150c04, 0x170c04, 0x1a0d05, 0x1c0f06, 0x1e1007, 0x221207, 0x251307, 0x271507, 0x281607, 0x271507, 0x261506, 0x251406, 0x241407, 0x221206, 0x211106, 0x201107, 0x1f1107, 0x1f1207, 0x1f1107, 0x1e1007, 0x1e1007, 0x1d1007, 0x1c0f07, 0x1c0f07, 0x1b0f06, 0x1c0f06, 0x1d0f07, 0x1d1007, 0x1d1006, 0x1e1108, 0x1e1106, 0x1e0d02, 0x1e0e03, 0x1f1409, 0x22130b, 0x221309, 0x27160e, 0x26140c, 0x251509, 0x28170a, 0x2e190c, 0x321b0b, 0x3e220d, 0x5a3019, 0x592f19, 0x44230f, 0x391f0e, 0x331c0f, 0x301b0d, 0x2e1b0e, 0x2f1910, 0x2d1a0c, 0x2c1a0d, 0x2d1a0d, 0x291404, 0x563d2d, 0x533929, 0x341a08, 0x3d2210, 0x462512, 0x4e2915, 0x502a13, 0x492712, 0x422411, 0x3c2210, 0x3a2010, 0x39200f, 0x372011, 0x351f10, 0x361f10, 0x362011, 0x372112, 0x372112, 0x362011, 0x361f11, 0x392112, 0x392312, 0x3b2212, 0x402616, 0x3a2110, 0x3b2213, 0x4a2b16, 0x775339, 0x583218, 0x472715, 0x442411, 0x4b2c19, 0x482916, 0x432613, 0x482915, 0x482815, 0x482916, 0x542f17, 0x61371b, 0x5c3218, 0x583016, 0x582f16, 0x5e331a, 0x5f3317, 0x63371a, 0x61361b, 0x532c15, 0x452511, 0x3f2211, 0x3b2111, 0x391e0a, 0x351d09, 0x341f0e, 0x341f0d, 0x341f0e, 0x361e0e, 0x381e0e, 0x3b200e, 0x3d210f, 0x3d210e, 0x3b200f, 0x351d0c, 0x2b190b, 0x2d1a0d, 0x432a19, 0x271409, 0x1e1109, 0x1f1108, 0x1e1007, 0x1d0f07, 0x1c0f07, 0x190e06, 0x1b0f06, 0x21140b, 0x1f1108, 0x1c0e06, 0x1a0d05, 0x180d04, 0x180e05, 0x190f06, 0x1c0f06, 0x1d1007, 0x1f1208, 0x211208, 0x1f1007, 0x1b0d05, 0x180c03, 0x140b04, 0x130a03, 0x120904, 0x110906, 0x100805, 0x0f0704, 0x0d0702, 0x0c0703, 0x0c0703, 0x0b0602, 0x0a0602, 0x0a0702, 0x090701, 0x090601, 0x090502, 0x080501, 0x050500, 0x040600, 0x050500, 0x080400, 0x070300, 0x070300, 0x070300, 0x070300, 0x050300, 0x040300, 0x030200, 0x040300, 0x040300, 0x040100, 0x030200, 0x030200, 0x020100, 0x030200, 0x030200, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000100, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020100, 0x020100, 0x030200, 0x040301, 0x030201, 0x030200, 0x020200, 0x030301, 0x050401, 0x040300, 0x040400, 0x050400, 0x070400, 0x080500, 0x090601, 0x0a0701, 0x0a0702, 0x0d0704, 0x0f0805, 0x120a04, 0x130a03, 0x150c05, 0x160b04, 0x180c03, 0x1c0e05, 0x1e1007, 0x211209, 0x231208, 0x251408, 0x251406, 0x241307, 0x231207, 0x221206, 0x201207, 0x1e1006, 0x1e1006, 0x1d1007, 0x1d1007, 0x1b0f06, 0x1b0f06, 0x1a0e05, 0x190d05, 0x1a0d06, 0x1a0d06, 0x1a0d06, 0x1a0d06, 0x1a0d06, 0x1b0e06, 0x1b0e06, 0x1c0f06, 0x1d0f07, 0x1b1007, 0x1d1108, 0x1e1107, 0x1d1208, 0x211109, 0x211209, 0x22120a, 0x24140b, 0x241408, 0x281709, 0x2d190b, 0x351c0b, 0x46240e, 0x5d341d, 0x4e2b18, 0x391e0d, 0x311c0d, 0x2d1a0e, 0x2c190c, 0x2c190c, 0x2c190e, 0x240e00, 0x271509, 0x27170b, 0x291709, 0x42291b, 0x41281a, 0x30190c, 0x381e0e, 0x43220f, 0x542f1c, 0x4f2a16, 0x42230f, 0x3a1f0e, 0x371e0f, 0x361f10, 0x351e10, 0x331d10, 0x311c0f, 0x301b0e, 0x2f1c0e, 0x2f1d0e, 0x301d0f, 0x301d0f, 0x301d0e, 0x311d0e, 0x311e10, 0x331e0f, 0x331c0d, 0x371d0f, 0x351f0f, 0x4d3423, 0x99795c, 0x41220d, 0x361f0f, 0x3d2310, 0x432917, 0x422715, 0x3f2412, 0x412512, 0x422513, 0x442815, 0x4c2a14, 0x553015, 0x583016, 0x522c13, 0x552f17, 0x562f16, 0x573016, 0x5d3319, 0x5f341b, 0x522d16, 0x442511, 0x3c2110, 0x371d0c, 0x4a2c1c, 0x503322, 0x341b09, 0x311c0c, 0x321d0c, 0x331e0e, 0x341d0e, 0x351e0f, 0x371e0f, 0x3a1f0f, 0x3a1e10, 0x331c0d, 0x2c1b0c, 0x29170a, 0x251103, 0x211208, 0x211109, 0x201008, 0x1d0f07, 0x1b0f07, 0x180f06, 0x170e05, 0x170d05, 0x180e05, 0x170c03, 0x180c04, 0x170d04, 0x160c03, 0x160c03, 0x160c03, 0x180d04, 0x190d04, 0x1a0d05, 0x1c0f06, 0x1d0f07, 0x1a0e05, 0x160c04, 0x140b04, 0x130a03, 0x120904, 0x100805, 0x0e0704, 0x0d0804, 0x0c0803, 0x0a0602, 0x0b0602, 0x0b0602, 0x0a0501, 0x090601, 0x090601, 0x080601, 0x070401, 0x060501, 0x060501, 0x040500, 0x050400, 0x070300, 0x060301, 0x060301, 0x060301, 0x050200, 0x050300, 0x030200, 0x030200, 0x040300, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x020100, 0x030200, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010200, 0x010100, 0x010100, 0x020000, 0x020100, 0x030200, 0x030200, 0x040301, 0x040301, 0x020200, 0x030301, 0x050400, 0x040300, 0x040400, 0x040400, 0x060300, 0x080401, 0x080601, 0x090701, 0x0b0803, 0x0c0704, 0x100805, 0x110a04, 0x120b04, 0x140a03, 0x140a04, 0x160a04, 0x190c05, 0x1d0f06, 0x1f1007, 0x221008, 0x231208, 0x221308, 0x211308, 0x201208, 0x1e1108, 0x1c0f06, 0x1c0f06, 0x1a0e05, 0x190e06, 0x190e06, 0x170e05, 0x160c04, 0x160c05, 0x160c05, 0x160b05, 0x160a05, 0x160a05, 0x160a05, 0x160b05, 0x170d04, 0x180d06, 0x180d06, 0x190e05, 0x1a1006, 0x211309, 0x1f1106, 0x1c1105, 0x1e0f06, 0x1f0f08, 0x1f110a, 0x21130a, 0x231307, 0x291509, 0x2f1a0c, 0x3a1e0e, 0x4d2614, 0x4e2813, 0x3e200f, 0x321b0c, 0x2a180b, 0x28180b, 0x28170a, 0x29180c, 0x271203, 0x554538, 0x3a291e, 0x372417, 0x2b1b0f, 0x28160a, 0x2a1609, 0x2d1a0e, 0x351d0f, 0x3f210f, 0x4a2815, 0x472512, 0x3c200f, 0x351e0d, 0x321d0f, 0x321c0f, 0x311c0f, 0x2e1a0f, 0x2d190e, 0x311f13, 0x352419, 0x29180c, 0x2b1a0e, 0x2c1a0e, 0x2c1a0e, 0x2b190d, 0x2c1b0e, 0x2c1a0d, 0x2d190a, 0x463227, 0x351f12, 0x2e190c, 0x1f0400, 0x311c10, 0x341e10, 0x362010, 0x361f0f, 0x391f0f, 0x3c2111, 0x3f2312, 0x3f2412, 0x3f2412, 0x442612, 0x4f2c16, 0x542f14, 0x4f2b11, 0x4d2b13, 0x522e16, 0x56331c, 0x562f18, 0x5b3219, 0x522d16, 0x422411, 0x38210e, 0x331a08, 0x4c3020, 0x563829, 0x321606, 0x2f1a0c, 0x301a0a, 0x30190a, 0x311b0e, 0x311d0f, 0x341e0f, 0x371e0f, 0x391f11, 0x341d0f, 0x2e1a0c, 0x2a170b, 0x231208, 0x201209, 0x201109, 0x1e1008, 0x1b0e06, 0x180d05, 0x170d05, 0x160c04, 0x160c05, 0x160b04, 0x150a04, 0x170c06, 0x190f08, 0x160b05, 0x150c04, 0x150c05, 0x150c05, 0x160c04, 0x170c04, 0x170c04, 0x180e05, 0x180e05, 0x160c04, 0x140a04, 0x130a04, 0x110903, 0x100805, 0x0d0804, 0x0c0803, 0x0b0702, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0601, 0x090601, 0x070500, 0x050400, 0x050501, 0x060501, 0x050400, 0x070400, 0x070301, 0x050301, 0x040301, 0x030301, 0x030200, 0x040301, 0x030200, 0x030200, 0x030200, 0x020100, 0x020100, 0x030200, 0x020200, 0x020200, 0x020200, 0x020100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000200, 0x010100, 0x020100, 0x020100, 0x030100, 0x020100, 0x020100, 0x030200, 0x040301, 0x030202, 0x020200, 0x030200, 0x050400, 0x040400, 0x040400, 0x070401, 0x080401, 0x080501, 0x090601, 0x0b0803, 0x0c0704, 0x0f0704, 0x110904, 0x120b05, 0x130a04, 0x150b04, 0x160b05, 0x190d05, 0x1b0d06, 0x1d0e06, 0x1f0f06, 0x201008, 0x1e1108, 0x1e1007, 0x1c1007, 0x1b0f07, 0x190e05, 0x180d05, 0x160c04, 0x150b04, 0x150b04, 0x140b04, 0x130a03, 0x140b04, 0x140b05, 0x140a04, 0x140a03, 0x150a04, 0x150a04, 0x160b05, 0x160c04, 0x160b05, 0x170c06, 0x170d04, 0x180f06, 0x1a0e05, 0x1a0e06, 0x190f07, 0x1b0e08, 0x1c0e06, 0x1d1008, 0x1f1109, 0x231207, 0x2a1509, 0x31190b, 0x3f2010, 0x502818, 0x482513, 0x3d2213, 0x2f1a0b, 0x271609, 0x251509, 0x251508, 0x27160a, 0x251001, 0x4f3e31, 0x3c291c, 0x4c3525, 0x2d1b0e, 0x27170d, 0x29170a, 0x2c190c, 0x341c0f, 0x3d200f, 0x432410, 0x3e220e, 0x371e0e, 0x311b0c, 0x2d190d, 0x2d190e, 0x2d180d, 0x2c190c, 0x2a180c, 0x2b1a0e, 0x2b1a0e, 0x28170c, 0x28170d, 0x29170d, 0x2a180e, 0x2a180e, 0x2a180d, 0x29180d, 0x2c1a0d, 0x2e190d, 0x2c190e, 0x2f1c0e, 0x321c11, 0x311b0d, 0x311c10, 0x331e11, 0x341e10, 0x382011, 0x391e0f, 0x3e2313, 0x3c2110, 0x3d2110, 0x41210f, 0x492713, 0x4f2b14, 0x4a2712, 0x452512, 0x472613, 0x482814, 0x4f2b15, 0x572f17, 0x502c15, 0x412311, 0x391e11, 0x341d10, 0x2f1707, 0x291404, 0x2c1a0d, 0x30180b, 0x3a2012, 0x402719, 0x2e180b, 0x2e1a0c, 0x311c0d, 0x341d0e, 0x351e0e, 0x331d0e, 0x2f190b, 0x2a160a, 0x22120a, 0x201109, 0x1e1008, 0x1c0f07, 0x1a0d05, 0x190c05, 0x180c05, 0x160c04, 0x150a04, 0x140903, 0x150a05, 0x150a05, 0x150a04, 0x140a04, 0x140b04, 0x140b04, 0x140b04, 0x140b04, 0x150c04, 0x150c03, 0x160c03, 0x160c03, 0x150b04, 0x130a04, 0x130a04, 0x120903, 0x100805, 0x0d0804, 0x0b0802, 0x0b0702, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0601, 0x090501, 0x080500, 0x060500, 0x050501, 0x050400, 0x050400, 0x060300, 0x070401, 0x070401, 0x040301, 0x040301, 0x040300, 0x040301, 0x040301, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x010100, 0x010100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x000000, 0x000000, 0x010100, 0x020100, 0x020100, 0x030200, 0x020100, 0x030200, 0x030101, 0x020100, 0x030200, 0x040300, 0x040400, 0x040400, 0x060501, 0x070300, 0x080401, 0x090601, 0x0a0702, 0x0b0703, 0x0e0704, 0x110804, 0x120902, 0x130a03, 0x140a03, 0x150a04, 0x170c04, 0x180e05, 0x1b0f06, 0x1c0e05, 0x1c0e05, 0x1a0d05, 0x190e05, 0x180e05, 0x170d04, 0x160c03, 0x150a04, 0x130a03, 0x130a03, 0x130a04, 0x130a03, 0x130a03, 0x130a03, 0x130a03, 0x120a04, 0x130c05, 0x140b04, 0x150a04, 0x150a04, 0x150c05, 0x150b05, 0x160b05, 0x160b05, 0x170c05, 0x170d04, 0x170d04, 0x180d05, 0x1a0e06, 0x1a0e06, 0x1c0f07, 0x1e0f08, 0x221108, 0x28150a, 0x32180a, 0x42200e, 0x4c2815, 0x41220f, 0x3c2313, 0x2d180b, 0x25140a, 0x231409, 0x221307, 0x251409, 0x261509, 0x1f0c00, 0x251405, 0x251306, 0x27160a, 0x28160a, 0x28160b, 0x2a180c, 0x311b0d, 0x3e1f10, 0x412110, 0x391e0e, 0x321c0e, 0x2d180b, 0x2a170b, 0x29170d, 0x28170d, 0x28170c, 0x29170c, 0x29170d, 0x27160e, 0x25170c, 0x25160b, 0x26160c, 0x27150c, 0x28160c, 0x28180b, 0x29180e, 0x2e1a11, 0x2a1609, 0x2b180a, 0x2d1a0c, 0x301d10, 0x301a0f, 0x2e190d, 0x2e1b0e, 0x311c0e, 0x321c0d, 0x361f0f, 0x381e0e, 0x391f0f, 0x3b2210, 0x3c1e0c, 0x4c2917, 0x4d2915, 0x462512, 0x3e210f, 0x402312, 0x432614, 0x4a2914, 0x522c15, 0x4f2b16, 0x422212, 0x391e0f, 0x321b0d, 0x2e1a0c, 0x2b180a, 0x2b180b, 0x2c1608, 0x412514, 0x4a3020, 0x271307, 0x2a180c, 0x2c190c, 0x311c0e, 0x341d0f, 0x331c0e, 0x2f190c, 0x2a160a, 0x231209, 0x1f1108, 0x1c0f06, 0x1b0e06, 0x1a0d05, 0x180d04, 0x160b03, 0x150a04, 0x140903, 0x150a04, 0x150a04, 0x140a04, 0x140b04, 0x140b04, 0x130c04, 0x130b04, 0x140b04, 0x120b03, 0x130b04, 0x140a04, 0x150b04, 0x140b04, 0x140b04, 0x130a04, 0x130a03, 0x120903, 0x100805, 0x0e0704, 0x0b0602, 0x0b0602, 0x0b0602, 0x0a0602, 0x090601, 0x090601, 0x070501, 0x060500, 0x050400, 0x050400, 0x060301, 0x070202, 0x060302, 0x040301, 0x040301, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x030200, 0x020100, 0x020100, 0x020100, 0x030200, 0x030200, 0x020100, 0x000000, 0x010100, 0x010100, 0x000000, 0x000000, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x020200, 0x020100, 0x020100, 0x010100, 0x020100, 0x030300, 0x030300, 0x030300, 0x040400, 0x040300, 0x040300, 0x060400, 0x070300, 0x080401, 0x090601, 0x0a0702, 0x0b0703, 0x0c0603, 0x0f0804, 0x110902, 0x130a03, 0x140a03, 0x140a04, 0x160c04, 0x170d04, 0x180d04, 0x190c03, 0x190c03, 0x170d04, 0x160c03, 0x150b03, 0x140b04, 0x140b04, 0x120a03, 0x120a03, 0x110a04, 0x110904, 0x110903, 0x110903, 0x120a04, 0x120a04, 0x120a05, 0x130c06, 0x130b04, 0x140a04, 0x150a04, 0x140b04, 0x140b04, 0x150a04, 0x160a05, 0x150b04, 0x150c04, 0x160b04, 0x160b04, 0x160c04, 0x180e05, 0x1b0e06, 0x1d0e07, 0x201007, 0x281509, 0x341a0c, 0x432310, 0x452511, 0x381d0c, 0x2a1607, 0x241408, 0x22130a, 0x201208, 0x201209, 0x22140a, 0x24140a, 0x25140a, 0x26140a, 0x27140b, 0x27150c, 0x27150b, 0x27160c, 0x28170c, 0x311a0c, 0x3b1d0f, 0x3e2011, 0x361c0d, 0x2d180b, 0x29160a, 0x271509, 0x27150b, 0x26150b, 0x27150b, 0x261407, 0x27150a, 0x25160c, 0x23160b, 0x23150a, 0x24150a, 0x25140a, 0x28160c, 0x26160b, 0x26150b, 0x241205, 0x38291e, 0x4e3f34, 0x210c00, 0x281509, 0x29160a, 0x2b170b, 0x2c190b, 0x2d1a0c, 0x2f190b, 0x341d0e, 0x351c0e, 0x361d0f, 0x362010, 0x371e0e, 0x3e2111, 0x462513, 0x432311, 0x402110, 0x422311, 0x412411, 0x452712, 0x4f2b15, 0x4e2a16, 0x422210, 0x381c0e, 0x311a0c, 0x2c180b, 0x2a170a, 0x29160a, 0x27160a, 0x271408, 0x251307, 0x261509, 0x28160a, 0x2a170b, 0x2d190c, 0x311b0d, 0x321b0d, 0x2f190c, 0x2a160a, 0x241209, 0x1f1108, 0x1c0f06, 0x1b0e06, 0x190c04, 0x160b04, 0x150a04, 0x140a03, 0x140903, 0x140903, 0x140a03, 0x130a03, 0x130a03, 0x130b04, 0x120b03, 0x120a02, 0x120a03, 0x120b03, 0x120b03, 0x130a03, 0x140a03, 0x140b04, 0x140b04, 0x130a03, 0x120902, 0x120903, 0x100805, 0x0d0603, 0x0b0602, 0x0b0601, 0x0a0702, 0x090601, 0x090601, 0x080601, 0x060500, 0x060500, 0x050400, 0x040300, 0x050200, 0x070301, 0x050301, 0x030300, 0x030300, 0x030300, 0x030200, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x020100, 0x030200, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010200, 0x030300, 0x030400, 0x030400, 0x030300, 0x040300, 0x070300, 0x080401, 0x090401, 0x090501, 0x0a0702, 0x0b0703, 0x0d0704, 0x0f0804, 0x110a05, 0x120a05, 0x130a04, 0x130a03, 0x150b04, 0x150c04, 0x150c03, 0x160b03, 0x160b02, 0x150c03, 0x140b02, 0x130a03, 0x130b03, 0x120b04, 0x100a03, 0x100a04, 0x0e0904, 0x0e0904, 0x0f0903, 0x0f0903, 0x100904, 0x100a05, 0x110a05, 0x110a04, 0x120b04, 0x130b04, 0x130b04, 0x130a03, 0x140b04, 0x140b04, 0x150b05, 0x140a04, 0x140b04, 0x150b05, 0x170c06, 0x160b05, 0x180e05, 0x190d05, 0x1d0f07, 0x201107, 0x28150a, 0x361c0e, 0x422312, 0x3f210f, 0x30190a, 0x261609, 0x211308, 0x1e1109, 0x1d1008, 0x1f1109, 0x1e1209, 0x20120a, 0x22120a, 0x23120a, 0x25130b, 0x26130c, 0x27150b, 0x27160b, 0x2a180c, 0x321a0d, 0x381d10, 0x391e11, 0x331c0e, 0x2a170b, 0x27150a, 0x26150a, 0x25140a, 0x25140a, 0x271509, 0x301f13, 0x2a190c, 0x221509, 0x21150a, 0x211509, 0x211308, 0x241309, 0x26160c, 0x22140a, 0x22130a, 0x231308, 0x26170a, 0x28190f, 0x241309, 0x26150a, 0x29180b, 0x2a180c, 0x2b190b, 0x2c190b, 0x2f190c, 0x2f190b, 0x331b0e, 0x331c10, 0x331d0f, 0x321c0e, 0x361e0f, 0x3e2212, 0x402312, 0x4a2c1b, 0x442514, 0x3e2210, 0x422511, 0x4a2914, 0x4b2a15, 0x432310, 0x381d0e, 0x31190b, 0x2b170b, 0x28160a, 0x271409, 0x25130a, 0x23130c, 0x24140c, 0x251308, 0x251408, 0x27160a, 0x2b180b, 0x2f190c, 0x301a0c, 0x2f180b, 0x2a1509, 0x24130a, 0x1f1008, 0x1c0e06, 0x1a0e06, 0x170c05, 0x150a05, 0x140a03, 0x130a04, 0x130a04, 0x130a03, 0x130a03, 0x120a04, 0x110a04, 0x110a04, 0x110a04, 0x100a04, 0x110a04, 0x0f0a04, 0x100a03, 0x120904, 0x130a03, 0x140a03, 0x140b04, 0x130a03, 0x130a03, 0x120903, 0x0f0704, 0x0d0603, 0x0b0602, 0x0a0601, 0x090601, 0x0a0702, 0x070601, 0x060500, 0x050400, 0x050400, 0x050400, 0x040300, 0x040200, 0x050300, 0x040300, 0x040300, 0x040300, 0x040301, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x010100, 0x010100, 0x000000, 0x010100, 0x010100, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030301, 0x030400, 0x030300, 0x050300, 0x070300, 0x080401, 0x090401, 0x090601, 0x0a0702, 0x0b0702, 0x0d0603, 0x0e0603, 0x0f0704, 0x110a05, 0x130a04, 0x120902, 0x130a04, 0x140b04, 0x140a02, 0x130a01, 0x140b02, 0x130a02, 0x120a02, 0x120a03, 0x110a02, 0x0f0903, 0x0d0803, 0x0c0804, 0x0c0904, 0x0c0904, 0x0d0804, 0x0d0804, 0x0c0804, 0x0e0905, 0x0f0904, 0x100903, 0x110a04, 0x110a04, 0x120b03, 0x120b03, 0x130a03, 0x140b04, 0x140b04, 0x130a03, 0x140b04, 0x140b04, 0x150b05, 0x150a04, 0x160c04, 0x180d05, 0x1b0e06, 0x1f1006, 0x281509, 0x371c0e, 0x3e1f0e, 0x361c0a, 0x2a1708, 0x241308, 0x201207, 0x1d1106, 0x1c0f06, 0x1d1008, 0x1e1008, 0x1e1108, 0x1e1108, 0x1f1208, 0x211208, 0x231309, 0x251308, 0x281408, 0x2d180a, 0x321a0d, 0x361b0f, 0x341a0e, 0x2f1a0c, 0x28160b, 0x25140a, 0x241309, 0x25140a, 0x241309, 0x1e0800, 0x5a493d, 0x3e2f25, 0x1d1003, 0x20140a, 0x21140a, 0x211309, 0x221209, 0x221209, 0x21120a, 0x20120a, 0x20120b, 0x20120a, 0x201209, 0x22130a, 0x23140a, 0x26150a, 0x27170a, 0x291709, 0x2d1a0c, 0x321e11, 0x2e180b, 0x2e190c, 0x2e1a0c, 0x301a0c, 0x311b0d, 0x351d10, 0x392110, 0x3d2210, 0x3a1f0c, 0x3a1f10, 0x3d2111, 0x412310, 0x452612, 0x472813, 0x41230f, 0x381d0c, 0x30190b, 0x29160b, 0x26140a, 0x25140a, 0x221308, 0x221309, 0x221308, 0x221308, 0x231309, 0x241408, 0x281608, 0x2b180a, 0x2e180a, 0x2e170a, 0x291409, 0x24130a, 0x1e1007, 0x190d04, 0x170c05, 0x160a05, 0x140a04, 0x130a03, 0x130a03, 0x130a03, 0x130a03, 0x130a03, 0x110a04, 0x110a04, 0x110a04, 0x100a04, 0x0f0a04, 0x110a04, 0x0e0903, 0x0f0903, 0x110903, 0x110903, 0x120a04, 0x120b05, 0x120a04, 0x120a03, 0x110803, 0x0f0704, 0x0d0603, 0x0c0702, 0x0a0601, 0x090601, 0x080601, 0x070601, 0x060500, 0x050400, 0x050400, 0x040300, 0x040301, 0x030301, 0x030201, 0x030201, 0x040301, 0x040301, 0x030200, 0x030200, 0x020100, 0x020100, 0x030200, 0x030200, 0x030200, 0x020100, 0x030200, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010100, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x030301, 0x030301, 0x030400, 0x040300, 0x060300, 0x080300, 0x080300, 0x090601, 0x090601, 0x0b0803, 0x0c0803, 0x0d0702, 0x0f0704, 0x100904, 0x120a03, 0x120902, 0x130a02, 0x130a01, 0x130a01, 0x120901, 0x120a02, 0x120a02, 0x110a03, 0x110a03, 0x100803, 0x0d0803, 0x0b0803, 0x0b0803, 0x0a0803, 0x0b0703, 0x0b0602, 0x0b0602, 0x0c0703, 0x0d0804, 0x0d0804, 0x0e0904, 0x0f0a05, 0x100904, 0x110a03, 0x100b02, 0x110b03, 0x120b03, 0x130b03, 0x120a03, 0x130a03, 0x140b04, 0x140b03, 0x150b03, 0x160c03, 0x180d04, 0x1b0e06, 0x201107, 0x2b160a, 0x381d0e, 0x381d0c, 0x2e1809, 0x241308, 0x201108, 0x1e1006, 0x1b0f05, 0x1a0f05, 0x1b0f06, 0x1c0f06, 0x1c0f06, 0x1e1007, 0x1e1107, 0x1f1206, 0x231207, 0x251309, 0x27150a, 0x2b180b, 0x311a0c, 0x351c0e, 0x311a0d, 0x2b180a, 0x26150b, 0x24130a, 0x221209, 0x23130b, 0x22130a, 0x221208, 0x201103, 0x201205, 0x211309, 0x1f120a, 0x1f1209, 0x1f1109, 0x1f1209, 0x201109, 0x1f1109, 0x1e110a, 0x1e110a, 0x1e110a, 0x20120a, 0x201208, 0x20130a, 0x22140b, 0x271609, 0x2a1809, 0x2a180a, 0x2b180c, 0x2c170a, 0x2a170a, 0x2a180a, 0x2c190b, 0x2e190b, 0x311b0d, 0x351d0d, 0x3c2110, 0x391e0d, 0x351b0d, 0x381f10, 0x3b1e0e, 0x402211, 0x442613, 0x3f230f, 0x371d0a, 0x2e190b, 0x29170a, 0x261409, 0x23140a, 0x201307, 0x1f1207, 0x1f1207, 0x1e1309, 0x1f1209, 0x221208, 0x251308, 0x291609, 0x2a160a, 0x2b1709, 0x281508, 0x231208, 0x1e1007, 0x1a0d05, 0x170c04, 0x150b04, 0x140903, 0x140a03, 0x130a03, 0x120a03, 0x120a04, 0x110903, 0x100a02, 0x100a03, 0x0f0902, 0x0e0903, 0x0d0802, 0x0d0803, 0x0d0804, 0x0d0703, 0x0e0803, 0x0f0803, 0x110a04, 0x110a05, 0x110a04, 0x110903, 0x100802, 0x0e0803, 0x0c0601, 0x0b0602, 0x0b0602, 0x090601, 0x070601, 0x070401, 0x070400, 0x050400, 0x040300, 0x040300, 0x040301, 0x040300, 0x040300, 0x040301, 0x040300, 0x040300, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x040301, 0x030200, 0x020100, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x010100, 0x010100, 0x020200, 0x030300, 0x030400, 0x030400, 0x050200, 0x080300, 0x080401, 0x080401, 0x090601, 0x0a0702, 0x0a0802, 0x0b0702, 0x0c0603, 0x0e0804, 0x100903, 0x110903, 0x110a01, 0x100a01, 0x100902, 0x0f0902, 0x100902, 0x0f0902, 0x0e0802, 0x0e0702, 0x0d0603, 0x0b0703, 0x0b0702, 0x0b0702, 0x0b0702, 0x0a0602, 0x0a0602, 0x0b0602, 0x0a0602, 0x0b0602, 0x0c0804, 0x0c0904, 0x0d0a05, 0x0e0904, 0x0f0903, 0x0f0a03, 0x0f0b03, 0x100a03, 0x110a03, 0x120b03, 0x120a03, 0x130a03, 0x140b04, 0x150c03, 0x160c03, 0x170d04, 0x1b0e06, 0x211107, 0x2d170a, 0x361d0e, 0x321b0b, 0x271506, 0x201108, 0x1d0f07, 0x1c0e05, 0x1a0e05, 0x180e04, 0x190e04, 0x1a0d04, 0x1b0e05, 0x1b0e05, 0x1d0f06, 0x1e1207, 0x201308, 0x231408, 0x231003, 0x2a1406, 0x311a0c, 0x331c0d, 0x2f1a0c, 0x28160a, 0x24130b, 0x22120a, 0x1f1108, 0x20110a, 0x20120a, 0x1f1209, 0x1e1209, 0x1e1209, 0x1f1108, 0x1e1008, 0x1d1008, 0x1d1008, 0x1e1109, 0x1e120a, 0x1d1008, 0x1d1008, 0x1d1008, 0x1e1109, 0x1d1008, 0x27160c, 0x28180d, 0x211209, 0x25150b, 0x26170c, 0x26170d, 0x27160d, 0x27160b, 0x27160a, 0x27160b, 0x271609, 0x291709, 0x2c190a, 0x331c0c, 0x391f10, 0x371c0d, 0x321a0c, 0x341d0f, 0x361c0e, 0x3b1f10, 0x3f2212, 0x3f2210, 0x361d0c, 0x2c190d, 0x28160b, 0x26150b, 0x21140b, 0x201308, 0x1e1108, 0x1e1108, 0x1e1108, 0x1d1007, 0x1f1108, 0x221208, 0x251308, 0x271409, 0x281509, 0x261508, 0x221207, 0x1e1007, 0x1b0d06, 0x170c03, 0x130b02, 0x130903, 0x140902, 0x120a03, 0x120b03, 0x110a04, 0x110a04, 0x0e0902, 0x0d0902, 0x0d0803, 0x0c0702, 0x0c0702, 0x0c0703, 0x0c0703, 0x0b0603, 0x0b0703, 0x0e0702, 0x100903, 0x100903, 0x100903, 0x100903, 0x0e0802, 0x0c0801, 0x0b0701, 0x0a0601, 0x0a0602, 0x090601, 0x070601, 0x070300, 0x070300, 0x050400, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030201, 0x020100, 0x030200, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020100, 0x030300, 0x030400, 0x040400, 0x040300, 0x060300, 0x080401, 0x080401, 0x080401, 0x090601, 0x0a0702, 0x0b0803, 0x0b0703, 0x0c0804, 0x0d0803, 0x0d0902, 0x0d0903, 0x0c0802, 0x0c0803, 0x0c0804, 0x0d0805, 0x0c0804, 0x0c0803, 0x0b0703, 0x0a0601, 0x0a0502, 0x0a0502, 0x0a0502, 0x0a0502, 0x0a0502, 0x0a0702, 0x0a0702, 0x0b0703, 0x0b0803, 0x0a0702, 0x0b0803, 0x0c0904, 0x0d0904, 0x0d0803, 0x0d0802, 0x0e0903, 0x0e0903, 0x0f0903, 0x100a04, 0x110a03, 0x110a02, 0x130a03, 0x150c04, 0x150b04, 0x160c05, 0x1b0e05, 0x231207, 0x2f190c, 0x331c0e, 0x2b1809, 0x211105, 0x1c0f05, 0x1a0e06, 0x190d05, 0x180e05, 0x180e05, 0x180e05, 0x180e05, 0x180e05, 0x1a0e05, 0x1b0e06, 0x1d0e07, 0x1d1008, 0x1d0f02, 0x422c20, 0x3e2418, 0x2e1809, 0x30190c, 0x2b170a, 0x251408, 0x22130a, 0x201209, 0x1e1108, 0x1e1109, 0x1e1108, 0x1e1108, 0x1e1108, 0x1e1008, 0x1c1007, 0x1c1007, 0x1d1008, 0x1d1008, 0x1d1008, 0x1d0f08, 0x1c0f07, 0x1c0f07, 0x1c0f07, 0x1c0f07, 0x160500, 0x49372e, 0x513e33, 0x1a0600, 0x21130b, 0x25140d, 0x26150d, 0x26150b, 0x281407, 0x27150a, 0x25140a, 0x26150a, 0x271509, 0x2a180a, 0x301a0c, 0x351d0e, 0x331c0d, 0x2f180b, 0x2f1a0d, 0x311a0d, 0x361c0e, 0x3b200f, 0x3d210f, 0x371d0d, 0x2d180c, 0x281305, 0x261307, 0x201309, 0x1e1408, 0x1c1007, 0x1c0f06, 0x1d0f06, 0x1b0f06, 0x1c0f06, 0x1e1007, 0x201107, 0x231308, 0x251408, 0x251408, 0x211207, 0x1d0f07, 0x1b0d06, 0x170c03, 0x140b02, 0x130a03, 0x130a03, 0x120b03, 0x110a03, 0x100904, 0x0e0804, 0x0d0804, 0x0c0703, 0x0c0703, 0x0c0703, 0x0b0603, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0c0703, 0x0c0703, 0x0d0803, 0x0d0803, 0x0d0802, 0x0c0701, 0x0a0602, 0x0a0702, 0x0a0702, 0x080601, 0x060500, 0x060400, 0x060300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x030200, 0x030200, 0x030200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020100, 0x030200, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030300, 0x030300, 0x040400, 0x040400, 0x040300, 0x070300, 0x080401, 0x090502, 0x090502, 0x090601, 0x0a0702, 0x0a0803, 0x0b0904, 0x0b0904, 0x0b0904, 0x0b0904, 0x0c0904, 0x0b0904, 0x0b0804, 0x0b0704, 0x0b0803, 0x0b0703, 0x090602, 0x090502, 0x090502, 0x0a0502, 0x090502, 0x090502, 0x0a0502, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0701, 0x0a0701, 0x0a0702, 0x0b0803, 0x0b0803, 0x0b0803, 0x0c0803, 0x0d0804, 0x0d0804, 0x0f0904, 0x110a04, 0x110a03, 0x110a02, 0x130a04, 0x150c05, 0x160c05, 0x1c0f06, 0x251408, 0x2f1a0c, 0x2d180b, 0x241407, 0x1c0f04, 0x190d05, 0x160c05, 0x160d05, 0x160d05, 0x160d06, 0x170e06, 0x180e05, 0x180f06, 0x180e05, 0x190e05, 0x1c0d06, 0x1f0e07, 0x1f0c03, 0x452e23, 0x3e251a, 0x2b1508, 0x2e180b, 0x281609, 0x231208, 0x1f1209, 0x1e1108, 0x1d1007, 0x1c1008, 0x1b1108, 0x1b1007, 0x1c0f07, 0x1c0f07, 0x1b1007, 0x1a1007, 0x1a0f07, 0x1a0f06, 0x1a0f06, 0x1a1007, 0x1a0f05, 0x190f05, 0x190f05, 0x190f05, 0x1d1009, 0x251107, 0x271407, 0x1f1108, 0x201209, 0x241209, 0x231209, 0x231205, 0x4c392e, 0x2e1d12, 0x21130a, 0x241409, 0x251409, 0x271609, 0x2b180a, 0x311b0d, 0x311b0d, 0x2c170a, 0x2c180b, 0x2f190b, 0x311b0d, 0x371e0e, 0x3b200f, 0x361c0a, 0x2a1100, 0x503b2e, 0x3f2c21, 0x1c0c01, 0x1c1207, 0x1a1006, 0x1b0f06, 0x1b0e05, 0x190f06, 0x190e05, 0x1b0f06, 0x1e1108, 0x201108, 0x221208, 0x221308, 0x201208, 0x1d1007, 0x1b0d05, 0x170c03, 0x140c02, 0x120b03, 0x120a03, 0x110a02, 0x100a03, 0x0e0904, 0x0c0703, 0x0b0703, 0x0b0702, 0x0a0702, 0x0a0703, 0x0b0703, 0x0a0702, 0x0b0702, 0x0b0703, 0x0b0703, 0x0a0702, 0x0b0703, 0x0b0803, 0x0b0703, 0x0b0803, 0x0c0702, 0x0b0702, 0x0a0702, 0x0a0702, 0x080601, 0x070601, 0x070500, 0x060400, 0x040300, 0x040301, 0x040301, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020100, 0x030300, 0x030300, 0x040300, 0x040500, 0x040400, 0x050300, 0x070300, 0x080401, 0x090502, 0x090501, 0x090601, 0x090702, 0x0a0803, 0x090803, 0x090904, 0x0b0804, 0x0c0703, 0x0b0702, 0x0a0602, 0x090502, 0x0a0702, 0x090501, 0x080402, 0x080403, 0x070301, 0x080401, 0x080401, 0x080401, 0x090602, 0x090601, 0x090602, 0x0a0702, 0x0a0702, 0x0a0802, 0x0b0801, 0x0a0802, 0x0a0703, 0x0a0702, 0x0a0702, 0x0a0702, 0x0c0703, 0x0c0703, 0x0d0702, 0x0f0802, 0x0f0903, 0x100a02, 0x120a02, 0x140b04, 0x160d05, 0x1d0f06, 0x271509, 0x2d190b, 0x291609, 0x1f1106, 0x180e04, 0x160c04, 0x150b05, 0x150c06, 0x150c05, 0x160d06, 0x170d06, 0x170d05, 0x160d05, 0x170e05, 0x190e05, 0x190f06, 0x1c0f07, 0x201008, 0x1e0d03, 0x231105, 0x2b170b, 0x2a1709, 0x261409, 0x211208, 0x1d1108, 0x1c0f06, 0x1c1006, 0x190f06, 0x180f06, 0x180e05, 0x1a0e06, 0x1b0e06, 0x180e06, 0x180f06, 0x180e05, 0x180e05, 0x190f06, 0x190f06, 0x190f05, 0x180e04, 0x190f05, 0x180e04, 0x1f120a, 0x21120a, 0x1c1008, 0x1c1209, 0x1f1106, 0x1f120a, 0x1e130a, 0x1f1209, 0x28180f, 0x221208, 0x20130a, 0x22130a, 0x241309, 0x251408, 0x271507, 0x2c190a, 0x2e1a0c, 0x2a170b, 0x2b170b, 0x2b180a, 0x2d190b, 0x321b0c, 0x381e0e, 0x331c0d, 0x2a1708, 0x301d11, 0x29180c, 0x1e1207, 0x1c1005, 0x1a0f05, 0x190f05, 0x180f05, 0x180e05, 0x180e05, 0x180e05, 0x190e06, 0x1c1007, 0x1e1107, 0x201207, 0x1f1207, 0x1c0f06, 0x1a0d05, 0x160c03, 0x130c02, 0x120b03, 0x110a03, 0x100a03, 0x0f0a04, 0x0d0905, 0x0b0602, 0x0a0701, 0x0a0701, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x090601, 0x090601, 0x090601, 0x0a0702, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0b0602, 0x0b0703, 0x0a0702, 0x090602, 0x070601, 0x070601, 0x070500, 0x060400, 0x040400, 0x040301, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030300, 0x040301, 0x030301, 0x020200, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x000200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x030300, 0x030200, 0x040300, 0x040300, 0x040300, 0x040500, 0x050400, 0x080500, 0x070500, 0x070601, 0x090601, 0x090702, 0x0a0702, 0x0a0702, 0x0a0602, 0x090502, 0x090401, 0x090502, 0x080501, 0x080401, 0x080401, 0x080401, 0x070301, 0x070400, 0x080500, 0x080500, 0x080500, 0x090601, 0x080601, 0x080601, 0x080702, 0x090702, 0x0a0803, 0x080702, 0x080702, 0x080702, 0x090702, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0702, 0x0c0802, 0x0d0802, 0x0d0802, 0x0e0902, 0x100902, 0x140b04, 0x170c04, 0x1f1106, 0x271608, 0x291709, 0x231307, 0x1a0e05, 0x160d05, 0x130c06, 0x130b05, 0x140b05, 0x140b05, 0x140b04, 0x150b05, 0x150a04, 0x160b05, 0x170c05, 0x190c04, 0x1b0e06, 0x1b0f06, 0x1d1007, 0x201108, 0x26140a, 0x28160a, 0x271409, 0x241208, 0x1f1207, 0x1b1007, 0x190f05, 0x180e04, 0x180e05, 0x180e05, 0x170e05, 0x170d04, 0x180d05, 0x170c06, 0x170d05, 0x170d04, 0x170d04, 0x170d04, 0x180d05, 0x180e05, 0x180e05, 0x170d04, 0x180e05, 0x1a0e05, 0x1a0d05, 0x1c0f06, 0x1c0f06, 0x1d1006, 0x1d1008, 0x1d1109, 0x1e1109, 0x1e0f08, 0x1f1008, 0x1f1109, 0x1f120a, 0x23120a, 0x261308, 0x251508, 0x29180a, 0x2b190b, 0x29170a, 0x28160a, 0x29170b, 0x2a1709, 0x2f190b, 0x341d0d, 0x341c0e, 0x2b1609, 0x241205, 0x211108, 0x1d1108, 0x190f05, 0x190f05, 0x170d04, 0x160d03, 0x160c03, 0x160c03, 0x160c03, 0x170d04, 0x180e05, 0x1a1006, 0x1d1108, 0x1e1108, 0x1d1005, 0x190e04, 0x160c04, 0x130b04, 0x110b04, 0x0f0a04, 0x0d0a03, 0x0c0902, 0x0b0803, 0x0a0702, 0x0a0602, 0x0a0603, 0x090502, 0x080401, 0x090502, 0x0a0501, 0x0a0501, 0x090601, 0x0a0700, 0x090601, 0x090601, 0x090601, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x080702, 0x070601, 0x070500, 0x070500, 0x060500, 0x050400, 0x040300, 0x040300, 0x040301, 0x040301, 0x030200, 0x020200, 0x020300, 0x030400, 0x030400, 0x020300, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x030301, 0x040201, 0x030200, 0x040300, 0x040300, 0x040400, 0x050400, 0x060400, 0x070500, 0x070601, 0x060501, 0x060501, 0x070601, 0x070601, 0x080401, 0x080401, 0x070401, 0x060501, 0x060501, 0x060400, 0x060400, 0x060400, 0x050400, 0x050400, 0x060500, 0x060500, 0x060500, 0x070601, 0x070500, 0x060601, 0x060600, 0x070500, 0x090601, 0x080601, 0x080601, 0x090702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0a0702, 0x0b0802, 0x0b0802, 0x0d0802, 0x0e0903, 0x0f0902, 0x130b04, 0x170c04, 0x1f1106, 0x261508, 0x251408, 0x1e1005, 0x160c03, 0x130a03, 0x120b05, 0x120b05, 0x120a04, 0x120a04, 0x140a04, 0x140b04, 0x140a04, 0x150a04, 0x160b05, 0x170d05, 0x190c04, 0x1a0d05, 0x1b0e05, 0x1f1007, 0x24130a, 0x27150a, 0x241208, 0x201107, 0x1c0f04, 0x190f05, 0x180e05, 0x170d04, 0x170d04, 0x170d04, 0x160d04, 0x170d04, 0x170c06, 0x160b05, 0x150b05, 0x150b04, 0x160b05, 0x150b04, 0x150b05, 0x160b05, 0x160b05, 0x160c05, 0x160c05, 0x170d04, 0x180d03, 0x180d03, 0x190e04, 0x190f05, 0x1b0f07, 0x1b0f07, 0x1c0f07, 0x1c0f07, 0x1d0f07, 0x1e1008, 0x1e1108, 0x201208, 0x241208, 0x241408, 0x271608, 0x291709, 0x271509, 0x251409, 0x27160a, 0x281609, 0x2b1709, 0x2f1a0b, 0x311b0d, 0x2a1609, 0x251308, 0x201108, 0x1d1007, 0x190f05, 0x180e05, 0x160c03, 0x150b02, 0x150b03, 0x150b03, 0x150b03, 0x160c04, 0x170d04, 0x180e04, 0x1a0f05, 0x1d1007, 0x1c0f05, 0x180d04, 0x160c04, 0x130b04, 0x100a03, 0x0d0903, 0x0c0902, 0x0b0802, 0x0a0702, 0x0a0702, 0x0a0603, 0x0a0502, 0x090401, 0x090401, 0x090401, 0x0a0502, 0x090601, 0x090601, 0x080600, 0x070500, 0x060500, 0x070500, 0x070601, 0x070601, 0x070601, 0x070500, 0x090601, 0x080501, 0x070400, 0x060400, 0x050400, 0x040300, 0x040300, 0x040300, 0x040301, 0x030200, 0x030200, 0x030200, 0x030301, 0x020300, 0x020200, 0x020200, 0x020100, 0x010100, 0x010100, 0x010100, 0x010200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 
-  0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x030200, 0x030200, 0x030200, 0x040300, 0x040500, 0x040500, 0x050500, 0x050400, 0x060501, 0x060501, 0x060501, 0x060501, 0x060501, 0x060501, 0x060501, 0x050400, 0x040400, 0x040400, 0x040300, 0x050400, 0x050400, 0x050400, 0x060501, 0x050400, 0x050400, 0x060501, 0x060501, 0x060500, 0x050600, 0x050600, 0x060601, 0x070601, 0x080501, 0x090601, 0x0a0501, 0x0a0501, 0x090601, 0x0a0702, 0x0b0803, 0x0a0702, 0x0a0702, 0x0a0802, 0x0b0802, 0x0d0802, 0x0e0903, 0x120a04, 0x170d04, 0x1f1207, 0x24150a, 0x201107, 0x1a0e05, 0x140b02, 0x120a04, 0x130a06, 0x120a05, 0x120b05, 0x120a05, 0x130b05, 0x140b06, 0x140b06, 0x140b05, 0x150a04, 0x160b05, 0x180b04, 0x190c04, 0x1b0e06, 0x1f0f07, 0x24120a, 0x25130a, 0x201208, 0x1d1007, 0x1b0e05, 0x180d04, 0x170d04, 0x160c04, 0x160c03, 0x160c03, 0x150b03, 0x150a04, 0x150a04, 0x150b04, 0x150b05, 0x150c05, 0x140b05, 0x140b05, 0x150c05, 0x150c05, 0x140b05, 0x150c06, 0x150c06, 0x150c04, 0x150c03, 0x150c03, 0x160d04, 0x170e05, 0x180e05, 0x180f06, 0x190f06, 0x1b0f07, 0x1b0f06, 0x1d0f06, 0x1d0e05, 0x1f1108, 0x201209, 0x221308, 0x261509, 0x281509, 0x26150a, 0x231208, 0x24140a, 0x27160a, 0x271608, 0x2a1809, 0x2d1a0b, 0x281608, 0x241308, 0x1f1108, 0x1c0e06, 0x1a0e06, 0x170d04, 0x160c03, 0x150c04, 0x140a04, 0x140b04, 0x140b04, 0x140b04, 0x150c05, 0x170e05, 0x180e05, 0x1b0f05, 0x1b0e05, 0x180d04, 0x150c03, 0x130b04, 0x100a03, 0x0d0803, 0x0c0904, 0x0b0803, 0x0a0702, 0x0a0603, 0x090401, 0x090401, 0x090401, 0x090401, 0x090502, 0x090502, 0x080401, 0x070500, 0x060500, 0x060500, 0x050400, 0x050400, 0x060500, 0x060501, 0x060501, 0x070601, 0x090601, 0x090501, 0x080400, 0x060400, 0x050400, 0x050400, 0x040300, 0x040300, 0x030200, 0x030200, 0x030200, 0x030201, 0x020200, 0x010100, 0x020200, 0x020200, 0x030200, 0x010100, 0x010100, 0x010100, 0x010201, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x020100, 0x030200, 0x030200, 0x030200, 0x030200, 0x040301, 0x030400, 0x030500, 0x040400, 0x060300, 0x050400, 0x050400, 0x050400, 0x040300, 0x040301, 0x040401, 0x040401, 0x040401, 0x040401, 0x040301, 0x040301, 0x040300, 0x050401, 0x050300, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x040500, 0x040500, 0x060501, 0x060601, 0x060601, 0x080602, 0x080502, 0x090502, 0x080500, 0x090601, 0x0a0702, 0x0a0803, 0x0b0803, 0x0a0702, 0x0a0702, 0x0c0802, 0x0e0903, 0x120a04, 0x180e05, 0x1f1307, 0x211208, 0x1b0e06, 0x150c03, 0x110a02, 0x120a04, 0x110705, 0x100806, 0x110905, 0x110a04, 0x120a05, 0x140b06, 0x140b06, 0x140b05, 0x140a04, 0x150a04, 0x170a04, 0x160c04, 0x190d05, 0x1d0f07, 0x221109, 0x23120a, 0x1d1006, 0x190e05, 0x180c04, 0x170c03, 0x150b04, 0x150a04, 0x150a03, 0x150a02, 0x140903, 0x150a04, 0x140a03, 0x130a05, 0x130a05, 0x140a06, 0x130a06, 0x130a06, 0x130a05, 0x130b05, 0x130b06, 0x130b06, 0x130c06, 0x140b06, 0x140a05, 0x130a05, 0x140b06, 0x150c06, 0x150c04, 0x160d05, 0x180e05, 0x180e06, 0x1a0e05, 0x1d1006, 0x26190e, 0x1d1006, 0x1d1108, 0x201208, 0x241309, 0x26140a, 0x25130a, 0x201109, 0x211309, 0x231409, 0x251608, 0x271708, 0x2a180a, 0x271508, 0x231308, 0x1d0f07, 0x1b0e06, 0x1a0d05, 0x160b03, 0x140b04, 0x140b04, 0x140b04, 0x130a03, 0x140a04, 0x140b04, 0x140b04, 0x160d04, 0x170d04, 0x190d04, 0x1a0d04, 0x170d04, 0x150c03, 0x130b03, 0x100a03, 0x0d0803, 0x0b0803, 0x0a0702, 0x0a0603, 0x090502, 0x080401, 0x080501, 0x080401, 0x080401, 0x080501, 0x080401, 0x060300, 0x050400, 0x050400, 0x050300, 0x050400, 0x050400, 0x050400, 0x060401, 0x070400, 0x070401, 0x060401, 0x060400, 0x060300, 0x060300, 0x040300, 0x040300, 0x040301, 0x030300, 0x030200, 0x030200, 0x040300, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020100, 0x010100, 0x010100, 0x010100, 0x000100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010100, 0x010100, 0x010100, 0x010100, 0x020100, 0x020100, 0x020200, 0x030200, 0x030300, 0x040401, 0x030500, 0x040400, 0x050400, 0x040400, 0x040400, 0x040400, 0x040400, 0x050402, 0x040301, 0x030301, 0x040301, 0x040301, 0x040301, 0x040301, 0x040301, 0x050401, 0x040400, 0x040400, 0x040400, 0x050500, 0x050400, 0x050400, 0x050400, 0x040400, 0x050400, 0x050501, 0x050500, 0x060501, 0x070501, 0x090502, 0x090501, 0x090501, 0x090501, 0x0a0602, 0x0b0702, 0x0a0702, 0x0b0803, 0x0c0802, 0x0e0803, 0x120a03, 0x1a0e05, 0x1e1107, 0x1c1006, 0x170d05, 0x130b03, 0x100a03, 0x100a04, 0x0f0904, 0x0e0904, 0x0f0904, 0x110905, 0x120905, 0x130a06, 0x130b05, 0x130a05, 0x130a05, 0x140a04, 0x150a04, 0x150c04, 0x180d04, 0x1c0e06, 0x201008, 0x1f1008, 0x1b0e06, 0x180e05, 0x150c04, 0x160b03, 0x150a04, 0x150a05, 0x150a03, 0x150b03, 0x150b04, 0x140a03, 0x130a04, 0x130a05, 0x130a04, 0x130b04, 0x130b04, 0x130b04, 0x130c05, 0x130b05, 0x130b05, 0x130b05, 0x130b04, 0x130a06, 0x130a06, 0x130a06, 0x140a06, 0x140a05, 0x150a04, 0x160c05, 0x160c05, 0x170d05, 0x170c05, 0x1a0e05, 0x21140a, 0x1c0e05, 0x1d0f07, 0x1e1008, 0x211208, 0x231309, 0x22130a, 0x201209, 0x1e1108, 0x201308, 0x221408, 0x251609, 0x281608, 0x261509, 0x211308, 0x1d0f07, 0x1a0d05, 0x170b04, 0x150a03, 0x140a04, 0x140b04, 0x130b03, 0x120a03, 0x120a04, 0x130b04, 0x120b04, 0x140b03, 0x160d05, 0x180d04, 0x1a0d04, 0x190d04, 0x160c03, 0x120a03, 0x100a03, 0x0d0903, 0x0b0703, 0x0b0702, 0x0a0602, 0x090502, 0x070501, 0x070602, 0x070501, 0x070500, 0x070401, 0x080300, 0x060400, 0x040500, 0x040500, 0x050500, 0x040400, 0x040400, 0x050500, 0x050500, 0x060400, 0x060400, 0x050400, 0x050400, 0x050300, 0x050300, 0x040300, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020300, 0x030400, 0x030400, 0x030400, 0x030400, 0x040401, 0x030400, 0x030400, 0x030300, 0x030301, 0x030200, 0x040301, 0x040301, 0x030201, 0x030201, 0x040301, 0x040300, 0x040300, 0x030400, 0x030500, 0x040500, 0x040500, 0x040400, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x050400, 0x060401, 0x080401, 0x090401, 0x080401, 0x090401, 0x0a0502, 0x090501, 0x0a0601, 0x090702, 0x0b0802, 0x0e0802, 0x130b04, 0x1b0f06, 0x1d0f07, 0x180d04, 0x130b03, 0x100902, 0x0f0903, 0x0d0903, 0x0d0a04, 0x0d0a03, 0x0e0904, 0x0f0704, 0x110705, 0x110805, 0x110b04, 0x120b05, 0x130a05, 0x140b06, 0x140b04, 0x140b04, 0x160c03, 0x1b0e05, 0x1e1007, 0x1c0f06, 0x190d05, 0x150c03, 0x140b04, 0x150b04, 0x150a04, 0x140a06, 0x140a04, 0x140a03, 0x130a03, 0x130a03, 0x130a04, 0x130a05, 0x130a04, 0x120a03, 0x120b04, 0x130c04, 0x120b04, 0x130b06, 0x130b06, 0x130b05, 0x130b05, 0x130b05, 0x130a05, 0x130a04, 0x130a03, 0x130a03, 0x140a03, 0x150a04, 0x160b04, 0x160c03, 0x160c04, 0x170d04, 0x170c03, 0x1b0e06, 0x1c0e06, 0x1b0e06, 0x1d1007, 0x201307, 0x211309, 0x1e1108, 0x1d0f06, 0x1e1107, 0x201208, 0x221308, 0x261308, 0x241408, 0x1f1108, 0x1b0e06, 0x180c05, 0x150a05, 0x140a04, 0x130a03, 0x130a03, 0x120b03, 0x100a03, 0x110a04, 0x110a04, 0x110a05, 0x130b05, 0x140b04, 0x160c03, 0x170d04, 0x180c03, 0x160b03, 0x120a03, 0x0f0a04, 0x0c0802, 0x0c0603, 0x0b0602, 0x0a0502, 0x080402, 0x060500, 0x060500, 0x070500, 0x080500, 0x070400, 0x060300, 0x060400, 0x040500, 0x040500, 0x040500, 0x030500, 0x030400, 0x040500, 0x030400, 0x030500, 0x030500, 0x040400, 0x050400, 0x040300, 0x040300, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020201, 0x020200, 0x020200, 0x020200, 0x030200, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x040300, 0x040300, 0x030500, 0x040500, 0x040500, 0x040500, 0x050400, 0x050400, 0x040300, 0x040300, 0x040300, 0x040300, 0x050400, 0x050400, 0x050300, 0x070300, 0x080401, 0x080401, 0x080401, 0x090502, 0x080501, 0x080602, 0x070601, 0x0a0702, 0x0f0903, 0x140b04, 0x190f06, 0x180d04, 0x140b02, 0x100a02, 0x0f0903, 0x0c0702, 0x0c0702, 0x0c0803, 0x0d0a04, 0x0d0804, 0x0e0804, 0x100705, 0x100804, 0x100903, 0x110a04, 0x120a04, 0x130a05, 0x120b04, 0x140b04, 0x160c03, 0x190d04, 0x1c0f06, 0x1a0e05, 0x150b03, 0x140a03, 0x130a04, 0x130b04, 0x120b04, 0x120a05, 0x120b05, 0x120b04, 0x120a05, 0x130a05, 0x120a04, 0x120904, 0x120906, 0x120906, 0x130906, 0x130a07, 0x120a06, 0x120a06, 0x110a06, 0x110a06, 0x120a06, 0x120a05, 0x110a04, 0x120a05, 0x130a04, 0x120a03, 0x130a04, 0x140b04, 0x150b04, 0x160b04, 0x160c03, 0x160c03, 0x160b03, 0x180c04, 0x190c05, 0x180d05, 0x1b0f05, 0x1d1106, 0x1e1108, 0x1c0f06, 0x1c0e05, 0x1c0f06, 0x1e1007, 0x201107, 0x221208, 0x221309, 0x1d1007, 0x1a0d05, 0x170c04, 0x130a04, 0x130a03, 0x130a03, 0x120a03, 0x110a04, 0x100904, 0x100903, 0x100804, 0x100804, 0x110a05, 0x120a04, 0x130b03, 0x140a02, 0x150b02, 0x140a03, 0x120b04, 0x0f0a04, 0x0c0702, 0x0b0602, 0x0a0501, 0x0a0501, 0x080401, 0x060401, 0x050400, 0x060501, 0x050400, 0x040400, 0x040500, 0x050400, 0x040300, 0x040300, 0x030400, 0x030400, 0x030400, 0x030400, 0x030301, 0x030400, 0x030400, 0x030400, 0x040300, 0x040301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020301, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020200, 0x020200, 0x020300, 0x030400, 0x020400, 0x030400, 0x050601, 0x040500, 0x040400, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x050400, 0x050400, 0x050400, 0x070300, 0x060400, 0x060400, 0x060401, 0x070501, 0x070501, 0x060601, 0x070702, 0x0a0702, 0x0f0804, 0x140b04, 0x170d05, 0x140b02, 0x110a02, 0x0f0903, 0x0c0703, 0x0c0703, 0x0b0602, 0x0b0603, 0x0b0703, 0x0c0703, 0x0d0803, 0x0e0803, 0x0f0903, 0x0f0903, 0x100903, 0x100903, 0x110a04, 0x110b04, 0x140b04, 0x160b04, 0x180d04, 0x190e05, 0x170d05, 0x140903, 0x130a04, 0x120a05, 0x120b04, 0x120a04, 0x110906, 0x120906, 0x110906, 0x110906, 0x100805, 0x100804, 0x100904, 0x110805, 0x100705, 0x100805, 0x100906, 0x110906, 0x100805, 0x100905, 0x110905, 0x110905, 0x100905, 0x100904, 0x110a04, 0x120a05, 0x120a04, 0x120a05, 0x130b05, 0x130a04, 0x150b05, 0x150b04, 0x140b02, 0x150c04, 0x150b05, 0x150a04, 0x160b04, 0x170d04, 0x1a1006, 0x1c1007, 0x190e05, 0x190d05, 0x1a0d05, 0x1b0e05, 0x1c0f06, 0x1e1108, 0x1e1008, 0x1c0e07, 0x180d05, 0x140b03, 0x130a04, 0x130a03, 0x120a03, 0x110a02, 0x110a04, 0x0f0802, 0x0e0702, 0x0e0603, 0x0f0704, 0x100805, 0x100904, 0x110a03, 0x120a03, 0x130b04, 0x120a03, 0x110a04, 0x0e0903, 0x0c0703, 0x0a0602, 0x0a0501, 0x090501, 0x070300, 0x060400, 0x040400, 0x050400, 0x040400, 0x030400, 0x040400, 0x040300, 0x050400, 0x040300, 0x040400, 0x030400, 0x030400, 0x040402, 0x020201, 0x030201, 0x030301, 0x020200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x020200, 0x020200, 0x010100, 0x010100, 0x020200, 0x020200, 0x010100, 0x030200, 0x030200, 0x040301, 0x040301, 0x030301, 0x030301, 0x030301, 0x030400, 0x030400, 0x020400, 0x020300, 0x030400, 0x030400, 0x040400, 0x040301, 0x040301, 0x040301, 0x040301, 0x040301, 0x050400, 0x050400, 0x050400, 0x060300, 0x050400, 0x050400, 0x050400, 0x050400, 0x050501, 0x050601, 0x060702, 0x0a0703, 0x100904, 0x140b04, 0x140c03, 0x110a01, 0x0f0902, 0x0c0803, 0x0a0702, 0x0b0703, 0x0b0603, 0x0b0704, 0x0c0703, 0x0b0602, 0x0b0601, 0x0b0600, 0x0c0701, 0x0d0802, 0x0f0903, 0x100903, 0x100a04, 0x100a04, 0x120a03, 0x150a04, 0x160c04, 0x170d05, 0x150a04, 0x130a04, 0x110904, 0x110906, 0x110903, 0x110804, 0x100705, 0x100705, 0x100705, 0x100806, 0x110906, 0x100805, 0x100805, 0x100905, 0x0f0805, 0x0f0a06, 0x0e0905, 0x0e0905, 0x100903, 0x100903, 0x100903, 0x110a04, 0x0f0904, 0x100805, 0x110a04, 0x110a04, 0x120904, 0x120a05, 0x120a05, 0x130a05, 0x140a04, 0x140a03, 0x140b02, 0x140b04, 0x140b04, 0x130a04, 0x140b03, 0x160c03, 0x180e04, 0x190f05, 0x170d05, 0x150b04, 0x160c03, 0x170d04, 0x190e05, 0x1a0f07, 0x1c0f07, 0x1b0e06, 0x180d06, 0x140b05, 0x130a05, 0x120a04, 0x110904, 0x110a04, 0x100903, 0x0f0802, 0x0e0603, 0x0e0603, 0x0e0603, 0x0e0704, 0x0e0704, 0x0f0903, 0x100a04, 0x120a03, 0x120a03, 0x110a04, 0x0e0804, 0x0c0703, 0x0a0602, 0x0a0501, 0x090501, 0x070300, 0x060400, 0x040400, 0x050400, 0x040400, 0x040400, 0x040300, 0x040300, 0x040300, 0x030400, 0x040400, 0x030400, 0x020300, 0x030301, 0x020200, 0x020200, 0x020200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x020100, 0x020100, 0x020100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x000000, 0x010102, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 
-  0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x020200, 0x020100, 0x020201, 0x030301, 0x030301, 0x030400, 0x020300, 0x030400, 0x030400, 0x030301, 0x020201, 0x020200, 0x030200, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x040400, 0x040500, 0x040400, 0x040500, 0x040400, 0x040500, 0x040400, 0x050400, 0x050400, 0x050500, 0x060501, 0x080601, 0x0b0702, 0x0f0a04, 0x140b04, 0x130b04, 0x100903, 0x0c0702, 0x0a0602, 0x0a0702, 0x090602, 0x0a0602, 0x0a0702, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0b0602, 0x0d0803, 0x0d0804, 0x110a03, 0x130a03, 0x130903, 0x160a04, 0x160a04, 0x130a03, 0x100a04, 0x0f0a04, 0x0e0903, 0x0f0804, 0x100805, 0x0f0704, 0x100805, 0x100805, 0x100804, 0x110905, 0x100804, 0x100803, 0x0e0803, 0x0d0903, 0x0b0a02, 0x0d0903, 0x0d0802, 0x0d0902, 0x0d0902, 0x0d0902, 0x0d0a03, 0x0d0902, 0x0f0903, 0x100903, 0x100903, 0x110904, 0x110805, 0x120907, 0x120906, 0x130a05, 0x130a04, 0x140b04, 0x140b04, 0x130a04, 0x130a03, 0x130a03, 0x140b03, 0x160d04, 0x180e05, 0x170c05, 0x140a04, 0x150a04, 0x150b03, 0x180d04, 0x1a0e06, 0x1b0e05, 0x1a0e05, 0x160d05, 0x140b04, 0x130a03, 0x120904, 0x110803, 0x110803, 0x100801, 0x100802, 0x0d0703, 0x0c0703, 0x0b0703, 0x0b0803, 0x0b0702, 0x0c0803, 0x0e0905, 0x0f0903, 0x0f0903, 0x100a03, 0x0e0803, 0x0c0603, 0x0a0501, 0x0b0502, 0x090401, 0x070300, 0x050400, 0x050400, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x050400, 0x040301, 0x030300, 0x030200, 0x020200, 0x020200, 0x020200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x020100, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x010101, 0x000001, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x010100, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010100, 0x010100, 0x010100, 0x020200, 0x010200, 0x020200, 0x020200, 0x030301, 0x030300, 0x030301, 0x030401, 0x020300, 0x030300, 0x040300, 0x030200, 0x030200, 0x040300, 0x040300, 0x040400, 0x040500, 0x040500, 0x030400, 0x040500, 0x030500, 0x040400, 0x040300, 0x050400, 0x040400, 0x060501, 0x090601, 0x0c0802, 0x0f0a04, 0x130c04, 0x110a03, 0x0d0802, 0x0b0602, 0x090501, 0x080500, 0x090601, 0x090601, 0x0a0702, 0x0a0602, 0x0a0702, 0x0a0702, 0x0a0702, 0x0b0702, 0x0c0703, 0x0c0703, 0x0c0703, 0x0c0703, 0x0f0802, 0x120a03, 0x130a03, 0x150a04, 0x140903, 0x120a04, 0x0f0a04, 0x0d0802, 0x0d0802, 0x0f0804, 0x0f0704, 0x0e0603, 0x0e0603, 0x0e0603, 0x0e0704, 0x0e0704, 0x0e0704, 0x0e0704, 0x0d0803, 0x0c0903, 0x0c0903, 0x0d0a03, 0x0d0903, 0x0c0903, 0x0c0903, 0x0c0902, 0x0c0903, 0x0c0802, 0x0d0803, 0x0f0803, 0x0f0803, 0x100804, 0x0f0704, 0x100805, 0x100805, 0x110a04, 0x120a04, 0x130a03, 0x120a02, 0x130a03, 0x130a03, 0x130a03, 0x130a03, 0x150b03, 0x160d03, 0x160c05, 0x140a03, 0x140a03, 0x160b05, 0x160c03, 0x180c04, 0x1a0d05, 0x190d04, 0x150c04, 0x130b03, 0x110a04, 0x100903, 0x0f0802, 0x0f0702, 0x0e0802, 0x0e0803, 0x0c0703, 0x0a0603, 0x0a0602, 0x0a0702, 0x0a0702, 0x0b0703, 0x0d0804, 0x0c0802, 0x0d0802, 0x0d0802, 0x0c0703, 0x0b0603, 0x0a0501, 0x090401, 0x080401, 0x070300, 0x040300, 0x040300, 0x030200, 0x040300, 0x040300, 0x040300, 0x040300, 0x040300, 0x030200, 0x030200, 0x030200, 0x030301, 0x030301, 0x030301, 0x030200, 0x030200, 0x030200, 0x030200, 0x020100, 0x010100, 0x020100, 0x020100, 0x020100, 0x010100, 0x010100, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101
-};
\ No newline at end of file
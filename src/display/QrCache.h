@@ -0,0 +1,242 @@
+/**
+ * QR Codes prontos antes da hora (task em background + cache LRU)
+ *
+ * A URL chega com a tag, mas o QR Code só aparece depois da recompensa
+ * (até 1 min). prepare() copia a URL e retorna na hora; uma task codifica
+ * a matriz (QrCode.h) enquanto a moeda está na tela. Na troca para o modo
+ * QR Code, get() só copia a matriz pronta e o desenho é um blit das faixas
+ * DMA.
+ *
+ * As matrizes ficam num cache LRU de QR_CACHE_ENTRIES entradas, chave =
+ * hash FNV-1a de 64 bits da URL + tamanho: as tags costumam repetir
+ * poucas URLs, que não são codificadas de novo.
+ *
+ *   qrCache.begin();
+ *   qrCache.prepare(url.c_str(), url.length());        // ao ler a tag
+ *   ...
+ *   if (qrCache.get(url.c_str(), url.length(), qrCode, 500)) drawQrCode(...);
+ *
+ * Memória fixa (global): entradas ~840 B cada + codificador ~2,3 KB + URL
+ * pendente; pilha da task QR_CACHE_TASK_STACK.
+ */
+
+#ifndef QR_CACHE_H
+#define QR_CACHE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "QrCode.h"
+
+#ifndef QR_CACHE_ENTRIES
+  #define QR_CACHE_ENTRIES 4
+#endif
+#ifndef QR_CACHE_TASK_CORE
+  #define QR_CACHE_TASK_CORE 0          // fora do núcleo do loop() e dos olhos
+#endif
+#ifndef QR_CACHE_TASK_STACK
+  #define QR_CACHE_TASK_STACK 3072
+#endif
+
+// Maior URL copiada para a task (QR_MAX_VERSION 16 aceita até 450 bytes)
+#ifndef QR_CACHE_MAX_URL
+  #define QR_CACHE_MAX_URL 512
+#endif
+
+class QrCache {
+public:
+  struct Stats {
+    uint32_t hits;           // get() com a matriz já pronta
+    uint32_t misses;         // get() teve de esperar a codificação
+    uint32_t encodes;        // matrizes codificadas pela task
+    uint32_t failures;       // URL grande demais para QR_MAX_VERSION
+    uint32_t lastEncodeMicros;
+  };
+
+private:
+  struct Entry {
+    uint64_t hash;
+    uint16_t len;
+    uint32_t lastUse;   // 0 = livre
+    QrCode code;
+  };
+
+  Entry entries[QR_CACHE_ENTRIES];
+  QrEncoder encoder;
+  QrCode staging;                     // matriz em construção (só a task)
+  char pending[QR_CACHE_MAX_URL];     // URL esperando a task
+  uint16_t pendingLen = 0;
+  uint64_t pendingHash = 0;
+  uint64_t runningHash = 0;           // URL sendo codificada (busy)
+  uint64_t failedHash = 0;            // última URL que não coube
+  bool hasPending = false;
+  bool busy = false;
+  uint32_t useClock = 0;
+  Stats stats = { 0, 0, 0, 0, 0 };
+
+  SemaphoreHandle_t lock = NULL;
+  SemaphoreHandle_t done = NULL;      // dado a cada codificação terminada
+  TaskHandle_t task = NULL;
+
+  static uint64_t hashOf(const char* text, size_t len) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+      hash ^= (uint8_t)text[i];
+      hash *= 0x100000001b3ULL;
+    }
+    return hash;
+  }
+
+  // Chamar com lock
+  Entry* find(uint64_t hash, size_t len) {
+    for (int i = 0; i < QR_CACHE_ENTRIES; i++) {
+      if (entries[i].lastUse && entries[i].hash == hash && entries[i].len == len) return &entries[i];
+    }
+    return NULL;
+  }
+
+  // Entrada livre ou a usada há mais tempo (chamar com lock)
+  Entry* victim() {
+    Entry* oldest = &entries[0];
+    for (int i = 0; i < QR_CACHE_ENTRIES; i++) {
+      if (entries[i].lastUse == 0) return &entries[i];
+      if (entries[i].lastUse < oldest->lastUse) oldest = &entries[i];
+    }
+    return oldest;
+  }
+
+  static void taskEntry(void* arg) {
+    QrCache* self = (QrCache*)arg;
+    char url[QR_CACHE_MAX_URL];
+    for (;;) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+      xSemaphoreTake(self->lock, portMAX_DELAY);
+      bool work = self->hasPending;
+      uint16_t len = self->pendingLen;
+      uint64_t hash = self->pendingHash;
+      if (work) memcpy(url, self->pending, len);
+      self->hasPending = false;
+      self->busy = work;
+      self->runningHash = hash;
+      xSemaphoreGive(self->lock);
+      if (!work) continue;
+
+      uint32_t start = micros();
+      bool ok = self->encoder.encode(url, len, self->staging);
+      uint32_t elapsed = micros() - start;
+
+      xSemaphoreTake(self->lock, portMAX_DELAY);
+      if (ok) {
+        Entry* entry = self->find(hash, len);
+        if (entry == NULL) entry = self->victim();
+        entry->hash = hash;
+        entry->len = len;
+        entry->lastUse = ++self->useClock;
+        entry->code = self->staging;
+        self->stats.encodes++;
+        self->stats.lastEncodeMicros = elapsed;
+      } else {
+        self->failedHash = hash;
+        self->stats.failures++;
+      }
+      self->busy = false;
+      xSemaphoreGive(self->lock);
+      xSemaphoreGive(self->done);
+    }
+  }
+
+public:
+  /**
+   * Cria a task (começa dormindo até o primeiro prepare())
+   */
+  bool begin() {
+    if (task) return true;
+    lock = xSemaphoreCreateMutex();
+    done = xSemaphoreCreateBinary();
+    if (lock == NULL || done == NULL) return false;
+    for (int i = 0; i < QR_CACHE_ENTRIES; i++) entries[i].lastUse = 0;
+    xTaskCreatePinnedToCore(taskEntry, "qr_cache", QR_CACHE_TASK_STACK, this, 1, &task, QR_CACHE_TASK_CORE);
+    return task != NULL;
+  }
+
+  /**
+   * Agenda a codificação da URL (não bloqueia). Já em cache: só marca como
+   * usada. Uma URL nova substitui a pendente ainda não iniciada.
+   */
+  bool prepare(const char* url, size_t len) {
+    if (task == NULL || len == 0 || len >= QR_CACHE_MAX_URL) return false;
+    uint64_t hash = hashOf(url, len);
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Entry* entry = find(hash, len);
+    if (entry) {
+      entry->lastUse = ++useClock;
+    } else if (hash != failedHash) {
+      memcpy(pending, url, len);
+      pendingLen = len;
+      pendingHash = hash;
+      hasPending = true;
+    }
+    bool queued = entry == NULL && hasPending;
+    xSemaphoreGive(lock);
+
+    if (queued) xTaskNotifyGive(task);
+    return true;
+  }
+
+  /**
+   * Copia a matriz da URL para out. Se ainda não está pronta, agenda e
+   * espera a task até waitMs (ready = false). false = não coube em
+   * QR_MAX_VERSION ou tempo esgotado.
+   */
+  bool get(const char* url, size_t len, QrCode& out, uint32_t waitMs, bool* ready = NULL) {
+    if (task == NULL || len == 0 || len >= QR_CACHE_MAX_URL) return false;
+    uint64_t hash = hashOf(url, len);
+    bool counted = false;
+    uint32_t start = millis();
+
+    for (;;) {
+      xSemaphoreTake(lock, portMAX_DELAY);
+      Entry* entry = find(hash, len);
+      if (entry) {
+        entry->lastUse = ++useClock;
+        out = entry->code;
+      }
+      if (!counted) {
+        if (entry) stats.hits++;
+        else stats.misses++;
+        if (ready) *ready = entry != NULL;
+        counted = true;
+      }
+      bool failed = entry == NULL && hash == failedHash;
+      bool queued = (hasPending && pendingHash == hash) || (busy && runningHash == hash);
+      xSemaphoreGive(lock);
+      if (entry) return true;
+      if (failed) return false;
+
+      if (!queued) prepare(url, len);
+
+      uint32_t elapsed = millis() - start;
+      if (elapsed >= waitMs) return false;
+      xSemaphoreTake(done, pdMS_TO_TICKS(waitMs - elapsed));
+    }
+  }
+
+  Stats getStats() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Stats snapshot = stats;
+    xSemaphoreGive(lock);
+    return snapshot;
+  }
+
+  /**
+   * Bytes fixos do cache (entradas + codificador + URL pendente)
+   */
+  size_t memoryBytes() const {
+    return sizeof(*this);
+  }
+};
+
+#endif // QR_CACHE_H
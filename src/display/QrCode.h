@@ -0,0 +1,549 @@
+/**
+ * QR Code nativo: codificador + desenho direto no TFT_eSPI (sem LVGL)
+ *
+ * QrEncoder gera a matriz de módulos (modo byte, versões 1 a
+ * QR_MAX_VERSION) num array de bits; drawQrCode() amplia a matriz para o
+ * tamanho pedido e envia pelas mesmas faixas DMA das imagens
+ * (ImageAsset.h): cada linha de módulos é expandida uma vez e copiada para
+ * as linhas de pixel seguintes.
+ *
+ * Mesmo comportamento do lv_qrcode do LVGL 8: correção de erro média
+ * (sobe para Q/H se couber na mesma versão), escala inteira e margem
+ * centralizada no quadrado. Algoritmo segue a ISO/IEC 18004 (Reed-Solomon
+ * em GF(256), 8 máscaras com a pontuação de penalidade padrão).
+ *
+ *   QrEncoder encoder;          // buffers de trabalho (~2,3 KB)
+ *   QrCode qr;
+ *   if (encoder.encode(url.c_str(), url.length(), qr)) {
+ *     drawQrCode(tft, qr, x, y, 163, TFT_BLACK, TFT_WHITE);
+ *   }
+ */
+
+#ifndef QR_CODE_H
+#define QR_CODE_H
+
+#include <Arduino.h>
+#include <limits.h>
+#include "ImageAsset.h"
+
+// Maior versão aceita. 16 = 81x81 módulos (2 px por módulo em 163 px),
+// até 450 bytes de URL com correção média
+#ifndef QR_MAX_VERSION
+  #define QR_MAX_VERSION 16
+#endif
+
+#define QR_SIZE_FOR(version) ((version) * 4 + 17)
+#define QR_MAX_SIZE QR_SIZE_FOR(QR_MAX_VERSION)
+#define QR_MATRIX_BYTES ((QR_MAX_SIZE * QR_MAX_SIZE + 7) / 8)
+
+enum QrEcc : uint8_t {
+  QR_ECC_LOW,
+  QR_ECC_MEDIUM,
+  QR_ECC_QUARTILE,
+  QR_ECC_HIGH
+};
+
+/**
+ * Matriz de módulos (bit 1 = escuro), linha a linha
+ */
+struct QrCode {
+  uint8_t version = 0;   // 0 = vazio
+  uint8_t size = 0;
+  QrEcc ecc = QR_ECC_MEDIUM;
+  uint8_t mask = 0;
+  uint8_t modules[QR_MATRIX_BYTES];
+
+  bool get(int x, int y) const {
+    int i = y * size + x;
+    return (modules[i >> 3] >> (i & 7)) & 1;
+  }
+
+  void set(int x, int y, bool dark) {
+    int i = y * size + x;
+    if (dark) modules[i >> 3] |= 1 << (i & 7);
+    else modules[i >> 3] &= ~(1 << (i & 7));
+  }
+
+  bool valid() const { return version > 0; }
+};
+
+class QrEncoder {
+private:
+  static const int MAX_CODEWORDS = (((16 * QR_MAX_VERSION + 128) * QR_MAX_VERSION + 64) / 8);
+
+  // Tabelas da norma, índice [ecc][versão]
+  static int8_t eccPerBlock(QrEcc ecc, int version) {
+    static const int8_t table[4][41] = {
+      { -1,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22, 24, 28, 30, 28, 28, 28, 28, 30, 30, 26, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+      { -1, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24, 28, 28, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28 },
+      { -1, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30, 24, 28, 28, 26, 30, 28, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+      { -1, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24, 30, 28, 28, 26, 28, 30, 24, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+    };
+    return table[ecc][version];
+  }
+
+  static int8_t eccBlocks(QrEcc ecc, int version) {
+    static const int8_t table[4][41] = {
+      { -1, 1, 1, 1, 1, 1, 2, 2, 2, 2,  4,  4,  4,  4,  4,  6,  6,  6,  6,  7,  8,  8,  9,  9, 10, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25 },
+      { -1, 1, 1, 1, 2, 2, 4, 4, 4, 5,  5,  5,  8,  9,  9, 10, 10, 11, 13, 14, 16, 17, 17, 18, 20, 21, 23, 25, 26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49 },
+      { -1, 1, 1, 2, 2, 4, 4, 6, 6, 8,  8,  8, 10, 12, 16, 12, 17, 16, 18, 21, 20, 23, 23, 25, 27, 29, 34, 34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68 },
+      { -1, 1, 1, 2, 4, 4, 4, 5, 6, 8,  8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25, 25, 34, 30, 32, 35, 37, 40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81 },
+    };
+    return table[ecc][version];
+  }
+
+  QrCode* qr = NULL;
+  uint8_t function[QR_MATRIX_BYTES];   // módulos fixos (não recebem dados nem máscara)
+  uint8_t data[MAX_CODEWORDS];         // dados + preenchimento, depois ECC por bloco
+  uint8_t out[MAX_CODEWORDS];          // blocos intercalados (ordem de desenho)
+
+  // Bits de dados (sem função) que cabem na versão
+  static int rawDataModules(int version) {
+    int result = (16 * version + 128) * version + 64;
+    if (version >= 2) {
+      int numAlign = version / 7 + 2;
+      result -= (25 * numAlign - 10) * numAlign - 55;
+      if (version >= 7) result -= 36;
+    }
+    return result;
+  }
+
+  static int dataCodewords(int version, QrEcc ecc) {
+    return rawDataModules(version) / 8 - eccPerBlock(ecc, version) * eccBlocks(ecc, version);
+  }
+
+  // Bits usados em modo byte (modo + contador + dados)
+  static int byteModeBits(int version, size_t len) {
+    return 4 + (version <= 9 ? 8 : 16) + (int)len * 8;
+  }
+
+  static uint8_t gfMultiply(uint8_t x, uint8_t y) {
+    uint8_t z = 0;
+    for (int i = 7; i >= 0; i--) {
+      z = (uint8_t)((z << 1) ^ ((z >> 7) * 0x11D));
+      z ^= ((y >> i) & 1) * x;
+    }
+    return z;
+  }
+
+  static void rsDivisor(int degree, uint8_t* result) {
+    memset(result, 0, degree);
+    result[degree - 1] = 1;
+    uint8_t root = 1;
+    for (int i = 0; i < degree; i++) {
+      for (int j = 0; j < degree; j++) {
+        result[j] = gfMultiply(result[j], root);
+        if (j + 1 < degree) result[j] ^= result[j + 1];
+      }
+      root = gfMultiply(root, 0x02);
+    }
+  }
+
+  static void rsRemainder(const uint8_t* dat, int len, const uint8_t* divisor, int degree, uint8_t* result) {
+    memset(result, 0, degree);
+    for (int i = 0; i < len; i++) {
+      uint8_t factor = dat[i] ^ result[0];
+      memmove(result, result + 1, degree - 1);
+      result[degree - 1] = 0;
+      for (int j = 0; j < degree; j++) result[j] ^= gfMultiply(divisor[j], factor);
+    }
+  }
+
+  bool isFunction(int x, int y) const {
+    int i = y * qr->size + x;
+    return (function[i >> 3] >> (i & 7)) & 1;
+  }
+
+  void setFunction(int x, int y, bool dark) {
+    qr->set(x, y, dark);
+    int i = y * qr->size + x;
+    function[i >> 3] |= 1 << (i & 7);
+  }
+
+  void drawFinder(int cx, int cy) {
+    for (int dy = -4; dy <= 4; dy++) {
+      for (int dx = -4; dx <= 4; dx++) {
+        int x = cx + dx, y = cy + dy;
+        if (x < 0 || y < 0 || x >= qr->size || y >= qr->size) continue;
+        int dist = max(abs(dx), abs(dy));
+        setFunction(x, y, dist != 2 && dist != 4);
+      }
+    }
+  }
+
+  void drawAlignment(int cx, int cy) {
+    for (int dy = -2; dy <= 2; dy++) {
+      for (int dx = -2; dx <= 2; dx++) {
+        setFunction(cx + dx, cy + dy, max(abs(dx), abs(dy)) != 1);
+      }
+    }
+  }
+
+  void drawFormatBits(uint8_t mask) {
+    static const uint8_t eccBits[4] = { 1, 0, 3, 2 };
+    int value = eccBits[qr->ecc] << 3 | mask;
+    int rem = value;
+    for (int i = 0; i < 10; i++) rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    int bits = (value << 10 | rem) ^ 0x5412;
+    int size = qr->size;
+
+    for (int i = 0; i <= 5; i++) setFunction(8, i, (bits >> i) & 1);
+    setFunction(8, 7, (bits >> 6) & 1);
+    setFunction(8, 8, (bits >> 7) & 1);
+    setFunction(7, 8, (bits >> 8) & 1);
+    for (int i = 9; i < 15; i++) setFunction(14 - i, 8, (bits >> i) & 1);
+
+    for (int i = 0; i < 8; i++) setFunction(size - 1 - i, 8, (bits >> i) & 1);
+    for (int i = 8; i < 15; i++) setFunction(8, size - 15 + i, (bits >> i) & 1);
+    setFunction(8, size - 8, true);   // módulo escuro fixo
+  }
+
+  void drawVersion() {
+    if (qr->version < 7) return;
+    int rem = qr->version;
+    for (int i = 0; i < 12; i++) rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+    long bits = (long)qr->version << 12 | rem;
+    for (int i = 0; i < 18; i++) {
+      bool bit = (bits >> i) & 1;
+      int a = qr->size - 11 + i % 3;
+      int b = i / 3;
+      setFunction(a, b, bit);
+      setFunction(b, a, bit);
+    }
+  }
+
+  void drawFunctionPatterns() {
+    int size = qr->size;
+    for (int i = 0; i < size; i++) {
+      setFunction(6, i, i % 2 == 0);
+      setFunction(i, 6, i % 2 == 0);
+    }
+
+    drawFinder(3, 3);
+    drawFinder(size - 4, 3);
+    drawFinder(3, size - 4);
+
+    if (qr->version >= 2) {
+      int numAlign = qr->version / 7 + 2;
+      int step = (qr->version * 8 + numAlign * 3 + 5) / (numAlign * 4 - 4) * 2;
+      uint8_t positions[7];
+      positions[0] = 6;
+      for (int i = numAlign - 1, pos = size - 7; i >= 1; i--, pos -= step) positions[i] = pos;
+      for (int i = 0; i < numAlign; i++) {
+        for (int j = 0; j < numAlign; j++) {
+          // Cantos com padrão de localização
+          if ((i == 0 && j == 0) || (i == 0 && j == numAlign - 1) || (i == numAlign - 1 && j == 0)) continue;
+          drawAlignment(positions[i], positions[j]);
+        }
+      }
+    }
+
+    drawFormatBits(0);   // reserva a área; valor real depois da máscara
+    drawVersion();
+  }
+
+  // Zigue-zague de baixo para cima em colunas de 2, pulando a coluna 6
+  void drawCodewords(const uint8_t* codewords, int len) {
+    int size = qr->size;
+    int bit = 0;
+    for (int right = size - 1; right >= 1; right -= 2) {
+      if (right == 6) right = 5;
+      bool upward = ((right + 1) & 2) == 0;
+      for (int vert = 0; vert < size; vert++) {
+        int y = upward ? size - 1 - vert : vert;
+        for (int j = 0; j < 2; j++) {
+          int x = right - j;
+          if (isFunction(x, y)) continue;
+          bool dark = bit < len * 8 && ((codewords[bit >> 3] >> (7 - (bit & 7))) & 1);
+          qr->set(x, y, dark);
+          bit++;
+        }
+      }
+    }
+  }
+
+  static bool maskBit(uint8_t mask, int x, int y) {
+    switch (mask) {
+      case 0: return (x + y) % 2 == 0;
+      case 1: return y % 2 == 0;
+      case 2: return x % 3 == 0;
+      case 3: return (x + y) % 3 == 0;
+      case 4: return (x / 3 + y / 2) % 2 == 0;
+      case 5: return x * y % 2 + x * y % 3 == 0;
+      case 6: return (x * y % 2 + x * y % 3) % 2 == 0;
+      default: return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+  }
+
+  // Aplicar duas vezes desfaz
+  void applyMask(uint8_t mask) {
+    for (int y = 0; y < qr->size; y++) {
+      for (int x = 0; x < qr->size; x++) {
+        if (!isFunction(x, y) && maskBit(mask, x, y)) qr->set(x, y, !qr->get(x, y));
+      }
+    }
+  }
+
+  // Histórico de corridas para o padrão 1:1:3:1:1 (regra N3)
+  int finderPatterns(const int* history) const {
+    int n = history[1];
+    bool core = n > 0 && history[2] == n && history[3] == n * 3 && history[4] == n && history[5] == n;
+    return (core && history[0] >= n * 4 && history[6] >= n ? 1 : 0) +
+           (core && history[6] >= n * 4 && history[0] >= n ? 1 : 0);
+  }
+
+  void addHistory(int run, int* history) const {
+    if (history[0] == 0) run += qr->size;   // borda clara antes da primeira corrida
+    memmove(history + 1, history, 6 * sizeof(int));
+    history[0] = run;
+  }
+
+  int terminateHistory(bool runDark, int run, int* history) const {
+    if (runDark) {
+      addHistory(run, history);
+      run = 0;
+    }
+    addHistory(run + qr->size, history);
+    return finderPatterns(history);
+  }
+
+  // Penalidade da norma: corridas (N1), blocos 2x2 (N2), falsos
+  // localizadores (N3) e equilíbrio claro/escuro (N4)
+  long penalty() const {
+    const int N1 = 3, N2 = 3, N3 = 40, N4 = 10;
+    int size = qr->size;
+    long result = 0;
+
+    for (int pass = 0; pass < 2; pass++) {   // linhas, depois colunas
+      for (int a = 0; a < size; a++) {
+        bool runDark = false;
+        int run = 0;
+        int history[7] = { 0 };
+        for (int b = 0; b < size; b++) {
+          bool dark = pass == 0 ? qr->get(b, a) : qr->get(a, b);
+          if (dark == runDark) {
+            run++;
+            if (run == 5) result += N1;
+            else if (run > 5) result++;
+          } else {
+            addHistory(run, history);
+            if (!runDark) result += finderPatterns(history) * N3;
+            runDark = dark;
+            run = 1;
+          }
+        }
+        result += terminateHistory(runDark, run, history) * N3;
+      }
+    }
+
+    int dark = 0;
+    for (int y = 0; y < size; y++) {
+      for (int x = 0; x < size; x++) {
+        bool color = qr->get(x, y);
+        if (color) dark++;
+        if (x + 1 < size && y + 1 < size && color == qr->get(x + 1, y) &&
+            color == qr->get(x, y + 1) && color == qr->get(x + 1, y + 1)) {
+          result += N2;
+        }
+      }
+    }
+    int total = size * size;
+    int k = (abs(dark * 20 - total * 10) + total - 1) / total - 1;
+    result += k * N4;
+    return result;
+  }
+
+public:
+  /**
+   * Codifica len bytes em qr (menor versão que cabe). Retorna false se
+   * não cabe em QR_MAX_VERSION.
+   */
+  bool encode(const char* text, size_t len, QrCode& code, QrEcc minEcc = QR_ECC_MEDIUM) {
+    qr = &code;
+    code.version = 0;
+
+    int version = 1;
+    while (version <= QR_MAX_VERSION && byteModeBits(version, len) > dataCodewords(version, minEcc) * 8) {
+      version++;
+    }
+    if (version > QR_MAX_VERSION) return false;
+
+    // Mais correção de erro se couber na mesma versão
+    QrEcc ecc = minEcc;
+    for (int e = minEcc + 1; e <= QR_ECC_HIGH; e++) {
+      if (byteModeBits(version, len) <= dataCodewords(version, (QrEcc)e) * 8) ecc = (QrEcc)e;
+    }
+
+    // Fluxo de bits: modo byte (0100), contador, dados, terminador, preenchimento
+    int capacity = dataCodewords(version, ecc);
+    memset(data, 0, sizeof(data));
+    int bitLen = 0;
+    auto append = [&](uint32_t value, int bits) {
+      for (int i = bits - 1; i >= 0; i--, bitLen++) {
+        data[bitLen >> 3] |= ((value >> i) & 1) << (7 - (bitLen & 7));
+      }
+    };
+    append(0x4, 4);
+    append(len, version <= 9 ? 8 : 16);
+    for (size_t i = 0; i < len; i++) append((uint8_t)text[i], 8);
+    append(0, min(4, capacity * 8 - bitLen));
+    bitLen = (bitLen + 7) / 8 * 8;
+    for (uint8_t pad = 0xEC; bitLen < capacity * 8; pad ^= 0xEC ^ 0x11) append(pad, 8);
+
+    // Reed-Solomon por bloco e intercalação
+    int numBlocks = eccBlocks(ecc, version);
+    int eccLen = eccPerBlock(ecc, version);
+    int raw = rawDataModules(version) / 8;
+    int shortBlocks = numBlocks - raw % numBlocks;
+    int shortLen = raw / numBlocks;   // bloco curto com ECC
+
+    uint8_t divisor[30];
+    uint8_t remainder[30];
+    rsDivisor(eccLen, divisor);
+    int dataOffset = 0;
+    for (int i = 0; i < numBlocks; i++) {
+      int blockData = shortLen - eccLen + (i < shortBlocks ? 0 : 1);
+      for (int j = 0; j < blockData; j++) {
+        // Blocos curtos não têm o último byte de dados
+        int k = j < shortLen - eccLen ? j * numBlocks + i : (shortLen - eccLen) * numBlocks + (i - shortBlocks);
+        out[k] = data[dataOffset + j];
+      }
+      rsRemainder(data + dataOffset, blockData, divisor, eccLen, remainder);
+      for (int j = 0; j < eccLen; j++) out[capacity + j * numBlocks + i] = remainder[j];
+      dataOffset += blockData;
+    }
+
+    code.version = version;
+    code.size = QR_SIZE_FOR(version);
+    code.ecc = ecc;
+    memset(code.modules, 0, sizeof(code.modules));
+    memset(function, 0, sizeof(function));
+    drawFunctionPatterns();
+    drawCodewords(out, raw);
+
+    // Máscara com menor penalidade
+    long best = LONG_MAX;
+    uint8_t bestMask = 0;
+    for (uint8_t mask = 0; mask < 8; mask++) {
+      applyMask(mask);
+      drawFormatBits(mask);
+      long score = penalty();
+      if (score < best) {
+        best = score;
+        bestMask = mask;
+      }
+      applyMask(mask);
+    }
+    applyMask(bestMask);
+    drawFormatBits(bestMask);
+    code.mask = bestMask;
+    return true;
+  }
+};
+
+/**
+ * Estatísticas do último drawQrCode()
+ */
+struct QrDrawStats {
+  uint32_t totalMicros;
+  uint8_t scale;   // pixels por módulo
+  bool dma;
+};
+
+/**
+ * Expande a linha de módulos qy (escala + margens) para out, cores já na
+ * ordem de bytes do display
+ */
+inline void expandQrRow(const QrCode& qr, int qy, int size, int scale, int margin,
+                        uint16_t dark, uint16_t light, uint16_t* out) {
+  uint16_t* p = out;
+  for (int i = 0; i < margin; i++) *p++ = light;
+  for (int x = 0; x < qr.size; x++) {
+    uint16_t c = qr.get(x, qy) ? dark : light;
+    for (int s = 0; s < scale; s++) *p++ = c;
+  }
+  while (p < out + size) *p++ = light;
+}
+
+/**
+ * Desenha o QR Code num quadrado size x size em (x, y), módulos com escala
+ * inteira e centralizados (sobra vira margem clara). Retorna o tempo gasto
+ * em microssegundos.
+ */
+template <typename Display>
+uint32_t drawQrCode(Display& tft, const QrCode& qr, int32_t x, int32_t y, int32_t size,
+                    uint16_t darkColor, uint16_t lightColor, QrDrawStats* stats = NULL) {
+  uint32_t start = micros();
+  if (!qr.valid() || size < qr.size) return 0;
+
+  int scale = size / qr.size;
+  int margin = (size - qr.size * scale) / 2;
+
+  // Faixas na ordem de bytes do display (como as imagens)
+  uint16_t dark = (darkColor >> 8) | (darkColor << 8);
+  uint16_t light = (lightColor >> 8) | (lightColor << 8);
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+
+  ImageBlitter& blitter = imageBlitter();
+  bool dma = blitter.dma && size <= IMAGE_MAX_WIDTH;
+
+  if (size <= IMAGE_MAX_WIDTH && (dma || imageBandsAlloc())) {
+    uint8_t current = 0;
+    if (dma) tft.startWrite();
+    for (int row = 0; row < size; row += IMAGE_BAND_LINES) {
+      int lines = min<int>(IMAGE_BAND_LINES, size - row);
+      uint16_t* band = blitter.bands[current];
+      int lastQy = -2;
+      for (int i = 0; i < lines; i++) {
+        uint16_t* line = band + i * size;
+        int my = row + i - margin;
+        int qy = my < 0 || my >= qr.size * scale ? -1 : my / scale;
+        if (qy == lastQy) {
+          memcpy(line, line - size, size * sizeof(uint16_t));   // mesma linha de módulos
+        } else if (qy < 0) {
+          for (int j = 0; j < size; j++) line[j] = light;
+        } else {
+          expandQrRow(qr, qy, size, scale, margin, dark, light, line);
+        }
+        lastQy = qy;
+      }
+      if (dma) {
+        tft.pushImageDMA(x, y + row, size, lines, band);
+        current ^= 1;
+      } else {
+        tft.pushImage(x, y + row, size, lines, band);
+      }
+    }
+    if (dma) {
+      tft.dmaWait();
+      tft.endWrite();
+    }
+  } else {
+    // Sem buffers: fundo claro + corridas de módulos escuros
+    tft.fillRect(x, y, size, size, lightColor);
+    for (int qy = 0; qy < qr.size; qy++) {
+      for (int qx = 0; qx < qr.size; ) {
+        if (!qr.get(qx, qy)) {
+          qx++;
+          continue;
+        }
+        int run = qx;
+        while (run < qr.size && qr.get(run, qy)) run++;
+        tft.fillRect(x + margin + qx * scale, y + margin + qy * scale, (run - qx) * scale, scale, darkColor);
+        qx = run;
+      }
+    }
+  }
+
+  tft.setSwapBytes(swap);
+  uint32_t elapsed = micros() - start;
+  if (stats) {
+    stats->totalMicros = elapsed;
+    stats->scale = scale;
+    stats->dma = dma;
+  }
+  return elapsed;
+}
+
+#endif // QR_CODE_H
@@ -12,12 +12,77 @@
 #define _TFT_ROBOEYES_H
 
 #include <TFT_eSPI.h>
+#include <esp_heap_caps.h>
+#include "Tween.h"
 // #include <TFT_eSprite.h>  // Include the sprite class header if needed
 
 // Default color definitions (can be changed via setColors)
 #define DEFAULT_BGCOLOR   TFT_BLACK
 #define DEFAULT_MAINCOLOR TFT_WHITE
 
+// Dirty-rectangle rendering: push only the region where the eyes were or
+// are now, and skip frames where nothing changed (0 = full frame every time)
+#ifndef ROBOEYES_DIRTY_RECTS
+  #define ROBOEYES_DIRTY_RECTS 1
+#endif
+
+// Sprite color depth. The picture only has two colors (mainColor, bgColor):
+//   1  1 bpp bitmap, ~7 KB for 235x235 (plain eyes)
+//   4  4 bpp palette, ~28 KB: 16-step main/bg blend, anti-aliased corners
+//   8  RGB332, ~55 KB (original behavior)
+// In 1/4 bpp the sprite holds bits/palette indices; the DMA push expands
+// them to RGB565 through a precomputed table.
+#ifndef ROBOEYES_COLOR_DEPTH
+  #define ROBOEYES_COLOR_DEPTH 1
+#endif
+
+// Asynchronous push (after beginDMA()): the damaged rows are expanded from
+// the 8-bit sprite to RGB565 into two DMA buffers and sent with
+// pushImageDMA(), so the CPU expands/draws while the SPI bus sends
+// (0 = blocking pushSprite)
+#ifndef ROBOEYES_DMA
+  #define ROBOEYES_DMA 1
+#endif
+// Pixels per DMA buffer (two buffers, 2 bytes per pixel). 235 x 16 = 7.3 KB
+// each: the box of a 50x50 eye fits in one buffer, a full frame takes 15.
+#ifndef ROBOEYES_DMA_PIXELS
+  #define ROBOEYES_DMA_PIXELS (235 * 16)
+#endif
+
+// Transition durations (ms). Animation is time-based (Tween.h), so these
+// hold at any frame rate.
+#ifndef ROBOEYES_MOVE_MS
+  #define ROBOEYES_MOVE_MS 200     // eye position
+#endif
+#ifndef ROBOEYES_SIZE_MS
+  #define ROBOEYES_SIZE_MS 100     // width, height (blink), border radius, spacing
+#endif
+#ifndef ROBOEYES_MOOD_MS
+  #define ROBOEYES_MOOD_MS 200     // tired / angry / happy eyelids
+#endif
+#ifndef ROBOEYES_FLICKER_MS
+  #define ROBOEYES_FLICKER_MS 20   // half period of the laugh/confused shake
+#endif
+
+// Frame pacing. Transitions without shake (blink, idle move, mood) are
+// drawn at ROBOEYES_CALM_FPS; laugh/confused raise it to the setFramerate()
+// rate. With nothing moving no frame is needed until the next scheduled
+// event: nextFrameIn() tells the caller how long it may sleep.
+#ifndef ROBOEYES_CALM_FPS
+  #define ROBOEYES_CALM_FPS 30
+#endif
+#ifndef ROBOEYES_PACE_MAX_MS
+  #define ROBOEYES_PACE_MAX_MS 1000   // longest answer of nextFrameIn()
+#endif
+
+// Screen position of the sprite
+#ifndef ROBOEYES_SPRITE_X
+  #define ROBOEYES_SPRITE_X 10
+#endif
+#ifndef ROBOEYES_SPRITE_Y
+  #define ROBOEYES_SPRITE_Y 40
+#endif
+
 // Mood and position defines (same as original)
 #define DEFAULTE   0
 #define TIRED     1
@@ -43,7 +108,7 @@ class TFT_RoboEyes {
     TFT_eSPI *tft;
     
     // Off-screen drawing buffer (sprite) to reduce flicker
-    TFT_eSprite *sprite;
+    TFT_eSprite *sprite = NULL;
 
     // Display configuration – you can update these via setScreenSize()
     int screenWidth = 249;   // effective width (set by user)
@@ -121,6 +186,19 @@ class TFT_RoboEyes {
     int laughAnimationDuration;
     bool laughToggle;
 
+    // --- Render statistics (refreshed every second) ---
+    struct RenderStats {
+      float fps;                // frames actually pushed per second
+      uint32_t bytesPerSecond;  // pixel bytes sent to the display per second
+      uint16_t skipped;         // unchanged frames skipped in the last second
+      uint16_t ticks;           // frames evaluated in the last second
+      uint32_t renderMicros;    // average drawEyes() time per evaluated frame
+      uint32_t pushMicros;      // average CPU time per pushed frame (expand + SPI waits)
+      uint32_t frameMicrosMax;  // worst render + push in the last second
+      uint32_t budgetMicros;    // frame interval the two must fit in
+      bool dma;                 // asynchronous DMA push active
+    };
+
     // --- New Blink State for AutoBlinker ---
     bool blinkingActive;             // indicates if a blink is in progress (closed state)
     unsigned long blinkCloseDurationTimer; // timer for how long to stay closed
@@ -222,22 +300,187 @@ class TFT_RoboEyes {
     void begin(byte frameRate = 50) {
       // Allocate and create the sprite (off-screen buffer)
       sprite = new TFT_eSprite(tft);
-      sprite->setColorDepth(8);
-      sprite->createSprite(screenWidth, screenHeight);
-      sprite->fillSprite(bgColor);
+      sprite->setColorDepth(ROBOEYES_COLOR_DEPTH);
+      createCanvas();
 
       eyeLheightCurrent = 1;
       eyeRheightCurrent = 1;
+      snapTweens();
       setFramerate(frameRate);
     }
 
+    // Enable the asynchronous DMA push (call after begin()). Allocates the two
+    // buffers in DMA-capable RAM. TFT_eSPI::initDMA() only succeeds once:
+    // pass true if it was already called elsewhere.
+    bool beginDMA(bool dmaReady = false) {
+#if ROBOEYES_DMA
+      if (dmaEnabled) return true;
+      for (uint8_t i = 0; i < 2; i++) {
+        if (dmaBuffers[i] == NULL) {
+          dmaBuffers[i] = (uint16_t*)heap_caps_malloc(ROBOEYES_DMA_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+        }
+      }
+      if (dmaBuffers[0] == NULL || dmaBuffers[1] == NULL || (!dmaReady && !tft->initDMA())) {
+        for (uint8_t i = 0; i < 2; i++) {
+          heap_caps_free(dmaBuffers[i]);
+          dmaBuffers[i] = NULL;
+        }
+        return false;
+      }
+      buildLut();
+      dmaEnabled = true;
+#endif
+      return dmaEnabled;
+    }
+
+    // Wait for the last DMA band and release the SPI bus. update() returns
+    // with the last band still being sent: call this before drawing anything
+    // else on the tft.
+    void finishPush() {
+      if (!dmaPending) return;
+      tft->dmaWait();
+      tft->endWrite();
+      dmaPending = false;
+    }
+
+    // Free the sprite and the DMA buffers while the eyes are off screen, so
+    // another mode can use the RAM. update() draws nothing until
+    // restoreCanvas(); moods, blinks and tweens keep their state.
+    void releaseCanvas() {
+      if (!canvasReady()) return;
+      finishPush();
+      sprite->deleteSprite();
+#if ROBOEYES_DMA
+      for (uint8_t i = 0; i < 2; i++) {
+        heap_caps_free(dmaBuffers[i]);
+        dmaBuffers[i] = NULL;
+      }
+#endif
+    }
+
+    // Rebuild what releaseCanvas() freed. Without room for the DMA buffers
+    // the eyes fall back to pushSprite(). Returns false if the sprite itself
+    // does not fit.
+    bool restoreCanvas() {
+      if (!sprite) return false;
+      if (!sprite->created()) createCanvas();
+#if ROBOEYES_DMA
+      if (dmaEnabled && (dmaBuffers[0] == NULL || dmaBuffers[1] == NULL)) {
+        for (uint8_t i = 0; i < 2; i++) {
+          if (dmaBuffers[i] == NULL) {
+            dmaBuffers[i] = (uint16_t*)heap_caps_malloc(ROBOEYES_DMA_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+          }
+        }
+        if (dmaBuffers[0] == NULL || dmaBuffers[1] == NULL) {
+          for (uint8_t i = 0; i < 2; i++) {
+            heap_caps_free(dmaBuffers[i]);
+            dmaBuffers[i] = NULL;
+          }
+          dmaEnabled = false;
+        }
+      }
+#endif
+      return canvasReady();
+    }
+
+    bool canvasReady() const {
+      return sprite && sprite->created();
+    }
+
     // Update the display; call often (e.g., inside loop())
     void update() {
-      if (millis() - fpsTimer >= frameInterval) {
-        drawEyes();                // draw on the sprite
-        sprite->pushSprite(10, 40);    // push the complete frame in one go
+      if (!canvasReady()) return;
+      if (millis() - fpsTimer >= frameIntervalNow()) {
+        // With DMA the previous frame may still be on the bus: it is sent
+        // from the DMA buffers, so drawing the next one on the sprite is safe
+        uint32_t frameStart = micros();
+        Rect dirty = drawEyes();   // draw on the sprite, get the damaged region
+        uint32_t renderEnd = micros();
+        statRenderMicros += renderEnd - frameStart;
+        statTicks++;
+        if (dirty.w > 0 && dirty.h > 0) {
+          if (dmaEnabled && screenWidth <= ROBOEYES_DMA_PIXELS) {
+            pushDMA(dirty);
+          } else if (dirty.w == canvasWidth() && dirty.h == screenHeight) {
+            sprite->pushSprite(ROBOEYES_SPRITE_X, ROBOEYES_SPRITE_Y);
+          } else {
+            sprite->pushSprite(ROBOEYES_SPRITE_X + dirty.x, ROBOEYES_SPRITE_Y + dirty.y,
+                               dirty.x, dirty.y, dirty.w, dirty.h);
+          }
+          statFrames++;
+          statBytes += (uint32_t)dirty.w * dirty.h * 2;
+          statPushMicros += micros() - renderEnd;
+        } else {
+          statSkipped++;
+        }
+        statFrameMax = max<uint32_t>(statFrameMax, micros() - frameStart);
         fpsTimer = millis();
       }
+
+      unsigned long elapsed = millis() - statTimer;
+      if (elapsed >= 1000) {
+        stats.fps = statFrames * 1000.0f / elapsed;
+        stats.bytesPerSecond = (uint32_t)((uint64_t)statBytes * 1000 / elapsed);
+        stats.skipped = statSkipped;
+        stats.ticks = statTicks;
+        stats.renderMicros = statTicks ? statRenderMicros / statTicks : 0;
+        stats.pushMicros = statFrames ? statPushMicros / statFrames : 0;
+        stats.frameMicrosMax = statFrameMax;
+        stats.budgetMicros = frameInterval * 1000UL;
+        stats.dma = dmaEnabled;
+        statFrames = statBytes = statSkipped = statTicks = 0;
+        statRenderMicros = statPushMicros = statFrameMax = 0;
+        statTimer = millis();
+      }
+    }
+
+    // Milliseconds until update() has something new to draw: the rest of
+    // the frame interval while a transition runs, otherwise the next
+    // scheduled event (blink, reopen, idle move, shake phase, end of
+    // laugh/confused). Setters called from input handlers change the
+    // answer: call it again after handling input.
+    uint32_t nextFrameIn() {
+      unsigned long now = millis();
+      unsigned long interval = frameIntervalNow();
+      uint32_t frameWait = now - fpsTimer >= interval ? 0 : interval - (now - fpsTimer);
+      if (fullRedraw || transitionPending(tweenNow())) return frameWait;
+
+      uint32_t wait = ROBOEYES_PACE_MAX_MS;
+      if (hFlicker || vFlicker) {
+        wait = ROBOEYES_FLICKER_MS - (uint32_t)((tweenNow() / 1000) % ROBOEYES_FLICKER_MS);
+      }
+      if (laugh) wait = min(wait, laughToggle ? 0 : untilMs(laughAnimationTimer + laughAnimationDuration, now));
+      if (confused) wait = min(wait, confusedToggle ? 0 : untilMs(confusedAnimationTimer + confusedAnimationDuration, now));
+      if (autoblinker && !blinkingActive) wait = min(wait, untilMs(blinktimer, now));
+      if (blinkingActive) wait = min(wait, untilMs(blinkCloseDurationTimer, now));
+      if (idle) wait = min(wait, untilMs(idleAnimationTimer, now));
+      return max(wait, frameWait);
+    }
+
+    // Force a full redraw and push on the next frame (call after something
+    // else drew over the eyes area, e.g. tft.fillScreen())
+    void invalidate() {
+      fullRedraw = true;
+    }
+
+    const RenderStats& getRenderStats() const {
+      return stats;
+    }
+
+    // Sprite buffer size in bytes
+    uint32_t spriteBytes() const {
+      return (uint32_t)canvasWidth() * screenHeight * ROBOEYES_COLOR_DEPTH / 8;
+    }
+
+    // Heap currently held: sprite plus DMA buffers (0 after releaseCanvas())
+    uint32_t bufferBytes() const {
+      uint32_t bytes = canvasReady() ? spriteBytes() : 0;
+#if ROBOEYES_DMA
+      for (uint8_t i = 0; i < 2; i++) {
+        if (dmaBuffers[i]) bytes += ROBOEYES_DMA_PIXELS * sizeof(uint16_t);
+      }
+#endif
+      return bytes;
     }
 
     // Set the target frame rate (fps)
@@ -259,11 +502,12 @@ class TFT_RoboEyes {
       eyeLyNext = eyeLyDefault;
       eyeRxNext = eyeRxDefault;
       eyeRyNext = eyeRyDefault;
-      // Recreate sprite with new dimensions
-      if(sprite) {
+      // Recreate sprite with new dimensions (unless released)
+      if(canvasReady()) {
         sprite->deleteSprite();
-        sprite->createSprite(screenWidth, screenHeight);
+        createCanvas();
       }
+      invalidate();
     }
 
     // Customization methods
@@ -395,6 +639,8 @@ class TFT_RoboEyes {
     void setColors(uint16_t main, uint16_t background) {
       mainColor = main;
       bgColor = background;
+      applyColors();
+      invalidate();
     }
 
     // ---------------------------
@@ -461,9 +707,292 @@ class TFT_RoboEyes {
     }
 
   private:
+    struct Rect {
+      int16_t x, y, w, h;
+    };
+
+    // Everything that affects the pixels of a frame (compared to skip frames)
+    struct FrameState {
+      int16_t lx, ly, lw, lh, rx, ry, rw, rh;
+      uint8_t lr, rr, tiredH, angryH, happyOff, cyclops;
+      uint16_t main, bg;
+    };
+
+    // Time-based transitions (one per animated property)
+    enum TweenId {
+      TW_X, TW_Y,                       // left eye position (right eye follows)
+      TW_LW, TW_LH, TW_LR,              // left eye width, height, border radius
+      TW_RW, TW_RH, TW_RR,              // right eye
+      TW_SPACE,
+      TW_TIRED, TW_ANGRY, TW_HAPPY,     // eyelid weights, 0..MOOD_WEIGHT
+      TW_COUNT
+    };
+    static const int32_t MOOD_WEIGHT = 256;
+    Tween tweens[TW_COUNT];
+
+    void snapTweens() {
+      tweens[TW_X].snap(eyeLx);
+      tweens[TW_Y].snap(eyeLy);
+      tweens[TW_LW].snap(eyeLwidthCurrent);
+      tweens[TW_LH].snap(eyeLheightCurrent);
+      tweens[TW_LR].snap(eyeLborderRadiusCurrent);
+      tweens[TW_RW].snap(eyeRwidthCurrent);
+      tweens[TW_RH].snap(eyeRheightCurrent);
+      tweens[TW_RR].snap(eyeRborderRadiusCurrent);
+      tweens[TW_SPACE].snap(spaceBetweenCurrent);
+      tweens[TW_TIRED].snap(0);
+      tweens[TW_ANGRY].snap(0);
+      tweens[TW_HAPPY].snap(0);
+    }
+
+    // Full rate while shaking (laugh/confused), calm rate otherwise
+    unsigned long frameIntervalNow() const {
+      if (hFlicker || vFlicker || laugh || confused) return frameInterval;
+      return max<unsigned long>(frameInterval, 1000 / ROBOEYES_CALM_FPS);
+    }
+
+    static uint32_t untilMs(unsigned long deadline, unsigned long now) {
+      return (long)(deadline - now) > 0 ? deadline - now : 0;
+    }
+
+    // A transition is running, or a target changed since the last
+    // drawEyes() (blink, idle move, setters) and starts on the next frame
+    bool transitionPending(int64_t now) const {
+      for (uint8_t i = 0; i < TW_COUNT; i++) {
+        if (!tweens[i].done(now)) return true;
+      }
+      if (tweens[TW_LH].to != eyeLheightNext + eyeLheightOffset ||
+          tweens[TW_RH].to != eyeRheightNext + eyeRheightOffset ||
+          tweens[TW_LW].to != eyeLwidthNext || tweens[TW_RW].to != eyeRwidthNext ||
+          tweens[TW_LR].to != eyeLborderRadiusNext || tweens[TW_RR].to != eyeRborderRadiusNext ||
+          tweens[TW_SPACE].to != spaceBetweenNext ||
+          tweens[TW_X].to != eyeLxNext || tweens[TW_Y].to != eyeLyNext) {
+        return true;
+      }
+      if (tweens[TW_TIRED].to != (tired && !angry ? MOOD_WEIGHT : 0) ||
+          tweens[TW_ANGRY].to != (angry ? MOOD_WEIGHT : 0) ||
+          tweens[TW_HAPPY].to != (happy ? MOOD_WEIGHT : 0)) {
+        return true;
+      }
+      // Reopening after a blink sets the height target inside drawEyes()
+      return (eyeL_open && eyeLheightCurrent <= 1 + eyeLheightOffset && eyeLheightNext != eyeLheightDefault) ||
+             (eyeR_open && eyeRheightCurrent <= 1 + eyeRheightOffset && eyeRheightNext != eyeRheightDefault);
+    }
+
+    bool fullRedraw = true;
+    Rect lastBox = { 0, 0, 0, 0 };   // eye pixels of the last pushed frame
+    FrameState lastState;
+
+    RenderStats stats = { 0, 0, 0, 0, 0, 0, 0, 0, false };
+    unsigned long statTimer = 0;
+    uint32_t statBytes = 0;
+    uint16_t statFrames = 0, statSkipped = 0, statTicks = 0;
+    uint32_t statRenderMicros = 0, statPushMicros = 0, statFrameMax = 0;
+
+    uint16_t* dmaBuffers[2] = { NULL, NULL };
+    // Sprite value -> RGB565 with bytes swapped (panel order)
+#if ROBOEYES_COLOR_DEPTH == 8
+    uint16_t dmaLut[256];       // RGB332 byte -> pixel
+#elif ROBOEYES_COLOR_DEPTH == 4
+    uint16_t dmaLut[256][2];    // byte -> 2 pixels (high nibble first)
+    uint16_t dmaPalette[16];    // nibble -> pixel (odd edges)
+#else
+    uint16_t dmaLut[16][4];     // nibble -> 4 pixels (MSB first)
+    uint16_t dmaBit[2];         // bit -> pixel (unaligned edges)
+#endif
+    bool lutDirty = true;       // colors changed since buildLut()
+    uint8_t dmaCurrent = 0;     // buffer the next band is expanded into
+    bool dmaEnabled = false;
+    bool dmaPending = false;    // write transaction open, last band may be in flight
+
+    // Value drawn on the sprite: the color at 8 bpp, a palette index at 4 bpp
+    // (0 = background, 15 = eyes, 1..14 = edge blend), a bit at 1 bpp
+    uint16_t ink(bool eye) const {
+#if ROBOEYES_COLOR_DEPTH == 8
+      return eye ? mainColor : bgColor;
+#elif ROBOEYES_COLOR_DEPTH == 4
+      return eye ? 15 : 0;
+#else
+      return eye ? 1 : 0;
+#endif
+    }
+
+    // Sprite width: 1/4 bpp rows rounded up to whole bytes (multiple of 8
+    // pixels), so every row starts on a byte; the extra columns stay
+    // background and are never pushed
+    int canvasWidth() const {
+      return ROBOEYES_COLOR_DEPTH == 8 ? screenWidth : (screenWidth + 7) & ~7;
+    }
+
+    void createCanvas() {
+      sprite->createSprite(canvasWidth(), screenHeight);
+#if ROBOEYES_COLOR_DEPTH == 4
+      sprite->createPalette(NULL, 16);
+#endif
+      applyColors();
+      sprite->fillSprite(ink(false));
+      invalidate();
+    }
+
+    // Colors used by pushSprite() and by the DMA expansion table
+    void applyColors() {
+      if (sprite) {
+#if ROBOEYES_COLOR_DEPTH == 4
+        for (uint8_t i = 0; i < 16; i++) {
+          sprite->setPaletteColor(i, tft->alphaBlend(i * 17, mainColor, bgColor));
+        }
+#elif ROBOEYES_COLOR_DEPTH == 1
+        sprite->setBitmapColor(mainColor, bgColor);
+#endif
+      }
+      lutDirty = true;
+    }
+
+    void buildLut() {
+#if ROBOEYES_COLOR_DEPTH == 8
+      for (uint16_t c = 0; c < 256; c++) {
+        uint16_t color = tft->color8to16(c);
+        dmaLut[c] = (color >> 8) | (color << 8);
+      }
+#elif ROBOEYES_COLOR_DEPTH == 4
+      for (uint8_t i = 0; i < 16; i++) {
+        uint16_t color = tft->alphaBlend(i * 17, mainColor, bgColor);
+        dmaPalette[i] = (color >> 8) | (color << 8);
+      }
+      for (uint16_t b = 0; b < 256; b++) {
+        dmaLut[b][0] = dmaPalette[b >> 4];
+        dmaLut[b][1] = dmaPalette[b & 0x0F];
+      }
+#else
+      dmaBit[0] = (bgColor >> 8) | (bgColor << 8);
+      dmaBit[1] = (mainColor >> 8) | (mainColor << 8);
+      for (uint8_t n = 0; n < 16; n++) {
+        for (uint8_t i = 0; i < 4; i++) dmaLut[n][i] = dmaBit[(n >> (3 - i)) & 1];
+      }
+#endif
+      lutDirty = false;
+    }
+
+    // Expand w pixels of sprite row y from x to RGB565 (panel byte order)
+    void expandRow(uint16_t* out, int16_t y, int16_t x, int16_t w) const {
+      const uint8_t* src = (const uint8_t*)sprite->getPointer();
+#if ROBOEYES_COLOR_DEPTH == 8
+      const uint8_t* line = src + y * canvasWidth() + x;
+      for (int16_t i = 0; i < w; i++) *out++ = dmaLut[line[i]];
+#elif ROBOEYES_COLOR_DEPTH == 4
+      const uint8_t* line = src + (y * canvasWidth() + x) / 2;
+      if (x & 1) {
+        *out++ = dmaPalette[*line++ & 0x0F];
+        w--;
+      }
+      for (; w >= 2; w -= 2, out += 2) memcpy(out, dmaLut[*line++], 2 * sizeof(uint16_t));
+      if (w) *out = dmaPalette[*line >> 4];
+#else
+      const uint8_t* line = src + (y * canvasWidth() + x) / 8;
+      uint8_t bit = x & 7;
+      for (; bit && w > 0; bit = (bit + 1) & 7, w--) {
+        *out++ = dmaBit[(*line >> (7 - bit)) & 1];
+        if (bit == 7) line++;
+      }
+      for (; w >= 8; w -= 8, out += 8, line++) {
+        memcpy(out, dmaLut[*line >> 4], 4 * sizeof(uint16_t));
+        memcpy(out + 4, dmaLut[*line & 0x0F], 4 * sizeof(uint16_t));
+      }
+      for (uint8_t i = 0; i < w; i++) *out++ = dmaBit[(*line >> (7 - i)) & 1];
+#endif
+    }
+
+    // Eye body. At 4 bpp the rounded corners get coverage-based edge
+    // indices (anti-aliasing); 1/8 bpp keep the hard TFT_eSPI shape.
+    void fillEye(int x, int y, int w, int h, int r) {
+      sprite->fillRoundRect(x, y, w, h, r, ink(true));
+#if ROBOEYES_COLOR_DEPTH == 4
+      if (r < 2 || 2 * r > w || 2 * r > h) return;   // blink: too thin to matter
+      for (int j = 0; j < r; j++) {
+        for (int i = 0; i < r; i++) {
+          float dx = r - i, dy = r - j;
+          float coverage = r + 0.5f - sqrtf(dx * dx + dy * dy);
+          uint8_t index = coverage <= 0 ? 0 : coverage >= 1 ? 15 : (uint8_t)(coverage * 15 + 0.5f);
+          sprite->drawPixel(x + i, y + j, index);
+          sprite->drawPixel(x + w - 1 - i, y + j, index);
+          sprite->drawPixel(x + i, y + h - 1 - j, index);
+          sprite->drawPixel(x + w - 1 - i, y + h - 1 - j, index);
+        }
+      }
+#endif
+    }
+
+    // Send region r of the sprite in bands of up to ROBOEYES_DMA_PIXELS.
+    // pushImageDMA() waits for the band in flight before queueing, so
+    // expanding one buffer overlaps sending the other. The last band is left
+    // on the bus: the next frame is drawn while it goes out.
+    void pushDMA(const Rect& r) {
+      if (lutDirty) buildLut();
+      int16_t bandLines = max<int16_t>(1, min<int16_t>(r.h, ROBOEYES_DMA_PIXELS / r.w));
+
+      bool swap = tft->getSwapBytes();
+      tft->setSwapBytes(false);   // LUT is already in panel byte order
+      if (!dmaPending) {
+        tft->startWrite();
+        dmaPending = true;
+      }
+      for (int16_t row = 0; row < r.h; row += bandLines) {
+        int16_t lines = min<int16_t>(bandLines, r.h - row);
+        uint16_t* out = dmaBuffers[dmaCurrent];
+        for (int16_t j = 0; j < lines; j++, out += r.w) expandRow(out, r.y + row + j, r.x, r.w);
+        tft->pushImageDMA(ROBOEYES_SPRITE_X + r.x, ROBOEYES_SPRITE_Y + r.y + row,
+                          r.w, lines, dmaBuffers[dmaCurrent]);
+        dmaCurrent ^= 1;
+      }
+      tft->setSwapBytes(swap);
+    }
+
+    static Rect unite(const Rect& a, const Rect& b) {
+      if (a.w <= 0 || a.h <= 0) return b;
+      if (b.w <= 0 || b.h <= 0) return a;
+      int16_t x0 = min(a.x, b.x), y0 = min(a.y, b.y);
+      int16_t x1 = max(a.x + a.w, b.x + b.w), y1 = max(a.y + a.h, b.y + b.h);
+      return { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    }
+
+    Rect clip(Rect r) const {
+      int16_t x1 = min<int16_t>(r.x + r.w, screenWidth), y1 = min<int16_t>(r.y + r.h, screenHeight);
+      r.x = max<int16_t>(r.x, 0);
+      r.y = max<int16_t>(r.y, 0);
+      r.w = max<int16_t>(x1 - r.x, 0);
+      r.h = max<int16_t>(y1 - r.y, 0);
+      return r;
+    }
+
+    // Eye pixels only exist inside the eye rectangles (eyelids draw with the
+    // background color), 1 px margin for the eyelid triangles at y - 1
+    Rect eyesBox() const {
+      Rect box = { (int16_t)(eyeLx - 1), (int16_t)(eyeLy - 1),
+                   (int16_t)(eyeLwidthCurrent + 2), (int16_t)(eyeLheightCurrent + 2) };
+      if (!cyclops) {
+        Rect right = { (int16_t)(eyeRx - 1), (int16_t)(eyeRy - 1),
+                       (int16_t)(eyeRwidthCurrent + 2), (int16_t)(eyeRheightCurrent + 2) };
+        box = unite(box, right);
+      }
+      return clip(box);
+    }
+
+    FrameState frameState() const {
+      FrameState state;
+      memset(&state, 0, sizeof(state));   // padding too: compared with memcmp
+      state.lx = eyeLx; state.ly = eyeLy; state.lw = eyeLwidthCurrent; state.lh = eyeLheightCurrent;
+      state.rx = eyeRx; state.ry = eyeRy; state.rw = eyeRwidthCurrent; state.rh = eyeRheightCurrent;
+      state.lr = eyeLborderRadiusCurrent; state.rr = eyeRborderRadiusCurrent;
+      state.tiredH = eyelidsTiredHeight; state.angryH = eyelidsAngryHeight;
+      state.happyOff = eyelidsHappyBottomOffset; state.cyclops = cyclops;
+      state.main = mainColor; state.bg = bgColor;
+      return state;
+    }
+
     // ---------------------------
     // Core drawing logic – adapts animations and draws the eyes on the sprite.
-    void drawEyes() {
+    // Returns the sprite region to push (w = 0: nothing changed).
+    Rect drawEyes() {
       // --- PRE-CALCULATIONS ---
       if (curious) {
         if (eyeLxNext <= 10) { eyeLheightOffset = 8; }
@@ -476,14 +1005,22 @@ class TFT_RoboEyes {
         eyeRheightOffset = 0;
       }
 
-      // Smooth eye height transition
-      eyeLheightCurrent = (eyeLheightCurrent + eyeLheightNext + eyeLheightOffset) / 2;
-      eyeLy += ((eyeLheightDefault - eyeLheightCurrent) / 2);
-      eyeLy -= eyeLheightOffset / 2;
-
-      eyeRheightCurrent = (eyeRheightCurrent + eyeRheightNext + eyeRheightOffset) / 2;
-      eyeRy += ((eyeRheightDefault - eyeRheightCurrent) / 2);
-      eyeRy -= eyeRheightOffset / 2;
+      // Time-based transitions toward the *Next targets: the value depends
+      // only on the clock, so frame rate changes don't alter the animation
+      int64_t now = tweenNow();
+      tweens[TW_LH].retarget(eyeLheightNext + eyeLheightOffset, now, ROBOEYES_SIZE_MS, EASE_OUT_CUBIC);
+      tweens[TW_RH].retarget(eyeRheightNext + eyeRheightOffset, now, ROBOEYES_SIZE_MS, EASE_OUT_CUBIC);
+      tweens[TW_LW].retarget(eyeLwidthNext, now, ROBOEYES_SIZE_MS, EASE_OUT_CUBIC);
+      tweens[TW_RW].retarget(eyeRwidthNext, now, ROBOEYES_SIZE_MS, EASE_OUT_CUBIC);
+      tweens[TW_LR].retarget(eyeLborderRadiusNext, now, ROBOEYES_SIZE_MS, EASE_OUT_CUBIC);
+      tweens[TW_RR].retarget(eyeRborderRadiusNext, now, ROBOEYES_SIZE_MS, EASE_OUT_CUBIC);
+      tweens[TW_SPACE].retarget(spaceBetweenNext, now, ROBOEYES_SIZE_MS, EASE_OUT_CUBIC);
+      tweens[TW_X].retarget(eyeLxNext, now, ROBOEYES_MOVE_MS, EASE_IN_OUT_QUAD);
+      tweens[TW_Y].retarget(eyeLyNext, now, ROBOEYES_MOVE_MS, EASE_IN_OUT_QUAD);
+
+      // Eye height (blink)
+      eyeLheightCurrent = tweens[TW_LH].value(now);
+      eyeRheightCurrent = tweens[TW_RH].value(now);
 
       if (eyeL_open) {
         if (eyeLheightCurrent <= 1 + eyeLheightOffset) { eyeLheightNext = eyeLheightDefault; }
@@ -492,23 +1029,22 @@ class TFT_RoboEyes {
         if (eyeRheightCurrent <= 1 + eyeRheightOffset) { eyeRheightNext = eyeRheightDefault; }
       }
 
-      // Smooth eye width transition
-      eyeLwidthCurrent = (eyeLwidthCurrent + eyeLwidthNext) / 2;
-      eyeRwidthCurrent = (eyeRwidthCurrent + eyeRwidthNext) / 2;
-      spaceBetweenCurrent = (spaceBetweenCurrent + spaceBetweenNext) / 2;
-
-      // Smooth coordinate transitions
-      eyeLx = (eyeLx + eyeLxNext) / 2;
-      eyeLy = (eyeLy + eyeLyNext) / 2;
-      // Right eye position depends on left eye pos + space + eye width
+      // Eye width, spacing and border radius
+      eyeLwidthCurrent = tweens[TW_LW].value(now);
+      eyeRwidthCurrent = tweens[TW_RW].value(now);
+      spaceBetweenCurrent = tweens[TW_SPACE].value(now);
+      eyeLborderRadiusCurrent = tweens[TW_LR].value(now);
+      eyeRborderRadiusCurrent = tweens[TW_RR].value(now);
+
+      // Coordinates: a shorter eye stays vertically centered on its default
+      // height; the right eye follows the left one
+      int baseY = tweens[TW_Y].value(now);
+      eyeLx = tweens[TW_X].value(now);
+      eyeLy = baseY + (eyeLheightDefault - eyeLheightCurrent) / 2 - eyeLheightOffset / 2;
       eyeRxNext = eyeLxNext + eyeLwidthCurrent + spaceBetweenCurrent;
       eyeRyNext = eyeLyNext;
-      eyeRx = (eyeRx + eyeRxNext) / 2;
-      eyeRy = (eyeRy + eyeRyNext) / 2;
-
-      // Smooth border radius transitions
-      eyeLborderRadiusCurrent = (eyeLborderRadiusCurrent + eyeLborderRadiusNext) / 2;
-      eyeRborderRadiusCurrent = (eyeRborderRadiusCurrent + eyeRborderRadiusNext) / 2;
+      eyeRx = eyeLx + eyeLwidthCurrent + spaceBetweenCurrent;
+      eyeRy = baseY + (eyeRheightDefault - eyeRheightCurrent) / 2 - eyeRheightOffset / 2;
 
       // --- MACRO ANIMATIONS ---
       if (autoblinker && !blinkingActive) {
@@ -556,26 +1092,20 @@ class TFT_RoboEyes {
         }
       }
 
+      // Shake phase comes from the clock too (same speed at any frame rate)
+      bool flickerPhase = (now / (ROBOEYES_FLICKER_MS * 1000LL)) & 1;
       if (hFlicker) {
-        if (hFlickerAlternate) {
-          eyeLx += hFlickerAmplitude;
-          eyeRx += hFlickerAmplitude;
-        } else {
-          eyeLx -= hFlickerAmplitude;
-          eyeRx -= hFlickerAmplitude;
-        }
-        hFlickerAlternate = !hFlickerAlternate;
+        hFlickerAlternate = flickerPhase;
+        int shift = hFlickerAlternate ? hFlickerAmplitude : -hFlickerAmplitude;
+        eyeLx += shift;
+        eyeRx += shift;
       }
 
       if (vFlicker) {
-        if (vFlickerAlternate) {
-          eyeLy += vFlickerAmplitude;
-          eyeRy += vFlickerAmplitude;
-        } else {
-          eyeLy -= vFlickerAmplitude;
-          eyeRy -= vFlickerAmplitude;
-        }
-        vFlickerAlternate = !vFlickerAlternate;
+        vFlickerAlternate = flickerPhase;
+        int shift = vFlickerAlternate ? vFlickerAmplitude : -vFlickerAmplitude;
+        eyeLy += shift;
+        eyeRy += shift;
       }
 
       if (cyclops) {
@@ -584,16 +1114,6 @@ class TFT_RoboEyes {
         spaceBetweenCurrent = 0;
       }
 
-      // --- ACTUAL DRAWINGS ---
-      // Instead of clearing the TFT, clear the sprite to the background color.
-      sprite->fillSprite(bgColor);
-
-      // Draw eyes onto the sprite
-      sprite->fillRoundRect(eyeLx, eyeLy, eyeLwidthCurrent, eyeLheightCurrent, eyeLborderRadiusCurrent, mainColor);
-      if (!cyclops) {
-        sprite->fillRoundRect(eyeRx, eyeRy, eyeRwidthCurrent, eyeRheightCurrent, eyeRborderRadiusCurrent, mainColor);
-      }
-
       // Prepare mood transitions: tired, angry, happy
       if (tired) { 
         eyelidsTiredHeightNext = eyeLheightCurrent / 2; 
@@ -612,43 +1132,74 @@ class TFT_RoboEyes {
       } else { 
         eyelidsHappyBottomOffsetNext = 0; 
       }
+      // Moods fade in/out as a weight applied to half the current eye height
+      tweens[TW_TIRED].retarget(tired && !angry ? MOOD_WEIGHT : 0, now, ROBOEYES_MOOD_MS, EASE_IN_OUT_QUAD);
+      tweens[TW_ANGRY].retarget(angry ? MOOD_WEIGHT : 0, now, ROBOEYES_MOOD_MS, EASE_IN_OUT_QUAD);
+      tweens[TW_HAPPY].retarget(happy ? MOOD_WEIGHT : 0, now, ROBOEYES_MOOD_MS, EASE_IN_OUT_QUAD);
+      eyelidsTiredHeight = (eyeLheightCurrent / 2) * tweens[TW_TIRED].value(now) / MOOD_WEIGHT;
+      eyelidsAngryHeight = (eyeLheightCurrent / 2) * tweens[TW_ANGRY].value(now) / MOOD_WEIGHT;
+      eyelidsHappyBottomOffset = (eyeLheightCurrent / 2) * tweens[TW_HAPPY].value(now) / MOOD_WEIGHT;
+
+      // --- DAMAGE TRACKING ---
+      FrameState state = frameState();
+      Rect box = eyesBox();
+      Rect dirty;
+      if (fullRedraw || !ROBOEYES_DIRTY_RECTS) {
+        dirty = { 0, 0, (int16_t)screenWidth, (int16_t)screenHeight };
+        fullRedraw = false;
+      } else if (memcmp(&state, &lastState, sizeof(state)) == 0) {
+        return { 0, 0, 0, 0 };   // identical frame: nothing to draw or push
+      } else {
+        dirty = clip(unite(lastBox, box));
+      }
+      lastState = state;
+      lastBox = box;
+
+      // --- ACTUAL DRAWINGS ---
+      // Outside the old and new eye boxes the sprite is already background:
+      // clear only the damaged region.
+      sprite->fillRect(dirty.x, dirty.y, dirty.w, dirty.h, ink(false));
+
+      // Draw eyes onto the sprite
+      fillEye(eyeLx, eyeLy, eyeLwidthCurrent, eyeLheightCurrent, eyeLborderRadiusCurrent);
+      if (!cyclops) {
+        fillEye(eyeRx, eyeRy, eyeRwidthCurrent, eyeRheightCurrent, eyeRborderRadiusCurrent);
+      }
 
       // Tired eyelids
-      eyelidsTiredHeight = (eyelidsTiredHeight + eyelidsTiredHeightNext) / 2;
       if (!cyclops) {
         sprite->fillTriangle(eyeLx, eyeLy - 1, eyeLx + eyeLwidthCurrent, eyeLy - 1,
-                              eyeLx, eyeLy + eyelidsTiredHeight - 1, bgColor);
+                              eyeLx, eyeLy + eyelidsTiredHeight - 1, ink(false));
         sprite->fillTriangle(eyeRx, eyeRy - 1, eyeRx + eyeRwidthCurrent, eyeRy - 1,
-                              eyeRx + eyeRwidthCurrent, eyeRy + eyelidsTiredHeight - 1, bgColor);
+                              eyeRx + eyeRwidthCurrent, eyeRy + eyelidsTiredHeight - 1, ink(false));
       } else {
         sprite->fillTriangle(eyeLx, eyeLy - 1, eyeLx + (eyeLwidthCurrent / 2), eyeLy - 1,
-                              eyeLx, eyeLy + eyelidsTiredHeight - 1, bgColor);
+                              eyeLx, eyeLy + eyelidsTiredHeight - 1, ink(false));
         sprite->fillTriangle(eyeLx + (eyeLwidthCurrent / 2), eyeLy - 1, eyeLx + eyeLwidthCurrent, eyeLy - 1,
-                              eyeLx + eyeLwidthCurrent, eyeLy + eyelidsTiredHeight - 1, bgColor);
+                              eyeLx + eyeLwidthCurrent, eyeLy + eyelidsTiredHeight - 1, ink(false));
       }
 
       // Angry eyelids
-      eyelidsAngryHeight = (eyelidsAngryHeight + eyelidsAngryHeightNext) / 2;
       if (!cyclops) {
         sprite->fillTriangle(eyeLx, eyeLy - 1, eyeLx + eyeLwidthCurrent, eyeLy - 1,
-                              eyeLx + eyeLwidthCurrent, eyeLy + eyelidsAngryHeight - 1, bgColor);
+                              eyeLx + eyeLwidthCurrent, eyeLy + eyelidsAngryHeight - 1, ink(false));
         sprite->fillTriangle(eyeRx, eyeRy - 1, eyeRx + eyeRwidthCurrent, eyeRy - 1,
-                              eyeRx, eyeRy + eyelidsAngryHeight - 1, bgColor);
+                              eyeRx, eyeRy + eyelidsAngryHeight - 1, ink(false));
       } else {
         sprite->fillTriangle(eyeLx, eyeLy - 1, eyeLx + (eyeLwidthCurrent / 2), eyeLy - 1,
-                              eyeLx + (eyeLwidthCurrent / 2), eyeLy + eyelidsAngryHeight - 1, bgColor);
+                              eyeLx + (eyeLwidthCurrent / 2), eyeLy + eyelidsAngryHeight - 1, ink(false));
         sprite->fillTriangle(eyeLx + (eyeLwidthCurrent / 2), eyeLy - 1, eyeLx + eyeLwidthCurrent, eyeLy - 1,
-                              eyeLx + eyeLwidthCurrent, eyeLy + eyelidsAngryHeight - 1, bgColor);
+                              eyeLx + eyeLwidthCurrent, eyeLy + eyelidsAngryHeight - 1, ink(false));
       }
 
       // Happy (bottom) eyelids
-      eyelidsHappyBottomOffset = (eyelidsHappyBottomOffset + eyelidsHappyBottomOffsetNext) / 2;
       sprite->fillRoundRect(eyeLx - 1, (eyeLy + eyeLheightCurrent) - eyelidsHappyBottomOffset + 1,
-                              eyeLwidthCurrent + 2, eyeLheightDefault, eyeLborderRadiusCurrent, bgColor);
+                              eyeLwidthCurrent + 2, eyeLheightDefault, eyeLborderRadiusCurrent, ink(false));
       if (!cyclops) {
         sprite->fillRoundRect(eyeRx - 1, (eyeRy + eyeRheightCurrent) - eyelidsHappyBottomOffset + 1,
-                              eyeRwidthCurrent + 2, eyeRheightDefault, eyeRborderRadiusCurrent, bgColor);
+                              eyeRwidthCurrent + 2, eyeRheightDefault, eyeRborderRadiusCurrent, ink(false));
       }
+      return dirty;
     } // end drawEyes
 
 }; // end class TFT_RoboEyes
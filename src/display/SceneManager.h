@@ -0,0 +1,121 @@
+/**
+ * Cenas da tela sem delay(): olhos, recompensa, QR Code, admin...
+ *
+ * Cada cena tem ganchos enter/update/exit. go() só agenda a troca (já ou
+ * daqui a N ms) e retorna; tick(), chamado a cada passagem do loop(), faz
+ * a troca vencida (exit da atual, prepare, enter da nova) e chama update()
+ * da cena ativa. Esperas viram tempo dentro da cena (elapsed()) ou uma
+ * troca agendada, nunca um delay(): UART e toque continuam sendo lidos, e
+ * uma tag que chega no meio de uma transição é tratada na passagem
+ * seguinte (go() substitui a troca pendente).
+ *
+ *   const Scenes::Scene table[MODE_COUNT] = {
+ *     { "olhos", eyesEnter, eyesUpdate, NULL },
+ *     ...
+ *   };
+ *   scenes.begin(table, EYES_MODE, prepareScene);
+ *   scenes.go(COIN_MODE, 500);            // olhos reagem antes da moeda
+ *   uint32_t sleepMs = scenes.tick();     // no loop()
+ *
+ * update() recebe os ms desde o enter e retorna quanto a cena pode ficar
+ * sem ser chamada; tick() devolve o menor entre isso e a próxima troca
+ * agendada (sono do FramePacer). Tempos com millis() em subtração: a volta
+ * do contador (49 dias) não dispara nem atrasa trocas.
+ */
+
+#ifndef SCENE_MANAGER_H
+#define SCENE_MANAGER_H
+
+#include <Arduino.h>
+
+template <typename Id, uint8_t Count>
+class SceneManager {
+public:
+  struct Scene {
+    const char* name;
+    void (*enter)();
+    uint32_t (*update)(uint32_t elapsedMs);   // NULL = cena estática
+    void (*exit)();
+  };
+
+  // Entre o exit de uma cena e o enter da próxima (DMA, memória)
+  typedef void (*PrepareHook)(Id next);
+
+private:
+  const Scene* scenes = NULL;
+  PrepareHook prepare = NULL;
+  Id active = (Id)0;
+  Id next = (Id)0;
+  bool pending = false;
+  uint32_t pendingSince = 0;
+  uint32_t pendingDelay = 0;
+  uint32_t enteredAt = 0;
+
+  bool due() const {
+    return pending && millis() - pendingSince >= pendingDelay;
+  }
+
+  void switchNow(bool first) {
+    Id from = active;
+    pending = false;
+    if (!first && scenes[from].exit) scenes[from].exit();
+    active = next;
+    enteredAt = millis();
+    if (first) {
+      Serial.printf("🎬 Cena: %s\n", scenes[active].name);
+    } else {
+      Serial.printf("🎬 Cena: %s → %s\n", scenes[from].name, scenes[active].name);
+    }
+    if (prepare) prepare(active);
+    if (scenes[active].enter) scenes[active].enter();
+  }
+
+public:
+  /**
+   * Entra na cena inicial (chamar no fim do setup())
+   */
+  void begin(const Scene (&table)[Count], Id initial, PrepareHook hook = NULL) {
+    scenes = table;
+    prepare = hook;
+    next = initial;
+    switchNow(true);
+  }
+
+  /**
+   * Agenda a troca para a cena id daqui a delayMs (0 = próxima passagem).
+   * Substitui uma troca pendente; ir para a cena atual reinicia a cena.
+   */
+  void go(Id id, uint32_t delayMs = 0) {
+    next = id;
+    pendingSince = millis();
+    pendingDelay = delayMs;
+    pending = true;
+  }
+
+  Id current() const { return active; }
+
+  /**
+   * ms desde o enter da cena atual
+   */
+  uint32_t elapsed() const { return millis() - enteredAt; }
+
+  /**
+   * Faz a troca vencida e atualiza a cena ativa. Retorna quantos ms o
+   * loop() pode dormir (UINT32_MAX = nada agendado).
+   */
+  uint32_t tick() {
+    // Um enter pode agendar outra troca imediata (ex.: QR Code indisponível)
+    for (uint8_t i = 0; i < Count && due(); i++) switchNow(false);
+
+    uint32_t sleepMs = UINT32_MAX;
+    if (scenes[active].update) sleepMs = scenes[active].update(elapsed());
+
+    if (pending) {
+      uint32_t waited = millis() - pendingSince;
+      sleepMs = min(sleepMs, waited >= pendingDelay ? 0 : pendingDelay - waited);
+    }
+    return sleepMs;
+  }
+};
+
+#endif // SCENE_MANAGER_H
@@ -0,0 +1,338 @@
+/**
+ * Texto suave (anti-aliasing) com fonte VLW da flash
+ *
+ * A fonte é um .vlw (formato do Processing/TFT_eSPI) compilado em PROGMEM
+ * (assets/fonts → generated/, ver scripts/build_assets.py): alfa de 8 bits
+ * por pixel, UTF-8 com os acentos do português (ã, ç, ê, ...). Só a caixa
+ * do texto vai para o TFT, em faixas de até TEXT_BAND_PIXELS pixels já
+ * misturadas com a cor de fundo: nada de fillScreen() por mensagem.
+ *
+ *   SmoothText text(tft);
+ *   text.begin(DejaVuSans20_vlw, DEJAVUSANS20_VLW_SIZE);
+ *   TextBox box = text.drawCentered("Seu quinhão!", 120, 80, TFT_WHITE, TFT_BLACK);
+ *   // Troca do texto: apaga o que sobrar da caixa anterior na mesma passada
+ *   box = text.drawCentered("Backup: 50%", 120, 80, TFT_WHITE, TFT_BLACK, &box);
+ *
+ * Os alfas dos glifos usados ficam num cache LRU em RAM (TEXT_CACHE_SLOTS
+ * de TEXT_CACHE_SLOT_BYTES): cada faixa relê os glifos da linha, e da RAM
+ * isso não disputa o cache da flash com o código. Glifo maior que o slot é
+ * lido direto da flash.
+ *
+ * Desenha direto no TFT: chamar com o DMA parado (finishDisplayDMA()).
+ */
+
+#ifndef SMOOTH_TEXT_H
+#define SMOOTH_TEXT_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#ifndef TEXT_CACHE_SLOTS
+  #define TEXT_CACHE_SLOTS 16
+#endif
+// Glifo de 20 px: até ~14x18 = 252 bytes (maiores, como '@', vêm da flash)
+#ifndef TEXT_CACHE_SLOT_BYTES
+  #define TEXT_CACHE_SLOT_BYTES 256
+#endif
+// Faixa enviada por pushImage() (RGB565): 2048 px = 4 KB
+#ifndef TEXT_BAND_PIXELS
+  #define TEXT_BAND_PIXELS 2048
+#endif
+
+#define VLW_HEADER_BYTES 24
+#define VLW_GLYPH_BYTES 28
+
+/**
+ * Área desenhada na tela (para apagar/trocar o texto depois)
+ */
+struct TextBox {
+  int16_t x, y, w, h;
+
+  bool empty() const { return w <= 0 || h <= 0; }
+};
+
+class SmoothText {
+public:
+  struct Stats {
+    uint32_t hits;         // glifo já no cache
+    uint32_t misses;       // copiado da flash para o cache
+    uint32_t uncached;     // maior que o slot: lido da flash
+    uint32_t pixels;       // pixels enviados ao TFT
+  };
+
+private:
+  struct Glyph {
+    int16_t width, height;
+    int16_t advance;
+    int16_t top;           // pixels acima da linha de base
+    int16_t left;
+    const uint8_t* alpha;  // na flash
+  };
+
+  struct Slot {
+    uint32_t code;         // 0 = vazio
+    uint32_t used;         // relógio do LRU
+    uint8_t alpha[TEXT_CACHE_SLOT_BYTES];
+  };
+
+  TFT_eSPI& tft;
+  const uint8_t* font = NULL;
+  uint16_t count = 0;
+  uint32_t* bitmaps = NULL;   // offset do alfa de cada glifo
+  int16_t ascent = 0;         // maior topo entre os glifos
+  int16_t descent = 0;        // maior parte abaixo da linha de base
+  int16_t fallbackAdvance = 0;
+
+  Slot cache[TEXT_CACHE_SLOTS];
+  uint32_t clock = 0;
+  uint16_t band[TEXT_BAND_PIXELS];
+  Stats stats = { 0, 0, 0, 0 };
+
+  // VLW é big-endian
+  int32_t field(uint32_t offset) const {
+    return (int32_t)(((uint32_t)pgm_read_byte(font + offset) << 24) |
+                     ((uint32_t)pgm_read_byte(font + offset + 1) << 16) |
+                     ((uint32_t)pgm_read_byte(font + offset + 2) << 8) |
+                     pgm_read_byte(font + offset + 3));
+  }
+
+  int32_t glyphField(uint16_t index, uint8_t field4) const {
+    return field(VLW_HEADER_BYTES + (uint32_t)index * VLW_GLYPH_BYTES + field4 * 4);
+  }
+
+  void load(uint16_t index, Glyph& out) const {
+    out.height = glyphField(index, 1);
+    out.width = glyphField(index, 2);
+    out.advance = glyphField(index, 3);
+    out.top = glyphField(index, 4);
+    out.left = glyphField(index, 5);
+    out.alpha = font + bitmaps[index];
+  }
+
+  // Glifos em ordem de código: busca binária
+  bool find(uint32_t code, Glyph& out) const {
+    int32_t lo = 0, hi = (int32_t)count - 1;
+    while (lo <= hi) {
+      int32_t mid = (lo + hi) / 2;
+      uint32_t midCode = glyphField(mid, 0);
+      if (midCode == code) {
+        load(mid, out);
+        return true;
+      }
+      if (midCode < code) lo = mid + 1;
+      else hi = mid - 1;
+    }
+    return false;
+  }
+
+  // Glifo do código; sem ele, '?' (ou só o avanço)
+  bool lookup(uint32_t code, Glyph& out) const {
+    if (find(code, out) || find('?', out)) return true;
+    out.width = out.height = 0;
+    out.advance = fallbackAdvance;
+    out.top = out.left = 0;
+    out.alpha = NULL;
+    return false;
+  }
+
+  // Próximo código UTF-8 (sequência inválida = U+FFFD)
+  static uint32_t next(const char*& s) {
+    uint8_t c = (uint8_t)*s++;
+    if (c < 0x80) return c;
+    uint8_t extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+    if (extra == 0) return 0xFFFD;
+    uint32_t code = c & (0x3F >> extra);
+    for (uint8_t i = 0; i < extra; i++) {
+      if (((uint8_t)*s & 0xC0) != 0x80) return 0xFFFD;
+      code = (code << 6) | ((uint8_t)*s++ & 0x3F);
+    }
+    return code;
+  }
+
+  // Alfa do glifo: do cache (LRU) ou copiado da flash para ele
+  const uint8_t* alphaOf(uint32_t code, const Glyph& g) {
+    uint32_t size = (uint32_t)g.width * g.height;
+    if (size > TEXT_CACHE_SLOT_BYTES) {
+      stats.uncached++;
+      return g.alpha;
+    }
+    Slot* victim = &cache[0];
+    for (uint8_t i = 0; i < TEXT_CACHE_SLOTS; i++) {
+      Slot& slot = cache[i];
+      if (slot.code == code) {
+        slot.used = ++clock;
+        stats.hits++;
+        return slot.alpha;
+      }
+      if (slot.used < victim->used) victim = &slot;
+    }
+    memcpy_P(victim->alpha, g.alpha, size);
+    victim->code = code;
+    victim->used = ++clock;
+    stats.misses++;
+    return victim->alpha;
+  }
+
+  // fg sobre bg com alfa de 0 a 32 (campos RGB565 separados num uint32_t)
+  static uint16_t blend(uint16_t fg, uint16_t bg, uint8_t alpha32) {
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t mixed = ((((f - b) * alpha32) >> 5) + b) & 0x07E0F81F;
+    return (uint16_t)(mixed | (mixed >> 16));
+  }
+
+  // Avanço total e tinta (pixels fora do avanço: itálico, 'j')
+  void measure(const char* text, int16_t& advance, int16_t& inkLeft, int16_t& inkRight) const {
+    advance = inkLeft = inkRight = 0;
+    Glyph g;
+    for (const char* s = text; *s; ) {
+      lookup(next(s), g);
+      if (g.width > 0) {
+        inkLeft = min<int16_t>(inkLeft, advance + g.left);
+        inkRight = max<int16_t>(inkRight, advance + g.left + g.width);
+      }
+      advance += g.advance;
+    }
+    inkRight = max(inkRight, advance);
+  }
+
+public:
+  explicit SmoothText(TFT_eSPI& display) : tft(display) {}
+
+  /**
+   * Lê a tabela de glifos do .vlw (em PROGMEM). false = arquivo inválido
+   */
+  bool begin(const uint8_t* vlw, uint32_t size) {
+    font = vlw;
+    if (size < VLW_HEADER_BYTES) return false;
+    int32_t glyphs = field(0);
+    if (glyphs <= 0 || glyphs > 0xFFFF ||
+        VLW_HEADER_BYTES + (uint32_t)glyphs * VLW_GLYPH_BYTES > size) return false;
+
+    free(bitmaps);
+    bitmaps = (uint32_t*)malloc(glyphs * sizeof(uint32_t));
+    if (bitmaps == NULL) return false;
+    count = glyphs;
+
+    // Alfas na ordem dos glifos, logo depois da tabela
+    uint32_t offset = VLW_HEADER_BYTES + (uint32_t)count * VLW_GLYPH_BYTES;
+    ascent = field(16);
+    descent = field(20);
+    for (uint16_t i = 0; i < count; i++) {
+      int32_t height = glyphField(i, 1), width = glyphField(i, 2), top = glyphField(i, 4);
+      bitmaps[i] = offset;
+      offset += (uint32_t)width * height;
+      ascent = max<int16_t>(ascent, top);
+      descent = max<int16_t>(descent, height - top);
+    }
+    if (offset > size) {
+      count = 0;
+      return false;
+    }
+
+    Glyph space;
+    fallbackAdvance = find(' ', space) ? space.advance : field(8) / 4;
+    for (uint8_t i = 0; i < TEXT_CACHE_SLOTS; i++) cache[i].code = cache[i].used = 0;
+    clock = 0;
+    return true;
+  }
+
+  bool ready() const { return count > 0; }
+
+  int16_t lineHeight() const { return ascent + descent; }
+
+  int16_t textWidth(const char* text) const {
+    int16_t advance, inkLeft, inkRight;
+    measure(text, advance, inkLeft, inkRight);
+    return advance;
+  }
+
+  /**
+   * Texto centrado em (cx, cy), fg sobre bg. erase: caixa de um texto
+   * anterior, apagada junto (só a união das duas vai para o TFT).
+   * Retorna a caixa deste texto.
+   */
+  TextBox drawCentered(const char* text, int16_t cx, int16_t cy, uint16_t fg, uint16_t bg,
+                       const TextBox* erase = NULL) {
+    if (!ready() || text == NULL) text = "";
+
+    int16_t advance, inkLeft, inkRight;
+    measure(text, advance, inkLeft, inkRight);
+    int16_t originX = cx - advance / 2;
+    int16_t baseline = cy - lineHeight() / 2 + ascent;
+    TextBox box = { (int16_t)(originX + inkLeft), (int16_t)(cy - lineHeight() / 2),
+                    (int16_t)(inkRight - inkLeft), lineHeight() };
+    if (*text == 0) box.w = 0;
+
+    // União com a caixa anterior, dentro da tela
+    int16_t x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+    if (!box.empty()) {
+      x0 = box.x;
+      y0 = box.y;
+      x1 = box.x + box.w;
+      y1 = box.y + box.h;
+    }
+    if (erase && !erase->empty()) {
+      x0 = min(x0, erase->x);
+      y0 = min(y0, erase->y);
+      x1 = max<int16_t>(x1, erase->x + erase->w);
+      y1 = max<int16_t>(y1, erase->y + erase->h);
+    }
+    x0 = max<int16_t>(x0, 0);
+    y0 = max<int16_t>(y0, 0);
+    x1 = min<int16_t>(x1, tft.width());
+    y1 = min<int16_t>(y1, tft.height());
+    int16_t areaW = x1 - x0;
+    if (areaW <= 0 || y1 <= y0) return box;
+    if (areaW > TEXT_BAND_PIXELS) areaW = TEXT_BAND_PIXELS;
+
+    uint16_t ramp[33];
+    for (uint8_t i = 0; i <= 32; i++) ramp[i] = blend(fg, bg, i);
+
+    bool swap = tft.getSwapBytes();
+    tft.setSwapBytes(true);
+    tft.startWrite();
+    int16_t rowsPerBand = TEXT_BAND_PIXELS / areaW;
+    for (int16_t bandY = y0; bandY < y1; bandY += rowsPerBand) {
+      int16_t rows = min<int16_t>(rowsPerBand, y1 - bandY);
+      for (int32_t i = 0; i < (int32_t)areaW * rows; i++) band[i] = bg;
+
+      int16_t pen = originX;
+      Glyph g;
+      for (const char* s = text; *s; ) {
+        uint32_t code = next(s);
+        lookup(code, g);
+        int16_t gx = pen + g.left, gy = baseline - g.top;
+        pen += g.advance;
+
+        // Parte do glifo dentro desta faixa
+        int16_t fromY = max(gy, bandY), toY = min<int16_t>(gy + g.height, bandY + rows);
+        int16_t fromX = max(gx, x0), toX = min<int16_t>(gx + g.width, x0 + areaW);
+        if (g.alpha == NULL || fromY >= toY || fromX >= toX) continue;
+
+        const uint8_t* alpha = alphaOf(code, g);
+        for (int16_t y = fromY; y < toY; y++) {
+          const uint8_t* src = alpha + (uint32_t)(y - gy) * g.width + (fromX - gx);
+          uint16_t* dst = band + (uint32_t)(y - bandY) * areaW + (fromX - x0);
+          for (int16_t x = fromX; x < toX; x++, src++, dst++) {
+            uint8_t a = *src;
+            if (a) *dst = ramp[(a * 33) >> 8];
+          }
+        }
+      }
+      tft.pushImage(x0, bandY, areaW, rows, band);
+      stats.pixels += (uint32_t)areaW * rows;
+    }
+    tft.endWrite();
+    tft.setSwapBytes(swap);
+    return box;
+  }
+
+  Stats getStats() const { return stats; }
+
+  static size_t memoryBytes() {
+    return sizeof(Slot) * TEXT_CACHE_SLOTS + sizeof(uint16_t) * TEXT_BAND_PIXELS;
+  }
+};
+
+#endif // SMOOTH_TEXT_H
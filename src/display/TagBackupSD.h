@@ -0,0 +1,508 @@
+/**
+ * Backup incremental de tags para SD Card em background
+ *
+ * - requestBackup() apenas enfileira o intervalo de tags novas desde o
+ *   último backup e retorna imediatamente; a task lê os registros do
+ *   TagStore em blocos (streaming, sem copiar a base para a RAM).
+ * - backupBeforeClear() é usado no reset admin: copia para a RAM só as
+ *   tags ainda não gravadas (o TagStore é zerado logo em seguida) e
+ *   inicia uma nova sessão. Um lote em streaming já em andamento para
+ *   no último bloco reservado e vai para o manifesto encurtado; a cópia
+ *   começa no seq seguinte (nenhuma linha duplicada no CSV). Sem SD
+ *   montado não copia nada; cópias esperando o SD somam no máximo
+ *   TAG_BACKUP_MAX_QUEUED_BYTES (as mais antigas são descartadas).
+ * - Uma task FreeRTOS grava os registros no SD em blocos de 4 KB;
+ *   cada lote termina alinhado em 512 bytes (setor do SD).
+ * - O manifesto registra cada lote com sessão, sequência e CRC32.
+ *
+ * Arquivos no SD:
+ *   /rfid_backup.csv  -> "sessao,seq,uid,primeira,ultima,toques"
+ *                        (linhas '#' são preenchimento)
+ *   /rfid_backup.man  -> "batch,sessao,primeiro_seq,ultimo_seq,offset,bytes,crc32"
+ *                        "reset,sessao" (TagStore foi zerado)
+ *
+ * Sessão: incrementa a cada clear() do TagStore (seq volta a 1).
+ */
+
+#ifndef TAG_BACKUP_SD_H
+#define TAG_BACKUP_SD_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include <SPI.h>
+#include <esp_rom_crc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <vector>
+#include "TagStore.h"
+
+// Intervalo do backup automático (0 = somente no reset admin)
+#ifndef TAG_BACKUP_INTERVAL_MS
+  #define TAG_BACKUP_INTERVAL_MS 300000
+#endif
+
+// Heap máximo das cópias de reset esperando o SD (24 bytes por tag)
+#ifndef TAG_BACKUP_MAX_QUEUED_BYTES
+  #define TAG_BACKUP_MAX_QUEUED_BYTES 32768
+#endif
+
+class TagBackupSD {
+public:
+    enum State {
+        BACKUP_IDLE,
+        BACKUP_RUNNING,
+        BACKUP_DONE,
+        BACKUP_FAILED
+    };
+
+    struct Progress {
+        State state;
+        uint32_t written;   // registros gravados no lote atual
+        uint32_t total;     // registros no lote atual
+
+        uint8_t percent() const {
+            return total ? (uint8_t)((written * 100UL) / total) : 100;
+        }
+    };
+
+private:
+    static const size_t BLOCK_SIZE = 4096;   // escrita em blocos grandes
+    static const size_t SECTOR_SIZE = 512;   // alinhamento de cada lote
+    const char* DATA_FILE = "/rfid_backup.csv";
+    const char* MANIFEST_FILE = "/rfid_backup.man";
+
+    /**
+     * Lote pendente. Sem records, a task lê [firstSeq, lastSeq] direto
+     * do TagStore enquanto a geração do TagStore não mudar.
+     */
+    struct BackupJob {
+        uint32_t session;
+        uint32_t firstSeq;
+        uint32_t lastSeq;
+        uint32_t generation;
+        bool reset;                       // grava "reset,sessao" no manifesto
+        std::vector<TagRecord> records;
+    };
+
+    TagStore* store = NULL;
+    SPIClass* spi = NULL;
+    uint8_t csPin = 0;
+    volatile bool sdMounted = false;   // escrito pela task depois do begin()
+
+    TaskHandle_t taskHandle = NULL;
+    SemaphoreHandle_t lock = NULL;
+
+    // Protegido por lock
+    std::vector<BackupJob> pending;
+    uint32_t runningSession = 0;       // lote em streaming na task (0 = nenhum)
+    uint32_t runningSeq = 0;           // último seq reservado por esse lote
+    bool runningStop = false;          // backupBeforeClear(): não reservar mais
+
+    // Estado do loop principal
+    uint32_t session = 1;
+    uint32_t queuedSeq = 0;            // último seq já enviado para a fila
+    unsigned long lastRequest = 0;
+
+    // Atualizados pela task
+    volatile uint32_t committedSeq = 0;  // último seq no manifesto (sessão atual)
+    volatile State state = BACKUP_IDLE;
+    volatile uint32_t written = 0;
+    volatile uint32_t total = 0;
+
+    uint8_t* block = NULL;
+    size_t blockUsed = 0;
+
+    bool mount() {
+        if (sdMounted) return true;
+        sdMounted = SD.begin(csPin, *spi);
+        return sdMounted;
+    }
+
+    /**
+     * Lê o manifesto para restaurar sessão/sequência
+     */
+    void loadManifest() {
+        File file = SD.open(MANIFEST_FILE, FILE_READ);
+        if (!file) return;
+
+        while (file.available()) {
+            String line = file.readStringUntil('\n');
+            line.trim();
+            unsigned long s = 0, first = 0, last = 0;
+            if (sscanf(line.c_str(), "batch,%lu,%lu,%lu", &s, &first, &last) == 3) {
+                if (s != session) committedSeq = 0;
+                session = s;
+                committedSeq = max((uint32_t)last, (uint32_t)committedSeq);
+            } else if (sscanf(line.c_str(), "reset,%lu", &s) == 1 && s != session) {
+                // Linhas "reset" podem vir depois do primeiro lote da mesma sessão
+                session = s;
+                committedSeq = 0;
+            }
+        }
+        file.close();
+        queuedSeq = committedSeq;
+    }
+
+    bool appendManifest(const String& line) {
+        File file = SD.open(MANIFEST_FILE, FILE_APPEND);
+        if (!file) return false;
+        file.println(line);
+        file.close();
+        return true;
+    }
+
+    void enqueue(BackupJob& job) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        pending.push_back(std::move(job));
+        xSemaphoreGive(lock);
+        if (taskHandle) xTaskNotifyGive(taskHandle);
+    }
+
+    void startSession() {
+        session++;
+        queuedSeq = 0;
+        xSemaphoreTake(lock, portMAX_DELAY);
+        if (!pending.empty() && pending.back().reset) {
+            // Sessão anterior sem nenhum lote: um único "reset" basta
+            pending.back().session = session;
+            xSemaphoreGive(lock);
+            return;
+        }
+        xSemaphoreGive(lock);
+        BackupJob job = { session, 0, 0, 0, true, {} };
+        enqueue(job);
+    }
+
+    /**
+     * Abre espaço para bytes de cópia na fila, descartando as cópias mais
+     * antigas. Chamar com lock. false = não cabe nem com a fila vazia.
+     */
+    bool reserveQueued(size_t bytes) {
+        if (bytes > TAG_BACKUP_MAX_QUEUED_BYTES) return false;
+        size_t queued = 0;
+        for (size_t i = 0; i < pending.size(); i++) {
+            queued += pending[i].records.size() * sizeof(TagRecord);
+        }
+        for (size_t i = 0; i < pending.size() && queued + bytes > TAG_BACKUP_MAX_QUEUED_BYTES; ) {
+            if (pending[i].records.empty()) {
+                i++;
+                continue;
+            }
+            Serial.printf("⚠️ Backup descartado: sessão %lu, seq %lu-%lu (SD sem gravar)\n",
+                          (unsigned long)pending[i].session, (unsigned long)pending[i].firstSeq,
+                          (unsigned long)pending[i].lastSeq);
+            queued -= pending[i].records.size() * sizeof(TagRecord);
+            pending.erase(pending.begin() + i);
+        }
+        return true;
+    }
+
+    static void taskEntry(void* arg) {
+        static_cast<TagBackupSD*>(arg)->taskLoop();
+    }
+
+    void taskLoop() {
+        for (;;) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            // SD inserido depois do boot: backupBeforeClear() só copia com SD montado
+            if (!sdMounted && mount()) Serial.println("✅ SD Card detectado");
+
+            for (;;) {
+                BackupJob job;
+                xSemaphoreTake(lock, portMAX_DELAY);
+                bool hasJob = !pending.empty();
+                if (hasJob) {
+                    job = std::move(pending.front());
+                    pending.erase(pending.begin());
+                    bool streaming = !job.reset && job.records.empty();
+                    runningSession = streaming ? job.session : 0;
+                    runningSeq = job.firstSeq - 1;
+                    runningStop = false;
+                }
+                xSemaphoreGive(lock);
+                if (!hasJob) break;
+
+                written = 0;
+                total = job.reset ? 0 : job.lastSeq - job.firstSeq + 1;
+                state = BACKUP_RUNNING;
+
+                bool ok = mount() && runJob(job);
+                xSemaphoreTake(lock, portMAX_DELAY);
+                runningSession = 0;
+                if (!ok) {
+                    // Recoloca na fila para a próxima tentativa
+                    pending.insert(pending.begin(), std::move(job));
+                }
+                xSemaphoreGive(lock);
+                if (!ok) {
+                    sdMounted = false;
+                    state = BACKUP_FAILED;
+                    break;
+                }
+                state = BACKUP_DONE;
+            }
+        }
+    }
+
+    /**
+     * Grava um lote em blocos de BLOCK_SIZE, completa até o próximo
+     * setor e registra no manifesto
+     */
+    bool runJob(BackupJob& job) {
+        if (job.reset) {
+            if (!appendManifest("reset," + String(job.session))) return false;
+            if (job.session == session) committedSeq = 0;
+            return true;
+        }
+
+        File file = SD.open(DATA_FILE, FILE_APPEND);
+        if (!file) {
+            Serial.println("❌ Erro ao abrir arquivo de backup!");
+            return false;
+        }
+
+        uint32_t offset = file.size();
+        uint32_t crc = 0;
+        size_t bytes = 0;
+        bool ok = true;
+        bool aborted = false;
+        blockUsed = 0;
+
+        if (!job.records.empty()) {
+            for (size_t i = 0; ok && i < job.records.size(); i++) {
+                ok = appendRecord(file, job.session, job.firstSeq + i, job.records[i], bytes, crc);
+            }
+        } else {
+            TagRecord records[TAG_STORE_BLOCK_RECORDS];
+            uint32_t seq = job.firstSeq;
+            while (ok && seq <= job.lastSeq) {
+                uint32_t generation;
+                uint32_t n = store->read(seq - 1, records,
+                                         min<uint32_t>(TAG_STORE_BLOCK_RECORDS, job.lastSeq - seq + 1),
+                                         &generation);
+
+                // Reserva o bloco antes de gravar: backupBeforeClear() copia
+                // a partir do seq seguinte ao último reservado
+                xSemaphoreTake(lock, portMAX_DELAY);
+                bool stop = runningStop || generation != job.generation || n == 0;
+                if (!stop) runningSeq = seq + n - 1;
+                xSemaphoreGive(lock);
+                if (stop) {
+                    aborted = true;
+                    break;
+                }
+                for (uint32_t i = 0; ok && i < n; i++) {
+                    ok = appendRecord(file, job.session, seq + i, records[i], bytes, crc);
+                }
+                seq += n;
+            }
+            if (aborted) {
+                // Registros seguintes ficam com a cópia do backupBeforeClear()
+                job.lastSeq = seq - 1;
+                if (job.lastSeq < job.firstSeq) {
+                    file.close();
+                    Serial.println("⚠️ Backup interrompido: TagStore será zerado");
+                    return true;
+                }
+            }
+        }
+
+        // Preenche até o fim do setor para o próximo lote começar alinhado
+        size_t padding = (SECTOR_SIZE - (offset + bytes) % SECTOR_SIZE) % SECTOR_SIZE;
+        char fill[64];
+        while (ok && padding > 0) {
+            size_t chunk = min(padding, sizeof(fill));
+            memset(fill, '#', chunk);
+            if (chunk == padding) fill[chunk - 1] = '\n';
+            ok = appendBytes(file, (const uint8_t*)fill, chunk, bytes, crc);
+            padding -= chunk;
+        }
+
+        if (ok && blockUsed > 0) {
+            ok = file.write(block, blockUsed) == blockUsed;
+        }
+        file.close();
+        if (!ok) return false;
+        if (aborted) {
+            Serial.printf("⚠️ Backup interrompido pelo reset: lote encurtado até o seq %lu\n",
+                          (unsigned long)job.lastSeq);
+        }
+
+        char entry[96];
+        snprintf(entry, sizeof(entry), "batch,%lu,%lu,%lu,%lu,%lu,%08lx",
+                 (unsigned long)job.session, (unsigned long)job.firstSeq,
+                 (unsigned long)job.lastSeq, (unsigned long)offset,
+                 (unsigned long)bytes, (unsigned long)crc);
+        if (!appendManifest(entry)) return false;
+        if (job.session == session) committedSeq = job.lastSeq;
+
+        Serial.printf("💾 Backup: %lu registros (sessão %lu, seq %lu-%lu, %u bytes)\n",
+                      (unsigned long)written, (unsigned long)job.session,
+                      (unsigned long)job.firstSeq, (unsigned long)job.lastSeq,
+                      (unsigned)bytes);
+        return true;
+    }
+
+    bool appendRecord(File& file, uint32_t recordSession, uint32_t seq,
+                      const TagRecord& record, size_t& bytes, uint32_t& crc) {
+        char line[72];
+        int len = snprintf(line, sizeof(line), "%lu,%lu,%s,%lu,%lu,%u\n",
+                           (unsigned long)recordSession, (unsigned long)seq,
+                           record.uidHex().c_str(),
+                           (unsigned long)record.firstSeen,
+                           (unsigned long)record.lastSeen,
+                           (unsigned)record.taps);
+        written = written + 1;
+        return appendBytes(file, (const uint8_t*)line, len, bytes, crc);
+    }
+
+    /**
+     * Acumula bytes no bloco; grava no SD sempre que o bloco enche
+     */
+    bool appendBytes(File& file, const uint8_t* data, size_t len, size_t& bytes, uint32_t& crc) {
+        crc = esp_rom_crc32_le(crc, data, len);
+        bytes += len;
+        while (len > 0) {
+            size_t chunk = min(len, BLOCK_SIZE - blockUsed);
+            memcpy(block + blockUsed, data, chunk);
+            blockUsed += chunk;
+            data += chunk;
+            len -= chunk;
+            if (blockUsed == BLOCK_SIZE) {
+                if (file.write(block, BLOCK_SIZE) != BLOCK_SIZE) return false;
+                blockUsed = 0;
+            }
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Monta o SD, lê o manifesto e cria a task de gravação.
+     * Chamar no setup(), depois de TagStore::begin().
+     */
+    bool begin(TagStore& tagStore, SPIClass& spiBus, uint8_t cs) {
+        store = &tagStore;
+        spi = &spiBus;
+        csPin = cs;
+
+        block = (uint8_t*)heap_caps_malloc(BLOCK_SIZE, MALLOC_CAP_DMA);
+        lock = xSemaphoreCreateMutex();
+        if (block == NULL || lock == NULL) {
+            Serial.println("❌ Erro ao alocar buffers de backup!");
+            return false;
+        }
+
+        if (mount()) {
+            loadManifest();
+        } else {
+            Serial.println("⚠️ SD Card não detectado - backup tentará novamente depois");
+        }
+
+        // TagStore zerado sem o manifesto saber (ex.: SD ausente no reset)
+        if (store->count() < queuedSeq) {
+            startSession();
+        }
+
+        xTaskCreatePinnedToCore(taskEntry, "tag_backup", 4096, this, 1, &taskHandle, 0);
+        if (taskHandle && !pending.empty()) xTaskNotifyGive(taskHandle);
+
+        Serial.printf("✅ Backup SD pronto (sessão %lu, último seq %lu)\n",
+                      (unsigned long)session, (unsigned long)queuedSeq);
+        return taskHandle != NULL;
+    }
+
+    /**
+     * Enfileira as tags novas desde o último backup e retorna imediatamente
+     */
+    bool requestBackup() {
+        if (taskHandle == NULL) return false;
+        lastRequest = millis();
+
+        uint32_t count = store->count();
+        if (count > queuedSeq) {
+            BackupJob job = { session, queuedSeq + 1, count, store->generation(), false, {} };
+            queuedSeq = count;
+            Serial.printf("💾 Backup agendado: %lu tags novas\n",
+                          (unsigned long)(job.lastSeq - job.firstSeq + 1));
+            enqueue(job);
+        } else {
+            xTaskNotifyGive(taskHandle);  // tenta de novo lotes que falharam
+        }
+        return true;
+    }
+
+    /**
+     * Copia as tags ainda não gravadas no SD e inicia nova sessão.
+     * Chamar imediatamente antes de TagStore::clear(). Retorna false (sem
+     * copiar) se o SD não está montado ou a cópia passa de
+     * TAG_BACKUP_MAX_QUEUED_BYTES: essas tags se perdem no reset.
+     */
+    bool backupBeforeClear() {
+        if (taskHandle == NULL) return false;
+
+        // Lotes em streaming desta sessão são cobertos pela cópia abaixo
+        // (ou perdidos com o reset, se não houver cópia)
+        xSemaphoreTake(lock, portMAX_DELAY);
+        for (size_t i = 0; i < pending.size(); ) {
+            if (!pending[i].reset && pending[i].records.empty() && pending[i].session == session) {
+                pending.erase(pending.begin() + i);
+            } else {
+                i++;
+            }
+        }
+        // Lote em andamento: termina no último bloco já reservado
+        uint32_t firstSeq = committedSeq + 1;
+        if (runningSession == session) {
+            runningStop = true;
+            firstSeq = max(firstSeq, runningSeq + 1);
+        }
+        uint32_t count = store->count();
+        uint32_t unsaved = count >= firstSeq ? count - firstSeq + 1 : 0;
+        bool mounted = sdMounted;
+        bool ok = unsaved == 0 || (mounted && reserveQueued(unsaved * sizeof(TagRecord)));
+        xSemaphoreGive(lock);
+
+        if (ok) {
+            BackupJob job = { session, firstSeq, 0, store->generation(), false, {} };
+            store->snapshot(job.records, job.firstSeq - 1);
+            job.lastSeq = job.firstSeq + job.records.size() - 1;
+            Serial.printf("💾 Backup agendado antes do reset: %u tags\n", (unsigned)job.records.size());
+            if (!job.records.empty()) enqueue(job);
+        } else {
+            Serial.printf("❌ Backup antes do reset: %s - %lu tags sem backup\n",
+                          mounted ? "cópia maior que TAG_BACKUP_MAX_QUEUED_BYTES" : "SD não montado",
+                          (unsigned long)unsaved);
+        }
+
+        startSession();
+        return ok;
+    }
+
+    /**
+     * Chamar no loop(): backup automático a cada TAG_BACKUP_INTERVAL_MS
+     */
+    void maintain() {
+        if (TAG_BACKUP_INTERVAL_MS > 0 && millis() - lastRequest >= TAG_BACKUP_INTERVAL_MS) {
+            requestBackup();
+        }
+    }
+
+    Progress progress() const {
+        Progress p;
+        p.state = state;
+        p.written = written;
+        p.total = total;
+        return p;
+    }
+
+    /**
+     * Heap do bloco de escrita
+     */
+    size_t bufferBytes() const {
+        return block ? BLOCK_SIZE : 0;
+    }
+};
+
+#endif // TAG_BACKUP_SD_H
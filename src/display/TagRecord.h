@@ -0,0 +1,97 @@
+/**
+ * Registro de visita de uma tag (largura fixa, 24 bytes)
+ *
+ * UID binário (até 10 bytes - ISO14443 triple size), primeira e última
+ * leitura em segundos e contador de toques. O formato é o mesmo em todos
+ * os backends do TagStore, no backup SD e na exportação.
+ *
+ * Tempo: segundos de operação do display, monotônicos entre reboots
+ * dentro da mesma época do TagStore (ver TagStore::now()). O display
+ * não tem RTC nem rede.
+ */
+
+#ifndef TAG_RECORD_H
+#define TAG_RECORD_H
+
+#include <Arduino.h>
+
+#define TAG_UID_MAX_BYTES 10
+
+struct __attribute__((packed)) TagRecord {
+  uint8_t uid[TAG_UID_MAX_BYTES];  // UID binário
+  uint8_t uidLen;                  // bytes válidos em uid (0 = slot vazio)
+  uint8_t epoch;                   // byte baixo da época do TagStore em que foi gravado
+  uint32_t firstSeen;              // primeira leitura (s)
+  uint32_t lastSeen;               // última leitura (s)
+  uint16_t taps;                   // quantidade de leituras (satura em 65535)
+  uint16_t reserved;
+
+  /**
+   * Converte UID em hexadecimal ("0431430F320289") para binário
+   */
+  bool setUID(const String& hex) {
+    size_t len = hex.length() / 2;
+    if (len == 0 || len > TAG_UID_MAX_BYTES || (hex.length() % 2) != 0) {
+      return false;
+    }
+    memset(uid, 0, sizeof(uid));
+    for (size_t i = 0; i < len; i++) {
+      int hi = hexValue(hex[i * 2]);
+      int lo = hexValue(hex[i * 2 + 1]);
+      if (hi < 0 || lo < 0) return false;
+      uid[i] = (hi << 4) | lo;
+    }
+    uidLen = len;
+    return true;
+  }
+
+  /**
+   * UID em hexadecimal maiúsculo (mesmo formato enviado pelo Reader)
+   */
+  String uidHex() const {
+    static const char digits[] = "0123456789ABCDEF";
+    char buf[TAG_UID_MAX_BYTES * 2 + 1];
+    for (uint8_t i = 0; i < uidLen && i < TAG_UID_MAX_BYTES; i++) {
+      buf[i * 2] = digits[uid[i] >> 4];
+      buf[i * 2 + 1] = digits[uid[i] & 0x0F];
+    }
+    buf[min((int)uidLen, TAG_UID_MAX_BYTES) * 2] = '\0';
+    return String(buf);
+  }
+
+  bool sameUID(const TagRecord& other) const {
+    return uidLen == other.uidLen && memcmp(uid, other.uid, uidLen) == 0;
+  }
+
+  /**
+   * Registra uma leitura no instante now (s)
+   */
+  void touch(uint32_t now) {
+    if (taps == 0) firstSeen = now;
+    lastSeen = now;
+    if (taps < 0xFFFF) taps++;
+  }
+
+  /**
+   * Hash FNV-1a do UID (índice em RAM do TagStore)
+   */
+  uint32_t hash() const {
+    uint32_t h = 2166136261UL;
+    for (uint8_t i = 0; i < uidLen; i++) {
+      h = (h ^ uid[i]) * 16777619UL;
+    }
+    return h;
+  }
+
+private:
+  static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+  }
+};
+
+static_assert(sizeof(TagRecord) == 24, "TagRecord deve ter 24 bytes");
+
+#endif // TAG_RECORD_H
@@ -0,0 +1,693 @@
+/**
+ * Interface comum de armazenamento de tags lidas
+ *
+ * Cada tag é um TagRecord de 24 bytes (UID binário, primeira/última
+ * leitura e contador de toques) guardado em um "slot" fixo, na ordem
+ * de inserção. A lógica comum fica aqui:
+ *   - índice em RAM (hash do UID -> slot) para contains() sem varrer a flash
+ *   - cache de registros em RAM: toques atualizam o registro no cache
+ *     e vão para a flash de forma preguiçosa (flush/maintain)
+ *   - tags novas são gravadas na hora (write-through)
+ *   - iterate()/read() percorrem os registros em blocos, sem carregar
+ *     tudo na memória
+ *   - clear() em tempo constante: só grava a época nova com o contador
+ *     zerado (storeEpoch). Cada registro guarda a época em que foi
+ *     gravado; slots de épocas antigas são sobrescritos pelas tags novas
+ *     e o restante é recuperado aos poucos em maintain() (compactação).
+ *     O registro guarda só o byte baixo da época: a cada 256 resets o
+ *     clear() apaga antes todos os slots antigos, para nenhum voltar
+ *
+ * Os backends implementam apenas E/S de registros:
+ *   - TagStoreNVS       (Preferences / NVS)
+ *   - TagStoreSPIFFS    (arquivo em SPIFFS)
+ *   - TagStoreLittleFS  (arquivo em LittleFS)
+ *   - TagStoreRAM       (somente RAM, perde dados no reset)
+ *
+ * O backend é escolhido em platformio.ini:
+ *   -DTAG_STORE_BACKEND=TAG_STORE_NVS   (padrão)
+ *   -DTAG_STORE_BACKEND=TAG_STORE_SPIFFS
+ *   -DTAG_STORE_BACKEND=TAG_STORE_LITTLEFS
+ *   -DTAG_STORE_BACKEND=TAG_STORE_RAM
+ * e instanciado via TagStoreFactory.h.
+ *
+ * Métodos públicos são thread-safe (mutex recursivo), para que a task
+ * de backup possa ler enquanto o loop principal registra visitas.
+ */
+
+#ifndef TAG_STORE_H
+#define TAG_STORE_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "TagRecord.h"
+
+// Identificadores de backend (usados em TAG_STORE_BACKEND)
+#define TAG_STORE_NVS       1
+#define TAG_STORE_SPIFFS    2
+#define TAG_STORE_LITTLEFS  3
+#define TAG_STORE_RAM       4
+
+// Registros mantidos em RAM (hits de toque e escrita preguiçosa)
+#ifndef TAG_STORE_CACHE_SIZE
+  #define TAG_STORE_CACHE_SIZE 16
+#endif
+
+// Tempo máximo que um toque fica só em RAM antes de ir para a flash
+#ifndef TAG_STORE_FLUSH_MS
+  #define TAG_STORE_FLUSH_MS 30000
+#endif
+
+// Registros lidos por vez em iterate()
+#define TAG_STORE_BLOCK_RECORDS 16
+
+// Intervalo entre passos da compactação de slots antigos (maintain)
+#ifndef TAG_STORE_COMPACT_MS
+  #define TAG_STORE_COMPACT_MS 100
+#endif
+
+/**
+ * Contadores de desempenho de um backend
+ */
+struct TagStoreStats {
+  uint32_t lookups;        // chamadas a contains()/recordVisit()
+  uint32_t inserts;        // tags novas gravadas
+  uint32_t visits;         // leituras de tags já conhecidas
+  uint32_t flashWrites;    // operações de escrita na flash
+  uint64_t lookupMicros;   // tempo acumulado em consultas
+  uint64_t insertMicros;   // tempo acumulado em inserções
+};
+
+class TagStore {
+public:
+  /**
+   * Visitante de iterate(): recebe índice (slot) e registro.
+   * Retorna false para interromper a iteração.
+   */
+  typedef std::function<bool(uint32_t index, const TagRecord& record)> Visitor;
+
+  virtual ~TagStore() {
+    if (lock) vSemaphoreDelete(lock);
+  }
+
+  /**
+   * Nome do backend (para logs)
+   */
+  virtual const char* name() const = 0;
+
+  /**
+   * Monta o armazenamento, migra formatos antigos e monta o índice.
+   * Deve ser chamado no setup(). Se falhar, o display segue sem
+   * armazenamento: consultas não acham nada e nada é gravado.
+   */
+  bool begin() {
+    if (lock == NULL) lock = xSemaphoreCreateRecursiveMutex();
+    Guard guard(lock);
+
+    mounted = mount();
+    if (!mounted) return false;
+
+    currentEpoch = loadEpoch();
+    recordCount = loadCount();
+    countDirty = false;
+    invalidateCache();
+
+    // Contador pode estar adiantado (reset interrompido) ou atrasado
+    rebuildIndex();
+    TagRecord probe;
+    while (readRecords(recordCount, &probe, 1) == 1 && isCurrent(probe)) {
+      indexInsert(probe.hash(), recordCount);
+      recordCount++;
+      countDirty = true;
+      clockBase = max(clockBase, probe.lastSeen + 1);
+    }
+
+    // Slots de épocas anteriores depois do fim: compactados em maintain()
+    staleEnd = recordCount;
+    while (readRecords(staleEnd, &probe, 1) == 1 && probe.uidLen != 0) {
+      staleEnd++;
+    }
+
+    migrateLegacy();
+    return true;
+  }
+
+  /**
+   * Verifica se uma tag já foi lida anteriormente
+   */
+  bool contains(const String& uid) {
+    TagRecord record;
+    return lookup(uid, record);
+  }
+
+  /**
+   * Busca o registro de uma tag. Retorna false se não existir.
+   */
+  bool lookup(const String& uid, TagRecord& out) {
+    TagRecord key = {};
+    if (!key.setUID(uid)) return false;
+
+    Guard guard(lock);
+    if (!mounted) return false;
+    uint32_t start = micros();
+    int32_t slot = findSlot(key);
+    if (slot >= 0) readRecord(slot, out);
+    _stats.lookups++;
+    _stats.lookupMicros += micros() - start;
+    return slot >= 0;
+  }
+
+  /**
+   * Registra uma leitura da tag.
+   * Tag nova: grava na flash imediatamente e retorna true.
+   * Tag conhecida: atualiza última leitura/contador em RAM e retorna false.
+   */
+  bool recordVisit(const String& uid, TagRecord* out = NULL) {
+    TagRecord record = {};
+    if (!record.setUID(uid)) {
+      Serial.printf("⚠️ UID inválido para armazenamento: %s\n", uid.c_str());
+      return false;
+    }
+
+    Guard guard(lock);
+    if (!mounted) {
+      if (out) *out = record;
+      return false;
+    }
+    uint32_t start = micros();
+    uint32_t timestamp = now();
+    int32_t slot = findSlot(record);
+    _stats.lookups++;
+
+    if (slot >= 0) {
+      CacheEntry& entry = cacheLoad(slot);
+      entry.record.touch(timestamp);
+      markDirty(entry);
+      _stats.visits++;
+      _stats.lookupMicros += micros() - start;
+      if (out) *out = entry.record;
+      return false;
+    }
+
+    record.touch(timestamp);
+    if (!appendRecord(record)) return false;
+    _stats.inserts++;
+    _stats.insertMicros += micros() - start;
+    if (out) *out = record;
+    return true;
+  }
+
+  /**
+   * Mescla um registro vindo de outro display (importação).
+   * Tag conhecida: primeira leitura mínima, última máxima e toques somados.
+   * Retorna true se a tag é nova.
+   */
+  bool merge(const TagRecord& incoming) {
+    if (incoming.uidLen == 0 || incoming.uidLen > TAG_UID_MAX_BYTES) return false;
+
+    Guard guard(lock);
+    if (!mounted) return false;
+    int32_t slot = findSlot(incoming);
+    if (slot < 0) {
+      return appendRecord(incoming);
+    }
+
+    CacheEntry& entry = cacheLoad(slot);
+    TagRecord& record = entry.record;
+    record.firstSeen = min(record.firstSeen, incoming.firstSeen);
+    record.lastSeen = max(record.lastSeen, incoming.lastSeen);
+    record.taps = min<uint32_t>(0xFFFF, (uint32_t)record.taps + incoming.taps);
+    markDirty(entry);
+    return false;
+  }
+
+  /**
+   * Quantidade de tags armazenadas
+   */
+  uint32_t count() {
+    return recordCount;
+  }
+
+  /**
+   * Lê até n registros a partir de index (inclui alterações ainda em cache).
+   * readGeneration recebe a geração lida sob o mesmo lock (ver generation()).
+   * Retorna quantidade lida.
+   */
+  uint32_t read(uint32_t index, TagRecord* out, uint32_t n, uint32_t* readGeneration = NULL) {
+    Guard guard(lock);
+    if (readGeneration) *readGeneration = storeGeneration;
+    if (index >= recordCount) return 0;
+    n = min(n, recordCount - index);
+    n = readRecords(index, out, n);
+
+    for (int i = 0; i < TAG_STORE_CACHE_SIZE; i++) {
+      const CacheEntry& entry = cache[i];
+      if (entry.valid && entry.slot >= index && entry.slot < index + n) {
+        out[entry.slot - index] = entry.record;
+      }
+    }
+    return n;
+  }
+
+  /**
+   * Percorre as tags em ordem de inserção a partir de startIndex,
+   * lendo TAG_STORE_BLOCK_RECORDS registros por vez
+   */
+  void iterate(Visitor visitor, uint32_t startIndex = 0) {
+    TagRecord block[TAG_STORE_BLOCK_RECORDS];
+    uint32_t index = startIndex;
+    uint32_t n;
+    while ((n = read(index, block, TAG_STORE_BLOCK_RECORDS)) > 0) {
+      for (uint32_t i = 0; i < n; i++) {
+        if (!visitor(index + i, block[i])) return;
+      }
+      index += n;
+    }
+  }
+
+  /**
+   * Apaga todas as tags em tempo constante (nova época).
+   * Os registros antigos continuam na flash até serem sobrescritos
+   * ou compactados por maintain().
+   */
+  void clear() {
+    Guard guard(lock);
+    if (!mounted) return;
+    invalidateCache();
+    currentEpoch++;
+    staleEnd = max(staleEnd, recordCount);
+    if ((uint8_t)currentEpoch == 0 && staleEnd > 0) {
+      // Byte da época vai se repetir: slot antigo que sobrar voltaria
+      // como tag válida no begin()
+      Serial.printf("🧹 Época %lu: apagando %lu slots antigos\n",
+                    (unsigned long)currentEpoch, (unsigned long)staleEnd);
+      if (eraseSlots(0, staleEnd)) {
+        countWrite();
+        staleEnd = 0;
+      }
+    }
+    if (storeEpoch(currentEpoch)) countWrite();
+    recordCount = 0;
+    countDirty = false;
+    clearIndex();
+    storeGeneration++;
+  }
+
+  /**
+   * Copia as tags a partir de startIndex para out.
+   * Retorna quantidade copiada.
+   */
+  uint32_t snapshot(std::vector<TagRecord>& out, uint32_t startIndex = 0) {
+    Guard guard(lock);
+    out.clear();
+    if (startIndex < recordCount) out.reserve(recordCount - startIndex);
+    iterate([&out](uint32_t, const TagRecord& record) {
+      out.push_back(record);
+      return true;
+    }, startIndex);
+    return out.size();
+  }
+
+  /**
+   * Grava na flash todos os toques pendentes em RAM
+   */
+  void flush() {
+    Guard guard(lock);
+    for (int i = 0; i < TAG_STORE_CACHE_SIZE; i++) {
+      writeBack(cache[i]);
+    }
+    if (countDirty && storeCount(recordCount)) {
+      countWrite();
+      countDirty = false;
+    }
+  }
+
+  /**
+   * Chamar no loop(): grava toques pendentes há mais de TAG_STORE_FLUSH_MS
+   * e apaga um bloco de slots antigos a cada TAG_STORE_COMPACT_MS
+   */
+  void maintain() {
+    Guard guard(lock);
+    for (int i = 0; i < TAG_STORE_CACHE_SIZE; i++) {
+      if (cache[i].dirty && millis() - cache[i].dirtySince >= TAG_STORE_FLUSH_MS) {
+        flush();
+        return;
+      }
+    }
+    compactStep();
+  }
+
+  /**
+   * Slots de épocas anteriores ainda não recuperados
+   */
+  uint32_t staleSlots() {
+    Guard guard(lock);
+    return staleEnd > recordCount ? staleEnd - recordCount : 0;
+  }
+
+  /**
+   * Relógio do armazenamento em segundos: continua a partir da maior
+   * leitura registrada, então é monotônico entre reboots
+   */
+  uint32_t now() {
+    return clockBase + millis() / 1000;
+  }
+
+  /**
+   * Incrementa a cada clear() desde o boot; permite detectar que o
+   * conteúdo mudou (a época persistida é interna ao armazenamento)
+   */
+  uint32_t generation() {
+    return storeGeneration;
+  }
+
+  const TagStoreStats& stats() const { return _stats; }
+
+  /**
+   * RAM do índice (heap, cresce com as tags) e do cache de registros
+   */
+  size_t memoryBytes() {
+    Guard guard(lock);
+    return indexHash.capacity() * sizeof(uint32_t) +
+           indexSlot.capacity() * sizeof(uint16_t) + sizeof(cache);
+  }
+
+  void resetStats() { _stats = TagStoreStats(); }
+
+  /**
+   * Imprime ops/s e escritas na flash por inserção via Serial
+   */
+  void printStats() {
+    Serial.printf("\n📊 Estatísticas TagStore (%s):\n", name());
+    Serial.printf("  ├─ Tags: %lu (índice RAM: %u bytes)\n",
+                  (unsigned long)recordCount,
+                  (unsigned)(indexHash.size() * (sizeof(uint32_t) + sizeof(uint16_t))));
+    Serial.printf("  ├─ Consultas: %lu (%.0f ops/s)\n",
+                  (unsigned long)_stats.lookups, opsPerSecond(_stats.lookups, _stats.lookupMicros));
+    Serial.printf("  ├─ Inserções: %lu (%.0f ops/s)\n",
+                  (unsigned long)_stats.inserts, opsPerSecond(_stats.inserts, _stats.insertMicros));
+    Serial.printf("  ├─ Releituras: %lu\n", (unsigned long)_stats.visits);
+    Serial.printf("  ├─ Época: %lu (slots antigos a compactar: %lu)\n",
+                  (unsigned long)currentEpoch, (unsigned long)staleSlots());
+    Serial.printf("  └─ Escritas na flash por inserção: %.2f\n\n",
+                  _stats.inserts ? (float)_stats.flashWrites / _stats.inserts : 0.0f);
+  }
+
+protected:
+  // ---------------------------
+  // E/S implementada pelos backends
+  // ---------------------------
+
+  /** Monta/abre o meio de armazenamento */
+  virtual bool mount() = 0;
+
+  /** Contador de registros persistido (pode estar atrasado) */
+  virtual uint32_t loadCount() = 0;
+
+  /** Persiste o contador de registros */
+  virtual bool storeCount(uint32_t count) = 0;
+
+  /** Época atual persistida (0 se nunca gravada) */
+  virtual uint32_t loadEpoch() = 0;
+
+  /**
+   * Persiste a época nova com o contador zerado (o reset inteiro; conta
+   * como uma escrita). Se o contador não puder ir na mesma gravação, a
+   * época vai primeiro: o begin() descarta registros de épocas antigas.
+   */
+  virtual bool storeEpoch(uint32_t epoch) = 0;
+
+  /**
+   * Lê n registros a partir de slot. Slots nunca gravados devem
+   * retornar uidLen == 0. Retorna quantidade lida.
+   */
+  virtual uint32_t readRecords(uint32_t slot, TagRecord* out, uint32_t n) = 0;
+
+  /** Grava um registro no slot */
+  virtual bool writeRecord(uint32_t slot, const TagRecord& record) = 0;
+
+  /**
+   * Libera os slots [from, to) de épocas antigas. Padrão: grava registros
+   * vazios; backends podem apagar páginas inteiras ou truncar.
+   */
+  virtual bool eraseSlots(uint32_t from, uint32_t to) {
+    TagRecord empty = {};
+    for (uint32_t slot = from; slot < to; slot++) {
+      if (!writeRecord(slot, empty)) return false;
+    }
+    return true;
+  }
+
+  /** Importa formatos antigos (opcional); use appendRecord() */
+  virtual void migrateLegacy() {}
+
+  /** false para backends que não gravam na flash (estatísticas) */
+  virtual bool persistent() const { return true; }
+
+  uint32_t epoch() const { return currentEpoch; }
+
+  /**
+   * Grava um registro novo no próximo slot (write-through)
+   */
+  bool appendRecord(TagRecord record) {
+    record.epoch = (uint8_t)currentEpoch;
+    if (recordCount >= 0xFFFF) {
+      Serial.println("❌ TagStore cheio!");
+      return false;
+    }
+    if (!writeRecord(recordCount, record)) {
+      Serial.println("❌ Erro ao gravar tag!");
+      return false;
+    }
+    countWrite();
+
+    uint32_t slot = recordCount++;
+    countDirty = true;
+    indexInsert(record.hash(), slot);
+    if (record.lastSeen >= now()) {
+      // Registro importado "do futuro": mantém o relógio monotônico
+      clockBase = record.lastSeen + 1 - millis() / 1000;
+    }
+
+    CacheEntry& entry = cacheSlot(slot);
+    entry.record = record;
+    return true;
+  }
+
+  TagStoreStats _stats = {};
+
+private:
+  struct CacheEntry {
+    bool valid;
+    bool dirty;
+    uint32_t slot;
+    uint32_t lastUse;
+    uint32_t dirtySince;
+    TagRecord record;
+  };
+
+  /**
+   * Trava o mutex recursivo durante o escopo
+   */
+  struct Guard {
+    SemaphoreHandle_t handle;
+    explicit Guard(SemaphoreHandle_t h) : handle(h) { if (handle) xSemaphoreTakeRecursive(handle, portMAX_DELAY); }
+    ~Guard() { if (handle) xSemaphoreGiveRecursive(handle); }
+  };
+
+  SemaphoreHandle_t lock = NULL;
+  bool mounted = false;         // índice e backend só valem depois do begin()
+  uint32_t recordCount = 0;
+  bool countDirty = false;
+  uint32_t clockBase = 0;
+  uint32_t storeGeneration = 0;
+  uint32_t currentEpoch = 0;
+  uint32_t staleEnd = 0;        // fim dos slots de épocas antigas
+  unsigned long lastCompact = 0;
+
+  // Índice: tabela hash com endereçamento aberto (slot + 1; 0 = vazio)
+  std::vector<uint32_t> indexHash;
+  std::vector<uint16_t> indexSlot;
+
+  CacheEntry cache[TAG_STORE_CACHE_SIZE] = {};
+  uint32_t cacheClock = 0;
+
+  void countWrite() {
+    if (persistent()) _stats.flashWrites++;
+  }
+
+  bool isCurrent(const TagRecord& record) const {
+    return record.uidLen != 0 && record.epoch == (uint8_t)currentEpoch;
+  }
+
+  /**
+   * Apaga o último bloco de slots antigos (do fim para o começo, para
+   * nunca tocar em slots que tags novas acabaram de ocupar)
+   */
+  void compactStep() {
+    if (staleEnd <= recordCount) {
+      staleEnd = recordCount;
+      return;
+    }
+    if (millis() - lastCompact < TAG_STORE_COMPACT_MS) return;
+    lastCompact = millis();
+
+    uint32_t from = staleEnd > TAG_STORE_BLOCK_RECORDS ? staleEnd - TAG_STORE_BLOCK_RECORDS : 0;
+    from -= from % TAG_STORE_BLOCK_RECORDS;
+    from = max(from, recordCount);
+    if (eraseSlots(from, staleEnd)) {
+      countWrite();
+      staleEnd = from;
+    }
+  }
+
+  static float opsPerSecond(uint32_t ops, uint64_t micros) {
+    return micros ? (float)ops * 1000000.0f / (float)micros : 0.0f;
+  }
+
+  // ---------------------------
+  // Índice em RAM
+  // ---------------------------
+  void clearIndex() {
+    indexHash.assign(64, 0);
+    indexSlot.assign(64, 0);
+  }
+
+  void indexInsert(uint32_t hash, uint32_t slot) {
+    if ((recordCount + 1) * 4 > indexSlot.size() * 3) growIndex();
+    size_t mask = indexSlot.size() - 1;
+    size_t pos = hash & mask;
+    while (indexSlot[pos] != 0) pos = (pos + 1) & mask;
+    indexHash[pos] = hash;
+    indexSlot[pos] = slot + 1;
+  }
+
+  void growIndex() {
+    std::vector<uint32_t> oldHash;
+    std::vector<uint16_t> oldSlot;
+    oldHash.swap(indexHash);
+    oldSlot.swap(indexSlot);
+    indexHash.assign(oldSlot.size() * 2, 0);
+    indexSlot.assign(oldSlot.size() * 2, 0);
+    size_t mask = indexSlot.size() - 1;
+    for (size_t i = 0; i < oldSlot.size(); i++) {
+      if (oldSlot[i] == 0) continue;
+      size_t pos = oldHash[i] & mask;
+      while (indexSlot[pos] != 0) pos = (pos + 1) & mask;
+      indexHash[pos] = oldHash[i];
+      indexSlot[pos] = oldSlot[i];
+    }
+  }
+
+  /**
+   * Lê todos os registros em blocos para montar o índice e o relógio
+   */
+  void rebuildIndex() {
+    clearIndex();
+    uint32_t maxSeen = 0;
+    TagRecord block[TAG_STORE_BLOCK_RECORDS];
+    uint32_t total = recordCount;
+    recordCount = 0;
+    for (uint32_t index = 0; index < total; ) {
+      uint32_t n = readRecords(index, block, min<uint32_t>(TAG_STORE_BLOCK_RECORDS, total - index));
+      if (n == 0) break;
+      for (uint32_t i = 0; i < n; i++) {
+        if (!isCurrent(block[i])) {
+          // Reset interrompido antes de zerar o contador
+          countDirty = true;
+          clockBase = maxSeen + 1;
+          return;
+        }
+        indexInsert(block[i].hash(), index + i);
+        recordCount++;
+        maxSeen = max(maxSeen, block[i].lastSeen);
+      }
+      index += n;
+    }
+    clockBase = maxSeen + 1;
+  }
+
+  int32_t findSlot(const TagRecord& key) {
+    uint32_t hash = key.hash();
+    size_t mask = indexSlot.size() - 1;
+    size_t pos = hash & mask;
+    while (indexSlot[pos] != 0) {
+      if (indexHash[pos] == hash) {
+        uint32_t slot = indexSlot[pos] - 1;
+        TagRecord stored;
+        readRecord(slot, stored);
+        if (stored.sameUID(key)) return slot;
+      }
+      pos = (pos + 1) & mask;
+    }
+    return -1;
+  }
+
+  // ---------------------------
+  // Cache de registros
+  // ---------------------------
+  void invalidateCache() {
+    for (int i = 0; i < TAG_STORE_CACHE_SIZE; i++) cache[i].valid = cache[i].dirty = false;
+  }
+
+  void readRecord(uint32_t slot, TagRecord& out) {
+    for (int i = 0; i < TAG_STORE_CACHE_SIZE; i++) {
+      if (cache[i].valid && cache[i].slot == slot) {
+        out = cache[i].record;
+        return;
+      }
+    }
+    if (readRecords(slot, &out, 1) != 1) memset(&out, 0, sizeof(out));
+  }
+
+  /**
+   * Retorna a entrada do slot, carregando da flash se necessário
+   */
+  CacheEntry& cacheLoad(uint32_t slot) {
+    for (int i = 0; i < TAG_STORE_CACHE_SIZE; i++) {
+      if (cache[i].valid && cache[i].slot == slot) {
+        cache[i].lastUse = ++cacheClock;
+        return cache[i];
+      }
+    }
+    CacheEntry& entry = cacheSlot(slot);
+    if (readRecords(slot, &entry.record, 1) != 1) memset(&entry.record, 0, sizeof(entry.record));
+    return entry;
+  }
+
+  /**
+   * Reserva uma entrada (LRU) para o slot; grava a antiga se suja
+   */
+  CacheEntry& cacheSlot(uint32_t slot) {
+    CacheEntry* victim = &cache[0];
+    for (int i = 0; i < TAG_STORE_CACHE_SIZE; i++) {
+      if (!cache[i].valid) { victim = &cache[i]; break; }
+      if (cache[i].lastUse < victim->lastUse) victim = &cache[i];
+    }
+    writeBack(*victim);
+    victim->valid = true;
+    victim->dirty = false;
+    victim->slot = slot;
+    victim->lastUse = ++cacheClock;
+    return *victim;
+  }
+
+  void markDirty(CacheEntry& entry) {
+    if (!entry.dirty) {
+      entry.dirty = true;
+      entry.dirtySince = millis();
+    }
+  }
+
+  void writeBack(CacheEntry& entry) {
+    if (!entry.valid || !entry.dirty) return;
+    if (writeRecord(entry.slot, entry.record)) {
+      countWrite();
+      entry.dirty = false;
+    }
+  }
+};
+
+#endif // TAG_STORE_H
@@ -0,0 +1,33 @@
+/**
+ * Seleção do backend de TagStore em tempo de compilação
+ *
+ * Configure em platformio.ini, por exemplo:
+ *   -DTAG_STORE_BACKEND=TAG_STORE_LITTLEFS
+ */
+
+#ifndef TAG_STORE_FACTORY_H
+#define TAG_STORE_FACTORY_H
+
+#include "TagStore.h"
+
+#ifndef TAG_STORE_BACKEND
+  #define TAG_STORE_BACKEND TAG_STORE_NVS
+#endif
+
+#if TAG_STORE_BACKEND == TAG_STORE_NVS
+  #include "TagStoreNVS.h"
+  typedef TagStoreNVS TagStoreBackend;
+#elif TAG_STORE_BACKEND == TAG_STORE_SPIFFS
+  #include "TagStoreSPIFFS.h"
+  typedef TagStoreSPIFFS TagStoreBackend;
+#elif TAG_STORE_BACKEND == TAG_STORE_LITTLEFS
+  #include "TagStoreLittleFS.h"
+  typedef TagStoreLittleFS TagStoreBackend;
+#elif TAG_STORE_BACKEND == TAG_STORE_RAM
+  #include "TagStoreRAM.h"
+  typedef TagStoreRAM TagStoreBackend;
+#else
+  #error "TAG_STORE_BACKEND inválido (use TAG_STORE_NVS, _SPIFFS, _LITTLEFS ou _RAM)"
+#endif
+
+#endif // TAG_STORE_FACTORY_H
@@ -0,0 +1,182 @@
+/**
+ * TagStore sobre sistema de arquivos (base de SPIFFS e LittleFS)
+ *
+ * Arquivo binário /tags.bin:
+ *   cabeçalho de 16 bytes (magic "TAGS", versão, contador, época)
+ *   seguido de registros TagRecord de 24 bytes (slot i no offset 16 + i*24)
+ *
+ * Toques alteram o registro no próprio lugar (seek + write).
+ * O formato antigo em texto (/tags.txt, um UID por linha) é migrado
+ * automaticamente no begin().
+ */
+
+#ifndef TAG_STORE_FILE_H
+#define TAG_STORE_FILE_H
+
+#include <FS.h>
+#include "TagStore.h"
+
+class TagStoreFile : public TagStore {
+protected:
+    const char* TAGS_FILE = "/tags.bin";
+    const char* LEGACY_TAGS_FILE = "/tags.txt";
+
+    static const uint32_t FILE_MAGIC = 0x53474154;  // "TAGS"
+    static const uint16_t FILE_VERSION = 1;
+
+    struct __attribute__((packed)) FileHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t recordSize;
+        uint32_t count;
+        uint32_t epoch;
+    };
+
+    fs::FS& fs;
+    File dataFile;
+
+    explicit TagStoreFile(fs::FS& filesystem) : fs(filesystem) {}
+
+    /**
+     * Monta o sistema de arquivos (implementado por SPIFFS/LittleFS)
+     */
+    virtual bool mountFS() = 0;
+
+    static size_t offsetOf(uint32_t slot) {
+        return sizeof(FileHeader) + (size_t)slot * sizeof(TagRecord);
+    }
+
+    bool createEmptyFile() {
+        if (dataFile) dataFile.close();
+
+        File file = fs.open(TAGS_FILE, "w");
+        if (!file) {
+            Serial.println("❌ Erro ao criar arquivo de tags!");
+            return false;
+        }
+        FileHeader header = { FILE_MAGIC, FILE_VERSION, sizeof(TagRecord), 0, 0 };
+        file.write((const uint8_t*)&header, sizeof(header));
+        file.close();
+
+        dataFile = fs.open(TAGS_FILE, "r+");
+        return (bool)dataFile;
+    }
+
+    bool mount() override {
+        Serial.printf("💾 Montando %s...\n", name());
+
+        if (!mountFS()) {
+            Serial.printf("❌ Falha ao montar %s!\n", name());
+            return false;
+        }
+
+        if (!fs.exists(TAGS_FILE)) {
+            Serial.println("📝 Criando arquivo de tags...");
+            return createEmptyFile();
+        }
+
+        dataFile = fs.open(TAGS_FILE, "r+");
+        FileHeader header = {};
+        if (!dataFile ||
+            dataFile.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+            header.magic != FILE_MAGIC || header.recordSize != sizeof(TagRecord)) {
+            Serial.println("⚠️ Arquivo de tags inválido - recriando...");
+            return createEmptyFile();
+        }
+        return true;
+    }
+
+    FileHeader readHeader() {
+        FileHeader header = {};
+        dataFile.seek(0);
+        dataFile.read((uint8_t*)&header, sizeof(header));
+        return header;
+    }
+
+    bool writeHeader(uint32_t count, uint32_t epoch) {
+        FileHeader header = { FILE_MAGIC, FILE_VERSION, sizeof(TagRecord), count, epoch };
+        dataFile.seek(0);
+        bool ok = dataFile.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+        dataFile.flush();
+        return ok;
+    }
+
+    uint32_t loadCount() override {
+        // Nunca além do que existe no arquivo
+        uint32_t stored = (dataFile.size() - sizeof(FileHeader)) / sizeof(TagRecord);
+        return min(readHeader().count, stored);
+    }
+
+    bool storeCount(uint32_t count) override {
+        return writeHeader(count, epoch());
+    }
+
+    uint32_t loadEpoch() override {
+        return readHeader().epoch;
+    }
+
+    bool storeEpoch(uint32_t epoch) override {
+        // Contador zerado na mesma escrita: o reset é uma única gravação de 16 bytes
+        return writeHeader(0, epoch);
+    }
+
+    uint32_t readRecords(uint32_t slot, TagRecord* out, uint32_t n) override {
+        if (!dataFile.seek(offsetOf(slot))) return 0;
+        size_t bytes = dataFile.read((uint8_t*)out, n * sizeof(TagRecord));
+        return bytes / sizeof(TagRecord);
+    }
+
+    bool writeRecord(uint32_t slot, const TagRecord& record) override {
+        if (!dataFile.seek(offsetOf(slot))) return false;
+        bool ok = dataFile.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+        dataFile.flush();
+        return ok;
+    }
+
+    /**
+     * Apaga slots antigos com uma única escrita de registros vazios
+     */
+    bool eraseSlots(uint32_t from, uint32_t to) override {
+        static const TagRecord empty[TAG_STORE_BLOCK_RECORDS] = {};
+        while (from < to) {
+            uint32_t n = min<uint32_t>(to - from, TAG_STORE_BLOCK_RECORDS);
+            if (!dataFile.seek(offsetOf(from))) return false;
+            if (dataFile.write((const uint8_t*)empty, n * sizeof(TagRecord)) != n * sizeof(TagRecord)) {
+                return false;
+            }
+            from += n;
+        }
+        dataFile.flush();
+        return true;
+    }
+
+    /**
+     * Importa /tags.txt (formato antigo) e remove o arquivo
+     */
+    void migrateLegacy() override {
+        if (!fs.exists(LEGACY_TAGS_FILE)) return;
+
+        File legacy = fs.open(LEGACY_TAGS_FILE, "r");
+        if (!legacy) return;
+
+        Serial.printf("🔄 Migrando %s para %s...\n", LEGACY_TAGS_FILE, TAGS_FILE);
+        while (legacy.available()) {
+            String uid = legacy.readStringUntil('\n');
+            uid.trim();
+            if (uid.length() == 0 || uid.startsWith("#")) continue;
+
+            TagRecord record = {};
+            if (record.setUID(uid) && !contains(uid)) {
+                record.touch(0);
+                appendRecord(record);
+            }
+        }
+        legacy.close();
+        flush();
+
+        fs.remove(LEGACY_TAGS_FILE);
+        Serial.printf("✅ Migração concluída: %lu tags\n", (unsigned long)count());
+    }
+};
+
+#endif // TAG_STORE_FILE_H
@@ -0,0 +1,24 @@
+/**
+ * TagStore sobre LittleFS
+ * Usa a mesma partição "spiffs" da tabela padrão
+ */
+
+#ifndef TAG_STORE_LITTLEFS_H
+#define TAG_STORE_LITTLEFS_H
+
+#include <LittleFS.h>
+#include "TagStoreFile.h"
+
+class TagStoreLittleFS : public TagStoreFile {
+public:
+    TagStoreLittleFS() : TagStoreFile(LittleFS) {}
+
+    const char* name() const override { return "LittleFS"; }
+
+protected:
+    bool mountFS() override {
+        return LittleFS.begin(true);  // true = format on fail
+    }
+};
+
+#endif // TAG_STORE_LITTLEFS_H
@@ -0,0 +1,188 @@
+/**
+ * TagStore sobre NVS (Preferences)
+ *
+ * Layout no namespace "rfid_tags":
+ *   state -> contador de registros + época (blob de 8 bytes; o contador é
+ *            gravado de forma preguiçosa, o reset grava os dois de uma vez)
+ *   p<n>  -> página com TAG_NVS_PAGE_RECORDS registros TagRecord (blob)
+ *
+ * Agrupar registros em páginas reduz o número de chaves e as entradas
+ * de 32 bytes que a NVS gasta por chave. Os formatos antigos (count +
+ * tag_<i> como string; rcount + epoch em chaves separadas) são migrados
+ * automaticamente no begin().
+ */
+
+#ifndef TAG_STORE_NVS_H
+#define TAG_STORE_NVS_H
+
+#include <Preferences.h>
+#include "TagStore.h"
+
+#define TAG_NVS_PAGE_RECORDS 16
+
+class TagStoreNVS : public TagStore {
+private:
+    const char* PREFS_NAMESPACE = "rfid_tags";
+    const char* PREFS_STATE_KEY = "state";
+    const char* LEGACY_RCOUNT_KEY = "rcount";
+    const char* LEGACY_EPOCH_KEY = "epoch";
+    const char* LEGACY_COUNT_KEY = "count";
+    const char* LEGACY_TAG_PREFIX = "tag_";
+
+    struct State {
+        uint32_t count;
+        uint32_t epoch;
+    };
+
+    Preferences prefs;
+
+    // Última página lida (evita reler o blob a cada registro)
+    TagRecord page[TAG_NVS_PAGE_RECORDS];
+    int32_t cachedPage = -1;
+
+    State loadState() {
+        State state = {};
+        prefs.getBytes(PREFS_STATE_KEY, &state, sizeof(state));
+        return state;
+    }
+
+    bool storeState(uint32_t count, uint32_t epoch) {
+        State state = { count, epoch };
+        return prefs.putBytes(PREFS_STATE_KEY, &state, sizeof(state)) == sizeof(state);
+    }
+
+    static String pageKey(uint32_t pageIndex) {
+        return "p" + String(pageIndex);
+    }
+
+    bool loadPage(uint32_t pageIndex) {
+        if ((int32_t)pageIndex == cachedPage) return true;
+        memset(page, 0, sizeof(page));
+        prefs.getBytes(pageKey(pageIndex).c_str(), page, sizeof(page));
+        cachedPage = pageIndex;
+        return true;
+    }
+
+    /**
+     * Grava a página em cache, só até o último slot usado
+     */
+    bool storePage(uint32_t pageIndex) {
+        size_t used = 0;
+        for (int i = 0; i < TAG_NVS_PAGE_RECORDS; i++) {
+            if (page[i].uidLen != 0) used = i + 1;
+        }
+        bool ok = used == 0 ? prefs.remove(pageKey(pageIndex).c_str())
+                            : prefs.putBytes(pageKey(pageIndex).c_str(), page, used * sizeof(TagRecord)) > 0;
+        if (!ok) cachedPage = -1;
+        return ok;
+    }
+
+public:
+    const char* name() const override { return "NVS"; }
+
+protected:
+    /**
+     * Abre o namespace em modo leitura/escrita e mantém aberto.
+     * nvs_flash_init() deve ter sido chamado antes.
+     */
+    bool mount() override {
+        cachedPage = -1;
+        if (!prefs.begin(PREFS_NAMESPACE, false)) {
+            Serial.println("❌ Falha ao abrir namespace NVS!");
+            return false;
+        }
+
+        // rcount/epoch em chaves separadas (versão anterior): vira "state"
+        if (!prefs.isKey(PREFS_STATE_KEY) &&
+            (prefs.isKey(LEGACY_RCOUNT_KEY) || prefs.isKey(LEGACY_EPOCH_KEY))) {
+            if (storeState(prefs.getUInt(LEGACY_RCOUNT_KEY, 0), prefs.getUChar(LEGACY_EPOCH_KEY, 0))) {
+                prefs.remove(LEGACY_RCOUNT_KEY);
+                prefs.remove(LEGACY_EPOCH_KEY);
+            }
+        }
+        return true;
+    }
+
+    uint32_t loadCount() override {
+        return loadState().count;
+    }
+
+    bool storeCount(uint32_t count) override {
+        return storeState(count, epoch());
+    }
+
+    uint32_t loadEpoch() override {
+        return loadState().epoch;
+    }
+
+    bool storeEpoch(uint32_t epoch) override {
+        // Contador zerado na mesma chave: o reset é uma única gravação
+        return storeState(0, epoch);
+    }
+
+    uint32_t readRecords(uint32_t slot, TagRecord* out, uint32_t n) override {
+        for (uint32_t i = 0; i < n; i++) {
+            loadPage((slot + i) / TAG_NVS_PAGE_RECORDS);
+            out[i] = page[(slot + i) % TAG_NVS_PAGE_RECORDS];
+        }
+        return n;
+    }
+
+    bool writeRecord(uint32_t slot, const TagRecord& record) override {
+        uint32_t pageIndex = slot / TAG_NVS_PAGE_RECORDS;
+        loadPage(pageIndex);
+        page[slot % TAG_NVS_PAGE_RECORDS] = record;
+        return storePage(pageIndex);
+    }
+
+    /**
+     * Páginas inteiramente antigas são removidas (libera entradas da NVS);
+     * página parcial é regravada só com os slots válidos
+     */
+    bool eraseSlots(uint32_t from, uint32_t to) override {
+        uint32_t firstPage = from / TAG_NVS_PAGE_RECORDS;
+        uint32_t lastPage = (to - 1) / TAG_NVS_PAGE_RECORDS;
+        for (uint32_t pageIndex = firstPage; pageIndex <= lastPage; pageIndex++) {
+            uint32_t pageStart = pageIndex * TAG_NVS_PAGE_RECORDS;
+            if (from <= pageStart) {
+                prefs.remove(pageKey(pageIndex).c_str());
+                if ((int32_t)pageIndex == cachedPage) cachedPage = -1;
+                continue;
+            }
+            loadPage(pageIndex);
+            uint32_t end = min<uint32_t>(to, pageStart + TAG_NVS_PAGE_RECORDS);
+            memset(&page[from - pageStart], 0, (end - from) * sizeof(TagRecord));
+            if (!storePage(pageIndex)) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Importa o formato antigo (count + tag_<i>) e remove as chaves antigas
+     */
+    void migrateLegacy() override {
+        if (!prefs.isKey(LEGACY_COUNT_KEY)) return;
+
+        int legacyCount = prefs.getInt(LEGACY_COUNT_KEY, 0);
+        Serial.printf("🔄 Migrando %d tags do formato antigo da NVS...\n", legacyCount);
+
+        for (int i = 0; i < legacyCount; i++) {
+            String uid = prefs.getString((String(LEGACY_TAG_PREFIX) + String(i)).c_str(), "");
+            TagRecord record = {};
+            if (record.setUID(uid) && !contains(uid)) {
+                record.touch(0);
+                appendRecord(record);
+            }
+        }
+        flush();
+
+        // Só remove as chaves antigas depois que os registros novos estão gravados
+        for (int i = 0; i < legacyCount; i++) {
+            prefs.remove((String(LEGACY_TAG_PREFIX) + String(i)).c_str());
+        }
+        prefs.remove(LEGACY_COUNT_KEY);
+        Serial.printf("✅ Migração concluída: %lu tags\n", (unsigned long)count());
+    }
+};
+
+#endif // TAG_STORE_NVS_H
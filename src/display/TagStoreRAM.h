@@ -0,0 +1,67 @@
+/**
+ * TagStore somente em RAM
+ * Útil para testes e eventos curtos: os dados são perdidos no reset.
+ */
+
+#ifndef TAG_STORE_RAM_H
+#define TAG_STORE_RAM_H
+
+#include "TagStore.h"
+
+class TagStoreRAM : public TagStore {
+private:
+    std::vector<TagRecord> records;
+
+public:
+    const char* name() const override { return "RAM"; }
+
+protected:
+    bool mount() override {
+        records.clear();
+        return true;
+    }
+
+    uint32_t loadCount() override {
+        return 0;
+    }
+
+    bool storeCount(uint32_t) override {
+        return true;
+    }
+
+    uint32_t loadEpoch() override {
+        return 0;
+    }
+
+    bool storeEpoch(uint32_t) override {
+        return true;
+    }
+
+    uint32_t readRecords(uint32_t slot, TagRecord* out, uint32_t n) override {
+        if (slot >= records.size()) return 0;
+        n = min<uint32_t>(n, records.size() - slot);
+        memcpy(out, &records[slot], n * sizeof(TagRecord));
+        return n;
+    }
+
+    bool writeRecord(uint32_t slot, const TagRecord& record) override {
+        if (slot >= records.size()) records.resize(slot + 1);
+        records[slot] = record;
+        return true;
+    }
+
+    bool eraseSlots(uint32_t from, uint32_t to) override {
+        if (to >= records.size()) {
+            records.resize(min<size_t>(from, records.size()));
+        } else {
+            memset(&records[from], 0, (to - from) * sizeof(TagRecord));
+        }
+        return true;
+    }
+
+    bool persistent() const override {
+        return false;
+    }
+};
+
+#endif // TAG_STORE_RAM_H
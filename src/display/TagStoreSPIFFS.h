@@ -0,0 +1,24 @@
+/**
+ * TagStore sobre SPIFFS
+ * Substitui o antigo TagStorageSPIFFS (migra /tags.txt automaticamente)
+ */
+
+#ifndef TAG_STORE_SPIFFS_H
+#define TAG_STORE_SPIFFS_H
+
+#include <SPIFFS.h>
+#include "TagStoreFile.h"
+
+class TagStoreSPIFFS : public TagStoreFile {
+public:
+    TagStoreSPIFFS() : TagStoreFile(SPIFFS) {}
+
+    const char* name() const override { return "SPIFFS"; }
+
+protected:
+    bool mountFS() override {
+        return SPIFFS.begin(true);  // true = format on fail
+    }
+};
+
+#endif // TAG_STORE_SPIFFS_H
@@ -0,0 +1,347 @@
+/**
+ * Exportação/importação binária do TagStore via serial
+ *
+ * Comandos (linha de texto, pelo link do Reader ou pela USB):
+ *   CMD|EXPORT|<indice>          -> display envia quadros SYNC_CHUNK a
+ *                                   partir de <indice> e termina com SYNC_END
+ *   CMD|IMPORT|<total>|<id>      -> display recebe quadros SYNC_CHUNK e
+ *                                   mescla os registros (TagStore::merge)
+ *
+ * Cada quadro leva até SYNC_MAX_RECORDS registros TagRecord com CRC32
+ * (formato em src/common/protocol.h). O receptor confirma com
+ * ACK|<proximo_indice>; quadro corrompido ou fora de ordem recebe
+ * NAK|<proximo_indice> e o emissor retoma dali.
+ *
+ * Retomada: uma importação interrompida com o mesmo <id> continua do
+ * último quadro confirmado; uma exportação é retomada com CMD|EXPORT
+ * a partir do último índice recebido.
+ *
+ * Enquanto a transferência está ativa, a porta é lida só por poll()
+ * (o loop principal não deve ler linhas dela). Cada quadro e cada
+ * resposta sai numa única write(): logs de outras tasks na mesma porta
+ * ficam entre quadros/linhas, nunca no meio.
+ */
+
+#ifndef TAG_SYNC_H
+#define TAG_SYNC_H
+
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+#include "TagStore.h"
+#include "../common/protocol.h"
+
+static_assert(sizeof(TagRecord) == SYNC_RECORD_SIZE, "SYNC_RECORD_SIZE deve ser sizeof(TagRecord)");
+
+// Sem dados do host por este tempo, a importação é suspensa (pode ser retomada)
+#ifndef TAG_SYNC_IMPORT_TIMEOUT_MS
+  #define TAG_SYNC_IMPORT_TIMEOUT_MS 5000
+#endif
+
+class TagSync {
+public:
+    enum Mode {
+        SYNC_IDLE,
+        SYNC_EXPORTING,
+        SYNC_IMPORTING
+    };
+
+private:
+    static const size_t MAX_FRAME = SYNC_HEADER_SIZE + SYNC_MAX_RECORDS * SYNC_RECORD_SIZE + 4;
+
+    TagStore* store = NULL;
+    Stream* port = NULL;
+    Mode mode = SYNC_IDLE;
+
+    // Exportação
+    uint32_t exportIndex = 0;       // próximo registro a enviar
+    uint32_t exportGeneration = 0;
+    bool awaitingAck = false;
+    bool endSent = false;
+    uint8_t retries = 0;
+    unsigned long sentAt = 0;
+    String line;
+
+    // Importação
+    uint32_t importId = 0;
+    uint32_t importTotal = 0;
+    uint32_t importNext = 0;        // próximo índice esperado (retomada)
+    uint32_t importAdded = 0;
+    uint32_t importMerged = 0;
+    unsigned long lastByteAt = 0;
+    uint8_t frame[MAX_FRAME];       // quadro recebido ou, na exportação, a enviar
+    size_t frameUsed = 0;
+
+    unsigned long startedAt = 0;
+
+    static void putU32(uint8_t* p, uint32_t v) {
+        p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+    }
+
+    static uint32_t getU32(const uint8_t* p) {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    void reply(const char* type, uint32_t next) {
+        char text[24];
+        int len = snprintf(text, sizeof(text), "%s|%lu\n", type, (unsigned long)next);
+        port->write((const uint8_t*)text, len);
+    }
+
+    void finish(const char* result) {
+        Serial.printf("🔁 Sync %s: %s (%lu ms)\n",
+                      mode == SYNC_EXPORTING ? "export" : "import",
+                      result, millis() - startedAt);
+        mode = SYNC_IDLE;
+        port = NULL;
+    }
+
+    // ---------------------------
+    // Exportação
+    // ---------------------------
+
+    void sendFrame(uint8_t type, uint32_t index, const TagRecord* records, uint16_t n) {
+        frame[0] = SYNC_MAGIC_0;
+        frame[1] = SYNC_MAGIC_1;
+        frame[2] = type;
+        putU32(frame + 3, index);
+        frame[7] = n;
+        frame[8] = n >> 8;
+        size_t size = SYNC_HEADER_SIZE + n * SYNC_RECORD_SIZE;
+        if (n) memcpy(frame + SYNC_HEADER_SIZE, records, n * SYNC_RECORD_SIZE);
+        putU32(frame + size, esp_rom_crc32_le(0, frame + 2, size - 2));
+
+        port->write(frame, size + 4);
+        sentAt = millis();
+        awaitingAck = true;
+    }
+
+    void sendCurrent() {
+        TagRecord records[SYNC_MAX_RECORDS];
+        uint32_t generation;
+        uint32_t n = store->read(exportIndex, records, SYNC_MAX_RECORDS, &generation);
+        if (generation != exportGeneration) {
+            sendFrame(SYNC_ABORT, exportIndex, NULL, 0);
+            finish("TagStore zerado durante a exportação");
+            return;
+        }
+        endSent = (n == 0);
+        sendFrame(endSent ? SYNC_END : SYNC_CHUNK, exportIndex, records, n);
+    }
+
+    void pollExport() {
+        // Respostas do host: ACK|<proximo> ou NAK|<proximo>
+        while (port->available()) {
+            char c = port->read();
+            if (c == '\r') continue;
+            if (c != '\n') {
+                if (line.length() < 32) line += c;
+                continue;
+            }
+
+            String type = CommProtocol::getMessageType(line);
+            uint32_t next = strtoul(line.c_str() + line.indexOf('|') + 1, NULL, 10);
+            line = "";
+
+            if (type == MSG_ACK) {
+                if (endSent && next >= exportIndex) {
+                    finish("concluída");
+                    return;
+                }
+                if (next > exportIndex) retries = 0;   // só avanço zera as tentativas
+                exportIndex = next;
+                awaitingAck = false;
+            } else if (type == MSG_NAK) {
+                // NAK conta como tentativa: host que rejeita sempre o mesmo
+                // quadro (CRC) não prende a exportação
+                if (++retries > SYNC_MAX_RETRIES) {
+                    finish("host rejeitou o quadro");
+                    return;
+                }
+                exportIndex = next;
+                awaitingAck = false;
+            }
+        }
+
+        if (awaitingAck && millis() - sentAt >= SYNC_ACK_TIMEOUT_MS) {
+            if (++retries > SYNC_MAX_RETRIES) {
+                finish("host não respondeu");
+                return;
+            }
+            awaitingAck = false;   // reenvia o mesmo quadro
+        }
+
+        if (!awaitingAck) sendCurrent();
+    }
+
+    // ---------------------------
+    // Importação
+    // ---------------------------
+
+    void pollImport() {
+        while (port->available()) {
+            uint8_t b = port->read();
+            lastByteAt = millis();
+
+            // Procura o início do quadro (ignora texto/ruído entre quadros)
+            if (frameUsed == 0 && b != SYNC_MAGIC_0) continue;
+            if (frameUsed == 1 && b != SYNC_MAGIC_1) {
+                frameUsed = (b == SYNC_MAGIC_0) ? 1 : 0;
+                continue;
+            }
+            frame[frameUsed++] = b;
+
+            if (frameUsed < SYNC_HEADER_SIZE) continue;
+            uint16_t n = frame[7] | (frame[8] << 8);
+            if (n > SYNC_MAX_RECORDS) {
+                frameUsed = 0;
+                reply(MSG_NAK, importNext);
+                continue;
+            }
+            size_t frameSize = SYNC_HEADER_SIZE + n * SYNC_RECORD_SIZE + 4;
+            if (frameUsed < frameSize) continue;
+
+            frameUsed = 0;
+            handleFrame(frame[2], getU32(frame + 3), n, frameSize);
+            if (mode != SYNC_IMPORTING) return;
+        }
+
+        if (millis() - lastByteAt >= TAG_SYNC_IMPORT_TIMEOUT_MS) {
+            store->flush();
+            finish("suspensa por timeout (retomável)");
+        }
+    }
+
+    void handleFrame(uint8_t type, uint32_t index, uint16_t n, size_t frameSize) {
+        uint32_t crc = esp_rom_crc32_le(0, frame + 2, frameSize - 6);
+        if (crc != getU32(frame + frameSize - 4)) {
+            reply(MSG_NAK, importNext);
+            return;
+        }
+
+        if (type == SYNC_ABORT) {
+            store->flush();
+            finish("cancelada pelo host");
+            return;
+        }
+
+        if (type == SYNC_END) {
+            store->flush();
+            char text[48];
+            int len = snprintf(text, sizeof(text), "%s|END|%lu|%lu\n", MSG_ACK,
+                               (unsigned long)importAdded, (unsigned long)importMerged);
+            port->write((const uint8_t*)text, len);
+            importId = 0;
+            Serial.printf("🔁 Importação: %lu tags novas, %lu mescladas\n",
+                          (unsigned long)importAdded, (unsigned long)importMerged);
+            finish("concluída");
+            return;
+        }
+
+        if (type != SYNC_CHUNK) {
+            reply(MSG_NAK, importNext);
+            return;
+        }
+
+        if (index == importNext) {
+            // Só confirma depois de mesclar: reenvio após ACK perdido não duplica toques
+            const TagRecord* records = (const TagRecord*)(frame + SYNC_HEADER_SIZE);
+            for (uint16_t i = 0; i < n; i++) {
+                TagRecord record;
+                memcpy(&record, &records[i], sizeof(record));
+                if (store->merge(record)) {
+                    importAdded++;
+                } else {
+                    importMerged++;
+                }
+            }
+            importNext += n;
+            reply(MSG_ACK, importNext);
+        } else if (index < importNext) {
+            reply(MSG_ACK, importNext);   // quadro repetido: já mesclado
+        } else {
+            reply(MSG_NAK, importNext);   // faltou um quadro
+        }
+    }
+
+public:
+    void begin(TagStore& tagStore) {
+        store = &tagStore;
+    }
+
+    /**
+     * Trata CMD|EXPORT e CMD|IMPORT recebidos em stream.
+     * Retorna true se o comando era de sincronização.
+     */
+    bool handleCommand(const String& message, Stream& stream) {
+        if (CommProtocol::getMessageType(message) != MSG_CMD || store == NULL) return false;
+
+        int sep1 = message.indexOf('|');
+        int sep2 = message.indexOf('|', sep1 + 1);
+        String command = message.substring(sep1 + 1, sep2 < 0 ? -1 : sep2);
+        String args = sep2 < 0 ? String("") : message.substring(sep2 + 1);
+
+        if (command != CMD_EXPORT && command != CMD_IMPORT) return false;
+        if (mode != SYNC_IDLE) {
+            stream.println(CommProtocol::encodeError("SYNC_BUSY"));
+            return true;
+        }
+
+        port = &stream;
+        line = "";
+        frameUsed = 0;
+        startedAt = millis();
+
+        if (command == CMD_EXPORT) {
+            store->flush();
+            exportIndex = strtoul(args.c_str(), NULL, 10);
+            exportGeneration = store->generation();
+            awaitingAck = false;
+            endSent = false;
+            retries = 0;
+            mode = SYNC_EXPORTING;
+            Serial.printf("🔁 Exportando %lu tags a partir de %lu...\n",
+                          (unsigned long)store->count(), (unsigned long)exportIndex);
+        } else {
+            int sep = args.indexOf('|');
+            uint32_t total = strtoul(args.c_str(), NULL, 10);
+            uint32_t id = sep < 0 ? 0 : strtoul(args.c_str() + sep + 1, NULL, 10);
+
+            // Mesmo id de uma importação interrompida: continua de onde parou
+            if (id == 0 || id != importId || total != importTotal) {
+                importId = id;
+                importTotal = total;
+                importNext = 0;
+                importAdded = 0;
+                importMerged = 0;
+            }
+            lastByteAt = millis();
+            mode = SYNC_IMPORTING;
+            Serial.printf("🔁 Importando %lu tags (a partir de %lu)...\n",
+                          (unsigned long)total, (unsigned long)importNext);
+            reply(MSG_ACK, importNext);
+        }
+        return true;
+    }
+
+    /**
+     * Chamar no loop(): avança a transferência sem bloquear
+     */
+    void poll() {
+        if (mode == SYNC_EXPORTING) {
+            pollExport();
+        } else if (mode == SYNC_IMPORTING) {
+            pollImport();
+        }
+    }
+
+    /**
+     * true enquanto a transferência usa stream (não ler linhas dela)
+     */
+    bool active(const Stream& stream) const {
+        return mode != SYNC_IDLE && port == &stream;
+    }
+
+    Mode currentMode() const { return mode; }
+};
+
+#endif // TAG_SYNC_H
@@ -0,0 +1,136 @@
+/**
+ * Uso de CPU e pilha por task (relatório "🧵 Tasks")
+ *
+ * Cada task da tela marca o trecho em que trabalha com um Busy (RAII) entre
+ * uma espera e outra; o monitor soma os µs ocupados. report() mostra, por
+ * task, a % de CPU desde o relatório anterior, a menor pilha livre já vista
+ * (uxTaskGetStackHighWaterMark) e núcleo/prioridade:
+ *
+ *   for (;;) {
+ *     xQueueReceive(...);                            // esperando: não conta
+ *     TaskMonitor::Busy busy(taskMonitor, TASK_INGEST);
+ *     ...
+ *   }
+ *
+ * Tasks de bibliotecas (tag_backup, qr_cache, lvgl) entram pelo nome com
+ * watch(): só pilha, sem CPU (o Arduino vem sem configGENERATE_RUN_TIME_STATS).
+ */
+
+#ifndef TASK_MONITOR_H
+#define TASK_MONITOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#ifndef TASK_MONITOR_SLOTS
+  #define TASK_MONITOR_SLOTS 8
+#endif
+
+class TaskMonitor {
+  struct Slot {
+    const char* name;
+    TaskHandle_t handle;
+    uint32_t stackBytes;          // 0 = desconhecido (watch())
+    bool timed;                   // usa Busy
+    volatile uint32_t busyMicros; // só a própria task escreve
+    uint32_t reportedMicros;      // busyMicros no relatório anterior
+  };
+
+  Slot slots[TASK_MONITOR_SLOTS];
+  uint8_t count = 0;
+  uint32_t windowStart = 0;
+
+public:
+  /**
+   * Marca o trecho ocupado da task id (construtor → destrutor)
+   */
+  class Busy {
+    TaskMonitor& monitor;
+    uint8_t id;
+    uint32_t start;
+
+  public:
+    Busy(TaskMonitor& m, uint8_t slot) : monitor(m), id(slot), start(micros()) {}
+    ~Busy() { monitor.slots[id].busyMicros += micros() - start; }
+  };
+
+  /**
+   * Cria a task fixa no núcleo e registra no slot id (enum da aplicação,
+   * a partir de 0). false = sem memória para a pilha.
+   */
+  bool start(uint8_t id, TaskFunction_t entry, const char* name, uint32_t stackBytes,
+             UBaseType_t priority, BaseType_t core, void* arg = NULL) {
+    if (id >= TASK_MONITOR_SLOTS) return false;
+    Slot& slot = slots[id];
+    slot.name = name;
+    slot.stackBytes = stackBytes;
+    slot.timed = true;
+    slot.busyMicros = slot.reportedMicros = 0;
+    slot.handle = NULL;
+    if (count <= id) count = id + 1;
+    if (windowStart == 0) windowStart = micros();
+    return xTaskCreatePinnedToCore(entry, name, stackBytes, arg, priority, &slot.handle, core) == pdPASS;
+  }
+
+  /**
+   * Task criada por outra classe: relatório só com a pilha (chamar depois
+   * dos start())
+   */
+  void watch(const char* name) {
+    if (count >= TASK_MONITOR_SLOTS) return;
+    Slot& slot = slots[count++];
+    slot.name = name;
+    slot.handle = NULL;
+    slot.stackBytes = 0;
+    slot.timed = false;
+    slot.busyMicros = slot.reportedMicros = 0;
+  }
+
+  TaskHandle_t handle(uint8_t id) const { return id < count ? slots[id].handle : NULL; }
+
+  /**
+   * Uma linha por task; CPU desde o relatório anterior
+   */
+  void report(Print& out) {
+    uint32_t now = micros();
+    uint32_t window = now - windowStart;
+    windowStart = now;
+
+    out.printf("🧵 Tasks (últimos %lu ms):\n", (unsigned long)(window / 1000));
+    for (uint8_t i = 0; i < count; i++) {
+      Slot& slot = slots[i];
+      // Tasks de outras classes podem ser apagadas (lvgl): procura a cada vez
+      TaskHandle_t task = slot.timed ? slot.handle : xTaskGetHandle(slot.name);
+      if (task == NULL) {
+        out.printf("   %-10s (parada)\n", slot.name);
+        continue;
+      }
+
+      uint32_t freeStack = uxTaskGetStackHighWaterMark(task);
+      BaseType_t core = xTaskGetAffinity(task);
+      char where[8];
+      if (core == tskNO_AFFINITY) snprintf(where, sizeof(where), "-");
+      else snprintf(where, sizeof(where), "%d", (int)core);
+
+      out.printf("   %-10s núcleo %s prio %u: ", slot.name, where,
+                 (unsigned)uxTaskPriorityGet(task));
+      if (slot.timed) {
+        uint32_t busy = slot.busyMicros;
+        uint32_t used = busy - slot.reportedMicros;
+        slot.reportedMicros = busy;
+        out.printf("CPU %3lu%%, ", (unsigned long)(window ? (uint64_t)used * 100 / window : 0));
+      } else {
+        out.print("CPU   -, ");
+      }
+      if (slot.stackBytes) {
+        out.printf("pilha livre %lu de %lu B\n", (unsigned long)freeStack,
+                   (unsigned long)slot.stackBytes);
+      } else {
+        out.printf("pilha livre %lu B\n", (unsigned long)freeStack);
+      }
+    }
+  }
+};
+
+#endif // TASK_MONITOR_H
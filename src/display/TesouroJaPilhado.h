@@ -1,249 +0,0 @@
-#define TESOUROPILHADO_HEIGHT 243
-#define TESOUROPILHADO_WIDTH 240
-
-// array size is 172800
-static const uint32_t TesouroJaPilhado[] PROGMEM  = {
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x808080, 0xaaaaaa, 0x858585, 0xb3b3b3, 0xd4d4d4, 0xe4e4e4, 0xefefef, 0xfafafa, 0xfafafa, 0xfafafa, 0xfafafa, 0xf4f4f4, 0xefefef, 0xdedede, 0xc3c3c3, 0x9a9a9a, 0x7c7c7c, 0xffffff, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb3b3b3, 0xbfbfbf, 0xefefef, 0xd8d8d8, 0xdcdcdc, 0xf8f8f8, 0xe4e4e4, 0xebebeb, 0xf7f7f7, 0xf9f9f9, 0xededed, 0xf3f3f3, 0xf7f7f7, 0xf8f8f8, 0xfbfbfb, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfafafa, 0xf9f9f9, 0xf5f5f5, 0xf1f1f1, 0xf3f3f3, 0xfbfbfb, 0xf1f1f1, 0xe2e2e2, 0xf1f1f1, 0xf0f0f0, 0xd2d2d2, 0xe7e7e7, 0xcfcfcf, 0xcccccc, 0x636363, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x909090, 0xc9cece, 0xced1ce, 0xe5e7e7, 0xe7e8e8, 0xf0f0f0, 0xf2f2f2, 0xf7f7f7, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xf9f9f9, 0xf8f8f8, 0xefefef, 0xefefef, 0xdddddd, 0xd9d9d9, 0xdbdbdb, 0xbcbcbc, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd3d3d3, 0xdbdbdb, 0xe3e3e3, 0xededed, 0xf1f1f1, 0xf5f6f6, 0xf9fbfa, 0xfcfdfc, 0xfdfefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfafafa, 0xf9f9f9, 0xf5f5f5, 0xf1f1f1, 0xebebeb, 0xd9d9d9, 0xd0d0d0, 0x959595, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb9b9b9, 0xd0d0d0, 0xe3e3e3, 0xefefef, 0xf8f8f8, 0xfafafa, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xf9f9f9, 0xf0f0f0, 0xededed, 0xe3e3e3, 0xcccccc, 0x4e4e4e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x404040, 0xdddddd, 0xe7e5e7, 0xebeaea, 0xf4f4f4, 0xf9f9f9, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfffeff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfafafa, 0xf6f6f6, 0xf2f2f2, 0xe8e8e8, 0xdbdbdb, 0xb7b7b7, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcdcdcd, 0xe5e5e5, 0xefefef, 0xf9f9f9, 0xfdfdfd, 0xfffefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefffd, 0xfefefe, 0xfefefe, 0xfefffe, 0xfcfffc, 0xfdfefc, 0xfefdfc, 0xfefdfb, 0xfdfefd, 0xfdfefd, 0xfefefd, 0xfefdfd, 0xfcfefd, 0xfdfefc, 0xfffdfd, 0xfdfdfe, 0xfcfefb, 0xfcfdfa, 0xfcfdfb, 0xfdfdfc, 0xfcfdfc, 0xfdfefc, 0xfefffc, 0xfefffc, 0xfefefc, 0xfffefe, 0xfefefe, 0xfffefd, 0xfefefb, 0xfefff9, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfffffd, 0xfffffe, 0xfffeff, 0xfdffff, 0xfffefe, 0xfefdfd, 0xfdfefc, 0xfdfefb, 0xfefefd, 0xfefefd, 0xfdfdfc, 0xfdfdfc, 0xfefdfc, 0xfefefd, 0xfefefd, 0xfefffd, 0xfdfefd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfbfbfb, 0xf5f5f5, 0xefefef, 0xd7d7d7, 0xa6a6a6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc7c7c7, 0xe7e7e7, 0xf2f2f2, 0xf5f5f5, 0xfafafa, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xfffffe, 0xfffffe, 0xffffff, 0xffffff, 0xfffefd, 0xfefcf8, 0xfefdf9, 0xfdfef9, 0xfbfef9, 0xfdfef9, 0xfdfef9, 0xfdfef9, 0xfcfef9, 0xfcfefa, 0xfdfefa, 0xfdfef9, 0xfbfffb, 0xfefef9, 0xfefef7, 0xfefff6, 0xfefff5, 0xfefff3, 0xfefff4, 0xfefff6, 0xfefff2, 0xffffee, 0xffffee, 0xfeffee, 0xfffff5, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffc, 0xfefffd, 0xfffefc, 0xfbfefa, 0xfbfffb, 0xfafffb, 0xfafef9, 0xfdfffb, 0xfdfffd, 0xfdfefd, 0xfbfefb, 0xfcfefb, 0xfefffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfafafa, 0xf1f1f1, 0xe9e9e9, 0xdddddd, 0xaaaaaa, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xa1a1a1, 0xdcdcdc, 0xe9e9e9, 0xf6f6f6, 0xfbfbfb, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefeff, 0xfefefe, 0xfbfdf9, 0xfbfefb, 0xfafffb, 0xfbfefb, 0xfdfefa, 0xfdfdf9, 0xfffef9, 0xfffff9, 0xfffff7, 0xfffff6, 0xfffff3, 0xfeffe7, 0xfeffda, 0xfefdd2, 0xfefdce, 0xfefbc8, 0xfdf9c3, 0xfdfabf, 0xfcf9b9, 0xfcf8b0, 0xfcf7a7, 0xfbf7a4, 0xfcf6ac, 0xfbfacb, 0xe7e7df, 0xe4e4e1, 0xeaeae9, 0xf0f0f0, 0xf4f4f4, 0xf6f6f6, 0xf8f8f8, 0xfcfcfb, 0xfffffd, 0xffffff, 0xffffff, 0xfffffe, 0xfffffc, 0xffffff, 0xfeffff, 0xfffefc, 0xfefef9, 0xfdfefa, 0xfdfefa, 0xfdfef8, 0xfdfef8, 0xfdfefc, 0xfdfefc, 0xfefefd, 0xfefefd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfcfcfc, 0xfafafa, 0xf2f2f2, 0xe7e7e7, 0xcfcfcf, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcfcfcf, 0xe0e0e0, 0xf2f2f2, 0xf9f9f9, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefc, 0xfefefd, 0xfdfefd, 0xfffffc, 0xfffcf7, 0xfff9f3, 0xfff3ec, 0xfbe6e0, 0xf6d8d3, 0xf0cac6, 0xe7bfb5, 0xdbb2a3, 0xcfac94, 0xf1da89, 0xf4e777, 0xece05e, 0xede057, 0xecde4f, 0xecdb47, 0xebda40, 0xe9d834, 0xe9d529, 0xe7d422, 0xe6d41e, 0xecdd47, 0xbcb66b, 0x16161f, 0x0a0b06, 0x2d2e2d, 0x3d3d3d, 0x484848, 0x525252, 0x626262, 0x787876, 0x898988, 0x9b9b99, 0xb1aeac, 0xc2beba, 0xd8c6c4, 0xf1d8d5, 0xf9e9e2, 0xfef4ed, 0xfffcf5, 0xfffff9, 0xfefffd, 0xfdfefd, 0xfefefd, 0xfffefb, 0xfffefb, 0xfefffb, 0xfefffb, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefffe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xf6f6f6, 0xebebeb, 0xd7d7d7, 0xaaaaaa, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdadada, 0xeaeaea, 0xf8f8f8, 0xfbfbfb, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfffcfa, 0xfff6f3, 0xfaebe9, 0xf2d7d3, 0xe8bab6, 0xda9c9a, 0xd17f7d, 0xc85f5e, 0xc43b3d, 0xc01016, 0xc10000, 0xb10000, 0xd38900, 0xf8d214, 0xf4d700, 0xf3d700, 0xf4d800, 0xf5d800, 0xf6d800, 0xf6d900, 0xf6d800, 0xf5d600, 0xf2d300, 0xf1d619, 0xcebd4a, 0x2d2a0e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x3f0000, 0xa70000, 0xc3282a, 0xc84c4a, 0xce716d, 0xda978f, 0xe6b2ac, 0xedcbc5, 0xf7e2db, 0xfef2eb, 0xfff8f2, 0xfffbf4, 0xfffef6, 0xfefef6, 0xfefefd, 0xfefeff, 0xfdfdfe, 0xfdfdfd, 0xfefdfe, 0xfffeff, 0xfefefe, 0xfefefd, 0xfefefd, 0xfdfefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfcfcfc, 0xfafafa, 0xf2f2f2, 0xdddddd, 0xc8c8c8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x505050, 0xe5e5e5, 0xf0f0f0, 0xfafafa, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffeff, 0xfcfefd, 0xfdfefb, 0xffffff, 0xffffff, 0xfcf8fa, 0xe9e5e2, 0xe4cac7, 0xd9a5a5, 0xc9827e, 0xc35b5a, 0xc23736, 0xc81617, 0xce0000, 0xd80000, 0xe00908, 0xe5111d, 0xdf1919, 0xca000e, 0xd56f16, 0xfac516, 0xf7d500, 0xf6d600, 0xf5d801, 0xf5d801, 0xf6d802, 0xf8d801, 0xf9d901, 0xf8d902, 0xf9d800, 0xf5d71d, 0xd8c448, 0x4c4623, 0x000000, 0x030403, 0x000102, 0x010101, 0x010000, 0x000000, 0x010101, 0x000201, 0x020100, 0x000202, 0x000000, 0x42080a, 0xb1292c, 0xdb2529, 0xde1e20, 0xdf1619, 0xdd010e, 0xd90000, 0xd40000, 0xcc1c19, 0xc5443f, 0xc46a65, 0xcc8883, 0xd3a79b, 0xf3e6b6, 0xfcfcc6, 0xfffed9, 0xffffea, 0xfefef5, 0xfefdfb, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefb, 0xfefefb, 0xfcfefa, 0xfdfef9, 0xfefefb, 0xfefffc, 0xfefefc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xf6f6f6, 0xeaeaea, 0xc4c4c4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x808080, 0xdadada, 0xededed, 0xf9f9f9, 0xfbfbfb, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfdfffe, 0xf1efef, 0xd7d7d9, 0xafafaf, 0x736f6f, 0x7c2526, 0xbc0006, 0xd10000, 0xd80c02, 0xdb1d16, 0xe2251f, 0xe3271f, 0xe6241d, 0xea211d, 0xe61f1e, 0xe71c1e, 0xd10012, 0xce620f, 0xf7bb19, 0xf2ce03, 0xf6d302, 0xf7d302, 0xf4d501, 0xf3d701, 0xf4d701, 0xf5d802, 0xf6d904, 0xf9da01, 0xf7d913, 0xdecf50, 0x645c33, 0x000000, 0x050503, 0x010103, 0x000101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000100, 0x010101, 0x000000, 0x210201, 0xa4272b, 0xda282c, 0xe12223, 0xe32223, 0xe42323, 0xe32424, 0xe42323, 0xe12422, 0xe32221, 0xdf1a1b, 0xd20700, 0xba0000, 0xba5a00, 0xe9c52b, 0xedd943, 0xefe362, 0xf6ee8f, 0xfcf7ba, 0xfefdd6, 0xffffe4, 0xfeffee, 0xfefff8, 0xfefffa, 0xfefefb, 0xfefdfa, 0xfefef8, 0xfefef8, 0xfefffb, 0xfefefd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfcfcfc, 0xfbfbfb, 0xf6f6f6, 0xe9e9e9, 0xc8c8c8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x505050, 0xdadada, 0xf1f1f1, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xffffff, 0xfdfdfd, 0xe9e9e9, 0xc6c6c6, 0x8e8f8e, 0x4d4c4c, 0x000000, 0x000000, 0x740000, 0xc32829, 0xdd2220, 0xe22420, 0xe52420, 0xe7241f, 0xe7221f, 0xe4231f, 0xe72421, 0xe82421, 0xe62024, 0xdc0819, 0xca4c0f, 0xf2b518, 0xf5ce03, 0xf2d000, 0xf3d103, 0xf3d402, 0xf3d500, 0xf3d501, 0xf4d701, 0xf5d802, 0xf7db01, 0xf8da0b, 0xefd746, 0x7e7739, 0x000000, 0x030203, 0x010103, 0x000002, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000201, 0x060000, 0x902125, 0xd42d2d, 0xe42322, 0xe62122, 0xe62223, 0xe62223, 0xe52322, 0xe6231f, 0xe4241e, 0xe4231f, 0xe0201e, 0xd50816, 0xc84713, 0xf1b61f, 0xf5d000, 0xf2d200, 0xf1d400, 0xefd406, 0xebd739, 0xecde62, 0xf1e887, 0xf7f3a7, 0xfefcc5, 0xffffdb, 0xfdffeb, 0xfcfff7, 0xfcfffa, 0xfcfefb, 0xfefdfd, 0xfefcfc, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xf6f6f6, 0xe5e5e5, 0xc0c0c0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdedede, 0xececec, 0xf9f9f9, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xefefef, 0xc6c6c6, 0x828282, 0x2d2d2d, 0x000000, 0x000000, 0x000000, 0x000000, 0x721c1e, 0xc52d30, 0xd92322, 0xe02020, 0xe22022, 0xe42022, 0xe32221, 0xe52223, 0xe32424, 0xe62423, 0xe82524, 0xe51d20, 0xd23c12, 0xf0a81a, 0xf5ce09, 0xf2d002, 0xf4d102, 0xf2d202, 0xf1d302, 0xf2d400, 0xf3d400, 0xf3d500, 0xf5d800, 0xf6da00, 0xf2dd41, 0x9e9345, 0x000000, 0x010204, 0x000102, 0x010101, 0x000000, 0x010001, 0x010101, 0x000100, 0x010101, 0x000000, 0x000000, 0x000000, 0x7f1d1f, 0xd22d2d, 0xe62525, 0xe72121, 0xe52220, 0xe62223, 0xe52323, 0xe3211f, 0xe1251f, 0xe3251f, 0xe4241d, 0xd91916, 0xc82f0e, 0xefa820, 0xf1cf0d, 0xf6d208, 0xf7d503, 0xf7d601, 0xf8d600, 0xf6d600, 0xf1d400, 0xeed300, 0xebd41e, 0xecdb4b, 0xf2e778, 0xfaf49f, 0xfefcbe, 0xffffd7, 0xffffee, 0xfffff7, 0xfffefa, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xf3f3f3, 0xe5e5e5, 0xc8c8c8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd0d0d0, 0xf1f1f1, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffdfe, 0xfefefe, 0xfefefe, 0xfdfefe, 0xfefffe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xf8f8f8, 0xd3d3d3, 0x949494, 0x454444, 0x000000, 0x000000, 0x000000, 0x010000, 0x010202, 0x000000, 0x571613, 0xc03132, 0xdd2527, 0xe02323, 0xe12222, 0xdf2021, 0xe12020, 0xe62122, 0xe52121, 0xe32222, 0xe42222, 0xe31e22, 0xd22815, 0xeda019, 0xf8d10e, 0xf4d203, 0xf2d402, 0xf2d401, 0xf2d501, 0xf2d400, 0xf2d400, 0xf0d401, 0xf3d501, 0xf4d500, 0xf3dc35, 0xb7ab4d, 0x000000, 0x000000, 0x020103, 0x000100, 0x000100, 0x000000, 0x010000, 0x010002, 0x020101, 0x010100, 0x000102, 0x000000, 0x691b1b, 0xc52d31, 0xe22523, 0xe52020, 0xe62022, 0xe42221, 0xe42223, 0xe32222, 0xe32120, 0xe4211f, 0xe4231d, 0xe2201c, 0xcb1e0e, 0xe99e1e, 0xf9cf12, 0xf3d304, 0xf6d409, 0xf4d504, 0xf4d703, 0xf5d506, 0xf7d505, 0xf6d502, 0xf6d601, 0xf5d600, 0xf3d600, 0xefd500, 0xeed516, 0xeddd42, 0xf4e87d, 0xf9f8c2, 0xf8faf0, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xf4f4f4, 0xe8e8e8, 0xbbbbbb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbebebe, 0xececec, 0xf7f7f7, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfcfffc, 0xfcfefc, 0xfbfefd, 0xfdfdfd, 0xfdfefe, 0xffffff, 0xffffff, 0xfafbfb, 0xe5e7e6, 0xb0b0b0, 0x626262, 0x000000, 0x000000, 0x000000, 0x000000, 0x020103, 0x030002, 0x010102, 0x000000, 0x3f0b0d, 0xb43030, 0xdb2827, 0xe02321, 0xe12422, 0xe12422, 0xe12220, 0xe22222, 0xe32223, 0xe42122, 0xe22021, 0xe21e20, 0xd51116, 0xe68a16, 0xfdcc12, 0xf8d303, 0xf6d202, 0xf2d401, 0xf3d501, 0xf3d501, 0xf3d500, 0xf3d500, 0xf3d502, 0xf1d200, 0xf0d82a, 0xc5b74c, 0x191916, 0x000000, 0x010200, 0x010001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x020000, 0x000100, 0x000000, 0x5d1414, 0xba2e2f, 0xdd2629, 0xe71f1f, 0xe4201f, 0xe42122, 0xe42222, 0xe32223, 0xe32121, 0xe42120, 0xe32220, 0xe1211a, 0xd30b14, 0xe48e1b, 0xfbcd17, 0xf5d306, 0xf6d207, 0xf5d406, 0xf4d404, 0xf4d606, 0xf4d606, 0xf5d506, 0xf5d506, 0xf4d504, 0xf5d703, 0xf7d604, 0xf8d604, 0xf6d500, 0xefd300, 0xe7d834, 0xb9b665, 0x6a6b68, 0xbdbdbb, 0xeeeeee, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfbfbfb, 0xf2f2f2, 0xdcdcdc, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x8e8e8e, 0xe3e3e3, 0xf3f3f3, 0xfbfbfb, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffdfe, 0xfefcfd, 0xfcfffd, 0xfcfcfb, 0xfefdfe, 0xffffff, 0xfaf9fa, 0xd3d3d3, 0x8f8f8f, 0x2c2e2d, 0x000000, 0x000000, 0x000000, 0x020202, 0x000201, 0x010101, 0x010200, 0x000201, 0x000001, 0x280303, 0xa52b2b, 0xdc2929, 0xe62324, 0xe12322, 0xe12522, 0xe32422, 0xe32322, 0xe22422, 0xe22320, 0xe62022, 0xe32022, 0xd41014, 0xdf7b15, 0xfbc614, 0xf7d302, 0xf9d201, 0xf3d402, 0xf3d501, 0xf3d501, 0xf3d501, 0xf2d500, 0xf2d501, 0xf4d300, 0xf1d61e, 0xcabe47, 0x35321c, 0x000000, 0x040504, 0x010003, 0x000004, 0x000001, 0x000000, 0x000000, 0x000000, 0x000100, 0x000101, 0x000000, 0x4c0f0d, 0xb82c2a, 0xdf2424, 0xe81f1f, 0xe71e1c, 0xe3201f, 0xe22121, 0xe32322, 0xe42223, 0xe42120, 0xe4221e, 0xe4241c, 0xd50012, 0xdc7a18, 0xf9c81b, 0xf6d203, 0xf5d306, 0xf6d205, 0xf6d405, 0xf5d504, 0xf4d606, 0xf4d606, 0xf4d606, 0xf5d606, 0xf5d606, 0xf6d703, 0xf9d704, 0xf8d607, 0xf6d700, 0xf2d924, 0xd0c352, 0x39371a, 0x000000, 0x000000, 0x4a4a4a, 0xa6a6a6, 0xe2e2e2, 0xfdfdfd, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xf9f9f9, 0xeeeeee, 0xcccccc, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd1d1d1, 0xf1f1f1, 0xfafafa, 0xfdfefd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfe, 0xfcfdfe, 0xfefffb, 0xfff7f4, 0xf5edea, 0xc6c4c4, 0x707070, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010100, 0x010002, 0x000302, 0x000100, 0x200000, 0x992828, 0xd92a29, 0xe12520, 0xe22523, 0xe22322, 0xe22321, 0xe32322, 0xe32322, 0xe42222, 0xe5221f, 0xe42121, 0xd51317, 0xd66a12, 0xfac61b, 0xf9d10a, 0xf7d206, 0xf3d501, 0xf1d601, 0xf3d501, 0xf3d501, 0xf3d501, 0xf2d401, 0xf0d401, 0xf1d617, 0xd6c742, 0x524e25, 0x000000, 0x020500, 0x000201, 0x010003, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x390707, 0xad2a2a, 0xdc2726, 0xe61f1d, 0xe51e1b, 0xe41e1d, 0xe41f20, 0xe32021, 0xe32121, 0xe42122, 0xe42120, 0xe3221c, 0xd70b16, 0xd46416, 0xf8c419, 0xf8d402, 0xf8d405, 0xf7d504, 0xf6d403, 0xf6d504, 0xf5d504, 0xf3d606, 0xf4d606, 0xf4d606, 0xf4d606, 0xf4d606, 0xf7d706, 0xf8d703, 0xf5d804, 0xf1da1b, 0xdbce54, 0x57502f, 0x000000, 0x030304, 0x000100, 0x000000, 0x000000, 0x090a09, 0x8c8d8c, 0xd7d7d7, 0xfbfbfb, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xf5f5f5, 0xe4e4e4, 0xb1b1b1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xadadad, 0xe6e6e6, 0xf7f7f7, 0xfcfcfc, 0xfcfcfc, 0xfcfcfd, 0xfefdfe, 0xfdfefe, 0xfefdfd, 0xfefdfe, 0xfdfdfd, 0xfdfdfd, 0xfefdfe, 0xfdfefd, 0xfffffd, 0xfff9f4, 0xf9e0da, 0xd9aeab, 0x906865, 0x000000, 0x000000, 0x000000, 0x020202, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x010104, 0x000103, 0x0c0000, 0x8d2122, 0xd42d2c, 0xe32220, 0xe22322, 0xe22322, 0xe32321, 0xe32321, 0xe32321, 0xe32321, 0xe52122, 0xe42322, 0xda151a, 0xd2550c, 0xf5bc17, 0xf8d305, 0xf6d304, 0xf3d501, 0xf2d503, 0xf2d600, 0xf3d600, 0xf3d500, 0xf3d501, 0xf2d400, 0xf2d50d, 0xe5d146, 0x6f682e, 0x000000, 0x060302, 0x010004, 0x000101, 0x000000, 0x000002, 0x000000, 0x000000, 0x000000, 0x010101, 0x000100, 0x160000, 0x982725, 0xd82a25, 0xe51e1e, 0xe61d1e, 0xe41e1e, 0xe41e1f, 0xe41f20, 0xe2201f, 0xe31f1f, 0xe42021, 0xe4221f, 0xdd1219, 0xce4d12, 0xf4b91a, 0xfad504, 0xf8d401, 0xf7d501, 0xf7d501, 0xf7d502, 0xf6d503, 0xf5d504, 0xf3d605, 0xf3d606, 0xf4d606, 0xf4d606, 0xf5d604, 0xf6d606, 0xf6d701, 0xf1d912, 0xe8d552, 0x7a733c, 0x000000, 0x050403, 0x020004, 0x000100, 0x000101, 0x020302, 0x000000, 0x000000, 0x000000, 0x7d7d7d, 0xd1d1d1, 0xfafafa, 0xffffff, 0xffffff, 0xfffeff, 0xfdfdfd, 0xfdfdfd, 0xfefdfd, 0xfefdfe, 0xfefefe, 0xfefefe, 0xfefdfe, 0xfcfcfc, 0xfdfdfd, 0xfbfbfb, 0xf3f3f3, 0xdedede, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd5d5d5, 0xf0f0f0, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefdfe, 0xfefcfe, 0xfcfefc, 0xfdfefc, 0xfdfdfe, 0xfdfdfd, 0xfbfefe, 0xfffefc, 0xfffaf3, 0xf9ded7, 0xdaa29d, 0xc15252, 0xa12b22, 0x3f0000, 0x000000, 0x000101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000203, 0x000101, 0x000000, 0x751b1d, 0xd12d2e, 0xe12321, 0xe22422, 0xe32322, 0xe42222, 0xe32222, 0xe42120, 0xe3221f, 0xe32220, 0xe52221, 0xd9191b, 0xce4311, 0xf3af18, 0xf8d208, 0xf4d203, 0xf3d403, 0xf2d501, 0xf1d500, 0xf1d601, 0xf0d503, 0xefd400, 0xeed300, 0xeed200, 0xead330, 0x8c8323, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x540000, 0xb30000, 0xd00000, 0xd70000, 0xd90005, 0xda1012, 0xdb191a, 0xdd1d1f, 0xdf201f, 0xe02120, 0xe42020, 0xde1a1d, 0xcc370c, 0xf1ad1e, 0xfbd309, 0xf8d500, 0xf9d307, 0xf6d401, 0xf7d502, 0xf6d401, 0xf6d503, 0xf4d404, 0xf4d503, 0xf4d606, 0xf3d608, 0xf4d507, 0xf5d504, 0xf5d602, 0xf3d800, 0xecd744, 0x938946, 0x000000, 0x000101, 0x000001, 0x000000, 0x000000, 0x000000, 0x000100, 0x010101, 0x030303, 0x000000, 0x000000, 0x000000, 0x7c7a7c, 0xd1d1d0, 0xfafbf7, 0xfffefd, 0xfdfefd, 0xfefdfc, 0xfcfdfd, 0xfefdfe, 0xfdfefa, 0xfdfefc, 0xfefdff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xf9f9f9, 0xe9e9e9, 0xb1b1b1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xa6a6a6, 0xe3e3e3, 0xf7f7f7, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfefc, 0xfbfff9, 0xfdfefa, 0xfdfdfb, 0xfcfdfd, 0xfdfefc, 0xfffcf6, 0xfbe5db, 0xdca79e, 0xba4846, 0xc00000, 0xb82c29, 0x581615, 0x000000, 0x000201, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000201, 0x010302, 0x010302, 0x010301, 0x000000, 0x571311, 0xc52e2e, 0xe12324, 0xe32221, 0xe32222, 0xe42222, 0xe42222, 0xe12320, 0xe12120, 0xe4201e, 0xe5201c, 0xe11f1b, 0xcd2b0e, 0xe9a51d, 0xfad115, 0xf5d104, 0xf1d400, 0xefd300, 0xeed300, 0xedd200, 0xead203, 0xe6d21f, 0xe6d434, 0xe9d949, 0xebdd5c, 0xd0c879, 0x919292, 0xa5a6a4, 0xafafb0, 0xb9bab9, 0xc8c8c8, 0xcfcfcf, 0xd3d3d3, 0xd5d5d5, 0xd5d5d5, 0xd5d5d5, 0xd1d1d1, 0xc6c6c7, 0xbcb9b7, 0xc9ada6, 0xd19893, 0xd08b87, 0xcb7c77, 0xc76a63, 0xc25852, 0xc03e3a, 0xc0201e, 0xc50006, 0xc70000, 0xcb0000, 0xc50000, 0xe49b0a, 0xfad604, 0xf4d700, 0xf8d704, 0xf7d503, 0xf6d600, 0xf8d501, 0xf7d401, 0xf5d401, 0xf3d501, 0xf4d502, 0xf3d504, 0xf3d605, 0xf4d504, 0xf4d602, 0xf5d500, 0xefd835, 0xa29941, 0x000000, 0x000000, 0x010100, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010301, 0x010302, 0x000000, 0x000000, 0x000000, 0x898986, 0xe5d9d3, 0xfff9f1, 0xfffffc, 0xfdfefc, 0xfdfcfd, 0xfffdfb, 0xfefefb, 0xfdfefd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xfdfdfd, 0xfbfbfb, 0xf0f0f0, 0xd2d2d2, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd3d3d3, 0xf0f0f0, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfdfdfc, 0xfdfdfd, 0xfafdfb, 0xfffdf8, 0xffede6, 0xe5b5af, 0xc15854, 0xbf0000, 0xcc0b14, 0xbe2d30, 0x661d17, 0x000000, 0x000101, 0x000100, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000201, 0x000201, 0x010100, 0x000000, 0x3c090b, 0xb72b2d, 0xe02624, 0xe22222, 0xe42222, 0xe42222, 0xe42222, 0xe32221, 0xe3211d, 0xe5211e, 0xe91d1e, 0xe71e1b, 0xd00a00, 0xe08b15, 0xf8cc0c, 0xedd000, 0xead21a, 0xead634, 0xeedd4d, 0xf2e56d, 0xf3eb87, 0xf5ef98, 0xf8f3a9, 0xfcf7b9, 0xfefbc7, 0xfffdd6, 0xfefee8, 0xfffff9, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffff8, 0xfffbf4, 0xfff9f5, 0xfff5ef, 0xfef0e7, 0xfce9df, 0xf6ddd4, 0xf1cfc7, 0xe8beb6, 0xdfa7a3, 0xce8f88, 0xdcac7a, 0xf8da5f, 0xecdb2b, 0xecd50e, 0xf0d600, 0xf1d500, 0xf2d500, 0xf3d400, 0xf6d402, 0xf5d302, 0xf4d302, 0xf3d404, 0xf3d503, 0xf3d503, 0xf3d503, 0xf2d500, 0xf5d92b, 0xbdab45, 0x000002, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010001, 0x000101, 0x000201, 0x000302, 0x020302, 0x000000, 0x000000, 0x7a2727, 0xd19693, 0xf8dfdb, 0xfffbf9, 0xfcfdfe, 0xfcfefb, 0xfefef8, 0xfdfefb, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xf5f5f5, 0xe1e1e1, 0x808080, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdddddd, 0xf5f5f5, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfeffff, 0xfef9f1, 0xf2cec6, 0xc57a72, 0xbd0000, 0xd00108, 0xd51f1f, 0xc92d2e, 0x802429, 0x000000, 0x000001, 0x000101, 0x010101, 0x000101, 0x000000, 0x000000, 0x010101, 0x010201, 0x010302, 0x010101, 0x000000, 0x250406, 0xa62b2c, 0xdf2626, 0xe82020, 0xe62021, 0xe42121, 0xe42222, 0xe32221, 0xe22220, 0xe31f1e, 0xdb1117, 0xd40000, 0xc10000, 0xc77840, 0xf6d36a, 0xf2e375, 0xf5e994, 0xf9f1ac, 0xfbf6b9, 0xfdfac7, 0xfffed9, 0xffffe6, 0xffffec, 0xfffff3, 0xfefef5, 0xfefff4, 0xfefff7, 0xfefef8, 0xfefdfc, 0xfdfef9, 0xfdfcfd, 0xfffefd, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefdfe, 0xfefcfc, 0xfffdfa, 0xfefefe, 0xfefefd, 0xfffcfc, 0xfffdfd, 0xfefefc, 0xfffefb, 0xfffef9, 0xfefafa, 0xfef7f2, 0xfefbe3, 0xfdfbcc, 0xfcf9b8, 0xfaf29f, 0xf3ed83, 0xece363, 0xe9d93f, 0xe6d51b, 0xead400, 0xeed500, 0xf1d400, 0xf2d400, 0xf4d403, 0xf3d302, 0xf3d300, 0xf2d818, 0xd4c34b, 0x342c1b, 0x000000, 0x030204, 0x010102, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010102, 0x020203, 0x000302, 0x010201, 0x000000, 0x000000, 0x761c1f, 0xb82022, 0xc70000, 0xc54a4b, 0xe3ada9, 0xfcece5, 0xfffff9, 0xfffff9, 0xfdfefc, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfbfbfb, 0xededed, 0xd4d4d4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb4b4b4, 0xeaeaea, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefd, 0xfefefe, 0xfefffe, 0xfefffc, 0xfffefd, 0xfefdfe, 0xfdfffd, 0xfffefa, 0xfbe6df, 0xdc9d99, 0xc03639, 0xcb0007, 0xd81f1d, 0xd6211e, 0xcb2b2c, 0x922b29, 0x000000, 0x000001, 0x010101, 0x000102, 0x010102, 0x010101, 0x010101, 0x000000, 0x010202, 0x000202, 0x020102, 0x000101, 0x000000, 0x932929, 0xd52829, 0xe71f1b, 0xe91e1d, 0xe41f1f, 0xe22020, 0xe11f1d, 0xda0d0d, 0xcf0000, 0xc11017, 0xc15352, 0xd28f88, 0xe4bfb0, 0xf7e7ca, 0xfefbd6, 0xfefedf, 0xffffed, 0xfffff4, 0xfefff7, 0xfefffa, 0xfefefc, 0xfdfdfc, 0xfdfdfc, 0xfdfdfe, 0xfdfdfe, 0xfdfdfd, 0xfdfdfe, 0xfefeff, 0xfefefe, 0xfeffff, 0xfefffe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfffefe, 0xfeffff, 0xfefffe, 0xfefffc, 0xfdfefc, 0xfdfefc, 0xfcfefd, 0xfcfefd, 0xfcfdfe, 0xfdfdfe, 0xfdfdfd, 0xfcfdfd, 0xfcfdfa, 0xfdfbfa, 0xfcfdf9, 0xfcfef4, 0xfeffec, 0xfdffe3, 0xfdfed6, 0xfcfac2, 0xf8f4a7, 0xf1ea85, 0xe9de59, 0xe5d635, 0xe6d10a, 0xebd100, 0xf0d100, 0xf1d509, 0xe4d14d, 0x676131, 0x000000, 0x020303, 0x010200, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020102, 0x000201, 0x000000, 0x6e1c1b, 0xbf2a2c, 0xd82122, 0xe0201f, 0xdc1114, 0xcb0000, 0xcd6e6a, 0xebcbc2, 0xfff8f2, 0xfffffd, 0xfdfdfe, 0xfefefe, 0xfffffe, 0xfdfefe, 0xfefefd, 0xfefefd, 0xfefefd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xf5f5f5, 0xdddddd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd2d2d2, 0xefefef, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefd, 0xfffffc, 0xfefefc, 0xfefefe, 0xfffefd, 0xfcfffa, 0xfbfefb, 0xfffdfb, 0xfff4ec, 0xe6bcb5, 0xc55a57, 0xc40000, 0xd22221, 0xde2326, 0xdd2121, 0xd4272a, 0x9e2c2f, 0x1e0302, 0x000000, 0x020100, 0x000101, 0x000002, 0x000001, 0x000000, 0x010101, 0x010101, 0x020101, 0x010100, 0x000000, 0x000000, 0x862426, 0xd42929, 0xe61f1e, 0xe11f1c, 0xdf1a1c, 0xd70810, 0xc90000, 0xc01b19, 0xc46462, 0xd8a19d, 0xeccec6, 0xfae8e0, 0xfff8ef, 0xfffef5, 0xfffff6, 0xfcfff5, 0xfdfef8, 0xfdfefd, 0xfdfdff, 0xfdfdfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfb, 0xfdfefb, 0xfdfef9, 0xfdfef6, 0xfdfff4, 0xfeffef, 0xffffe2, 0xfefdcd, 0xfaf8ba, 0xf3efa0, 0xeae27a, 0xe1d34d, 0xd7ca48, 0x796f27, 0x000000, 0x040303, 0x000201, 0x000103, 0x000001, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010001, 0x010003, 0x000000, 0x5b1416, 0xb82a2d, 0xd52123, 0xe31e21, 0xe61e20, 0xe31e20, 0xdc2020, 0xd4060e, 0xc31a21, 0xd18b88, 0xf6dbd2, 0xfffaf5, 0xfcfefd, 0xfefffb, 0xfefefa, 0xfefffb, 0xfefefb, 0xfffffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xf7f7f7, 0xe3e3e3, 0x4e4e4e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e1, 0xf6f6f6, 0xfdfdfd, 0xfdfdfd, 0xfefeff, 0xfefefd, 0xfefffb, 0xfffffb, 0xfefffb, 0xfefefc, 0xfcfefe, 0xfefef9, 0xfefdf1, 0xf7dcd0, 0xd38780, 0xc91610, 0xdd1319, 0xdd2421, 0xe32423, 0xe42122, 0xd92829, 0xb62c2f, 0x40080b, 0x000000, 0x010000, 0x000101, 0x000100, 0x000001, 0x010101, 0x010101, 0x010101, 0x010101, 0x020101, 0x000100, 0x000000, 0x7b2322, 0xcd2f2b, 0xdf201d, 0xdb1013, 0xcc0000, 0xc01718, 0xc75c5a, 0xd79695, 0xedc9c6, 0xfcece8, 0xfffdf6, 0xfffffa, 0xfefffa, 0xfcfffa, 0xfbfefb, 0xfefefc, 0xfefefc, 0xfefefd, 0xfefefe, 0xfefeff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefc, 0xfefefd, 0xfffffe, 0xfffffe, 0xfefffd, 0xfcfef9, 0xfefefa, 0xfdfef7, 0xfefff3, 0xfeffed, 0xffffe1, 0xfdfccf, 0xe0e0bb, 0x878987, 0x323331, 0x000000, 0x000000, 0x000000, 0x020203, 0x010201, 0x020202, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000103, 0x000000, 0x41090a, 0xb42a2c, 0xda1f22, 0xe41c20, 0xe51d1f, 0xe31f20, 0xe51e21, 0xe51f21, 0xdd2220, 0xdf1b1f, 0xcf0000, 0xc1443e, 0xe3b0ab, 0xfff2ee, 0xfefffb, 0xfbfff9, 0xfefff9, 0xfefffa, 0xfffffc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfafafa, 0xeaeaea, 0xacacac, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xaaaaaa, 0xe5e5e5, 0xfafafa, 0xfffffd, 0xfffefd, 0xfffefd, 0xfffefd, 0xfffefc, 0xfefffa, 0xfefffa, 0xfefffa, 0xfefff8, 0xfdfef3, 0xfff5df, 0xf0c6ae, 0xc35547, 0xd10000, 0xe32121, 0xe72021, 0xe61e20, 0xe31f22, 0xe22324, 0xc73233, 0x611919, 0x000000, 0x020002, 0x000001, 0x000101, 0x000100, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000101, 0x000000, 0x70201f, 0xcf3334, 0xdd1712, 0xcc0000, 0xbf443f, 0xd58d8e, 0xedcacb, 0xfbe8e6, 0xfff8f5, 0xfffefc, 0xfffefd, 0xfefdfa, 0xfefdf9, 0xfefdf8, 0xfefef8, 0xfefdf9, 0xfffefb, 0xfffffd, 0xfffffd, 0xfefefc, 0xfefefd, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfffffd, 0xfffffe, 0xfffffe, 0xfffefc, 0xfefdfa, 0xfffefc, 0xfefffb, 0xfefffb, 0xfefefd, 0xfefff8, 0xfffdf3, 0xfffff4, 0xfdfff6, 0xe8eae3, 0xbebfbe, 0x757577, 0x000000, 0x000000, 0x000000, 0x020202, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x2d0302, 0xa62629, 0xd92326, 0xe21e1f, 0xe61d20, 0xe21e1f, 0xe02020, 0xe21f21, 0xe41f21, 0xe51e20, 0xe51e20, 0xe32021, 0xd91413, 0xc40000, 0xd68180, 0xfaddd5, 0xfffef6, 0xfdfff8, 0xfdfef8, 0xfdfefa, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfafafa, 0xf0f0f0, 0xdddddd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb5b5b5, 0xebebeb, 0xfdfdfd, 0xfcfcfc, 0xfefdfc, 0xfffefc, 0xfefefb, 0xfffefb, 0xfffefc, 0xfffffb, 0xfefffb, 0xfdfff8, 0xfefff0, 0xfff8d1, 0xf2c097, 0xc44125, 0xd50b02, 0xe02220, 0xe32121, 0xe61f21, 0xe61e20, 0xe32024, 0xcf3030, 0x7c2120, 0x000000, 0x010102, 0x010101, 0x000002, 0x000001, 0x020202, 0x010202, 0x010102, 0x010101, 0x000100, 0x000101, 0x000000, 0x510d0f, 0xb12c2b, 0xc4291f, 0xcd6c6a, 0xe1b1b0, 0xf6e0db, 0xfff5f4, 0xfffefc, 0xfefdfb, 0xfbfdfa, 0xfcfcf9, 0xfefdfb, 0xfdfdfc, 0xfdfefd, 0xfefdfc, 0xfefdfb, 0xfefefd, 0xfefefe, 0xfefffe, 0xfefffe, 0xfefefe, 0xfefeff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffd, 0xfefefc, 0xfffffc, 0xfefefc, 0xfefefc, 0xfefefb, 0xfdfeff, 0xfefef9, 0xfdfef7, 0xfdfefb, 0xfefefc, 0xfffffe, 0xfafafa, 0xdbdbdb, 0x9a9a9a, 0x353535, 0x000000, 0x000000, 0x010101, 0x000100, 0x000100, 0x000100, 0x000000, 0x0f0000, 0x8f2425, 0xd12728, 0xe21c1e, 0xe31e20, 0xe31e20, 0xe31e20, 0xe11f20, 0xe21f20, 0xe3201f, 0xe32020, 0xe31f20, 0xe41e20, 0xe31f21, 0xe0201f, 0xd10000, 0xc95c52, 0xebc9bc, 0xfffdee, 0xfffff8, 0xfefdfb, 0xfefdfb, 0xfefdfd, 0xfefefe, 0xfdfefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xf4f4f4, 0xe9e9e9, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe8e8e8, 0xf2f4f3, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefdfc, 0xfefefb, 0xfefff8, 0xfefff7, 0xfefefa, 0xfefefa, 0xfcfff7, 0xfdfee4, 0xfcf2b9, 0xf4c77b, 0xc85422, 0xd7100a, 0xe1221d, 0xe51f1e, 0xe21f1f, 0xe11f21, 0xe31e1f, 0xd32d2e, 0x8b2625, 0x000000, 0x000202, 0x020100, 0x020002, 0x000000, 0x000000, 0x010101, 0x010101, 0x010002, 0x000101, 0x040504, 0x000000, 0x000000, 0x7c3838, 0xc38480, 0xebc6be, 0xfcebe8, 0xfffbfb, 0xfefdfd, 0xfdfdfd, 0xfcfdfd, 0xfdfdfe, 0xfdfdfc, 0xfdfdfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefe, 0xffffff, 0xffffff, 0xe8e8e8, 0xadadad, 0x505050, 0x000000, 0x000000, 0x000101, 0x000203, 0x000000, 0x7e1a20, 0xcb262b, 0xe11c1f, 0xe51b1f, 0xe21f20, 0xe11f20, 0xe11f20, 0xe22021, 0xe11f20, 0xe12020, 0xe21f21, 0xe41e20, 0xe31e1f, 0xe21e20, 0xe4201d, 0xe4271d, 0xcf0400, 0xc36f29, 0xf1dc96, 0xfefad1, 0xffffef, 0xfefcf8, 0xfefcfc, 0xfdfdfb, 0xfdfefd, 0xfefdfe, 0xfefdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xf9f9f9, 0xe1e1e1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcdcdcd, 0xf2f3f2, 0xfcfcfc, 0xfcfcfc, 0xfefefd, 0xfffdfd, 0xfcfefa, 0xfdfff8, 0xfffef6, 0xfffef8, 0xfffef8, 0xfdfff2, 0xfffdd8, 0xf8e79b, 0xf8c65f, 0xd56c28, 0xd41207, 0xe5211f, 0xe21f1f, 0xe51e21, 0xe31f1f, 0xe01f1e, 0xd4292b, 0x92282a, 0x140000, 0x000202, 0x010302, 0x030000, 0x010003, 0x000000, 0x000000, 0x000000, 0x000000, 0x020202, 0x000000, 0x000000, 0x151715, 0xa59d9c, 0xead6d5, 0xfff0ed, 0xfffdf7, 0xfafaf9, 0xfdfafc, 0xfdfbfc, 0xfdfdfd, 0xfdfdfd, 0xfdfefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xededed, 0xb9b9b8, 0x666664, 0x000000, 0x000000, 0x6b0f13, 0xc5282b, 0xdc2122, 0xe31d20, 0xe61b21, 0xe11f20, 0xe01f1f, 0xe11f20, 0xe11f20, 0xe11f20, 0xe22021, 0xe21f20, 0xe31f20, 0xe21f1f, 0xe41f1f, 0xe1231b, 0xdb1814, 0xd25511, 0xf6b923, 0xf3cc00, 0xecd859, 0xf9f5a8, 0xfeffdf, 0xfdfefa, 0xfdfdfa, 0xfefdf9, 0xfffefa, 0xfefdfc, 0xfdfdfe, 0xfefefe, 0xfcfcfc, 0xfbfbfb, 0xf7f7f7, 0xefefef, 0x4e4e4e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe6e6e6, 0xf5f5f5, 0xfcfcfc, 0xfdfdfd, 0xfefdfd, 0xfefdfc, 0xfefdfb, 0xfefefb, 0xfefffa, 0xfdfefc, 0xfdfff9, 0xfdffeb, 0xfcfac6, 0xf4df7a, 0xf4c742, 0xde7e27, 0xd61404, 0xe6221c, 0xe71e20, 0xe41f21, 0xe61d23, 0xe51e22, 0xd52628, 0x962627, 0x180000, 0x000001, 0x000203, 0x020101, 0x020101, 0x000203, 0x000101, 0x010101, 0x050505, 0x000000, 0x000000, 0x0f1010, 0x949494, 0xdfdddc, 0xfdfaf8, 0xfffdfa, 0xfefafb, 0xfefcfc, 0xfcfdfa, 0xfcfcfc, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xf4f4f4, 0xc7c5c4, 0x7c6b67, 0x9f0000, 0xd50714, 0xdf1e20, 0xe21d21, 0xe41c22, 0xe01f20, 0xe11f20, 0xe11f20, 0xe11f20, 0xe22021, 0xe22021, 0xe31f21, 0xe31f1f, 0xe2201e, 0xe4221e, 0xdf1f17, 0xd0370f, 0xf0ae1b, 0xfad308, 0xf7d200, 0xf2cf00, 0xecd130, 0xf4eb92, 0xfefed7, 0xfefef2, 0xfdfefa, 0xfdfff9, 0xfdfefb, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xe3e3e3, 0x7f7f7f, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e1, 0xfafafa, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfffefd, 0xfffefc, 0xfffefa, 0xfffefc, 0xfefffb, 0xfcfff7, 0xffffdd, 0xfaf4aa, 0xedd75f, 0xf8c52c, 0xe88f26, 0xd72510, 0xe6221c, 0xe82021, 0xe82022, 0xe62021, 0xe31f24, 0xd52a2c, 0xa22b2c, 0x290405, 0x000000, 0x010001, 0x010100, 0x000001, 0x000001, 0x000100, 0x010101, 0x000000, 0x000000, 0x000000, 0x8b8b8a, 0xdedddd, 0xfcfbfc, 0xfefcfd, 0xfdfbfb, 0xfdfdfa, 0xfbfefa, 0xfdfdfa, 0xfdfdfb, 0xfdfefe, 0xfdfefe, 0xfefefe, 0xfefefd, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xf5f5f5, 0xebebeb, 0xe9e9e9, 0xf9f9f9, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xf0f0f0, 0xe8e8e8, 0xededed, 0xf6f6f6, 0xfcfcfc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefdfd, 0xfcfdfc, 0xfffffe, 0xfaefed, 0xe2bbb8, 0xc45b59, 0xcd0000, 0xdd1318, 0xe41e23, 0xe21f20, 0xe11f20, 0xe11f20, 0xe11f20, 0xe22021, 0xe11f20, 0xe11d1f, 0xe21f1d, 0xe2211d, 0xe2221c, 0xd0260e, 0xe89b1c, 0xfbd00f, 0xf6d201, 0xf5d103, 0xf5d200, 0xf2d000, 0xe8ce1d, 0xf1e577, 0xfefcc0, 0xfeffef, 0xfcfefa, 0xfefdfb, 0xfdfdfd, 0xfefeff, 0xfefffe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfbfbfb, 0xe9e9e9, 0xbfbfbf, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd5d5d5, 0xf6f6f6, 0xfdfdfd, 0xfcfcfc, 0xfdfefd, 0xfefefd, 0xfefefd, 0xfdfffd, 0xfffefc, 0xfefefc, 0xfefff3, 0xfefed8, 0xf6ed95, 0xefd245, 0xf7cc23, 0xefa327, 0xd6350e, 0xe5221a, 0xea231f, 0xe62223, 0xeb1f23, 0xe52022, 0xd92728, 0xb33332, 0x45110f, 0x000000, 0x000101, 0x010100, 0x000000, 0x010202, 0x020202, 0x050505, 0x000000, 0x000000, 0x707070, 0xd1d1d1, 0xfefefd, 0xffffff, 0xfdfdfd, 0xfdfcfd, 0xfdfcfd, 0xfdfcfc, 0xfdfcfb, 0xfefcfb, 0xfdfcfd, 0xfcfdfe, 0xfdfefe, 0xfefefe, 0xfffffe, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefffd, 0xfefffe, 0xfdfdfc, 0xfcfcfd, 0xffffff, 0xffffff, 0xf4f4f5, 0xd5d5d5, 0xacabac, 0x7c7b7b, 0x5a5a5a, 0x383839, 0x19191a, 0x8f8f8f, 0xf9f9f9, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xdadada, 0x464646, 0x222222, 0x414141, 0x616161, 0x8e8d8d, 0xbcbbbc, 0xe1e1e1, 0xfbfbfb, 0xffffff, 0xfffeff, 0xfdfcfe, 0xfffeff, 0xfefffe, 0xfefffe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfcfcfb, 0xfdfcfc, 0xfcfdfd, 0xfffefc, 0xfae5e1, 0xdea5a4, 0xc34446, 0xcf0000, 0xdf1a1d, 0xe11e21, 0xe21d20, 0xe11e21, 0xe11e20, 0xe01e1e, 0xe11e1e, 0xe11e20, 0xdf221a, 0xd41212, 0xe1831c, 0xfac918, 0xfad000, 0xf7d103, 0xf6d201, 0xf3d400, 0xf2d400, 0xf1d200, 0xead000, 0xecdf63, 0xfcf9bf, 0xfffeef, 0xfdfef8, 0xfdfefc, 0xfdfffd, 0xfffefe, 0xffffff, 0xfeffff, 0xfefefe, 0xfdfdfd, 0xfbfbfb, 0xf2f2f2, 0xd9d9d9, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd9d9d9, 0xf6f6f6, 0xfcfcfc, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfefdfa, 0xfffefa, 0xfefffc, 0xfefff8, 0xffffec, 0xfffecd, 0xf4e782, 0xedce1f, 0xf5cb0e, 0xf4b023, 0xd44410, 0xe02017, 0xe6241e, 0xe92122, 0xe72123, 0xe82222, 0xdd2627, 0xbd2e2e, 0x5d1a18, 0x000000, 0x000101, 0x010000, 0x000000, 0x000000, 0x040404, 0x000000, 0x000000, 0x454545, 0xbcbcbc, 0xf6f6f6, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xe5e5e2, 0xa8a8a5, 0x545454, 0x000000, 0x000000, 0x000000, 0x000000, 0x1c1a16, 0x000000, 0x565756, 0xf5f5f5, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xffffff, 0xc9c9c9, 0x000000, 0x000000, 0x1e1a19, 0x000000, 0x000000, 0x000000, 0x000000, 0x757573, 0xc4c5c2, 0xf4f5f2, 0xffffff, 0xfffefe, 0xfefeff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfb, 0xfff5f4, 0xf5d9d4, 0xcf8a87, 0xbc121b, 0xcf0001, 0xdc1d1f, 0xdf1c1e, 0xe11c21, 0xe21e21, 0xe61e1e, 0xe5201e, 0xd80e12, 0xdb7215, 0xfbc41d, 0xf5d202, 0xf9d000, 0xf7d201, 0xf4d401, 0xf3d300, 0xf3d302, 0xf3d403, 0xf3d301, 0xe9cf00, 0xe7d852, 0xfaf5af, 0xfeffe6, 0xfdfff7, 0xfcfffb, 0xfffefd, 0xfffdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xf4f4f4, 0xe4e4e4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdedede, 0xf8f8f8, 0xfcfcfc, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefa, 0xfffefa, 0xfefffa, 0xfeffeb, 0xfdfbc3, 0xf2e26d, 0xf0cf11, 0xfacc00, 0xf9b71c, 0xd55610, 0xdf141b, 0xe7251d, 0xe92122, 0xe82023, 0xea2023, 0xe52425, 0xcf3134, 0x741f1f, 0x000000, 0x000301, 0x000200, 0x010101, 0x010102, 0x030303, 0x000000, 0x000000, 0x979797, 0xebebeb, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfcfb, 0xffffff, 0xf0eff0, 0xa3a3a3, 0x20211f, 0x000000, 0x000000, 0x565346, 0x8d8975, 0xada88e, 0xc1bba0, 0x837f71, 0x000000, 0xa1a1a1, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xecebec, 0x333234, 0x0d0b0c, 0xb2ad97, 0xb6b194, 0x9e9a83, 0x767261, 0x2c2925, 0x000000, 0x000000, 0x636462, 0xcfcfcd, 0xfdfefd, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfe, 0xfcfbfc, 0xfffcfa, 0xfff1ed, 0xecc2c0, 0xc56265, 0xc10000, 0xd31313, 0xde1b1c, 0xe21e1e, 0xe42120, 0xda1516, 0xd26213, 0xfac11c, 0xf8d401, 0xf3d300, 0xf9d004, 0xf6d201, 0xf3d400, 0xf3d301, 0xf3d302, 0xf3d302, 0xf5d300, 0xf5d401, 0xedd100, 0xe7d334, 0xf8ef9d, 0xffffd8, 0xfdfff1, 0xfefefb, 0xfffdfb, 0xfefdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xf7f7f7, 0xededed, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdddddd, 0xf9f9f9, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfffb, 0xfdfff6, 0xfeffe8, 0xfcf9b6, 0xecde5f, 0xf2d100, 0xf7cf00, 0xfabf17, 0xd76413, 0xd70b18, 0xe1241f, 0xe6221f, 0xea2022, 0xe72022, 0xe12225, 0xd32f32, 0x8e2427, 0x000000, 0x000001, 0x000002, 0x000100, 0x020303, 0x000000, 0x000000, 0x626262, 0xd0d0d0, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xfdfdfd, 0xfbfcf8, 0xccccca, 0x4d4c4d, 0x000000, 0x000000, 0x7e7c68, 0xbab697, 0xd5cfab, 0xd5ceab, 0xcac39f, 0xd5cca6, 0x77735f, 0x000000, 0xc9c8c8, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfbfafb, 0x706f71, 0x000000, 0xb8b491, 0xd4cda1, 0xcec7a1, 0xd4cca7, 0xc9c1a3, 0x9c9882, 0x4e4c40, 0x000000, 0x000000, 0x939393, 0xeeeeed, 0xfdfdfd, 0xfafafa, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfffdfc, 0xfcfefc, 0xfcfffc, 0xfdfffc, 0xfefdfa, 0xf9e4e3, 0xdda0a1, 0xc23034, 0xd00000, 0xdf201c, 0xda1a1b, 0xd14a0f, 0xf6b51e, 0xfdd206, 0xf8d101, 0xf7d201, 0xf7d106, 0xf4d302, 0xf3d401, 0xf3d302, 0xf3d302, 0xf3d201, 0xf4d301, 0xf4d304, 0xf6d300, 0xf4d200, 0xedd428, 0xf3eb8d, 0xffffda, 0xfffff9, 0xfffefc, 0xfefdfe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xf7f7f7, 0xe4e4e4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd9d9d9, 0xf8f8f8, 0xfdfdfd, 0xfdfdfd, 0xfdfefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffeff, 0xfffefa, 0xfeffe8, 0xfaf7b6, 0xecd950, 0xf3d000, 0xf9d204, 0xfac416, 0xdd7919, 0xd50913, 0xe22019, 0xe62022, 0xe91f21, 0xe62021, 0xe52122, 0xda3032, 0x992a2b, 0x0a0000, 0x000001, 0x000100, 0x010102, 0x020202, 0x000000, 0x000000, 0xa9a9a9, 0xf3f3f3, 0xffffff, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xf7f7f7, 0xa7a7a8, 0x000000, 0x000000, 0x6f6c5c, 0xbcb79f, 0xd5d0af, 0xc8c39f, 0xa19e82, 0x5e5c4d, 0x817b69, 0xd6caac, 0x6c6556, 0x000000, 0xd4d3d3, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0x838382, 0x000000, 0xb3ae8f, 0xc4bd9c, 0x524f42, 0x7f7963, 0xb2aa8a, 0xd1c9a7, 0xccc5a7, 0x98937d, 0x202217, 0x000000, 0x5d5d5c, 0xdddddd, 0xfefefe, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfeffff, 0xfefefe, 0xfffdfd, 0xfdfefe, 0xfdfffe, 0xfdfdfd, 0xfdfdfc, 0xfff7f5, 0xf1cdc8, 0xcb7573, 0xc20000, 0xc53501, 0xefa922, 0xfdd00b, 0xf8d200, 0xf6d202, 0xf4d400, 0xf5d302, 0xf6d202, 0xf3d401, 0xf3d302, 0xf3d302, 0xf4d202, 0xf5d301, 0xf5d302, 0xf6d401, 0xf7d501, 0xf3d800, 0xe5d749, 0xd3cf9f, 0xfafaf4, 0xfffffe, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfbfbfb, 0xf5f5f5, 0xededed, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xf8f8f8, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfdfefd, 0xfefdfc, 0xfefefc, 0xfdfffb, 0xfffef8, 0xffffe8, 0xfbf7b1, 0xead953, 0xf1d104, 0xf8d003, 0xfbca15, 0xe18c18, 0xcc0e13, 0xe21f1c, 0xe51f1e, 0xe62022, 0xe71f20, 0xe61f21, 0xdf2b2c, 0xb13131, 0x2d0404, 0x000000, 0x010202, 0x040404, 0x000000, 0x000000, 0x636363, 0xd4d4d4, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfdfdfd, 0xffffff, 0xf5f5f6, 0x8c8c8a, 0x000000, 0x130e0d, 0x9e9882, 0xd2ccac, 0xc6c0a3, 0x8d8a76, 0x35352d, 0x000000, 0x000000, 0x6d6959, 0xd6cbaa, 0x787161, 0x000000, 0xc3c3c3, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfcfd, 0x747475, 0x000000, 0xbcb397, 0xbeb89d, 0x000000, 0x000000, 0x000000, 0x5b574a, 0xa59d88, 0xd0c7a9, 0xbfb99e, 0x656055, 0x000000, 0x3d3d3d, 0xd7d7d7, 0xfffffe, 0xfcfcfb, 0xfdfdfe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xfffeff, 0xffffff, 0xffffff, 0xfffefd, 0xfdfdfc, 0xfafefd, 0xfefaf6, 0xfeeae6, 0xddb2a3, 0xd69e3d, 0xf8cc14, 0xfad000, 0xf7d102, 0xf6d102, 0xf4d301, 0xf4d400, 0xf5d301, 0xf3d401, 0xf3d302, 0xf3d303, 0xf3d302, 0xf5d300, 0xf4d301, 0xf5d502, 0xf5d600, 0xf2de29, 0xc7bc4f, 0x000000, 0x979696, 0xf9f8f8, 0xfffffe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfcfcfc, 0xf5f5f5, 0xd1d1d1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdcdcdc, 0xf5f5f5, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefd, 0xfffefa, 0xfffffa, 0xfefff5, 0xfeffe5, 0xf9f6ae, 0xefda4d, 0xf1d303, 0xf8d502, 0xfcd011, 0xed9b1d, 0xce2113, 0xdc1f1b, 0xe41d21, 0xe51e23, 0xe91c22, 0xe22020, 0xd92527, 0xb82d30, 0x470f0c, 0x000000, 0x020002, 0x040504, 0x000000, 0x000000, 0xa4a4a4, 0xf3f3f3, 0xfefefe, 0xfafafa, 0xfdfdfd, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefd, 0xf8f9f6, 0x8d8e8f, 0x000000, 0x35322d, 0xb6af93, 0xd4ccab, 0xa49e89, 0x403f37, 0x000000, 0x000000, 0x010202, 0x000000, 0x4e4a3f, 0xd1c8a4, 0x9d977d, 0x000000, 0x888888, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe7e7e7, 0x191c20, 0x332f23, 0xcbc3a0, 0xaaa58c, 0x000000, 0x000001, 0x000003, 0x000000, 0x000000, 0x6d695d, 0xc9bda5, 0xcfc4a5, 0x7e7a68, 0x000000, 0x333335, 0xd8dad9, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefd, 0xfdfefa, 0xfbfefc, 0xfafcf9, 0xfcfef8, 0xfffdeb, 0xf9eeac, 0xe8d34a, 0xf0ce00, 0xf6d100, 0xf6d002, 0xf6d103, 0xf5d303, 0xf3d400, 0xf3d400, 0xf3d302, 0xf3d302, 0xf3d402, 0xf4d400, 0xf7d500, 0xf7d303, 0xf2d815, 0xd6c944, 0x494321, 0x000000, 0x000000, 0x8c8b8e, 0xf4f4f5, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xeeeeee, 0xa4a4a4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe7e7e7, 0xfafafa, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfffc, 0xfdfff9, 0xfdfef7, 0xfeffe2, 0xf9f5ae, 0xe9d84a, 0xf4d302, 0xf8d704, 0xfbd50f, 0xf0b020, 0xd03c14, 0xe1181d, 0xe6201b, 0xe62021, 0xe22021, 0xe32021, 0xdd2324, 0xb72b2b, 0x571212, 0x000000, 0x020105, 0x040507, 0x000000, 0x3b3b3b, 0xcbcbcb, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfdfc, 0xa5a7a4, 0x000000, 0x24241f, 0xb6b193, 0xd4ccaa, 0x8b8470, 0x000000, 0x000000, 0x020204, 0x010301, 0x000100, 0x000000, 0x000000, 0xb9b394, 0xc8c3a3, 0x36332e, 0x000000, 0xcacaca, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xfbfbfb, 0x919190, 0x000000, 0x8f8973, 0xd8d1ad, 0x7b7867, 0x000000, 0x000002, 0x000002, 0x010202, 0x000000, 0x000000, 0x454036, 0xb6af93, 0xd5caac, 0x837d6d, 0x000000, 0x484a49, 0xe5e6e5, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffd, 0xfdfffb, 0xfefefd, 0xfefefe, 0xfefefc, 0xfefdf4, 0xffffe6, 0xfbf9b8, 0xefe265, 0xecd100, 0xf2d200, 0xf7d100, 0xf8d003, 0xf5d202, 0xf2d400, 0xf3d302, 0xf3d302, 0xf5d400, 0xf4d500, 0xf6d501, 0xf4d601, 0xe1d23c, 0x6c662b, 0x000000, 0x040303, 0x020000, 0x000000, 0x7c7d7d, 0xf3f3f3, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xe3e3e3, 0x5e5e5e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcdcdcd, 0xf5f5f5, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfefc, 0xfcfff6, 0xfeffe6, 0xfaf6a8, 0xebd841, 0xf4d400, 0xfbd804, 0xfad80d, 0xf9bd25, 0xd25514, 0xdb1b19, 0xe62120, 0xe6201e, 0xe71f20, 0xe42021, 0xdc2423, 0xc02b2c, 0x611818, 0x000000, 0x020202, 0x000000, 0x000000, 0x707171, 0xe4e4e4, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xc6c6c5, 0x000000, 0x000000, 0xaea98e, 0xd4cdab, 0x827d6b, 0x000000, 0x000000, 0x030304, 0x010000, 0x010101, 0x010101, 0x010102, 0x000000, 0x7d7a68, 0xd6cfad, 0x9e9885, 0x000000, 0x2b2b2c, 0xc4c4c4, 0xf8f8f8, 0xffffff, 0xffffff, 0xffffff, 0xeeeeee, 0x969696, 0x000000, 0x49443e, 0xcfc6a4, 0xc4be9f, 0x1c1c1c, 0x000000, 0x010101, 0x020000, 0x010101, 0x010101, 0x040303, 0x000000, 0x1f1e1a, 0xb7ae97, 0xd4cbad, 0x726e61, 0x000000, 0x777777, 0xf8f8f8, 0xffffff, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfefefd, 0xfefefe, 0xfefefe, 0xfffeff, 0xfcfefb, 0xfbfef7, 0xfefef1, 0xfdfecc, 0xf6ec87, 0xe6d42e, 0xedcf00, 0xf6d201, 0xf5d301, 0xf2d400, 0xf2d402, 0xf3d301, 0xf6d300, 0xf4d500, 0xf4d403, 0xead234, 0x867f2f, 0x000000, 0x020301, 0x020002, 0x010201, 0x010301, 0x000000, 0x7e7e7e, 0xf3f3f3, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xf0f0f0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe3e3e3, 0xf5f5f5, 0xfdfdfd, 0xfdfdfd, 0xfefdfd, 0xfdfefc, 0xfbfefd, 0xfefefe, 0xfefefd, 0xfdfefa, 0xffffeb, 0xfaf8b0, 0xeada4a, 0xefd200, 0xf8d304, 0xfad709, 0xfac624, 0xd76a19, 0xdc1918, 0xe6251e, 0xe62124, 0xe51f21, 0xe32021, 0xdf2223, 0xcc2b2b, 0x791d1d, 0x000000, 0x000506, 0x000000, 0x000000, 0x9c9c9c, 0xf4f5f5, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xe9e8e9, 0x3b3b3b, 0x000000, 0x9b947f, 0xd7d0ae, 0x8d8874, 0x000000, 0x000001, 0x010101, 0x010101, 0x010101, 0x010102, 0x010102, 0x000000, 0x000000, 0x000000, 0xa9a48a, 0xd4cdaf, 0x8e8774, 0x000000, 0x000000, 0x757575, 0xacabab, 0xbab9bb, 0x9d9d9e, 0x444445, 0x000000, 0x312e2a, 0xbbb49a, 0xd6d1ac, 0x726f5c, 0x000000, 0x010201, 0x000000, 0x010001, 0x010001, 0x000002, 0x000101, 0x020202, 0x000000, 0x272722, 0xbfb89d, 0xd1c9ac, 0x565148, 0x000000, 0xacacac, 0xffffff, 0xfcfcfb, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfeffff, 0xfeffff, 0xffffff, 0xfdfeff, 0xfefcfe, 0xfefcfb, 0xfefff7, 0xffffde, 0xf7f39d, 0xe7d83c, 0xecd100, 0xf5d200, 0xf4d301, 0xf3d304, 0xf4d401, 0xf6d400, 0xf6d400, 0xf2d836, 0xa4953b, 0x000000, 0x000001, 0x010001, 0x010001, 0x000100, 0x000101, 0x020203, 0x000000, 0x828282, 0xf4f4f4, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xf9f9f9, 0xdedede, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xa7a7a7, 0xefefef, 0xfbfbfb, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefdfe, 0xfefeff, 0xfffffd, 0xfdfff5, 0xfeffe7, 0xfaf8b2, 0xe9d94c, 0xefd000, 0xf6d100, 0xf8d206, 0xfbca1f, 0xdb7a1a, 0xda1d16, 0xe6271e, 0xe82123, 0xe42022, 0xe71f21, 0xde2223, 0xd12c2b, 0x8c2622, 0x000000, 0x000303, 0x000000, 0x000000, 0xb9b9b9, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0x8d8d8d, 0x000000, 0x716e5f, 0xd4cdac, 0xa59f86, 0x000000, 0x000000, 0x020203, 0x000000, 0x010100, 0x010101, 0x010101, 0x010101, 0x000000, 0x030203, 0x000000, 0x1c1e18, 0xaca791, 0xd7cfb2, 0xa8a38a, 0x514f43, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x767263, 0xc3bea1, 0xd5d1af, 0x888572, 0x000000, 0x020303, 0x000100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x030302, 0x000000, 0x59564a, 0xd2caa9, 0xc0baa0, 0x000206, 0x000000, 0xdbdbdc, 0xfffffe, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfdfdfd, 0xfdfdfd, 0xfefefc, 0xfefef7, 0xffffde, 0xfbf8a8, 0xeadd53, 0xe9d100, 0xf0d300, 0xf3d400, 0xf5d403, 0xf4d400, 0xf5d929, 0xbdac45, 0x000006, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x000000, 0x878787, 0xf6f6f6, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xf7f7f7, 0xe0e0e0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x9f9f9f, 0xeaeaea, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfdfefe, 0xfdfefd, 0xfffefd, 0xfdfff9, 0xfeffe4, 0xfaf8ae, 0xe9d949, 0xeecf00, 0xf5d300, 0xf7d200, 0xfcd016, 0xe3881c, 0xd81015, 0xe6251c, 0xe92121, 0xe82021, 0xe7201f, 0xe91e20, 0xd92a2b, 0xa12b29, 0x1e0200, 0x000406, 0x000000, 0x2a2a29, 0xcecece, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xcfcfcf, 0x000000, 0x2c2a26, 0xc5bfa0, 0xc1bb9b, 0x272521, 0x000000, 0x030302, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x020101, 0x030402, 0x000000, 0x000207, 0x9d9985, 0xd5ceb1, 0xcec9a7, 0xb1ad8e, 0x99937e, 0x98917d, 0xaaa48c, 0xc3bda0, 0xd8d2af, 0xcbc6a2, 0x797966, 0x000000, 0x000000, 0x020305, 0x010102, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020201, 0x000000, 0x89826d, 0xd9d2ab, 0x96937d, 0x000000, 0x757576, 0xf9f9f9, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffffd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfef8, 0xfeffeb, 0xfdfbbe, 0xebe366, 0xe7d200, 0xf3d500, 0xf6d400, 0xf3d71b, 0xd0bc48, 0x282416, 0x000000, 0x010102, 0x000102, 0x000100, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x8d8d8d, 0xf9f9f9, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xf3f3f3, 0xcecece, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe4e4e4, 0xfbfbfb, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfffe, 0xfdfff9, 0xfefef8, 0xfdffe7, 0xfbf8ad, 0xead94e, 0xedce00, 0xf3ce03, 0xf2d300, 0xf8ce17, 0xe7991c, 0xd51c11, 0xe8201c, 0xe82220, 0xe72121, 0xe71f1f, 0xe6211e, 0xde2928, 0xb1312f, 0x3c0907, 0x000203, 0x000000, 0x494b4a, 0xd7d8d8, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xf9f9f9, 0x6b6b6b, 0x000000, 0x9a947e, 0xd4ceab, 0x6c6958, 0x000000, 0x020201, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x020204, 0x000000, 0x000000, 0x5f5d4f, 0xa5a088, 0xc4bd9e, 0xcfc7a5, 0xd1c8a6, 0xccc49e, 0xb9b491, 0x8f8c75, 0x3f3d33, 0x000000, 0x000001, 0x010100, 0x000002, 0x010102, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb0a989, 0xd0c9a9, 0x58554b, 0x000000, 0xbdbdbd, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffe, 0xffffff, 0xffffff, 0xfffefc, 0xfdfef8, 0xfdfffa, 0xfeffed, 0xfffdcd, 0xf1e883, 0xe6d312, 0xeed618, 0xd7c74a, 0x564c26, 0x000000, 0x030306, 0x010000, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x9e9e9e, 0xfbfbfb, 0xfeffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xefefef, 0xaaaaaa, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe0e0e0, 0xfbfbfb, 0xfcfcfc, 0xfefefd, 0xfefefd, 0xfefefe, 0xfffeff, 0xfffffe, 0xfefef9, 0xffffee, 0xfdfbbf, 0xeedc54, 0xeed000, 0xf4d000, 0xf3ce02, 0xf9d009, 0xeea51c, 0xce2b0f, 0xe31b1c, 0xe7211f, 0xe81f21, 0xe92023, 0xe72022, 0xdf2626, 0xbe3131, 0x541412, 0x000000, 0x000000, 0x696765, 0xe5e6e6, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xc2c2c2, 0x000000, 0x575444, 0xd1c9a8, 0xaaa38b, 0x000000, 0x000000, 0x020102, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010003, 0x010101, 0x010101, 0x010105, 0x000000, 0x000000, 0x22201d, 0x474539, 0x4b4a3d, 0x39382d, 0x000000, 0x000000, 0x000000, 0x030302, 0x020202, 0x010003, 0x010001, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x030304, 0x000000, 0x504b42, 0xccc3a5, 0xb2ac91, 0x000000, 0x464647, 0xececec, 0xfefefe, 0xfffffe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffd, 0xfefffd, 0xfdfefd, 0xfdfffc, 0xfcfef6, 0xfdfff5, 0xfdffd5, 0xf0eb8d, 0xd2c753, 0x6e6833, 0x000000, 0x040403, 0x010102, 0x010000, 0x010001, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000100, 0x010101, 0x040404, 0x000000, 0x000000, 0xb1afaf, 0xfffefe, 0xfeffff, 0xfffffe, 0xffffff, 0xffffff, 0xfffefe, 0xfeffff, 0xfcfcfc, 0xfbfbfb, 0xececec, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcfcfcb, 0xf7f7f6, 0xffffff, 0xffffff, 0xfefefc, 0xfefff9, 0xfefefa, 0xfffffc, 0xfffffc, 0xfefef1, 0xfdfeca, 0xefe16c, 0xedd100, 0xf3d100, 0xf5cf00, 0xf7d105, 0xf5b31b, 0xcd450e, 0xdd1218, 0xe51f1f, 0xe61f21, 0xe81f22, 0xe72022, 0xde2626, 0xc93432, 0x6d1919, 0x000000, 0x000000, 0x7c7c7c, 0xeeeded, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xefeeef, 0x4f504e, 0x000000, 0xafa78a, 0xcdc6a5, 0x47443c, 0x000000, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010102, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000002, 0x010201, 0x000000, 0x908976, 0xd5cdab, 0x757263, 0x000000, 0x9e9d9c, 0xfcfefc, 0xfefffe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfefd, 0xfdfff0, 0xffffdb, 0xd3d3b5, 0x0c0b1d, 0x000000, 0x030303, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x010101, 0x020101, 0x010103, 0x000201, 0x000000, 0x570000, 0xdec0bf, 0xfffdfa, 0xfdfefe, 0xfffdff, 0xfbfefc, 0xfefdf8, 0xfdfefd, 0xfefffe, 0xfffefe, 0xfafafa, 0xe7e7e7, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xa7a7a7, 0xf1f1ef, 0xfcfcfb, 0xfefefe, 0xfefeff, 0xfffeff, 0xfefff9, 0xfdfff6, 0xfdfff9, 0xfefff7, 0xffffd1, 0xf1e878, 0xeed220, 0xf5d501, 0xf3d302, 0xfad009, 0xf5bd1a, 0xce5810, 0xdd0019, 0xe51c1d, 0xe61e1f, 0xe61e20, 0xe51e1f, 0xdf2522, 0xca3232, 0x77201f, 0x000000, 0x000000, 0x878787, 0xf3f3f3, 0xfefefe, 0xfbfbfb, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xa6a5a6, 0x000000, 0x736c5d, 0xd9ceac, 0x958f7a, 0x000000, 0x010201, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000101, 0x000000, 0x1a1913, 0xc1ba9f, 0xbeb89b, 0x000000, 0x000000, 0xdbdbd9, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfcfefa, 0xfdfef2, 0xfffef4, 0xd2d2d0, 0x2d2f30, 0x000000, 0x030303, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x030100, 0x010102, 0x000104, 0x000000, 0x5e1415, 0xa9161a, 0xae3638, 0xeececd, 0xffffff, 0xfefdff, 0xfafefa, 0xfbfff8, 0xfffcfd, 0xfefefe, 0xfefffe, 0xfcfcfc, 0xf8f8f8, 0xe6e6e6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xebebeb, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffefd, 0xfefff7, 0xfdfff8, 0xfefef4, 0xffffda, 0xf4ed8d, 0xecd41c, 0xf7d301, 0xf9d402, 0xf8d405, 0xf9c71c, 0xd66a12, 0xd50012, 0xe51c1f, 0xe31e20, 0xe41e1e, 0xe61e1f, 0xde2122, 0xcd3030, 0x872525, 0x000000, 0x000000, 0x858587, 0xf5f5f5, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xffffff, 0xdddcde, 0x010103, 0x000000, 0xc1b89e, 0xccc2a3, 0x35342f, 0x000000, 0x000101, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x020204, 0x000000, 0x7b7564, 0xd5cead, 0x868370, 0x000000, 0x777776, 0xf6f6f6, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefd, 0xfdfdfe, 0xfcfcfb, 0xfffffe, 0xd9d9d8, 0x343334, 0x000000, 0x030303, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000200, 0x000200, 0x010202, 0x000000, 0x4a0f0d, 0xb02929, 0xd02323, 0xd00000, 0xc15055, 0xf4dbd6, 0xfffdf7, 0xfdfdf8, 0xfdfdf9, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xf3f3f3, 0xbcbcbc, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e1, 0xf9f9f9, 0xfefefe, 0xfefefe, 0xfefefd, 0xfffffd, 0xfffffb, 0xfdfff8, 0xfdfff9, 0xffffdb, 0xf7f091, 0xebd42c, 0xf5d302, 0xf7d502, 0xfad402, 0xfdcc1b, 0xde8519, 0xd50a14, 0xe51d1d, 0xe51e22, 0xe41f21, 0xe51f1f, 0xe11f22, 0xcc2c2e, 0x912b2b, 0x110000, 0x000000, 0x898786, 0xf2f3f2, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xf4f4f4, 0x717071, 0x000000, 0x8f8975, 0xded5b1, 0x888270, 0x000000, 0x030304, 0x000100, 0x000001, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000002, 0x010102, 0x000000, 0x000000, 0xb6ae96, 0xc9bf9f, 0x3c392f, 0x000000, 0xbcbcbc, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfdfb, 0xfdfcff, 0xfcfcfb, 0xfdfdfa, 0xffffff, 0xd4d4d4, 0x232323, 0x000000, 0x020202, 0x010101, 0x000000, 0x000000, 0x010101, 0x000201, 0x000201, 0x000000, 0x370706, 0xa82a29, 0xd42525, 0xdc1d21, 0xdf2120, 0xd40000, 0xca6866, 0xfbe4dd, 0xfefffc, 0xfffdfd, 0xfdfefc, 0xfefefe, 0xfefefe, 0xfefeff, 0xffffff, 0xfefefe, 0xeaeaea, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc3c3c3, 0xf3f3f3, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefc, 0xfffffd, 0xfefffc, 0xfdfff5, 0xfeffed, 0xfaf6ab, 0xecd73a, 0xf5d200, 0xf8d504, 0xf6d500, 0xfdd017, 0xe5951f, 0xcc1a11, 0xe42121, 0xe6201c, 0xe81e1f, 0xe71e20, 0xe11f20, 0xd42725, 0x9d2a29, 0x280506, 0x000000, 0x838383, 0xf5f4f4, 0xfffffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefe, 0xfcfcfd, 0xfdfdfe, 0xfefeff, 0xa3a3a3, 0x000000, 0x524e44, 0xd4cbac, 0xb7b093, 0x000000, 0x000000, 0x000101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000001, 0x010000, 0x020101, 0x000000, 0x635c4e, 0xd4c7a3, 0xa79e88, 0x000000, 0x363636, 0xdfdfde, 0xffffff, 0xfdfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefdfd, 0xfdfdfe, 0xfdfdfd, 0xfdfcfc, 0xfcfcfd, 0xffffff, 0xcecece, 0x010101, 0x000000, 0x030202, 0x010102, 0x000102, 0x010201, 0x010101, 0x000002, 0x0c0001, 0x952424, 0xcf2726, 0xdd1f1e, 0xe11d21, 0xe01f20, 0xe12121, 0xce0000, 0xd1928e, 0xfef6f4, 0xfdfeff, 0xfdfcfc, 0xfefdfe, 0xfefefe, 0xfefefe, 0xfeffff, 0xfdfdfd, 0xfafaf8, 0xe8e8e6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xececec, 0xfefefe, 0xfcfcfc, 0xfefefd, 0xfffffd, 0xfffffd, 0xfffffd, 0xfefefc, 0xfefef2, 0xfdfac1, 0xecdb56, 0xf0d100, 0xf9d302, 0xf9d302, 0xfad114, 0xeb9f21, 0xcd3008, 0xe1221c, 0xe92324, 0xe4211f, 0xe71e22, 0xe31f21, 0xd92327, 0xac2b2b, 0x390e0b, 0x000000, 0x757575, 0xf0f1f1, 0xfefefe, 0xfdfcfd, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfc, 0xffffff, 0xbcbdbd, 0x000000, 0x000000, 0xb8b390, 0xd0c9a7, 0x4b4740, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x000000, 0x98907b, 0xd5ccab, 0x7f7a68, 0x000000, 0x636361, 0xebece8, 0xffffff, 0xfdfcfd, 0xfefffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xc3c3c3, 0x000000, 0x000000, 0x030203, 0x010102, 0x000103, 0x000101, 0x000000, 0x7d1f21, 0xc72929, 0xdf1f21, 0xe01e1f, 0xe01e1f, 0xe11e1f, 0xe22021, 0xe01d20, 0xc70000, 0xe0b4b0, 0xfffaf9, 0xfcfbfb, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfc, 0xfdfdfb, 0xf6f6f5, 0xcacaca, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe3e3e3, 0xfbfbfb, 0xfdfdfd, 0xfefefd, 0xfffffc, 0xfffffd, 0xfffffc, 0xfefffa, 0xfffff4, 0xfeffd7, 0xf1e66f, 0xf0cf00, 0xf5d201, 0xf6d300, 0xfbd50d, 0xf1ae22, 0xcf3913, 0xe41f1e, 0xeb2223, 0xe92021, 0xe72021, 0xe61f24, 0xdc2524, 0xba2d2d, 0x521416, 0x000000, 0x616161, 0xeaeceb, 0xffffff, 0xfdfdfd, 0xfefdfe, 0xfffeff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xf9f9f8, 0xaeafb0, 0x000000, 0x000000, 0xa39d83, 0xd5d0a7, 0x7d7965, 0x000000, 0x030303, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x010201, 0x000000, 0x00010d, 0xb2ad8b, 0xd2c6a7, 0x666056, 0x000000, 0x626262, 0xdbdbda, 0xfffffd, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xbcbcbc, 0x000000, 0x000000, 0x010302, 0x000203, 0x000000, 0x691717, 0xc22725, 0xdb211d, 0xe11f21, 0xe11f20, 0xe11f20, 0xe11e20, 0xe11f20, 0xe22122, 0xda1913, 0xc83030, 0xefcac9, 0xfffbf9, 0xfefdfd, 0xfefefe, 0xfefefe, 0xfffefe, 0xfffefd, 0xfefefc, 0xfefefe, 0xeeeeee, 0x9c9c9c, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcecece, 0xf7f7f7, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfefa, 0xfdfdfb, 0xfefffa, 0xfefff7, 0xffffe6, 0xf5ef98, 0xead40a, 0xf4d100, 0xf6d103, 0xfad311, 0xf6ba24, 0xce5010, 0xde1c1d, 0xe82423, 0xe71f21, 0xe71e21, 0xe81f24, 0xe52224, 0xd02e2d, 0x731e1d, 0x000000, 0x515251, 0xe5e5e5, 0xffffff, 0xfdfefd, 0xfefefe, 0xfefdfe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xf2f2f2, 0xd1d1d2, 0x7b7b7c, 0x000000, 0x000000, 0x9d9783, 0xd8d0ae, 0x97927c, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000002, 0x010202, 0x000000, 0x413d32, 0xc4ba9f, 0xcdc5aa, 0x625f52, 0x000000, 0x101209, 0xa2a29f, 0xe0e0e0, 0xf7f7f7, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfefefe, 0xb3b3b1, 0x000000, 0x000000, 0x000000, 0x591110, 0xb62928, 0xda201b, 0xe01f1c, 0xde201f, 0xe11f1f, 0xe01e1e, 0xdf1e1e, 0xe01d1e, 0xe21e1f, 0xe22020, 0xda0002, 0xc4595a, 0xf7dfdd, 0xfffcfd, 0xfefdfe, 0xfdfefe, 0xfffefe, 0xfffefd, 0xfefefc, 0xfefefe, 0xfbfbfb, 0xe8e8e8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x767676, 0xf0f0f0, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefc, 0xfefdfc, 0xfefff7, 0xfeffef, 0xfaf8b6, 0xebd736, 0xf2d000, 0xf5cf03, 0xf8d105, 0xf9c321, 0xd26016, 0xd91716, 0xe7251f, 0xe82221, 0xe72120, 0xe71f23, 0xe32325, 0xd82f2c, 0x8f2421, 0x000000, 0x363635, 0xdedddd, 0xffffff, 0xfdfcfd, 0xfefdfe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xeaeaea, 0xa4a4a4, 0x959595, 0x9c9c9c, 0xacacac, 0xa8a8a8, 0x8b8b8b, 0x535353, 0x000000, 0x000000, 0x4d4a3e, 0xb2ae95, 0xd9d0ae, 0x9d967e, 0x000000, 0x000000, 0x010102, 0x020001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010002, 0x030302, 0x000000, 0x545147, 0xc7bda3, 0xd1caad, 0x88846f, 0x000000, 0x000000, 0x000000, 0x686868, 0x949494, 0xa5a5a5, 0xa5a6a5, 0x979797, 0x8c8c8c, 0xc4c4c4, 0xfdfdfd, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xfcfcf9, 0x9e9e9e, 0x000000, 0x470607, 0xb02a2b, 0xd52523, 0xdf1d1a, 0xdf1f21, 0xe21e20, 0xe21e1f, 0xe01f1f, 0xe01f1f, 0xe11e1f, 0xe31e1d, 0xe31f21, 0xe1201f, 0xd00000, 0xd08588, 0xfff3f3, 0xfffeff, 0xfdfefc, 0xfdfffe, 0xfefefc, 0xfefefd, 0xfffffe, 0xfdfdfd, 0xf8f8f8, 0xdbdbdb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdedede, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefffd, 0xfefefc, 0xfefefb, 0xfcfff2, 0xfefdcc, 0xefe168, 0xefd000, 0xf4cc02, 0xf7cf05, 0xfcc81d, 0xd27517, 0xd30914, 0xe5241b, 0xe62320, 0xe92022, 0xe32222, 0xe32222, 0xd62e2a, 0x9d2927, 0x170000, 0x000000, 0xd1d1d2, 0xffffff, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfc, 0x91908f, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x59574c, 0x9e9884, 0xd2c9ab, 0xccc4a7, 0x7e7a68, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x030302, 0x000000, 0x403d35, 0xb1ab93, 0xd8d2b2, 0xbfb99e, 0x7f7b6a, 0x34302d, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdddddc, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefb, 0xf5f5f1, 0x857d7a, 0x830000, 0xcf2626, 0xe01d1d, 0xe01f1d, 0xdf1f21, 0xe01e20, 0xde1f20, 0xe01f20, 0xe11f20, 0xe22021, 0xe21f20, 0xe21d1f, 0xe11e1e, 0xde1e1c, 0xc20000, 0xddb2ab, 0xfff9f6, 0xfdfef9, 0xfcfffc, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xf1f1f0, 0x9c9c9c, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc8c8c8, 0xf2f2f2, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefffb, 0xfafff4, 0xfdffdf, 0xf5e985, 0xeed310, 0xf8d000, 0xf5cf04, 0xfbce1a, 0xde8a1b, 0xcb010c, 0xe61f1f, 0xe61f21, 0xe5221f, 0xea2022, 0xe42321, 0xdb2a29, 0xa92e2e, 0x270000, 0x000000, 0xb7bbba, 0xffffff, 0xfcfbfb, 0xfdfefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xf6f6f5, 0x5c5c5b, 0x000000, 0x8b8877, 0xa49e82, 0x979078, 0x9b937c, 0xaaa287, 0xc1b79b, 0xd3c8a8, 0xd1c7a7, 0xa69e88, 0x47433a, 0x000000, 0x000000, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x020202, 0x000000, 0x000000, 0x7c7968, 0xc1bc9f, 0xd8cfb2, 0xcdc4aa, 0xb6af98, 0xa39e88, 0x97927e, 0x9a9382, 0xaaa495, 0x524f49, 0x000000, 0xc2c3c2, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfefd, 0xf8fcf6, 0xfffff7, 0xf4e6dc, 0xb4635d, 0xcd0000, 0xe01e1c, 0xde201e, 0xe21d21, 0xe11e1f, 0xde1f1f, 0xe01f20, 0xe12021, 0xe22021, 0xe11f21, 0xe11e21, 0xde1f1e, 0xe4201d, 0xda1404, 0xbf5635, 0xf9eccc, 0xfefff8, 0xfefdfc, 0xfffeff, 0xffffff, 0xfefefe, 0xfefefe, 0xfffffe, 0xfbfbfa, 0xdfdfdf, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xeaeaea, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefa, 0xfcffe9, 0xf9f4a7, 0xefd52c, 0xf7d400, 0xf7d406, 0xf9d313, 0xe89d1b, 0xcd1c10, 0xe11c1c, 0xe81f1f, 0xe72023, 0xe62022, 0xe52120, 0xe02724, 0xb92f2d, 0x460c0c, 0x000000, 0x9d9d9d, 0xfdfefd, 0xfffefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0x828483, 0x000000, 0x9c9885, 0xcfc8a9, 0xcec3a4, 0xccc1a3, 0xc3b99c, 0xb1a98c, 0x8f886f, 0x4f4b3d, 0x000000, 0x000000, 0x030203, 0x020101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x040201, 0x000000, 0x000000, 0x120f13, 0x706b5c, 0xa09b83, 0xbab39a, 0xc8c0a5, 0xd0c6ab, 0xd1c7ab, 0xc7c0aa, 0x56534a, 0x000000, 0xd7d7d8, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfc, 0xfdfdfa, 0xfefef5, 0xf2d2ca, 0xbe4847, 0xd91417, 0xe01f20, 0xe61e21, 0xe0211f, 0xdf2020, 0xe12021, 0xe12021, 0xe12021, 0xe11e20, 0xe31e1f, 0xe0201f, 0xe4231d, 0xd21e05, 0xe0912e, 0xfae080, 0xfeffdb, 0xfdfef9, 0xfdfefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfc, 0xf6f6f6, 0xcbcbcb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdcdcdc, 0xf9f9f9, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefff3, 0xfdfbc6, 0xf0dd5c, 0xf4d400, 0xf7d506, 0xfbd512, 0xf1ad20, 0xcc370f, 0xe2181b, 0xe61f1f, 0xe81e23, 0xe62020, 0xe42020, 0xdb2524, 0xbc312d, 0x5a1615, 0x000000, 0x757472, 0xf6f5f5, 0xfefdfb, 0xfefefc, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xb3b3b3, 0x000000, 0x070608, 0x262323, 0x34302b, 0x333229, 0x20221d, 0x000000, 0x000000, 0x000000, 0x000001, 0x010101, 0x000101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010104, 0x010103, 0x030203, 0x000000, 0x000000, 0x000000, 0x000000, 0x292521, 0x3d3730, 0x3a362c, 0x201e15, 0x000000, 0x4a4a49, 0xf2f2f1, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefc, 0xfcfcfb, 0xfff9f7, 0xe7c4be, 0xbc2926, 0xdd1b1b, 0xe31f1f, 0xe12020, 0xe02020, 0xe12021, 0xe12021, 0xe01f20, 0xdf2022, 0xe3201e, 0xe2241a, 0xd11a0c, 0xd87921, 0xfbca2f, 0xf3d122, 0xf5ee90, 0xffffe5, 0xfefffc, 0xfffeff, 0xffffff, 0xfefefe, 0xfefefe, 0xfcfcfb, 0xfcfcfc, 0xececec, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x949494, 0xefefef, 0xfefefe, 0xfdfdfd, 0xfffdfd, 0xfefefe, 0xfefefd, 0xfffeff, 0xfefffb, 0xfeffe0, 0xf4ea8b, 0xf2d21a, 0xf9d400, 0xfad60e, 0xf7c020, 0xd25312, 0xde1319, 0xe7211d, 0xe61f23, 0xe81e26, 0xe81e1f, 0xdc2523, 0xc3312f, 0x701f1e, 0x000000, 0x3a3b3a, 0xe5e5e4, 0xffffff, 0xfefefc, 0xfdfefd, 0xfefdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe1e1e1, 0x0a0b0a, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020002, 0x010001, 0x010000, 0x010000, 0x000002, 0x000001, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000101, 0x000100, 0x000101, 0x000201, 0x020302, 0x020102, 0x020101, 0x000000, 0x000000, 0x010001, 0x030303, 0x000000, 0x000000, 0x000000, 0x000005, 0x1a1a1b, 0x2a2a29, 0x373735, 0x3e3f3c, 0x40413e, 0x3c3c39, 0x2d2e2b, 0x161818, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010102, 0x020201, 0x010100, 0x000000, 0x010101, 0x010102, 0x010002, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x000202, 0x000100, 0x010100, 0x010100, 0x010102, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x9e9e9d, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfefffe, 0xfefdfe, 0xfefdfe, 0xfff9f5, 0xdba7a1, 0xca0000, 0xe01e1c, 0xe22021, 0xe11f21, 0xe01f20, 0xe01f21, 0xe01f20, 0xe22221, 0xe0261d, 0xd7180f, 0xd16618, 0xf8c42c, 0xf6d312, 0xf2d402, 0xe9d63b, 0xfbf7b6, 0xfffff4, 0xfffefe, 0xfefffb, 0xfdfffe, 0xfefefd, 0xfefefd, 0xfefefd, 0xf9f9f7, 0xdddddd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xeaeaea, 0xfafafa, 0xfdfdfd, 0xfdfdfd, 0xfdfcfd, 0xfdfdfd, 0xfefff9, 0xfefefc, 0xfcffeb, 0xfaf6b2, 0xf2d73d, 0xf4d604, 0xf8d40a, 0xfcc722, 0xd46e16, 0xda1517, 0xe5251e, 0xe72024, 0xe52022, 0xe12121, 0xde2221, 0xc72e2e, 0x7c2220, 0x000000, 0x000000, 0xcac9c7, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfb, 0x8f8f8f, 0x000000, 0x040404, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000100, 0x000200, 0x000201, 0x000000, 0x000000, 0x000000, 0x000000, 0x222422, 0x000000, 0x000000, 0x4e4e4b, 0xababa2, 0xbfbdae, 0xc4c0b0, 0xc8c4b3, 0xcbc7b6, 0xcdc9b9, 0xcfcaba, 0xcfcaba, 0xccc7b7, 0xc9c4b4, 0xc4c0af, 0xb8b5a5, 0xa9a798, 0x8f8e82, 0x747368, 0x505049, 0x161917, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010000, 0x000000, 0x000000, 0x2e2e2d, 0xe4e4e5, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfcfffd, 0xfeeeea, 0xcb827f, 0xcf0000, 0xe11d21, 0xe01e1f, 0xdd201e, 0xdd2021, 0xe02021, 0xe2241b, 0xd81d11, 0xcc5012, 0xf6b927, 0xf6d211, 0xf2d403, 0xf2d506, 0xecd200, 0xebdf6a, 0xfffecf, 0xfefff8, 0xfcfff9, 0xfbfff7, 0xfefffc, 0xfffffd, 0xfffffd, 0xfdfdfb, 0xeeeeec, 0x7f7f7f, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb9b9b9, 0xf5f5f5, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfcfefb, 0xfefefb, 0xfefef9, 0xfdfff5, 0xfcfecc, 0xefe165, 0xf6d208, 0xf7d407, 0xfccd1a, 0xdd8318, 0xd9121c, 0xe82522, 0xe72220, 0xe92024, 0xe81f21, 0xdf211f, 0xcc2d2d, 0x832525, 0x020000, 0x000000, 0xacabaa, 0xfffefd, 0xfdfeff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xe8e8e8, 0x3c3c3c, 0x000000, 0x020202, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x020202, 0x020202, 0x030305, 0x000000, 0x000000, 0x000000, 0x272725, 0x6e6d63, 0x9c9a8d, 0xbcb9a9, 0xc9c6b3, 0x8d8c80, 0x000000, 0x000000, 0x71726b, 0xbfbcac, 0xdbd5c0, 0xd9d3bb, 0xd8d1b8, 0xd8d1b8, 0xd7d1b7, 0xd6d0b6, 0xd5cfb5, 0xd4ceb4, 0xd3cdb4, 0xd4cfb5, 0xd6d1b8, 0xd6d1ba, 0xd4cfb9, 0xcfcbb6, 0xc2bead, 0xa6a395, 0x7e7b72, 0x484541, 0x000000, 0x000000, 0x000000, 0x010204, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0xb5b5b5, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfb, 0xfffcfe, 0xf7dddc, 0xbd564d, 0xd20003, 0xe01d1f, 0xdf1f1d, 0xdf2120, 0xe32520, 0xdd2016, 0xcf3d0d, 0xf1b020, 0xfdd40f, 0xf3d500, 0xf3d600, 0xf4d503, 0xf3d500, 0xe9d108, 0xf7ed8e, 0xffffe5, 0xfbfefb, 0xfcfff6, 0xfefefe, 0xfffffd, 0xfffffd, 0xfdfdfb, 0xfcfcfa, 0xe3e3e1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xececec, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefa, 0xfefdfb, 0xfdfff9, 0xfeffe2, 0xf5ee93, 0xeed323, 0xfad106, 0xfccf1a, 0xe7951e, 0xd71f13, 0xe6271f, 0xe52521, 0xe92123, 0xe92020, 0xe42122, 0xd42a29, 0x952829, 0x130302, 0x000000, 0x767776, 0xf8f8f8, 0xffffff, 0xfdfffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xc7c7c7, 0x000000, 0x000000, 0x020202, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x62615a, 0xa3a195, 0xc7c3b3, 0xd7d2bc, 0xd9d3bc, 0xd8d2b8, 0xdbd4b9, 0xdfddc6, 0xb5b5a6, 0x464743, 0x000000, 0x000000, 0x8c887e, 0xd3d0c0, 0xf3f0dd, 0xf3efd9, 0xefedd4, 0xeeecd3, 0xecead1, 0xeae8cf, 0xe8e5cc, 0xe3e0c7, 0xdedbc2, 0xdad6bf, 0xd6d2bb, 0xd3cfb4, 0xd3cdb4, 0xd4ceb8, 0xd5ceba, 0xcdc6b5, 0xb5b0a4, 0x85837a, 0x3e3e3a, 0x000000, 0x000000, 0x010102, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x040404, 0x000000, 0x838383, 0xfafafa, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfefc, 0xfcfefc, 0xfffaf8, 0xebbfbb, 0xc21417, 0xdb1819, 0xe01d1d, 0xe1221c, 0xdc2715, 0xcc2909, 0xeb9e1c, 0xfad30f, 0xf8d400, 0xf4d501, 0xf3d501, 0xf3d502, 0xf5d401, 0xf0d200, 0xebd640, 0xfdfaba, 0xfefff2, 0xfefefc, 0xfdfeff, 0xfefefc, 0xfffffd, 0xfffffd, 0xfffffd, 0xf6f8f6, 0xc8c8c8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbfbfbf, 0xf7f7f7, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefffc, 0xfffefc, 0xfcfff2, 0xfbfabc, 0xeed646, 0xf6d000, 0xfbd213, 0xeaa120, 0xd22f14, 0xe42220, 0xe4271d, 0xe92221, 0xe62221, 0xe52225, 0xda2b29, 0xae2e2b, 0x350907, 0x000000, 0x2c2b2a, 0xdfe0de, 0xffffff, 0xfffeff, 0xfffefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xb2b2b2, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010101, 0x010101, 0x020202, 0x000000, 0x000000, 0x78776d, 0xb5b5a6, 0xd1cfbb, 0xd8d3bb, 0xd6d1b7, 0xd8d4b9, 0xe0dcc2, 0xebe8cf, 0xf4f1d9, 0xf7f3da, 0xf7f6df, 0xe3e4d3, 0x9b9c92, 0x000000, 0x000000, 0x3a3b38, 0xacada1, 0xeaebd9, 0xfcfbe7, 0xfbfae4, 0xfaf9e2, 0xfaf9e3, 0xfaf8e4, 0xfaf9e2, 0xf9f8e1, 0xf8f7e0, 0xf5f4dd, 0xf1efd9, 0xecead4, 0xe2e0c8, 0xd9d5bd, 0xd2cdb5, 0xd3cdb5, 0xd5d0bb, 0xcac7b7, 0xabaa9d, 0x64645d, 0x000000, 0x000000, 0x020203, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x010101, 0x050505, 0x000000, 0x575757, 0xebebeb, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefeff, 0xfcfefb, 0xfafefb, 0xfff0f1, 0xda918e, 0xc60000, 0xde201c, 0xde2518, 0xcc1b07, 0xe18b17, 0xfbce19, 0xf5d500, 0xf2d500, 0xf5d501, 0xf4d501, 0xf2d601, 0xf2d303, 0xf2d400, 0xebd100, 0xf2e680, 0xffffde, 0xfffefd, 0xfdfffc, 0xfefefc, 0xfefefd, 0xfffffd, 0xfffffd, 0xfcfdfb, 0xebedeb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xeaeaea, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefb, 0xffffdc, 0xf1e67e, 0xf1cd00, 0xfbce10, 0xeea91e, 0xca390e, 0xe01f1e, 0xe52621, 0xe72223, 0xe92123, 0xe32321, 0xe02727, 0xc0332e, 0x5a1414, 0x000000, 0x000000, 0xbababa, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xfbfbfb, 0xadadad, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x010101, 0x000000, 0x73716a, 0xbbb8ac, 0xd6d1bf, 0xd5d0ba, 0xd2cdb5, 0xddd8c2, 0xeeead5, 0xf7f3dd, 0xfaf8e0, 0xfaf8e1, 0xf9f7e1, 0xf9f7e1, 0xfaf8e1, 0xfbf9e3, 0xf9f7e5, 0xd4d4c6, 0x7c7d76, 0x000000, 0x000000, 0x484944, 0xabaaa0, 0xe7e7d7, 0xfcfce7, 0xfcfbe5, 0xf9f8e4, 0xf9f8e2, 0xf9f7e1, 0xf9f7e1, 0xfaf7e0, 0xf9f7e0, 0xfaf8e1, 0xf9f8e2, 0xf7f6e1, 0xf0efdb, 0xe4e2cc, 0xd4cfb9, 0xd3cdb7, 0xd8d3be, 0xd3d1be, 0xa4a497, 0x212221, 0x000000, 0x010100, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x040404, 0x000000, 0x4f4f4f, 0xe3e3e3, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefdfe, 0xfefdfc, 0xfbfffc, 0xfbfbf9, 0xfcdddb, 0xc45f5b, 0xd30500, 0xd31810, 0xdb731a, 0xfbc81f, 0xf5d403, 0xf3d400, 0xf3d600, 0xf3d600, 0xf3d501, 0xf2d400, 0xf2d400, 0xf2d401, 0xefd300, 0xe8d33d, 0xfcf8bb, 0xfefff5, 0xfffefb, 0xfefdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfdfefe, 0xf6f6f6, 0xcccccc, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdbdbdb, 0xf9f9f9, 0xfcfcfc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfffff0, 0xfbf4af, 0xefd337, 0xf7cd00, 0xf6b31e, 0xd04813, 0xda171b, 0xe32322, 0xe82124, 0xe82125, 0xe62323, 0xdf2824, 0xcc3130, 0x721c1c, 0x000000, 0x000000, 0x7f7e7e, 0xf8f7f8, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xfcfcfc, 0xfcfcfc, 0xb0b0b0, 0x000000, 0x000000, 0x030303, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010100, 0x000000, 0x3b3b38, 0xd0cdbf, 0xdbd4c2, 0xd4cdba, 0xdad4bf, 0xeeead4, 0xf9f6e1, 0xfcf9e5, 0xfcf6e3, 0xfaf5e0, 0xf9f7e0, 0xf9f7de, 0xfaf7df, 0xf9f7df, 0xfaf8e1, 0xfbf8e4, 0xfbf9e5, 0xf6f5e2, 0xcbcbbc, 0x74756d, 0x000000, 0x000000, 0x383936, 0xa2a298, 0xddddcb, 0xf4f5e0, 0xfbfae8, 0xfdfce8, 0xfdfce6, 0xfcfbe3, 0xfbf9e2, 0xfaf8e1, 0xf8f6e1, 0xf8f6e1, 0xf9f7e3, 0xfaf9e4, 0xf1eed8, 0xd8d3bd, 0xd3ceb8, 0xd5cfb8, 0xdad6c2, 0x8d8c83, 0x000000, 0x010101, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x626262, 0xe5e5e5, 0xffffff, 0xfbfbfb, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefdfb, 0xfafefd, 0xf6fdfc, 0xfefbf5, 0xedc4bc, 0xb41810, 0xd25b10, 0xf6be24, 0xf7d30a, 0xf2d300, 0xf3d500, 0xf3d600, 0xf3d600, 0xf2d600, 0xf1d500, 0xf1d500, 0xf1d500, 0xf2d400, 0xe9d000, 0xefe67e, 0xffffdc, 0xfefefb, 0xfefdfe, 0xfdfdfd, 0xffffff, 0xffffff, 0xfdfdfd, 0xfcfcfc, 0xe1e1e1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xefefef, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefb, 0xfefed9, 0xeee171, 0xf3ce00, 0xfabe1d, 0xd26314, 0xd40c1a, 0xe1231c, 0xe5211d, 0xe72022, 0xe12421, 0xe72322, 0xd6312f, 0x842521, 0x000000, 0x000000, 0x373133, 0xe5e4e5, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xc2c2c2, 0x2a2a2a, 0x000000, 0x040404, 0x030303, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x5f5f59, 0xdad6c5, 0xdbd2bd, 0xd6cfbb, 0xf1ecd8, 0xfcf9e4, 0xfaf9e4, 0xf9f7e2, 0xf9f5df, 0xf8f6de, 0xf9f7e0, 0xfbfae3, 0xfbf9e3, 0xfcfbe5, 0xfdfce5, 0xfaf9e1, 0xf9f7df, 0xfaf8e0, 0xfcfbe2, 0xf3f4de, 0xcbccbb, 0x7d7e75, 0x000000, 0x000000, 0x000000, 0x65655f, 0x8e8e87, 0xa3a39a, 0xbbbbaf, 0xd2d1c4, 0xe4e4d2, 0xf2f1de, 0xf8f8e4, 0xfaf9e5, 0xfaf9e4, 0xf9f8e5, 0xfcfbe7, 0xedebd7, 0xd6d1bc, 0xd5cfb7, 0xdad4be, 0xb2aea2, 0x000000, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x020202, 0x050505, 0x000000, 0x000000, 0x8a8a8a, 0xeeeeee, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfffe, 0xfcfefb, 0xfefefc, 0xfcfeff, 0xfdfefb, 0xfff6ea, 0xd4ac8e, 0xeeaf2c, 0xfad019, 0xf5d500, 0xf3d600, 0xf3d600, 0xf3d600, 0xf3d600, 0xf2d600, 0xf2d600, 0xf1d500, 0xf0d500, 0xf2d400, 0xf1d300, 0xe7d432, 0xfaf7b0, 0xfffff3, 0xfefdfe, 0xfefefe, 0xffffff, 0xffffff, 0xfeffff, 0xffffff, 0xf4f4f4, 0xb8b8b8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd3d3d3, 0xf9f9f9, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfe, 0xfffff6, 0xfaf3b3, 0xeed338, 0xfdc326, 0xdd781a, 0xce0c12, 0xe0201e, 0xe42022, 0xe42120, 0xe42120, 0xe12221, 0xd72c2b, 0x992a29, 0x060000, 0x000101, 0x000000, 0xb8b8b5, 0xfffffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xfcfcfc, 0xffffff, 0xdfdfdf, 0x727272, 0x000000, 0x000000, 0x020202, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x676760, 0xdad7c5, 0xd7d1bc, 0xd7d3be, 0xf6f3df, 0xfaf7e4, 0xfaf7e3, 0xf9f8e1, 0xfafae3, 0xf3f3e0, 0xd2d2c3, 0xb1b1a5, 0xa0a096, 0xadada3, 0xcfcfc2, 0xf0f0df, 0xfbfae5, 0xfaf8e0, 0xf8f6df, 0xf6f4de, 0xfaf9e2, 0xf5f4e1, 0xd9d9ca, 0x9c9d94, 0x3d3d3b, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x272826, 0x65665f, 0x9d9d94, 0xcacabe, 0xe8e8d9, 0xf7f6e7, 0xfdfdee, 0xfaf9e7, 0xdedac6, 0xd8d4bf, 0xddd8c2, 0xbab5a9, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x1d1d1d, 0xb4b4b4, 0xf8f8f8, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfcfefb, 0xfefefb, 0xfffdfe, 0xfdfefa, 0xfbfdf4, 0xfef7d3, 0xf3da64, 0xf1d300, 0xf4d500, 0xf3d501, 0xf3d501, 0xf3d600, 0xf3d600, 0xf3d600, 0xf3d600, 0xf2d500, 0xf2d400, 0xf1d501, 0xf3d402, 0xecd100, 0xefe777, 0xffffe3, 0xfefdfe, 0xfefefe, 0xffffff, 0xffffff, 0xfeffff, 0xffffff, 0xfefefe, 0xe0e0e0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe6e6e6, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefffc, 0xfeffff, 0xfdfefb, 0xfefedc, 0xf0e07c, 0xf8cb25, 0xe38626, 0xd0100f, 0xe1211f, 0xe4201f, 0xe51e21, 0xe41f21, 0xe22123, 0xd82927, 0xa22b29, 0x270303, 0x000102, 0x000000, 0x707070, 0xf8f9f8, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xf7f7f7, 0xb2b2b2, 0x2f2f2f, 0x000000, 0x000000, 0x030303, 0x020202, 0x010101, 0x000000, 0x010101, 0x000000, 0x64635d, 0xdad7c5, 0xd5ceb9, 0xddd9c3, 0xf9f7e3, 0xf9f7e2, 0xfaf7e1, 0xfaf9e6, 0xd9dbcc, 0x74756d, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x63635f, 0xd6d6c9, 0xfcfbe5, 0xf7f6de, 0xf9f6e2, 0xf8f6e1, 0xf9f7e0, 0xfcfae4, 0xfafaea, 0x84857f, 0x000000, 0x000001, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x353532, 0x7a7a73, 0xa1a29a, 0xb4b4ab, 0xa9a89b, 0xa8a69a, 0xaaa89b, 0x838079, 0x000000, 0x010102, 0x000000, 0x000000, 0x020202, 0x020202, 0x000000, 0x000000, 0x000000, 0x868686, 0xe2e2e2, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefffe, 0xfffffe, 0xfefffd, 0xfdfff6, 0xffffea, 0xf6f2a2, 0xe8d615, 0xf3d500, 0xf3d502, 0xf2d602, 0xf3d501, 0xf3d600, 0xf3d501, 0xf2d601, 0xf3d601, 0xf4d502, 0xf2d601, 0xf5d400, 0xf2d91e, 0xc3bc45, 0xcfcfbb, 0xfffffb, 0xfdfdfb, 0xfefefe, 0xfffffe, 0xfffffe, 0xffffff, 0xffffff, 0xf2f2f2, 0xb5b5b5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc3c3c3, 0xf5f5f5, 0xfefefe, 0xfefefe, 0xfdfefe, 0xfcfefc, 0xfefdfc, 0xfefdfd, 0xffffed, 0xfaf4b3, 0xf4d048, 0xe99c24, 0xd1230d, 0xe1211e, 0xe52121, 0xe32023, 0xe31f20, 0xe12021, 0xd82829, 0xab2e2a, 0x3a0a06, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xe5e5e5, 0x9c9c9c, 0x2c2c2c, 0x000000, 0x000000, 0x000000, 0x010101, 0x000001, 0x000000, 0x565550, 0xd7d4c3, 0xd3cdb8, 0xe0ddc6, 0xfbf8e4, 0xf9f7e2, 0xfbfae5, 0xd9d8ca, 0x303130, 0x000000, 0x000000, 0x000001, 0x000000, 0x010101, 0x000000, 0x000000, 0x30312e, 0xdfdfcf, 0xfaf8e2, 0xf9f6e2, 0xf7f6e0, 0xf8f6df, 0xf9f6e0, 0xefedde, 0x52524e, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x080808, 0x010100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x717171, 0xcdcdcd, 0xfafafa, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefb, 0xfdfff5, 0xffffd1, 0xeee364, 0xedd200, 0xf3d403, 0xf5d403, 0xf5d501, 0xf3d600, 0xf4d601, 0xf3d702, 0xf7d502, 0xf7d404, 0xf4d600, 0xf4d81b, 0xd7c841, 0x3e3a00, 0x5b5c5e, 0xf4f5ef, 0xfefefb, 0xfefefd, 0xfefefd, 0xfffffe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xe1e1e1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xededed, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefffe, 0xfdfefa, 0xfefdfe, 0xfdfef6, 0xfefed2, 0xf4df7e, 0xf1a933, 0xd23a0c, 0xe11d1c, 0xe72021, 0xe62020, 0xe51f22, 0xe41e20, 0xd92524, 0xb6312f, 0x511412, 0x000000, 0x020306, 0x000000, 0x9b9b9b, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xfefefe, 0xe9e9e9, 0xb4b4b4, 0x696969, 0x000000, 0x000000, 0x000000, 0x000000, 0x343430, 0xceccbd, 0xd5cfbc, 0xdfdbc7, 0xfaf8e4, 0xf9f7e2, 0xf6f5e5, 0x7a7a74, 0x000000, 0x060607, 0x000002, 0x000000, 0x000000, 0x000000, 0x010101, 0x040403, 0x000000, 0x919188, 0xf8f6e5, 0xf9f7e2, 0xf8f6df, 0xf8f6de, 0xfaf7e1, 0xeae7d8, 0x383835, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x70716c, 0xa2a298, 0x929288, 0x818278, 0x7e7e75, 0x4e4f4b, 0x000000, 0x000000, 0x000000, 0x000000, 0x3f3f3e, 0x909090, 0xd1d1d1, 0xf9f9f9, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefd, 0xfdfefa, 0xfefef0, 0xfbf8aa, 0xe6d836, 0xefd300, 0xf7d301, 0xf6d402, 0xf4d501, 0xf4d602, 0xf5d602, 0xf8d500, 0xf7d600, 0xf2d90d, 0xe1d346, 0x68642b, 0x000000, 0x000000, 0xc5c5c2, 0xfffffc, 0xfdfdfb, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xf7f7f7, 0xc1c1c1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc4c4c4, 0xf7f7f7, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefdfc, 0xfefefc, 0xfcffea, 0xfbecac, 0xedb053, 0xd54b19, 0xdd1917, 0xe62420, 0xe72121, 0xe52120, 0xe52120, 0xde2524, 0xbc3432, 0x651f1c, 0x000000, 0x020205, 0x000000, 0x383838, 0xe9e9e9, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xf6f6f6, 0xdcdcdc, 0xb3b3b3, 0x878887, 0x282927, 0x000000, 0xbbb9ac, 0xdcd6c4, 0xa9a699, 0xe5e3d2, 0xfbfae5, 0xe4e3d6, 0x1e1f20, 0x000000, 0x000001, 0x000001, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x4b4a45, 0xefeddc, 0xfaf8e3, 0xf8f6de, 0xf8f6de, 0xfaf8e1, 0xeae7d8, 0x373734, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010102, 0x000000, 0xa0a097, 0xffffec, 0xd2d3c2, 0xd9d8c4, 0xe1e0cf, 0x797972, 0x000000, 0x757674, 0xaaaaa8, 0xccccca, 0xececea, 0xfdfdfb, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefc, 0xfefef9, 0xfcfdf9, 0xffffdd, 0xeeea86, 0xe6d200, 0xf5d100, 0xf4d401, 0xf4d502, 0xf5d503, 0xf6d600, 0xf6d600, 0xf0d70a, 0xe8d94a, 0x88823b, 0x000000, 0x020401, 0x000000, 0x6a6a69, 0xf5f5f3, 0xfffffc, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xdcdcdc, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdcdcdc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefffe, 0xfdfffe, 0xfefffa, 0xfffcdd, 0xf2c085, 0xcf5117, 0xd91015, 0xe62120, 0xe52121, 0xe52123, 0xe61f23, 0xe42421, 0xcf3330, 0x792927, 0x000000, 0x000103, 0x030403, 0x000000, 0xadacae, 0xffffff, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0x989999, 0x000000, 0x908d84, 0xdfdaca, 0x727067, 0xcecdbe, 0xfffce7, 0xd4d3c5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x32312f, 0xe9e7d6, 0xfaf8e2, 0xf8f6df, 0xf8f6df, 0xf9f7e1, 0xefeddd, 0x494945, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010100, 0x000000, 0xa9a9a0, 0xfbfde9, 0x7c7c72, 0xc3c0b0, 0xd2d0c2, 0x302f2c, 0x0d0d0f, 0xe7e7e5, 0xffffff, 0xfffffe, 0xfefefc, 0xfcfcfa, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefb, 0xfdfdf9, 0xfffef7, 0xfcfbc8, 0xe5d649, 0xf1d100, 0xf4d502, 0xf4d502, 0xf5d501, 0xf4d500, 0xf2d300, 0xecd940, 0xa79e4d, 0x000000, 0x000001, 0x020002, 0x000000, 0x000000, 0xc9c9c8, 0xffffff, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfffffe, 0xfefefe, 0xf0f0f0, 0x808080, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x979797, 0xf3f3f3, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xfffef8, 0xfae6c5, 0xc86343, 0xd50303, 0xe52120, 0xe52021, 0xe4211f, 0xe42022, 0xe32324, 0xd9342d, 0x952d29, 0x000000, 0x000000, 0x010101, 0x000000, 0x4c4c4c, 0xeeeeef, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0xffffff, 0xd8d9d9, 0x000000, 0x33312c, 0xc3c1b5, 0x555550, 0xcbc9bb, 0xfffbe6, 0xd5d3c6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x595954, 0xf2f0df, 0xfaf8e0, 0xf8f6df, 0xf7f5e0, 0xf9f7e0, 0xf8f6e4, 0x82817a, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010201, 0x000000, 0xc0c0b5, 0xf6f8e3, 0x5e5f56, 0xa7a79d, 0xa3a29a, 0x000000, 0x848484, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfdfdfb, 0xfdfdfd, 0xffffee, 0xf2ec90, 0xe8d100, 0xf3d300, 0xf1d403, 0xf2d401, 0xf1d400, 0xf0d82b, 0xbbae4e, 0x000007, 0x000000, 0x010100, 0x000000, 0x010101, 0x000000, 0x7a7a7a, 0xfbfbfb, 0xfcfcfa, 0xfdfdfb, 0xfefefc, 0xfefefc, 0xfffffc, 0xfefefc, 0xf9f9f7, 0xe1e1de, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdedede, 0xf9f9f9, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfbfdfd, 0xfefcfe, 0xfff9ef, 0xdd9e8e, 0xc70000, 0xe0211e, 0xe72022, 0xe72020, 0xe7211d, 0xe52320, 0xdc322f, 0xa1312e, 0x1c0000, 0x000102, 0x010102, 0x010101, 0x000000, 0xb9b9b9, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfc, 0xf9f9f7, 0x7e7e7d, 0x000000, 0x4e4e4b, 0x000004, 0xd5d4c5, 0xfcfae6, 0xe8e7d9, 0x393938, 0x000000, 0x000002, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x020202, 0x000000, 0xa9aaa1, 0xfbfae8, 0xf9f7df, 0xfaf8e2, 0xfdf9e3, 0xfbf7de, 0xfbf8e3, 0xc9c8bd, 0x000000, 0x000000, 0x010103, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x161519, 0xe2e1d2, 0xf8f9e4, 0x797a72, 0x4d4d4a, 0x3e3e3a, 0x000000, 0xd0d0cf, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefc, 0xfefefd, 0xfdfff9, 0xfdfccb, 0xe9db53, 0xecd300, 0xf0d405, 0xefd302, 0xf1d71c, 0xcbbf46, 0x292718, 0x000000, 0x020100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd8d8d7, 0xffffff, 0xfefefc, 0xfefefc, 0xfefefc, 0xfffffd, 0xfefefc, 0xfbfbf9, 0xededec, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xebebeb, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfcfdfd, 0xfefffa, 0xf4dbcc, 0xc33a34, 0xdc171a, 0xe42121, 0xe62022, 0xeb1f20, 0xe92120, 0xde2c2a, 0xb73632, 0x390806, 0x000000, 0x020101, 0x030303, 0x000000, 0x5f5f5f, 0xf3f3f3, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefd, 0xfffffd, 0xdadad9, 0x171718, 0x000000, 0x383734, 0xe4e2d3, 0xfaf8e3, 0xfaf8e8, 0xa2a199, 0x000000, 0x060607, 0x010102, 0x000000, 0x000000, 0x010102, 0x000000, 0x000000, 0x5f5f5a, 0xebebdd, 0xfafae5, 0xfaf8e3, 0xe3e2d2, 0xcfcdbf, 0xf8f6e2, 0xf9f7e1, 0xf5f4e5, 0x898982, 0x000000, 0x050507, 0x000002, 0x000000, 0x000000, 0x000000, 0x020202, 0x060605, 0x000000, 0x8a8a84, 0xfaf9e6, 0xf9f8e4, 0x9d9c93, 0x000000, 0x000000, 0x8e8d8d, 0xfafaf8, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefe, 0xfdfefb, 0xffffe9, 0xf5ef94, 0xe7d214, 0xf3d603, 0xf1d912, 0xe0cd4c, 0x554d29, 0x000000, 0x030301, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x8c8c8b, 0xfcfcfa, 0xfefefc, 0xfefefc, 0xfefefc, 0xfffffd, 0xfefefc, 0xfdfdfb, 0xf6f6f5, 0xcacaca, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcccccc, 0xf7f7f7, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfdfdfe, 0xfff9f1, 0xd99a8e, 0xcf0000, 0xe42021, 0xe52021, 0xe52021, 0xe81f20, 0xdc2926, 0xb73632, 0x521615, 0x000000, 0x010302, 0x010100, 0x010102, 0x000000, 0xc2c2c2, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfb, 0xfcfcfa, 0x7f7f7e, 0x000000, 0x828078, 0xedebd9, 0xfaf8e1, 0xfaf8e4, 0xededde, 0x70716c, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x878881, 0xe4e4d6, 0xfaf9e5, 0xf9f8e3, 0xe5e4d5, 0x52534f, 0x000000, 0xbbbbaf, 0xfaf9e5, 0xfaf9e6, 0xe8e8db, 0x6d6e69, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x020202, 0x000000, 0x343634, 0xe1e1d4, 0xfafae5, 0xf9f8e5, 0xc7c6b6, 0x000000, 0x000000, 0xdededc, 0xfffefc, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfffffe, 0xfefefd, 0xfefefe, 0xffffff, 0xfefeff, 0xfdfefd, 0xfcfef3, 0xfdfcca, 0xe7da58, 0xf0d702, 0xe8da4b, 0x7b763a, 0x000000, 0x060504, 0x020202, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x1d1d1c, 0xe3e3e1, 0xfffffd, 0xfdfdfb, 0xfefefc, 0xfefefc, 0xfefefc, 0xfdfdfb, 0xfdfdfb, 0xe1e1e1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xeaeaea, 0xfefefe, 0xfefefe, 0xfffdff, 0xfdfdfc, 0xfcfefc, 0xfefcfd, 0xfdfffd, 0xf9e2da, 0xc54a45, 0xe01013, 0xe71f21, 0xe62020, 0xe52022, 0xe02422, 0xc23430, 0x601d1a, 0x000000, 0x030102, 0x010101, 0x010101, 0x000000, 0x5d5d5d, 0xf6f6f6, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefeff, 0xfdfefe, 0xedeeee, 0x484849, 0x000000, 0xbbb9a9, 0xece9d5, 0xfbf9e4, 0xfaf8e1, 0xfaf9e4, 0xededdd, 0xaaa99e, 0x75756e, 0x6b6c67, 0x77766f, 0xa09e95, 0xd5d3c7, 0xf7f6e6, 0xfaf9e6, 0xf9f8e3, 0xf9f8e8, 0x96968e, 0x000000, 0x000000, 0x343531, 0xe2e4d5, 0xfafae5, 0xf8f8e5, 0xe9eadb, 0x8e8e86, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x5a5a55, 0xd6d7c9, 0xfcfbe8, 0xf9f8e3, 0xf8f6e1, 0xdad7c4, 0x76746c, 0x000000, 0xbbbbba, 0xffffff, 0xfffefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfdfef8, 0xfffeea, 0xf1ed95, 0xe2d64b, 0x98924a, 0x000000, 0x000203, 0x010101, 0x000002, 0x000000, 0x000000, 0x010101, 0x000000, 0x010000, 0x020101, 0x000000, 0xa7a8a6, 0xffffff, 0xfefefc, 0xfdfefc, 0xfefffc, 0xfffefc, 0xfefefb, 0xfffffd, 0xf1f1f1, 0x868686, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x868686, 0xf0f0f0, 0xffffff, 0xfefefe, 0xfefdff, 0xfdfdfc, 0xfdfdfc, 0xfefcfe, 0xfffcf8, 0xe1b2ac, 0xc80000, 0xe41f1e, 0xe52021, 0xe32221, 0xdf2423, 0xcd3030, 0x782322, 0x000000, 0x000001, 0x020001, 0x000000, 0x010201, 0x000000, 0xb9b9b9, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xcbcccc, 0x000000, 0x686761, 0xd1cebc, 0xe5e3ce, 0xfbf9e4, 0xfaf8e1, 0xf9f8e0, 0xfaf9e2, 0xfbfae5, 0xf7f7e3, 0xf5f5e4, 0xf7f6e3, 0xfbf8e6, 0xfaf8e3, 0xf9f6e0, 0xf9f5df, 0xfaf8e5, 0xe2e1d4, 0x222321, 0x000000, 0x050506, 0x000000, 0xaaaca2, 0xfcfce9, 0xf8f7e1, 0xf9f8e3, 0xf6f6e4, 0xd9d7c9, 0xb1b0a3, 0x97978d, 0x9f9e95, 0xc4c2b8, 0xedecdd, 0xfafae6, 0xf9f8e1, 0xf9f9e2, 0xf7f5e0, 0xd6d2be, 0xb5b2a7, 0x000000, 0x7f7f7e, 0xfbfbfa, 0xfefeff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfcfff6, 0xfdfff1, 0xfcfdcf, 0xb3af7b, 0x000000, 0x000005, 0x030204, 0x000000, 0x010001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x020001, 0x000000, 0x494748, 0xf0efee, 0xfffffe, 0xfffefc, 0xfefffb, 0xfefffa, 0xfefefb, 0xfefefc, 0xf9f9f8, 0xd7d7d7, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdedede, 0xf9f9f9, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefc, 0xfdfdfd, 0xf9fffc, 0xfdeee8, 0xc96967, 0xda0510, 0xe51f1d, 0xe71f20, 0xe32121, 0xd32d2a, 0x8a2826, 0x000000, 0x000102, 0x010101, 0x010101, 0x010302, 0x000000, 0x4d4d4d, 0xefefef, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xbdbebc, 0x000000, 0x7f7e77, 0xd2cfbd, 0xdcdac5, 0xfaf8e3, 0xfbf9e2, 0xfaf9e1, 0xfaf8e0, 0xf9f7df, 0xf9f7df, 0xf8f6df, 0xfaf8e1, 0xf7f6df, 0xf8f5df, 0xfaf5e1, 0xfaf5e0, 0xfcf9e7, 0xb5b4aa, 0x000000, 0x020202, 0x020202, 0x000000, 0x656660, 0xf4f4e4, 0xf9f7e2, 0xf7f5e1, 0xf8f5e1, 0xfaf8e2, 0xf9f7e0, 0xf8f7e0, 0xf9f8e3, 0xfaf8e4, 0xf9f6e0, 0xf8f6de, 0xf8f8e0, 0xfafae2, 0xf1f0d9, 0xd2cdb8, 0xc4c1b4, 0x000000, 0x646463, 0xf8f8f7, 0xfefeff, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfefef9, 0xfcfef7, 0xfffff3, 0xbfbfb8, 0x000000, 0x040603, 0x010203, 0x000002, 0x000100, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x020001, 0x020305, 0x000000, 0xbfc0bc, 0xfffffd, 0xfcfefa, 0xfffffa, 0xfefff9, 0xfefefc, 0xfefefc, 0xfbfbfb, 0xededed, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xebebeb, 0xfdfdfd, 0xffffff, 0xffffff, 0xfffefe, 0xfefefc, 0xfcfffd, 0xfafff8, 0xeecbc4, 0xc4151e, 0xe21f20, 0xe61f20, 0xe41e20, 0xd62b29, 0xa12c2b, 0x190200, 0x000000, 0x020002, 0x000000, 0x000101, 0x030404, 0x000000, 0xaeaeae, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xcdcecc, 0x000000, 0x706f68, 0xd5d2c0, 0xd4d2bc, 0xecebd5, 0xfaf8e1, 0xf9f9e2, 0xf9f8e3, 0xf9f8e2, 0xfaf8e3, 0xfaf8e3, 0xf9f7e2, 0xfaf6e2, 0xfaf5e2, 0xfaf5e2, 0xfaf5e2, 0xf9f6e5, 0x888780, 0x000000, 0x000000, 0x000000, 0x000000, 0x111213, 0xe2e1d4, 0xfaf9e5, 0xf7f5e2, 0xf8f5e1, 0xf7f6e0, 0xf8f6df, 0xf8f6dc, 0xf9f7dd, 0xf9f7de, 0xfbf7df, 0xfbf8e0, 0xfbf9e2, 0xf9f8e1, 0xe0dcc8, 0xd7d1be, 0xbcb9ae, 0x000000, 0x70706f, 0xfafaf9, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffefd, 0xfefdfc, 0xfefff5, 0xeff1e6, 0x50524e, 0x000000, 0x010101, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010000, 0x010102, 0x010202, 0x000000, 0x7c7571, 0xfbf8f1, 0xfcfffa, 0xfffefb, 0xfefefa, 0xfefefe, 0xffffff, 0xfefefe, 0xf2f2f2, 0xaaaaaa, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb1b1b1, 0xf4f4f4, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfffeff, 0xfcfefb, 0xfefefb, 0xfffaf0, 0xda938f, 0xd10000, 0xe52022, 0xe42121, 0xdb2827, 0xaf302d, 0x3a0909, 0x000000, 0x010101, 0x000103, 0x010101, 0x010101, 0x000000, 0x292929, 0xe7e7e7, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfffffe, 0xe8e9e8, 0x1e1f21, 0x24221e, 0xc5c2b2, 0xd7d4c0, 0xd5d2bd, 0xe1dec7, 0xe4e3cc, 0xe4e3cc, 0xe4e3ce, 0xe8e5d1, 0xefedd8, 0xf9f7e2, 0xfaf7e1, 0xfaf6e0, 0xfaf5e0, 0xfaf6e0, 0xf4f1e1, 0x5b5b57, 0x000000, 0x000000, 0x1e2121, 0x000000, 0x000000, 0xd9d8cd, 0xfaf9e5, 0xf7f6e0, 0xf7f6df, 0xf8f6e0, 0xf8f6df, 0xf8f6df, 0xf0eed7, 0xe7e5ce, 0xe5e0cb, 0xe7e2cd, 0xe6e3cd, 0xdbd9c3, 0xd2cdb9, 0xdad4c4, 0x918e88, 0x000000, 0x9c9c9c, 0xfffffe, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffc, 0xfefffe, 0xfefefb, 0xfdfdf8, 0xfffffd, 0xaaaba9, 0x000000, 0x020102, 0x000000, 0x000100, 0x000000, 0x000000, 0x000100, 0x010101, 0x010101, 0x010102, 0x000103, 0x0c0000, 0x6e2a2d, 0xeed8d5, 0xfffffb, 0xfffffc, 0xfefefb, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfa, 0xe0e0de, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe3e3e3, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfbfffb, 0xfffffb, 0xfae6df, 0xc7514f, 0xdc141a, 0xe42023, 0xdf2727, 0xbe3232, 0x511110, 0x000000, 0x000102, 0x020002, 0x010100, 0x010101, 0x020202, 0x000000, 0x929292, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0x989898, 0x000000, 0x6a6a63, 0xceccbd, 0xd8d5c2, 0xd5d1be, 0xd5d3bf, 0xd6d5c0, 0xd7d4c4, 0xd9d5c5, 0xd9d5c2, 0xebe8d4, 0xfaf7e3, 0xf8f6e1, 0xf9f7e2, 0xf8f7e1, 0xf5f4e2, 0xabaaa1, 0x3f3e39, 0x999b91, 0xd5d9cc, 0x7d7f76, 0x6b6b64, 0xe8e7d8, 0xf8f7e2, 0xf6f6e0, 0xf6f5e0, 0xf9f7e0, 0xf8f6df, 0xe8e6cf, 0xd8d5c4, 0xd6d3c3, 0xd7d3c1, 0xd8d2c1, 0xd2cebb, 0xd2cfbb, 0xd6d2c2, 0xb5b1a7, 0x1a1918, 0x000000, 0xd9d9d9, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefe, 0xffffff, 0xdfdfde, 0x10110f, 0x000000, 0x000000, 0x000100, 0x000000, 0x010000, 0x010201, 0x000201, 0x010100, 0x000101, 0x000000, 0x7c2424, 0xa70000, 0xd5a7a3, 0xfffcf8, 0xfefffc, 0xfdfefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xf4f4f4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xebebeb, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfdfefd, 0xfefdfd, 0xfffffc, 0xe6beba, 0xc90000, 0xe12123, 0xdc2523, 0xc63231, 0x641b1c, 0x000000, 0x000301, 0x000303, 0x020002, 0x010100, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xececec, 0x5f5f5f, 0x000000, 0x52524d, 0x9d9b92, 0xb0afa5, 0xafaea4, 0x909087, 0x717069, 0x828078, 0xbebdb0, 0xd9d7c5, 0xf5f3df, 0xf9f7e2, 0xf9f7e2, 0xf8f6e0, 0xf6f6df, 0xf8f6e3, 0xebead7, 0xf4f4de, 0xf8f7df, 0xf3f3de, 0xf1f0de, 0xf7f6e0, 0xf6f6de, 0xf6f5e0, 0xf7f6e1, 0xf8f6e0, 0xf1eed7, 0xcfccb9, 0x96938a, 0x6a6a63, 0x7d7c74, 0x9f9d95, 0xb3b1a8, 0xacaba1, 0x87867f, 0x040100, 0x000000, 0xaaaaaa, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfafaf8, 0x838381, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010201, 0x000100, 0x000000, 0x6b1a14, 0xc52a28, 0xcc0003, 0xbf6566, 0xfdefec, 0xfeffff, 0xfdfffd, 0xfefefe, 0xfefefe, 0xfefeff, 0xffffff, 0xf6f6f6, 0xbdbdbd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbcbcbc, 0xf5f5f5, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfbfffd, 0xfefffe, 0xfff7f2, 0xcc827f, 0xd30000, 0xe12524, 0xd03330, 0x7b201d, 0x000000, 0x000102, 0x010102, 0x020101, 0x020101, 0x000101, 0x000000, 0x000000, 0x757575, 0xf8f8f8, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xe9e9e9, 0x808080, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x61625c, 0xcdcbba, 0xeeebd7, 0xf8f6e1, 0xf9f7e2, 0xf9f7e2, 0xf9f6e2, 0xf8f6e1, 0xf9f7e0, 0xf9f6de, 0xf9f7de, 0xf9f7e0, 0xf9f7e2, 0xf7f6e1, 0xf7f6e0, 0xf7f5e0, 0xf8f6e1, 0xfbf8e2, 0xe7e2cc, 0xa3a193, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x28292b, 0xb5b5b5, 0xfbfbfb, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xcacac9, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x010000, 0x000000, 0x560f11, 0xbe2726, 0xe11e1c, 0xdc1a18, 0xbd1b1f, 0xf0d0cd, 0xfffffe, 0xfdfefa, 0xfefffe, 0xfffffe, 0xfffffe, 0xfffffe, 0xfbfbfb, 0xdadada, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd4d4d4, 0xfafafa, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfffffd, 0xf6ded9, 0xbf3b3d, 0xd7181b, 0xd53231, 0x922c29, 0x000000, 0x000101, 0x000202, 0x020001, 0x010100, 0x000200, 0x000101, 0x000000, 0x000000, 0xbebebe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfb, 0xfefefe, 0xf8f8f6, 0xd2d3d1, 0xa2a4a2, 0x8f908e, 0x91918f, 0xaaaaa9, 0x969697, 0x000000, 0x8f8e89, 0xd7d4c4, 0xe9e7d2, 0xf9f7e2, 0xfaf8e3, 0xfaf8e3, 0xf9f7e1, 0xf9f7de, 0xf8f7de, 0xf8f6e0, 0xf7f6e0, 0xf7f7df, 0xf8f7df, 0xf8f6e1, 0xf8f6e1, 0xf9f7e2, 0xf8f6e1, 0xfbf6e1, 0xe0dbc5, 0xbebcad, 0x222220, 0x3e3e3e, 0xafafad, 0x979795, 0x848484, 0x8d8d8d, 0xb4b5b4, 0xe8eae8, 0xfefffe, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xf2f2f1, 0x505050, 0x000000, 0x020101, 0x010101, 0x010101, 0x010101, 0x000000, 0x390807, 0xb22927, 0xdf2120, 0xe71c19, 0xe31e1c, 0xcc0000, 0xdaa19e, 0xfffdfa, 0xfdfffb, 0xfefffd, 0xfffffd, 0xfffffd, 0xfffffd, 0xfefefd, 0xe7e7e8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xefefef, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefeff, 0xfffdfa, 0xe3bab4, 0xc10000, 0xd12b2c, 0xa43331, 0x270302, 0x000002, 0x020201, 0x010201, 0x000000, 0x000100, 0x000100, 0x010101, 0x000000, 0x373737, 0xebebeb, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfffefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xffffff, 0xd3d3d3, 0x000000, 0x5f605a, 0xd1d1c0, 0xeae9d4, 0xfaf8e3, 0xf3f1de, 0xf2f1df, 0xf9f7e0, 0xf9f8e1, 0xf8f8e0, 0xf9f7e2, 0xf8f9e5, 0xf8f8e1, 0xf8f7df, 0xf9f7e0, 0xf9f7e3, 0xf1f0de, 0xfaf8e5, 0xf9f6e0, 0xdfdbc8, 0xc0beb2, 0x000000, 0x757574, 0xfdfefb, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfffffe, 0x9c9c9a, 0x000000, 0x020202, 0x010100, 0x010101, 0x000000, 0x220301, 0x9b2c28, 0xd72a28, 0xe71e1a, 0xea1d1a, 0xe51e1f, 0xd7020c, 0xc86463, 0xfdeee9, 0xfcfffc, 0xfffffd, 0xfffffd, 0xfefefc, 0xfefefc, 0xfdfdfc, 0xf0f0ee, 0x9f9f9f, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x999999, 0xf2f2f2, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefd, 0xfff7f4, 0xcb8886, 0xc2000d, 0xa22e2d, 0x3c0d0b, 0x000000, 0x020103, 0x030002, 0x010102, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x8f8f8f, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfc, 0xffffff, 0xd6d6d6, 0x000000, 0x4f4f4a, 0xd0cfbe, 0xe5e2ce, 0xf9f6e5, 0xa6a49b, 0xa4a39b, 0xfbfae6, 0xf8f8e3, 0xfaf9e4, 0xebead8, 0xc3c3b6, 0xf9f9e6, 0xf9f7e1, 0xfbf9e2, 0xe7e5d5, 0x797873, 0xece9dd, 0xece9d5, 0xdfdac8, 0xb6b4aa, 0x000000, 0x848484, 0xfcfcfa, 0xfdfefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xd5d5d3, 0x000000, 0x000000, 0x000101, 0x000001, 0x0c0000, 0x922726, 0xd02c2b, 0xe52021, 0xea1e1b, 0xe61f1c, 0xe61f20, 0xde1b1c, 0xc21b23, 0xf0cfca, 0xfffefb, 0xfffffd, 0xfffffd, 0xfdfdfb, 0xfefefc, 0xfdfdfb, 0xf8f8f6, 0xd9d9d6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe0e0e0, 0xfafafa, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefb, 0xf9eae5, 0xbd5658, 0xa92423, 0x3f0f0d, 0x000000, 0x010303, 0x030101, 0x020101, 0x000101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0xcbcbcb, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xffffff, 0xe2e2e2, 0x000000, 0x3d3d39, 0xd3d0be, 0xe1ddc9, 0xe8e5d6, 0x6f6d68, 0x6c6c68, 0xf7f7e4, 0xf9f7e4, 0xfcfbe7, 0xc8c8ba, 0x535350, 0xf3f2e4, 0xfaf8e3, 0xfbf9e4, 0xd3d3c3, 0x000000, 0xc8c6bd, 0xdedbc9, 0xe0dbc9, 0xaeaca3, 0x000000, 0x979796, 0xfffffe, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfffffd, 0xf5f5f3, 0x5f5f5e, 0x000000, 0x000201, 0x000000, 0x832523, 0xd12c2a, 0xe6201e, 0xe91f1b, 0xe61f1b, 0xe41f1f, 0xe51f1f, 0xe11f1e, 0xcd0000, 0xdca29d, 0xfffcf6, 0xfefffd, 0xfefefc, 0xfefefc, 0xfefefc, 0xfdfdfb, 0xfcfcfa, 0xe3e3e2, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe5e5e5, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfffefc, 0xecd4ce, 0x9e3436, 0x5a1313, 0x000000, 0x000101, 0x010102, 0x020000, 0x010100, 0x000100, 0x000000, 0x000000, 0x000000, 0x000000, 0x444444, 0xeeeeee, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xf5f5f5, 0x595959, 0x000000, 0xa7a69a, 0xdeddce, 0xdfdfd1, 0x474741, 0x545553, 0xf3f4e3, 0xfbf8e5, 0xfefce9, 0xaeaea3, 0x000000, 0xe4e4d9, 0xfbfae7, 0xfcfbe8, 0xd0d0c4, 0x000000, 0xaeada6, 0xdedcd0, 0xc8c4b9, 0x6b6a65, 0x000000, 0xc1c1c1, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefc, 0xfffffe, 0xababaa, 0x000000, 0x000000, 0x711818, 0xc82e2b, 0xe2231f, 0xe6201c, 0xe4211d, 0xe3201f, 0xe32021, 0xe32021, 0xe0201f, 0xd90001, 0xcc6b69, 0xffefea, 0xfefffd, 0xfefefc, 0xfefefc, 0xfdfdfb, 0xfdfdfb, 0xfefefc, 0xebebeb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xf0f0f0, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfe, 0xfffefe, 0xd2b7b2, 0x550000, 0x000000, 0x000102, 0x010101, 0x010103, 0x000001, 0x010001, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x8d8d8d, 0xfcfcfc, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffe, 0xfffffe, 0xfffffe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xb9b9b9, 0x000000, 0x000000, 0x555551, 0x6a6a64, 0x000000, 0x3d3e3e, 0xe0e0d4, 0xf5f3e4, 0xfaf9ea, 0x9fa098, 0x000000, 0xd8d8cf, 0xf8f8e9, 0xf4f3e5, 0xb0afa7, 0x000000, 0x4a4948, 0x63625f, 0x000000, 0x000000, 0x5b5b5c, 0xf1f1f1, 0xfffefe, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefd, 0xfffffd, 0xdcdcdb, 0x000000, 0x4a0001, 0xbc2b2b, 0xe12321, 0xe42020, 0xe52121, 0xe32121, 0xe32122, 0xe22122, 0xe22121, 0xe31f22, 0xe11719, 0xc73234, 0xf6dad6, 0xfefffd, 0xfdfefb, 0xfdfdfb, 0xfcfcfc, 0xfdfdfb, 0xfdfdfb, 0xf6f6f6, 0xc1c1c1, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xbbbbbb, 0xf6f6f6, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfeffff, 0xfffcfb, 0x968985, 0x000000, 0x000002, 0x000201, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc1c1c1, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffffc, 0xfefefc, 0xfefefc, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfafafa, 0xbbbbbb, 0x636363, 0x000000, 0x000000, 0x000000, 0x000000, 0x3b3b39, 0x656662, 0x757672, 0x444442, 0x000000, 0x636360, 0x6f706b, 0x535351, 0x000000, 0x000000, 0x000000, 0x000000, 0x2b2c2c, 0x919191, 0xe5e5e5, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefffe, 0xfefffd, 0xfffefe, 0xfdfefd, 0xf9f6f4, 0x706564, 0x9e000c, 0xd72425, 0xe71d21, 0xe32020, 0xe12021, 0xe12121, 0xe12120, 0xe12221, 0xe22120, 0xe31f22, 0xe21f1f, 0xc90000, 0xe6b8b4, 0xfffef9, 0xfcfef8, 0xfefdfa, 0xfdfefb, 0xfffdfb, 0xfdfdfb, 0xfbfbfb, 0xdddddd, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xf9f9f9, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xf0f0f1, 0x464645, 0x000000, 0x000102, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x191919, 0xe4e4e4, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefd, 0xfefefd, 0xfffffe, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfafafa, 0xfdfdfd, 0xf4f4f3, 0xdddddb, 0xc9c9c7, 0xbebebd, 0x7d7d7c, 0x2a2b2d, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x5c5c5c, 0xafafaf, 0xcccccc, 0xcecece, 0xeaeaea, 0xfbfbfb, 0xfbfbfb, 0xfbfbfb, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfffdfe, 0xfefefa, 0xfffef9, 0xc4a2a1, 0xc10000, 0xe31e1e, 0xe71d20, 0xe12121, 0xe12021, 0xe12020, 0xe12120, 0xe22221, 0xe22121, 0xe32022, 0xe21f1f, 0xd40000, 0xd58a87, 0xfff5ef, 0xfcfff9, 0xfefef9, 0xfdfef8, 0xfffdfa, 0xfefefc, 0xfdfdfd, 0xeaeaea, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xe3e3e3, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xd5d5d6, 0x000000, 0x000000, 0x010001, 0x020000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020202, 0x000000, 0x727272, 0xf9f9f9, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefd, 0xfffffd, 0xffffff, 0xfffffe, 0xfafbf9, 0xe9eae8, 0xdbdbd9, 0xd7d7d5, 0xd9d9d8, 0xdadad8, 0xd6d6d5, 0xd6d6d5, 0xe2e2e1, 0xf5f5f4, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfffdfe, 0xfdfefa, 0xfffffa, 0xe8c7c2, 0xc50007, 0xe41b1b, 0xe61c1f, 0xe22021, 0xe12021, 0xe12021, 0xe12120, 0xe22221, 0xe22222, 0xe32021, 0xe21f1d, 0xdb030d, 0xc85f56, 0xfce7dd, 0xfdfffc, 0xfefdfd, 0xfdfefb, 0xfefdfc, 0xfefefc, 0xfefefe, 0xf0f0f0, 0x333333, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xebebeb, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xaeaeae, 0x000000, 0x020203, 0x010000, 0x010001, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000001, 0x010102, 0x000000, 0xb0b0b0, 0xffffff, 0xfcfcfc, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfc, 0xfefffe, 0xffffff, 0xffffff, 0xfffefe, 0xfefefc, 0xfefefe, 0xfefefe, 0xfdfdfc, 0xfdfdfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfffffe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfffffe, 0xfffffd, 0xfffefe, 0xfbfffd, 0xfefffc, 0xf6e0dd, 0xc44144, 0xe11318, 0xe61c20, 0xe31f20, 0xe12021, 0xe12021, 0xe22221, 0xe22221, 0xe22222, 0xe4201e, 0xe3201b, 0xdd1314, 0xbd4430, 0xf6dfc7, 0xfefff7, 0xfefdfb, 0xfdfefc, 0xfefdfe, 0xfefefc, 0xfefefd, 0xf6f6f6, 0xc7c7c7, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x999999, 0xf3f3f3, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xfbfbfb, 0x777777, 0x000000, 0x000001, 0x000000, 0x000101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010100, 0x000102, 0x000000, 0x000000, 0xd4d7d4, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefd, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfefdff, 0xffffff, 0xffffff, 0xfefefe, 0xf5f5f5, 0xe9e8ea, 0xdcdcdd, 0xcbcbca, 0xbfbfbf, 0xb2b3b4, 0xa2a2a4, 0x959699, 0x8f9094, 0x8f9093, 0x939398, 0x9e9ea2, 0xb0b0b2, 0xc5c5c6, 0xdddddc, 0xf1f1f0, 0xfefefd, 0xffffff, 0xffffff, 0xfdfdfe, 0xfffefd, 0xfffefe, 0xfefefe, 0xfffffe, 0xfcfbfd, 0xebeaea, 0xd7d7d6, 0xc7c6c8, 0xbfbfc1, 0xb9b9bc, 0xb6b7b9, 0xbbbcbd, 0xc2c3c4, 0xd5d6d5, 0xeeeeea, 0xfffefd, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xf5f5f4, 0xe8e7e7, 0xd8d7da, 0xc6c6c7, 0xbababc, 0xa8a9ac, 0x9a9b9d, 0x919295, 0x8d8e93, 0x8e8f93, 0x929397, 0x9d9da1, 0xb1b1b3, 0xc5c6c5, 0xdedfdd, 0xf2f2f3, 0xfefefc, 0xffffff, 0xfefdfe, 0xfcfcf9, 0xfcfdfc, 0xfdfdfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xfdfdfe, 0xfdfdfd, 0xfcfcfd, 0xfbfcfd, 0xfbfafa, 0xfcfcf9, 0xfdfdff, 0xf4f2f5, 0xe4e3e2, 0xd1d1d2, 0xc2c3c4, 0xbababa, 0xb1b1b2, 0xaaaaac, 0xaaaaac, 0xb6b6b8, 0xc4c4c5, 0xdbdcdc, 0xf4f4f5, 0xffffff, 0xfffffe, 0xfcfdfa, 0xfffdff, 0xffffff, 0xf3f3f1, 0xdedddd, 0xd0cfd2, 0xcbcbcb, 0xcacaca, 0xcacbcc, 0xcbcbcc, 0xcbcbcb, 0xcbcacb, 0xcacacb, 0xcacacb, 0xcacacb, 0xcacacb, 0xcacaca, 0xc9c9c8, 0xc7c8c7, 0xc7c8c7, 0xc7c7c7, 0xc7c7c7, 0xc7c8c8, 0xc7c8c9, 0xc8c9ca, 0xc8c9cb, 0xcdcecf, 0xe1e0e0, 0xfbfaf8, 0xffffff, 0xfdfdfe, 0xf0eff0, 0xe3e2e4, 0xdeddde, 0xdadada, 0xd5d4d5, 0xd3d2d3, 0xd0d0d1, 0xcececf, 0xcbcccc, 0xc9cac9, 0xc8c9c8, 0xc6c7c8, 0xc5c6c7, 0xc4c5c6, 0xc3c4c4, 0xc4c5c4, 0xc4c5c4, 0xc7c8c7, 0xd2d2d3, 0xe5e6e6, 0xfafbf7, 0xfffefc, 0xfdfcfc, 0xfefcfd, 0xfffefd, 0xfffffe, 0xfeffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfffe, 0xfeffff, 0xfef2f1, 0xc76b6e, 0xde0003, 0xe41b1e, 0xe21e20, 0xe21f21, 0xe12021, 0xe22121, 0xe32121, 0xe42120, 0xe3201f, 0xe12019, 0xcf140e, 0xda892d, 0xf7e5af, 0xfeffef, 0xfdfff9, 0xfefffc, 0xfffef9, 0xfefefc, 0xfefefe, 0xf9f9f9, 0xd9d9d9, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xbfbfbf, 0xf7f7f7, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xebebeb, 0x353535, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000002, 0x000100, 0x000000, 0x3d3d3e, 0xedeeeb, 0xfffffc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfffffd, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefe, 0xfefefb, 0xe1e3df, 0xb4b7b3, 0x818385, 0x464b56, 0x000126, 0x000000, 0x0b0000, 0x362600, 0x503f00, 0x604f00, 0x6b5a00, 0x70600a, 0x726209, 0x726209, 0x665600, 0x4b3b00, 0x110000, 0x000000, 0x313646, 0x7f8086, 0xc0c1c1, 0xefeeed, 0xfffffc, 0xffffff, 0xffffff, 0xfbfbf9, 0xc8c8c8, 0x74757a, 0x000826, 0x000000, 0x0a0000, 0x332300, 0x413100, 0x433200, 0x3a2c00, 0x1f0500, 0x000000, 0x162031, 0x8b8b8f, 0xdddcde, 0xe0e1e1, 0xb4b6b2, 0x848787, 0x474a55, 0x00001d, 0x000000, 0x1e1300, 0x413500, 0x594900, 0x685900, 0x726310, 0x756512, 0x756412, 0x72620f, 0x675800, 0x514200, 0x291800, 0x000000, 0x363a4a, 0x86888c, 0xc7c8cb, 0xf2f2f1, 0xffffff, 0xfefefe, 0xfcfefc, 0xfcfefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefdfb, 0xfdfdfa, 0xfffeff, 0xe6e6e6, 0xa2a3a2, 0x434953, 0x000000, 0x000000, 0x241800, 0x413300, 0x4f4200, 0x514400, 0x4a3c00, 0x352600, 0x000000, 0x000000, 0x444850, 0xabadab, 0xf2f1f2, 0xffffff, 0xeff0ed, 0xa8a9a7, 0x3f4350, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x75777a, 0xb2b4b3, 0x818486, 0x2f3743, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x070000, 0x060000, 0x070000, 0x000000, 0x000000, 0x00000b, 0x787c78, 0xd7d9da, 0xfdfefe, 0xfcfcfd, 0xfefefd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfeffff, 0xfffcfa, 0xd29796, 0xd40000, 0xe21c1e, 0xe11e1f, 0xe11e20, 0xe21f20, 0xe22020, 0xe32021, 0xe2211f, 0xe22218, 0xd70012, 0xe07b1d, 0xf5c215, 0xf0e286, 0xfeffe6, 0xfdfff8, 0xfdfefe, 0xfffefc, 0xfefefc, 0xfefefe, 0xfcfcfc, 0xe0e0e0, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xe4e4e4, 0xfafafa, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xd3d3d3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x020102, 0x040503, 0x000000, 0x878683, 0xfdfdf5, 0xfffffc, 0xffffff, 0xfefefe, 0xfffffe, 0xfffffd, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xeff0f0, 0x9b9d9b, 0x000002, 0x1c0000, 0x7e701d, 0xaf9c3f, 0xcab64c, 0xdac446, 0xe4cb43, 0xebd041, 0xefd241, 0xf2d33e, 0xf3d53d, 0xf4d73d, 0xf4d53c, 0xf3d63c, 0xf0d33d, 0xedcf41, 0xe5c946, 0xd3bb45, 0xac9a35, 0x6d610f, 0x000000, 0x343842, 0xacaeab, 0xf0f1f2, 0xf9faf8, 0x989a95, 0x000000, 0x6c611d, 0xb9a54f, 0xd6be4f, 0xe2ca43, 0xe9d140, 0xecd33c, 0xedd13b, 0xead03c, 0xe5cb40, 0xd6be45, 0xad9c40, 0x564b00, 0x000000, 0x000011, 0x312200, 0x7a6e25, 0xae9d43, 0xcbb852, 0xdcc74e, 0xe7ce47, 0xeed248, 0xf2d447, 0xf3d644, 0xf4d63f, 0xf5d73d, 0xf5d73c, 0xf4d73c, 0xf1d63e, 0xeed444, 0xe6cf45, 0xd4c047, 0xb09f38, 0x6e6300, 0x000000, 0x4a4f54, 0xbebfbc, 0xf6f7f4, 0xffffff, 0xfbfcfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfbfd, 0xfdfefe, 0xc6c8c4, 0x0f1833, 0x3b2e00, 0xa39343, 0xcab852, 0xdec74c, 0xe7cd44, 0xecd140, 0xeed33d, 0xeed439, 0xedd23b, 0xeacf3e, 0xe1c947, 0xcab54a, 0x938539, 0x000000, 0x717176, 0xd2d0d2, 0x616466, 0x1e0a00, 0xa79644, 0xd0bc53, 0xdbc64e, 0xdec653, 0xdec44c, 0xdec347, 0xddc347, 0xddc347, 0xdcc248, 0xddc248, 0xdfc349, 0xdfc349, 0xe0c249, 0xdfc149, 0xe1c349, 0xe1c449, 0xe1c448, 0xe1c348, 0xe1c448, 0xe1c449, 0xe2c449, 0xe1c548, 0xe1c547, 0xdbc44e, 0xbdad51, 0x716823, 0x000000, 0x6b5f03, 0xae9d44, 0xc7b64c, 0xd3bf4b, 0xd7c04d, 0xdbc24c, 0xdcc24d, 0xdec34e, 0xe0c34e, 0xe1c54c, 0xe2c749, 0xe3c748, 0xe4c947, 0xe4ca46, 0xe5cb46, 0xe5cb46, 0xe5cb47, 0xe5ca48, 0xe3c949, 0xdbc54c, 0xbfad4e, 0x675c20, 0x000000, 0xc4c6c3, 0xfeffff, 0xfefefd, 0xfefefe, 0xfefeff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfffffd, 0xe4bdba, 0xcb0000, 0xe41a1d, 0xe31d1f, 0xe11e1f, 0xe21e1f, 0xe21f1f, 0xe11f1e, 0xe2211e, 0xdc0718, 0xd75f17, 0xfabf1c, 0xf3ce00, 0xecdd63, 0xfffede, 0xfdfffa, 0xfdfffd, 0xfffefe, 0xfffffd, 0xfefefe, 0xfefefe, 0xececec, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xe3e3e3, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xb2b2b2, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010001, 0x000000, 0x050402, 0x000000, 0x4b4632, 0xe5e1c3, 0xfffff5, 0xfffffd, 0xffffff, 0xfefefe, 0xfefefe, 0xfffffd, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xeeeeee, 0x66686a, 0x000000, 0xb5a44a, 0xe8d251, 0xf7dd46, 0xfbdb37, 0xfadb2c, 0xfbdb25, 0xfddc28, 0xfddb2b, 0xfedb2d, 0xfeda31, 0xfedb39, 0xfedd3d, 0xfcdc39, 0xfbdc35, 0xfcdb31, 0xfcdb2c, 0xfcda27, 0xfddd23, 0xfbde2f, 0xf1da46, 0xdac74b, 0xa0903c, 0x110000, 0x4f515a, 0x808083, 0x000000, 0xb6a953, 0xeed64f, 0xf9da32, 0xfcdc24, 0xfddc26, 0xfedd27, 0xfedd29, 0xfedc29, 0xfddc27, 0xfcdd24, 0xfbdd22, 0xf6db35, 0xe9d449, 0xb7a943, 0xc1af4b, 0xe5d24b, 0xf4db46, 0xfadd34, 0xfbdd29, 0xfddd26, 0xfedc29, 0xfedc2d, 0xfedd2e, 0xfddc31, 0xfddc35, 0xfddc38, 0xfddc39, 0xfddb36, 0xfcdc31, 0xfbdc2a, 0xfdde24, 0xfcdd21, 0xfbdf2c, 0xf1da41, 0xd8c54d, 0x968836, 0x000000, 0x616469, 0xd9d9d8, 0xfffeff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfeffff, 0xc9cbcc, 0x000000, 0x91863f, 0xe6d256, 0xf8dc3f, 0xf8db26, 0xfadb21, 0xfbdc25, 0xfddc28, 0xfddc28, 0xfddc28, 0xfedc28, 0xfddd27, 0xfcdd24, 0xfbdc26, 0xf5dc43, 0xd9c753, 0x5e540f, 0x000000, 0x675b20, 0xe2cb5a, 0xf8dc41, 0xfad92a, 0xfbda23, 0xfcd925, 0xfcd821, 0xfdd821, 0xfcd721, 0xfbd722, 0xfbd623, 0xfbd624, 0xfbd725, 0xfcd726, 0xfed726, 0xfed826, 0xffd926, 0xfed826, 0xfdd726, 0xfed727, 0xfed72a, 0xfed72a, 0xfdd72a, 0xfdd82a, 0xfdd82b, 0xfcdb29, 0xf8de31, 0xefda45, 0xe1d042, 0xeed73d, 0xf8db30, 0xfadc29, 0xfbdb28, 0xfbd92a, 0xfbd727, 0xfad627, 0xfad627, 0xfbd628, 0xfcd729, 0xfdd82c, 0xfed92c, 0xfed92d, 0xfeda2d, 0xffdb2d, 0xfeda2b, 0xfeda2c, 0xfeda2c, 0xfddb2a, 0xfddc2b, 0xfbdd37, 0xecd759, 0xa3934d, 0x000013, 0xe1e1df, 0xffffff, 0xfefefd, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfffffe, 0xf3d6d5, 0xc62a34, 0xe31518, 0xe61d1f, 0xe31f1f, 0xe41f1e, 0xe21f1d, 0xe3201e, 0xdd1819, 0xcf4013, 0xf4b020, 0xf9d106, 0xf3d000, 0xebd947, 0xfdfdcd, 0xfdfefa, 0xfcfffb, 0xfffefd, 0xfffffd, 0xfffffe, 0xfefefe, 0xf4f4f4, 0x9f9f9f, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xe7e7e7, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0x888888, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x010000, 0x010100, 0x020201, 0x000000, 0x221616, 0xc3ba72, 0xfaf7bc, 0xfefef6, 0xfffffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffffd, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfcfdfc, 0x9e9fa0, 0x0a0000, 0xd1c151, 0xf9df3f, 0xf9dc2d, 0xf5d93d, 0xedd446, 0xe4cc4c, 0xdac450, 0xd1bc50, 0xc5af48, 0xbba543, 0xb19b42, 0xa89444, 0xa19044, 0x9f8f43, 0xa09041, 0xac9a43, 0xb7a343, 0xcbb94b, 0xe0cc4f, 0xf2d94a, 0xfbdf38, 0xfade28, 0xf7da3b, 0xd7c147, 0x847227, 0x000000, 0xb2a248, 0xf3db41, 0xf9d924, 0xedd344, 0xd8c248, 0xcfb743, 0xc6ae40, 0xbea93f, 0xbca83e, 0xbfab3a, 0xcdb948, 0xdfc94c, 0xf2da40, 0xf7d923, 0xf8db33, 0xf8dc2d, 0xfadd2a, 0xf8dc3d, 0xf0d745, 0xe4cc45, 0xdac349, 0xceb84a, 0xc0ac44, 0xb39f40, 0xaa973e, 0xa2903f, 0x9d8d3f, 0x9e8d3f, 0xa29140, 0xab993f, 0xbba83f, 0xceba45, 0xe5cd4a, 0xf4d944, 0xfbdf32, 0xfcde24, 0xf6dc3b, 0xd1be4f, 0x675d1a, 0x00000e, 0xc6c6c4, 0xffffff, 0xfffdff, 0xfefefe, 0xfffeff, 0xf2f2f1, 0x474953, 0x82762e, 0xf0d94e, 0xf8db26, 0xf5db43, 0xe6ce52, 0xd6c054, 0xc9b74d, 0xbbaa41, 0xb4a23d, 0xb09d3a, 0xb19f3a, 0xb8a73c, 0xd1bc4a, 0xecd14d, 0xf6db2c, 0xf9db26, 0xd2bb45, 0x211716, 0xd3c04a, 0xf8da25, 0xf5d930, 0xebd44b, 0xdcc248, 0xd7be47, 0xd7bd48, 0xd6bc47, 0xd5bc47, 0xd4bb48, 0xd4bc4a, 0xd4bc4b, 0xd3bc4c, 0xd3bb4b, 0xd3ba4a, 0xd3ba4a, 0xd2b94b, 0xd1b84c, 0xd0b74c, 0xd0b64d, 0xcfb54c, 0xcdb54a, 0xccb44a, 0xccb44b, 0xccb54e, 0xd5bd4f, 0xf1d749, 0xfadd25, 0xfadd1a, 0xf7dc2a, 0xf0d744, 0xe8d04d, 0xe0c74d, 0xdac14a, 0xd8bf4d, 0xd6bd4c, 0xd4bc4d, 0xd3bb4d, 0xd2ba4b, 0xd1b84a, 0xcfb54a, 0xceb44a, 0xccb24a, 0xc9b348, 0xc8b247, 0xc8b246, 0xc8b245, 0xc8b343, 0xd7bd4b, 0xf1d240, 0xf5d919, 0xefd754, 0x675b11, 0x8e8f8f, 0xfffffb, 0xfefffe, 0xfdfdfe, 0xfefefd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfce9e8, 0xca5f62, 0xde0004, 0xe41e1e, 0xe41e1e, 0xe41e1d, 0xe51e1b, 0xe11c1b, 0xcf2212, 0xec9c21, 0xfcd012, 0xf5d200, 0xf1d500, 0xe8d51f, 0xf9f9b3, 0xfefff6, 0xfdfffc, 0xfffefd, 0xfefefd, 0xfefefe, 0xffffff, 0xf7f7f7, 0xcccccc, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xaaaa8e, 0xf6f6f5, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf4f4f4, 0x5b5b5b, 0x000000, 0x000000, 0x010101, 0x000000, 0x000001, 0x010101, 0x020102, 0x020404, 0x000000, 0x000000, 0xb4a758, 0xebde57, 0xfbf7be, 0xfffff8, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfcfefe, 0xfffffe, 0xebebe9, 0x011732, 0xab9c3d, 0xf5db38, 0xf4d932, 0xdac855, 0x998d47, 0x686432, 0x3e3d23, 0x010e12, 0x000004, 0x000000, 0x160003, 0x2b0008, 0x3c000f, 0x430012, 0x440011, 0x40000f, 0x2e0008, 0x0e0001, 0x000002, 0x252b1c, 0x6f6838, 0xae9e4b, 0xe0cb50, 0xf7db39, 0xf9d61e, 0xefd239, 0xbda835, 0xe4c737, 0xf4d620, 0xe1c548, 0x706731, 0x010812, 0x000005, 0x000004, 0x000004, 0x000004, 0x000004, 0x000003, 0x1f1b15, 0x9c8f41, 0xf2d642, 0xf6d80f, 0xf5d82f, 0xd6be4b, 0x978c42, 0x6a6734, 0x3a3b1e, 0x00020e, 0x000005, 0x030001, 0x1e0004, 0x2b0009, 0x3b000f, 0x450013, 0x450014, 0x410016, 0x220009, 0x000001, 0x000005, 0x2e311c, 0x777135, 0xb7aa4e, 0xe7d14f, 0xf8dd35, 0xfbdc29, 0xedd651, 0x9b9344, 0x000000, 0xc7c7c6, 0xffffff, 0xfefefc, 0xffffff, 0xc8c7c8, 0x000000, 0xd5c251, 0xf8d81d, 0xf0d74c, 0x9c914b, 0x3a3924, 0x00000d, 0x000004, 0x000003, 0x110004, 0x130004, 0x090004, 0x000004, 0x000002, 0x56532f, 0xd1c356, 0xf7d827, 0xefd02c, 0xb3a132, 0xf0d230, 0xf3da21, 0xd2bf52, 0x56512d, 0x00000b, 0x000006, 0x000008, 0x000007, 0x000008, 0x000007, 0x000007, 0x000007, 0x000007, 0x000007, 0x000007, 0x000007, 0x000007, 0x000007, 0x000007, 0x000007, 0x000006, 0x000005, 0x000004, 0x000004, 0x000003, 0x000000, 0x8d8241, 0xf5dd4b, 0xfadc30, 0xcdbb50, 0x746b36, 0x404223, 0x282919, 0x00070d, 0x00000b, 0x000008, 0x000005, 0x000004, 0x000004, 0x000005, 0x000005, 0x000005, 0x000006, 0x000005, 0x000004, 0x000003, 0x000003, 0x000002, 0x000008, 0xa9994a, 0xf4d63c, 0xf7d935, 0xaf9f4a, 0x2c3542, 0xf2f2ef, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffd, 0xfff6f3, 0xd28b8a, 0xd50000, 0xe31e1d, 0xe51d1b, 0xe21f19, 0xe41c1b, 0xd0120f, 0xe38c22, 0xfbcc21, 0xf1d600, 0xf5d400, 0xf2d400, 0xead400, 0xf5f39d, 0xfffff1, 0xfefefb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xd7d7d7, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xb9b9b4, 0xf6f6f6, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe6e6e6, 0x282828, 0x000000, 0x000000, 0x010101, 0x000000, 0x000001, 0x000004, 0x010201, 0x010401, 0x000000, 0x9a8c43, 0xebda41, 0xeee04f, 0xfefbcc, 0xfefef9, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfcfefd, 0xfffffe, 0xccccc8, 0x000000, 0xd5be43, 0xf8d821, 0xe5cd52, 0x4b482b, 0x000000, 0x630015, 0x861720, 0x9d2428, 0xa9282b, 0xb32c2b, 0xb92d2d, 0xbf2e2e, 0xc62f30, 0xc93030, 0xc9302e, 0xc8302f, 0xc4302f, 0xbd2e2d, 0xae2c2d, 0x912124, 0x60000f, 0x000000, 0x31301b, 0xab9745, 0xefd244, 0xf9da22, 0xfad628, 0xf5d41e, 0xf3d52b, 0xa5923b, 0x000000, 0x8d2e29, 0xa62b2b, 0xab2b2a, 0xb22b29, 0xb62a27, 0xb22826, 0xa02f2d, 0x6d212b, 0x150e0d, 0xdecb45, 0xf9db26, 0xd2b744, 0x271c15, 0x1e0002, 0x6b041c, 0x881f23, 0xa12728, 0xaf2829, 0xb82b2d, 0xbe2d2f, 0xc12e2e, 0xc82f2f, 0xcc2f30, 0xcb2f2e, 0xc9312f, 0xc12e2e, 0xb72b2d, 0xab2b2b, 0x8c1f21, 0x54000f, 0x000000, 0x494625, 0xb7a647, 0xf1d93e, 0xfbda26, 0xf4dd4d, 0xa09444, 0x000023, 0xe1e4db, 0xffffff, 0xffffff, 0x85878b, 0x7a711d, 0xf1d93f, 0xf6d923, 0xbeaa46, 0x000000, 0x772028, 0x9f2627, 0xb02c2d, 0xb92c2f, 0xbd2d30, 0xbf2c30, 0xbe2d31, 0xbb3030, 0x9d2c2d, 0x36000d, 0x6c6330, 0xebd541, 0xf1d105, 0xeed214, 0xf4d101, 0xf0d741, 0x776d34, 0x3e001b, 0x9a3034, 0xa72927, 0xa9282a, 0xa82929, 0xa82b2a, 0xaa2b2b, 0xaa292b, 0xab292b, 0xab2a2a, 0xab2a2a, 0xab292a, 0xac292a, 0xad2a2b, 0xac292a, 0xae2a2b, 0xaf2a2c, 0xaf2a2c, 0xb12a2c, 0xb1292c, 0xb0292b, 0xaf2d2e, 0x7e2527, 0x000000, 0xd6c755, 0xe1cc4c, 0x352a16, 0x46001e, 0x86212c, 0x96181c, 0xa22124, 0xa22328, 0xa3252a, 0xa6262a, 0xa7262a, 0xa82629, 0xaa272a, 0xac282b, 0xaf2a2c, 0xb12a2d, 0xb32a2c, 0xb42a2c, 0xb3292b, 0xb32a2b, 0xad3230, 0x61151a, 0x37351f, 0xe7c84a, 0xf8d621, 0xc9b651, 0x000000, 0xe4e3e2, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefc, 0xfffcf7, 0xe1afaa, 0xc80000, 0xe21b1a, 0xe71d19, 0xe41c1a, 0xd50516, 0xde7d1b, 0xfacb1b, 0xf1d603, 0xf0d600, 0xf3d402, 0xf2d500, 0xebd400, 0xf1eb86, 0xffffe6, 0xfefefc, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xe8e8e8, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xddddda, 0xfcfcfb, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xd5d5d5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000100, 0x000202, 0x030402, 0x000000, 0x7a6f30, 0xe8d342, 0xefd600, 0xf3e66c, 0xfffee0, 0xfefffb, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfefd, 0xfffffe, 0xb4b5b2, 0x261000, 0xe5c73e, 0xf9da29, 0xb9a547, 0x000000, 0xa83333, 0xcd3030, 0xd92b29, 0xdd2925, 0xde2824, 0xe12724, 0xe22622, 0xe22520, 0xe2251e, 0xe3251f, 0xe2261f, 0xe32521, 0xe52523, 0xe52524, 0xe32625, 0xdd2928, 0xcd2c2b, 0xab2b2c, 0x720d1c, 0x000000, 0x7c7234, 0xe9cf49, 0xf8d81e, 0xf4d513, 0xf3d631, 0x968836, 0x4b0016, 0xcb3635, 0xdd2824, 0xde2625, 0xe02626, 0xe22726, 0xe42625, 0xd52f33, 0x912e30, 0x0c1511, 0xdbc64a, 0xfbde3e, 0xa09042, 0x0d0005, 0xaf3b37, 0xd03030, 0xd62c29, 0xde2824, 0xe22623, 0xe32624, 0xe42522, 0xe32420, 0xe2241e, 0xe3241d, 0xe5231f, 0xe62320, 0xe62420, 0xe52520, 0xe32622, 0xde2928, 0xca2c2c, 0xa92d2c, 0x67001a, 0x000000, 0x918739, 0xefd742, 0xfedc24, 0xf0da4d, 0x746d23, 0x747779, 0xf9f9fa, 0xedecec, 0x262d3a, 0xbdaf40, 0xf7d922, 0xf1d73d, 0x776d32, 0x470009, 0xc6352f, 0xe22524, 0xe22423, 0xe52323, 0xe62320, 0xe72221, 0xe72220, 0xe52221, 0xdb282c, 0x992b2f, 0x000007, 0xd6bd4a, 0xf6d415, 0xf7d007, 0xf8d200, 0xead244, 0x525128, 0x80202a, 0xd63232, 0xe52624, 0xe52528, 0xe32626, 0xe22724, 0xe32625, 0xe32526, 0xe22626, 0xe02625, 0xe12625, 0xe12625, 0xe22625, 0xe32626, 0xe32625, 0xe32525, 0xe42425, 0xe32524, 0xe32625, 0xe32626, 0xe12725, 0xe02927, 0xb42f2d, 0x000000, 0xcec05f, 0xc4b655, 0x000000, 0xa4393a, 0xd33031, 0xdd2526, 0xe02327, 0xde2224, 0xde2224, 0xe02324, 0xe12323, 0xe02324, 0xe02425, 0xe22425, 0xe42424, 0xe42423, 0xe22524, 0xe22524, 0xe32525, 0xe22625, 0xde2d2c, 0x952b29, 0x071f18, 0xe0c34f, 0xf8d51e, 0xd5bf4d, 0x000000, 0xe0dfdf, 0xffffff, 0xfefdfe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefb, 0xfffefa, 0xeecbc5, 0xc2150e, 0xe41a18, 0xe41e18, 0xdb0115, 0xd96819, 0xfac422, 0xf7d405, 0xf4d701, 0xf2d503, 0xf1d602, 0xf1d700, 0xedd300, 0xefe46a, 0xffffd9, 0xfefffc, 0xfefdfe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xe3e3e3, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xe3e3df, 0xfdfdfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xc1c1c1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x030401, 0x000000, 0x5f5826, 0xe1cd41, 0xf3d80c, 0xebd300, 0xf4eb84, 0xffffea, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfdfdfc, 0xfffffe, 0xabadac, 0x463700, 0xe8cc3d, 0xf8db2e, 0xac983f, 0x1f0000, 0xc52d2c, 0xe22423, 0xe52323, 0xe32423, 0xe32422, 0xe42422, 0xe32421, 0xe42421, 0xe42321, 0xe42321, 0xe52320, 0xe52320, 0xe6231f, 0xe6231f, 0xe6231e, 0xe42422, 0xe12520, 0xdd2923, 0xce2d2d, 0x952829, 0x000000, 0x84763a, 0xedd54f, 0xf7d518, 0xf4d830, 0x968a37, 0x530007, 0xd12d2a, 0xe12421, 0xe32422, 0xe52524, 0xe52523, 0xe52424, 0xda2b2e, 0x952a2b, 0x1c1812, 0xe1c44d, 0xf8de41, 0x9c9145, 0x4a0010, 0xcb322f, 0xe52325, 0xe32524, 0xe32523, 0xe32524, 0xe42423, 0xe52321, 0xe42221, 0xe32321, 0xe32321, 0xe42320, 0xe62221, 0xe82223, 0xe72223, 0xe72222, 0xe52322, 0xe32522, 0xe02825, 0xcd3032, 0x95282b, 0x000000, 0x978b41, 0xf4db43, 0xf8de25, 0xd6c855, 0x000000, 0xcccaca, 0xd2d1d1, 0x000000, 0xdac840, 0xf7d818, 0xdcc74c, 0x112015, 0x8c1b20, 0xde2726, 0xe82120, 0xea2120, 0xe82022, 0xe8211f, 0xe7211f, 0xe7211f, 0xe62120, 0xe22421, 0xbd2d2c, 0x1d0001, 0xa99a40, 0xf4d82a, 0xf8d204, 0xf5d300, 0xe9d140, 0x504e26, 0x8a111c, 0xe02a2a, 0xe92325, 0xe82323, 0xe82223, 0xe92223, 0xe72224, 0xe62224, 0xe42323, 0xe42321, 0xe52322, 0xe62422, 0xe62422, 0xe62422, 0xe62421, 0xe62321, 0xe62220, 0xe62220, 0xe62321, 0xe62320, 0xe42420, 0xe32622, 0xb62b2b, 0x000000, 0xcaba5d, 0xc2b15d, 0x000000, 0xb42f2c, 0xe32221, 0xe62222, 0xe62121, 0xe72020, 0xe6201f, 0xe62020, 0xe62020, 0xe52120, 0xe5211f, 0xe5221f, 0xe5221f, 0xe5221f, 0xe5221f, 0xe6221f, 0xe7221f, 0xe6231f, 0xdf2b27, 0x962b29, 0x001512, 0xdbc350, 0xfad51a, 0xd8c049, 0x000000, 0xdcddda, 0xffffff, 0xfffdfe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffb, 0xfffffb, 0xf8dfd8, 0xc23f38, 0xdf160f, 0xd90f14, 0xd24d15, 0xf6ba23, 0xf5d407, 0xf3d401, 0xf0d501, 0xeed601, 0xeed600, 0xf3d502, 0xeed200, 0xecdc52, 0xfffdce, 0xfdfffa, 0xfefdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xf0f0f0, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xe6e6e6, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xa9a9a9, 0x000000, 0x010002, 0x000200, 0x000200, 0x010102, 0x030302, 0x000000, 0x39361d, 0xd7c246, 0xf4d918, 0xf0d600, 0xe9d400, 0xf7ef9e, 0xfeffec, 0xfdfffa, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefdfd, 0xfffffe, 0xacadad, 0x524400, 0xebd03e, 0xf9db2e, 0xae9c42, 0x240000, 0xc52a28, 0xe12421, 0xe22423, 0xe32523, 0xe32523, 0xe22426, 0xe22620, 0xe22522, 0xe52324, 0xe42321, 0xe52223, 0xe52322, 0xe5241e, 0xe5231f, 0xe52420, 0xe52321, 0xe62220, 0xe4241f, 0xe02623, 0xd12d29, 0x93282a, 0x000000, 0xab974a, 0xf5d739, 0xf4d830, 0x9b8b3a, 0x4e0005, 0xcf2a28, 0xdf2423, 0xe02423, 0xe22323, 0xe42424, 0xe42524, 0xd92b2c, 0x93272f, 0x171c10, 0xdfc348, 0xf8dd3b, 0x9f9341, 0x50000c, 0xcd2c2d, 0xe32424, 0xe32525, 0xe32625, 0xe32524, 0xe32523, 0xe42321, 0xe32420, 0xe42121, 0xe42121, 0xe3231d, 0xe72220, 0xe62322, 0xe42322, 0xe52424, 0xe42323, 0xe42324, 0xe62323, 0xe42322, 0xd02f2e, 0x90272a, 0x000000, 0xbdab51, 0xf7dc37, 0xf2de42, 0x8f8737, 0x686970, 0x8d8e92, 0x665d00, 0xedd438, 0xf7da2b, 0xb3a246, 0x000000, 0xb12a2d, 0xe22523, 0xe52321, 0xe6221f, 0xe42123, 0xe52222, 0xe22322, 0xe72021, 0xe52021, 0xe4211e, 0xd12928, 0x660018, 0x625d2d, 0xead13e, 0xf5d400, 0xf5d500, 0xe9d041, 0x514d26, 0x8a101f, 0xde2b2b, 0xeb2322, 0xe92321, 0xe52321, 0xea2123, 0xe62222, 0xe52221, 0xe22322, 0xe42222, 0xe42222, 0xe52323, 0xe52424, 0xe42322, 0xe52324, 0xe62322, 0xe62221, 0xe62123, 0xe62223, 0xe52222, 0xe52422, 0xe22623, 0xb32e29, 0x000000, 0xc7b95b, 0xc0b15a, 0x000000, 0xb72f32, 0xe42123, 0xe72020, 0xe71f21, 0xe42021, 0xe5201f, 0xe62021, 0xe41f22, 0xe42121, 0xe42120, 0xe52120, 0xe52221, 0xe62322, 0xe72222, 0xe72321, 0xe62321, 0xe6231f, 0xdf2c25, 0x982a2a, 0x001013, 0xdcc455, 0xfbd61a, 0xd9c14e, 0x000000, 0xd8d9d7, 0xfffffe, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefc, 0xfefefc, 0xfdf0e6, 0xca6a5f, 0xd00000, 0xcc2e0f, 0xf1a61e, 0xf8d310, 0xf2d400, 0xefd600, 0xeed600, 0xedd700, 0xeed600, 0xf1d501, 0xefd200, 0xead73b, 0xfdfcc2, 0xfdfff7, 0xfefdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xededed, 0x6f6f6f, 0x000000, 
-  0x000000, 0x000000, 0xe8e8e8, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0x929292, 0x000000, 0x020101, 0x010001, 0x020101, 0x010100, 0x000000, 0x00000e, 0xc2b545, 0xf2db24, 0xf1d600, 0xf0d600, 0xe9d51f, 0xfaf5ae, 0xfdfff1, 0xfcfefa, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xb1b1b0, 0x483900, 0xe9ce3f, 0xfadc2f, 0xb3a246, 0x260000, 0xc42926, 0xe12421, 0xe22422, 0xe32423, 0xe22523, 0xe1261e, 0xe32520, 0xe02526, 0xdb2828, 0xdb2825, 0xe22626, 0xe52525, 0xe42522, 0xe52320, 0xe72221, 0xe5221f, 0xe5231e, 0xe4231f, 0xe32322, 0xe02624, 0xcc2e2f, 0x6c1018, 0x2d2b17, 0xdfc64a, 0xf6d838, 0x9f8d3e, 0x480001, 0xcc2926, 0xdf2422, 0xdf2423, 0xe02323, 0xe12323, 0xe22323, 0xd82a2a, 0x91262c, 0x191c10, 0xe0c248, 0xf8dc3b, 0xa39545, 0x4d0007, 0xcc2b2b, 0xe22323, 0xe12323, 0xe22424, 0xe22324, 0xe02523, 0xe02425, 0xde2527, 0xdd2624, 0xdf2525, 0xde2526, 0xdf2723, 0xe22520, 0xe52321, 0xe42324, 0xe32322, 0xe32221, 0xe32322, 0xe52423, 0xe22623, 0xc92f33, 0x60001a, 0x564f2b, 0xead14f, 0xf8de28, 0xcdbf56, 0x000000, 0x000000, 0xa69843, 0xf6d92e, 0xf2d53d, 0x796d33, 0x48000e, 0xc82c31, 0xe4211e, 0xe72221, 0xe62121, 0xe62120, 0xe91f1f, 0xe32120, 0xe5201f, 0xe6201f, 0xe4211e, 0xda2627, 0x912325, 0x000006, 0xd4c13d, 0xf6d712, 0xf8d603, 0xe8d039, 0x4e4e21, 0x8a0b1e, 0xdf2a26, 0xe82422, 0xe92224, 0xe92122, 0xe72223, 0xe42222, 0xe81f23, 0xe42224, 0xe32322, 0xe32322, 0xe32322, 0xe42423, 0xe42321, 0xe22422, 0xe52322, 0xe52222, 0xe22323, 0xe22322, 0xe22320, 0xe1241f, 0xdf2622, 0xb32c2d, 0x000000, 0xc8bc5e, 0xc1b05c, 0x000000, 0xb62e30, 0xe42123, 0xe7201f, 0xe72022, 0xe61f22, 0xe42020, 0xe22221, 0xe4211f, 0xe5201e, 0xe2221f, 0xe3221f, 0xe32320, 0xe42320, 0xe32421, 0xe32421, 0xe22520, 0xe2241e, 0xde2b28, 0x97292a, 0x002018, 0xdfc852, 0xfbd718, 0xd7c24d, 0x000000, 0xd8d8d7, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefb, 0xfdfefa, 0xfffbef, 0xd19084, 0xb51000, 0xeb9c22, 0xfaca15, 0xf5d300, 0xf3d304, 0xeed501, 0xedd600, 0xedd500, 0xeed500, 0xefd600, 0xf0d300, 0xe8d527, 0xfbf9b6, 0xfefff4, 0xfefdfe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xf8f8f8, 0xe0e0e0, 0x000000, 
-  0x000000, 0x000000, 0xefefef, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfbfbfb, 0x727272, 0x000000, 0x010201, 0x020003, 0x030302, 0x000005, 0x000000, 0xaea23f, 0xf3da27, 0xf2d700, 0xf0d702, 0xefd600, 0xe9d63a, 0xfdf8bf, 0xfdfff5, 0xfdfefc, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfdfd, 0xffffff, 0xb7b8b5, 0x392a00, 0xe5cc3f, 0xfadc2f, 0xb7a64a, 0x220000, 0xc32928, 0xe12321, 0xe12422, 0xe32523, 0xe22523, 0xe22625, 0xe1252c, 0xce2727, 0xa52727, 0x9f2428, 0xa52527, 0xb5282b, 0xc52c30, 0xd9292c, 0xe22324, 0xe12221, 0xe3221d, 0xe5221f, 0xe52220, 0xe42220, 0xdf2424, 0xac2c27, 0x000000, 0xbaa54c, 0xfae04e, 0xa09041, 0x450000, 0xcb2727, 0xdf2321, 0xdf2322, 0xe12323, 0xe12323, 0xe32223, 0xd8292b, 0x8f242b, 0x1d1d10, 0xe1c246, 0xfadc3a, 0xa89848, 0x450004, 0xca2a2b, 0xe22323, 0xe12323, 0xe12323, 0xe22424, 0xe22523, 0xe12627, 0xc3262c, 0x992422, 0x921e1e, 0x961f24, 0xaa2a26, 0xc62e2b, 0xdb2a2b, 0xe02422, 0xe22321, 0xe42222, 0xe42322, 0xe32423, 0xe52321, 0xe02729, 0x9f2a2a, 0x000000, 0xc7b24c, 0xf9da23, 0xead64c, 0x534f2a, 0x000000, 0xd3bd45, 0xfbdb1d, 0xe3c84a, 0x2a2718, 0x861921, 0xdc272b, 0xe5201d, 0xe6221f, 0xe72021, 0xe7201e, 0xe82022, 0xe62020, 0xe6201e, 0xe81f1e, 0xe51f1d, 0xe22123, 0xba2b29, 0x110000, 0xa89c39, 0xf5db27, 0xf9d605, 0xecd235, 0x514f1f, 0x811323, 0xdb2d2a, 0xe52425, 0xe52324, 0xe32425, 0xe02622, 0xe02624, 0xe02424, 0xe12221, 0xe32322, 0xe32322, 0xe32322, 0xe32323, 0xe42224, 0xe22421, 0xe12525, 0xdf2626, 0xde2724, 0xdd2624, 0xdc2623, 0xdb2723, 0xd82a25, 0xa6302e, 0x000000, 0xd0c464, 0xc2b05b, 0x000000, 0xb52d30, 0xe42123, 0xe7211f, 0xe72022, 0xe62021, 0xe52023, 0xe12221, 0xdf2322, 0xdd2628, 0xda2727, 0xda2728, 0xda2727, 0xda2727, 0xda2828, 0xda2828, 0xd92929, 0xd92928, 0xd23432, 0x842a29, 0x2d3222, 0xe8ce55, 0xfada19, 0xd1c051, 0x000000, 0xdddcdc, 0xfffffe, 0xfffefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefd, 0xfdfef9, 0xfffff1, 0xd7b396, 0xd69300, 0xf9cf19, 0xf3d100, 0xf4d100, 0xf1d302, 0xedd500, 0xedd500, 0xeed500, 0xeed500, 0xeed500, 0xefd400, 0xe9d510, 0xf9f4a7, 0xffffef, 0xfefdfe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xf7f7f7, 0xc0c0c0, 0x000000, 
-  0x000000, 0xb5b5b5, 0xf2f2f2, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xf6f6f6, 0x5b5b5b, 0x000000, 0x010301, 0x010103, 0x000301, 0x000000, 0xa0933a, 0xefdb30, 0xf3d600, 0xf2d802, 0xf1d802, 0xefd600, 0xecda50, 0xfefbcd, 0xfdfff8, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfefc, 0xffffff, 0xbdbdb9, 0x2a1800, 0xe3ca40, 0xf9dc2e, 0xbaa94b, 0x200000, 0xc12929, 0xe12422, 0xe22422, 0xe32523, 0xe22523, 0xe32422, 0xdf292a, 0xb02a26, 0x190000, 0x091410, 0x00030c, 0x000000, 0x370001, 0x951d21, 0xca2b2c, 0xd82727, 0xe32220, 0xe6211e, 0xe4221f, 0xe4221e, 0xe12220, 0xc92b29, 0x5a000b, 0x86783d, 0xf7e15d, 0xa49446, 0x440000, 0xcb2727, 0xdf2221, 0xe02322, 0xe12323, 0xe32223, 0xe52222, 0xd9292b, 0x8e232c, 0x221f11, 0xe1c345, 0xfbdc38, 0xad9b4a, 0x3c0001, 0xc92a2b, 0xe22223, 0xe12323, 0xe12323, 0xe22424, 0xe12526, 0xd82a29, 0x932521, 0x000000, 0x272f1d, 0x202714, 0x000003, 0x380005, 0x982324, 0xd62a27, 0xdf2320, 0xe32222, 0xe52223, 0xe42423, 0xe22423, 0xe22424, 0xbd2b28, 0x1b0000, 0xa4964b, 0xf7d936, 0xf6dd41, 0x7e793b, 0x564e20, 0xebd03a, 0xf9da2b, 0xc0aa4e, 0x000000, 0xb22629, 0xe32325, 0xe62121, 0xe7211e, 0xe62120, 0xe12425, 0xcc2425, 0xdf2324, 0xe81f1c, 0xe71f1f, 0xe91e1f, 0xe62121, 0xd22b29, 0x670010, 0x6c652e, 0xedd63f, 0xf8d701, 0xf4d42e, 0x766925, 0x4a001d, 0x9f2f33, 0xa92529, 0xa72628, 0xa82729, 0xa92626, 0xa62528, 0xb32221, 0xdd2523, 0xe32221, 0xe32322, 0xe32322, 0xe22322, 0xe32325, 0xe02726, 0xb62524, 0x9b2423, 0x9c2222, 0x9a2124, 0x992122, 0x962022, 0x922223, 0x5f0d18, 0x262316, 0xe9d766, 0xc2b056, 0x000000, 0xb52d2f, 0xe42123, 0xe7211f, 0xe61f21, 0xe52021, 0xe32023, 0xe42323, 0xbf2425, 0x8e1e21, 0x88121e, 0x870c1e, 0x870c1f, 0x860c1e, 0x860d1e, 0x850e1e, 0x840e1e, 0x830f1d, 0x791921, 0x1c0000, 0x6f622f, 0xf5d847, 0xfadb25, 0xc3b452, 0x0a162b, 0xebeae7, 0xfffffe, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefeff, 0xfdfef9, 0xffffef, 0xf4e2a6, 0xedcb19, 0xf3d300, 0xf4d200, 0xf2d301, 0xeed601, 0xedd600, 0xeed500, 0xeed500, 0xeed500, 0xefd500, 0xf1d500, 0xead300, 0xf6ef99, 0xffffe9, 0xfffefe, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xfafafa, 0xe3e3e3, 0x000000, 
-  0x000000, 0xcdcdcd, 0xfafafa, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefe, 0xececeb, 0x353536, 0x000000, 0x010100, 0x040204, 0x000000, 0x8c8339, 0xeed73c, 0xf3d700, 0xf0d703, 0xf1d801, 0xf2d800, 0xefd500, 0xedde60, 0xfffdd7, 0xfefffa, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfdfefc, 0xffffff, 0xc1c1bd, 0x200b00, 0xe2ca45, 0xf9db2d, 0xbdac4e, 0x1a0000, 0xc02929, 0xe12422, 0xe12422, 0xe22523, 0xe32523, 0xe32421, 0xe02728, 0xb0282a, 0x000000, 0xb5a453, 0xdbc545, 0xccb247, 0x948544, 0x000000, 0x8d1b1e, 0xd12b2d, 0xe12221, 0xe6211f, 0xe4221f, 0xe6201f, 0xe4211c, 0xd82829, 0x820f22, 0x564e24, 0xf0da5f, 0xa69746, 0x430000, 0xca2628, 0xdf2222, 0xe02222, 0xe22222, 0xe32223, 0xe32122, 0xd9282b, 0x8d232b, 0x252112, 0xe1c446, 0xfbdc37, 0xb19d4c, 0x330000, 0xc82a2b, 0xe22223, 0xe12323, 0xe12323, 0xe22424, 0xe32526, 0xda2a2a, 0x922627, 0x000003, 0xc6b75a, 0xe1ce48, 0xd1b946, 0x887938, 0x000000, 0xa42421, 0xdc2724, 0xe22222, 0xe52223, 0xe52323, 0xe42322, 0xe12326, 0xcb292a, 0x500009, 0x857d43, 0xf2da41, 0xf9de36, 0x978f42, 0x958635, 0xf5d62c, 0xf4d841, 0x88793c, 0x450002, 0xcb2a2d, 0xe22022, 0xe42022, 0xe6211f, 0xe4211f, 0xd52a2c, 0x8f1b1b, 0xcf2929, 0xe6201d, 0xe5201f, 0xeb1d20, 0xe6201e, 0xdc2829, 0x952523, 0x1d1716, 0xdac54a, 0xf7da09, 0xf7d519, 0xccb438, 0x413518, 0x000009, 0x00000a, 0x00000c, 0x00000c, 0x140916, 0x000f0d, 0x5d0a0b, 0xd22729, 0xe12321, 0xe22422, 0xe22422, 0xe22422, 0xe42223, 0xdb2a29, 0x7d1e1f, 0x000000, 0x0c1318, 0x001116, 0x00040e, 0x00000e, 0x00000b, 0x08090d, 0xb0a14a, 0xffe656, 0xc1ae52, 0x000000, 0xb52c2e, 0xe42123, 0xe72120, 0xe72022, 0xe42122, 0xe42223, 0xe12526, 0x982122, 0x000000, 0x444126, 0x524924, 0x4e491f, 0x504722, 0x4e471e, 0x4d451c, 0x4a441c, 0x47421e, 0x46401f, 0x5d5124, 0xd1ba4b, 0xfadd26, 0xfadd3f, 0xa19547, 0x5e6167, 0xf9f9f6, 0xfdfffd, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefffe, 0xfdfff9, 0xfefff1, 0xfbf4af, 0xe7d218, 0xeed300, 0xefd300, 0xedd501, 0xedd500, 0xeed401, 0xeed501, 0xeed500, 0xefd500, 0xf0d500, 0xf2d500, 0xead200, 0xf4ec8f, 0xfeffe6, 0xfefefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfd, 0xcfcfcf, 0x000000, 
-  0x000000, 0xc2c2c2, 0xf7f7f7, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe6e6e6, 0x141315, 0x000000, 0x040402, 0x000000, 0x6d642e, 0xe6d243, 0xf1d805, 0xf0d700, 0xf0d700, 0xf0d601, 0xf1d600, 0xefd400, 0xece16e, 0xffffdd, 0xfefefd, 0xfcfdfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefdfc, 0xfdfefb, 0xfffffe, 0xc4c3c1, 0x0e0000, 0xe1c848, 0xfadb2d, 0xc0ae4f, 0x100000, 0xbd2928, 0xe02422, 0xe12323, 0xe12524, 0xe42423, 0xe52323, 0xe22526, 0xae2729, 0x000000, 0xcbb33d, 0xfbdd20, 0xf8d91b, 0xf1d949, 0x958a48, 0x3b0000, 0xc5292b, 0xdf2320, 0xe62121, 0xe7211e, 0xe4211e, 0xe4211d, 0xd92727, 0x941f2a, 0x3d3516, 0xecd25f, 0xad9c48, 0x400000, 0xca2628, 0xe02324, 0xe12322, 0xe22222, 0xe22323, 0xe22222, 0xda272a, 0x8c222a, 0x262213, 0xdfc546, 0xf9db35, 0xb3a14c, 0x2a0000, 0xc52a28, 0xe12223, 0xe12323, 0xe12323, 0xe12323, 0xe32525, 0xdc2b2e, 0x93272a, 0x000002, 0xd9c340, 0xfedf23, 0xfcdc1b, 0xf0d450, 0x70683c, 0x640009, 0xd22b2b, 0xe32124, 0xe42123, 0xe32322, 0xe52221, 0xe02424, 0xd02b29, 0x66001b, 0x6d6531, 0xedd640, 0xfcde2d, 0xa7993e, 0xc1aa38, 0xfadb22, 0xe4cc50, 0x39381f, 0x86161d, 0xd82829, 0xe32021, 0xe52021, 0xe42121, 0xe2221f, 0xc43030, 0x4a0f0f, 0xba2a2d, 0xe72124, 0xe81f1d, 0xeb1e20, 0xe51f1d, 0xe12225, 0xb62e2e, 0x040000, 0xb5a446, 0xf9da26, 0xf9d50c, 0xf8d720, 0xe5cb3d, 0xd9bf46, 0xd4c043, 0xd3be4c, 0xd3be53, 0xd9c66c, 0x8b8253, 0x450000, 0xcd2927, 0xdf2421, 0xe12422, 0xe32322, 0xe32323, 0xe42122, 0xd82a2b, 0x7e1823, 0x2e3526, 0xcbba6e, 0xd9c658, 0xd7c44c, 0xd8c247, 0xd7c345, 0xe0c944, 0xf8dd3c, 0xfce130, 0xc1ae4f, 0x000002, 0xb72d2f, 0xe42223, 0xe72120, 0xe72021, 0xe72124, 0xe72122, 0xdd2625, 0x941d23, 0x262b1b, 0xdbcb63, 0xf0d44b, 0xead342, 0xeacf44, 0xe9cd3e, 0xe7cc3c, 0xe5cb3d, 0xe6cc41, 0xe7cc43, 0xefd33f, 0xfadb2f, 0xf9dd25, 0xdeca54, 0x2c1c00, 0xb0afb2, 0xfffffe, 0xfdfefb, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefffe, 0xfefffa, 0xfefff4, 0xfcf9b4, 0xe9d629, 0xedd300, 0xeed500, 0xeed500, 0xeed500, 0xeed402, 0xeed401, 0xf1d401, 0xf3d402, 0xf1d400, 0xf1d400, 0xead304, 0xe7e090, 0xfdfeeb, 0xfdfefd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfd, 0xe0e0e0, 0x000000, 
-  0x000000, 0xefefef, 0xfbfbfb, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffe, 0xdfdfe0, 0x000000, 0x000000, 0x000000, 0x4f4a23, 0xdac841, 0xf5d912, 0xefd801, 0xf0d600, 0xf0d500, 0xf0d500, 0xf1d500, 0xedd200, 0xefe47c, 0xffffe3, 0xfefefc, 0xfcfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfc, 0xfdfdfc, 0xfffffe, 0xc5c5c2, 0x010000, 0xe0c849, 0xfadc2d, 0xc3b151, 0x0a0000, 0xbb2929, 0xdf2422, 0xe22222, 0xe22423, 0xe42423, 0xe52323, 0xe32627, 0xae272a, 0x000000, 0xc9b23a, 0xfbdc18, 0xf7d70a, 0xf8d71c, 0xc5b247, 0x000002, 0xb52a2c, 0xe02421, 0xe72021, 0xe52120, 0xe6201f, 0xe61f1f, 0xdb2427, 0x9a222e, 0x382f14, 0xebd15c, 0xb2a14a, 0x400000, 0xca2729, 0xdf2323, 0xe02322, 0xe12322, 0xe12323, 0xe22222, 0xda272a, 0x8c232a, 0x262313, 0xdfc547, 0xfadb31, 0xb8a54d, 0x240000, 0xc42929, 0xe12323, 0xe12323, 0xe12323, 0xe22324, 0xe32624, 0xdb2b2b, 0x96272c, 0x000003, 0xddc142, 0xfdde1f, 0xfadb0b, 0xfddc3e, 0x988a49, 0x460000, 0xc92b2c, 0xe12221, 0xe52121, 0xe32223, 0xe32222, 0xe12220, 0xd12c29, 0x65001f, 0x71682d, 0xefd63b, 0xfcdb22, 0xbfa72f, 0xe3c72b, 0xfade2d, 0xc5ae52, 0x000000, 0xb1262c, 0xe22124, 0xe42121, 0xe52020, 0xe52021, 0xe12423, 0xae2e2d, 0x000000, 0x9b2527, 0xe32229, 0xe81e1e, 0xe81e20, 0xe4201d, 0xe51f1f, 0xce2b2b, 0x5e0010, 0x7c7436, 0xf6d63a, 0xfad509, 0xf7d50e, 0xf6dc16, 0xfcd920, 0xf9d91c, 0xf5d819, 0xf7d515, 0xf9db36, 0x958636, 0x410003, 0xcb2a26, 0xdf2421, 0xe12422, 0xe32221, 0xe32322, 0xe22321, 0xd72a2d, 0x801624, 0x3a3c1b, 0xe4cc41, 0xf9d713, 0xfad71a, 0xfbda1e, 0xfcda21, 0xfcd924, 0xfbd713, 0xfcde2b, 0xbfae4e, 0x000003, 0xb82d2f, 0xe42224, 0xe72120, 0xe82022, 0xe81f24, 0xe52220, 0xe12622, 0x9b1a22, 0x2c311e, 0xe5d75c, 0xfade3d, 0xf7da35, 0xf3d72e, 0xf3d42c, 0xefd32b, 0xefd12a, 0xf1d029, 0xf6d422, 0xf8d515, 0xfad814, 0xe0c93d, 0x605916, 0x626268, 0xf0eff0, 0xfffffa, 0xfffefa, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefffd, 0xfdfff4, 0xfefabd, 0xebd836, 0xedd300, 0xefd500, 0xeed500, 0xeed500, 0xeed500, 0xf0d500, 0xf3d401, 0xf4d501, 0xf2d500, 0xf3d81a, 0xd4c432, 0xaaa791, 0xfffff7, 0xfefdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfcfcfc, 0xf7f7f7, 0x000000, 
-  0x000000, 0xdedede, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffc, 0xd1d1d1, 0x000000, 0x000000, 0x262416, 0xd0bd47, 0xf4d91d, 0xf1d700, 0xf2d500, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d500, 0xecd100, 0xf3ea8e, 0xffffea, 0xfffefc, 0xfdfdfd, 0xfdfdfe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfdfdfd, 0xfffffe, 0xc6c7c3, 0x000000, 0xe0c94c, 0xf9dc2b, 0xc4b251, 0x000000, 0xb8292a, 0xdf2524, 0xe32222, 0xe22422, 0xe32423, 0xe52423, 0xe32628, 0xae262b, 0x000000, 0xcbb33a, 0xfbdc18, 0xf9d80a, 0xf7d620, 0xb8a640, 0x000003, 0xb4292c, 0xe02320, 0xe72021, 0xe42221, 0xe62020, 0xe71e1f, 0xdb2427, 0x961e2b, 0x3e3616, 0xedd458, 0xb2a045, 0x3e0000, 0xc82628, 0xde2323, 0xe02322, 0xe12423, 0xe22424, 0xe22322, 0xda272a, 0x8b2229, 0x282415, 0xe0c548, 0xfbdb2e, 0xbaa84b, 0x1d0000, 0xc12929, 0xe02322, 0xe12323, 0xe12323, 0xe22424, 0xe32524, 0xdc292d, 0x98262c, 0x0a0103, 0xddc446, 0xfddd24, 0xfbdb18, 0xf5d74d, 0x6b6132, 0x5f000c, 0xd12a2c, 0xe32121, 0xe42121, 0xe32122, 0xe22222, 0xe2221f, 0xcb2e2b, 0x510017, 0x83772f, 0xf4d732, 0xfbd816, 0xdfbd1c, 0xf4d310, 0xf6dc3a, 0x917f3d, 0x400001, 0xc82a2e, 0xe42022, 0xe42120, 0xe6211f, 0xe61f20, 0xdb2726, 0x942522, 0x000000, 0x791f1e, 0xd72728, 0xe6201d, 0xe51f20, 0xe52120, 0xe81f1d, 0xde2526, 0x911a24, 0x2f3117, 0xe3c940, 0xf9d80c, 0xf0d028, 0xd1ba36, 0xd2b93b, 0xd1b737, 0xdcc02e, 0xf5d313, 0xf8d932, 0x938335, 0x470008, 0xcd2b2b, 0xdf2421, 0xe12422, 0xe32322, 0xe32322, 0xe32224, 0xd72a2a, 0x80171d, 0x433f20, 0xe6ca43, 0xf8d622, 0xe7c842, 0xbfa93a, 0xc0a93c, 0xc8b03e, 0xf3d535, 0xfbdd28, 0xbfab4c, 0x000004, 0xb82d2f, 0xe42224, 0xe72221, 0xe82122, 0xe42221, 0xe52220, 0xe02526, 0x992126, 0x001007, 0x837e43, 0x928237, 0x8e7c2f, 0x887929, 0x847628, 0x807327, 0x827025, 0x806b22, 0xab9632, 0xeed639, 0xf8d91c, 0xccb43b, 0x000000, 0xc6c6c3, 0xfffffe, 0xfefefb, 0xfffefe, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfff6, 0xfefbc9, 0xecdb45, 0xedd300, 0xefd500, 0xeed500, 0xeed500, 0xefd500, 0xf2d401, 0xf5d500, 0xf5d900, 0xf1d900, 0xe8d741, 0x72690d, 0x7c7d82, 0xfefefc, 0xfefefd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe4e4e4, 0x000000, 
-  0x000000, 0xd4d4d4, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xc7c7c2, 0x000000, 0x000004, 0xbaac44, 0xf1db29, 0xf1d500, 0xf0d601, 0xf0d500, 0xf2d400, 0xf1d500, 0xefd501, 0xf0d500, 0xead100, 0xf7ee9b, 0xffffef, 0xfefdfb, 0xfdfcfd, 0xfcfcfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefdfc, 0xfdfdfd, 0xfffffe, 0xc7c8c4, 0x000000, 0xdfc94d, 0xf8db2a, 0xc5b451, 0x000001, 0xb6282a, 0xdf2525, 0xe32222, 0xe32421, 0xe32523, 0xe42423, 0xe32528, 0xae262c, 0x000002, 0xcfb73e, 0xfbde1a, 0xfad814, 0xf3da4d, 0x8b8345, 0x430006, 0xc52a2d, 0xe02221, 0xe52021, 0xe52120, 0xe52020, 0xe61f1f, 0xda2728, 0x8c1324, 0x4e471e, 0xf2d855, 0xb3a141, 0x3c0002, 0xc62728, 0xde2323, 0xe02322, 0xe02322, 0xe02323, 0xe12221, 0xd92629, 0x8b2129, 0x2b2716, 0xe1c649, 0xfada29, 0xbcab4a, 0x160000, 0xbf2929, 0xe02323, 0xe12323, 0xe12323, 0xe12323, 0xe42524, 0xde2a2d, 0x97272b, 0x050508, 0xdbc667, 0xf6dd5d, 0xebcf57, 0xab964d, 0x000000, 0x992123, 0xdf2527, 0xe61f21, 0xe32121, 0xe32121, 0xe32120, 0xe12222, 0xc0302e, 0x290005, 0xa18e3c, 0xf9d72b, 0xf8d409, 0xf0c90b, 0xf9d60b, 0xe8d146, 0x4b4521, 0x7c081c, 0xd92729, 0xe71f1e, 0xe5211f, 0xe5211d, 0xe4201f, 0xd22926, 0x731b16, 0x000000, 0x561513, 0xca282a, 0xe6211f, 0xe42222, 0xe52222, 0xe6211f, 0xe12524, 0xb02c29, 0x000000, 0xbfaf47, 0xf8db20, 0xf0d43a, 0x6b5f2b, 0x000000, 0x000000, 0x817326, 0xf1d228, 0xf6da30, 0x938334, 0x490009, 0xcf2a2c, 0xdf2421, 0xe22423, 0xe32322, 0xe32322, 0xe52224, 0xd92a2d, 0x7f1620, 0x454124, 0xe5cb49, 0xf8d92b, 0xb6a145, 0x000000, 0x000000, 0x413b26, 0xe7d14b, 0xfcdc29, 0xbfa84c, 0x000002, 0xb82d2f, 0xe42223, 0xe72221, 0xe82222, 0xe52222, 0xe52224, 0xdd2825, 0xb52726, 0x771216, 0x6c000c, 0x670013, 0x680017, 0x680016, 0x690015, 0x660013, 0x640015, 0x42000d, 0x000000, 0xc4b148, 0xf7d720, 0xedd347, 0x554a00, 0xa4a6a3, 0xfffffb, 0xfefefe, 0xffffff, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfefefd, 0xfcfff6, 0xfffcd2, 0xeddd52, 0xecd300, 0xefd500, 0xeed500, 0xeed500, 0xf0d501, 0xf3d502, 0xf5d601, 0xf1d700, 0xf1dc39, 0x9d943e, 0x000000, 0x6d6d6d, 0xf8f9f8, 0xfefefd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xe6e6e6, 0x000000, 
-  0x000000, 0xededeb, 0xfdfdfb, 0xfefefd, 0xfefefe, 0xffffff, 0xffffff, 0xfffeff, 0xfffffd, 0xbebeba, 0x000000, 0xa2973f, 0xefd935, 0xefd500, 0xefd600, 0xeed500, 0xefd600, 0xf1d601, 0xf0d501, 0xefd400, 0xf1d400, 0xead115, 0xf8f1a8, 0xfffff0, 0xfefffb, 0xfefdfd, 0xfefdfe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfc, 0xffffff, 0xc8c9c7, 0x000000, 0xdec94e, 0xf8db25, 0xcab550, 0x000002, 0xb62629, 0xdf2625, 0xe42321, 0xe32324, 0xe32424, 0xe42323, 0xe12628, 0xb0282d, 0x000000, 0xbcaa57, 0xe2cb50, 0xd0b748, 0x92833e, 0x000000, 0x8f2627, 0xd0292c, 0xe22121, 0xe5201e, 0xe71f1e, 0xe6211b, 0xe12121, 0xd42a2b, 0x72001d, 0x6d642b, 0xf8dc4e, 0xb39f43, 0x390001, 0xc82628, 0xde2223, 0xe02323, 0xe12323, 0xe12323, 0xe22222, 0xd8282a, 0x8b222a, 0x2f2916, 0xe1c749, 0xfad927, 0xc0ad4b, 0x000000, 0xbb2a29, 0xe12322, 0xe12422, 0xe12422, 0xe12423, 0xe42522, 0xdb2a27, 0x992b2a, 0x000000, 0x685f3d, 0x696437, 0x39371c, 0x000000, 0x821d21, 0xcb2b2d, 0xe42122, 0xe81e21, 0xe32121, 0xe32021, 0xe62021, 0xdc2726, 0xa72e2c, 0x000000, 0xc8b049, 0xfad71c, 0xf9d206, 0xf8d103, 0xfbd817, 0xd2bb47, 0x000000, 0xa42329, 0xe22425, 0xe8201f, 0xe42121, 0xe82020, 0xe22121, 0xc2292c, 0x490d0e, 0x1e2724, 0x310508, 0xb62626, 0xe22221, 0xe42222, 0xe42222, 0xe32221, 0xe12321, 0xc62f2d, 0x3f0002, 0x8f843e, 0xf4da3a, 0xf7da2d, 0x9d8e34, 0x313647, 0x65676e, 0x706212, 0xf0d12b, 0xf8d830, 0x918335, 0x4b0006, 0xce2a29, 0xdf2321, 0xe22523, 0xe22422, 0xe22423, 0xe42223, 0xd82a2d, 0x7e1522, 0x444221, 0xe6cb45, 0xf7d729, 0xad9b3c, 0x1a2339, 0x767679, 0x403b1a, 0xe7d04f, 0xfcdc26, 0xbfa84b, 0x000002, 0xb62f30, 0xe22223, 0xe92221, 0xe72222, 0xe52324, 0xe42224, 0xe02423, 0xdd2627, 0xd7282a, 0xd22928, 0xd12929, 0xd32a2b, 0xd4292a, 0xd62a29, 0xd52b27, 0xd22d29, 0xbb3434, 0x3f000f, 0x948537, 0xf7d730, 0xf6d83d, 0x877a27, 0x818285, 0xfdfdfb, 0xfefefd, 0xfefffe, 0xfefefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfdfefb, 0xfcfef8, 0xfffed8, 0xeee062, 0xedd200, 0xf1d400, 0xf0d400, 0xf1d500, 0xf5d501, 0xf4d601, 0xf5d600, 0xf4da33, 0xb5a949, 0x000000, 0x000000, 0x5c5b5c, 0xf3f3f3, 0xfefffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfc, 0xf2f2f1, 0x000000, 
-  0x000000, 0xfcfcfc, 0xfcfcfa, 0xfefefd, 0xfefefe, 0xffffff, 0xffffff, 0xfffffe, 0xfffffb, 0xabacae, 0x847700, 0xebd637, 0xefd500, 0xeed401, 0xeed500, 0xeed500, 0xefd500, 0xf1d601, 0xf0d502, 0xf0d400, 0xf1d400, 0xead328, 0xfaf5b3, 0xfffff2, 0xfdfefa, 0xfefdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfb, 0xffffff, 0xc9cac8, 0x000000, 0xddc94e, 0xf9dc23, 0xcdb650, 0x000003, 0xb52527, 0xe02625, 0xe42321, 0xe32325, 0xe32424, 0xe62222, 0xe12626, 0xad2725, 0x000000, 0x131c13, 0x141812, 0x000004, 0x3e0007, 0x962224, 0xcb2e30, 0xde2326, 0xe5211f, 0xe3221d, 0xe32121, 0xe1221f, 0xe22121, 0xc22d2d, 0x390005, 0x9c8a3f, 0xfddf47, 0xb29e42, 0x360000, 0xc72728, 0xde2323, 0xe02323, 0xe12323, 0xe12323, 0xe22222, 0xd7282a, 0x8a2129, 0x302a17, 0xe1c748, 0xfbd926, 0xc2ae4c, 0x000000, 0xb82a28, 0xe12322, 0xe12422, 0xe12422, 0xe22523, 0xe42424, 0xe02629, 0xb62b2b, 0x6b181a, 0x620017, 0x70001d, 0x8b1925, 0xaf282c, 0xd02a2b, 0xe12222, 0xe71f20, 0xe8201e, 0xe4221e, 0xe4211f, 0xdf221c, 0xcd2f2f, 0x6c071b, 0x474323, 0xe9ce46, 0xf9d503, 0xfbd108, 0xf9d300, 0xfada29, 0xaa963d, 0x1d0000, 0xbe282a, 0xe52122, 0xea1e21, 0xe72022, 0xe72122, 0xdd2424, 0xa5292a, 0x120a06, 0xa29f86, 0x282920, 0x9b1f20, 0xdf2426, 0xe52222, 0xe32322, 0xe32322, 0xe32220, 0xd92b2a, 0x801020, 0x494524, 0xe8ce4e, 0xf6da1d, 0xc7b43c, 0x292b37, 0x5a5d61, 0x76691d, 0xf1d12b, 0xf8d831, 0x908336, 0x4b0005, 0xcd2a28, 0xdf2321, 0xe22523, 0xe12422, 0xe22523, 0xe42323, 0xd72a2c, 0x7c1221, 0x454320, 0xe6cb45, 0xf7d62a, 0xad9c3b, 0x353847, 0x949395, 0x39350c, 0xe7cf50, 0xfcdd24, 0xbea749, 0x000002, 0xb53030, 0xe12223, 0xe82120, 0xe62222, 0xe42425, 0xe22323, 0xe12323, 0xe12425, 0xe12425, 0xe12324, 0xe12423, 0xe22323, 0xe42323, 0xe52322, 0xe5221f, 0xe32220, 0xce2d2f, 0x560018, 0x84792e, 0xf7d733, 0xf9d835, 0x9b8c36, 0x707278, 0xfdfdfb, 0xfefefd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfdfefc, 0xfbfdfa, 0xfffedc, 0xf0e46d, 0xedd200, 0xf3d400, 0xf2d400, 0xf3d600, 0xf5d501, 0xf4d700, 0xf1db25, 0xc5b74a, 0x0d0613, 0x000000, 0x000000, 0x4c4c4c, 0xf3f3f3, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfdfb, 0xf7f7f5, 0xa2a2a2, 
-  0x000000, 0xe9e9e8, 0xfefefc, 0xfefefd, 0xffffff, 0xffffff, 0xfeffff, 0xfefdff, 0xfefcf2, 0xc5c095, 0xdfc929, 0xf3d800, 0xefd500, 0xefd400, 0xeed300, 0xefd401, 0xefd401, 0xf0d500, 0xf1d401, 0xf2d400, 0xf1d400, 0xebd538, 0xfcf8bd, 0xfffff6, 0xfdfefa, 0xfefdfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfc, 0xffffff, 0xc9cbc8, 0x000000, 0xddc94e, 0xf9dc22, 0xceb750, 0x000003, 0xb32527, 0xdf2525, 0xe42220, 0xe42324, 0xe32424, 0xe42520, 0xe32329, 0xcb2527, 0x9c2123, 0x9b1f28, 0xa3212b, 0xb52727, 0xc92b2c, 0xd9292b, 0xe22225, 0xe72122, 0xe7211f, 0xe5211f, 0xe42021, 0xe22220, 0xd92826, 0x952526, 0x000000, 0xcdb348, 0xfddf39, 0xaf9c3f, 0x360000, 0xc62829, 0xde2324, 0xe02222, 0xe12323, 0xe12323, 0xe12222, 0xd7292b, 0x882128, 0x312c18, 0xe1c849, 0xf9d926, 0xc2af4c, 0x000000, 0xb82928, 0xe12322, 0xe12422, 0xe12422, 0xe22523, 0xe22524, 0xe32424, 0xdd2524, 0xd1292b, 0xd32b30, 0xd52a2e, 0xdd272b, 0xe22324, 0xe42222, 0xe72122, 0xe71f1f, 0xe8201c, 0xe8201e, 0xe62020, 0xdd2829, 0x9e2c2b, 0x000000, 0xab9b47, 0xf8db33, 0xf9d500, 0xf8d106, 0xf8d400, 0xf0d73b, 0x6d622a, 0x670018, 0xd32827, 0xe4211f, 0xe91f21, 0xe72122, 0xe62221, 0xd92527, 0x881b23, 0x2e3622, 0xdcd792, 0x5b5c35, 0x790017, 0xdb2726, 0xe42322, 0xe32322, 0xe42222, 0xe42221, 0xe02624, 0xa8292a, 0x000000, 0xcdb451, 0xf7da20, 0xe6ce3a, 0x544d21, 0x000000, 0x7e702c, 0xf1d22d, 0xf7d830, 0x8e8235, 0x4a0005, 0xcc2a28, 0xdf2321, 0xe12422, 0xe12422, 0xe22523, 0xe42323, 0xd62a2c, 0x7c1221, 0x464421, 0xe5cb45, 0xf7d72a, 0xad9d3c, 0x323645, 0x919193, 0x39350d, 0xe7d050, 0xfbdc24, 0xbda548, 0x000002, 0xb53030, 0xe12223, 0xe72120, 0xe52322, 0xe22424, 0xe12424, 0xe12323, 0xe32325, 0xe32324, 0xe42323, 0xe32423, 0xe42322, 0xe62322, 0xe52220, 0xe6211d, 0xe5211e, 0xd02c2b, 0x580015, 0x84782e, 0xf9d832, 0xfad831, 0x9e8c31, 0x6e7177, 0xfcfcfa, 0xfefefc, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefd, 0xfdfefd, 0xfdfdfd, 0xffffe3, 0xf1e678, 0xecd200, 0xf3d300, 0xf3d400, 0xf3d501, 0xf3d500, 0xf6da1c, 0xd3c14c, 0x393720, 0x000000, 0x020201, 0x000000, 0x383838, 0xebebeb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefc, 0xeeeeec, 0x7f7f7f, 
-  0x000000, 0xe2e2e1, 0xfffffd, 0xfefefd, 0xffffff, 0xffffff, 0xfefdfe, 0xfdfdfb, 0xfefbe4, 0xf0e284, 0xedd400, 0xf0d500, 0xf0d500, 0xeed300, 0xeed300, 0xefd401, 0xf0d500, 0xf1d400, 0xf3d300, 0xf2d400, 0xf0d300, 0xebd640, 0xfdfac2, 0xfefff6, 0xfefffa, 0xfefdfd, 0xfefdfe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefdfc, 0xffffff, 0xcacbc9, 0x000000, 0xdbc94e, 0xf9db21, 0xceb64f, 0x000004, 0xb12426, 0xe02525, 0xe52220, 0xe52325, 0xe42425, 0xe22522, 0xe52225, 0xe52226, 0xe32624, 0xe42623, 0xe22523, 0xe42422, 0xe82321, 0xe92122, 0xe82221, 0xe62220, 0xe62120, 0xe72020, 0xe42020, 0xdb2625, 0xb4302f, 0x3a0002, 0x665a2d, 0xeed144, 0xfada2c, 0xac993d, 0x390000, 0xc6282a, 0xdf2324, 0xe02323, 0xe12323, 0xe12323, 0xe12222, 0xd7292a, 0x882128, 0x332e19, 0xe1ca4a, 0xf8d926, 0xc1af4b, 0x000000, 0xb72827, 0xe02322, 0xe12422, 0xe22523, 0xe22523, 0xe22523, 0xe42322, 0xe52321, 0xe52320, 0xe62122, 0xe82120, 0xe92221, 0xe62322, 0xe52223, 0xe82124, 0xe62020, 0xe6201e, 0xe22020, 0xd62827, 0xb32f2d, 0x2e0000, 0x564e2a, 0xead54e, 0xfadb11, 0xf0d112, 0xf3d108, 0xf7d714, 0xd7c349, 0x130e0f, 0x9b2124, 0xde2624, 0xe72024, 0xe7211f, 0xe62121, 0xe62020, 0xce2b2c, 0x620010, 0x6a6942, 0xf6f082, 0x928b48, 0x4d0000, 0xcf2927, 0xe32422, 0xe32322, 0xe42222, 0xe42122, 0xe22222, 0xc52e2e, 0x320000, 0x9a8946, 0xf5d93f, 0xf3d92a, 0x9a8c37, 0x000000, 0x83762d, 0xf2d32c, 0xf6d930, 0x8e8235, 0x4a0006, 0xcc2a28, 0xdf2320, 0xe12422, 0xe12422, 0xe22523, 0xe42422, 0xd72a2c, 0x7d1423, 0x474421, 0xe5cb45, 0xf7d72b, 0xac9e3c, 0x323746, 0x939395, 0x37340a, 0xe5d14f, 0xfadc24, 0xbda548, 0x000002, 0xb5302f, 0xe12324, 0xe82120, 0xe52323, 0xe32325, 0xe32424, 0xe32323, 0xe32224, 0xe22324, 0xe12322, 0xe12422, 0xe22422, 0xe42322, 0xe42321, 0xe6221d, 0xe3201c, 0xcc2d29, 0x530013, 0x897d31, 0xf9da32, 0xf9d932, 0x97862c, 0x707278, 0xfcfcfa, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfefefc, 0xfefefe, 0xffffe7, 0xf1e97f, 0xecd200, 0xf4d300, 0xf4d400, 0xf3d500, 0xf2d802, 0xe1cf4f, 0x655b34, 0x000000, 0x040404, 0x000000, 0x000000, 0x252525, 0xe5e5e5, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefc, 0xf0f0ef, 0x9d9d9d, 
-  0x000000, 0xeaeaea, 0xfffffd, 0xfefefd, 0xffffff, 0xfefefe, 0xfefefe, 0xfcfefd, 0xfcfddf, 0xf0df6d, 0xecd300, 0xf1d300, 0xf0d300, 0xeed301, 0xedd201, 0xefd301, 0xf0d400, 0xf1d400, 0xf3d400, 0xf2d300, 0xf0d300, 0xebd745, 0xfcfbc6, 0xfefff7, 0xfefefb, 0xfefefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfc, 0xffffff, 0xcbccca, 0x000000, 0xdcc94f, 0xf8db1f, 0xd0b84f, 0x000005, 0xb12527, 0xe02525, 0xe52221, 0xe32324, 0xe32323, 0xe52224, 0xe52221, 0xe42320, 0xe42220, 0xe42321, 0xe52121, 0xe72323, 0xea2320, 0xe9221f, 0xe92220, 0xe62220, 0xe72121, 0xe32121, 0xd92724, 0xbe2d2e, 0x67121b, 0x000000, 0xcdb455, 0xf6d72c, 0xf7d628, 0xa9963c, 0x3a0001, 0xc6282a, 0xdf2323, 0xe02322, 0xe12222, 0xe12223, 0xe12221, 0xd7292a, 0x89222a, 0x342f1a, 0xe2ca4b, 0xf9d925, 0xc4b14c, 0x000000, 0xb62827, 0xe02323, 0xe12422, 0xe12422, 0xe22423, 0xe42423, 0xe42224, 0xe42224, 0xe52122, 0xe72023, 0xe62121, 0xe82123, 0xe62123, 0xe42320, 0xe6221f, 0xe62121, 0xe12220, 0xd32627, 0xa62e2b, 0x3e0000, 0x1a1f18, 0xd2bf54, 0xf7e12c, 0xf4d828, 0xd6b825, 0xf2d515, 0xf8dc30, 0xad9e43, 0x180000, 0xbd2829, 0xe32221, 0xea1e23, 0xe7211f, 0xe6201f, 0xe5201e, 0xbe302e, 0x2f0000, 0x8b855f, 0xeee58a, 0xa89b62, 0x090000, 0xbf292b, 0xe02322, 0xe32221, 0xe42121, 0xe52021, 0xe61f1f, 0xd7292a, 0x72041a, 0x4f4a2b, 0xe8d04f, 0xf7d915, 0xcdba45, 0x000000, 0x8b7e31, 0xf3d52c, 0xf7d931, 0x8f8336, 0x4a0005, 0xcc2928, 0xdf2321, 0xe12422, 0xe12422, 0xe22523, 0xe42322, 0xd72a2d, 0x7d1424, 0x474421, 0xe5cc45, 0xf7d72b, 0xae9f3e, 0x353947, 0x969798, 0x353308, 0xe6d250, 0xfadc23, 0xbda647, 0x000002, 0xb53030, 0xe02423, 0xe72120, 0xe52322, 0xe32324, 0xe52224, 0xe12223, 0xe12326, 0xe02425, 0xdf2323, 0xdf2423, 0xe12325, 0xe12325, 0xe12422, 0xe2231f, 0xdf211c, 0xc7302c, 0x4f0012, 0x918538, 0xf9dc33, 0xf7d933, 0x8b7e23, 0x73757a, 0xfcfcfb, 0xfffffd, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfefefb, 0xfefefd, 0xfeffe8, 0xf3ea85, 0xedd300, 0xf5d400, 0xf5d300, 0xf3d500, 0xead545, 0x837c3e, 0x000000, 0x040303, 0x010201, 0x000000, 0x000000, 0x090909, 0xe1e1e1, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xf3f3f2, 0xb8b8be, 
-  0x000000, 0xf3f3f3, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefeff, 0xfdfefd, 0xfefddb, 0xecdd60, 0xecd000, 0xf1d101, 0xefd300, 0xeed300, 0xefd200, 0xf2d401, 0xf2d401, 0xf0d501, 0xf2d401, 0xf1d400, 0xf0d400, 0xebd84c, 0xfdfccf, 0xfefef7, 0xfefefc, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfc, 0xffffff, 0xcaccc9, 0x000000, 0xdbc84d, 0xf8da1e, 0xcfb74e, 0x000005, 0xaf2427, 0xdf2526, 0xe52122, 0xe22424, 0xe22422, 0xe52322, 0xe52323, 0xe52222, 0xe72022, 0xe62122, 0xe62121, 0xe6231f, 0xe6241f, 0xe62320, 0xe6231f, 0xe12323, 0xe12421, 0xd72825, 0xb82d2e, 0x6a151c, 0x000000, 0xae9b4e, 0xf6d944, 0xf4d208, 0xf7d624, 0xa9973a, 0x3a0002, 0xc62929, 0xdf2322, 0xe12422, 0xe32322, 0xe12323, 0xe02222, 0xd7292b, 0x882229, 0x332e19, 0xe2c84a, 0xf9d922, 0xc5b14a, 0x000000, 0xb52828, 0xe02323, 0xe12422, 0xe12422, 0xe32423, 0xe52423, 0xe42324, 0xe42323, 0xe52221, 0xe52121, 0xe62220, 0xe62222, 0xe52323, 0xe52322, 0xe72223, 0xe52322, 0xdf2526, 0xaf2123, 0x060000, 0x575330, 0xd4c458, 0xf9e23c, 0xf8dd29, 0xc9b844, 0xbaa02e, 0xf8dc14, 0xf1d940, 0x6f6531, 0x610015, 0xd0272d, 0xe5201e, 0xe92020, 0xe82022, 0xe61f20, 0xdf2320, 0xad2928, 0x130000, 0x1b231a, 0x3c352a, 0x2e2920, 0x000000, 0xab2325, 0xdf2524, 0xe42122, 0xe42020, 0xe52020, 0xe71e1e, 0xdf2525, 0x9c2425, 0x000000, 0xcab54b, 0xf9d81b, 0xead348, 0x504927, 0x8c7d31, 0xf3d62c, 0xf7d930, 0x908436, 0x4a0004, 0xcc2927, 0xe12321, 0xe32322, 0xe12422, 0xe32423, 0xe42321, 0xd62a2c, 0x7c1423, 0x484421, 0xe6cb45, 0xf7d72a, 0xb09f3e, 0x363948, 0x979798, 0x36330a, 0xe7d251, 0xfadd22, 0xbda647, 0x000003, 0xb4312f, 0xe12423, 0xe6211f, 0xe52221, 0xe42222, 0xe52022, 0xde2425, 0xce272a, 0xb42828, 0xb02929, 0xb12927, 0xb42928, 0xb42b26, 0xb62a29, 0xb82a2b, 0xb62b29, 0x9f3130, 0x1b0003, 0xae9d42, 0xfbdb2b, 0xf3d737, 0x6f6500, 0x8b8c8f, 0xfefefd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfefffb, 0xfefdfb, 0xffffe7, 0xf5eb89, 0xefd300, 0xf3d401, 0xf2d300, 0xecd73a, 0xa19544, 0x000000, 0x010002, 0x000100, 0x000001, 0x010101, 0x000000, 0x000000, 0xdedede, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefc, 0xf6f6f5, 0xd4d4d4, 
-  0xcccccc, 0xf8f8f8, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefd, 0xfefdda, 0xebdc5f, 0xebcf00, 0xf1d101, 0xf0d200, 0xf0d200, 0xf1d200, 0xf3d400, 0xf3d401, 0xf0d501, 0xf2d401, 0xf1d400, 0xefd400, 0xebd84d, 0xfdfcd1, 0xfefff6, 0xfefefb, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xffffff, 0xcaccc9, 0x000000, 0xdbc94b, 0xf8db1c, 0xcfb84e, 0x000006, 0xaf2428, 0xde2426, 0xe52122, 0xe22424, 0xe22422, 0xe52322, 0xe52421, 0xe22421, 0xe22422, 0xe32221, 0xe22320, 0xe42320, 0xe42321, 0xe52424, 0xe02823, 0xd82a2c, 0xc62d30, 0x982727, 0x46000d, 0x00000b, 0xb09e4f, 0xf3d846, 0xf7d612, 0xf4d306, 0xf6d720, 0xa99836, 0x390003, 0xc62a2b, 0xe02322, 0xe12422, 0xe32322, 0xe12323, 0xe12322, 0xd8292b, 0x872229, 0x322e19, 0xe2c84a, 0xf9da23, 0xc5b24b, 0x000000, 0xb32827, 0xe02423, 0xe12422, 0xe12422, 0xe22422, 0xe22624, 0xe12524, 0xe02728, 0xd52a2b, 0xd42b2b, 0xd92929, 0xe22423, 0xe62321, 0xe42322, 0xe52323, 0xe42323, 0xe32323, 0xbc302f, 0x280000, 0x948b4f, 0xfae34b, 0xfae000, 0xf2d740, 0x786a33, 0xd8c130, 0xfbdd17, 0xdcc24a, 0x180d0e, 0x922026, 0xda262b, 0xe71f1e, 0xe72121, 0xe72022, 0xe51f22, 0xdf2224, 0xc72226, 0xa12023, 0xa02128, 0xa11f29, 0xa42224, 0xa22621, 0xc62325, 0xe02323, 0xe42223, 0xe32020, 0xe5201f, 0xe81f1e, 0xe62023, 0xc02926, 0x0b0000, 0x998b3f, 0xf7d933, 0xf6da35, 0x98873b, 0x887c2b, 0xf4d728, 0xf8db30, 0x918537, 0x480003, 0xcc2927, 0xe12321, 0xe32322, 0xe02422, 0xe22423, 0xe42321, 0xd62a2c, 0x7c1523, 0x474320, 0xe6cc44, 0xf7d82a, 0xb0a03d, 0x343846, 0x959596, 0x37340c, 0xe6d14f, 0xfbdd22, 0xbda647, 0x000003, 0xb53030, 0xe12323, 0xe6201f, 0xe52120, 0xe62122, 0xe42120, 0xdd2525, 0x9e1e21, 0x230000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x44381c, 0xe2c642, 0xfdd710, 0xe3cb3e, 0x2d2400, 0xbfbfbe, 0xfffffe, 0xfdfdfc, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfdfffb, 0xfefdfa, 0xfeffe8, 0xf5ec8d, 0xecd500, 0xf2d500, 0xedd832, 0xaea747, 0x000000, 0x000002, 0x030402, 0x000002, 0x000001, 0x010101, 0x000000, 0x000000, 0xdcdcdc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefc, 0xf9f9f8, 0xe4e4e4, 
-  0xffffff, 0xfbfbfb, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefdd9, 0xeadb5e, 0xecd000, 0xf0d000, 0xefd200, 0xf0d300, 0xf1d300, 0xf1d300, 0xf2d401, 0xf0d501, 0xf2d501, 0xf1d400, 0xefd400, 0xecd94f, 0xfcfcd1, 0xfefff5, 0xfefffa, 0xfefffd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefdfc, 0xffffff, 0xcaccc9, 0x000000, 0xdcc94c, 0xf7db1b, 0xceb74c, 0x000006, 0xae2227, 0xdf2426, 0xe52122, 0xe32424, 0xe32422, 0xe42323, 0xe62324, 0xdd2523, 0xd42b29, 0xd32d2f, 0xd22d31, 0xcf2f31, 0xc62e2f, 0xbd2c2e, 0xaa2b2f, 0x891d22, 0x4c000c, 0x000000, 0x716433, 0xd2bc49, 0xf7d83c, 0xfad417, 0xf6d526, 0xf2d20e, 0xf6d820, 0xa79735, 0x380002, 0xc62a2b, 0xe02422, 0xe12422, 0xe32322, 0xe12323, 0xe12323, 0xd82a2b, 0x872229, 0x332e19, 0xe2c84a, 0xf9da23, 0xc5b34c, 0x000000, 0xb42727, 0xe12324, 0xe22322, 0xe12322, 0xe02322, 0xe22523, 0xe02826, 0xc32b2c, 0x791a1c, 0x67090e, 0x8f2121, 0xcd2c28, 0xe42322, 0xe52323, 0xe52422, 0xe52320, 0xe2251f, 0xd72c2c, 0x94282d, 0x201c12, 0xdac851, 0xf9e11e, 0xf2d82e, 0xbfa72d, 0xefd21e, 0xfada2d, 0xb29d47, 0x030000, 0xb9292a, 0xe12426, 0xe61f1f, 0xe52122, 0xe62120, 0xe72020, 0xe42020, 0xe32023, 0xe12223, 0xe22222, 0xe02125, 0xe32123, 0xdf2222, 0xe12125, 0xe22122, 0xe42022, 0xe22121, 0xe51f20, 0xe61f1e, 0xe71f20, 0xd52925, 0x660011, 0x585429, 0xecd343, 0xfadd1d, 0xc7ae3d, 0x907f32, 0xf5d729, 0xf8db2f, 0x8f8636, 0x470003, 0xcb2927, 0xe02220, 0xe32322, 0xe02422, 0xe22422, 0xe42221, 0xd62a2c, 0x7c1322, 0x474321, 0xe5cc43, 0xf6d928, 0xae9f3b, 0x323645, 0x939495, 0x38350c, 0xe6d24e, 0xfbde22, 0xbea748, 0x000004, 0xb53031, 0xe22324, 0xe71f1f, 0xe62121, 0xe42222, 0xe42120, 0xe12424, 0x941920, 0x14231a, 0xbaaa65, 0xcbb450, 0xc6b149, 0xc8af48, 0xc9b044, 0xcab042, 0xc8b145, 0xc8b142, 0xdfc33e, 0xf8d720, 0xfcd71f, 0xbaa538, 0x000000, 0xc0c1bd, 0xfffffb, 0xfdfdfb, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfdfffb, 0xfdfdfa, 0xfdffeb, 0xf5ec92, 0xebd500, 0xf4dd27, 0xc4b649, 0x00000f, 0x000000, 0x010300, 0x000104, 0x000004, 0x010100, 0x010101, 0x000000, 0x000000, 0xdbdbdb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefc, 0xfbfbf9, 0xefefef, 
-  0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfdfc, 0xfefdd9, 0xe8d95c, 0xecd000, 0xf0d001, 0xefd401, 0xeed500, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d501, 0xf2d500, 0xf2d500, 0xf0d500, 0xedda52, 0xfcfcd2, 0xfefff4, 0xfefff9, 0xfdfefd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfc, 0xffffff, 0xcacbc9, 0x000000, 0xdbca4d, 0xf7db1c, 0xcdb74d, 0x000006, 0xaf2327, 0xdf2426, 0xe52122, 0xe32323, 0xe42422, 0xe62322, 0xe42427, 0xc3292b, 0x7d191a, 0x6a0015, 0x620012, 0x590012, 0x45000d, 0x1f0000, 0x000000, 0x312a18, 0x837533, 0xc8b048, 0xf2d147, 0xfad822, 0xf8d722, 0xe8cc46, 0xad9736, 0xe9cb23, 0xf8d925, 0xa89638, 0x370001, 0xc62a2a, 0xdf2322, 0xe12422, 0xe32322, 0xe22424, 0xe22423, 0xd82a2b, 0x882229, 0x332e1a, 0xe3ca4b, 0xf9db23, 0xc6b44d, 0x000000, 0xb42727, 0xe22324, 0xe32223, 0xe12323, 0xe12323, 0xe32324, 0xdf2728, 0xa82b2a, 0x000000, 0x3a3737, 0x190000, 0xa92d28, 0xe02624, 0xe52223, 0xe52420, 0xe22522, 0xe12522, 0xde2725, 0xc9312f, 0x500004, 0x867d3e, 0xf6dc47, 0xf8dd06, 0xf1d117, 0xf4d500, 0xf2d847, 0x776937, 0x5f000e, 0xcf2829, 0xe02420, 0xe52021, 0xe32121, 0xe42020, 0xe51f21, 0xe52020, 0xe4211f, 0xe4201f, 0xe61f1f, 0xe91e1d, 0xe71e1e, 0xe61f1f, 0xe61f1f, 0xe61f22, 0xe51f21, 0xe32121, 0xe71f21, 0xe91e21, 0xe81f1f, 0xde2624, 0x9a2525, 0x000005, 0xd2be4a, 0xf8dd20, 0xe6cb37, 0xa18a32, 0xf5d425, 0xf7db2e, 0x8e8635, 0x460003, 0xca2927, 0xe02220, 0xe32322, 0xe12422, 0xe22422, 0xe32221, 0xd62a2c, 0x7c1423, 0x484321, 0xe5cc43, 0xf6da28, 0xae9f3a, 0x323745, 0x929494, 0x373409, 0xe6d24d, 0xfbde22, 0xbea748, 0x000004, 0xb63032, 0xe22224, 0xe71f20, 0xe62121, 0xe32222, 0xe61f23, 0xe02523, 0x93171d, 0x222b1f, 0xe7d662, 0xffe128, 0xfbde24, 0xfbdc1e, 0xfadb1c, 0xf9dd18, 0xfdda1c, 0xf7dc1b, 0xf9d80d, 0xf6d509, 0xf5d509, 0xe3c63a, 0x877830, 0x1e2530, 0xe1e1dd, 0xfffffe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffc, 0xfefffa, 0xfefefb, 0xfeffed, 0xf4ed97, 0xecdc2c, 0xdacc57, 0x3f3b1f, 0x000000, 0x040203, 0x010200, 0x010103, 0x010201, 0x010103, 0x000001, 0x000000, 0x000000, 0xdbdbdb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefc, 0xfcfcfa, 0xefefef, 
-  0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfefd, 0xfefdd8, 0xe8d95e, 0xebcf00, 0xf0d001, 0xefd300, 0xeed400, 0xf0d500, 0xf0d500, 0xf1d401, 0xf2d501, 0xeed701, 0xf3d400, 0xf5d100, 0xe8c953, 0xfafad5, 0xfefff6, 0xfefff8, 0xfdfefe, 0xfdfdfe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefb, 0xfffffe, 0xcacac7, 0x000000, 0xdcc94d, 0xf7da1c, 0xcfb84d, 0x000006, 0xb02327, 0xdf2424, 0xe52220, 0xe42323, 0xe42322, 0xe72320, 0xe02626, 0xb52e2f, 0x0a0000, 0x5d593d, 0x827a41, 0x81793a, 0x8d8035, 0xa4933c, 0xc2af42, 0xe2c849, 0xf6d63a, 0xf9d81b, 0xf8d615, 0xf4d53b, 0xd0bf4a, 0x685f27, 0x4e441e, 0xebce35, 0xf8d927, 0xa7973e, 0x350000, 0xc72929, 0xde2522, 0xe02422, 0xe22523, 0xe32624, 0xe22423, 0xd72a2c, 0x8a222c, 0x312e19, 0xe5c84a, 0xf9d923, 0xc7b549, 0x000000, 0xb32727, 0xe12324, 0xe22323, 0xe12323, 0xe22423, 0xe22523, 0xdf272b, 0xa9292a, 0x000000, 0xb4a98d, 0x585746, 0x761011, 0xd42e28, 0xe42425, 0xe52522, 0xe12523, 0xe22624, 0xe02523, 0xde2826, 0xa62a2a, 0x000005, 0xcfb854, 0xf9df25, 0xf9d604, 0xf7d609, 0xddc44f, 0x221f19, 0x911a23, 0xdb2625, 0xe12421, 0xe42423, 0xe42423, 0xe42322, 0xe52023, 0xe72023, 0xe5221f, 0xe61f1e, 0xe61e20, 0xe81e20, 0xe71e21, 0xe61e21, 0xe61f20, 0xe61e1e, 0xe61f1f, 0xe42021, 0xe81f1f, 0xe91f1c, 0xe72020, 0xe4231e, 0xb82f2c, 0x000000, 0xa89a46, 0xf8dd31, 0xf5d926, 0xcaab2d, 0xf4d117, 0xf6db31, 0x928739, 0x440001, 0xcd2827, 0xe12221, 0xe32221, 0xe32322, 0xe32322, 0xe22120, 0xd52a2b, 0x7c1323, 0x494420, 0xe6cd41, 0xf6da27, 0xaea03a, 0x343946, 0x929393, 0x393605, 0xe8d34a, 0xfcde21, 0xbfa847, 0x000005, 0xb63031, 0xe22223, 0xe72022, 0xe42120, 0xe52121, 0xe71f22, 0xde2623, 0x95191f, 0x021a19, 0xd6ca72, 0xf2d951, 0xf2d44b, 0xeed546, 0xedd446, 0xebd342, 0xedd141, 0xe7d140, 0xe6ce46, 0xe6cf45, 0xf1d738, 0xf3d213, 0xe8cb46, 0x695c0a, 0x7d7f7f, 0xfdfbf8, 0xfdfdfe, 0xfefefc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffc, 0xfefefd, 0xfdfef9, 0xfcfded, 0xf2f0a1, 0xe2dc6d, 0x736d3e, 0x000000, 0x030402, 0x020104, 0x010101, 0x020201, 0x010201, 0x010102, 0x010102, 0x000000, 0x000000, 0xdbdbdb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfcfcfc, 0xf4f4f4, 
-  0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefd, 0xfffdda, 0xe9da62, 0xeace00, 0xf1d101, 0xefd301, 0xeed400, 0xf0d500, 0xf0d500, 0xefd501, 0xf1d402, 0xf5d203, 0xf6d404, 0xf0b70a, 0xbd8455, 0xfaf5e3, 0xfcfff9, 0xfefefa, 0xfefefa, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefe, 0xfcfefb, 0xfffffe, 0xcacac7, 0x000000, 0xdcc84c, 0xf7da1c, 0xcfb84c, 0x000005, 0xb02328, 0xe02525, 0xe52220, 0xe42223, 0xe42322, 0xe62226, 0xe02525, 0xb72d2f, 0x000000, 0xb7a857, 0xf3dd4c, 0xf3d93d, 0xf9db35, 0xf8db2d, 0xfbdb23, 0xfbd919, 0xf8da24, 0xefd63f, 0xd5c146, 0x90832e, 0x000000, 0x081731, 0x5a4e20, 0xeace38, 0xf8da28, 0xa89840, 0x350000, 0xc62828, 0xde2421, 0xe02422, 0xe12422, 0xe22523, 0xe22422, 0xd62a2b, 0x8b222b, 0x2d2c17, 0xe3c747, 0xf9d923, 0xc7b446, 0x000000, 0xb22728, 0xe02323, 0xe12323, 0xe12323, 0xe22523, 0xe22624, 0xde272a, 0xaa2928, 0x000000, 0xc7bc74, 0xaba365, 0x000000, 0xb62f2c, 0xe12625, 0xe32424, 0xe22523, 0xe22523, 0xe02623, 0xe02522, 0xcf322f, 0x5f0015, 0x685c32, 0xecd651, 0xf7da0a, 0xf6db29, 0xb5a547, 0x000000, 0xb5282a, 0xe12422, 0xe22422, 0xe32322, 0xe32322, 0xe32321, 0xe22221, 0xe52122, 0xe52120, 0xe52022, 0xe62020, 0xe6211f, 0xe6201f, 0xe52020, 0xe22122, 0xe22122, 0xe61f20, 0xe61f1f, 0xe5211f, 0xe6201c, 0xe71f20, 0xe61f1a, 0xca302d, 0x590014, 0x6d6732, 0xf0d742, 0xf8da0d, 0xf0d018, 0xf4d103, 0xf5db30, 0x938738, 0x430003, 0xce2828, 0xe22220, 0xe32121, 0xe42222, 0xe22221, 0xe32020, 0xd5292a, 0x7b1323, 0x49451f, 0xe6cd3f, 0xf6d926, 0xad9f39, 0x333745, 0x919292, 0x3b3804, 0xe8d347, 0xfcde1f, 0xbfa945, 0x000006, 0xb73132, 0xe32123, 0xe72022, 0xe52120, 0xe62121, 0xea1e20, 0xe12424, 0x991f21, 0x000000, 0x40432c, 0x56502c, 0x544b27, 0x524b26, 0x504a25, 0x4e4722, 0x4c4621, 0x4a4420, 0x444120, 0x48431f, 0xaf9a49, 0xefcf3b, 0xf2d324, 0xc1ae4b, 0x000001, 0xe3e2de, 0xffffff, 0xfffefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffdfd, 0xfefef6, 0xfcfcf0, 0xeeeeb9, 0x93915e, 0x000000, 0x020304, 0x010102, 0x020104, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0xdadada, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0xf4f4f4, 
-  0xffffff, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefffe, 0xfffedd, 0xebdb66, 0xeacd00, 0xf0d000, 0xefd300, 0xefd400, 0xf0d500, 0xf0d500, 0xf0d500, 0xf1d601, 0xf6d405, 0xf8be1a, 0xcb5b00, 0xbc5a57, 0xfceee3, 0xfcfff8, 0xfefdfe, 0xfefdfb, 0xfefdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfcfefb, 0xffffff, 0xcac9c7, 0x000000, 0xdcc84d, 0xf7da1c, 0xceb74b, 0x000005, 0xb12327, 0xe02525, 0xe52221, 0xe52323, 0xe42423, 0xe52323, 0xe22521, 0xb72c2e, 0x000001, 0xbdaa3c, 0xf7d91d, 0xfbd711, 0xf4d32c, 0xead036, 0xe2c93f, 0xd2bb42, 0xb09e38, 0x716405, 0x000000, 0x5b5c63, 0xcbcec8, 0x9c9e99, 0x4d4000, 0xebd038, 0xf8db29, 0xa7983f, 0x340000, 0xc62727, 0xdf2421, 0xe12422, 0xe32322, 0xe32423, 0xe32321, 0xd62929, 0x8b222a, 0x2c2b16, 0xe2c746, 0xf8d921, 0xc6b344, 0x000000, 0xb32928, 0xe12423, 0xe12422, 0xe12422, 0xe22523, 0xe32624, 0xde2826, 0xa82928, 0x000000, 0xc8b64d, 0xe4d363, 0x2c2e1e, 0x7d161d, 0xd52b2b, 0xe12324, 0xe22523, 0xe22523, 0xe22523, 0xe22522, 0xdc2a28, 0xad3034, 0x000000, 0xb3a450, 0xfadc35, 0xf1da3f, 0x7f7638, 0x580011, 0xcc2a2a, 0xe52322, 0xe42423, 0xe42423, 0xe32322, 0xe42422, 0xdb2728, 0xc8292a, 0xc02825, 0xbf2826, 0xc22829, 0xc32728, 0xc32728, 0xc22727, 0xc32728, 0xc5272b, 0xd62326, 0xe4211e, 0xe72020, 0xe72020, 0xe81e20, 0xe71e1c, 0xda2827, 0x922225, 0x172317, 0xdcc844, 0xfadb07, 0xf9d707, 0xf5d200, 0xf5da2f, 0x928737, 0x410004, 0xcd2829, 0xe12220, 0xe42121, 0xe52122, 0xe42222, 0xe42121, 0xd62a2b, 0x7c1323, 0x48451e, 0xe6ce3e, 0xf6da26, 0xac9e38, 0x323745, 0x919394, 0x3e3b05, 0xe9d446, 0xfbde1c, 0xbfaa43, 0x000007, 0xb83131, 0xe42122, 0xe82021, 0xe62120, 0xe92121, 0xe82020, 0xe12323, 0xbb2325, 0x861c1e, 0x820e1a, 0x800a18, 0x7f0d19, 0x800e18, 0x801019, 0x80101a, 0x80101a, 0x80121a, 0x7c191c, 0x56001a, 0x000007, 0xcfb741, 0xf6d219, 0xe3c649, 0x281b00, 0xc1c3bf, 0xfffffe, 0xfefdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefe, 0xfffdfc, 0xfefef6, 0xfffff7, 0xcbccba, 0x000000, 0x000004, 0x010302, 0x000100, 0x010102, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0xdddddd, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfafafa, 0xe9e9e9, 
-  0x666666, 0xf6f6f6, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfffedf, 0xecdd6b, 0xeacd00, 0xf0d100, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d500, 0xf1d500, 0xf3d503, 0xfac61d, 0xd86914, 0xd30000, 0xc6504b, 0xfae8df, 0xfdfff8, 0xfefdfe, 0xfdfdfe, 0xfefdfe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfcfefc, 0xffffff, 0xc9c9c7, 0x000000, 0xdcc94e, 0xf6da1b, 0xcdb64b, 0x000005, 0xb02327, 0xe02525, 0xe42220, 0xe42323, 0xe42423, 0xe4231f, 0xe32323, 0xb62c2c, 0x000000, 0xbeaa3e, 0xf8db24, 0xf0d238, 0x88742c, 0x483c00, 0x070000, 0x000000, 0x333944, 0x8f9091, 0xcecece, 0xf3f3f0, 0xfffffb, 0xa7a7a3, 0x483c00, 0xead138, 0xf7dd29, 0xa89940, 0x350000, 0xc72828, 0xdf2422, 0xe12422, 0xe42423, 0xe42423, 0xe42321, 0xd72829, 0x8d222b, 0x2c2b16, 0xe2c745, 0xf9d91e, 0xc7b242, 0x000000, 0xb42928, 0xe12422, 0xe22522, 0xe22523, 0xe32624, 0xe42724, 0xdf2826, 0xa8292c, 0x000000, 0xcbb446, 0xfce448, 0xa1914a, 0x0b0000, 0xb62d2e, 0xdf2526, 0xe32322, 0xe42423, 0xe42423, 0xe42422, 0xdf2525, 0xd52e33, 0x750511, 0x4c4828, 0xead05b, 0xdfcb52, 0x3a331d, 0x8e1a26, 0xdb282a, 0xe52221, 0xe42222, 0xe42423, 0xe52523, 0xe42523, 0xc62f2e, 0x641617, 0x1b0000, 0x0a0000, 0x150000, 0x170000, 0x150000, 0x0e0000, 0x160000, 0x440909, 0xb7292c, 0xe32220, 0xe5201f, 0xe61f1f, 0xe91f1f, 0xe7211e, 0xe32322, 0xba2d2e, 0x000000, 0xbba843, 0xf8db20, 0xf9d607, 0xf6d200, 0xf4da2e, 0x928737, 0x3f0003, 0xcb2827, 0xe12120, 0xe32021, 0xe42021, 0xe32222, 0xe42121, 0xd62a2a, 0x7c1322, 0x47451e, 0xe6cf3e, 0xf7db26, 0xad9f38, 0x323646, 0x929495, 0x3f3c07, 0xe9d446, 0xfcdf1d, 0xc0aa44, 0x000007, 0xb83131, 0xe42122, 0xe82021, 0xe72120, 0xe82021, 0xe5221f, 0xe52222, 0xe22527, 0xd92728, 0xd72826, 0xd72a21, 0xd52829, 0xd52a25, 0xd62a25, 0xd62927, 0xd72928, 0xd62a27, 0xd32e2a, 0xab3334, 0x000000, 0xaf9937, 0xf8d121, 0xedce43, 0x554b00, 0xb1b1b1, 0xfffffe, 0xfefefc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefffe, 0xfefdfd, 0xfefef9, 0xfffffa, 0xbabab6, 0x000000, 0x010200, 0x000100, 0x010100, 0x020201, 0x020202, 0x010101, 0x010101, 0x020202, 0x000000, 0x000000, 0x121212, 0xe3e3e3, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xf7f7f7, 0xd9d9d9, 
-  0x000000, 0xededed, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefeff, 0xfefefe, 0xfffee2, 0xeee072, 0xeace00, 0xf0d200, 0xefd500, 0xf2d402, 0xf0d500, 0xf1d500, 0xf0d603, 0xf9cf18, 0xde8016, 0xd40a14, 0xdd190a, 0xc44542, 0xf8e3df, 0xfefffa, 0xfffdfd, 0xfcfefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfdfdfc, 0xffffff, 0xc8c9c8, 0x000000, 0xdaca4e, 0xf6da1b, 0xceb84a, 0x000005, 0xb22427, 0xe02425, 0xe42221, 0xe42223, 0xe42323, 0xe52220, 0xe32227, 0xb42a2c, 0x000000, 0xbfa940, 0xf8da21, 0xe6cf3f, 0x2d2400, 0x747678, 0xbebebe, 0xd8d7d9, 0xf1f1f1, 0xfffffe, 0xffffff, 0xfafef9, 0xfffffe, 0xa7a5a6, 0x493d00, 0xe9d036, 0xf8dc2a, 0xa99b40, 0x370000, 0xc82728, 0xde2420, 0xe02421, 0xe32321, 0xe42322, 0xe52221, 0xd62929, 0x8c232b, 0x2d2b16, 0xe2c746, 0xfad91e, 0xc9b341, 0x000000, 0xb72a28, 0xe12421, 0xe32423, 0xe32424, 0xe32524, 0xe42524, 0xde2827, 0xa92b2c, 0x000000, 0xcbb343, 0xfae022, 0xdfc758, 0x2c251e, 0x7f191f, 0xd72c2c, 0xe42221, 0xe22422, 0xe42223, 0xe42323, 0xe52222, 0xdf2423, 0xb52b2c, 0x000000, 0xb5aa64, 0xc2b66c, 0x000000, 0xb32a2d, 0xe42328, 0xe52020, 0xe42021, 0xe32122, 0xe52323, 0xe02725, 0xaa2f2e, 0x000000, 0x867c4b, 0xa99644, 0xae9640, 0xb09843, 0xb39945, 0xb49c43, 0x9d8b49, 0x000004, 0xa02529, 0xdf2525, 0xe6201f, 0xe6201e, 0xe7201e, 0xe3211f, 0xe42020, 0xce2d30, 0x4b0011, 0x8d7c3b, 0xf4d937, 0xf7d704, 0xf5d200, 0xf5da2d, 0x948835, 0x410004, 0xcc2828, 0xe2211f, 0xe32020, 0xe32020, 0xe32120, 0xe4201f, 0xd52b2a, 0x7c1422, 0x47441e, 0xe6cf40, 0xf7db27, 0xaea03a, 0x313645, 0x949496, 0x3f3c0c, 0xe8d448, 0xfbe01c, 0xc0ac44, 0x000006, 0xb93030, 0xe62121, 0xea1f22, 0xe6211e, 0xe52121, 0xe72120, 0xe91f20, 0xe6201e, 0xe4211c, 0xe42021, 0xe5201f, 0xe52020, 0xe3211b, 0xe4211c, 0xe51f1d, 0xe51f1e, 0xe5201d, 0xe12420, 0xba2e2b, 0x000000, 0xab9136, 0xf8d221, 0xefd23d, 0x5f5600, 0xa7a7a6, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefffe, 0xfefefe, 0xfdfdfc, 0xfffffb, 0xb1b1b0, 0x000000, 0x010000, 0x010003, 0x000102, 0x000100, 0x010101, 0x010000, 0x010000, 0x010101, 0x000100, 0x000000, 0x2c2d2e, 0xe7e8e8, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfffffe, 0xfefefd, 0xf2f2f2, 0xb8b8b8, 
-  0x000000, 0xe3e3e3, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfe, 0xfdfdfd, 0xffffe6, 0xefe47d, 0xeacf00, 0xf1d200, 0xefd501, 0xf2d503, 0xf2d501, 0xf6d401, 0xfad415, 0xe4981a, 0xd01a15, 0xe3221b, 0xe11a13, 0xc53635, 0xf5dcd6, 0xfefff9, 0xfffdfd, 0xfdfefd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfdfb, 0xffffff, 0xc7c9c9, 0x000000, 0xd9ca4e, 0xf8d91c, 0xcdba48, 0x000005, 0xb42626, 0xe02522, 0xe42220, 0xe42220, 0xe52221, 0xe52122, 0xe62225, 0xb62a2d, 0x000000, 0xbea943, 0xf6d91f, 0xe8d248, 0x271800, 0xc0c0be, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfcfffd, 0xffffff, 0xa3a4a1, 0x4a3e00, 0xe8cf37, 0xf9dc2c, 0xad9c41, 0x330000, 0xc82928, 0xe12523, 0xe22422, 0xe42222, 0xe52324, 0xe82224, 0xdb292b, 0x90242c, 0x2d2a16, 0xe2c747, 0xf8da1d, 0xcab542, 0x0d0000, 0xb72d2a, 0xe22420, 0xe42221, 0xe42222, 0xe52321, 0xe62422, 0xe02827, 0xac2b2d, 0x000000, 0xccb440, 0xf9dc1b, 0xf6db40, 0x9e8947, 0x020000, 0xb92d2e, 0xe12625, 0xe42320, 0xe72022, 0xe61f21, 0xe62020, 0xe4211e, 0xd52a2c, 0x780717, 0x5c5c46, 0x78765c, 0x5a0000, 0xcf2c2d, 0xea2020, 0xe6201e, 0xe4211f, 0xe4201e, 0xe4201e, 0xdc2927, 0x8d2224, 0x262a18, 0xe3cc5e, 0xf8db30, 0xfbd928, 0xfadb27, 0xfbda28, 0xfada24, 0xecd252, 0x524b29, 0x7f0f1c, 0xda282a, 0xe92221, 0xe6211d, 0xe4201c, 0xe3211e, 0xe2211d, 0xdb2a28, 0x851922, 0x484322, 0xe5d246, 0xf7d806, 0xf5d300, 0xf5d92a, 0x968832, 0x420005, 0xcd2828, 0xe41f20, 0xe41f20, 0xe32221, 0xe42121, 0xe71e20, 0xd92a2d, 0x7e1424, 0x474620, 0xe6cf42, 0xf7db28, 0xb0a33e, 0x313543, 0x969595, 0x3f3b11, 0xe7d44a, 0xfbdf1e, 0xc2af47, 0x000005, 0xb52f31, 0xe42320, 0xea2023, 0xe92120, 0xe8211f, 0xe7211f, 0xe7211f, 0xe6211e, 0xe5211f, 0xe4211e, 0xe5211e, 0xe5211d, 0xe5211c, 0xe4211c, 0xe3211c, 0xe4211c, 0xe4211c, 0xe32421, 0xba2a2c, 0x000000, 0xae9a37, 0xf8d31d, 0xf1d23d, 0x5d5100, 0xa7a8a6, 0xffffff, 0xfefeff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xa9a9a9, 0x000000, 0x010101, 0x020202, 0x010101, 0x000000, 0x000000, 0x000000, 0x010001, 0x010101, 0x020101, 0x000000, 0x453e3e, 0xedebea, 0xfffeff, 0xfdfdfe, 0xffffff, 0xffffff, 0xfefefd, 0xfefefc, 0xeeeeec, 0x959595, 
-  0x000000, 0xf0f0f0, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffe8, 0xf2e887, 0xead000, 0xf1d200, 0xf2d303, 0xf0d700, 0xf3d500, 0xfbd312, 0xefa21b, 0xd22c10, 0xe31f20, 0xe6211b, 0xe31b18, 0xc72628, 0xf2d6d0, 0xfffff9, 0xfefdfe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfdfb, 0xffffff, 0xc6c8c6, 0x000000, 0xddc74c, 0xf9d921, 0xccbb4c, 0x060004, 0xb62628, 0xe02525, 0xe42222, 0xe32321, 0xe42322, 0xe32322, 0xe22624, 0xb12a28, 0x000000, 0xc0ab45, 0xf6da1f, 0xe8d34c, 0x281c00, 0xb8b9b7, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfffefe, 0xfdfeff, 0xffffff, 0xa2a39f, 0x493f00, 0xe8d038, 0xf9dd2e, 0xae9e43, 0x300000, 0xc52825, 0xe02522, 0xe22421, 0xe32320, 0xe22421, 0xe12422, 0xdb292c, 0x92222c, 0x282816, 0xe1c647, 0xf6da1f, 0xc8b445, 0x020000, 0xb62a29, 0xe22523, 0xe42322, 0xe42222, 0xe42321, 0xe42422, 0xdb2a27, 0xa82d2d, 0x000000, 0xcbb33f, 0xf9da1d, 0xf9d910, 0xdec350, 0x252019, 0x811c1e, 0xd72c2c, 0xe92120, 0xe5221e, 0xe6211e, 0xe6221a, 0xe7201e, 0xe02522, 0xaa302e, 0x1b0005, 0x000000, 0x8a2424, 0xdb2a26, 0xe72220, 0xe91e1f, 0xe81f1f, 0xe91e1f, 0xe61c1f, 0xd62d2c, 0x670015, 0x716a37, 0xf6d646, 0xf8d508, 0xf1d337, 0xecd23e, 0xf1d632, 0xf7da0b, 0xf9da41, 0x89783c, 0x57000c, 0xd12c2b, 0xe72522, 0xe4201f, 0xe52021, 0xe42120, 0xe3201d, 0xe02521, 0xab2c2c, 0x000000, 0xccb746, 0xf9d91f, 0xf6d500, 0xf6da2c, 0x968734, 0x410003, 0xca2927, 0xe22020, 0xe42021, 0xe22220, 0xe2211f, 0xe12220, 0xd92a2d, 0x7f1224, 0x494621, 0xe6ce42, 0xf7db27, 0xb0a43f, 0x2c3040, 0x929292, 0x37340b, 0xe6d24a, 0xfedf23, 0xc9b44f, 0x000002, 0xb22c31, 0xe5211f, 0xe7211f, 0xe82020, 0xe62020, 0xe52120, 0xe42120, 0xe42120, 0xe42221, 0xe42221, 0xe42120, 0xe52120, 0xe5211f, 0xe4211f, 0xe5211f, 0xe4211e, 0xe4211e, 0xe02620, 0xb12b29, 0x000000, 0xbba53d, 0xf8d416, 0xf0d23d, 0x504200, 0xafafaf, 0xffffff, 0xfefefd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0x9d9d9d, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x000100, 0x000100, 0x010001, 0x000002, 0x0f0000, 0x835856, 0xf6eeea, 0xfeffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefd, 0xfdfdfb, 0xf1f1ef, 0x84848c, 
-  0x000000, 0xf8f8f8, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xfeffed, 0xf5eb95, 0xead000, 0xf3d200, 0xf5d201, 0xf6d400, 0xf9d30c, 0xf2af1c, 0xd53713, 0xe3181c, 0xe5211f, 0xe3211b, 0xe11e1d, 0xc81116, 0xeecdc8, 0xfffffa, 0xfefefe, 0xfdfdfc, 0xfcfdfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfc, 0xfffffe, 0xc3c5c2, 0x000000, 0xdcc94e, 0xf9db24, 0xd1bc4d, 0x100007, 0xaf2a2f, 0xd92827, 0xde2424, 0xdf2523, 0xe12524, 0xe32424, 0xdc2a29, 0xac3133, 0x000000, 0xc2ac45, 0xf7da22, 0xe8d353, 0x241800, 0xbdbdbd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfdfeff, 0xffffff, 0xa3a5a1, 0x473c00, 0xeacf3c, 0xf8df2d, 0xaea243, 0x290000, 0xbc2d2d, 0xd72725, 0xdb2523, 0xdf2423, 0xdd2524, 0xdc2624, 0xd53031, 0x8e2931, 0x222614, 0xdfc548, 0xf8d924, 0xc6b546, 0x000000, 0xa72b2a, 0xd82726, 0xde2624, 0xe02523, 0xe12624, 0xe22625, 0xd82e2a, 0xa93635, 0x000000, 0xcab53d, 0xf8da1a, 0xfad601, 0xf7d83a, 0x9b8941, 0x1d0000, 0xb83030, 0xe12626, 0xe22423, 0xe22425, 0xdc2827, 0xd42b2c, 0xcd302f, 0xa23232, 0x361216, 0x000000, 0x8f3230, 0xcc322c, 0xda2928, 0xdf2525, 0xde2422, 0xdd211f, 0xd92320, 0xc1302e, 0x2c0000, 0xa79848, 0xfadc35, 0xf4d731, 0x968a39, 0x4b4013, 0x938331, 0xf2da38, 0xfadf34, 0xaea149, 0x210000, 0xbe2f2f, 0xe02625, 0xdd2423, 0xdd2524, 0xdd2626, 0xdc2726, 0xd82a29, 0xaf3131, 0x000000, 0xaa953c, 0xf7dc2e, 0xf3d700, 0xf7db2e, 0x9a8634, 0x380007, 0xc12e2e, 0xdb2525, 0xde2325, 0xdd2524, 0xdd2525, 0xdb2724, 0xd13233, 0x781827, 0x4c4922, 0xe7cf42, 0xf7dc27, 0xafa23e, 0x292e3e, 0x9f9f9d, 0x171600, 0xdccd4f, 0xfedf1f, 0xd7bf4d, 0x000002, 0x982d2e, 0xd72a2b, 0xe02323, 0xde2524, 0xe12423, 0xe02423, 0xe02423, 0xdf2523, 0xe02624, 0xe02624, 0xe02524, 0xe02524, 0xe02524, 0xdf2525, 0xdf2525, 0xde2625, 0xde2625, 0xdd2a28, 0xa72c2b, 0x000000, 0xc7b544, 0xf9d517, 0xe9ce41, 0x2f2100, 0xbabbbc, 0xffffff, 0xfefffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0x888888, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000101, 0x000100, 0x020101, 0x000001, 0x160000, 0x8d1d1a, 0xb56662, 0xfaefea, 0xfffeff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefd, 0xfdfdfb, 0xf5f5f5, 0xaaaaaa, 
-  0x000000, 0xe6e6e6, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfeffff, 0xfefef2, 0xf8efa2, 0xebd100, 0xf4d200, 0xf4d300, 0xf8d306, 0xf9b91c, 0xd34f10, 0xde1219, 0xe3231e, 0xe1231f, 0xe22221, 0xe1201f, 0xca0000, 0xe5c2bd, 0xfffffb, 0xfdfdfe, 0xfdfdfb, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfc, 0xfffffe, 0xc9cac8, 0x000000, 0xd8c84e, 0xfbdc25, 0xd8c04d, 0x000003, 0x80272e, 0xa72e30, 0xae2a2d, 0xb12c2d, 0xb52b2d, 0xb22f30, 0xa63335, 0x77242f, 0x000000, 0xcbb346, 0xf8db25, 0xe5d155, 0x050000, 0xc5c4c6, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfffefd, 0xfdfffe, 0xffffff, 0xafb1ad, 0x372c00, 0xe5d03f, 0xfbdf2b, 0xbfaa4d, 0x000000, 0x842a2c, 0xa52f31, 0xac2c2f, 0xb02c2f, 0xb02c30, 0xac3034, 0x9c3637, 0x5a0d26, 0x2f281a, 0xe2ca48, 0xf6d819, 0xd0b744, 0x000000, 0x661820, 0xa12e2f, 0xab2b2b, 0xb12c2b, 0xb52d2d, 0xb22d2f, 0xa73635, 0x7b2c31, 0x000000, 0xd3bb3e, 0xf8d913, 0xfad809, 0xf8d812, 0xdec54d, 0x372f1f, 0x701a23, 0xba3837, 0xbd2f2e, 0xae2b2d, 0x9c232b, 0x7b0d1f, 0x550013, 0x000000, 0x00000c, 0x0f0b14, 0x0b0000, 0x5c0014, 0x80151f, 0x982326, 0xa52b2a, 0xae2c2a, 0xb33332, 0x912d2c, 0x000004, 0xd0ba4b, 0xf8de1b, 0xebd142, 0x4e4921, 0x313a4a, 0x3b3523, 0xdfcd48, 0xf7e121, 0xd4bf4d, 0x000008, 0x8c2f30, 0xb83736, 0xb63434, 0xac2f30, 0x9d282b, 0x8c1b22, 0x770017, 0x48000c, 0x000000, 0xb7a43e, 0xf7da26, 0xf4d600, 0xf8dc30, 0xa2903e, 0x000000, 0x8e2b2d, 0xa92c30, 0xad2a30, 0xac2b2f, 0xac2b2f, 0xa62e30, 0x943434, 0x3d0015, 0x5a5028, 0xebd341, 0xf8dd28, 0xada03a, 0x383b49, 0xc7c7c5, 0x000009, 0xbeb34d, 0xfbdf29, 0xedd444, 0x62582c, 0x260000, 0x90282d, 0xaa2c31, 0xad2d30, 0xb02d2e, 0xaf2d2e, 0xae2d2d, 0xac2c2c, 0xad2c2c, 0xad2c2c, 0xab2b2c, 0xaa2b2d, 0xa92b2d, 0xa82c2e, 0xa72c2e, 0xa62c2e, 0xa62c2d, 0xa22f32, 0x691c22, 0x0f0512, 0xdbc345, 0xfad714, 0xdcc544, 0x000000, 0xcfd0d0, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfbfbfb, 0x737373, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000201, 0x000101, 0x000000, 0x000000, 0x7e1f1f, 0xcb2a27, 0xc7726d, 0xfdf2ed, 0xfefeff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfffffd, 0xfefefc, 0xececea, 0x000000, 
-  0x000000, 0xd4d4d4, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffef3, 0xf8f3af, 0xecd110, 0xf4d200, 0xf6d303, 0xfac51a, 0xd86911, 0xd60513, 0xe32320, 0xe12422, 0xe12422, 0xe02322, 0xe12120, 0xce0000, 0xe0b3ae, 0xfffefa, 0xfefdfc, 0xfdfefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefdfe, 0xfdfefd, 0xfdfefc, 0xffffff, 0xdddddb, 0x000000, 0xc5b74e, 0xf9dd2e, 0xf2d548, 0x988a41, 0x00000f, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000002, 0x262314, 0x927f36, 0xe8ca3e, 0xf7dc2c, 0xd4c75f, 0x000000, 0xd6d6d7, 0xffffff, 0xfefdfc, 0xfffeff, 0xffffff, 0xffffff, 0xfffffc, 0xffffff, 0xcccbca, 0x000000, 0xd7c748, 0xf9de23, 0xead057, 0x80753c, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000009, 0x4c4322, 0xb19c42, 0xeed137, 0xf2d500, 0xebd13a, 0x99873a, 0x160c0e, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000708, 0x918338, 0xebd03c, 0xf5d616, 0xe7c821, 0xf2d410, 0xf4d93b, 0xae9b4b, 0x000000, 0x35000f, 0x240000, 0x000000, 0x191715, 0x564f26, 0x877b34, 0xaf9f41, 0xc7b646, 0xc8b74b, 0xa0913d, 0x746c2e, 0x48461d, 0x232317, 0x000007, 0x000000, 0x0c0004, 0x000000, 0x615729, 0xead143, 0xf8da1f, 0xd5c04f, 0x130e1c, 0xbec1bf, 0x3a3d46, 0xbeac43, 0xf6dc23, 0xecd342, 0x7d6d31, 0x000000, 0x0e0004, 0x000004, 0x000003, 0x000e0e, 0x37381d, 0x5d5729, 0x7f7535, 0xb4a141, 0xecd037, 0xf6d60c, 0xf5d80c, 0xf3d921, 0xd7c54c, 0x6c6130, 0x000002, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x453e1e, 0xb5a13f, 0xf2d62c, 0xf4dc3c, 0x938832, 0x6b6d73, 0xf2f4f4, 0x62636a, 0x746c23, 0xefd842, 0xf8db2a, 0xceba4c, 0x60572b, 0x000003, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x9c8a40, 0xf2d439, 0xf9d91f, 0xc2b042, 0x000019, 0xe6e9e4, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf6f6f6, 0x616161, 0x000000, 0x000000, 0x000000, 0x000000, 0x000201, 0x020100, 0x000101, 0x000000, 0x5e1a1a, 0xc63031, 0xd50d13, 0xcf827c, 0xfff7f2, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfffffe, 0xe4e4e3, 0x000000, 
-  0x000000, 0xf3f3f3, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfefef9, 0xfbf6bc, 0xedd225, 0xf6d300, 0xfccb18, 0xe27f18, 0xd30811, 0xdd241a, 0xe12522, 0xe12422, 0xe12422, 0xe02421, 0xe12321, 0xcf0000, 0xd8a29e, 0xfffbf7, 0xfefdfb, 0xfdfffe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfcfdfc, 0xfdfefd, 0xfefeff, 0xf6f5f5, 0x696a6d, 0x7e7427, 0xf1dd49, 0xfadb2c, 0xf4d944, 0xdbbf4b, 0xc5ad42, 0xbea53e, 0xbaa03d, 0xbaa041, 0xbea748, 0xccb34c, 0xdfc344, 0xf1d335, 0xf4d50d, 0xf5d94d, 0x8d8049, 0x000000, 0x7a7c7f, 0x7b7e81, 0x77797d, 0x808386, 0x959799, 0xb7b8b9, 0xdededb, 0xfafbfa, 0xf2f2f0, 0x3b3b46, 0xa39740, 0xf4de3e, 0xf9dd2e, 0xefd748, 0xd3bb47, 0xc0ab41, 0xb9a23a, 0xb69f37, 0xb69f37, 0xc4aa3d, 0xd4bb40, 0xe4cb41, 0xf2d430, 0xf4d205, 0xf7d404, 0xf5d50f, 0xefd433, 0xd6be42, 0xc5ae3c, 0xbca538, 0xba9e3b, 0xb79f3f, 0xb6a440, 0xc2ac46, 0xd5bf45, 0xecd438, 0xf2d50d, 0xebd23d, 0x8e7933, 0xdbc12d, 0xf8d515, 0xecd040, 0xb6a13b, 0x9d9039, 0xac9f3f, 0xc5b044, 0xdac149, 0xe5cc41, 0xefd72f, 0xf2d823, 0xf2d61b, 0xf2d41a, 0xf3d72c, 0xedd237, 0xe5ca3c, 0xd8bf43, 0xcdb644, 0xbaa73c, 0xa49533, 0xae9c3a, 0xddc43f, 0xf5d61b, 0xf7d936, 0xa29642, 0x00002d, 0xadadad, 0x40454f, 0x766a25, 0xebd532, 0xf2d714, 0xe5cc3a, 0xb8a332, 0xab9935, 0xbaa63c, 0xc9b142, 0xd6bc43, 0xe0c43f, 0xe9cc3c, 0xefd433, 0xf5d727, 0xf6d71b, 0xecd336, 0xdfc634, 0xf6db25, 0xf5da23, 0xe9d243, 0xccb843, 0xbaa93e, 0xb4a238, 0xb29f36, 0xb6a237, 0xc5af3e, 0xd0ba41, 0xe2cb3d, 0xf2d62b, 0xf3d618, 0xd8c24d, 0x2c1d06, 0x535759, 0xa7a8a5, 0x616266, 0x000000, 0xb5a042, 0xf6d72c, 0xf6d829, 0xe8cf40, 0xd1ba3f, 0xc3ae3a, 0xc0ab3d, 0xbfaa3f, 0xbeaa3f, 0xbfab3f, 0xc0ab40, 0xc0ac40, 0xc1ac3f, 0xc2ac3f, 0xc2ab3e, 0xc2ab3e, 0xc3ac3e, 0xc4ac3e, 0xc5ad3f, 0xc6ae40, 0xc9b043, 0xd0b941, 0xeed337, 0xf8d411, 0xf6d540, 0x7d6e1c, 0x787c7f, 0xfcfdfc, 0xfefef8, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xededed, 0x3d3d3d, 0x000000, 0x000000, 0x000000, 0x000000, 0x000001, 0x010001, 0x000000, 0x450f10, 0xb73033, 0xdd2527, 0xd40000, 0xd18f88, 0xfffaf4, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xf7f7f7, 0x000000, 
-  0x000000, 0xd7d7d7, 0xf8f8f8, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfffef9, 0xfcf9c7, 0xebd53f, 0xfbce0b, 0xe9951b, 0xd21811, 0xe1201b, 0xe4231f, 0xe02421, 0xe12422, 0xe12422, 0xe12422, 0xe22422, 0xd20000, 0xce8a88, 0xfff6f2, 0xfefefa, 0xfdfefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfefd, 0xfefefe, 0xfefeff, 0xffffff, 0xd0d0ce, 0x000000, 0xab9f42, 0xf2dd4b, 0xfbde2c, 0xf8d516, 0xf7d418, 0xf8d31a, 0xf8d31e, 0xf8d421, 0xf7d51f, 0xf9d61a, 0xf9d50f, 0xfad30a, 0xfad41d, 0xcbaf3d, 0x74642e, 0x807634, 0x83731b, 0x867410, 0x847418, 0x7f711f, 0x6d6018, 0x3a2e00, 0x000000, 0x7c7e7e, 0xdcdedb, 0xb9bbbb, 0x000000, 0xc7b856, 0xf7de49, 0xfadc28, 0xf9da1f, 0xf6d81d, 0xf8d61c, 0xf9d51f, 0xf8d41d, 0xf7d516, 0xf7d509, 0xf7d300, 0xf6d202, 0xf6d405, 0xf7d405, 0xf8d406, 0xf7d405, 0xf6d50b, 0xf6d516, 0xf5d31a, 0xf7d119, 0xf5d021, 0xf0d31c, 0xf2d21b, 0xf6d314, 0xf3d524, 0xe8d042, 0xaa9c43, 0x000000, 0x968529, 0xf4d420, 0xf7d607, 0xf8d61c, 0xf5d726, 0xf5d822, 0xf7d617, 0xf8d70a, 0xf6d500, 0xf7d500, 0xf7d503, 0xf7d504, 0xf8d503, 0xf8d500, 0xf7d500, 0xf8d500, 0xf8d604, 0xf8d710, 0xf7d81b, 0xf6d81e, 0xf5d91b, 0xf4d908, 0xf5da1d, 0xceb941, 0x141115, 0x000000, 0x2c2500, 0x574d20, 0x7f6f2f, 0xe4cb2e, 0xf6d701, 0xf7d405, 0xf8d619, 0xf7d81e, 0xf7d818, 0xf9d714, 0xf9d60b, 0xf9d400, 0xfad300, 0xfad400, 0xf9d60a, 0xdec130, 0x7b6d29, 0x433819, 0xc8b644, 0xf1dc31, 0xf7db19, 0xf7d816, 0xf7d91b, 0xf7d81d, 0xf7d71e, 0xf7d71b, 0xf6d715, 0xf8d613, 0xf7d303, 0xf9d500, 0xf3d520, 0xb19c34, 0x6c622c, 0x6a6326, 0x5f5100, 0x65571d, 0x5b5227, 0x695924, 0xdabf2d, 0xf7d605, 0xf6d400, 0xf7d60e, 0xf9d713, 0xfad617, 0xf9d619, 0xf8d619, 0xf8d618, 0xf8d618, 0xf8d617, 0xf8d518, 0xf9d517, 0xfad516, 0xf9d416, 0xf7d514, 0xf7d513, 0xf8d512, 0xf7d512, 0xf8d410, 0xf8d50e, 0xf7d504, 0xf1d629, 0xb2a140, 0x00000d, 0xd5d7cf, 0xffffff, 0xfffffb, 0xfdfefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe3e3e3, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x010101, 0x000100, 0x280101, 0xa82b2d, 0xdc2627, 0xea191d, 0xd40000, 0xd9a098, 0xfffdf8, 0xfdfdfe, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xe3e3e3, 0x000000, 
-  0x000000, 0xb5b5b5, 0xf6f6f6, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefef9, 0xfcfbd4, 0xf2d35d, 0xf1a31e, 0xd53110, 0xde1e19, 0xe3241d, 0xe4221f, 0xe22222, 0xe22423, 0xe22523, 0xe22523, 0xe22422, 0xd60000, 0xc77373, 0xfff1ed, 0xfefefa, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfdfdfc, 0xfdfdfb, 0xaeafad, 0x000000, 0x796e22, 0xc7b74c, 0xdfc84a, 0xe9cb42, 0xedce40, 0xefd03d, 0xefd13d, 0xefd13c, 0xe9c826, 0xf3d00f, 0xfbd708, 0xf9d50e, 0xf2cf21, 0xf5d639, 0xf6da3a, 0xfadb38, 0xfadd33, 0xf7dd35, 0xf5de3f, 0xf3dd4b, 0xecd753, 0xc7b458, 0x625412, 0x000000, 0xbbbebd, 0x8f9091, 0x000000, 0x978a3d, 0xd1be4e, 0xe4cd3b, 0xefcf1b, 0xf5d306, 0xf9d204, 0xf8d200, 0xf7d400, 0xf7d500, 0xf7d600, 0xf7d600, 0xf6d600, 0xf5d500, 0xf6d600, 0xf8d502, 0xf7d304, 0xebca18, 0xeacd3a, 0xedd137, 0xedce3b, 0xeccf3f, 0xe6cd40, 0xddc647, 0xbcaa4c, 0x776935, 0x000000, 0x7c7039, 0xcbb746, 0xf0d423, 0xf6d603, 0xf9d600, 0xf9d400, 0xf8d400, 0xf6d500, 0xf7d600, 0xf8d600, 0xf7d700, 0xf6d600, 0xf4d500, 0xf4d500, 0xf5d600, 0xf6d700, 0xf6d600, 0xf6d600, 0xf6d600, 0xf7d600, 0xf9d600, 0xf6d601, 0xf1d612, 0xd3ba33, 0x927f3a, 0xa89841, 0xccb743, 0xe3cb3a, 0xead03b, 0xf1d435, 0xf5d51a, 0xf6d603, 0xf9d600, 0xfbd501, 0xfad501, 0xfbd501, 0xfbd400, 0xfbd400, 0xf9d300, 0xf9d400, 0xf9d600, 0xf7d711, 0xd3b636, 0x8a7a3a, 0x201713, 0x000001, 0x978e3b, 0xdac542, 0xf4d51d, 0xf7d601, 0xf7d401, 0xf8d400, 0xf8d300, 0xf8d300, 0xf9d600, 0xf9d600, 0xf9d500, 0xf7d402, 0xf3d227, 0xf2d639, 0xf1d73e, 0xf0d63e, 0xefd437, 0xecd039, 0xeacc32, 0xf1ce1d, 0xf8d500, 0xf7d500, 0xf8d400, 0xfad300, 0xfbd300, 0xf8d300, 0xf7d300, 0xf7d301, 0xf7d302, 0xf6d300, 0xf6d300, 0xf7d400, 0xf8d300, 0xf9d300, 0xfad200, 0xfbd300, 0xfad300, 0xf9d300, 0xf9d300, 0xf8d500, 0xf9d60b, 0xdcc236, 0x090000, 0x7b7d7d, 0xfcfdf3, 0xfdfff8, 0xffffff, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xcecece, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000100, 0x070000, 0x962528, 0xda2828, 0xe6201c, 0xe9181a, 0xd00000, 0xdfafa9, 0xfffff9, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xd2d2d2, 0x000000, 
-  0x000000, 0xe0e0e0, 0xf8f8f8, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfeffff, 0xfdfefc, 0xfffdde, 0xefbb72, 0xd54500, 0xe0191d, 0xe1241f, 0xe32124, 0xe02520, 0xe22324, 0xe22423, 0xe22523, 0xe12422, 0xe22422, 0xd9100d, 0xbf595a, 0xfbebe6, 0xfdfffb, 0xfcfdfc, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfcfdfb, 0xfdfefd, 0xfafaf9, 0xc7c8c5, 0x5e6063, 0x000000, 0x000000, 0x3b3200, 0x4a3f00, 0x524700, 0x5d5526, 0x574b25, 0xbca22c, 0xf6d11c, 0xfcd407, 0xf7d814, 0xf9da2a, 0xf9db37, 0xf6dc39, 0xf5dc38, 0xf5dc3c, 0xf7dc3f, 0xfadd43, 0xfbe03b, 0xfadf2a, 0xf8de31, 0xead650, 0x93833f, 0x000019, 0xd0d0d2, 0xa9abaa, 0x40434b, 0x000000, 0x8c7728, 0xeacb25, 0xf1d101, 0xf6d715, 0xf8d929, 0xf6d730, 0xf3d633, 0xf1d633, 0xf2d632, 0xf4d532, 0xf5d52f, 0xf6d826, 0xf5d504, 0xf6d50a, 0xcaae2d, 0x5c4e26, 0x5f5517, 0x554700, 0x534400, 0x473a00, 0x2c2600, 0x000000, 0x21191a, 0xbaab59, 0xe7d144, 0xf0d51f, 0xf3d610, 0xf8d71a, 0xf8d823, 0xf7d928, 0xf6d92c, 0xf6d92d, 0xf6d92e, 0xf6d92e, 0xf5d930, 0xf5d931, 0xf4d832, 0xf5d732, 0xf4d734, 0xf4d735, 0xf4d734, 0xf5d734, 0xf3d734, 0xf5d82f, 0xf4d924, 0xf2d508, 0xefd110, 0xe1c820, 0xe9d035, 0xf0d328, 0xf5d81f, 0xf7d922, 0xf6da32, 0xf2da39, 0xf2d83d, 0xf1d43e, 0xebd13f, 0xe7cd40, 0xe4ca3d, 0xe4ca3d, 0xe7ca3c, 0xeccd39, 0xf3d236, 0xf8d532, 0xf9d827, 0xf6d716, 0xf3d71c, 0xf0d638, 0xd7c049, 0x8b7739, 0x000000, 0x675820, 0xeacf2b, 0xf5d600, 0xf7d716, 0xf8d928, 0xf8d82e, 0xf8d72e, 0xf7d72f, 0xf7d82f, 0xf9d830, 0xf8d931, 0xf7da31, 0xf9db32, 0xf8db32, 0xf7dc32, 0xf7dc33, 0xf8d934, 0xf8d931, 0xf5d731, 0xf5d633, 0xf4d634, 0xf4d736, 0xf5d739, 0xf5d838, 0xf5d736, 0xf6d62e, 0xf5d51a, 0xf5d108, 0xf2d40d, 0xf2d734, 0xefd137, 0xebcc35, 0xe8ca39, 0xe8ca3b, 0xe8ca3b, 0xe7cb3b, 0xe7cc3b, 0xecd142, 0xf4d73b, 0xf9d615, 0xf3d42d, 0xb4a745, 0x000016, 0xdcddd9, 0xfffffc, 0xfefffe, 0xfefefc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xbdbdbd, 0x000000, 0x000001, 0x010101, 0x010102, 0x000001, 0x000000, 0x771e22, 0xcd2b2f, 0xe51f1c, 0xeb1b1a, 0xe4191a, 0xc80000, 0xe5bbb5, 0xfffffa, 0xfcfefd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfbfbfb, 0xf2f2f2, 0x000000, 
-  0x000000, 0x5a5a5a, 0xf1f1f1, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfefefe, 0xfffce8, 0xd19274, 0xd40000, 0xe02421, 0xe12422, 0xe12422, 0xe12422, 0xe22423, 0xe22523, 0xe22523, 0xe22523, 0xe22422, 0xde1b1a, 0xc23c40, 0xf7dfdc, 0xfefffd, 0xfefcfb, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfc, 0xfffffd, 0xf5f5f3, 0xdededc, 0xc8c9c7, 0xbebfc0, 0xbdbdbc, 0xacadae, 0x000028, 0x7c6f2c, 0xeed137, 0xf5d516, 0xf2d43d, 0xd7c14a, 0xb6a541, 0x9b8b3d, 0x857b34, 0x796f2c, 0x736a2c, 0x796f31, 0x8b7e3c, 0xa39541, 0xcab749, 0xf0d840, 0xf5d814, 0xecd14f, 0x645912, 0x7b7c80, 0xffffff, 0xd2d1d1, 0x000000, 0xc2ac41, 0xf3d51b, 0xf2d43a, 0xd6c04d, 0xad9c40, 0x908136, 0x7e732d, 0x796e2b, 0x766b2a, 0x776a29, 0x7d702b, 0xaa9c42, 0xe3cd48, 0xf4d30f, 0xeaca3a, 0x5e5213, 0x676871, 0xbab7bd, 0xbabbbe, 0xc4c5c3, 0xb3b1b4, 0x000010, 0xb1a353, 0xf4d942, 0xf6d920, 0xefd340, 0xd8c245, 0xc6b044, 0xb39f3e, 0xad993f, 0xa99640, 0xa3923d, 0x9d8c3e, 0x97863b, 0x928238, 0x8c7d35, 0x887a33, 0x857732, 0x847532, 0x827533, 0x817331, 0x80732f, 0x7f7630, 0x948336, 0xb5a63c, 0xeace2e, 0xf4d609, 0xf4d702, 0xf3d725, 0xe9d03e, 0xd6c143, 0xc4b042, 0xaf9f47, 0x958941, 0x7a7033, 0x625b27, 0x534d21, 0x433f1b, 0x3a3718, 0x3a3717, 0x403c19, 0x51491d, 0x6d6126, 0x8d7e35, 0xb09e41, 0xd7c146, 0xeed53b, 0xf5d920, 0xf4dd1b, 0xf3d743, 0xcab543, 0xcbb436, 0xf3d51d, 0xf2d73d, 0xd4bf4d, 0xa8973b, 0x9e8f3d, 0x9c8d3c, 0x9d8d3d, 0x9f8e3f, 0xa08f40, 0x9e8f40, 0x9d8f3f, 0x9d8d3f, 0x9e8e3e, 0x9f8e3e, 0x9d8c40, 0x9b8a3e, 0x9a8a3e, 0x98893c, 0x96883d, 0x958640, 0x938541, 0x928441, 0x91843f, 0x93863c, 0xa4923e, 0xd2c046, 0xf4d22e, 0xefd23c, 0xab9c49, 0x665b25, 0x564c1d, 0x4e461d, 0x49421b, 0x48411b, 0x47421b, 0x49461c, 0x595227, 0x8e823c, 0xe1cc4c, 0xf7d510, 0xefd344, 0x5e5100, 0x9b9d9d, 0xfffffe, 0xfefffc, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0x9e9e9e, 0x000000, 0x010101, 0x030001, 0x000203, 0x000000, 0x621919, 0xbc2e2f, 0xe32121, 0xe81d19, 0xe91b17, 0xe01718, 0xbd0008, 0xeeccc3, 0xfffffb, 0xfcfefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xf7f7f7, 0xc4c4c4, 0x000000, 
-  0x000000, 0x000000, 0xf8f8f8, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfcfffc, 0xfffaf3, 0xd7998c, 0xcf0000, 0xe02422, 0xe12422, 0xe12422, 0xe12422, 0xe22423, 0xe22523, 0xe22523, 0xe22523, 0xe22523, 0xe02120, 0xc2171e, 0xeecbc9, 0xfffffd, 0xfefcfc, 0xfefdfe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfc, 0xfdfdfc, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xd6d8d8, 0x000000, 0xcab439, 0xfad61b, 0xefd445, 0x9c8f43, 0x150910, 0x000000, 0x400005, 0x5a000d, 0x670013, 0x6e0015, 0x6a0014, 0x58000f, 0x260000, 0x000000, 0xa99646, 0xf5d738, 0xfad825, 0xc1ac51, 0x000000, 0xe5e7e4, 0xa7a7aa, 0x453700, 0xe5cd3e, 0xf2d829, 0xbfab4b, 0x160015, 0x000000, 0x40000e, 0x540013, 0x5d0013, 0x610012, 0x5e000f, 0x52000c, 0x000000, 0x827438, 0xf0d13b, 0xf5d424, 0xa49532, 0x626269, 0xfbf9fb, 0xffffff, 0xffffff, 0x9ea09f, 0x57510d, 0xe6d34d, 0xf7db27, 0xdac14f, 0x76662f, 0x261c12, 0x120004, 0x100000, 0x1b0000, 0x290000, 0x350000, 0x3f0007, 0x44000a, 0x48000d, 0x4d0010, 0x540012, 0x590014, 0x5b0014, 0x5d0012, 0x5e0012, 0x600016, 0x5c0016, 0x310008, 0x000000, 0xa89432, 0xf6db25, 0xf5d833, 0xc3ae47, 0x685d29, 0x17120f, 0x000000, 0x250000, 0x490009, 0x600015, 0x6e001d, 0x770f21, 0x801823, 0x861c24, 0x8b1f27, 0x891c25, 0x7e1120, 0x69001a, 0x480008, 0x000000, 0x00020c, 0x796c2e, 0xc3b146, 0xefd640, 0xf8de1f, 0xf8df24, 0xf6da24, 0xf8da26, 0xcbb74c, 0x000012, 0x020000, 0x370002, 0x3a0001, 0x390000, 0x3a0001, 0x390000, 0x390002, 0x390003, 0x3b0003, 0x3a0003, 0x3a0002, 0x3e0001, 0x400002, 0x400002, 0x3e0002, 0x410002, 0x450002, 0x440001, 0x440001, 0x430002, 0x3b0004, 0x000000, 0x373218, 0xdcc349, 0xd5bb4d, 0x000000, 0x4f0018, 0x7f121e, 0x8c141d, 0x8e181d, 0x8b181e, 0x87181e, 0x82181e, 0x6b0e1d, 0x000000, 0x968a3a, 0xf4d92a, 0xf5d72f, 0x968630, 0x6e7079, 0xfbfdf8, 0xfefff9, 0xfefcfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0x7f7f7f, 0x000000, 0x010000, 0x000100, 0x000000, 0x510f10, 0xb92b2d, 0xde2321, 0xe81d18, 0xe71f1b, 0xe51c19, 0xdc1315, 0xba2f32, 0xf5d8cf, 0xfffef9, 0xfcfefd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xf9f9f9, 0xdedede, 0x000000, 
-  0x000000, 0x000000, 0xe4e4e4, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfcfef8, 0xfffef6, 0xe4afa5, 0xcb0000, 0xe0231f, 0xe02321, 0xe12422, 0xe12422, 0xe22423, 0xe32423, 0xe32423, 0xe32423, 0xe32423, 0xe12422, 0xc70000, 0xe7b7b5, 0xfefffc, 0xfdfefc, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefe, 0xffffff, 0xffffff, 0xfeffff, 0xfcfcfc, 0xfffffd, 0x979b9b, 0x4b3f00, 0xe9cc36, 0xfbd826, 0xc0a94a, 0x000000, 0x7a2127, 0xb83333, 0xc8312e, 0xd02f2e, 0xd32d2d, 0xd52d2b, 0xd62d2b, 0xd32e2c, 0xba3330, 0x7c1c20, 0x150912, 0xdac045, 0xfbda18, 0xe6ce4d, 0x302700, 0xb6b8b7, 0x818284, 0x736602, 0xf4d73b, 0xf4d645, 0x7b6e37, 0x390006, 0xac3834, 0xc63432, 0xcb302f, 0xd02d2c, 0xd12d2a, 0xd12e29, 0xc63131, 0x7e272a, 0x1c1a0e, 0xddc340, 0xf8d71a, 0xbfac3f, 0x21242d, 0xeaece8, 0xffffff, 0xf6f5f6, 0x4d5058, 0xa0943d, 0xf5da35, 0xf4d841, 0x7b7135, 0x000000, 0x922623, 0xb32b25, 0xb92b27, 0xbb2b27, 0xc12d27, 0xc52e27, 0xc8302b, 0xca302b, 0xcc302c, 0xcd312c, 0xce312d, 0xcf312d, 0xd0312d, 0xd2302b, 0xd32f2b, 0xd3302a, 0xd4312e, 0xbd362f, 0x47000b, 0x6c632a, 0xf1db44, 0xd9c244, 0x0b000e, 0x410004, 0x942326, 0xaa2b2b, 0xbd2e2d, 0xca2f2f, 0xd12f2e, 0xd42e2b, 0xd62c29, 0xda2a29, 0xdc2829, 0xda292a, 0xdb2927, 0xd92a26, 0xd42a2a, 0xcb2a2b, 0xb42929, 0x902426, 0x530012, 0x000000, 0x786c30, 0xd6c647, 0xf8dc2d, 0xf7d903, 0xf6e039, 0x998c40, 0x1c0000, 0xae322f, 0xc92a28, 0xc72826, 0xc82827, 0xc82928, 0xc72a28, 0xc82a29, 0xc82b2a, 0xc72b2a, 0xc72a2a, 0xc72b2a, 0xc72c29, 0xc72c29, 0xc72c2a, 0xc72b29, 0xc92c29, 0xca2c28, 0xca2b27, 0xca2b27, 0xcb2a29, 0xc62c29, 0x992d26, 0x000000, 0xb6a643, 0xcbb954, 0x000007, 0xaa3234, 0xdb2b2a, 0xdf2727, 0xdd2825, 0xdc2925, 0xd92926, 0xd72c29, 0xc63832, 0x500015, 0x736928, 0xf0d52e, 0xf7d827, 0xa1912d, 0x64676f, 0xfafcf6, 0xfefff8, 0xfefdfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf6f6f6, 0x575757, 0x000000, 0x010103, 0x000000, 0x3a090a, 0xb12a2e, 0xdd2226, 0xe51f1c, 0xe61e1d, 0xe41f21, 0xe41d1f, 0xd7030d, 0xbf5554, 0xfbe7de, 0xfffffa, 0xfdfefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xeeeeee, 0x999999, 0x000000, 
-  0x000000, 0x000000, 0xefefef, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfefb, 0xfefff7, 0xedc3b8, 0xc80002, 0xe12220, 0xe12422, 0xe12422, 0xe12422, 0xe22423, 0xe42423, 0xe42423, 0xe42423, 0xe42423, 0xe42323, 0xcf0000, 0xdb9e9d, 0xfffcfb, 0xfefefb, 0xfefefd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xfdfdfd, 0xf4f2f2, 0x444a54, 0x99882f, 0xf5d62d, 0xf4d83e, 0x83753a, 0x350008, 0xc03133, 0xde2424, 0xe3211e, 0xe42224, 0xe62423, 0xe62322, 0xe32323, 0xe5221f, 0xdc2321, 0xbc2e2d, 0x0d0000, 0xaa923b, 0xf8dc2a, 0xf7da3c, 0x8e7d31, 0x7a7c83, 0x797a81, 0x7e7306, 0xf5d935, 0xf4d743, 0x7b6f36, 0x5c0016, 0xce2b2e, 0xe32221, 0xe2231f, 0xe2241e, 0xe4231f, 0xe5251f, 0xda2828, 0x8c2327, 0x212414, 0xdcbf40, 0xf8d618, 0xc6b13f, 0x191e28, 0xe6e8e6, 0xffffff, 0xeeeeec, 0x2d313e, 0xbeaf49, 0xf7dc25, 0xe9d048, 0x434320, 0x7c1620, 0xd52b28, 0xe22324, 0xe12420, 0xe12420, 0xe12420, 0xe12420, 0xe32420, 0xe4241f, 0xe4241e, 0xe5241e, 0xe5241e, 0xe6231d, 0xe6231c, 0xe8221c, 0xe8221d, 0xe9221b, 0xe7241a, 0xd82a25, 0x74001c, 0x5e5625, 0xf1da4f, 0xbfac42, 0x000000, 0xa72b2a, 0xd92727, 0xdf2322, 0xe42322, 0xe32321, 0xe32321, 0xe4221f, 0xe5221d, 0xe6211e, 0xe72120, 0xe6211f, 0xe6211d, 0xe6211c, 0xe8211e, 0xe92122, 0xe22424, 0xdc2a28, 0xcc3031, 0x9e292c, 0x340003, 0x3e3822, 0xd2bf51, 0xf7db23, 0xf7df40, 0x88813c, 0x4f000d, 0xd22f2d, 0xe82020, 0xe5221f, 0xe5221e, 0xe5231f, 0xe4221f, 0xe4221e, 0xe4221e, 0xe3211f, 0xe32220, 0xe32221, 0xe32321, 0xe32321, 0xe32221, 0xe42221, 0xe42121, 0xe42120, 0xe4211e, 0xe4211e, 0xe51f20, 0xe32225, 0xb72d2b, 0x020000, 0xb0a141, 0xd3be5b, 0x00000b, 0xb0272c, 0xe72424, 0xeb2220, 0xe82221, 0xe92120, 0xe8221f, 0xe62220, 0xd6302b, 0x570014, 0x70682a, 0xefd230, 0xf8d627, 0x9e912d, 0x67696d, 0xfbfbf6, 0xfdfff8, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe8e8e8, 0x252525, 0x000000, 0x000001, 0x1d0000, 0xa0252a, 0xd92628, 0xe1221e, 0xe2211f, 0xe12020, 0xe12021, 0xe2201e, 0xd50000, 0xc87572, 0xfff3ea, 0xfefffb, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf1f1f1, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xd0d2d0, 0xfcfcfc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefc, 0xfffff9, 0xf5d4c9, 0xc52a2a, 0xdf1d1c, 0xe12221, 0xe02422, 0xe12523, 0xe32423, 0xe22523, 0xe22423, 0xe32422, 0xe42322, 0xe32323, 0xd30000, 0xcf8683, 0xfff7f5, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xffffff, 0xd8d7d5, 0x000000, 0xcbb642, 0xf8d91e, 0xe7cd4f, 0x37371d, 0x801b28, 0xd8292d, 0xe52020, 0xe42121, 0xe42122, 0xe52121, 0xe52322, 0xe32323, 0xe32323, 0xe02322, 0xd02a27, 0x62000e, 0x635726, 0xedd437, 0xfadc28, 0xc5b04d, 0x343b48, 0x545960, 0x857721, 0xf6da31, 0xf4d83e, 0x807336, 0x5c0012, 0xd12729, 0xe52221, 0xe42323, 0xe32322, 0xe32321, 0xe42420, 0xd92828, 0x8b2026, 0x1d2612, 0xdcc13a, 0xf9d415, 0xc6af3c, 0x00061e, 0xe6e4e6, 0xffffff, 0xececec, 0x232536, 0xc6b449, 0xf6db1c, 0xe6d14b, 0x3f3f23, 0x8d1a21, 0xdd2825, 0xe6231f, 0xe5241f, 0xe4241f, 0xe4231f, 0xe2241f, 0xe1251f, 0xe42320, 0xe42321, 0xe32420, 0xe4231e, 0xe52220, 0xe62120, 0xe72120, 0xe62120, 0xe7221d, 0xe6221d, 0xd92b24, 0x77081c, 0x5e5524, 0xf2db4a, 0xbca93d, 0x0f0000, 0xbd2a2c, 0xe22223, 0xe42321, 0xe42221, 0xe52323, 0xe52323, 0xe62122, 0xe52021, 0xe5211e, 0xe62020, 0xe71f1e, 0xe7211f, 0xe72120, 0xe72120, 0xe62120, 0xe42020, 0xe42120, 0xe32324, 0xdd2829, 0xb72d2c, 0x410009, 0x4b4827, 0xe0cb4f, 0xf6e14a, 0x847c3a, 0x54000f, 0xd42b2d, 0xe9221c, 0xe6211d, 0xe6221f, 0xe6211f, 0xe5201f, 0xe4201f, 0xe52020, 0xe42020, 0xe4211f, 0xe32320, 0xe42221, 0xe92022, 0xe62123, 0xe42122, 0xe62020, 0xe5201e, 0xe7201e, 0xe7201e, 0xe8201f, 0xe12222, 0xb92b2b, 0x060000, 0xac9d3c, 0xdbc55c, 0x08000d, 0xaa2828, 0xe72425, 0xeb2121, 0xe72322, 0xe52322, 0xe52321, 0xe32420, 0xd2342e, 0x530014, 0x76702f, 0xf1d633, 0xf7d827, 0x9a8d2a, 0x6c6f74, 0xfcfcf6, 0xfcfff9, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xd0d3d0, 0x000000, 0x000000, 0x000000, 0x841f1f, 0xd12627, 0xe31f1f, 0xe22120, 0xe12120, 0xe02220, 0xe02220, 0xe0221f, 0xd00000, 0xd39492, 0xfff8f1, 0xfdfffb, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe5e5e5, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xd4d4d4, 0xf9fafa, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfffc, 0xfdfff9, 0xfce4d9, 0xc94f4b, 0xde1415, 0xe12321, 0xe12422, 0xe32523, 0xe32423, 0xe12323, 0xe32322, 0xe42322, 0xe52221, 0xe22420, 0xd40f12, 0xb86362, 0xf9f1ed, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xffffff, 0xa8a9a9, 0x3d3500, 0xe7cf41, 0xfbdc2c, 0xc7ae50, 0x000000, 0xad272f, 0xe22224, 0xe52021, 0xe42021, 0xe52120, 0xe42120, 0xe32221, 0xe32322, 0xe22323, 0xe02322, 0xdb2826, 0x932022, 0x000005, 0xd9be46, 0xfcdc23, 0xe2cd4c, 0x393621, 0x000a29, 0x85772b, 0xf6d92f, 0xf4d83f, 0x837639, 0x5a000d, 0xd12828, 0xe32222, 0xe32222, 0xe22221, 0xe32322, 0xe42421, 0xd82828, 0x8a2126, 0x192410, 0xdbc138, 0xf9d515, 0xc4ad39, 0x00001b, 0xe6e4e5, 0xffffff, 0xececec, 0x222537, 0xc5b347, 0xf6da1b, 0xe6d14a, 0x413f23, 0x8c1a22, 0xdb2727, 0xe52220, 0xe42321, 0xe42421, 0xe32320, 0xe32320, 0xe5221d, 0xe5231c, 0xe3221d, 0xe4221f, 0xe4221f, 0xe3231f, 0xe4211e, 0xe4211e, 0xe3211e, 0xe5221d, 0xe9201f, 0xdb2b25, 0x74051c, 0x635b24, 0xf4dc48, 0xbfac3d, 0x130000, 0xbc292a, 0xe12221, 0xe32322, 0xe32322, 0xe32223, 0xe42223, 0xe22321, 0xe32321, 0xe5211f, 0xe4211e, 0xe4201e, 0xe4211d, 0xe4221e, 0xe62020, 0xe52020, 0xe32221, 0xe42222, 0xe52323, 0xe32222, 0xdd2629, 0xa92e2b, 0x000000, 0x8c8240, 0xeee269, 0x7e7a3f, 0x58000f, 0xd32a2e, 0xe72121, 0xe6211d, 0xe6211e, 0xe6211e, 0xe6201f, 0xe6201f, 0xe5211f, 0xe4211f, 0xe62220, 0xe82120, 0xe52122, 0xe62121, 0xe32220, 0xe2211e, 0xe5211e, 0xe4201e, 0xe4201d, 0xe5201e, 0xe6201e, 0xe32123, 0xbb2d30, 0x000000, 0xaf9b3b, 0xe1c85c, 0x1f1711, 0xa62427, 0xe52324, 0xe9201e, 0xe62323, 0xe52323, 0xe52223, 0xe12321, 0xcf3631, 0x4b0012, 0x817935, 0xf3d633, 0xf7d829, 0x93841f, 0x787b7f, 0xfdfef7, 0xfdfffa, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefe, 0xffffff, 0xb3b1b1, 0x000000, 0x000000, 0x691619, 0xcc262c, 0xe11f1f, 0xe31f1f, 0xe12120, 0xe02220, 0xe02321, 0xdf2220, 0xe02220, 0xca0000, 0xe0afac, 0xfffdf6, 0xfdfffa, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xefefef, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0xa1a8a1, 0xf5f5f5, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefdfc, 0xfcfffa, 0xfff0e9, 0xd27371, 0xd90000, 0xe12422, 0xe22422, 0xe32322, 0xe32322, 0xe32223, 0xe42223, 0xe52322, 0xe42321, 0xe02421, 0xca292e, 0x6a191a, 0xe3dfdc, 0xfffffe, 0xfeffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xfffffe, 0xf7f7f7, 0x5b6069, 0x8c7f22, 0xf6d931, 0xfada3c, 0x92813d, 0x3d0009, 0xc9282f, 0xe32120, 0xe52021, 0xe62020, 0xe5201f, 0xe2211e, 0xe12321, 0xe22321, 0xe32322, 0xe22423, 0xe02422, 0xb92d29, 0x080000, 0xaf9b48, 0xfadf36, 0xf5de44, 0x877b3f, 0x000000, 0x807528, 0xf5d82b, 0xf4d93e, 0x867a3b, 0x58000a, 0xd02827, 0xe32221, 0xe22122, 0xe22221, 0xe32322, 0xe42421, 0xd72727, 0x8a2127, 0x192510, 0xdcc138, 0xf7d515, 0xc2ad38, 0x00001d, 0xe6e5e6, 0xffffff, 0xededed, 0x252a3b, 0xc3b245, 0xf6d91a, 0xe8d148, 0x454222, 0x8c1a24, 0xdb2729, 0xe52120, 0xe42220, 0xe42321, 0xe32321, 0xe42421, 0xe22322, 0xe12322, 0xe4221f, 0xe3221e, 0xdf241f, 0xe3221e, 0xe3211e, 0xe4211e, 0xe2211d, 0xe12318, 0xe12117, 0xd23028, 0x68001d, 0x716723, 0xf6dd43, 0xbfac3f, 0x120000, 0xbb2829, 0xe12222, 0xe32322, 0xe32322, 0xe22221, 0xe42122, 0xe32222, 0xde2626, 0xd9282c, 0xd4292a, 0xd52b2a, 0xdc2828, 0xdf2725, 0xe12624, 0xe22323, 0xe22322, 0xe42222, 0xe52323, 0xe52223, 0xe2221e, 0xd42a29, 0x7b181f, 0x0b0500, 0xdccf7b, 0x84814e, 0x5b0006, 0xd02a29, 0xe4211e, 0xe42120, 0xe52121, 0xe52120, 0xe5211f, 0xe52020, 0xe42120, 0xe5221e, 0xe62320, 0xe62221, 0xe52222, 0xe42220, 0xe5211d, 0xe6211f, 0xe52120, 0xe42021, 0xe42021, 0xe42021, 0xe52020, 0xe02422, 0xb53132, 0x000000, 0xb49f3d, 0xe6cc5d, 0x322c18, 0xa22128, 0xe42424, 0xe8201f, 0xe52323, 0xe52424, 0xe52323, 0xe12421, 0xcd3633, 0x410011, 0x8e833b, 0xf6d731, 0xf6d82c, 0x897b15, 0x878a8c, 0xfffffb, 0xfefffb, 0xfefdfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfefefd, 0x918f91, 0x000000, 0x530d0e, 0xbd2627, 0xe41f21, 0xe41f1c, 0xe52020, 0xdf2421, 0xe12422, 0xe02422, 0xdf2321, 0xdf201f, 0xc31a1f, 0xedcec8, 0xfffff9, 0xfdfffc, 0xfffefe, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xd8d8d8, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xf0f1f1, 0xfefefe, 0xffffff, 0xffffff, 0xfefffe, 0xfefdfb, 0xfefdf8, 0xfff9f8, 0xde9c9b, 0xd20000, 0xe12422, 0xe32322, 0xe32322, 0xe32322, 0xe42321, 0xe52121, 0xe42222, 0xe22422, 0xd22e2c, 0x892426, 0x000000, 0xc5c4c2, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xdededf, 0x000000, 0xc4b03e, 0xfbda22, 0xeccf48, 0x4c4622, 0x790c1c, 0xd8282b, 0xe52120, 0xe62020, 0xe72122, 0xe22021, 0xde2221, 0xe02322, 0xe22322, 0xe32322, 0xe32322, 0xe22220, 0xcf2c29, 0x65000f, 0x716735, 0xf2d949, 0xfbdf30, 0xc2b352, 0x000000, 0x7b7026, 0xf5d72d, 0xf5da3c, 0x897d3d, 0x57000a, 0xcf2929, 0xe32222, 0xe32223, 0xe22122, 0xe32322, 0xe32321, 0xd72728, 0x8a2126, 0x1a2510, 0xdcc139, 0xf8d616, 0xc1ac36, 0x00001f, 0xe7e6e7, 0xffffff, 0xeeeeef, 0x2a2f3f, 0xc1b143, 0xf7da19, 0xebd245, 0x494522, 0x8c1b24, 0xdc2829, 0xe62121, 0xe42222, 0xe52322, 0xe42323, 0xe42322, 0xdf2723, 0xcf2d28, 0xc72d2c, 0xc92b29, 0xc62c27, 0xc52c28, 0xc72b28, 0xc72b28, 0xc62c29, 0xc82f2b, 0xc43231, 0xae3a37, 0x36000f, 0x8c7c2b, 0xf8dc3a, 0xc1ad40, 0x100000, 0xb82729, 0xe12322, 0xe32122, 0xe22221, 0xe22221, 0xe42222, 0xe32524, 0xc12928, 0x6f1617, 0x5e000f, 0x650013, 0x7c0019, 0x9d2326, 0xc32b2c, 0xdc2528, 0xe12323, 0xe32223, 0xe52424, 0xe42323, 0xe4221f, 0xe02126, 0xad2a29, 0x000000, 0xbdb674, 0x958f5a, 0x4f0006, 0xc63638, 0xd72a2c, 0xd72a2a, 0xd72a29, 0xd72929, 0xd82927, 0xd82828, 0xda2625, 0xe42523, 0xe72321, 0xe52422, 0xe52322, 0xe42220, 0xe32322, 0xd82726, 0xd22b29, 0xd52a2a, 0xd32a29, 0xd32a29, 0xd32a29, 0xcc2f2f, 0xaa3a3f, 0x000000, 0xc4ae45, 0xe8d25a, 0x3e3d20, 0x9d1d28, 0xe22625, 0xe92020, 0xe52424, 0xe52423, 0xe62223, 0xe02421, 0xc93632, 0x35000b, 0x9a8d42, 0xf7d82e, 0xf4d72e, 0x7f7101, 0x949796, 0xfffffd, 0xfefffe, 0xfefdfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xf8f7f6, 0x646667, 0x340000, 0xb52627, 0xe02222, 0xe2221b, 0xe3221e, 0xe52121, 0xe02521, 0xe22523, 0xe12422, 0xe02321, 0xdd1918, 0xc34b4a, 0xf8e7e1, 0xfffffc, 0xfdfffc, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xf9f9f9, 0xdddddd, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xefefef, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfeffff, 0xfefefb, 0xfcfdfa, 0xfffefc, 0xeec1bd, 0xcd0008, 0xe2211f, 0xe52121, 0xe42222, 0xe42221, 0xe52220, 0xe3211e, 0xe12221, 0xd82929, 0xa12727, 0x150100, 0x000000, 0x9b9d9c, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xb2b2b3, 0x271900, 0xe6cd3e, 0xfbda1f, 0xd1ba4d, 0x000001, 0xa02527, 0xde2325, 0xe91f1e, 0xe71f1f, 0xe61f21, 0xdf1f21, 0xc91e20, 0xd52223, 0xe32221, 0xe42221, 0xe42222, 0xe32320, 0xdb2528, 0x971f23, 0x181210, 0xe0c54e, 0xfbde1e, 0xe1cf4b, 0x251e17, 0x776c27, 0xf5d731, 0xf5da39, 0x8d803c, 0x53000b, 0xce2829, 0xe32222, 0xe32122, 0xe22122, 0xe22222, 0xe32320, 0xd72728, 0x8a2126, 0x1e2611, 0xddc23a, 0xf9d717, 0xc2ac35, 0x000021, 0xe7e6e7, 0xffffff, 0xefefef, 0x2f3343, 0xbfb044, 0xf7da1b, 0xebd240, 0x4c4820, 0x8b1822, 0xdb2727, 0xe52020, 0xe42222, 0xe42222, 0xe52323, 0xe52322, 0xd42c2a, 0x7f1d1a, 0x3e0009, 0x340000, 0x360003, 0x390006, 0x3b0007, 0x3b0007, 0x3c0009, 0x3f000c, 0x3e0013, 0x230008, 0x000000, 0xb29f3c, 0xf8db30, 0xc1ae40, 0x090000, 0xb72628, 0xe12222, 0xe32122, 0xe22222, 0xe22321, 0xe22422, 0xe02725, 0xad2829, 0x000000, 0x5d5832, 0x776f30, 0x62582b, 0x0a050b, 0x5a000b, 0xbc2928, 0xdf2525, 0xe02323, 0xe32223, 0xe22422, 0xe12322, 0xe22023, 0xc62c2f, 0x3a0000, 0x9c9254, 0xbaad66, 0x000000, 0x67051f, 0x7b1723, 0x7a1021, 0x790f1e, 0x790b1d, 0x7a161c, 0x8a201e, 0xc62b2a, 0xe22524, 0xe92221, 0xe62322, 0xe52221, 0xe32220, 0xdd2524, 0xb52827, 0x7a1d1b, 0x72101b, 0x6f061a, 0x6f081b, 0x6f081b, 0x660c1d, 0x400018, 0x0e0013, 0xddc24d, 0xedd355, 0x484927, 0x941825, 0xe22627, 0xe9211f, 0xe42322, 0xe32222, 0xe62122, 0xe02320, 0xc5332f, 0x260003, 0xa39644, 0xf7d829, 0xf3d532, 0x746600, 0x9da09e, 0xfffffd, 0xfffefc, 0xfffdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe6e5e6, 0x2b2524, 0xa0191e, 0xda2524, 0xe32120, 0xe3221f, 0xe42221, 0xe22221, 0xe22421, 0xe22423, 0xdf2422, 0xdf2220, 0xd70000, 0xc9736f, 0xfef4ee, 0xfffef9, 0xfcfefb, 0xfefeff, 0xffffff, 0xffffff, 0xffffff, 0xf6f6f6, 0xadadad, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xdedede, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefd, 0xfcfefe, 0xfefefb, 0xf8dbd5, 0xcd3b41, 0xe01a18, 0xe7211d, 0xe5211f, 0xe62220, 0xe72122, 0xe4221f, 0xda2a2b, 0xa52d2f, 0x360405, 0x000000, 0x000000, 0x686868, 0xf7f8f8, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0x777a7f, 0x84771d, 0xf5d733, 0xfad831, 0xa79343, 0x150000, 0xbc2a2b, 0xe32122, 0xe81f1d, 0xe92020, 0xe72121, 0xdb2524, 0x921b1a, 0xb32224, 0xe12624, 0xe4201e, 0xe61f23, 0xe3211f, 0xe12223, 0xb7292b, 0x000000, 0xb3a045, 0xf7dd2c, 0xf4da43, 0x746934, 0x756923, 0xf4d731, 0xf4d934, 0x8f8238, 0x50000c, 0xcc2728, 0xe32122, 0xe32122, 0xe22122, 0xe32322, 0xe32220, 0xd82727, 0x892126, 0x232612, 0xdec23b, 0xf9d716, 0xc3ac34, 0x000224, 0xe8e7e8, 0xffffff, 0xf0f0f0, 0x343645, 0xbdb044, 0xf7da1d, 0xebd23d, 0x4e4a1f, 0x87131f, 0xdb2629, 0xe42020, 0xe32121, 0xe42222, 0xe52323, 0xe52222, 0xd32c2b, 0x620511, 0x48442e, 0x908048, 0x8b7c39, 0x8b7c38, 0x8b7c38, 0x8b7d38, 0x8b7c38, 0x8a7b39, 0x887931, 0x8c7f38, 0xae9f45, 0xe5ce3c, 0xf5d81e, 0xc2b03f, 0x000001, 0xb62525, 0xe12322, 0xe12223, 0xe12323, 0xe12422, 0xe22321, 0xde2626, 0xa92829, 0x000000, 0xbfb05d, 0xf2da43, 0xeed242, 0xc9b757, 0x32371d, 0x780d16, 0xd32d2c, 0xe02422, 0xe52122, 0xe22220, 0xe32221, 0xe32020, 0xcc2a2d, 0x63001b, 0x74682d, 0xe4d15d, 0xa59540, 0x5b5221, 0x49441f, 0x4b461f, 0x4b4621, 0x4c4925, 0x28311d, 0x1c0006, 0xb93030, 0xe22424, 0xe72321, 0xe52322, 0xe42223, 0xe12222, 0xdc2625, 0x9e2728, 0x000000, 0x3f412b, 0x514f29, 0x4f4b27, 0x4e4c24, 0x5a532a, 0x6c642f, 0xbaab46, 0xf1d833, 0xead34e, 0x504f29, 0x8a1523, 0xe1262a, 0xe92120, 0xe52321, 0xe52324, 0xe8211f, 0xe22320, 0xc0302c, 0x0d0000, 0xada140, 0xf7d921, 0xf0d436, 0x645800, 0xacadad, 0xfffffc, 0xfefef8, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffd, 0xfefffd, 0xffffff, 0xffffff, 0xffffff, 0xcdc6c8, 0x780000, 0xd2262a, 0xe1211f, 0xe32121, 0xe22221, 0xe32322, 0xe32322, 0xe22321, 0xe32222, 0xdf2422, 0xe3211f, 0xd20000, 0xd59895, 0xfffcf7, 0xfffef6, 0xfcfdfb, 0xfefeff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xececec, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xcbcbcb, 0xf7f7f7, 0xfdfdfd, 0xffffff, 0xfeffff, 0xfdfefd, 0xfdfefd, 0xfdfefd, 0xfeeee9, 0xcf6769, 0xdb0604, 0xe7231b, 0xe7211c, 0xe5211e, 0xe42320, 0xde2626, 0xb12b2d, 0x431010, 0x000000, 0x000401, 0x000000, 0x1d1d1e, 0xe6e7e6, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe9ebe9, 0x00192b, 0xc3ae3f, 0xfad61a, 0xf0d242, 0x665b2e, 0x630011, 0xd22927, 0xe71e23, 0xe81f20, 0xe81e20, 0xe5211e, 0xcc2829, 0x581211, 0x8e2021, 0xd82727, 0xe61f1d, 0xe62022, 0xe5211f, 0xe32020, 0xd02a2e, 0x54000d, 0x766b2f, 0xf2d63a, 0xfade2d, 0xb09f45, 0x766822, 0xf3d82f, 0xf5da33, 0x928539, 0x50000c, 0xcc2729, 0xe32122, 0xe32122, 0xe22122, 0xe32322, 0xe32320, 0xd82727, 0x882025, 0x232612, 0xdec23b, 0xf9d718, 0xc1ac35, 0x000424, 0xe8e7e8, 0xffffff, 0xf0f0f0, 0x373948, 0xbcad41, 0xf7d91c, 0xecd23d, 0x524e21, 0x85111e, 0xda2629, 0xe52021, 0xe32121, 0xe32121, 0xe52323, 0xe52222, 0xd52b2b, 0x600008, 0x8a7e48, 0xf3dc59, 0xf1d437, 0xeecf35, 0xecce32, 0xecce31, 0xecce30, 0xecd133, 0xedd32d, 0xeed52f, 0xf1d827, 0xf3d611, 0xf6d817, 0xc4b23c, 0x000001, 0xb32526, 0xdf2422, 0xe02322, 0xe02322, 0xe12422, 0xe22422, 0xdf2629, 0xa9282d, 0x000000, 0xc7b54d, 0xfadb21, 0xf6d900, 0xf6d942, 0x9b8a4b, 0x2b0000, 0xc23033, 0xe32324, 0xe32120, 0xe42022, 0xe61f20, 0xe1211d, 0xd2262a, 0x770c23, 0x605429, 0xedd442, 0xf6d92e, 0xeccf3c, 0xe7cd40, 0xeacd3e, 0xebcc3e, 0xe9d04b, 0xb3a457, 0x000000, 0xb43130, 0xdf2423, 0xe62220, 0xe52322, 0xe52122, 0xe22221, 0xdb2625, 0x9b2427, 0x000009, 0xc7b760, 0xe8ce49, 0xe8c944, 0xe7ca42, 0xeace43, 0xf0d43d, 0xf8d82c, 0xf7d810, 0xebd748, 0x57562a, 0x810c20, 0xde272a, 0xea1f1f, 0xe42321, 0xe52323, 0xe9211f, 0xe32321, 0xbb2d2b, 0x000000, 0xb7a742, 0xf9d91e, 0xedd239, 0x514600, 0xbabbb9, 0xfffffd, 0xfefefb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffffe, 0xfeffff, 0xffffff, 0xffffff, 0xbe9d9d, 0xbf0000, 0xe12021, 0xe3201d, 0xe22321, 0xe22221, 0xe22422, 0xe22523, 0xe12423, 0xe22222, 0xe1211f, 0xe51f1e, 0xca0000, 0xe4bab5, 0xfffff9, 0xfdfef6, 0xfcfdfc, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xe2e2e2, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0xb0b0b0, 0xf3f3f3, 0xfdfdfd, 0xffffff, 0xffffff, 0xfdfffe, 0xfefefd, 0xfcfefe, 0xfffaf7, 0xd79190, 0xd60000, 0xe9211a, 0xeb1e1a, 0xe8201e, 0xe32524, 0xbf2e2f, 0x541210, 0x000000, 0x020101, 0x010103, 0x000002, 0x000000, 0xc7c8c8, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xbbbbbd, 0x2d2400, 0xe8cd40, 0xfad610, 0xd6bf47, 0x00000d, 0x952324, 0xdf2422, 0xe61f20, 0xe51f21, 0xe61f20, 0xe3211f, 0xb8292c, 0x1e0404, 0x6d181b, 0xd3282b, 0xea1e1d, 0xe52021, 0xe52020, 0xe51f1d, 0xdf2628, 0x88161e, 0x2d2a17, 0xe0c73f, 0xfcdf1c, 0xd8c24b, 0x867429, 0xf4d72b, 0xf5d930, 0x95873a, 0x4e0009, 0xcb2728, 0xe32122, 0xe32122, 0xe22122, 0xe42323, 0xe32320, 0xd92728, 0x871f24, 0x252712, 0xdec33b, 0xf9d819, 0xc0ac35, 0x000022, 0xe7e6e7, 0xffffff, 0xf1f1f1, 0x3a3c4a, 0xbbab3f, 0xf9d81c, 0xedd13c, 0x554f21, 0x84111e, 0xd92629, 0xe52021, 0xe42122, 0xe42222, 0xe52222, 0xe42221, 0xd32c27, 0x620005, 0x827649, 0xdfc85c, 0xdcc23f, 0xdac03c, 0xd8be39, 0xd7be37, 0xd9c037, 0xdbc236, 0xe3cc36, 0xefd722, 0xf5d80d, 0xf5d710, 0xf7d713, 0xc7b43d, 0x000002, 0xb02524, 0xdf2523, 0xe02222, 0xe02222, 0xe22321, 0xe22321, 0xde2628, 0xaa292f, 0x000001, 0xccb74e, 0xfadb20, 0xf8d702, 0xf9db31, 0xab9950, 0x170000, 0xbe2e32, 0xe42124, 0xe32120, 0xe42022, 0xe51f20, 0xe2201c, 0xd32629, 0x770622, 0x5b5526, 0xebd43b, 0xfbd613, 0xfadb2d, 0xf9de2c, 0xf8dd21, 0xfbd809, 0xfadb22, 0xc3b04e, 0x000004, 0xb02f2f, 0xdf2525, 0xe72221, 0xe52322, 0xe42222, 0xe32220, 0xdb2524, 0x9a2227, 0x00000d, 0xd3bd47, 0xfcd618, 0xfad309, 0xf9d719, 0xf7db1a, 0xf9da1f, 0xfbd616, 0xfad606, 0xf0d941, 0x63602b, 0x78001f, 0xdb292a, 0xeb1e1e, 0xe62221, 0xe62220, 0xea201d, 0xe22423, 0xb42929, 0x000000, 0xc2ae3f, 0xfcd918, 0xe9cf3e, 0x3a2e00, 0xc6c8c3, 0xfffffd, 0xfffffd, 0xfdfefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xffffff, 0xfdfefe, 0xfefefd, 0xfef5f2, 0xc0706f, 0xd20000, 0xe31f1d, 0xe4211f, 0xe12522, 0xe12422, 0xe12422, 0xe12422, 0xe12422, 0xe22221, 0xe3201e, 0xe11b1d, 0xbf2929, 0xf1d6d1, 0xfffffa, 0xfdfef8, 0xfdfdfe, 0xfdfefd, 0xffffff, 0xfefefe, 0xfafafa, 0xdadada, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xeeeeee, 0xfdfdfd, 0xfefefe, 0xfffeff, 0xfefefe, 0xfdfefc, 0xfbfefc, 0xfffefb, 0xe4b6b2, 0xcc0000, 0xe8211a, 0xeb201b, 0xe32321, 0xce3233, 0x6f1f1f, 0x000000, 0x000202, 0x010201, 0x010001, 0x020302, 0x000000, 0x9b9a9b, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfb, 0x73747a, 0x7f7315, 0xf3d632, 0xf9d82d, 0xaa9945, 0x000000, 0xb82a2d, 0xe71f21, 0xe7201e, 0xe81e21, 0xe7201f, 0xe12322, 0x9e272a, 0x000000, 0x470f11, 0xc32a2c, 0xe81e1c, 0xe5201f, 0xe71e21, 0xe81e1d, 0xe22223, 0xad272c, 0x000000, 0xbfab46, 0xfbde2b, 0xeed73c, 0xa18c2e, 0xf3d424, 0xf6da30, 0x988a3c, 0x4a0006, 0xca2728, 0xe32122, 0xe32122, 0xe22122, 0xe32322, 0xe32321, 0xd92829, 0x881e24, 0x272913, 0xdfc33c, 0xf9d91a, 0xbfac35, 0x000020, 0xe7e6e7, 0xffffff, 0xf2f2f2, 0x3b3d4b, 0xbbab3e, 0xf9d81c, 0xedd13c, 0x565022, 0x820f1d, 0xd92629, 0xe51f21, 0xe42222, 0xe42222, 0xe32121, 0xe42120, 0xd52a29, 0x6c1517, 0x000f08, 0x362f1c, 0x353017, 0x353115, 0x363114, 0x363214, 0x393415, 0x3c3415, 0x554c1c, 0xbba940, 0xf1d82c, 0xf4d60c, 0xf6d614, 0xc9b542, 0x000003, 0xae2322, 0xe02423, 0xe12122, 0xe22122, 0xe32121, 0xe42223, 0xde2727, 0xa8292b, 0x000004, 0xd1bf51, 0xfade20, 0xfdda25, 0xf0d64f, 0x726937, 0x520005, 0xc82d2e, 0xe12022, 0xe32121, 0xe32121, 0xe22121, 0xe51e1d, 0xd0282a, 0x670019, 0x6d612c, 0xf2d43d, 0xf6d525, 0xccb543, 0xb39e43, 0xc1ae40, 0xf2d433, 0xfbdb22, 0xc4ae4d, 0x000005, 0xb12f30, 0xe12526, 0xe82221, 0xe52221, 0xe42222, 0xe42120, 0xde2524, 0x9b2126, 0x00000d, 0xd5bb48, 0xfdd61e, 0xe7ca30, 0xb5a133, 0xb7a12f, 0xad992d, 0xd5bd2f, 0xf7d912, 0xf4d83e, 0x756d32, 0x6c001b, 0xd82c2b, 0xeb1f1f, 0xe92121, 0xe92120, 0xea201c, 0xe12524, 0xad2626, 0x000004, 0xccb742, 0xfdd813, 0xe2c93d, 0x211300, 0xcfd0ca, 0xfffffc, 0xfffffe, 0xfdfefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xfdfffe, 0xfdfefd, 0xfffefc, 0xf3dcdb, 0xbc3738, 0xe01716, 0xe61e20, 0xe32220, 0xe22522, 0xe12523, 0xe12422, 0xe02522, 0xe22422, 0xe42222, 0xe3211f, 0xd80c14, 0xc15b5b, 0xfceae7, 0xfffefa, 0xfefef9, 0xfdfdfe, 0xfdfefc, 0xfefefe, 0xfefefe, 0xf7f7f7, 0xcecece, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e1, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfffffe, 0xf2d9d6, 0xc12d2b, 0xe41c1b, 0xe2241e, 0xd23030, 0x892829, 0x000000, 0x000003, 0x020101, 0x000100, 0x000000, 0x010101, 0x000000, 0x565555, 0xf4f4f4, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefffe, 0xfffffd, 0xe7e5e8, 0x00001f, 0xb7a23b, 0xf7d722, 0xf0d33e, 0x6d6130, 0x530013, 0xce2a2d, 0xe71e1f, 0xe81e21, 0xe71d22, 0xe61f1c, 0xd92826, 0x802320, 0x000000, 0x0c0000, 0xb22b2c, 0xe52223, 0xe82020, 0xe81e21, 0xe81e20, 0xe52020, 0xc42c2b, 0x3a0003, 0x8b7f3b, 0xf4da39, 0xf6db25, 0xd4b829, 0xf1cf13, 0xf7d82f, 0x9b8d3c, 0x430007, 0xca2828, 0xe42222, 0xe22322, 0xe02321, 0xe12422, 0xe32321, 0xd92829, 0x881f24, 0x262a14, 0xdfc43d, 0xf9d91a, 0xc0ac38, 0x00001c, 0xe6e5e6, 0xffffff, 0xf2f2f2, 0x3b3f4c, 0xbba93d, 0xf7d71b, 0xecd13c, 0x575023, 0x810b1b, 0xd92629, 0xe52020, 0xe32322, 0xe32322, 0xe32322, 0xe42322, 0xda2626, 0xa52525, 0x7d2224, 0x811e25, 0x882023, 0x8a1f24, 0x891e24, 0x8a1f24, 0x8a1f25, 0x87252a, 0x580020, 0x221715, 0xd9c148, 0xf7d513, 0xf7d516, 0xccb545, 0x000004, 0xad2124, 0xe12425, 0xe32223, 0xe42222, 0xe42222, 0xe32323, 0xde2724, 0xa72b2e, 0x000000, 0xc1b467, 0xe1d15c, 0xcfb755, 0x84723c, 0x000000, 0x9a2222, 0xd72727, 0xe22022, 0xe32221, 0xe32121, 0xe32020, 0xe31f20, 0xc5272b, 0x400006, 0x907f36, 0xf7d732, 0xefd539, 0x69632b, 0x000000, 0x3d3623, 0xe7cf46, 0xfadb20, 0xc3ae4c, 0x000005, 0xb12f30, 0xe02324, 0xe7201f, 0xe52120, 0xe42121, 0xe42020, 0xdb2526, 0x9a2228, 0x00010e, 0xd4bd48, 0xfbd924, 0xd1b63c, 0x000000, 0x3c414d, 0x00001b, 0x9a8a39, 0xf6d52a, 0xf4d637, 0x887a38, 0x5b0012, 0xd5292b, 0xea1e1e, 0xe92020, 0xe7201f, 0xe91f1d, 0xe22526, 0xa22728, 0x080910, 0xd8c047, 0xfdd70e, 0xdbbf3b, 0x000000, 0xdcddd7, 0xfffffc, 0xfffefe, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffefe, 0xfbfefe, 0xfafefb, 0xfdfdfa, 0xfffef9, 0xe2b6b5, 0xbf0000, 0xe41c1d, 0xe61f1f, 0xe22121, 0xe12422, 0xe12422, 0xe12422, 0xe12422, 0xe22323, 0xe62022, 0xe2211f, 0xcc0001, 0xce8d8c, 0xfff8f4, 0xfefef9, 0xfefffc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xf0f0f0, 0x636363, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xd2d2d2, 0xf9f9f9, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xfdf0ed, 0xc36763, 0xd10806, 0xd62d2e, 0x972627, 0x1c0000, 0x000100, 0x010101, 0x020001, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdbdbdb, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefdfe, 0xfdfefe, 0xffffff, 0xc0c0c1, 0x000000, 0xddc343, 0xfbd815, 0xdbc146, 0x0b140e, 0x8a2026, 0xdc272a, 0xe61f1c, 0xe71e21, 0xe61e21, 0xe4211e, 0xce2a2d, 0x560000, 0x5d5d52, 0x393e36, 0x961d1f, 0xe12526, 0xea1f22, 0xe6201e, 0xe91e1f, 0xe71e1e, 0xd5292a, 0x791723, 0x3f3d1e, 0xe7ce47, 0xfcd80f, 0xf6d217, 0xf6d001, 0xf7d82f, 0x9c8f3c, 0x3e0005, 0xc92727, 0xe32222, 0xe22422, 0xe02321, 0xe12422, 0xe22321, 0xd8292a, 0x871f24, 0x272b14, 0xdec33c, 0xf9d81a, 0xbfab38, 0x00001c, 0xe6e5e6, 0xffffff, 0xf3f2f2, 0x3c404d, 0xbba93d, 0xf7d71c, 0xecd13c, 0x585123, 0x810b1b, 0xda2629, 0xe42020, 0xe22221, 0xe32322, 0xe32322, 0xe32322, 0xdf2523, 0xd62624, 0xd32627, 0xd42524, 0xd52822, 0xd52822, 0xd62923, 0xd62923, 0xd72923, 0xd32c27, 0xa43233, 0x000000, 0xc1ae4f, 0xf4d522, 0xf8d415, 0xcdb546, 0x000004, 0xac2024, 0xe12425, 0xe32223, 0xe42222, 0xe32322, 0xe42322, 0xde2724, 0xa32828, 0x000000, 0x19251c, 0x252920, 0x000000, 0x2e0000, 0x8f2124, 0xce292a, 0xdd2222, 0xe22121, 0xe2211f, 0xe52020, 0xe4201f, 0xdd2325, 0xa72326, 0x000000, 0xbda44c, 0xf7d725, 0xe6ce49, 0x4d4626, 0x161d2d, 0x4b452b, 0xe7cf48, 0xfadb21, 0xc3ae4c, 0x000005, 0xb12f30, 0xe02324, 0xe6201f, 0xe52120, 0xe42121, 0xe42020, 0xda2425, 0x982228, 0x00030e, 0xd3bc46, 0xfbd821, 0xd6b93f, 0x000000, 0xd1d1d1, 0x76787e, 0x857622, 0xf5d433, 0xf5d633, 0x97863d, 0x480006, 0xce282a, 0xe81e1e, 0xe81f1f, 0xe71f1e, 0xe71e1c, 0xdf2628, 0x982428, 0x32301c, 0xe1c748, 0xfcd70f, 0xd1b73c, 0x030e24, 0xe8e8e4, 0xfffffd, 0xfefefe, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefdfd, 0xfefbfc, 0xfbfdfb, 0xfdfbfb, 0xfff7f2, 0xcd8586, 0xce0000, 0xe5201e, 0xe3201e, 0xe32222, 0xe22423, 0xe22423, 0xe22422, 0xe12422, 0xe12323, 0xe12221, 0xdf2120, 0xc50004, 0xe4bbb7, 0xfffefa, 0xfdfdfa, 0xfdfefc, 0xfffdfe, 0xfefdfe, 0xfefefe, 0xffffff, 0xe5e5e5, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0xaeaeae, 0xf3f3f3, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffcfa, 0xd39f9a, 0xc10000, 0xa52a30, 0x220101, 0x000000, 0x000202, 0x020000, 0x010002, 0x000103, 0x000000, 0x000000, 0x010101, 0x000000, 0xafafaf, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefdfd, 0xfdffff, 0x888b8c, 0x655700, 0xf2d232, 0xfcd92a, 0xb7a149, 0x000000, 0xb42729, 0xe52124, 0xe61f1c, 0xe51f1f, 0xe61e21, 0xe22122, 0xbd2b34, 0x000000, 0xb3a77d, 0x827b5b, 0x6a0000, 0xd92829, 0xec1d21, 0xe7201c, 0xe71f1f, 0xe62220, 0xdf2426, 0xa32d30, 0x000000, 0xc8b74a, 0xfddb19, 0xfcd602, 0xfad200, 0xf7d72e, 0x9d8f3d, 0x3c0003, 0xc82727, 0xe32222, 0xe22422, 0xe02422, 0xe22523, 0xe32421, 0xd82a2a, 0x861f24, 0x292c15, 0xdfc43e, 0xf9d81c, 0xc0ac3b, 0x00001c, 0xe6e5e6, 0xffffff, 0xf3f2f3, 0x3d414e, 0xbdaa3f, 0xf9d71e, 0xedd03c, 0x585022, 0x810a1b, 0xd92629, 0xe42021, 0xe32322, 0xe32322, 0xe32322, 0xe32322, 0xe52120, 0xe6201d, 0xe41f1a, 0xe2201b, 0xe2201d, 0xe3201f, 0xe42120, 0xe42120, 0xe52120, 0xe02522, 0xae302f, 0x000000, 0xc1ad52, 0xf6d520, 0xf8d415, 0xcfb546, 0x000006, 0xab2023, 0xe12425, 0xe32222, 0xe42222, 0xe32222, 0xe32321, 0xe02327, 0xc5242a, 0x9a201f, 0x991c23, 0x9b1d26, 0xa92627, 0xc32729, 0xd92526, 0xe02220, 0xe22121, 0xe12120, 0xe2201f, 0xe3201f, 0xde2221, 0xcb2c29, 0x670115, 0x413923, 0xe4c650, 0xf3d61b, 0xcebb52, 0x000015, 0x7a7c79, 0x474329, 0xe6cf48, 0xfbdb22, 0xc2ae4c, 0x000004, 0xb02e2e, 0xe02324, 0xe6201f, 0xe5201f, 0xe42020, 0xe51f20, 0xdb2424, 0x982228, 0x00060e, 0xd4bd45, 0xfcd71f, 0xd6b93e, 0x000000, 0xdcdcdb, 0x98999c, 0x6d6000, 0xf2d336, 0xf8d62d, 0xa7933f, 0x330002, 0xc62b2b, 0xe51e20, 0xe81f1f, 0xe81f1e, 0xe61e1c, 0xd9292b, 0x851620, 0x4f4a28, 0xebce45, 0xfcd916, 0xc4ae40, 0x212638, 0xededeb, 0xfefefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefdfc, 0xfafefd, 0xfefdfd, 0xf9e3de, 0xc2494c, 0xde1011, 0xe3201d, 0xe22120, 0xe42221, 0xe42423, 0xe42423, 0xe32322, 0xe32322, 0xe32222, 0xe22221, 0xde1a1c, 0xc23237, 0xf4dbd7, 0xfffffd, 0xfefefc, 0xfefefd, 0xfffdfe, 0xfffefe, 0xfefefe, 0xfcfcfc, 0xd9d9d9, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xeaeaea, 0xffffff, 0xfffffe, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xead0cd, 0xa0292e, 0x46080c, 0x000000, 0x000101, 0x010001, 0x020100, 0x010102, 0x000102, 0x000000, 0x000000, 0x000000, 0x000000, 0x707070, 0xf8f8f8, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfffffe, 0xf1f2f1, 0x343c48, 0xa4922b, 0xf9d623, 0xf4d542, 0x7f703b, 0x4f0008, 0xce2729, 0xe51f22, 0xe61f1f, 0xe3201e, 0xe51f21, 0xde262a, 0xa1272e, 0x000000, 0xe0ce73, 0xb4a55d, 0x2e0000, 0xc42b2b, 0xe92220, 0xea2022, 0xe52021, 0xe72221, 0xdf221f, 0xc13433, 0x340006, 0x988b3d, 0xfad931, 0xfbd500, 0xfcd100, 0xf7d72d, 0x9e903d, 0x3b0002, 0xc82729, 0xe42323, 0xe22422, 0xe02422, 0xe12523, 0xe32422, 0xd72a2a, 0x841e23, 0x2b2e16, 0xdfc43e, 0xf9d71f, 0xbfab3d, 0x00001b, 0xe6e5e6, 0xffffff, 0xf4f3f3, 0x3f4350, 0xbca93e, 0xfad71f, 0xeecf3c, 0x595023, 0x820a1a, 0xd92528, 0xe41f20, 0xe42322, 0xe42322, 0xe32322, 0xe32322, 0xe3221f, 0xe31f1d, 0xe1201d, 0xe11f1d, 0xe51e1d, 0xe61f1c, 0xe61f1c, 0xe7201d, 0xe8211d, 0xe3241f, 0xb42e2c, 0x000000, 0xc4ae4e, 0xf9d423, 0xf8d315, 0xd1b447, 0x000007, 0xab2122, 0xe02424, 0xe32222, 0xe42222, 0xe32222, 0xe3241f, 0xe4211e, 0xe32024, 0xde2425, 0xdf2525, 0xe22325, 0xe22223, 0xe22322, 0xe72021, 0xe32121, 0xe3211f, 0xe12020, 0xe22021, 0xde221e, 0xd22b2b, 0x932526, 0x000000, 0xae9c4a, 0xf1d538, 0xf2d941, 0x9b8d43, 0x575b60, 0xb1b3b1, 0x343000, 0xe6cf4a, 0xfbda22, 0xc3ae4c, 0x000003, 0xaf2d2d, 0xdf2323, 0xe61f1e, 0xe5201f, 0xe42020, 0xe51e1f, 0xdb2325, 0x972227, 0x00070f, 0xd5bd44, 0xfdd71d, 0xd7b93e, 0x000000, 0xdededd, 0xadadae, 0x534900, 0xedd037, 0xf9d525, 0xb49f40, 0x190001, 0xbc2a29, 0xe52023, 0xe71e1e, 0xe81e1d, 0xe51e1c, 0xd42c2e, 0x710018, 0x655e2d, 0xf3d341, 0xfcda1f, 0xb7a33e, 0x40434f, 0xf2f2ef, 0xfffffb, 0xfefefb, 0xfdfcfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfefb, 0xfcffff, 0xfffefb, 0xe9beb8, 0xc60000, 0xe31c1c, 0xe1201f, 0xe22122, 0xe32220, 0xe32322, 0xe32322, 0xe32322, 0xe32322, 0xe42322, 0xe72022, 0xd90108, 0xca6a69, 0xfeefec, 0xfffffe, 0xfefefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xf9f9f9, 0xcecece, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe4e4e4, 0xfdfdfd, 0xfefefe, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xf6eceb, 0x684b49, 0x000000, 0x030102, 0x010100, 0x000100, 0x000000, 0x010000, 0x000001, 0x000000, 0x000000, 0x000000, 0x000000, 0x040404, 0xe1e1e1, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefd, 0xffffff, 0xd2d1d2, 0x000000, 0xceb73f, 0xfad71a, 0xe1c848, 0x2d2b18, 0x881921, 0xdb2428, 0xe31f21, 0xe42021, 0xe32120, 0xe32120, 0xd52c2e, 0x7b0720, 0x5d5a3b, 0xf9e779, 0xdbcb74, 0x000004, 0xa82a29, 0xe22722, 0xe92024, 0xe52122, 0xe82122, 0xe0231f, 0xd12e2b, 0x770a1d, 0x5a5024, 0xf0cd3b, 0xfad500, 0xfcd100, 0xf8d62f, 0xa09040, 0x3a0001, 0xc82829, 0xe32222, 0xe22321, 0xe12322, 0xe12422, 0xe22422, 0xd62929, 0x831c22, 0x2e2f16, 0xe0c53f, 0xf9d822, 0xbfac40, 0x000011, 0xe5e4e4, 0xffffff, 0xf4f3f3, 0x434653, 0xbba73a, 0xfad820, 0xeecf3b, 0x5b5122, 0x810a1e, 0xd82528, 0xe31e1f, 0xe32222, 0xe32222, 0xe32222, 0xe32322, 0xe0231f, 0xe81f1e, 0xe71e1c, 0xe2201a, 0xe41f19, 0xe41f1b, 0xe41f1b, 0xe51f1b, 0xe51f1b, 0xdd2421, 0xb42f30, 0x000002, 0xc6b147, 0xf8d41f, 0xf9d315, 0xd2b547, 0x000008, 0xa92122, 0xdf2323, 0xe22122, 0xe42222, 0xe32221, 0xe22324, 0xe42024, 0xe71f21, 0xe51f1f, 0xe61f1e, 0xe71f20, 0xe71f21, 0xe1221e, 0xe6201d, 0xe61f1e, 0xe2201f, 0xe22021, 0xe32021, 0xd02b28, 0x9e2d29, 0x000000, 0x756b3a, 0xecd04d, 0xf8d51d, 0xdfcb57, 0x180000, 0xb6b8b6, 0xc5c4c7, 0x262100, 0xe6cf4a, 0xfbd921, 0xc4ae4d, 0x000004, 0xb02c2d, 0xe02222, 0xe51e1f, 0xe5201f, 0xe31f20, 0xe31d1f, 0xdb2325, 0x972127, 0x00060e, 0xd5bd44, 0xfed71d, 0xd8b93e, 0x000000, 0xe0dfe0, 0xbababc, 0x352900, 0xe7cb3a, 0xfbd421, 0xc3aa46, 0x000000, 0xb42a27, 0xe21e23, 0xe51e1e, 0xea1c1d, 0xe71b1c, 0xd12d2f, 0x620013, 0x776d32, 0xf7d63d, 0xfcdb25, 0xa89734, 0x5b5e66, 0xf8f9f4, 0xfefffa, 0xfefefb, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfefc, 0xfefefe, 0xfff5f3, 0xd18783, 0xd20000, 0xe1201e, 0xe12020, 0xe32122, 0xe32321, 0xe32220, 0xe32220, 0xe32322, 0xe42423, 0xe42324, 0xe62021, 0xd20000, 0xdb9d9a, 0xfff9f8, 0xfdfefd, 0xfdfdfd, 0xfefefe, 0xfefffe, 0xffffff, 0xffffff, 0xf1f1f1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd2d2d2, 0xf9f9f9, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefc, 0xfbfaf8, 0x7f7e7e, 0x000000, 0x020101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0xb4b4b4, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xfffdfe, 0xfefffe, 0x98989c, 0x4d4400, 0xe8cf40, 0xf9da27, 0xbda947, 0x000000, 0xb12a29, 0xe12123, 0xe42021, 0xe22122, 0xe22122, 0xe22323, 0xca2c30, 0x4d0008, 0x585940, 0xb7aa69, 0xb2a570, 0x001b17, 0x8a2225, 0xdc2c2d, 0xe42220, 0xe42221, 0xe52122, 0xe12422, 0xda2823, 0xa12527, 0x000008, 0xd6b941, 0xfad60f, 0xfbd200, 0xf9d62f, 0xa29041, 0x390000, 0xca282a, 0xe32222, 0xe32221, 0xe32322, 0xe12422, 0xe32422, 0xd72828, 0x801a20, 0x312f16, 0xe2c43f, 0xf9d724, 0xbfac47, 0x000016, 0xe6e6e5, 0xffffff, 0xf7f6f8, 0x464957, 0xbaa53a, 0xfcd822, 0xefd03a, 0x5d5321, 0x7f0921, 0xd72729, 0xe41f20, 0xe32322, 0xe32322, 0xe32322, 0xe32322, 0xe12524, 0xe02622, 0xdd2925, 0xda2725, 0xdc2825, 0xda2728, 0xda2727, 0xd92827, 0xd92827, 0xd42d2c, 0xa83531, 0x000003, 0xd0b747, 0xf7d317, 0xfad312, 0xd2b544, 0x000008, 0xa92124, 0xdf2424, 0xe22222, 0xe42322, 0xe42222, 0xe22322, 0xe42122, 0xe71f20, 0xe42020, 0xe51f21, 0xe41f1f, 0xe52020, 0xe42021, 0xe32021, 0xe42020, 0xe42021, 0xe02222, 0xcf2624, 0x8d2323, 0x000000, 0x6c6031, 0xe3c950, 0xfbd523, 0xf2d746, 0x8d813d, 0x333943, 0xf4f4f4, 0xc5c5c5, 0x292500, 0xe6ce49, 0xfbd920, 0xc6ae4d, 0x000003, 0xb02b2c, 0xe12323, 0xe51f21, 0xe61f20, 0xe41f21, 0xe31e1f, 0xda2425, 0x972127, 0x00070e, 0xd6bd45, 0xfed71e, 0xd8ba3d, 0x000000, 0xe0dfdf, 0xc9cbcb, 0x070000, 0xdfc43c, 0xfbd418, 0xcdb548, 0x000000, 0xad2627, 0xe31e23, 0xe61c1e, 0xe61c1e, 0xe31d1d, 0xc83032, 0x4e0012, 0x897c37, 0xf8d937, 0xfcda2d, 0x9c8a2b, 0x6e7177, 0xfcfdf8, 0xfefff9, 0xfefefc, 0xfdfcfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfcfdfc, 0xfffefe, 0xf7dfdc, 0xbc4242, 0xda1415, 0xe02120, 0xe12120, 0xe22221, 0xe32322, 0xe2211d, 0xe3211e, 0xe32120, 0xe42222, 0xe22322, 0xe0211f, 0xc5151a, 0xeccbc9, 0xfffdfc, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xe9e9e9, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xa6a6a6, 0xf4f4f4, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfb, 0xffffff, 0xbdbdbd, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x6f6f6f, 0xf9f9f9, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfffeff, 0xf1f3f2, 0x434954, 0x9b8d31, 0xf5da29, 0xf7d940, 0x897a3e, 0x4c0006, 0xcc272a, 0xe31f20, 0xe32121, 0xe22122, 0xe12222, 0xe02427, 0xbe262c, 0x550c0c, 0x340000, 0x170000, 0x1e0000, 0x2f0100, 0x84181b, 0xd5272b, 0xe3221f, 0xe42221, 0xe52122, 0xe32221, 0xe02422, 0xc02b2e, 0x110000, 0xaa973f, 0xfad72b, 0xfad100, 0xf9d630, 0xa39142, 0x380000, 0xc9282a, 0xe42223, 0xe32221, 0xe32322, 0xe12422, 0xe22422, 0xd62928, 0x801a20, 0x343117, 0xe3c43f, 0xf9d726, 0xbfac4b, 0x00000c, 0x909495, 0xa3a5a5, 0x9b9ca0, 0x00002f, 0xbaa541, 0xfed921, 0xf0d03a, 0x5d5421, 0x7f0a22, 0xd7282a, 0xe31f20, 0xe32322, 0xe32322, 0xe42423, 0xe42423, 0xda2829, 0xaa2622, 0x8e1f21, 0x8e1121, 0x8f1320, 0x8c1420, 0x8b1620, 0x8a1620, 0x891720, 0x861d23, 0x4e0014, 0x302217, 0xe3c243, 0xf8d30a, 0xf9d310, 0xd1b544, 0x000008, 0xa82124, 0xdf2525, 0xe32223, 0xe42222, 0xe42222, 0xe42221, 0xe4211f, 0xe31f1e, 0xe51e20, 0xe41d1f, 0xe4201e, 0xe22021, 0xe71e23, 0xe61f23, 0xe22120, 0xe62020, 0xe02322, 0xb62625, 0x000000, 0x77704a, 0xe5ce55, 0xf7da24, 0xf5d32e, 0xb4a347, 0x000000, 0xc3c5c3, 0xffffff, 0xc5c5c4, 0x2d2b00, 0xe5ce48, 0xfad81d, 0xc5ad4d, 0x000003, 0xaf2a2b, 0xe02323, 0xe52021, 0xe62020, 0xe31f20, 0xe31e1f, 0xda2425, 0x972127, 0x00080e, 0xd6bd44, 0xfdd61c, 0xd8b93c, 0x000000, 0xdfdfde, 0xdcdddb, 0x000000, 0xd7c03f, 0xfbd511, 0xd8bd4a, 0x00000d, 0x9e2522, 0xda201f, 0xe41b1c, 0xe11d1a, 0xe21c1a, 0xc22c31, 0x39000a, 0x96893c, 0xfbdb30, 0xfad934, 0x8a7a19, 0x85868a, 0xfefefa, 0xfefff9, 0xfefefb, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefdff, 0xfffbfb, 0xe2b3b1, 0xc40000, 0xde2020, 0xe22120, 0xe22221, 0xe32221, 0xe42222, 0xe22120, 0xe32020, 0xe4211f, 0xe4211f, 0xe3211d, 0xd71f20, 0xae5c5c, 0xf9edea, 0xfdfefd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xf9f9f9, 0xd0d0d0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe9e9e9, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfffffe, 0xe7e9e8, 0x272928, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdcdcdc, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xd6d6d7, 0x000000, 0xccb648, 0xfada1b, 0xe8cc48, 0x403a21, 0x85101c, 0xdb2428, 0xe31f20, 0xe22020, 0xe22122, 0xe12222, 0xe02222, 0xd32627, 0xc4272c, 0xc32830, 0xbe292b, 0xbf272d, 0xbc2726, 0xcb2326, 0xe12124, 0xe42120, 0xe42222, 0xe52222, 0xe42222, 0xe42221, 0xd42b2b, 0x660011, 0x6a6330, 0xeed541, 0xf7d501, 0xf8d630, 0xa49243, 0x350000, 0xc8282a, 0xe32222, 0xe32322, 0xe32322, 0xe12422, 0xe12422, 0xd62928, 0x7f191f, 0x383519, 0xe4c641, 0xf6d726, 0xd0ba49, 0x7b6d37, 0x726320, 0x6e6011, 0x6d5e0c, 0x70652c, 0xccb33f, 0xfbdb21, 0xefd13b, 0x5f5422, 0x800d23, 0xd6292a, 0xe32121, 0xe22422, 0xe22422, 0xe32423, 0xe32422, 0xce2c28, 0x5a0b0f, 0x17271a, 0x4e462a, 0x494221, 0x463e1f, 0x433c1d, 0x413a1c, 0x3e391b, 0x38371d, 0x4a4320, 0xb49c38, 0xf6d32a, 0xf6d207, 0xf8d310, 0xd0b542, 0x000007, 0xa82124, 0xdf2424, 0xe22222, 0xe42322, 0xe42222, 0xe32222, 0xe32223, 0xda2427, 0xca2726, 0xc52827, 0xcd292a, 0xd72323, 0xe22121, 0xe6201f, 0xe4201e, 0xe61f20, 0xe62123, 0xcc2a2d, 0x640016, 0x68653c, 0xebd350, 0xfcd813, 0xf0d03b, 0x574800, 0x797b7c, 0xfefefd, 0xffffff, 0xc7c7c8, 0x312e00, 0xe5cd47, 0xfad81b, 0xc4ac4b, 0x000004, 0xad2b2b, 0xdf2222, 0xe42021, 0xe62020, 0xe31f21, 0xe31e20, 0xda2425, 0x962026, 0x00080d, 0xd6be43, 0xfdd71a, 0xd9bb3c, 0x000000, 0xdddedd, 0xe5e5e2, 0x000000, 0xccb942, 0xfbd516, 0xe7c84c, 0x332b18, 0x8d272b, 0xce2d30, 0xd3282b, 0xd2272d, 0xcf292b, 0xa93235, 0x000003, 0xa99a42, 0xfddb29, 0xf7d93f, 0x726300, 0xa3a4a6, 0xfffffd, 0xfefff9, 0xfefefb, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfbfcfb, 0xfff0ed, 0xcc7472, 0xd30000, 0xe12221, 0xe22221, 0xe22121, 0xe32121, 0xe32121, 0xe22120, 0xe32021, 0xe32021, 0xe02220, 0xdf2424, 0xaf0000, 0xad9b9c, 0xfffffe, 0xfefcfd, 0xfdfcfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xf1f1f1, 0x9d9d9d, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdfdfdf, 0xfafafa, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffffd, 0xfcfdfc, 0x7e7e7e, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000100, 0x000000, 0x000001, 0x010101, 0x010101, 0x030302, 0x000000, 0xa3a3a2, 0xfffffc, 0xfefefd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xa5a5a8, 0x3d3300, 0xe6cd44, 0xf8db22, 0xc6b24c, 0x000000, 0xaa2326, 0xe12022, 0xe41f22, 0xe32020, 0xe32122, 0xe22122, 0xe22122, 0xe02021, 0xe32022, 0xe22122, 0xe22222, 0xe32122, 0xe2231f, 0xe52025, 0xe6211d, 0xe42121, 0xe42223, 0xe42222, 0xe42222, 0xe42220, 0xdd2829, 0x961e25, 0x071010, 0xdbc64c, 0xf9d714, 0xf9d730, 0xa49343, 0x340000, 0xc8272a, 0xe42323, 0xe32321, 0xe22321, 0xe12422, 0xe22422, 0xd62928, 0x7e181f, 0x3b391c, 0xe4c943, 0xf5d510, 0xf3d532, 0xf4d644, 0xf3d646, 0xf1d846, 0xf1d544, 0xf1d53c, 0xf7d42c, 0xf8d815, 0xefd33d, 0x605522, 0x7e0d22, 0xd62a2b, 0xe32121, 0xe12422, 0xe12422, 0xe12422, 0xe32522, 0xcf2d29, 0x480003, 0x90844b, 0xefd25e, 0xe8cc46, 0xe7ca44, 0xe5c942, 0xe4c841, 0xe3c640, 0xe1c442, 0xe6c83f, 0xf3d325, 0xf5d30c, 0xf6d10b, 0xf8d311, 0xd0b643, 0x000008, 0xa82222, 0xdf2424, 0xe32223, 0xe42222, 0xe42222, 0xe32321, 0xe22426, 0xbd272c, 0x580d0c, 0x360000, 0x691013, 0xc2272c, 0xe42122, 0xe4201f, 0xe42022, 0xe32021, 0xe42121, 0xde2423, 0xae2c2a, 0x000000, 0xb4a34f, 0xfbda37, 0xf9d831, 0xb3a142, 0x313541, 0xecebea, 0xffffff, 0xc7c6c5, 0x312e00, 0xe5ce47, 0xfad81a, 0xc5ad4b, 0x000003, 0xae2b2b, 0xe02323, 0xe42022, 0xe62221, 0xe42021, 0xe31e20, 0xda2425, 0x972127, 0x00090d, 0xd7be43, 0xfdd71a, 0xd8ba3a, 0x000000, 0xdbdddc, 0xf0f0ec, 0x111e32, 0xbdaa3b, 0xf7d81e, 0xf2d744, 0x756530, 0x2a0000, 0x6d1b1f, 0x6c1619, 0x69131a, 0x5f1618, 0x400000, 0x000000, 0xcabb50, 0xfcda1c, 0xf1d449, 0x544600, 0xb5b6b6, 0xfffffc, 0xfefff9, 0xfefefb, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfefef9, 0xf3d2cf, 0xc4282a, 0xdc1d19, 0xe41f20, 0xe22120, 0xe32121, 0xe32121, 0xe32121, 0xe2211f, 0xe32120, 0xe12120, 0xdd2321, 0xc42d2c, 0x4a0000, 0xd3ced1, 0xffffff, 0xfcfdfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xebebeb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x9f9f9f, 0xf4f4f4, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xbdbdbd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000101, 0x000103, 0x010004, 0x010102, 0x020102, 0x060504, 0x000000, 0x9e9b6f, 0xfffede, 0xfefef9, 0xfdfdfe, 0xfefdfc, 0xfffcff, 0xfdfefb, 0xfdfdfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfaf9fa, 0x60636b, 0x908125, 0xf5d732, 0xf6da36, 0x9a8b43, 0x2d0000, 0xc4272a, 0xe61e20, 0xe42022, 0xe12021, 0xe31e1f, 0xe51e1f, 0xe11f23, 0xe41e21, 0xe31f20, 0xe32020, 0xe41f22, 0xe52021, 0xe91f21, 0xe92023, 0xe62220, 0xe62120, 0xe42220, 0xe42221, 0xe42222, 0xe42222, 0xe22325, 0xb52a2e, 0x000000, 0xb1a247, 0xf9d82c, 0xfad62f, 0xa59343, 0x2e0000, 0xc62728, 0xe32223, 0xe22321, 0xe32322, 0xe32322, 0xe22321, 0xd82b28, 0x811920, 0x433e25, 0xe6d159, 0xf6da32, 0xf4d530, 0xf4d52b, 0xf3d528, 0xf1d525, 0xf2d426, 0xf6d526, 0xf7d726, 0xf7d616, 0xedd13d, 0x615521, 0x7a0e20, 0xd5282c, 0xe4211f, 0xe22322, 0xe12422, 0xe22523, 0xe52422, 0xcf2d2b, 0x3f0005, 0x988841, 0xfadd3f, 0xf4d715, 0xf6d517, 0xf5d415, 0xf4d412, 0xf4d30f, 0xf5d108, 0xf3d203, 0xf7d409, 0xf7d30d, 0xf4d003, 0xf7d314, 0xd0b947, 0x000006, 0xa92020, 0xdf2523, 0xe22221, 0xe22221, 0xe32322, 0xe42321, 0xe02428, 0xb22a2c, 0x1a0000, 0x585b56, 0x172524, 0x9a2126, 0xdd2525, 0xe52021, 0xe31f22, 0xe32020, 0xe32122, 0xdf2322, 0xd22a28, 0x780717, 0x3d3d25, 0xe4ca51, 0xf7dc18, 0xedd04c, 0x4a3d00, 0xa0a1a4, 0xffffff, 0xc4c4c3, 0x322d00, 0xe6cf48, 0xfad81b, 0xc6ae4c, 0x000003, 0xaf2a2d, 0xe12325, 0xe4201f, 0xe52020, 0xe41f20, 0xe11f20, 0xd92426, 0x972127, 0x00090c, 0xd6bf42, 0xfcd819, 0xd8ba37, 0x000000, 0xdbdbdb, 0xfaf9f6, 0x3b404c, 0x97862b, 0xf6d92d, 0xf6db2a, 0xdfcd6b, 0x7e7966, 0x000c12, 0x000000, 0x000000, 0x000000, 0x5a5c59, 0xaea874, 0xf3d849, 0xfbda14, 0xe0c340, 0x000000, 0xc1c2be, 0xfffffc, 0xfefdf9, 0xfffefb, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefcfd, 0xfdfdfd, 0xfcfefd, 0xfefcfd, 0xfefdfd, 0xfffbf5, 0xdaa098, 0xce0000, 0xe12120, 0xe32121, 0xe32222, 0xe32221, 0xe32322, 0xe32322, 0xe42021, 0xe12120, 0xe0211e, 0xca2c2b, 0x6e0000, 0x4e5451, 0xf3f4f3, 0xfffeff, 0xfefefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xe4e4e4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xebebeb, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xeaeaea, 0x383838, 0x000000, 0x000000, 0x000000, 0x010100, 0x000103, 0x000104, 0x000201, 0x000100, 0x030501, 0x000000, 0x686031, 0xddd458, 0xf5f2a2, 0xffffe8, 0xfcfffa, 0xfdfef9, 0xfefcfe, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xfeffff, 0xffffff, 0xe6e5e3, 0x000013, 0xc4b244, 0xf9d920, 0xefd244, 0x5d5429, 0x6f0019, 0xd62629, 0xe91d1f, 0xe81e1f, 0xe51e22, 0xe31f20, 0xe41e1c, 0xe51e1e, 0xe41f1f, 0xe31f1f, 0xe31f1f, 0xe41f20, 0xe42021, 0xe52120, 0xe8201f, 0xea2021, 0xe62122, 0xe62120, 0xe32321, 0xe22322, 0xe52122, 0xe5211e, 0xcc2c2d, 0x55000f, 0x776d35, 0xf4d643, 0xfbd72d, 0xa59342, 0x290000, 0xc32728, 0xe22322, 0xe12422, 0xe22322, 0xe32322, 0xe42321, 0xd82b2a, 0x821f23, 0x2d2e20, 0xa99656, 0xb09d44, 0xad9941, 0xad9a40, 0xac9a3f, 0xab983d, 0xab963f, 0xac963e, 0xbba542, 0xe3c73b, 0xedd248, 0x5f5422, 0x780b1f, 0xd4282b, 0xe32120, 0xe22221, 0xe12422, 0xe12422, 0xe52422, 0xcf2c2a, 0x440000, 0x7b7144, 0xd9c561, 0xd7c052, 0xd5bf4a, 0xd5bf48, 0xd5be46, 0xd5be45, 0xd7bf41, 0xd6be41, 0xd5bf49, 0xe0c641, 0xf2d12e, 0xf7d315, 0xd2b946, 0x000007, 0xa81f20, 0xdf2523, 0xe22221, 0xe22221, 0xe32322, 0xe22321, 0xe02428, 0xb52b30, 0x000000, 0xb1ae90, 0x777860, 0x500000, 0xcd2829, 0xe42225, 0xe32120, 0xe32021, 0xe42022, 0xe12222, 0xdc2422, 0xb32b29, 0x000000, 0x9d8b45, 0xf8db3e, 0xfbda2e, 0xb8a642, 0x000019, 0xe6e7e4, 0xc7c7c7, 0x312a00, 0xe6d049, 0xfbd81b, 0xc7af4d, 0x000003, 0xb02b2d, 0xe12325, 0xe4211f, 0xe4211f, 0xe41f20, 0xe12020, 0xd82426, 0x972127, 0x000a0c, 0xd6c040, 0xfdd918, 0xd8ba36, 0x000000, 0xdedede, 0xd1d1cf, 0x000000, 0xc9b749, 0xfadb23, 0xfcdd45, 0xcdbb64, 0x625f4d, 0x000003, 0x2a0000, 0x300202, 0x1a0000, 0x292e33, 0x97935c, 0xedd340, 0xfdd810, 0xf1d641, 0x786f24, 0x828386, 0xf9fdf8, 0xfefef8, 0xfffefc, 0xfefeff, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefd, 0xfcfefb, 0xfcfffc, 0xfbe6e4, 0xc55755, 0xda0e0f, 0xe21f20, 0xe12322, 0xe32322, 0xe22322, 0xe32322, 0xe42222, 0xe22221, 0xdf2121, 0xcf292b, 0x7f2525, 0x000000, 0xa2a2a1, 0xffffff, 0xfffdfe, 0xfdfefc, 0xfefffe, 0xfefefe, 0xfefefe, 0xffffff, 0xf7f7f7, 0xc6c6c6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd0d0d0, 0xfafafa, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0x8f8f8f, 0x000000, 0x020202, 0x010101, 0x010101, 0x000103, 0x000201, 0x010303, 0x050508, 0x000000, 0x454223, 0xd5c64d, 0xebd615, 0xece15d, 0xfefdd0, 0xfdfff8, 0xfdfffb, 0xfefdfd, 0xfefffe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xbabbbd, 0x312700, 0xe6cf42, 0xfada16, 0xd7bd47, 0x00000a, 0x9f2327, 0xdf2122, 0xe61e1e, 0xe71e1c, 0xe71d21, 0xe61d1f, 0xe41d1d, 0xe42021, 0xe12323, 0xe02322, 0xdf2322, 0xe02222, 0xe42123, 0xe22422, 0xe22421, 0xe42322, 0xe22121, 0xe42122, 0xe32321, 0xe32321, 0xe52122, 0xe52120, 0xdb2729, 0x8a1822, 0x222a19, 0xdfc94b, 0xfbd935, 0xa49442, 0x280000, 0xc22828, 0xe12322, 0xe12422, 0xe12422, 0xe22422, 0xe52322, 0xdd2a2c, 0x972527, 0x3b0102, 0x2b0000, 0x280000, 0x280000, 0x2b0001, 0x2b0002, 0x2e0002, 0x2b0003, 0x200002, 0x000000, 0x6e5f26, 0xe1c95d, 0x5f5524, 0x780b1f, 0xd5292a, 0xe42222, 0xe32322, 0xe12422, 0xe22422, 0xe42423, 0xce2e2b, 0x5d1311, 0x000000, 0x090008, 0x11000e, 0x05000a, 0x0a000a, 0x10000b, 0x12000b, 0x0d000c, 0x14000a, 0x10040f, 0x322512, 0xaf9539, 0xf5d62f, 0xd4ba46, 0x000009, 0xa71e20, 0xde2422, 0xe22221, 0xe22221, 0xe22322, 0xe22322, 0xe02326, 0xb52a31, 0x000000, 0xbeb673, 0xc4bd74, 0x000000, 0xa42427, 0xe12327, 0xe22123, 0xe32122, 0xe32121, 0xe32121, 0xe3211f, 0xd22927, 0x831d21, 0x001411, 0xd7c353, 0xfdda22, 0xeed445, 0x5d5100, 0x8b8e91, 0xc2c1c5, 0x363000, 0xe7d049, 0xfbd81b, 0xc8af4e, 0x000003, 0xb02b2c, 0xe12424, 0xe4211e, 0xe4211e, 0xe42020, 0xe12020, 0xd92527, 0x972128, 0x000c0c, 0xd6c13f, 0xfdd917, 0xd7ba35, 0x000000, 0xd4d4d3, 0x6d6f74, 0x7b712d, 0xf0d945, 0xfbde2d, 0xd1bb57, 0x11000e, 0x3f0000, 0x9c2527, 0xbc2827, 0xc32625, 0xb62929, 0x822321, 0x000000, 0x988836, 0xf4d734, 0xf9de20, 0xd0bd4a, 0x000011, 0xdfe2de, 0xfffff9, 0xfffefc, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfffe, 0xfefeff, 0xfefdfd, 0xfbfef9, 0xfffef7, 0xe6bbb9, 0xc70007, 0xe2201d, 0xe41f21, 0xe12021, 0xe02321, 0xe22321, 0xe22121, 0xe32121, 0xdf2320, 0xd42b2a, 0x962729, 0x000000, 0x000000, 0xdadcdc, 0xfefeff, 0xfffdfe, 0xfdfefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xe5e5e5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xa6a6a6, 0xf5f5f5, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xcfcfcf, 0x000000, 0x000000, 0x000000, 0x000000, 0x010202, 0x000300, 0x030406, 0x000002, 0x0f0412, 0xc7ba48, 0xecd422, 0xeed200, 0xead621, 0xf9f2a4, 0xffffe9, 0xfdfdfa, 0xfefdfd, 0xfdfefc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xf8f8f8, 0x6e7077, 0x7f721a, 0xf4d834, 0xf9dc30, 0xa79642, 0x280000, 0xbf2a2a, 0xe51e21, 0xe41e1f, 0xe51f1d, 0xe41e1f, 0xe91c1d, 0xdc2425, 0xb9292a, 0xa32326, 0xa12024, 0xa12125, 0xa32125, 0xa62125, 0xa72127, 0xa32529, 0xa92525, 0xcb282a, 0xdf2323, 0xe32220, 0xe52020, 0xe42022, 0xe42023, 0xe12324, 0xb12828, 0x000000, 0xbfae4b, 0xfbdd44, 0xa19343, 0x280000, 0xc42827, 0xe12421, 0xe12422, 0xe22523, 0xe12522, 0xe22423, 0xe02526, 0xd02a28, 0xbf2927, 0xc02a27, 0xc02a29, 0xc02a2a, 0xc12b2a, 0xc02a2a, 0xc42a29, 0xc32b29, 0xc0302e, 0x85262b, 0x000000, 0xcfba66, 0x635a2b, 0x780c1f, 0xd5292a, 0xe42223, 0xe32423, 0xe12422, 0xe12422, 0xe42322, 0xdc2527, 0xb72325, 0xac282a, 0xa72829, 0xa92629, 0xa82628, 0xa82627, 0xa82527, 0xa92627, 0xad2626, 0xad2a29, 0xa32e2d, 0x5a0018, 0x342c11, 0xe4ca41, 0xd6bc4c, 0x000009, 0xa71d21, 0xdf2422, 0xe22221, 0xe22221, 0xe32322, 0xe22324, 0xe02325, 0xb4292c, 0x000000, 0xbeaf55, 0xf0dd62, 0x665c32, 0x570009, 0xcc2a2c, 0xe22122, 0xe42021, 0xe22121, 0xe22221, 0xe32120, 0xe0231e, 0xbf2d2d, 0x360001, 0x867c3e, 0xf5da49, 0xfcdd2b, 0xc6b046, 0x000020, 0x7d7d81, 0x484426, 0xe6d049, 0xfbd91c, 0xc8b04e, 0x000003, 0xb02b2c, 0xe12324, 0xe4221d, 0xe4211e, 0xe52020, 0xe12020, 0xd92527, 0x972128, 0x000c0d, 0xd7c03f, 0xfeda19, 0xd7ba36, 0x0f161f, 0xb2b3b2, 0x030f26, 0xc4b24c, 0xf9dc25, 0xf0d94e, 0x6d6533, 0x300000, 0xb32d2a, 0xdc2624, 0xe32221, 0xe6201f, 0xe5201d, 0xce322c, 0x912d2b, 0x000002, 0xc8b545, 0xf8da17, 0xf0d649, 0x594f00, 0xb4b7b0, 0xfffffc, 0xfffffc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfffdfe, 0xfefefe, 0xfdfef9, 0xffeee9, 0xca7571, 0xd50007, 0xe3201f, 0xe12122, 0xe42122, 0xe12220, 0xe22221, 0xe12120, 0xe12020, 0xd72727, 0xa62d2b, 0x260504, 0x000000, 0x717170, 0xf9f9f8, 0xfdfefc, 0xfefefe, 0xfffefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xf9f9f9, 0xd8d8d8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xf0f0f0, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xf5f5f5, 0x5e5e5e, 0x000000, 0x000000, 0x000001, 0x010102, 0x010300, 0x000002, 0x000000, 0xb1a248, 0xefd82f, 0xf0d400, 0xf0d505, 0xedd400, 0xece164, 0xfffecd, 0xfefef7, 0xfefdfe, 0xfdfefd, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xe1e1e1, 0x000005, 0xb7a63f, 0xf7db24, 0xf1d544, 0x665d2b, 0x6b0018, 0xd42728, 0xe91d1e, 0xe81e21, 0xe81e1e, 0xe2201e, 0xe51c1e, 0xcc2b2a, 0x671e1b, 0x000000, 0x00000a, 0x000006, 0x000006, 0x000008, 0x00000c, 0x000009, 0x000000, 0x8f2320, 0xd82727, 0xe5201f, 0xe71f20, 0xe52022, 0xe6201f, 0xe42120, 0xcc2a2b, 0x420004, 0x8f813a, 0xf8de55, 0xa39349, 0x280000, 0xc42827, 0xe22223, 0xe12322, 0xe22423, 0xe22423, 0xe22323, 0xe12321, 0xe12122, 0xe22025, 0xe12121, 0xe22120, 0xe32122, 0xe22120, 0xe32121, 0xe32121, 0xe02421, 0xde2625, 0xa52c2c, 0x000000, 0xcdba6a, 0x675e2f, 0x780c1d, 0xd52a2a, 0xe42123, 0xe32322, 0xe22422, 0xe22422, 0xe32322, 0xe12422, 0xdd2422, 0xe02325, 0xde2426, 0xe02424, 0xdf2423, 0xe02422, 0xe02422, 0xe02422, 0xe12521, 0xde2623, 0xd72b29, 0x91282a, 0x000008, 0xdbc34a, 0xd8be4e, 0x000008, 0xa71e21, 0xde2422, 0xe12221, 0xe32322, 0xe32322, 0xe22324, 0xdf2324, 0xb3292b, 0x000000, 0xc0ad51, 0xfae146, 0xbcac58, 0x000000, 0xa12729, 0xe12524, 0xe51f20, 0xe32121, 0xe32120, 0xe32120, 0xe41f24, 0xd82826, 0x972127, 0x000004, 0xcdba53, 0xfcdc2c, 0xf2d643, 0x827335, 0x000000, 0x4c482b, 0xe8d14a, 0xfcd91c, 0xc9b14e, 0x000003, 0xaf2b2c, 0xe22424, 0xe6211f, 0xe5211f, 0xe41f20, 0xe21f20, 0xda2427, 0x992128, 0x000e0e, 0xd8c13f, 0xfdda1b, 0xd4ba36, 0x262930, 0x9a9c9b, 0x2f2a11, 0xdfc848, 0xf9d81b, 0xd9c253, 0x00000b, 0x8c1d21, 0xdb2527, 0xe71f1a, 0xe81e1b, 0xe41f1e, 0xe51e1b, 0xdf1e1f, 0xc43937, 0x2a0009, 0x95873a, 0xf6d42b, 0xf5da39, 0x8f8530, 0x888a85, 0xfefff9, 0xfffefd, 0xfefefb, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefd, 0xfdfffd, 0xfffcf9, 0xedc9c6, 0xc31f20, 0xe11f22, 0xe51f21, 0xe02322, 0xe32222, 0xe32222, 0xe32020, 0xe0201e, 0xd62624, 0xb0302f, 0x460f0e, 0x000000, 0x000000, 0xb7b7b6, 0xffffff, 0xfdfdfc, 0xfdfefc, 0xfefdfe, 0xfefefe, 0xffffff, 0xfefefe, 0xf3f3f3, 0xb5b5b5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd8d8d8, 0xf7f7f7, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xb1b1b1, 0x000000, 0x020202, 0x010102, 0x010104, 0x000100, 0x000000, 0x9a8d3c, 0xebd536, 0xeed400, 0xf0d501, 0xf0d501, 0xf0d500, 0xe7d423, 0xfbf5a7, 0xfeffef, 0xfefefc, 0xfefefd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xbababb, 0x000000, 0xdcc64a, 0xf7dc14, 0xdac249, 0x000310, 0x931e26, 0xdf2226, 0xe71e1b, 0xe61e20, 0xe71d1f, 0xe2211d, 0xe11f22, 0xbd2c2b, 0x240000, 0x837945, 0xd4c357, 0xd4be44, 0xd5bd46, 0xd7bd49, 0xd6c347, 0xd2be5b, 0x48462a, 0x630815, 0xcd2c2b, 0xe6231e, 0xe5201f, 0xe52121, 0xe71f1f, 0xe52121, 0xdc262a, 0x811420, 0x3d3d1e, 0xe7d561, 0xa6964a, 0x250000, 0xc32827, 0xe22324, 0xe12422, 0xe02422, 0xe02523, 0xe22423, 0xe22222, 0xe22122, 0xe22122, 0xe32122, 0xe22121, 0xe22121, 0xe12120, 0xe22121, 0xe32221, 0xe2221f, 0xdd2625, 0xa52b2a, 0x000000, 0xcdbc69, 0x6b6331, 0x740819, 0xd32b2a, 0xe32122, 0xe12322, 0xe12323, 0xe12423, 0xe12323, 0xe02422, 0xe02421, 0xe12321, 0xe12320, 0xe12221, 0xe12221, 0xe12221, 0xe22121, 0xe32121, 0xe32120, 0xe2231d, 0xda2825, 0x93272a, 0x08100e, 0xdec64f, 0xdabf4a, 0x010008, 0xa71e20, 0xdf2421, 0xe12321, 0xe32321, 0xe32321, 0xe42222, 0xde2323, 0xb0292c, 0x000000, 0xbcac56, 0xf8db31, 0xead25a, 0x524c2c, 0x4e0008, 0xc92b2c, 0xe32122, 0xe22022, 0xe5201f, 0xe1211f, 0xe41f21, 0xe12120, 0xc42c33, 0x440011, 0x786b33, 0xf1d442, 0xfadc23, 0xd2b950, 0x000003, 0x4c4929, 0xe9d149, 0xfbd91c, 0xc8b14b, 0x000004, 0xad2c2c, 0xe12423, 0xe62121, 0xe62220, 0xe42121, 0xe22020, 0xdb2526, 0x9a2229, 0x00100e, 0xd8c33d, 0xfdda1c, 0xd3bb37, 0x2a2e32, 0x979997, 0x45400c, 0xe5cc3a, 0xf9d820, 0xc6ae48, 0x000000, 0xaa2627, 0xe72322, 0xe91f20, 0xe91e1d, 0xe71f1e, 0xe61f1b, 0xe21d18, 0xcf3533, 0x57001b, 0x766f31, 0xf3d633, 0xfadb2a, 0xa29637, 0x66686a, 0xf9fbf4, 0xfffeff, 0xfefdfb, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfefffb, 0xfdfffb, 0xffefec, 0xcc807e, 0xcf0000, 0xe12223, 0xe42121, 0xe22221, 0xe42121, 0xe22223, 0xe0201f, 0xd82322, 0xb72d2e, 0x601918, 0x000000, 0x000000, 0x3e3e3e, 0xeeeeee, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfcfcfc, 0xe8e8e8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x555555, 0xf3f3f3, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xe8e8e6, 0x2c2c2b, 0x000000, 0x000000, 0x040402, 0x000000, 0x7e7231, 0xe7ce3c, 0xeed300, 0xeed400, 0xefd400, 0xf0d501, 0xf0d500, 0xebd200, 0xf1e66b, 0xffffd5, 0xfefff5, 0xfffefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0x898a8d, 0x6d6209, 0xefd63f, 0xf7db28, 0xb29f43, 0x000000, 0xb22729, 0xe41f20, 0xe81c1a, 0xe31e1f, 0xe51f20, 0xe41e1c, 0xdf2221, 0xa72c2c, 0x000000, 0xc5b24c, 0xffdf2b, 0xffda1c, 0xffde1f, 0xffdb1c, 0xfdd710, 0xfbda3f, 0x948642, 0x2d0000, 0xbf2d2d, 0xe52320, 0xe8201f, 0xe7201f, 0xe81e1f, 0xe91f1d, 0xe32020, 0xac292d, 0x000000, 0xc9bf6b, 0xa99f59, 0x200000, 0xc32926, 0xe32222, 0xe22322, 0xe12422, 0xe12422, 0xe22322, 0xe12321, 0xe22321, 0xe22221, 0xe12120, 0xe32121, 0xe22120, 0xe22120, 0xe32121, 0xe32121, 0xe42120, 0xde2626, 0xa22b2b, 0x000000, 0xd1c36e, 0x726a34, 0x73021b, 0xd32d2b, 0xe52122, 0xe22221, 0xe22222, 0xe32322, 0xe32322, 0xe32320, 0xe32320, 0xe3221f, 0xe3221f, 0xe3211f, 0xe32121, 0xe32121, 0xe42121, 0xe42121, 0xe5211f, 0xe3211c, 0xd82926, 0x8e2528, 0x242217, 0xe4ca55, 0xdbbf4b, 0x010005, 0xaa1d23, 0xe22322, 0xe5221f, 0xe5211f, 0xe6201f, 0xe62020, 0xe02323, 0xb02b2d, 0x000000, 0xbcac58, 0xf8d830, 0xfad835, 0xb7a451, 0x000000, 0x982424, 0xdb2727, 0xe2201e, 0xe61f1f, 0xe51f1f, 0xe71f1c, 0xe71e1f, 0xd92426, 0x98272a, 0x000000, 0xc9b24a, 0xfcd927, 0xf2d444, 0x6e6431, 0x413f24, 0xe7d045, 0xfad91b, 0xc6af4a, 0x000005, 0xad2d2d, 0xe12524, 0xe72223, 0xe62221, 0xe62121, 0xe32020, 0xdc2526, 0x9b232a, 0x03120e, 0xd9c13d, 0xfdd91d, 0xd4bc39, 0x2c3034, 0x959796, 0x464106, 0xe5cc37, 0xf8d71e, 0xc1ab44, 0x000000, 0xaf2823, 0xeb2122, 0xea1f20, 0xeb1f1b, 0xe8201d, 0xe72019, 0xe21f19, 0xd03235, 0x5a001c, 0x716d31, 0xf1d836, 0xfbda2c, 0x9e9034, 0x565761, 0xf8faf4, 0xfffffe, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfefefc, 0xfffefb, 0xefcac7, 0xbc2424, 0xdc1b1f, 0xe22021, 0xe12221, 0xe32221, 0xe62122, 0xe22322, 0xde2423, 0xc43132, 0x6d1e1f, 0x000000, 0x000404, 0x000000, 0x989899, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xf9f9f9, 0xdbdbdb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe3e3e3, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefc, 0x959593, 0x000000, 0x030302, 0x000000, 0x5e5927, 0xdecc3c, 0xf0d207, 0xefd200, 0xf1d401, 0xf1d504, 0xf1d504, 0xf2d401, 0xf0d300, 0xe8d528, 0xfdf8a7, 0xfeffea, 0xfefefd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf7f7f7, 0x585b64, 0x9d9034, 0xf6da2f, 0xf3d73a, 0x7e7235, 0x46000e, 0xc02d2e, 0xe12122, 0xe81c1d, 0xe51e1e, 0xe31f1e, 0xe41e1e, 0xd82826, 0x892227, 0x151c10, 0xdfc947, 0xfddb21, 0xe8ca38, 0xcdb63d, 0xd7c13b, 0xf6d725, 0xfdd723, 0xc4ab4a, 0x000000, 0xaa292c, 0xe42223, 0xeb1e20, 0xe91e20, 0xeb1e1f, 0xe81f1c, 0xe4211d, 0xc22e31, 0x3a0000, 0xa7a072, 0xb2a87a, 0x100000, 0xbe2b2b, 0xe32122, 0xe42121, 0xe42021, 0xe42021, 0xe52021, 0xe61f21, 0xe51f21, 0xe51f21, 0xe51f21, 0xe41f21, 0xe42021, 0xe42021, 0xe52022, 0xe42022, 0xe22120, 0xda2829, 0x99292c, 0x0f1107, 0xdbcd69, 0x837a37, 0x6a0020, 0xcf2e2d, 0xe72122, 0xe5211e, 0xe5211e, 0xe5221f, 0xe5211e, 0xe52120, 0xe52020, 0xe52120, 0xe52121, 0xe42120, 0xe4211f, 0xe4211f, 0xe5211f, 0xe5211f, 0xe3211f, 0xe3221e, 0xd42a28, 0x831e24, 0x39361f, 0xe9cf55, 0xdabe4c, 0x000005, 0xa71f24, 0xe22424, 0xe62121, 0xe62020, 0xe72021, 0xe72021, 0xdf2323, 0xaf2d2f, 0x000000, 0xc0ad5b, 0xf8d730, 0xfbd306, 0xefd050, 0x645731, 0x530006, 0xc82c2b, 0xe2211c, 0xe91f1e, 0xe91e1e, 0xe81f1e, 0xe71e1f, 0xe2201d, 0xbf3130, 0x440016, 0x8a7a38, 0xf9d538, 0xfad930, 0xa29145, 0x353521, 0xe5ce45, 0xfad81d, 0xc4ad48, 0x000005, 0xad2d2f, 0xe22525, 0xe92224, 0xe82223, 0xe72022, 0xe32121, 0xda2727, 0x9a242b, 0x05130d, 0xdac23c, 0xfeda1e, 0xd5bc3c, 0x2a2e32, 0x999a98, 0x2d2905, 0xdec747, 0xf7d719, 0xd7bf53, 0x00000b, 0x9b2727, 0xdf2724, 0xe9211b, 0xea211b, 0xe8201d, 0xe61f1c, 0xdd2423, 0xbf3432, 0x2d0002, 0x928641, 0xf7da36, 0xf9db34, 0x8e8231, 0x717378, 0xfcfdf9, 0xfefffd, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfffe, 0xfcfefe, 0xfff0ef, 0xcb8081, 0xc90000, 0xe11d20, 0xe21d1f, 0xe12120, 0xe32121, 0xe22221, 0xde2521, 0xd23231, 0x892728, 0x000000, 0x000001, 0x000000, 0x000000, 0xdadbdb, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xf0f0f0, 0x2b2b2b, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbebebe, 0xf7f7f7, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xd8d8d6, 0x000000, 0x000000, 0x38361d, 0xd4c34d, 0xf4d619, 0xf2d400, 0xf2d401, 0xf3d401, 0xf1d501, 0xf0d401, 0xf2d301, 0xf1d301, 0xead000, 0xf0e66c, 0xffffd7, 0xfefff7, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf4f4f4, 0x474b56, 0xae9f3e, 0xfadc2d, 0xedd436, 0x5c541f, 0x420014, 0xa63234, 0xc22c2c, 0xd42628, 0xda2727, 0xdb2722, 0xde2625, 0xcc322f, 0x61001a, 0x675c2a, 0xf2d63c, 0xfadd32, 0x9a8c35, 0x000000, 0x000000, 0xd8c140, 0xfdd917, 0xe2c546, 0x292716, 0x8b2026, 0xd92929, 0xe32524, 0xdf2624, 0xe12625, 0xd82927, 0xce2929, 0xb53739, 0x530011, 0x7a785e, 0xb0a984, 0x000000, 0xb43333, 0xdc2b28, 0xdc2726, 0xde2726, 0xdd2726, 0xdc2725, 0xdc2625, 0xdc2625, 0xdb2726, 0xda2725, 0xda2726, 0xda2827, 0xda2827, 0xd92726, 0xd92728, 0xd82825, 0xcc312e, 0x882b2d, 0x2d2915, 0xe7d15f, 0x9e903f, 0x36000a, 0xb7342e, 0xda2c29, 0xdc2926, 0xdb2825, 0xdc2826, 0xdb2825, 0xdb2825, 0xda2725, 0xd92825, 0xd92925, 0xd82925, 0xd72925, 0xd72824, 0xd82825, 0xd92925, 0xd72a24, 0xda2924, 0xcb322e, 0x70121e, 0x554e2b, 0xf0d654, 0xd7be4e, 0x000002, 0xa12727, 0xdb2c29, 0xdd2725, 0xde2625, 0xde2624, 0xdd2525, 0xd72b2a, 0xaa3635, 0x000000, 0xc3b05d, 0xf9d72e, 0xf9d305, 0xfcd62b, 0xc2ae4d, 0x000000, 0xa02a2a, 0xd82a26, 0xe12425, 0xde2525, 0xd92728, 0xcf2926, 0xc22a2b, 0x9a2b30, 0x2d0014, 0x7b7024, 0xf5d52f, 0xfadb33, 0xab994c, 0x2c2e1e, 0xe5cd47, 0xfad81e, 0xc3ac48, 0x000002, 0xa93533, 0xdc2b29, 0xe22727, 0xe22725, 0xe02627, 0xdd2726, 0xd32f2d, 0x942a2f, 0x06170d, 0xdcc43d, 0xfed91d, 0xd5bd3d, 0x141924, 0xb4b3af, 0x000a23, 0xc6b24d, 0xf7d81d, 0xf0d654, 0x5b5832, 0x5f0017, 0xc4332d, 0xe42824, 0xe8211c, 0xe71f1e, 0xde2422, 0xc6322d, 0x872624, 0x000000, 0xc9b54e, 0xfddc1d, 0xf1d943, 0x605600, 0x9da09c, 0xfffffe, 0xfffffd, 0xfdfdfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffd, 0xfffef9, 0xefcbc7, 0xbb2126, 0xd61a1c, 0xdf1e1e, 0xe41c1f, 0xe21e1f, 0xe22120, 0xe12223, 0xd83030, 0x9c2f2d, 0x0f0000, 0x000001, 0x010101, 0x000000, 0x828585, 0xfcfdfc, 0xfefdfc, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xe6e6e6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xf0f0f0, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefc, 0xfbfbf2, 0x747673, 0x000000, 0xbdb04f, 0xf0d831, 0xf3d300, 0xf2d301, 0xf1d400, 0xf0d200, 0xf0d200, 0xf1d301, 0xf1d301, 0xf0d400, 0xeed300, 0xe6d62c, 0xfaf8ae, 0xfeffef, 0xfdfefe, 0xfefdfc, 0xfefefb, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf9f9f9, 0x63656d, 0x9d9339, 0xf7de38, 0xf7da2f, 0xaa9c3d, 0x000008, 0x000000, 0x3c000b, 0x61000e, 0x7c0217, 0x8f1a1d, 0x9e2626, 0x943431, 0x000000, 0xa89547, 0xf9da31, 0xf1d843, 0x645a1c, 0x65666b, 0x3c404e, 0xb2a037, 0xfcdc27, 0xf3d63a, 0x7a6c31, 0x4c0014, 0xa53132, 0xa7272c, 0x9a2324, 0x8b181e, 0x740118, 0x550010, 0x250007, 0x000000, 0x9d8f4c, 0xc7b86e, 0x000000, 0x640014, 0x982326, 0x972124, 0x962023, 0x952023, 0x941f23, 0x931d22, 0x911d22, 0x8f1d23, 0x8e1c23, 0x8d1c22, 0x8d1d23, 0x8d1c23, 0x8b1b23, 0x8b1924, 0x8c1822, 0x7f1f24, 0x3a0015, 0x5e5328, 0xeed74d, 0xcbb748, 0x01000e, 0x4a0004, 0x8a1d24, 0x931e24, 0x921c22, 0x921d21, 0x921d21, 0x911d22, 0x8f1c21, 0x8e1b21, 0x8d1b21, 0x8d1c22, 0x8c1c21, 0x8c1b21, 0x8b1b21, 0x8a1920, 0x89191e, 0x8b151f, 0x7c181e, 0x040000, 0x7d7132, 0xf9db47, 0xe0c64c, 0x00000f, 0x560010, 0x932627, 0x982627, 0x992525, 0x9a2425, 0x972225, 0x901f27, 0x62031e, 0x000000, 0xceb751, 0xf8d725, 0xfad510, 0xf9d60b, 0xedd547, 0x716330, 0x4f0011, 0xa4312e, 0xa42626, 0x901b1f, 0x770018, 0x580006, 0x2d0000, 0x000000, 0x4e421c, 0xd2bb3c, 0xfad819, 0xf4db47, 0x81783f, 0x24251e, 0xe0cd4f, 0xfbda1f, 0xcfb74a, 0x000001, 0x5f0c1c, 0x911c21, 0x971a21, 0x971c1e, 0x951920, 0x94151d, 0x84171d, 0x3f0012, 0x443e1b, 0xe7cd3c, 0xfcd820, 0xccb747, 0x000012, 0xdadad6, 0x65686b, 0x83762e, 0xefd53f, 0xf9de35, 0xc6b459, 0x000000, 0x640413, 0xad2b2d, 0xc82f2e, 0xc42f2c, 0xad2f2d, 0x75201e, 0x000000, 0x8a7d3c, 0xf3d642, 0xfbdf17, 0xd3c451, 0x000000, 0xcecfc9, 0xfffffc, 0xfefefd, 0xfdfdfe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfffefe, 0xfdfffe, 0xfefefd, 0xfefefd, 0xfdfefd, 0xfff1ed, 0xce8180, 0xc70000, 0xde1d1d, 0xdd1f1e, 0xe31c20, 0xe41d1e, 0xde211f, 0xdc2a2a, 0xb23434, 0x360709, 0x000000, 0x010101, 0x000000, 0x000000, 0xd0d0d0, 0xffffff, 0xfdfcfd, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xfefefd, 0xfdfdfd, 0xf6f6f6, 0xc7c7c7, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd8d8d8, 0xf9f9f9, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefffe, 0xfefefb, 0xfffffa, 0xced0c0, 0xa49937, 0xedd83e, 0xf0d300, 0xf2d301, 0xf1d401, 0xf1d302, 0xefd200, 0xefd200, 0xf0d200, 0xf0d200, 0xf1d302, 0xf3d302, 0xead000, 0xede470, 0xffffd5, 0xfefff7, 0xfdfff9, 0xfdfef8, 0xfefdff, 0xfefdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xa2a2a4, 0x4c4700, 0xead84f, 0xf9db1e, 0xf2d93a, 0xd3bb46, 0xb39e43, 0x988538, 0x79692d, 0x5a4f22, 0x39361a, 0x151a13, 0x000006, 0x302d1c, 0xd9c14b, 0xf9dd23, 0xddca52, 0x000000, 0xc2c3c2, 0x919296, 0x756e0a, 0xf5dd3c, 0xfddc26, 0xc8b047, 0x2b0f16, 0x000001, 0x000005, 0x161411, 0x3d3918, 0x685c2a, 0x897733, 0xa8913c, 0xc6ad46, 0xeed041, 0xf5d644, 0xc7ac57, 0x6e5b33, 0x393019, 0x332a16, 0x332a15, 0x362c16, 0x3a2f17, 0x3e3218, 0x413519, 0x433719, 0x453819, 0x46391b, 0x473a1a, 0x463a1a, 0x473a1a, 0x463c1b, 0x483f1f, 0x4e431d, 0x685b27, 0xccb548, 0xf6dc2b, 0xf6d636, 0xd1b752, 0x7a6e37, 0x423a1b, 0x3e341b, 0x3e331a, 0x3d3318, 0x3d3218, 0x3d3319, 0x3f341a, 0x3f351a, 0x41371a, 0x42381b, 0x43391c, 0x443a1c, 0x443a1d, 0x453a1d, 0x453c1d, 0x443f1d, 0x463f1e, 0x604f23, 0xceb548, 0xf9dc26, 0xf8d93e, 0xbfa64b, 0x5c5125, 0x2c2d1a, 0x101512, 0x00090f, 0x071010, 0x1c1d15, 0x373319, 0x625725, 0xb59c47, 0xf1d03f, 0xf6d61b, 0xe9d12f, 0xf5d821, 0xfad927, 0xcfb54d, 0x160b14, 0x000000, 0x000000, 0x1b2012, 0x5b5426, 0x887839, 0xaf9443, 0xceac43, 0xeac53e, 0xfbd521, 0xfade2d, 0xd3c455, 0x000000, 0x000000, 0xccbc53, 0xf9da28, 0xf2d53a, 0xb09a41, 0x5c4b24, 0x323118, 0x272715, 0x232215, 0x262515, 0x2c2d18, 0x3c391c, 0x635622, 0xc4a93f, 0xf7d226, 0xfada3b, 0xa89848, 0x393f4b, 0xf6f6f2, 0xc0c0bc, 0x000000, 0xc5b44d, 0xf9dc28, 0xfbdd46, 0xbca855, 0x2c2a1e, 0x000000, 0x240002, 0x230001, 0x000000, 0x000005, 0x928341, 0xe6d246, 0xf8db16, 0xf4dc47, 0x7e742a, 0x5f6165, 0xf4f5f0, 0xfefffa, 0xfefefd, 0xfdfdfe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfdfefe, 0xfefdfe, 0xfefdfe, 0xfffdfe, 0xfffffe, 0xecc8c6, 0xbf1621, 0xd91a1b, 0xe11d1f, 0xe21d1f, 0xe11b20, 0xdc1f1e, 0xd92324, 0xbf2e31, 0x551514, 0x000000, 0x020000, 0x010202, 0x000000, 0x6b6b6b, 0xf8f7f7, 0xfdfdfd, 0xfdfdfe, 0xfefefe, 0xfefefe, 0xffffff, 0xfffffe, 0xfcfcfc, 0xe5e5e5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xececec, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfffffd, 0xfdfef9, 0xfefefe, 0xfefedc, 0xe9dd61, 0xf1d400, 0xf6d401, 0xf3d405, 0xf0d500, 0xf1d302, 0xeed300, 0xeed300, 0xeed300, 0xefd300, 0xefd301, 0xf2d401, 0xf2d400, 0xe7d52e, 0xf8f5ae, 0xffffee, 0xfefffc, 0xfdfff9, 0xfefdfc, 0xfefdfd, 0xfdfdfe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xe5e5e5, 0x000826, 0x9c923d, 0xf2dd4d, 0xfbdf2a, 0xfbdc1f, 0xf8d925, 0xf7d72a, 0xf6d334, 0xf0cf38, 0xe6cc40, 0xe0c345, 0xd9c143, 0xe3cb44, 0xf4d82d, 0xf9e03e, 0xafa149, 0x131d32, 0xf0efed, 0xc8c7c7, 0x000000, 0xdac74d, 0xffdd1f, 0xf7d92e, 0xe1c341, 0xd2b940, 0xd9ba3d, 0xddbf41, 0xe6c83a, 0xefce38, 0xf5d331, 0xf7d427, 0xfbd723, 0xfbd924, 0xf5d91c, 0xf9d534, 0xf2d048, 0xe7c944, 0xe4c541, 0xe4c43f, 0xe4c43e, 0xe5c43e, 0xe7c53d, 0xe8c63d, 0xe9c63c, 0xeac73b, 0xe9c73e, 0xe8c83d, 0xe9c83d, 0xe9c93c, 0xeac93e, 0xebca42, 0xecce3d, 0xf2d73b, 0xfadc27, 0xfadc13, 0xfbde19, 0xf7de26, 0xf4d845, 0xedcc43, 0xe9c944, 0xe8c742, 0xe7c641, 0xe7c53f, 0xe6c541, 0xe6c541, 0xe6c540, 0xe6c53f, 0xe6c540, 0xe7c641, 0xe7c641, 0xe7c741, 0xe8c742, 0xe8c744, 0xe9c83f, 0xebc842, 0xf0d03a, 0xf8d825, 0xfad814, 0xfbdb1b, 0xf8d833, 0xf0cf42, 0xe4c547, 0xdcbe46, 0xdabb45, 0xdabd43, 0xdebf42, 0xe5c73f, 0xeecf3d, 0xfad52b, 0xf9d817, 0xe9d145, 0x7a6d2c, 0xd1bc3d, 0xfddc26, 0xf7d92f, 0xd6be46, 0xbaa83a, 0xccae3c, 0xdebd3f, 0xedca3a, 0xf6ce36, 0xfbd227, 0xfbd51e, 0xfcda27, 0xf6db3f, 0xd1c44c, 0x4f4a00, 0x64666a, 0x575b62, 0x776c28, 0xefd545, 0xfcd61b, 0xfad22e, 0xedca3d, 0xe4c341, 0xe3bf3b, 0xdfbe3d, 0xe0be3e, 0xe4c13e, 0xeac641, 0xf1cf37, 0xf7d51d, 0xf9d81e, 0xe5d05d, 0x3e3200, 0x979a99, 0xfffffa, 0xf7f6f1, 0x6d7171, 0x463c00, 0xddc751, 0xf8dd29, 0xfbdc3d, 0xe3c551, 0xb29e40, 0x978539, 0x978739, 0xad9945, 0xd8bb4d, 0xf5d53e, 0xf9d80f, 0xf9de3c, 0xb1a146, 0x000000, 0xd1d2ce, 0xfffffc, 0xfdfefb, 0xfefefd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfffdfe, 0xf9fdfd, 0xf9fffc, 0xfff4f0, 0xc97c7c, 0xd50000, 0xe11d1e, 0xe01d1e, 0xe41c1d, 0xdf1d1d, 0xda1d1e, 0xc02c2b, 0x671d1b, 0x000000, 0x000203, 0x020001, 0x000102, 0x000000, 0xc5c5c5, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xf8f8f8, 0xd5d5d5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdddddd, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfffeff, 0xfefefd, 0xfcfefc, 0xfdfef9, 0xfeffe8, 0xf5ef96, 0xead507, 0xf4d400, 0xf4d303, 0xf1d400, 0xf1d301, 0xf0d200, 0xefd100, 0xf1d301, 0xf2d402, 0xf1d302, 0xf0d600, 0xf5d503, 0xefd200, 0xece16e, 0xfffece, 0xfefff6, 0xfcfffc, 0xfefefc, 0xfefefc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfefefe, 0xbebfbf, 0x000000, 0x80762e, 0xcbbe4a, 0xe5d445, 0xf0d73d, 0xf5d82e, 0xf7d723, 0xf9da1f, 0xf6dc16, 0xfcd914, 0xfadc16, 0xfbdc1b, 0xf9e139, 0xd6c856, 0x020000, 0xa2a4a5, 0xffffff, 0xf2f0f1, 0x494c52, 0x7c721f, 0xead649, 0xf7de29, 0xf6db15, 0xf9d81d, 0xfbd71e, 0xf9d81c, 0xf8d820, 0xf9d926, 0xf8d833, 0xf3d644, 0xe9cf47, 0xd6c044, 0xdec742, 0xf8d836, 0xfbd724, 0xfbd61e, 0xfad51c, 0xfad41e, 0xfad41f, 0xf9d31f, 0xfad21d, 0xf9d21b, 0xfad31b, 0xfad31a, 0xf9d31a, 0xf9d41b, 0xfad51a, 0xfbd61a, 0xfdd617, 0xfcd61a, 0xfdda1b, 0xfcdd21, 0xf8dd33, 0xe4ce40, 0xe1c83a, 0xf8db37, 0xfcdc28, 0xfad822, 0xfad51f, 0xf9d31d, 0xf9d31c, 0xf9d21b, 0xf8d21a, 0xf8d219, 0xf8d31a, 0xf9d31b, 0xf9d31c, 0xf9d31d, 0xf9d31d, 0xfad41c, 0xfad41d, 0xf8d61b, 0xf8d717, 0xf9d71b, 0xf9d91e, 0xf5d734, 0xe2c434, 0xe9c935, 0xf7da31, 0xfbd825, 0xfcd71d, 0xfad71c, 0xfad71d, 0xfcd71d, 0xfcd81c, 0xfcd81b, 0xfdd924, 0xf9db38, 0xebd34e, 0x96883c, 0x000000, 0x6b6223, 0xead44c, 0xfcde27, 0xfdd621, 0xfcd51e, 0xfad419, 0xfad51b, 0xfbd522, 0xf8d534, 0xf0d343, 0xe2ca4f, 0xc7b74e, 0x8c8537, 0x000000, 0x5e6064, 0xe9eae4, 0xcfd0cc, 0x000000, 0x978937, 0xe9d045, 0xf5d933, 0xf7d521, 0xfbd318, 0xfad316, 0xfbd114, 0xfad213, 0xf9d316, 0xfad616, 0xfbd628, 0xf8d846, 0xdfcd5b, 0x71692b, 0x2b2d3c, 0xe6e7e4, 0xfffefc, 0xfffefb, 0xe3e3e0, 0x3d3e49, 0x584e02, 0xd8bf52, 0xfad934, 0xfbdb20, 0xfcd929, 0xfad42b, 0xf7d629, 0xf6da29, 0xf7da1c, 0xf8dd25, 0xf2d946, 0xb1a044, 0x000000, 0xabaca6, 0xfefffa, 0xfdfdfb, 0xfefefd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffefd, 0xfefefe, 0xf7fefa, 0xfefcf6, 0xe9c2bf, 0xc3181c, 0xe11f20, 0xe31d22, 0xe31c1d, 0xe21b1c, 0xdb1e1e, 0xc92828, 0x7a2221, 0x000000, 0x000001, 0x030003, 0x000100, 0x000000, 0x646464, 0xf5f5f5, 0xffffff, 0xfefefe, 0xfefefd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefeff, 0xededed, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb3b3b3, 0xf2f2f2, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefffe, 0xfcfefc, 0xfcfdfd, 0xfdfef4, 0xfefdc4, 0xe8dd59, 0xedd400, 0xf4d201, 0xf2d300, 0xf1d300, 0xf1d301, 0xf0d200, 0xf1d301, 0xf2d402, 0xf3d303, 0xf2d401, 0xf4d402, 0xf6d200, 0xebd427, 0xf5ee9a, 0xffffeb, 0xfbfff9, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xcacbcb, 0x505159, 0x000000, 0x281f00, 0x675c00, 0x897b1a, 0xa79630, 0xbfae42, 0xd2bd49, 0xdfc744, 0xddcd44, 0xd5c24e, 0xb0a343, 0x221800, 0x67696c, 0xf1f3ef, 0xfefffb, 0xfefffc, 0xd1d3d1, 0x00021e, 0x584b00, 0xb6a33c, 0xd9c147, 0xdac240, 0xd6c247, 0xd3bd48, 0xc3af43, 0xb1a036, 0x928222, 0x685d02, 0x261c00, 0x000000, 0x180000, 0x93852e, 0xbdaa40, 0xcbb549, 0xcbb64a, 0xcab54b, 0xcab54d, 0xc9b44c, 0xc8b34a, 0xc8b348, 0xc7b348, 0xc7b348, 0xc6b345, 0xc7b344, 0xc8b343, 0xc8b342, 0xc7b33f, 0xc4b13f, 0xc4b03f, 0xb8a33c, 0x8e7d1f, 0x231200, 0x000000, 0x827315, 0xb7a539, 0xc6b24b, 0xc8b346, 0xc8b346, 0xc8b346, 0xc9b346, 0xc8b546, 0xc8b647, 0xc8b547, 0xc8b547, 0xc9b547, 0xc9b448, 0xc9b447, 0xc8b445, 0xc8b343, 0xc8b23d, 0xcab13f, 0xc6ad3f, 0xb8a433, 0x897a19, 0x000000, 0x250b00, 0x92801b, 0xbea73e, 0xcfb647, 0xd4bc4b, 0xd5be4c, 0xd8bf4d, 0xd5bd4a, 0xccb543, 0xbca739, 0x95882f, 0x413100, 0x12172c, 0x9fa0a0, 0x3d404a, 0x726315, 0xcebb4e, 0xe6cd4e, 0xe8cd47, 0xe0ca49, 0xd1ba43, 0xb5a037, 0x907f29, 0x5c5100, 0x000000, 0x00000e, 0x57595f, 0xadafab, 0xf3f4f2, 0xfffffd, 0xfdfdf9, 0xb3b5b3, 0x000000, 0x493f00, 0x9f8f3a, 0xc2aa45, 0xccb446, 0xcdbb4c, 0xd5bc4a, 0xd4bc43, 0xd0b747, 0xc8b142, 0xb8a541, 0x908038, 0x120000, 0x44474c, 0xd9dad6, 0xfffffd, 0xfefefe, 0xfefefe, 0xfefdfb, 0xe1e1e0, 0x5f6265, 0x000000, 0x9a8c34, 0xd4be46, 0xecd247, 0xf3d844, 0xf2d641, 0xefd343, 0xe5cb4c, 0xc2af47, 0x696003, 0x000000, 0xacaead, 0xfcfbfa, 0xfefefc, 0xfefefc, 0xfffffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfdfefd, 0xfdfffb, 0xfde8e3, 0xc76a6c, 0xd8010f, 0xe32021, 0xe71d21, 0xe61c1f, 0xdf1d1f, 0xd22727, 0x942827, 0x030000, 0x000000, 0x010000, 0x010101, 0x000000, 0x000000, 0xc3c3c3, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefd, 0xfdfdfe, 0xfdfdfd, 0xf9f9fa, 0xd6d6d6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd7d7d7, 0xfbfbfb, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfdfefd, 0xfcfdfc, 0xfdfef9, 0xffffdd, 0xf4ee91, 0xe6d10a, 0xf3d100, 0xf2d101, 0xf1d201, 0xf1d301, 0xf0d200, 0xf1d301, 0xf1d301, 0xf1d201, 0xf1d302, 0xf5d204, 0xfad102, 0xf6d01a, 0xd9ae58, 0xf9eeda, 0xfffffa, 0xfefcfd, 0xfdfcfd, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xf2f2f2, 0xd7d7d7, 0xb8b8b8, 0x969696, 0x737478, 0x464854, 0x000a2f, 0x000000, 0x000000, 0x000000, 0x000000, 0x1f2a36, 0x9d9e9d, 0xeeeeeb, 0xfffffc, 0xfefff9, 0xfcfdf8, 0xfcfdfb, 0xdddddc, 0x838383, 0x000625, 0x000000, 0x000000, 0x000000, 0x000000, 0x162033, 0x464a56, 0x75777d, 0x9a9a9c, 0xbcbdba, 0xccccc9, 0xaeaeae, 0x606169, 0x2f3442, 0x19232f, 0x0d1a27, 0x071726, 0x0e1b2a, 0x151f2e, 0x162030, 0x172131, 0x1c2434, 0x1f2735, 0x262c38, 0x262c37, 0x252c37, 0x272d38, 0x2a2f3c, 0x313543, 0x373c48, 0x3f444f, 0x75777e, 0xb3b4b4, 0xb9b9b8, 0x7c7c81, 0x3e404e, 0x2c313f, 0x232a35, 0x1e2631, 0x1c2531, 0x1c2530, 0x1c2630, 0x1d2631, 0x1e2731, 0x202933, 0x222a35, 0x232b35, 0x252c36, 0x262d38, 0x29303a, 0x2f3541, 0x363a44, 0x383c46, 0x40444f, 0x78797b, 0xb7b7b5, 0xb7b7b7, 0x717279, 0x3b3e4c, 0x1b2332, 0x00000a, 0x000000, 0x000000, 0x000000, 0x000019, 0x2b3142, 0x5f6267, 0x9d9f9c, 0xdfe1da, 0xfefffb, 0xe0e1de, 0x727376, 0x000000, 0x1f0d00, 0x342900, 0x190a00, 0x000000, 0x2a313f, 0x6b6d72, 0x9e9f9e, 0xc4c5bf, 0xe2e2dc, 0xf6f7f2, 0xfffffb, 0xfffffb, 0xfefffa, 0xfdfdf9, 0xfcfdf8, 0xdadbd7, 0x969796, 0x55585e, 0x353d45, 0x18232f, 0x151c25, 0x121a20, 0x101822, 0x191f2a, 0x2c313b, 0x454a50, 0x767979, 0xb4b5b2, 0xeeefea, 0xfffffb, 0xfbfcf8, 0xffffff, 0xffffff, 0xfbfbfb, 0xfefefc, 0xf1f1ed, 0xacaca8, 0x373d44, 0x000000, 0x3d3500, 0x615701, 0x645a04, 0x4a4000, 0x000000, 0x000013, 0x7e7f7e, 0xd3d4cf, 0xfdfefa, 0xfdfdfc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfffe, 0xfefefd, 0xfff9f8, 0xdda7a4, 0xc50000, 0xe31e24, 0xe51d1f, 0xe81e1d, 0xe41f21, 0xda2728, 0xab2e2b, 0x320b09, 0x000000, 0x020001, 0x000000, 0x010101, 0x000000, 0x636363, 0xf3f3f3, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xf0f0f0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb1b1b1, 0xf0f0f0, 0xfdfdfd, 0xfefefe, 0xfffefe, 0xfefdfb, 0xfdfdf8, 0xfdfef9, 0xfffff2, 0xfefcc7, 0xe6da52, 0xeecf00, 0xf3ce01, 0xf0d001, 0xf0d300, 0xf0d200, 0xf1d301, 0xf1d301, 0xf3d202, 0xf1d300, 0xf5d302, 0xfad40d, 0xf2ab20, 0xb72400, 0xd9ac9c, 0xfffdf5, 0xfdfefd, 0xfdfdfa, 0xfcfcfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfffffd, 0xfafbf3, 0xf4f5ec, 0xe8e9e1, 0xdededb, 0xd3d2d3, 0xcbcaca, 0xd8d7d4, 0xedeee7, 0xfdfef8, 0xfcfdf8, 0xfefefa, 0xfefefa, 0xfdfcf8, 0xfdfcf9, 0xfdfdfc, 0xfbfbf9, 0xeaeae6, 0xdbdcd9, 0xd5d5d4, 0xdadad9, 0xe0e1dd, 0xe9eae7, 0xf4f6f3, 0xfbfbfa, 0xfffffd, 0xfffffb, 0xfffffa, 0xfffffd, 0xf8f8f7, 0xeeefed, 0xe9e9e6, 0xe8e7e3, 0xe7e6e2, 0xe8e8e4, 0xe9e9e5, 0xe8e9e6, 0xe8eae6, 0xeaebe7, 0xeaebe8, 0xebede9, 0xebede9, 0xebede9, 0xecedea, 0xebedea, 0xecf0eb, 0xeff3ec, 0xf1f4ed, 0xfafcf6, 0xfffffc, 0xfffffc, 0xfafaf8, 0xf3f3f3, 0xededec, 0xebebe8, 0xebeae7, 0xebeae7, 0xebeae8, 0xeaeae7, 0xeaeae7, 0xeaeae7, 0xebebe8, 0xebebe8, 0xebebe8, 0xecebe9, 0xecece9, 0xededea, 0xecefed, 0xeef0ec, 0xf0f2eb, 0xf2f4ee, 0xfbfcf7, 0xfffffb, 0xfffffb, 0xf9f9f6, 0xf2f2f1, 0xe8e9e6, 0xe2e2df, 0xe0e1de, 0xe0e0dd, 0xe0e1dd, 0xe3e5df, 0xeef0ea, 0xf8faf3, 0xfdfff8, 0xfefef6, 0xfafcf1, 0xfdfef6, 0xf8f8f6, 0xdadad9, 0xbdbfba, 0xb6b5b2, 0xc4c4c0, 0xdcdcd6, 0xeeefea, 0xfafaf8, 0xfffffc, 0xfffff9, 0xfffff8, 0xfdfef8, 0xfcfdf7, 0xfefffa, 0xfffffa, 0xfcfdf8, 0xfdfdf8, 0xfefffa, 0xfefffa, 0xf6f6f2, 0xf1f1ec, 0xe9e9e6, 0xe6e5e4, 0xe4e3e3, 0xe3e4e1, 0xe6e7e3, 0xedeee9, 0xf4f6f0, 0xfcfdf7, 0xfffffb, 0xfefff9, 0xfcfcf9, 0xfcfcfa, 0xffffff, 0xffffff, 0xfdfdfc, 0xfcfcfa, 0xfefcf9, 0xfffef8, 0xf0f1ea, 0xcdcfcc, 0xa9aaac, 0x929293, 0x8d8c8d, 0xa1a19f, 0xc1c2bc, 0xe4e6de, 0xfcfdf6, 0xfffffa, 0xfcfdf9, 0xfcfcfa, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfefd, 0xfffefd, 0xf4d4d3, 0xbc3b3d, 0xdc1316, 0xe71c1f, 0xe71b1f, 0xe91e1f, 0xdf2425, 0xbf3130, 0x531412, 0x000000, 0x020204, 0x020100, 0x000000, 0x010101, 0x000000, 0xc0c0c0, 0xffffff, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xf9f9f9, 0xe8e8e8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e1, 0xfbfbfb, 0xfefefe, 0xfefefd, 0xfdfcfa, 0xfefefa, 0xfdfdfa, 0xfdfdfd, 0xffffea, 0xf2ed94, 0xe5cf00, 0xf1ce00, 0xf1d100, 0xf0d200, 0xf1d301, 0xf1d301, 0xf1d301, 0xf2d301, 0xf3d202, 0xf6d607, 0xf5bb1d, 0xd94e0e, 0xd7130c, 0xbe392c, 0xefd3c9, 0xfefdf8, 0xfdfdfa, 0xfbfbfb, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfefff9, 0xfffff9, 0xfffffb, 0xfffffc, 0xfffffc, 0xfffffd, 0xfffffd, 0xfffffc, 0xfdfef9, 0xfdfef9, 0xfdfdfb, 0xfdfdfb, 0xfefefb, 0xfefefc, 0xfefefe, 0xfffefe, 0xfffffe, 0xfffffc, 0xfffffe, 0xfffffd, 0xfffffb, 0xfffff9, 0xfefff9, 0xfefffa, 0xfefefb, 0xfffefb, 0xfdfefb, 0xfefff9, 0xfefffa, 0xfefff9, 0xfffffb, 0xfffffc, 0xfffffb, 0xfffffc, 0xfffffc, 0xfffffb, 0xfffffc, 0xfffffc, 0xfffffb, 0xfffffc, 0xfffffc, 0xfffffc, 0xfffffc, 0xfffffb, 0xfefffa, 0xfffffb, 0xfffffc, 0xfffefe, 0xfefefd, 0xfefefa, 0xfefffa, 0xfefffa, 0xfffffc, 0xfffffe, 0xfffffe, 0xfffffe, 0xfffffe, 0xfffffd, 0xfffffd, 0xfffffd, 0xfffffd, 0xfffffc, 0xfffffb, 0xfffffc, 0xfffffd, 0xfffffc, 0xfffff8, 0xfffff8, 0xfffffa, 0xfffffb, 0xfffefb, 0xfefefb, 0xfefef8, 0xfefff7, 0xfffff8, 0xfffffc, 0xfffffe, 0xffffff, 0xfffffe, 0xffffff, 0xffffff, 0xfffffc, 0xfffffa, 0xfffefa, 0xfffefd, 0xfffefa, 0xfffff7, 0xfffffa, 0xffffff, 0xffffff, 0xfffffb, 0xfffffb, 0xfffffd, 0xfffffa, 0xfffffa, 0xfffefc, 0xfffdfd, 0xfffefc, 0xfffefa, 0xfffffa, 0xfffffb, 0xfffffb, 0xfefffc, 0xfefefc, 0xfefffc, 0xfffffc, 0xfffffd, 0xfffffc, 0xfffffd, 0xfffffc, 0xfffffc, 0xfffffc, 0xfffffc, 0xfffffb, 0xfffff9, 0xfffffa, 0xfffffa, 0xfffffb, 0xfefefc, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefc, 0xfefdfb, 0xfefdfb, 0xffffff, 0xfffffe, 0xfffff9, 0xfffffb, 0xfffff7, 0xfffff7, 0xfffffd, 0xfffffd, 0xfffffb, 0xfefefb, 0xfefefc, 0xfffefc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefd, 0xfbfdf8, 0xfef1eb, 0xcb7e7c, 0xcb0000, 0xe31f1f, 0xe91c1f, 0xe81c1f, 0xe42326, 0xca3233, 0x73211f, 0x000000, 0x000103, 0x010101, 0x000100, 0x010101, 0x000000, 0x696969, 0xf4f4f4, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xeeeeee, 0x717171, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb7b7b7, 0xf5f5f5, 0xffffff, 0xfefefd, 0xfdfdfd, 0xfdfdfe, 0xfdfdfb, 0xfdfcfd, 0xfdfdf6, 0xfdfcc9, 0xeadd54, 0xeccd00, 0xf3d201, 0xf0d200, 0xf1d401, 0xf1d301, 0xf1d301, 0xf0d401, 0xf8d407, 0xfac119, 0xd96016, 0xdf1616, 0xe2251f, 0xcd0000, 0xc5706c, 0xfeeae5, 0xfefdfb, 0xfcfbfc, 0xfefefe, 0xfefdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefd, 0xfefffb, 0xfefefd, 0xfefefd, 0xfffefc, 0xfdfdfb, 0xfdfdfb, 0xfdfdfb, 0xfdfefb, 0xfdfefb, 0xfdfdfc, 0xfdfdfc, 0xfdfdfc, 0xfcfcfb, 0xfdfefd, 0xfefefe, 0xfffefe, 0xfffdfd, 0xfffdfc, 0xfdfefb, 0xfdfefa, 0xfdfefa, 0xfdfefb, 0xfefdfb, 0xfefefa, 0xfdfdfa, 0xfdfdfb, 0xfefefc, 0xfefefb, 0xfefffb, 0xfefefb, 0xfefdfc, 0xfdfefa, 0xfdfefa, 0xfcfdfb, 0xfdfdfd, 0xfdfdfc, 0xfdfdfb, 0xfefefb, 0xfefefb, 0xfefefb, 0xfdfefa, 0xfdfefa, 0xfdfefa, 0xfdfefa, 0xfdfefa, 0xfdfefa, 0xfdfdfa, 0xfefdfb, 0xfefdfb, 0xfdfefc, 0xfefffb, 0xfefffb, 0xfefefc, 0xfefdfd, 0xfdfdfc, 0xfdfdfc, 0xfdfefc, 0xfdfefc, 0xfdfefb, 0xfdfefb, 0xfdfefb, 0xfdfefb, 0xfdfefa, 0xfdfef9, 0xfdfefa, 0xfdfefb, 0xfdfffc, 0xfefefb, 0xfefefc, 0xfefffd, 0xfefefc, 0xfefefb, 0xfefefc, 0xfffefd, 0xfffdfc, 0xfffefa, 0xfefefb, 0xfdfefb, 0xfdfdfb, 0xfdfefb, 0xfcfdfb, 0xfdfefb, 0xfefffa, 0xfefffb, 0xfefefc, 0xfdfefb, 0xfefefc, 0xfffefc, 0xfefefb, 0xfefdfa, 0xfffdfb, 0xfefdfc, 0xfffefd, 0xfefefb, 0xfffefc, 0xfffefc, 0xfffefb, 0xfffefb, 0xfffefc, 0xfffdfd, 0xfffefd, 0xfffefd, 0xfffdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefeff, 0xfefefd, 0xfefefb, 0xfefdfc, 0xfefdfb, 0xfffdfc, 0xfffdfb, 0xfefefb, 0xfefffb, 0xfefefc, 0xfefefd, 0xfefefd, 0xfffffe, 0xfefefd, 0xfefefd, 0xfefefe, 0xffffff, 0xfffffe, 0xfffffd, 0xfefefd, 0xfffefe, 0xfefefb, 0xfefdfa, 0xfefdfc, 0xfdfefa, 0xfdfefa, 0xfdfefb, 0xfdfefc, 0xfefefd, 0xfefefd, 0xfefefe, 0xfffdfe, 0xfffdfe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfefe, 0xfefefe, 0xfdfefe, 0xfefffd, 0xfffcf5, 0xe5b3b1, 0xbf0000, 0xde1d1d, 0xe81d21, 0xe81c1f, 0xe4211e, 0xd23130, 0x882728, 0x000000, 0x000204, 0x010202, 0x010001, 0x000002, 0x000000, 0x000000, 0xcecece, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xededed, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe0e0e0, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfcfd, 0xfcfdfa, 0xffffe6, 0xf7f198, 0xe6d002, 0xf3cf00, 0xf1d101, 0xeed401, 0xf0d201, 0xf1d302, 0xf3d600, 0xfbc71a, 0xdb7012, 0xd91211, 0xe4261d, 0xe3231e, 0xdc201e, 0xbc0000, 0xdaa69f, 0xfff6f0, 0xfcfaf9, 0xfafefa, 0xfdfcfa, 0xfefeff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefd, 0xffffff, 0xffffff, 0xfdfdfc, 0xfdfdfc, 0xfdfcfd, 0xfcfcfd, 0xfdfcfc, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefeff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xfefdfd, 0xfefdfd, 0xfefdfd, 0xfefdfe, 0xfefdfe, 0xfefefd, 0xfefefe, 0xfefefd, 0xfefefe, 0xfefefd, 0xfefefd, 0xfefefd, 0xfdfefd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfefd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefdfe, 0xfdfdfd, 0xfefdfd, 0xfefdfd, 0xfefdfd, 0xfefefe, 0xfefefe, 0xfffefe, 0xfefefe, 0xfffefe, 0xfefefd, 0xfffefe, 0xfffefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefd, 0xfefefd, 0xfefefd, 0xfefefd, 0xfdfefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefe, 0xfefdfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xfdfdfe, 0xfefefd, 0xfefefc, 0xfefefc, 0xfefefc, 0xfefefb, 0xfefefd, 0xfefefe, 0xfefefe, 0xfffeff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefd, 0xfefdfd, 0xfefdfd, 0xfefdfe, 0xfdfdfc, 0xfefefd, 0xfefffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfcfdfc, 0xfdfdfd, 0xfcfcfc, 0xfcfcfc, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfe, 0xfbfffd, 0xfefdfc, 0xfdfdfd, 0xfffffa, 0xf4dcd4, 0xbc4747, 0xd40c0d, 0xe41c1e, 0xe91b21, 0xe21e1e, 0xd42e2a, 0x9d2b2c, 0x1b0000, 0x000000, 0x000001, 0x000000, 0x000000, 0x030303, 0x000000, 0x848484, 0xf9f9f9, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfbfbfb, 0xf3f3f3, 0x808080, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xaaaaaa, 0xf3f3f3, 0xfbfbfb, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefdfe, 0xfefef7, 0xfffece, 0xeee064, 0xeacd00, 0xf1d202, 0xf3d104, 0xf4d003, 0xf6d100, 0xfccc14, 0xe38319, 0xd71413, 0xe6251a, 0xe4251e, 0xe5201e, 0xe31f1f, 0xd61c1b, 0xb93735, 0xf1d2ca, 0xfffdf7, 0xfffdfb, 0xfdfdfb, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefdfe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffeff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefeff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefd, 0xfefefd, 0xfffffd, 0xfefefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefcfd, 0xfefdfc, 0xfbfefd, 0xfcfdfc, 0xffefed, 0xc98280, 0xc80000, 0xdf1c1d, 0xe61c1c, 0xe11f1b, 0xd52a28, 0xa73030, 0x320504, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x111111, 0xdddddd, 0xfefefe, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xf8f8f8, 0xdbdbdb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e1, 0xfbfbfb, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefdfd, 0xfdfefe, 0xfefff0, 0xfcf7af, 0xe5d63c, 0xeed200, 0xf6d002, 0xf6d102, 0xfdce12, 0xed9919, 0xd2260e, 0xe5231c, 0xe52520, 0xe6221f, 0xe42120, 0xe32020, 0xe32320, 0xd30000, 0xcb7772, 0xfdede2, 0xfcfff9, 0xfefdfb, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xffffff, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xfbfbfb, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfcfefc, 0xfbfdfb, 0xfdfef7, 0xe4b7b3, 0xc10004, 0xdf1b1c, 0xe81a1c, 0xe71a1d, 0xdb2422, 0xb23131, 0x3d0e10, 0x000000, 0x020102, 0x010101, 0x010101, 0x020202, 0x030303, 0x000000, 0xa5a5a5, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xe8e8e8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x5a5a5a, 0xececec, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfc, 0xfdfdfa, 0xfdfefe, 0xfdfff7, 0xffffde, 0xf4f09a, 0xe8d22d, 0xf7d100, 0xfcce0f, 0xf5a71f, 0xd23b10, 0xe02318, 0xe4251b, 0xe2241d, 0xe32021, 0xe22120, 0xe32222, 0xe42320, 0xe42324, 0xc90000, 0xdda9a2, 0xfffcf5, 0xfefefc, 0xfdfefd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xdfdfdf, 0xb6b6b6, 0xbbbbbb, 0xbbbbbb, 0xbababa, 0xb9b9b9, 0xb5b5b5, 0xe7e7e7, 0xcbcbcb, 0xafafaf, 0xd6d6d6, 0xffffff, 0xf2f2f2, 0xb9b9b9, 0xb6b6b6, 0xeeeeee, 0xebebeb, 0xb4b4b4, 0xbababa, 0xf5f5f5, 0xffffff, 0xeeeeee, 0xbcbcbc, 0xaaaaaa, 0xb0b0b0, 0xd0d0d0, 0xf6f6f6, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xffffff, 0xe9e9e9, 0xbababa, 0xa6a6a6, 0xb5b5b5, 0xdbdbdb, 0xededed, 0xbebebe, 0xb1b1b1, 0xeeeeee, 0xffffff, 0xdbdbdb, 0xaeaeae, 0xd1d1d2, 0xfefefe, 0xf5f5f5, 0xbcbcbc, 0xb0b0b0, 0xebebeb, 0xffffff, 0xd8d8d8, 0xababab, 0xb7b7b7, 0xf6f6f6, 0xfefefe, 0xfdfdfd, 0xffffff, 0xfefefe, 0xdcdcdc, 0xb2b2b2, 0xa8a8a8, 0xb5b5b5, 0xdedede, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xe6e6e6, 0xadadad, 0xb9b9b9, 0xf5f5f5, 0xfdfdfd, 0xcdcdcd, 0xb2b2b2, 0xdfdfdf, 0xffffff, 0xe9e9e9, 0xb0b0b0, 0xbcbcbc, 0xf6f6f6, 0xfefefe, 0xcacaca, 0xaeaeae, 0xc8c8c8, 0xfafafa, 0xfdfdfd, 0xffffff, 0xffffff, 0xe3e3e3, 0xb4b4b4, 0xa7a7a7, 0xb6b6b6, 0xdadada, 0xfafafa, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefe, 0xfbfffc, 0xfffffb, 0xf7dcd5, 0xc24b48, 0xdb030d, 0xe81b1b, 0xe71b1e, 0xdc1f21, 0xbb2f2d, 0x5c191a, 0x000000, 0x020100, 0x020002, 0x010101, 0x010101, 0x040404, 0x000000, 0x525252, 0xefefef, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfafafa, 0xdadada, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xfafafa, 0xfefefe, 0xfefdfe, 0xfefdfd, 0xfdfefc, 0xfdfefd, 0xfdfef8, 0xfefef4, 0xfdfeda, 0xedde75, 0xf7cd0c, 0xf9b321, 0xd74e0d, 0xde1c1b, 0xe6261f, 0xe52321, 0xe4221d, 0xe32222, 0xe42222, 0xe42323, 0xe52423, 0xe52424, 0xdd1f20, 0xbf3336, 0xeed1cd, 0xfffffe, 0xfefdfe, 0xfefdfe, 0xfefefd, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xaaaaaa, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc5c5c6, 0x747475, 0x000000, 0x9d9d9d, 0xffffff, 0xe2e2e2, 0x000000, 0x000000, 0xd9d9d9, 0xd4d4d4, 0x000000, 0x121212, 0xececec, 0xebebeb, 0x5f5f5f, 0x000000, 0x000000, 0x000000, 0x000000, 0xe2e2e2, 0xfefefe, 0xfdfdfd, 0xffffff, 0xe2e2e2, 0x484848, 0x000000, 0x000000, 0x000000, 0x3e3e3e, 0xd9d9d9, 0x000000, 0x000000, 0xcccccc, 0xffffff, 0x797979, 0x000000, 0x777777, 0xffffff, 0xdbdbdc, 0x000000, 0x111110, 0xececec, 0xfbfbfb, 0x6f6f6f, 0x000000, 0x000000, 0xcfcfcf, 0xffffff, 0xfefefe, 0xfcfcfc, 0xa7a7a7, 0x000000, 0x000000, 0x000000, 0x000000, 0x858585, 0xfcfcfc, 0xfefefe, 0xffffff, 0xd6d6d6, 0x000000, 0x000000, 0xe2e2e2, 0xf9f9f9, 0x585858, 0x000000, 0x9a9a9a, 0xffffff, 0xbebfbf, 0x000000, 0x595959, 0xf7f7f7, 0xf1f1f1, 0x444444, 0x000000, 0x212121, 0xe9e9e9, 0xffffff, 0xffffff, 0xdadada, 0x242424, 0x000000, 0x000000, 0x000000, 0x4e4e4e, 0xf4f4f4, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffefe, 0xfefffe, 0xfefefd, 0xfefffe, 0xfefdfd, 0xfdfffd, 0xfef1eb, 0xce7f7c, 0xd30000, 0xe81c1e, 0xe71d1c, 0xe01f1f, 0xc92c2d, 0x70211d, 0x000000, 0x000101, 0x010100, 0x010002, 0x010101, 0x010101, 0x000000, 0x000000, 0xc9c9c9, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xebebeb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe7e7e7, 0xfcfcfc, 0xfffefe, 0xfffdfd, 0xfefefb, 0xfefefb, 0xfefefb, 0xfdfef8, 0xfdfff1, 0xfaf5bc, 0xefbe4f, 0xd45f0c, 0xd71c1a, 0xe42822, 0xe32621, 0xe32421, 0xe42322, 0xe42222, 0xe42423, 0xe32322, 0xe42323, 0xe52323, 0xe32425, 0xd00e0d, 0xc66a69, 0xfae8e4, 0xfefffd, 0xfefffe, 0xfefdfd, 0xfdfdfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xd0d0d0, 0x959595, 0x7a7a7a, 0x000000, 0x000001, 0x8b8b8a, 0x9b9b9a, 0xdadad9, 0x737374, 0x000000, 0xa2a2a2, 0xffffff, 0xe8e8e8, 0x1e1e1e, 0x000000, 0xd8d8d8, 0xd6d6d6, 0x000000, 0x373737, 0xeeeeee, 0xacacac, 0x000000, 0x575757, 0xc1c1c1, 0xb7b7b7, 0x9d9d9d, 0xf4f4f4, 0xfefefe, 0xfdfdfd, 0xffffff, 0x989898, 0x000000, 0x5f5f5f, 0xc6c6c6, 0xb6b6b6, 0x9c9c9c, 0xf2f2f2, 0x727272, 0x000000, 0xb5b5b5, 0xf3f3f3, 0x3e3e3e, 0x000000, 0x4f4f4f, 0xf6f6f6, 0xc3c3c3, 0x000000, 0x7b7b7b, 0xffffff, 0xe3e3e3, 0x090909, 0x000000, 0x000000, 0x999999, 0xfdfdfd, 0xffffff, 0xbebebe, 0x000000, 0x000000, 0x838383, 0xacacac, 0x989898, 0xcacaca, 0xfefefe, 0xfdfdfd, 0xffffff, 0xededed, 0x383838, 0x000000, 0xcccccc, 0xe8e8e8, 0x101010, 0x000000, 0x717171, 0xffffff, 0xa3a3a3, 0x000000, 0x979797, 0xffffff, 0xd2d2d2, 0x000000, 0x000000, 0x000000, 0xbcbcbc, 0xffffff, 0xffffff, 0x929292, 0x000000, 0x6f6f6f, 0xcccccc, 0xadadad, 0xaaaaaa, 0xfbfbfb, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfcfdfc, 0xfefcfd, 0xfdfdfe, 0xfefdfd, 0xfef8f4, 0xd9a4a0, 0xc40000, 0xe51f23, 0xe91d21, 0xe61f20, 0xd42a2c, 0x862626, 0x000000, 0x000000, 0x000100, 0x000201, 0x020101, 0x010101, 0x040404, 0x000000, 0x8f8f8f, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xf5f5f5, 0xc5c5c5, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcacaca, 0xf6f6f6, 0xfefefc, 0xfefefb, 0xfefffb, 0xfefffa, 0xfefffb, 0xfefff9, 0xfefef8, 0xffffec, 0xdfbf9f, 0xbf0000, 0xde2520, 0xe32522, 0xe22522, 0xe22422, 0xe32223, 0xe42323, 0xe42423, 0xe32422, 0xe42322, 0xe52323, 0xe52424, 0xe32624, 0xcf0000, 0xd08e8b, 0xfff4ed, 0xfdfffb, 0xfcfdfc, 0xfffdfe, 0xfdfdfc, 0xfdfefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfb, 0xfdfdfd, 0xffffff, 0xd2d2d2, 0x000000, 0x0a0a0c, 0xe6e6e6, 0xfffffe, 0xf7f7f7, 0x6d6d6d, 0x000000, 0x8d8d8d, 0xebebeb, 0xcfcfcf, 0x1a1a1a, 0x000000, 0xd7d7d7, 0xd6d6d6, 0x000000, 0x3a3a3a, 0xeeeeee, 0x989898, 0x000000, 0x595959, 0xdddddd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xfdfdfd, 0x7d7d7d, 0x000000, 0x676767, 0xe6e6e6, 0xffffff, 0xfbfbfb, 0xf8f8f8, 0xa0a0a0, 0x000000, 0x949494, 0xd9d9d9, 0x000000, 0x000000, 0x000000, 0xdfdfdf, 0xa6a6a6, 0x000000, 0xa8a8a8, 0xffffff, 0xb7b7b7, 0x000000, 0x6a6a6a, 0x131313, 0x545454, 0xf3f3f3, 0xfafafa, 0x6d6d6d, 0x000000, 0x747474, 0xf7f7f7, 0xffffff, 0xffffff, 0xffffff, 0xfbfbfb, 0xfdfdfd, 0xffffff, 0xfafafa, 0x747474, 0x000000, 0xacacac, 0xc8c8c8, 0x000000, 0x000000, 0x363636, 0xeaeaea, 0x7f7f7f, 0x000000, 0xbfbfbf, 0xffffff, 0x9f9f9f, 0x000000, 0x464646, 0x000000, 0x7e7e7e, 0xfbfbfb, 0xfdfdfd, 0x7c7c7c, 0x000000, 0x6c6c6c, 0xe3e3e3, 0xffffff, 0xffffff, 0xfbfbfb, 0xfdfdfd, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfdfefb, 0xfefdfe, 0xfcfeff, 0xfbfffe, 0xfffefa, 0xe9c5c0, 0xbe2326, 0xde191a, 0xe91f23, 0xe42123, 0xdd2a27, 0xa4292b, 0x080302, 0x000000, 0x000100, 0x000201, 0x000201, 0x020102, 0x020202, 0x000000, 0x424242, 0xe9e9e9, 0xffffff, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfbfbfb, 0xe4e4e4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdedede, 0xfbfbf9, 0xfcfcf8, 0xfefffa, 0xfefffa, 0xfefffa, 0xfefffa, 0xfffefa, 0xfcfcf4, 0xfaeedf, 0xc06e64, 0xd20400, 0xe2221f, 0xe32121, 0xe32121, 0xe42223, 0xe42223, 0xe42423, 0xe32322, 0xe42323, 0xe52323, 0xe42423, 0xe32221, 0xdd2321, 0xbd0000, 0xd8a7a3, 0xfff4ee, 0xfbfcf6, 0xfefdfd, 0xfefefd, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xd3d3d3, 0x000000, 0x1b1b1c, 0xe8e8e7, 0xfffffd, 0xf7f7f6, 0x6d6d6d, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xd6d6d6, 0x000000, 0x3a3a3a, 0xefefef, 0xcacaca, 0x000000, 0x000000, 0x000000, 0x828282, 0xd8d8d8, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xc0c0c0, 0x000000, 0x000000, 0x1a1a1a, 0x898989, 0xdfdfdf, 0xffffff, 0xc7c7c7, 0x000000, 0x6e6e6e, 0xb6b6b6, 0x000000, 0x131313, 0x000000, 0xbcbcbc, 0x878787, 0x000000, 0xcfcfcf, 0xfdfdfd, 0x767676, 0x000000, 0xb9b9b9, 0x636363, 0x000000, 0xdadada, 0xf4f4f4, 0x3e3e3e, 0x000000, 0xb6b6b6, 0xffffff, 0xf7f7f7, 0xd5d5d5, 0xcccccc, 0xf2f2f2, 0xffffff, 0xfefefe, 0xffffff, 0xa9a9a9, 0x000000, 0x939393, 0x9c9c9c, 0x000000, 0x222222, 0x000000, 0xc4c4c4, 0x5a5a5a, 0x000000, 0xe1e1e1, 0xf5f5f5, 0x5c5c5c, 0x000000, 0xbdbdbd, 0x373737, 0x2a2a2a, 0xe6e6e6, 0xffffff, 0xb6b6b6, 0x000000, 0x000000, 0x161616, 0x868686, 0xdfdfdf, 0xfefefe, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffdfb, 0xfefefe, 0xf8fefc, 0xfdfcf6, 0xf5dbd4, 0xbc524f, 0xd4040a, 0xe51d1e, 0xe61e20, 0xdf2626, 0xb73330, 0x3f0d0a, 0x000000, 0x010101, 0x000201, 0x000201, 0x000100, 0x010101, 0x000000, 0x000000, 0xc4c4c4, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfcfcfc, 0xfdfdfd, 0xf1f1f1, 0xaaaaaa, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x9faa9f, 0xf0f2ed, 0xfdfef9, 0xfefffa, 0xfefffa, 0xfefffa, 0xfefefc, 0xfefefc, 0xfafdf6, 0xfffff4, 0xeccac3, 0xba2326, 0xdd181a, 0xe41f20, 0xe52021, 0xe42221, 0xe42221, 0xe32322, 0xe42423, 0xe42323, 0xe42323, 0xe52222, 0xe32022, 0xe22120, 0xd51b1e, 0xa42a2b, 0xdbc5bd, 0xfffef6, 0xfefffb, 0xfefdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xd2d2d2, 0x000000, 0x1a1a1b, 0xe8e8e7, 0xfffffe, 0xf8f8f7, 0x6e6e6e, 0x000000, 0x2e2e2e, 0x5a5a5a, 0x4b4b4b, 0x000000, 0x000000, 0xd5d5d5, 0xd6d6d6, 0x000000, 0x383838, 0xeaeaea, 0xfcfcfc, 0xb2b2b2, 0x494949, 0x000000, 0x000000, 0x2e2e2e, 0xe3e3e3, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xb9b9b9, 0x505050, 0x000000, 0x000000, 0x515151, 0xeeeeee, 0xe6e6e6, 0x000000, 0x535353, 0x878787, 0x000000, 0x929292, 0x000000, 0x8b8b8b, 0x5d5d5d, 0x111111, 0xebebeb, 0xececec, 0x242424, 0x000000, 0xe2e2e2, 0x909090, 0x000000, 0xaeaeae, 0xf3f3f3, 0x3b3b3b, 0x000000, 0xbcbcbc, 0xffffff, 0xe9e9e9, 0x232323, 0x000000, 0xd6d6d6, 0xffffff, 0xfefefe, 0xffffff, 0xd0d0d0, 0x000000, 0x6a6a6a, 0x5d5d5d, 0x454545, 0x939393, 0x000000, 0x898989, 0x252525, 0x5d5d5d, 0xf8f8f8, 0xd9d9d9, 0x000000, 0x5a5a5a, 0xf1f1f1, 0x777777, 0x000000, 0xc5c5c5, 0xffffff, 0xf7f7f7, 0xa7a7a7, 0x3f3f3f, 0x000000, 0x000000, 0x4a4a4a, 0xececec, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefefb, 0xfeffff, 0xfefefa, 0xfde5de, 0xc47371, 0xc70000, 0xe01e1e, 0xe51b20, 0xde2321, 0xc23632, 0x5d1a1a, 0x000000, 0x030201, 0x010201, 0x020101, 0x020101, 0x000101, 0x030404, 0x000000, 0x888888, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xf8f8f8, 0xdadada, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd2d2cf, 0xf6f6f5, 0xfffefb, 0xfffdfa, 0xfffefa, 0xfffffb, 0xfefefa, 0xfbfffa, 0xfcfffa, 0xfff4ed, 0xd59a92, 0xc80000, 0xe32123, 0xe62022, 0xe62121, 0xe52322, 0xe32222, 0xe42322, 0xe42423, 0xe32222, 0xe22220, 0xe32021, 0xe12020, 0xcb292a, 0x83181c, 0x453c38, 0xe0e1db, 0xfffffd, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xd1d1d1, 0x000000, 0x161616, 0xe7e7e7, 0xffffff, 0xf8f8f8, 0x6f6f6f, 0x000000, 0x878787, 0xf9f9f9, 0xd9d9d9, 0x000000, 0x000000, 0xd6d6d6, 0xd6d6d6, 0x000000, 0x353535, 0xe9e9e9, 0xffffff, 0xffffff, 0xf4f4f4, 0xc7c7c7, 0x303030, 0x000000, 0xb6b6b6, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xf6f6f6, 0xbbbbbb, 0x010101, 0x000000, 0xc5c5c5, 0xf9f9f9, 0x595959, 0x000000, 0x1d1d1d, 0x4d4d4d, 0xd7d7d7, 0x2c2c2c, 0x313131, 0x050505, 0x676767, 0xfcfcfc, 0xc2c2c2, 0x000000, 0x212121, 0x818181, 0x525252, 0x000000, 0x686868, 0xeeeeee, 0x585858, 0x000000, 0x909090, 0xffffff, 0xebebeb, 0x343434, 0x000000, 0xd6d6d6, 0xffffff, 0xfefefe, 0xfefefe, 0xebebeb, 0x373737, 0x030303, 0x000000, 0x7d7d7d, 0xcdcdcd, 0x000000, 0x282828, 0x000000, 0x959595, 0xffffff, 0xaaaaaa, 0x000000, 0x363636, 0x888888, 0x565656, 0x000000, 0x8e8e8e, 0xfbfbfb, 0xfbfbfb, 0xffffff, 0xf3f3f3, 0xb3b3b3, 0x000000, 0x000000, 0xc5c5c5, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefd, 0xfefffd, 0xfdfefb, 0xfefefe, 0xfff2ee, 0xd2928d, 0xc30000, 0xdd1e1e, 0xe31b1f, 0xda1e22, 0xc6322f, 0x742421, 0x000000, 0x000104, 0x000101, 0x000100, 0x010001, 0x010101, 0x030303, 0x000000, 0x3e3e3e, 0xe7e7e7, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfbfbfb, 0xe7e7e7, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe3e3e5, 0xfffefd, 0xfffefc, 0xfffefc, 0xfefefc, 0xfffefc, 0xfdfef9, 0xfdfefa, 0xfbfcf6, 0xfae6da, 0xc56b65, 0xd10004, 0xe32320, 0xe7211f, 0xe52223, 0xe32423, 0xe32322, 0xe42323, 0xe42122, 0xe4201f, 0xdf2120, 0xd22728, 0x9a2c2d, 0x270809, 0x000000, 0x666866, 0xf0eeed, 0xfffefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xd1d1d1, 0x000000, 0x131313, 0xe7e7e7, 0xffffff, 0xfafafa, 0x727272, 0x000000, 0x909090, 0xffffff, 0xe4e4e4, 0x191919, 0x000000, 0xd5d5d5, 0xd6d6d6, 0x000000, 0x313131, 0xececec, 0xc7c7c7, 0xc1c1c1, 0xe0e0e0, 0xdadada, 0x494949, 0x000000, 0xbababa, 0xffffff, 0xfcfcfc, 0xffffff, 0xc8c8c8, 0xbcbcbc, 0xe2e2e2, 0xc1c1c1, 0x000000, 0x000000, 0xc0c0c0, 0xffffff, 0x858585, 0x000000, 0x000000, 0x818181, 0xf8f8f8, 0x676767, 0x000000, 0x000000, 0xa0a0a0, 0xffffff, 0x909090, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdfdfdf, 0xaaaaaa, 0x000000, 0x020202, 0xb4b4b4, 0xcccccc, 0x303030, 0x000000, 0xd5d5d5, 0xffffff, 0xfefefe, 0xfdfdfd, 0xf9f9f9, 0x747474, 0x000000, 0x000000, 0xa8a8a8, 0xeeeeee, 0x333333, 0x000000, 0x000000, 0xc1c1c1, 0xfdfdfd, 0x6e6e6e, 0x000000, 0x171717, 0x000000, 0x000000, 0x000000, 0x484848, 0xf2f2f2, 0xcccccc, 0xc8c8c8, 0xe4e4e4, 0xbdbdbd, 0x000000, 0x000000, 0xc9c9c9, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffe, 0xfdfffe, 0xfdfffe, 0xfdfefe, 0xfbfdfc, 0xfff6ee, 0xdca6a0, 0xc00000, 0xda1b1e, 0xe01d1c, 0xe01d1c, 0xca2e2e, 0x822926, 0x000000, 0x000502, 0x000303, 0x020002, 0x000001, 0x010101, 0x010101, 0x000000, 0x000000, 0xc6c6c6, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xf4f4f4, 0xc1c1c1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb5b5b5, 0xf3f2f1, 0xfefdfb, 0xfdfdfb, 0xfefefc, 0xfefefc, 0xfcfefa, 0xfefdfa, 0xfcfdfd, 0xfffffa, 0xf0d7ce, 0xc33f40, 0xe01517, 0xe52320, 0xe52223, 0xe32422, 0xe42423, 0xe42323, 0xe42222, 0xe32120, 0xd92724, 0xac2b2b, 0x3a0e0d, 0x000000, 0x050506, 0x000000, 0x817f80, 0xf5f4f4, 0xfdfdfc, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xd0d0d0, 0x000000, 0x000000, 0xe5e5e5, 0xffffff, 0xfbfbfb, 0x6e6e6e, 0x000000, 0x919191, 0xffffff, 0xe3e3e3, 0x000000, 0x000000, 0xd4d4d4, 0xd4d4d4, 0x000000, 0x030303, 0xebebeb, 0x8c8c8c, 0x000000, 0x000000, 0x000000, 0x000000, 0x393939, 0xe6e6e6, 0xffffff, 0xfdfdfd, 0xfbfbfb, 0x6b6b6b, 0x000000, 0x000000, 0x000000, 0x000000, 0x545454, 0xededed, 0xffffff, 0xb7b7b7, 0x000000, 0x000000, 0xa8a8a8, 0xffffff, 0x9b9b9b, 0x000000, 0x000000, 0xcccccc, 0xf0f0f0, 0x2a2a2a, 0x000000, 0xb9b9b9, 0xe7e7e7, 0xdadada, 0x383838, 0x000000, 0xaeaeae, 0xf2f2f2, 0x656565, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xa3a3a3, 0x000000, 0x000000, 0xc8c8c8, 0xfefefe, 0x717171, 0x000000, 0x000000, 0xe5e5e5, 0xe5e5e5, 0x000000, 0x000000, 0xcacaca, 0xe9e9e9, 0xcacaca, 0x000000, 0x000000, 0xcacaca, 0x6d6d6d, 0x000000, 0x000000, 0x000000, 0x000000, 0x676767, 0xf0f0f0, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfefffd, 0xfdfffe, 0xfdfefc, 0xfefefb, 0xfff8f6, 0xe3b6b1, 0xbf0409, 0xd71116, 0xe01a1e, 0xdd201f, 0xd02c29, 0x982b2b, 0x100000, 0x000002, 0x000302, 0x010100, 0x010002, 0x000102, 0x010101, 0x030303, 0x000000, 0x999999, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xfcfcfc, 0xfafafa, 0xe0e0e0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd5d5d2, 0xf7f8f5, 0xfdfdfb, 0xfefefc, 0xfefefc, 0xfefefb, 0xfcfef9, 0xfefdfe, 0xfdfefe, 0xfffef9, 0xe2b6b1, 0xcb0008, 0xe1221f, 0xe62121, 0xe52323, 0xe42222, 0xe32322, 0xe22221, 0xd92424, 0xb9332f, 0x561715, 0x000000, 0x010201, 0x010102, 0x020102, 0x000000, 0x969696, 0xf9f8f8, 0xfcfcfc, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xdedede, 0x787878, 0x8a8a8a, 0xf1f1f1, 0xffffff, 0xfdfdfd, 0xa9a9a9, 0x727272, 0xb8b8b8, 0xffffff, 0xeeeeee, 0x898989, 0x797979, 0xe3e3e3, 0xe2e2e2, 0x808080, 0x8e8e8e, 0xeeeeee, 0xcdcdcd, 0x7e7e7e, 0x656565, 0x5f5f5f, 0x8b8b8b, 0xdddddd, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfcfcfc, 0xc7c7c7, 0x818181, 0x616161, 0x696969, 0x9e9e9e, 0xe7e7e7, 0xffffff, 0xfefefe, 0xe9e9e9, 0x8e8e8e, 0x858585, 0xd9d9d9, 0xffffff, 0xd4d4d4, 0x838383, 0x8c8c8c, 0xeeeeee, 0xe0e0e0, 0x818181, 0x949494, 0xf5f5f5, 0xffffff, 0xffffff, 0xa9a9a9, 0x757575, 0xadadad, 0xffffff, 0xececec, 0xacacac, 0x787878, 0x616161, 0x737373, 0xababab, 0xf3f3f3, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xdbdbdb, 0x7f7f7f, 0x8a8a8a, 0xececec, 0xffffff, 0xbdbdbd, 0x747474, 0x9a9a9a, 0xfafafa, 0xd9d9d9, 0x7a7a7a, 0xa5a5a5, 0xfafafa, 0xffffff, 0xf9f9f9, 0x9c9c9c, 0x7d7d7d, 0xcccccc, 0xcbcbcb, 0x797979, 0x585858, 0x737373, 0xa7a7a7, 0xeaeaea, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfefdfb, 0xfffbf5, 0xebc4bf, 0xbc2e32, 0xdb080f, 0xe2181a, 0xde1d1d, 0xce2b29, 0x9e312f, 0x300705, 0x000000, 0x010101, 0x010101, 0x010001, 0x000000, 0x000100, 0x040304, 0x000000, 0x6e6e6e, 0xf4f4f4, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfbfbfb, 0xe6e6e6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe8e9e8, 0xfcfcfb, 0xfefefd, 0xfefdfd, 0xfefdfd, 0xfcfefa, 0xfdfdfc, 0xfefdfe, 0xfdfefe, 0xfef6ee, 0xd48d86, 0xd70000, 0xe3231f, 0xe52221, 0xe22222, 0xe0221f, 0xdb2321, 0xc63132, 0x752523, 0x000000, 0x000004, 0x010201, 0x010101, 0x010000, 0x000000, 0x000000, 0xa5a5a5, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfafafa, 0xf9f9f9, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xf9f9f9, 0xfafafa, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfdfdfd, 0xf9f9f9, 0xfcfcfc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfcfcfc, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xf8f8f8, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xffffff, 0xfffeff, 0xfeffff, 0xfefeff, 0xfffdf9, 0xeecfc9, 0xbd403f, 0xd7000b, 0xe31a19, 0xe11b1b, 0xd32623, 0xb13532, 0x451110, 0x000000, 0x010101, 0x010200, 0x010201, 0x000101, 0x010101, 0x030302, 0x000000, 0x2b2b2b, 0xe1e1e1, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xf4f4f4, 0xd3d3d3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbcbcbc, 0xf0f0f0, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefc, 0xfffef9, 0xf9e5db, 0xc7625c, 0xd30000, 0xe22021, 0xe31e21, 0xdb2120, 0xc72d2f, 0x822626, 0x0e0000, 0x000102, 0x020003, 0x020002, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0xababab, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefffe, 0xfdfefd, 0xfcfefc, 0xfffffb, 0xf2d3cf, 0xbe4847, 0xd80000, 0xe5191e, 0xe31c1a, 0xdc201f, 0xbb3634, 0x611e1d, 0x000000, 0x010001, 0x010001, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc1c1c1, 0xffffff, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfdfdfd, 0xfcfcfc, 0xf9f9f9, 0xdadada, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdddddd, 0xf7f7f7, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefa, 0xfcfdfb, 0xfffff9, 0xeed2c6, 0xbc3b3a, 0xd31215, 0xdc201f, 0xc82e2e, 0x86292a, 0x000000, 0x000101, 0x010202, 0x030002, 0x000004, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0xb0b0b0, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xf8f8f8, 0xf7f7f7, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xf8f8f8, 0xf7f7f7, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfafafa, 0xf4f4f4, 0xf2f2f2, 0xf4f4f4, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfefefe, 0xfafafa, 0xfafafa, 0xfafafa, 0xfafafa, 0xfafafa, 0xfcfcfc, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfafafa, 0xf8f8f8, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xf9f9f9, 0xf5f5f5, 0xf3f3f3, 0xf6f6f6, 0xffffff, 0xffffff, 0xffffff, 0xfafafa, 0xf9f9f9, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfefefe, 0xf8f8f8, 0xf6f6f6, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xfefefe, 0xf9f9f9, 0xf8f8f8, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xf9f9f9, 0xf9f9f9, 0xfefefe, 0xfdfdfd, 0xf9f9f9, 0xf9f9f9, 0xfdfdfd, 0xfdfdfd, 0xf9f9f9, 0xfcfcfc, 0xffffff, 0xfdfdfd, 0xfbfbfb, 0xf7f7f7, 0xfafafa, 0xfcfcfc, 0xfafafa, 0xfbfbfb, 0xfafafa, 0xfafafa, 0xfafafa, 0xfafafa, 0xfdfdfd, 0xfcfcfc, 0xfafafa, 0xfafafa, 0xfafafa, 0xfbfbfb, 0xfcfcfc, 0xfdfdfd, 0xf9f9f9, 0xf5f5f5, 0xf3f3f3, 0xf6f6f6, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfeffff, 0xfdfffd, 0xfdfffc, 0xfefdfe, 0xfffdf8, 0xf2d5cb, 0xbd4f4e, 0xd20000, 0xe41a1c, 0xe51c1c, 0xdf1f1d, 0xc6302d, 0x712621, 0x000000, 0x000304, 0x010102, 0x020101, 0x000000, 0x000000, 0x010101, 0x020202, 0x000000, 0x9d9d9d, 0xfbfbfb, 0xfefefe, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfbfbfb, 0xe3e3e3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe0e0e0, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefb, 0xfcfefe, 0xfdfcfc, 0xfffaf3, 0xe3bdb7, 0xb51115, 0xc32526, 0x982e2d, 0x1e0403, 0x000000, 0x000100, 0x020100, 0x020000, 0x000101, 0x010101, 0x010101, 0x000000, 0x010101, 0x020202, 0x000000, 0x000000, 0xaeaeae, 0xfdfdfd, 0xfbfbfb, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xffffff, 0xfdfdfd, 0xffffff, 0xdcdcdc, 0x545454, 0x4b4b4b, 0xc2c2c2, 0xffffff, 0xfdfdfd, 0xeaeaea, 0x626262, 0x525252, 0xdcdcdc, 0xffffff, 0xffffff, 0xfbfbfb, 0x989898, 0x454545, 0x494949, 0x505050, 0x737373, 0xcdcdcd, 0xfafafa, 0xf3f3f3, 0x7b7b7b, 0x636363, 0x676767, 0x676767, 0x595959, 0xb8b8b8, 0xfefefe, 0xfdfdfd, 0xe9e9e9, 0x6a6a6a, 0x4b4b4b, 0xbfbfbf, 0xffffff, 0xfdfdfd, 0xf2f2f2, 0x787878, 0x4d4d4d, 0x4b4b4b, 0x515151, 0x878787, 0xd2d2d2, 0xffffff, 0xc2c2c2, 0x494949, 0x808080, 0xf3f3f3, 0xffffff, 0xc9c9c9, 0x484848, 0x6c6c6c, 0xeeeeee, 0xffffff, 0xffffff, 0xf3f3f3, 0x747474, 0x4c4c4c, 0xc7c7c7, 0xffffff, 0xfefefe, 0xd7d7d7, 0x565656, 0x606060, 0xe8e8e8, 0xeeeeee, 0x6c6c6c, 0x575757, 0xe2e2e2, 0xd7d7d7, 0x4c4c4c, 0x878787, 0xf4f4f4, 0xffffff, 0xc3c3c3, 0x3c3c3c, 0xa4a4a4, 0xd2d2d2, 0x616161, 0x696969, 0x696969, 0x686868, 0x676767, 0x575757, 0xcccccc, 0xb7b7b7, 0x585858, 0x666666, 0x676767, 0x656565, 0x888888, 0xf3f3f3, 0x868686, 0x4d4d4d, 0x4c4c4c, 0x535353, 0x7e7e7e, 0xcbcbcb, 0xf8f8f8, 0xfbfbfb, 0xfcfcfc, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffeff, 0xfeffff, 0xfcfefc, 0xfdfdfb, 0xfffdfa, 0xf2d3ce, 0xbd4c4b, 0xd00000, 0xe01c1e, 0xe31c1c, 0xe31c1d, 0xd52929, 0x8d2626, 0x000000, 0x000000, 0x000101, 0x000100, 0x000100, 0x000000, 0x000000, 0x070707, 0x000000, 0x757575, 0xf5f5f5, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xf0f0f0, 0xb0b0b0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x777777, 0xeeeeee, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfefd, 0xfdfdfb, 0xfcfdf8, 0xfffaf3, 0xd1aaa3, 0x85050f, 0x3b0e0d, 0x000000, 0x020101, 0x000001, 0x000001, 0x010000, 0x010001, 0x010101, 0x010101, 0x000000, 0x010101, 0x010102, 0x020203, 0x000000, 0x000000, 0xafafaf, 0xfafaf7, 0xfcfdfa, 0xfefffc, 0xfefefc, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xa7a7a7, 0x000000, 0x000000, 0x757575, 0xf9f9fa, 0xfdfdfe, 0xe8e8e9, 0x0d0d0f, 0x000000, 0xd5d5d5, 0xffffff, 0xfefefe, 0xfbfbfb, 0x7a7a7a, 0x000000, 0x050505, 0x000000, 0x000000, 0x000000, 0xdedede, 0xf2f2f2, 0x3a3a3a, 0x000000, 0x000000, 0x000000, 0x000000, 0x9d9d9d, 0xfdfdfd, 0xffffff, 0xbbbbbb, 0x000000, 0x000000, 0x6a6a6a, 0xf8f8f8, 0xffffff, 0xeeeeee, 0x3b3b3b, 0x000000, 0x262626, 0x1d1d1e, 0x000000, 0x000000, 0xbcbcbc, 0xececec, 0x2f2f2f, 0x000000, 0xc8c8c8, 0xfcfcfc, 0x787878, 0x000000, 0xa2a2a2, 0xffffff, 0xfdfdfd, 0xffffff, 0xeeeeee, 0x2a2a2a, 0x000000, 0x707070, 0xf8f8f8, 0xfefefe, 0x999999, 0x000000, 0x000000, 0xdddddd, 0xededed, 0x181818, 0x000000, 0xd6d6d6, 0xd4d4d4, 0x000000, 0x000000, 0xb2b2b2, 0xffffff, 0xbababa, 0x000000, 0x8b8b8b, 0xc7c7c7, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbfbfbf, 0xa3a3a3, 0x000000, 0x000000, 0x000000, 0x000000, 0x3c3c3c, 0xeeeeee, 0x676767, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xaaaaaa, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfffeff, 0xfefffe, 0xfefefc, 0xfffdfb, 0xf2d5d3, 0xc15050, 0xd10000, 0xe01d1e, 0xe31b1e, 0xe01d1d, 0xd52724, 0xa32b26, 0x2a0303, 0x000000, 0x010002, 0x010002, 0x010000, 0x010001, 0x000000, 0x030303, 0x000000, 0x555555, 0xebebeb, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf8f8f8, 0xd9d9d9, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc2c2c2, 0xf4f4f4, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfcfdfc, 0xfefefb, 0xfef7ef, 0x9e9491, 0x000000, 0x040504, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000102, 0x010102, 0x020302, 0x000000, 0x000000, 0xa3a29f, 0xf7f7ed, 0xfefff7, 0xfefdfd, 0xfefcfb, 0xfefdfb, 0xfffdfc, 0xfdfdfe, 0xfcfdfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xf7f7f7, 0x636363, 0x000000, 0x000000, 0x1c1c1d, 0xe3e3e3, 0xffffff, 0xe8e8e8, 0x252525, 0x000000, 0xd6d6d6, 0xffffff, 0xffffff, 0xfbfbfb, 0x777777, 0x000000, 0x828282, 0xd2d2d2, 0x474747, 0x000000, 0xbbbbbb, 0xf4f4f4, 0x3e3e3e, 0x000000, 0xb4b4b4, 0xe5e5e5, 0xdbdbdb, 0xe7e7e7, 0xfcfcfc, 0xf8f8f8, 0x737373, 0x000000, 0x000000, 0x000000, 0xd9d9d9, 0xffffff, 0xededed, 0x3f3f3f, 0x000000, 0xaeaeae, 0xededec, 0x8e8e8e, 0x000000, 0x29292a, 0xededee, 0xa8a8a8, 0x000000, 0x808080, 0xd4d4d4, 0x000000, 0x1c1c1c, 0xe4e4e4, 0xffffff, 0xfefefe, 0xffffff, 0xe8e8e8, 0x202020, 0x000000, 0x000000, 0xd9d9d9, 0xf5f5f5, 0x4f4f4f, 0x000000, 0x000000, 0xd7d7d7, 0xebebeb, 0x222222, 0x000000, 0xd4d4d4, 0xd5d5d5, 0x000000, 0x000000, 0x2d2d2d, 0xe9e9e9, 0xc2c2c2, 0x000000, 0x878787, 0xededed, 0xd9d9d9, 0xb5b5b5, 0x000000, 0x000000, 0xb9b9b9, 0xdcdcdc, 0xf1f1f1, 0x9f9f9f, 0x000000, 0x888888, 0xe2e2e2, 0xdddddd, 0xdddddd, 0xf5f5f5, 0x696969, 0x000000, 0x9b9b9b, 0xe1e1e1, 0x8c8c8c, 0x000000, 0x000000, 0xdcdcdc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfcfdfd, 0xfcfdfd, 0xfefcfd, 0xfdfdfd, 0xfcfdfe, 0xfcfbfc, 0xfffaf8, 0xf0cfcc, 0xbf4f53, 0xd50000, 0xe01e1d, 0xe01d1d, 0xe11c1e, 0xd62523, 0xaf312e, 0x420d0a, 0x000000, 0x000101, 0x000000, 0x000000, 0x000000, 0x000001, 0x040404, 0x000000, 0x232323, 0xdadada, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfafafa, 0xe4e4e4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd3d3d3, 0xf9f9f9, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfcfdfb, 0xfbfcf5, 0xf3f1ec, 0x787876, 0x000000, 0x040404, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x010101, 0x010102, 0x000100, 0x000104, 0x010106, 0x000000, 0x000000, 0xc7c28d, 0xffffce, 0xfefff1, 0xfdfefb, 0xfdfefa, 0xfefefb, 0xfefdfc, 0xfefdfe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xdadada, 0x000000, 0x585858, 0x737373, 0x000000, 0xb5b5b5, 0xffffff, 0xe9e9e9, 0x242424, 0x000000, 0xd8d8d8, 0xffffff, 0xffffff, 0xfbfbfb, 0x777777, 0x000000, 0x949494, 0xf8f8f8, 0x626262, 0x000000, 0xbbbbbb, 0xf4f4f4, 0x3e3e3e, 0x000000, 0x9c9c9c, 0xc6c6c6, 0xcbcbcb, 0xfbfbfb, 0xfefefe, 0xe1e1e1, 0x000000, 0x616161, 0x828282, 0x000000, 0xaaaaaa, 0xffffff, 0xededed, 0x404040, 0x000000, 0xbbbbbb, 0xffffff, 0xe4e4e4, 0x1b1b1b, 0x000000, 0xcccccd, 0xe7e7e7, 0x0f0f0f, 0x171717, 0x666666, 0x000000, 0x989898, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xdddddd, 0x000000, 0x000000, 0x000000, 0xa0a0a0, 0xd5d5d5, 0x000000, 0x000000, 0x000000, 0xc9c9c9, 0xececec, 0x252525, 0x000000, 0xd3d3d3, 0xd5d5d5, 0x000000, 0x000000, 0x000000, 0x9f9f9f, 0xc2c2c2, 0x000000, 0x848484, 0xfbfbfb, 0xffffff, 0xd9d9d9, 0x000000, 0x000000, 0xdfdfdf, 0xffffff, 0xffffff, 0x9c9c9c, 0x000000, 0x727272, 0xbfbfbf, 0xb3b3b3, 0xe3e3e3, 0xfafafa, 0x666666, 0x000000, 0xaeaeae, 0xffffff, 0xe7e7e7, 0x343434, 0x000000, 0xb0b0b0, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfffe, 0xfcfdfd, 0xfefcfe, 0xfefcfe, 0xfefdfe, 0xfdfefc, 0xfff8f5, 0xedc4c4, 0xc24244, 0xd40000, 0xe61e1e, 0xe51b1c, 0xe01d1f, 0xd92224, 0xbc3130, 0x581416, 0x000000, 0x010101, 0x010003, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0xc5c5c5, 0xffffff, 0xfdfdfd, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfbfbfb, 0xe8e8e8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e1, 0xfafafa, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfdfffd, 0xfcfdf9, 0xfffefc, 0xeeeeec, 0x6c6b6a, 0x000000, 0x050505, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000003, 0x010105, 0x010302, 0x030302, 0x000000, 0x979145, 0xe2d347, 0xf1e676, 0xfffdca, 0xfeffee, 0xfefdfa, 0xfdfdfb, 0xfefef9, 0xfefdfc, 0xfefdfe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xacacac, 0x000000, 0x9e9e9e, 0xbcbcbc, 0x000000, 0x7a7a7a, 0xfafafa, 0xe9e9e9, 0x252525, 0x000000, 0xd9d9d9, 0xffffff, 0xffffff, 0xfbfbfb, 0x767676, 0x000000, 0x888888, 0xb0b0b0, 0x000000, 0x3a3a3a, 0xe5e5e5, 0xf3f3f3, 0x404040, 0x000000, 0x000000, 0x000000, 0x2e2e2e, 0xf5f5f5, 0xffffff, 0xb7b7b7, 0x000000, 0x9f9f9f, 0xcecece, 0x000000, 0x6e6e6e, 0xfafafa, 0xefefef, 0x424242, 0x000000, 0xbdbdbc, 0xffffff, 0xf2f2f2, 0x555555, 0x000000, 0xb6b6b7, 0xffffff, 0x969696, 0x000000, 0x000000, 0x212121, 0xe1e1e1, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xd2d2d2, 0x000000, 0x373737, 0x2b2b2b, 0x474747, 0x747474, 0x0e0e0e, 0x474747, 0x000000, 0xc0c0c0, 0xececec, 0x272727, 0x000000, 0xd4d4d4, 0xd4d4d4, 0x000000, 0x3c3c3c, 0x2c2c2c, 0x242424, 0x808080, 0x000000, 0x818181, 0xfcfcfc, 0xffffff, 0xdadada, 0x000000, 0x000000, 0xdfdfdf, 0xffffff, 0xffffff, 0x9c9c9c, 0x000000, 0x000000, 0x000000, 0x000000, 0xc4c4c4, 0xf9f9f9, 0x666666, 0x000000, 0xaeaeae, 0xffffff, 0xf4f4f4, 0x5e5e5e, 0x000000, 0x9e9e9e, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfefe, 0xfdfcfd, 0xfdfcfe, 0xf8fdfa, 0xfcfefb, 0xfff5f6, 0xe6bbb6, 0xc23234, 0xd90008, 0xe41e1d, 0xea191e, 0xe71b1f, 0xde2020, 0xc6312f, 0x72211d, 0x000000, 0x000201, 0x020100, 0x000101, 0x000000, 0x010101, 0x030303, 0x000000, 0x000000, 0xb5b5b5, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfefefe, 0xf0f0f0, 0x929292, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe5e5e5, 0xfbfbfb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfffdfc, 0xfffffd, 0xececea, 0x5c5b5b, 0x000000, 0x040404, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000103, 0x050502, 0x000000, 0x7b7637, 0xe6d549, 0xebd401, 0xead614, 0xf0e36e, 0xfefbb8, 0xffffe3, 0xfdfef8, 0xfefef9, 0xfefcfc, 0xfdfcfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfafafa, 0x6f6f6f, 0x000000, 0xa4a4a4, 0xb5b5b5, 0x000000, 0x2d2d2d, 0xe9e9e9, 0xebebeb, 0x242424, 0x000000, 0xd9d9d9, 0xffffff, 0xffffff, 0xfbfbfb, 0x767676, 0x000000, 0x757575, 0x3a3a3a, 0x000000, 0xa4a4a4, 0xffffff, 0xefefef, 0x3e3e3e, 0x000000, 0x848484, 0xa6a6a6, 0xafafaf, 0xf8f8f8, 0xfbfbfb, 0x808080, 0x000000, 0x979797, 0xcacaca, 0x000000, 0x131313, 0xe5e5e5, 0xf1f1f1, 0x464646, 0x000000, 0xc0c0c0, 0xffffff, 0xf3f3f3, 0x535353, 0x000000, 0xc1c1c1, 0xffffff, 0xdfdfdf, 0x0d0d0d, 0x000000, 0x919191, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xfefefe, 0xffffff, 0xcdcdcd, 0x000000, 0x767676, 0x8f8f8f, 0x000000, 0x000000, 0x8e8e8e, 0x919191, 0x000000, 0xb7b7b7, 0xeeeeee, 0x2b2b2b, 0x000000, 0xd4d4d4, 0xd4d4d4, 0x000000, 0x757575, 0xacacac, 0x000000, 0x000000, 0x000000, 0x7e7e7e, 0xfbfbfb, 0xffffff, 0xdddddd, 0x000000, 0x000000, 0xdfdfdf, 0xffffff, 0xffffff, 0x9d9d9d, 0x000000, 0x5e5e5e, 0x9e9e9e, 0x969696, 0xdcdcdc, 0xf6f6f6, 0x656565, 0x000000, 0xb0b0b0, 0xffffff, 0xf4f4f4, 0x575757, 0x000000, 0x9e9e9e, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfefd, 0xfefcfd, 0xfdfdfd, 0xfbfef8, 0xfff1eb, 0xe0afac, 0xc02022, 0xda0409, 0xe81d21, 0xe91c20, 0xe71c22, 0xe02021, 0xcd2f2b, 0x832724, 0x000000, 0x000101, 0x020103, 0x020001, 0x000100, 0x000000, 0x010101, 0x000000, 0x000000, 0xa7a7a7, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xf3f3f3, 0xc1c1c1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x959595, 0xefefef, 0xfdfdfc, 0xfdfdfc, 0xfefefd, 0xfefefe, 0xfeffff, 0xfeffff, 0xfefefe, 0xfbfcfb, 0xffffff, 0xe1e0df, 0x3e3e3d, 0x000000, 0x040404, 0x010101, 0x000001, 0x000001, 0x010102, 0x010102, 0x020102, 0x030304, 0x000000, 0x5d582e, 0xddd04c, 0xeed50b, 0xefd400, 0xeed600, 0xead400, 0xecde5a, 0xfbf7b1, 0xfeffe7, 0xfefff5, 0xfefdfd, 0xfdfdfe, 0xfefdfe, 0xfefefd, 0xfefffe, 0xfeffff, 0xffffff, 0xfefefe, 0xffffff, 0xe3e3e3, 0x101010, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc4c4c4, 0xeeeeee, 0x242424, 0x000000, 0xd6d6d6, 0xffffff, 0xfcfcfc, 0xf8f8f8, 0x747474, 0x000000, 0xa3a3a3, 0x9a9a9a, 0x000000, 0x696969, 0xf7f7f7, 0xf0f0f0, 0x3a3a3a, 0x000000, 0xd1d1d1, 0xffffff, 0xffffff, 0xfefefe, 0xebebeb, 0x3b3b3b, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbebebe, 0xf3f3f3, 0x484848, 0x000000, 0xc7c7c7, 0xffffff, 0xcecece, 0x000000, 0x000000, 0xd5d5d5, 0xffffff, 0xf3f3f3, 0x515151, 0x000000, 0xbebebe, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xc6c6c6, 0x000000, 0x818181, 0xcecece, 0x000000, 0x000000, 0xd6d6d6, 0x9a9a9a, 0x000000, 0xafafaf, 0xefefef, 0x2f2f2f, 0x000000, 0xd3d3d3, 0xd5d5d5, 0x000000, 0x6d6d6d, 0xefefef, 0x5e5e5e, 0x000000, 0x000000, 0x7b7b7b, 0xfbfbfb, 0xffffff, 0xdddddd, 0x000000, 0x000000, 0xdedede, 0xffffff, 0xffffff, 0x9e9e9e, 0x000000, 0x929292, 0xfdfdfd, 0xf7f7f7, 0xf5f5f5, 0xf1f1f1, 0x646464, 0x000000, 0xb6b6b6, 0xffffff, 0xcfcfcf, 0x000000, 0x000000, 0xb7b7b7, 0xffffff, 0xfefefe, 0xfffefe, 0xfffdff, 0xfefffe, 0xfdfefe, 0xfdfdfe, 0xfcfefe, 0xfdfefd, 0xfffffc, 0xffede5, 0xd49a96, 0xc40002, 0xe10e16, 0xe41d1f, 0xe71c1e, 0xe61f1f, 0xe41f1f, 0xd72c29, 0x9d2b29, 0x150000, 0x000001, 0x010201, 0x000103, 0x000002, 0x010101, 0x020202, 0x000000, 0x000000, 0x9c9c9c, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfc, 0xfefefd, 0xf4f4f4, 0xdadada, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbfbfc5, 0xededeb, 0xfafaf9, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfd, 0xfffffe, 0xd7d7d5, 0x2c2c2b, 0x000000, 0x040404, 0x000000, 0x000000, 0x000000, 0x000000, 0x030204, 0x000000, 0x312d1a, 0xcfc14d, 0xeed61d, 0xeed400, 0xeed501, 0xefd500, 0xefd500, 0xecd200, 0xe9da4a, 0xf9f4a4, 0xffffde, 0xfdfef7, 0xfefffc, 0xfefefe, 0xfdfdfa, 0xfdfdfa, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xffffff, 0xb2b2b2, 0x000000, 0x4c4c4c, 0x939393, 0x939393, 0x545454, 0x000000, 0x8e8e8e, 0xebebeb, 0x262626, 0x000000, 0x6e6e6e, 0x828282, 0x7d7d7d, 0xd4d4d4, 0x7a7a7a, 0x000000, 0xa3a3a3, 0xe3e3e3, 0x161616, 0x000000, 0xbebebe, 0xf3f3f3, 0x3b3b3b, 0x000000, 0x6a6a6a, 0x878787, 0x808080, 0xb3b3b3, 0xc4c4c4, 0x000000, 0x3f3f3f, 0x818181, 0x909090, 0x5f5f5f, 0x000000, 0x828282, 0xececec, 0x474747, 0x000000, 0x7a7a7a, 0x999999, 0x313131, 0x000000, 0x6c6c6c, 0xf6f6f6, 0xffffff, 0xf4f4f4, 0x595959, 0x000000, 0xc0c0c0, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xb8b8b8, 0x000000, 0x797979, 0xf3f3f3, 0xb1b1b1, 0xababab, 0xf5f5f5, 0x979797, 0x000000, 0xa0a0a0, 0xededed, 0x313131, 0x000000, 0xd1d1d1, 0xd5d5d5, 0x000000, 0x636363, 0xfafafa, 0xcbcbcb, 0x000000, 0x000000, 0x7b7b7b, 0xfcfcfc, 0xffffff, 0xdedede, 0x000000, 0x000000, 0xdedede, 0xffffff, 0xffffff, 0x9f9f9f, 0x000000, 0x414141, 0x7d7d7d, 0x7a7a7a, 0x7f7f7f, 0xe2e2e2, 0x666666, 0x000000, 0x717171, 0x9d9d9d, 0x3c3c3c, 0x000000, 0x393939, 0xeaeaea, 0xffffff, 0xfefefe, 0xfefefe, 0xfcfdfe, 0xfcfefd, 0xfefdfc, 0xfffcfb, 0xfefdfb, 0xfffaf7, 0xfae3dd, 0xcd8681, 0xc30000, 0xdf171c, 0xe41e20, 0xe31e1e, 0xe31e1e, 0xe22020, 0xdc2c28, 0xb33531, 0x390909, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020202, 0x030303, 0x000000, 0x8c8c8c, 0xf6f6f6, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfafaf9, 0xf7f7f6, 0xdedede, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd6d6d2, 0xf6f6f5, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfcfb, 0xfffffe, 0xd5d5d3, 0x272726, 0x000000, 0x040404, 0x010101, 0x000000, 0x010100, 0x000000, 0x000004, 0xbcae3e, 0xf1d626, 0xefd600, 0xf0d501, 0xefd500, 0xf0d500, 0xf0d501, 0xf1d500, 0xeed300, 0xecd52a, 0xf6ed8a, 0xfdffcb, 0xffffee, 0xfefefb, 0xfdfefc, 0xfffef9, 0xfefefc, 0xfefefe, 0xfefefe, 0xf7f7f7, 0x6a6a6a, 0x000000, 0x9a9a9a, 0xffffff, 0xffffff, 0xb9b9b9, 0x000000, 0x3e3e3e, 0xd7d7d7, 0x030303, 0x000000, 0x000000, 0x000000, 0x000000, 0xbfbfbf, 0x717171, 0x000000, 0x959595, 0xfefefe, 0x8e8e8e, 0x000000, 0x494949, 0xdddddd, 0x2e2e2e, 0x000000, 0x000000, 0x000000, 0x000000, 0x6b6b6b, 0x7b7b7b, 0x000000, 0x939393, 0xffffff, 0xffffff, 0xbfbfbf, 0x000000, 0x000000, 0xd6d6d6, 0x474747, 0x000000, 0x000000, 0x000000, 0x000000, 0x777777, 0xe6e6e6, 0xffffff, 0xffffff, 0xf4f4f4, 0x4f4f4f, 0x000000, 0xbfbfbf, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xafafaf, 0x000000, 0x747474, 0xfbfbfb, 0xffffff, 0xffffff, 0xffffff, 0x969696, 0x000000, 0x898989, 0xebebeb, 0x0f0f0f, 0x000000, 0xd0d0d0, 0xd3d3d3, 0x000000, 0x555555, 0xf6f6f6, 0xf8f8f8, 0x7e7e7e, 0x000000, 0x777777, 0xfcfcfc, 0xffffff, 0xdddddd, 0x000000, 0x000000, 0xdddddd, 0xffffff, 0xffffff, 0x9b9b9b, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd5d5d5, 0x5b5b5b, 0x000000, 0x000000, 0x000000, 0x000000, 0x4f4f4f, 0xd2d2d2, 0xffffff, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfbfffb, 0xfdfefd, 0xfcfefd, 0xfcfefa, 0xfffdf7, 0xf3d3cd, 0xc36462, 0xc60000, 0xde1c1f, 0xe21c1f, 0xe31d1e, 0xe51d1d, 0xe41f1f, 0xde2725, 0xbf3732, 0x501613, 0x000000, 0x010301, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x8a8a8a, 0xf6f6f6, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xf9f9f9, 0xdadad9, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd6d6d6, 0xf5f5f5, 0xfdfdfc, 0xfdfdfb, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffefb, 0xfefffa, 0xfffffd, 0xd5d5d3, 0x313231, 0x000000, 0x050505, 0x010101, 0x000000, 0x000000, 0xa19a39, 0xecd828, 0xf1d300, 0xf0d602, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d600, 0xf1d502, 0xf1d200, 0xebd204, 0xf0e36e, 0xfcfab6, 0xffffe1, 0xfdfff7, 0xfefffb, 0xfffffe, 0xffffff, 0xfefefe, 0xf7f7f7, 0xcdcdcd, 0xc4c4c4, 0xe7e7e7, 0xffffff, 0xffffff, 0xeeeeee, 0xcccccc, 0xd0d0d0, 0xebebeb, 0xd0d0d0, 0xcacaca, 0xcccccc, 0xcecece, 0xcfcfcf, 0xeaeaea, 0xd9d9d9, 0xcccccc, 0xe2e2e2, 0xffffff, 0xebebeb, 0xcbcbcb, 0xc8c8c8, 0xe9e9e9, 0xd4d4d4, 0xcdcdcd, 0xcecece, 0xcdcdcd, 0xcbcbcb, 0xd6d6d6, 0xd8d8d8, 0xcccccc, 0xe4e4e4, 0xffffff, 0xffffff, 0xf2f2f2, 0xcccccc, 0xcecece, 0xf0f0f0, 0xdadada, 0xc5c5c5, 0xc0c0c0, 0xc2c2c2, 0xdbdbdb, 0xf8f8f8, 0xffffff, 0xfefefe, 0xffffff, 0xfcfcfc, 0xdbdbdb, 0xcccccc, 0xe9e9e9, 0xfcfcfc, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xe8e8e8, 0xcacaca, 0xdbdbdb, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xe3e3e3, 0xc8c8c8, 0xdbdbdb, 0xf5f5f5, 0xd3d3d3, 0xc9c9c9, 0xefefef, 0xefefef, 0xcecece, 0xd5d5d5, 0xfbfbfb, 0xfefefe, 0xececec, 0xc5c5c5, 0xd6d6d6, 0xfefefe, 0xfdfdfd, 0xf1f1f1, 0xcbcbcb, 0xc9c9c9, 0xf2f2f2, 0xffffff, 0xffffff, 0xe3e3e3, 0xcecece, 0xcfcfcf, 0xcfcfcf, 0xcecece, 0xcfcfcf, 0xeeeeee, 0xd3d3d3, 0xbababa, 0xb2b2b2, 0xbbbbbb, 0xd4d4d4, 0xf2f2f2, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfffffe, 0xfffefa, 0xfdfffe, 0xfafefc, 0xfff4f2, 0xe7bdba, 0xbe4845, 0xd40000, 0xe01e1d, 0xe11d1c, 0xe21d1e, 0xe41d1c, 0xe81d1e, 0xdd2324, 0xc63432, 0x70201d, 0x000000, 0x000002, 0x000100, 0x000000, 0x000000, 0x040404, 0x020202, 0x000000, 0x8f8f8f, 0xf7f7f7, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfcfcfb, 0xfbfbf9, 0xf9f9f9, 0xebebeb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd8d8d8, 0xf8f8f6, 0xfdfdfc, 0xfefefe, 0xfefefe, 0xfffffe, 0xfffffe, 0xfffefb, 0xfffffa, 0xfcfdf8, 0xfffffd, 0xd8d9d5, 0x2f302e, 0x000000, 0x060604, 0x000000, 0x857f36, 0xe8d53a, 0xf2d400, 0xf3d402, 0xf1d501, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d502, 0xf2d502, 0xf2d300, 0xedd300, 0xe9da45, 0xf9f3a0, 0xffffe2, 0xfefffb, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfcfcfc, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xfcfcfc, 0xfcfcfc, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfb, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfeffff, 0xffffff, 0xfefeff, 0xffffff, 0xfdeee9, 0xd79b98, 0xbb151e, 0xd51316, 0xe12020, 0xe41d1d, 0xe51c1f, 0xe61d1e, 0xe51d1c, 0xe01d1e, 0xc9322e, 0x822a25, 0x000000, 0x000202, 0x010100, 0x010101, 0x010101, 0x010101, 0x010101, 0x000000, 0x909090, 0xf7f7f7, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfdfdfe, 0xffffff, 0xffffff, 0xfdfdfc, 0xfafaf8, 0xf3f3f2, 0xc6c6c6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe9e9e9, 0xfafaf9, 0xfbfbf9, 0xfbfbfa, 0xfffffd, 0xfffffd, 0xfefffa, 0xfefff9, 0xfefff9, 0xfefff9, 0xfffffc, 0xd5d6d1, 0x38373c, 0x000000, 0x5d5929, 0xddd043, 0xeed507, 0xf4d400, 0xf2d601, 0xf0d502, 0xf0d500, 0xf0d500, 0xf0d500, 0xf0d500, 0xf1d400, 0xf0d500, 0xefd501, 0xf1d500, 0xf2d400, 0xf0d400, 0xe6d62e, 0xf2ea94, 0xfffedf, 0xfefef6, 0xfefefd, 0xfdfefe, 0xfefefd, 0xfeffff, 0xfeffff, 0xfeffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefdfc, 0xfffefd, 0xfffffd, 0xfffffd, 0xfdfffe, 0xfdfffe, 0xfefefe, 0xfcfefd, 0xfefffe, 0xfffdfa, 0xf2d8d3, 0xc97875, 0xc30000, 0xd92221, 0xe02423, 0xe02321, 0xe3221f, 0xe3201c, 0xe61e1c, 0xe01e20, 0xd32b28, 0x952f2b, 0x000000, 0x000000, 0x010001, 0x000000, 0x010101, 0x040404, 0x000000, 0x000000, 0x929292, 0xf8f8f8, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefeff, 0xfefdfe, 0xfdfdfc, 0xfdfdfa, 0xeaebe8, 0xa8a8a1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe9e9e9, 0xf8f8f6, 0xfbfbf9, 0xfefefc, 0xfefefc, 0xfefffa, 0xfefff9, 0xfefff9, 0xfefff9, 0xfdfef7, 0xfbfcf6, 0xdadbd4, 0x706d58, 0xc8be3b, 0xead515, 0xf1d400, 0xf3d501, 0xf0d600, 0xf1d500, 0xf0d500, 0xf0d500, 0xefd400, 0xefd400, 0xf0d500, 0xefd500, 0xefd600, 0xf0d600, 0xf1d601, 0xf4d500, 0xf2d500, 0xf0d526, 0xe8c782, 0xf2dcd0, 0xfffdf7, 0xfdfffe, 0xfefdfc, 0xfefffe, 0xfeffff, 0xfeffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfffefe, 0xfffffe, 0xffffff, 0xffffff, 0xfffffe, 0xfdfffd, 0xfbffff, 0xfffdfc, 0xfdf0ec, 0xddb2aa, 0xc63c3d, 0xd70007, 0xdd2524, 0xe12524, 0xe22523, 0xe32321, 0xe4231f, 0xe4221d, 0xe2211e, 0xd52725, 0xa52e2e, 0x2b0908, 0x000000, 0x020001, 0x010000, 0x000000, 0x010101, 0x000000, 0x000000, 0x989898, 0xf6f6f6, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefc, 0xfdfefb, 0xfcfcfa, 0xf0f0ee, 0xb7b7b1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdddddd, 0xfafaf9, 0xfdfdfb, 0xfcfcfa, 0xfefff9, 0xfefff9, 0xfefff9, 0xfefff9, 0xfefff8, 0xfcfdf6, 0xfefff4, 0xf8f7c6, 0xe9de54, 0xe7d000, 0xf1d500, 0xf1d402, 0xf0d601, 0xf1d401, 0xefd400, 0xf0d500, 0xefd400, 0xefd400, 0xf0d501, 0xefd601, 0xefd600, 0xf0d601, 0xf1d602, 0xf1d504, 0xf7d50d, 0xf3b424, 0xc14700, 0xb6433c, 0xe0b0a8, 0xffefe7, 0xfffffb, 0xfcfdff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefd, 0xfefefc, 0xfcfefd, 0xfdfefd, 0xfff9f5, 0xf1d1ca, 0xc97471, 0xcf0000, 0xe2171b, 0xe2231f, 0xe12322, 0xe32323, 0xe22420, 0xe42321, 0xe42421, 0xe32420, 0xdd2623, 0xb7322e, 0x431411, 0x000000, 0x010001, 0x000000, 0x010101, 0x050505, 0x000000, 0x000000, 0xa6a6a6, 0xfbfbfb, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefc, 0xfdfefa, 0xfbfcf7, 0xf6f6f3, 0xd8d8d8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe2e2e1, 0xfafaf8, 0xfcfcf8, 0xfefff9, 0xfefff9, 0xfefff9, 0xfefff9, 0xfefff9, 0xfdfef9, 0xfdfef7, 0xffffe9, 0xfdfbbc, 0xe9e263, 0xe6d404, 0xf1d501, 0xf3d600, 0xf2d502, 0xefd400, 0xf0d500, 0xf0d500, 0xf0d500, 0xf1d402, 0xf1d402, 0xf0d502, 0xf1d402, 0xf3d402, 0xf4d408, 0xf8c11c, 0xd76010, 0xdd1a1d, 0xdf1b18, 0xc60000, 0xca7972, 0xf3d5cd, 0xfffaf9, 0xfffeff, 0xfefdfe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfeffff, 0xfefefd, 0xfefefb, 0xfefffb, 0xfffdf8, 0xfbe5df, 0xdaa19c, 0xbf302f, 0xd70000, 0xe42121, 0xe42221, 0xe52121, 0xe52222, 0xe32322, 0xe42322, 0xe42323, 0xe22524, 0xdd2623, 0xc4332f, 0x671f1e, 0x000000, 0x020101, 0x020001, 0x000000, 0x030303, 0x000000, 0x000000, 0xb5b5b5, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfdfef9, 0xf8f8f4, 0xe9e9e3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe1e1e0, 0xf9f9f6, 0xfcfdf8, 0xfdfef8, 0xfefff9, 0xfefffa, 0xfefefc, 0xfdfefc, 0xfdfdfd, 0xfcfdfc, 0xfefff5, 0xfdfdd0, 0xebe375, 0xe9d200, 0xf2d400, 0xf2d400, 0xf1d300, 0xf1d500, 0xf2d600, 0xf2d401, 0xf2d401, 0xf2d304, 0xefd502, 0xf4d304, 0xf5d401, 0xfbcd1a, 0xdd7a1a, 0xda0c17, 0xe82520, 0xe72222, 0xe12122, 0xce0000, 0xbb3d3c, 0xd9a9a6, 0xf9e8e7, 0xfffcfb, 0xfefefe, 0xfefefd, 0xfdfffd, 0xfdfefe, 0xfefeff, 0xfdfefe, 0xfcfefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xffffff, 0xffffff, 0xfefffd, 0xfefffb, 0xfefffc, 0xfefffe, 0xfcfffd, 0xfefefc, 0xfdfff8, 0xfffaee, 0xedc8c2, 0xbf6562, 0xc00000, 0xda1719, 0xe22122, 0xe42320, 0xe52221, 0xe52222, 0xe42220, 0xe4231f, 0xe52222, 0xe62322, 0xde2621, 0xd23232, 0x872826, 0x000000, 0x000003, 0x010101, 0x010202, 0x040404, 0x000000, 0x232323, 0xc6c7c7, 0xffffff, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefd, 0xfbfbf9, 0xeeeeee, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdededb, 0xf8f9f6, 0xfafcf7, 0xfcfdf7, 0xfffffb, 0xfffefd, 0xfefefc, 0xfdfdfd, 0xfdfdfe, 0xfdfdfd, 0xfefff6, 0xfffed1, 0xf0e681, 0xe6cf18, 0xeed100, 0xf0d204, 0xf0d103, 0xf0d201, 0xf0d203, 0xf1d202, 0xf2d201, 0xf3d204, 0xf8d409, 0xfad017, 0xe4951f, 0xd12013, 0xe2241f, 0xe6231f, 0xe5201f, 0xe52021, 0xe22325, 0xd62124, 0xc40000, 0xbf5454, 0xe2b5b3, 0xfcede9, 0xfdfcf9, 0xfefdfc, 0xfefdfc, 0xfdfefd, 0xfcfefc, 0xfdfefb, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffc, 0xfffffb, 0xfffffd, 0xfefefd, 0xfdfefd, 0xfdfdfd, 0xfefefc, 0xfdfffa, 0xfdfff8, 0xfffee9, 0xfeedd1, 0xd79e8f, 0xb4221d, 0xc70005, 0xdf1f21, 0xe31f20, 0xe22121, 0xe22221, 0xe32222, 0xe42222, 0xe52321, 0xe5231f, 0xe32322, 0xe12322, 0xd1302c, 0x993030, 0x1e0000, 0x000100, 0x000204, 0x010001, 0x040403, 0x000000, 0x474747, 0xd7d7d7, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xf8f8f8, 0xeeeef4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd9dad9, 0xf7f9f5, 0xfdfef9, 0xfefefb, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefd, 0xfdfdfd, 0xfdfdf9, 0xfdfef6, 0xfeffd6, 0xf2ea87, 0xe5d123, 0xead000, 0xeed101, 0xf0d001, 0xf1d102, 0xf2d102, 0xf3d300, 0xf5d300, 0xf8d311, 0xeea31f, 0xd13113, 0xe22121, 0xe62321, 0xe5201d, 0xe32020, 0xe42021, 0xe42022, 0xe42124, 0xe32123, 0xd9080a, 0xc50000, 0xc76c6b, 0xebc0bd, 0xfff1ed, 0xfefffa, 0xfdfefb, 0xfefbfa, 0xfdfdfa, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffd, 0xfffffd, 0xfffefd, 0xfdfef9, 0xfcfff7, 0xfdfff7, 0xfefff1, 0xffffe7, 0xfefcd1, 0xfae7a3, 0xde9460, 0xcb0000, 0xde191c, 0xe41f21, 0xe51e1e, 0xe3201f, 0xe32121, 0xe32121, 0xe32121, 0xe42222, 0xe42220, 0xe62320, 0xe52524, 0xd82d2b, 0xa6322f, 0x2c0807, 0x000000, 0x000501, 0x020503, 0x000000, 0x000000, 0x747474, 0xe5e5e5, 0xffffff, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xf2f2f2, 0xe3e3e3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xedefeb, 0xf9f9f6, 0xfbfbf9, 0xfdfdfd, 0xffffff, 0xfffffd, 0xfefefc, 0xfdfdfd, 0xfdfdfd, 0xfafef7, 0xfbfff6, 0xffffe0, 0xf8f1a6, 0xe2d444, 0xe3cc00, 0xeece00, 0xf4d101, 0xf4d101, 0xf4d201, 0xf7d50e, 0xf2b11e, 0xd43d10, 0xe11918, 0xe52322, 0xe91e20, 0xe41f1f, 0xe22022, 0xe32021, 0xe22121, 0xe32120, 0xe62020, 0xe42020, 0xe0201f, 0xd70002, 0xc41114, 0xce7878, 0xedcbc2, 0xfff6ec, 0xfffef9, 0xfafefb, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefeff, 0xfefefd, 0xfefefc, 0xfdfff7, 0xfdfff3, 0xfffee6, 0xfef9bf, 0xf4ea8e, 0xf2da69, 0xe3a04e, 0xd22305, 0xe3221c, 0xe5211d, 0xe5201f, 0xe4211f, 0xe32222, 0xe42122, 0xe42222, 0xe42222, 0xe42222, 0xe42320, 0xe32522, 0xdd2c2b, 0xb53331, 0x450d0a, 0x000000, 0x010303, 0x040405, 0x000000, 0x000000, 0x9c9c9d, 0xf5f5f5, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfcfcfc, 0xececec, 0xc1c1c1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe2e2e0, 0xf4f4f3, 0xfcfcfc, 0xffffff, 0xfffffd, 0xfefefc, 0xfdfdfd, 0xfdfefd, 0xfdfdfc, 0xfefdfc, 0xfefef7, 0xfeffed, 0xf9f8bf, 0xe6db5e, 0xe5cc00, 0xf1d100, 0xf6d303, 0xf7d40d, 0xf7ba23, 0xd84f16, 0xdf121b, 0xe42120, 0xe4211f, 0xe21f1f, 0xe21f22, 0xe4201f, 0xe32120, 0xe32122, 0xe22121, 0xe22221, 0xe22220, 0xe61f20, 0xe62122, 0xe02222, 0xd40000, 0xc0221e, 0xcd928a, 0xeadbd3, 0xfcfaf6, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffefe, 0xfefeff, 0xfefffd, 0xfefefc, 0xfefffa, 0xfefff3, 0xffffe3, 0xfdf9be, 0xf3eb8d, 0xedd64f, 0xf3ce29, 0xecac35, 0xd23d14, 0xe2231e, 0xe5241e, 0xe52222, 0xe42221, 0xe32222, 0xe22323, 0xe32223, 0xe32222, 0xe42222, 0xe42221, 0xe2221e, 0xdb2625, 0xbc3534, 0x581816, 0x000000, 0x010302, 0x030504, 0x000000, 0x29292b, 0xc1c1c1, 0xfdfcfc, 0xfdfdfd, 0xfcfcfc, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfbfbfb, 0xededed, 0x9f9f9f, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcbcbcb, 0xf3f3f4, 0xfcfcfc, 0xfafafa, 0xfefefe, 0xfdfdfd, 0xfdfefd, 0xfdfefe, 0xfdfdfd, 0xfdfdfc, 0xfdfdfd, 0xfefff2, 0xfefdca, 0xf0e582, 0xe7cc23, 0xefcd00, 0xf9c22c, 0xda661c, 0xdc131d, 0xe22620, 0xe32422, 0xe32123, 0xe32124, 0xe42022, 0xe52122, 0xe42222, 0xe32322, 0xe32222, 0xe32221, 0xe2211f, 0xe42121, 0xe22121, 0xe32021, 0xe22124, 0xd82c28, 0xad2e2a, 0x431a16, 0x818180, 0xd1d1d1, 0xf7f7f7, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfdfefe, 0xfefdfc, 0xfefdfa, 0xfefefa, 0xfdfefc, 0xfefefc, 0xfffefc, 0xfefeff, 0xfdfefc, 0xfefff9, 0xfffff0, 0xffffda, 0xfbf7b3, 0xf2e682, 0xe9d442, 0xe9cd00, 0xf4cd05, 0xf4b42b, 0xcd5115, 0xd72616, 0xe62621, 0xe72321, 0xe52424, 0xe42423, 0xe42423, 0xe32322, 0xe22322, 0xe32322, 0xe42024, 0xe41f20, 0xdb2421, 0xb9322e, 0x6d2220, 0x000000, 0x030402, 0x000000, 0x000000, 0x6a6a6a, 0xdfdfdf, 0xffffff, 0xfefdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xfafafa, 0xececec, 0xe3e3e3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdddddd, 0xf0f0f0, 0xfbfbfb, 0xfefefe, 0xfefefe, 0xfdfffe, 0xfdfffe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefc, 0xfcfff9, 0xffffdd, 0xf6f1a5, 0xe7cb63, 0xcf761a, 0xce1b1b, 0xe22c28, 0xe32522, 0xe32320, 0xe22221, 0xe22122, 0xe22122, 0xe42222, 0xe42222, 0xe32322, 0xe42323, 0xe42222, 0xe32023, 0xe32021, 0xe32021, 0xe21f20, 0xdc2220, 0xc53a36, 0x6b2321, 0x000000, 0x000000, 0x000000, 0x6e6e6e, 0xc0c0c0, 0xededed, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfffffe, 0xfffffe, 0xffffff, 0xfefefe, 0xfdfdfe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfefe, 0xffffff, 0xffffff, 0xffffff, 0xfefdfe, 0xfffdfa, 0xfffdf7, 0xfffdfa, 0xfffdfa, 0xfefef7, 0xfdfffa, 0xfdfff8, 0xffffea, 0xffffd5, 0xfaf4a8, 0xf1e36b, 0xe8d22a, 0xe8cb00, 0xefc900, 0xf1ca01, 0xf6ba21, 0xd25e17, 0xd72115, 0xe22b22, 0xe42624, 0xe52321, 0xe52524, 0xe52423, 0xe42423, 0xe32322, 0xe42322, 0xe62023, 0xe22020, 0xdc2120, 0xc02f2d, 0x762623, 0x000000, 0x000507, 0x000000, 0x000000, 0xa1a1a1, 0xf2f2f2, 0xfefefe, 0xfbfbfb, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfafafa, 0xdddddd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbebebe, 0xf1f1f1, 0xfdfdfd, 0xfcfcfc, 0xfdfefd, 0xfdfffe, 0xfefefe, 0xffffff, 0xffffff, 0xfefdfc, 0xfdfffa, 0xfdfff7, 0xffffed, 0xfef6d9, 0xd5ab9c, 0xbc271f, 0xd50f00, 0xe02323, 0xe21f1f, 0xe31e1f, 0xe41f20, 0xe41f21, 0xe42021, 0xe32121, 0xe32322, 0xe42322, 0xe42222, 0xe32121, 0xe6211e, 0xe9201d, 0xe22320, 0xd13431, 0x832d29, 0x000000, 0x000101, 0x030201, 0x000000, 0x000000, 0x000000, 0x454545, 0x9f9f9f, 0xdfdfdf, 0xfafafa, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefdfd, 0xfefefe, 0xfefdfe, 0xfefefe, 0xfdfdfe, 0xfcfdfb, 0xfdfdf9, 0xfefefa, 0xfefef8, 0xfeffed, 0xfeffdd, 0xfdfcc0, 0xf7f099, 0xede066, 0xe9d226, 0xeccf00, 0xefce00, 0xf1cd01, 0xf0ce04, 0xf8c21a, 0xd46d1a, 0xd30014, 0xe7231f, 0xe52124, 0xe22323, 0xe42422, 0xe52324, 0xe52323, 0xe52323, 0xe52323, 0xe52223, 0xe52123, 0xe3201f, 0xd1292c, 0x882b2c, 0x000000, 0x000000, 0x000000, 0x545453, 0xd0d1d0, 0xffffff, 0xffffff, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfdfdfd, 0xf4f4f4, 0xe2e2e2, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb9b9b9, 0xe8e8e8, 0xfcfcfc, 0xfdfffe, 0xfdfffe, 0xffffff, 0xffffff, 0xfffefe, 0xfefdf8, 0xfefff9, 0xfefefc, 0xfffefb, 0xfbfdf6, 0xfdfaf0, 0xebcbc5, 0xc4595a, 0xcc0000, 0xdd1c1f, 0xe11e20, 0xe41e1f, 0xe51e21, 0xe41f21, 0xe22020, 0xe32322, 0xe42322, 0xe52223, 0xe42120, 0xe8201c, 0xe4201f, 0xce322d, 0x973430, 0x150100, 0x000000, 0x020101, 0x000001, 0x000000, 0x010101, 0x020202, 0x000000, 0x000000, 0x000000, 0x7a7a7a, 0xc3c3c3, 0xededed, 0xfdfdfd, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfe, 0xfefeff, 0xfdfdfe, 0xfdfdfd, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xfdfdfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xfffeff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfffdfe, 0xfffdfe, 0xfffdfe, 0xfefdfe, 0xfdfefc, 0xfdfefa, 0xfeffef, 0xffffdb, 0xfefdc9, 0xf9f4ac, 0xf1e57c, 0xebd743, 0xead308, 0xeed400, 0xf4d501, 0xf4d501, 0xf3d201, 0xf1cf00, 0xf9c918, 0xde8219, 0xcb000f, 0xe31d1e, 0xe72022, 0xe52024, 0xe42222, 0xe52323, 0xe52324, 0xe52323, 0xe52323, 0xe62423, 0xe62324, 0xe42322, 0xdb2824, 0xa82e2f, 0x270b0c, 0x000000, 0x000000, 0x969693, 0xeeeeec, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xf4f4f4, 0xd9d9d9, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xe2e2e2, 0xf9faf9, 0xfdfefe, 0xfefefe, 0xffffff, 0xfefeff, 0xfdfefe, 0xfefefb, 0xfefefd, 0xfefdfe, 0xfdfefa, 0xfffdf9, 0xfffdfa, 0xf7dfdc, 0xd58b88, 0xc1070f, 0xd50007, 0xe02020, 0xe22122, 0xe22122, 0xe52022, 0xe32122, 0xe02321, 0xe42121, 0xe72022, 0xe3211f, 0xd52a27, 0xa33734, 0x2c0b08, 0x000000, 0x010201, 0x000201, 0x010102, 0x010101, 0x010101, 0x020202, 0x020202, 0x020202, 0x000000, 0x000000, 0x000000, 0x464646, 0x908f90, 0xc7c6c6, 0xeaeaec, 0xfcfcf8, 0xfffff5, 0xfefff8, 0xfefefd, 0xfefdfe, 0xfefefd, 0xfefdfe, 0xfdfdff, 0xfdfdfd, 0xfffdfd, 0xfffdfc, 0xfffdfd, 0xfffdfb, 0xfffdfb, 0xfefdfc, 0xfdfdfc, 0xfdfdfd, 0xfdfdfd, 0xfdfefd, 0xfdfefd, 0xfefffe, 0xfefffe, 0xfeffff, 0xfeffff, 0xffffff, 0xffffff, 0xfefeff, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefdfe, 0xfefdfd, 0xfefefd, 0xfefefd, 0xfefffe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfffcfd, 0xfffdfc, 0xfdfff9, 0xfffef5, 0xffffec, 0xfffdd8, 0xfaf5b5, 0xf2e889, 0xeadb5a, 0xe8d123, 0xebcf00, 0xf1d100, 0xf3d302, 0xf2d500, 0xf5d501, 0xf5d501, 0xf5d300, 0xf9d014, 0xe79a23, 0xc80d0f, 0xdf191b, 0xe51d1e, 0xe32020, 0xe62324, 0xe62323, 0xe62324, 0xe52323, 0xe52321, 0xe42323, 0xe52324, 0xe52324, 0xe22524, 0xc43330, 0x560c0a, 0x000000, 0x4d4e4c, 0xc5c6c2, 0xfbfcf8, 0xfffffe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfcfcfc, 0xefefef, 0xbebebe, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdbdbdb, 0xf1f1f1, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefb, 0xfffdfa, 0xf8fdfb, 0xf9fbf8, 0xfff0eb, 0xeabfba, 0xc15b5b, 0xc40000, 0xd81515, 0xe12222, 0xe22122, 0xe32022, 0xe32021, 0xe42021, 0xe22121, 0xda2626, 0xb53434, 0x421212, 0x000000, 0x010101, 0x000100, 0x000100, 0x000100, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x0a152e, 0xa29c81, 0xf3eca5, 0xfcf8b6, 0xfffece, 0xfeffe0, 0xfeffeb, 0xfdfff4, 0xfcfff7, 0xfdfff6, 0xfefef8, 0xfdfef9, 0xfdfefb, 0xfdfef9, 0xfdfff9, 0xfcfefb, 0xfcfdf8, 0xfcfef8, 0xfcfef8, 0xfcfef9, 0xfdfefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefdfe, 0xfdfdfe, 0xfdfdfd, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfffefc, 0xfefdfb, 0xfdfdfb, 0xfefefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfffffe, 0xfffffc, 0xfefee9, 0xfbf9c6, 0xfbf3a7, 0xf2e683, 0xebdc5b, 0xe9d32b, 0xebcf00, 0xeed100, 0xefd200, 0xf0d300, 0xf2d300, 0xf3d200, 0xf4d500, 0xf8d303, 0xf5d304, 0xf8d314, 0xf1b024, 0xc73b0f, 0xde1a1d, 0xe51e20, 0xe3201e, 0xe32120, 0xe42222, 0xe52323, 0xe52323, 0xe52322, 0xe42222, 0xe72123, 0xe92124, 0xe42626, 0xcf3130, 0x6e0000, 0x000000, 0xa2a19f, 0xebece8, 0xfbfcf7, 0xfbfbf8, 0xfdfdfc, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xf9f9f9, 0xe9e9e9, 0xa4a4a4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc7c7c7, 0xebebeb, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfcfdfd, 0xfdfdf8, 0xfafdf7, 0xf6fdfc, 0xfafdfd, 0xfffdf9, 0xfae8e3, 0xd7a6a0, 0xba3c3b, 0xcc0000, 0xd8201e, 0xdf2321, 0xe2201f, 0xe21f20, 0xdd2322, 0xc1302f, 0x5a181a, 0x000000, 0x010101, 0x010101, 0x000101, 0x000000, 0x000100, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x020201, 0x050507, 0x000000, 0x524924, 0xd7c34a, 0xe8d014, 0xe9d42c, 0xebde57, 0xf0e87f, 0xf8f19e, 0xfcf8b6, 0xfffdc9, 0xffffd8, 0xffffe8, 0xfffff1, 0xfffef5, 0xfefef3, 0xfdfef2, 0xfdfef6, 0xfcfff7, 0xfdfff7, 0xfdfefa, 0xfdfefd, 0xfdfffe, 0xfdfffe, 0xfefefd, 0xfefdfc, 0xfefdfc, 0xfefdfd, 0xfefdfd, 0xfefdfd, 0xfdfcfd, 0xfdfdfd, 0xfefefe, 0xfeffff, 0xffffff, 0xfefefd, 0xfefefb, 0xfefefc, 0xfefefc, 0xfffefc, 0xfefefd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xf7f7f7, 0xe4e4e4, 0xc1c3bf, 0xaaa688, 0xe8d458, 0xf0d715, 0xeecf00, 0xf1d100, 0xf2d100, 0xf3d100, 0xf3d200, 0xf1d301, 0xf1d300, 0xf1d301, 0xf1d302, 0xf4d302, 0xf5d502, 0xf3d70c, 0xf7bb28, 0xd45516, 0xdd161e, 0xe92321, 0xe5201e, 0xe32122, 0xe32121, 0xe32121, 0xe32121, 0xe32121, 0xe42021, 0xe52122, 0xe42222, 0xdf2626, 0xd32826, 0x860000, 0x706f72, 0xd9d9d5, 0xfffffa, 0xfffefd, 0xfbfcf9, 0xfcfcfa, 0xfefefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xf6f6f6, 0xe3e3e3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x6d6d6d, 0xe6e6e6, 0xf7f7f7, 0xfbfbfb, 0xfcfcfc, 0xfefefe, 0xfefefe, 0xfcfefd, 0xfdfff7, 0xfffef7, 0xfefdfc, 0xfdfefc, 0xfefcfb, 0xfffffd, 0xfefef6, 0xf4dbd7, 0xd28f8a, 0xc12527, 0xd10009, 0xda2121, 0xdc2122, 0xc92e2f, 0x75211e, 0x000000, 0x010001, 0x010101, 0x010101, 0x010000, 0x000000, 0x000100, 0x010101, 0x010101, 0x000000, 0x000000, 0x000100, 0x010101, 0x010101, 0x010101, 0x020200, 0x000000, 0x2a2413, 0xcfbd4d, 0xf3d828, 0xf2d300, 0xf1d300, 0xeed200, 0xecd000, 0xecd20a, 0xebd42e, 0xeedb51, 0xf0e472, 0xf5ed8e, 0xf8f5a9, 0xfcfabb, 0xfefdcb, 0xffffdb, 0xfeffe7, 0xfeffee, 0xfefff6, 0xfefffa, 0xfdfff8, 0xfefff9, 0xfefffa, 0xfefffb, 0xfefefb, 0xfefdfb, 0xfefcfe, 0xfefdfe, 0xfffdfe, 0xfefcfd, 0xfefcfc, 0xfefdfd, 0xfffdfe, 0xfffdfe, 0xfefefc, 0xfefef9, 0xfefefa, 0xfdfdfb, 0xfffefd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xf7f7f7, 0xececec, 0xd9d9d9, 0xbdbdbd, 0x949494, 0x636363, 0x000013, 0x000000, 0xc8b53a, 0xf3d411, 0xf5d200, 0xf3d201, 0xf2d300, 0xf1d301, 0xf0d301, 0xf1d300, 0xf1d301, 0xf1d302, 0xf2d203, 0xf3d304, 0xf2d102, 0xf5d60d, 0xf9c51e, 0xdd6718, 0xe01718, 0xe72623, 0xe5231d, 0xe4211e, 0xe42024, 0xe42222, 0xe42222, 0xe42222, 0xe52222, 0xe42121, 0xe31f20, 0xdd181b, 0xc20005, 0x9f4b46, 0xc1b5b3, 0xf9f5f6, 0xffffff, 0xfefefa, 0xfffdfd, 0xfefefc, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfbfbfb, 0xf9f9f9, 0xededed, 0xcdcdcd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd8d8d8, 0xf2f2f2, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefdfe, 0xfdfefc, 0xfdfefc, 0xfefcfd, 0xfcfdfa, 0xfcfdfc, 0xfefdfb, 0xfcfcfa, 0xfefefa, 0xfff8f2, 0xeccbc6, 0xc5716e, 0xb70000, 0xbf0f18, 0x882627, 0x000000, 0x000001, 0x010100, 0x000101, 0x000000, 0x010000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010102, 0x010101, 0x020101, 0x000000, 0x000002, 0xb9ab48, 0xf3d829, 0xf1d300, 0xf2d401, 0xf2d300, 0xf2d300, 0xf2d300, 0xf2d400, 0xefd200, 0xeed000, 0xedd000, 0xebd000, 0xe9d113, 0xebd637, 0xeedd55, 0xf4e772, 0xf8ec86, 0xfcee9d, 0xf9e7bc, 0xf7e4d4, 0xf9eadf, 0xfdefe6, 0xfff3eb, 0xfff5f0, 0xfff8f4, 0xfffaf8, 0xfffcfc, 0xfffdfc, 0xfffdfd, 0xfffefd, 0xfffefc, 0xfffdfb, 0xfffdfb, 0xfffdfc, 0xfffefb, 0xfffef9, 0xfffffc, 0xfefefb, 0xf9faf8, 0xf6f6f6, 0xeeeeee, 0xe0e0e0, 0xd6d6d6, 0xc2c2c2, 0xa8a8a8, 0x898989, 0x676767, 0x373737, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbbad4f, 0xf3d72e, 0xf2d300, 0xf2d301, 0xf1d301, 0xf1d300, 0xf2d302, 0xf2d302, 0xf1d300, 0xf1d302, 0xf2d201, 0xf2d301, 0xf4d301, 0xf5d302, 0xfbc91f, 0xde771b, 0xda1914, 0xea271f, 0xe72322, 0xe5221f, 0xe62121, 0xe42221, 0xe42221, 0xe42223, 0xe42323, 0xe52423, 0xe01f1f, 0xca0000, 0xb43029, 0xcc9c97, 0xf2e6e2, 0xfffffe, 0xfdfdf9, 0xfcfdfa, 0xfefbfd, 0xfcfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xf8f8f8, 0xe9e9e9, 0x979797, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc5c5c5, 0xebebeb, 0xf8f8f8, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfdfefd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefd, 0xfffefb, 0xfdede9, 0xe0bab7, 0x9f6d6b, 0x000000, 0x000000, 0x000202, 0x010202, 0x000101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010102, 0x010004, 0x030103, 0x030102, 0x000000, 0x9b9049, 0xefd73e, 0xf4d400, 0xf2d503, 0xf3d500, 0xf2d300, 0xf2d400, 0xf1d301, 0xf1d301, 0xf1d300, 0xf1d200, 0xf1d200, 0xf0d200, 0xf2d200, 0xf2d100, 0xf1d100, 0xf0d000, 0xf3d100, 0xf3bc28, 0xc26024, 0xc34838, 0xc3584c, 0xc56760, 0xc7756e, 0xc9827d, 0xd08f8c, 0xd79b9b, 0xdaa4a4, 0xdda8a9, 0xdeacae, 0xdeb0b1, 0xdfb0af, 0xdfafaf, 0xddadab, 0xd9aaa9, 0xd4a9a8, 0xcfa9a7, 0xbca6a8, 0x878683, 0x6e6f6e, 0x5c5c5c, 0x3f3f3f, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x020004, 0x000000, 0x000000, 0xa99b51, 0xedd942, 0xefd300, 0xf3d303, 0xf1d401, 0xf1d300, 0xf1d300, 0xf1d300, 0xf2d301, 0xf1d300, 0xf2d103, 0xf4d203, 0xf2d402, 0xf4d300, 0xfccd17, 0xe28e19, 0xd31210, 0xe6241c, 0xe72521, 0xe52521, 0xe62222, 0xe72021, 0xe42321, 0xe42321, 0xe22123, 0xde2222, 0xcc0000, 0xb72826, 0xc78583, 0xeecfcd, 0xfffaf6, 0xfffffc, 0xfefefe, 0xfffffe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfcfcfc, 0xf1f1f1, 0xdedede, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdfdfdf, 0xf2f2f2, 0xfdfdfd, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefa, 0xfdfef8, 0xfbfef9, 0xfefdf8, 0xf8f2ee, 0xbfbdba, 0x585d5b, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x000000, 0x000101, 0x020001, 0x020602, 0x000000, 0x807135, 0xe7d243, 0xf1d400, 0xf4d304, 0xf4d401, 0xf1d300, 0xf0d300, 0xefd300, 0xeed300, 0xefd300, 0xefd100, 0xf0d200, 0xf1d301, 0xf1d301, 0xf0d303, 0xf4d300, 0xf5d401, 0xf6d105, 0xfdc918, 0xd97917, 0xd50009, 0xe41610, 0xdf1116, 0xdb0b07, 0xd70000, 0xd50000, 0xd50000, 0xd40000, 0xd10000, 0xd10000, 0xd00000, 0xd00000, 0xd20000, 0xd00000, 0xd10000, 0xcd0000, 0xc70000, 0xa6151a, 0x1c0000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x000200, 0x020101, 0x000000, 0x908541, 0xead445, 0xecd500, 0xefd105, 0xf2d304, 0xf0d400, 0xf1d300, 0xf2d400, 0xf1d301, 0xf1d302, 0xf1d301, 0xf1d401, 0xf2d206, 0xf7d001, 0xfbcf10, 0xe8a01f, 0xce2013, 0xe11c16, 0xe52120, 0xe72122, 0xe62120, 0xe52221, 0xe82123, 0xe72124, 0xe0201b, 0xce0000, 0xba2a20, 0xc68685, 0xecced2, 0xfff1f1, 0xfefbf8, 0xfcfefb, 0xfdfdfc, 0xfffffe, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfafafa, 0xe7e7e7, 0xb2b2b2, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbdbdbd, 0xe4e4e4, 0xf6f6f6, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfffc, 0xfefefa, 0xfefef9, 0xfefef7, 0xfffff9, 0xfffffe, 0xf3f4f3, 0xbfbebf, 0x6b6b6b, 0x000000, 0x000000, 0x000000, 0x030303, 0x020202, 0x000000, 0x000000, 0x010101, 0x010101, 0x020203, 0x060303, 0x000000, 0x5c5524, 0xdfc941, 0xf3d503, 0xf2d400, 0xf0d500, 0xf1d403, 0xf0d402, 0xeed400, 0xeed300, 0xedd300, 0xeed200, 0xefd100, 0xf0d201, 0xf1d301, 0xf2d402, 0xf1d303, 0xf4d203, 0xf3d207, 0xfbcc15, 0xe6901a, 0xd21b10, 0xe7201b, 0xe62222, 0xe72122, 0xe92120, 0xe62021, 0xe52022, 0xe52022, 0xe51f22, 0xe72122, 0xe72021, 0xe71f21, 0xe71e21, 0xe61f1f, 0xe61e23, 0xe91c22, 0xdf2223, 0xc63533, 0x6c1f1c, 0x000000, 0x000101, 0x010201, 0x000101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x010101, 0x060504, 0x000000, 0x776b33, 0xe7d045, 0xf0d400, 0xf2d500, 0xf2d302, 0xf2d400, 0xf0d501, 0xf1d301, 0xf1d301, 0xf1d301, 0xf1d301, 0xf1d401, 0xf6d202, 0xf4d202, 0xf7d30a, 0xf2ac23, 0xca360e, 0xdd0c1b, 0xe51c1e, 0xe91d1e, 0xe4201f, 0xe52221, 0xe32320, 0xdd1c14, 0xcf0000, 0xc33b38, 0xce908f, 0xedd4cf, 0xfff6f1, 0xfffefb, 0xfefcf7, 0xfefdf7, 0xfdfff9, 0xfdfefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xf4f4f4, 0xdbdbdb, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xd5d5d5, 0xf4f4f4, 0xfbfbfb, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfffefc, 0xfefffa, 0xfdfff8, 0xfcfef8, 0xfefdfa, 0xfffefc, 0xfffffd, 0xf6f7f6, 0xcdcdcd, 0x7d7d7d, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010101, 0x020301, 0x000000, 0x342f19, 0xd2c041, 0xf3d812, 0xf3d400, 0xf4d401, 0xf0d503, 0xf1d502, 0xf1d401, 0xf0d300, 0xeed300, 0xeed301, 0xeed201, 0xf1d201, 0xf1d301, 0xf1d301, 0xf1d301, 0xf2d400, 0xf5d202, 0xfad210, 0xefa11d, 0xce2b0f, 0xdd1e1e, 0xe42420, 0xe62321, 0xe72223, 0xe62221, 0xe52121, 0xe52121, 0xe52221, 0xe52120, 0xe6211f, 0xe72120, 0xe82220, 0xe72120, 0xea1f1e, 0xeb1e1e, 0xe71e1e, 0xce332f, 0x822925, 0x000000, 0x000203, 0x020101, 0x010100, 0x000101, 0x010101, 0x000000, 0x010101, 0x000000, 0x000000, 0x000000, 0x000000, 0x020201, 0x000000, 0x534f29, 0xddca46, 0xf4d50f, 0xf2d300, 0xf2d401, 0xf1d400, 0xf2d402, 0xf2d501, 0xf1d301, 0xf1d301, 0xf1d301, 0xf1d302, 0xf1d302, 0xf5d202, 0xf8d306, 0xf6b924, 0xd44f17, 0xdf0017, 0xe41b17, 0xe71a1d, 0xe31c1c, 0xdf1e1f, 0xd6120f, 0xc60000, 0xbe534d, 0xd5a19b, 0xf2d8d1, 0xfff7f4, 0xfdfffd, 0xfdfdf9, 0xfefef8, 0xfcfff7, 0xfcfef9, 0xfdfefb, 0xfffefc, 0xfffffe, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfcfcfc, 0xf5f5f5, 0xe4e4e4, 0xb3b3b3, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb6b6b6, 0xe2e2e2, 0xf7f7f7, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefd, 0xfefefe, 0xfdfdfd, 0xfdfdfb, 0xfdfdfb, 0xfbfcfa, 0xfcfcfc, 0xffffff, 0xfdfdfd, 0xdbdbdb, 0x929291, 0x30302f, 0x000000, 0x000000, 0x000000, 0x030303, 0x000002, 0x000002, 0xbdad44, 0xf5da25, 0xf2d300, 0xf3d400, 0xf4d400, 0xf2d400, 0xf3d301, 0xf0d200, 0xefd100, 0xf1d300, 0xf0d301, 0xf1d300, 0xf1d301, 0xf0d302, 0xf1d300, 0xf0d301, 0xf1d303, 0xf8d20e, 0xf3b31d, 0xcd4514, 0xe11a1e, 0xe42523, 0xe52423, 0xe7231f, 0xe52324, 0xe42425, 0xe42323, 0xe42223, 0xe42223, 0xe42122, 0xe42020, 0xe72021, 0xe72021, 0xe92022, 0xea1f23, 0xe5201e, 0xda2f2b, 0x95312d, 0x090000, 0x000000, 0x010102, 0x020101, 0x020102, 0x000001, 0x000000, 0x010101, 0x010101, 0x010100, 0x000002, 0x000001, 0x040103, 0x000000, 0x1f1f17, 0xcfbb51, 0xf2d722, 0xf0d500, 0xf2d400, 0xf1d400, 0xf1d400, 0xf2d404, 0xf3d402, 0xf0d402, 0xf0d401, 0xf1d301, 0xf2d102, 0xf3d101, 0xf6d305, 0xfac51e, 0xda681a, 0xdf0518, 0xe7211e, 0xe51f1a, 0xdf1510, 0xcb0000, 0xbe0000, 0xbf625f, 0xd9ada9, 0xf7e7e2, 0xfffdf8, 0xfefffb, 0xfdfdfb, 0xfefdfa, 0xfdfefc, 0xfdfdfd, 0xfefdfd, 0xfefeff, 0xfefefe, 0xfefefd, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfafafa, 0xececec, 0xcfcfcf, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcacaca, 0xeaeaea, 0xf7f7f7, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xfcfcfa, 0xe6e6e4, 0xb2b2b1, 0x636362, 0x000000, 0x000000, 0x000000, 0xa29547, 0xf1da3e, 0xf3d600, 0xf3d401, 0xf3d300, 0xf1d300, 0xf0d302, 0xf1d303, 0xf1d301, 0xf0d200, 0xf1d301, 0xf1d301, 0xf1d301, 0xefd401, 0xf1d400, 0xf4d202, 0xf3d204, 0xf6d205, 0xf8bb1e, 0xd05a16, 0xd7141b, 0xe32522, 0xe32623, 0xe42524, 0xe52423, 0xe52324, 0xe62424, 0xe62424, 0xe62424, 0xe42222, 0xe42222, 0xe52122, 0xe62121, 0xe5211f, 0xe5201f, 0xe51f22, 0xdd2e28, 0xa6332d, 0x250404, 0x000000, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x000000, 0x010101, 0x010100, 0x000001, 0x000001, 0x010200, 0x000000, 0x000001, 0xb7a950, 0xefd335, 0xf2d300, 0xf2d400, 0xf2d300, 0xf1d300, 0xf1d300, 0xf1d301, 0xf1d301, 0xefd302, 0xefd401, 0xf0d301, 0xf0d201, 0xf2d202, 0xfccb1c, 0xe0801b, 0xd31512, 0xe12215, 0xd80800, 0xc70000, 0xb9403c, 0xc78d87, 0xe6c7c0, 0xfbe8e4, 0xfffbf6, 0xfefffa, 0xfffcf8, 0xfefdfd, 0xfdfdfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfafafa, 0xededed, 0xdadada, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xcecece, 0xececec, 0xf9f9f9, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfcfcfc, 0xfbfbfa, 0xfefefb, 0xfefffa, 0xf4f5f1, 0xd1d1cf, 0x919293, 0x8b8a65, 0xe5d754, 0xedd600, 0xefd500, 0xf4d200, 0xf4d301, 0xf2d302, 0xf0d301, 0xefd401, 0xf1d301, 0xf1d301, 0xf1d301, 0xf1d301, 0xf0d303, 0xf0d500, 0xf3d403, 0xf3d307, 0xf5d301, 0xfac61b, 0xdc7116, 0xd7031a, 0xe22321, 0xe42422, 0xe52524, 0xe52524, 0xe52424, 0xe62424, 0xe62424, 0xe52323, 0xe52323, 0xe52323, 0xe52222, 0xe52222, 0xe5211f, 0xe71f1d, 0xe6201e, 0xe22b27, 0xb73330, 0x340e0a, 0x000000, 0x030203, 0x010101, 0x000000, 0x010101, 0x010101, 0x000000, 0x000000, 0x010101, 0x010101, 0x010101, 0x010104, 0x000003, 0x000000, 0x9e9144, 0xeed53c, 0xf0d300, 0xf1d502, 0xf1d401, 0xf2d301, 0xf1d300, 0xf1d301, 0xf2d402, 0xf2d401, 0xf2d402, 0xf2d304, 0xf3d101, 0xf5d000, 0xfbce1a, 0xe69a1b, 0xc00000, 0xc30000, 0xc03127, 0xc5736d, 0xdbaea8, 0xf4dedb, 0xfff7f4, 0xfffefc, 0xfefdfb, 0xfcfdf8, 0xfdfef9, 0xfdfdfb, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xf6f6f6, 0xe9e9e9, 0xa8a8a8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xdfdfdf, 0xefefef, 0xf9f9f9, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffd, 0xfffffd, 0xfefefb, 0xfefffc, 0xfffffd, 0xfcfdf9, 0xf6f9d8, 0xf6f2a1, 0xede268, 0xe8d841, 0xe5d205, 0xe6d000, 0xe9d100, 0xeed100, 0xf0d101, 0xf1d302, 0xf1d302, 0xf1d301, 0xf1d301, 0xf0d301, 0xf2d400, 0xf2d206, 0xf0d107, 0xfcca15, 0xe0891c, 0xd20e11, 0xe6201b, 0xe1251e, 0xe42221, 0xe42222, 0xe42222, 0xe52323, 0xe52324, 0xe42222, 0xe42222, 0xe52223, 0xe52223, 0xe52122, 0xe52221, 0xe7211f, 0xe82020, 0xdf2725, 0xc2362f, 0x5b1716, 0x000000, 0x020000, 0x010104, 0x020202, 0x010101, 0x010101, 0x010101, 0x000000, 0x000000, 0x000000, 0x010101, 0x010102, 0x050506, 0x000000, 0x867a36, 0xe9d43e, 0xf1d300, 0xf0d400, 0xefd405, 0xf0d401, 0xf1d401, 0xf1d301, 0xf1d301, 0xf2d301, 0xf1d301, 0xf1d400, 0xf2d200, 0xf3d000, 0xf3cc03, 0xe0aa00, 0xaa401a, 0xc5726a, 0xdbaca3, 0xf1d8d3, 0xfef1ed, 0xfffdfa, 0xfffffe, 0xfefefd, 0xfcfefa, 0xfcfff7, 0xfdfff9, 0xfdfffc, 0xfcffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xf7f7f7, 0xe4e4e4, 0xbababa, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x8f8f8f, 0xd5d5d5, 0xf2f2f2, 0xfcfcfc, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefd, 0xfffffe, 0xfefeff, 0xfdfdfd, 0xfbfbf9, 0xfcfdf8, 0xfdfef2, 0xfdffec, 0xfeffdd, 0xfdfac9, 0xf5f3a7, 0xede681, 0xe6d951, 0xe5d118, 0xe9d000, 0xeed000, 0xf0d200, 0xf1d300, 0xf1d300, 0xf0d300, 0xf1d300, 0xf2d201, 0xfbcf10, 0xec9a1e, 0xce220d, 0xdf201c, 0xe52020, 0xe4211c, 0xe32222, 0xe42222, 0xe42222, 0xe42323, 0xe42223, 0xe52122, 0xe52222, 0xe52222, 0xe52122, 0xe62122, 0xe62221, 0xe6211f, 0xe12423, 0xc3342d, 0x6d211d, 0x000000, 0x000101, 0x010001, 0x010201, 0x010101, 0x010101, 0x020202, 0x020202, 0x010101, 0x010102, 0x010101, 0x010100, 0x040403, 0x000000, 0x655b2d, 0xe2cd45, 0xf2d504, 0xf3d300, 0xf1d400, 0xf3d202, 0xf2d300, 0xf2d301, 0xf2d301, 0xf1d300, 0xf1d300, 0xefd100, 0xebd000, 0xe7cf00, 0xe5d334, 0xe7d569, 0xd8c499, 0xeedbd0, 0xfef2ef, 0xfffdf5, 0xfffefd, 0xfdfdfd, 0xfcfefa, 0xfdfdfa, 0xfdfdfc, 0xfbfefb, 0xfcfefb, 0xfdfefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfafafa, 0xeeeeee, 0xd9d9d9, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x898989, 0xe6e6e6, 0xf4f4f4, 0xfafafa, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfc, 0xfdfdfb, 0xfdfefa, 0xfdfef8, 0xfdfff5, 0xfeffef, 0xffffe2, 0xfefdcb, 0xf8f5a9, 0xf1ea8a, 0xecdf69, 0xe7d645, 0xe6cf19, 0xe9cf00, 0xebd200, 0xf0d400, 0xf8d407, 0xf3b221, 0xcc3f0e, 0xe01b19, 0xe5231e, 0xe21f1e, 0xe21f1f, 0xe22020, 0xe32020, 0xe32021, 0xe52023, 0xe62024, 0xe52121, 0xe42321, 0xe42322, 0xe52323, 0xe62221, 0xe62120, 0xe32220, 0xd02f2b, 0x7e2621, 0x000000, 0x000000, 0x000101, 0x000102, 0x020103, 0x010101, 0x000000, 0x010101, 0x010101, 0x000100, 0x010102, 0x010101, 0x030301, 0x000000, 0x40391f, 0xd7c348, 0xf2d716, 0xf6d300, 0xf5d502, 0xf3d500, 0xf1d400, 0xefd300, 0xecd100, 0xe8ce00, 0xe6ce00, 0xe5d128, 0xead84e, 0xede075, 0xf1ea96, 0xf9f6bd, 0xfdfddd, 0xfffff2, 0xfffffc, 0xfefffd, 0xfffffd, 0xfffffe, 0xfefdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfffeff, 0xfffeff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xfbfbfb, 0xf7f7f7, 0xededed, 0xdedede, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x9d9d9d, 0xe3e3e3, 0xf0f0f0, 0xf9f9f9, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfdfdfc, 0xfdfdfa, 0xfdfef9, 0xfdfef8, 0xfdfef7, 0xfcfdf6, 0xfdfef5, 0xfefef0, 0xffffea, 0xfdffdc, 0xfbfbc6, 0xf9f4ac, 0xf4eb8c, 0xece16f, 0xeddb55, 0xebc53e, 0xab5300, 0xbc0000, 0xd30000, 0xd50500, 0xd9140f, 0xdd1b1b, 0xe01d1e, 0xe31d1f, 0xe41e20, 0xe62022, 0xe72123, 0xe52122, 0xe52323, 0xe62324, 0xe62223, 0xe6221f, 0xe2221c, 0xd62a2b, 0x932625, 0x000000, 0x000000, 0x000000, 0x000100, 0x000100, 0x010000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000003, 0x000100, 0x010200, 0x000000, 0x110505, 0xc4b44e, 0xedd31e, 0xeece00, 0xeed000, 0xecd200, 0xead300, 0xe7d315, 0xe7d539, 0xeadb57, 0xeee476, 0xf4ee90, 0xf9f6af, 0xfdfccd, 0xfeffe1, 0xfeffea, 0xfefef3, 0xfefcf8, 0xfefdfb, 0xfdfdfc, 0xfefefd, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xf4f4f4, 0xe8e8e8, 0xd1d1d1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x666666, 0xd2d2d2, 0xeeeeee, 0xf5f5f5, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfb, 0xfdfdfb, 0xfefefc, 0xfefefc, 0xfefefb, 0xfefefb, 0xfefefc, 0xfdfffc, 0xfcfffb, 0xfbfffa, 0xfdfff6, 0xfefff1, 0xffffe5, 0xffffd6, 0xfefdcc, 0xf7edc6, 0xe0c5b5, 0xdaa8a0, 0xd18989, 0xc66a6d, 0xc1474d, 0xc2292e, 0xc60005, 0xcb0000, 0xcf0000, 0xd50000, 0xda0000, 0xdc060b, 0xdd1011, 0xe11716, 0xe21b19, 0xe21b18, 0xd82723, 0xab2827, 0x2b0000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xa49c59, 0xe8d643, 0xe7d01e, 0xe7d540, 0xeae15b, 0xeee776, 0xf4ee8d, 0xf8f4a9, 0xfbfac1, 0xfefed3, 0xffffe1, 0xffffe7, 0xffffeb, 0xfefff4, 0xfdfff7, 0xfdfef9, 0xfefefc, 0xfdfdfd, 0xfdfdfe, 0xfdfdfe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfafafa, 0xf0f0f0, 0xe8e8e8, 0xb4b4b4, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc5c5c5, 0xe1e1e1, 0xf4f4f4, 0xfafafa, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfc, 0xfdfdfb, 0xfefefb, 0xfefffb, 0xfefffa, 0xfefefa, 0xfffefa, 0xfffff9, 0xfefef8, 0xfffdfc, 0xfefffa, 0xfdfffa, 0xfdfff8, 0xfefff5, 0xfdfff7, 0xfdfffa, 0xfffff9, 0xfffcf9, 0xfef4f5, 0xfdebef, 0xfadde3, 0xf4d0d4, 0xecc3c5, 0xe0afb2, 0xd79ea0, 0xd89294, 0xd18485, 0xcb7575, 0xc76766, 0xc55858, 0xc24c4a, 0xbd4542, 0xad4342, 0x5e2b29, 0x1d2629, 0x262323, 0x211f21, 0x252325, 0x2c2c2c, 0x333433, 0x393a38, 0x424242, 0x515151, 0x646464, 0x747474, 0x808080, 0x8e8f8c, 0xa1a1a3, 0xbab9b3, 0xf1efc3, 0xf8f3ab, 0xfcf7b4, 0xfdfdc3, 0xffffd5, 0xffffdc, 0xffffe3, 0xffffee, 0xfefff6, 0xfdfef7, 0xfdfefb, 0xfdfdfe, 0xfefdfb, 0xfefdfc, 0xfdfef6, 0xfefef7, 0xfffdfa, 0xfefefd, 0xfdfdfe, 0xfdfdfd, 0xfefefe, 0xfffffe, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfdfdfd, 0xf7f7f7, 0xeaeaea, 0xdedede, 0x9b9b9b, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xbdbdbd, 0xe1e1e1, 0xeeeeee, 0xf8f8f8, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfc, 0xfcfcfb, 0xfefefb, 0xfefffb, 0xfefefb, 0xfefefc, 0xfefefd, 0xfffefe, 0xfffeff, 0xfefdfd, 0xfdfdfa, 0xfefefb, 0xfefefe, 0xfffefe, 0xfffeff, 0xfefefd, 0xfdfdfc, 0xfdfefd, 0xfcfefb, 0xfdfefd, 0xfffdfe, 0xfffdfe, 0xfffdff, 0xfffdff, 0xfffcfd, 0xfffbfa, 0xfff9f8, 0xfef5f3, 0xfdf0ef, 0xfae9e9, 0xf7e4e4, 0xf4e2e1, 0xf1e1df, 0xeae3e2, 0xeaeaea, 0xeae9e7, 0xe8e8e8, 0xeae9ea, 0xebeaeb, 0xebebeb, 0xececec, 0xededed, 0xf1f1f1, 0xf8f8f8, 0xfcfcfc, 0xfdfdfd, 0xfffffd, 0xffffff, 0xffffff, 0xfffff7, 0xfffff5, 0xfefff6, 0xfdfff6, 0xfffff8, 0xfdfdf9, 0xfdfdfb, 0xfdfdfe, 0xfefdff, 0xfdfdfd, 0xfefefe, 0xfefeff, 0xfefefe, 0xfefefe, 0xfdfefd, 0xfefefc, 0xfefdfc, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefd, 0xfefefd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfcfcfc, 0xf5f5f5, 0xeaeaea, 0xd0d0d0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc1c1c1, 0xdedede, 0xebebeb, 0xf7f7f7, 0xfbfbf9, 0xfbfbf9, 0xfdfdfb, 0xfefefc, 0xfefefc, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfdfd, 0xfcfdfd, 0xfcfdfd, 0xfcfdfd, 0xfefefe, 0xfdfefc, 0xfefffd, 0xfffffd, 0xfffffe, 0xfffffe, 0xfffffd, 0xfffffd, 0xfffffd, 0xfffffd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefeff, 0xffffff, 0xfffffe, 0xfffffe, 0xfffffe, 0xfffffe, 0xfdfdfe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefc, 0xfefefc, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfdfe, 0xfdfdfe, 0xfafafa, 0xf4f4f4, 0xeaeaea, 0xdfdfdf, 0xadadad, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x666666, 0xd0d0d0, 0xe5e5e5, 0xf0f0f0, 0xf8f8f8, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfdfefc, 0xfdfefc, 0xfefefc, 0xfefefc, 0xfefefc, 0xfdfffd, 0xfdfefd, 0xfdfdfd, 0xfdfcfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefc, 0xfefefc, 0xfdfdfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xfbfbfb, 0xf5f5f5, 0xececec, 0xe0e0e0, 0xc1c1c1, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x888888, 0xcdcdd0, 0xdcdcdc, 0xececec, 0xf5f5f5, 0xfafafa, 0xfdfdfd, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefffe, 0xfefffe, 0xfffffe, 0xfffffe, 0xfefefe, 0xfefffe, 0xfefffe, 0xffffff, 0xfffeff, 0xfffefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xfdfdfc, 0xfefefc, 0xfcfcfb, 0xf7f7f7, 0xf1f1f1, 0xededed, 0xd7d7d7, 0xbcbcbc, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xc7c7c7, 0xdbdbdb, 0xe7e7e7, 0xefefef, 0xf8f8f8, 0xfdfdfd, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffeff, 0xfffeff, 0xfffeff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfffffe, 0xfffffe, 0xfefefd, 0xfefefd, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfb, 0xf5f5f4, 0xeeeeed, 0xe4e4e2, 0xd4d4d4, 0xa2a2a2, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x5b5b5b, 0xcccccc, 0xdfdfdf, 0xe2e2e2, 0xf0f0f0, 0xf5f5f5, 0xf7f7f7, 0xfbfbfb, 0xfcfcfc, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfdfdfd, 0xfefefe, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfbfbfb, 0xf8f8f8, 0xf3f3f3, 0xf1f1f1, 0xdfdfdf, 0xd4d4d4, 0xbdbdbd, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xb2b2b2, 0xc5c5c5, 0xe5e5e5, 0xe8e8e8, 0xe9e9e9, 0xf5f5f5, 0xf3f3f3, 0xfcfcfc, 0xfbfbfb, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xfefefe, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xffffff, 0xfefefe, 0xfbfbfb, 0xfafafa, 0xf2f2f2, 0xf1f1f1, 0xebebeb, 0xe5e5e5, 0xd6d6d6, 0xd6d6d6, 0xa6a6a6, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 
-  0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x8f8f8f, 0xc1c1c1, 0xd8d8d8, 0xd8d8d8, 0xe6e6e6, 0xd8d8d8, 0xf1f1f1, 0xeaeaea, 0xe5e5e5, 0xf2f2f2, 0xfafafa, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xfdfdfd, 0xfdfdfd, 0xfdfdfd, 0xfcfcfc, 0xf5f5f5, 0xe7e7e7, 0xf2f2f2, 0xf2f2f2, 0xdbdbdb, 0xf1f1f1, 0xd9d9d9, 0xcfcfcf, 0xb7b7b7, 0x797979, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000
-};
\ No newline at end of file
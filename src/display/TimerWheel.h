@@ -0,0 +1,227 @@
+/**
+ * Timeouts da tela numa roda de temporizadores hierárquica (timer wheel)
+ *
+ * Cada timeout é um Timer global com o seu callback. arm() e cancel() são
+ * O(1) (lista duplamente encadeada no slot); poll(), a cada passagem,
+ * avança a roda até millis() e chama os callbacks vencidos. nextIn() diz
+ * exatamente quantos ms faltam para o próximo: é o sono do FramePacer, sem
+ * um if (millis() - x > TIMEOUT) por timeout a cada passagem.
+ *
+ *   TimerWheel::Timer qrTimeout(onQrTimeout);
+ *   timers.begin();
+ *   timers.arm(qrTimeout, 180000);       // rearmar substitui o anterior
+ *   timers.cancel(qrTimeout);
+ *   timers.poll();                       // a cada passagem da task
+ *   uint32_t sleepMs = timers.nextIn();
+ *
+ * Resolução de 1 ms, TIMER_WHEEL_LEVELS níveis de 64 slots: o nível L
+ * guarda os timeouts que vencem em até 64^(L+1) ms e desce para o nível
+ * de baixo quando a roda chega ao slot dele (cascata). Com 5 níveis o
+ * maior atraso é ~12 dias (TIMER_WHEEL_MAX_MS). Tudo em subtração de
+ * uint32_t: a volta do millis() (49 dias) não adianta nem atrasa nada.
+ *
+ * Callbacks rodam dentro de poll() e podem armar/cancelar qualquer timer
+ * (inclusive o próprio). Só para uma task (a render): sem lock.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <Arduino.h>
+
+#ifndef TIMER_WHEEL_LEVELS
+  #define TIMER_WHEEL_LEVELS 5
+#endif
+
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_MAX_MS ((1UL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1)
+
+class TimerWheel {
+public:
+  class Timer {
+    friend class TimerWheel;
+    void (*callback)();
+    Timer* next = NULL;
+    Timer** pprev = NULL;     // NULL = desarmado
+    uint32_t expires = 0;
+
+  public:
+    explicit Timer(void (*onExpire)()) : callback(onExpire) {}
+    bool armed() const { return pprev != NULL; }
+  };
+
+private:
+  Timer* slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+  uint64_t used[TIMER_WHEEL_LEVELS];   // bit por slot (pode ter bit de slot já vazio)
+  uint32_t base = 0;                   // próximo ms a processar
+  uint16_t count = 0;
+
+  static uint8_t slotOf(uint32_t expires, uint8_t level) {
+    return (expires >> (level * TIMER_WHEEL_BITS)) & (TIMER_WHEEL_SLOTS - 1);
+  }
+
+  static void link(Timer*& head, Timer& t) {
+    t.next = head;
+    if (head) head->pprev = &t.next;
+    head = &t;
+    t.pprev = &head;
+  }
+
+  static void unlink(Timer& t) {
+    *t.pprev = t.next;
+    if (t.next) t.next->pprev = t.pprev;
+    t.next = NULL;
+    t.pprev = NULL;
+  }
+
+  // Nível = menor que alcança o vencimento a partir de base
+  void insert(Timer& t) {
+    uint32_t delta = t.expires - base;
+    if ((int32_t)delta < 0) {        // vencido (armado dentro de um callback)
+      t.expires = base;
+      delta = 0;
+    }
+    uint8_t level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1UL << ((level + 1) * TIMER_WHEEL_BITS))) level++;
+    uint8_t slot = slotOf(t.expires, level);
+    link(slots[level][slot], t);
+    used[level] |= 1ULL << slot;
+  }
+
+  // Desce os timers do slot atual do nível para os níveis de baixo
+  void cascade(uint8_t level) {
+    uint8_t slot = slotOf(base, level);
+    Timer* list = slots[level][slot];
+    slots[level][slot] = NULL;
+    used[level] &= ~(1ULL << slot);
+    while (list) {
+      Timer* t = list;
+      list = t->next;
+      t->next = NULL;
+      insert(*t);
+    }
+  }
+
+  // Processa o ms base e avança
+  void step() {
+    for (uint8_t level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+      if (slotOf(base, level - 1) != 0) break;
+      cascade(level);
+    }
+
+    uint8_t slot = slotOf(base, 0);
+    base++;
+    if (slots[0][slot] == NULL) return;
+
+    // Lista separada: callbacks podem cancelar timers que ainda estão nela
+    Timer* expired = slots[0][slot];
+    slots[0][slot] = NULL;
+    used[0] &= ~(1ULL << slot);
+    expired->pprev = &expired;
+    while (expired) {
+      Timer* t = expired;
+      unlink(*t);
+      count--;
+      t->callback();
+    }
+  }
+
+  // Próximo slot ocupado do nível a partir de first (64 = nenhum)
+  uint8_t nextUsed(uint8_t level, uint8_t first) {
+    for (uint8_t d = 0; d < TIMER_WHEEL_SLOTS; d++) {
+      uint8_t slot = (first + d) & (TIMER_WHEEL_SLOTS - 1);
+      if (!(used[level] & (1ULL << slot))) continue;
+      if (slots[level][slot]) return d;
+      used[level] &= ~(1ULL << slot);   // esvaziado por cancel()
+    }
+    return TIMER_WHEEL_SLOTS;
+  }
+
+  uint32_t earliestIn(Timer* list) const {
+    uint32_t earliest = UINT32_MAX;
+    for (Timer* t = list; t; t = t->next) earliest = min(earliest, t->expires - base);
+    return earliest;
+  }
+
+public:
+  void begin() {
+    for (uint8_t level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+      for (uint8_t slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) slots[level][slot] = NULL;
+      used[level] = 0;
+    }
+    count = 0;
+    base = millis();
+  }
+
+  /**
+   * Arma o timer para daqui a delayMs (limitado a TIMER_WHEEL_MAX_MS).
+   * Já armado: cancela e arma de novo.
+   */
+  void arm(Timer& t, uint32_t delayMs) {
+    if (t.armed()) cancel(t);
+    if (delayMs > TIMER_WHEEL_MAX_MS) delayMs = TIMER_WHEEL_MAX_MS;
+    t.expires = millis() + delayMs;
+    insert(t);
+    count++;
+  }
+
+  void cancel(Timer& t) {
+    if (!t.armed()) return;
+    unlink(t);
+    count--;
+  }
+
+  /**
+   * ms até o timer vencer (0 = vencido ou desarmado)
+   */
+  uint32_t remaining(const Timer& t) const {
+    if (!t.armed()) return 0;
+    uint32_t left = t.expires - millis();
+    return (int32_t)left < 0 ? 0 : left;
+  }
+
+  uint16_t armedCount() const { return count; }
+
+  /**
+   * Chama os callbacks vencidos até millis()
+   */
+  void poll() {
+    uint32_t now = millis();
+    if (count == 0) {                  // roda vazia: só acompanha o relógio
+      base = now + 1;
+      return;
+    }
+    while ((int32_t)(now - base) >= 0) step();
+  }
+
+  /**
+   * ms até o próximo vencimento (UINT32_MAX = nenhum armado)
+   */
+  uint32_t nextIn() {
+    if (count == 0) return UINT32_MAX;
+
+    // Nível 0: o slot já é o ms do vencimento
+    uint32_t earliest = UINT32_MAX;
+    uint8_t d = nextUsed(0, slotOf(base, 0));
+    if (d < TIMER_WHEEL_SLOTS) earliest = d;
+
+    // Níveis acima: o primeiro slot ocupado depois do atual tem os menores
+    // vencimentos do nível; o atual pode ter a volta seguinte ou a cascata
+    // que ainda não rodou, então entra também
+    for (uint8_t level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+      uint8_t current = slotOf(base, level);
+      d = nextUsed(level, current + 1);
+      if (d == TIMER_WHEEL_SLOTS) continue;
+      uint8_t slot = (current + 1 + d) & (TIMER_WHEEL_SLOTS - 1);
+      earliest = min(earliest, earliestIn(slots[level][slot]));
+      if (slot != current) earliest = min(earliest, earliestIn(slots[level][current]));
+    }
+
+    // earliest conta a partir de base, que pode estar atrás de millis()
+    int32_t left = (int32_t)(base + earliest - millis());
+    return left > 0 ? left : 0;
+  }
+};
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,269 @@
+/**
+ * Touch por interrupção com gestos (tap, toque longo, arraste)
+ *
+ * Caneta levantada: nenhuma leitura SPI. A task de entrada dorme sem
+ * timeout até o T_IRQ do XPT2046 (GPIO36) cair; daí amostra a cada
+ * TOUCH_SAMPLE_MS só enquanto houver toque, filtra (mediana de 3 + IIR) e
+ * classifica o gesto. Volta a dormir TOUCH_RELEASE_SAMPLES leituras depois
+ * que a caneta sai.
+ *
+ *   TouchService<TFT_eTouch<TFT_eSPI> > touchService(touch, TOUCH_IRQ);
+ *   for (;;) {                                     // task de entrada
+ *     ulTaskNotifyTake(pdTRUE, touchService.nextWait());
+ *     if (touchService.poll(event)) touchQueue.send(event);
+ *   }
+ *
+ * Gestos (um por toque, exceto o longo, que sai com a caneta ainda no painel):
+ *   TAP         soltou antes de TOUCH_LONG_PRESS_MS, andou até TOUCH_TAP_SLOP_PX
+ *   LONG_PRESS  parado (TOUCH_TAP_SLOP_PX) por TOUCH_LONG_PRESS_MS
+ *   SWIPE_*     andou TOUCH_SWIPE_MIN_PX em até TOUCH_SWIPE_MAX_MS (eixo dominante)
+ *
+ * Sem T_IRQ na placa: TOUCH_IDLE_POLL_MS > 0 volta a ler com a caneta
+ * levantada (e as leituras "ociosas" do relatório deixam de ser zero).
+ */
+
+#ifndef TOUCH_SERVICE_H
+#define TOUCH_SERVICE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Amostragem com a caneta no painel (100 Hz)
+#ifndef TOUCH_SAMPLE_MS
+  #define TOUCH_SAMPLE_MS 10
+#endif
+// Leituras seguidas sem toque = caneta levantada
+#ifndef TOUCH_RELEASE_SAMPLES
+  #define TOUCH_RELEASE_SAMPLES 3
+#endif
+// Leituras com toque para valer como gesto (ruído do painel)
+#ifndef TOUCH_MIN_SAMPLES
+  #define TOUCH_MIN_SAMPLES 2
+#endif
+// IIR: posição += (mediana - posição) >> TOUCH_IIR_SHIFT
+#ifndef TOUCH_IIR_SHIFT
+  #define TOUCH_IIR_SHIFT 1
+#endif
+#ifndef TOUCH_TAP_SLOP_PX
+  #define TOUCH_TAP_SLOP_PX 15
+#endif
+#ifndef TOUCH_LONG_PRESS_MS
+  #define TOUCH_LONG_PRESS_MS 800
+#endif
+#ifndef TOUCH_SWIPE_MIN_PX
+  #define TOUCH_SWIPE_MIN_PX 40
+#endif
+#ifndef TOUCH_SWIPE_MAX_MS
+  #define TOUCH_SWIPE_MAX_MS 1000
+#endif
+// 0 = só o T_IRQ acorda; > 0 = lê também a cada N ms sem toque
+#ifndef TOUCH_IDLE_POLL_MS
+  #define TOUCH_IDLE_POLL_MS 0
+#endif
+
+/**
+ * Gesto reconhecido (task de entrada → tela)
+ */
+struct TouchEvent {
+  enum Gesture : uint8_t { TAP, LONG_PRESS, SWIPE_LEFT, SWIPE_RIGHT, SWIPE_UP, SWIPE_DOWN };
+  Gesture gesture;
+  int16_t x;               // início do toque (filtrado)
+  int16_t y;
+  int16_t dx;              // deslocamento até soltar (SWIPE_*)
+  int16_t dy;
+  uint16_t durationMs;
+
+  const char* name() const {
+    static const char* const NAMES[] = { "tap", "toque longo", "arraste ←", "arraste →",
+                                         "arraste ↑", "arraste ↓" };
+    return gesture <= SWIPE_DOWN ? NAMES[gesture] : "?";
+  }
+};
+
+template <typename Touch>
+class TouchService {
+public:
+  struct Stats {
+    uint32_t wakes;        // T_IRQ (ou poll ocioso) que acordou a task
+    uint32_t presses;
+    uint32_t reads;        // leituras SPI do XPT2046
+    uint32_t idleReads;    // leituras acordada sem caneta (deve ser 0)
+    uint32_t taps;
+    uint32_t longPresses;
+    uint32_t swipes;
+    uint32_t ignored;      // curto demais ou arrastado sem ser arraste
+  };
+
+private:
+  Touch& touch;
+  uint8_t irqPin;
+  int16_t width;
+  int16_t height;
+
+  bool pressed = false;
+  bool longSent = false;
+  uint8_t misses = 0;
+  uint16_t samples = 0;
+  uint32_t pressStart = 0;
+  uint32_t lastSample = 0;
+  int16_t histX[3], histY[3];     // últimas leituras para a mediana
+  int32_t posX, posY;             // IIR, em 1/16 px
+  int16_t startX, startY;
+
+  volatile uint32_t wakes = 0, presses = 0, reads = 0, idleReads = 0;
+  volatile uint32_t taps = 0, longPresses = 0, swipes = 0, ignored = 0;
+
+  static int16_t median3(int16_t a, int16_t b, int16_t c) {
+    if (a > b) { int16_t t = a; a = b; b = t; }
+    if (b > c) b = c;
+    return a > b ? a : b;
+  }
+
+  int16_t x() const { return (posX + 8) >> 4; }
+  int16_t y() const { return (posY + 8) >> 4; }
+
+  // Uma leitura SPI; false = sem toque ou fora da tela
+  bool read(int16_t& rx, int16_t& ry) {
+    reads++;
+    if (!touch.getXY(rx, ry)) return false;
+    return rx >= 0 && ry >= 0 && rx < width && ry < height;
+  }
+
+  void filter(int16_t rx, int16_t ry) {
+    if (samples == 0) {
+      for (uint8_t i = 0; i < 3; i++) { histX[i] = rx; histY[i] = ry; }
+      posX = (int32_t)rx << 4;
+      posY = (int32_t)ry << 4;
+      startX = rx;
+      startY = ry;
+    } else {
+      histX[0] = histX[1]; histX[1] = histX[2]; histX[2] = rx;
+      histY[0] = histY[1]; histY[1] = histY[2]; histY[2] = ry;
+      posX += (((int32_t)median3(histX[0], histX[1], histX[2]) << 4) - posX) >> TOUCH_IIR_SHIFT;
+      posY += (((int32_t)median3(histY[0], histY[1], histY[2]) << 4) - posY) >> TOUCH_IIR_SHIFT;
+    }
+    samples++;
+  }
+
+  bool moved(int16_t slop) const {
+    return abs(x() - startX) > slop || abs(y() - startY) > slop;
+  }
+
+  void fill(TouchEvent& event, TouchEvent::Gesture gesture, uint32_t now) const {
+    event.gesture = gesture;
+    event.x = startX;
+    event.y = startY;
+    event.dx = x() - startX;
+    event.dy = y() - startY;
+    event.durationMs = (uint16_t)min<uint32_t>(now - pressStart, UINT16_MAX);
+  }
+
+  // Caneta levantada: classifica o toque inteiro
+  bool release(TouchEvent& event, uint32_t now) {
+    pressed = false;
+    // Bordas do T_IRQ causadas pelas próprias leituras: não acordam de novo
+    ulTaskNotifyTake(pdTRUE, 0);
+
+    if (longSent) return false;
+    if (samples < TOUCH_MIN_SAMPLES) {
+      ignored++;
+      return false;
+    }
+    int16_t dx = x() - startX, dy = y() - startY;
+    uint32_t held = now - pressStart;
+    if ((abs(dx) >= TOUCH_SWIPE_MIN_PX || abs(dy) >= TOUCH_SWIPE_MIN_PX) && held <= TOUCH_SWIPE_MAX_MS) {
+      TouchEvent::Gesture gesture;
+      if (abs(dx) >= abs(dy)) gesture = dx < 0 ? TouchEvent::SWIPE_LEFT : TouchEvent::SWIPE_RIGHT;
+      else gesture = dy < 0 ? TouchEvent::SWIPE_UP : TouchEvent::SWIPE_DOWN;
+      fill(event, gesture, now);
+      swipes++;
+      return true;
+    }
+    if (!moved(TOUCH_TAP_SLOP_PX)) {
+      fill(event, TouchEvent::TAP, now);
+      taps++;
+      return true;
+    }
+    ignored++;
+    return false;
+  }
+
+public:
+  /**
+   * irq: T_IRQ do XPT2046 (nível baixo com toque); a ISR da aplicação só
+   * acorda a task com vTaskNotifyGiveFromISR
+   */
+  TouchService(Touch& t, uint8_t irq, int16_t w = 320, int16_t h = 240)
+    : touch(t), irqPin(irq), width(w), height(h) {}
+
+  void setScreenSize(int16_t w, int16_t h) {
+    width = w;
+    height = h;
+  }
+
+  /**
+   * Espera do ulTaskNotifyTake: sem toque, só o T_IRQ acorda
+   * (portMAX_DELAY); com toque, até a próxima amostra
+   */
+  TickType_t nextWait() const {
+    if (pressed) {
+      uint32_t since = millis() - lastSample;
+      return since >= TOUCH_SAMPLE_MS ? 0 : pdMS_TO_TICKS(TOUCH_SAMPLE_MS - since);
+    }
+    // Toque que começou entre o release() e a espera (borda já consumida)
+    if (digitalRead(irqPin) == LOW) return pdMS_TO_TICKS(TOUCH_SAMPLE_MS);
+    return TOUCH_IDLE_POLL_MS > 0 ? pdMS_TO_TICKS(TOUCH_IDLE_POLL_MS) : portMAX_DELAY;
+  }
+
+  /**
+   * Uma passagem da task de entrada (depois de nextWait()). true = gesto
+   * em event
+   */
+  bool poll(TouchEvent& event) {
+    uint32_t now = millis();
+    int16_t rx, ry;
+
+    if (!pressed) {
+      wakes++;
+      if (!read(rx, ry)) {
+        idleReads++;
+        return false;
+      }
+      pressed = true;
+      longSent = false;
+      misses = 0;
+      samples = 0;
+      pressStart = lastSample = now;
+      presses++;
+      filter(rx, ry);
+      return false;
+    }
+
+    // Acordada pelo T_IRQ antes da hora: mantém o ritmo fixo
+    if (now - lastSample < TOUCH_SAMPLE_MS) return false;
+    lastSample = now;
+
+    if (!read(rx, ry)) {
+      if (++misses >= TOUCH_RELEASE_SAMPLES) return release(event, now);
+      return false;
+    }
+    misses = 0;
+    filter(rx, ry);
+
+    if (!longSent && now - pressStart >= TOUCH_LONG_PRESS_MS && !moved(TOUCH_TAP_SLOP_PX)) {
+      longSent = true;
+      fill(event, TouchEvent::LONG_PRESS, now);
+      longPresses++;
+      return true;
+    }
+    return false;
+  }
+
+  Stats getStats() const {
+    Stats stats = { wakes, presses, reads, idleReads, taps, longPresses, swipes, ignored };
+    return stats;
+  }
+};
+
+#endif // TOUCH_SERVICE_H
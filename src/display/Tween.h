@@ -0,0 +1,97 @@
+/**
+ * Interpolação por tempo com curvas de easing em ponto fixo
+ *
+ * O valor de um Tween depende só do instante (esp_timer_get_time()), não
+ * de quantos quadros foram desenhados: a animação tem a mesma duração e
+ * forma a 20 ou a 100 FPS, e um delay() no loop só faz pular quadros.
+ *
+ * Progresso e curvas em Q16 (65536 = 1.0), sem float.
+ */
+
+#ifndef TWEEN_H
+#define TWEEN_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#define TWEEN_ONE 65536
+
+enum TweenCurve : uint8_t {
+  EASE_LINEAR,
+  EASE_IN_QUAD,
+  EASE_OUT_QUAD,
+  EASE_IN_OUT_QUAD,
+  EASE_OUT_CUBIC
+};
+
+/**
+ * Aplica a curva a t em Q16 (0..TWEEN_ONE)
+ */
+inline uint32_t tweenEase(TweenCurve curve, uint32_t t) {
+  if (t >= TWEEN_ONE) return TWEEN_ONE;
+  uint32_t u = TWEEN_ONE - t;
+  switch (curve) {
+    case EASE_IN_QUAD:
+      return ((uint64_t)t * t) >> 16;
+    case EASE_OUT_QUAD:
+      return TWEEN_ONE - (uint32_t)(((uint64_t)u * u) >> 16);
+    case EASE_IN_OUT_QUAD:
+      if (t < TWEEN_ONE / 2) return ((uint64_t)t * t) >> 15;
+      return TWEEN_ONE - (uint32_t)(((uint64_t)u * u) >> 15);
+    case EASE_OUT_CUBIC:
+      return TWEEN_ONE - (uint32_t)(((((uint64_t)u * u) >> 16) * u) >> 16);
+    default:
+      return t;
+  }
+}
+
+/**
+ * Microssegundos desde o boot (relógio dos tweens)
+ */
+inline int64_t tweenNow() {
+  return esp_timer_get_time();
+}
+
+struct Tween {
+  int32_t from;
+  int32_t to;
+  int64_t startUs;
+  uint32_t durationUs;
+  TweenCurve curve;
+
+  /**
+   * Vai direto para value (sem animação)
+   */
+  void snap(int32_t value) {
+    from = to = value;
+    startUs = 0;
+    durationUs = 0;
+    curve = EASE_LINEAR;
+  }
+
+  /**
+   * Anima do valor atual até target. Alvo igual ao atual não reinicia a
+   * animação (pode ser chamado a cada quadro).
+   */
+  void retarget(int32_t target, int64_t now, uint32_t durationMs, TweenCurve easing) {
+    if (target == to) return;
+    from = value(now);
+    to = target;
+    startUs = now;
+    durationUs = durationMs * 1000UL;
+    curve = easing;
+  }
+
+  int32_t value(int64_t now) const {
+    if (durationUs == 0 || now - startUs >= (int64_t)durationUs) return to;
+    if (now <= startUs) return from;
+    uint32_t t = (uint32_t)(((uint64_t)(now - startUs) << 16) / durationUs);
+    return from + (int32_t)(((int64_t)(to - from) * tweenEase(curve, t)) >> 16);
+  }
+
+  bool done(int64_t now) const {
+    return durationUs == 0 || now - startUs >= (int64_t)durationUs;
+  }
+};
+
+#endif // TWEEN_H
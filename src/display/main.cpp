@@ -3,11 +3,17 @@
 #include "RoboEyesTFT_eSPI.h"
 #include <TFT_eTouch.h>
 #include <SPI.h>
-#include <Preferences.h>
 #include <nvs_flash.h>  // Para inicializar NVS
 #include <FS.h>
 #include <SD.h>
 
+// QR Code nativo (QrCode.h) por padrão; 1 = QR Code e telas do SquareLine
+// pelo LVGL (env display-cyd-lvgl)
+#ifndef USE_LVGL
+  #define USE_LVGL 0
+#endif
+
+#if USE_LVGL
 // LVGL para QR Code
 #include <lvgl.h>
 
@@ -15,24 +21,56 @@
 extern "C" {
   #include "ui/ui.h"
 }
-
-// Imagens (RGB888)
-#include "BauTesouro.h"
-#include "MoedaOuro.h"
-#include "TesouroJaPilhado.h"
+#endif
+
+// Imagens: registro único (partição assets + compiladas de assets/ por
+// scripts/build_assets.py), usado pelo TFT direto e pelo LVGL
+#include "AssetRegistry.h"
+#if USE_LVGL
+#include "LvglAssetDecoder.h"
+#include "LvglTask.h"
+#endif
+#include "FramePacer.h"
+#include "MemoryBudget.h"
+#include "SceneManager.h"
+#include "TimerWheel.h"
+#include "QrCache.h"
+#include "EventQueue.h"
+#include "TaskMonitor.h"
+#include "TouchService.h"
+
+// Mensagens com fonte suave (assets/fonts, acentos); 0 = fonte GLCD
+#ifndef USE_SMOOTH_TEXT
+  #define USE_SMOOTH_TEXT 1
+#endif
+#if USE_SMOOTH_TEXT
+#include "SmoothText.h"
+#include "generated/DejaVuSans20.h"
+#endif
+
+// Armazenamento de tags (backend escolhido em platformio.ini)
+#include "TagStoreFactory.h"
+#include "TagBackupSD.h"
+#include "TagSync.h"
 
 // Inclui protocolo compartilhado
 #include "../common/protocol.h"
 
 // ============================================
 // ESP32-2432S028R (CYD) - Display Controller
-// RoboEyes + QR Code LVGL
+// RoboEyes + QR Code
 // ============================================
 
 // Pinos UART (conectar ao Reader ESP32-WROOM)
 #define UART_RX_PIN  27  // GPIO27 (CN1 Pin 3) <- Reader TX (GPIO17)
 #define UART_TX_PIN  22  // GPIO22 (CN1 Pin 2) -> Reader RX (GPIO16)
 
+// Buffer de recepção da UART (padrão do core: 256 bytes); importações do
+// TagSync chegam em rajadas
+#ifndef UART_RX_BUFFER_SIZE
+  #define UART_RX_BUFFER_SIZE 4096
+#endif
+
 // Pinos SPI para SD Card
 #define SDSPI_CS    5
 #define SDSPI_CLK   18
@@ -58,57 +96,147 @@ TFT_eSPI tft = TFT_eSPI();
 SPIClass hSPI(HSPI);
 TFT_eTouch<TFT_eSPI> touch(tft, ETOUCH_CS, 0xFF, hSPI); 
 
+// Gestos do touch: lê só com a tela tocada (T_IRQ), task de entrada
+TouchService<TFT_eTouch<TFT_eSPI> > touchService(touch, TOUCH_IRQ);
+
 // RoboEyes (portrait mode: 240x320)
 TFT_RoboEyes roboEyes(tft, true, 1);
 
-// LVGL Display Buffer (serão alocados sob demanda)
+#if USE_SMOOTH_TEXT
+// Texto de showSimpleMessage() (DejaVu Sans 20 px)
+SmoothText smoothText(tft);
+#endif
+
+// Orçamento de memória por subsistema: cada modo mantém só o que desenha
+MemoryBudget memoryBudget;
+
+#if USE_LVGL
+// LVGL Display Buffer (alocados sob demanda, liberados ao sair do QR Code)
 static lv_disp_draw_buf_t draw_buf;
 static lv_color_t *buf1 = NULL;
 static lv_color_t *buf2 = NULL;
+static lv_obj_t *lvglHomeScreen = NULL;   // tela padrão (ativa sem o QR Code)
+#endif
 
-// Display Mode States
+// Display Mode States (uma cena do SceneManager por modo)
 enum DisplayMode {
   EYES_MODE,
   QRCODE_MODE,
   COIN_MODE,        // ⭐ NOVO: Moeda de ouro
-  LOOTED_MODE       // ⭐ NOVO: Tesouro já pilhado
+  LOOTED_MODE,      // ⭐ NOVO: Tesouro já pilhado
+  ADMIN_MODE,       // Mensagem da tag admin (contagem / lista zerada)
+  DISPLAY_MODE_COUNT
 };
 
-DisplayMode currentMode = EYES_MODE;
+// Cena atual e trocas agendadas (SceneManager.h): nada de delay() no loop
+typedef SceneManager<DisplayMode, DISPLAY_MODE_COUNT> Scenes;
+Scenes scenes;
+
+// Timeouts da tela (TimerWheel.h): um callback por timeout, sono exato
+TimerWheel timers;
+#if USE_LVGL
 bool lvglInitialized = false;
+#endif
 
 // UI State
-bool tagPresent = false;
 String currentUID = "";
 String currentURL = "";
 String currentText = "";
 ContentType currentType = CONTENT_RAW;
 
 // QR Code variables
+#if USE_LVGL
 lv_obj_t *qr_code = NULL;
 lv_obj_t *panel_qr = NULL;
 lv_obj_t *qr_screen = NULL;
-unsigned long qrCodeShowTime = 0;
+#else
+QrCache qrCache;       // matrizes codificadas em background (LRU por URL)
+QrCode qrCode;         // matriz do QR Code na tela
+#endif
 const unsigned long QR_CODE_TIMEOUT = 180000;  // 3 minutos em ms
 
 // ⭐ NOVO: Variáveis de controle do fluxo de verificação
 const unsigned long REWARD_TIMEOUT = 60000;      // 1 minuto para moeda/mensagem
 bool waitingForTagCheck = false;                 // Flag para verificação pendente
 String pendingTagUID = "";	                       // UID da tag sendo verificada
-unsigned long rewardShowTime = 0;                // Tempo de início da recompensa
 
-// ⭐ NOVO: Preferences para armazenamento persistente
-Preferences prefs;
-const char* PREFS_NAMESPACE = "rfid_tags";
-const char* PREFS_COUNT_KEY = "count";
-const char* PREFS_TAG_PREFIX = "tag_";
+// Armazenamento persistente de tags (NVS, SPIFFS, LittleFS ou RAM)
+TagStoreBackend tagStore;
+
+// Backup incremental no SD Card (task em background)
+TagBackupSD tagBackup;
+bool showingBackupStatus = false;               // Linha "Backup: xx%" visível
+TagBackupSD::Progress lastBackupProgress = { TagBackupSD::BACKUP_IDLE, 0, 0 };
+
+// Exportação/importação binária de tags (CMD|EXPORT, CMD|IMPORT)
+TagSync tagSync;
+
+// Imagens (partição assets, com fallback para as compiladas)
+AssetRegistry assetRegistry;
+
+#if USE_LVGL
+// Task do LVGL (lv_timer_handler fora do loop, mutex para objetos lv_*)
+LvglTask lvglTask;
+#endif
+
+// Ritmo da task render: dorme até o próximo quadro/timeout ou até chegar evento
+FramePacer pacer;
+
+// Sono máximo por passagem da task da tela (linha do backup na cena admin)
+#ifndef PACER_MAX_SLEEP_MS
+  #define PACER_MAX_SLEEP_MS 100
+#endif
+
+// Tasks da tela (seção TASKS DA TELA): UART → armazenamento → tela, toque → tela
+enum DisplayTaskId {
+  TASK_RENDER,      // cenas, olhos, TFT (núcleo 1)
+  TASK_INGEST,      // UART do Reader, USB, TagSync
+  TASK_STORAGE,     // TagStore, backup no SD, relatório de tasks
+  TASK_INPUT,       // touch (XPT2046)
+  DISPLAY_TASK_COUNT
+};
+TaskMonitor taskMonitor;
+
+// URL/texto levado por um TagEvent (maior: sem QR Code, com aviso no log)
+#ifndef TAG_EVENT_TEXT_MAX
+  #define TAG_EVENT_TEXT_MAX 256
+#endif
+#ifndef TAG_QUEUE_DEPTH
+  #define TAG_QUEUE_DEPTH 4
+#endif
+#ifndef TOUCH_QUEUE_DEPTH
+  #define TOUCH_QUEUE_DEPTH 4
+#endif
+// Espera da UART por vaga na fila de tags (armazenamento ocupado listando/limpando)
+#ifndef TAG_QUEUE_WAIT_MS
+  #define TAG_QUEUE_WAIT_MS 200
+#endif
+
+/**
+ * Tag lida: ingest → armazenamento (TAG_READ), armazenamento → tela
+ * (veredito). Tamanho fixo, copiada pela fila.
+ */
+struct TagEvent {
+  enum Kind : uint8_t { TAG_READ, TAG_NEW, TAG_REPEATED, TAG_ADMIN };
+  Kind kind;
+  uint8_t type;                      // ContentType
+  bool react;                        // TAG_ADMIN: olhos reagem antes da mensagem
+  bool backupLine;                   // TAG_ADMIN: linha 2 mostra o progresso do backup
+  char uid[24];                      // hex, até 10 bytes
+  char text[TAG_EVENT_TEXT_MAX];     // URL ou texto; TAG_ADMIN: 4 linhas separadas por '\n'
+};
+
+EventQueue<TagEvent, TAG_QUEUE_DEPTH> tagQueue;        // ingest → armazenamento
+EventQueue<TagEvent, TAG_QUEUE_DEPTH> sceneQueue;      // armazenamento → tela
+EventQueue<TouchEvent, TOUCH_QUEUE_DEPTH> touchQueue;  // entrada → tela (gestos)
+volatile bool taskReportRequested = false;             // CMD|TASKS
 
 // ⭐ NOVO: Tag especial para admin/debug
 const String ADMIN_TAG_UID = "0431430F320289";
 int consecutiveAdminReads = 0;
 String lastReadUID = "";
-bool showingResetMessage = false;
-unsigned long adminMessageShowTime = 0;         // Tempo de início da mensagem de admin
+String adminLines[4];                           // Mensagem da cena ADMIN_MODE
+bool adminBackupLine = false;                   // Linha 2 mostra o progresso do backup
 const unsigned long ADMIN_MESSAGE_TIMEOUT = 30000; // 30 segundos para mensagem de admin
 
 // Mood change variables
@@ -116,32 +244,189 @@ unsigned long lastMoodChange = 0;
 const unsigned long MOOD_CHANGE_INTERVAL = 30000;  // 1 minuto
 const uint8_t MOODS[] = {0, TIRED, ANGRY, HAPPY};  // 0 = DEFAULT
 const int NUM_MOODS = 4;
+const unsigned long CONFUSED_MOOD_DELAY = 800;     // Duração da animação confused
 
-// Touch variables
-bool touchEnabled = false;
-unsigned long lastTouchTime = 0;
-const unsigned long TOUCH_DEBOUNCE = 300;  // 300ms debounce
-bool touchProcessing = false;  // Flag para evitar múltiplas leituras
+// Olhos reagem (laugh/confused) antes da moeda, do tesouro ou da mensagem
+const unsigned long EYES_REACTION_TIME = 500;
 
 
 // ============================================
 // FUNÇÕES LVGL - Display Driver
 // ============================================
 
+// DMA do TFT disponível (imageBlitterBegin() no setup)
+bool tftDMA = false;
+
+#if USE_LVGL
+
+// Linhas por faixa do LVGL (2 buffers DMA de TFT_WIDTH x LVGL_BUF_LINES).
+// Escolher pelo log "🖼️ LVGL" (ver ROBOEYES_INTEGRATION.md)
+#ifndef LVGL_BUF_LINES
+  #define LVGL_BUF_LINES 40
+#endif
+
+// Log de tempos do flush a cada refresh do LVGL (0 = desligado)
+#ifndef LVGL_FLUSH_STATS
+  #define LVGL_FLUSH_STATS 1
+#endif
+
+// Heap do LVGL (LV_MEM_CUSTOM no lv_conf.h): objetos lv_* contados na
+// concessão MEM_LVGL_HEAP e devolvidos ao sistema quando a tela é apagada.
+// Sem limite imposto: o LVGL para em assert se uma alocação falhar
+extern "C" void* lvgl_lease_alloc(size_t size) {
+  return memoryBudget.alloc(MEM_LVGL_HEAP, size, false);
+}
+
+extern "C" void lvgl_lease_free(void* ptr) {
+  memoryBudget.free(ptr);
+}
+
+extern "C" void* lvgl_lease_realloc(void* ptr, size_t size) {
+  return memoryBudget.realloc(MEM_LVGL_HEAP, ptr, size);
+}
+
+// Transação SPI aberta pelo flush (só dentro de um refresh da task LVGL)
+bool lvglFlushOpen = false;
+
+/**
+ * Tempos do flush no refresh atual (zerados pelo monitor_cb)
+ */
+struct LvglFlushStats {
+  uint16_t bands;
+  uint32_t pixels;
+  uint32_t renderMicros;   // LVGL desenhando entre o fim de um flush e o próximo
+  uint32_t waitMicros;     // flush parado esperando a faixa anterior sair
+  uint32_t lastReturn;     // micros() no fim do último flush
+};
+LvglFlushStats lvglFlushStats = { 0, 0, 0, 0, 0 };
+
 /**
  * Callback para flush do display
+ *
+ * Com DMA a faixa é só enfileirada: pushImageDMA() espera a faixa anterior
+ * terminar antes de começar esta, então ao retornar o outro buffer está
+ * livre e o LVGL já desenha nele enquanto esta sai pelo SPI.
+ *
+ * A transação abre na primeira faixa e fecha na última do refresh, ainda na
+ * task do LVGL: o mutex do SPI é liberado pela mesma task que o pegou, e
+ * depois de lv_timer_handler() (logo, depois de pause()) o barramento está
+ * livre.
  */
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
+  uint32_t start = micros();
+  if (lvglFlushStats.bands > 0) {
+    lvglFlushStats.renderMicros += start - lvglFlushStats.lastReturn;
+  }
   
-  tft.startWrite();
-  tft.setAddrWindow(area->x1, area->y1, w, h);
-  tft.pushColors((uint16_t*)&color_p->full, w * h, false);
-  tft.endWrite();
+  if (tftDMA) {
+    if (!lvglFlushOpen) {
+      tft.startWrite();
+      lvglFlushOpen = true;
+    }
+    // Buffers já na ordem de bytes do ILI9341 (LV_COLOR_16_SWAP)
+    bool swap = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+    tft.pushImageDMA(area->x1, area->y1, w, h, (uint16_t*)&color_p->full);
+    tft.setSwapBytes(swap);
+    if (lv_disp_flush_is_last(disp)) {
+      tft.dmaWait();
+      tft.endWrite();
+      lvglFlushOpen = false;
+    }
+  } else {
+    tft.startWrite();
+    tft.setAddrWindow(area->x1, area->y1, w, h);
+    tft.pushColors((uint16_t*)&color_p->full, w * h, false);
+    tft.endWrite();
+  }
   
+  lvglFlushStats.waitMicros += micros() - start;
+  lvglFlushStats.bands++;
+  lvglFlushStats.pixels += w * h;
+  lvglFlushStats.lastReturn = micros();
   lv_disp_flush_ready(disp);
 }
+
+/**
+ * Fim de um refresh do LVGL: loga os tempos das faixas
+ *
+ * Espera do DMA perto de zero: o envio fica escondido atrás do desenho
+ * (faixas menores liberam RAM sem perder nada). Espera alta: o SPI é o
+ * gargalo e faixas maiores não ajudam.
+ */
+void lvglMonitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+#if LVGL_FLUSH_STATS
+  LvglFlushStats& st = lvglFlushStats;
+  if (st.bands > 0) {
+    uint32_t sendMicros = (uint32_t)((uint64_t)st.pixels * 16 * 1000000ULL / SPI_FREQUENCY);
+    Serial.printf("🖼️ LVGL: refresh %lu ms, %u faixas de até %d linhas, desenho %lu µs/faixa, "
+                  "espera do DMA %lu µs/faixa, envio ~%lu µs/faixa\n",
+                  (unsigned long)time, st.bands, LVGL_BUF_LINES,
+                  (unsigned long)(st.bands > 1 ? st.renderMicros / (st.bands - 1) : 0),
+                  (unsigned long)(st.waitMicros / st.bands),
+                  (unsigned long)(sendMicros / st.bands));
+  }
+#endif
+  lvglFlushStats = { 0, 0, 0, 0, 0 };
+}
+
+/**
+ * Aloca os buffers de desenho na concessão MEM_LVGL_BUFFERS (chamar com o
+ * mutex do LVGL se a task já existe)
+ */
+bool lvglBuffersAlloc() {
+  size_t bufferSize = TFT_WIDTH * LVGL_BUF_LINES * sizeof(lv_color_t);
+  
+  if (buf1 == NULL) buf1 = (lv_color_t*)memoryBudget.alloc(MEM_LVGL_BUFFERS, bufferSize);
+  if (buf2 == NULL) buf2 = (lv_color_t*)memoryBudget.alloc(MEM_LVGL_BUFFERS, bufferSize);
+  if (buf1 == NULL || buf2 == NULL) {
+    Serial.printf("❌ ERRO: Falha ao alocar buffers do LVGL (2 x %d bytes)!\n", bufferSize);
+    Serial.printf("  └─ Heap livre: %d bytes, maior bloco DMA: %d bytes\n", ESP.getFreeHeap(),
+                  heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+    memoryBudget.free(buf1);
+    memoryBudget.free(buf2);
+    buf1 = buf2 = NULL;
+    return false;
+  }
+  Serial.printf("  ├─ buf1 alocado em: %p\n", buf1);
+  Serial.printf("  ├─ buf2 alocado em: %p\n", buf2);
+  
+  // Buffer duplo: o LVGL desenha em um enquanto o outro sai por DMA
+  lv_disp_draw_buf_init(&draw_buf, buf1, buf2, TFT_WIDTH * LVGL_BUF_LINES);
+  return true;
+}
+
+/**
+ * Desmonta o LVGL ao sair do QR Code: apaga a tela do QR, esvazia os caches
+ * e libera os buffers de desenho. O núcleo (display, timers, tema) continua
+ * registrado; initializeLVGLIfNeeded() realoca o resto.
+ */
+void releaseLVGL() {
+  if (!lvglInitialized || buf1 == NULL) return;
+  
+  uint32_t before = ESP.getFreeHeap();
+  lvglTask.pause();
+  {
+    LvglLock lock(lvglTask);
+    lv_scr_load(lvglHomeScreen);
+    if (qr_screen != NULL) {
+      lv_obj_del(qr_screen);
+      qr_screen = NULL;
+      panel_qr = NULL;
+      qr_code = NULL;
+    }
+    lv_img_cache_invalidate_src(NULL);
+    lv_mem_buf_free_all();
+    memoryBudget.free(buf1);
+    memoryBudget.free(buf2);
+    buf1 = buf2 = NULL;
+  }
+  Serial.printf("♻️ LVGL desmontado: +%lu bytes de heap\n",
+                (unsigned long)(ESP.getFreeHeap() - before));
+}
+
 /**
  * Inicializa LVGL
  */
@@ -152,36 +437,16 @@ void initLVGL() {
   
   lv_init();
   
-  // Calcula tamanho do buffer (largura * linhas)
-  size_t bufferLines = 20;
+  // Calcula tamanho do buffer (largura * linhas). 40 linhas cabem com o
+  // sprite dos olhos em 1 bpp (~7 KB em vez de 55 KB)
+  size_t bufferLines = LVGL_BUF_LINES;
   size_t bufferSize = TFT_WIDTH * bufferLines * sizeof(lv_color_t);
   
   Serial.printf("  ├─ Alocando buffers: %d x %d linhas = %d pixels (%d bytes)\n", 
                 TFT_WIDTH, bufferLines, TFT_WIDTH * bufferLines, bufferSize);
   
-  // Aloca buffers dinamicamente
-  if (buf1 == NULL) {
-    buf1 = (lv_color_t*)heap_caps_malloc(bufferSize, MALLOC_CAP_DMA);
-    if (buf1 == NULL) {
-      Serial.printf("❌ ERRO: Falha ao alocar buf1 (%d bytes)!\n", bufferSize);
-      Serial.printf("  └─ Heap livre: %d bytes\n", ESP.getFreeHeap());
-      return;
-    }
-    Serial.printf("  ├─ buf1 alocado em: %p\n", buf1);
-  }
-  
-  if (buf2 == NULL) {
-    buf2 = (lv_color_t*)heap_caps_malloc(bufferSize, MALLOC_CAP_DMA);
-    if (buf2 == NULL) {
-      Serial.printf("❌ ERRO: Falha ao alocar buf2 (%d bytes)!\n", bufferSize);
-      Serial.printf("  └─ Heap livre: %d bytes\n", ESP.getFreeHeap());
-      return;
-    }
-    Serial.printf("  ├─ buf2 alocado em: %p\n", buf2);
-  }
-  
-  // Configura buffer duplo para melhor performance
-  lv_disp_draw_buf_init(&draw_buf, buf1, buf2, TFT_WIDTH * bufferLines);
+  // Aloca buffers dinamicamente (concessão MEM_LVGL_BUFFERS)
+  if (!lvglBuffersAlloc()) return;
   Serial.printf("  ├─ draw_buf inicializado: %d pixels\n", TFT_WIDTH * bufferLines);
   
   // Registra driver do display
@@ -189,17 +454,99 @@ void initLVGL() {
   lv_disp_drv_init(&disp_drv);
   disp_drv.draw_buf = &draw_buf;
   disp_drv.flush_cb = my_disp_flush;
+  disp_drv.monitor_cb = lvglMonitor;
   disp_drv.hor_res = TFT_WIDTH;
   disp_drv.ver_res = TFT_HEIGHT;
   lv_disp_drv_register(&disp_drv);
+  lvglHomeScreen = lv_scr_act();
+  
+  // lv_img com ui_asset_img("...") lê do mesmo registro do TFT direto
+  lvglAssetDecoderInit(assetRegistry);
   
   Serial.printf("  ├─ Display driver: %dx%d\n", disp_drv.hor_res, disp_drv.ver_res);
+  
+  // lv_timer_handler() na própria task (começa pausada: modo QR chama resume())
+  if (!lvglTask.begin()) {
+    Serial.println("❌ ERRO: Falha ao criar a task do LVGL!");
+    return;
+  }
   Serial.printf("  └─ Heap livre após LVGL: %d bytes\n", ESP.getFreeHeap());
   Serial.println("✅ LVGL inicializado com sucesso!\n");
   
   lvglInitialized = true;
 }
 
+#endif // USE_LVGL
+
+// ============================================
+// MEMÓRIA E DMA DO DISPLAY
+// ============================================
+
+/**
+ * Termina os envios por DMA em andamento (olhos e LVGL). Chamar antes de
+ * desenhar com o tft fora do RoboEyes/LVGL.
+ */
+void finishDisplayDMA() {
+  roboEyes.finishPush();
+#if USE_LVGL
+  lvglTask.pause();   // espera o render em andamento (que fecha o SPI); LVGL para de desenhar
+#endif
+}
+
+/**
+ * Olhos fora da tela: sprite e faixas DMA voltam para o heap
+ */
+void releaseEyes() {
+  if (!roboEyes.canvasReady()) return;
+  roboEyes.releaseCanvas();
+  memoryBudget.set(MEM_EYES, roboEyes.bufferBytes());
+}
+
+void restoreEyes() {
+  if (!roboEyes.canvasReady() && !roboEyes.restoreCanvas()) {
+    Serial.printf("❌ ERRO: Sem heap para o sprite dos olhos (%lu bytes)!\n",
+                  (unsigned long)roboEyes.spriteBytes());
+  }
+  memoryBudget.set(MEM_EYES, roboEyes.bufferBytes());
+}
+
+/**
+ * Cada modo mantém só os subsistemas que desenha: olhos no EYES_MODE, LVGL
+ * no QRCODE_MODE (construído por initializeLVGLIfNeeded())
+ */
+void applyMemoryPlan(DisplayMode mode) {
+#if USE_LVGL
+  if (mode != QRCODE_MODE) releaseLVGL();
+#endif
+  if (mode == EYES_MODE) {
+    restoreEyes();
+  } else {
+    releaseEyes();
+  }
+}
+
+/**
+ * Relatório das concessões (CMD|MEM e fim do setup)
+ */
+void reportMemory() {
+  memoryBudget.set(MEM_STORAGE, tagBackup.bufferBytes() + tagStore.memoryBytes());
+  memoryBudget.report(Serial);
+  Serial.printf("   filas de eventos: %u B fixos (pilhas das tasks: CMD|TASKS)\n",
+                tagQueue.memoryBytes() + sceneQueue.memoryBytes() + touchQueue.memoryBytes());
+#if !USE_LVGL
+  QrCache::Stats qrStats = qrCache.getStats();
+  Serial.printf("   qr cache: %u B fixos, %lu prontos / %lu esperados, %lu codificados\n",
+                qrCache.memoryBytes(), (unsigned long)qrStats.hits,
+                (unsigned long)qrStats.misses, (unsigned long)qrStats.encodes);
+#endif
+#if USE_SMOOTH_TEXT
+  SmoothText::Stats textStats = smoothText.getStats();
+  Serial.printf("   texto: %u B fixos (cache de glifos + faixa), glifos %lu do cache / %lu da flash\n",
+                SmoothText::memoryBytes(), (unsigned long)textStats.hits,
+                (unsigned long)(textStats.misses + textStats.uncached));
+#endif
+}
+
 // ============================================
 // UI TEMPORÁRIA (COMENTADA - Usando SquareLine)
 // ============================================
@@ -250,114 +597,66 @@ void createTemporaryUI() {
 */
 
 // ============================================
-// DESENHO DO BAÚ DE TESOURO - TFT DIRETO
+// IMAGENS DE RECOMPENSA - TFT DIRETO
 // ============================================
 
 /**
- * Exibe imagem do baú de tesouro diretamente com TFT_eSPI
+ * Desenha uma imagem de recompensa centralizada (yShift desloca na vertical)
+ * symbol é o nome no assets.json (ver AssetRegistry.h)
+ * Usa o blitter de ImageAsset.h: faixas por DMA com buffer duplo
  */
-void drawTreasureChest() {
-  Serial.println("🎨 Desenhando baú de tesouro (RGB888->RGB565)...");
-  
-  // CRÍTICO: Garante swap correto para RGB565
-  tft.setSwapBytes(true);
-  
-  // Calcula posição centralizada
-  int16_t x_offset = (tft.width() - BAUTESOURO_WIDTH) / 2;
-  int16_t y_offset = (tft.height() - BAUTESOURO_HEIGHT) / 2;
-  
-  // Buffer para uma linha de pixels em RGB565
-  uint16_t* lineBuffer = (uint16_t*)malloc(BAUTESOURO_WIDTH * sizeof(uint16_t));
-  if (lineBuffer == NULL) {
-    Serial.println("❌ Erro ao alocar buffer para linha!");
+void drawRewardImage(const char* symbol, int16_t yShift, const char* name) {
+  ImageAsset asset;
+  bool fromBundle;
+  if (!assetRegistry.find(symbol, asset, &fromBundle)) {
+    Serial.printf("❌ Imagem %s não encontrada (partição assets nem firmware)\n", symbol);
     return;
   }
-  
-  // Desenha linha por linha
-  for (int y = 0; y < BAUTESOURO_HEIGHT; y++) {
-    // Converte linha de RGB888 para RGB565
-    for (int x = 0; x < BAUTESOURO_WIDTH; x++) {
-      int pixelIndex = y * BAUTESOURO_WIDTH + x;
-      
-      // Lê valor RGB888 de 32-bit (0x00RRGGBB) da PROGMEM
-      uint32_t rgb888 = pgm_read_dword(&BauTesouro[pixelIndex]);
-      
-      // Extrai componentes RGB
-      uint8_t r = (rgb888 >> 16) & 0xFF;
-      uint8_t g = (rgb888 >> 8) & 0xFF;
-      uint8_t b = rgb888 & 0xFF;
-      
-      // Converte para RGB565
-      lineBuffer[x] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-    }
-    
-    // Envia linha para o display
-    tft.pushImage(x_offset, y_offset + y, BAUTESOURO_WIDTH, 1, lineBuffer);
-  }
-  
-  free(lineBuffer);
-  Serial.println("✅ Baú desenhado com sucesso!");
+
+  int16_t x_offset = (tft.width() - asset.width) / 2;
+  int16_t y_offset = ((tft.height() - asset.height) / 2) + yShift;
+
+  ImageDrawStats stats;
+  drawImageAsset(tft, asset, x_offset, y_offset, &stats);
+  Serial.printf("🎨 %s desenhado (%lu us, decodificação %lu us, %s, %s)\n", name,
+                (unsigned long)stats.totalMicros, (unsigned long)stats.decodeMicros,
+                stats.dma ? "DMA" : "bloqueante", fromBundle ? "partição" : "firmware");
 }
 
 // ============================================
-// SISTEMA DE ARMAZENAMENTO NVS (PREFERENCES)
+// SISTEMA DE ARMAZENAMENTO (TAGSTORE)
 // ============================================
 
 /**
- * Verifica se uma tag já foi lida anteriormente
+ * Registra a leitura de uma tag (primeira/última leitura e toques)
+ * Retorna true se a tag é nova
  */
-bool isTagAlreadyRead(String uid) {
-  prefs.begin(PREFS_NAMESPACE, true); // read-only
-  int count = prefs.getInt(PREFS_COUNT_KEY, 0);
-  
-  for (int i = 0; i < count; i++) {
-    String key = String(PREFS_TAG_PREFIX) + String(i);
-    String storedUID = prefs.getString(key.c_str(), "");
-    if (storedUID == uid) {
-      prefs.end();
-      return true; // Tag já existe
-    }
+bool registerTagVisit(String uid) {
+  TagRecord record;
+  bool isNew = tagStore.recordVisit(uid, &record);
+  if (isNew) {
+    Serial.printf("✅ Tag salva! Total de tags lidas: %lu\n", (unsigned long)tagStore.count());
+  } else {
+    Serial.printf("  ├─ Toques: %u (primeira leitura: %lus)\n",
+                  (unsigned)record.taps, (unsigned long)record.firstSeen);
   }
-  
-  prefs.end();
-  return false; // Tag nova
-}
-
-/**
- * Salva uma tag como lida
- */
-void saveTagAsRead(String uid) {
-  prefs.begin(PREFS_NAMESPACE, false); // read-write
-  
-  int count = prefs.getInt(PREFS_COUNT_KEY, 0);
-  String key = String(PREFS_TAG_PREFIX) + String(count);
-  
-  prefs.putString(key.c_str(), uid);
-  prefs.putInt(PREFS_COUNT_KEY, count + 1);
-  
-  prefs.end();
-  
-  Serial.printf("✅ Tag salva! Total de tags lidas: %d\n", count + 1);
+  return isNew;
 }
 
 /**
  * Retorna quantidade de tags lidas
  */
 int getReadTagsCount() {
-  prefs.begin(PREFS_NAMESPACE, true);
-  int count = prefs.getInt(PREFS_COUNT_KEY, 0);
-  prefs.end();
-  return count;
+  return tagStore.count();
 }
 
 /**
  * Limpa todas as tags armazenadas (opcional, para debug)
  */
 void clearAllTags() {
-  prefs.begin(PREFS_NAMESPACE, false);
-  prefs.clear();
-  prefs.end();
-  Serial.println("⚠️ Todas as tags foram apagadas!");
+  unsigned long start = micros();
+  tagStore.clear();
+  Serial.printf("⚠️ Todas as tags foram apagadas! (%lu us)\n", micros() - start);
 }
 
 /**
@@ -366,224 +665,115 @@ void clearAllTags() {
 void listAllTags() {
   Serial.println("\n📊 ========== LISTA DE TAGS LIDAS ===========");
   
-  prefs.begin(PREFS_NAMESPACE, true); // read-only
-  int count = prefs.getInt(PREFS_COUNT_KEY, 0);
+  uint32_t count = tagStore.count();
   
-  Serial.printf("📊 Total de tags armazenadas: %d\n\n", count);
+  Serial.printf("📊 Total de tags armazenadas: %lu\n\n", (unsigned long)count);
   
   if (count == 0) {
     Serial.println("⚠️ Nenhuma tag armazenada ainda.");
   } else {
-    Serial.println("├───┬──────────────────────────");
-    Serial.println("│ # │ UID                  │");
-    Serial.println("├───┼──────────────────────────");
+    Serial.println("├─────┬──────────────────────┬───────┬──────────┬──────────");
+    Serial.println("│   # │ UID                  │ Toques│ Primeira │ Última");
+    Serial.println("├─────┼──────────────────────┼───────┼──────────┼──────────");
     
-    for (int i = 0; i < count; i++) {
-      String key = String(PREFS_TAG_PREFIX) + String(i);
-      String uid = prefs.getString(key.c_str(), "N/A");
-      Serial.printf("│%3d│ %-20s│\n", i+1, uid.c_str());
-    }
+    tagStore.iterate([](uint32_t i, const TagRecord& record) {
+      Serial.printf("│%5lu│ %-20s │ %6u│ %8lus│ %8lus\n",
+                    (unsigned long)(i + 1), record.uidHex().c_str(), (unsigned)record.taps,
+                    (unsigned long)record.firstSeen, (unsigned long)record.lastSeen);
+      return true;
+    });
     
-    Serial.println("└───┴──────────────────────────");
+    Serial.println("└─────┴──────────────────────┴───────┴──────────┴──────────");
   }
   
-  prefs.end();
+  tagStore.printStats();
   Serial.println("📊 =========================================\n");
 }
 
 /**
- * Faz backup das tags para arquivo no SD Card
- * Retorna true se sucesso, false se falha
+ * Agenda backup incremental das tags no SD Card (task em background)
+ * Retorna true se o backup foi enfileirado, false se indisponível
  */
 bool backupTagsToSD() {
-  Serial.println("\n💾 Iniciando backup de tags para SD Card...");
-  
-  // Inicializa SD Card se não estiver inicializado
-  if (!SD.begin(SDSPI_CS, hSPI)) {
-    Serial.println("❌ Erro: SD Card não detectado!");
-    return false;
-  }
-  
-  // Lê tags da NVS
-  prefs.begin(PREFS_NAMESPACE, true);
-  int count = prefs.getInt(PREFS_COUNT_KEY, 0);
-  
-  if (count == 0) {
-    Serial.println("⚠️ Nenhuma tag para fazer backup.");
-    prefs.end();
-    return false;
-  }
-  
-  // Cria nome de arquivo com timestamp
-  String filename = "/rfid_backup_" + String(millis()) + ".txt";
-  
-  File file = SD.open(filename.c_str(), FILE_WRITE);
-  if (!file) {
-    Serial.println("❌ Erro ao criar arquivo de backup!");
-    prefs.end();
-    return false;
-  }
-  
-  // Escreve header
-  file.println("========================================");
-  file.println("RFID TAGS BACKUP");
-  file.println("Sistema: ESP32 RFID Reader Display CYD");
-  file.printf("Data: %lu ms\n", millis());
-  file.printf("Total de tags: %d\n", count);
-  file.println("========================================\n");
-  
-  // Escreve cada tag
-  for (int i = 0; i < count; i++) {
-    String key = String(PREFS_TAG_PREFIX) + String(i);
-    String uid = prefs.getString(key.c_str(), "N/A");
-    file.printf("%d,%s\n", i+1, uid.c_str());
-  }
-  
-  file.println("\n========================================");
-  file.println("FIM DO BACKUP");
-  file.println("========================================");
-  
-  file.close();
-  prefs.end();
-  
-  Serial.printf("✅ Backup criado com sucesso!\n");
-  Serial.printf("📁 Arquivo: %s\n", filename.c_str());
-  Serial.printf("📊 %d tags salvas\n\n", count);
-  
-  return true;
+  Serial.println("\n💾 Agendando backup de tags para SD Card...");
+  return tagBackup.requestBackup();
 }
 
-/**
- * Exibe mensagem simples na tela (sem imagens)
- */
-void showSimpleMessage(const char* line1, const char* line2 = nullptr, 
-                       const char* line3 = nullptr, const char* line4 = nullptr) {
-  tft.fillScreen(TFT_BLACK);
-  tft.setTextColor(TFT_WHITE, TFT_BLACK);
-  tft.setTextSize(2);
-  tft.setTextDatum(MC_DATUM);
-  
-  int y = 80;
-  int lineSpacing = 30;
-  
-  if (line1) tft.drawString(line1, tft.width()/2, y);
-  if (line2) tft.drawString(line2, tft.width()/2, y + lineSpacing);
-  if (line3) tft.drawString(line3, tft.width()/2, y + lineSpacing*2);
-  if (line4) tft.drawString(line4, tft.width()/2, y + lineSpacing*3);
-}
+// Linhas de showSimpleMessage(): centro da primeira e espaçamento
+const int MESSAGE_FIRST_Y = 80;
+const int MESSAGE_LINE_SPACING = 30;
 
-// ============================================
-// DESENHO DA MOEDA DE OURO
-// ============================================
+#if USE_SMOOTH_TEXT
+TextBox messageBoxes[4];   // Caixa de cada linha na tela (troca só ela)
+#endif
 
 /**
- * Exibe imagem da moeda de ouro diretamente com TFT_eSPI
+ * Desenha a linha index (0 a 3) de showSimpleMessage(), centrada, no
+ * lugar do texto anterior da mesma linha
  */
-void drawGoldenCoin() {
-  Serial.println("🪙 Desenhando moeda de ouro (RGB888->RGB565)...");
-  
-  tft.setSwapBytes(true);
-  
-  // Calcula posição centralizada
-  int16_t x_offset = (tft.width() - MOEDAOURO_WIDTH) / 2;
-  int16_t y_offset = ((tft.height() - MOEDAOURO_HEIGHT) / 2) - 15;
-  
-  // Buffer para uma linha de pixels em RGB565
-  uint16_t* lineBuffer = (uint16_t*)malloc(MOEDAOURO_WIDTH * sizeof(uint16_t));
-  if (lineBuffer == NULL) {
-    Serial.println("❌ Erro ao alocar buffer para linha!");
+void drawMessageLine(uint8_t index, const char* text) {
+  int y = MESSAGE_FIRST_Y + MESSAGE_LINE_SPACING * index;
+#if USE_SMOOTH_TEXT
+  if (smoothText.ready()) {
+    messageBoxes[index] = smoothText.drawCentered(text, tft.width()/2, y, TFT_WHITE, TFT_BLACK,
+                                                  &messageBoxes[index]);
     return;
   }
-  
-  // Desenha linha por linha
-  for (int y = 0; y < MOEDAOURO_HEIGHT; y++) {
-    for (int x = 0; x < MOEDAOURO_WIDTH; x++) {
-      int pixelIndex = y * MOEDAOURO_WIDTH + x;
-      uint32_t rgb888 = pgm_read_dword(&MoedaOuro[pixelIndex]);
-      
-      uint8_t r = (rgb888 >> 16) & 0xFF;
-      uint8_t g = (rgb888 >> 8) & 0xFF;
-      uint8_t b = rgb888 & 0xFF;
-      
-      lineBuffer[x] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-    }
-    
-    tft.pushImage(x_offset, y_offset + y, MOEDAOURO_WIDTH, 1, lineBuffer);
-  }
-  
-  free(lineBuffer);
-  Serial.println("✅ Moeda de ouro desenhada com sucesso!");
+#endif
+  // Fonte GLCD (sem acentos): o padding apaga o texto anterior
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setTextSize(2);
+  tft.setTextDatum(MC_DATUM);
+  tft.setTextPadding(tft.width());
+  tft.drawString(text, tft.width()/2, y);
+  tft.setTextPadding(0);
 }
 
-// ============================================
-// DESENHO DA MENSAGEM "TESOURO JÁ PILHADO"
-// ============================================
-
 /**
- * Exibe imagem de tesouro já pilhado com TFT_eSPI
+ * Exibe mensagem simples na tela (sem imagens). A tela já vem preta do
+ * prepareScene(): só as caixas das linhas vão para o TFT
  */
-void drawLootedMessage() {
-  Serial.println("☠️ Desenhando mensagem de tesouro pilhado (RGB888->RGB565)...");
-  
-  tft.setSwapBytes(true);
-  
-  // Calcula posição centralizada
-  int16_t x_offset = (tft.width() - TESOUROPILHADO_WIDTH) / 2;
-  int16_t y_offset = ((tft.height() - TESOUROPILHADO_HEIGHT) / 2) - 10;
-  
-  // Buffer para uma linha de pixels em RGB565
-  uint16_t* lineBuffer = (uint16_t*)malloc(TESOUROPILHADO_WIDTH * sizeof(uint16_t));
-  if (lineBuffer == NULL) {
-    Serial.println("❌ Erro ao alocar buffer para linha!");
-    return;
-  }
-  
-  // Desenha linha por linha
-  for (int y = 0; y < TESOUROPILHADO_HEIGHT; y++) {
-    for (int x = 0; x < TESOUROPILHADO_WIDTH; x++) {
-      int pixelIndex = y * TESOUROPILHADO_WIDTH + x;
-      uint32_t rgb888 = pgm_read_dword(&TesouroJaPilhado[pixelIndex]);
-      
-      uint8_t r = (rgb888 >> 16) & 0xFF;
-      uint8_t g = (rgb888 >> 8) & 0xFF;
-      uint8_t b = rgb888 & 0xFF;
-      
-      lineBuffer[x] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-    }
-    
-    tft.pushImage(x_offset, y_offset + y, TESOUROPILHADO_WIDTH, 1, lineBuffer);
+void showSimpleMessage(const char* line1, const char* line2 = nullptr, 
+                       const char* line3 = nullptr, const char* line4 = nullptr) {
+  finishDisplayDMA();
+  const char* lines[4] = { line1, line2, line3, line4 };
+  
+#if USE_SMOOTH_TEXT
+  SmoothText::Stats before = smoothText.getStats();
+  for (uint8_t i = 0; i < 4; i++) messageBoxes[i] = TextBox();
+#endif
+  for (uint8_t i = 0; i < 4; i++) {
+    if (lines[i] && *lines[i]) drawMessageLine(i, lines[i]);
   }
-  
-  free(lineBuffer);
-  Serial.println("✅ Mensagem de tesouro pilhado desenhada com sucesso!");
-  
-  // Adiciona texto sobre a imagem
-  /* tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.setTextSize(2);
-  tft.setTextDatum(MC_DATUM);
-  tft.drawString("AhhhhRRR!", tft.width()/2, 40);
-  tft.setTextSize(1);
-  tft.drawString("Voce esta tentando", tft.width()/2, 70);
-  tft.drawString("pilhar o tesouro", tft.width()/2, 85);
-  tft.drawString("novamente?", tft.width()/2, 100);
-  tft.drawString("Contente-se com", tft.width()/2, 120);
-  tft.drawString("seu quinhao!", tft.width()/2, 135); */
+#if USE_SMOOTH_TEXT
+  SmoothText::Stats after = smoothText.getStats();
+  Serial.printf("🔤 Mensagem: %lu px enviados (tela: %ld), glifos %lu do cache / %lu da flash\n",
+                (unsigned long)(after.pixels - before.pixels), (long)tft.width() * tft.height(),
+                (unsigned long)(after.hits - before.hits),
+                (unsigned long)(after.misses + after.uncached - before.misses - before.uncached));
+#endif
 }
 
 // ============================================
 // QR CODE - MODO ALTERNATIVO
 // ============================================
 
+#if USE_LVGL
 /**
  * Inicializa LVGL sob demanda (só quando precisar do QR Code)
  */
-void initializeLVGLIfNeeded() {
+bool initializeLVGLIfNeeded() {
   if (!lvglInitialized) {
     Serial.println("📦 Inicializando LVGL para QR Code...");
     initLVGL();
-    lvglInitialized = true;
-    Serial.println("✅ LVGL inicializado!");
+    if (lvglInitialized) Serial.println("✅ LVGL inicializado!");
+  } else if (buf1 == NULL) {
+    // Desmontado por releaseLVGL(): só os buffers de desenho voltam
+    Serial.println("📦 Remontando LVGL para QR Code...");
+    LvglLock lock(lvglTask);
+    lvglBuffersAlloc();
   }
+  return lvglInitialized && buf1 != NULL;
 }
 
 /**
@@ -614,98 +804,119 @@ void createQRCodeScreen() {
   
   Serial.println("✅ Tela QR Code criada!");
 }
+#else
+// Moldura do QR Code (mesmo estilo da tela LVGL: painel preto com borda
+// azul, QR Code de 163 px centralizado)
+#define QR_PANEL_SIZE     188
+#define QR_PANEL_BORDER   3
+#define QR_PANEL_RADIUS   10
+#define QR_PANEL_OFFSET_Y -9
+#define QR_CODE_PIXELS    163
+
+// Espera máxima pela task do cache quando a matriz ainda não está pronta
+#ifndef QR_CACHE_WAIT_MS
+  #define QR_CACHE_WAIT_MS 1000
+#endif
 
 /**
- * Alterna para modo RoboEyes
+ * Desenha a tela do QR Code (qrCode já codificado) direto no TFT
  */
-void switchToEyesMode() {
-  Serial.println("👀 Alternando para modo Eyes...");
-  
-  // Garante swap correto para RoboEyes
-  tft.setSwapBytes(true);
+void drawQrScreen(QrDrawStats* stats) {
+  int32_t panelX = (tft.width() - QR_PANEL_SIZE) / 2;
+  int32_t panelY = (tft.height() - QR_PANEL_SIZE) / 2 + QR_PANEL_OFFSET_Y;
   
-  currentMode = EYES_MODE;
   tft.fillScreen(TFT_BLACK);
-  // RoboEyes continuará automaticamente no loop
-  Serial.println("✅ Modo Eyes ativo!");
+  tft.fillRoundRect(panelX, panelY, QR_PANEL_SIZE, QR_PANEL_SIZE, QR_PANEL_RADIUS,
+                    tft.color565(0x20, 0x95, 0xF6));
+  tft.fillRoundRect(panelX + QR_PANEL_BORDER, panelY + QR_PANEL_BORDER,
+                    QR_PANEL_SIZE - 2 * QR_PANEL_BORDER, QR_PANEL_SIZE - 2 * QR_PANEL_BORDER,
+                    QR_PANEL_RADIUS - QR_PANEL_BORDER, TFT_BLACK);
+  
+  int32_t inset = (QR_PANEL_SIZE - QR_CODE_PIXELS) / 2;
+  drawQrCode(tft, qrCode, panelX + inset, panelY + inset, QR_CODE_PIXELS,
+             TFT_BLACK, TFT_WHITE, stats);
 }
+#endif
 
 /**
- * Alterna para modo QR Code
+ * Codifica (ou pega do cache) e desenha o QR Code da url. false = sem
+ * memória ou URL longa demais.
  */
-void switchToQRCodeMode(const String& url) {
-  Serial.println("📱 Alternando para modo QR Code...");
-  
-  currentMode = QRCODE_MODE;
-  
-  // Desenha baú de tesouro com TFT_eSPI (RGB888 -> RGB565)
-  tft.fillScreen(TFT_BLACK);
-  drawTreasureChest();
+bool showQrCode(const String& url) {
+  uint32_t qrStart = micros();
   
-  // Aguarda 500ms
-  delay(1000);
-  
-  // Inicializa LVGL para QR Code
-  initializeLVGLIfNeeded();
+#if USE_LVGL
+  // Inicializa LVGL para QR Code (heap dos olhos já foi devolvido)
+  if (!initializeLVGLIfNeeded()) {
+    Serial.println("❌ Sem memória para o QR Code - voltando aos olhos");
+    return false;
+  }
   
   // 📱 Agora exibe o QR Code
   Serial.println("📱 Exibindo QR Code...");
   
-  // Cria tela se não existir
-  if (qr_screen == NULL) {
-    createQRCodeScreen();
+  {
+    LvglLock lock(lvglTask);
+    
+    // Cria tela se não existir
+    if (qr_screen == NULL) {
+      createQRCodeScreen();
+    }
+    
+    // Atualiza QR Code com a URL
+    lv_qrcode_update(qr_code, url.c_str(), url.length());
+    
+    // Carrega tela QR Code
+    lv_scr_load(qr_screen);
   }
   
-  // Atualiza QR Code com a URL
-  lv_qrcode_update(qr_code, url.c_str(), url.length());
-  
-  // Carrega tela QR Code
-  lv_scr_load(qr_screen);
-  
-  // Registra tempo
-  qrCodeShowTime = millis();
-  
-  Serial.println("✅ QR Code exibido (timeout: 3 min)");
-}
-
-/**
- * Alterna para modo Moeda de Ouro
- */
-void switchToCoinMode() {
-  Serial.println("🪙 Alternando para modo Moeda de Ouro...");
-  
-  currentMode = COIN_MODE;
-  tft.fillScreen(TFT_BLACK);
-  drawGoldenCoin();
-  
-  // Registra tempo de início
-  rewardShowTime = millis();
+  // Task do LVGL volta a desenhar (tela inteira)
+  lvglTask.resume();
+  Serial.printf("⏱️ QR Code (LVGL): init + codificação %lu µs; desenho no log 🖼️ LVGL\n",
+                (unsigned long)(micros() - qrStart));
+#else
+  // Matriz codificada em background desde a leitura da tag (QrCache.h);
+  // só espera se a task ainda não terminou
+  Serial.println("📱 Exibindo QR Code...");
+  bool wasReady = false;
+  if (!qrCache.get(url.c_str(), url.length(), qrCode, QR_CACHE_WAIT_MS, &wasReady)) {
+    Serial.printf("❌ QR Code indisponível (%d bytes, versão máx. %d)\n",
+                  url.length(), QR_MAX_VERSION);
+    return false;
+  }
+  uint32_t encodeMicros = micros() - qrStart;
+  QrDrawStats drawStats;
+  drawQrScreen(&drawStats);
+  Serial.printf("⏱️ QR Code: versão %d (%dx%d, %d px/módulo), matriz %s %lu µs + tela %lu µs (%s)\n",
+                qrCode.version, qrCode.size, qrCode.size, drawStats.scale,
+                wasReady ? "pronta" : "esperada", (unsigned long)encodeMicros,
+                (unsigned long)(micros() - qrStart - encodeMicros),
+                drawStats.dma ? "DMA" : "bloqueante");
+#endif
   
-  Serial.println("✅ Moeda de ouro exibida (timeout: 1 min)");
+  return true;
 }
 
 /**
- * Alterna para modo Tesouro Já Pilhado
+ * Fim da recompensa (timeout ou toque): QR Code pendente ou olhos
  */
-void switchToLootedMode() {
-  Serial.println("☠️ Alternando para modo Tesouro Já Pilhado...");
-  
-  currentMode = LOOTED_MODE;
-  tft.fillScreen(TFT_BLACK);
-  drawLootedMessage();
-  
-  // Registra tempo de início
-  rewardShowTime = millis();
-  
-  Serial.println("✅ Mensagem de tesouro pilhado exibida (timeout: 1 min)");
+void leaveReward() {
+  if (waitingForTagCheck && currentURL.length() > 0) {
+    Serial.println("  └─ Exibindo QR Code após recompensa...");
+    scenes.go(QRCODE_MODE);
+    waitingForTagCheck = false;  // QR code já foi exibido
+  } else {
+    Serial.println("  └─ Voltando aos olhos");
+    scenes.go(EYES_MODE);
+  }
 }
 
 /**
- * DEPRECATED: Função não mais utilizada - verificação agora é imediata em showTagInfo()
+ * DEPRECATED: Função não mais utilizada - verificação agora é imediata em checkTag()
  * Mantida por compatibilidade, mas não deve ser chamada.
  */
 void checkAndRewardTag() {
-  // Esta função foi substituída pela verificação imediata em showTagInfo()
+  // Esta função foi substituída pela verificação imediata em checkTag()
   Serial.println("⚠️ checkAndRewardTag() DEPRECATED - verificação já foi feita!");
   
   // Limpa flags para evitar estados inconsistentes
@@ -745,89 +956,84 @@ void changeRandomMood() {
   }
 }
 
+/**
+ * Humor novo quando a animação confused do toque termina
+ */
+void onMoodTimer() {
+  changeRandomMood();
+  Serial.println("  └─ Humor alterado!");
+}
+
+TimerWheel::Timer moodTimer(onMoodTimer);
+
 // ============================================
 // FUNÇÕES DE TOUCH
 // ============================================
 
+// Task input (cópia do handle: a ISR não chama código da flash)
+volatile TaskHandle_t touchTask = NULL;
+
 /**
- * Verifica e processa toques na tela
+ * T_IRQ do XPT2046 (nível baixo com a tela tocada): acorda a task de entrada
  */
-void handleTouch() {
-  if (!touchEnabled || touchProcessing) return;
-  int16_t t_x , t_y; 
-  // TFT_eTouch: Método simples e eficaz
-  if (touch.getXY(t_x, t_y)) {
-    // Debounce - evita múltiplos toques
-    if (millis() - lastTouchTime < TOUCH_DEBOUNCE) {
-      return;
-    }
+void IRAM_ATTR onTouchIrq() {
+  TaskHandle_t input = touchTask;
+  if (input == NULL) return;
+  BaseType_t higherPriorityWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(input, &higherPriorityWoken);
+  if (higherPriorityWoken) portYIELD_FROM_ISR();
+}
+
+/**
+ * Processa um gesto na task da tela: fora dos olhos qualquer gesto vale
+ * como toque; nos olhos, tap confunde, toque longo faz rir e arraste
+ * manda olhar para o lado do arraste
+ */
+void handleTouch(const TouchEvent& event) {
+  Serial.printf("👆 Touch: %s em (%d, %d), %u ms\n", event.name(), event.x, event.y, event.durationMs);
+  
+  // Ação baseada na cena atual (trocas só agendadas: nada bloqueia)
+  DisplayMode mode = scenes.current();
+  if (mode == QRCODE_MODE) {
+    // ⭐ MODIFICADO: Touch no QR Code - volta para olhos
+    Serial.println("📱 Touch no QR Code - voltando aos olhos...");
+    scenes.go(EYES_MODE);
+    waitingForTagCheck = false;  // Limpa flag se houver
     
-    // Marca que está processando
-    touchProcessing = true;    
+  } else if (mode == COIN_MODE || mode == LOOTED_MODE) {
+    // ⭐ MODIFICADO: Touch na moeda ou mensagem - verifica se há QR pendente
+    Serial.println("👆 Touch na recompensa");
+    leaveReward();
     
-    // Valida coordenadas
-    if (t_x > tft.width() || t_y > tft.height()) {
-      Serial.printf("⚠️ Touch fora da tela: (%d, %d)\n", t_x, t_y);
-      touchProcessing = false;
-      return;
+  } else if (mode == ADMIN_MODE) {
+    // ⭐ MODIFICADO: Verifica se passaram 30 segundos mínimos
+    unsigned long elapsedTime = scenes.elapsed();
+    if (elapsedTime < ADMIN_MESSAGE_TIMEOUT) {
+      unsigned long remainingTime = (ADMIN_MESSAGE_TIMEOUT - elapsedTime) / 1000;
+      Serial.printf("⏳ Touch bloqueado! Aguarde %lu segundos...\n", remainingTime);
+    } else {
+      Serial.println("👆 Touch na mensagem de admin (após 30s) - voltando aos olhos...");
+      scenes.go(EYES_MODE);
     }
     
-    lastTouchTime = millis();
-    
-    Serial.printf("👆 Touch válido em: (%d, %d)\n", t_x, t_y);
-    
-    // Ação baseada no modo atual
-    if (currentMode == QRCODE_MODE) {
-      // ⭐ MODIFICADO: Touch no QR Code - volta para olhos
-      Serial.println("📱 Touch no QR Code - voltando aos olhos...");
-      switchToEyesMode();
-      waitingForTagCheck = false;  // Limpa flag se houver
-      
-    } else if (currentMode == COIN_MODE || currentMode == LOOTED_MODE) {
-      // ⭐ MODIFICADO: Touch na moeda ou mensagem - verifica se há QR pendente
-      if (waitingForTagCheck && currentURL.length() > 0) {
-        Serial.println("👆 Touch na recompensa - exibindo QR Code...");
-        switchToQRCodeMode(currentURL);
-        waitingForTagCheck = false;
-      } else {
-        Serial.println("👆 Touch na recompensa - voltando aos olhos...");
-        switchToEyesMode();
-      }
-      rewardShowTime = 0;  // Reseta timer
-      
-    } else if (currentMode == EYES_MODE) {
-      // ⭐ NOVO: Se está mostrando mensagem de reset/admin
-      if (showingResetMessage) {
-        // ⭐ MODIFICADO: Verifica se passaram 30 segundos mínimos
-        unsigned long elapsedTime = millis() - adminMessageShowTime;
-        if (elapsedTime < ADMIN_MESSAGE_TIMEOUT) {
-          unsigned long remainingTime = (ADMIN_MESSAGE_TIMEOUT - elapsedTime) / 1000;
-          Serial.printf("⏳ Touch bloqueado! Aguarde %lu segundos...\n", remainingTime);
-          touchProcessing = false;
-          return;
-        }
-        
-        Serial.println("👆 Touch na mensagem de admin (após 30s) - voltando aos olhos...");
-        showingResetMessage = false;
-        adminMessageShowTime = 0;
-        switchToEyesMode();
-        touchProcessing = false;
-        return;
-      }
-      
-      // Se está mostrando olhos, executa animação confused e muda humor
-      Serial.println("👀 Touch nos olhos - executando animação confused...");
-      roboEyes.anim_confused();
-      
-      // Muda para um humor aleatório após a animação
-      delay(800); // Aguarda animação confused
-      changeRandomMood();
-      Serial.println("  └─ Humor alterado!");
+  } else if (mode == EYES_MODE) {
+    switch (event.gesture) {
+      case TouchEvent::TAP:
+        // Executa animação confused; humor novo quando ela termina (moodTimer)
+        Serial.println("👀 Touch nos olhos - executando animação confused...");
+        roboEyes.anim_confused();
+        timers.arm(moodTimer, CONFUSED_MOOD_DELAY);
+        break;
+      case TouchEvent::LONG_PRESS:
+        Serial.println("😄 Toque longo nos olhos - risada...");
+        roboEyes.anim_laugh();
+        timers.arm(moodTimer, CONFUSED_MOOD_DELAY);
+        break;
+      case TouchEvent::SWIPE_LEFT:  roboEyes.setPosition(W); break;
+      case TouchEvent::SWIPE_RIGHT: roboEyes.setPosition(E); break;
+      case TouchEvent::SWIPE_UP:    roboEyes.setPosition(N); break;
+      case TouchEvent::SWIPE_DOWN:  roboEyes.setPosition(S); break;
     }
-    
-    // Aguarda liberar o toque
-    delay(100);
-    touchProcessing = false;
   }
 }
 
@@ -836,15 +1042,48 @@ void handleTouch() {
 // ============================================
 
 /**
- * Mostra informações da tag detectada
+ * Espera antes de trocar de cena: os olhos mostram a reação (laugh,
+ * confused) se estão na tela; de outra cena a troca é imediata
+ */
+uint32_t reactionTime() {
+  return scenes.current() == EYES_MODE ? EYES_REACTION_TIME : 0;
+}
+
+/**
+ * Agenda a mensagem de admin (cena ADMIN_MODE) daqui a delayMs
+ */
+void showAdminMessage(const String& line1, const String& line2, const String& line3,
+                      const String& line4, bool backupLine, uint32_t delayMs) {
+  adminLines[0] = line1;
+  adminLines[1] = line2;
+  adminLines[2] = line3;
+  adminLines[3] = line4;
+  adminBackupLine = backupLine;
+  scenes.go(ADMIN_MODE, delayMs);
+}
+
+/**
+ * Copia as 4 linhas da mensagem de admin para o evento (separadas por '\n')
+ */
+void setAdminLines(TagEvent& event, const String& line1, const String& line2,
+                   const String& line3, const String& line4) {
+  String lines = line1 + "\n" + line2 + "\n" + line3 + "\n" + line4;
+  strlcpy(event.text, lines.c_str(), sizeof(event.text));
+}
+
+/**
+ * Verifica a tag no armazenamento (task de armazenamento) e preenche o
+ * veredito do evento para a tela: tag nova, repetida ou admin
  */
-void showTagInfo(const TagMessage& tag) {
+void checkTag(TagEvent& event) {
+  String uid = event.uid;
   Serial.println("📱 Tag detectada!");
-  Serial.println("  ├─ UID: " + tag.uid);
+  Serial.println("  ├─ UID: " + uid);
   
   // ⭐ NOVO: Verifica se é a tag especial de admin
-  if (tag.uid == ADMIN_TAG_UID) {
+  if (uid == ADMIN_TAG_UID) {
     Serial.println("  ├─ 🔑 TAG ADMIN DETECTADA!");
+    event.kind = TagEvent::TAG_ADMIN;
     
     // Verifica se é leitura consecutiva
     if (lastReadUID == ADMIN_TAG_UID) {
@@ -855,7 +1094,7 @@ void showTagInfo(const TagMessage& tag) {
       Serial.println("  ├─ Primeira leitura admin");
     }
     
-    lastReadUID = tag.uid;
+    lastReadUID = uid;
     
     // a) Sempre lista as tags no console
     Serial.println("  ├─ Listando tags armazenadas...");
@@ -866,60 +1105,42 @@ void showTagInfo(const TagMessage& tag) {
       Serial.println("  └─ ⚠️ 3 LEITURAS CONSECUTIVAS - INICIANDO RESET!");
       Serial.println();
       
-      // Faz backup
-      bool backupOk = backupTagsToSD();
+      // Copia as tags ainda sem backup (gravação em background) e inicia nova sessão
+      Serial.println("\n💾 Agendando backup de tags para SD Card...");
+      bool backupOk = tagBackup.backupBeforeClear();
       
       // Limpa a tabela principal
       clearAllTags();
       
-      // Exibe mensagem na tela
-      showSimpleMessage(
+      // Mensagem na tela (progresso do backup atualizado na cena)
+      setAdminLines(event,
         "LISTA ZERADA",
-        backupOk ? "Backup: OK" : "Backup: FALHOU",
+        backupOk ? "Backup: ..." : "Backup: FALHOU",
         "Tags apagadas",
         "Toque para voltar"
       );
+      event.react = false;
+      event.backupLine = backupOk;
       
       // Reseta contador
       consecutiveAdminReads = 0;
       
-      // ⭐ MODIFICADO: Garante mínimo de 30s na tela
-      showingResetMessage = true;
-      adminMessageShowTime = millis();
-      Serial.println("⏳ Aguardando toque (mínimo 30s) para voltar aos olhos...");
-      
     } else {
       Serial.println("  └─ Leia mais " + String(3 - consecutiveAdminReads) + "x para resetar");
       
-      // Executa animação
-      roboEyes.anim_laugh();
-      delay(500);
-      
-      // ⭐ NOVO: Mostra mensagem visual na tela
-      prefs.begin(PREFS_NAMESPACE, true); // read-only
-      int tagsCount = prefs.getInt(PREFS_COUNT_KEY, 0);
-      prefs.end();
-      
+      // ⭐ NOVO: Mostra mensagem visual na tela (olhos riem antes)
+      int tagsCount = getReadTagsCount();
       int timesToClear = 3 - consecutiveAdminReads;
       
-      // Cria strings temporárias para conversão
-      String line2 = String(tagsCount) + " tags detected";
-      String line3 = String(timesToClear) + "x times to clear";
-      
-      showSimpleMessage(
+      setAdminLines(event,
         "Ye Captain!",
-        line2.c_str(),
-        line3.c_str(),
+        String(tagsCount) + " tags detected",
+        String(timesToClear) + "x times to clear",
         "Touch to continue"
       );
-      
-      // ⭐ MODIFICADO: Garante mínimo de 30s na tela
-      showingResetMessage = true;
-      adminMessageShowTime = millis();
-      Serial.println("⏳ Aguardando toque (mínimo 30s) para voltar aos olhos...");
+      event.react = true;
+      event.backupLine = false;
     }
-    
-    tagPresent = true;
     return; // Não processa o resto
   }
   
@@ -927,73 +1148,82 @@ void showTagInfo(const TagMessage& tag) {
   if (lastReadUID == ADMIN_TAG_UID) {
     consecutiveAdminReads = 0;
   }
-  lastReadUID = tag.uid;
+  lastReadUID = uid;
   
   // ⭐ MODIFICADO: Verifica IMEDIATAMENTE se tag já foi lida (antes de mostrar QR code)
   Serial.println("\n🔍 Verificando tag...");
-  Serial.println("  ├─ UID: " + tag.uid);
+  Serial.println("  ├─ UID: " + uid);
   
-  bool tagAlreadyRead = isTagAlreadyRead(tag.uid);
-  
-  if (tagAlreadyRead) {
-    // Tag já foi lida - mensagem de tesouro pilhado
-    Serial.println("  └─ ⚠️ Tag já foi lida anteriormente!");
-    
-    // Executa animação de confusão
-    roboEyes.anim_confused();
-    delay(500);
-    
-    switchToLootedMode();
-    
-  } else {
-    // Tag nova - salva e mostra moeda
-    Serial.println("  ├─ ✅ Tag nova! Salvando...");
-    saveTagAsRead(tag.uid);
+  if (registerTagVisit(uid)) {
+    // Tag nova (já salva por registerTagVisit)
+    Serial.println("  ├─ ✅ Tag nova!");
     Serial.println("  └─ 🎆 Recompensa: Moeda de Ouro!");
-    
-    // Executa animação de felicidade
-    roboEyes.anim_laugh();
-    delay(500);
-    
-    switchToCoinMode();
+    event.kind = TagEvent::TAG_NEW;
+  } else {
+    Serial.println("  └─ ⚠️ Tag já foi lida anteriormente!");
+    event.kind = TagEvent::TAG_REPEATED;
   }
   
-  // ⭐ MODIFICADO: Salva URL para exibir QR Code DEPOIS da recompensa
-  if (tag.type == CONTENT_URL && tag.url.length() > 0) {
+  if (event.type == CONTENT_URL && event.text[0]) {
     Serial.println("  ├─ Tipo: URL NDEF");
-    Serial.println("  ├─ URL: " + tag.url);
-    
-    // Registra URL para mostrar após timeout da moeda/mensagem
-    currentURL = tag.url;
-    waitingForTagCheck = true;  // Reutiliza flag para indicar QR pendente
-    Serial.println("  └─ QR Code será exibido após recompensa");
-    
-  } else if (tag.type == CONTENT_TEXT && tag.text.length() > 0) {
+    Serial.printf("  └─ URL: %s\n", event.text);
+  } else if (event.type == CONTENT_TEXT && event.text[0]) {
     Serial.println("  ├─ Tipo: Texto");
-    Serial.println("  └─ Conteúdo: " + tag.text);
-    
+    Serial.printf("  └─ Conteúdo: %s\n", event.text);
   } else {
     Serial.println("  └─ Tipo: Dados brutos (não-NDEF)");
   }
-  
-  tagPresent = true;
 }
 
 /**
- * Limpa display e volta para estado inicial (RoboEyes)
+ * Mostra a tag verificada (task da tela)
  */
-void clearDisplay() {
-  Serial.println("🔄 Limpando display...");
-  
-  // Volta para modo olhos
-  if (currentMode == QRCODE_MODE) {
-    switchToEyesMode();
+void showTagEvent(const TagEvent& event) {
+  bool admin = event.kind == TagEvent::TAG_ADMIN;
+  currentUID = event.uid;
+  currentURL = !admin && event.type == CONTENT_URL ? event.text : "";
+  currentText = !admin && event.type == CONTENT_TEXT ? event.text : "";
+  currentType = (ContentType)event.type;
+  
+  if (admin) {
+    String lines[4];
+    String text = event.text;
+    for (int i = 0, from = 0; i < 4; i++) {
+      int to = text.indexOf('\n', from);
+      if (to < 0) to = text.length();
+      lines[i] = text.substring(from, to);
+      from = to + 1;
+    }
+    
+    // Executa animação (a mensagem entra quando ela termina)
+    if (event.react) roboEyes.anim_laugh();
+    showAdminMessage(lines[0], lines[1], lines[2], lines[3], event.backupLine,
+                     event.react ? reactionTime() : 0);
+    
+    // ⭐ MODIFICADO: Garante mínimo de 30s na tela
+    Serial.println("⏳ Aguardando toque (mínimo 30s) para voltar aos olhos...");
+    return;
   }
   
-  qrCodeShowTime = 0;
-  tagPresent = false;
+  if (event.kind == TagEvent::TAG_REPEATED) {
+    // Executa animação de confusão; tesouro pilhado quando ela termina
+    roboEyes.anim_confused();
+    scenes.go(LOOTED_MODE, reactionTime());
+  } else {
+    // Executa animação de felicidade; moeda quando ela termina
+    roboEyes.anim_laugh();
+    scenes.go(COIN_MODE, reactionTime());
+  }
   
-  Serial.println("✅ Display limpo - voltando para RoboEyes");
+  // ⭐ MODIFICADO: Salva URL para exibir QR Code DEPOIS da recompensa
+  if (currentURL.length() > 0) {
+    // URL fica em currentURL para mostrar após timeout da moeda/mensagem
+    waitingForTagCheck = true;  // Reutiliza flag para indicar QR pendente
+#if !USE_LVGL
+    qrCache.prepare(currentURL.c_str(), currentURL.length());  // codifica durante a recompensa
+#endif
+    Serial.println("📱 QR Code será exibido após recompensa");
+  }
 }
 
 /**
@@ -1006,57 +1236,28 @@ void updateConnectionStatus(String status) {
 }
 
 /**
- * Verifica timeout do QR Code (3 minutos)
- */
-void checkQRCodeTimeout() {
-  // ⭐ MODIFICADO: QR Code agora é exibido APÓS a recompensa, sem verificação pendente
-  if (currentMode == QRCODE_MODE && qrCodeShowTime > 0) {
-    if (millis() - qrCodeShowTime >= QR_CODE_TIMEOUT) {
-      Serial.println("⏰ Timeout do QR Code (3 min) - voltando aos olhos");
-      switchToEyesMode();
-      qrCodeShowTime = 0;
-      waitingForTagCheck = false;  // Limpa qualquer flag pendente
-    }
-  }
-}
-
-/**
- * Verifica timeout da recompensa (moeda/mensagem - 1 minuto)
+ * Atualiza a linha "Backup: xx%" da mensagem de reset conforme a task avança
  */
-void checkRewardTimeout() {
-  if ((currentMode == COIN_MODE || currentMode == LOOTED_MODE) && rewardShowTime > 0) {
-    // Verifica timeout de 1 minuto
-    if (millis() - rewardShowTime >= REWARD_TIMEOUT) {
-      Serial.println("⏰ Timeout de recompensa (1 min)");
-      
-      // ⭐ MODIFICADO: Verifica se há QR Code pendente para exibir
-      if (waitingForTagCheck && currentURL.length() > 0) {
-        Serial.println("  └─ Exibindo QR Code após recompensa...");
-        switchToQRCodeMode(currentURL);
-        waitingForTagCheck = false;  // QR code já foi exibido
-      } else {
-        Serial.println("  └─ Voltando aos olhos");
-        switchToEyesMode();
-      }
-      
-      rewardShowTime = 0;
-    }
+void updateBackupStatus() {
+  if (!showingBackupStatus) return;
+  
+  TagBackupSD::Progress progress = tagBackup.progress();
+  if (progress.state == lastBackupProgress.state &&
+      progress.percent() / 10 == lastBackupProgress.percent() / 10) {
+    return;
   }
-}
-
-/**
- * ⭐ NOVO: Verifica timeout da mensagem de admin (30 segundos)
- */
-void checkAdminMessageTimeout() {
-  if (showingResetMessage && adminMessageShowTime > 0) {
-    // Verifica timeout de 30 segundos
-    if (millis() - adminMessageShowTime >= ADMIN_MESSAGE_TIMEOUT) {
-      Serial.println("⏰ Timeout de mensagem admin - voltando aos olhos");
-      showingResetMessage = false;
-      adminMessageShowTime = 0;
-      switchToEyesMode();
-    }
+  lastBackupProgress = progress;
+  
+  String status;
+  switch (progress.state) {
+    case TagBackupSD::BACKUP_DONE:   status = "Backup: OK"; break;
+    case TagBackupSD::BACKUP_FAILED: status = "Backup: FALHOU"; break;
+    default:                         status = "Backup: " + String(progress.percent()) + "%"; break;
   }
+  
+  // Redesenha apenas a segunda linha de showSimpleMessage()
+  finishDisplayDMA();
+  drawMessageLine(1, status.c_str());
 }
 
 // ============================================
@@ -1079,18 +1280,25 @@ void processUARTMessage(String message) {
   String msgType = CommProtocol::getMessageType(message);
   
   if (msgType == MSG_TAG) {
-    // Decodifica e mostra tag
+    // Decodifica e passa para a task de armazenamento (verifica e manda à tela)
     TagMessage tag = CommProtocol::decodeTag(message);
+    const String& content = tag.type == CONTENT_URL ? tag.url : tag.text;
     
-    // Salva estado atual
-    currentUID = tag.uid;
-    currentURL = tag.url;
-    currentText = tag.text;
-    currentType = tag.type;
-    tagPresent = true;
-    
-    // Atualiza UI
-    showTagInfo(tag);
+    TagEvent event;
+    event.kind = TagEvent::TAG_READ;
+    event.type = tag.type;
+    event.react = event.backupLine = false;
+    strlcpy(event.uid, tag.uid.c_str(), sizeof(event.uid));
+    event.text[0] = '\0';
+    if (content.length() < sizeof(event.text)) {
+      strlcpy(event.text, content.c_str(), sizeof(event.text));
+    } else {
+      Serial.printf("⚠️ Conteúdo com %d bytes (máx. %d): tag sem QR Code/texto\n",
+                    content.length(), TAG_EVENT_TEXT_MAX - 1);
+    }
+    if (!tagQueue.send(event, pdMS_TO_TICKS(TAG_QUEUE_WAIT_MS))) {
+      Serial.println("⚠️ Fila de tags cheia - tag descartada");
+    }
     
     // Envia ACK
     Serial1.println(CommProtocol::encodeAck());
@@ -1110,6 +1318,9 @@ void processUARTMessage(String message) {
     String error = "ERRO: " + message.substring(sep + 1);
     updateConnectionStatus(error);
     
+  } else if (msgType == MSG_CMD && tagSync.handleCommand(message, Serial1)) {
+    // Exportação/importação de tags em andamento (ver TagSync.h)
+    
   } else {
     Serial.print("⚠️  Mensagem desconhecida: ");
     Serial.println(message);
@@ -1120,28 +1331,397 @@ void processUARTMessage(String message) {
  * Verifica e processa mensagens UART
  */
 void checkUARTMessages() {
-  while (Serial1.available()) {
+  // Durante exportação/importação a porta é lida pelo TagSync
+  while (!tagSync.active(Serial1) && Serial1.available()) {
     String message = Serial1.readStringUntil('\n');
     processUARTMessage(message);
   }
 }
 
+/**
+ * Comandos pela USB: sincronização (CMD|EXPORT, CMD|IMPORT) e diagnóstico
+ * (CMD|MEM, CMD|TASKS)
+ */
+void checkSerialCommands() {
+  while (!tagSync.active(Serial) && Serial.available()) {
+    String message = Serial.readStringUntil('\n');
+    message.trim();
+    if (message == "CMD|MEM") {
+      reportMemory();
+    } else if (message == "CMD|TASKS") {
+      taskReportRequested = true;   // impresso pela task de armazenamento
+    } else if (message.length() > 0 && !tagSync.handleCommand(message, Serial)) {
+      Serial.println("⚠️  Comando desconhecido: " + message);
+    }
+  }
+}
+
+// ============================================
+// ESTATÍSTICAS DO ROBOEYES
+// ============================================
+
+// Intervalo do log de quadros/bytes do RoboEyes (0 = desligado)
+#ifndef EYES_STATS_INTERVAL_MS
+  #define EYES_STATS_INTERVAL_MS 10000
+#endif
+
+/**
+ * Loga FPS efetivo, bytes/s enviados pelo RoboEyes (dirty rectangles), o
+ * orçamento do quadro (desenho + envio contra o intervalo entre quadros) e
+ * quanto a task render dormiu
+ */
+void logEyesStats() {
+#if EYES_STATS_INTERVAL_MS > 0
+  static unsigned long lastLog = 0;
+  if (millis() - lastLog < EYES_STATS_INTERVAL_MS) return;
+  lastLog = millis();
+  
+  const TFT_RoboEyes::RenderStats& stats = roboEyes.getRenderStats();
+  Serial.printf("👀 Olhos: %.1f fps efetivos, %lu bytes/s, %u/%u quadros sem mudança\n",
+                stats.fps, (unsigned long)stats.bytesPerSecond, stats.skipped, stats.ticks);
+  Serial.printf("   ↳ quadro: desenho %lu µs + envio %lu µs (pior %lu µs) de %lu µs, %s\n",
+                (unsigned long)stats.renderMicros, (unsigned long)stats.pushMicros,
+                (unsigned long)stats.frameMicrosMax, (unsigned long)stats.budgetMicros,
+                stats.dma ? "DMA" : "bloqueante");
+  
+  const FramePacer::Stats& pace = pacer.getStats();
+  Serial.printf("💤 Render: %u%% dormindo, %u passagens/s, %u acordadas por evento\n",
+                pace.sleepPercent, pace.loops, pace.inputWakes);
+#endif
+}
+
+// ============================================
+// CENAS DA TELA (SceneManager.h)
+// ============================================
+
+// Baú de tesouro antes do QR Code
+#ifndef QR_CHEST_MS
+  #define QR_CHEST_MS 1000
+#endif
+
+/**
+ * Antes de qualquer cena: termina os envios por DMA, aplica o plano de
+ * memória do modo e limpa a tela
+ */
+void prepareScene(DisplayMode mode) {
+  finishDisplayDMA();
+  applyMemoryPlan(mode);
+  tft.fillScreen(TFT_BLACK);
+}
+
+/**
+ * Olhos: RoboEyes desenha a cada update(), só a região alterada
+ */
+void eyesEnter() {
+  tft.setSwapBytes(true);   // Garante swap correto para RoboEyes
+  roboEyes.invalidate();    // tela limpa: próximo quadro envia o sprite inteiro
+}
+
+uint32_t eyesUpdate(uint32_t elapsedMs) {
+  roboEyes.update();
+  logEyesStats();
+  return roboEyes.nextFrameIn();
+}
+
+void eyesExit() {
+  timers.cancel(moodTimer);
+}
+
+/**
+ * QR Code: baú por QR_CHEST_MS, depois o QR Code de currentURL até o
+ * timeout de 3 minutos
+ */
+void onQrTimeout() {
+  Serial.println("⏰ Timeout do QR Code (3 min) - voltando aos olhos");
+  waitingForTagCheck = false;  // Limpa qualquer flag pendente
+  scenes.go(EYES_MODE);
+}
+
+TimerWheel::Timer qrTimeoutTimer(onQrTimeout);
+
+void onQrChestDone() {
+  if (!showQrCode(currentURL)) {
+    scenes.go(EYES_MODE);
+    return;
+  }
+  timers.arm(qrTimeoutTimer, QR_CODE_TIMEOUT);
+  Serial.println("✅ QR Code exibido (timeout: 3 min)");
+}
+
+TimerWheel::Timer qrChestTimer(onQrChestDone);
+
+void qrEnter() {
+#if !USE_LVGL
+  qrCache.prepare(currentURL.c_str(), currentURL.length());   // já pronta se veio da recompensa
+#endif
+  drawRewardImage("BauTesouro", 0, "Baú");
+  timers.arm(qrChestTimer, QR_CHEST_MS);
+}
+
+void qrExit() {
+  timers.cancel(qrChestTimer);
+  timers.cancel(qrTimeoutTimer);
+}
+
+/**
+ * Recompensa: moeda (tag nova) ou tesouro pilhado (tag repetida) por 1 min
+ */
+void onRewardTimeout() {
+  Serial.println("⏰ Timeout de recompensa (1 min)");
+  leaveReward();
+}
+
+TimerWheel::Timer rewardTimer(onRewardTimeout);
+
+void coinEnter() {
+  drawRewardImage("MoedaOuro", -15, "Moeda de ouro");
+  timers.arm(rewardTimer, REWARD_TIMEOUT);
+  Serial.println("✅ Moeda de ouro exibida (timeout: 1 min)");
+}
+
+void lootedEnter() {
+  drawRewardImage("TesouroJaPilhado", -10, "Tesouro pilhado");
+  timers.arm(rewardTimer, REWARD_TIMEOUT);
+  Serial.println("✅ Mensagem de tesouro pilhado exibida (timeout: 1 min)");
+}
+
+void rewardExit() {
+  timers.cancel(rewardTimer);
+}
+
+/**
+ * Mensagem de admin (adminLines) por 30 s; linha do backup atualizada
+ */
+void onAdminTimeout() {
+  Serial.println("⏰ Timeout de mensagem admin - voltando aos olhos");
+  scenes.go(EYES_MODE);
+}
+
+TimerWheel::Timer adminTimer(onAdminTimeout);
+
+void adminEnter() {
+  showSimpleMessage(adminLines[0].c_str(), adminLines[1].c_str(),
+                    adminLines[2].c_str(), adminLines[3].c_str());
+  showingBackupStatus = adminBackupLine;
+  lastBackupProgress = tagBackup.progress();
+  timers.arm(adminTimer, ADMIN_MESSAGE_TIMEOUT);
+}
+
+uint32_t adminUpdate(uint32_t elapsedMs) {
+  updateBackupStatus();
+  return UINT32_MAX;   // progresso do backup a cada PACER_MAX_SLEEP_MS
+}
+
+void adminExit() {
+  timers.cancel(adminTimer);
+  showingBackupStatus = false;
+}
+
+// Uma cena por DisplayMode, na ordem do enum
+const Scenes::Scene SCENES[DISPLAY_MODE_COUNT] = {
+  { "olhos",           eyesEnter,   eyesUpdate,  eyesExit },
+  { "QR Code",         qrEnter,     NULL,        qrExit },
+  { "moeda",           coinEnter,   NULL,        rewardExit },
+  { "tesouro pilhado", lootedEnter, NULL,        rewardExit },
+  { "admin",           adminEnter,  adminUpdate, adminExit },
+};
+
 // ============================================
-// TASK AUTO-CLEAR (Limpa display após 5s)
+// TASKS DA TELA
 // ============================================
+//
+//   ingest  (UART/USB) ──tagQueue──► storage (TagStore) ──sceneQueue──► render
+//   input   (touch)    ──touchQueue────────────────────────────────────► render
+//
+// Só a task render desenha (TFT, RoboEyes, cenas, timers); as outras se
+// falam por filas de eventos de tamanho fixo (EventQueue.h) e acordam a
+// render com pacer.wake(). Uma busca lenta no NVS, uma listagem de tags ou
+// um readStringUntil() esperando o fim da linha não seguram mais os olhos.
+
+#ifndef RENDER_TASK_STACK
+  #define RENDER_TASK_STACK 8192
+#endif
+#ifndef INGEST_TASK_STACK
+  #define INGEST_TASK_STACK 5120
+#endif
+#ifndef STORAGE_TASK_STACK
+  #define STORAGE_TASK_STACK 5120
+#endif
+#ifndef INPUT_TASK_STACK
+  #define INPUT_TASK_STACK 3072
+#endif
+
+// Ingest sem onReceive (rede de segurança)
+#ifndef INGEST_IDLE_MS
+  #define INGEST_IDLE_MS 100
+#endif
+
+// Gravação de toques pendentes e backup periódico
+#ifndef STORAGE_MAINTAIN_MS
+  #define STORAGE_MAINTAIN_MS 100
+#endif
+
+// Intervalo do relatório "🧵 Tasks" (0 = só com CMD|TASKS)
+#ifndef TASK_STATS_INTERVAL_MS
+  #define TASK_STATS_INTERVAL_MS 10000
+#endif
 
-unsigned long tagDisplayTime = 0;
-const unsigned long TAG_DISPLAY_DURATION = 5000; // 5 segundos
+/**
+ * Relatório de CPU/pilha por task, ocupação das filas e ritmo dos olhos
+ * (task de armazenamento: o Serial lento não atrasa quadros)
+ */
+void logTaskStats(bool force) {
+  static unsigned long lastLog = 0;
+  if (!force && (TASK_STATS_INTERVAL_MS == 0 || millis() - lastLog < TASK_STATS_INTERVAL_MS)) return;
+  lastLog = millis();
+  
+  taskMonitor.report(Serial);
+  
+  EventQueue<TagEvent, TAG_QUEUE_DEPTH>::Stats tags = tagQueue.getStats();
+  EventQueue<TagEvent, TAG_QUEUE_DEPTH>::Stats scene = sceneQueue.getStats();
+  EventQueue<TouchEvent, TOUCH_QUEUE_DEPTH>::Stats touches = touchQueue.getStats();
+  Serial.printf("   filas (pico/tamanho, descartados): tags %u/%u %lu, tela %u/%u %lu, toque %u/%u %lu\n",
+                tags.peak, tags.depth, (unsigned long)tags.dropped,
+                scene.peak, scene.depth, (unsigned long)scene.dropped,
+                touches.peak, touches.depth, (unsigned long)touches.dropped);
+  
+  // Sem toque o XPT2046 fica quieto: leituras ociosas devem ser 0
+  TouchService<TFT_eTouch<TFT_eSPI> >::Stats pen = touchService.getStats();
+  Serial.printf("   toque: %lu toques (%lu tap, %lu longo, %lu arraste, %lu ignorado), "
+                "SPI %lu leituras, ociosas %lu\n",
+                (unsigned long)pen.presses, (unsigned long)pen.taps,
+                (unsigned long)pen.longPresses, (unsigned long)pen.swipes,
+                (unsigned long)pen.ignored, (unsigned long)pen.reads,
+                (unsigned long)pen.idleReads);
+  
+  // Olhos a 50 fps durante o backup: fps aqui + backup "gravando"
+  TagBackupSD::Progress backup = tagBackup.progress();
+  const char* backupState = "parado";
+  if (backup.state == TagBackupSD::BACKUP_RUNNING) backupState = "gravando";
+  else if (backup.state == TagBackupSD::BACKUP_DONE) backupState = "ok";
+  else if (backup.state == TagBackupSD::BACKUP_FAILED) backupState = "falhou";
+  Serial.printf("   olhos %.1f fps (%s), backup SD %s %u%%\n",
+                roboEyes.getRenderStats().fps,
+                scenes.current() == EYES_MODE ? "na tela" : "fora da tela",
+                backupState, backup.percent());
+}
 
-void checkAutoClear() {
-  if (tagPresent && tagDisplayTime > 0) {
-    if (millis() - tagDisplayTime > TAG_DISPLAY_DURATION) {
-      clearDisplay();
-      tagDisplayTime = 0;
+/**
+ * Cenas, olhos e timeouts; dorme até o próximo quadro/timeout ou até
+ * chegar um evento (núcleo 1)
+ */
+void renderTask(void* arg) {
+  pacer.begin();
+  timers.begin();
+  scenes.begin(SCENES, EYES_MODE, prepareScene);
+  
+  TagEvent tag;
+  TouchEvent touchEvent;
+  for (;;) {
+    uint32_t sleepMs;
+    {
+      TaskMonitor::Busy busy(taskMonitor, TASK_RENDER);
+      while (sceneQueue.receive(tag)) showTagEvent(tag);
+      while (touchQueue.receive(touchEvent)) handleTouch(touchEvent);
+      
+      // Timeouts vencidos (QR Code 3 min, recompensa 1 min, admin 30 s,
+      // baú, humor): cada um chama o seu callback
+      timers.poll();
+      
+      // Cena atual: trocas agendadas e animação dos olhos, sem bloquear.
+      // Dorme até o próximo quadro/piscada, troca de cena ou timeout
+      sleepMs = min<uint32_t>(PACER_MAX_SLEEP_MS, scenes.tick());
+      sleepMs = min<uint32_t>(sleepMs, timers.nextIn());
     }
+    pacer.sleep(sleepMs);
+  }
+}
+
+/**
+ * Linhas da UART do Reader e da USB, transferências do TagSync
+ */
+void ingestTask(void* arg) {
+  for (;;) {
+    // Acordada pelo onReceive; durante exportação/importação, a cada 1 ms
+    bool syncing = tagSync.currentMode() != TagSync::SYNC_IDLE;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(syncing ? 1 : INGEST_IDLE_MS));
+    
+    TaskMonitor::Busy busy(taskMonitor, TASK_INGEST);
+    checkUARTMessages();
+    checkSerialCommands();
+    tagSync.poll();
   }
 }
 
+void wakeIngest() {
+  TaskHandle_t ingest = taskMonitor.handle(TASK_INGEST);
+  if (ingest) xTaskNotifyGive(ingest);
+}
+
+/**
+ * Verifica as tags no TagStore e manda o veredito para a tela; grava
+ * toques pendentes e agenda o backup periódico
+ */
+void storageTask(void* arg) {
+  TagEvent event;
+  for (;;) {
+    bool received = tagQueue.receive(event, pdMS_TO_TICKS(STORAGE_MAINTAIN_MS));
+    
+    TaskMonitor::Busy busy(taskMonitor, TASK_STORAGE);
+    if (received) {
+      checkTag(event);
+      if (sceneQueue.send(event, pdMS_TO_TICKS(TAG_QUEUE_WAIT_MS))) {
+        pacer.wake();
+      } else {
+        Serial.println("⚠️ Fila da tela cheia - tag descartada");
+      }
+    }
+    
+    tagStore.maintain();
+    tagBackup.maintain();
+    
+    bool requested = taskReportRequested;
+    taskReportRequested = false;
+    logTaskStats(requested);
+  }
+}
+
+/**
+ * Touch: dorme até o T_IRQ; com a tela tocada amostra a cada
+ * TOUCH_SAMPLE_MS e manda os gestos para a tela
+ */
+void inputTask(void* arg) {
+  TouchEvent event;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, touchService.nextWait());
+    TaskMonitor::Busy busy(taskMonitor, TASK_INPUT);
+    if (touchService.poll(event) && touchQueue.send(event)) pacer.wake();
+  }
+}
+
+/**
+ * Cria as filas e as tasks (fim do setup(): a render desenha a primeira cena)
+ */
+bool startDisplayTasks() {
+  if (!tagQueue.begin() || !sceneQueue.begin() || !touchQueue.begin()) return false;
+  
+  bool ok = true;
+  ok &= taskMonitor.start(TASK_RENDER,  renderTask,  "render",  RENDER_TASK_STACK,  3, 1);
+  ok &= taskMonitor.start(TASK_INGEST,  ingestTask,  "ingest",  INGEST_TASK_STACK,  2, 0);
+  ok &= taskMonitor.start(TASK_STORAGE, storageTask, "storage", STORAGE_TASK_STACK, 1, 0);
+  ok &= taskMonitor.start(TASK_INPUT,   inputTask,   "input",   INPUT_TASK_STACK,   3, 0);
+  touchTask = taskMonitor.handle(TASK_INPUT);
+  
+  // Tasks das classes: só a pilha no relatório
+  taskMonitor.watch("tag_backup");
+#if USE_LVGL
+  taskMonitor.watch("lvgl");
+#else
+  taskMonitor.watch("qr_cache");
+#endif
+  return ok;
+}
+
 // ============================================
 // SETUP
 // ============================================
@@ -1165,6 +1745,7 @@ void setup() {
   Serial.print(UART_RX_PIN);
   Serial.println(")...");
   
+  Serial1.setRxBufferSize(UART_RX_BUFFER_SIZE);   // antes do begin()
   Serial1.begin(115200, SERIAL_8N1, UART_RX_PIN, UART_TX_PIN);
   delay(100);
   
@@ -1189,6 +1770,21 @@ void setup() {
   
   tft.setSwapBytes(true);
   
+  // DMA + buffers de faixa das imagens de recompensa
+  tftDMA = imageBlitterBegin(tft);
+  memoryBudget.set(MEM_IMAGES, imageBandsBytes());
+  if (tftDMA) {
+    Serial.println("  ↳ DMA do TFT ativo para imagens");
+  } else {
+    Serial.println("  ⚠️ DMA indisponível: imagens com envio bloqueante");
+  }
+  assetRegistry.begin();
+#if !USE_LVGL
+  if (!qrCache.begin()) {
+    Serial.println("❌ ERRO: Falha ao criar a task do cache de QR Code!");
+  }
+#endif
+  
   // Configura gamma
   tft.writecommand(ILI9341_GAMMASET);
   tft.writedata(2);
@@ -1202,6 +1798,16 @@ void setup() {
                 tft.width(), tft.height(), tft.getRotation());
   Serial.printf("  └─ Heap livre: %d bytes\n", ESP.getFreeHeap());
   
+#if USE_SMOOTH_TEXT
+  // Fonte suave das mensagens (tabela de glifos na flash)
+  if (smoothText.begin(DejaVuSans20_vlw, DEJAVUSANS20_VLW_SIZE)) {
+    Serial.printf("🔤 Fonte suave: DejaVu Sans 20 px, %d bytes na flash, linha de %d px\n",
+                  DEJAVUSANS20_VLW_SIZE, smoothText.lineHeight());
+  } else {
+    Serial.println("⚠️ Fonte suave inválida - mensagens com a fonte GLCD");
+  }
+#endif
+  
   // Inicializa Touchscreen TFT_eTouch
   Serial.println("\n👆 Inicializando Touchscreen (TFT_eTouch)...");
   
@@ -1211,11 +1817,12 @@ void setup() {
   
   TFT_eTouchBase::Calibation calibation = { 233, 3785, 3731, 120, 2 };
   touch.setCalibration(calibation);
+  touchService.setScreenSize(tft.width(), tft.height());
   
-  touchEnabled = true;
   Serial.println("✅ Touchscreen TFT_eTouch inicializado!");
   Serial.println("  ├─ Biblioteca: TFT_eTouch (estável)");
   Serial.println("  ├─ Calibração: Automática");
+  Serial.printf("  ├─ Gestos: T_IRQ GPIO%d, amostra a cada %d ms com toque\n", TOUCH_IRQ, TOUCH_SAMPLE_MS);
   Serial.printf("  └─ Rotação: %d\n", tft.getRotation());
   
   // Inicializa RoboEyes
@@ -1231,6 +1838,16 @@ void setup() {
   roboEyes.setCuriosity(true);
   roboEyes.begin();
   roboEyes.setAutoblinker(true, 3, 4);  // Piscar a cada 3 segundos
+  Serial.printf("  ↳ Sprite %d bpp: %lu bytes\n", ROBOEYES_COLOR_DEPTH,
+                (unsigned long)roboEyes.spriteBytes());
+  // Envio por DMA: desenha o próximo quadro enquanto o anterior sai pelo SPI
+  if (roboEyes.beginDMA(tftDMA)) {
+    Serial.printf("  ↳ Envio por DMA (2 buffers de %u bytes)\n",
+                  (unsigned)(ROBOEYES_DMA_PIXELS * sizeof(uint16_t)));
+  } else {
+    Serial.println("  ⚠️ Olhos com envio bloqueante (pushSprite)");
+  }
+  memoryBudget.set(MEM_EYES, roboEyes.bufferBytes());
   Serial.println("✅ RoboEyes inicializado! Piscarão a cada 3s");
   
   // Inicializa gerador de números aleatórios
@@ -1241,7 +1858,7 @@ void setup() {
   lastMoodChange = millis();
   
   // ⭐ NOVO: Inicializa sistema de armazenamento
-  Serial.println("\n💾 Inicializando sistema de armazenamento (NVS)...");
+  Serial.printf("\n💾 Inicializando sistema de armazenamento (%s)...\n", tagStore.name());
   
   // Inicializa NVS Flash (CRÍTICO!)
   esp_err_t err = nvs_flash_init();
@@ -1254,9 +1871,14 @@ void setup() {
   ESP_ERROR_CHECK(err);
   Serial.println("✅ NVS Flash inicializado!");
   
-  prefs.begin(PREFS_NAMESPACE, true); // read-only para checar
-  int tagsCount = prefs.getInt(PREFS_COUNT_KEY, 0);
-  prefs.end();
+  if (!tagStore.begin()) {
+    Serial.println("❌ Falha ao inicializar armazenamento de tags!");
+  }
+  int tagsCount = tagStore.count();
+  
+  // Backup incremental no SD Card
+  tagBackup.begin(tagStore, hSPI, SDSPI_CS);
+  tagSync.begin(tagStore);
   
   Serial.printf("✅ Sistema de armazenamento pronto!\n");
   Serial.printf("📊 Total de tags lidas anteriormente: %d\n", tagsCount);
@@ -1265,6 +1887,20 @@ void setup() {
   // clearAllTags();
   // Serial.println("⚠️ Todas as tags foram limpas!");
   
+  reportMemory();
+  
+  // Tasks: render (núcleo 1, primeira cena: olhos), ingest, storage, input
+  Serial.println("\n🧵 Iniciando tasks...");
+  if (!startDisplayTasks()) {
+    Serial.println("❌ ERRO: Falha ao criar filas/tasks da tela!");
+  }
+  
+  // Entradas acordam as tasks: UART/USB → ingest, T_IRQ → input
+  Serial1.onReceive(wakeIngest);
+  Serial.onReceive(wakeIngest);
+  pinMode(TOUCH_IRQ, INPUT);
+  attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ), onTouchIrq, FALLING);
+  
   Serial.println("\n✅ Sistema pronto!");
   Serial.println("⏳ Aguardando dados do Reader via UART...\n");
 }
@@ -1275,36 +1911,7 @@ void setup() {
 // ============================================
 
 void loop() {
-  // Verifica toques na tela
-  handleTouch();
-  
-  // Verifica mensagens UART
-  checkUARTMessages();
-  
-  // Verifica timeout do QR Code (3 minutos)
-  checkQRCodeTimeout();
-  
-  // ⭐ NOVO: Verifica timeout da recompensa (1 minuto)
-  checkRewardTimeout();
-  
-  // ⭐ NOVO: Verifica timeout da mensagem de admin (30 segundos)
-  checkAdminMessageTimeout();
-  
-  // Auto-clear após timeout
-  checkAutoClear();
-  
-  // Atualiza display baseado no modo atual
-  if (currentMode == EYES_MODE) {
-    // Atualiza animação RoboEyes (humor só muda com toque)
-    roboEyes.update();
-    delay(10);    
-  } else if (currentMode == QRCODE_MODE) {
-    // Modo QR Code: processa LVGL
-    lv_timer_handler();
-    lv_tick_inc(5);
-    delay(5);
-  } else if (currentMode == COIN_MODE || currentMode == LOOTED_MODE) {
-    // ⭐ NOVO: Modos estáticos - não precisa atualizar
-    delay(50);
-  }
+  // Tudo roda nas tasks criadas no setup() (TASKS DA TELA): a loopTask do
+  // Arduino termina e devolve a pilha
+  vTaskDelete(NULL);
 }
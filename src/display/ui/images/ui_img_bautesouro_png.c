@@ -1,864 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.4
-// LVGL version: 8.3.11
-// Project name: PirateNFCReader
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/BauTesouro.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_bautesouro_png_data[] = {
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x43,0x29,0xFF,0xE2,0x18,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0xC2,0x18,0xFF,0x81,0x10,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,
-    0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,
-    0x81,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0xA0,0x18,0xFF,0xC0,0x20,0xFF,0xA0,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,
-    0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x80,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x20,0x29,0xFF,0xE6,0x6A,0xFF,0x44,0x52,0xFF,0xC0,0x20,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xC1,0x49,0xFF,0xF1,0xC5,0xFF,0x4B,0x94,0xFF,0x20,0x18,0xFF,
-    0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0xA0,0x18,0xFF,0x41,0x31,0xFF,0x07,0x6B,0xFF,0x44,0x52,0xFF,0xA0,0x20,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,
-    0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,
-    0x80,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x18,0xFF,0xC7,0x62,0xFF,0x26,0x4A,0xFF,0x40,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xC1,0x18,0xFF,0x00,0x10,0xFF,0x80,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x41,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x08,0xFF,0x81,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,
-    0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xC0,0x20,0xFF,0xA6,0x62,0xFF,0x24,0x4A,0xFF,0x80,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xC1,0x20,0xFF,0x41,0x31,0xFF,0x21,0x29,0xFF,0xC1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x60,0x10,0xFF,0x00,0x29,0xFF,0x60,0x39,0xFF,0xE0,0x20,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0xA0,0x20,0xFF,0xC0,0x28,0xFF,0x00,0x31,0xFF,
-    0xC0,0x20,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x10,0xFF,0x25,0x73,0xFF,0xCA,0xAC,0xFF,0xE2,0x49,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x10,0xFF,0x44,0x5A,0xFF,0x6D,0xBD,0xFF,0x6A,0x9C,0xFF,0x80,0x39,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,
-    0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x10,0xFF,0x84,0x62,0xFF,0xC7,0x8B,0xFF,0xA1,0x41,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x00,0x00,0xFF,0x47,0x7B,0xFF,0x91,0xDE,0xFF,0x0C,0xB5,0xFF,0x40,0x39,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,
-    0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x08,0xFF,0x60,0x18,0xFF,0x20,0x18,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x80,0x18,0xFF,0x61,0x39,0xFF,0x83,0x62,0xFF,0x22,0x52,0xFF,0xE0,0x28,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0xA0,0x18,0xFF,0x60,0x18,0xFF,0xA0,0x18,0xFF,
-    0xA0,0x18,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x61,0x10,0xFF,0x60,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xA1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,
-    0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x60,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA2,0x10,0xFF,
-    0x82,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x18,0xFF,0xA2,0x18,0xFF,0x82,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,
-    0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE1,0x20,0xFF,0xE0,0x28,0xFF,0x80,0x20,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,
-    0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x60,0x18,0xFF,0xE8,0x6A,0xFF,0x2D,0x8C,0xFF,0xE0,0x28,0xFF,0xE2,0x28,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,
-    0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x03,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xA0,0x20,0xFF,0x46,0x52,0xFF,
-    0x6A,0x73,0xFF,0x00,0x31,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x82,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x20,0xFF,0xA1,0x20,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x23,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x01,0x29,0xFF,0x00,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xA0,0x20,0xFF,0x40,0x18,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,
-    0x80,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0xA0,0x18,0xFF,0xC0,0x28,0xFF,0xC0,0x30,0xFF,0xE0,0x28,0xFF,0xA0,0x18,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x20,0xFF,0x43,0x39,0xFF,0x02,0x29,0xFF,0xC1,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,
-    0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x23,0x29,0xFF,0x01,0x29,0xFF,0x66,0x5A,0xFF,0x8A,0x7B,0xFF,0xA0,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x28,0xFF,0xE1,0x20,0xFF,0x01,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xA5,0x62,0xFF,0xAD,0xAC,0xFF,0x45,0x5A,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x20,0xFF,0x02,0x31,0xFF,0xE2,0x28,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x03,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,
-    0x22,0x29,0xFF,0x22,0x31,0xFF,0xA3,0x41,0xFF,0x05,0x4A,0xFF,0x01,0x29,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0xC0,0x20,0xFF,0xE9,0x6A,0xFF,0x05,0x4A,0xFF,0xE1,0x20,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x18,0xFF,0x06,0x73,0xFF,0x0E,0xB5,0xFF,0x45,0x5A,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xE1,0x28,0xFF,0xC0,0x28,0xFF,
-    0xC0,0x28,0xFF,0xE1,0x28,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x23,0x29,0xFF,0x03,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x01,0x29,0xFF,0xC4,0x41,0xFF,0x63,0x31,0xFF,0x02,0x29,0xFF,
-    0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xA1,0x10,0xFF,0xC0,0x20,0xFF,0x20,0x39,0xFF,0x60,0x41,0xFF,0x00,0x29,0xFF,0xA0,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x20,0xFF,0x61,0x39,0xFF,0xC9,0x83,0xFF,0x68,0x7B,0xFF,0x40,0x39,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,
-    0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0x80,0x18,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x02,0x29,0xFF,0x01,0x31,0xFF,0xC0,0x28,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,
-    0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xA1,0x10,0xFF,0xA0,0x18,0xFF,0xA0,0x18,0xFF,0x80,0x10,0xFF,0xA0,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0xA0,0x10,0xFF,0xA1,0x18,0xFF,0xC0,0x20,0xFF,0x22,0x52,0xFF,0xD4,0xDE,0xFF,0x53,0xCE,0xFF,0x80,0x41,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,
-    0x06,0x42,0xFF,0x2A,0x6B,0xFF,0xE0,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x03,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0xE5,0x49,0xFF,0x8B,0x7B,0xFF,0x00,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA0,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,
-    0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,
-    0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xE1,0x20,0xFF,0xC2,0x41,0xFF,0xC9,0x83,0xFF,0x89,0x7B,0xFF,0x40,0x39,0xFF,0xE1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC2,0x18,0xFF,0xE1,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xC1,0x20,0xFF,0x26,0x4A,0xFF,0x6B,0x73,0xFF,0xA0,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,
-    0x22,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x83,0x39,0xFF,0x46,0x52,0xFF,0x01,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xE1,0x28,0xFF,0xA0,0x28,0xFF,
-    0xA0,0x20,0xFF,0xE1,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xC1,0x20,0xFF,0x60,0x10,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0xE1,0x28,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,
-    0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,
-    0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x23,0x31,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xA0,0x18,0xFF,0x60,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x40,0x00,0xFF,0x60,0x08,0xFF,0xA0,0x10,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,
-    0x23,0x29,0xFF,0x03,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x83,0x31,0xFF,0x46,0x52,0xFF,0x42,0x31,0xFF,0x43,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x03,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xC1,0x20,0xFF,0xE2,0x20,0xFF,0x44,0x29,0xFF,0x85,0x31,0xFF,0x07,0x3A,0xFF,0x89,0x4A,0xFF,0x2B,0x63,0xFF,0x4B,0x6B,0xFF,0x6C,0x6B,0xFF,0x6B,0x73,0xFF,0x4B,0x73,0xFF,0xEA,0x6A,0xFF,0x68,0x52,0xFF,0xE6,0x41,0xFF,0x23,0x29,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0xA0,0x10,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,
-    0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x81,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,
-    0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x28,0xFF,0xE2,0x28,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x23,0x31,0xFF,0x43,0x31,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x43,0x31,0xFF,0xC4,0x41,0xFF,0x42,0x31,0xFF,0x43,0x31,0xFF,0x63,0x31,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x64,0x39,0xFF,
-    0x63,0x31,0xFF,0x23,0x31,0xFF,0x02,0x29,0xFF,0xE1,0x20,0xFF,0xC0,0x20,0xFF,0x80,0x18,0xFF,0x80,0x18,0xFF,0xA0,0x18,0xFF,0xC0,0x20,0xFF,0xA0,0x20,0xFF,0x40,0x18,0xFF,0x80,0x18,0xFF,0xC1,0x20,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE1,0x20,0xFF,0x23,0x21,0xFF,0xC6,0x31,0xFF,0x07,0x3A,0xFF,0x69,0x4A,0xFF,0xA9,0x4A,0xFF,0xCA,0x52,0xFF,0xCA,0x52,0xFF,0xEB,0x52,0xFF,0x2C,0x63,0xFF,0x6C,0x73,0xFF,0xEE,0x83,0xFF,0x4F,0x8C,0xFF,0x6F,0x9C,0xFF,0xB0,0xA4,0xFF,0xB0,0xA4,0xFF,0x90,0xA4,0xFF,0x0E,0x94,0xFF,0x2B,0x73,0xFF,0x68,0x52,0xFF,0x02,0x21,0xFF,0x00,0x00,0xFF,0x60,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,
-    0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x28,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x84,0x39,0xFF,0x84,0x39,0xFF,0x63,0x39,0xFF,0xA4,0x39,0xFF,0xA5,0x39,0xFF,0xE6,0x41,0xFF,0x47,0x4A,0xFF,0xCA,0x5A,0xFF,0x4C,0x6B,0xFF,0xEE,0x7B,0xFF,0xCD,0x83,0xFF,0xED,0x83,0xFF,0x0E,0x8C,0xFF,0x2E,0x8C,0xFF,0x2E,0x8C,0xFF,0x4B,0x73,0xFF,0x68,0x52,0xFF,0x84,0x39,0xFF,0xC0,0x20,0xFF,0xA0,0x18,0xFF,
-    0x02,0x21,0xFF,0x44,0x29,0xFF,0x07,0x42,0xFF,0xCA,0x5A,0xFF,0x0B,0x63,0xFF,0x0A,0x63,0xFF,0xA9,0x5A,0xFF,0x88,0x52,0xFF,0xA9,0x5A,0xFF,0x68,0x52,0xFF,0x06,0x4A,0xFF,0xC5,0x39,0xFF,0x64,0x31,0xFF,0xE2,0x20,0xFF,0x65,0x31,0xFF,0x48,0x52,0xFF,0x2B,0x6B,0xFF,0xEE,0x83,0xFF,0x2F,0x94,0xFF,0xED,0x83,0xFF,0xED,0x83,0xFF,0x0E,0x8C,0xFF,0xEE,0x83,0xFF,0x0A,0x6B,0xFF,0x44,0x31,0xFF,0x00,0x00,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x03,0x29,0xFF,
-    0x02,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0xE3,0x28,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x27,0x4A,0xFF,0xC9,0x5A,0xFF,0xA9,0x52,0xFF,0x68,0x52,0xFF,0x88,0x52,0xFF,0x68,0x4A,0xFF,0xA9,0x5A,0xFF,0xCA,0x5A,0xFF,0x4C,0x6B,0xFF,0x8C,0x73,0xFF,0x4F,0x94,0xFF,0xF1,0xA4,0xFF,0xF1,0xA4,0xFF,0xB1,0x9C,0xFF,0xB1,0x9C,0xFF,0xB1,0x9C,0xFF,0x4F,0x8C,0xFF,0x8D,0x7B,0xFF,0x8C,0x7B,0xFF,0x0E,0x94,0xFF,0x2E,0x9C,0xFF,0x4F,0x9C,0xFF,0xB0,0xA4,0xFF,0xB0,0xA4,0xFF,0xB0,0xA4,0xFF,0x8F,0xA4,0xFF,0x4E,0xA4,0xFF,0x6E,0xA4,0xFF,0x2D,0x9C,0xFF,0xAB,0x8B,0xFF,0x6A,0x83,0xFF,0x09,0x73,0xFF,0x88,0x62,0xFF,0xC5,0x49,0xFF,0xA1,0x20,0xFF,
-    0xC2,0x20,0xFF,0xE6,0x41,0xFF,0x4C,0x73,0xFF,0x4F,0x94,0xFF,0x6F,0x94,0xFF,0x4F,0x94,0xFF,0x0E,0x94,0xFF,0x2E,0x94,0xFF,0x2E,0x94,0xFF,0xEA,0x62,0xFF,0xC2,0x18,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x23,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x23,0x31,0xFF,0x43,0x31,0xFF,0x23,0x31,0xFF,
-    0x22,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xE1,0x20,0xFF,0xE1,0x28,0xFF,0x22,0x31,0xFF,0x83,0x39,0xFF,0xC5,0x41,0xFF,0x26,0x52,0xFF,0x67,0x52,0xFF,0xE9,0x62,0xFF,0x6B,0x73,0xFF,0x6B,0x73,0xFF,0x4B,0x73,0xFF,0x4B,0x73,0xFF,0x2A,0x73,0xFF,0x0A,0x6B,0xFF,0xA8,0x5A,0xFF,0x26,0x4A,0xFF,0x84,0x39,0xFF,0x44,0x31,0xFF,0x85,0x39,0xFF,0x89,0x52,0xFF,0x4C,0x6B,0xFF,0xAD,0x7B,0xFF,0xCE,0x7B,0xFF,0xEE,0x7B,0xFF,0xEE,0x83,0xFF,0x0F,0x8C,0xFF,0x70,0x9C,0xFF,0xF1,0xAC,0xFF,0xB0,0xB4,0xFF,0x6E,0xAC,0xFF,0x8E,0xAC,0xFF,0x8E,0xAC,0xFF,0x8D,0xAC,0xFF,0xAE,0xB4,0xFF,0xAE,0xBC,0xFF,0xCE,0xBC,0xFF,0x8D,0xB4,0xFF,0x8D,0xB4,0xFF,0x6D,0xB4,0xFF,0x6D,0xB4,0xFF,0x6D,0xAC,0xFF,0x2D,0xA4,0xFF,0xAB,0x8B,0xFF,0x88,0x62,0xFF,0x84,0x39,0xFF,0x44,0x31,0xFF,0x47,0x52,0xFF,0xAD,0x83,0xFF,0x90,0x9C,0xFF,0x4F,0x9C,0xFF,0xEE,0x8B,0xFF,0xAD,0x83,0xFF,0x0E,0x94,0xFF,0xCD,0x83,0xFF,0xE6,0x41,0xFF,0x00,0x00,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x80,0x10,0xFF,
-    0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA2,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xA1,0x18,0xFF,0x80,0x18,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x03,0x21,0xFF,0xA6,0x31,0xFF,0x03,0x21,0xFF,0xE1,0x20,0xFF,0xE1,0x20,0xFF,0xE2,0x28,0xFF,0x43,0x31,0xFF,0x64,0x31,0xFF,0x43,0x31,0xFF,0xE1,0x28,0xFF,0x80,0x20,0xFF,0xC1,0x20,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0xE2,0x28,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xA1,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x28,0xFF,0x23,0x31,0xFF,0x64,0x39,0xFF,0x84,0x41,0xFF,0xE6,0x49,0xFF,0x67,0x5A,0xFF,0x88,0x62,0xFF,0xE9,0x6A,0xFF,0x2A,0x73,0xFF,0x6B,0x7B,0xFF,0xAC,0x83,0xFF,0xED,0x93,0xFF,0x4E,0x9C,0xFF,0x6E,0x9C,0xFF,0xAF,0xA4,0xFF,0xD0,0xAC,0xFF,0x10,0xB5,0xFF,0x11,0xB5,0xFF,0x11,0xB5,0xFF,0xF0,0xB4,0xFF,0xF0,0xB4,0xFF,
-    0xAF,0xAC,0xFF,0x6E,0xAC,0xFF,0x4D,0xA4,0xFF,0x6E,0xA4,0xFF,0x6E,0xA4,0xFF,0x4D,0x9C,0xFF,0x8A,0x83,0xFF,0x87,0x62,0xFF,0x23,0x31,0xFF,0x64,0x31,0xFF,0x27,0x4A,0xFF,0x2B,0x6B,0xFF,0x8D,0x7B,0xFF,0xAD,0x7B,0xFF,0xEE,0x83,0xFF,0xEE,0x8B,0xFF,0x2F,0x94,0xFF,0x8F,0xA4,0xFF,0xAF,0xB4,0xFF,0x8E,0xB4,0xFF,0xAD,0xBC,0xFF,0xCE,0xBC,0xFF,0xEF,0xC4,0xFF,0xEE,0xC4,0xFF,0xEE,0xC4,0xFF,0xAD,0xBC,0xFF,0x4C,0xB4,0xFF,0x8D,0xBC,0xFF,0x8D,0xBC,0xFF,0x8D,0xBC,0xFF,0xAE,0xBC,0xFF,0xCE,0xBC,0xFF,0x6D,0xAC,0xFF,0xEC,0x9B,0xFF,0xC8,0x6A,0xFF,0x84,0x41,0xFF,0x64,0x39,0xFF,0xC9,0x62,0xFF,0x2E,0x94,0xFF,0x2E,0x94,0xFF,0xCD,0x8B,0xFF,0xCD,0x83,0xFF,0x0E,0x94,0xFF,0x0E,0x8C,0xFF,0x89,0x52,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xE2,0x20,0xFF,0xE1,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE2,0x20,0xFF,
-    0xC6,0x39,0xFF,0x48,0x4A,0xFF,0x8A,0x52,0xFF,0xEB,0x62,0xFF,0xAE,0x73,0xFF,0xCF,0x7B,0xFF,0xCE,0x7B,0xFF,0x0F,0x84,0xFF,0x70,0x94,0xFF,0x50,0x94,0xFF,0xEE,0x8B,0xFF,0xAD,0x7B,0xFF,0x8D,0x7B,0xFF,0x8D,0x7B,0xFF,0x2B,0x6B,0xFF,0x48,0x52,0xFF,0x23,0x31,0xFF,0x02,0x31,0xFF,0x44,0x39,0xFF,0xA4,0x41,0xFF,0x06,0x4A,0xFF,0x47,0x5A,0xFF,0x88,0x62,0xFF,0xE9,0x6A,0xFF,0x4B,0x7B,0xFF,0xAC,0x8B,0xFF,0xED,0x93,0xFF,0x0D,0x94,0xFF,0x4E,0x9C,0xFF,0x6E,0xA4,0xFF,0x6E,0xAC,0xFF,0x8F,0xAC,0xFF,0xAF,0xB4,0xFF,0xAF,0xB4,0xFF,0xD0,0xB4,0xFF,0xCF,0xAC,0xFF,0xF0,0xB4,0xFF,0xF0,0xB4,0xFF,0xF0,0xB4,0xFF,0xAF,0xB4,0xFF,0xCF,0xB4,0xFF,0xAF,0xAC,0xFF,0x8E,0xAC,0xFF,0x6E,0xAC,0xFF,0x6E,0xAC,0xFF,0xAE,0xB4,0xFF,0xCE,0xB4,0xFF,0xEF,0xBC,0xFF,0x0F,0xC5,0xFF,0x0F,0xC5,0xFF,0xEE,0xBC,0xFF,0xEE,0xC4,0xFF,0x0E,0xC5,0xFF,0x2F,0xC5,0xFF,0x2F,0xC5,0xFF,0x0F,0xC5,0xFF,0x8E,0xAC,0xFF,0xE9,0x72,0xFF,0x23,0x31,0xFF,0x24,0x31,0xFF,0x48,0x52,0xFF,0x8D,0x7B,0xFF,0x2F,0x94,0xFF,0x50,0x94,0xFF,
-    0x70,0x9C,0xFF,0x70,0x9C,0xFF,0x6F,0xA4,0xFF,0xAF,0xAC,0xFF,0xEF,0xBC,0xFF,0x8D,0xBC,0xFF,0x8D,0xBC,0xFF,0x6C,0xBC,0xFF,0x6C,0xB4,0xFF,0x6C,0xB4,0xFF,0x8C,0xBC,0xFF,0x0E,0xCD,0xFF,0x70,0xD5,0xFF,0x70,0xD5,0xFF,0x30,0xCD,0xFF,0x30,0xCD,0xFF,0x0F,0xC5,0xFF,0x8D,0xB4,0xFF,0x6D,0xAC,0xFF,0xEC,0x93,0xFF,0x47,0x5A,0xFF,0xE2,0x28,0xFF,0x07,0x4A,0xFF,0x0E,0x8C,0xFF,0x2F,0x9C,0xFF,0x0A,0x73,0xFF,0xB1,0xA4,0xFF,0xF1,0xAC,0xFF,0xD1,0xA4,0xFF,0x0B,0x6B,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x60,0x10,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x85,0x31,0xFF,0x85,0x31,0xFF,0x60,0x10,0xFF,0x00,0x08,0xFF,0x44,0x31,0xFF,0x23,0x29,0xFF,0xA0,0x18,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x80,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0x80,0x18,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x20,0x08,0xFF,0x03,0x21,0xFF,0x07,0x3A,0xFF,0x69,0x4A,0xFF,0x49,0x42,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0xC7,0x31,0xFF,0x08,0x42,0xFF,0xCB,0x5A,0xFF,0x2C,0x6B,0xFF,0x0F,0x84,0xFF,0x91,0x94,0xFF,0x71,0x94,0xFF,0x0F,0x8C,0xFF,0x6D,0x7B,0xFF,0xCE,0x83,0xFF,0x71,0x94,0xFF,0x71,0x94,0xFF,
-    0x4F,0x94,0xFF,0x2E,0x94,0xFF,0x0E,0x9C,0xFF,0x2D,0x9C,0xFF,0x4E,0xA4,0xFF,0x4E,0xA4,0xFF,0x6F,0xAC,0xFF,0x6F,0xAC,0xFF,0x8F,0xAC,0xFF,0xAF,0xB4,0xFF,0xAF,0xB4,0xFF,0xAF,0xB4,0xFF,0xAF,0xB4,0xFF,0x6D,0xAC,0xFF,0x6E,0xAC,0xFF,0x8E,0xB4,0xFF,0x8E,0xB4,0xFF,0x6D,0xAC,0xFF,0x8E,0xB4,0xFF,0xAF,0xB4,0xFF,0xCF,0xB4,0xFF,0xEF,0xBC,0xFF,0x10,0xBD,0xFF,0xCF,0xBC,0xFF,0x0F,0xBD,0xFF,0xEF,0xBC,0xFF,0xCE,0xBC,0xFF,0xEF,0xC4,0xFF,0x0F,0xC5,0xFF,0x0F,0xC5,0xFF,0xCE,0xBC,0xFF,0xCE,0xC4,0xFF,0xEE,0xC4,0xFF,0x0E,0xC5,0xFF,0x0E,0xC5,0xFF,0x90,0xD5,0xFF,0x90,0xD5,0xFF,0xB1,0xDD,0xFF,0xD1,0xDD,0xFF,0xD1,0xDD,0xFF,0x90,0xD5,0xFF,0x2F,0xC5,0xFF,0x2C,0xA4,0xFF,0x67,0x6A,0xFF,0xA1,0x20,0xFF,0xA5,0x41,0xFF,0xAD,0x83,0xFF,0x70,0x9C,0xFF,0x70,0x9C,0xFF,0xF1,0xAC,0xFF,0x90,0xA4,0xFF,0x4E,0x9C,0xFF,0x8F,0xAC,0xFF,0xEF,0xBC,0xFF,0xEE,0xC4,0xFF,0x2F,0xCD,0xFF,0x70,0xD5,0xFF,0x4F,0xCD,0xFF,0x91,0xD5,0xFF,0x91,0xD5,0xFF,0xB2,0xD5,0xFF,0x71,0xCD,0xFF,0xEF,0xBC,0xFF,0x30,0xC5,0xFF,
-    0x10,0xC5,0xFF,0xCF,0xBC,0xFF,0x8E,0xB4,0xFF,0xAB,0x93,0xFF,0xA8,0x6A,0xFF,0x02,0x31,0xFF,0xA1,0x20,0xFF,0xA5,0x41,0xFF,0x4F,0x9C,0xFF,0x8F,0xA4,0xFF,0xED,0x8B,0xFF,0xCC,0x8B,0xFF,0x8F,0xA4,0xFF,0x32,0xB5,0xFF,0x0B,0x6B,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,
-    0xA0,0x18,0xFF,0x80,0x10,0xFF,0x20,0x10,0xFF,0x00,0x08,0xFF,0x60,0x10,0xFF,0x24,0x21,0xFF,0x08,0x3A,0xFF,0x8A,0x4A,0xFF,0xEA,0x5A,0xFF,0x8D,0x73,0xFF,0x0E,0x84,0xFF,0x0E,0x84,0xFF,0x2F,0x8C,0xFF,0x4F,0x94,0xFF,0x6F,0x94,0xFF,0x4F,0x94,0xFF,0xCD,0x83,0xFF,0x6C,0x73,0xFF,0x27,0x4A,0xFF,0xA0,0x18,0xFF,0x60,0x18,0xFF,0xE0,0x20,0xFF,0x02,0x29,0xFF,0x64,0x39,0xFF,0xC5,0x41,0xFF,0x06,0x4A,0xFF,0x06,0x52,0xFF,0x06,0x4A,0xFF,0x47,0x52,0xFF,0xC9,0x62,0xFF,0x2B,0x6B,0xFF,0x4C,0x73,0xFF,0x6C,0x73,0xFF,0x8C,0x7B,0xFF,0xEE,0x83,0xFF,0xEE,0x83,0xFF,0x6C,0x7B,0xFF,0xEA,0x6A,0xFF,0x48,0x52,0xFF,0xC6,0x39,0xFF,0x65,0x29,0xFF,0xE7,0x39,0xFF,0xCB,0x5A,0xFF,0xAE,0x7B,0xFF,0xEF,0x83,0xFF,0xCE,0x83,0xFF,0xEF,0x83,0xFF,0x30,0x8C,0xFF,0x50,0x94,0xFF,0x91,0xA4,0xFF,0xB0,0xAC,0xFF,0xD0,0xB4,0xFF,0x6F,0xAC,0xFF,0x2D,0xA4,0xFF,0x0D,0x9C,0xFF,0xCC,0x9B,0xFF,0xEC,0x9B,0xFF,0x0C,0xA4,0xFF,0x2C,0xA4,0xFF,0x2C,0xA4,0xFF,0x2C,0xAC,0xFF,0x0B,0xAC,0xFF,0x2B,0xAC,0xFF,0x6C,0xB4,0xFF,
-    0xEE,0xC4,0xFF,0x2F,0xCD,0xFF,0x30,0xCD,0xFF,0x50,0xCD,0xFF,0x50,0xCD,0xFF,0x2F,0xC5,0xFF,0x30,0xCD,0xFF,0x50,0xCD,0xFF,0x4F,0xCD,0xFF,0x2F,0xCD,0xFF,0x2F,0xCD,0xFF,0x2E,0xCD,0xFF,0x2F,0xCD,0xFF,0x0E,0xCD,0xFF,0xCD,0xC4,0xFF,0xEE,0xCC,0xFF,0x0E,0xCD,0xFF,0x2E,0xCD,0xFF,0x2E,0xCD,0xFF,0xB0,0xDD,0xFF,0xD0,0xDD,0xFF,0xB0,0xDD,0xFF,0xB0,0xD5,0xFF,0x6F,0xD5,0xFF,0x4E,0xCD,0xFF,0x4F,0xCD,0xFF,0x6F,0xD5,0xFF,0x4F,0xCD,0xFF,0xCB,0x93,0xFF,0x43,0x39,0xFF,0x64,0x39,0xFF,0x8C,0x83,0xFF,0xB1,0xAC,0xFF,0x0E,0x94,0xFF,0x2A,0x7B,0xFF,0x32,0xBD,0xFF,0x31,0xB5,0xFF,0x8E,0xAC,0xFF,0x91,0xD5,0xFF,0xB1,0xD5,0xFF,0x70,0xCD,0xFF,0xEF,0xBC,0xFF,0x8E,0xB4,0xFF,0x0C,0xA4,0xFF,0xEC,0x9B,0xFF,0xEB,0x9B,0xFF,0xEB,0x9B,0xFF,0x4D,0xAC,0xFF,0x8E,0xAC,0xFF,0xAE,0xB4,0xFF,0x8D,0xAC,0xFF,0xEB,0x9B,0xFF,0x6A,0x8B,0xFF,0xC8,0x72,0xFF,0x84,0x41,0xFF,0x81,0x20,0xFF,0xE6,0x49,0xFF,0x8F,0xA4,0xFF,0xAF,0xA4,0xFF,0x4E,0x9C,0xFF,0x4E,0x9C,0xFF,0xF0,0xB4,0xFF,0x52,0xBD,0xFF,0x2B,0x73,0xFF,
-    0x00,0x00,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0xC2,0x18,0xFF,0x28,0x42,0xFF,0xCB,0x52,0xFF,0xCF,0x6B,0xFF,0x52,0x7C,0xFF,0x92,0x84,0xFF,0xB3,0x84,0xFF,0xD3,0x94,0xFF,0xB2,0x94,0xFF,0x30,0x8C,0xFF,0x2F,0x8C,0xFF,0x90,0x94,0xFF,0x6F,0x94,0xFF,0x70,0x94,0xFF,0x70,0x94,0xFF,
-    0x90,0x9C,0xFF,0xB1,0x9C,0xFF,0x90,0x9C,0xFF,0x70,0x94,0xFF,0x70,0x94,0xFF,0x2E,0x94,0xFF,0xED,0x93,0xFF,0x0D,0x9C,0xFF,0x4E,0xA4,0xFF,0x4E,0xA4,0xFF,0x4F,0xA4,0xFF,0x2E,0xA4,0xFF,0x4E,0xA4,0xFF,0x4E,0x9C,0xFF,0x4F,0x9C,0xFF,0x4F,0x9C,0xFF,0x4F,0x9C,0xFF,0x6F,0xA4,0xFF,0x6F,0xA4,0xFF,0x90,0xA4,0xFF,0x6F,0xA4,0xFF,0x6F,0x9C,0xFF,0x4F,0x9C,0xFF,0xCD,0x8B,0xFF,0xCA,0x62,0xFF,0xA5,0x39,0xFF,0x03,0x21,0xFF,0xA6,0x31,0xFF,0xCA,0x5A,0xFF,0x4C,0x73,0xFF,0x8D,0x7B,0xFF,0xCE,0x83,0xFF,0xEE,0x83,0xFF,0xCE,0x83,0xFF,0x8C,0x83,0xFF,0x0E,0x94,0xFF,0x2E,0x9C,0xFF,0xEC,0x9B,0xFF,0xEC,0x9B,0xFF,0x2D,0xA4,0xFF,0x2C,0xA4,0xFF,0x6D,0xAC,0xFF,0x8D,0xB4,0xFF,0x6C,0xB4,0xFF,0x8C,0xBC,0xFF,0xAD,0xC4,0xFF,0xCD,0xC4,0xFF,0x0D,0xC5,0xFF,0x4F,0xD5,0xFF,0x6F,0xD5,0xFF,0x6F,0xD5,0xFF,0x4F,0xCD,0xFF,0x4F,0xCD,0xFF,0x2E,0xCD,0xFF,0x8F,0xD5,0xFF,0x8F,0xD5,0xFF,0x8F,0xD5,0xFF,0x8F,0xD5,0xFF,0x6F,0xD5,0xFF,0x8F,0xDD,0xFF,0xB0,0xDD,0xFF,0x8F,0xDD,0xFF,0x6F,0xD5,0xFF,0x6F,0xD5,0xFF,
-    0x8F,0xDD,0xFF,0xD0,0xE5,0xFF,0x11,0xE6,0xFF,0x32,0xEE,0xFF,0x32,0xEE,0xFF,0x11,0xE6,0xFF,0xD0,0xDD,0xFF,0xB0,0xDD,0xFF,0x8F,0xDD,0xFF,0xD0,0xDD,0xFF,0xB0,0xDD,0xFF,0x90,0xD5,0xFF,0x0F,0xC5,0xFF,0x8B,0x8B,0xFF,0x02,0x31,0xFF,0x23,0x39,0xFF,0x8C,0x83,0xFF,0xB0,0xAC,0xFF,0x6B,0x83,0xFF,0x2E,0x94,0xFF,0x31,0xB5,0xFF,0x2D,0x9C,0xFF,0xF0,0xBC,0xFF,0x0C,0x9C,0xFF,0xCA,0x9B,0xFF,0x8D,0xB4,0xFF,0xCE,0xBC,0xFF,0x0F,0xC5,0xFF,0xB1,0xD5,0xFF,0x12,0xE6,0xFF,0x32,0xE6,0xFF,0x52,0xEE,0xFF,0x52,0xEE,0xFF,0x32,0xE6,0xFF,0x90,0xD5,0xFF,0x0E,0xC5,0xFF,0x6D,0xB4,0xFF,0x8A,0x93,0xFF,0xA7,0x72,0xFF,0x83,0x41,0xFF,0xC1,0x20,0xFF,0x68,0x5A,0xFF,0xF1,0xAC,0xFF,0xB0,0xAC,0xFF,0x8F,0xA4,0xFF,0xF0,0xB4,0xFF,0x52,0xBD,0xFF,0x93,0xC5,0xFF,0x4B,0x73,0xFF,0x00,0x00,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,
-    0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0xC7,0x31,0xFF,0xEB,0x52,0xFF,0x4D,0x5B,0xFF,0x0D,0x53,0xFF,0x0D,0x4B,0xFF,0xAF,0x63,0xFF,0xEC,0x4A,0xFF,0xAB,0x42,0xFF,0xCC,0x4A,0xFF,0x0C,0x53,0xFF,0x2D,0x5B,0xFF,0x6D,0x6B,0xFF,0x4C,0x63,0xFF,0x8D,0x73,0xFF,0xEE,0x83,0xFF,0xAD,0x7B,0xFF,0xAD,0x7B,0xFF,0xEE,0x83,0xFF,0x2F,0x8C,0xFF,0x70,0x94,0xFF,0xB1,0x9C,0xFF,0xD1,0xA4,0xFF,0xB0,0xAC,0xFF,0xB0,0xAC,0xFF,0xD0,0xB4,0xFF,0x6F,0xA4,0xFF,0x0D,0x9C,0xFF,0x0D,0x9C,0xFF,0x0D,0x9C,0xFF,0x0D,0x9C,0xFF,0x0D,0x94,0xFF,0xED,0x93,0xFF,
-    0xED,0x93,0xFF,0xAC,0x8B,0xFF,0x8C,0x83,0xFF,0xED,0x93,0xFF,0x0E,0x94,0xFF,0x0E,0x9C,0xFF,0x2E,0x9C,0xFF,0x2E,0x9C,0xFF,0x2F,0x9C,0xFF,0xCD,0x8B,0xFF,0x89,0x5A,0xFF,0x24,0x29,0xFF,0x24,0x21,0xFF,0x89,0x52,0xFF,0xAE,0x7B,0xFF,0xAD,0x83,0xFF,0xCD,0x83,0xFF,0xCD,0x83,0xFF,0xAD,0x83,0xFF,0xAD,0x83,0xFF,0xEE,0x93,0xFF,0x2E,0x9C,0xFF,0xCB,0x9B,0xFF,0xEB,0xA3,0xFF,0x0B,0xA4,0xFF,0x2C,0xAC,0xFF,0xAD,0xBC,0xFF,0xED,0xC4,0xFF,0x2E,0xCD,0xFF,0x4E,0xD5,0xFF,0x2E,0xCD,0xFF,0x2E,0xCD,0xFF,0x2E,0xCD,0xFF,0x2E,0xCD,0xFF,0x8F,0xDD,0xFF,0xAF,0xDD,0xFF,0xAF,0xDD,0xFF,0x8F,0xDD,0xFF,0xD0,0xDD,0xFF,0xF1,0xE5,0xFF,0xF1,0xE5,0xFF,0xF0,0xDD,0xFF,0xD0,0xDD,0xFF,0xF0,0xE5,0xFF,0x31,0xE6,0xFF,0x11,0xE6,0xFF,0xF1,0xE5,0xFF,0xF1,0xE5,0xFF,0xB0,0xDD,0xFF,0x2E,0xCD,0xFF,0x4F,0xCD,0xFF,0x0E,0xC5,0xFF,0xEE,0xC4,0xFF,0x8C,0xB4,0xFF,0x2B,0xAC,0xFF,0x0A,0xA4,0xFF,0xA9,0x93,0xFF,0xAA,0x93,0xFF,0xEB,0x9B,0xFF,0x0B,0x9C,0xFF,0x2C,0xA4,0xFF,0xCB,0x93,0xFF,0x87,0x6A,0xFF,0x02,0x31,0xFF,
-    0x02,0x31,0xFF,0x8C,0x83,0xFF,0xD1,0xB4,0xFF,0x4E,0x9C,0xFF,0x2D,0x9C,0xFF,0x4E,0xA4,0xFF,0x8E,0xAC,0xFF,0x71,0xCD,0xFF,0xCE,0xBC,0xFF,0xAD,0xBC,0xFF,0xCE,0xBC,0xFF,0x0E,0xC5,0xFF,0xF1,0xDD,0xFF,0xD1,0xDD,0xFF,0x12,0xDE,0xFF,0xF1,0xDD,0xFF,0xF1,0xDD,0xFF,0xD1,0xDD,0xFF,0x2F,0xCD,0xFF,0x0E,0xC5,0xFF,0xCE,0xC4,0xFF,0x4C,0xB4,0xFF,0xAA,0x9B,0xFF,0x29,0x7B,0xFF,0xA4,0x41,0xFF,0x02,0x29,0xFF,0xC9,0x62,0xFF,0x11,0xB5,0xFF,0xAF,0xAC,0xFF,0x6E,0xA4,0xFF,0xF0,0xB4,0xFF,0x32,0xBD,0xFF,0x52,0xBD,0xFF,0x68,0x52,0xFF,0x00,0x00,0xFF,0xA2,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0xC7,0x31,0xFF,0x8A,0x4A,0xFF,0x4A,0x3A,0xFF,0xC8,0x29,0xFF,0xE9,0x29,0xFF,0x09,0x32,0xFF,0x2A,0x32,0xFF,0x6A,0x3A,0xFF,0x4A,0x3A,0xFF,0x6A,0x3A,0xFF,0x4A,0x3A,0xFF,0x09,0x3A,0xFF,0x2D,0x5B,0xFF,0xAF,0x6B,0xFF,0x4D,0x63,0xFF,0x4D,0x63,0xFF,0x4C,0x6B,0xFF,0x6D,0x6B,0xFF,0x8D,0x73,0xFF,0xCE,0x7B,0xFF,0xAD,0x73,0xFF,0x6D,0x73,0xFF,0xCE,0x83,0xFF,0xD1,0xA4,0xFF,0x6F,0x9C,0xFF,0x6B,0x83,0xFF,0x8C,0x8B,0xFF,0x4B,0x7B,0xFF,0x4B,0x7B,0xFF,0x0A,0x7B,0xFF,0xE9,0x72,0xFF,0x2A,0x7B,0xFF,0x4A,0x7B,0xFF,0xAC,0x8B,0xFF,0x2E,0x9C,0xFF,0x2E,0x9C,0xFF,0x2E,0x9C,0xFF,0x2E,0x9C,0xFF,0x4E,0x9C,0xFF,0x0D,0x94,0xFF,0xED,0x93,0xFF,0xAC,0x8B,0xFF,0xAC,0x8B,0xFF,0x8B,0x83,0xFF,0xE9,0x6A,0xFF,0xA5,0x41,0xFF,0x24,0x29,0xFF,0x89,0x5A,0xFF,0xAD,0x83,0xFF,
-    0xCD,0x8B,0xFF,0xAD,0x83,0xFF,0xAD,0x8B,0xFF,0xAC,0x83,0xFF,0xAC,0x83,0xFF,0xED,0x93,0xFF,0x4E,0xA4,0xFF,0x2C,0xAC,0xFF,0x8D,0xB4,0xFF,0xAD,0xC4,0xFF,0xEE,0xCC,0xFF,0x6F,0xD5,0xFF,0xB0,0xDD,0xFF,0xF1,0xE5,0xFF,0xF1,0xE5,0xFF,0x11,0xE6,0xFF,0x11,0xE6,0xFF,0x31,0xEE,0xFF,0x52,0xEE,0xFF,0x52,0xEE,0xFF,0x52,0xEE,0xFF,0x73,0xEE,0xFF,0x53,0xEE,0xFF,0x32,0xE6,0xFF,0x12,0xDE,0xFF,0xB1,0xD5,0xFF,0x4F,0xC5,0xFF,0xEE,0xBC,0xFF,0xAD,0xB4,0xFF,0x8D,0xAC,0xFF,0x2C,0xA4,0xFF,0x2B,0xA4,0xFF,0x4C,0xAC,0xFF,0xCE,0xB4,0xFF,0x0F,0xC5,0xFF,0x50,0xC5,0xFF,0x4F,0xCD,0xFF,0x70,0xCD,0xFF,0xB0,0xD5,0xFF,0xD1,0xDD,0xFF,0xF1,0xDD,0xFF,0x11,0xDE,0xFF,0xB0,0xDD,0xFF,0xB0,0xD5,0xFF,0x90,0xD5,0xFF,0x2E,0xCD,0xFF,0x8D,0xB4,0xFF,0x08,0x83,0xFF,0x83,0x41,0xFF,0x02,0x31,0xFF,0xAD,0x83,0xFF,0xD0,0xAC,0xFF,0xAF,0xAC,0xFF,0xF0,0xB4,0xFF,0x51,0xC5,0xFF,0xB3,0xCD,0xFF,0x30,0xBD,0xFF,0x4C,0xAC,0xFF,0xAD,0xBC,0xFF,0x2B,0xAC,0xFF,0x4C,0xAC,0xFF,0x2F,0xC5,0xFF,0x90,0xCD,0xFF,0x2F,0xC5,0xFF,
-    0x6C,0xAC,0xFF,0x4C,0xAC,0xFF,0x2E,0xCD,0xFF,0xCD,0xC4,0xFF,0xAD,0xBC,0xFF,0x8D,0xB4,0xFF,0x0B,0xA4,0xFF,0xCA,0x9B,0xFF,0x29,0x7B,0xFF,0x84,0x39,0xFF,0x00,0x18,0xFF,0x6B,0x7B,0xFF,0xF4,0xCD,0xFF,0xD0,0xAC,0xFF,0xD0,0xB4,0xFF,0xF0,0xB4,0xFF,0x52,0xBD,0xFF,0x53,0xBD,0xFF,0xE7,0x41,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x00,0x00,0xFF,0xE7,0x39,0xFF,0xAB,0x4A,0xFF,
-    0x08,0x32,0xFF,0xE8,0x31,0xFF,0xC8,0x31,0xFF,0xE8,0x31,0xFF,0x09,0x32,0xFF,0x29,0x3A,0xFF,0x49,0x3A,0xFF,0x6A,0x3A,0xFF,0x6A,0x42,0xFF,0x49,0x42,0xFF,0x08,0x3A,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0x49,0x42,0xFF,0x4D,0x63,0xFF,0x6D,0x6B,0xFF,0x8D,0x73,0xFF,0x4C,0x6B,0xFF,0x6D,0x73,0xFF,0x8D,0x73,0xFF,0x8D,0x73,0xFF,0xAE,0x7B,0xFF,0x6D,0x73,0xFF,0x2F,0x8C,0xFF,0xEE,0x8B,0xFF,0x0A,0x73,0xFF,0x2A,0x7B,0xFF,0xAC,0x8B,0xFF,0x0D,0x9C,0xFF,0x0D,0x9C,0xFF,0x0D,0x94,0xFF,0xCB,0x93,0xFF,0xCC,0x93,0xFF,0x0C,0x9C,0xFF,0x0C,0x9C,0xFF,0x0C,0xA4,0xFF,0x2D,0xA4,0xFF,0x2C,0xA4,0xFF,0xEB,0x9B,0xFF,0xCB,0x9B,0xFF,0xCB,0x9B,0xFF,0xAB,0x93,0xFF,0xCB,0x93,0xFF,0xAB,0x93,0xFF,0x49,0x7B,0xFF,0xE5,0x49,0xFF,0x23,0x29,0xFF,0x48,0x52,0xFF,0xAD,0x83,0xFF,0xED,0x8B,0xFF,0x2B,0x7B,0xFF,0x0A,0x73,0xFF,0x0E,0x9C,0xFF,0xF1,0xB4,0xFF,0x2D,0x9C,0xFF,0x4D,0xA4,0xFF,0x6D,0xAC,0xFF,0xCE,0xBC,0xFF,0x0E,0xCD,0xFF,0x6F,0xD5,0xFF,0x6F,0xD5,0xFF,0x6F,0xD5,0xFF,0x2E,0xCD,0xFF,0x2E,0xC5,0xFF,
-    0x0E,0xBD,0xFF,0x8C,0xAC,0xFF,0x2C,0xA4,0xFF,0x6C,0xAC,0xFF,0x8D,0xAC,0xFF,0x6D,0xAC,0xFF,0x4C,0xAC,0xFF,0x6C,0xAC,0xFF,0x8D,0xB4,0xFF,0xAD,0xB4,0xFF,0xED,0xBC,0xFF,0x2E,0xC5,0xFF,0xB0,0xD5,0xFF,0xB0,0xD5,0xFF,0xB0,0xD5,0xFF,0xD1,0xDD,0xFF,0xF1,0xDD,0xFF,0xF1,0xDD,0xFF,0xF1,0xDD,0xFF,0xF1,0xDD,0xFF,0xD0,0xDD,0xFF,0xF0,0xDD,0xFF,0x11,0xE6,0xFF,0xF1,0xDD,0xFF,0x11,0xE6,0xFF,0x51,0xEE,0xFF,0x11,0xE6,0xFF,0xF0,0xE5,0xFF,0xF0,0xE5,0xFF,0xD0,0xE5,0xFF,0xD0,0xE5,0xFF,0x0E,0xC5,0xFF,0x28,0x83,0xFF,0x02,0x31,0xFF,0xE1,0x28,0xFF,0x8C,0x83,0xFF,0x8F,0xA4,0xFF,0xF4,0xD5,0xFF,0xD3,0xD5,0xFF,0x92,0xCD,0xFF,0x92,0xCD,0xFF,0xCF,0xB4,0xFF,0xAA,0x9B,0xFF,0x4C,0xAC,0xFF,0x8C,0xB4,0xFF,0xCE,0xBC,0xFF,0x0E,0xC5,0xFF,0xEE,0xC4,0xFF,0xED,0xC4,0xFF,0xEE,0xC4,0xFF,0x4F,0xCD,0xFF,0xCD,0xC4,0xFF,0x0E,0xC5,0xFF,0xCE,0xBC,0xFF,0x6C,0xB4,0xFF,0xEA,0x9B,0xFF,0xAB,0x93,0xFF,0xA7,0x62,0xFF,0x00,0x18,0xFF,0x42,0x39,0xFF,0xB3,0xC5,0xFF,0x15,0xD6,0xFF,0x93,0xC5,0xFF,0x31,0xBD,0xFF,
-    0x52,0xBD,0xFF,0xD4,0xCD,0xFF,0x32,0xB5,0xFF,0x03,0x21,0xFF,0x20,0x00,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0x49,0x42,0xFF,0x0C,0x5B,0xFF,0x08,0x3A,0xFF,0x09,0x3A,0xFF,0x08,0x3A,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xC8,0x31,0xFF,0x09,0x3A,0xFF,0x29,0x3A,0xFF,0x29,0x3A,0xFF,0x08,0x32,0xFF,0x29,0x42,0xFF,0x28,0x3A,0xFF,0xE7,0x39,0xFF,0x08,0x3A,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xCF,0x7B,0xFF,
-    0xCF,0x7B,0xFF,0xAE,0x73,0xFF,0x6D,0x73,0xFF,0x4C,0x6B,0xFF,0x0C,0x63,0xFF,0x2C,0x6B,0xFF,0x0C,0x6B,0xFF,0x2B,0x6B,0xFF,0x6C,0x73,0xFF,0xCD,0x8B,0xFF,0x6B,0x83,0xFF,0x8B,0x8B,0xFF,0xCC,0x93,0xFF,0xCB,0x93,0xFF,0xAB,0x8B,0xFF,0x6A,0x8B,0xFF,0xAA,0x93,0xFF,0x0B,0xA4,0xFF,0x4C,0xAC,0xFF,0x6C,0xAC,0xFF,0x8D,0xB4,0xFF,0x6C,0xB4,0xFF,0x4C,0xAC,0xFF,0x2C,0xAC,0xFF,0x4D,0xAC,0xFF,0x6D,0xB4,0xFF,0xCE,0xBC,0xFF,0xCE,0xBC,0xFF,0x6D,0xAC,0xFF,0x8A,0x8B,0xFF,0xC4,0x49,0xFF,0x23,0x29,0xFF,0x27,0x52,0xFF,0xCD,0x8B,0xFF,0x8C,0x83,0xFF,0x26,0x5A,0xFF,0x6B,0x83,0xFF,0xF0,0xB4,0xFF,0xCC,0x93,0xFF,0x6E,0xA4,0xFF,0x4E,0xA4,0xFF,0xA7,0x72,0xFF,0x48,0x8B,0xFF,0xCA,0x9B,0xFF,0x0B,0xA4,0xFF,0x4C,0xAC,0xFF,0x6C,0xAC,0xFF,0xAD,0xBC,0xFF,0x0E,0xC5,0xFF,0x6F,0xCD,0xFF,0x6F,0xD5,0xFF,0x8F,0xD5,0xFF,0xB0,0xDD,0xFF,0xF1,0xE5,0xFF,0x11,0xE6,0xFF,0x11,0xE6,0xFF,0xF1,0xE5,0xFF,0xAF,0xDD,0xFF,0x6E,0xD5,0xFF,0xAF,0xD5,0xFF,0xB0,0xD5,0xFF,0x6F,0xCD,0xFF,0x4F,0xCD,0xFF,0x4F,0xCD,0xFF,
-    0x70,0xCD,0xFF,0x6F,0xCD,0xFF,0x2E,0xCD,0xFF,0x8F,0xDD,0xFF,0xD0,0xE5,0xFF,0x11,0xE6,0xFF,0x52,0xEE,0xFF,0x52,0xEE,0xFF,0xF0,0xE5,0xFF,0xD0,0xDD,0xFF,0xF0,0xE5,0xFF,0xAF,0xDD,0xFF,0x8F,0xD5,0xFF,0x4F,0xD5,0xFF,0xED,0xC4,0xFF,0x6C,0xB4,0xFF,0x69,0x93,0xFF,0xE4,0x51,0xFF,0xC1,0x28,0xFF,0x03,0x31,0xFF,0x8C,0x83,0xFF,0xD3,0xCD,0xFF,0x34,0xDE,0xFF,0x54,0xE6,0xFF,0xD3,0xD5,0xFF,0x72,0xCD,0xFF,0x8E,0xB4,0xFF,0x4C,0xB4,0xFF,0xAD,0xBC,0xFF,0x8C,0xB4,0xFF,0x2E,0xC5,0xFF,0x2E,0xCD,0xFF,0x4F,0xCD,0xFF,0x4F,0xCD,0xFF,0x0E,0xC5,0xFF,0x2F,0xC5,0xFF,0xCD,0xBC,0xFF,0x4C,0xAC,0xFF,0x4C,0xAC,0xFF,0x6D,0xAC,0xFF,0x2D,0xA4,0xFF,0xE8,0x72,0xFF,0x2E,0x94,0xFF,0x93,0xC5,0xFF,0xD3,0xD5,0xFF,0xB3,0xCD,0xFF,0x72,0xC5,0xFF,0x72,0xC5,0xFF,0x93,0xCD,0xFF,0xB3,0xCD,0xFF,0xF4,0xCD,0xFF,0xB0,0xA4,0xFF,0x00,0x00,0xFF,0x80,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,
-    0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0x8A,0x4A,0xFF,0x4D,0x63,0xFF,0x08,0x3A,0xFF,0x29,0x42,0xFF,0x29,0x42,0xFF,0xC8,0x39,0xFF,0xC7,0x39,0xFF,0x66,0x29,0xFF,0x87,0x29,0xFF,0xA7,0x31,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0x29,0x3A,0xFF,0x29,0x42,0xFF,0x29,0x42,0xFF,0x28,0x42,0xFF,0xE7,0x39,0xFF,0xE7,0x39,0xFF,0xE7,0x41,0xFF,0xE8,0x39,0xFF,0x29,0x42,0xFF,0x4D,0x6B,0xFF,0x0F,0x84,0xFF,0x4C,0x73,0xFF,0xEB,0x6A,0xFF,0xEB,0x62,0xFF,0x2C,0x73,0xFF,0x8D,0x7B,0xFF,0x6C,0x73,0xFF,0x2B,0x73,0xFF,0xED,0x8B,0xFF,0xAC,0x8B,0xFF,0x8A,0x8B,0xFF,0x6A,0x8B,0xFF,0xAB,0x93,0xFF,0xEB,0x9B,0xFF,
-    0x0B,0xA4,0xFF,0xAD,0xBC,0xFF,0x0E,0xC5,0xFF,0xEE,0xBC,0xFF,0xAD,0xB4,0xFF,0x8D,0xB4,0xFF,0x0C,0xA4,0xFF,0xEC,0x9B,0xFF,0xAA,0x93,0xFF,0x8A,0x93,0xFF,0x4D,0xAC,0xFF,0x8D,0xB4,0xFF,0x2C,0xA4,0xFF,0x6A,0x8B,0xFF,0x05,0x52,0xFF,0x02,0x29,0xFF,0x03,0x21,0xFF,0x68,0x5A,0xFF,0x0E,0x94,0xFF,0xAC,0x8B,0xFF,0x6B,0x83,0xFF,0x09,0x7B,0xFF,0xCC,0x93,0xFF,0xCC,0x93,0xFF,0x4E,0xA4,0xFF,0x8E,0xAC,0xFF,0x2B,0xAC,0xFF,0xCD,0xBC,0xFF,0xED,0xC4,0xFF,0xB0,0xDD,0xFF,0x11,0xE6,0xFF,0x11,0xEE,0xFF,0x31,0xEE,0xFF,0x11,0xE6,0xFF,0xF0,0xE5,0xFF,0xAF,0xDD,0xFF,0xAF,0xDD,0xFF,0xD0,0xDD,0xFF,0xB0,0xDD,0xFF,0xF0,0xDD,0xFF,0xD0,0xDD,0xFF,0x8F,0xD5,0xFF,0x6E,0xD5,0xFF,0x6F,0xD5,0xFF,0x4F,0xCD,0xFF,0x50,0xC5,0xFF,0x30,0xBD,0xFF,0x51,0xC5,0xFF,0x30,0xBD,0xFF,0x91,0xCD,0xFF,0x90,0xCD,0xFF,0x4F,0xCD,0xFF,0x0E,0xC5,0xFF,0x0E,0xC5,0xFF,0x4E,0xCD,0xFF,0x8F,0xD5,0xFF,0x6F,0xD5,0xFF,0x2E,0xCD,0xFF,0xAC,0xBC,0xFF,0xAB,0xBC,0xFF,0xAC,0xBC,0xFF,0xED,0xC4,0xFF,0xED,0xC4,0xFF,0xAC,0xBC,0xFF,
-    0x4B,0xAC,0xFF,0x69,0x8B,0xFF,0xE5,0x51,0xFF,0xE2,0x30,0xFF,0x43,0x39,0xFF,0x72,0xC5,0xFF,0xD3,0xD5,0xFF,0xD3,0xD5,0xFF,0x34,0xDE,0xFF,0x72,0xC5,0xFF,0x10,0xBD,0xFF,0x0F,0xBD,0xFF,0x4C,0xAC,0xFF,0x8D,0xB4,0xFF,0x8D,0xB4,0xFF,0xEE,0xBC,0xFF,0x50,0xC5,0xFF,0x70,0xCD,0xFF,0xB1,0xCD,0xFF,0xB1,0xCD,0xFF,0x13,0xD6,0xFF,0xF3,0xD5,0xFF,0xF3,0xD5,0xFF,0x92,0xCD,0xFF,0x8F,0xA4,0xFF,0xAC,0x83,0xFF,0x14,0xDE,0xFF,0xD3,0xD5,0xFF,0x30,0xBD,0xFF,0x92,0xCD,0xFF,0xD4,0xD5,0xFF,0xD3,0xCD,0xFF,0x93,0xC5,0xFF,0x72,0xC5,0xFF,0xB3,0xCD,0xFF,0xB3,0xC5,0xFF,0x6C,0x7B,0xFF,0x00,0x00,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0xC6,0x31,0xFF,0x2C,0x63,0xFF,0x29,0x3A,0xFF,0x29,0x3A,0xFF,0x49,0x42,0xFF,0x08,0x3A,0xFF,0xA7,0x31,0xFF,0x86,0x31,0xFF,0x66,0x29,0xFF,0x66,0x29,0xFF,0x87,0x29,0xFF,0x08,0x3A,0xFF,0xE8,0x31,0xFF,0x29,0x3A,0xFF,0x29,0x3A,0xFF,0x28,0x3A,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0xC7,0x39,0xFF,0xA6,0x39,0xFF,0xC7,0x39,0xFF,0x08,0x3A,0xFF,0xEC,0x5A,0xFF,0xCF,0x7B,0xFF,0x30,0x8C,0xFF,0x0B,0x6B,0xFF,0x07,0x52,0xFF,0x48,0x5A,0xFF,0x30,0x94,0xFF,0xF6,0xCD,0xFF,0x6C,0x7B,0xFF,0x4C,0x7B,0xFF,0x2E,0x9C,0xFF,0xAB,0x93,0xFF,0x0C,0xA4,0xFF,0x6D,0xAC,0xFF,0x8E,0xAC,0xFF,0x2C,0xA4,0xFF,0xCB,0x93,0xFF,0xAB,0x93,0xFF,0x8B,0x8B,0xFF,0x8B,0x8B,0xFF,0x4A,0x83,0xFF,0x2A,0x83,0xFF,0xCC,0x93,0xFF,0xCC,0x93,0xFF,0xCC,0x93,0xFF,0x4D,0xAC,0xFF,0x6D,0xAC,0xFF,0x8E,0xB4,0xFF,0x6D,0xAC,0xFF,0xCB,0x93,0xFF,0x66,0x62,0xFF,
-    0x02,0x29,0xFF,0xE2,0x20,0xFF,0x6C,0x7B,0xFF,0x6F,0xA4,0xFF,0xED,0x93,0xFF,0xCC,0x8B,0xFF,0xAC,0x8B,0xFF,0xCC,0x93,0xFF,0xEC,0x93,0xFF,0x31,0xC5,0xFF,0xCE,0xBC,0xFF,0xCD,0xC4,0xFF,0x0E,0xCD,0xFF,0x6F,0xD5,0xFF,0xB0,0xDD,0xFF,0xB0,0xDD,0xFF,0x8F,0xDD,0xFF,0xB0,0xDD,0xFF,0xAF,0xDD,0xFF,0x6F,0xD5,0xFF,0x4E,0xD5,0xFF,0x0D,0xCD,0xFF,0x0D,0xCD,0xFF,0x4E,0xD5,0xFF,0x8F,0xDD,0xFF,0x8F,0xDD,0xFF,0x4E,0xCD,0xFF,0x4C,0xAC,0xFF,0xB3,0xCD,0xFF,0x35,0xD6,0xFF,0x4F,0x9C,0xFF,0x12,0xB5,0xFF,0x52,0xBD,0xFF,0x92,0xC5,0xFF,0x51,0xC5,0xFF,0x51,0xC5,0xFF,0x51,0xC5,0xFF,0x30,0xC5,0xFF,0x0E,0xC5,0xFF,0xCD,0xBC,0xFF,0xAC,0xBC,0xFF,0xCD,0xBC,0xFF,0xCD,0xBC,0xFF,0xED,0xC4,0xFF,0xED,0xBC,0xFF,0x8C,0xB4,0xFF,0x6C,0xB4,0xFF,0x6C,0xAC,0xFF,0x4C,0xAC,0xFF,0x2C,0xA4,0xFF,0x6A,0x83,0xFF,0x67,0x62,0xFF,0x06,0x52,0xFF,0x4B,0x7B,0xFF,0x14,0xDE,0xFF,0x92,0xCD,0xFF,0x31,0xC5,0xFF,0x31,0xC5,0xFF,0x71,0xC5,0xFF,0x75,0xE6,0xFF,0x31,0xC5,0xFF,0x4C,0xA4,0xFF,0xEF,0xBC,0xFF,0x50,0xC5,0xFF,
-    0x71,0xC5,0xFF,0x91,0xCD,0xFF,0xD2,0xD5,0xFF,0xD2,0xD5,0xFF,0x13,0xD6,0xFF,0xF3,0xD5,0xFF,0xD3,0xCD,0xFF,0xB2,0xCD,0xFF,0x8B,0x83,0xFF,0x6B,0x83,0xFF,0x14,0xDE,0xFF,0xCB,0x93,0xFF,0x52,0xBD,0xFF,0x14,0xD6,0xFF,0xF4,0xD5,0xFF,0x35,0xDE,0xFF,0xD3,0xCD,0xFF,0x72,0xC5,0xFF,0x92,0xC5,0xFF,0x93,0xCD,0xFF,0x11,0xB5,0xFF,0x85,0x39,0xFF,0x20,0x00,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0xA1,0x10,0xFF,0xAA,0x52,0xFF,0x29,0x3A,0xFF,0x09,0x3A,0xFF,0x29,0x3A,0xFF,0x08,0x3A,0xFF,
-    0xA7,0x31,0xFF,0xA7,0x31,0xFF,0x86,0x29,0xFF,0x86,0x29,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0x29,0x3A,0xFF,0xE8,0x31,0xFF,0xE8,0x31,0xFF,0xE8,0x31,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0x65,0x31,0xFF,0x86,0x31,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0x0C,0x5B,0xFF,0x8E,0x73,0xFF,0xCE,0x83,0xFF,0x0B,0x73,0xFF,0x27,0x52,0xFF,0x68,0x5A,0xFF,0x50,0x9C,0xFF,0x0B,0x73,0xFF,0xEB,0x6A,0xFF,0x8D,0x83,0xFF,0x4B,0x7B,0xFF,0xC8,0x72,0xFF,0x8B,0x8B,0xFF,0xAC,0x8B,0xFF,0x8C,0x8B,0xFF,0xCD,0x93,0xFF,0xED,0x93,0xFF,0xCD,0x93,0xFF,0xCD,0x93,0xFF,0xED,0x9B,0xFF,0x2D,0xA4,0xFF,0x4E,0xAC,0xFF,0x8E,0xB4,0xFF,0x8E,0xB4,0xFF,0x8E,0xB4,0xFF,0x2F,0xC5,0xFF,0x0F,0xC5,0xFF,0xCE,0xBC,0xFF,0x6E,0xB4,0xFF,0xCC,0x93,0xFF,0x26,0x5A,0xFF,0x02,0x21,0xFF,0x44,0x29,0xFF,0x0A,0x6B,0xFF,0x8C,0x7B,0xFF,0x0E,0x94,0xFF,0x2E,0x9C,0xFF,0x2E,0x9C,0xFF,0x6E,0xA4,0xFF,0x10,0xBD,0xFF,0x71,0xC5,0xFF,0x4C,0xAC,0xFF,0x4B,0xB4,0xFF,0xAC,0xBC,0xFF,0xCD,0xC4,0xFF,0xED,0xC4,0xFF,
-    0xED,0xC4,0xFF,0x2E,0xCD,0xFF,0x2E,0xD5,0xFF,0x2E,0xCD,0xFF,0xED,0xC4,0xFF,0xCC,0xC4,0xFF,0xAC,0xC4,0xFF,0xAC,0xC4,0xFF,0xED,0xC4,0xFF,0x6B,0xB4,0xFF,0x28,0x83,0xFF,0xD0,0xAC,0xFF,0x56,0xDE,0xFF,0x15,0xD6,0xFF,0x90,0xA4,0xFF,0xC9,0x6A,0xFF,0xAC,0x83,0xFF,0xF0,0xAC,0xFF,0xF4,0xCD,0xFF,0x11,0xBD,0xFF,0x11,0xB5,0xFF,0x51,0xBD,0xFF,0x31,0xBD,0xFF,0x71,0xC5,0xFF,0x30,0xC5,0xFF,0x30,0xC5,0xFF,0xEE,0xBC,0xFF,0xCE,0xB4,0xFF,0xAD,0xB4,0xFF,0x8D,0xAC,0xFF,0xCE,0xB4,0xFF,0x30,0xBD,0xFF,0x30,0xC5,0xFF,0x92,0xCD,0xFF,0x31,0xBD,0xFF,0xD3,0xCD,0xFF,0x51,0xBD,0xFF,0x62,0x41,0xFF,0x8F,0xA4,0xFF,0x14,0xDE,0xFF,0x10,0xBD,0xFF,0x8E,0xAC,0xFF,0x72,0xC5,0xFF,0x35,0xDE,0xFF,0x55,0xDE,0xFF,0x2C,0x9C,0xFF,0x10,0xBD,0xFF,0x30,0xBD,0xFF,0xEF,0xB4,0xFF,0x71,0xC5,0xFF,0xF3,0xD5,0xFF,0x14,0xDE,0xFF,0xB2,0xCD,0xFF,0x72,0xC5,0xFF,0xB2,0xCD,0xFF,0xB3,0xCD,0xFF,0x0D,0x94,0xFF,0x40,0x41,0xFF,0x31,0xBD,0xFF,0x92,0xC5,0xFF,0xED,0x8B,0xFF,0xF0,0xAC,0xFF,0x92,0xC5,0xFF,0x14,0xD6,0xFF,
-    0x14,0xD6,0xFF,0x14,0xD6,0xFF,0x35,0xDE,0xFF,0xD3,0xCD,0xFF,0x51,0xBD,0xFF,0x0D,0x8C,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x08,0xFF,0x80,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x20,0x08,0xFF,0x69,0x4A,0xFF,0x69,0x42,0xFF,0xE8,0x31,0xFF,0xE8,0x31,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0x28,0x42,0xFF,0xE7,0x39,0xFF,0xA6,0x31,0xFF,0xC7,0x31,0xFF,0x86,0x29,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0x08,0x42,0xFF,0xE7,0x39,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,
-    0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0xAA,0x52,0xFF,0x8D,0x7B,0xFF,0xEF,0x8B,0xFF,0x4C,0x73,0xFF,0xAA,0x62,0xFF,0xAA,0x62,0xFF,0x2C,0x73,0xFF,0x2C,0x73,0xFF,0x4C,0x73,0xFF,0x70,0x9C,0xFF,0x8C,0x83,0xFF,0x6B,0x83,0xFF,0x8C,0x8B,0xFF,0x6B,0x83,0xFF,0x0A,0x7B,0xFF,0x0A,0x7B,0xFF,0x2A,0x83,0xFF,0x09,0x7B,0xFF,0xAB,0x93,0xFF,0xEC,0x9B,0xFF,0xEC,0xA3,0xFF,0x0C,0xA4,0xFF,0x0C,0xA4,0xFF,0x2D,0xAC,0xFF,0x6D,0xB4,0xFF,0x4D,0xAC,0xFF,0x0C,0xA4,0xFF,0xCB,0x9B,0xFF,0xAB,0x93,0xFF,0x4A,0x83,0xFF,0xC5,0x49,0xFF,0x03,0x29,0xFF,0x64,0x31,0xFF,0xCA,0x62,0xFF,0x2F,0x94,0xFF,0xF1,0xAC,0xFF,0x8F,0xA4,0xFF,0x8F,0xA4,0xFF,0x31,0xBD,0xFF,0x31,0xBD,0xFF,0xCF,0xB4,0xFF,0x0B,0xA4,0xFF,0x4C,0xAC,0xFF,0x6C,0xB4,0xFF,0x8C,0xB4,0xFF,0xAD,0xBC,0xFF,0xED,0xC4,0xFF,0xED,0xC4,0xFF,0x2E,0xCD,0xFF,0x4E,0xCD,0xFF,0x4E,0xCD,0xFF,0x2D,0xCD,0xFF,0xED,0xC4,0xFF,0x4B,0xAC,0xFF,0x07,0x7B,0xFF,0x4E,0x9C,0xFF,0x15,0xD6,0xFF,0xD4,0xCD,0xFF,0x93,0xC5,0xFF,0x52,0xBD,0xFF,0xB0,0xA4,0xFF,
-    0x4F,0x9C,0xFF,0x8F,0xA4,0xFF,0x72,0xC5,0xFF,0xB3,0xCD,0xFF,0x31,0xBD,0xFF,0xAF,0xAC,0xFF,0x8F,0xAC,0xFF,0x10,0xB5,0xFF,0x92,0xCD,0xFF,0x71,0xC5,0xFF,0x51,0xC5,0xFF,0x30,0xBD,0xFF,0x0F,0xB5,0xFF,0x30,0xBD,0xFF,0x51,0xC5,0xFF,0xD2,0xCD,0xFF,0x13,0xDE,0xFF,0x91,0xCD,0xFF,0x51,0xC5,0xFF,0xF3,0xD5,0xFF,0x13,0xDE,0xFF,0xEC,0x93,0xFF,0xA4,0x49,0xFF,0xB3,0xCD,0xFF,0x51,0xC5,0xFF,0xE9,0x72,0xFF,0xF4,0xD5,0xFF,0xB2,0xCD,0xFF,0x34,0xDE,0xFF,0x10,0xBD,0xFF,0xCF,0xB4,0xFF,0x92,0xCD,0xFF,0x51,0xC5,0xFF,0x71,0xC5,0xFF,0xD2,0xCD,0xFF,0x14,0xDE,0xFF,0x92,0xCD,0xFF,0x51,0xBD,0xFF,0x71,0xBD,0xFF,0x92,0xC5,0xFF,0x51,0xBD,0xFF,0xC8,0x6A,0xFF,0xE8,0x72,0xFF,0xB7,0xE6,0xFF,0x75,0xDE,0xFF,0x30,0xB5,0xFF,0xB2,0xCD,0xFF,0x55,0xDE,0xFF,0xB6,0xE6,0xFF,0xD7,0xEE,0xFF,0xD7,0xE6,0xFF,0x96,0xE6,0xFF,0x14,0xD6,0xFF,0x34,0xD6,0xFF,0x0A,0x63,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,
-    0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x04,0x4A,0xFF,0x83,0x39,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0xA6,0x31,0xFF,0xEB,0x5A,0xFF,0x08,0x3A,0xFF,0xE8,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0xC7,0x39,0xFF,0xA6,0x31,0xFF,0x65,0x29,0xFF,0xE3,0x20,0xFF,0x61,0x10,0xFF,0x60,0x08,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x03,0x19,0xFF,0x86,0x31,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0xC7,0x39,0xFF,0xE7,0x39,0xFF,0x28,0x42,0xFF,0x86,0x31,0xFF,0x87,0x31,0xFF,0xA7,0x31,0xFF,0xCB,0x5A,0xFF,0x50,0x94,0xFF,0x2F,0x94,0xFF,0x4C,0x73,0xFF,0x4C,0x73,0xFF,0xAE,0x83,0xFF,0xAE,0x83,0xFF,0x8D,0x7B,0xFF,0xEE,0x8B,0xFF,0x90,0x9C,0xFF,0x0A,0x73,0xFF,0x4A,0x83,0xFF,
-    0x6B,0x8B,0xFF,0x6B,0x8B,0xFF,0x6B,0x8B,0xFF,0x6B,0x8B,0xFF,0xAB,0x93,0xFF,0x0C,0xA4,0xFF,0x2D,0xA4,0xFF,0x2D,0xA4,0xFF,0x0C,0xA4,0xFF,0x4D,0xAC,0xFF,0x4D,0xAC,0xFF,0xEC,0x9B,0xFF,0xAB,0x93,0xFF,0xCC,0x9B,0xFF,0xCB,0x93,0xFF,0x0D,0x9C,0xFF,0x4E,0xA4,0xFF,0x09,0x73,0xFF,0x43,0x31,0xFF,0x44,0x29,0xFF,0x07,0x42,0xFF,0xAD,0x7B,0xFF,0x12,0xB5,0xFF,0xF1,0xAC,0xFF,0x0E,0x94,0xFF,0x2E,0x9C,0xFF,0x4E,0x9C,0xFF,0xF0,0xB4,0xFF,0x6E,0xAC,0xFF,0xAA,0x93,0xFF,0x4C,0xAC,0xFF,0x6C,0xAC,0xFF,0x6C,0xAC,0xFF,0x6C,0xAC,0xFF,0x4C,0xAC,0xFF,0x4B,0xA4,0xFF,0x0A,0x9C,0xFF,0x2B,0xA4,0xFF,0x4C,0xA4,0xFF,0x0B,0x9C,0xFF,0xEB,0x93,0xFF,0xAB,0x83,0xFF,0x31,0xB5,0xFF,0xD4,0xCD,0xFF,0xF4,0xCD,0xFF,0xD4,0xCD,0xFF,0x52,0xB5,0xFF,0x32,0xB5,0xFF,0x32,0xBD,0xFF,0x11,0xB5,0xFF,0xF0,0xB4,0xFF,0xD0,0xB4,0xFF,0xD0,0xB4,0xFF,0xAF,0xAC,0xFF,0x6E,0xA4,0xFF,0x2D,0x9C,0xFF,0x4E,0x9C,0xFF,0x6E,0xA4,0xFF,0xD0,0xAC,0xFF,0xB3,0xC5,0xFF,0x51,0xBD,0xFF,0xAE,0xAC,0xFF,0x10,0xBD,0xFF,0xB2,0xCD,0xFF,
-    0x34,0xDE,0xFF,0x71,0xC5,0xFF,0x91,0xCD,0xFF,0xB2,0xCD,0xFF,0xF3,0xD5,0xFF,0xB3,0xCD,0xFF,0xA4,0x49,0xFF,0xAC,0x83,0xFF,0xB3,0xCD,0xFF,0x8E,0xA4,0xFF,0xEC,0x93,0xFF,0xCF,0xAC,0xFF,0xB2,0xCD,0xFF,0xD3,0xCD,0xFF,0x6D,0xAC,0xFF,0xB2,0xCD,0xFF,0x14,0xD6,0xFF,0x96,0xE6,0xFF,0xB6,0xE6,0xFF,0x75,0xE6,0xFF,0x75,0xDE,0xFF,0xF7,0xEE,0xFF,0xF4,0xCD,0xFF,0x72,0xBD,0xFF,0xD4,0xCD,0xFF,0x72,0xC5,0xFF,0xE9,0x72,0xFF,0x8B,0x83,0xFF,0x96,0xDE,0xFF,0xD7,0xEE,0xFF,0x18,0xF7,0xFF,0x38,0xF7,0xFF,0x59,0xF7,0xFF,0x59,0xF7,0xFF,0x18,0xEF,0xFF,0xD7,0xE6,0xFF,0x35,0xD6,0xFF,0xD3,0xC5,0xFF,0x8C,0x7B,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0xE8,0x6A,0xFF,0x86,0x5A,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x00,0xFF,0xAA,0x52,0xFF,0x49,0x42,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0x45,0x29,0xFF,0xC7,0x39,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0x85,0x31,0xFF,0xC2,0x18,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xC2,0x18,0xFF,0x03,0x19,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0x24,0x21,0xFF,0x44,0x21,0xFF,0x65,0x29,0xFF,0xC7,0x31,0xFF,0x28,0x42,0xFF,0x28,0x42,0xFF,0xC7,0x39,0xFF,0x08,0x42,0xFF,0x65,0x29,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0x6A,0x4A,0xFF,0xCF,0x7B,0xFF,0xB2,0xA4,0xFF,0x70,0x9C,0xFF,0xCE,0x8B,0xFF,0x0F,0x8C,0xFF,0x30,0x94,0xFF,0x0F,0x8C,0xFF,0xCE,0x83,0xFF,0x50,0x9C,0xFF,0x0E,0x9C,0xFF,0x09,0x7B,0xFF,0x6A,0x83,0xFF,0x6B,0x8B,0xFF,0x6B,0x8B,0xFF,0x6A,0x8B,0xFF,0xAB,0x93,0xFF,0x2D,0xA4,0xFF,0x6E,0xAC,0xFF,0x2D,0xA4,0xFF,0xCC,0x93,0xFF,0xEC,0x9B,0xFF,0x6A,0x8B,0xFF,0x2A,0x83,0xFF,0x29,0x83,0xFF,0x4A,0x83,0xFF,0x8B,0x8B,0xFF,0xEC,0x93,0xFF,
-    0x8B,0x8B,0xFF,0x4A,0x7B,0xFF,0xE5,0x49,0xFF,0x03,0x29,0xFF,0x24,0x29,0xFF,0xCA,0x62,0xFF,0x73,0xBD,0xFF,0x53,0xBD,0xFF,0x2E,0x9C,0xFF,0xCD,0x8B,0xFF,0x0D,0x94,0xFF,0xAF,0xAC,0xFF,0x11,0xB5,0xFF,0xAB,0x8B,0xFF,0xCC,0x93,0xFF,0xCB,0x8B,0xFF,0xCB,0x8B,0xFF,0xAB,0x8B,0xFF,0x8B,0x83,0xFF,0x4E,0x9C,0xFF,0x8F,0xA4,0xFF,0x8F,0xA4,0xFF,0xF0,0xB4,0xFF,0x31,0xB5,0xFF,0x6E,0x9C,0xFF,0x2E,0x94,0xFF,0xD0,0xAC,0xFF,0xF0,0xAC,0xFF,0x11,0xB5,0xFF,0xF1,0xAC,0xFF,0xF1,0xAC,0xFF,0x0E,0x8C,0xFF,0x4F,0x9C,0xFF,0x52,0xBD,0xFF,0x72,0xBD,0xFF,0x93,0xC5,0xFF,0xB3,0xC5,0xFF,0xF4,0xCD,0xFF,0x35,0xDE,0xFF,0x15,0xD6,0xFF,0x35,0xDE,0xFF,0xF4,0xD5,0xFF,0x96,0xE6,0xFF,0x96,0xE6,0xFF,0xB3,0xCD,0xFF,0x10,0xB5,0xFF,0x51,0xBD,0xFF,0xD2,0xD5,0xFF,0x95,0xEE,0xFF,0xF2,0xD5,0xFF,0x91,0xCD,0xFF,0x34,0xDE,0xFF,0xD2,0xD5,0xFF,0x91,0xCD,0xFF,0xCC,0x93,0xFF,0x01,0x39,0xFF,0x72,0xC5,0xFF,0x14,0xDE,0xFF,0xF3,0xD5,0xFF,0x34,0xDE,0xFF,0x96,0xE6,0xFF,0x96,0xE6,0xFF,0x14,0xD6,0xFF,0xB3,0xC5,0xFF,
-    0xB3,0xC5,0xFF,0x76,0xDE,0xFF,0xD7,0xEE,0xFF,0xF7,0xEE,0xFF,0x59,0xF7,0xFF,0x7A,0xF7,0xFF,0x18,0xEF,0xFF,0x97,0xE6,0xFF,0x76,0xDE,0xFF,0x76,0xE6,0xFF,0xF4,0xCD,0xFF,0x2E,0x9C,0xFF,0x05,0x5A,0xFF,0x6B,0x83,0xFF,0x2D,0x94,0xFF,0x2E,0x94,0xFF,0xED,0x8B,0xFF,0x6B,0x7B,0xFF,0xC8,0x6A,0xFF,0x86,0x62,0xFF,0x86,0x62,0xFF,0x05,0x52,0xFF,0xC0,0x20,0xFF,0xC1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x08,0xFF,0x81,0x08,0xFF,0x81,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0xC0,0x20,0xFF,0xC0,0x20,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0xE7,0x39,0xFF,0xEB,0x5A,0xFF,0xC7,0x31,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0x86,0x31,0xFF,0x86,0x29,0xFF,0xE7,0x41,0xFF,
-    0x85,0x31,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0xA2,0x18,0xFF,0xE3,0x18,0xFF,0x23,0x21,0xFF,0x44,0x29,0xFF,0x64,0x29,0xFF,0x44,0x21,0xFF,0x44,0x29,0xFF,0x85,0x29,0xFF,0xA6,0x31,0xFF,0x24,0x21,0xFF,0x65,0x29,0xFF,0x08,0x42,0xFF,0xC7,0x39,0xFF,0x66,0x29,0xFF,0x45,0x29,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0xCB,0x5A,0xFF,0x50,0x94,0xFF,0xF2,0xAC,0xFF,0x70,0x9C,0xFF,0xCE,0x83,0xFF,0xEE,0x8B,0xFF,0x0F,0x8C,0xFF,0xCE,0x83,0xFF,0xEE,0x8B,0xFF,0xB0,0xA4,0xFF,0x4A,0x7B,0xFF,0xA7,0x6A,0xFF,0xC8,0x72,0xFF,0xC9,0x72,0xFF,0x2A,0x7B,0xFF,0x09,0x7B,0xFF,0x09,0x7B,0xFF,0x29,0x7B,0xFF,0x29,0x7B,0xFF,0x09,0x7B,0xFF,0x09,0x7B,0xFF,0x08,0x7B,0xFF,0x29,0x7B,0xFF,0x49,0x83,0xFF,0x8A,0x8B,0xFF,0x6A,0x83,0xFF,0x4A,0x7B,0xFF,0x4A,0x7B,0xFF,0x09,0x7B,0xFF,0xE9,0x6A,0xFF,0x67,0x52,0xFF,0x27,0x4A,0xFF,0xC6,0x41,0xFF,0x90,0x9C,0xFF,0xD1,0xAC,0xFF,0xB0,0xAC,0xFF,0xAF,0xAC,0xFF,0xF0,0xB4,0xFF,0x11,0xBD,0xFF,0x52,0xBD,0xFF,0x72,0xC5,0xFF,0x6F,0xA4,0xFF,0x4F,0x9C,0xFF,
-    0x2E,0x94,0xFF,0x4F,0x9C,0xFF,0xCD,0x8B,0xFF,0x8C,0x83,0xFF,0x4F,0x9C,0xFF,0xD0,0xAC,0xFF,0x72,0xC5,0xFF,0x72,0xBD,0xFF,0xC9,0x6A,0xFF,0x6E,0x9C,0xFF,0xD0,0xAC,0xFF,0xCC,0x8B,0xFF,0xD3,0xCD,0xFF,0x4E,0x9C,0xFF,0x6B,0x7B,0xFF,0x26,0x52,0xFF,0x2B,0x7B,0xFF,0x56,0xDE,0xFF,0x97,0xE6,0xFF,0x35,0xDE,0xFF,0x14,0xD6,0xFF,0xD3,0xCD,0xFF,0x31,0xBD,0xFF,0x8E,0xAC,0xFF,0xEC,0x9B,0xFF,0x28,0x83,0xFF,0xE7,0x7A,0xFF,0x6A,0x8B,0xFF,0xD3,0xCD,0xFF,0xF3,0xCD,0xFF,0xAE,0xAC,0xFF,0x10,0xBD,0xFF,0xF3,0xD5,0xFF,0xB2,0xCD,0xFF,0xD2,0xD5,0xFF,0x54,0xE6,0xFF,0x75,0xE6,0xFF,0x14,0xDE,0xFF,0x72,0xC5,0xFF,0x46,0x5A,0xFF,0x8B,0x83,0xFF,0x14,0xDE,0xFF,0xF3,0xD5,0xFF,0x55,0xDE,0xFF,0x79,0xFF,0xFF,0x7A,0xFF,0xFF,0xD7,0xE6,0xFF,0xF4,0xCD,0xFF,0x56,0xDE,0xFF,0xF8,0xEE,0xFF,0xF8,0xEE,0xFF,0xD7,0xE6,0xFF,0xF8,0xEE,0xFF,0xF8,0xEE,0xFF,0x97,0xDE,0xFF,0x15,0xD6,0xFF,0x93,0xC5,0xFF,0xB0,0xAC,0xFF,0xED,0x93,0xFF,0x4A,0x7B,0xFF,0x26,0x62,0xFF,0x25,0x62,0xFF,0xE4,0x61,0xFF,0x04,0x62,0xFF,
-    0x04,0x62,0xFF,0x25,0x62,0xFF,0x45,0x6A,0xFF,0x66,0x6A,0xFF,0x86,0x62,0xFF,0x63,0x31,0xFF,0x80,0x08,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0xCA,0x52,0xFF,0x08,0x3A,0xFF,0xC8,0x31,0xFF,0xE8,0x39,0xFF,0xC8,0x39,0xFF,0x86,0x31,0xFF,0xE7,0x39,0xFF,0xC6,0x39,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA2,0x10,0xFF,0xE2,0x18,0xFF,0x24,0x21,0xFF,0x64,0x29,0xFF,0x64,0x29,0xFF,0x64,0x29,0xFF,0x64,0x29,0xFF,0x65,0x29,0xFF,0xA5,0x31,0xFF,0xA5,0x31,0xFF,0x65,0x29,0xFF,0x44,0x29,0xFF,0x44,0x29,0xFF,0xA6,0x31,0xFF,
-    0x86,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x4D,0x6B,0xFF,0xB1,0x9C,0xFF,0x70,0x9C,0xFF,0x0E,0x94,0xFF,0xCE,0x83,0xFF,0xEE,0x8B,0xFF,0xEF,0x8B,0xFF,0xAD,0x83,0xFF,0xCD,0x8B,0xFF,0x2E,0x9C,0xFF,0x6B,0x83,0xFF,0x2A,0x7B,0xFF,0x0A,0x73,0xFF,0x6B,0x7B,0xFF,0x0A,0x73,0xFF,0xA7,0x6A,0xFF,0xE8,0x72,0xFF,0xE9,0x72,0xFF,0x29,0x7B,0xFF,0x6A,0x83,0xFF,0xCC,0x8B,0xFF,0xEC,0x93,0xFF,0x0D,0x94,0xFF,0xEC,0x93,0xFF,0x2D,0x9C,0xFF,0x6E,0x9C,0xFF,0xB0,0xAC,0xFF,0x8F,0xA4,0xFF,0xF0,0xAC,0xFF,0x32,0xB5,0xFF,0x90,0x9C,0xFF,0xA9,0x5A,0xFF,0xCA,0x62,0xFF,0x4F,0x9C,0xFF,0x31,0xBD,0xFF,0xAF,0xA4,0xFF,0xCC,0x8B,0xFF,0x4E,0x9C,0xFF,0x8E,0xA4,0xFF,0x52,0xBD,0xFF,0xF1,0xB4,0xFF,0x0E,0x94,0xFF,0x4E,0x9C,0xFF,0x32,0xB5,0xFF,0xB0,0xA4,0xFF,0x8C,0x83,0xFF,0xED,0x8B,0xFF,0x8F,0xA4,0xFF,0x31,0xBD,0xFF,0x72,0xBD,0xFF,0xA8,0x62,0xFF,0x4A,0x7B,0xFF,0x31,0xBD,0xFF,0x2A,0x73,0xFF,0x72,0xBD,0xFF,0x2E,0x94,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,
-    0x29,0x7B,0xFF,0x6A,0x8B,0xFF,0x28,0x83,0xFF,0xC6,0x7A,0xFF,0x44,0x6A,0xFF,0x23,0x6A,0xFF,0xE1,0x61,0xFF,0xE2,0x61,0xFF,0x24,0x6A,0xFF,0x45,0x6A,0xFF,0xA7,0x72,0xFF,0x30,0xC5,0xFF,0xD3,0xD5,0xFF,0xB2,0xCD,0xFF,0xB2,0xCD,0xFF,0x51,0xBD,0xFF,0x51,0xBD,0xFF,0xF3,0xD5,0xFF,0xF3,0xD5,0xFF,0x13,0xDE,0xFF,0x54,0xDE,0xFF,0xB6,0xEE,0xFF,0x54,0xDE,0xFF,0x31,0xBD,0xFF,0xC3,0x51,0xFF,0x4D,0xA4,0xFF,0xAF,0xB4,0xFF,0x8E,0xAC,0xFF,0xD0,0xB4,0xFF,0x2D,0x9C,0xFF,0x6A,0x83,0xFF,0x72,0xBD,0xFF,0xD4,0xCD,0xFF,0x11,0xB5,0xFF,0x6E,0xA4,0xFF,0xAC,0x93,0xFF,0xC7,0x7A,0xFF,0x45,0x6A,0xFF,0xE3,0x61,0xFF,0xC0,0x61,0xFF,0xA0,0x61,0xFF,0xE3,0x69,0xFF,0xE2,0x61,0xFF,0xE3,0x61,0xFF,0x04,0x6A,0xFF,0x25,0x6A,0xFF,0x04,0x62,0xFF,0x04,0x62,0xFF,0x04,0x62,0xFF,0x45,0x6A,0xFF,0x86,0x72,0xFF,0x66,0x6A,0xFF,0x22,0x31,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,
-    0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0x45,0x29,0xFF,0xAB,0x52,0xFF,0xA7,0x31,0xFF,0xC8,0x39,0xFF,0x86,0x29,0xFF,0x86,0x31,0xFF,0xC6,0x39,0xFF,0x44,0x29,0xFF,0x00,0x00,0xFF,0x61,0x10,0xFF,0xC2,0x18,0xFF,0xE3,0x18,0xFF,0x03,0x21,0xFF,0x65,0x29,0xFF,0x64,0x29,0xFF,0x85,0x31,0xFF,0x85,0x31,0xFF,0xA5,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xA5,0x31,0xFF,0x85,0x31,0xFF,0x81,0x10,0xFF,0x44,0x21,0xFF,0xE7,0x39,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0x49,0x4A,0xFF,0xEF,0x83,0xFF,0xF2,0xAC,0xFF,0x70,0x9C,0xFF,0xCE,0x8B,0xFF,0xCD,0x83,0xFF,0xCE,0x8B,0xFF,0xCE,0x8B,0xFF,0x4C,0x7B,0xFF,0x8C,0x83,0xFF,
-    0x4F,0x9C,0xFF,0x90,0xA4,0xFF,0xF1,0xAC,0xFF,0xB0,0xA4,0xFF,0xD1,0xAC,0xFF,0x2E,0x94,0xFF,0x8B,0x83,0xFF,0xAC,0x83,0xFF,0xD1,0xAC,0xFF,0x8F,0xA4,0xFF,0x2E,0x9C,0xFF,0x6F,0x9C,0xFF,0x8F,0xA4,0xFF,0x4E,0x9C,0xFF,0xF0,0xAC,0xFF,0x31,0xB5,0xFF,0x11,0xB5,0xFF,0xAF,0xAC,0xFF,0x52,0xBD,0xFF,0x15,0xD6,0xFF,0x32,0xB5,0xFF,0xCD,0x83,0xFF,0x07,0x4A,0xFF,0x0E,0x94,0xFF,0x52,0xBD,0xFF,0xCC,0x83,0xFF,0x21,0x39,0xFF,0x32,0xB5,0xFF,0xF5,0xCD,0xFF,0x10,0xBD,0xFF,0xB3,0xCD,0xFF,0xAC,0x8B,0xFF,0x6F,0xA4,0xFF,0x72,0xC5,0xFF,0xB3,0xC5,0xFF,0xAF,0xA4,0xFF,0x8F,0xA4,0xFF,0x11,0xB5,0xFF,0x51,0xBD,0xFF,0x31,0xBD,0xFF,0xCC,0x8B,0xFF,0x80,0x28,0xFF,0xCF,0xAC,0xFF,0x10,0xBD,0xFF,0xCF,0xAC,0xFF,0x6E,0x9C,0xFF,0xE5,0x49,0xFF,0x43,0x39,0xFF,0xE4,0x51,0xFF,0x66,0x62,0xFF,0x6A,0x8B,0xFF,0x69,0x8B,0xFF,0xCB,0x93,0xFF,0x2C,0xA4,0xFF,0x8E,0xB4,0xFF,0x0B,0xA4,0xFF,0x0B,0xA4,0xFF,0xEE,0xBC,0xFF,0x30,0xC5,0xFF,0x4D,0xA4,0xFF,0x2D,0x9C,0xFF,0xB3,0xCD,0xFF,0x39,0xF7,0xFF,0xD7,0xEE,0xFF,
-    0x13,0xD6,0xFF,0x95,0xE6,0xFF,0x95,0xE6,0xFF,0x75,0xE6,0xFF,0x34,0xDE,0xFF,0xF2,0xD5,0xFF,0x71,0xC5,0xFF,0x8E,0xB4,0xFF,0xE7,0x82,0xFF,0x43,0x7A,0xFF,0x02,0x72,0xFF,0x01,0x72,0xFF,0xE0,0x69,0xFF,0xE0,0x69,0xFF,0x43,0x7A,0xFF,0x20,0x72,0xFF,0xE0,0x71,0xFF,0x00,0x72,0xFF,0x42,0x7A,0xFF,0x43,0x7A,0xFF,0x64,0x82,0xFF,0x64,0x82,0xFF,0x64,0x82,0xFF,0x84,0x82,0xFF,0x85,0x82,0xFF,0x85,0x82,0xFF,0x64,0x7A,0xFF,0x64,0x7A,0xFF,0x03,0x6A,0xFF,0xA2,0x61,0xFF,0xE3,0x61,0xFF,0xA3,0x59,0xFF,0xE3,0x61,0xFF,0x65,0x72,0xFF,0x66,0x6A,0xFF,0x02,0x31,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0xE7,0x39,0xFF,0x49,0x4A,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x25,0x21,0xFF,0x86,0x31,0xFF,0x44,0x29,0xFF,0x20,0x08,0xFF,0x61,0x10,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0x03,0x19,0xFF,0x44,0x29,0xFF,0x85,0x31,0xFF,0xA6,0x39,0xFF,0x85,0x31,0xFF,0xA5,0x31,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xA5,0x31,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xE3,0x20,0xFF,0x65,0x29,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xE8,0x39,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0xC7,0x39,0xFF,0x08,0x3A,0xFF,0x2C,0x63,0xFF,0xF2,0xA4,0xFF,0x32,0xB5,0xFF,0xB0,0xA4,0xFF,0x0E,0x94,0xFF,0x0F,0x94,0xFF,0x0F,0x94,0xFF,0xAD,0x8B,0xFF,0xCD,0x8B,0xFF,0x4F,0x9C,0xFF,0x12,0xB5,0xFF,0xB1,0xA4,0xFF,0x90,0xA4,0xFF,0x90,0xA4,0xFF,0x12,0xB5,0xFF,0x6F,0xA4,0xFF,0x8C,0x83,0xFF,0x2E,0x94,0xFF,0x2E,0x94,0xFF,0x8F,0xA4,0xFF,0xB0,0xA4,0xFF,0xD0,0xAC,0xFF,0x8F,0xA4,0xFF,0xD0,0xAC,0xFF,0x11,0xB5,0xFF,
-    0xF0,0xB4,0xFF,0x8F,0xAC,0xFF,0x8F,0xA4,0xFF,0x93,0xC5,0xFF,0x93,0xC5,0xFF,0x6F,0x9C,0xFF,0x0A,0x73,0xFF,0x88,0x62,0xFF,0xF1,0xB4,0xFF,0xB0,0xAC,0xFF,0x0A,0x73,0xFF,0xCC,0x8B,0xFF,0xED,0x93,0xFF,0xCF,0xB4,0xFF,0xD3,0xD5,0xFF,0xD0,0xAC,0xFF,0x4E,0xA4,0xFF,0x72,0xC5,0xFF,0x35,0xDE,0xFF,0xD4,0xCD,0xFF,0x52,0xBD,0xFF,0xD0,0xB4,0xFF,0x92,0xC5,0xFF,0x31,0xBD,0xFF,0xF0,0xB4,0xFF,0xA8,0x6A,0xFF,0xC4,0x51,0xFF,0xD0,0xB4,0xFF,0x92,0xCD,0xFF,0xCF,0xAC,0xFF,0xAB,0x83,0xFF,0x87,0x62,0xFF,0xE5,0x51,0xFF,0x67,0x62,0xFF,0xB3,0xCD,0xFF,0xF3,0xD5,0xFF,0xD2,0xD5,0xFF,0x71,0xC5,0xFF,0x91,0xCD,0xFF,0x2F,0xC5,0xFF,0xEE,0xBC,0xFF,0x2F,0xC5,0xFF,0x34,0xDE,0xFF,0x6D,0xAC,0xFF,0x0F,0xC5,0xFF,0xB2,0xCD,0xFF,0x71,0xC5,0xFF,0x0F,0xBD,0xFF,0x8D,0xB4,0xFF,0x2B,0xA4,0xFF,0x68,0x93,0xFF,0x06,0x8B,0xFF,0xA4,0x82,0xFF,0x62,0x82,0xFF,0x21,0x7A,0xFF,0x00,0x72,0xFF,0x43,0x82,0xFF,0x63,0x82,0xFF,0x43,0x82,0xFF,0x43,0x7A,0xFF,0x64,0x82,0xFF,0x64,0x82,0xFF,0x64,0x82,0xFF,0xA4,0x8A,0xFF,
-    0x84,0x82,0xFF,0xA5,0x8A,0xFF,0xE5,0x92,0xFF,0xC5,0x92,0xFF,0xE5,0x92,0xFF,0xE5,0x92,0xFF,0x85,0x82,0xFF,0x24,0x7A,0xFF,0xE3,0x69,0xFF,0xA2,0x69,0xFF,0x82,0x69,0xFF,0x81,0x61,0xFF,0x81,0x61,0xFF,0x24,0x72,0xFF,0xE3,0x69,0xFF,0xE3,0x61,0xFF,0x66,0x6A,0xFF,0x25,0x5A,0xFF,0xE1,0x28,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x63,0x31,0xFF,0x22,0x29,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x8A,0x4A,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0x87,0x29,0xFF,0x66,0x29,0xFF,0x65,0x31,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0xA2,0x18,0xFF,
-    0x03,0x21,0xFF,0x24,0x21,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x41,0xFF,0xA6,0x39,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0xC6,0x39,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0x64,0x31,0xFF,0x24,0x29,0xFF,0x27,0x42,0xFF,0xA6,0x31,0xFF,0x24,0x21,0xFF,0x08,0x3A,0xFF,0x29,0x42,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x08,0x42,0xFF,0x8A,0x52,0xFF,0x2C,0x6B,0xFF,0xD1,0xAC,0xFF,0x4F,0x9C,0xFF,0xAC,0x8B,0xFF,0x0E,0x94,0xFF,0x0E,0x94,0xFF,0xAD,0x8B,0xFF,0x0E,0x94,0xFF,0x4F,0x9C,0xFF,0xD1,0xAC,0xFF,0xF1,0xAC,0xFF,0x2F,0x94,0xFF,0xEE,0x8B,0xFF,0xD1,0xAC,0xFF,0x4F,0x9C,0xFF,0x90,0xA4,0xFF,0x0E,0x94,0xFF,0x0D,0x94,0xFF,0xB0,0xA4,0xFF,0xB0,0xA4,0xFF,0xB0,0xA4,0xFF,0xF0,0xAC,0xFF,0xAF,0xAC,0xFF,0x11,0xB5,0xFF,0xF1,0xB4,0xFF,0x8F,0xA4,0xFF,0x6F,0xA4,0xFF,0xD0,0xAC,0xFF,0x73,0xBD,0xFF,0x11,0xB5,0xFF,0x0E,0x94,0xFF,0xE6,0x51,0xFF,0x0D,0x94,0xFF,0x31,0xBD,0xFF,0xD0,0xB4,0xFF,0xD0,0xB4,0xFF,0xD0,0xB4,0xFF,0x30,0xBD,0xFF,0x14,0xDE,0xFF,0x76,0xE6,0xFF,
-    0xAF,0xAC,0xFF,0xF0,0xB4,0xFF,0xD3,0xCD,0xFF,0x56,0xDE,0xFF,0x14,0xD6,0xFF,0xB2,0xCD,0xFF,0x31,0xBD,0xFF,0x71,0xC5,0xFF,0x31,0xBD,0xFF,0x30,0xBD,0xFF,0x2D,0x9C,0xFF,0x09,0x7B,0xFF,0x8B,0x8B,0xFF,0x6A,0x83,0xFF,0xC8,0x72,0xFF,0x46,0x62,0xFF,0x83,0x49,0xFF,0xA0,0x38,0xFF,0x0C,0x94,0xFF,0x75,0xE6,0xFF,0xF3,0xD5,0xFF,0xD2,0xD5,0xFF,0x2F,0xC5,0xFF,0x50,0xC5,0xFF,0xB2,0xD5,0xFF,0xD2,0xD5,0xFF,0x95,0xEE,0xFF,0x6B,0xB4,0xFF,0x86,0xAB,0xFF,0x45,0xA3,0xFF,0x03,0x9B,0xFF,0x03,0x9B,0xFF,0x24,0xA3,0xFF,0x65,0xAB,0xFF,0x65,0xAB,0xFF,0x24,0xA3,0xFF,0x25,0xA3,0xFF,0x46,0xA3,0xFF,0x26,0xA3,0xFF,0x26,0x9B,0xFF,0x47,0x9B,0xFF,0x06,0x9B,0xFF,0xC5,0x8A,0xFF,0xA5,0x8A,0xFF,0x85,0x82,0xFF,0x44,0x7A,0xFF,0x44,0x7A,0xFF,0xC3,0x61,0xFF,0xC3,0x61,0xFF,0xC2,0x69,0xFF,0xA2,0x69,0xFF,0x81,0x69,0xFF,0xA1,0x69,0xFF,0xC1,0x71,0xFF,0xA1,0x69,0xFF,0x40,0x61,0xFF,0x81,0x69,0xFF,0x61,0x61,0xFF,0x20,0x61,0xFF,0xC2,0x71,0xFF,0x07,0x9B,0xFF,0x23,0x7A,0xFF,0x03,0x6A,0xFF,0x86,0x72,0xFF,
-    0xE4,0x51,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x80,0x10,0xFF,0x22,0x31,0xFF,0x01,0x29,0xFF,0x60,0x10,0xFF,0x20,0x00,0xFF,0x24,0x21,0xFF,0x6A,0x4A,0xFF,0xA7,0x31,0xFF,0x87,0x31,0xFF,0x66,0x29,0xFF,0x86,0x31,0xFF,0xE3,0x20,0xFF,0x00,0x08,0xFF,0x81,0x10,0xFF,0xE3,0x18,0xFF,0x23,0x21,0xFF,0x44,0x29,0xFF,0xE7,0x39,0xFF,0xC6,0x39,0xFF,0xE6,0x41,0xFF,0x06,0x4A,0xFF,0xC6,0x41,0xFF,0xC6,0x41,0xFF,0xC6,0x41,0xFF,0xC6,0x41,0xFF,0xE6,0x41,0xFF,0xC6,0x41,0xFF,0x81,0x10,0xFF,0xE7,0x41,0xFF,0x07,0x42,0xFF,0x85,0x31,0xFF,
-    0x44,0x29,0xFF,0x44,0x29,0xFF,0x49,0x4A,0xFF,0x29,0x42,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0x28,0x42,0xFF,0x08,0x42,0xFF,0x0E,0x8C,0xFF,0x90,0xAC,0xFF,0xED,0x93,0xFF,0xCD,0x93,0xFF,0x0E,0x9C,0xFF,0xCD,0x93,0xFF,0x6F,0xA4,0xFF,0x4F,0x9C,0xFF,0x90,0xA4,0xFF,0xF2,0xAC,0xFF,0x89,0x5A,0xFF,0x8D,0x7B,0xFF,0x16,0xD6,0xFF,0xB0,0xA4,0xFF,0x6F,0xA4,0xFF,0xD0,0xAC,0xFF,0xCC,0x8B,0xFF,0x4E,0x9C,0xFF,0x6F,0xA4,0xFF,0x8F,0xA4,0xFF,0x8F,0xA4,0xFF,0x6F,0xA4,0xFF,0xD0,0xAC,0xFF,0xF1,0xAC,0xFF,0x52,0xBD,0xFF,0x93,0xC5,0xFF,0x73,0xC5,0xFF,0x52,0xBD,0xFF,0x31,0xBD,0xFF,0xD0,0xAC,0xFF,0x0A,0x73,0xFF,0x67,0x62,0xFF,0x51,0xC5,0xFF,0xEF,0xBC,0xFF,0xCF,0xB4,0xFF,0x71,0xC5,0xFF,0xD2,0xD5,0xFF,0x54,0xE6,0xFF,0xF7,0xF6,0xFF,0xD2,0xCD,0xFF,0x71,0xC5,0xFF,0x34,0xDE,0xFF,0xD6,0xEE,0xFF,0x17,0xEF,0xFF,0xB5,0xE6,0xFF,0x53,0xDE,0xFF,0x33,0xDE,0xFF,0x12,0xDE,0xFF,0x12,0xD6,0xFF,0x91,0xCD,0xFF,0xEE,0xBC,0xFF,0x6B,0xB4,0xFF,0x29,0xAC,0xFF,0xE7,0xA3,0xFF,0xE7,0xA3,0xFF,
-    0xE7,0xA3,0xFF,0x07,0xAC,0xFF,0xC5,0x7A,0xFF,0x14,0xDE,0xFF,0x75,0xE6,0xFF,0xF2,0xD5,0xFF,0x70,0xCD,0xFF,0x91,0xCD,0xFF,0xF3,0xDD,0xFF,0xF2,0xD5,0xFF,0x74,0xE6,0xFF,0xB1,0xD5,0xFF,0x06,0xBC,0xFF,0x27,0xC4,0xFF,0x28,0xC4,0xFF,0x28,0xC4,0xFF,0x08,0xC4,0xFF,0x07,0xC4,0xFF,0x08,0xC4,0xFF,0xE8,0xBB,0xFF,0xA7,0xAB,0xFF,0x47,0xA3,0xFF,0xC6,0x92,0xFF,0x65,0x82,0xFF,0x24,0x72,0xFF,0xC3,0x69,0xFF,0x61,0x61,0xFF,0x40,0x61,0xFF,0xA1,0x69,0xFF,0xC2,0x69,0xFF,0xC0,0x40,0xFF,0x01,0x49,0xFF,0xA2,0x61,0xFF,0x61,0x61,0xFF,0x40,0x61,0xFF,0x81,0x69,0xFF,0x81,0x69,0xFF,0xA1,0x71,0xFF,0xA1,0x71,0xFF,0xA1,0x69,0xFF,0x81,0x69,0xFF,0x00,0x61,0xFF,0x64,0x82,0xFF,0x47,0xA3,0xFF,0x63,0x82,0xFF,0x65,0x7A,0xFF,0xA6,0x7A,0xFF,0x83,0x49,0xFF,0x81,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x60,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x00,0x00,0xFF,0xC7,0x31,0xFF,0x49,0x42,0xFF,0xE8,0x31,0xFF,0xC8,0x31,0xFF,0x87,0x31,0xFF,0x65,0x31,0xFF,0x61,0x10,0xFF,0x40,0x08,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0x04,0x21,0xFF,0xC6,0x39,0xFF,0xA6,0x39,0xFF,0x07,0x4A,0xFF,0x27,0x52,0xFF,0x07,0x4A,0xFF,0x27,0x52,0xFF,0x07,0x4A,0xFF,0x06,0x4A,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0x03,0x29,0xFF,0x85,0x31,0xFF,0x07,0x42,0xFF,0xC6,0x41,0xFF,0xA5,0x39,0xFF,0x65,0x31,0xFF,0x24,0x29,0xFF,0x66,0x29,0xFF,0xAB,0x52,0xFF,0x4A,0x42,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0xE8,0x41,0xFF,0xEB,0x6A,0xFF,0x4F,0x9C,0xFF,0xD1,0xB4,0xFF,0x4F,0xA4,0xFF,0xCD,0x8B,0xFF,0x2E,0x9C,0xFF,0x4F,0x9C,0xFF,
-    0x6F,0x9C,0xFF,0xF1,0xAC,0xFF,0x12,0xB5,0xFF,0x2F,0x94,0xFF,0x89,0x5A,0xFF,0x8C,0x7B,0xFF,0xCD,0x8B,0xFF,0x0D,0x9C,0xFF,0x52,0xBD,0xFF,0x8B,0x83,0xFF,0x6B,0x83,0xFF,0x2D,0x9C,0xFF,0x4E,0x9C,0xFF,0x8F,0xA4,0xFF,0xD0,0xAC,0xFF,0xF0,0xAC,0xFF,0x4E,0x9C,0xFF,0xAF,0xAC,0xFF,0xF1,0xB4,0xFF,0x11,0xB5,0xFF,0xF0,0xB4,0xFF,0x31,0xBD,0xFF,0x52,0xBD,0xFF,0xEC,0x93,0xFF,0xA3,0x51,0xFF,0xCB,0x9B,0xFF,0xED,0xC4,0xFF,0xED,0xBC,0xFF,0xF1,0xD5,0xFF,0xD0,0xD5,0xFF,0xAF,0xCD,0xFF,0x8F,0xCD,0xFF,0xED,0xBC,0xFF,0x12,0xD6,0xFF,0x52,0xDE,0xFF,0xF1,0xD5,0xFF,0x8F,0xCD,0xFF,0x4E,0xC5,0xFF,0x0B,0xC5,0xFF,0x0A,0xC5,0xFF,0x0A,0xC5,0xFF,0xE9,0xC4,0xFF,0x09,0xCD,0xFF,0xC7,0xC4,0xFF,0x86,0xC4,0xFF,0xC6,0xCC,0xFF,0x28,0xD5,0xFF,0x48,0xDD,0xFF,0x48,0xDD,0xFF,0xA9,0xE5,0xFF,0xE6,0xA3,0xFF,0x30,0xC5,0xFF,0x95,0xEE,0xFF,0x54,0xE6,0xFF,0xF2,0xDD,0xFF,0x74,0xE6,0xFF,0x74,0xEE,0xFF,0x33,0xDE,0xFF,0x13,0xDE,0xFF,0x74,0xE6,0xFF,0xA7,0xA3,0xFF,0x46,0x9B,0xFF,0x06,0x93,0xFF,0x84,0x82,0xFF,
-    0x43,0x7A,0xFF,0x02,0x72,0xFF,0xA1,0x69,0xFF,0x81,0x69,0xFF,0x40,0x61,0xFF,0x00,0x59,0xFF,0x00,0x59,0xFF,0x20,0x59,0xFF,0x20,0x59,0xFF,0x40,0x61,0xFF,0x61,0x69,0xFF,0xC2,0x71,0xFF,0x03,0x72,0xFF,0x21,0x49,0xFF,0x62,0x59,0xFF,0xC2,0x69,0xFF,0x81,0x69,0xFF,0x61,0x61,0xFF,0x61,0x61,0xFF,0xA1,0x69,0xFF,0xE2,0x71,0xFF,0xA1,0x71,0xFF,0xC1,0x71,0xFF,0xC1,0x79,0xFF,0x40,0x69,0xFF,0x05,0x9B,0xFF,0xC8,0xB3,0xFF,0x63,0x8A,0xFF,0x64,0x82,0xFF,0x86,0x7A,0xFF,0x83,0x49,0xFF,0xA1,0x18,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0x29,0x42,0xFF,0x09,0x3A,0xFF,0xC8,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE3,0x20,0xFF,0x20,0x08,0xFF,0x61,0x08,0xFF,0xE3,0x18,0xFF,0x24,0x21,0xFF,0x65,0x29,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x27,0x4A,0xFF,0x07,0x4A,0xFF,0x27,0x4A,0xFF,0x48,0x52,0xFF,0x07,0x4A,0xFF,0x27,0x52,0xFF,0x47,0x52,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x07,0x4A,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0xA6,0x39,0xFF,0xA6,0x39,0xFF,0x85,0x31,0xFF,0xA6,0x31,0xFF,0x29,0x3A,0xFF,0x4A,0x42,0xFF,0x08,0x3A,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0x08,0x42,0xFF,0xEF,0x8B,0xFF,0xD1,0xAC,0xFF,0xD1,0xAC,0xFF,0x90,0xAC,0xFF,0x4F,0xA4,0xFF,0x2E,0x9C,0xFF,0x2F,0x9C,0xFF,0x12,0xB5,0xFF,0xF1,0xAC,0xFF,0xB1,0xA4,0xFF,0x2F,0x94,0xFF,0x6C,0x83,0xFF,0xED,0x93,0xFF,0xB0,0xAC,0xFF,0x72,0xC5,0xFF,0x8B,0x83,0xFF,0x29,0x7B,0xFF,0x0D,0x94,0xFF,0xD0,0xAC,0xFF,0xD0,0xAC,0xFF,0x31,0xBD,0xFF,0x51,0xBD,0xFF,
-    0x10,0xB5,0xFF,0x31,0xBD,0xFF,0xD3,0xCD,0xFF,0x71,0xC5,0xFF,0xF3,0xD5,0xFF,0x34,0xD6,0xFF,0x13,0xD6,0xFF,0x50,0xC5,0xFF,0x06,0x83,0xFF,0xE6,0xAB,0xFF,0x09,0xCD,0xFF,0x69,0xD5,0xFF,0x68,0xD5,0xFF,0x88,0xD5,0xFF,0xA9,0xDD,0xFF,0x88,0xD5,0xFF,0xEA,0xDD,0xFF,0x0B,0xE6,0xFF,0xEA,0xDD,0xFF,0xEB,0xE5,0xFF,0xA9,0xDD,0xFF,0xC9,0xDD,0xFF,0x0A,0xE6,0xFF,0x4B,0xEE,0xFF,0x2A,0xEE,0xFF,0x4B,0xEE,0xFF,0x2B,0xEE,0xFF,0x2A,0xEE,0xFF,0xCA,0xE5,0xFF,0xAA,0xE5,0xFF,0x8A,0xE5,0xFF,0x49,0xD5,0xFF,0x69,0xD5,0xFF,0x6A,0xD5,0xFF,0x88,0xB4,0xFF,0x0C,0xA4,0xFF,0x74,0xE6,0xFF,0x13,0xDE,0xFF,0x33,0xDE,0xFF,0x71,0xCD,0xFF,0x30,0xC5,0xFF,0x13,0xDE,0xFF,0x33,0xDE,0xFF,0x75,0xE6,0xFF,0xEC,0x93,0xFF,0x00,0x40,0xFF,0x40,0x59,0xFF,0x61,0x61,0xFF,0x81,0x69,0xFF,0x81,0x69,0xFF,0xC2,0x71,0xFF,0xE2,0x71,0xFF,0x81,0x69,0xFF,0x81,0x61,0xFF,0x81,0x61,0xFF,0x40,0x59,0xFF,0x61,0x61,0xFF,0x81,0x69,0xFF,0xC2,0x71,0xFF,0xE3,0x71,0xFF,0x42,0x51,0xFF,0xC3,0x69,0xFF,0xE2,0x71,0xFF,0x81,0x69,0xFF,
-    0x41,0x69,0xFF,0x81,0x71,0xFF,0x81,0x71,0xFF,0xC2,0x71,0xFF,0xC1,0x71,0xFF,0x81,0x71,0xFF,0xC1,0x79,0xFF,0x80,0x71,0xFF,0xA7,0xB3,0xFF,0x28,0xC4,0xFF,0xA4,0x92,0xFF,0x84,0x82,0xFF,0x65,0x72,0xFF,0x42,0x41,0xFF,0xA1,0x20,0xFF,0xE2,0x20,0xFF,0xE1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0xE3,0x18,0xFF,0x69,0x4A,0xFF,0x08,0x3A,0xFF,0xE8,0x31,0xFF,0xA7,0x31,0xFF,0x86,0x31,0xFF,0x61,0x10,0xFF,0x20,0x08,0xFF,0xA2,0x10,0xFF,0x03,0x21,0xFF,0x24,0x21,0xFF,
-    0x85,0x31,0xFF,0xE6,0x39,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0xA5,0x39,0xFF,0x48,0x52,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0x88,0x5A,0xFF,0xE6,0x41,0xFF,0xA6,0x39,0xFF,0x27,0x4A,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0xC6,0x41,0xFF,0xE7,0x49,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xE7,0x39,0xFF,0x4A,0x42,0xFF,0x29,0x3A,0xFF,0xE8,0x39,0xFF,0x86,0x31,0xFF,0xC7,0x39,0xFF,0xA7,0x31,0xFF,0x86,0x31,0xFF,0xEB,0x62,0xFF,0xF2,0xAC,0xFF,0xD1,0xAC,0xFF,0x90,0xA4,0xFF,0xF1,0xB4,0xFF,0xB0,0xAC,0xFF,0xB0,0xAC,0xFF,0x53,0xBD,0xFF,0x73,0xBD,0xFF,0x94,0xC5,0xFF,0xB4,0xC5,0xFF,0x94,0xC5,0xFF,0xD5,0xCD,0xFF,0xF5,0xCD,0xFF,0x32,0xBD,0xFF,0x10,0xB5,0xFF,0x31,0xBD,0xFF,0xF0,0xB4,0xFF,0x92,0xC5,0xFF,0xF4,0xD5,0xFF,0xF3,0xD5,0xFF,0xF3,0xD5,0xFF,0x91,0xCD,0xFF,0x70,0xC5,0xFF,0x70,0xC5,0xFF,0x0E,0xBD,0xFF,0x2D,0xC5,0xFF,0xAE,0xCD,0xFF,0xCD,0xD5,0xFF,0xED,0xDD,0xFF,0xCB,0xDD,0xFF,0xC9,0xE5,0xFF,0xC8,0xE5,0xFF,0xE9,0xE5,0xFF,0xE8,0xE5,0xFF,0x09,0xEE,0xFF,0x29,0xEE,0xFF,0x49,0xEE,0xFF,
-    0xAB,0xF6,0xFF,0xCC,0xFE,0xFF,0xCC,0xFE,0xFF,0xCC,0xFE,0xFF,0x8C,0xF6,0xFF,0x6B,0xEE,0xFF,0x6C,0xEE,0xFF,0x2C,0xE6,0xFF,0xEC,0xDD,0xFF,0xAC,0xD5,0xFF,0x4B,0xCD,0xFF,0xCA,0xBC,0xFF,0x27,0xA4,0xFF,0x66,0x93,0xFF,0xE5,0x7A,0xFF,0x63,0x72,0xFF,0x42,0x6A,0xFF,0x43,0x72,0xFF,0x22,0x6A,0xFF,0x68,0x8B,0xFF,0x13,0xDE,0xFF,0x91,0xCD,0xFF,0x54,0xE6,0xFF,0x28,0x8B,0xFF,0x40,0x59,0xFF,0x30,0xC5,0xFF,0x54,0xE6,0xFF,0xB2,0xCD,0xFF,0xF3,0xD5,0xFF,0xC3,0x61,0xFF,0xC2,0x69,0xFF,0xC2,0x69,0xFF,0xA2,0x69,0xFF,0xC2,0x71,0xFF,0xE3,0x71,0xFF,0xA2,0x69,0xFF,0xA1,0x69,0xFF,0xA2,0x69,0xFF,0x81,0x61,0xFF,0x61,0x61,0xFF,0x61,0x61,0xFF,0xC2,0x71,0xFF,0xC3,0x69,0xFF,0x21,0x49,0xFF,0x24,0x72,0xFF,0x02,0x7A,0xFF,0xA1,0x71,0xFF,0x81,0x71,0xFF,0xA2,0x71,0xFF,0xA1,0x71,0xFF,0xC1,0x79,0xFF,0xC2,0x79,0xFF,0xC1,0x79,0xFF,0xA1,0x71,0xFF,0x80,0x71,0xFF,0xE8,0xBB,0xFF,0x08,0xBC,0xFF,0xA3,0x92,0xFF,0xA5,0x8A,0xFF,0x45,0x72,0xFF,0x22,0x39,0xFF,0xC1,0x28,0xFF,0xE2,0x20,0xFF,0xC0,0x20,0xFF,
-    0xE1,0x20,0xFF,0xE1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x20,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x45,0x29,0xFF,0x49,0x42,0xFF,0x09,0x3A,0xFF,0x09,0x3A,0xFF,0xC7,0x39,0xFF,0x45,0x29,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x03,0x21,0xFF,0xE3,0x18,0xFF,0x85,0x31,0xFF,0xA6,0x31,0xFF,0x07,0x42,0xFF,0x07,0x4A,0xFF,0xA5,0x39,0xFF,0x07,0x4A,0xFF,0x27,0x52,0xFF,0x07,0x4A,0xFF,0x27,0x52,0xFF,0xC6,0x41,0xFF,0x85,0x39,0xFF,0x89,0x5A,0xFF,0x48,0x52,0xFF,0x27,0x52,0xFF,0xE6,0x49,0xFF,0xE6,0x49,0xFF,0xA5,0x39,0xFF,
-    0xA6,0x39,0xFF,0xA5,0x31,0xFF,0xC7,0x31,0xFF,0x8A,0x4A,0xFF,0xE8,0x31,0xFF,0xE8,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0x08,0x42,0xFF,0xC7,0x39,0xFF,0xA6,0x39,0xFF,0xB1,0xA4,0xFF,0x57,0xD6,0xFF,0x16,0xCE,0xFF,0x36,0xD6,0xFF,0xF5,0xCD,0xFF,0xB4,0xCD,0xFF,0x73,0xBD,0xFF,0x33,0xBD,0xFF,0xD1,0xAC,0xFF,0x6F,0xA4,0xFF,0x4E,0xA4,0xFF,0x6D,0xAC,0xFF,0x49,0x8B,0xFF,0xAF,0xAC,0xFF,0xF0,0xB4,0xFF,0x0C,0x9C,0xFF,0xEA,0x9B,0xFF,0xEA,0xA3,0xFF,0x09,0xA4,0xFF,0xE8,0xA3,0xFF,0x89,0xBC,0xFF,0xC9,0xC4,0xFF,0x29,0xCD,0xFF,0xE8,0xC4,0xFF,0x6A,0xD5,0xFF,0xEB,0xE5,0xFF,0x0A,0xE6,0xFF,0x8B,0xF6,0xFF,0xAC,0xF6,0xFF,0x8B,0xF6,0xFF,0x6A,0xF6,0xFF,0x8B,0xF6,0xFF,0xCC,0xFE,0xFF,0xCD,0xFE,0xFF,0xCD,0xF6,0xFF,0xAC,0xF6,0xFF,0x6C,0xEE,0xFF,0x0B,0xE6,0xFF,0xAB,0xD5,0xFF,0x4A,0xCD,0xFF,0xA9,0xB4,0xFF,0x07,0xA4,0xFF,0x86,0x93,0xFF,0xE5,0x82,0xFF,0x43,0x72,0xFF,0xC1,0x61,0xFF,0x20,0x59,0xFF,0xC0,0x50,0xFF,0xC0,0x50,0xFF,0xE0,0x50,0xFF,0x20,0x51,0xFF,0xA1,0x61,0xFF,0xE2,0x61,0xFF,
-    0x23,0x6A,0xFF,0x64,0x72,0xFF,0x63,0x72,0xFF,0xCA,0x9B,0xFF,0x75,0xE6,0xFF,0x54,0xE6,0xFF,0x33,0xE6,0xFF,0x0C,0xA4,0xFF,0xA0,0x69,0xFF,0x8A,0x93,0xFF,0x13,0xDE,0xFF,0xD2,0xD5,0xFF,0x34,0xDE,0xFF,0xCF,0xB4,0xFF,0x60,0x61,0xFF,0xE2,0x71,0xFF,0xE2,0x71,0xFF,0x03,0x72,0xFF,0xC2,0x71,0xFF,0xE2,0x71,0xFF,0xC2,0x71,0xFF,0x81,0x69,0xFF,0xA2,0x69,0xFF,0xA1,0x69,0xFF,0xC2,0x71,0xFF,0xC3,0x69,0xFF,0x21,0x49,0xFF,0x03,0x72,0xFF,0x22,0x7A,0xFF,0xC1,0x79,0xFF,0xC1,0x79,0xFF,0xE2,0x81,0xFF,0xA1,0x79,0xFF,0xE2,0x79,0xFF,0x02,0x82,0xFF,0xE2,0x79,0xFF,0xA1,0x71,0xFF,0xA1,0x71,0xFF,0xC8,0xB3,0xFF,0xA7,0xB3,0xFF,0xA3,0x8A,0xFF,0xC5,0x8A,0xFF,0x24,0x6A,0xFF,0x22,0x31,0xFF,0xE2,0x28,0xFF,0xE2,0x28,0xFF,0xE1,0x20,0xFF,0x06,0x4A,0xFF,0x43,0x31,0xFF,0xE1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x86,0x31,0xFF,0x29,0x42,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0xE3,0x20,0xFF,0x00,0x08,0xFF,0xA2,0x10,0xFF,0x03,0x21,0xFF,0x85,0x31,0xFF,0xE6,0x39,0xFF,0xE6,0x41,0xFF,0x07,0x4A,0xFF,0xE6,0x41,0xFF,0x85,0x39,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0xE6,0x49,0xFF,0xC2,0x20,0xFF,0x68,0x52,0xFF,0x48,0x52,0xFF,0x68,0x52,0xFF,0x48,0x52,0xFF,0xC6,0x49,0xFF,0xC6,0x41,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x24,0x21,0xFF,0x29,0x42,0xFF,0x09,0x3A,0xFF,0xC8,0x31,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0x28,0x4A,0xFF,0xA9,0x6A,0xFF,0x4E,0x9C,0xFF,0xED,0x93,0xFF,0x4A,0x83,0xFF,0xE8,0x7A,0xFF,
-    0x85,0x72,0xFF,0xE0,0x69,0xFF,0x41,0x7A,0xFF,0xA2,0x82,0xFF,0xC3,0x8A,0xFF,0xC4,0x8A,0xFF,0x66,0x9B,0xFF,0xA6,0xA3,0xFF,0xE6,0xAB,0xFF,0x26,0xB4,0xFF,0x47,0xBC,0xFF,0x87,0xC4,0xFF,0xA7,0xCC,0xFF,0xC7,0xCC,0xFF,0xE8,0xD4,0xFF,0x89,0xE5,0xFF,0xEA,0xE5,0xFF,0x2B,0xF6,0xFF,0x2B,0xF6,0xFF,0x6C,0xF6,0xFF,0x8C,0xF6,0xFF,0x6B,0xF6,0xFF,0x6C,0xF6,0xFF,0x2B,0xEE,0xFF,0xEB,0xE5,0xFF,0xCA,0xDD,0xFF,0x8A,0xD5,0xFF,0x4A,0xCD,0xFF,0xC9,0xBC,0xFF,0x27,0xAC,0xFF,0xA5,0x9B,0xFF,0x03,0x8B,0xFF,0x82,0x82,0xFF,0x41,0x7A,0xFF,0x00,0x7A,0xFF,0xA0,0x69,0xFF,0xA0,0x69,0xFF,0x80,0x61,0xFF,0x80,0x61,0xFF,0x80,0x61,0xFF,0x80,0x61,0xFF,0xA1,0x61,0xFF,0xA1,0x61,0xFF,0xA1,0x61,0xFF,0xC1,0x61,0xFF,0xC2,0x61,0xFF,0xC2,0x61,0xFF,0x03,0x6A,0xFF,0x43,0x72,0xFF,0x63,0x72,0xFF,0x83,0x72,0xFF,0x4C,0xAC,0xFF,0xB6,0xEE,0xFF,0x74,0xE6,0xFF,0x54,0xE6,0xFF,0x0F,0xBD,0xFF,0xA0,0x69,0xFF,0x44,0x72,0xFF,0x71,0xCD,0xFF,0x33,0xDE,0xFF,0x91,0xCD,0xFF,0x13,0xDE,0xFF,0x49,0x8B,0xFF,0xE1,0x71,0xFF,
-    0x23,0x7A,0xFF,0x02,0x72,0xFF,0xA1,0x71,0xFF,0xE2,0x71,0xFF,0xC2,0x71,0xFF,0x81,0x69,0xFF,0xC2,0x69,0xFF,0x03,0x7A,0xFF,0xE3,0x69,0xFF,0x62,0x59,0xFF,0x03,0x72,0xFF,0x02,0x7A,0xFF,0xE1,0x79,0xFF,0xE1,0x81,0xFF,0x01,0x82,0xFF,0x01,0x82,0xFF,0x02,0x8A,0xFF,0x22,0x8A,0xFF,0x22,0x82,0xFF,0xE1,0x79,0xFF,0x23,0x82,0xFF,0xA7,0xB3,0xFF,0x25,0xA3,0xFF,0x83,0x8A,0xFF,0xC6,0x8A,0xFF,0x45,0x6A,0xFF,0x22,0x31,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xE1,0x20,0xFF,0x06,0x42,0xFF,0x43,0x31,0xFF,0xE1,0x20,0xFF,0xC1,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE1,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x20,0x08,0xFF,0xA6,0x31,0xFF,0x08,0x42,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xE7,0x39,0xFF,0x81,0x18,0xFF,0x40,0x08,0xFF,0xC2,0x18,0xFF,0x44,0x29,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x06,0x42,0xFF,0xE6,0x41,0xFF,0xC5,0x41,0xFF,0xA5,0x41,0xFF,0xE6,0x49,0xFF,0x27,0x52,0xFF,0xE6,0x49,0xFF,0xC2,0x20,0xFF,0x68,0x52,0xFF,0x88,0x52,0xFF,0x68,0x52,0xFF,0x88,0x5A,0xFF,0x47,0x52,0xFF,0x07,0x52,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0x65,0x31,0xFF,0x45,0x21,0xFF,0x29,0x42,0xFF,0xA7,0x31,0xFF,0xC8,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x31,0xFF,0xE7,0x39,0xFF,0x07,0x4A,0xFF,0x67,0x62,0xFF,0x85,0x72,0xFF,0xC5,0x8A,0xFF,0xA7,0xA3,0xFF,0x66,0xA3,0xFF,0xA6,0xAB,0xFF,0xC7,0xB3,0xFF,0xC7,0xB3,0xFF,0xE7,0xB3,0xFF,0x07,0xB4,0xFF,0x27,0xBC,0xFF,0x27,0xBC,0xFF,0x47,0xBC,0xFF,0x67,0xC4,0xFF,0xC8,0xCC,0xFF,0xE8,0xD4,0xFF,0x08,0xD5,0xFF,0x08,0xD5,0xFF,0x28,0xDD,0xFF,0x48,0xDD,0xFF,0x49,0xDD,0xFF,0x49,0xD5,0xFF,
-    0x29,0xD5,0xFF,0xC8,0xC4,0xFF,0x67,0xBC,0xFF,0x27,0xB4,0xFF,0xE6,0xAB,0xFF,0x65,0x9B,0xFF,0x04,0x93,0xFF,0xE3,0x92,0xFF,0x03,0x93,0xFF,0xC1,0x92,0xFF,0xE2,0x92,0xFF,0x02,0x9B,0xFF,0x43,0x9B,0xFF,0x43,0x9B,0xFF,0x03,0x9B,0xFF,0x03,0x9B,0xFF,0x03,0x93,0xFF,0xE3,0x92,0xFF,0xA3,0x8A,0xFF,0x62,0x82,0xFF,0x22,0x7A,0xFF,0xE1,0x71,0xFF,0xA0,0x61,0xFF,0x80,0x61,0xFF,0x60,0x59,0xFF,0x81,0x59,0xFF,0xA1,0x61,0xFF,0xA1,0x61,0xFF,0xA1,0x61,0xFF,0xC1,0x61,0xFF,0xE2,0x69,0xFF,0x43,0x72,0xFF,0x63,0x72,0xFF,0x84,0x7A,0xFF,0xA3,0x7A,0xFF,0x6C,0xAC,0xFF,0xB6,0xEE,0xFF,0x33,0xDE,0xFF,0x33,0xE6,0xFF,0xB1,0xD5,0xFF,0x03,0x72,0xFF,0xC1,0x69,0xFF,0x4D,0xAC,0xFF,0x33,0xE6,0xFF,0x13,0xDE,0xFF,0xD2,0xD5,0xFF,0x50,0xCD,0xFF,0x02,0x72,0xFF,0x22,0x7A,0xFF,0xE1,0x71,0xFF,0xC1,0x71,0xFF,0x02,0x7A,0xFF,0xA1,0x69,0xFF,0xC2,0x71,0xFF,0x23,0x7A,0xFF,0x03,0x72,0xFF,0xA2,0x61,0xFF,0x43,0x7A,0xFF,0x42,0x82,0xFF,0x21,0x82,0xFF,0x21,0x8A,0xFF,0x22,0x8A,0xFF,0x42,0x8A,0xFF,0x82,0x92,0xFF,
-    0x62,0x92,0xFF,0x42,0x8A,0xFF,0x42,0x8A,0xFF,0xC4,0x9A,0xFF,0xC7,0xB3,0xFF,0xE4,0x92,0xFF,0x83,0x82,0xFF,0xE6,0x82,0xFF,0x45,0x6A,0xFF,0x22,0x39,0xFF,0x22,0x31,0xFF,0x23,0x31,0xFF,0x03,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE1,0x20,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE1,0x20,0xFF,0xE1,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0xC1,0x18,0xFF,0xE6,0x41,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0x86,0x29,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0x40,0x08,0xFF,0x81,0x10,0xFF,0x24,0x21,0xFF,0x86,0x31,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,
-    0x27,0x4A,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x49,0xFF,0x06,0x4A,0xFF,0xE2,0x28,0xFF,0x85,0x31,0xFF,0xA9,0x5A,0xFF,0x88,0x5A,0xFF,0x88,0x5A,0xFF,0x88,0x62,0xFF,0x47,0x5A,0xFF,0x47,0x52,0xFF,0x47,0x52,0xFF,0xE6,0x41,0xFF,0x24,0x21,0xFF,0x08,0x42,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0x66,0x29,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xC7,0x31,0xFF,0x08,0x42,0xFF,0xE6,0x51,0xFF,0xC6,0x82,0xFF,0xC8,0xAB,0xFF,0x25,0x9B,0xFF,0xC7,0xB3,0xFF,0xC6,0xB3,0xFF,0x06,0xBC,0xFF,0x47,0xC4,0xFF,0x68,0xCC,0xFF,0x88,0xCC,0xFF,0x67,0xC4,0xFF,0x68,0xC4,0xFF,0x88,0xC4,0xFF,0xA8,0xCC,0xFF,0x88,0xC4,0xFF,0x68,0xC4,0xFF,0x07,0xB4,0xFF,0xC6,0xAB,0xFF,0xA5,0xAB,0xFF,0x65,0xA3,0xFF,0xE4,0x9A,0xFF,0x62,0x8A,0xFF,0x01,0x82,0xFF,0x21,0x82,0xFF,0x21,0x82,0xFF,0x41,0x8A,0xFF,0xA2,0x92,0xFF,0x81,0x92,0xFF,0xE2,0x9A,0xFF,0x44,0xA3,0xFF,0x64,0xAB,0xFF,0xA4,0xAB,0xFF,0x84,0xAB,0xFF,0x84,0xAB,0xFF,0xA5,0xAB,0xFF,0xC5,0xAB,0xFF,0x64,0xA3,0xFF,0x24,0x9B,0xFF,0x24,0x9B,0xFF,
-    0xE3,0x92,0xFF,0xA3,0x8A,0xFF,0x62,0x82,0xFF,0x21,0x7A,0xFF,0xE1,0x71,0xFF,0xC1,0x69,0xFF,0xA1,0x61,0xFF,0x81,0x61,0xFF,0x81,0x59,0xFF,0x60,0x59,0xFF,0x81,0x59,0xFF,0x81,0x59,0xFF,0xC1,0x61,0xFF,0x02,0x6A,0xFF,0x23,0x72,0xFF,0x83,0x7A,0xFF,0xA4,0x7A,0xFF,0xC4,0x82,0xFF,0xC4,0x82,0xFF,0xC9,0x9B,0xFF,0x33,0xE6,0xFF,0xB1,0xD5,0xFF,0x33,0xDE,0xFF,0x34,0xE6,0xFF,0x28,0x8B,0xFF,0xA0,0x69,0xFF,0xE7,0x82,0xFF,0xF2,0xD5,0xFF,0x13,0xDE,0xFF,0x13,0xDE,0xFF,0x54,0xE6,0xFF,0x28,0x8B,0xFF,0x21,0x7A,0xFF,0x02,0x72,0xFF,0x43,0x82,0xFF,0x23,0x7A,0xFF,0xC2,0x71,0xFF,0x23,0x7A,0xFF,0xE3,0x71,0xFF,0xC2,0x69,0xFF,0x43,0x82,0xFF,0x21,0x82,0xFF,0x41,0x8A,0xFF,0x82,0x92,0xFF,0x62,0x92,0xFF,0x82,0x92,0xFF,0xC3,0x9A,0xFF,0xC3,0x9A,0xFF,0xA2,0x9A,0xFF,0x82,0x92,0xFF,0xE3,0x9A,0xFF,0x86,0xB3,0xFF,0xC3,0x92,0xFF,0x84,0x8A,0xFF,0xC6,0x82,0xFF,0x04,0x5A,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x23,0x31,0xFF,0x22,0x31,0xFF,0x02,0x31,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,
-    0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x01,0x29,0xFF,0x01,0x31,0xFF,0xE1,0x28,0xFF,0xE1,0x28,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x81,0x10,0xFF,0x44,0x29,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0xA1,0x10,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0x86,0x29,0xFF,0xE8,0x39,0xFF,0xA6,0x31,0xFF,0x20,0x08,0xFF,0xC2,0x18,0xFF,0x65,0x29,0xFF,0x65,0x29,0xFF,0x65,0x31,0xFF,0x07,0x42,0xFF,0x47,0x4A,0xFF,0xC6,0x41,0xFF,0x27,0x52,0xFF,0x06,0x4A,0xFF,0x27,0x52,0xFF,0x84,0x39,0xFF,0x03,0x21,0xFF,0x89,0x52,0xFF,0x68,0x52,0xFF,0x68,0x5A,0xFF,0x88,0x62,0xFF,0x67,0x5A,0xFF,0x26,0x52,0xFF,0x67,0x5A,0xFF,0xE6,0x41,0xFF,0x44,0x29,0xFF,
-    0x08,0x3A,0xFF,0xAB,0x52,0xFF,0xE8,0x39,0xFF,0x6A,0x4A,0xFF,0x65,0x29,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE7,0x39,0xFF,0xE6,0x49,0xFF,0x86,0x72,0xFF,0xE8,0xB3,0xFF,0xE7,0xBB,0xFF,0x86,0xAB,0xFF,0xC4,0x92,0xFF,0xC7,0xB3,0xFF,0xE7,0xB3,0xFF,0xC7,0xAB,0xFF,0x86,0xAB,0xFF,0x45,0xA3,0xFF,0xC4,0x92,0xFF,0xC4,0x92,0xFF,0x63,0x82,0xFF,0xE1,0x71,0xFF,0xE1,0x79,0xFF,0x21,0x82,0xFF,0x01,0x82,0xFF,0x21,0x8A,0xFF,0xA3,0x9A,0xFF,0x82,0x92,0xFF,0x62,0x92,0xFF,0x42,0x8A,0xFF,0x42,0x8A,0xFF,0x83,0x92,0xFF,0xC3,0x9A,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0xE3,0xA2,0xFF,0xE3,0x9A,0xFF,0x23,0xA3,0xFF,0x43,0xA3,0xFF,0x44,0xA3,0xFF,0x84,0xAB,0xFF,0x84,0xAB,0xFF,0x64,0xA3,0xFF,0x65,0xA3,0xFF,0x44,0xA3,0xFF,0x45,0xA3,0xFF,0x65,0xA3,0xFF,0x44,0x9B,0xFF,0x04,0x9B,0xFF,0xC3,0x8A,0xFF,0x62,0x82,0xFF,0x01,0x72,0xFF,0xE2,0x71,0xFF,0xE1,0x69,0xFF,0xC1,0x69,0xFF,0xA1,0x61,0xFF,0xC1,0x61,0xFF,0xE2,0x69,0xFF,0xE2,0x61,0xFF,0xE2,0x69,0xFF,0x23,0x72,0xFF,0x63,0x7A,0xFF,0xA4,0x7A,0xFF,
-    0xC4,0x82,0xFF,0xE5,0x82,0xFF,0x05,0x83,0xFF,0x66,0x93,0xFF,0x91,0xCD,0xFF,0xF2,0xDD,0xFF,0xD1,0xDD,0xFF,0xF2,0xDD,0xFF,0xEF,0xBC,0xFF,0x03,0x6A,0xFF,0x86,0x72,0xFF,0xF3,0xD5,0xFF,0xD2,0xD5,0xFF,0xD2,0xD5,0xFF,0x75,0xE6,0xFF,0x69,0x93,0xFF,0x20,0x7A,0xFF,0x42,0x82,0xFF,0x43,0x82,0xFF,0x22,0x7A,0xFF,0x23,0x7A,0xFF,0xA2,0x61,0xFF,0xE2,0x69,0xFF,0x83,0x8A,0xFF,0x42,0x8A,0xFF,0x62,0x92,0xFF,0x03,0xAB,0xFF,0xE3,0xA2,0xFF,0xC2,0x9A,0xFF,0x02,0xA3,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0xC2,0x9A,0xFF,0x44,0xAB,0xFF,0xC6,0xBB,0xFF,0xE4,0x9A,0xFF,0xC5,0x8A,0xFF,0xA6,0x7A,0xFF,0xE4,0x51,0xFF,0x22,0x31,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x23,0x31,0xFF,0x22,0x31,0xFF,0x02,0x31,0xFF,0x02,0x31,0xFF,0x02,0x29,0xFF,0x02,0x31,0xFF,0x02,0x31,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x61,0x39,0xFF,0x22,0x5A,0xFF,0x62,0x62,0xFF,
-    0x81,0x49,0xFF,0x21,0x31,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0xC2,0x18,0xFF,0x08,0x42,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0x08,0x42,0xFF,0x24,0x29,0xFF,0x20,0x08,0xFF,0x03,0x21,0xFF,0x44,0x29,0xFF,0x65,0x29,0xFF,0x07,0x42,0xFF,0x68,0x52,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0x47,0x52,0xFF,0x68,0x5A,0xFF,0x06,0x4A,0xFF,0xC2,0x20,0xFF,0x27,0x4A,0xFF,0x88,0x5A,0xFF,0x68,0x52,0xFF,0x06,0x52,0xFF,0x27,0x52,0xFF,0x26,0x52,0xFF,0x68,0x5A,0xFF,0x47,0x52,0xFF,0xA5,0x39,0xFF,0x85,0x31,0xFF,0x0C,0x5B,0xFF,0x29,0x42,0xFF,0x08,0x3A,0xFF,0xA7,0x31,0xFF,0x04,0x21,0xFF,0x66,0x29,0xFF,0xC7,0x39,0xFF,0xA6,0x41,0xFF,0xE4,0x59,0xFF,0x27,0x9B,0xFF,0xC7,0xB3,0xFF,0xA6,0xB3,0xFF,0x07,0xBC,0xFF,0x09,0xBC,0xFF,0xE0,0x79,0xFF,0xE1,0x81,0xFF,
-    0x42,0x8A,0xFF,0x82,0x92,0xFF,0x83,0x92,0xFF,0x83,0x92,0xFF,0x83,0x92,0xFF,0x63,0x8A,0xFF,0x62,0x8A,0xFF,0x63,0x8A,0xFF,0xE4,0x9A,0xFF,0x83,0x92,0xFF,0x42,0x8A,0xFF,0x62,0x8A,0xFF,0x42,0x8A,0xFF,0x42,0x8A,0xFF,0x22,0x82,0xFF,0x02,0x82,0xFF,0x42,0x8A,0xFF,0x62,0x92,0xFF,0x62,0x92,0xFF,0x62,0x92,0xFF,0x82,0x92,0xFF,0xA3,0x9A,0xFF,0xE3,0x9A,0xFF,0x44,0xA3,0xFF,0x65,0xAB,0xFF,0x85,0xAB,0xFF,0x85,0xAB,0xFF,0x85,0xA3,0xFF,0x85,0xAB,0xFF,0xC6,0xAB,0xFF,0xC6,0xAB,0xFF,0xA5,0xAB,0xFF,0x65,0xA3,0xFF,0x24,0x9B,0xFF,0xC3,0x92,0xFF,0x62,0x82,0xFF,0x22,0x72,0xFF,0x02,0x72,0xFF,0xE1,0x71,0xFF,0xC1,0x69,0xFF,0xC1,0x69,0xFF,0xC1,0x61,0xFF,0xE2,0x69,0xFF,0xE1,0x69,0xFF,0xE2,0x69,0xFF,0x22,0x72,0xFF,0x83,0x7A,0xFF,0xC4,0x82,0xFF,0x05,0x83,0xFF,0x25,0x8B,0xFF,0x05,0x8B,0xFF,0x45,0x93,0xFF,0x2B,0xAC,0xFF,0xF1,0xDD,0xFF,0xF2,0xDD,0xFF,0x2F,0xC5,0xFF,0x70,0xCD,0xFF,0x91,0xCD,0xFF,0x34,0xDE,0xFF,0xD2,0xD5,0xFF,0xD2,0xD5,0xFF,0x34,0xDE,0xFF,0x34,0xDE,0xFF,0x84,0x7A,0xFF,
-    0x82,0x82,0xFF,0x83,0x8A,0xFF,0x42,0x82,0xFF,0x43,0x7A,0xFF,0x81,0x61,0xFF,0xE2,0x71,0xFF,0xA3,0x92,0xFF,0x62,0x8A,0xFF,0x82,0x92,0xFF,0xC2,0xA2,0xFF,0x23,0xAB,0xFF,0x22,0xA3,0xFF,0x63,0xAB,0xFF,0xA8,0xC4,0xFF,0x06,0xBC,0xFF,0x23,0xA3,0xFF,0x06,0xBC,0xFF,0x27,0xC4,0xFF,0x24,0xA3,0xFF,0x05,0x93,0xFF,0xC6,0x82,0xFF,0xC4,0x51,0xFF,0x42,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x22,0x31,0xFF,0x23,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xE1,0x20,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x01,0x29,0xFF,0x42,0x5A,0xFF,0x6D,0xBD,0xFF,0x2F,0xD6,0xFF,0xE6,0x93,0xFF,0x60,0x41,0xFF,0xE1,0x28,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x04,0x21,0xFF,0xE8,0x39,0xFF,0x86,0x31,0xFF,0xE7,0x39,0xFF,0x08,0x42,0xFF,0xC2,0x18,0xFF,0x60,0x08,0xFF,0x03,0x19,0xFF,0x44,0x21,0xFF,0xC6,0x39,0xFF,0x68,0x4A,0xFF,0x68,0x52,0xFF,0x06,0x42,0xFF,0x68,0x52,0xFF,0x67,0x52,0xFF,0x27,0x52,0xFF,0x44,0x31,0xFF,0xC6,0x39,0xFF,0xA9,0x5A,0xFF,0x88,0x5A,0xFF,0x68,0x5A,0xFF,0x06,0x52,0xFF,0xC5,0x49,0xFF,0x26,0x52,0xFF,0x67,0x5A,0xFF,0x06,0x4A,0xFF,0x64,0x31,0xFF,0xEB,0x52,0xFF,0x8A,0x4A,0xFF,0xE8,0x39,0xFF,0x29,0x42,0xFF,0x66,0x29,0xFF,0x45,0x29,0xFF,0x86,0x31,0xFF,0xC6,0x39,0xFF,0xA4,0x51,0xFF,0x64,0x82,0xFF,0xE4,0x9A,0xFF,0x65,0xB3,0xFF,0x64,0xB3,0xFF,0x89,0xCC,0xFF,0xA4,0x92,0xFF,0xE1,0x81,0xFF,0x22,0x82,0xFF,0x42,0x8A,0xFF,0x82,0x92,0xFF,0x82,0x8A,0xFF,0x83,0x8A,0xFF,0x42,0x8A,0xFF,0x02,0x7A,0xFF,0xE1,0x79,0xFF,0xC1,0x79,0xFF,0xE1,0x79,0xFF,0xE1,0x81,0xFF,0x22,0x82,0xFF,0x22,0x8A,0xFF,0x22,0x8A,0xFF,0x22,0x8A,0xFF,0x42,0x8A,0xFF,0x63,0x92,0xFF,
-    0x42,0x8A,0xFF,0x42,0x8A,0xFF,0x42,0x8A,0xFF,0x42,0x92,0xFF,0x82,0x92,0xFF,0xC3,0x9A,0xFF,0x24,0xA3,0xFF,0x64,0xAB,0xFF,0x65,0xAB,0xFF,0x85,0xAB,0xFF,0x85,0xAB,0xFF,0xA5,0xAB,0xFF,0xA5,0xAB,0xFF,0xC6,0xB3,0xFF,0xE6,0xB3,0xFF,0xC5,0xAB,0xFF,0x84,0xA3,0xFF,0x24,0x9B,0xFF,0x03,0x93,0xFF,0xA2,0x8A,0xFF,0x62,0x82,0xFF,0x42,0x7A,0xFF,0x01,0x72,0xFF,0xC1,0x69,0xFF,0xC1,0x61,0xFF,0xA1,0x61,0xFF,0xA1,0x61,0xFF,0xC1,0x61,0xFF,0xE1,0x69,0xFF,0x43,0x72,0xFF,0xA4,0x7A,0xFF,0xE4,0x82,0xFF,0x05,0x8B,0xFF,0x45,0x8B,0xFF,0x25,0x8B,0xFF,0xE3,0x82,0xFF,0xE8,0xA3,0xFF,0xEC,0xC4,0xFF,0xD0,0xDD,0xFF,0x6F,0xCD,0xFF,0x70,0xCD,0xFF,0x74,0xE6,0xFF,0xD6,0xEE,0xFF,0x13,0xDE,0xFF,0x71,0xC5,0xFF,0x95,0xE6,0xFF,0x4D,0xA4,0xFF,0x60,0x82,0xFF,0xE3,0x8A,0xFF,0xA3,0x8A,0xFF,0x63,0x82,0xFF,0xA1,0x69,0xFF,0x43,0x7A,0xFF,0xE4,0x9A,0xFF,0xC3,0x9A,0xFF,0x82,0x92,0xFF,0xE3,0xA2,0xFF,0x03,0xA3,0xFF,0x84,0xAB,0xFF,0x26,0xBC,0xFF,0xE4,0xB3,0xFF,0x4A,0xD5,0xFF,0x87,0xC4,0xFF,0x06,0xBC,0xFF,
-    0x06,0xBC,0xFF,0x24,0xA3,0xFF,0x26,0x9B,0xFF,0xC6,0x82,0xFF,0xC3,0x51,0xFF,0x83,0x41,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x22,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x42,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x31,0xFF,0x82,0x39,0xFF,0x04,0x4A,0xFF,0x41,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0xE1,0x28,0xFF,0xC3,0x6A,0xFF,0x90,0xDE,0xFF,0x74,0xFF,0xFF,0x09,0xB5,0xFF,0xA0,0x51,0xFF,0xC0,0x28,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x20,0x00,0xFF,0x65,0x29,0xFF,0xC7,0x39,0xFF,0x25,0x21,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0x80,0x10,0xFF,0xA1,0x10,0xFF,0xE3,0x18,0xFF,0x65,0x29,0xFF,0x07,0x42,0xFF,0x68,0x4A,0xFF,0x06,0x42,0xFF,
-    0x27,0x4A,0xFF,0x47,0x52,0xFF,0x27,0x52,0xFF,0xC5,0x41,0xFF,0x85,0x31,0xFF,0x89,0x52,0xFF,0x88,0x5A,0xFF,0x68,0x5A,0xFF,0x47,0x5A,0xFF,0x06,0x52,0xFF,0xC5,0x49,0xFF,0x27,0x52,0xFF,0x06,0x4A,0xFF,0x64,0x31,0xFF,0x89,0x4A,0xFF,0xEB,0x52,0xFF,0x29,0x3A,0xFF,0xE8,0x39,0xFF,0x28,0x42,0xFF,0x08,0x42,0xFF,0xE7,0x39,0xFF,0x07,0x4A,0xFF,0x84,0x41,0xFF,0x44,0x72,0xFF,0xE4,0x92,0xFF,0xE6,0xBB,0xFF,0xE5,0xC3,0xFF,0x88,0xCC,0xFF,0x66,0xAB,0xFF,0xE0,0x81,0xFF,0xE1,0x81,0xFF,0x01,0x7A,0xFF,0x22,0x82,0xFF,0x83,0x92,0xFF,0x63,0x8A,0xFF,0xE1,0x79,0xFF,0xE1,0x79,0xFF,0xE2,0x79,0xFF,0x02,0x7A,0xFF,0x23,0x82,0xFF,0xC2,0x79,0xFF,0x02,0x82,0xFF,0x42,0x8A,0xFF,0x22,0x8A,0xFF,0x21,0x82,0xFF,0x22,0x82,0xFF,0x42,0x8A,0xFF,0x42,0x8A,0xFF,0x62,0x92,0xFF,0x62,0x92,0xFF,0x82,0x92,0xFF,0xA3,0x9A,0xFF,0xC3,0x9A,0xFF,0xC3,0x9A,0xFF,0x03,0xA3,0xFF,0x44,0xA3,0xFF,0x44,0xA3,0xFF,0x84,0xAB,0xFF,0xA5,0xAB,0xFF,0xA5,0xAB,0xFF,0xE6,0xB3,0xFF,0x06,0xB4,0xFF,0xE5,0xB3,0xFF,0x09,0xCD,0xFF,
-    0xE8,0xCC,0xFF,0x84,0xAB,0xFF,0x44,0x9B,0xFF,0xC3,0x92,0xFF,0x82,0x8A,0xFF,0x62,0x82,0xFF,0x22,0x7A,0xFF,0x01,0x72,0xFF,0xE1,0x69,0xFF,0xC1,0x69,0xFF,0xC1,0x61,0xFF,0xC1,0x61,0xFF,0x02,0x6A,0xFF,0x63,0x7A,0xFF,0xC4,0x82,0xFF,0x05,0x8B,0xFF,0x45,0x93,0xFF,0x86,0x93,0xFF,0x45,0x93,0xFF,0x04,0x8B,0xFF,0x04,0x8B,0xFF,0xE8,0xA3,0xFF,0xEB,0xC4,0xFF,0x4E,0xCD,0xFF,0xB0,0xD5,0xFF,0x33,0xDE,0xFF,0xF7,0xEE,0xFF,0xD6,0xEE,0xFF,0x75,0xE6,0xFF,0xEF,0xB4,0xFF,0x80,0x82,0xFF,0xE4,0x92,0xFF,0xE4,0x92,0xFF,0x83,0x82,0xFF,0xE1,0x71,0xFF,0x83,0x8A,0xFF,0xE3,0x9A,0xFF,0xE3,0x9A,0xFF,0x03,0xA3,0xFF,0xE2,0x9A,0xFF,0x03,0xA3,0xFF,0x42,0xA3,0xFF,0x4F,0xEE,0xFF,0xD0,0xF6,0xFF,0xC7,0xC4,0xFF,0x45,0xBC,0xFF,0x66,0xC4,0xFF,0xE6,0xBB,0xFF,0x45,0xA3,0xFF,0x26,0x9B,0xFF,0xC6,0x7A,0xFF,0xE4,0x51,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0x83,0x41,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x63,0x31,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,
-    0x43,0x31,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x22,0x31,0xFF,0x44,0x52,0xFF,0xEF,0xAC,0xFF,0xE4,0x49,0xFF,0x01,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0xE2,0x51,0xFF,0x27,0x9C,0xFF,0xC9,0xAC,0xFF,0x44,0x83,0xFF,0x60,0x41,0xFF,0xE1,0x28,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x20,0x00,0xFF,0xA6,0x31,0xFF,0xC8,0x39,0xFF,0x45,0x29,0xFF,0xC7,0x39,0xFF,0x65,0x31,0xFF,0x60,0x10,0xFF,0xA1,0x10,0xFF,0x24,0x21,0xFF,0xA5,0x31,0xFF,0xE6,0x39,0xFF,0x06,0x42,0xFF,0xE6,0x41,0xFF,0x27,0x4A,0xFF,0x27,0x52,0xFF,0x06,0x4A,0xFF,0x64,0x31,0xFF,0x88,0x52,0xFF,0xA9,0x5A,0xFF,0x68,0x5A,0xFF,0x67,0x5A,0xFF,0x47,0x5A,0xFF,0x06,0x52,0xFF,0x27,0x52,0xFF,0xE6,0x49,0xFF,0xA5,0x39,0xFF,0x28,0x42,0xFF,0x0C,0x5B,0xFF,0x29,0x3A,0xFF,
-    0x29,0x42,0xFF,0x08,0x42,0xFF,0x08,0x42,0xFF,0x48,0x4A,0xFF,0x07,0x4A,0xFF,0xA4,0x41,0xFF,0x23,0x72,0xFF,0xE4,0x92,0xFF,0xC6,0xBB,0xFF,0x87,0xD4,0xFF,0xE8,0xDC,0xFF,0xE7,0xBB,0xFF,0xE0,0x81,0xFF,0x02,0x82,0xFF,0xE1,0x79,0xFF,0xE1,0x79,0xFF,0x22,0x82,0xFF,0x42,0x8A,0xFF,0x63,0x8A,0xFF,0xA3,0x92,0xFF,0xC3,0x9A,0xFF,0xE4,0x9A,0xFF,0xC4,0x9A,0xFF,0xC4,0x9A,0xFF,0x83,0x92,0xFF,0x63,0x8A,0xFF,0x63,0x8A,0xFF,0x42,0x8A,0xFF,0x22,0x82,0xFF,0x62,0x92,0xFF,0x82,0x92,0xFF,0x82,0x92,0xFF,0xE3,0x9A,0xFF,0xE3,0xA2,0xFF,0xC3,0x9A,0xFF,0xA2,0x9A,0xFF,0xA2,0x9A,0xFF,0xA2,0x9A,0xFF,0xE3,0x9A,0xFF,0x44,0xAB,0xFF,0x85,0xAB,0xFF,0xA5,0xB3,0xFF,0xC5,0xB3,0xFF,0xC5,0xB3,0xFF,0xE6,0xB3,0xFF,0x26,0xBC,0xFF,0x26,0xBC,0xFF,0x66,0xBC,0xFF,0xE8,0xCC,0xFF,0x67,0xC4,0xFF,0x43,0xA3,0xFF,0xE3,0x9A,0xFF,0xA2,0x8A,0xFF,0xA3,0x8A,0xFF,0x62,0x82,0xFF,0x42,0x7A,0xFF,0x22,0x7A,0xFF,0x22,0x72,0xFF,0x22,0x72,0xFF,0x22,0x72,0xFF,0x63,0x7A,0xFF,0xC4,0x82,0xFF,0x05,0x8B,0xFF,0x45,0x93,0xFF,
-    0x86,0x9B,0xFF,0x86,0x93,0xFF,0x25,0x8B,0xFF,0x04,0x8B,0xFF,0x04,0x8B,0xFF,0xE2,0x8A,0xFF,0x44,0x93,0xFF,0x08,0xAC,0xFF,0x2C,0xCD,0xFF,0xAF,0xD5,0xFF,0x94,0xE6,0xFF,0x17,0xEF,0xFF,0xB6,0xE6,0xFF,0x47,0x8B,0xFF,0x04,0x93,0xFF,0x04,0x93,0xFF,0x83,0x82,0xFF,0x02,0x72,0xFF,0xA3,0x8A,0xFF,0xE4,0x9A,0xFF,0xC2,0x9A,0xFF,0x24,0xA3,0xFF,0x23,0xA3,0xFF,0x03,0xA3,0xFF,0x43,0xA3,0xFF,0xC4,0xB3,0xFF,0x4E,0xEE,0xFF,0xF0,0xF6,0xFF,0x08,0xCD,0xFF,0xA7,0xCC,0xFF,0x67,0xC4,0xFF,0x85,0xAB,0xFF,0x66,0x9B,0xFF,0xC6,0x7A,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xC3,0x49,0xFF,0xA3,0x49,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x42,0x31,0xFF,0x43,0x31,0xFF,0x63,0x31,0xFF,0xA3,0x41,0xFF,0x45,0x52,0xFF,0xA3,0x39,0xFF,0x42,0x31,0xFF,0x42,0x29,0xFF,0x42,0x29,0xFF,0x42,0x31,0xFF,0x60,0x41,0xFF,0x80,0x41,0xFF,
-    0x20,0x39,0xFF,0x21,0x31,0xFF,0xE1,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0xC7,0x39,0xFF,0x29,0x3A,0xFF,0xC8,0x39,0xFF,0xA6,0x31,0xFF,0x03,0x21,0xFF,0x40,0x08,0xFF,0xA2,0x10,0xFF,0x24,0x21,0xFF,0x65,0x29,0xFF,0xC6,0x39,0xFF,0xC5,0x39,0xFF,0x06,0x42,0xFF,0x27,0x4A,0xFF,0x06,0x4A,0xFF,0x23,0x29,0xFF,0x68,0x4A,0xFF,0x0A,0x63,0xFF,0x27,0x52,0xFF,0x06,0x4A,0xFF,0x26,0x52,0xFF,0x27,0x52,0xFF,0x26,0x52,0xFF,0x26,0x52,0xFF,0x07,0x4A,0xFF,0xA5,0x39,0xFF,0x8A,0x4A,0xFF,0x49,0x42,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0x08,0x42,0xFF,0xE7,0x39,0xFF,0x28,0x4A,0xFF,0x27,0x52,0xFF,0x23,0x6A,0xFF,0x86,0xAB,0xFF,0xA4,0xB3,0xFF,0x05,0xC4,0xFF,0x66,0xCC,0xFF,0xE7,0xBB,0xFF,0xC0,0x81,0xFF,0x22,0x8A,0xFF,0x02,0x82,0xFF,0x02,0x82,0xFF,0xE1,0x79,0xFF,
-    0x02,0x82,0xFF,0x42,0x8A,0xFF,0x62,0x92,0xFF,0xC3,0x9A,0xFF,0xA3,0x92,0xFF,0x82,0x92,0xFF,0x62,0x8A,0xFF,0x62,0x8A,0xFF,0x42,0x8A,0xFF,0x22,0x82,0xFF,0xE1,0x79,0xFF,0x01,0x82,0xFF,0x22,0x8A,0xFF,0x82,0x92,0xFF,0xA2,0x9A,0xFF,0xE3,0x9A,0xFF,0xE3,0xA2,0xFF,0x23,0xA3,0xFF,0xE3,0xA2,0xFF,0xC3,0x9A,0xFF,0xE3,0xA2,0xFF,0xC2,0x9A,0xFF,0x03,0xA3,0xFF,0x44,0xAB,0xFF,0x64,0xAB,0xFF,0x85,0xAB,0xFF,0xC5,0xB3,0xFF,0xE5,0xB3,0xFF,0x06,0xB4,0xFF,0x26,0xBC,0xFF,0x47,0xBC,0xFF,0x06,0xB4,0xFF,0xA8,0xC4,0xFF,0xA8,0xC4,0xFF,0xA4,0xAB,0xFF,0x44,0xA3,0xFF,0xE3,0x92,0xFF,0xE3,0x92,0xFF,0xA3,0x8A,0xFF,0x62,0x82,0xFF,0x42,0x7A,0xFF,0x22,0x72,0xFF,0x02,0x6A,0xFF,0x02,0x6A,0xFF,0x22,0x72,0xFF,0x83,0x7A,0xFF,0xE4,0x82,0xFF,0x25,0x8B,0xFF,0x86,0x93,0xFF,0x65,0x93,0xFF,0x25,0x8B,0xFF,0x24,0x93,0xFF,0x24,0x93,0xFF,0x24,0x93,0xFF,0x44,0x9B,0xFF,0x22,0x93,0xFF,0x44,0x9B,0xFF,0xAA,0xBC,0xFF,0xAF,0xD5,0xFF,0xD5,0xEE,0xFF,0xF2,0xD5,0xFF,0x03,0x93,0xFF,0x04,0x93,0xFF,0xA3,0x8A,0xFF,
-    0x42,0x7A,0xFF,0xC3,0x92,0xFF,0xE3,0x9A,0xFF,0xC2,0x9A,0xFF,0x44,0xA3,0xFF,0x64,0xAB,0xFF,0x44,0xA3,0xFF,0x64,0xAB,0xFF,0xC5,0xB3,0xFF,0x05,0xBC,0xFF,0x66,0xBC,0xFF,0xC7,0xC4,0xFF,0xC7,0xCC,0xFF,0x47,0xBC,0xFF,0xC6,0xAB,0xFF,0xA7,0xA3,0xFF,0xC6,0x7A,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xA3,0x49,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x83,0x31,0xFF,0x83,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x01,0x29,0xFF,0x01,0x21,0xFF,0x01,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0x08,0x3A,0xFF,0x09,0x3A,0xFF,0x29,0x42,0xFF,0x07,0x42,0xFF,0x23,0x29,0xFF,0x20,0x08,0xFF,0xA2,0x18,0xFF,0x03,0x21,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0x27,0x4A,0xFF,0x27,0x4A,0xFF,0x27,0x4A,0xFF,0x85,0x39,0xFF,0xA6,0x39,0xFF,0x0A,0x63,0xFF,0x88,0x5A,0xFF,0x06,0x4A,0xFF,0xE6,0x49,0xFF,0x06,0x52,0xFF,0x06,0x52,0xFF,0x26,0x4A,0xFF,0x06,0x4A,0xFF,0xA5,0x39,0xFF,0x29,0x42,0xFF,0x08,0x3A,0xFF,0x29,0x3A,0xFF,0xE8,0x39,0xFF,0x28,0x42,0xFF,0x28,0x42,0xFF,0xC7,0x39,0xFF,0xE7,0x41,0xFF,0x05,0x5A,0xFF,0xE8,0xAB,0xFF,0xE5,0xBB,0xFF,0xE4,0xC3,0xFF,0x86,0xD4,0xFF,0x47,0xC4,0xFF,0x42,0x8A,0xFF,0x22,0x8A,0xFF,0x42,0x8A,0xFF,0x22,0x8A,0xFF,0x01,0x82,0xFF,0x21,0x82,0xFF,0x41,0x8A,0xFF,0x62,0x92,0xFF,0xA2,0x9A,0xFF,0xC2,0x9A,0xFF,0xE3,0x9A,0xFF,0xE3,0xA2,0xFF,0xA2,0x9A,0xFF,0x83,0x92,0xFF,0x62,0x8A,0xFF,0x42,0x8A,0xFF,0x22,0x82,0xFF,0x21,0x8A,0xFF,0x62,0x92,0xFF,0x82,0x92,0xFF,0xC2,0x9A,0xFF,0xE3,0xA2,0xFF,
-    0x23,0xAB,0xFF,0x23,0xAB,0xFF,0x03,0xA3,0xFF,0xE3,0xA2,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0x23,0xA3,0xFF,0x64,0xAB,0xFF,0xA5,0xAB,0xFF,0xC5,0xB3,0xFF,0xE5,0xB3,0xFF,0x06,0xB4,0xFF,0x26,0xBC,0xFF,0x67,0xC4,0xFF,0x67,0xC4,0xFF,0x67,0xBC,0xFF,0x06,0xB4,0xFF,0xC5,0xAB,0xFF,0x44,0x9B,0xFF,0xC3,0x8A,0xFF,0x82,0x82,0xFF,0x21,0x7A,0xFF,0xE1,0x71,0xFF,0xC1,0x69,0xFF,0xC1,0x69,0xFF,0xE1,0x69,0xFF,0x22,0x72,0xFF,0x83,0x7A,0xFF,0x25,0x93,0xFF,0x45,0x93,0xFF,0x66,0x9B,0xFF,0xA6,0xA3,0xFF,0xA6,0x9B,0xFF,0x45,0x93,0xFF,0x45,0x93,0xFF,0x44,0x93,0xFF,0x24,0x93,0xFF,0x44,0x9B,0xFF,0x23,0x93,0xFF,0x03,0x93,0xFF,0xE1,0x92,0xFF,0xE8,0xAB,0xFF,0x6A,0xB4,0xFF,0x66,0x9B,0xFF,0x24,0x9B,0xFF,0xC3,0x8A,0xFF,0x83,0x82,0xFF,0xC3,0x92,0xFF,0x04,0x9B,0xFF,0x03,0x9B,0xFF,0x03,0xA3,0xFF,0x85,0xAB,0xFF,0x64,0xAB,0xFF,0x84,0xAB,0xFF,0xC5,0xB3,0xFF,0xE5,0xB3,0xFF,0xE4,0xB3,0xFF,0x46,0xBC,0xFF,0xA7,0xCC,0xFF,0x26,0xBC,0xFF,0xC6,0xAB,0xFF,0xA8,0xA3,0xFF,0xE7,0x7A,0xFF,
-    0x44,0x5A,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0xE4,0x51,0xFF,0xC4,0x49,0xFF,0xA3,0x49,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0xC4,0x49,0xFF,0xC3,0x49,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0xA3,0x41,0xFF,0xA3,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x83,0x31,0xFF,0x43,0x31,0xFF,0x42,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0xE7,0x39,0xFF,0x08,0x3A,0xFF,0x08,0x42,0xFF,0xE7,0x39,0xFF,0x03,0x21,0xFF,0x60,0x10,0xFF,0x82,0x10,0xFF,0x24,0x21,0xFF,0xC6,0x39,0xFF,0xA5,0x39,0xFF,0x27,0x4A,0xFF,0x27,0x4A,0xFF,
-    0xE6,0x41,0xFF,0x23,0x29,0xFF,0xEA,0x62,0xFF,0xA8,0x5A,0xFF,0x06,0x4A,0xFF,0xE6,0x49,0xFF,0x06,0x52,0xFF,0x06,0x4A,0xFF,0x47,0x52,0xFF,0xC5,0x41,0xFF,0x85,0x31,0xFF,0x69,0x4A,0xFF,0x29,0x42,0xFF,0x29,0x3A,0xFF,0x49,0x42,0xFF,0x08,0x3A,0xFF,0x08,0x42,0xFF,0x08,0x42,0xFF,0xC7,0x39,0xFF,0xA5,0x41,0xFF,0xE5,0x8A,0xFF,0xC6,0xB3,0xFF,0xA4,0xBB,0xFF,0x45,0xCC,0xFF,0xC9,0xD4,0xFF,0x63,0x8A,0xFF,0x80,0x79,0xFF,0xE1,0x81,0xFF,0xE1,0x81,0xFF,0x22,0x8A,0xFF,0x62,0x8A,0xFF,0x82,0x92,0xFF,0xA3,0x9A,0xFF,0xE3,0xA2,0xFF,0xE3,0xA2,0xFF,0xE3,0xA2,0xFF,0x03,0xA3,0xFF,0x24,0xAB,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0xE3,0xA2,0xFF,0xA2,0x9A,0xFF,0x82,0x92,0xFF,0xA2,0x9A,0xFF,0xA2,0x9A,0xFF,0x82,0x9A,0xFF,0xA2,0x9A,0xFF,0x03,0xAB,0xFF,0x23,0xAB,0xFF,0x43,0xAB,0xFF,0x43,0xAB,0xFF,0x84,0xAB,0xFF,0x64,0xAB,0xFF,0x64,0xAB,0xFF,0x85,0xAB,0xFF,0xC5,0xB3,0xFF,0x06,0xBC,0xFF,0x26,0xBC,0xFF,0x26,0xBC,0xFF,0x06,0xB4,0xFF,0x26,0xBC,0xFF,0x46,0xBC,0xFF,0x26,0xB4,0xFF,
-    0x06,0xB4,0xFF,0xC5,0xAB,0xFF,0x64,0xA3,0xFF,0x03,0x93,0xFF,0xE3,0x92,0xFF,0xC3,0x8A,0xFF,0xC3,0x8A,0xFF,0xC4,0x8A,0xFF,0x83,0x82,0xFF,0x62,0x7A,0xFF,0x62,0x7A,0xFF,0x82,0x82,0xFF,0xE4,0x8A,0xFF,0x24,0x93,0xFF,0x65,0x9B,0xFF,0xA6,0xA3,0xFF,0xC6,0xA3,0xFF,0xA5,0x9B,0xFF,0x65,0x9B,0xFF,0x65,0x9B,0xFF,0x65,0x9B,0xFF,0x44,0x93,0xFF,0x44,0x93,0xFF,0x44,0x9B,0xFF,0x03,0x93,0xFF,0xE3,0x92,0xFF,0xA2,0x8A,0xFF,0xE2,0x92,0xFF,0x04,0x93,0xFF,0xE3,0x92,0xFF,0xC3,0x8A,0xFF,0x04,0x9B,0xFF,0xE3,0x9A,0xFF,0x03,0x9B,0xFF,0x23,0xA3,0xFF,0x64,0xAB,0xFF,0xA5,0xAB,0xFF,0xA5,0xB3,0xFF,0xC5,0xB3,0xFF,0xE5,0xB3,0xFF,0xC4,0xB3,0xFF,0x66,0xC4,0xFF,0xC8,0xCC,0xFF,0x06,0xB4,0xFF,0xC7,0xAB,0xFF,0xA8,0xA3,0xFF,0xE6,0x7A,0xFF,0x45,0x62,0xFF,0x45,0x62,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0xE4,0x51,0xFF,0xE4,0x51,0xFF,0xC4,0x49,0xFF,0xC4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,
-    0xA4,0x39,0xFF,0x84,0x39,0xFF,0x84,0x39,0xFF,0x84,0x39,0xFF,0x83,0x41,0xFF,0xC3,0x41,0xFF,0xA5,0x62,0xFF,0x64,0x5A,0xFF,0x83,0x39,0xFF,0x43,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0xA7,0x31,0xFF,0xE7,0x41,0xFF,0x23,0x29,0xFF,0x81,0x10,0xFF,0xA2,0x10,0xFF,0x65,0x29,0xFF,0xA6,0x39,0xFF,0xC6,0x39,0xFF,0x27,0x4A,0xFF,0x06,0x4A,0xFF,0xE2,0x20,0xFF,0x89,0x52,0xFF,0xA9,0x5A,0xFF,0x06,0x4A,0xFF,0xE6,0x49,0xFF,0x26,0x52,0xFF,0xE6,0x49,0xFF,0x06,0x4A,0xFF,0x06,0x4A,0xFF,0xA5,0x39,0xFF,0xE7,0x39,0xFF,0x28,0x42,0xFF,0x29,0x3A,0xFF,0x6A,0x42,0xFF,0x69,0x4A,0xFF,0xE8,0x39,0xFF,
-    0x08,0x42,0xFF,0x07,0x42,0xFF,0xE6,0x49,0xFF,0xA5,0x7A,0xFF,0xA6,0xAB,0xFF,0xC5,0xBB,0xFF,0xA3,0xBB,0xFF,0x09,0xDD,0xFF,0xE5,0x92,0xFF,0x40,0x71,0xFF,0x01,0x82,0xFF,0x22,0x8A,0xFF,0x42,0x92,0xFF,0x63,0x92,0xFF,0x83,0x92,0xFF,0xA3,0x9A,0xFF,0xC3,0x9A,0xFF,0xC2,0xA2,0xFF,0xA2,0x9A,0xFF,0xA2,0x9A,0xFF,0xE3,0xA2,0xFF,0x03,0xAB,0xFF,0x23,0xAB,0xFF,0x43,0xAB,0xFF,0x64,0xB3,0xFF,0x63,0xAB,0xFF,0x02,0xA3,0xFF,0x03,0xA3,0xFF,0x23,0xAB,0xFF,0x03,0xA3,0xFF,0x23,0xAB,0xFF,0x64,0xAB,0xFF,0x85,0xB3,0xFF,0x85,0xB3,0xFF,0xA5,0xB3,0xFF,0x64,0xAB,0xFF,0x43,0xA3,0xFF,0x04,0x9B,0xFF,0x03,0x9B,0xFF,0x03,0x93,0xFF,0x23,0x9B,0xFF,0x84,0xA3,0xFF,0xE5,0xB3,0xFF,0x26,0xB4,0xFF,0x46,0xBC,0xFF,0x87,0xC4,0xFF,0xA8,0xC4,0xFF,0xC8,0xCC,0xFF,0xA8,0xC4,0xFF,0x87,0xC4,0xFF,0x06,0xB4,0xFF,0xC5,0xAB,0xFF,0x64,0xA3,0xFF,0xE3,0x92,0xFF,0xC2,0x8A,0xFF,0x82,0x82,0xFF,0x41,0x7A,0xFF,0x41,0x7A,0xFF,0x62,0x82,0xFF,0xC2,0x8A,0xFF,0x44,0x9B,0xFF,0x85,0xA3,0xFF,0xC5,0xAB,0xFF,0xE6,0xAB,0xFF,
-    0x06,0xAC,0xFF,0xC6,0xA3,0xFF,0x85,0x9B,0xFF,0x85,0x9B,0xFF,0x85,0x9B,0xFF,0x65,0x9B,0xFF,0x44,0x9B,0xFF,0x24,0x93,0xFF,0xE3,0x92,0xFF,0xE3,0x8A,0xFF,0xE3,0x92,0xFF,0x04,0x9B,0xFF,0xE3,0x92,0xFF,0xE3,0x92,0xFF,0x24,0x9B,0xFF,0x03,0x9B,0xFF,0xE3,0x9A,0xFF,0x23,0xA3,0xFF,0x85,0xAB,0xFF,0x84,0xAB,0xFF,0xC5,0xB3,0xFF,0xE5,0xB3,0xFF,0x05,0xBC,0xFF,0x05,0xBC,0xFF,0xA7,0xCC,0xFF,0xC8,0xCC,0xFF,0x07,0xB4,0xFF,0xE7,0xAB,0xFF,0xC8,0x9B,0xFF,0xC6,0x72,0xFF,0x85,0x62,0xFF,0x64,0x62,0xFF,0x44,0x5A,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x51,0xFF,0x04,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x39,0xFF,0x84,0x39,0xFF,0x83,0x39,0xFF,0x83,0x41,0xFF,0xA0,0x49,0xFF,0x90,0xBD,0xFF,0x0E,0xA5,0xFF,0x20,0x31,0xFF,0x43,0x31,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,
-    0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0xE8,0x39,0xFF,0x09,0x42,0xFF,0xE8,0x39,0xFF,0x28,0x4A,0xFF,0x64,0x31,0xFF,0x60,0x10,0xFF,0xE3,0x18,0xFF,0x65,0x29,0xFF,0xA5,0x39,0xFF,0xC6,0x39,0xFF,0xE6,0x41,0xFF,0xE2,0x20,0xFF,0xE6,0x41,0xFF,0xA9,0x5A,0xFF,0x27,0x4A,0xFF,0xE6,0x49,0xFF,0x06,0x4A,0xFF,0xE6,0x49,0xFF,0xE6,0x49,0xFF,0x26,0x4A,0xFF,0xC5,0x39,0xFF,0xE7,0x39,0xFF,0x69,0x4A,0xFF,0xC7,0x31,0xFF,0x29,0x3A,0xFF,0x49,0x42,0xFF,0x49,0x4A,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0xE6,0x41,0xFF,0x04,0x5A,0xFF,0x06,0x93,0xFF,0xA6,0xB3,0xFF,0x63,0xB3,0xFF,0xC9,0xD4,0xFF,0xE8,0xB3,0xFF,0xC0,0x81,0xFF,0x01,0x82,0xFF,0xE1,0x81,0xFF,0xE1,0x81,0xFF,0x22,0x8A,0xFF,0x42,0x8A,0xFF,0x63,0x92,0xFF,0x82,0x92,0xFF,
-    0x81,0x92,0xFF,0xC2,0xA2,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0x23,0xAB,0xFF,0x44,0xAB,0xFF,0x84,0xB3,0xFF,0xA4,0xB3,0xFF,0xE5,0xBB,0xFF,0xE5,0xBB,0xFF,0x84,0xB3,0xFF,0x84,0xB3,0xFF,0x85,0xB3,0xFF,0x44,0xA3,0xFF,0xE3,0x9A,0xFF,0xA3,0x92,0xFF,0x42,0x82,0xFF,0x42,0x82,0xFF,0x42,0x82,0xFF,0x62,0x82,0xFF,0xA3,0x8A,0xFF,0xC3,0x92,0xFF,0x03,0x93,0xFF,0x44,0xA3,0xFF,0xC6,0xB3,0xFF,0x26,0xBC,0xFF,0x87,0xC4,0xFF,0xC8,0xCC,0xFF,0xA7,0xCC,0xFF,0xC8,0xCC,0xFF,0xC8,0xCC,0xFF,0xA8,0xCC,0xFF,0x87,0xC4,0xFF,0x46,0xBC,0xFF,0x06,0xB4,0xFF,0xC5,0xB3,0xFF,0x64,0xA3,0xFF,0x03,0x9B,0xFF,0xC3,0x92,0xFF,0xA2,0x8A,0xFF,0x61,0x82,0xFF,0x82,0x82,0xFF,0xC3,0x92,0xFF,0x24,0x9B,0xFF,0x85,0xA3,0xFF,0x06,0xB4,0xFF,0x06,0xB4,0xFF,0x26,0xB4,0xFF,0x27,0xB4,0xFF,0xE6,0xAB,0xFF,0xA5,0xA3,0xFF,0xA5,0x9B,0xFF,0xA5,0x9B,0xFF,0x85,0x9B,0xFF,0x44,0x9B,0xFF,0x24,0x93,0xFF,0x04,0x93,0xFF,0xE4,0x92,0xFF,0xE4,0x92,0xFF,0xE3,0x92,0xFF,0x24,0x9B,0xFF,0x44,0xA3,0xFF,0x03,0x9B,0xFF,0x03,0x9B,0xFF,
-    0x23,0xA3,0xFF,0x84,0xAB,0xFF,0xA4,0xAB,0xFF,0xA4,0xAB,0xFF,0xC5,0xB3,0xFF,0xE5,0xB3,0xFF,0x05,0xBC,0xFF,0xE8,0xD4,0xFF,0xE8,0xCC,0xFF,0x27,0xBC,0xFF,0xE8,0xAB,0xFF,0xC8,0x9B,0xFF,0xE6,0x7A,0xFF,0x85,0x6A,0xFF,0x85,0x6A,0xFF,0x64,0x62,0xFF,0x44,0x62,0xFF,0x44,0x5A,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x51,0xFF,0x04,0x5A,0xFF,0x24,0x62,0xFF,0xC5,0x72,0xFF,0x47,0x83,0xFF,0x24,0x5A,0xFF,0xE4,0x51,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0xA2,0x41,0xFF,0x89,0x7B,0xFF,0x47,0x73,0xFF,0x62,0x39,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x86,0x31,0xFF,0xE8,0x39,0xFF,0x08,0x42,0xFF,0x48,0x4A,0xFF,0x64,0x31,0xFF,0x60,0x10,0xFF,0x24,0x21,0xFF,0x85,0x29,0xFF,0xA5,0x31,0xFF,0xC5,0x41,0xFF,0x44,0x29,0xFF,0x64,0x29,0xFF,0xA9,0x5A,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,0xA5,0x39,0xFF,0x06,0x4A,0xFF,0x06,0x4A,0xFF,0x27,0x4A,0xFF,0x06,0x4A,0xFF,0xC6,0x39,0xFF,0x69,0x4A,0xFF,0xC7,0x31,0xFF,0xC8,0x39,0xFF,0x08,0x3A,0xFF,0x49,0x42,0xFF,0x49,0x4A,0xFF,0x28,0x42,0xFF,0xE6,0x41,0xFF,0xC4,0x51,0xFF,0xA5,0x82,0xFF,0x24,0xA3,0xFF,0x43,0xAB,0xFF,0x47,0xC4,0xFF,0x49,0xBC,0xFF,0x01,0x82,0xFF,0x83,0x9A,0xFF,0x62,0x92,0xFF,0xE1,0x81,0xFF,0xA1,0x79,0xFF,0x22,0x82,0xFF,0x83,0x92,0xFF,0x83,0x92,0xFF,0xC4,0x9A,0xFF,0x86,0xB3,0xFF,0x48,0xC4,0xFF,0x27,0xC4,0xFF,0xA5,0xBB,0xFF,0x24,0xA3,0xFF,0x24,0xA3,0xFF,0x03,0xA3,0xFF,0xC2,0x9A,0xFF,0xC2,0x9A,0xFF,0xC2,0x92,0xFF,0xE3,0x92,0xFF,0xE3,0x92,0xFF,0xE3,0x92,0xFF,0x04,0x93,0xFF,0x24,0x9B,0xFF,0x24,0x9B,0xFF,
-    0xE4,0x92,0xFF,0x65,0xA3,0xFF,0x85,0xAB,0xFF,0x64,0xA3,0xFF,0x64,0xAB,0xFF,0x64,0xAB,0xFF,0x64,0xAB,0xFF,0x84,0xAB,0xFF,0xC5,0xB3,0xFF,0xE5,0xB3,0xFF,0x46,0xC4,0xFF,0xA7,0xCC,0xFF,0x08,0xD5,0xFF,0x08,0xD5,0xFF,0x29,0xD5,0xFF,0x08,0xD5,0xFF,0xE8,0xCC,0xFF,0xA7,0xCC,0xFF,0x46,0xC4,0xFF,0x06,0xBC,0xFF,0xC5,0xAB,0xFF,0x64,0xA3,0xFF,0x23,0x9B,0xFF,0xE3,0x92,0xFF,0xC2,0x8A,0xFF,0xC2,0x8A,0xFF,0x23,0x9B,0xFF,0x84,0xA3,0xFF,0xA5,0xAB,0xFF,0x26,0xBC,0xFF,0x47,0xBC,0xFF,0x47,0xBC,0xFF,0x46,0xB4,0xFF,0x06,0xAC,0xFF,0xC5,0xA3,0xFF,0xA5,0xA3,0xFF,0xA5,0xA3,0xFF,0x85,0xA3,0xFF,0x64,0x9B,0xFF,0x24,0x93,0xFF,0x24,0x93,0xFF,0x04,0x93,0xFF,0xE3,0x92,0xFF,0x24,0x9B,0xFF,0x44,0xA3,0xFF,0x44,0xA3,0xFF,0x23,0x9B,0xFF,0x43,0xA3,0xFF,0x67,0xBC,0xFF,0x2A,0xCD,0xFF,0x67,0xBC,0xFF,0xE5,0xB3,0xFF,0xC5,0xB3,0xFF,0x05,0xBC,0xFF,0xC8,0xCC,0xFF,0xC8,0xCC,0xFF,0x47,0xBC,0xFF,0x08,0xAC,0xFF,0xA8,0x9B,0xFF,0xE6,0x7A,0xFF,0xC5,0x72,0xFF,0xC5,0x6A,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,
-    0x64,0x62,0xFF,0x44,0x62,0xFF,0x24,0x5A,0xFF,0x25,0x5A,0xFF,0x05,0x52,0xFF,0x04,0x52,0xFF,0x24,0x5A,0xFF,0x44,0x6A,0xFF,0x67,0x8B,0xFF,0xED,0xB4,0xFF,0x44,0x62,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x21,0x39,0xFF,0x42,0x39,0xFF,0x63,0x31,0xFF,0x42,0x31,0xFF,0x43,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x65,0x29,0xFF,0xA7,0x31,0xFF,0xE7,0x39,0xFF,0x28,0x4A,0xFF,0x03,0x21,0xFF,0xA1,0x18,0xFF,0x23,0x21,0xFF,0x85,0x31,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x24,0x21,0xFF,0x89,0x52,0xFF,
-    0x48,0x4A,0xFF,0x07,0x42,0xFF,0xC6,0x41,0xFF,0xA5,0x41,0xFF,0xC5,0x41,0xFF,0xC5,0x41,0xFF,0x27,0x4A,0xFF,0x07,0x42,0xFF,0x69,0x4A,0xFF,0x08,0x3A,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0x49,0x42,0xFF,0x69,0x4A,0xFF,0x28,0x4A,0xFF,0xC5,0x51,0xFF,0xE5,0x8A,0xFF,0x24,0xA3,0xFF,0xC5,0xBB,0xFF,0xC5,0xB3,0xFF,0x89,0xC4,0xFF,0xC1,0x71,0xFF,0x63,0x92,0xFF,0x25,0xA3,0xFF,0x45,0xAB,0xFF,0x26,0xAB,0xFF,0xE5,0x9A,0xFF,0xA5,0x92,0xFF,0x85,0x92,0xFF,0x85,0x8A,0xFF,0x84,0x8A,0xFF,0xA5,0x8A,0xFF,0xC5,0x8A,0xFF,0xA4,0x92,0xFF,0xC3,0x92,0xFF,0xE4,0x9A,0xFF,0x24,0xA3,0xFF,0x85,0xAB,0xFF,0x06,0xBC,0xFF,0x47,0xC4,0xFF,0x87,0xCC,0xFF,0x67,0xCC,0xFF,0x46,0xC4,0xFF,0x26,0xC4,0xFF,0x26,0xC4,0xFF,0x05,0xBC,0xFF,0xA5,0xB3,0xFF,0x43,0xA3,0xFF,0x64,0xAB,0xFF,0x64,0xAB,0xFF,0x64,0xAB,0xFF,0x64,0xAB,0xFF,0x44,0xAB,0xFF,0x63,0xAB,0xFF,0xA4,0xB3,0xFF,0xC4,0xB3,0xFF,0x26,0xBC,0xFF,0x87,0xCC,0xFF,0xE8,0xD4,0xFF,0x29,0xDD,0xFF,0x69,0xDD,0xFF,0x89,0xE5,0xFF,0x89,0xDD,0xFF,
-    0x49,0xDD,0xFF,0xE8,0xD4,0xFF,0x87,0xC4,0xFF,0x26,0xBC,0xFF,0xE5,0xB3,0xFF,0x64,0xA3,0xFF,0x23,0x9B,0xFF,0xE2,0x92,0xFF,0xE2,0x92,0xFF,0xE3,0x92,0xFF,0x23,0x9B,0xFF,0x84,0xAB,0xFF,0x06,0xB4,0xFF,0x47,0xBC,0xFF,0x87,0xC4,0xFF,0x87,0xC4,0xFF,0x67,0xBC,0xFF,0x26,0xB4,0xFF,0xE6,0xAB,0xFF,0xA5,0xA3,0xFF,0xA5,0xA3,0xFF,0x85,0x9B,0xFF,0x65,0x9B,0xFF,0x44,0x9B,0xFF,0x24,0x93,0xFF,0x04,0x93,0xFF,0x24,0x9B,0xFF,0x24,0x9B,0xFF,0x44,0xA3,0xFF,0x44,0xA3,0xFF,0x64,0xA3,0xFF,0xC4,0xAB,0xFF,0x8F,0xEE,0xFF,0x93,0xFF,0xFF,0xAB,0xDD,0xFF,0x25,0xBC,0xFF,0x46,0xC4,0xFF,0xC8,0xCC,0xFF,0xA8,0xCC,0xFF,0x48,0xBC,0xFF,0x08,0xB4,0xFF,0x87,0x9B,0xFF,0xE6,0x7A,0xFF,0xC6,0x7A,0xFF,0xE6,0x72,0xFF,0xC6,0x72,0xFF,0xA5,0x6A,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,0x85,0x62,0xFF,0x65,0x62,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x62,0xFF,0x44,0x62,0xFF,0x84,0x6A,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0xE3,0x49,0xFF,0xE4,0x49,0xFF,0xC4,0x41,0xFF,
-    0xA4,0x41,0xFF,0xA4,0x41,0xFF,0x84,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x22,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x86,0x29,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0x07,0x42,0xFF,0xC2,0x20,0xFF,0x81,0x18,0xFF,0x23,0x21,0xFF,0xC6,0x39,0xFF,0xC6,0x41,0xFF,0x03,0x21,0xFF,0x48,0x4A,0xFF,0x89,0x52,0xFF,0xE6,0x41,0xFF,0x06,0x42,0xFF,0xA5,0x39,0xFF,0xA5,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0x69,0x4A,0xFF,0x69,0x42,0xFF,0x29,0x42,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xA6,0x31,0xFF,0xE7,0x41,0xFF,0x48,0x4A,0xFF,0xE6,0x51,0xFF,
-    0xA5,0x82,0xFF,0x45,0xAB,0xFF,0xA4,0xBB,0xFF,0xA4,0xBB,0xFF,0xCA,0xCC,0xFF,0x06,0x93,0xFF,0x44,0x82,0xFF,0x84,0x8A,0xFF,0x84,0x8A,0xFF,0x64,0x82,0xFF,0x44,0x82,0xFF,0x24,0x7A,0xFF,0x64,0x82,0xFF,0xC5,0x92,0xFF,0x26,0x9B,0xFF,0x86,0xA3,0xFF,0xE7,0xB3,0xFF,0x48,0xBC,0xFF,0x67,0xC4,0xFF,0x47,0xC4,0xFF,0xC5,0xB3,0xFF,0xE6,0xBB,0xFF,0x46,0xC4,0xFF,0x66,0xCC,0xFF,0x66,0xC4,0xFF,0x66,0xC4,0xFF,0x25,0xC4,0xFF,0xE4,0xBB,0xFF,0xE4,0xBB,0xFF,0xC4,0xBB,0xFF,0xC4,0xBB,0xFF,0x84,0xB3,0xFF,0x84,0xB3,0xFF,0xA4,0xB3,0xFF,0x84,0xB3,0xFF,0x84,0xB3,0xFF,0xA4,0xB3,0xFF,0x84,0xB3,0xFF,0x63,0xB3,0xFF,0x84,0xB3,0xFF,0xA4,0xB3,0xFF,0x46,0xC4,0xFF,0xC7,0xD4,0xFF,0x08,0xDD,0xFF,0x69,0xDD,0xFF,0x2C,0xEE,0xFF,0xCE,0xF6,0xFF,0x4C,0xEE,0xFF,0x69,0xDD,0xFF,0x08,0xD5,0xFF,0xC7,0xCC,0xFF,0x66,0xC4,0xFF,0x26,0xBC,0xFF,0xA4,0xAB,0xFF,0x64,0xA3,0xFF,0x23,0x9B,0xFF,0x03,0x9B,0xFF,0x03,0x9B,0xFF,0x64,0xA3,0xFF,0xE5,0xB3,0xFF,0x47,0xBC,0xFF,0x87,0xC4,0xFF,0xA7,0xC4,0xFF,0xA7,0xC4,0xFF,
-    0x87,0xBC,0xFF,0x46,0xBC,0xFF,0x06,0xB4,0xFF,0xC5,0xA3,0xFF,0xA5,0xA3,0xFF,0x85,0xA3,0xFF,0x65,0x9B,0xFF,0x44,0x9B,0xFF,0x24,0x93,0xFF,0x65,0xA3,0xFF,0x64,0xA3,0xFF,0x64,0xA3,0xFF,0x64,0xA3,0xFF,0x64,0xA3,0xFF,0x84,0xAB,0xFF,0x05,0xB4,0xFF,0x4D,0xE6,0xFF,0x31,0xFF,0xFF,0x8A,0xD5,0xFF,0xA7,0xC4,0xFF,0x09,0xD5,0xFF,0x88,0xC4,0xFF,0x69,0xC4,0xFF,0x29,0xB4,0xFF,0x87,0x93,0xFF,0x26,0x83,0xFF,0x06,0x83,0xFF,0x06,0x7B,0xFF,0xE6,0x7A,0xFF,0xC5,0x7A,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0xA5,0x6A,0xFF,0xA5,0x6A,0xFF,0x85,0x62,0xFF,0x65,0x62,0xFF,0x44,0x62,0xFF,0x45,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x44,0x5A,0xFF,0x83,0x62,0xFF,0x82,0x62,0xFF,0x23,0x52,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0x84,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x22,0x31,0xFF,0x02,0x29,0xFF,0x22,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,
-    0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0x86,0x31,0xFF,0xE7,0x39,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xE2,0x20,0xFF,0x60,0x10,0xFF,0x64,0x31,0xFF,0x06,0x42,0xFF,0x44,0x31,0xFF,0xC6,0x39,0xFF,0x89,0x52,0xFF,0x48,0x4A,0xFF,0x27,0x42,0xFF,0xC6,0x39,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0x06,0x42,0xFF,0xE6,0x41,0xFF,0x28,0x42,0xFF,0x69,0x42,0xFF,0x08,0x3A,0xFF,0x6A,0x42,0xFF,0xE7,0x31,0xFF,0xC7,0x39,0xFF,0x85,0x31,0xFF,0x07,0x4A,0xFF,0x06,0x52,0xFF,0x64,0x72,0xFF,0x65,0xAB,0xFF,0x64,0xB3,0xFF,0xA4,0xBB,0xFF,0xA9,0xCC,0xFF,0xE6,0x82,0xFF,0x41,0x59,0xFF,0xA3,0x69,0xFF,0xC3,0x69,0xFF,0xE3,0x71,0xFF,0x44,0x82,0xFF,0xA4,0x92,0xFF,0xE5,0x9A,0xFF,0x45,0xAB,0xFF,0xA6,0xB3,0xFF,0xE7,0xBB,0xFF,0x06,0xC4,0xFF,
-    0x06,0xBC,0xFF,0xE5,0xBB,0xFF,0x05,0xBC,0xFF,0xC5,0xB3,0xFF,0xA5,0xB3,0xFF,0xE5,0xBB,0xFF,0x66,0xC4,0xFF,0x49,0xD5,0xFF,0xAA,0xE5,0xFF,0x07,0xD5,0xFF,0xC7,0xD4,0xFF,0xA6,0xCC,0xFF,0x46,0xC4,0xFF,0x45,0xC4,0xFF,0x05,0xC4,0xFF,0xE5,0xBB,0xFF,0xE5,0xBB,0xFF,0xE5,0xBB,0xFF,0xC4,0xBB,0xFF,0xC4,0xBB,0xFF,0xC5,0xBB,0xFF,0xA4,0xB3,0xFF,0x64,0xB3,0xFF,0x84,0xB3,0xFF,0xA4,0xB3,0xFF,0x26,0xC4,0xFF,0xC7,0xCC,0xFF,0x08,0xD5,0xFF,0xAA,0xE5,0xFF,0xEF,0xF6,0xFF,0xF5,0xFF,0xFF,0x51,0xFF,0xFF,0xCA,0xE5,0xFF,0x69,0xDD,0xFF,0x08,0xD5,0xFF,0x87,0xC4,0xFF,0x26,0xBC,0xFF,0xC5,0xB3,0xFF,0x84,0xAB,0xFF,0x64,0xA3,0xFF,0x64,0xA3,0xFF,0x84,0xAB,0xFF,0xC5,0xB3,0xFF,0x26,0xBC,0xFF,0x87,0xC4,0xFF,0xC8,0xCC,0xFF,0xC8,0xCC,0xFF,0xC8,0xCC,0xFF,0xA7,0xC4,0xFF,0x66,0xBC,0xFF,0x46,0xB4,0xFF,0x26,0xB4,0xFF,0xC5,0xA3,0xFF,0xA5,0xA3,0xFF,0x65,0xA3,0xFF,0x44,0x9B,0xFF,0x85,0xA3,0xFF,0x85,0xA3,0xFF,0x64,0xA3,0xFF,0x84,0xA3,0xFF,0x64,0xA3,0xFF,0x84,0xA3,0xFF,0xA4,0xAB,0xFF,0x46,0xBC,0xFF,
-    0xA6,0xC4,0xFF,0x08,0xCD,0xFF,0xE8,0xCC,0xFF,0x09,0xD5,0xFF,0x88,0xC4,0xFF,0x68,0xBC,0xFF,0x29,0xB4,0xFF,0x88,0x93,0xFF,0x27,0x83,0xFF,0x47,0x83,0xFF,0x26,0x83,0xFF,0x26,0x83,0xFF,0x06,0x7B,0xFF,0xE5,0x7A,0xFF,0xE5,0x7A,0xFF,0xE5,0x7A,0xFF,0xC6,0x72,0xFF,0xC5,0x6A,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x83,0x62,0xFF,0x4E,0xB5,0xFF,0xD0,0xC5,0xFF,0xE4,0x72,0xFF,0xE4,0x51,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0x84,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x22,0x39,0xFF,0x22,0x31,0xFF,0x22,0x29,0xFF,0x01,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0xA6,0x31,0xFF,0xE8,0x39,0xFF,0x86,0x31,0xFF,0xE7,0x41,0xFF,0x03,0x21,0xFF,0x81,0x10,0xFF,0x85,0x31,0xFF,0x64,0x31,0xFF,0x65,0x29,0xFF,0x28,0x42,0xFF,0x48,0x4A,0xFF,0x48,0x4A,0xFF,0x27,0x4A,0xFF,0xC6,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xA6,0x39,0xFF,0x8A,0x4A,0xFF,0x08,0x32,0xFF,0x29,0x3A,0xFF,0x29,0x3A,0xFF,0xE7,0x31,0xFF,0xA6,0x31,0xFF,0xC6,0x41,0xFF,0xE6,0x49,0xFF,0xC3,0x59,0xFF,0x04,0x9B,0xFF,0x64,0xB3,0xFF,0x23,0xB3,0xFF,0xA9,0xD4,0xFF,0x87,0xA3,0xFF,0xE3,0x79,0xFF,0x23,0x7A,0xFF,0x43,0x82,0xFF,0x23,0x82,0xFF,0x43,0x82,0xFF,0x83,0x92,0xFF,0x83,0x92,0xFF,0xC3,0xA2,0xFF,0x24,0xAB,0xFF,0x64,0xB3,0xFF,0x44,0xAB,0xFF,0xE3,0xA2,0xFF,0x64,0xAB,0xFF,0x27,0xC4,0xFF,0x47,0xC4,0xFF,0x84,0xAB,0xFF,0xA5,0xB3,0xFF,0x05,0xBC,0xFF,0x08,0xD5,0xFF,0x10,0xF7,0xFF,0x71,0xFF,0xFF,0x0B,0xE6,0xFF,0x07,0xDD,0xFF,0x07,0xD5,0xFF,0xA6,0xCC,0xFF,0x45,0xC4,0xFF,0x05,0xC4,0xFF,0x05,0xC4,0xFF,
-    0xE4,0xBB,0xFF,0xC5,0xBB,0xFF,0xC5,0xBB,0xFF,0x84,0xB3,0xFF,0xA4,0xBB,0xFF,0xA4,0xBB,0xFF,0xA4,0xBB,0xFF,0x84,0xB3,0xFF,0xA4,0xBB,0xFF,0x46,0xC4,0xFF,0xC7,0xD4,0xFF,0x28,0xDD,0xFF,0xA9,0xE5,0xFF,0xAE,0xF6,0xFF,0x93,0xFF,0xFF,0xEF,0xF6,0xFF,0xEA,0xE5,0xFF,0xA9,0xDD,0xFF,0x49,0xD5,0xFF,0xC7,0xCC,0xFF,0x46,0xC4,0xFF,0x05,0xBC,0xFF,0x84,0xAB,0xFF,0x43,0xA3,0xFF,0x43,0xA3,0xFF,0x63,0xAB,0xFF,0xE5,0xB3,0xFF,0x67,0xC4,0xFF,0xE8,0xCC,0xFF,0x29,0xD5,0xFF,0x29,0xD5,0xFF,0x09,0xCD,0xFF,0xC8,0xC4,0xFF,0x87,0xC4,0xFF,0x87,0xBC,0xFF,0x67,0xBC,0xFF,0xC5,0xA3,0xFF,0x84,0xA3,0xFF,0x84,0xA3,0xFF,0xA5,0xA3,0xFF,0xA5,0xAB,0xFF,0xA5,0xAB,0xFF,0xA5,0xAB,0xFF,0xA5,0xAB,0xFF,0x85,0xAB,0xFF,0x84,0xA3,0xFF,0xE5,0xB3,0xFF,0x46,0xBC,0xFF,0x86,0xC4,0xFF,0x08,0xCD,0xFF,0x09,0xD5,0xFF,0x88,0xC4,0xFF,0x69,0xBC,0xFF,0x29,0xAC,0xFF,0x88,0x93,0xFF,0x47,0x8B,0xFF,0x47,0x8B,0xFF,0x66,0x8B,0xFF,0x46,0x83,0xFF,0x26,0x83,0xFF,0x26,0x83,0xFF,0x26,0x83,0xFF,0x26,0x83,0xFF,0x06,0x7B,0xFF,
-    0xE6,0x72,0xFF,0xC5,0x72,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x44,0x5A,0xFF,0x24,0x5A,0xFF,0x25,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x82,0x6A,0xFF,0xD0,0xC5,0xFF,0x51,0xD6,0xFF,0x03,0x73,0xFF,0xE3,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x43,0x39,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x02,0x31,0xFF,0x01,0x29,0xFF,0x01,0x21,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0x65,0x29,0xFF,0x08,0x42,0xFF,0x86,0x31,0xFF,0xA6,0x39,0xFF,0x03,0x29,0xFF,0x81,0x10,0xFF,0xE3,0x20,0xFF,0xE3,0x20,0xFF,0x28,0x42,0xFF,0x07,0x42,0xFF,0x07,0x42,0xFF,0x48,0x4A,0xFF,
-    0xE7,0x41,0xFF,0xC6,0x39,0xFF,0xA5,0x39,0xFF,0x85,0x39,0xFF,0x85,0x31,0xFF,0x08,0x3A,0xFF,0x29,0x3A,0xFF,0x29,0x3A,0xFF,0xE8,0x31,0xFF,0x28,0x42,0xFF,0xE7,0x39,0xFF,0xC6,0x39,0xFF,0x07,0x4A,0xFF,0xA4,0x51,0xFF,0xC4,0x8A,0xFF,0x45,0xAB,0xFF,0xE2,0xA2,0xFF,0xE7,0xBB,0xFF,0x87,0xAB,0xFF,0xE0,0x81,0xFF,0x02,0x82,0xFF,0xE1,0x79,0xFF,0xE1,0x79,0xFF,0xE1,0x79,0xFF,0x02,0x82,0xFF,0x83,0x92,0xFF,0x82,0x92,0xFF,0xE3,0xA2,0xFF,0x44,0xAB,0xFF,0x64,0xB3,0xFF,0x64,0xB3,0xFF,0x44,0xB3,0xFF,0x64,0xB3,0xFF,0xE6,0xBB,0xFF,0x26,0xC4,0xFF,0x06,0xBC,0xFF,0x06,0xBC,0xFF,0x67,0xCC,0xFF,0x69,0xDD,0xFF,0x30,0xFF,0xFF,0xB2,0xFF,0xFF,0x4C,0xEE,0xFF,0x06,0xD5,0xFF,0x68,0xDD,0xFF,0x68,0xE5,0xFF,0x86,0xCC,0xFF,0x45,0xCC,0xFF,0x25,0xC4,0xFF,0x05,0xC4,0xFF,0xE5,0xBB,0xFF,0xE5,0xC3,0xFF,0x05,0xC4,0xFF,0x05,0xC4,0xFF,0x05,0xC4,0xFF,0xE5,0xC3,0xFF,0xC4,0xBB,0xFF,0xC4,0xBB,0xFF,0x46,0xC4,0xFF,0xE8,0xD4,0xFF,0x48,0xDD,0xFF,0x68,0xDD,0xFF,0xCA,0xE5,0xFF,0x2B,0xEE,0xFF,0x0B,0xE6,0xFF,
-    0xCA,0xE5,0xFF,0xA9,0xDD,0xFF,0x49,0xDD,0xFF,0xE7,0xCC,0xFF,0x66,0xC4,0xFF,0x05,0xBC,0xFF,0xA4,0xAB,0xFF,0xA4,0xAB,0xFF,0x84,0xAB,0xFF,0xE5,0xB3,0xFF,0x46,0xBC,0xFF,0xC8,0xCC,0xFF,0x29,0xD5,0xFF,0x49,0xD5,0xFF,0x29,0xD5,0xFF,0x09,0xCD,0xFF,0xA7,0xC4,0xFF,0x87,0xBC,0xFF,0x26,0xB4,0xFF,0xE5,0xAB,0xFF,0xC5,0xAB,0xFF,0xA4,0xA3,0xFF,0x67,0xBC,0xFF,0xC8,0xC4,0xFF,0xC5,0xAB,0xFF,0xC5,0xB3,0xFF,0xC5,0xB3,0xFF,0xC5,0xAB,0xFF,0xA5,0xAB,0xFF,0xA4,0xAB,0xFF,0x05,0xB4,0xFF,0x66,0xC4,0xFF,0x28,0xD5,0xFF,0x09,0xCD,0xFF,0xA9,0xC4,0xFF,0xA9,0xC4,0xFF,0x49,0xB4,0xFF,0x87,0x93,0xFF,0x47,0x8B,0xFF,0x47,0x8B,0xFF,0x66,0x8B,0xFF,0x87,0x8B,0xFF,0x86,0x8B,0xFF,0x66,0x8B,0xFF,0x86,0x93,0xFF,0x87,0x93,0xFF,0x46,0x8B,0xFF,0x26,0x83,0xFF,0x05,0x7B,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0xA5,0x6A,0xFF,0x65,0x62,0xFF,0x44,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x04,0x5A,0xFF,0x24,0x5A,0xFF,0x64,0x62,0xFF,0x04,0x7B,0xFF,0x04,0x7B,0xFF,0x63,0x62,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,
-    0xC4,0x41,0xFF,0xC4,0x41,0xFF,0xA3,0x39,0xFF,0x83,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x62,0x39,0xFF,0x42,0x39,0xFF,0xE1,0x20,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x40,0x10,0xFF,0x24,0x21,0xFF,0xE8,0x39,0xFF,0xA6,0x31,0xFF,0xA6,0x39,0xFF,0x23,0x29,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0xA6,0x31,0xFF,0x07,0x42,0xFF,0xE7,0x39,0xFF,0x08,0x42,0xFF,0x07,0x42,0xFF,0xC7,0x39,0xFF,0xA6,0x39,0xFF,0xA6,0x39,0xFF,0x85,0x31,0xFF,0x29,0x42,0xFF,0xC7,0x31,0xFF,0x09,0x32,0xFF,0x09,0x3A,0xFF,0xC7,0x31,0xFF,0xC7,0x39,0xFF,0xA6,0x39,0xFF,0x07,0x4A,0xFF,0xC5,0x51,0xFF,0x63,0x82,0xFF,0x45,0xAB,0xFF,0xE3,0xA2,0xFF,
-    0x65,0xB3,0xFF,0x86,0xB3,0xFF,0xE0,0x81,0xFF,0x42,0x92,0xFF,0x62,0x92,0xFF,0x82,0x9A,0xFF,0xC3,0x9A,0xFF,0xA3,0x9A,0xFF,0x62,0x92,0xFF,0xC4,0xA2,0xFF,0xE4,0xAA,0xFF,0x44,0xB3,0xFF,0x65,0xB3,0xFF,0x85,0xBB,0xFF,0x85,0xBB,0xFF,0x64,0xB3,0xFF,0x84,0xB3,0xFF,0x06,0xBC,0xFF,0x05,0xC4,0xFF,0xE5,0xBB,0xFF,0x06,0xC4,0xFF,0x46,0xCC,0xFF,0xC7,0xD4,0xFF,0xC9,0xE5,0xFF,0x6B,0xF6,0xFF,0xA8,0xE5,0xFF,0x47,0xDD,0xFF,0xA8,0xE5,0xFF,0x68,0xE5,0xFF,0xE7,0xD4,0xFF,0xA6,0xD4,0xFF,0xA6,0xD4,0xFF,0xA6,0xD4,0xFF,0x87,0xD4,0xFF,0x46,0xCC,0xFF,0x45,0xCC,0xFF,0x46,0xC4,0xFF,0x25,0xC4,0xFF,0x25,0xC4,0xFF,0x05,0xC4,0xFF,0x05,0xC4,0xFF,0x66,0xCC,0xFF,0xC7,0xD4,0xFF,0x48,0xDD,0xFF,0x89,0xE5,0xFF,0xCA,0xE5,0xFF,0xCA,0xE5,0xFF,0x0A,0xEE,0xFF,0xEA,0xE5,0xFF,0xCA,0xE5,0xFF,0xAA,0xE5,0xFF,0x49,0xD5,0xFF,0xA7,0xCC,0xFF,0x67,0xC4,0xFF,0xE5,0xB3,0xFF,0x84,0xAB,0xFF,0xA4,0xAB,0xFF,0xE5,0xAB,0xFF,0x47,0xBC,0xFF,0xE9,0xCC,0xFF,0x4A,0xD5,0xFF,0x4A,0xD5,0xFF,0x4A,0xD5,0xFF,0x29,0xCD,0xFF,
-    0x08,0xCD,0xFF,0xA7,0xC4,0xFF,0x87,0xBC,0xFF,0x46,0xB4,0xFF,0xE5,0xB3,0xFF,0xC4,0xAB,0xFF,0x87,0xC4,0xFF,0xC8,0xCC,0xFF,0x05,0xB4,0xFF,0xE5,0xB3,0xFF,0xE5,0xB3,0xFF,0xC5,0xB3,0xFF,0xC5,0xAB,0xFF,0xE5,0xB3,0xFF,0x46,0xBC,0xFF,0x09,0xD5,0xFF,0xE8,0xCC,0xFF,0xC9,0xC4,0xFF,0xCA,0xC4,0xFF,0x49,0xB4,0xFF,0xA8,0x9B,0xFF,0x87,0x93,0xFF,0x87,0x93,0xFF,0x87,0x93,0xFF,0x87,0x93,0xFF,0xA7,0x93,0xFF,0xA7,0x93,0xFF,0xA7,0x93,0xFF,0xC7,0x9B,0xFF,0xC7,0x9B,0xFF,0x87,0x93,0xFF,0x46,0x83,0xFF,0x05,0x7B,0xFF,0xC5,0x72,0xFF,0xA5,0x72,0xFF,0xA5,0x6A,0xFF,0x65,0x62,0xFF,0x65,0x62,0xFF,0x44,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xA3,0x41,0xFF,0xA3,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0xA3,0x41,0xFF,0xC3,0x41,0xFF,0xE1,0x28,0xFF,0xC1,0x18,0xFF,
-    0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x44,0x29,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0xE7,0x41,0xFF,0x64,0x31,0xFF,0x60,0x10,0xFF,0xE3,0x18,0xFF,0xA6,0x31,0xFF,0xC6,0x39,0xFF,0x08,0x42,0xFF,0x08,0x42,0xFF,0x86,0x31,0xFF,0xA6,0x39,0xFF,0xA6,0x31,0xFF,0x65,0x31,0xFF,0x08,0x42,0xFF,0x49,0x42,0xFF,0xE8,0x31,0xFF,0x4A,0x42,0xFF,0x09,0x3A,0xFF,0xA6,0x31,0xFF,0x24,0x29,0xFF,0x85,0x39,0xFF,0x07,0x52,0xFF,0x03,0x6A,0xFF,0x45,0xAB,0xFF,0x03,0xAB,0xFF,0xE3,0xA2,0xFF,0x66,0xB3,0xFF,0xE1,0x81,0xFF,0x63,0x92,0xFF,0x85,0xB3,0xFF,0x23,0xAB,0xFF,0x84,0xB3,0xFF,0x27,0xC4,0xFF,0xE7,0xBB,0xFF,0xE4,0xA2,0xFF,0xA3,0xA2,0xFF,0xC3,0xA2,0xFF,0x65,0xB3,0xFF,0x85,0xBB,0xFF,0x84,0xB3,0xFF,0xA5,0xBB,0xFF,0xC5,0xBB,0xFF,
-    0xC5,0xBB,0xFF,0x26,0xC4,0xFF,0x67,0xCC,0xFF,0x87,0xCC,0xFF,0xA7,0xD4,0xFF,0x66,0xCC,0xFF,0x86,0xCC,0xFF,0xE7,0xD4,0xFF,0x07,0xDD,0xFF,0xC6,0xD4,0xFF,0x27,0xDD,0xFF,0x67,0xE5,0xFF,0x27,0xDD,0xFF,0xE6,0xD4,0xFF,0xC6,0xD4,0xFF,0xA6,0xD4,0xFF,0xA6,0xD4,0xFF,0x66,0xCC,0xFF,0x66,0xCC,0xFF,0x86,0xD4,0xFF,0xA7,0xD4,0xFF,0xC7,0xD4,0xFF,0x86,0xCC,0xFF,0x45,0xC4,0xFF,0x66,0xCC,0xFF,0x87,0xCC,0xFF,0xC7,0xCC,0xFF,0x48,0xDD,0xFF,0x89,0xDD,0xFF,0xCA,0xE5,0xFF,0xCA,0xE5,0xFF,0xEA,0xE5,0xFF,0xEB,0xE5,0xFF,0xEB,0xE5,0xFF,0xCB,0xDD,0xFF,0x29,0xD5,0xFF,0xA7,0xC4,0xFF,0x26,0xB4,0xFF,0xC5,0xAB,0xFF,0x84,0xA3,0xFF,0xC5,0xAB,0xFF,0x26,0xBC,0xFF,0xC8,0xC4,0xFF,0x4A,0xD5,0xFF,0xAB,0xDD,0xFF,0xAB,0xDD,0xFF,0x8A,0xDD,0xFF,0x69,0xD5,0xFF,0x28,0xD5,0xFF,0xE8,0xCC,0xFF,0x86,0xC4,0xFF,0x46,0xBC,0xFF,0x05,0xB4,0xFF,0x05,0xB4,0xFF,0x26,0xBC,0xFF,0x46,0xBC,0xFF,0x46,0xBC,0xFF,0x08,0xCD,0xFF,0x46,0xBC,0xFF,0xE5,0xB3,0xFF,0x05,0xB4,0xFF,0x46,0xBC,0xFF,0xE8,0xCC,0xFF,0xE9,0xCC,0xFF,
-    0xC9,0xC4,0xFF,0xCA,0xC4,0xFF,0x69,0xB4,0xFF,0xE8,0x9B,0xFF,0xC8,0x9B,0xFF,0xC8,0x9B,0xFF,0xC8,0x93,0xFF,0xC7,0x93,0xFF,0xC7,0x9B,0xFF,0xE7,0x9B,0xFF,0xE7,0x9B,0xFF,0xE7,0x9B,0xFF,0xE7,0x9B,0xFF,0xE7,0x9B,0xFF,0x87,0x93,0xFF,0x46,0x83,0xFF,0x05,0x7B,0xFF,0xC5,0x72,0xFF,0x85,0x6A,0xFF,0x85,0x6A,0xFF,0x85,0x6A,0xFF,0x85,0x62,0xFF,0x45,0x62,0xFF,0x24,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC4,0x49,0xFF,0xC3,0x41,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0xE1,0x20,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,
-    0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0xA0,0x18,0xFF,0xC0,0x18,0xFF,0x24,0x29,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0x07,0x42,0xFF,0xC6,0x39,0xFF,0xA1,0x18,0xFF,0x03,0x21,0xFF,0x65,0x29,0xFF,0x66,0x31,0xFF,0xC7,0x39,0xFF,0xA6,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xE7,0x39,0xFF,0x6A,0x4A,0xFF,0x08,0x3A,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0xA7,0x31,0xFF,0x65,0x31,0xFF,0x85,0x39,0xFF,0x27,0x52,0xFF,0xC4,0x59,0xFF,0xE5,0x9A,0xFF,0xE3,0xA2,0xFF,0x82,0x9A,0xFF,0xA6,0xB3,0xFF,0x63,0x92,0xFF,0x42,0x8A,0xFF,0xC4,0x9A,0xFF,0xC6,0xBB,0xFF,0xE5,0xBB,0xFF,0x88,0xCC,0xFF,0xE9,0xD4,0xFF,0x06,0xBC,0xFF,0x24,0xAB,0xFF,0x45,0xAB,0xFF,0x86,0xB3,0xFF,0xE6,0xBB,0xFF,0x85,0xB3,0xFF,0x85,0xB3,0xFF,0xC5,0xBB,0xFF,0x06,0xC4,0xFF,0x87,0xCC,0xFF,0xC8,0xD4,0xFF,0xA7,0xCC,0xFF,0x66,0xCC,0xFF,0xA7,0xCC,0xFF,0xA7,0xD4,0xFF,0x87,0xCC,0xFF,0xA7,0xD4,0xFF,0xE7,0xD4,0xFF,0x08,0xDD,0xFF,0x08,0xDD,0xFF,0x48,0xDD,0xFF,0x68,0xE5,0xFF,0x69,0xE5,0xFF,0x69,0xE5,0xFF,0x48,0xE5,0xFF,
-    0x28,0xDD,0xFF,0xC7,0xD4,0xFF,0xC7,0xD4,0xFF,0xA6,0xD4,0xFF,0xA7,0xD4,0xFF,0xC7,0xD4,0xFF,0xA7,0xCC,0xFF,0x66,0xC4,0xFF,0x46,0xC4,0xFF,0x46,0xBC,0xFF,0x66,0xC4,0xFF,0xE8,0xCC,0xFF,0x49,0xD5,0xFF,0x8A,0xDD,0xFF,0xAA,0xDD,0xFF,0xEB,0xDD,0xFF,0x0B,0xE6,0xFF,0xEB,0xE5,0xFF,0xEB,0xDD,0xFF,0xAA,0xDD,0xFF,0x29,0xD5,0xFF,0xC8,0xCC,0xFF,0x87,0xC4,0xFF,0x46,0xBC,0xFF,0x67,0xC4,0xFF,0xA8,0xCC,0xFF,0x08,0xD5,0xFF,0x6A,0xDD,0xFF,0xAA,0xDD,0xFF,0xCB,0xE5,0xFF,0xCA,0xDD,0xFF,0x0C,0xE6,0xFF,0x0C,0xE6,0xFF,0x48,0xCD,0xFF,0xC7,0xC4,0xFF,0x29,0xCD,0xFF,0x66,0xBC,0xFF,0x26,0xBC,0xFF,0x46,0xBC,0xFF,0x46,0xBC,0xFF,0x67,0xBC,0xFF,0xA7,0xC4,0xFF,0x26,0xB4,0xFF,0x05,0xB4,0xFF,0x67,0xC4,0xFF,0xC8,0xCC,0xFF,0xC8,0xC4,0xFF,0xE9,0xC4,0xFF,0xEA,0xC4,0xFF,0x69,0xB4,0xFF,0x09,0xA4,0xFF,0x09,0x9C,0xFF,0xE8,0x9B,0xFF,0xE8,0x9B,0xFF,0xE7,0x9B,0xFF,0xE8,0x9B,0xFF,0x08,0xA4,0xFF,0x28,0xA4,0xFF,0x07,0xA4,0xFF,0x89,0xAC,0xFF,0x71,0xDE,0xFF,0x8A,0xAC,0xFF,0x86,0x8B,0xFF,0x46,0x83,0xFF,
-    0x06,0x7B,0xFF,0xC6,0x72,0xFF,0xA5,0x72,0xFF,0x85,0x72,0xFF,0x85,0x6A,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x24,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x51,0xFF,0xE4,0x51,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xC3,0x41,0xFF,0x83,0x41,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x23,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0xE3,0x18,0xFF,0xC7,0x39,0xFF,0xA7,0x31,0xFF,0x08,0x42,0xFF,0x07,0x42,0xFF,0xC1,0x18,0xFF,0xC2,0x18,0xFF,0x45,0x29,0xFF,0x86,0x31,0xFF,0x45,0x29,0xFF,0x65,0x29,0xFF,0xA6,0x31,0xFF,
-    0x86,0x31,0xFF,0xC7,0x39,0xFF,0x8A,0x4A,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0xA7,0x31,0xFF,0x65,0x31,0xFF,0x07,0x4A,0xFF,0xA4,0x51,0xFF,0x64,0x82,0xFF,0xC4,0x9A,0xFF,0x61,0x9A,0xFF,0x86,0xB3,0xFF,0xA4,0x92,0xFF,0x42,0x8A,0xFF,0xA3,0x92,0xFF,0xE4,0x9A,0xFF,0xE3,0xA2,0xFF,0x44,0xAB,0xFF,0x84,0xAB,0xFF,0xA5,0xB3,0xFF,0x64,0xAB,0xFF,0x24,0xAB,0xFF,0x85,0xB3,0xFF,0xA6,0xB3,0xFF,0x06,0xC4,0xFF,0xE6,0xBB,0xFF,0x85,0xB3,0xFF,0x85,0xB3,0xFF,0xC5,0xB3,0xFF,0x46,0xC4,0xFF,0x67,0xC4,0xFF,0x87,0xCC,0xFF,0xC8,0xD4,0xFF,0x09,0xDD,0xFF,0x49,0xDD,0xFF,0x28,0xDD,0xFF,0x48,0xE5,0xFF,0x48,0xE5,0xFF,0x48,0xE5,0xFF,0x48,0xDD,0xFF,0x48,0xDD,0xFF,0x89,0xE5,0xFF,0xEA,0xED,0xFF,0xCA,0xED,0xFF,0x89,0xE5,0xFF,0x49,0xE5,0xFF,0xE7,0xD4,0xFF,0x86,0xCC,0xFF,0x46,0xC4,0xFF,0x05,0xBC,0xFF,0xE5,0xB3,0xFF,0x05,0xB4,0xFF,0xC4,0xAB,0xFF,0xC4,0xAB,0xFF,0xE5,0xB3,0xFF,0x46,0xBC,0xFF,0xE8,0xCC,0xFF,0x6A,0xDD,0xFF,0xCB,0xE5,0xFF,0xEB,0xE5,0xFF,0x2C,0xEE,0xFF,
-    0x4C,0xEE,0xFF,0x2C,0xEE,0xFF,0x2C,0xEE,0xFF,0xEB,0xE5,0xFF,0x89,0xDD,0xFF,0x28,0xD5,0xFF,0xC7,0xCC,0xFF,0xA7,0xCC,0xFF,0xC8,0xCC,0xFF,0x28,0xD5,0xFF,0x6A,0xDD,0xFF,0xAA,0xDD,0xFF,0xCB,0xE5,0xFF,0xEB,0xE5,0xFF,0xEB,0xE5,0xFF,0x30,0xF7,0xFF,0x92,0xFF,0xFF,0xCB,0xDD,0xFF,0xE8,0xCC,0xFF,0x87,0xBC,0xFF,0x66,0xBC,0xFF,0x67,0xBC,0xFF,0x67,0xBC,0xFF,0x67,0xC4,0xFF,0x67,0xBC,0xFF,0x46,0xBC,0xFF,0x26,0xB4,0xFF,0x87,0xC4,0xFF,0xE8,0xCC,0xFF,0xE8,0xC4,0xFF,0x0A,0xCD,0xFF,0x0B,0xC5,0xFF,0x8A,0xB4,0xFF,0x29,0xAC,0xFF,0x29,0xA4,0xFF,0x29,0xA4,0xFF,0x28,0xA4,0xFF,0x28,0xA4,0xFF,0x28,0xA4,0xFF,0x28,0xA4,0xFF,0x48,0xA4,0xFF,0x48,0xA4,0xFF,0x07,0xA4,0xFF,0x69,0xA4,0xFF,0x0F,0xD6,0xFF,0x49,0xA4,0xFF,0x66,0x8B,0xFF,0x46,0x83,0xFF,0x06,0x7B,0xFF,0xE6,0x7A,0xFF,0xC5,0x72,0xFF,0xA5,0x72,0xFF,0x85,0x72,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x44,0x62,0xFF,0x24,0x5A,0xFF,0x05,0x5A,0xFF,0x04,0x52,0xFF,0xE4,0x51,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,
-    0xE2,0x51,0xFF,0x23,0x5A,0xFF,0x03,0x52,0xFF,0xC3,0x49,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x22,0x29,0xFF,0x22,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x81,0x10,0xFF,0x08,0x42,0xFF,0xEC,0x5A,0xFF,0x08,0x3A,0xFF,0x48,0x4A,0xFF,0xE2,0x20,0xFF,0x81,0x10,0xFF,0x65,0x29,0xFF,0x45,0x29,0xFF,0x24,0x29,0xFF,0xA6,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0x6A,0x4A,0xFF,0x6A,0x4A,0xFF,0x49,0x42,0xFF,0xC8,0x39,0xFF,0xC8,0x39,0xFF,0x08,0x42,0xFF,0x08,0x42,0xFF,0xC6,0x41,0xFF,0xA5,0x49,0xFF,0xE3,0x69,0xFF,0x22,0x82,0xFF,0x01,0x82,0xFF,0xE5,0xA2,0xFF,0xC4,0x9A,0xFF,0x63,0x8A,0xFF,
-    0xA4,0x92,0xFF,0xC4,0x92,0xFF,0xC4,0x92,0xFF,0xA4,0x92,0xFF,0xC4,0x9A,0xFF,0xC3,0x92,0xFF,0x04,0x9B,0xFF,0x04,0xA3,0xFF,0xE3,0x9A,0xFF,0xE3,0x9A,0xFF,0xE3,0xA2,0xFF,0x85,0xB3,0xFF,0x07,0xBC,0xFF,0xC6,0xB3,0xFF,0xA5,0xB3,0xFF,0xA5,0xB3,0xFF,0xC5,0xB3,0xFF,0xE6,0xB3,0xFF,0xE6,0xBB,0xFF,0x26,0xC4,0xFF,0x87,0xCC,0xFF,0xC7,0xCC,0xFF,0x07,0xD5,0xFF,0x48,0xDD,0xFF,0x48,0xDD,0xFF,0x08,0xDD,0xFF,0x69,0xE5,0xFF,0x69,0xE5,0xFF,0x69,0xDD,0xFF,0x29,0xDD,0xFF,0xC7,0xCC,0xFF,0x46,0xC4,0xFF,0x25,0xBC,0xFF,0x05,0xB4,0xFF,0xE5,0xB3,0xFF,0x05,0xB4,0xFF,0x46,0xBC,0xFF,0x87,0xCC,0xFF,0xC7,0xCC,0xFF,0xC7,0xCC,0xFF,0xA7,0xCC,0xFF,0xA7,0xCC,0xFF,0xE7,0xD4,0xFF,0x28,0xDD,0xFF,0x8A,0xDD,0xFF,0xEB,0xE5,0xFF,0x2B,0xEE,0xFF,0x4C,0xEE,0xFF,0x6D,0xEE,0xFF,0x6C,0xEE,0xFF,0x6C,0xF6,0xFF,0x2B,0xEE,0xFF,0xCA,0xE5,0xFF,0x69,0xDD,0xFF,0x28,0xD5,0xFF,0x08,0xD5,0xFF,0x28,0xD5,0xFF,0x8A,0xDD,0xFF,0xEB,0xE5,0xFF,0x0B,0xE6,0xFF,0x2B,0xEE,0xFF,0x2C,0xEE,0xFF,0x2C,0xE6,0xFF,0x8E,0xEE,0xFF,
-    0x8E,0xEE,0xFF,0xAA,0xDD,0xFF,0x49,0xD5,0xFF,0xE8,0xCC,0xFF,0xC8,0xCC,0xFF,0x88,0xC4,0xFF,0x67,0xC4,0xFF,0x67,0xC4,0xFF,0x67,0xBC,0xFF,0x67,0xBC,0xFF,0xC8,0xCC,0xFF,0xE8,0xCC,0xFF,0xE8,0xC4,0xFF,0x0A,0xC5,0xFF,0x2B,0xCD,0xFF,0xAA,0xBC,0xFF,0x49,0xAC,0xFF,0x69,0xAC,0xFF,0x49,0xAC,0xFF,0x49,0xAC,0xFF,0x49,0xAC,0xFF,0x48,0xAC,0xFF,0x69,0xAC,0xFF,0x69,0xAC,0xFF,0x48,0xAC,0xFF,0x28,0xA4,0xFF,0x08,0x9C,0xFF,0xC7,0x93,0xFF,0x85,0x8B,0xFF,0x86,0x8B,0xFF,0x66,0x8B,0xFF,0x45,0x83,0xFF,0x46,0x83,0xFF,0x26,0x83,0xFF,0xE6,0x7A,0xFF,0xC6,0x72,0xFF,0xA5,0x72,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x44,0x62,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x24,0x52,0xFF,0x04,0x5A,0xFF,0x44,0x62,0xFF,0x6B,0xA4,0xFF,0x09,0x94,0xFF,0x41,0x5A,0xFF,0x03,0x52,0xFF,0xE3,0x49,0xFF,0xA3,0x39,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x22,0x21,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE1,0x18,0xFF,
-    0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0x49,0x4A,0xFF,0x0C,0x63,0xFF,0xC7,0x31,0xFF,0x69,0x4A,0xFF,0x03,0x21,0xFF,0xA2,0x18,0xFF,0x24,0x21,0xFF,0x24,0x21,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0x8A,0x4A,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x49,0x52,0xFF,0xA5,0x49,0xFF,0xC3,0x61,0xFF,0x02,0x7A,0xFF,0x01,0x82,0xFF,0xA4,0x9A,0xFF,0xA4,0x92,0xFF,0x42,0x8A,0xFF,0x43,0x8A,0xFF,0x22,0x82,0xFF,0x42,0x82,0xFF,0x42,0x82,0xFF,0x42,0x82,0xFF,0x83,0x92,0xFF,0xA3,0x8A,0xFF,0xA3,0x92,0xFF,0xA3,0x9A,0xFF,0xC3,0x9A,0xFF,0x04,0xA3,0xFF,0x24,0xAB,0xFF,0x85,0xB3,0xFF,0x85,0xB3,0xFF,0x85,0xB3,0xFF,0xE6,0xBB,0xFF,0x47,0xC4,0xFF,
-    0xA8,0xCC,0xFF,0xA8,0xCC,0xFF,0x87,0xCC,0xFF,0x29,0xDD,0xFF,0x6A,0xDD,0xFF,0x29,0xD5,0xFF,0xE7,0xCC,0xFF,0x08,0xD5,0xFF,0xC8,0xCC,0xFF,0x87,0xC4,0xFF,0x46,0xBC,0xFF,0x46,0xBC,0xFF,0x46,0xBC,0xFF,0x87,0xC4,0xFF,0xC8,0xCC,0xFF,0x09,0xD5,0xFF,0x49,0xDD,0xFF,0x49,0xDD,0xFF,0x69,0xE5,0xFF,0x69,0xE5,0xFF,0x48,0xDD,0xFF,0x07,0xDD,0xFF,0x07,0xD5,0xFF,0x28,0xDD,0xFF,0xE7,0xD4,0xFF,0xC7,0xD4,0xFF,0x07,0xD5,0xFF,0x48,0xDD,0xFF,0xA9,0xE5,0xFF,0x2B,0xEE,0xFF,0x6C,0xEE,0xFF,0x8D,0xF6,0xFF,0x8D,0xF6,0xFF,0x8D,0xF6,0xFF,0x8D,0xF6,0xFF,0x8D,0xF6,0xFF,0x2B,0xEE,0xFF,0xCA,0xE5,0xFF,0xA9,0xE5,0xFF,0x89,0xDD,0xFF,0x89,0xDD,0xFF,0xCA,0xE5,0xFF,0x0C,0xE6,0xFF,0x2C,0xEE,0xFF,0x4C,0xEE,0xFF,0x4C,0xEE,0xFF,0x4C,0xEE,0xFF,0x0C,0xE6,0xFF,0xEB,0xE5,0xFF,0x8A,0xDD,0xFF,0x69,0xD5,0xFF,0x29,0xD5,0xFF,0xE8,0xCC,0xFF,0xC8,0xCC,0xFF,0x87,0xC4,0xFF,0x67,0xBC,0xFF,0x87,0xBC,0xFF,0xE8,0xCC,0xFF,0x09,0xCD,0xFF,0x09,0xCD,0xFF,0x2A,0xCD,0xFF,0x4B,0xCD,0xFF,0xCB,0xBC,0xFF,0x8A,0xB4,0xFF,
-    0x8A,0xB4,0xFF,0x8A,0xB4,0xFF,0x8A,0xAC,0xFF,0x89,0xAC,0xFF,0x89,0xB4,0xFF,0x89,0xB4,0xFF,0xC9,0xB4,0xFF,0xA9,0xAC,0xFF,0x48,0xA4,0xFF,0x08,0x9C,0xFF,0xE8,0x93,0xFF,0xC7,0x93,0xFF,0x87,0x8B,0xFF,0x66,0x8B,0xFF,0xC7,0x93,0xFF,0xEC,0xB4,0xFF,0xA7,0x93,0xFF,0x67,0x8B,0xFF,0x06,0x83,0xFF,0xC6,0x72,0xFF,0xA5,0x72,0xFF,0x85,0x6A,0xFF,0x65,0x6A,0xFF,0x65,0x6A,0xFF,0x45,0x62,0xFF,0x24,0x5A,0xFF,0x25,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x5A,0xFF,0x84,0x6A,0xFF,0x72,0xDE,0xFF,0xCE,0xCD,0xFF,0x47,0x9C,0xFF,0x24,0x7B,0xFF,0x23,0x52,0xFF,0xC3,0x41,0xFF,0x83,0x39,0xFF,0x63,0x31,0xFF,0x42,0x29,0xFF,0x22,0x29,0xFF,0x22,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0xE7,0x39,0xFF,0x6A,0x4A,0xFF,0x66,0x29,0xFF,0x69,0x4A,0xFF,0x44,0x29,0xFF,0x81,0x10,0xFF,0x03,0x21,0xFF,0x65,0x31,0xFF,0x65,0x31,0xFF,0x66,0x31,0xFF,0xA6,0x31,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x49,0x42,0xFF,0xC8,0x39,0xFF,0x08,0x3A,0xFF,0x08,0x42,0xFF,0x69,0x52,0xFF,0xE6,0x49,0xFF,0x82,0x59,0xFF,0x23,0x7A,0xFF,0x22,0x82,0xFF,0x63,0x92,0xFF,0xC5,0x9A,0xFF,0xE1,0x81,0xFF,0x02,0x82,0xFF,0x22,0x8A,0xFF,0x43,0x8A,0xFF,0x63,0x8A,0xFF,0x63,0x92,0xFF,0xA3,0x92,0xFF,0xC4,0x9A,0xFF,0xE4,0x9A,0xFF,0x25,0xA3,0xFF,0x65,0xAB,0xFF,0x65,0xB3,0xFF,0xA6,0xBB,0xFF,0x07,0xC4,0xFF,0x27,0xC4,0xFF,0x07,0xC4,0xFF,0xC6,0xBB,0xFF,0x07,0xBC,0xFF,0x07,0xBC,0xFF,0x27,0xB4,0xFF,0xC6,0xAB,0xFF,0x64,0x9B,0xFF,0x65,0xA3,0xFF,0x85,0xA3,0xFF,0xA5,0xAB,0xFF,0x06,0xB4,0xFF,0x87,0xC4,0xFF,0xC8,0xCC,0xFF,0x29,0xD5,0xFF,0x49,0xDD,0xFF,0x49,0xDD,0xFF,0x69,0xE5,0xFF,0x8A,0xE5,0xFF,0xCA,0xED,0xFF,0xCA,0xED,0xFF,
-    0xEA,0xED,0xFF,0xCA,0xED,0xFF,0xA9,0xE5,0xFF,0xA9,0xE5,0xFF,0x69,0xE5,0xFF,0x27,0xDD,0xFF,0x48,0xDD,0xFF,0x69,0xE5,0xFF,0x48,0xDD,0xFF,0x28,0xDD,0xFF,0x28,0xDD,0xFF,0x68,0xDD,0xFF,0xEA,0xE5,0xFF,0x4C,0xEE,0xFF,0x8D,0xF6,0xFF,0xAD,0xF6,0xFF,0xAE,0xF6,0xFF,0xCE,0xF6,0xFF,0xCE,0xF6,0xFF,0xCD,0xF6,0xFF,0x6C,0xF6,0xFF,0x0B,0xEE,0xFF,0xCA,0xE5,0xFF,0xA9,0xDD,0xFF,0xAA,0xE5,0xFF,0xEB,0xE5,0xFF,0x4C,0xEE,0xFF,0x6D,0xEE,0xFF,0x6D,0xEE,0xFF,0x6D,0xEE,0xFF,0x4C,0xEE,0xFF,0x2C,0xE6,0xFF,0xEB,0xE5,0xFF,0xAA,0xDD,0xFF,0x8A,0xDD,0xFF,0x8A,0xDD,0xFF,0x6A,0xDD,0xFF,0x29,0xD5,0xFF,0x08,0xCD,0xFF,0xE8,0xCC,0xFF,0xC8,0xC4,0xFF,0xE9,0xCC,0xFF,0x0A,0xCD,0xFF,0x4B,0xD5,0xFF,0x6C,0xCD,0xFF,0x0B,0xBD,0xFF,0xAB,0xB4,0xFF,0xAB,0xB4,0xFF,0xAA,0xB4,0xFF,0xAA,0xB4,0xFF,0xAA,0xB4,0xFF,0xA9,0xB4,0xFF,0xC9,0xB4,0xFF,0xCA,0xB4,0xFF,0xC9,0xB4,0xFF,0x68,0xAC,0xFF,0x28,0xA4,0xFF,0xE8,0x9B,0xFF,0xC8,0x93,0xFF,0xA8,0x93,0xFF,0x87,0x8B,0xFF,0x66,0x8B,0xFF,0xE8,0x93,0xFF,0x8F,0xC5,0xFF,
-    0x86,0x8B,0xFF,0x26,0x83,0xFF,0x06,0x7B,0xFF,0xC6,0x72,0xFF,0xA5,0x6A,0xFF,0xA5,0x6A,0xFF,0xA5,0x72,0xFF,0x85,0x72,0xFF,0x65,0x72,0xFF,0x45,0x62,0xFF,0x24,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x5A,0xFF,0x64,0x62,0xFF,0x85,0x8B,0xFF,0xAC,0xCD,0xFF,0x33,0xF7,0xFF,0x0B,0xB5,0xFF,0x20,0x5A,0xFF,0xC3,0x41,0xFF,0x83,0x39,0xFF,0x43,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x80,0x10,0xFF,0xC6,0x31,0xFF,0x08,0x3A,0xFF,0x86,0x31,0xFF,0x48,0x4A,0xFF,0x65,0x29,0xFF,0x81,0x10,0xFF,0xE3,0x18,0xFF,0x65,0x29,0xFF,0x85,0x31,0xFF,0x86,0x31,0xFF,0x08,0x3A,0xFF,
-    0xC7,0x31,0xFF,0x29,0x42,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x09,0x42,0xFF,0x49,0x4A,0xFF,0x28,0x52,0xFF,0x63,0x51,0xFF,0x03,0x7A,0xFF,0x42,0x82,0xFF,0x02,0x82,0xFF,0xA5,0x92,0xFF,0xE2,0x79,0xFF,0x23,0x82,0xFF,0xC4,0x9A,0xFF,0x05,0xA3,0xFF,0xE4,0x9A,0xFF,0x25,0xA3,0xFF,0x86,0xB3,0xFF,0xA7,0xB3,0xFF,0x86,0xAB,0xFF,0x66,0xAB,0xFF,0x66,0xAB,0xFF,0x86,0xAB,0xFF,0x26,0xA3,0xFF,0x05,0x9B,0xFF,0xE5,0x9A,0xFF,0xC5,0x92,0xFF,0x84,0x8A,0xFF,0x44,0x82,0xFF,0x64,0x82,0xFF,0xA4,0x8A,0xFF,0x25,0x93,0xFF,0x86,0xA3,0xFF,0xE7,0xB3,0xFF,0x47,0xBC,0xFF,0x87,0xCC,0xFF,0xC8,0xD4,0xFF,0xE8,0xD4,0xFF,0x29,0xDD,0xFF,0x29,0xDD,0xFF,0x28,0xDD,0xFF,0x89,0xE5,0xFF,0x69,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0xAA,0xE5,0xFF,0x0B,0xEE,0xFF,0x2B,0xEE,0xFF,0xEA,0xED,0xFF,0xCA,0xE5,0xFF,0x89,0xE5,0xFF,0x68,0xDD,0xFF,0x48,0xDD,0xFF,0x48,0xDD,0xFF,0x69,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0x89,0xE5,0xFF,0xA9,0xE5,0xFF,0x0A,0xEE,0xFF,0x4C,0xF6,0xFF,0x8D,0xF6,0xFF,0xAD,0xF6,0xFF,
-    0xAD,0xF6,0xFF,0xAD,0xF6,0xFF,0xCE,0xF6,0xFF,0xCE,0xF6,0xFF,0x8D,0xF6,0xFF,0x2B,0xEE,0xFF,0xEA,0xE5,0xFF,0xEB,0xE5,0xFF,0x2B,0xEE,0xFF,0x6C,0xEE,0xFF,0x8D,0xEE,0xFF,0xAE,0xEE,0xFF,0xAE,0xF6,0xFF,0xAE,0xEE,0xFF,0xAE,0xEE,0xFF,0x4D,0xEE,0xFF,0x0C,0xE6,0xFF,0x0C,0xE6,0xFF,0xEB,0xE5,0xFF,0xAA,0xDD,0xFF,0x6A,0xDD,0xFF,0x49,0xD5,0xFF,0x09,0xCD,0xFF,0xE9,0xCC,0xFF,0xE9,0xCC,0xFF,0x0A,0xCD,0xFF,0x2B,0xCD,0xFF,0x4C,0xCD,0xFF,0x2C,0xC5,0xFF,0x0C,0xBD,0xFF,0xEB,0xBC,0xFF,0xEB,0xBC,0xFF,0xCB,0xB4,0xFF,0xCA,0xB4,0xFF,0xCA,0xB4,0xFF,0xCA,0xB4,0xFF,0xEA,0xBC,0xFF,0xCA,0xB4,0xFF,0x89,0xAC,0xFF,0x49,0xA4,0xFF,0x08,0x9C,0xFF,0xE8,0x9B,0xFF,0xA7,0x93,0xFF,0x87,0x8B,0xFF,0x87,0x8B,0xFF,0x87,0x8B,0xFF,0x66,0x83,0xFF,0x45,0x83,0xFF,0x46,0x83,0xFF,0x26,0x83,0xFF,0xE6,0x72,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0x06,0x8B,0xFF,0x47,0x93,0xFF,0x65,0x72,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x24,0x5A,0xFF,0x44,0x62,0xFF,
-    0xE3,0x7A,0xFF,0xEA,0xB4,0xFF,0x50,0xDE,0xFF,0x49,0x9C,0xFF,0x01,0x52,0xFF,0xA3,0x41,0xFF,0x63,0x39,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x60,0x08,0xFF,0x65,0x29,0xFF,0xE8,0x39,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0x85,0x29,0xFF,0xA1,0x10,0xFF,0x03,0x21,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0x08,0x3A,0xFF,0xE8,0x31,0xFF,0xA7,0x31,0xFF,0x08,0x3A,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0x08,0x42,0xFF,0x27,0x4A,0xFF,0xA4,0x51,0xFF,0x03,0x72,0xFF,0x63,0x82,0xFF,0xC1,0x79,0xFF,0x64,0x8A,0xFF,0x23,0x7A,0xFF,0x64,0x82,0xFF,0xA5,0x8A,0xFF,0xC5,0x92,0xFF,0xE5,0x9A,0xFF,
-    0xC5,0x92,0xFF,0xC4,0x92,0xFF,0xC4,0x8A,0xFF,0x43,0x7A,0xFF,0xE3,0x71,0xFF,0xA2,0x69,0xFF,0xA2,0x61,0xFF,0xC3,0x69,0xFF,0x24,0x7A,0xFF,0x85,0x8A,0xFF,0xC5,0x92,0xFF,0x26,0x9B,0xFF,0x66,0xAB,0xFF,0xA7,0xB3,0xFF,0xE7,0xBB,0xFF,0x26,0xBC,0xFF,0x27,0xC4,0xFF,0x06,0xBC,0xFF,0x26,0xC4,0xFF,0x66,0xC4,0xFF,0x87,0xCC,0xFF,0xC7,0xD4,0xFF,0xA7,0xD4,0xFF,0x08,0xDD,0xFF,0x89,0xE5,0xFF,0xA9,0xE5,0xFF,0xCA,0xED,0xFF,0xEA,0xED,0xFF,0xAA,0xED,0xFF,0xAA,0xED,0xFF,0xCA,0xED,0xFF,0xEA,0xE5,0xFF,0x0B,0xEE,0xFF,0x0B,0xEE,0xFF,0x0A,0xEE,0xFF,0x0A,0xEE,0xFF,0xEA,0xED,0xFF,0xC9,0xE5,0xFF,0x89,0xE5,0xFF,0xA9,0xE5,0xFF,0xCA,0xED,0xFF,0xEA,0xE5,0xFF,0xEA,0xED,0xFF,0x0A,0xEE,0xFF,0x0B,0xEE,0xFF,0x4C,0xEE,0xFF,0x8D,0xF6,0xFF,0xCE,0xF6,0xFF,0xEE,0xF6,0xFF,0x0F,0xF7,0xFF,0xEE,0xF6,0xFF,0xEE,0xF6,0xFF,0xCE,0xF6,0xFF,0x8D,0xEE,0xFF,0x6C,0xEE,0xFF,0x6C,0xEE,0xFF,0x8D,0xEE,0xFF,0xAE,0xF6,0xFF,0xCE,0xF6,0xFF,0xCF,0xF6,0xFF,0xCF,0xF6,0xFF,0xAE,0xEE,0xFF,0x8E,0xEE,0xFF,0x4D,0xE6,0xFF,
-    0xEC,0xE5,0xFF,0xCB,0xDD,0xFF,0xAB,0xDD,0xFF,0x6A,0xD5,0xFF,0x4A,0xD5,0xFF,0x29,0xD5,0xFF,0x09,0xCD,0xFF,0x2A,0xD5,0xFF,0x2A,0xD5,0xFF,0x4B,0xD5,0xFF,0x4B,0xCD,0xFF,0x6C,0xD5,0xFF,0x4C,0xC5,0xFF,0x0C,0xC5,0xFF,0xEB,0xBC,0xFF,0xEB,0xBC,0xFF,0xEB,0xBC,0xFF,0xEA,0xBC,0xFF,0xEA,0xBC,0xFF,0xEA,0xBC,0xFF,0xEA,0xBC,0xFF,0xA9,0xB4,0xFF,0x69,0xAC,0xFF,0x29,0xA4,0xFF,0x08,0x9C,0xFF,0xC8,0x9B,0xFF,0xA7,0x93,0xFF,0x87,0x8B,0xFF,0x87,0x8B,0xFF,0x87,0x8B,0xFF,0x66,0x8B,0xFF,0x86,0x8B,0xFF,0xD0,0xCD,0xFF,0x0E,0xB5,0xFF,0xC5,0x72,0xFF,0xC5,0x72,0xFF,0xE6,0x72,0xFF,0xC5,0x6A,0xFF,0x85,0x6A,0xFF,0x06,0x8B,0xFF,0xEA,0xAB,0xFF,0xC6,0x82,0xFF,0x24,0x5A,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x83,0x62,0xFF,0xC3,0x6A,0xFF,0xE3,0x72,0xFF,0x42,0x62,0xFF,0xC2,0x49,0xFF,0x82,0x41,0xFF,0x42,0x31,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x01,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x61,0x10,0xFF,0x04,0x21,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0x08,0x3A,0xFF,0xC6,0x31,0xFF,0xC2,0x10,0xFF,0xE3,0x18,0xFF,0x44,0x29,0xFF,0x08,0x42,0xFF,0xE8,0x39,0xFF,0xC8,0x31,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xC7,0x39,0xFF,0x08,0x4A,0xFF,0xA5,0x49,0xFF,0x03,0x6A,0xFF,0x43,0x82,0xFF,0xE2,0x71,0xFF,0x03,0x7A,0xFF,0x84,0x82,0xFF,0x85,0x82,0xFF,0x44,0x7A,0xFF,0x04,0x72,0xFF,0x82,0x61,0xFF,0x42,0x59,0xFF,0x21,0x51,0xFF,0x21,0x51,0xFF,0x42,0x59,0xFF,0x62,0x59,0xFF,0xA2,0x61,0xFF,0x03,0x72,0xFF,0x85,0x8A,0xFF,0xE5,0x9A,0xFF,0x26,0xA3,0xFF,0x46,0xAB,0xFF,0x65,0xAB,0xFF,0x65,0xAB,0xFF,0xA5,0xB3,0xFF,0x06,0xBC,0xFF,0x06,0xBC,0xFF,0x46,0xC4,0xFF,
-    0x67,0xCC,0xFF,0x46,0xCC,0xFF,0x67,0xCC,0xFF,0x87,0xD4,0xFF,0x87,0xCC,0xFF,0xA7,0xD4,0xFF,0xA7,0xD4,0xFF,0x08,0xDD,0xFF,0x89,0xE5,0xFF,0xAA,0xE5,0xFF,0xCA,0xED,0xFF,0xCA,0xED,0xFF,0xAA,0xE5,0xFF,0xAA,0xE5,0xFF,0xEA,0xED,0xFF,0x0B,0xEE,0xFF,0x2B,0xEE,0xFF,0x4B,0xF6,0xFF,0x4B,0xF6,0xFF,0x2B,0xEE,0xFF,0x0A,0xEE,0xFF,0xEA,0xED,0xFF,0xC9,0xE5,0xFF,0xA9,0xE5,0xFF,0xEA,0xED,0xFF,0x2B,0xEE,0xFF,0x2B,0xEE,0xFF,0x4B,0xEE,0xFF,0x2B,0xEE,0xFF,0x4C,0xEE,0xFF,0xAD,0xF6,0xFF,0xEF,0xF6,0xFF,0x71,0xFF,0xFF,0xB3,0xFF,0xFF,0x71,0xFF,0xFF,0x50,0xFF,0xFF,0x0F,0xF7,0xFF,0xCE,0xF6,0xFF,0x6D,0xEE,0xFF,0x6D,0xEE,0xFF,0x8D,0xEE,0xFF,0x8E,0xEE,0xFF,0x8E,0xEE,0xFF,0x8E,0xEE,0xFF,0xAE,0xEE,0xFF,0x8E,0xEE,0xFF,0x6E,0xEE,0xFF,0x4D,0xE6,0xFF,0x0C,0xE6,0xFF,0xEC,0xDD,0xFF,0xEC,0xDD,0xFF,0xEC,0xDD,0xFF,0xEC,0xE5,0xFF,0xEC,0xE5,0xFF,0x0D,0xE6,0xFF,0x0D,0xE6,0xFF,0x8B,0xD5,0xFF,0xAC,0xDD,0xFF,0xAC,0xD5,0xFF,0x8C,0xD5,0xFF,0x6C,0xCD,0xFF,0x2C,0xC5,0xFF,0x0B,0xBD,0xFF,0x0B,0xBD,0xFF,
-    0x0B,0xBD,0xFF,0x0B,0xBD,0xFF,0x0B,0xC5,0xFF,0x0A,0xBD,0xFF,0xCA,0xBC,0xFF,0xA9,0xB4,0xFF,0x49,0xAC,0xFF,0x08,0xA4,0xFF,0xE8,0x9B,0xFF,0xC7,0x9B,0xFF,0xA7,0x93,0xFF,0x87,0x93,0xFF,0x87,0x8B,0xFF,0x87,0x8B,0xFF,0x87,0x8B,0xFF,0x86,0x8B,0xFF,0x29,0x9C,0xFF,0xC9,0x93,0xFF,0xE6,0x72,0xFF,0xE6,0x72,0xFF,0xE6,0x6A,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,0x85,0x72,0xFF,0xA5,0x7A,0xFF,0x65,0x6A,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x24,0x5A,0xFF,0x24,0x52,0xFF,0x24,0x5A,0xFF,0x03,0x52,0xFF,0xE3,0x51,0xFF,0xC3,0x49,0xFF,0xA2,0x41,0xFF,0x62,0x39,0xFF,0x42,0x31,0xFF,0x22,0x31,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE1,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0xE3,0x18,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0x08,0x3A,0xFF,0x07,0x3A,0xFF,0x03,0x21,0xFF,0x81,0x10,0xFF,0xC6,0x31,0xFF,0x08,0x42,0xFF,0xA7,0x31,0xFF,0xC7,0x31,0xFF,0x09,0x3A,0xFF,0x29,0x42,0xFF,0x08,0x42,0xFF,0xE8,0x41,0xFF,0xA5,0x41,0xFF,0xC4,0x59,0xFF,0xA2,0x61,0xFF,0xE2,0x71,0xFF,0x23,0x7A,0xFF,0xE3,0x71,0xFF,0x62,0x59,0xFF,0x62,0x59,0xFF,0x83,0x59,0xFF,0xE3,0x69,0xFF,0x04,0x72,0xFF,0x04,0x72,0xFF,0x03,0x72,0xFF,0xE3,0x71,0xFF,0x03,0x72,0xFF,0x03,0x7A,0xFF,0x43,0x82,0xFF,0x43,0x82,0xFF,0x83,0x92,0xFF,0x83,0x92,0xFF,0xC4,0x9A,0xFF,0x24,0xAB,0xFF,0x85,0xB3,0xFF,0x07,0xC4,0xFF,0x68,0xCC,0xFF,0x27,0xC4,0xFF,0x26,0xC4,0xFF,0x67,0xCC,0xFF,0x87,0xCC,0xFF,0x87,0xCC,0xFF,0x67,0xCC,0xFF,0xE5,0xBB,0xFF,0xC5,0xBB,0xFF,0x46,0xC4,0xFF,0x87,0xCC,0xFF,0xE8,0xD4,0xFF,0x69,0xDD,0xFF,0xAA,0xE5,0xFF,0xAA,0xE5,0xFF,0xAA,0xE5,0xFF,0xEB,0xED,0xFF,0xEB,0xED,0xFF,0xEB,0xED,0xFF,0xEA,0xED,0xFF,
-    0xEA,0xED,0xFF,0x2B,0xEE,0xFF,0x2B,0xEE,0xFF,0x0B,0xEE,0xFF,0x2B,0xEE,0xFF,0x4B,0xEE,0xFF,0x4B,0xEE,0xFF,0x0A,0xEE,0xFF,0x0B,0xEE,0xFF,0x6C,0xF6,0xFF,0x8D,0xF6,0xFF,0x8D,0xF6,0xFF,0x8D,0xF6,0xFF,0xCE,0xF6,0xFF,0xEF,0xF6,0xFF,0x0F,0xF7,0xFF,0x51,0xFF,0xFF,0x72,0xFF,0xFF,0x30,0xF7,0xFF,0x0F,0xF7,0xFF,0xEF,0xF6,0xFF,0x8D,0xEE,0xFF,0x4C,0xE6,0xFF,0x4D,0xE6,0xFF,0x8E,0xEE,0xFF,0xCF,0xF6,0xFF,0xCF,0xEE,0xFF,0xAE,0xEE,0xFF,0xAF,0xEE,0xFF,0x8E,0xEE,0xFF,0x8E,0xEE,0xFF,0xAF,0xEE,0xFF,0xCF,0xF6,0xFF,0xCF,0xF6,0xFF,0xAF,0xF6,0xFF,0x6E,0xEE,0xFF,0x2D,0xE6,0xFF,0x0C,0xE6,0xFF,0xCC,0xDD,0xFF,0xAB,0xDD,0xFF,0xCC,0xDD,0xFF,0xEC,0xDD,0xFF,0xED,0xDD,0xFF,0xED,0xDD,0xFF,0xCD,0xDD,0xFF,0xCE,0xD5,0xFF,0x8D,0xCD,0xFF,0x4C,0xC5,0xFF,0x2B,0xC5,0xFF,0x2B,0xC5,0xFF,0x2B,0xC5,0xFF,0x0A,0xBD,0xFF,0xCA,0xBC,0xFF,0x89,0xB4,0xFF,0x48,0xAC,0xFF,0x28,0xA4,0xFF,0x08,0xA4,0xFF,0x08,0xA4,0xFF,0xE8,0x9B,0xFF,0xA7,0x93,0xFF,0xA7,0x93,0xFF,0x87,0x8B,0xFF,0x67,0x8B,0xFF,0x67,0x8B,0xFF,
-    0x26,0x83,0xFF,0x06,0x7B,0xFF,0x06,0x7B,0xFF,0x06,0x73,0xFF,0xE6,0x72,0xFF,0xA5,0x6A,0xFF,0x65,0x62,0xFF,0x45,0x62,0xFF,0x45,0x62,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x04,0x52,0xFF,0xE3,0x49,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x22,0x31,0xFF,0x22,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x80,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xE2,0x18,0xFF,0xE7,0x39,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0x28,0x42,0xFF,0xA6,0x31,0xFF,0x44,0x21,0xFF,0x49,0x42,0xFF,0x08,0x3A,0xFF,0x86,0x29,0xFF,0xE8,0x39,0xFF,
-    0xE8,0x39,0xFF,0xC8,0x39,0xFF,0x28,0x42,0xFF,0xA6,0x41,0xFF,0xC4,0x51,0xFF,0x62,0x51,0xFF,0x40,0x59,0xFF,0x82,0x61,0xFF,0x84,0x82,0xFF,0x64,0x82,0xFF,0x64,0x82,0xFF,0x44,0x7A,0xFF,0x44,0x7A,0xFF,0x43,0x7A,0xFF,0x23,0x7A,0xFF,0x23,0x7A,0xFF,0x02,0x7A,0xFF,0x03,0x7A,0xFF,0x43,0x82,0xFF,0x83,0x8A,0xFF,0x83,0x8A,0xFF,0xA4,0x92,0xFF,0xE4,0x9A,0xFF,0xE4,0x9A,0xFF,0xC4,0x9A,0xFF,0x04,0xA3,0xFF,0x24,0xA3,0xFF,0x24,0xAB,0xFF,0x65,0xAB,0xFF,0x64,0xB3,0xFF,0xA5,0xB3,0xFF,0x85,0xB3,0xFF,0xC5,0xBB,0xFF,0xC5,0xBB,0xFF,0x26,0xC4,0xFF,0x47,0xC4,0xFF,0x67,0xCC,0xFF,0x08,0xD5,0xFF,0x29,0xDD,0xFF,0x29,0xDD,0xFF,0x49,0xDD,0xFF,0x49,0xDD,0xFF,0x8A,0xE5,0xFF,0xCB,0xED,0xFF,0xEB,0xED,0xFF,0x0B,0xEE,0xFF,0x2B,0xEE,0xFF,0x2C,0xEE,0xFF,0x0B,0xEE,0xFF,0x2C,0xEE,0xFF,0x2C,0xEE,0xFF,0x2B,0xEE,0xFF,0x4C,0xEE,0xFF,0x6C,0xEE,0xFF,0x6D,0xF6,0xFF,0x6D,0xF6,0xFF,0x6C,0xEE,0xFF,0x6D,0xEE,0xFF,0x6D,0xEE,0xFF,0x4D,0xEE,0xFF,0x2C,0xE6,0xFF,0x2C,0xE6,0xFF,0x4D,0xE6,0xFF,0xAE,0xEE,0xFF,
-    0xEF,0xF6,0xFF,0x10,0xF7,0xFF,0x30,0xF7,0xFF,0x50,0xF7,0xFF,0x51,0xF7,0xFF,0x30,0xF7,0xFF,0x30,0xF7,0xFF,0x0F,0xF7,0xFF,0xEE,0xF6,0xFF,0x0F,0xF7,0xFF,0x0F,0xF7,0xFF,0xEF,0xF6,0xFF,0xCE,0xF6,0xFF,0xAE,0xEE,0xFF,0xCF,0xEE,0xFF,0xAE,0xEE,0xFF,0x8E,0xE6,0xFF,0x2D,0xE6,0xFF,0xEC,0xE5,0xFF,0xCB,0xDD,0xFF,0xCB,0xDD,0xFF,0xAB,0xDD,0xFF,0xAB,0xDD,0xFF,0x8B,0xDD,0xFF,0x6A,0xD5,0xFF,0xEC,0xE5,0xFF,0x8E,0xF6,0xFF,0x0C,0xDE,0xFF,0xCC,0xDD,0xFF,0x0D,0xE6,0xFF,0x4F,0xE6,0xFF,0x4F,0xE6,0xFF,0xCD,0xD5,0xFF,0x6C,0xCD,0xFF,0x2B,0xC5,0xFF,0xEA,0xBC,0xFF,0xCA,0xB4,0xFF,0x89,0xB4,0xFF,0x69,0xAC,0xFF,0x49,0xAC,0xFF,0x48,0xAC,0xFF,0x28,0xA4,0xFF,0xE7,0x9B,0xFF,0xA7,0x93,0xFF,0xA7,0x93,0xFF,0x87,0x8B,0xFF,0x67,0x8B,0xFF,0x47,0x83,0xFF,0x46,0x83,0xFF,0x26,0x7B,0xFF,0x06,0x7B,0xFF,0xE6,0x72,0xFF,0xC6,0x72,0xFF,0x86,0x6A,0xFF,0x65,0x62,0xFF,0x45,0x62,0xFF,0x25,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,
-    0x04,0x4A,0xFF,0xC3,0x49,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x43,0x31,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA0,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xC8,0x39,0xFF,0x29,0x42,0xFF,0xCB,0x52,0xFF,0x69,0x42,0xFF,0x08,0x3A,0xFF,0x69,0x4A,0xFF,0xA6,0x31,0xFF,0x08,0x3A,0xFF,0x09,0x42,0xFF,0xC7,0x39,0xFF,0x07,0x4A,0xFF,0x43,0x41,0xFF,0x62,0x51,0xFF,0x00,0x49,0xFF,0x21,0x51,0xFF,0xE3,0x71,0xFF,0x03,0x7A,0xFF,0xC2,0x71,0xFF,0xE2,0x71,0xFF,0x03,0x7A,0xFF,0x43,0x82,0xFF,0x43,0x82,0xFF,0x23,0x82,0xFF,0x03,0x82,0xFF,
-    0xE2,0x79,0xFF,0xE2,0x79,0xFF,0x43,0x82,0xFF,0x84,0x92,0xFF,0xA4,0x92,0xFF,0xA4,0x92,0xFF,0xE4,0x9A,0xFF,0xA3,0x8A,0xFF,0x63,0x8A,0xFF,0xA3,0x92,0xFF,0xE4,0x9A,0xFF,0xE3,0x9A,0xFF,0x24,0xA3,0xFF,0x85,0xB3,0xFF,0xE6,0xBB,0xFF,0x26,0xC4,0xFF,0x67,0xCC,0xFF,0x87,0xCC,0xFF,0xA8,0xD4,0xFF,0xE9,0xD4,0xFF,0xE8,0xD4,0xFF,0xE8,0xD4,0xFF,0xE8,0xD4,0xFF,0x29,0xDD,0xFF,0x49,0xDD,0xFF,0x8A,0xE5,0xFF,0xAA,0xE5,0xFF,0x0B,0xEE,0xFF,0x4C,0xEE,0xFF,0x8D,0xEE,0xFF,0xAE,0xF6,0xFF,0xAE,0xF6,0xFF,0x8D,0xF6,0xFF,0x4C,0xEE,0xFF,0x2C,0xEE,0xFF,0x4C,0xEE,0xFF,0x2C,0xE6,0xFF,0x0C,0xE6,0xFF,0xEB,0xE5,0xFF,0xAB,0xDD,0xFF,0x6A,0xD5,0xFF,0x8A,0xD5,0xFF,0xAA,0xDD,0xFF,0xEB,0xE5,0xFF,0x0C,0xE6,0xFF,0x2C,0xE6,0xFF,0x6D,0xEE,0xFF,0xAE,0xEE,0xFF,0x0F,0xF7,0xFF,0x91,0xFF,0xFF,0x91,0xFF,0xFF,0xB1,0xFF,0xFF,0xB2,0xFF,0xFF,0xB2,0xFF,0xFF,0xB2,0xFF,0xFF,0xB1,0xFF,0xFF,0x50,0xF7,0xFF,0x0E,0xF7,0xFF,0xCD,0xF6,0xFF,0xED,0xF6,0xFF,0x0D,0xF7,0xFF,0x0D,0xF7,0xFF,0x2E,0xF7,0xFF,0x70,0xFF,0xFF,
-    0x4F,0xF7,0xFF,0x0E,0xF7,0xFF,0xAD,0xEE,0xFF,0x2B,0xE6,0xFF,0x4C,0xEE,0xFF,0x4B,0xE6,0xFF,0x4B,0xEE,0xFF,0x2B,0xEE,0xFF,0xEB,0xE5,0xFF,0xEB,0xE5,0xFF,0x8C,0xEE,0xFF,0x4C,0xEE,0xFF,0x49,0xD5,0xFF,0x8A,0xDD,0xFF,0xEC,0xE5,0xFF,0x2D,0xEE,0xFF,0x4D,0xE6,0xFF,0x2D,0xE6,0xFF,0x4D,0xE6,0xFF,0x0D,0xDE,0xFF,0x8C,0xCD,0xFF,0xEA,0xBC,0xFF,0x89,0xB4,0xFF,0x48,0xAC,0xFF,0x48,0xAC,0xFF,0x28,0xA4,0xFF,0x07,0xA4,0xFF,0xC7,0x9B,0xFF,0xA7,0x93,0xFF,0xA7,0x93,0xFF,0x67,0x8B,0xFF,0x67,0x8B,0xFF,0x47,0x83,0xFF,0x26,0x7B,0xFF,0xE6,0x72,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x45,0x62,0xFF,0x25,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x5A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x4A,0xFF,0xE4,0x49,0xFF,0x04,0x4A,0xFF,0xC3,0x49,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA0,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0xA6,0x31,0xFF,0xC7,0x31,0xFF,0xE8,0x31,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0x29,0x42,0xFF,0x28,0x42,0xFF,0x07,0x42,0xFF,0x86,0x31,0xFF,0x08,0x42,0xFF,0x07,0x4A,0xFF,0xA4,0x49,0xFF,0x83,0x51,0xFF,0x00,0x49,0xFF,0x41,0x51,0xFF,0x82,0x61,0xFF,0xE3,0x71,0xFF,0xE3,0x71,0xFF,0xE2,0x71,0xFF,0xE2,0x71,0xFF,0xE2,0x79,0xFF,0x43,0x82,0xFF,0x43,0x82,0xFF,0x64,0x8A,0xFF,0x44,0x8A,0xFF,0x23,0x82,0xFF,0x43,0x8A,0xFF,0x43,0x8A,0xFF,0xC4,0x9A,0xFF,0xC4,0x9A,0xFF,0x62,0x92,0xFF,0x41,0x8A,0xFF,0xA2,0x8A,0xFF,0x44,0xA3,0xFF,0xC5,0xB3,0xFF,0x06,0xBC,0xFF,0xE6,0xBB,0xFF,0x26,0xC4,0xFF,0x67,0xCC,0xFF,0x26,0xC4,0xFF,0x47,0xCC,0xFF,
-    0x87,0xCC,0xFF,0xA7,0xCC,0xFF,0x87,0xCC,0xFF,0xA7,0xCC,0xFF,0xA7,0xCC,0xFF,0x08,0xD5,0xFF,0x8A,0xDD,0xFF,0xCB,0xE5,0xFF,0x0C,0xEE,0xFF,0x4D,0xEE,0xFF,0x6D,0xF6,0xFF,0x6D,0xEE,0xFF,0x6D,0xEE,0xFF,0x2D,0xE6,0xFF,0xCB,0xDD,0xFF,0x8A,0xD5,0xFF,0x6A,0xD5,0xFF,0x69,0xD5,0xFF,0x6A,0xD5,0xFF,0x6A,0xD5,0xFF,0x8B,0xDD,0xFF,0xAB,0xDD,0xFF,0xEB,0xDD,0xFF,0xEB,0xDD,0xFF,0xEB,0xE5,0xFF,0x0B,0xE6,0xFF,0x4B,0xEE,0xFF,0x6C,0xF6,0xFF,0x8C,0xF6,0xFF,0xAC,0xF6,0xFF,0xCD,0xF6,0xFF,0xEE,0xF6,0xFF,0x6F,0xFF,0xFF,0x90,0xFF,0xFF,0x90,0xF7,0xFF,0x70,0xF7,0xFF,0x70,0xF7,0xFF,0x91,0xF7,0xFF,0x90,0xF7,0xFF,0x90,0xF7,0xFF,0x91,0xF7,0xFF,0x91,0xFF,0xFF,0x0E,0xF7,0xFF,0xCC,0xF6,0xFF,0x0C,0xF7,0xFF,0x2D,0xF7,0xFF,0x0C,0xF7,0xFF,0x4D,0xFF,0xFF,0x2D,0xF7,0xFF,0x0D,0xF7,0xFF,0x0C,0xF7,0xFF,0xEC,0xF6,0xFF,0xCC,0xF6,0xFF,0xCB,0xF6,0xFF,0xCB,0xF6,0xFF,0xAB,0xF6,0xFF,0x8A,0xEE,0xFF,0x8A,0xEE,0xFF,0x4A,0xEE,0xFF,0x2A,0xE6,0xFF,0x89,0xD5,0xFF,0x08,0xCD,0xFF,0x29,0xD5,0xFF,0x69,0xDD,0xFF,
-    0xCA,0xE5,0xFF,0x4C,0xEE,0xFF,0x4B,0xEE,0xFF,0xAD,0xF6,0xFF,0x8E,0xEE,0xFF,0x4D,0xE6,0xFF,0xEC,0xDD,0xFF,0x4B,0xCD,0xFF,0xEA,0xBC,0xFF,0x89,0xAC,0xFF,0x28,0xA4,0xFF,0xC7,0x9B,0xFF,0xC7,0x93,0xFF,0xA8,0x93,0xFF,0x88,0x93,0xFF,0x47,0x8B,0xFF,0x26,0x83,0xFF,0x06,0x7B,0xFF,0xC5,0x72,0xFF,0x85,0x6A,0xFF,0x85,0x62,0xFF,0x45,0x62,0xFF,0x45,0x62,0xFF,0x25,0x5A,0xFF,0x05,0x5A,0xFF,0x05,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xE4,0x49,0xFF,0xC3,0x49,0xFF,0xC3,0x41,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x63,0x31,0xFF,0x22,0x31,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE1,0x18,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA0,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,
-    0x60,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x60,0x08,0xFF,0x85,0x29,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0x29,0x42,0xFF,0x66,0x29,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x28,0x4A,0xFF,0x84,0x41,0xFF,0x83,0x49,0xFF,0x41,0x49,0xFF,0x41,0x51,0xFF,0xC3,0x61,0xFF,0xA2,0x61,0xFF,0x82,0x61,0xFF,0x81,0x61,0xFF,0x03,0x7A,0xFF,0x03,0x7A,0xFF,0x23,0x7A,0xFF,0x43,0x82,0xFF,0x23,0x82,0xFF,0x43,0x82,0xFF,0x23,0x82,0xFF,0xE2,0x79,0xFF,0x22,0x82,0xFF,0x42,0x8A,0xFF,0xE3,0xA2,0xFF,0x44,0xB3,0xFF,0xC5,0xBB,0xFF,0x05,0xC4,0xFF,0x66,0xCC,0xFF,0x66,0xCC,0xFF,0x46,0xC4,0xFF,0x26,0xBC,0xFF,0xE5,0xBB,0xFF,0xC5,0xBB,0xFF,0xA7,0xCC,0xFF,0x07,0xD5,0xFF,0x28,0xD5,0xFF,0x49,0xDD,0xFF,0xAA,0xE5,0xFF,0xAA,0xDD,0xFF,0xAB,0xE5,0xFF,0xCC,0xE5,0xFF,0xEC,0xE5,0xFF,0xCC,0xDD,0xFF,0xAB,0xDD,0xFF,0x4A,0xCD,0xFF,0xE9,0xC4,0xFF,0xA8,0xBC,0xFF,0x87,0xBC,0xFF,0x87,0xBC,0xFF,0x69,0xD5,0xFF,0xA9,0xDD,0xFF,0xEA,0xE5,0xFF,
-    0x0A,0xEE,0xFF,0x0B,0xE6,0xFF,0xEB,0xE5,0xFF,0xAA,0xDD,0xFF,0xAA,0xDD,0xFF,0xEB,0xE5,0xFF,0x4C,0xEE,0xFF,0x6C,0xEE,0xFF,0x8C,0xF6,0xFF,0x6B,0xEE,0xFF,0x6B,0xF6,0xFF,0xAC,0xF6,0xFF,0xCD,0xF6,0xFF,0x2E,0xFF,0xFF,0x2E,0xF7,0xFF,0x4E,0xF7,0xFF,0x4E,0xF7,0xFF,0x2D,0xF7,0xFF,0x6E,0xF7,0xFF,0xB1,0xFF,0xFF,0xB1,0xFF,0xFF,0xB1,0xFF,0xFF,0x90,0xF7,0xFF,0x90,0xF7,0xFF,0x90,0xF7,0xFF,0x91,0xF7,0xFF,0x91,0xFF,0xFF,0x4F,0xF7,0xFF,0x6F,0xF7,0xFF,0x4F,0xFF,0xFF,0xCB,0xEE,0xFF,0xEC,0xF6,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x0D,0xF7,0xFF,0x2D,0xF7,0xFF,0x2D,0xF7,0xFF,0x0C,0xF7,0xFF,0xEB,0xF6,0xFF,0xAA,0xEE,0xFF,0xCB,0xF6,0xFF,0xCA,0xF6,0xFF,0xAA,0xF6,0xFF,0xCB,0xF6,0xFF,0xED,0xF6,0xFF,0x8D,0xEE,0xFF,0xEB,0xE5,0xFF,0x49,0xD5,0xFF,0x27,0xD5,0xFF,0x89,0xDD,0xFF,0xE9,0xE5,0xFF,0x4B,0xEE,0xFF,0xAD,0xF6,0xFF,0x4C,0xEE,0xFF,0x4D,0xEE,0xFF,0x8E,0xEE,0xFF,0x6E,0xE6,0xFF,0x0E,0xDE,0xFF,0xAD,0xCD,0xFF,0xCB,0xB4,0xFF,0x29,0xA4,0xFF,0xC8,0x93,0xFF,0x87,0x93,0xFF,0x66,0x8B,0xFF,
-    0x26,0x83,0xFF,0xE6,0x7A,0xFF,0xC5,0x72,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x65,0x62,0xFF,0x44,0x5A,0xFF,0x25,0x5A,0xFF,0x25,0x52,0xFF,0x04,0x52,0xFF,0x05,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC3,0x49,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0x02,0x21,0xFF,0xE1,0x20,0xFF,0xE1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x24,0x21,0xFF,0xE8,0x39,0xFF,0xC8,0x31,0xFF,0xC8,0x31,0xFF,0xE8,0x39,0xFF,0xC8,0x31,0xFF,0x66,0x29,0xFF,0x45,0x29,0xFF,0x65,0x29,0xFF,0x85,0x31,0xFF,
-    0xE6,0x49,0xFF,0x42,0x41,0xFF,0x01,0x41,0xFF,0x21,0x49,0xFF,0x82,0x59,0xFF,0xA2,0x61,0xFF,0xA2,0x61,0xFF,0xA2,0x69,0xFF,0xC3,0x71,0xFF,0x03,0x7A,0xFF,0xE3,0x71,0xFF,0x03,0x7A,0xFF,0x23,0x82,0xFF,0x43,0x82,0xFF,0x22,0x82,0xFF,0x43,0x82,0xFF,0x83,0x92,0xFF,0xA4,0x92,0xFF,0xE4,0x9A,0xFF,0x44,0xAB,0xFF,0x84,0xB3,0xFF,0xC4,0xBB,0xFF,0xA4,0xB3,0xFF,0x04,0xBC,0xFF,0x04,0xB4,0xFF,0xA4,0xAB,0xFF,0xE5,0xB3,0xFF,0x07,0xB4,0xFF,0x88,0xC4,0xFF,0x69,0xDD,0xFF,0xCB,0xE5,0xFF,0x8A,0xDD,0xFF,0x6B,0xD5,0xFF,0x2A,0xCD,0xFF,0xC9,0xBC,0xFF,0x48,0xB4,0xFF,0xE6,0xAB,0xFF,0xA5,0xA3,0xFF,0x84,0xA3,0xFF,0x84,0xA3,0xFF,0xA5,0xA3,0xFF,0xA5,0xA3,0xFF,0xC6,0xAB,0xFF,0x26,0xB4,0xFF,0x0A,0xE6,0xFF,0x6A,0xF6,0xFF,0x49,0xEE,0xFF,0x49,0xF6,0xFF,0x49,0xF6,0xFF,0x4A,0xF6,0xFF,0x6B,0xF6,0xFF,0x4B,0xF6,0xFF,0x0B,0xEE,0xFF,0x2B,0xEE,0xFF,0x6B,0xF6,0xFF,0x6B,0xF6,0xFF,0x8B,0xF6,0xFF,0xAB,0xF6,0xFF,0xCC,0xF6,0xFF,0x0D,0xF7,0xFF,0x4F,0xFF,0xFF,0x0E,0xF7,0xFF,0x0D,0xF7,0xFF,0x4D,0xF7,0xFF,
-    0x0C,0xF7,0xFF,0x4D,0xF7,0xFF,0x8F,0xFF,0xFF,0xB1,0xFF,0xFF,0xB1,0xFF,0xFF,0x91,0xF7,0xFF,0xD2,0xFF,0xFF,0xD1,0xFF,0xFF,0x4F,0xF7,0xFF,0x70,0xF7,0xFF,0xB2,0xFF,0xFF,0xB3,0xFF,0xFF,0xB2,0xFF,0xFF,0xB2,0xFF,0xFF,0x0E,0xF7,0xFF,0x4A,0xE6,0xFF,0x4B,0xE6,0xFF,0xEE,0xF6,0xFF,0x2E,0xF7,0xFF,0x70,0xFF,0xFF,0x90,0xFF,0xFF,0x6E,0xFF,0xFF,0x6D,0xFF,0xFF,0x6D,0xFF,0xFF,0x0C,0xFF,0xFF,0xAA,0xF6,0xFF,0x28,0xEE,0xFF,0x49,0xEE,0xFF,0x8B,0xEE,0xFF,0xCC,0xF6,0xFF,0xED,0xF6,0xFF,0xAD,0xF6,0xFF,0xAA,0xDD,0xFF,0xE7,0xCC,0xFF,0xE6,0xCC,0xFF,0x67,0xDD,0xFF,0x2A,0xEE,0xFF,0xAC,0xF6,0xFF,0x8D,0xEE,0xFF,0xCE,0xEE,0xFF,0x0F,0xF7,0xFF,0x10,0xF7,0xFF,0xB0,0xE6,0xFF,0x0E,0xD6,0xFF,0xAE,0xD5,0xFF,0x4D,0xC5,0xFF,0xAC,0xB4,0xFF,0x09,0xA4,0xFF,0x67,0x8B,0xFF,0xE6,0x7A,0xFF,0xA5,0x72,0xFF,0xA5,0x6A,0xFF,0xA5,0x6A,0xFF,0x85,0x6A,0xFF,0x65,0x62,0xFF,0x65,0x62,0xFF,0x45,0x5A,0xFF,0x24,0x5A,0xFF,0x24,0x5A,0xFF,0x25,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xC4,0x49,0xFF,0xC3,0x41,0xFF,
-    0xA3,0x41,0xFF,0x83,0x39,0xFF,0x42,0x31,0xFF,0x42,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x03,0x21,0xFF,0x08,0x3A,0xFF,0xE8,0x31,0xFF,0xE8,0x39,0xFF,0xC8,0x31,0xFF,0xC8,0x31,0xFF,0xA7,0x31,0xFF,0x86,0x31,0xFF,0x44,0x29,0xFF,0x23,0x31,0xFF,0x23,0x39,0xFF,0xC0,0x38,0xFF,0x01,0x41,0xFF,0x62,0x51,0xFF,0xA3,0x61,0xFF,0xA2,0x61,0xFF,0x04,0x72,0xFF,0xE3,0x71,0xFF,0xE3,0x71,0xFF,0xC3,0x71,0xFF,0xE3,0x71,0xFF,0x43,0x82,0xFF,0x64,0x8A,0xFF,0x63,0x8A,0xFF,0xE4,0x9A,0xFF,0xC7,0xB3,0xFF,
-    0x65,0xAB,0xFF,0xC3,0x9A,0xFF,0x04,0x9B,0xFF,0xA5,0xB3,0xFF,0x47,0xC4,0xFF,0x29,0xD5,0xFF,0x0C,0xE6,0xFF,0xCC,0xDD,0xFF,0x0A,0xCD,0xFF,0x47,0xB4,0xFF,0xC6,0xA3,0xFF,0x07,0xAC,0xFF,0xE7,0xA3,0xFF,0x25,0x8B,0xFF,0xC3,0x82,0xFF,0x63,0x7A,0xFF,0x62,0x7A,0xFF,0x41,0x72,0xFF,0x20,0x72,0xFF,0x41,0x7A,0xFF,0xA2,0x82,0xFF,0x04,0x93,0xFF,0x04,0x93,0xFF,0x24,0x9B,0xFF,0x44,0x9B,0xFF,0x85,0xAB,0xFF,0xE6,0xB3,0xFF,0x66,0xBC,0xFF,0xE9,0xED,0xFF,0x08,0xEE,0xFF,0x49,0xF6,0xFF,0x49,0xF6,0xFF,0x69,0xF6,0xFF,0x49,0xF6,0xFF,0x09,0xEE,0xFF,0x4A,0xEE,0xFF,0x6B,0xEE,0xFF,0x2A,0xEE,0xFF,0x2A,0xEE,0xFF,0x4A,0xEE,0xFF,0x2A,0xEE,0xFF,0x6B,0xF6,0xFF,0x6B,0xEE,0xFF,0xCC,0xF6,0xFF,0x8C,0xEE,0xFF,0xAC,0xEE,0xFF,0x4E,0xF7,0xFF,0x4D,0xF7,0xFF,0x2C,0xF7,0xFF,0x4D,0xF7,0xFF,0x8F,0xF7,0xFF,0x90,0xF7,0xFF,0x90,0xFF,0xFF,0x91,0xF7,0xFF,0xB1,0xF7,0xFF,0x70,0xF7,0xFF,0x70,0xF7,0xFF,0x6F,0xF7,0xFF,0x50,0xF7,0xFF,0xB3,0xFF,0xFF,0xD3,0xFF,0xFF,0xD3,0xFF,0xFF,0x2F,0xF7,0xFF,0xAC,0xEE,0xFF,
-    0x6C,0xE6,0xFF,0x6D,0xE6,0xFF,0xAE,0xE6,0xFF,0xCF,0xEE,0xFF,0xEF,0xEE,0xFF,0x0E,0xF7,0xFF,0xED,0xEE,0xFF,0x4A,0xE6,0xFF,0x67,0xD5,0xFF,0x86,0xDD,0xFF,0x28,0xEE,0xFF,0xCA,0xF6,0xFF,0xCC,0xEE,0xFF,0x2E,0xF7,0xFF,0x2E,0xF7,0xFF,0x2E,0xF7,0xFF,0x0D,0xF7,0xFF,0xAC,0xF6,0xFF,0x29,0xE6,0xFF,0xC8,0xE5,0xFF,0x47,0xDD,0xFF,0x88,0xDD,0xFF,0xAD,0xF6,0xFF,0x0E,0xFF,0xFF,0x0E,0xF7,0xFF,0x0F,0xF7,0xFF,0x71,0xFF,0xFF,0x11,0xEF,0xFF,0xAD,0xD5,0xFF,0x2C,0xCD,0xFF,0x4E,0xD5,0xFF,0x6E,0xD5,0xFF,0x2D,0xCD,0xFF,0xED,0xBC,0xFF,0x2B,0xA4,0xFF,0x07,0x7B,0xFF,0x84,0x6A,0xFF,0x64,0x62,0xFF,0x65,0x62,0xFF,0x65,0x62,0xFF,0x45,0x62,0xFF,0x45,0x5A,0xFF,0x25,0x5A,0xFF,0x24,0x52,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0xC3,0x49,0xFF,0xA3,0x41,0xFF,0x83,0x41,0xFF,0x62,0x39,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,
-    0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xC2,0x18,0xFF,0xE7,0x39,0xFF,0xE8,0x39,0xFF,0xC8,0x31,0xFF,0xC8,0x31,0xFF,0xE9,0x39,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0x44,0x31,0xFF,0x02,0x31,0xFF,0xC1,0x30,0xFF,0xC0,0x30,0xFF,0x01,0x41,0xFF,0xA3,0x61,0xFF,0xA2,0x61,0xFF,0x82,0x61,0xFF,0xA2,0x69,0xFF,0xA2,0x69,0xFF,0xC3,0x71,0xFF,0xE2,0x71,0xFF,0xE2,0x71,0xFF,0x22,0x7A,0xFF,0x63,0x82,0xFF,0x05,0x93,0xFF,0xA7,0xAB,0xFF,0x49,0xBC,0xFF,0xA9,0xC4,0xFF,0x6A,0xBC,0xFF,0x29,0xB4,0xFF,0xC7,0xAB,0xFF,0x66,0x9B,0xFF,0x66,0x93,0xFF,0x66,0x93,0xFF,0xC5,0x7A,0xFF,0x63,0x72,0xFF,0x22,0x6A,0xFF,0x02,0x6A,0xFF,0xA1,0x61,0xFF,0x80,0x59,0xFF,0xA1,0x59,0xFF,0xC1,0x61,0xFF,0xC1,0x61,0xFF,
-    0xC0,0x61,0xFF,0x84,0x7A,0xFF,0x87,0x9B,0xFF,0x49,0xB4,0xFF,0x69,0xBC,0xFF,0xA5,0xAB,0xFF,0x44,0xA3,0xFF,0x64,0xAB,0xFF,0xA4,0xB3,0xFF,0xA4,0xB3,0xFF,0xA4,0xB3,0xFF,0xA3,0xB3,0xFF,0xC6,0xD4,0xFF,0xC7,0xED,0xFF,0x08,0xEE,0xFF,0x29,0xEE,0xFF,0x49,0xEE,0xFF,0x6A,0xEE,0xFF,0xAC,0xF6,0xFF,0xED,0xF6,0xFF,0xCC,0xF6,0xFF,0xCC,0xF6,0xFF,0xAC,0xF6,0xFF,0xAC,0xF6,0xFF,0x8C,0xEE,0xFF,0x6B,0xEE,0xFF,0x2A,0xEE,0xFF,0x0A,0xE6,0xFF,0xA8,0xDD,0xFF,0xE9,0xE5,0xFF,0x2D,0xF7,0xFF,0x6D,0xF7,0xFF,0x4D,0xF7,0xFF,0x8E,0xFF,0xFF,0x90,0xFF,0xFF,0x6F,0xF7,0xFF,0x90,0xF7,0xFF,0x91,0xF7,0xFF,0xB2,0xFF,0xFF,0xB2,0xFF,0xFF,0x90,0xFF,0xFF,0x0D,0xEF,0xFF,0x0E,0xEF,0xFF,0xB2,0xFF,0xFF,0xB3,0xFF,0xFF,0xB2,0xFF,0xFF,0x71,0xF7,0xFF,0x90,0xF7,0xFF,0x90,0xFF,0xFF,0xB1,0xFF,0xFF,0xB1,0xFF,0xFF,0xB1,0xFF,0xFF,0x90,0xFF,0xFF,0x6F,0xF7,0xFF,0x0E,0xEF,0xFF,0xCA,0xD5,0xFF,0x85,0xBC,0xFF,0x05,0xCD,0xFF,0xE7,0xE5,0xFF,0xA9,0xF6,0xFF,0x0B,0xF7,0xFF,0x2D,0xFF,0xFF,0x6E,0xFF,0xFF,0x8E,0xFF,0xFF,
-    0x2D,0xF7,0xFF,0xCB,0xF6,0xFF,0xAA,0xF6,0xFF,0x87,0xDD,0xFF,0xE8,0xED,0xFF,0x66,0xD5,0xFF,0x06,0xCD,0xFF,0x2A,0xE6,0xFF,0xCC,0xF6,0xFF,0xAC,0xEE,0xFF,0x0F,0xF7,0xFF,0x50,0xFF,0xFF,0x10,0xF7,0xFF,0x6B,0xCD,0xFF,0x48,0xB4,0xFF,0x0C,0xCD,0xFF,0x6E,0xD5,0xFF,0x8F,0xD5,0xFF,0xAF,0xD5,0xFF,0x4F,0xCD,0xFF,0xCD,0xBC,0xFF,0x0B,0x9C,0xFF,0x69,0x8B,0xFF,0xA6,0x6A,0xFF,0x24,0x5A,0xFF,0x03,0x52,0xFF,0x24,0x52,0xFF,0x24,0x52,0xFF,0x04,0x52,0xFF,0xC4,0x49,0xFF,0xC4,0x41,0xFF,0xA3,0x41,0xFF,0x83,0x39,0xFF,0x63,0x31,0xFF,0x42,0x31,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,
-    0x61,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA0,0x18,0xFF,0xA6,0x31,0xFF,0xE8,0x39,0xFF,0xA7,0x31,0xFF,0xC8,0x31,0xFF,0xE8,0x39,0xFF,0x08,0x42,0xFF,0xE7,0x41,0xFF,0x03,0x21,0xFF,0xA1,0x20,0xFF,0xE1,0x30,0xFF,0xC0,0x38,0xFF,0x83,0x51,0xFF,0xC3,0x61,0xFF,0xC2,0x69,0xFF,0x23,0x72,0xFF,0x03,0x72,0xFF,0x44,0x82,0xFF,0x84,0x82,0xFF,0xA5,0x8A,0xFF,0xC6,0x8A,0xFF,0x68,0x9B,0xFF,0xEA,0xAB,0xFF,0x0A,0xAC,0xFF,0xA9,0x9B,0xFF,0x27,0x8B,0xFF,0x85,0x7A,0xFF,0xE3,0x61,0xFF,0x40,0x51,0xFF,0xE0,0x50,0xFF,0xE0,0x50,0xFF,0xA0,0x50,0xFF,0x00,0x51,0xFF,0x61,0x51,0xFF,0x82,0x51,0xFF,0xE3,0x59,0xFF,0xE3,0x61,0xFF,0xA2,0x59,0xFF,0xA2,0x59,0xFF,0x03,0x62,0xFF,0x23,0x6A,0xFF,0xC5,0x82,0xFF,0x29,0xB4,0xFF,0xAA,0xC4,0xFF,0x89,0xC4,0xFF,0x27,0xBC,0xFF,0x06,0xBC,0xFF,0x86,0xC4,0xFF,0x48,0xD5,0xFF,0x07,0xD5,0xFF,0xE7,0xDC,0xFF,0xE6,0xD4,0xFF,0x07,0xDD,0xFF,0xE6,0xD4,0xFF,0xA5,0xCC,0xFF,0x06,0xDD,0xFF,0x46,0xDD,0xFF,0x09,0xEE,0xFF,
-    0xAB,0xF6,0xFF,0xEC,0xF6,0xFF,0xCC,0xF6,0xFF,0xAB,0xF6,0xFF,0x6A,0xEE,0xFF,0x8A,0xF6,0xFF,0xAA,0xF6,0xFF,0xCB,0xF6,0xFF,0xCB,0xF6,0xFF,0xCC,0xF6,0xFF,0xAB,0xF6,0xFF,0xCC,0xF6,0xFF,0x8B,0xEE,0xFF,0x87,0xDD,0xFF,0x29,0xE6,0xFF,0x2D,0xF7,0xFF,0x6E,0xFF,0xFF,0x8F,0xF7,0xFF,0xB1,0xF7,0xFF,0x91,0xF7,0xFF,0xD2,0xFF,0xFF,0xD3,0xFF,0xFF,0xF4,0xFF,0xFF,0xD3,0xFF,0xFF,0x91,0xF7,0xFF,0xEE,0xEE,0xFF,0x2F,0xEF,0xFF,0x71,0xF7,0xFF,0x91,0xF7,0xFF,0xD4,0xFF,0xFF,0x92,0xF7,0xFF,0xB2,0xFF,0xFF,0xB2,0xFF,0xFF,0xB1,0xFF,0xFF,0x91,0xF7,0xFF,0x90,0xF7,0xFF,0xB0,0xFF,0xFF,0x6F,0xF7,0xFF,0x8F,0xFF,0xFF,0x6F,0xFF,0xFF,0xED,0xF6,0xFF,0xEC,0xF6,0xFF,0x0B,0xF7,0xFF,0x48,0xEE,0xFF,0x28,0xEE,0xFF,0x28,0xEE,0xFF,0xE7,0xE5,0xFF,0x08,0xE6,0xFF,0x29,0xEE,0xFF,0x28,0xEE,0xFF,0xC7,0xE5,0xFF,0xC4,0xCC,0xFF,0x48,0xEE,0xFF,0xEB,0xFE,0xFF,0xCC,0xF6,0xFF,0x2B,0xE6,0xFF,0x0A,0xDE,0xFF,0x6B,0xEE,0xFF,0x4A,0xE6,0xFF,0x8C,0xEE,0xFF,0xED,0xF6,0xFF,0xEE,0xF6,0xFF,0x4A,0xCD,0xFF,0xC5,0xAB,0xFF,
-    0x68,0xBC,0xFF,0xCB,0xC4,0xFF,0x2C,0xCD,0xFF,0x4D,0xD5,0xFF,0x6E,0xD5,0xFF,0x4F,0xCD,0xFF,0x4F,0xCD,0xFF,0x2F,0xC5,0xFF,0x8D,0xAC,0xFF,0x69,0x8B,0xFF,0x65,0x62,0xFF,0xC3,0x49,0xFF,0xA3,0x41,0xFF,0xA3,0x41,0xFF,0xA4,0x41,0xFF,0x84,0x39,0xFF,0x83,0x39,0xFF,0x63,0x31,0xFF,0x43,0x31,0xFF,0x23,0x29,0xFF,0x22,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA0,0x18,0xFF,0x45,0x29,0xFF,0xE8,0x39,0xFF,0xA7,0x29,0xFF,0x87,0x29,0xFF,0xC7,0x39,0xFF,0x28,0x4A,0xFF,0x85,0x39,0xFF,0x80,0x18,0xFF,0xC1,0x28,0xFF,
-    0xA0,0x30,0xFF,0x42,0x49,0xFF,0xC3,0x59,0xFF,0xE3,0x69,0xFF,0x65,0x7A,0xFF,0xA5,0x82,0xFF,0x64,0x7A,0xFF,0x07,0x8B,0xFF,0x27,0x93,0xFF,0x85,0x7A,0xFF,0x04,0x62,0xFF,0x83,0x51,0xFF,0xC0,0x38,0xFF,0x00,0x18,0xFF,0x00,0x28,0xFF,0x00,0x38,0xFF,0xA0,0x40,0xFF,0xE4,0x61,0xFF,0x86,0x72,0xFF,0x68,0x93,0xFF,0xA9,0x9B,0xFF,0x6C,0xB4,0xFF,0x8D,0xB4,0xFF,0x45,0x6A,0xFF,0x45,0x6A,0xFF,0x45,0x6A,0xFF,0x45,0x6A,0xFF,0x45,0x6A,0xFF,0x85,0x72,0xFF,0xA5,0x82,0xFF,0xE5,0x92,0xFF,0x86,0xAB,0xFF,0xA6,0xB3,0xFF,0x84,0xB3,0xFF,0x83,0xB3,0xFF,0xC4,0xBB,0xFF,0x86,0xD4,0xFF,0x67,0xE5,0xFF,0x88,0xE5,0xFF,0x06,0xDD,0xFF,0x05,0xDD,0xFF,0x46,0xE5,0xFF,0x46,0xE5,0xFF,0x46,0xE5,0xFF,0x46,0xE5,0xFF,0x26,0xDD,0xFF,0x27,0xDD,0xFF,0x09,0xEE,0xFF,0x0C,0xFF,0xFF,0x8A,0xEE,0xFF,0x89,0xF6,0xFF,0x69,0xF6,0xFF,0x89,0xF6,0xFF,0x69,0xF6,0xFF,0x8A,0xF6,0xFF,0xAA,0xF6,0xFF,0x8A,0xEE,0xFF,0x2D,0xF7,0xFF,0x4E,0xFF,0xFF,0xEC,0xF6,0xFF,0x2E,0xF7,0xFF,0x09,0xE6,0xFF,0xE8,0xDD,0xFF,0xC8,0xD5,0xFF,
-    0x8C,0xE6,0xFF,0x91,0xF7,0xFF,0xB3,0xFF,0xFF,0xB3,0xFF,0xFF,0xB3,0xF7,0xFF,0xB3,0xF7,0xFF,0xB3,0xF7,0xFF,0x93,0xF7,0xFF,0xB3,0xFF,0xFF,0xD3,0xFF,0xFF,0xB2,0xFF,0xFF,0x4F,0xEF,0xFF,0x92,0xF7,0xFF,0xF5,0xFF,0xFF,0xB3,0xF7,0xFF,0xB3,0xFF,0xFF,0xB2,0xF7,0xFF,0x91,0xF7,0xFF,0x91,0xF7,0xFF,0x70,0xF7,0xFF,0x70,0xF7,0xFF,0x90,0xF7,0xFF,0x4F,0xF7,0xFF,0x8F,0xFF,0xFF,0x4E,0xF7,0xFF,0xAB,0xEE,0xFF,0xCA,0xEE,0xFF,0xCA,0xF6,0xFF,0x89,0xF6,0xFF,0x69,0xF6,0xFF,0x29,0xEE,0xFF,0xE8,0xE5,0xFF,0xA8,0xE5,0xFF,0xE6,0xCC,0xFF,0x63,0xC4,0xFF,0xC8,0xE5,0xFF,0x4A,0xEE,0xFF,0x09,0xE6,0xFF,0x0A,0xDE,0xFF,0xCD,0xF6,0xFF,0x4F,0xFF,0xFF,0xEE,0xF6,0xFF,0x0B,0xE6,0xFF,0x47,0xD5,0xFF,0xA8,0xDD,0xFF,0x2A,0xEE,0xFF,0xEB,0xED,0xFF,0xE5,0xB3,0xFF,0x84,0xAB,0xFF,0x05,0xB4,0xFF,0x26,0xB4,0xFF,0x27,0xB4,0xFF,0xAA,0xBC,0xFF,0x4D,0xCD,0xFF,0x8F,0xD5,0xFF,0x90,0xD5,0xFF,0x90,0xD5,0xFF,0x70,0xCD,0xFF,0x0F,0xC5,0xFF,0x8D,0xAC,0xFF,0xCB,0x8B,0xFF,0xA7,0x6A,0xFF,0xC4,0x49,0xFF,0x21,0x31,0xFF,
-    0x22,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xE2,0x18,0xFF,0xA6,0x31,0xFF,0xA7,0x29,0xFF,0x87,0x31,0xFF,0x08,0x42,0xFF,0xA5,0x39,0xFF,0xA0,0x20,0xFF,0xE2,0x30,0xFF,0xC1,0x28,0xFF,0xE1,0x30,0xFF,0x83,0x49,0xFF,0x62,0x49,0xFF,0x62,0x49,0xFF,0x42,0x49,0xFF,0x22,0x41,0xFF,0x22,0x41,0xFF,0x01,0x41,0xFF,0x01,0x41,0xFF,0x01,0x41,0xFF,0x01,0x41,0xFF,0x83,0x49,0xFF,0x46,0x62,0xFF,0x88,0x6A,0xFF,0xC8,0x72,0xFF,0xCB,0x93,0xFF,
-    0xCE,0xB4,0xFF,0x0F,0xBD,0xFF,0x0B,0xA4,0xFF,0xCA,0x9B,0xFF,0xCA,0x9B,0xFF,0x89,0x93,0xFF,0x07,0x83,0xFF,0x24,0x6A,0xFF,0x65,0x72,0xFF,0x64,0x7A,0xFF,0x84,0x7A,0xFF,0xE5,0x8A,0xFF,0xE5,0x92,0xFF,0xC4,0x92,0xFF,0xE4,0x9A,0xFF,0xE3,0x9A,0xFF,0x23,0xA3,0xFF,0x84,0xB3,0xFF,0xA4,0xBB,0xFF,0xA4,0xB3,0xFF,0xC7,0xD4,0xFF,0xE6,0xD4,0xFF,0xA5,0xD4,0xFF,0xE6,0xDC,0xFF,0x26,0xDD,0xFF,0x47,0xDD,0xFF,0x47,0xDD,0xFF,0x88,0xE5,0xFF,0xE9,0xED,0xFF,0x2A,0xEE,0xFF,0x47,0xDD,0xFF,0x85,0xC4,0xFF,0x6A,0xEE,0xFF,0xAA,0xF6,0xFF,0x8A,0xF6,0xFF,0x49,0xEE,0xFF,0x69,0xF6,0xFF,0x69,0xEE,0xFF,0x6A,0xF6,0xFF,0xAA,0xF6,0xFF,0x0D,0xF7,0xFF,0x6F,0xFF,0xFF,0x6F,0xFF,0xFF,0x4E,0xF7,0xFF,0x2D,0xF7,0xFF,0x2E,0xF7,0xFF,0x6F,0xFF,0xFF,0x50,0xF7,0xFF,0x91,0xF7,0xFF,0xB2,0xF7,0xFF,0xB3,0xF7,0xFF,0xD4,0xFF,0xFF,0xD4,0xFF,0xFF,0xB4,0xF7,0xFF,0x93,0xF7,0xFF,0xD5,0xFF,0xFF,0xB4,0xFF,0xFF,0xB3,0xF7,0xFF,0x92,0xF7,0xFF,0x91,0xF7,0xFF,0xB3,0xF7,0xFF,0xF5,0xFF,0xFF,0xD4,0xFF,0xFF,0xB3,0xFF,0xFF,
-    0x92,0xF7,0xFF,0x91,0xF7,0xFF,0xB2,0xFF,0xFF,0xB3,0xFF,0xFF,0xB1,0xFF,0xFF,0x2F,0xEF,0xFF,0x2E,0xEF,0xFF,0x4E,0xF7,0xFF,0x4E,0xF7,0xFF,0x2D,0xF7,0xFF,0x0B,0xFF,0xFF,0xCA,0xF6,0xFF,0x69,0xEE,0xFF,0x89,0xEE,0xFF,0x69,0xEE,0xFF,0xAA,0xF6,0xFF,0xAA,0xF6,0xFF,0xAB,0xF6,0xFF,0x6A,0xEE,0xFF,0xAB,0xF6,0xFF,0xEC,0xF6,0xFF,0x0D,0xFF,0xFF,0x2C,0xE6,0xFF,0xA3,0xA3,0xFF,0x09,0xC5,0xFF,0x2D,0xE6,0xFF,0xCE,0xF6,0xFF,0xCE,0xF6,0xFF,0x0C,0xE6,0xFF,0x29,0xCD,0xFF,0x25,0xBC,0xFF,0x63,0xAB,0xFF,0x68,0xB4,0xFF,0x4E,0xE6,0xFF,0x6E,0xEE,0xFF,0xEC,0xDD,0xFF,0x2A,0xCD,0xFF,0xA8,0xC4,0xFF,0x48,0xB4,0xFF,0x8B,0xBC,0xFF,0x4E,0xD5,0xFF,0xAF,0xDD,0xFF,0xB0,0xDD,0xFF,0x90,0xD5,0xFF,0x4F,0xCD,0xFF,0xEE,0xBC,0xFF,0x6D,0xAC,0xFF,0xAB,0x93,0xFF,0xC8,0x6A,0xFF,0xC4,0x49,0xFF,0x22,0x29,0xFF,0xC1,0x20,0xFF,0xE2,0x20,0xFF,0x02,0x21,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,
-    0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0xC2,0x18,0xFF,0xA5,0x39,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x86,0x29,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0x85,0x39,0xFF,0x02,0x29,0xFF,0xE2,0x28,0xFF,0xC1,0x28,0xFF,0xE2,0x30,0xFF,0x02,0x31,0xFF,0x02,0x31,0xFF,0xE1,0x30,0xFF,0xC0,0x28,0xFF,0xC0,0x28,0xFF,0xE1,0x30,0xFF,0x02,0x31,0xFF,0x03,0x39,0xFF,0x43,0x39,0xFF,0x64,0x41,0xFF,0x67,0x62,0xFF,0x4A,0x83,0xFF,0xCB,0x93,0xFF,0xCC,0x93,0xFF,0xE8,0x7A,0xFF,0xC8,0x7A,0xFF,0xC7,0x7A,0xFF,0x04,0x62,0xFF,0xC2,0x61,0xFF,0xE2,0x69,0xFF,0x22,0x72,0xFF,0x42,0x72,0xFF,0xA4,0x82,0xFF,0xE5,0x8A,0xFF,0x46,0x93,0xFF,0xE8,0xAB,0xFF,0x69,0xBC,0xFF,0x08,0xB4,0xFF,0x25,0xA3,0xFF,0x45,0xA3,0xFF,0x24,0xA3,0xFF,0x44,0xAB,0xFF,
-    0x44,0xAB,0xFF,0x44,0xAB,0xFF,0xE3,0x9A,0xFF,0xA2,0x92,0xFF,0xA5,0xB3,0xFF,0x26,0xC4,0xFF,0x45,0xC4,0xFF,0xC7,0xD4,0xFF,0x28,0xDD,0xFF,0x48,0xDD,0xFF,0x07,0xD5,0xFF,0x07,0xDD,0xFF,0x27,0xDD,0xFF,0xE6,0xD4,0xFF,0x04,0xC4,0xFF,0x83,0xB3,0xFF,0x04,0xBC,0xFF,0x88,0xDD,0xFF,0x4A,0xEE,0xFF,0x6A,0xF6,0xFF,0x8A,0xF6,0xFF,0xAA,0xF6,0xFF,0xAA,0xF6,0xFF,0xCB,0xF6,0xFF,0xEC,0xF6,0xFF,0x0D,0xFF,0xFF,0x0D,0xF7,0xFF,0xCC,0xF6,0xFF,0xEC,0xF6,0xFF,0x6F,0xFF,0xFF,0x2F,0xEF,0xFF,0xD2,0xFF,0xFF,0x71,0xF7,0xFF,0xB2,0xF7,0xFF,0xB3,0xF7,0xFF,0xD5,0xFF,0xFF,0xD5,0xF7,0xFF,0xB4,0xFF,0xFF,0xB4,0xF7,0xFF,0xF6,0xFF,0xFF,0xF6,0xFF,0xFF,0xB3,0xF7,0xFF,0x92,0xF7,0xFF,0x91,0xF7,0xFF,0xB2,0xFF,0xFF,0xF5,0xFF,0xFF,0x93,0xF7,0xFF,0xD4,0xFF,0xFF,0xD4,0xFF,0xFF,0xD3,0xFF,0xFF,0x92,0xF7,0xFF,0xD3,0xFF,0xFF,0xB1,0xFF,0xFF,0x4F,0xF7,0xFF,0x2E,0xF7,0xFF,0x4E,0xF7,0xFF,0x4F,0xF7,0xFF,0x0C,0xF7,0xFF,0x0B,0xF7,0xFF,0x0B,0xF7,0xFF,0xAA,0xF6,0xFF,0xEB,0xF6,0xFF,0xCB,0xF6,0xFF,0xCB,0xF6,0xFF,
-    0x8A,0xEE,0xFF,0xCB,0xF6,0xFF,0xCB,0xF6,0xFF,0xEC,0xF6,0xFF,0xED,0xF6,0xFF,0x8A,0xD5,0xFF,0x29,0xCD,0xFF,0xCB,0xD5,0xFF,0xEB,0xDD,0xFF,0xAA,0xDD,0xFF,0x28,0xCD,0xFF,0x8A,0xD5,0xFF,0x6D,0xEE,0xFF,0xCE,0xF6,0xFF,0x6C,0xEE,0xFF,0xAA,0xE5,0xFF,0x4D,0xEE,0xFF,0x50,0xFF,0xFF,0xCE,0xEE,0xFF,0x6D,0xEE,0xFF,0x8E,0xEE,0xFF,0x8E,0xEE,0xFF,0xEC,0xE5,0xFF,0x87,0xBC,0xFF,0x64,0xA3,0xFF,0x68,0xC4,0xFF,0x0B,0xD5,0xFF,0x2D,0xD5,0xFF,0x8E,0xDD,0xFF,0x8F,0xD5,0xFF,0x2E,0xCD,0xFF,0xAD,0xBC,0xFF,0x4D,0xAC,0xFF,0x0C,0xA4,0xFF,0xAB,0x8B,0xFF,0xE9,0x72,0xFF,0xE5,0x49,0xFF,0xC1,0x20,0xFF,0x60,0x18,0xFF,0xA1,0x18,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0xC1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,
-    0xA1,0x18,0xFF,0x64,0x31,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x44,0x29,0xFF,0xE8,0x39,0xFF,0xC6,0x39,0xFF,0x23,0x29,0xFF,0x02,0x29,0xFF,0x02,0x29,0xFF,0xC1,0x20,0xFF,0xC1,0x20,0xFF,0xE2,0x28,0xFF,0xE2,0x28,0xFF,0x44,0x31,0xFF,0xA5,0x41,0xFF,0xE6,0x49,0xFF,0x03,0x31,0xFF,0xE6,0x49,0xFF,0x47,0x5A,0xFF,0x26,0x5A,0xFF,0x06,0x52,0xFF,0xC4,0x51,0xFF,0x83,0x51,0xFF,0x00,0x49,0xFF,0xA0,0x40,0xFF,0x00,0x49,0xFF,0x60,0x59,0xFF,0xE2,0x69,0xFF,0x84,0x82,0xFF,0x47,0x93,0xFF,0x67,0x9B,0xFF,0xA7,0xA3,0xFF,0x4A,0xBC,0xFF,0x8A,0xC4,0xFF,0xAB,0xC4,0xFF,0x8A,0xC4,0xFF,0x08,0xB4,0xFF,0xC7,0xAB,0xFF,0xC7,0xB3,0xFF,0x06,0xBC,0xFF,0xE5,0xC3,0xFF,0xA4,0xBB,0xFF,0xA4,0xBB,0xFF,0xA4,0xBB,0xFF,0x03,0xA3,0xFF,0x00,0x82,0xFF,0x21,0x82,0xFF,0x01,0x7A,0xFF,0x62,0x8A,0xFF,0xC2,0x92,0xFF,0x23,0xA3,0xFF,0xE5,0xB3,0xFF,0x66,0xC4,0xFF,0x86,0xC4,0xFF,0x85,0xCC,0xFF,0x45,0xC4,0xFF,0xE3,0xBB,0xFF,0x21,0xAB,0xFF,0xC1,0x9A,0xFF,
-    0x62,0xAB,0xFF,0x66,0xBC,0xFF,0x27,0xCD,0xFF,0x88,0xDD,0xFF,0xA8,0xDD,0xFF,0x09,0xEE,0xFF,0xE8,0xE5,0xFF,0x09,0xEE,0xFF,0x08,0xEE,0xFF,0x87,0xDD,0xFF,0x25,0xD5,0xFF,0xE8,0xE5,0xFF,0xCC,0xF6,0xFF,0xA9,0xD5,0xFF,0x89,0xCD,0xFF,0xB1,0xFF,0xFF,0xB1,0xF7,0xFF,0x71,0xF7,0xFF,0xD4,0xFF,0xFF,0xD5,0xFF,0xFF,0xD6,0xFF,0xFF,0xB5,0xF7,0xFF,0x94,0xF7,0xFF,0xD5,0xFF,0xFF,0xD5,0xFF,0xFF,0xD4,0xFF,0xFF,0xB2,0xF7,0xFF,0xB1,0xFF,0xFF,0x2F,0xF7,0xFF,0xB4,0xFF,0xFF,0xB4,0xFF,0xFF,0xB4,0xF7,0xFF,0xD4,0xF7,0xFF,0xB3,0xF7,0xFF,0x91,0xF7,0xFF,0x91,0xF7,0xFF,0x70,0xF7,0xFF,0x4F,0xF7,0xFF,0x4F,0xF7,0xFF,0x4F,0xF7,0xFF,0x4F,0xF7,0xFF,0x6A,0xEE,0xFF,0xEB,0xF6,0xFF,0x0C,0xFF,0xFF,0xEB,0xF6,0xFF,0xEB,0xF6,0xFF,0xEC,0xF6,0xFF,0x0C,0xFF,0xFF,0xAB,0xF6,0xFF,0x8A,0xEE,0xFF,0xAB,0xF6,0xFF,0xCC,0xF6,0xFF,0x4B,0xE6,0xFF,0x86,0xC4,0xFF,0x8D,0xEE,0xFF,0x0E,0xFF,0xFF,0xED,0xF6,0xFF,0xED,0xFE,0xFF,0xCC,0xF6,0xFF,0x6B,0xEE,0xFF,0x0B,0xE6,0xFF,0xCA,0xDD,0xFF,0xC9,0xE5,0xFF,0xE6,0xD4,0xFF,
-    0x48,0xDD,0xFF,0x0E,0xF7,0xFF,0x10,0xF7,0xFF,0xCF,0xEE,0xFF,0x10,0xF7,0xFF,0xEF,0xF6,0xFF,0x8E,0xEE,0xFF,0x8E,0xEE,0xFF,0xCC,0xDD,0xFF,0xE6,0xB3,0xFF,0xC4,0xBB,0xFF,0x06,0xC4,0xFF,0x47,0xC4,0xFF,0xAA,0xC4,0xFF,0xEC,0xCC,0xFF,0xED,0xCC,0xFF,0xAD,0xC4,0xFF,0x6C,0xB4,0xFF,0x2C,0xAC,0xFF,0x2C,0xA4,0xFF,0xEC,0x9B,0xFF,0xAB,0x8B,0xFF,0x09,0x73,0xFF,0x26,0x52,0xFF,0x64,0x39,0xFF,0xA0,0x18,0xFF,0x60,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x40,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x24,0x29,0xFF,0x28,0x4A,0xFF,0x85,0x39,0xFF,0x44,0x31,0xFF,0x44,0x31,0xFF,0x65,0x31,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,
-    0x85,0x39,0xFF,0xE6,0x41,0xFF,0x07,0x4A,0xFF,0x27,0x52,0xFF,0xC6,0x49,0xFF,0x63,0x39,0xFF,0x83,0x49,0xFF,0xA3,0x51,0xFF,0xA2,0x51,0xFF,0xA2,0x59,0xFF,0x04,0x62,0xFF,0x85,0x7A,0xFF,0x07,0x8B,0xFF,0x68,0x93,0xFF,0xEA,0xA3,0xFF,0xEA,0xAB,0xFF,0xC9,0xA3,0xFF,0x0A,0xB4,0xFF,0x09,0xAC,0xFF,0x67,0x9B,0xFF,0x05,0x93,0xFF,0xC4,0x8A,0xFF,0x83,0x82,0xFF,0x20,0x7A,0xFF,0x62,0x82,0xFF,0xC7,0xB3,0xFF,0xC7,0xBB,0xFF,0x24,0xAB,0xFF,0x43,0xB3,0xFF,0x63,0xBB,0xFF,0x84,0xBB,0xFF,0x84,0xBB,0xFF,0x63,0xB3,0xFF,0x83,0xB3,0xFF,0x49,0xD5,0xFF,0x84,0xA3,0xFF,0x20,0x82,0xFF,0x42,0x82,0xFF,0x04,0x93,0xFF,0xE6,0xB3,0xFF,0xA7,0xCC,0xFF,0x07,0xD5,0xFF,0x27,0xDD,0xFF,0x67,0xE5,0xFF,0x87,0xE5,0xFF,0xC8,0xED,0xFF,0x26,0xDD,0xFF,0xA6,0xC4,0xFF,0xEA,0xE5,0xFF,0x8B,0xEE,0xFF,0xAB,0xF6,0xFF,0xAB,0xF6,0xFF,0x29,0xEE,0xFF,0x29,0xEE,0xFF,0x08,0xEE,0xFF,0x09,0xEE,0xFF,0x29,0xEE,0xFF,0x29,0xEE,0xFF,0xA8,0xE5,0xFF,0xE6,0xCC,0xFF,0xE5,0xCC,0xFF,0x06,0xCD,0xFF,0x68,0xD5,0xFF,0xED,0xF6,0xFF,
-    0x90,0xFF,0xFF,0x90,0xF7,0xFF,0x91,0xF7,0xFF,0xD4,0xFF,0xFF,0xF6,0xFF,0xFF,0xF7,0xFF,0xFF,0xF6,0xFF,0xFF,0xD5,0xF7,0xFF,0xD4,0xF7,0xFF,0xB3,0xF7,0xFF,0xB2,0xFF,0xFF,0x4F,0xF7,0xFF,0x88,0xD5,0xFF,0x2D,0xE6,0xFF,0xB3,0xFF,0xFF,0xD4,0xFF,0xFF,0x93,0xF7,0xFF,0x92,0xF7,0xFF,0x51,0xEF,0xFF,0x71,0xF7,0xFF,0x92,0xF7,0xFF,0x91,0xF7,0xFF,0xB1,0xFF,0xFF,0x90,0xFF,0xFF,0x8B,0xEE,0xFF,0x09,0xEE,0xFF,0xAB,0xF6,0xFF,0xEC,0xF6,0xFF,0xCB,0xEE,0xFF,0x0C,0xF7,0xFF,0xEC,0xF6,0xFF,0x6A,0xEE,0xFF,0x49,0xEE,0xFF,0x49,0xEE,0xFF,0xAB,0xF6,0xFF,0xEC,0xF6,0xFF,0xAC,0xF6,0xFF,0x07,0xCD,0xFF,0xEC,0xFE,0xFF,0x0D,0xF7,0xFF,0xEC,0xF6,0xFF,0xAB,0xF6,0xFF,0x8B,0xEE,0xFF,0x8B,0xEE,0xFF,0xCC,0xF6,0xFF,0xCD,0xF6,0xFF,0x4B,0xEE,0xFF,0xC6,0xCC,0xFF,0xE5,0xD4,0xFF,0x4A,0xEE,0xFF,0xEE,0xF6,0xFF,0x30,0xF7,0xFF,0xEF,0xEE,0xFF,0x30,0xF7,0xFF,0xEF,0xF6,0xFF,0xAE,0xEE,0xFF,0xAE,0xF6,0xFF,0x0D,0xE6,0xFF,0xC6,0xAB,0xFF,0x84,0xB3,0xFF,0xC5,0xBB,0xFF,0x84,0xB3,0xFF,0x44,0xAB,0xFF,0x65,0xA3,0xFF,
-    0xE9,0xAB,0xFF,0x0A,0xB4,0xFF,0x0A,0xAC,0xFF,0x2C,0xAC,0xFF,0xAE,0xB4,0xFF,0xAE,0xB4,0xFF,0xAE,0xB4,0xFF,0x4E,0xA4,0xFF,0xEC,0x93,0xFF,0xE9,0x72,0xFF,0x27,0x52,0xFF,0x43,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA0,0x10,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x20,0xFF,0x43,0x31,0xFF,0xA9,0x5A,0xFF,0x27,0x4A,0xFF,0x07,0x4A,0xFF,0xA6,0x39,0xFF,0x85,0x39,0xFF,0x44,0x39,0xFF,0x43,0x39,0xFF,0x63,0x41,0xFF,0xA3,0x49,0xFF,0xE4,0x51,0xFF,0x25,0x5A,0xFF,0xA7,0x72,0xFF,0x69,0x8B,0xFF,0xCA,0x93,0xFF,0xCA,0x9B,0xFF,0x0B,0xA4,0xFF,0x0B,0xAC,0xFF,0xEA,0xA3,0xFF,0xC9,0xA3,0xFF,0x88,0x9B,0xFF,0x67,0x9B,0xFF,0x06,0x93,0xFF,
-    0x84,0x82,0xFF,0x02,0x72,0xFF,0x02,0x72,0xFF,0x02,0x7A,0xFF,0x23,0x7A,0xFF,0xE2,0x71,0xFF,0xA1,0x69,0xFF,0x84,0x8A,0xFF,0xE7,0xBB,0xFF,0x65,0xB3,0xFF,0xA1,0xA2,0xFF,0xE2,0xAA,0xFF,0x84,0xBB,0xFF,0x64,0xBB,0xFF,0x22,0xAB,0xFF,0x63,0xB3,0xFF,0x05,0xBC,0xFF,0x2B,0xE6,0xFF,0x4C,0xEE,0xFF,0x84,0xAB,0xFF,0xE8,0xCC,0xFF,0x69,0xE5,0xFF,0x68,0xE5,0xFF,0x47,0xE5,0xFF,0x26,0xDD,0xFF,0x26,0xDD,0xFF,0x05,0xDD,0xFF,0x67,0xE5,0xFF,0x46,0xDD,0xFF,0x09,0xEE,0xFF,0x29,0xEE,0xFF,0x8A,0xF6,0xFF,0x49,0xEE,0xFF,0x69,0xEE,0xFF,0xAA,0xF6,0xFF,0x49,0xEE,0xFF,0x28,0xEE,0xFF,0x08,0xEE,0xFF,0x29,0xEE,0xFF,0x29,0xEE,0xFF,0x49,0xEE,0xFF,0x49,0xEE,0xFF,0x49,0xEE,0xFF,0x2A,0xEE,0xFF,0x4A,0xEE,0xFF,0x0D,0xFF,0xFF,0x8B,0xEE,0xFF,0x67,0xD5,0xFF,0xAC,0xF6,0xFF,0x0E,0xF7,0xFF,0x4F,0xF7,0xFF,0x92,0xF7,0xFF,0xD4,0xFF,0xFF,0xF6,0xFF,0xFF,0xF6,0xFF,0xFF,0xF5,0xFF,0xFF,0xB3,0xFF,0xFF,0x91,0xFF,0xFF,0xEE,0xF6,0xFF,0x89,0xD5,0xFF,0x80,0xAB,0xFF,0xA5,0xC4,0xFF,0xEA,0xE5,0xFF,0xAD,0xEE,0xFF,
-    0x0F,0xF7,0xFF,0x51,0xF7,0xFF,0x92,0xFF,0xFF,0x92,0xFF,0xFF,0x92,0xFF,0xFF,0x50,0xF7,0xFF,0xCD,0xEE,0xFF,0xC9,0xD5,0xFF,0x03,0xAC,0xFF,0x88,0xDD,0xFF,0x8B,0xF6,0xFF,0xAB,0xF6,0xFF,0xEB,0xF6,0xFF,0xCB,0xF6,0xFF,0xCC,0xF6,0xFF,0xCB,0xF6,0xFF,0xAB,0xEE,0xFF,0xAB,0xF6,0xFF,0x8A,0xEE,0xFF,0x2D,0xFF,0xFF,0x4B,0xEE,0xFF,0x41,0xA3,0xFF,0x88,0xDD,0xFF,0x0D,0xFF,0xFF,0xED,0xF6,0xFF,0xAC,0xEE,0xFF,0xCD,0xEE,0xFF,0x0E,0xF7,0xFF,0x0E,0xF7,0xFF,0x0E,0xF7,0xFF,0xEE,0xF6,0xFF,0x6D,0xEE,0xFF,0x67,0xBC,0xFF,0x26,0xDD,0xFF,0x09,0xEE,0xFF,0x0E,0xF7,0xFF,0x71,0xFF,0xFF,0x10,0xF7,0xFF,0x10,0xF7,0xFF,0xCF,0xEE,0xFF,0xCE,0xEE,0xFF,0x8D,0xEE,0xFF,0xAC,0xDD,0xFF,0xE4,0x92,0xFF,0x82,0x92,0xFF,0xE4,0x9A,0xFF,0x04,0x9B,0xFF,0xE4,0x9A,0xFF,0xC3,0x92,0xFF,0x62,0x82,0xFF,0xA4,0x8A,0xFF,0xE5,0x8A,0xFF,0xA9,0x9B,0xFF,0x8D,0xB4,0xFF,0xCE,0xB4,0xFF,0x6E,0xAC,0xFF,0x6E,0xA4,0xFF,0x0D,0x9C,0xFF,0x6F,0xA4,0xFF,0xB0,0xA4,0xFF,0xB0,0xA4,0xFF,0xAD,0x83,0xFF,0x47,0x52,0xFF,0x00,0x00,0xFF,
-    0x40,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xC1,0x18,0xFF,0xC1,0x20,0xFF,0x43,0x29,0xFF,0x2B,0x6B,0xFF,0x2C,0x6B,0xFF,0x48,0x52,0xFF,0xC5,0x41,0xFF,0xA5,0x41,0xFF,0x84,0x41,0xFF,0x63,0x41,0xFF,0x83,0x49,0xFF,0x62,0x49,0xFF,0x46,0x6A,0xFF,0xCB,0x93,0xFF,0x0B,0xA4,0xFF,0xAA,0x93,0xFF,0x28,0x83,0xFF,0x85,0x72,0xFF,0x85,0x7A,0xFF,0x64,0x7A,0xFF,0x43,0x7A,0xFF,0x64,0x7A,0xFF,0x85,0x7A,0xFF,0x23,0x72,0xFF,0x03,0x72,0xFF,0xC2,0x69,0xFF,0xC2,0x71,0xFF,0xE2,0x79,0xFF,0xE2,0x79,0xFF,0x42,0x82,0xFF,0xE2,0x79,0xFF,0xC1,0x71,0xFF,0xE4,0x9A,0xFF,0xE3,0xA2,0xFF,0xA1,0xA2,0xFF,0xC3,0xAA,0xFF,0xC2,0xA2,0xFF,0x43,0xB3,0xFF,0xC5,0xBB,0xFF,0xE5,0xC3,0xFF,0x08,0xD5,0xFF,
-    0x2C,0xEE,0xFF,0x8A,0xD5,0xFF,0x03,0x93,0xFF,0xA5,0xB3,0xFF,0xC7,0xD4,0xFF,0x64,0xCC,0xFF,0xA5,0xD4,0xFF,0xA5,0xD4,0xFF,0xE5,0xD4,0xFF,0x67,0xE5,0xFF,0x67,0xE5,0xFF,0xA7,0xE5,0xFF,0xE9,0xED,0xFF,0xE9,0xE5,0xFF,0x8B,0xF6,0xFF,0x08,0xE6,0xFF,0x28,0xEE,0xFF,0x28,0xEE,0xFF,0x28,0xEE,0xFF,0x28,0xEE,0xFF,0xE7,0xE5,0xFF,0xE8,0xE5,0xFF,0x29,0xEE,0xFF,0x6A,0xEE,0xFF,0xAB,0xF6,0xFF,0x6A,0xEE,0xFF,0x29,0xEE,0xFF,0xEC,0xF6,0xFF,0x0D,0xFF,0xFF,0x0C,0xFF,0xFF,0x8B,0xF6,0xFF,0x64,0xC4,0xFF,0xA5,0xCC,0xFF,0xE9,0xE5,0xFF,0x8C,0xEE,0xFF,0x2F,0xF7,0xFF,0x71,0xFF,0xFF,0x72,0xF7,0xFF,0x51,0xF7,0xFF,0xEF,0xEE,0xFF,0x6D,0xE6,0xFF,0x0A,0xE6,0xFF,0x47,0xD5,0xFF,0x84,0xBC,0xFF,0xE6,0xCC,0xFF,0x44,0xBC,0xFF,0x44,0xC4,0xFF,0xA5,0xCC,0xFF,0xA5,0xC4,0xFF,0x07,0xC5,0xFF,0xAD,0xEE,0xFF,0x2F,0xF7,0xFF,0x0E,0xF7,0xFF,0xCD,0xEE,0xFF,0xCC,0xEE,0xFF,0x6B,0xEE,0xFF,0x69,0xCD,0xFF,0x46,0xB4,0xFF,0xE7,0xC4,0xFF,0x09,0xEE,0xFF,0x8A,0xF6,0xFF,0x8A,0xEE,0xFF,0x8A,0xEE,0xFF,0x6A,0xEE,0xFF,
-    0xCB,0xF6,0xFF,0xEC,0xF6,0xFF,0x0C,0xF7,0xFF,0xCC,0xF6,0xFF,0xA7,0xC4,0xFF,0xC0,0x81,0xFF,0x03,0xBC,0xFF,0x4A,0xEE,0xFF,0x4E,0xFF,0xFF,0x2F,0xF7,0xFF,0x70,0xFF,0xFF,0x30,0xF7,0xFF,0x70,0xFF,0xFF,0x30,0xF7,0xFF,0x0F,0xF7,0xFF,0x0F,0xF7,0xFF,0x6D,0xEE,0xFF,0xA7,0xC4,0xFF,0xE5,0xD4,0xFF,0x88,0xDD,0xFF,0xCE,0xEE,0xFF,0x71,0xFF,0xFF,0x51,0xF7,0xFF,0x8E,0xE6,0xFF,0x8E,0xE6,0xFF,0x8E,0xEE,0xFF,0x4D,0xEE,0xFF,0x0B,0xC5,0xFF,0xA0,0x69,0xFF,0x40,0x61,0xFF,0x20,0x59,0xFF,0x60,0x61,0xFF,0x64,0x82,0xFF,0xE7,0x92,0xFF,0xAA,0xA3,0xFF,0x4C,0xB4,0xFF,0x8D,0xBC,0xFF,0x8D,0xB4,0xFF,0xAE,0xB4,0xFF,0x8E,0xAC,0xFF,0x4D,0xA4,0xFF,0x4D,0x9C,0xFF,0x4E,0x9C,0xFF,0x6F,0xA4,0xFF,0xB4,0xC5,0xFF,0x36,0xD6,0xFF,0xB4,0xC5,0xFF,0x12,0xAD,0xFF,0x28,0x4A,0xFF,0x00,0x00,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,
-    0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xE1,0x20,0xFF,0x27,0x42,0xFF,0x89,0x52,0xFF,0x2C,0x63,0xFF,0x0B,0x63,0xFF,0x48,0x52,0xFF,0xE6,0x49,0xFF,0xC5,0x49,0xFF,0xC4,0x51,0xFF,0xE4,0x59,0xFF,0xC3,0x59,0xFF,0xA2,0x61,0xFF,0x03,0x6A,0xFF,0x23,0x72,0xFF,0x44,0x72,0xFF,0x64,0x7A,0xFF,0x64,0x7A,0xFF,0x85,0x82,0xFF,0x85,0x82,0xFF,0x64,0x7A,0xFF,0x02,0x72,0xFF,0x43,0x7A,0xFF,0x43,0x8A,0xFF,0x22,0x8A,0xFF,0x22,0x8A,0xFF,0x62,0x92,0xFF,0xA3,0x9A,0xFF,0x42,0x8A,0xFF,0x42,0x8A,0xFF,0x25,0x9B,0xFF,0x20,0x61,0xFF,0x22,0x82,0xFF,0x42,0x92,0xFF,0x01,0x92,0xFF,0x21,0x92,0xFF,0x82,0x9A,0xFF,0xC2,0xA2,0xFF,0x44,0xAB,0xFF,0x46,0xC4,0xFF,0x25,0xBC,0xFF,0x63,0xA3,0xFF,0xC2,0x92,0xFF,0x05,0xC4,0xFF,0x61,0xB3,0xFF,0x44,0xCC,0xFF,0x85,0xCC,0xFF,0xC5,0xD4,0xFF,0x06,0xDD,0xFF,0x26,0xDD,0xFF,0x67,0xDD,0xFF,0xA8,0xE5,0xFF,0x48,0xDD,0xFF,0xA6,0xC4,0xFF,0x6A,0xEE,0xFF,0x28,0xE6,0xFF,
-    0xA7,0xE5,0xFF,0x86,0xDD,0xFF,0xC7,0xE5,0xFF,0x87,0xDD,0xFF,0xE8,0xE5,0xFF,0x8A,0xF6,0xFF,0x8A,0xF6,0xFF,0xAB,0xF6,0xFF,0xAA,0xF6,0xFF,0xAB,0xF6,0xFF,0x8A,0xEE,0xFF,0x0D,0xFF,0xFF,0xAB,0xF6,0xFF,0x8A,0xEE,0xFF,0x6A,0xEE,0xFF,0xA9,0xDD,0xFF,0x82,0xAB,0xFF,0xE2,0xBB,0xFF,0xA4,0xCC,0xFF,0x47,0xDD,0xFF,0x88,0xDD,0xFF,0x68,0xD5,0xFF,0x68,0xD5,0xFF,0x68,0xD5,0xFF,0x48,0xCD,0xFF,0x48,0xCD,0xFF,0x89,0xD5,0xFF,0x8C,0xEE,0xFF,0x4F,0xFF,0xFF,0xCD,0xF6,0xFF,0xA5,0xC4,0xFF,0x20,0xA3,0xFF,0xE4,0xAB,0xFF,0x8C,0xEE,0xFF,0x6F,0xFF,0xFF,0x4E,0xF7,0xFF,0x4E,0xFF,0xFF,0x4D,0xF7,0xFF,0xEC,0xF6,0xFF,0xEB,0xF6,0xFF,0xEC,0xF6,0xFF,0xEC,0xF6,0xFF,0xCA,0xDD,0xFF,0x85,0xC4,0xFF,0x06,0xD5,0xFF,0x08,0xEE,0xFF,0x6A,0xF6,0xFF,0x6A,0xF6,0xFF,0xAB,0xF6,0xFF,0xAB,0xF6,0xFF,0x6A,0xEE,0xFF,0x47,0xD5,0xFF,0x25,0xBC,0xFF,0x43,0xAB,0xFF,0xC1,0x9A,0xFF,0x26,0xD5,0xFF,0x0A,0xE6,0xFF,0xEE,0xF6,0xFF,0xB2,0xFF,0xFF,0x71,0xF7,0xFF,0x0F,0xEF,0xFF,0x30,0xF7,0xFF,0x10,0xF7,0xFF,0x30,0xF7,0xFF,
-    0xCE,0xF6,0xFF,0x6C,0xEE,0xFF,0x08,0xCD,0xFF,0x60,0xAB,0xFF,0xC4,0xAB,0xFF,0x6B,0xCD,0xFF,0xD0,0xEE,0xFF,0x31,0xFF,0xFF,0xD0,0xEE,0xFF,0x10,0xF7,0xFF,0x4E,0xEE,0xFF,0xED,0xDD,0xFF,0xAA,0xC4,0xFF,0xEA,0xA3,0xFF,0xCB,0x9B,0xFF,0x6E,0xB4,0xFF,0xEF,0xC4,0xFF,0x0F,0xCD,0xFF,0x30,0xCD,0xFF,0x30,0xCD,0xFF,0x30,0xCD,0xFF,0x30,0xCD,0xFF,0x30,0xC5,0xFF,0x10,0xBD,0xFF,0x31,0xBD,0xFF,0x93,0xC5,0xFF,0xB4,0xC5,0xFF,0x73,0xC5,0xFF,0x53,0xBD,0xFF,0xF1,0xAC,0xFF,0x0E,0x94,0xFF,0x0E,0x94,0xFF,0x89,0x5A,0xFF,0x00,0x00,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xE1,0x20,0xFF,0x85,0x31,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0x8A,0x4A,0xFF,0x0C,0x63,0xFF,0x89,0x52,0xFF,
-    0xC6,0x41,0xFF,0x47,0x5A,0xFF,0x05,0x5A,0xFF,0xE4,0x59,0xFF,0xC3,0x59,0xFF,0xE3,0x61,0xFF,0x04,0x6A,0xFF,0x44,0x72,0xFF,0x64,0x7A,0xFF,0x43,0x7A,0xFF,0x23,0x72,0xFF,0x03,0x72,0xFF,0x02,0x7A,0xFF,0xC4,0x92,0xFF,0x65,0xAB,0xFF,0x24,0xAB,0xFF,0xA2,0xA2,0xFF,0xA2,0xA2,0xFF,0x03,0xA3,0xFF,0xA3,0x9A,0xFF,0xA0,0x81,0xFF,0x47,0xBC,0xFF,0x87,0xC4,0xFF,0x80,0x69,0xFF,0xA2,0x71,0xFF,0x22,0x8A,0xFF,0x42,0x92,0xFF,0xC3,0xA2,0xFF,0x03,0xA3,0xFF,0x03,0xAB,0xFF,0x23,0xB3,0xFF,0x01,0xAB,0xFF,0xE4,0xBB,0xFF,0xE7,0xCC,0xFF,0xE5,0xB3,0xFF,0xC4,0xB3,0xFF,0x87,0xC4,0xFF,0xE7,0xCC,0xFF,0xE6,0xCC,0xFF,0xE6,0xD4,0xFF,0x27,0xD5,0xFF,0x68,0xDD,0xFF,0x07,0xD5,0xFF,0x45,0xC4,0xFF,0x41,0xAB,0xFF,0x43,0xA3,0xFF,0x09,0xEE,0xFF,0x08,0xEE,0xFF,0x25,0xD5,0xFF,0x46,0xDD,0xFF,0x87,0xE5,0xFF,0xC8,0xE5,0xFF,0x49,0xEE,0xFF,0x6A,0xEE,0xFF,0x8A,0xEE,0xFF,0x6A,0xEE,0xFF,0x69,0xEE,0xFF,0x8A,0xEE,0xFF,0xCC,0xF6,0xFF,0xAB,0xF6,0xFF,0x8A,0xEE,0xFF,0xEC,0xF6,0xFF,0x0D,0xF7,0xFF,0x2E,0xFF,0xFF,
-    0x4C,0xE6,0xFF,0x65,0xBC,0xFF,0x81,0xAB,0xFF,0xA1,0xB3,0xFF,0xE4,0xAB,0xFF,0xEB,0xDD,0xFF,0x0F,0xF7,0xFF,0x2F,0xF7,0xFF,0x50,0xF7,0xFF,0x50,0xF7,0xFF,0x0F,0xF7,0xFF,0x0F,0xF7,0xFF,0x4F,0xF7,0xFF,0x2E,0xF7,0xFF,0x4A,0xE6,0xFF,0x85,0xBC,0xFF,0xEB,0xD5,0xFF,0x4E,0xFF,0xFF,0x2E,0xF7,0xFF,0x0C,0xF7,0xFF,0x2C,0xF7,0xFF,0x4D,0xFF,0xFF,0xAB,0xEE,0xFF,0x8A,0xEE,0xFF,0xCB,0xF6,0xFF,0xCB,0xF6,0xFF,0x0D,0xFF,0xFF,0xAC,0xEE,0xFF,0x66,0xBC,0xFF,0xE2,0xBB,0xFF,0x64,0xC4,0xFF,0xC5,0xCC,0xFF,0x07,0xD5,0xFF,0xC6,0xCC,0xFF,0x65,0xC4,0xFF,0x88,0xDD,0xFF,0x09,0xEE,0xFF,0x87,0xE5,0xFF,0xE3,0xBB,0xFF,0xC7,0xCC,0xFF,0xC9,0xDD,0xFF,0x25,0xAC,0xFF,0x4E,0xDE,0xFF,0x92,0xFF,0xFF,0x91,0xFF,0xFF,0x30,0xF7,0xFF,0x50,0xF7,0xFF,0x50,0xF7,0xFF,0xAD,0xEE,0xFF,0xCC,0xF6,0xFF,0xED,0xF6,0xFF,0xE9,0xBC,0xFF,0x40,0x82,0xFF,0xE0,0x79,0xFF,0x25,0x93,0xFF,0xEB,0xBC,0xFF,0x4F,0xE6,0xFF,0x70,0xEE,0xFF,0xCF,0xDD,0xFF,0x8F,0xDD,0xFF,0x6F,0xD5,0xFF,0x50,0xD5,0xFF,0x30,0xCD,0xFF,0x30,0xCD,0xFF,
-    0x51,0xCD,0xFF,0x92,0xCD,0xFF,0x92,0xCD,0xFF,0xB2,0xCD,0xFF,0x92,0xCD,0xFF,0x6E,0xAC,0xFF,0xD0,0xB4,0xFF,0x31,0xBD,0xFF,0xB0,0xAC,0xFF,0x2E,0x9C,0xFF,0x8C,0x83,0xFF,0xC9,0x72,0xFF,0x67,0x6A,0xFF,0x68,0x6A,0xFF,0x06,0x5A,0xFF,0x68,0x62,0xFF,0x64,0x39,0xFF,0x40,0x08,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x20,0xFF,0x80,0x18,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0x85,0x29,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0xC8,0x31,0xFF,0x49,0x4A,0xFF,0xE7,0x39,0xFF,0x48,0x52,0xFF,0xEA,0x6A,0xFF,0x68,0x62,0xFF,0x05,0x5A,0xFF,0x05,0x62,0xFF,0xE4,0x61,0xFF,0xE3,0x69,0xFF,0x24,0x72,0xFF,0x64,0x7A,0xFF,0x04,0x72,0xFF,0xC2,0x69,0xFF,0x05,0x9B,0xFF,0x65,0xB3,0xFF,0x85,0xBB,0xFF,0xA2,0xA2,0xFF,
-    0xA2,0x9A,0xFF,0xA5,0xBB,0xFF,0xE2,0xA2,0xFF,0xA1,0x9A,0xFF,0x27,0xBC,0xFF,0x2B,0xEE,0xFF,0x08,0xD5,0xFF,0x21,0x82,0xFF,0xC1,0x71,0xFF,0x63,0x92,0xFF,0x04,0xAB,0xFF,0x23,0xB3,0xFF,0x43,0xB3,0xFF,0x64,0xB3,0xFF,0xA4,0xBB,0xFF,0xA2,0xBB,0xFF,0x68,0xDD,0xFF,0x8C,0xF6,0xFF,0x85,0xA3,0xFF,0x61,0x61,0xFF,0xC7,0x9B,0xFF,0xEA,0xC4,0xFF,0x2A,0xC5,0xFF,0xC9,0xC4,0xFF,0x87,0xBC,0xFF,0xE5,0xAB,0xFF,0x63,0xA3,0xFF,0xE5,0xB3,0xFF,0x25,0xC4,0xFF,0x83,0xB3,0xFF,0x04,0xBC,0xFF,0x27,0xDD,0xFF,0xA7,0xE5,0xFF,0xA7,0xE5,0xFF,0x87,0xDD,0xFF,0xA7,0xDD,0xFF,0x6A,0xEE,0xFF,0xAB,0xF6,0xFF,0xAA,0xF6,0xFF,0x69,0xEE,0xFF,0x6A,0xEE,0xFF,0x8B,0xF6,0xFF,0x4A,0xEE,0xFF,0x6A,0xEE,0xFF,0xEC,0xF6,0xFF,0x0D,0xF7,0xFF,0x0D,0xF7,0xFF,0x4F,0xF7,0xFF,0x4F,0xFF,0xFF,0xCC,0xF6,0xFF,0xE9,0xE5,0xFF,0x85,0xBC,0xFF,0x4D,0xE6,0xFF,0xB1,0xFF,0xFF,0x90,0xF7,0xFF,0x90,0xF7,0xFF,0xB1,0xFF,0xFF,0xB1,0xFF,0xFF,0x71,0xF7,0xFF,0x50,0xF7,0xFF,0xEE,0xEE,0xFF,0xCD,0xEE,0xFF,0xED,0xF6,0xFF,0x4A,0xE6,0xFF,
-    0xCD,0xEE,0xFF,0x6E,0xFF,0xFF,0x0D,0xF7,0xFF,0xAB,0xEE,0xFF,0x0C,0xF7,0xFF,0x2D,0xFF,0xFF,0x4D,0xFF,0xFF,0xEC,0xF6,0xFF,0x2C,0xF7,0xFF,0xCB,0xF6,0xFF,0xCB,0xEE,0xFF,0x0D,0xF7,0xFF,0xCD,0xF6,0xFF,0xA8,0xDD,0xFF,0xE6,0xCC,0xFF,0x07,0xCD,0xFF,0x07,0xCD,0xFF,0x68,0xD5,0xFF,0x2A,0xEE,0xFF,0xCB,0xF6,0xFF,0x49,0xEE,0xFF,0xE8,0xE5,0xFF,0x08,0xEE,0xFF,0xC8,0xDD,0xFF,0xAC,0xF6,0xFF,0x24,0x93,0xFF,0x22,0x93,0xFF,0x2A,0xC5,0xFF,0xCF,0xEE,0xFF,0x51,0xF7,0xFF,0x51,0xF7,0xFF,0x71,0xFF,0xFF,0x2F,0xF7,0xFF,0x8D,0xEE,0xFF,0xAE,0xEE,0xFF,0x0D,0xE6,0xFF,0x8B,0xBC,0xFF,0x4B,0xBC,0xFF,0xCD,0xCC,0xFF,0xCD,0xC4,0xFF,0xAC,0xC4,0xFF,0x0E,0xCD,0xFF,0x6F,0xD5,0xFF,0xB1,0xD5,0xFF,0xF3,0xDD,0xFF,0x14,0xDE,0xFF,0x55,0xDE,0xFF,0x76,0xDE,0xFF,0xD3,0xCD,0xFF,0xCF,0xAC,0xFF,0xEC,0x93,0xFF,0xEC,0x9B,0xFF,0xA7,0x6A,0xFF,0xA8,0x6A,0xFF,0x8C,0x8B,0xFF,0x46,0x62,0xFF,0x26,0x62,0xFF,0x47,0x6A,0xFF,0x88,0x6A,0xFF,0x88,0x6A,0xFF,0xA8,0x72,0xFF,0xA9,0x72,0xFF,0x26,0x62,0xFF,0xA9,0x6A,0xFF,
-    0x64,0x39,0xFF,0x40,0x08,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0xA0,0x18,0xFF,0xC0,0x20,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x18,0xFF,0xA0,0x18,0xFF,0x85,0x31,0xFF,0xE7,0x39,0xFF,0xE7,0x31,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0x69,0x4A,0xFF,0xA6,0x39,0xFF,0x48,0x4A,0xFF,0x89,0x5A,0xFF,0x68,0x5A,0xFF,0x47,0x5A,0xFF,0x46,0x62,0xFF,0x25,0x62,0xFF,0x24,0x6A,0xFF,0x65,0x7A,0xFF,0xA5,0x82,0xFF,0x47,0x9B,0xFF,0x25,0xA3,0xFF,0x82,0x9A,0xFF,0x82,0x9A,0xFF,0xA2,0xA2,0xFF,0x84,0xB3,0xFF,0x44,0xB3,0xFF,0xC1,0xA2,0xFF,0x27,0xBC,0xFF,0xAA,0xE5,0xFF,0x07,0xD5,0xFF,0x23,0x9B,0xFF,0x22,0x82,0xFF,0x04,0xA3,0xFF,0xE4,0x9A,0xFF,0x24,0xAB,0xFF,0x64,0xB3,0xFF,0x23,0xAB,0xFF,0x02,0xAB,0xFF,0x83,0xB3,0xFF,0xA6,0xC4,0xFF,
-    0xAD,0xF6,0xFF,0xAB,0xD5,0xFF,0x80,0x71,0xFF,0x00,0x40,0xFF,0x00,0x38,0xFF,0x00,0x40,0xFF,0xA0,0x48,0xFF,0x20,0x59,0xFF,0xC1,0x69,0xFF,0xE7,0xA3,0xFF,0xCB,0xDD,0xFF,0x4B,0xEE,0xFF,0xA5,0xD4,0xFF,0xC1,0xA2,0xFF,0x20,0x8A,0xFF,0x03,0xA3,0xFF,0x46,0xC4,0xFF,0x06,0xD5,0xFF,0xA8,0xE5,0xFF,0x29,0xEE,0xFF,0x4A,0xEE,0xFF,0x2A,0xEE,0xFF,0xC9,0xE5,0xFF,0x68,0xDD,0xFF,0x07,0xCD,0xFF,0x05,0xAC,0xFF,0xC5,0xA3,0xFF,0x8C,0xF6,0xFF,0x2D,0xFF,0xFF,0x0D,0xF7,0xFF,0x0D,0xF7,0xFF,0x4E,0xF7,0xFF,0x4E,0xF7,0xFF,0x0D,0xF7,0xFF,0x0D,0xFF,0xFF,0x6B,0xEE,0xFF,0x71,0xFF,0xFF,0x91,0xF7,0xFF,0x50,0xF7,0xFF,0x70,0xF7,0xFF,0x91,0xF7,0xFF,0xB1,0xF7,0xFF,0xB2,0xFF,0xFF,0x50,0xF7,0xFF,0x0F,0xEF,0xFF,0x0E,0xEF,0xFF,0x0E,0xF7,0xFF,0x2B,0xDE,0xFF,0x2B,0xE6,0xFF,0x6E,0xFF,0xFF,0xEC,0xF6,0xFF,0x6A,0xEE,0xFF,0x8A,0xEE,0xFF,0xCB,0xEE,0xFF,0x0C,0xF7,0xFF,0x2D,0xF7,0xFF,0x0C,0xF7,0xFF,0x8B,0xEE,0xFF,0xCB,0xF6,0xFF,0xCC,0xF6,0xFF,0x4E,0xFF,0xFF,0xCC,0xF6,0xFF,0x6B,0xEE,0xFF,0xED,0xFE,0xFF,
-    0x4E,0xFF,0xFF,0x2D,0xFF,0xFF,0x0D,0xF7,0xFF,0x0D,0xF7,0xFF,0xCC,0xF6,0xFF,0x8B,0xF6,0xFF,0x88,0xDD,0xFF,0x47,0xD5,0xFF,0x28,0xCD,0xFF,0x61,0x82,0xFF,0x80,0x69,0xFF,0x60,0x82,0xFF,0x84,0x9B,0xFF,0xCA,0xB4,0xFF,0x6F,0xE6,0xFF,0xB0,0xEE,0xFF,0x4F,0xEE,0xFF,0x4C,0xD5,0xFF,0x0C,0xD5,0xFF,0xEC,0xCC,0xFF,0x0E,0xD5,0xFF,0xED,0xCC,0xFF,0x0E,0xCD,0xFF,0x0F,0xCD,0xFF,0x2F,0xC5,0xFF,0x70,0xCD,0xFF,0x13,0xDE,0xFF,0x34,0xDE,0xFF,0xD3,0xCD,0xFF,0x11,0xB5,0xFF,0x4E,0x9C,0xFF,0x6B,0x83,0xFF,0xC8,0x72,0xFF,0x25,0x62,0xFF,0x66,0x6A,0xFF,0x87,0x6A,0xFF,0x63,0x41,0xFF,0x0A,0x7B,0xFF,0x87,0x6A,0xFF,0x2A,0x7B,0xFF,0x2E,0x9C,0xFF,0x47,0x62,0xFF,0x67,0x6A,0xFF,0xA8,0x72,0xFF,0xC9,0x72,0xFF,0x47,0x62,0xFF,0x27,0x62,0xFF,0xA9,0x6A,0xFF,0x23,0x31,0xFF,0x40,0x08,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,
-    0x60,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x65,0x29,0xFF,0xE7,0x39,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0x49,0x42,0xFF,0x8A,0x4A,0xFF,0x69,0x4A,0xFF,0x86,0x31,0xFF,0xE7,0x39,0xFF,0xE7,0x39,0xFF,0xA6,0x31,0xFF,0x28,0x4A,0xFF,0x48,0x52,0xFF,0xA8,0x6A,0xFF,0xE8,0x7A,0xFF,0xA6,0x7A,0xFF,0xA5,0x82,0xFF,0xA5,0x82,0xFF,0xE5,0x8A,0xFF,0xC5,0x92,0xFF,0x63,0x8A,0xFF,0x24,0xAB,0xFF,0xA5,0xBB,0xFF,0xC2,0xA2,0xFF,0xE6,0xBB,0xFF,0x87,0xCC,0xFF,0xC4,0xB3,0xFF,0x20,0x82,0xFF,0x84,0x8A,0xFF,0x65,0xAB,0xFF,0xC7,0xB3,0xFF,0x82,0x92,0xFF,0x64,0xB3,0xFF,0xA5,0xB3,0xFF,0xA4,0xBB,0xFF,0x83,0xB3,0xFF,0x09,0xCD,0xFF,0x10,0xF7,0xFF,0x8E,0xEE,0xFF,0xA4,0xA3,0xFF,0x87,0xBC,0xFF,0xA5,0xA3,0xFF,0x24,0x9B,0xFF,0x65,0xA3,0xFF,0x85,0xAB,0xFF,0xA5,0xB3,0xFF,0xE5,0xBB,0xFF,0x09,0xD5,0xFF,0xAD,0xF6,0xFF,0x4A,0xEE,0xFF,0x67,0xE5,0xFF,0xA4,0xBB,0xFF,0xE0,0x89,0xFF,0x20,0x71,0xFF,
-    0xE1,0x79,0xFF,0x03,0x9B,0xFF,0xC5,0xB3,0xFF,0x46,0xBC,0xFF,0x25,0xBC,0xFF,0x83,0xA3,0xFF,0x01,0x9B,0xFF,0x43,0xA3,0xFF,0x24,0x9B,0xFF,0x00,0x72,0xFF,0xC0,0x58,0xFF,0x06,0xAC,0xFF,0x0A,0xE6,0xFF,0xED,0xF6,0xFF,0x6E,0xFF,0xFF,0x6F,0xFF,0xFF,0x6E,0xFF,0xFF,0x0D,0xF7,0xFF,0xCB,0xF6,0xFF,0xE9,0xDD,0xFF,0x50,0xF7,0xFF,0x91,0xF7,0xFF,0x70,0xF7,0xFF,0x91,0xFF,0xFF,0x70,0xF7,0xFF,0x4F,0xEF,0xFF,0x70,0xF7,0xFF,0xB2,0xFF,0xFF,0x50,0xF7,0xFF,0x50,0xF7,0xFF,0x2F,0xF7,0xFF,0xEE,0xF6,0xFF,0xAA,0xD5,0xFF,0x8C,0xEE,0xFF,0xEC,0xF6,0xFF,0xAB,0xEE,0xFF,0x8B,0xEE,0xFF,0xED,0xF6,0xFF,0x0D,0xF7,0xFF,0x4E,0xF7,0xFF,0x0D,0xF7,0xFF,0x2D,0xFF,0xFF,0x0C,0xF7,0xFF,0xAB,0xEE,0xFF,0x2E,0xF7,0xFF,0x8D,0xE6,0xFF,0xC4,0xA3,0xFF,0x87,0xB4,0xFF,0x09,0xC5,0xFF,0x4A,0xC5,0xFF,0x6A,0xCD,0xFF,0x29,0xC5,0xFF,0x88,0xB4,0xFF,0x05,0xAC,0xFF,0x85,0xC4,0xFF,0x25,0xB4,0xFF,0x65,0x9B,0xFF,0x0B,0xCD,0xFF,0x4D,0xD5,0xFF,0xED,0xC4,0xFF,0x4E,0xD5,0xFF,0x4D,0xD5,0xFF,0x0C,0xCD,0xFF,0xAB,0xC4,0xFF,
-    0xAB,0xC4,0xFF,0xAC,0xC4,0xFF,0xED,0xCC,0xFF,0x50,0xD5,0xFF,0x2F,0xCD,0xFF,0x70,0xCD,0xFF,0xF2,0xDD,0xFF,0x33,0xDE,0xFF,0x34,0xDE,0xFF,0x14,0xD6,0xFF,0x8F,0xA4,0xFF,0x4A,0x7B,0xFF,0x4A,0x7B,0xFF,0xC8,0x6A,0xFF,0xC8,0x72,0xFF,0x66,0x62,0xFF,0xA8,0x6A,0xFF,0x67,0x6A,0xFF,0x87,0x6A,0xFF,0x26,0x5A,0xFF,0x63,0x41,0xFF,0xE9,0x72,0xFF,0x26,0x5A,0xFF,0x2A,0x7B,0xFF,0x8C,0x8B,0xFF,0x46,0x62,0xFF,0x67,0x6A,0xFF,0x88,0x6A,0xFF,0x67,0x6A,0xFF,0x47,0x6A,0xFF,0x06,0x5A,0xFF,0x88,0x62,0xFF,0xC2,0x20,0xFF,0x60,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x03,0x21,0xFF,0xE7,0x39,0xFF,0xC7,0x39,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0x86,0x29,0xFF,
-    0x08,0x42,0xFF,0x65,0x29,0xFF,0x86,0x31,0xFF,0x08,0x3A,0xFF,0xA7,0x31,0xFF,0xC7,0x31,0xFF,0xE7,0x39,0xFF,0x28,0x4A,0xFF,0x2A,0x73,0xFF,0x8B,0x83,0xFF,0x28,0x83,0xFF,0xC6,0x82,0xFF,0xC6,0x82,0xFF,0xE6,0x8A,0xFF,0xE6,0x92,0xFF,0xE5,0x92,0xFF,0xA4,0x92,0xFF,0xA3,0x92,0xFF,0xE3,0x9A,0xFF,0x82,0x92,0xFF,0x63,0x8A,0xFF,0x46,0xA3,0xFF,0x25,0xA3,0xFF,0xC4,0x9A,0xFF,0xA3,0x92,0xFF,0x41,0x8A,0xFF,0x64,0xB3,0xFF,0xA4,0xB3,0xFF,0xC5,0xBB,0xFF,0x27,0xC4,0xFF,0xEC,0xE5,0xFF,0x6E,0xE6,0xFF,0x68,0xB4,0xFF,0x4C,0xEE,0xFF,0x6B,0xEE,0xFF,0x28,0xD5,0xFF,0x25,0xC4,0xFF,0x25,0xC4,0xFF,0x65,0xC4,0xFF,0x45,0xC4,0xFF,0x45,0xCC,0xFF,0x03,0xC4,0xFF,0x65,0xC4,0xFF,0xC9,0xE5,0xFF,0x88,0xE5,0xFF,0x45,0xC4,0xFF,0x64,0xB3,0xFF,0x24,0xA3,0xFF,0xA3,0x8A,0xFF,0x22,0x7A,0xFF,0xC0,0x79,0xFF,0x00,0x69,0xFF,0x84,0x7A,0xFF,0x69,0xAC,0xFF,0x6B,0xC5,0xFF,0x4D,0xE6,0xFF,0x6C,0xEE,0xFF,0x2C,0xE6,0xFF,0x2A,0xC5,0xFF,0x07,0xAC,0xFF,0xE4,0xAB,0xFF,0xA5,0xC4,0xFF,0xA9,0xDD,0xFF,0x4B,0xEE,0xFF,
-    0x8B,0xEE,0xFF,0x2A,0xEE,0xFF,0xA8,0xE5,0xFF,0x04,0xBC,0xFF,0x8E,0xE6,0xFF,0x91,0xFF,0xFF,0x0F,0xEF,0xFF,0x70,0xF7,0xFF,0xB1,0xFF,0xFF,0x91,0xF7,0xFF,0x2F,0xEF,0xFF,0x91,0xF7,0xFF,0x71,0xF7,0xFF,0x50,0xF7,0xFF,0x70,0xF7,0xFF,0x4F,0xF7,0xFF,0x8D,0xEE,0xFF,0x66,0xB4,0xFF,0x0B,0xE6,0xFF,0x0D,0xFF,0xFF,0x0E,0xF7,0xFF,0x4E,0xF7,0xFF,0x6F,0xFF,0xFF,0x6F,0xFF,0xFF,0x4F,0xF7,0xFF,0x2E,0xF7,0xFF,0x0D,0xF7,0xFF,0x8B,0xE6,0xFF,0x2E,0xF7,0xFF,0x8E,0xEE,0xFF,0x02,0x9B,0xFF,0x80,0x92,0xFF,0x20,0x82,0xFF,0xC0,0x71,0xFF,0xE0,0x71,0xFF,0xC3,0x8A,0xFF,0x08,0xAC,0xFF,0x2A,0xD5,0xFF,0xAB,0xE5,0xFF,0x6C,0xD5,0xFF,0xAE,0xDD,0xFF,0xEE,0xE5,0xFF,0x0F,0xE6,0xFF,0x10,0xE6,0xFF,0xF0,0xE5,0xFF,0x4E,0xCD,0xFF,0x2E,0xC5,0xFF,0x4F,0xCD,0xFF,0x70,0xCD,0xFF,0x71,0xCD,0xFF,0x30,0xC5,0xFF,0xEC,0x9B,0xFF,0x51,0xCD,0xFF,0x51,0xC5,0xFF,0xCF,0xB4,0xFF,0x2D,0xA4,0xFF,0x6A,0x83,0xFF,0x6A,0x83,0xFF,0xC8,0x72,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x88,0x6A,0xFF,0xA8,0x6A,0xFF,0x67,0x6A,0xFF,
-    0xC8,0x72,0xFF,0x87,0x6A,0xFF,0x66,0x6A,0xFF,0xC5,0x51,0xFF,0x02,0x31,0xFF,0x88,0x6A,0xFF,0xC6,0x49,0xFF,0xA4,0x49,0xFF,0xE5,0x59,0xFF,0x67,0x62,0xFF,0x67,0x6A,0xFF,0x26,0x62,0xFF,0x68,0x6A,0xFF,0x88,0x6A,0xFF,0x27,0x62,0xFF,0xA9,0x6A,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x61,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xC2,0x18,0xFF,0xE7,0x39,0xFF,0x49,0x42,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0x03,0x21,0xFF,0x65,0x29,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0x08,0x42,0xFF,0xCA,0x5A,0xFF,0x8C,0x83,0xFF,0x4A,0x83,0xFF,0x28,0x8B,0xFF,0x07,0x8B,0xFF,0x27,0x93,0xFF,0xE6,0x8A,0xFF,
-    0x46,0x9B,0xFF,0x47,0xA3,0xFF,0x84,0x82,0xFF,0xC2,0x71,0xFF,0xA4,0x8A,0xFF,0x83,0x8A,0xFF,0xE3,0x9A,0xFF,0x82,0x9A,0xFF,0x03,0xA3,0xFF,0x03,0xA3,0xFF,0x85,0xB3,0xFF,0xE6,0xBB,0xFF,0x65,0xAB,0xFF,0xC6,0xAB,0xFF,0x28,0xB4,0xFF,0x07,0xAC,0xFF,0x2B,0xEE,0xFF,0xEA,0xDD,0xFF,0x66,0xBC,0xFF,0xE5,0xBB,0xFF,0xA4,0xB3,0xFF,0xC4,0xB3,0xFF,0x65,0xC4,0xFF,0x24,0xC4,0xFF,0x65,0xCC,0xFF,0xA6,0xCC,0xFF,0x03,0xBC,0xFF,0xE7,0xCC,0xFF,0x09,0xEE,0xFF,0xA8,0xE5,0xFF,0x88,0xE5,0xFF,0x89,0xE5,0xFF,0x0A,0xE6,0xFF,0x2B,0xE6,0xFF,0xEA,0xE5,0xFF,0x29,0xCD,0xFF,0x8E,0xE6,0xFF,0x2F,0xF7,0xFF,0x0E,0xF7,0xFF,0xED,0xF6,0xFF,0xCC,0xF6,0xFF,0xCC,0xF6,0xFF,0xAC,0xF6,0xFF,0xAC,0xEE,0xFF,0x2B,0xE6,0xFF,0x28,0xCD,0xFF,0x25,0xBC,0xFF,0x04,0xBC,0xFF,0x45,0xC4,0xFF,0x65,0xCC,0xFF,0x63,0xAB,0xFF,0x20,0x82,0xFF,0xA8,0xC4,0xFF,0x71,0xFF,0xFF,0x2F,0xEF,0xFF,0xCE,0xE6,0xFF,0x70,0xF7,0xFF,0xB2,0xFF,0xFF,0xD2,0xFF,0xFF,0x91,0xF7,0xFF,0x91,0xF7,0xFF,0x71,0xF7,0xFF,0x71,0xF7,0xFF,0x70,0xFF,0xFF,
-    0x2F,0xFF,0xFF,0xE9,0xC4,0xFF,0xE0,0x92,0xFF,0x09,0xCD,0xFF,0xAD,0xEE,0xFF,0x4F,0xFF,0xFF,0x90,0xFF,0xFF,0x4F,0xF7,0xFF,0x2F,0xF7,0xFF,0x0E,0xF7,0xFF,0xCD,0xEE,0xFF,0xCD,0xEE,0xFF,0x0F,0xF7,0xFF,0x2A,0xCD,0xFF,0x08,0xB4,0xFF,0x67,0x9B,0xFF,0xE9,0xA3,0xFF,0x6A,0xB4,0xFF,0x8D,0xD5,0xFF,0x0E,0xEE,0xFF,0x2E,0xEE,0xFF,0xCD,0xE5,0xFF,0xAD,0xDD,0xFF,0xAE,0xDD,0xFF,0xAE,0xDD,0xFF,0xD0,0xDD,0xFF,0x11,0xDE,0xFF,0xD1,0xD5,0xFF,0x12,0xD6,0xFF,0xD2,0xCD,0xFF,0x71,0xBD,0xFF,0xAF,0xAC,0xFF,0xEC,0x93,0xFF,0x4A,0x83,0xFF,0x46,0x62,0xFF,0xC0,0x30,0xFF,0x46,0x6A,0xFF,0x25,0x6A,0xFF,0x66,0x72,0xFF,0x46,0x6A,0xFF,0xC8,0x7A,0xFF,0x2A,0x83,0xFF,0xA8,0x6A,0xFF,0xE5,0x51,0xFF,0x06,0x5A,0xFF,0x46,0x62,0xFF,0x87,0x6A,0xFF,0xA8,0x72,0xFF,0xA8,0x72,0xFF,0x87,0x6A,0xFF,0x67,0x62,0xFF,0xC5,0x49,0xFF,0xC1,0x28,0xFF,0x68,0x62,0xFF,0x47,0x62,0xFF,0x84,0x49,0xFF,0x67,0x62,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x27,0x62,0xFF,0x68,0x6A,0xFF,0x88,0x6A,0xFF,0x88,0x6A,0xFF,0x88,0x62,0xFF,
-    0x40,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xA0,0x10,0xFF,0x81,0x10,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0xC7,0x31,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0xA2,0x18,0xFF,0x65,0x29,0xFF,0xC7,0x31,0xFF,0xE8,0x31,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0x49,0x4A,0xFF,0x0B,0x63,0xFF,0x6B,0x7B,0xFF,0x8B,0x8B,0xFF,0xCB,0x9B,0xFF,0x69,0x9B,0xFF,0x68,0x9B,0xFF,0x47,0x9B,0xFF,0x47,0x9B,0xFF,0x47,0x9B,0xFF,0x65,0x82,0xFF,0xC2,0x69,0xFF,0x66,0xAB,0xFF,0x86,0xAB,0xFF,0x66,0xAB,0xFF,0x65,0xA3,0xFF,0x25,0xA3,0xFF,0x84,0x92,0xFF,0xE2,0x71,0xFF,0x44,0x7A,0xFF,0xC7,0xAB,0xFF,0x0C,0xE6,0xFF,
-    0x8A,0xDD,0xFF,0x26,0xB4,0xFF,0xC5,0xB3,0xFF,0xE5,0xBB,0xFF,0x23,0xA3,0xFF,0x26,0xBC,0xFF,0x66,0xC4,0xFF,0xE4,0xBB,0xFF,0x04,0xBC,0xFF,0x07,0xD5,0xFF,0xC3,0xBB,0xFF,0x49,0xD5,0xFF,0x4B,0xEE,0xFF,0xE9,0xE5,0xFF,0x4A,0xF6,0xFF,0x2A,0xEE,0xFF,0x09,0xE6,0xFF,0x2A,0xE6,0xFF,0x4A,0xEE,0xFF,0xCD,0xF6,0xFF,0x0E,0xF7,0xFF,0x0D,0xF7,0xFF,0xAC,0xEE,0xFF,0xCC,0xEE,0xFF,0xAB,0xEE,0xFF,0x6B,0xE6,0xFF,0xED,0xF6,0xFF,0xED,0xF6,0xFF,0xCD,0xF6,0xFF,0xCD,0xF6,0xFF,0xEB,0xDD,0xFF,0x88,0xBC,0xFF,0xE2,0x92,0xFF,0x80,0x92,0xFF,0x00,0x82,0xFF,0xA0,0x71,0xFF,0x23,0x9B,0xFF,0x4B,0xCD,0xFF,0x51,0xF7,0xFF,0x50,0xF7,0xFF,0x0F,0xEF,0xFF,0x30,0xEF,0xFF,0x50,0xF7,0xFF,0x71,0xF7,0xFF,0xB2,0xFF,0xFF,0x92,0xFF,0xFF,0x30,0xEF,0xFF,0x70,0xF7,0xFF,0x4F,0xFF,0xFF,0xCB,0xD5,0xFF,0xA0,0x79,0xFF,0x80,0x92,0xFF,0x23,0xA3,0xFF,0xA8,0xBC,0xFF,0xCB,0xD5,0xFF,0x6D,0xE6,0xFF,0xCE,0xEE,0xFF,0xCE,0xEE,0xFF,0xAE,0xEE,0xFF,0x8D,0xE6,0xFF,0x2D,0xE6,0xFF,0xED,0xDD,0xFF,0x6F,0xEE,0xFF,0x8F,0xF6,0xFF,
-    0x6F,0xF6,0xFF,0x2E,0xEE,0xFF,0x0E,0xE6,0xFF,0x0E,0xE6,0xFF,0xEF,0xDD,0xFF,0x8E,0xD5,0xFF,0x4E,0xCD,0xFF,0x0E,0xBD,0xFF,0xEE,0xBC,0xFF,0xAE,0xAC,0xFF,0x6D,0xA4,0xFF,0x6A,0x83,0xFF,0x29,0x7B,0xFF,0xC8,0x72,0xFF,0xA7,0x72,0xFF,0x66,0x6A,0xFF,0xA7,0x72,0xFF,0xA8,0x72,0xFF,0x06,0x5A,0xFF,0xE2,0x30,0xFF,0x87,0x6A,0xFF,0x87,0x72,0xFF,0x47,0x62,0xFF,0x6F,0xA4,0xFF,0x4A,0x7B,0xFF,0x0A,0x7B,0xFF,0xA9,0x6A,0xFF,0x67,0x62,0xFF,0x67,0x6A,0xFF,0x47,0x62,0xFF,0x88,0x6A,0xFF,0xA8,0x6A,0xFF,0xC8,0x72,0xFF,0xA8,0x72,0xFF,0x67,0x62,0xFF,0xE5,0x51,0xFF,0xE2,0x28,0xFF,0xC5,0x49,0xFF,0xE9,0x72,0xFF,0x88,0x6A,0xFF,0xC8,0x72,0xFF,0xC8,0x72,0xFF,0x67,0x6A,0xFF,0x27,0x62,0xFF,0x26,0x62,0xFF,0x67,0x62,0xFF,0xEA,0x7A,0xFF,0x47,0x5A,0xFF,0x20,0x08,0xFF,0xA1,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x08,0x42,0xFF,0xC7,0x39,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0xC7,0x39,0xFF,0x24,0x29,0xFF,0xE3,0x18,0xFF,0x65,0x29,0xFF,0xC7,0x31,0xFF,0xE8,0x39,0xFF,0xE8,0x31,0xFF,0x09,0x3A,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0x49,0x4A,0xFF,0x2C,0x6B,0xFF,0x8C,0x83,0xFF,0xEC,0x93,0xFF,0x0B,0xA4,0xFF,0x0B,0xAC,0xFF,0xE9,0xAB,0xFF,0x88,0xA3,0xFF,0x88,0xA3,0xFF,0x06,0x93,0xFF,0xC5,0x8A,0xFF,0xE5,0x92,0xFF,0xC1,0x69,0xFF,0xE2,0x71,0xFF,0x44,0x7A,0xFF,0x61,0x61,0xFF,0x41,0x61,0xFF,0x44,0x7A,0xFF,0xCA,0xC4,0xFF,0x4A,0xD5,0xFF,0x06,0xB4,0xFF,0x26,0xB4,0xFF,0x43,0xA3,0xFF,0x03,0xA3,0xFF,0x64,0xAB,0xFF,0xE5,0xB3,0xFF,0x67,0xC4,0xFF,0xE8,0xD4,0xFF,0xE8,0xCC,0xFF,0xC7,0xD4,0xFF,0xC4,0xB3,0xFF,0xAB,0xE5,0xFF,0x26,0xBC,0xFF,0x87,0xCC,0xFF,0x69,0xDD,0xFF,0xCA,0xE5,0xFF,
-    0xCB,0xE5,0xFF,0xAA,0xDD,0xFF,0x28,0xCD,0xFF,0x6D,0xE6,0xFF,0x2E,0xF7,0xFF,0xCC,0xF6,0xFF,0x4B,0xE6,0xFF,0x8B,0xEE,0xFF,0xED,0xF6,0xFF,0x8C,0xE6,0xFF,0xCD,0xF6,0xFF,0xCD,0xEE,0xFF,0x6C,0xE6,0xFF,0xEE,0xF6,0xFF,0x0E,0xF7,0xFF,0x4C,0xEE,0xFF,0x69,0xDD,0xFF,0x68,0xDD,0xFF,0xA6,0xC4,0xFF,0x22,0xA3,0xFF,0x00,0x82,0xFF,0x24,0x9B,0xFF,0x08,0xAC,0xFF,0x4F,0xDE,0xFF,0x72,0xF7,0xFF,0x51,0xF7,0xFF,0x30,0xEF,0xFF,0x92,0xF7,0xFF,0x92,0xF7,0xFF,0x50,0xEF,0xFF,0x50,0xF7,0xFF,0x50,0xF7,0xFF,0x30,0xF7,0xFF,0x0A,0xC5,0xFF,0x03,0x9B,0xFF,0xA0,0x71,0xFF,0x21,0x82,0xFF,0xE4,0x92,0xFF,0x65,0x9B,0xFF,0x69,0xB4,0xFF,0x2B,0xC5,0xFF,0xED,0xD5,0xFF,0x8E,0xEE,0xFF,0xCF,0xF6,0xFF,0xD0,0xF6,0xFF,0xD0,0xF6,0xFF,0xB0,0xF6,0xFF,0xD2,0xF6,0xFF,0x91,0xEE,0xFF,0x72,0xE6,0xFF,0xD0,0xD5,0xFF,0x2E,0xBD,0xFF,0x8D,0xA4,0xFF,0x4C,0x9C,0xFF,0x6E,0xA4,0xFF,0xF0,0xAC,0xFF,0x6E,0xA4,0xFF,0xA7,0x6A,0xFF,0xA8,0x6A,0xFF,0xC8,0x72,0xFF,0x67,0x6A,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0xC8,0x7A,0xFF,
-    0xA7,0x72,0xFF,0x67,0x62,0xFF,0x26,0x5A,0xFF,0x02,0x31,0xFF,0xA8,0x72,0xFF,0x26,0x62,0xFF,0xA4,0x49,0xFF,0x6B,0x7B,0xFF,0x4B,0x7B,0xFF,0x88,0x6A,0xFF,0xA8,0x6A,0xFF,0x67,0x6A,0xFF,0xC9,0x72,0xFF,0x0A,0x7B,0xFF,0x87,0x6A,0xFF,0x87,0x6A,0xFF,0xC8,0x72,0xFF,0xE8,0x72,0xFF,0x87,0x6A,0xFF,0x47,0x5A,0xFF,0xA5,0x41,0xFF,0xE2,0x28,0xFF,0xA5,0x41,0xFF,0x88,0x62,0xFF,0x67,0x5A,0xFF,0xA8,0x6A,0xFF,0x47,0x62,0xFF,0x06,0x5A,0xFF,0x27,0x62,0xFF,0x47,0x62,0xFF,0xA9,0x72,0xFF,0x27,0x52,0xFF,0x40,0x10,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x81,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0xE7,0x39,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xC7,0x31,0xFF,0x65,0x29,0xFF,
-    0x00,0x00,0xFF,0x81,0x10,0xFF,0x45,0x29,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xA7,0x31,0xFF,0x65,0x29,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0x29,0x3A,0xFF,0x6A,0x42,0xFF,0x08,0x3A,0xFF,0xE7,0x39,0xFF,0xCA,0x62,0xFF,0x6C,0x7B,0xFF,0x0D,0x9C,0xFF,0x4C,0xAC,0xFF,0x4B,0xB4,0xFF,0xE9,0xAB,0xFF,0xA8,0xA3,0xFF,0xC8,0xA3,0xFF,0xA8,0xA3,0xFF,0x68,0x9B,0xFF,0x45,0x7A,0xFF,0x41,0x61,0xFF,0x26,0x9B,0xFF,0x86,0xAB,0xFF,0x46,0x9B,0xFF,0xE7,0xAB,0xFF,0x47,0xB4,0xFF,0x26,0xB4,0xFF,0x88,0xC4,0xFF,0x64,0xAB,0xFF,0x44,0xA3,0xFF,0x43,0xA3,0xFF,0x06,0xBC,0xFF,0x67,0xC4,0xFF,0x87,0xC4,0xFF,0xA7,0xCC,0xFF,0xA3,0xB3,0xFF,0x29,0xD5,0xFF,0xC8,0xCC,0xFF,0x60,0x60,0xFF,0x01,0x82,0xFF,0x04,0x9B,0xFF,0x65,0xA3,0xFF,0x25,0x93,0xFF,0xC4,0x82,0xFF,0x80,0x61,0xFF,0x4B,0xC5,0xFF,0x4F,0xFF,0xFF,0x6B,0xE6,0xFF,0xC9,0xDD,0xFF,0x6C,0xEE,0xFF,0xAD,0xEE,0xFF,0xED,0xF6,0xFF,0xAC,0xEE,0xFF,0xCD,0xF6,0xFF,0xAC,0xEE,0xFF,0xAD,0xEE,0xFF,0xED,0xEE,0xFF,0xCD,0xEE,0xFF,
-    0x2B,0xE6,0xFF,0xED,0xFE,0xFF,0x8B,0xF6,0xFF,0x89,0xE5,0xFF,0x23,0x9B,0xFF,0x40,0x69,0xFF,0x80,0x69,0xFF,0xC0,0x71,0xFF,0x09,0x9C,0xFF,0x0F,0xD6,0xFF,0xF1,0xEE,0xFF,0x93,0xF7,0xFF,0x72,0xF7,0xFF,0x10,0xEF,0xFF,0xEF,0xEE,0xFF,0xEF,0xEE,0xFF,0x0D,0xDE,0xFF,0xC9,0xC4,0xFF,0xCD,0xE5,0xFF,0xEE,0xDD,0xFF,0x2F,0xE6,0xFF,0x90,0xEE,0xFF,0xD0,0xF6,0xFF,0xD0,0xF6,0xFF,0xAF,0xF6,0xFF,0x8F,0xEE,0xFF,0x8F,0xEE,0xFF,0xD1,0xF6,0xFF,0xB1,0xEE,0xFF,0x51,0xE6,0xFF,0xF0,0xD5,0xFF,0x6F,0xC5,0xFF,0xCE,0xAC,0xFF,0xCF,0xAC,0xFF,0xAF,0xAC,0xFF,0x8E,0xA4,0xFF,0x8F,0xA4,0xFF,0x4E,0x9C,0xFF,0xED,0x93,0xFF,0x2A,0x7B,0xFF,0x09,0x7B,0xFF,0x09,0x7B,0xFF,0xC9,0x72,0xFF,0x26,0x62,0xFF,0x88,0x72,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0x88,0x6A,0xFF,0x88,0x62,0xFF,0x27,0x5A,0xFF,0x23,0x39,0xFF,0x88,0x6A,0xFF,0x06,0x5A,0xFF,0x23,0x39,0xFF,0x84,0x41,0xFF,0x27,0x52,0xFF,0x68,0x62,0xFF,0x47,0x62,0xFF,0x06,0x5A,0xFF,0xA8,0x6A,0xFF,0x09,0x7B,0xFF,0xE8,0x72,0xFF,0xC8,0x72,0xFF,
-    0xC8,0x72,0xFF,0x87,0x6A,0xFF,0x06,0x52,0xFF,0x84,0x41,0xFF,0x22,0x31,0xFF,0xE1,0x28,0xFF,0x40,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x67,0x5A,0xFF,0xA8,0x6A,0xFF,0x06,0x5A,0xFF,0x27,0x62,0xFF,0xA8,0x72,0xFF,0xE9,0x72,0xFF,0xC5,0x49,0xFF,0x40,0x10,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0x60,0x10,0xFF,0xA6,0x31,0xFF,0xE8,0x39,0xFF,0xC8,0x31,0xFF,0xC7,0x39,0xFF,0xE3,0x18,0xFF,0x00,0x00,0xFF,0x81,0x10,0xFF,0xE3,0x18,0xFF,0x45,0x29,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0x09,0x3A,0xFF,0x2A,0x3A,0xFF,0x09,0x3A,0xFF,0xE8,0x39,0xFF,0xA6,0x31,0xFF,
-    0xE7,0x41,0xFF,0xCA,0x62,0xFF,0x2A,0x7B,0xFF,0xCB,0x93,0xFF,0xAD,0xBC,0xFF,0x8B,0xBC,0xFF,0x2A,0xB4,0xFF,0x4A,0xBC,0xFF,0x8B,0xC4,0xFF,0x8B,0xC4,0xFF,0xE9,0xAB,0xFF,0xE6,0x8A,0xFF,0xE4,0x92,0xFF,0x63,0x82,0xFF,0x05,0x93,0xFF,0x88,0xBC,0xFF,0x26,0xBC,0xFF,0xC6,0xB3,0xFF,0xE6,0xB3,0xFF,0x44,0xA3,0xFF,0x43,0xAB,0xFF,0xE5,0xB3,0xFF,0xE4,0xB3,0xFF,0x05,0xBC,0xFF,0xA3,0xB3,0xFF,0x29,0xD5,0xFF,0xAA,0xE5,0xFF,0x64,0xAB,0xFF,0x86,0xB3,0xFF,0xE7,0xBB,0xFF,0xE6,0xBB,0xFF,0x07,0xB4,0xFF,0xA7,0xAB,0xFF,0x67,0x9B,0xFF,0x44,0x72,0xFF,0xC5,0x7A,0xFF,0xCF,0xEE,0xFF,0xED,0xF6,0xFF,0x6B,0xE6,0xFF,0x0B,0xDE,0xFF,0x2B,0xE6,0xFF,0xAC,0xEE,0xFF,0xCD,0xEE,0xFF,0xCD,0xF6,0xFF,0xCD,0xEE,0xFF,0xED,0xF6,0xFF,0x8C,0xE6,0xFF,0x8D,0xE6,0xFF,0xAD,0xEE,0xFF,0x8A,0xD5,0xFF,0xCB,0xDD,0xFF,0x6A,0xD5,0xFF,0x49,0xBC,0xFF,0x63,0x82,0xFF,0xE2,0x71,0xFF,0xA1,0x69,0xFF,0xA0,0x60,0xFF,0x00,0x58,0xFF,0x62,0x7A,0xFF,0x2A,0xA4,0xFF,0x6D,0xC5,0xFF,0x4F,0xDE,0xFF,0xF1,0xEE,0xFF,0x31,0xF7,0xFF,
-    0x51,0xFF,0xFF,0x31,0xFF,0xFF,0x31,0xFF,0xFF,0x31,0xFF,0xFF,0x51,0xFF,0xFF,0x52,0xFF,0xFF,0x53,0xFF,0xFF,0xD2,0xEE,0xFF,0x71,0xE6,0xFF,0xF0,0xD5,0xFF,0x4E,0xBD,0xFF,0xED,0xB4,0xFF,0xAE,0xAC,0xFF,0x4D,0x9C,0xFF,0x2D,0x9C,0xFF,0x6E,0xA4,0xFF,0xAF,0xA4,0xFF,0x4E,0x9C,0xFF,0x8B,0x8B,0xFF,0x87,0x6A,0xFF,0x67,0x6A,0xFF,0x26,0x62,0xFF,0x25,0x62,0xFF,0x26,0x62,0xFF,0x4E,0x9C,0xFF,0x09,0x7B,0xFF,0xE9,0x72,0xFF,0x26,0x62,0xFF,0x46,0x6A,0xFF,0xA7,0x72,0xFF,0xA7,0x7A,0xFF,0x87,0x72,0xFF,0xA9,0x72,0xFF,0xA9,0x6A,0xFF,0x07,0x52,0xFF,0x02,0x31,0xFF,0xA8,0x6A,0xFF,0x27,0x62,0xFF,0x64,0x41,0xFF,0xC5,0x49,0xFF,0x27,0x5A,0xFF,0x68,0x62,0xFF,0x88,0x62,0xFF,0x26,0x5A,0xFF,0x47,0x62,0xFF,0x06,0x52,0xFF,0xC5,0x49,0xFF,0x64,0x39,0xFF,0xE2,0x28,0xFF,0xE2,0x30,0xFF,0x02,0x31,0xFF,0x63,0x39,0xFF,0xA4,0x41,0xFF,0x84,0x39,0xFF,0x02,0x29,0xFF,0x60,0x10,0xFF,0x00,0x08,0xFF,0x06,0x52,0xFF,0x47,0x62,0xFF,0x06,0x5A,0xFF,0x26,0x5A,0xFF,0xA8,0x6A,0xFF,0xE9,0x72,0xFF,0x64,0x39,0xFF,
-    0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x24,0x21,0xFF,0xE8,0x39,0xFF,0xC7,0x31,0xFF,0xC7,0x39,0xFF,0x03,0x21,0xFF,0x00,0x00,0xFF,0xC2,0x18,0xFF,0x44,0x29,0xFF,0x44,0x29,0xFF,0x64,0x29,0xFF,0x86,0x31,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0xC8,0x39,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0xE8,0x39,0xFF,0x09,0x3A,0xFF,0x08,0x3A,0xFF,0x6A,0x4A,0xFF,0xC7,0x39,0xFF,0x86,0x31,0xFF,0xE7,0x39,0xFF,0x28,0x4A,0xFF,0x69,0x5A,0xFF,0xE9,0x72,0xFF,0x2C,0x9C,0xFF,0x6C,0xB4,0xFF,0x8B,0xBC,0xFF,0x8B,0xBC,0xFF,0xAB,0xC4,0xFF,0xAB,0xC4,0xFF,0x8B,0xBC,0xFF,0xEA,0xAB,0xFF,0x45,0x72,0xFF,0x03,0x6A,0xFF,0x69,0xBC,0xFF,
-    0xE5,0xB3,0xFF,0x63,0xA3,0xFF,0x64,0xA3,0xFF,0x03,0x9B,0xFF,0x23,0xA3,0xFF,0x05,0xBC,0xFF,0x87,0xC4,0xFF,0x66,0xC4,0xFF,0x08,0xD5,0xFF,0x8A,0xE5,0xFF,0x87,0xC4,0xFF,0x06,0xBC,0xFF,0xE5,0xBB,0xFF,0x05,0xBC,0xFF,0x46,0xC4,0xFF,0x26,0xBC,0xFF,0x47,0xBC,0xFF,0x67,0xC4,0xFF,0x48,0xBC,0xFF,0x05,0x93,0xFF,0xC8,0x93,0xFF,0x8F,0xEE,0xFF,0x0E,0xFF,0xFF,0xCD,0xF6,0xFF,0x4B,0xE6,0xFF,0x6C,0xE6,0xFF,0xCD,0xEE,0xFF,0x6C,0xE6,0xFF,0xCE,0xEE,0xFF,0xEE,0xF6,0xFF,0xAE,0xEE,0xFF,0xCE,0xEE,0xFF,0x0F,0xF7,0xFF,0x49,0xA4,0xFF,0x00,0x48,0xFF,0x02,0x6A,0xFF,0x64,0x7A,0xFF,0xE1,0x71,0xFF,0x64,0x82,0xFF,0x68,0x93,0xFF,0xAC,0xB4,0xFF,0x4E,0xC5,0xFF,0xCF,0xD5,0xFF,0x71,0xE6,0xFF,0x12,0xF7,0xFF,0x53,0xFF,0xFF,0x73,0xFF,0xFF,0x94,0xFF,0xFF,0x53,0xFF,0xFF,0x33,0xFF,0xFF,0x12,0xF7,0xFF,0xD2,0xEE,0xFF,0x51,0xDE,0xFF,0x11,0xCE,0xFF,0x2F,0xB5,0xFF,0x6C,0xA4,0xFF,0xEF,0xAC,0xFF,0x71,0xBD,0xFF,0x92,0xBD,0xFF,0xF0,0xAC,0xFF,0x2D,0x9C,0xFF,0x2A,0x7B,0xFF,0xA8,0x6A,0xFF,0x46,0x62,0xFF,
-    0x25,0x62,0xFF,0x05,0x62,0xFF,0x87,0x72,0xFF,0x87,0x6A,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0xE5,0x51,0xFF,0x26,0x5A,0xFF,0xCC,0x93,0xFF,0x09,0x73,0xFF,0x47,0x6A,0xFF,0x06,0x62,0xFF,0x05,0x5A,0xFF,0x87,0x72,0xFF,0xC8,0x7A,0xFF,0x68,0x6A,0xFF,0x89,0x6A,0xFF,0x88,0x6A,0xFF,0x07,0x52,0xFF,0x23,0x39,0xFF,0xC9,0x72,0xFF,0x47,0x6A,0xFF,0xE6,0x59,0xFF,0x47,0x5A,0xFF,0x27,0x5A,0xFF,0x68,0x62,0xFF,0xC5,0x49,0xFF,0xE2,0x30,0xFF,0xE1,0x30,0xFF,0x43,0x39,0xFF,0x63,0x41,0xFF,0x83,0x49,0xFF,0xC5,0x51,0xFF,0x05,0x5A,0xFF,0x26,0x5A,0xFF,0x66,0x62,0xFF,0x46,0x5A,0xFF,0xE5,0x49,0xFF,0x63,0x39,0xFF,0x81,0x18,0xFF,0x40,0x10,0xFF,0xE6,0x51,0xFF,0xE6,0x51,0xFF,0x88,0x62,0xFF,0x8C,0x83,0xFF,0x06,0x5A,0xFF,0xA8,0x6A,0xFF,0xE2,0x28,0xFF,0x80,0x18,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x24,0x21,0xFF,0x08,0x3A,0xFF,0x08,0x3A,0xFF,0x24,0x21,0xFF,0x65,0x29,0xFF,0x20,0x00,0xFF,0xC2,0x18,0xFF,0x44,0x29,0xFF,0x64,0x29,0xFF,0x65,0x29,0xFF,0x65,0x29,0xFF,0x65,0x29,0xFF,0xA6,0x31,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0xE8,0x39,0xFF,0xC8,0x31,0xFF,0xE8,0x39,0xFF,0x09,0x3A,0xFF,0x6A,0x4A,0xFF,0x66,0x29,0xFF,0x66,0x29,0xFF,0xC7,0x39,0xFF,0xA6,0x31,0xFF,0xA6,0x39,0xFF,0x07,0x42,0xFF,0x28,0x52,0xFF,0x09,0x7B,0xFF,0x2C,0xA4,0xFF,0xAD,0xBC,0xFF,0xCC,0xC4,0xFF,0xCC,0xC4,0xFF,0xCC,0xC4,0xFF,0x8B,0xBC,0xFF,0xAC,0xBC,0xFF,0xCA,0xA3,0xFF,0x67,0x9B,0xFF,0xC6,0xAB,0xFF,0x85,0xAB,0xFF,0xA5,0xAB,0xFF,0x85,0xAB,0xFF,0xC6,0xB3,0xFF,0xA8,0xCC,0xFF,0xC8,0xCC,0xFF,0x06,0xB4,0xFF,0x65,0x9B,0xFF,0x67,0xC4,0xFF,0xA7,0xCC,0xFF,0xA7,0xCC,0xFF,0xC8,0xCC,0xFF,0xC8,0xCC,0xFF,0x46,0xBC,0xFF,0x06,0xB4,0xFF,
-    0xE5,0xB3,0xFF,0x88,0xC4,0xFF,0x47,0xBC,0xFF,0x07,0xB4,0xFF,0x84,0x82,0xFF,0xC5,0x7A,0xFF,0x6C,0xCD,0xFF,0x8E,0xEE,0xFF,0xAD,0xF6,0xFF,0xAD,0xEE,0xFF,0xAD,0xEE,0xFF,0xEE,0xEE,0xFF,0xEE,0xEE,0xFF,0x0F,0xF7,0xFF,0xCE,0xEE,0xFF,0x0F,0xF7,0xFF,0xCF,0xEE,0xFF,0xC8,0x9B,0xFF,0x47,0x93,0xFF,0x09,0xAC,0xFF,0x6A,0xB4,0xFF,0xCC,0xC4,0xFF,0xAF,0xDD,0xFF,0x91,0xEE,0xFF,0xD3,0xF6,0xFF,0xF3,0xF6,0xFF,0xF3,0xF6,0xFF,0x13,0xF7,0xFF,0x13,0xF7,0xFF,0xD2,0xEE,0xFF,0xB3,0xE6,0xFF,0x92,0xDE,0xFF,0x11,0xD6,0xFF,0x6F,0xBD,0xFF,0x6C,0x9C,0xFF,0x29,0x7B,0xFF,0x87,0x6A,0xFF,0x05,0x5A,0xFF,0x66,0x6A,0xFF,0xEF,0xB4,0xFF,0xEF,0xAC,0xFF,0x4D,0x9C,0xFF,0x6A,0x83,0xFF,0xE8,0x7A,0xFF,0x87,0x6A,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x46,0x6A,0xFF,0x46,0x6A,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x46,0x62,0xFF,0x06,0x5A,0xFF,0x43,0x41,0xFF,0x05,0x5A,0xFF,0x26,0x5A,0xFF,0x47,0x62,0xFF,0x27,0x62,0xFF,0xE6,0x59,0xFF,0x67,0x6A,0xFF,0xA8,0x72,0xFF,0xA9,0x72,0xFF,
-    0x88,0x6A,0xFF,0x47,0x62,0xFF,0xC5,0x49,0xFF,0x43,0x39,0xFF,0xC9,0x72,0xFF,0x47,0x6A,0xFF,0x26,0x62,0xFF,0x27,0x62,0xFF,0x27,0x5A,0xFF,0x47,0x5A,0xFF,0xA4,0x49,0xFF,0xE5,0x51,0xFF,0x05,0x5A,0xFF,0x46,0x62,0xFF,0x87,0x6A,0xFF,0x86,0x72,0xFF,0x46,0x6A,0xFF,0x45,0x6A,0xFF,0x86,0x72,0xFF,0xC7,0x7A,0xFF,0xA6,0x72,0xFF,0x45,0x5A,0xFF,0x84,0x41,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x88,0x62,0xFF,0x27,0x5A,0xFF,0x0A,0x73,0xFF,0xB1,0xAC,0xFF,0x2A,0x7B,0xFF,0x88,0x62,0xFF,0x60,0x18,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x03,0x21,0xFF,0xE7,0x39,0xFF,0x45,0x21,0xFF,0x24,0x21,0xFF,0xA6,0x31,0xFF,
-    0x20,0x08,0xFF,0xA1,0x10,0xFF,0x44,0x29,0xFF,0xA5,0x31,0xFF,0xC5,0x31,0xFF,0xA6,0x31,0xFF,0xA5,0x31,0xFF,0x65,0x29,0xFF,0x45,0x29,0xFF,0xA6,0x31,0xFF,0xC7,0x31,0xFF,0xC8,0x39,0xFF,0xE8,0x39,0xFF,0xE8,0x31,0xFF,0xC7,0x31,0xFF,0x45,0x21,0xFF,0x45,0x29,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xE7,0x39,0xFF,0xE7,0x41,0xFF,0x48,0x52,0xFF,0x68,0x5A,0xFF,0xA7,0x6A,0xFF,0xEB,0x9B,0xFF,0xAC,0xBC,0xFF,0xCD,0xC4,0xFF,0x8B,0xBC,0xFF,0x6B,0xB4,0xFF,0x6B,0xBC,0xFF,0x8B,0xBC,0xFF,0xAB,0xC4,0xFF,0x28,0xB4,0xFF,0x86,0x9B,0xFF,0x25,0x93,0xFF,0xE4,0x92,0xFF,0x05,0x93,0xFF,0x43,0x7A,0xFF,0x61,0x61,0xFF,0x28,0xB4,0xFF,0xE8,0xCC,0xFF,0x87,0xC4,0xFF,0x46,0xBC,0xFF,0x29,0xD5,0xFF,0xA7,0xC4,0xFF,0x06,0xB4,0xFF,0x27,0xBC,0xFF,0xA4,0xAB,0xFF,0x68,0xBC,0xFF,0xC9,0xC4,0xFF,0xC6,0xAB,0xFF,0x86,0xA3,0xFF,0x80,0x48,0xFF,0xA0,0x50,0xFF,0xA4,0x7A,0xFF,0x69,0xAC,0xFF,0xAD,0xCD,0xFF,0xAF,0xE6,0xFF,0x30,0xF7,0xFF,0x10,0xF7,0xFF,0xCF,0xEE,0xFF,0xD0,0xF6,0xFF,0xB0,0xEE,0xFF,
-    0x2E,0xE6,0xFF,0xCE,0xE5,0xFF,0x0F,0xEE,0xFF,0xEE,0xED,0xFF,0xCE,0xE5,0xFF,0x6E,0xDD,0xFF,0x6D,0xD5,0xFF,0x6E,0xD5,0xFF,0x8F,0xD5,0xFF,0x52,0xE6,0xFF,0xD4,0xEE,0xFF,0x32,0xD6,0xFF,0x90,0xC5,0xFF,0x8D,0xA4,0xFF,0xCB,0x8B,0xFF,0xE8,0x72,0xFF,0x87,0x6A,0xFF,0x66,0x62,0xFF,0x87,0x6A,0xFF,0xA7,0x72,0xFF,0xA7,0x6A,0xFF,0x83,0x49,0xFF,0xA8,0x6A,0xFF,0xA8,0x72,0xFF,0x8B,0x8B,0xFF,0x09,0x7B,0xFF,0x87,0x72,0xFF,0xA8,0x72,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x88,0x6A,0xFF,0xE8,0x7A,0xFF,0x08,0x7B,0xFF,0x67,0x6A,0xFF,0x46,0x6A,0xFF,0x46,0x62,0xFF,0x67,0x6A,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0x27,0x62,0xFF,0x26,0x62,0xFF,0x06,0x5A,0xFF,0x27,0x5A,0xFF,0x27,0x62,0xFF,0x27,0x62,0xFF,0x47,0x62,0xFF,0x68,0x62,0xFF,0x07,0x5A,0xFF,0x64,0x41,0xFF,0x03,0x31,0xFF,0x60,0x18,0xFF,0x64,0x41,0xFF,0x88,0x6A,0xFF,0x27,0x62,0xFF,0x27,0x62,0xFF,0x27,0x62,0xFF,0xE6,0x51,0xFF,0x67,0x62,0xFF,0x46,0x62,0xFF,0x66,0x6A,0xFF,0x45,0x6A,0xFF,0x45,0x6A,0xFF,0xA6,0x7A,0xFF,0xA6,0x7A,0xFF,
-    0xC6,0x82,0xFF,0x06,0x8B,0xFF,0x27,0x93,0xFF,0x47,0x93,0xFF,0x48,0x8B,0xFF,0xA7,0x6A,0xFF,0x84,0x41,0xFF,0x60,0x10,0xFF,0x03,0x29,0xFF,0xA9,0x6A,0xFF,0xE6,0x51,0xFF,0xA5,0x49,0xFF,0x06,0x5A,0xFF,0xA8,0x6A,0xFF,0x68,0x62,0xFF,0x00,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xE2,0x18,0xFF,0xC7,0x31,0xFF,0x66,0x29,0xFF,0x86,0x31,0xFF,0xC6,0x39,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0x23,0x21,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x06,0x42,0xFF,0x07,0x42,0xFF,0xC6,0x39,0xFF,0xA5,0x31,0xFF,0x24,0x21,0xFF,0x65,0x29,0xFF,0xC7,0x39,0xFF,0xC8,0x31,0xFF,0xA7,0x31,0xFF,0x66,0x29,0xFF,
-    0x45,0x29,0xFF,0x86,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0x07,0x42,0xFF,0x07,0x4A,0xFF,0x27,0x52,0xFF,0x07,0x52,0xFF,0x87,0x62,0xFF,0x0B,0x9C,0xFF,0xEE,0xBC,0xFF,0xAD,0xBC,0xFF,0x8C,0xB4,0xFF,0x6B,0xB4,0xFF,0xAC,0xBC,0xFF,0xCC,0xC4,0xFF,0x4B,0xB4,0xFF,0xE7,0x82,0xFF,0x20,0x51,0xFF,0xC0,0x50,0xFF,0xE0,0x50,0xFF,0x28,0xAC,0xFF,0xE9,0xCC,0xFF,0xA8,0xC4,0xFF,0xE5,0xAB,0xFF,0xC5,0xAB,0xFF,0x67,0xBC,0xFF,0xE6,0xAB,0xFF,0x89,0xC4,0xFF,0xA5,0xAB,0xFF,0x44,0xA3,0xFF,0x0A,0xCD,0xFF,0xCA,0xC4,0xFF,0xE6,0xB3,0xFF,0xCA,0xC4,0xFF,0x40,0x51,0xFF,0x20,0x30,0xFF,0xA3,0x51,0xFF,0x45,0x72,0xFF,0x26,0x8B,0xFF,0x29,0xAC,0xFF,0x6D,0xD5,0xFF,0xCD,0xDD,0xFF,0xAD,0xDD,0xFF,0x8D,0xD5,0xFF,0x4D,0xD5,0xFF,0x2C,0xD5,0xFF,0x4D,0xD5,0xFF,0xCF,0xDD,0xFF,0xAF,0xDD,0xFF,0x4E,0xD5,0xFF,0x8F,0xD5,0xFF,0xB1,0xD5,0xFF,0x12,0xDE,0xFF,0x54,0xE6,0xFF,0x34,0xDE,0xFF,0xCF,0xAC,0xFF,0x86,0x6A,0xFF,0x25,0x62,0xFF,0x26,0x62,0xFF,0x46,0x62,0xFF,0x87,0x6A,0xFF,
-    0x87,0x6A,0xFF,0xA7,0x6A,0xFF,0xA7,0x6A,0xFF,0xA7,0x6A,0xFF,0x67,0x62,0xFF,0x63,0x41,0xFF,0xA8,0x6A,0xFF,0x84,0x49,0xFF,0xB0,0xAC,0xFF,0x2E,0x9C,0xFF,0x26,0x62,0xFF,0x67,0x6A,0xFF,0x47,0x62,0xFF,0x26,0x5A,0xFF,0xE5,0x51,0xFF,0x09,0x7B,0xFF,0xCE,0xB4,0xFF,0x8E,0xAC,0xFF,0x46,0x6A,0xFF,0xE5,0x59,0xFF,0x26,0x62,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0x88,0x6A,0xFF,0x47,0x62,0xFF,0xE6,0x59,0xFF,0xE6,0x51,0xFF,0xA5,0x49,0xFF,0x84,0x41,0xFF,0x23,0x39,0xFF,0xE2,0x30,0xFF,0xE2,0x30,0xFF,0x23,0x31,0xFF,0xA1,0x20,0xFF,0x20,0x10,0xFF,0x84,0x41,0xFF,0x88,0x6A,0xFF,0x06,0x5A,0xFF,0xC5,0x59,0xFF,0xC5,0x59,0xFF,0x06,0x5A,0xFF,0x29,0x83,0xFF,0xA7,0x72,0xFF,0x45,0x6A,0xFF,0x65,0x72,0xFF,0x86,0x7A,0xFF,0xA5,0x7A,0xFF,0x48,0x93,0xFF,0xA9,0xA3,0xFF,0xC9,0xAB,0xFF,0xE9,0xAB,0xFF,0x06,0x93,0xFF,0x45,0x72,0xFF,0xE4,0x59,0xFF,0x22,0x31,0xFF,0x20,0x10,0xFF,0x44,0x39,0xFF,0xC9,0x6A,0xFF,0x68,0x62,0xFF,0x84,0x41,0xFF,0x06,0x52,0xFF,0xA8,0x6A,0xFF,0x68,0x5A,0xFF,0x00,0x00,0xFF,
-    0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0xA1,0x10,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xC7,0x31,0xFF,0x07,0x42,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x44,0x29,0xFF,0x65,0x31,0xFF,0x44,0x29,0xFF,0xC6,0x39,0xFF,0xE6,0x39,0xFF,0x07,0x42,0xFF,0xE7,0x41,0xFF,0xA5,0x31,0xFF,0x44,0x29,0xFF,0x03,0x21,0xFF,0x24,0x21,0xFF,0x66,0x29,0xFF,0xC8,0x39,0xFF,0xC7,0x31,0xFF,0x86,0x31,0xFF,0x87,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xA7,0x31,0xFF,0xC7,0x39,0xFF,0xE7,0x39,0xFF,0x07,0x42,0xFF,0x07,0x42,0xFF,0xE7,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x49,0xFF,0xE9,0x72,0xFF,0x0C,0x9C,0xFF,0x8D,0xB4,0xFF,0x4C,0xB4,0xFF,
-    0x8C,0xB4,0xFF,0xAC,0xBC,0xFF,0xCD,0xBC,0xFF,0xCD,0xC4,0xFF,0x8C,0xB4,0xFF,0x28,0x8B,0xFF,0xA8,0x9B,0xFF,0x4B,0xD5,0xFF,0x26,0xB4,0xFF,0xA8,0xC4,0xFF,0x26,0xB4,0xFF,0x88,0xBC,0xFF,0x85,0xA3,0xFF,0x48,0xB4,0xFF,0x68,0xBC,0xFF,0xE6,0xAB,0xFF,0xC9,0xC4,0xFF,0x2E,0xE6,0xFF,0xE6,0xAB,0xFF,0x0B,0xCD,0xFF,0xCD,0xE5,0xFF,0x6A,0xBC,0xFF,0xAC,0xC4,0xFF,0x0C,0xD5,0xFF,0x0C,0xD5,0xFF,0xEC,0xCC,0xFF,0xEC,0xCC,0xFF,0xEC,0xCC,0xFF,0xEC,0xCC,0xFF,0x0D,0xCD,0xFF,0xED,0xC4,0xFF,0x6F,0xD5,0xFF,0xB0,0xD5,0xFF,0x6F,0xCD,0xFF,0x8C,0xAC,0xFF,0xAD,0xB4,0xFF,0x90,0xCD,0xFF,0x2F,0xC5,0xFF,0x8E,0xAC,0xFF,0x0C,0x9C,0xFF,0x29,0x7B,0xFF,0x45,0x6A,0xFF,0x08,0x83,0xFF,0x87,0x6A,0xFF,0x87,0x6A,0xFF,0x87,0x6A,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x87,0x62,0xFF,0x88,0x62,0xFF,0x26,0x52,0xFF,0x64,0x41,0xFF,0xA8,0x6A,0xFF,0x43,0x39,0xFF,0x47,0x5A,0xFF,0x67,0x62,0xFF,0x06,0x5A,0xFF,0x46,0x62,0xFF,0x67,0x62,0xFF,0x06,0x52,0xFF,0x84,0x41,0xFF,0x00,0x20,0xFF,
-    0x46,0x5A,0xFF,0xB2,0xC5,0xFF,0xF3,0xCD,0xFF,0x46,0x62,0xFF,0xE5,0x59,0xFF,0x47,0x62,0xFF,0x67,0x6A,0xFF,0x67,0x62,0xFF,0xE6,0x51,0xFF,0x23,0x39,0xFF,0x63,0x41,0xFF,0x43,0x41,0xFF,0x84,0x49,0xFF,0xC4,0x51,0xFF,0xE5,0x59,0xFF,0xC4,0x51,0xFF,0x63,0x41,0xFF,0xA1,0x20,0xFF,0x20,0x10,0xFF,0xA5,0x49,0xFF,0xA8,0x6A,0xFF,0xC5,0x51,0xFF,0xE5,0x59,0xFF,0x87,0x72,0xFF,0x67,0x6A,0xFF,0x09,0x83,0xFF,0x86,0x72,0xFF,0x65,0x72,0xFF,0x07,0x8B,0xFF,0x48,0x93,0xFF,0x88,0xA3,0xFF,0x67,0x9B,0xFF,0x47,0x9B,0xFF,0x47,0x9B,0xFF,0x06,0x8B,0xFF,0xC6,0x82,0xFF,0xA6,0x72,0xFF,0x05,0x5A,0xFF,0x23,0x31,0xFF,0x00,0x08,0xFF,0x85,0x41,0xFF,0xE9,0x72,0xFF,0xA8,0x6A,0xFF,0x47,0x62,0xFF,0x47,0x62,0xFF,0xC9,0x6A,0xFF,0x48,0x52,0xFF,0x00,0x00,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x80,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0x86,0x31,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0x08,0x42,0xFF,0xC2,0x18,0xFF,0x81,0x10,0xFF,0x64,0x29,0xFF,0xC5,0x39,0xFF,0xC6,0x39,0xFF,0xE6,0x41,0xFF,0x07,0x42,0xFF,0x48,0x4A,0xFF,0x27,0x4A,0xFF,0x07,0x42,0xFF,0xC6,0x39,0xFF,0x64,0x29,0xFF,0x24,0x29,0xFF,0x65,0x29,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0x86,0x31,0xFF,0x66,0x29,0xFF,0x86,0x31,0xFF,0xA7,0x31,0xFF,0xE7,0x39,0xFF,0xE7,0x41,0xFF,0xE7,0x41,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x41,0xFF,0xC6,0x41,0xFF,0x68,0x5A,0xFF,0x4A,0x7B,0xFF,0xEB,0x9B,0xFF,0x8D,0xB4,0xFF,0xAD,0xBC,0xFF,0x6C,0xB4,0xFF,0x4C,0xAC,0xFF,0x8C,0xB4,0xFF,0xED,0xC4,0xFF,0x2D,0xC5,0xFF,0x0A,0xC5,0xFF,0xA5,0xA3,0xFF,0x88,0xBC,0xFF,0xC9,0xC4,0xFF,0xE6,0xAB,0xFF,0xC6,0xA3,0xFF,0x07,0xB4,0xFF,0x68,0xBC,0xFF,0xA9,0xC4,0xFF,
-    0x0A,0xCD,0xFF,0x0B,0xCD,0xFF,0x49,0xBC,0xFF,0x8A,0xC4,0xFF,0x6A,0xC4,0xFF,0xCB,0xCC,0xFF,0x0D,0xD5,0xFF,0x0D,0xCD,0xFF,0xED,0xC4,0xFF,0x2A,0xAC,0xFF,0xEA,0xA3,0xFF,0x4F,0xC5,0xFF,0x70,0xCD,0xFF,0x50,0xC5,0xFF,0x4C,0xA4,0xFF,0x6C,0xAC,0xFF,0xCA,0x9B,0xFF,0xA6,0x72,0xFF,0x42,0x41,0xFF,0xE1,0x30,0xFF,0x66,0x6A,0xFF,0x45,0x6A,0xFF,0xA4,0x51,0xFF,0x21,0x49,0xFF,0x00,0x41,0xFF,0x46,0x62,0xFF,0xE8,0x7A,0xFF,0x26,0x62,0xFF,0x46,0x62,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x88,0x62,0xFF,0x88,0x62,0xFF,0x88,0x62,0xFF,0x88,0x62,0xFF,0x06,0x4A,0xFF,0x64,0x41,0xFF,0xE9,0x72,0xFF,0x26,0x5A,0xFF,0x84,0x49,0xFF,0x26,0x62,0xFF,0x67,0x6A,0xFF,0x47,0x62,0xFF,0x67,0x62,0xFF,0x06,0x52,0xFF,0x43,0x39,0xFF,0x80,0x20,0xFF,0x80,0x28,0xFF,0x87,0x62,0xFF,0xD7,0xE6,0xFF,0x51,0xB5,0xFF,0xE4,0x59,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x27,0x62,0xFF,0x63,0x49,0xFF,0xC4,0x51,0xFF,0x05,0x5A,0xFF,0x46,0x62,0xFF,0x46,0x6A,0xFF,0x25,0x62,0xFF,0xE4,0x59,0xFF,0xC4,0x51,0xFF,
-    0x63,0x41,0xFF,0xC1,0x20,0xFF,0x20,0x10,0xFF,0xA5,0x49,0xFF,0x88,0x6A,0xFF,0x63,0x49,0xFF,0x6F,0xAC,0xFF,0x6E,0xAC,0xFF,0x66,0x72,0xFF,0x49,0x8B,0xFF,0xE6,0x82,0xFF,0x85,0x7A,0xFF,0x07,0x8B,0xFF,0x27,0x93,0xFF,0xA5,0x82,0xFF,0xC5,0x82,0xFF,0x47,0x93,0xFF,0xA9,0xA3,0xFF,0x07,0x8B,0xFF,0xC6,0x82,0xFF,0x45,0x6A,0xFF,0xC4,0x51,0xFF,0x02,0x31,0xFF,0x20,0x10,0xFF,0xC5,0x49,0xFF,0xC9,0x72,0xFF,0x88,0x6A,0xFF,0x67,0x6A,0xFF,0x88,0x6A,0xFF,0xC9,0x6A,0xFF,0x27,0x4A,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x40,0x08,0xFF,0xA6,0x31,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0x49,0x4A,0xFF,
-    0x03,0x21,0xFF,0x20,0x00,0xFF,0x23,0x29,0xFF,0x06,0x42,0xFF,0x48,0x4A,0xFF,0x07,0x42,0xFF,0x27,0x42,0xFF,0x07,0x42,0xFF,0x07,0x42,0xFF,0x07,0x42,0xFF,0x06,0x42,0xFF,0x07,0x42,0xFF,0x69,0x4A,0xFF,0xC7,0x39,0xFF,0x08,0x42,0xFF,0xE7,0x39,0xFF,0x86,0x31,0xFF,0x45,0x29,0xFF,0x66,0x29,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xA7,0x31,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xC7,0x39,0xFF,0xA6,0x39,0xFF,0xC6,0x39,0xFF,0xA6,0x39,0xFF,0x07,0x42,0xFF,0xCA,0x62,0xFF,0xCD,0x8B,0xFF,0x6E,0xA4,0xFF,0xCF,0xB4,0xFF,0x2F,0xC5,0xFF,0x0F,0xC5,0xFF,0xAD,0xB4,0xFF,0x4B,0xAC,0xFF,0x6B,0xAC,0xFF,0xCC,0xBC,0xFF,0xCB,0xBC,0xFF,0xCA,0xC4,0xFF,0xAA,0xBC,0xFF,0x8A,0xBC,0xFF,0x8A,0xBC,0xFF,0xAB,0xC4,0xFF,0x8A,0xC4,0xFF,0x6A,0xBC,0xFF,0x4A,0xBC,0xFF,0xAB,0xC4,0xFF,0xEC,0xC4,0xFF,0x8C,0xBC,0xFF,0xAD,0xBC,0xFF,0x50,0xC5,0xFF,0xD2,0xD5,0xFF,0xD2,0xCD,0xFF,0xB2,0xCD,0xFF,0xD2,0xCD,0xFF,0x08,0x73,0xFF,0x05,0x5A,0xFF,0x46,0x5A,0xFF,0x26,0x5A,0xFF,0x46,0x62,0xFF,0xA7,0x7A,0xFF,
-    0xC7,0x7A,0xFF,0x26,0x62,0xFF,0xA4,0x49,0xFF,0xE2,0x30,0xFF,0xE5,0x59,0xFF,0x05,0x62,0xFF,0x26,0x62,0xFF,0xED,0x93,0xFF,0x2E,0x9C,0xFF,0x05,0x5A,0xFF,0xA7,0x72,0xFF,0x26,0x5A,0xFF,0x47,0x62,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x88,0x62,0xFF,0x88,0x62,0xFF,0x47,0x5A,0xFF,0x67,0x5A,0xFF,0x68,0x5A,0xFF,0x06,0x4A,0xFF,0x23,0x31,0xFF,0xC9,0x72,0xFF,0xA8,0x72,0xFF,0x47,0x62,0xFF,0x26,0x62,0xFF,0x67,0x6A,0xFF,0x47,0x62,0xFF,0x47,0x5A,0xFF,0xE6,0x49,0xFF,0x23,0x29,0xFF,0x40,0x18,0xFF,0xE1,0x28,0xFF,0x00,0x20,0xFF,0x8E,0x9C,0xFF,0x92,0xC5,0xFF,0x67,0x62,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x05,0x5A,0xFF,0xE5,0x59,0xFF,0x25,0x6A,0xFF,0x25,0x6A,0xFF,0x25,0x6A,0xFF,0x45,0x72,0xFF,0x45,0x72,0xFF,0x45,0x6A,0xFF,0x05,0x5A,0xFF,0x63,0x41,0xFF,0xA1,0x20,0xFF,0x00,0x10,0xFF,0xE6,0x51,0xFF,0xA8,0x6A,0xFF,0x63,0x49,0xFF,0x29,0x83,0xFF,0x4A,0x8B,0xFF,0x87,0x72,0xFF,0xE7,0x82,0xFF,0xC6,0x82,0xFF,0xC6,0x82,0xFF,0x07,0x8B,0xFF,0xA6,0x82,0xFF,0x65,0x7A,0xFF,0xE6,0x8A,0xFF,
-    0x27,0x93,0xFF,0x27,0x93,0xFF,0x27,0x93,0xFF,0xE6,0x82,0xFF,0xA6,0x7A,0xFF,0xE4,0x51,0xFF,0x22,0x31,0xFF,0x40,0x18,0xFF,0xE6,0x51,0xFF,0x87,0x6A,0xFF,0x06,0x5A,0xFF,0x88,0x6A,0xFF,0xA8,0x6A,0xFF,0xE9,0x72,0xFF,0xC5,0x41,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x60,0x10,0xFF,0xA6,0x39,0xFF,0x08,0x42,0xFF,0x49,0x4A,0xFF,0x49,0x4A,0xFF,0x24,0x29,0xFF,0x20,0x00,0xFF,0x03,0x21,0xFF,0xC6,0x39,0xFF,0x27,0x4A,0xFF,0x27,0x4A,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,0xC6,0x39,0xFF,0xA5,0x31,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0xAA,0x52,0xFF,0xC7,0x31,0xFF,0x66,0x29,0xFF,0x86,0x29,0xFF,
-    0xC7,0x31,0xFF,0xA6,0x31,0xFF,0x03,0x21,0xFF,0x45,0x29,0xFF,0xA6,0x31,0xFF,0xC7,0x39,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xC7,0x39,0xFF,0xA6,0x31,0xFF,0xA6,0x39,0xFF,0x07,0x42,0xFF,0xC7,0x39,0xFF,0x28,0x4A,0xFF,0x4C,0x73,0xFF,0xED,0x8B,0xFF,0x6E,0xA4,0xFF,0x0F,0xBD,0xFF,0x0F,0xC5,0xFF,0xEE,0xBC,0xFF,0xAD,0xB4,0xFF,0xAD,0xB4,0xFF,0xCD,0xBC,0xFF,0x4B,0xAC,0xFF,0x6B,0xB4,0xFF,0x8C,0xBC,0xFF,0xAC,0xBC,0xFF,0x8C,0xBC,0xFF,0x6C,0xB4,0xFF,0x8D,0xB4,0xFF,0xAE,0xB4,0xFF,0x0F,0xBD,0xFF,0x71,0xC5,0xFF,0xB2,0xC5,0xFF,0xD3,0xCD,0xFF,0xB3,0xC5,0xFF,0x4D,0x9C,0xFF,0x09,0x73,0xFF,0x46,0x62,0xFF,0x8E,0xA4,0xFF,0x31,0xBD,0xFF,0xA8,0x6A,0xFF,0xC5,0x51,0xFF,0x47,0x62,0xFF,0x87,0x6A,0xFF,0x46,0x6A,0xFF,0x46,0x6A,0xFF,0x46,0x62,0xFF,0xA5,0x49,0xFF,0x02,0x29,0xFF,0x06,0x5A,0xFF,0x46,0x62,0xFF,0x06,0x5A,0xFF,0x2E,0x9C,0xFF,0x93,0xC5,0xFF,0x87,0x6A,0xFF,0x87,0x6A,0xFF,0x26,0x5A,0xFF,0x67,0x62,0xFF,0x67,0x5A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,
-    0x68,0x62,0xFF,0x68,0x62,0xFF,0x68,0x5A,0xFF,0x88,0x62,0xFF,0x47,0x52,0xFF,0x64,0x39,0xFF,0x64,0x41,0xFF,0x47,0x62,0xFF,0x88,0x72,0xFF,0x46,0x6A,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0x06,0x52,0xFF,0x84,0x39,0xFF,0x03,0x29,0xFF,0x60,0x18,0xFF,0xA0,0x20,0xFF,0xE1,0x28,0xFF,0x26,0x5A,0xFF,0x4D,0x9C,0xFF,0xA8,0x6A,0xFF,0x47,0x62,0xFF,0x47,0x62,0xFF,0x67,0x72,0xFF,0x65,0x72,0xFF,0x45,0x72,0xFF,0x86,0x7A,0xFF,0xE6,0x8A,0xFF,0xE7,0x8A,0xFF,0x07,0x8B,0xFF,0x07,0x83,0xFF,0x66,0x6A,0xFF,0x43,0x39,0xFF,0x81,0x20,0xFF,0x00,0x10,0xFF,0x06,0x52,0xFF,0x88,0x6A,0xFF,0x02,0x39,0xFF,0xC4,0x59,0xFF,0x66,0x72,0xFF,0xA7,0x7A,0xFF,0x27,0x8B,0xFF,0x88,0xA3,0xFF,0x0A,0xB4,0xFF,0xA9,0xA3,0xFF,0x27,0x93,0xFF,0x47,0x9B,0xFF,0x27,0x93,0xFF,0x47,0x93,0xFF,0x67,0x9B,0xFF,0x67,0x93,0xFF,0xC6,0x82,0xFF,0xA6,0x7A,0xFF,0xE4,0x51,0xFF,0x02,0x31,0xFF,0x40,0x18,0xFF,0x47,0x5A,0xFF,0x26,0x62,0xFF,0x47,0x6A,0xFF,0xA8,0x72,0xFF,0xA8,0x6A,0xFF,0x0A,0x73,0xFF,0x85,0x31,0xFF,0x00,0x00,0xFF,
-    0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0xA0,0x18,0xFF,0x65,0x31,0xFF,0x08,0x42,0xFF,0x29,0x42,0xFF,0x08,0x42,0xFF,0x44,0x29,0xFF,0x20,0x00,0xFF,0xC2,0x18,0xFF,0x85,0x31,0xFF,0xE6,0x41,0xFF,0x27,0x4A,0xFF,0x47,0x4A,0xFF,0x07,0x42,0xFF,0x07,0x42,0xFF,0xE6,0x39,0xFF,0x44,0x29,0xFF,0x24,0x21,0xFF,0x86,0x29,0xFF,0xC7,0x31,0xFF,0x4A,0x42,0xFF,0x29,0x3A,0xFF,0x25,0x21,0xFF,0xA6,0x31,0xFF,0x86,0x31,0xFF,0x03,0x21,0xFF,0x24,0x21,0xFF,0x65,0x31,0xFF,0x86,0x31,0xFF,0x65,0x29,0xFF,0x86,0x31,0xFF,0xA6,0x31,0xFF,0xA7,0x31,0xFF,0x86,0x31,0xFF,0x85,0x31,0xFF,0xE7,0x41,0xFF,0xE7,0x39,0xFF,0x85,0x31,0xFF,
-    0x85,0x31,0xFF,0xC6,0x39,0xFF,0x48,0x52,0xFF,0x6B,0x7B,0xFF,0x0D,0x9C,0xFF,0xAE,0xAC,0xFF,0xEF,0xBC,0xFF,0xAE,0xB4,0xFF,0x0B,0x9C,0xFF,0xEB,0x9B,0xFF,0x6C,0xAC,0xFF,0xAE,0xB4,0xFF,0xCE,0xB4,0xFF,0x30,0xBD,0xFF,0xB2,0xCD,0xFF,0x14,0xCE,0xFF,0xF4,0xCD,0xFF,0x93,0xBD,0xFF,0xF0,0xAC,0xFF,0xED,0x8B,0xFF,0x09,0x73,0xFF,0x2A,0x73,0xFF,0x87,0x6A,0xFF,0xC4,0x49,0xFF,0xE5,0x51,0xFF,0xA4,0x49,0xFF,0xE8,0x72,0xFF,0x6A,0x83,0xFF,0x26,0x5A,0xFF,0x26,0x52,0xFF,0x47,0x5A,0xFF,0x67,0x62,0xFF,0x67,0x6A,0xFF,0x26,0x62,0xFF,0x84,0x41,0xFF,0x22,0x31,0xFF,0x87,0x6A,0xFF,0x05,0x5A,0xFF,0x64,0x41,0xFF,0x05,0x5A,0xFF,0xC8,0x72,0xFF,0x26,0x62,0xFF,0x87,0x6A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x67,0x5A,0xFF,0xA8,0x6A,0xFF,0xE9,0x72,0xFF,0xE9,0x72,0xFF,0x88,0x62,0xFF,0x47,0x5A,0xFF,0xE6,0x49,0xFF,0x64,0x31,0xFF,0x20,0x08,0xFF,0x03,0x31,0xFF,0x67,0x6A,0xFF,0x87,0x72,0xFF,0x47,0x6A,0xFF,0x27,0x5A,0xFF,0xC5,0x49,0xFF,0x44,0x31,0xFF,0x03,0x21,0xFF,0xA1,0x20,0xFF,
-    0x87,0x5A,0xFF,0xA4,0x41,0xFF,0xA4,0x49,0xFF,0xAB,0x8B,0xFF,0x87,0x6A,0xFF,0x06,0x5A,0xFF,0x26,0x62,0xFF,0xC7,0x82,0xFF,0xA6,0x82,0xFF,0xA5,0x82,0xFF,0x07,0x93,0xFF,0x07,0x93,0xFF,0xE6,0x8A,0xFF,0xE7,0x8A,0xFF,0xC7,0x82,0xFF,0xC4,0x51,0xFF,0x02,0x31,0xFF,0x80,0x18,0xFF,0x00,0x08,0xFF,0x27,0x52,0xFF,0x27,0x5A,0xFF,0xC5,0x51,0xFF,0xE5,0x59,0xFF,0x46,0x6A,0xFF,0xC8,0x7A,0xFF,0x89,0x9B,0xFF,0x26,0x9B,0xFF,0x87,0xA3,0xFF,0x06,0x93,0xFF,0xE6,0x8A,0xFF,0x67,0x9B,0xFF,0xC9,0xAB,0xFF,0xC9,0xA3,0xFF,0x88,0x9B,0xFF,0x88,0x9B,0xFF,0x88,0x9B,0xFF,0xC6,0x7A,0xFF,0xE5,0x51,0xFF,0x02,0x29,0xFF,0x60,0x18,0xFF,0x67,0x62,0xFF,0x87,0x72,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0xA8,0x6A,0xFF,0x0A,0x73,0xFF,0x44,0x29,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0xA0,0x18,0xFF,0x44,0x29,0xFF,0xE7,0x41,0xFF,0x29,0x42,0xFF,0x29,0x42,0xFF,0x86,0x31,0xFF,0x20,0x00,0xFF,0xC2,0x18,0xFF,0x85,0x31,0xFF,0xA6,0x39,0xFF,0x07,0x4A,0xFF,0x48,0x52,0xFF,0x27,0x4A,0xFF,0x07,0x42,0xFF,0xC6,0x39,0xFF,0x08,0x42,0xFF,0xA7,0x31,0xFF,0x66,0x29,0xFF,0x04,0x19,0xFF,0xC8,0x31,0xFF,0xEC,0x52,0xFF,0x6A,0x42,0xFF,0x66,0x29,0xFF,0x08,0x3A,0xFF,0x44,0x29,0xFF,0x64,0x31,0xFF,0x44,0x29,0xFF,0x24,0x21,0xFF,0x45,0x29,0xFF,0x86,0x31,0xFF,0xA6,0x31,0xFF,0xA7,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xC6,0x39,0xFF,0x89,0x52,0xFF,0xA6,0x39,0xFF,0xA6,0x31,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0x68,0x52,0xFF,0x4B,0x73,0xFF,0xED,0x93,0xFF,0x0C,0x9C,0xFF,0x2D,0x9C,0xFF,0xAF,0xAC,0xFF,0x31,0xBD,0xFF,0x72,0xC5,0xFF,0x52,0xBD,0xFF,0x11,0xAD,0xFF,0x6E,0x9C,0xFF,0x8B,0x83,0xFF,
-    0xA8,0x6A,0xFF,0x06,0x5A,0xFF,0x05,0x52,0xFF,0x84,0x49,0xFF,0xC5,0x51,0xFF,0x47,0x62,0xFF,0xC9,0x72,0xFF,0x26,0x5A,0xFF,0x06,0x52,0xFF,0x06,0x52,0xFF,0x05,0x5A,0xFF,0x87,0x6A,0xFF,0x67,0x62,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x5A,0xFF,0x06,0x5A,0xFF,0x26,0x5A,0xFF,0x64,0x39,0xFF,0x43,0x31,0xFF,0xA8,0x72,0xFF,0x05,0x5A,0xFF,0xE1,0x30,0xFF,0xA4,0x49,0xFF,0xC5,0x51,0xFF,0xA4,0x49,0xFF,0x47,0x62,0xFF,0x67,0x62,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x52,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0xA5,0x49,0xFF,0x43,0x39,0xFF,0xE2,0x30,0xFF,0xE2,0x28,0xFF,0x81,0x18,0xFF,0xA1,0x18,0xFF,0x80,0x18,0xFF,0x47,0x62,0xFF,0x87,0x72,0xFF,0x87,0x6A,0xFF,0x26,0x5A,0xFF,0xA5,0x41,0xFF,0x24,0x29,0xFF,0xE3,0x20,0xFF,0x60,0x18,0xFF,0xC8,0x6A,0xFF,0xE5,0x49,0xFF,0xC5,0x49,0xFF,0xC8,0x72,0xFF,0x26,0x5A,0xFF,0x2A,0x7B,0xFF,0xC8,0x72,0xFF,0xC7,0x82,0xFF,0xC6,0x8A,0xFF,0x27,0x9B,0xFF,0x27,0x93,0xFF,0xC6,0x82,0xFF,0x65,0x7A,0xFF,0x04,0x6A,0xFF,0x05,0x62,0xFF,0x46,0x62,0xFF,
-    0x84,0x49,0xFF,0xA1,0x20,0xFF,0x40,0x10,0xFF,0x06,0x52,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x47,0x62,0xFF,0xA8,0x6A,0xFF,0x09,0x83,0xFF,0xE7,0x8A,0xFF,0xE6,0x92,0xFF,0x27,0x9B,0xFF,0x06,0x93,0xFF,0x68,0x9B,0xFF,0xC9,0xA3,0xFF,0x28,0x8B,0xFF,0xC3,0x59,0xFF,0xE7,0x7A,0xFF,0xA9,0x9B,0xFF,0x68,0x8B,0xFF,0x66,0x6A,0xFF,0x64,0x41,0xFF,0x61,0x18,0xFF,0x60,0x18,0xFF,0x87,0x6A,0xFF,0xA8,0x72,0xFF,0x66,0x62,0xFF,0xC8,0x72,0xFF,0xE8,0x72,0xFF,0xC8,0x62,0xFF,0x81,0x10,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x03,0x21,0xFF,0x08,0x42,0xFF,0xE8,0x41,0xFF,0xE8,0x39,0xFF,
-    0x66,0x31,0xFF,0x40,0x08,0xFF,0x81,0x10,0xFF,0x64,0x29,0xFF,0xE6,0x41,0xFF,0x07,0x4A,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,0xC6,0x39,0xFF,0xEB,0x5A,0xFF,0x31,0x7C,0xFF,0xEC,0x52,0xFF,0x87,0x29,0xFF,0xC3,0x10,0xFF,0x82,0x10,0xFF,0x25,0x21,0xFF,0x29,0x42,0xFF,0xE7,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0x03,0x21,0xFF,0x64,0x31,0xFF,0x64,0x31,0xFF,0x24,0x29,0xFF,0x03,0x21,0xFF,0x65,0x29,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xC7,0x39,0xFF,0x69,0x52,0xFF,0xA6,0x31,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x65,0x31,0xFF,0x85,0x31,0xFF,0x68,0x52,0xFF,0x8C,0x83,0xFF,0xF0,0xB4,0xFF,0x4E,0x9C,0xFF,0xAC,0x8B,0xFF,0xC8,0x72,0xFF,0x25,0x5A,0xFF,0xC4,0x59,0xFF,0xC4,0x51,0xFF,0x06,0x5A,0xFF,0x46,0x62,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x0E,0x94,0xFF,0x6C,0x7B,0xFF,0xC5,0x49,0xFF,0xC8,0x6A,0xFF,0x26,0x5A,0xFF,0x26,0x52,0xFF,0x06,0x52,0xFF,0x26,0x5A,0xFF,0x87,0x6A,0xFF,0x67,0x62,0xFF,0x47,0x5A,0xFF,0x26,0x52,0xFF,0x27,0x5A,0xFF,
-    0x27,0x5A,0xFF,0x26,0x5A,0xFF,0x64,0x39,0xFF,0x23,0x31,0xFF,0x87,0x72,0xFF,0x46,0x62,0xFF,0x84,0x41,0xFF,0xC5,0x49,0xFF,0x06,0x52,0xFF,0xE5,0x51,0xFF,0x67,0x62,0xFF,0x26,0x52,0xFF,0x84,0x41,0xFF,0x64,0x39,0xFF,0xE1,0x28,0xFF,0xC1,0x28,0xFF,0x01,0x39,0xFF,0x42,0x41,0xFF,0x63,0x49,0xFF,0x83,0x49,0xFF,0x83,0x41,0xFF,0xE2,0x28,0xFF,0x81,0x18,0xFF,0xA1,0x20,0xFF,0x26,0x5A,0xFF,0x87,0x6A,0xFF,0x67,0x6A,0xFF,0x26,0x5A,0xFF,0x84,0x39,0xFF,0x23,0x29,0xFF,0xC2,0x18,0xFF,0x60,0x10,0xFF,0x02,0x31,0xFF,0x02,0x31,0xFF,0xC5,0x49,0xFF,0x47,0x62,0xFF,0x84,0x49,0xFF,0x6B,0x83,0xFF,0xC8,0x72,0xFF,0xA6,0x82,0xFF,0xE6,0x92,0xFF,0xC6,0x8A,0xFF,0x07,0x8B,0xFF,0xE7,0x8A,0xFF,0x07,0x8B,0xFF,0x28,0x93,0xFF,0xE8,0x82,0xFF,0x46,0x62,0xFF,0x22,0x39,0xFF,0x60,0x18,0xFF,0x60,0x18,0xFF,0xC5,0x49,0xFF,0x06,0x4A,0xFF,0x27,0x5A,0xFF,0x88,0x62,0xFF,0xA8,0x6A,0xFF,0xE8,0x7A,0xFF,0x48,0x93,0xFF,0x27,0x93,0xFF,0xE6,0x8A,0xFF,0x48,0x93,0xFF,0x65,0x72,0xFF,0x82,0x51,0xFF,0x21,0x49,0xFF,
-    0x80,0x28,0xFF,0x46,0x62,0xFF,0x05,0x5A,0xFF,0xC4,0x49,0xFF,0x06,0x52,0xFF,0xA5,0x41,0xFF,0x81,0x18,0xFF,0x40,0x18,0xFF,0x87,0x6A,0xFF,0x66,0x6A,0xFF,0x87,0x6A,0xFF,0xC8,0x72,0xFF,0xC8,0x72,0xFF,0xC9,0x6A,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0xE2,0x18,0xFF,0x08,0x42,0xFF,0xE8,0x39,0xFF,0x08,0x3A,0xFF,0xA6,0x31,0xFF,0x60,0x08,0xFF,0xA2,0x10,0xFF,0xE3,0x18,0xFF,0x44,0x29,0xFF,0xE6,0x41,0xFF,0x48,0x4A,0xFF,0x27,0x4A,0xFF,0xA6,0x39,0xFF,0x8E,0x6B,0xFF,0x72,0x84,0xFF,0x11,0x74,0xFF,0x4E,0x5B,0xFF,0x09,0x3A,0xFF,0x25,0x21,0xFF,0xE3,0x18,0xFF,
-    0xC3,0x18,0xFF,0x45,0x21,0xFF,0x65,0x29,0xFF,0xE7,0x39,0xFF,0x44,0x29,0xFF,0x44,0x29,0xFF,0x85,0x39,0xFF,0x85,0x31,0xFF,0x64,0x31,0xFF,0x44,0x29,0xFF,0x24,0x21,0xFF,0x85,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x39,0xFF,0xE7,0x39,0xFF,0xC6,0x39,0xFF,0x65,0x29,0xFF,0xA6,0x31,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x65,0x31,0xFF,0x85,0x31,0xFF,0x07,0x42,0xFF,0x68,0x5A,0xFF,0xA8,0x72,0xFF,0xC4,0x59,0xFF,0x46,0x62,0xFF,0x46,0x62,0xFF,0x26,0x62,0xFF,0x46,0x62,0xFF,0x46,0x62,0xFF,0x26,0x5A,0xFF,0x47,0x62,0xFF,0x06,0x52,0xFF,0x85,0x41,0xFF,0x0E,0x94,0xFF,0x90,0xA4,0xFF,0xA4,0x49,0xFF,0xA8,0x6A,0xFF,0x26,0x5A,0xFF,0x06,0x52,0xFF,0x26,0x52,0xFF,0x06,0x5A,0xFF,0x67,0x62,0xFF,0x47,0x62,0xFF,0x27,0x52,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x27,0x5A,0xFF,0x27,0x5A,0xFF,0xA5,0x41,0xFF,0x02,0x31,0xFF,0x67,0x6A,0xFF,0x46,0x62,0xFF,0x06,0x52,0xFF,0x26,0x5A,0xFF,0x47,0x5A,0xFF,0xE5,0x51,0xFF,0x67,0x62,0xFF,0xA4,0x49,0xFF,0x01,0x31,0xFF,0x42,0x41,0xFF,0xA3,0x51,0xFF,0xC4,0x51,0xFF,
-    0xA3,0x51,0xFF,0xC3,0x59,0xFF,0x04,0x62,0xFF,0x05,0x62,0xFF,0xA4,0x51,0xFF,0x02,0x31,0xFF,0x81,0x18,0xFF,0xE2,0x28,0xFF,0x06,0x5A,0xFF,0x67,0x62,0xFF,0xE5,0x51,0xFF,0xE5,0x51,0xFF,0x64,0x39,0xFF,0x23,0x29,0xFF,0x03,0x21,0xFF,0xC2,0x20,0xFF,0xC1,0x28,0xFF,0x01,0x31,0xFF,0x26,0x5A,0xFF,0x47,0x62,0xFF,0xA4,0x49,0xFF,0x84,0x49,0xFF,0x05,0x62,0xFF,0xE7,0x8A,0xFF,0xA8,0xA3,0xFF,0xA8,0xA3,0xFF,0x68,0x9B,0xFF,0x27,0x93,0xFF,0xE7,0x8A,0xFF,0x65,0x72,0xFF,0xC4,0x59,0xFF,0x83,0x49,0xFF,0x02,0x31,0xFF,0x60,0x18,0xFF,0xA1,0x20,0xFF,0xC5,0x49,0xFF,0x06,0x52,0xFF,0x68,0x5A,0xFF,0xA9,0x62,0xFF,0xA8,0x6A,0xFF,0xE8,0x7A,0xFF,0x49,0x93,0xFF,0x28,0x8B,0xFF,0xE4,0x61,0xFF,0xA3,0x51,0xFF,0x86,0x72,0xFF,0x8A,0x93,0xFF,0x0C,0x9C,0xFF,0x2C,0xA4,0xFF,0xEB,0x9B,0xFF,0x89,0x93,0xFF,0x69,0x8B,0xFF,0xE8,0x72,0xFF,0xA4,0x41,0xFF,0x60,0x10,0xFF,0x02,0x29,0xFF,0xA8,0x6A,0xFF,0x66,0x62,0xFF,0xA7,0x6A,0xFF,0xA7,0x72,0xFF,0xE8,0x72,0xFF,0xA8,0x62,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,
-    0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0xA1,0x10,0xFF,0xE7,0x39,0xFF,0x08,0x42,0xFF,0xE8,0x39,0xFF,0xC7,0x39,0xFF,0x81,0x10,0xFF,0xE3,0x18,0xFF,0x45,0x29,0xFF,0xA6,0x31,0xFF,0x45,0x29,0xFF,0x85,0x31,0xFF,0x07,0x42,0xFF,0xE7,0x41,0xFF,0x49,0x42,0xFF,0xEC,0x52,0xFF,0xAF,0x6B,0xFF,0x52,0x7C,0xFF,0xD0,0x6B,0xFF,0xEC,0x52,0xFF,0x08,0x3A,0xFF,0xE7,0x39,0xFF,0x85,0x31,0xFF,0x24,0x21,0xFF,0x44,0x29,0xFF,0xE6,0x39,0xFF,0x03,0x21,0xFF,0x85,0x31,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x31,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0x65,0x29,0xFF,0xA6,0x31,0xFF,0xC6,0x39,0xFF,0xA6,0x31,0xFF,
-    0x65,0x29,0xFF,0x86,0x31,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0x85,0x31,0xFF,0x07,0x42,0xFF,0x89,0x5A,0xFF,0xC9,0x72,0xFF,0x26,0x62,0xFF,0x46,0x6A,0xFF,0x26,0x62,0xFF,0x26,0x62,0xFF,0x46,0x62,0xFF,0x67,0x6A,0xFF,0x47,0x62,0xFF,0x26,0x5A,0xFF,0xE6,0x49,0xFF,0x44,0x31,0xFF,0x06,0x52,0xFF,0x67,0x62,0xFF,0x06,0x5A,0xFF,0xC9,0x72,0xFF,0x06,0x52,0xFF,0x06,0x52,0xFF,0x47,0x5A,0xFF,0x05,0x52,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0x67,0x5A,0xFF,0x68,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x52,0xFF,0xE6,0x49,0xFF,0x44,0x31,0xFF,0x23,0x31,0xFF,0xA8,0x6A,0xFF,0x26,0x62,0xFF,0x26,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x5A,0xFF,0xC5,0x49,0xFF,0x67,0x62,0xFF,0x05,0x5A,0xFF,0xC4,0x59,0xFF,0x04,0x62,0xFF,0x45,0x6A,0xFF,0x45,0x72,0xFF,0xA6,0x7A,0xFF,0xE7,0x8A,0xFF,0xE7,0x8A,0xFF,0xA6,0x7A,0xFF,0xE4,0x59,0xFF,0x02,0x29,0xFF,0xA1,0x18,0xFF,0x02,0x31,0xFF,0xC5,0x51,0xFF,0x06,0x5A,0xFF,0xCD,0x8B,0xFF,0xA8,0x62,0xFF,0x23,0x31,0xFF,0x03,0x21,0xFF,0x44,0x31,0xFF,0xA5,0x41,0xFF,
-    0x23,0x31,0xFF,0x63,0x41,0xFF,0x26,0x62,0xFF,0x05,0x5A,0xFF,0xE5,0x59,0xFF,0x46,0x6A,0xFF,0xC6,0x82,0xFF,0xE6,0x8A,0xFF,0x26,0x93,0xFF,0x26,0x93,0xFF,0xC6,0x8A,0xFF,0xE6,0x8A,0xFF,0xE7,0x8A,0xFF,0x07,0x8B,0xFF,0xA6,0x7A,0xFF,0xE5,0x59,0xFF,0x43,0x39,0xFF,0x80,0x18,0xFF,0x02,0x29,0xFF,0x26,0x52,0xFF,0x47,0x52,0xFF,0xA9,0x62,0xFF,0xA8,0x62,0xFF,0x68,0x62,0xFF,0xE9,0x7A,0xFF,0x46,0x6A,0xFF,0x66,0x6A,0xFF,0x08,0x7B,0xFF,0x0B,0xA4,0xFF,0xAD,0xBC,0xFF,0xEE,0xBC,0xFF,0x8C,0xB4,0xFF,0xEA,0xA3,0xFF,0xC9,0xA3,0xFF,0x88,0x9B,0xFF,0x48,0x8B,0xFF,0x86,0x6A,0xFF,0x63,0x39,0xFF,0x20,0x10,0xFF,0x84,0x41,0xFF,0xC8,0x72,0xFF,0x46,0x62,0xFF,0xA7,0x6A,0xFF,0xC7,0x72,0xFF,0x08,0x73,0xFF,0x88,0x62,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x61,0x08,0xFF,0x81,0x08,0xFF,0x80,0x08,0xFF,0x80,0x08,0xFF,0x80,0x10,0xFF,0xE7,0x39,0xFF,0xC7,0x39,0xFF,0xE8,0x39,0xFF,0xE7,0x39,0xFF,0x61,0x08,0xFF,0xA2,0x10,0xFF,0x44,0x29,0xFF,0x85,0x31,0xFF,0x48,0x4A,0xFF,0x07,0x42,0xFF,0x44,0x29,0xFF,0x07,0x42,0xFF,0x28,0x42,0xFF,0x07,0x3A,0xFF,0x49,0x42,0xFF,0x4D,0x5B,0xFF,0xF0,0x73,0xFF,0xCF,0x6B,0xFF,0x8E,0x63,0xFF,0x4C,0x63,0xFF,0x85,0x31,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x03,0x21,0xFF,0x44,0x29,0xFF,0x23,0x29,0xFF,0xA5,0x39,0xFF,0xC5,0x39,0xFF,0xC5,0x39,0xFF,0xC5,0x39,0xFF,0x85,0x31,0xFF,0x64,0x29,0xFF,0x44,0x29,0xFF,0x65,0x29,0xFF,0xA5,0x31,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xC7,0x39,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0xC6,0x39,0xFF,0xE7,0x39,0xFF,0xA9,0x5A,0xFF,0x0A,0x73,0xFF,0x67,0x6A,0xFF,0x26,0x62,0xFF,0x06,0x5A,0xFF,0xE5,0x51,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x67,0x62,0xFF,
-    0x47,0x5A,0xFF,0x27,0x52,0xFF,0x03,0x29,0xFF,0xA5,0x41,0xFF,0x84,0x41,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x52,0xFF,0x27,0x52,0xFF,0x06,0x52,0xFF,0x47,0x5A,0xFF,0xA8,0x6A,0xFF,0x26,0x52,0xFF,0xE5,0x49,0xFF,0xA4,0x41,0xFF,0x63,0x39,0xFF,0x03,0x29,0xFF,0x61,0x10,0xFF,0x00,0x00,0xFF,0x44,0x31,0xFF,0xA8,0x6A,0xFF,0x06,0x5A,0xFF,0x06,0x52,0xFF,0x26,0x5A,0xFF,0x46,0x5A,0xFF,0xE6,0x51,0xFF,0xC8,0x72,0xFF,0xA7,0x72,0xFF,0x65,0x6A,0xFF,0xA6,0x7A,0xFF,0xA6,0x7A,0xFF,0x85,0x7A,0xFF,0xC6,0x82,0xFF,0xE6,0x8A,0xFF,0x86,0x7A,0xFF,0x24,0x6A,0xFF,0xA3,0x51,0xFF,0x22,0x31,0xFF,0xC1,0x20,0xFF,0x23,0x31,0xFF,0x47,0x62,0xFF,0xC5,0x49,0xFF,0x88,0x62,0xFF,0x06,0x52,0xFF,0x43,0x39,0xFF,0x23,0x29,0xFF,0x84,0x39,0xFF,0xE5,0x49,0xFF,0x27,0x5A,0xFF,0x06,0x5A,0xFF,0xE5,0x59,0xFF,0x05,0x62,0xFF,0x86,0x7A,0xFF,0x86,0x7A,0xFF,0x85,0x82,0xFF,0xE6,0x8A,0xFF,0x67,0x9B,0xFF,0xA8,0xA3,0xFF,0x09,0xAC,0xFF,0xC9,0xA3,0xFF,0xA8,0xA3,0xFF,0x47,0x93,0xFF,0x85,0x72,0xFF,0x25,0x62,0xFF,
-    0x83,0x41,0xFF,0x60,0x18,0xFF,0x23,0x31,0xFF,0xA8,0x62,0xFF,0x68,0x5A,0xFF,0xA9,0x62,0xFF,0xA9,0x62,0xFF,0x67,0x62,0xFF,0x09,0x7B,0xFF,0xCB,0x9B,0xFF,0xCA,0x9B,0xFF,0x89,0x9B,0xFF,0x48,0x93,0xFF,0x06,0x8B,0xFF,0x06,0x93,0xFF,0x67,0x9B,0xFF,0x87,0x9B,0xFF,0xC8,0xA3,0xFF,0xC9,0xA3,0xFF,0xA9,0x9B,0xFF,0xC7,0x72,0xFF,0x83,0x39,0xFF,0x20,0x08,0xFF,0xA4,0x49,0xFF,0x67,0x62,0xFF,0x25,0x5A,0xFF,0x46,0x62,0xFF,0xA7,0x72,0xFF,0x29,0x7B,0xFF,0x68,0x5A,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x80,0x08,0xFF,0x60,0x08,0xFF,0xA6,0x31,0xFF,0xC7,0x39,0xFF,0xA6,0x31,0xFF,
-    0xC7,0x39,0xFF,0xA2,0x10,0xFF,0x81,0x10,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0x07,0x42,0xFF,0x28,0x4A,0xFF,0x28,0x4A,0xFF,0xAA,0x52,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x07,0x3A,0xFF,0x68,0x4A,0xFF,0x28,0x42,0xFF,0x0C,0x5B,0xFF,0x4D,0x63,0xFF,0xC6,0x39,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0x81,0x10,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0xC6,0x41,0xFF,0x07,0x4A,0xFF,0xC6,0x41,0xFF,0xC5,0x39,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x64,0x29,0xFF,0x44,0x29,0xFF,0x44,0x29,0xFF,0x85,0x31,0xFF,0xC7,0x39,0xFF,0xA6,0x39,0xFF,0x85,0x31,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0x07,0x42,0xFF,0xA9,0x5A,0xFF,0x2A,0x7B,0xFF,0x67,0x62,0xFF,0x47,0x62,0xFF,0xE6,0x51,0xFF,0xE5,0x51,0xFF,0xE6,0x51,0xFF,0x06,0x52,0xFF,0xE6,0x51,0xFF,0x26,0x52,0xFF,0x47,0x5A,0xFF,0xC5,0x41,0xFF,0x84,0x41,0xFF,0x06,0x52,0xFF,0x47,0x5A,0xFF,0x06,0x4A,0xFF,0x27,0x52,0xFF,0x26,0x52,0xFF,0x63,0x39,0xFF,0x43,0x31,0xFF,0x22,0x31,0xFF,0x02,0x29,0xFF,0x22,0x31,0xFF,0x43,0x39,0xFF,0x84,0x39,0xFF,
-    0x43,0x31,0xFF,0xC2,0x18,0xFF,0x20,0x00,0xFF,0x44,0x31,0xFF,0x88,0x6A,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0x67,0x6A,0xFF,0x88,0x6A,0xFF,0x26,0x5A,0xFF,0x87,0x6A,0xFF,0x66,0x6A,0xFF,0x04,0x62,0xFF,0x85,0x7A,0xFF,0xC6,0x82,0xFF,0xC6,0x82,0xFF,0x27,0x93,0xFF,0x27,0x93,0xFF,0x85,0x7A,0xFF,0x04,0x6A,0xFF,0xE4,0x59,0xFF,0x63,0x41,0xFF,0xC2,0x28,0xFF,0x02,0x29,0xFF,0x47,0x5A,0xFF,0xE5,0x51,0xFF,0xA4,0x49,0xFF,0xC5,0x49,0xFF,0x84,0x41,0xFF,0x64,0x39,0xFF,0xE6,0x49,0xFF,0xA5,0x41,0xFF,0x47,0x62,0xFF,0x06,0x5A,0xFF,0xE5,0x59,0xFF,0x25,0x6A,0xFF,0xA6,0x82,0xFF,0xC6,0x82,0xFF,0x07,0x93,0xFF,0x88,0x9B,0xFF,0xE9,0xAB,0xFF,0x4A,0xB4,0xFF,0xC9,0xA3,0xFF,0x88,0x9B,0xFF,0x0A,0xAC,0xFF,0x88,0x93,0xFF,0x08,0x7B,0xFF,0x66,0x62,0xFF,0x63,0x39,0xFF,0x40,0x10,0xFF,0x43,0x39,0xFF,0xC8,0x6A,0xFF,0x88,0x62,0xFF,0x68,0x5A,0xFF,0x88,0x62,0xFF,0x68,0x62,0xFF,0xC8,0x7A,0xFF,0x27,0x8B,0xFF,0x06,0x8B,0xFF,0x46,0x93,0xFF,0x67,0x9B,0xFF,0xA8,0xA3,0xFF,0xE8,0xAB,0xFF,0x2A,0xB4,0xFF,
-    0x6A,0xB4,0xFF,0x4A,0xB4,0xFF,0xE9,0xA3,0xFF,0x68,0x8B,0xFF,0x66,0x62,0xFF,0x02,0x29,0xFF,0x40,0x10,0xFF,0xA4,0x49,0xFF,0x67,0x62,0xFF,0x05,0x5A,0xFF,0x0A,0x7B,0xFF,0xC8,0x6A,0xFF,0x09,0x7B,0xFF,0x07,0x4A,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x85,0x31,0xFF,0x28,0x42,0xFF,0xC7,0x39,0xFF,0xE7,0x41,0xFF,0xC3,0x18,0xFF,0x61,0x10,0xFF,0x03,0x21,0xFF,0xC6,0x39,0xFF,0x28,0x4A,0xFF,0xE6,0x41,0xFF,0x48,0x4A,0xFF,0xA9,0x52,0xFF,0xE2,0x18,0xFF,0x61,0x08,0xFF,0x85,0x31,0xFF,0xA6,0x31,0xFF,0x27,0x42,0xFF,0xA9,0x52,0xFF,0x07,0x42,0xFF,
-    0x24,0x21,0xFF,0xE7,0x39,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0xA1,0x18,0xFF,0x85,0x39,0xFF,0x07,0x4A,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,0xA5,0x39,0xFF,0xA5,0x31,0xFF,0x84,0x29,0xFF,0x44,0x29,0xFF,0x03,0x21,0xFF,0x44,0x29,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0x85,0x31,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0x28,0x42,0xFF,0x27,0x4A,0xFF,0xE9,0x6A,0xFF,0x26,0x5A,0xFF,0x27,0x5A,0xFF,0x06,0x52,0xFF,0xC5,0x49,0xFF,0xE6,0x49,0xFF,0x26,0x52,0xFF,0x26,0x52,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x27,0x52,0xFF,0x47,0x5A,0xFF,0xC5,0x41,0xFF,0x43,0x31,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0x43,0x31,0xFF,0x63,0x39,0xFF,0x63,0x39,0xFF,0x83,0x41,0xFF,0xC4,0x49,0xFF,0xC5,0x51,0xFF,0xC5,0x51,0xFF,0xE5,0x51,0xFF,0x63,0x39,0xFF,0xE2,0x20,0xFF,0x40,0x00,0xFF,0x23,0x31,0xFF,0x67,0x62,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0xC9,0x72,0xFF,0x88,0x6A,0xFF,0xC5,0x51,0xFF,0x46,0x62,0xFF,0x45,0x6A,0xFF,0xE4,0x61,0xFF,0x24,0x6A,0xFF,0x07,0x8B,0xFF,0x27,0x93,0xFF,
-    0x68,0x9B,0xFF,0x27,0x93,0xFF,0xE6,0x8A,0xFF,0xA6,0x7A,0xFF,0x25,0x62,0xFF,0x42,0x39,0xFF,0xE2,0x28,0xFF,0xC1,0x20,0xFF,0x02,0x31,0xFF,0x84,0x41,0xFF,0x06,0x5A,0xFF,0x06,0x5A,0xFF,0xC5,0x49,0xFF,0xA5,0x41,0xFF,0xE5,0x49,0xFF,0x43,0x39,0xFF,0x06,0x52,0xFF,0x06,0x5A,0xFF,0x25,0x6A,0xFF,0xA6,0x7A,0xFF,0x2B,0xAC,0xFF,0x4B,0xB4,0xFF,0xC9,0xA3,0xFF,0x0A,0xAC,0xFF,0x2A,0xAC,0xFF,0xC9,0xA3,0xFF,0x48,0x93,0xFF,0x07,0x83,0xFF,0xA6,0x72,0xFF,0x66,0x62,0xFF,0x46,0x5A,0xFF,0x63,0x39,0xFF,0xA1,0x20,0xFF,0x00,0x08,0xFF,0x64,0x39,0xFF,0x88,0x62,0xFF,0x68,0x5A,0xFF,0x47,0x5A,0xFF,0x68,0x5A,0xFF,0x67,0x62,0xFF,0x08,0x83,0xFF,0xA8,0xA3,0xFF,0xC8,0xAB,0xFF,0xE9,0xAB,0xFF,0x2A,0xB4,0xFF,0x29,0xB4,0xFF,0x09,0xAC,0xFF,0x09,0xAC,0xFF,0xA8,0x9B,0xFF,0x67,0x93,0xFF,0x48,0x8B,0xFF,0x49,0x83,0xFF,0x66,0x5A,0xFF,0x23,0x31,0xFF,0x00,0x08,0xFF,0x26,0x5A,0xFF,0x87,0x6A,0xFF,0xA4,0x51,0xFF,0xAC,0x8B,0xFF,0x6A,0x83,0xFF,0x2A,0x7B,0xFF,0xE6,0x41,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x60,0x08,0xFF,0x20,0x00,0xFF,0x45,0x29,0xFF,0x29,0x42,0xFF,0xA6,0x31,0xFF,0xC6,0x39,0xFF,0xE3,0x20,0xFF,0x61,0x08,0xFF,0x24,0x21,0xFF,0x65,0x31,0xFF,0xE6,0x41,0xFF,0x27,0x4A,0xFF,0x48,0x4A,0xFF,0x07,0x42,0xFF,0xC1,0x18,0xFF,0x03,0x21,0xFF,0xC6,0x39,0xFF,0x44,0x29,0xFF,0x64,0x29,0xFF,0x07,0x42,0xFF,0xA5,0x39,0xFF,0x03,0x21,0xFF,0x8A,0x52,0xFF,0x04,0x21,0xFF,0x20,0x00,0xFF,0xA2,0x10,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0x64,0x31,0xFF,0xC6,0x41,0xFF,0x07,0x42,0xFF,0x07,0x4A,0xFF,0x27,0x4A,0xFF,0xE6,0x39,0xFF,0x85,0x31,0xFF,0x64,0x29,0xFF,0x44,0x29,0xFF,
-    0x24,0x21,0xFF,0xA5,0x31,0xFF,0xC6,0x39,0xFF,0xA6,0x39,0xFF,0x86,0x31,0xFF,0xC7,0x39,0xFF,0x08,0x42,0xFF,0x07,0x4A,0xFF,0xC9,0x6A,0xFF,0x67,0x5A,0xFF,0x67,0x5A,0xFF,0x27,0x52,0xFF,0x06,0x52,0xFF,0x27,0x5A,0xFF,0x27,0x5A,0xFF,0x06,0x52,0xFF,0x47,0x5A,0xFF,0x06,0x52,0xFF,0xA5,0x41,0xFF,0x43,0x31,0xFF,0xE2,0x28,0xFF,0x02,0x29,0xFF,0x43,0x39,0xFF,0x83,0x41,0xFF,0xE5,0x51,0xFF,0x26,0x5A,0xFF,0x05,0x5A,0xFF,0x05,0x5A,0xFF,0x25,0x62,0xFF,0x25,0x62,0xFF,0x46,0x62,0xFF,0xE5,0x51,0xFF,0x43,0x39,0xFF,0xE2,0x20,0xFF,0x61,0x08,0xFF,0x44,0x31,0xFF,0x46,0x5A,0xFF,0x06,0x52,0xFF,0xA4,0x41,0xFF,0x6B,0x83,0xFF,0x2A,0x7B,0xFF,0x26,0x5A,0xFF,0x87,0x6A,0xFF,0x86,0x72,0xFF,0xA6,0x7A,0xFF,0x07,0x8B,0xFF,0xE6,0x8A,0xFF,0x27,0x93,0xFF,0x88,0x9B,0xFF,0x68,0x9B,0xFF,0xC6,0x82,0xFF,0x85,0x72,0xFF,0x25,0x62,0xFF,0x63,0x41,0xFF,0x02,0x31,0xFF,0x22,0x31,0xFF,0x22,0x31,0xFF,0xE1,0x28,0xFF,0x22,0x39,0xFF,0xE6,0x51,0xFF,0xC5,0x51,0xFF,0xA4,0x41,0xFF,0xC5,0x51,0xFF,0x06,0x5A,0xFF,
-    0xA4,0x51,0xFF,0xC4,0x59,0xFF,0xA6,0x7A,0xFF,0xA9,0x9B,0xFF,0x0A,0xA4,0xFF,0x89,0x93,0xFF,0xE7,0x82,0xFF,0x45,0x6A,0xFF,0x04,0x5A,0xFF,0x05,0x5A,0xFF,0xE8,0x7A,0xFF,0xCB,0x93,0xFF,0x0B,0x9C,0xFF,0x0B,0x9C,0xFF,0xEB,0x93,0xFF,0x66,0x62,0xFF,0x22,0x31,0xFF,0x40,0x10,0xFF,0x64,0x39,0xFF,0x68,0x62,0xFF,0x88,0x62,0xFF,0x68,0x62,0xFF,0x47,0x5A,0xFF,0x47,0x62,0xFF,0x08,0x83,0xFF,0xA9,0xA3,0xFF,0xA8,0xA3,0xFF,0x87,0xA3,0xFF,0xA8,0xA3,0xFF,0x67,0x9B,0xFF,0x47,0x93,0xFF,0x47,0x93,0xFF,0x68,0x93,0xFF,0xA9,0x93,0xFF,0xEA,0x9B,0xFF,0xA9,0x8B,0xFF,0xA7,0x6A,0xFF,0x43,0x31,0xFF,0x00,0x10,0xFF,0x26,0x5A,0xFF,0x46,0x62,0xFF,0x43,0x39,0xFF,0x05,0x5A,0xFF,0x87,0x6A,0xFF,0x2A,0x7B,0xFF,0xA5,0x39,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x24,0x21,0xFF,0x08,0x42,0xFF,0x86,0x31,0xFF,0xC6,0x39,0xFF,0x24,0x29,0xFF,0x61,0x08,0xFF,0x44,0x29,0xFF,0x85,0x31,0xFF,0x65,0x31,0xFF,0xC6,0x41,0xFF,0x48,0x4A,0xFF,0xE6,0x41,0xFF,0xE1,0x20,0xFF,0x65,0x29,0xFF,0xC6,0x39,0xFF,0x64,0x29,0xFF,0x43,0x29,0xFF,0x23,0x29,0xFF,0x64,0x31,0xFF,0x40,0x08,0xFF,0x69,0x4A,0xFF,0x08,0x42,0xFF,0x00,0x00,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0x43,0x29,0xFF,0x64,0x31,0xFF,0xC6,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x39,0xFF,0xE6,0x39,0xFF,0xA5,0x31,0xFF,0x64,0x29,0xFF,0x85,0x31,0xFF,0xA6,0x39,0xFF,0x86,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xE6,0x41,0xFF,0x88,0x5A,0xFF,0x47,0x5A,0xFF,0x68,0x5A,0xFF,0x68,0x5A,0xFF,0x27,0x5A,0xFF,0x26,0x5A,0xFF,0x06,0x5A,0xFF,0x26,0x5A,0xFF,
-    0x47,0x5A,0xFF,0x23,0x31,0xFF,0xE2,0x30,0xFF,0x63,0x39,0xFF,0x84,0x41,0xFF,0xA4,0x49,0xFF,0xE5,0x51,0xFF,0x05,0x5A,0xFF,0x46,0x62,0xFF,0x87,0x72,0xFF,0x86,0x72,0xFF,0x65,0x6A,0xFF,0xE7,0x7A,0xFF,0xC7,0x7A,0xFF,0x25,0x6A,0xFF,0xC4,0x51,0xFF,0x43,0x39,0xFF,0xE2,0x20,0xFF,0x40,0x08,0xFF,0x43,0x31,0xFF,0x67,0x62,0xFF,0xA4,0x41,0xFF,0x63,0x39,0xFF,0xA4,0x49,0xFF,0x46,0x5A,0xFF,0x06,0x52,0xFF,0xC8,0x72,0xFF,0x28,0x8B,0xFF,0x48,0x93,0xFF,0x08,0x8B,0xFF,0x07,0x8B,0xFF,0x47,0x93,0xFF,0x67,0x9B,0xFF,0x07,0x8B,0xFF,0xE6,0x8A,0xFF,0xE7,0x82,0xFF,0xA7,0x72,0xFF,0xA3,0x51,0xFF,0x42,0x39,0xFF,0xE1,0x30,0xFF,0x01,0x31,0xFF,0x01,0x31,0xFF,0xE1,0x30,0xFF,0xE2,0x30,0xFF,0x02,0x39,0xFF,0xE5,0x59,0xFF,0xE5,0x61,0xFF,0x66,0x72,0xFF,0x86,0x72,0xFF,0xC7,0x82,0xFF,0x28,0x8B,0xFF,0xC7,0x7A,0xFF,0x05,0x62,0xFF,0x05,0x5A,0xFF,0xE7,0x72,0xFF,0xCB,0x93,0xFF,0x6D,0xAC,0xFF,0xCE,0xBC,0xFF,0xAD,0xBC,0xFF,0x4B,0xAC,0xFF,0xEA,0xA3,0xFF,0xC9,0x9B,0xFF,0xA9,0x93,0xFF,0xA6,0x6A,0xFF,
-    0x22,0x31,0xFF,0x20,0x10,0xFF,0x84,0x39,0xFF,0x67,0x62,0xFF,0x47,0x5A,0xFF,0x67,0x5A,0xFF,0x27,0x5A,0xFF,0x47,0x62,0xFF,0x08,0x83,0xFF,0x48,0x9B,0xFF,0x47,0x9B,0xFF,0xC6,0x8A,0xFF,0xE6,0x8A,0xFF,0x06,0x8B,0xFF,0x88,0x93,0xFF,0x88,0x93,0xFF,0xA9,0x9B,0xFF,0xC9,0x9B,0xFF,0xA9,0x93,0xFF,0x07,0x73,0xFF,0x46,0x5A,0xFF,0x02,0x29,0xFF,0xA1,0x28,0xFF,0x46,0x62,0xFF,0x67,0x6A,0xFF,0xA4,0x49,0xFF,0xE5,0x59,0xFF,0xA8,0x72,0xFF,0x0A,0x73,0xFF,0x44,0x31,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x03,0x21,0xFF,0xC7,0x39,0xFF,0x66,0x29,0xFF,
-    0xC7,0x39,0xFF,0x45,0x29,0xFF,0x81,0x10,0xFF,0x23,0x21,0xFF,0x64,0x31,0xFF,0xC6,0x41,0xFF,0x07,0x4A,0xFF,0x27,0x4A,0xFF,0x27,0x4A,0xFF,0x03,0x29,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0x44,0x29,0xFF,0x23,0x29,0xFF,0x03,0x21,0xFF,0x23,0x29,0xFF,0xE2,0x20,0xFF,0x28,0x42,0xFF,0x0C,0x5B,0xFF,0xC3,0x18,0xFF,0x81,0x08,0xFF,0xA2,0x10,0xFF,0xA1,0x10,0xFF,0x03,0x21,0xFF,0x64,0x31,0xFF,0xA5,0x39,0xFF,0xC6,0x39,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,0xA5,0x31,0xFF,0xE6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x64,0x29,0xFF,0xA6,0x39,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xA6,0x31,0xFF,0xC6,0x39,0xFF,0xC6,0x41,0xFF,0x47,0x5A,0xFF,0xE6,0x49,0xFF,0x68,0x5A,0xFF,0x47,0x5A,0xFF,0x27,0x5A,0xFF,0x06,0x5A,0xFF,0x06,0x5A,0xFF,0x47,0x62,0xFF,0x84,0x41,0xFF,0x22,0x39,0xFF,0x84,0x41,0xFF,0xE5,0x51,0xFF,0xE5,0x59,0xFF,0x25,0x62,0xFF,0x45,0x6A,0xFF,0x46,0x6A,0xFF,0x86,0x72,0xFF,0xE7,0x7A,0xFF,0xC7,0x7A,0xFF,0xC7,0x82,0xFF,0xC6,0x82,0xFF,0x66,0x72,0xFF,0x25,0x62,0xFF,0xC4,0x51,0xFF,
-    0x43,0x39,0xFF,0xE2,0x20,0xFF,0x40,0x08,0xFF,0x64,0x39,0xFF,0xE9,0x72,0xFF,0xA4,0x41,0xFF,0xE2,0x28,0xFF,0x63,0x39,0xFF,0xA4,0x49,0xFF,0xC5,0x49,0xFF,0xE8,0x7A,0xFF,0x07,0x83,0xFF,0xE7,0x8A,0xFF,0x27,0x93,0xFF,0xA8,0xA3,0xFF,0x88,0x9B,0xFF,0xC6,0x8A,0xFF,0x44,0x7A,0xFF,0x24,0x72,0xFF,0x65,0x72,0xFF,0x66,0x72,0xFF,0x45,0x62,0xFF,0x25,0x62,0xFF,0x04,0x5A,0xFF,0x25,0x62,0xFF,0xE4,0x51,0xFF,0xC4,0x51,0xFF,0x83,0x49,0xFF,0xE1,0x30,0xFF,0xE5,0x51,0xFF,0xA7,0x7A,0xFF,0x66,0x72,0xFF,0xE4,0x61,0xFF,0x05,0x62,0xFF,0xC7,0x72,0xFF,0xAA,0x93,0xFF,0x8C,0xB4,0xFF,0x0D,0xC5,0xFF,0x0D,0xCD,0xFF,0x6B,0xB4,0xFF,0xC9,0xA3,0xFF,0x67,0x9B,0xFF,0x46,0x9B,0xFF,0x87,0xA3,0xFF,0xA8,0x9B,0xFF,0x87,0x93,0xFF,0x47,0x8B,0xFF,0x65,0x62,0xFF,0x62,0x39,0xFF,0x20,0x10,0xFF,0xA5,0x41,0xFF,0x67,0x62,0xFF,0x06,0x5A,0xFF,0x06,0x5A,0xFF,0x06,0x5A,0xFF,0xA8,0x6A,0xFF,0x49,0x8B,0xFF,0x07,0x8B,0xFF,0x07,0x93,0xFF,0x06,0x8B,0xFF,0x47,0x93,0xFF,0x67,0x9B,0xFF,0x88,0x9B,0xFF,0x47,0x93,0xFF,
-    0x88,0x93,0xFF,0xE9,0x9B,0xFF,0xCA,0x93,0xFF,0x69,0x83,0xFF,0x26,0x52,0xFF,0xC1,0x28,0xFF,0x80,0x28,0xFF,0x26,0x62,0xFF,0x87,0x72,0xFF,0x87,0x72,0xFF,0x87,0x6A,0xFF,0xA8,0x72,0xFF,0x2A,0x73,0xFF,0xE3,0x20,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0xC3,0x18,0xFF,0xC7,0x31,0xFF,0x66,0x29,0xFF,0xE7,0x39,0xFF,0x65,0x29,0xFF,0x60,0x08,0xFF,0xC2,0x18,0xFF,0x24,0x29,0xFF,0xC5,0x41,0xFF,0x27,0x52,0xFF,0x68,0x52,0xFF,0x48,0x52,0xFF,0x64,0x31,0xFF,0x65,0x31,0xFF,0xA5,0x31,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,
-    0xE3,0x20,0xFF,0x45,0x29,0xFF,0xEC,0x5A,0xFF,0xE7,0x39,0xFF,0x81,0x08,0xFF,0xC2,0x18,0xFF,0x61,0x10,0xFF,0xE2,0x20,0xFF,0x64,0x31,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x07,0x42,0xFF,0x27,0x42,0xFF,0xE6,0x39,0xFF,0xC6,0x39,0xFF,0xE6,0x39,0xFF,0x85,0x31,0xFF,0xC6,0x39,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xC7,0x39,0xFF,0xC6,0x39,0xFF,0xA6,0x39,0xFF,0xEA,0x6A,0xFF,0x67,0x5A,0xFF,0x67,0x5A,0xFF,0x27,0x5A,0xFF,0x06,0x5A,0xFF,0xC5,0x51,0xFF,0xE5,0x51,0xFF,0x47,0x5A,0xFF,0xC5,0x49,0xFF,0xC5,0x51,0xFF,0xE5,0x59,0xFF,0x05,0x62,0xFF,0x05,0x62,0xFF,0x05,0x62,0xFF,0x25,0x62,0xFF,0x25,0x6A,0xFF,0x86,0x72,0xFF,0x86,0x72,0xFF,0xC7,0x7A,0xFF,0xE7,0x7A,0xFF,0xE7,0x82,0xFF,0xC7,0x7A,0xFF,0x66,0x6A,0xFF,0x84,0x49,0xFF,0x02,0x29,0xFF,0xC2,0x18,0xFF,0x40,0x00,0xFF,0x84,0x39,0xFF,0xC9,0x6A,0xFF,0x26,0x52,0xFF,0x63,0x39,0xFF,0xE5,0x51,0xFF,0xE5,0x51,0xFF,0xE5,0x49,0xFF,0xA7,0x72,0xFF,0xE7,0x82,0xFF,0xC6,0x82,0xFF,0x27,0x93,0xFF,0x67,0x9B,0xFF,0x88,0xA3,0xFF,
-    0x47,0x93,0xFF,0x48,0x93,0xFF,0x48,0x93,0xFF,0x27,0x8B,0xFF,0x07,0x83,0xFF,0xC7,0x7A,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0x86,0x6A,0xFF,0x46,0x62,0xFF,0x46,0x62,0xFF,0xA4,0x49,0xFF,0xC1,0x28,0xFF,0xC1,0x30,0xFF,0xC7,0x7A,0xFF,0x49,0x93,0xFF,0x89,0x9B,0xFF,0x4B,0xB4,0xFF,0xCC,0xC4,0xFF,0x8B,0xBC,0xFF,0x29,0xB4,0xFF,0xE7,0xAB,0xFF,0x07,0xB4,0xFF,0xC7,0xAB,0xFF,0xA7,0xA3,0xFF,0x87,0xA3,0xFF,0xA8,0xA3,0xFF,0x87,0x9B,0xFF,0xC8,0xA3,0xFF,0xC9,0xA3,0xFF,0x88,0x93,0xFF,0xE7,0x7A,0xFF,0x63,0x41,0xFF,0x00,0x10,0xFF,0xC5,0x49,0xFF,0x88,0x6A,0xFF,0xE5,0x59,0xFF,0x0A,0x73,0xFF,0x88,0x6A,0xFF,0xA8,0x72,0xFF,0x28,0x8B,0xFF,0x07,0x93,0xFF,0x27,0x93,0xFF,0x47,0x9B,0xFF,0x47,0x9B,0xFF,0x67,0x9B,0xFF,0x68,0x93,0xFF,0x47,0x8B,0xFF,0x06,0x83,0xFF,0x28,0x83,0xFF,0xC7,0x72,0xFF,0x25,0x5A,0xFF,0x84,0x41,0xFF,0xA1,0x20,0xFF,0xA1,0x28,0xFF,0x87,0x6A,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0xC8,0x72,0xFF,0x0A,0x73,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0xA2,0x10,0xFF,0xA6,0x31,0xFF,0x66,0x29,0xFF,0xC7,0x39,0xFF,0x86,0x31,0xFF,0x40,0x08,0xFF,0xC2,0x18,0xFF,0x44,0x29,0xFF,0x85,0x39,0xFF,0xE6,0x49,0xFF,0x68,0x52,0xFF,0x68,0x52,0xFF,0x85,0x31,0xFF,0x03,0x21,0xFF,0x85,0x31,0xFF,0x03,0x21,0xFF,0x02,0x21,0xFF,0x23,0x29,0xFF,0x44,0x31,0xFF,0x03,0x21,0xFF,0xC2,0x18,0xFF,0x6A,0x4A,0xFF,0x49,0x42,0xFF,0xA2,0x10,0xFF,0xA2,0x10,0xFF,0xA1,0x18,0xFF,0xA1,0x18,0xFF,0x03,0x21,0xFF,0x44,0x31,0xFF,0xA5,0x39,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0xC6,0x39,0xFF,0x27,0x4A,0xFF,0x07,0x42,0xFF,
-    0xC6,0x39,0xFF,0x85,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xA6,0x31,0xFF,0xE7,0x39,0xFF,0xC6,0x39,0xFF,0xA5,0x39,0xFF,0xEA,0x6A,0xFF,0x67,0x62,0xFF,0x67,0x5A,0xFF,0x67,0x5A,0xFF,0x06,0x52,0xFF,0xA5,0x49,0xFF,0xC5,0x51,0xFF,0x67,0x62,0xFF,0x06,0x5A,0xFF,0xA4,0x51,0xFF,0x83,0x51,0xFF,0xC4,0x59,0xFF,0x05,0x62,0xFF,0x25,0x62,0xFF,0x86,0x72,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0x86,0x6A,0xFF,0xA7,0x72,0xFF,0x86,0x6A,0xFF,0x66,0x6A,0xFF,0x24,0x62,0xFF,0x45,0x62,0xFF,0x26,0x5A,0xFF,0x64,0x39,0xFF,0xC2,0x18,0xFF,0x20,0x00,0xFF,0x84,0x39,0xFF,0x88,0x62,0xFF,0x47,0x5A,0xFF,0x06,0x52,0xFF,0xE5,0x51,0xFF,0x26,0x5A,0xFF,0xE6,0x51,0xFF,0x87,0x6A,0xFF,0xC7,0x82,0xFF,0x47,0x93,0xFF,0xE9,0xAB,0xFF,0x8C,0xBC,0xFF,0xAC,0xC4,0xFF,0x4A,0xB4,0xFF,0x88,0x9B,0xFF,0x68,0x93,0xFF,0x28,0x8B,0xFF,0xE7,0x82,0xFF,0x45,0x6A,0xFF,0xA4,0x51,0xFF,0x43,0x41,0xFF,0x22,0x39,0xFF,0x63,0x41,0xFF,0x63,0x41,0xFF,0xC1,0x30,0xFF,0xC1,0x30,0xFF,0x42,0x49,0xFF,0x86,0x7A,0xFF,0xE6,0x92,0xFF,
-    0x46,0x9B,0xFF,0x08,0xB4,0xFF,0x49,0xC4,0xFF,0x89,0xC4,0xFF,0xAA,0xC4,0xFF,0x69,0xBC,0xFF,0x69,0xBC,0xFF,0x28,0xB4,0xFF,0xA7,0xA3,0xFF,0xC8,0xAB,0xFF,0x87,0xA3,0xFF,0x87,0x9B,0xFF,0xC8,0xA3,0xFF,0x87,0x9B,0xFF,0x47,0x8B,0xFF,0xC6,0x72,0xFF,0x42,0x39,0xFF,0x00,0x08,0xFF,0xE6,0x49,0xFF,0x88,0x6A,0xFF,0x43,0x41,0xFF,0xCD,0x8B,0xFF,0x4B,0x83,0xFF,0x67,0x6A,0xFF,0x28,0x8B,0xFF,0xE6,0x8A,0xFF,0xE6,0x8A,0xFF,0x88,0x9B,0xFF,0x68,0x9B,0xFF,0xA8,0x9B,0xFF,0xA8,0x9B,0xFF,0xA6,0x7A,0xFF,0x85,0x72,0xFF,0xC6,0x72,0xFF,0xC7,0x72,0xFF,0x05,0x52,0xFF,0x63,0x39,0xFF,0x81,0x20,0xFF,0xC1,0x28,0xFF,0xA8,0x72,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0xC7,0x72,0xFF,0xE8,0x72,0xFF,0xA8,0x62,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x86,0x31,0xFF,0xA7,0x31,0xFF,0x08,0x42,0xFF,0xA6,0x31,0xFF,0x20,0x08,0xFF,0xA2,0x10,0xFF,0x44,0x29,0xFF,0xC6,0x41,0xFF,0xC6,0x41,0xFF,0x69,0x52,0xFF,0x69,0x4A,0xFF,0xA6,0x39,0xFF,0x03,0x21,0xFF,0xC6,0x39,0xFF,0x24,0x29,0xFF,0xE2,0x20,0xFF,0x23,0x29,0xFF,0x64,0x31,0xFF,0xA5,0x39,0xFF,0x44,0x29,0xFF,0x08,0x42,0xFF,0x6A,0x4A,0xFF,0x03,0x19,0xFF,0x60,0x08,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0x23,0x29,0xFF,0x64,0x31,0xFF,0xA5,0x39,0xFF,0x47,0x52,0xFF,0x27,0x4A,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0x86,0x31,0xFF,0xC7,0x39,0xFF,0xC6,0x41,0xFF,0x88,0x62,0xFF,0x26,0x5A,0xFF,0x47,0x5A,0xFF,0x67,0x5A,0xFF,0x06,0x52,0xFF,0x84,0x49,0xFF,0x26,0x5A,0xFF,0xC9,0x6A,0xFF,
-    0x26,0x5A,0xFF,0xA4,0x51,0xFF,0x05,0x5A,0xFF,0xA7,0x72,0xFF,0x66,0x6A,0xFF,0x87,0x6A,0xFF,0x87,0x6A,0xFF,0x26,0x5A,0xFF,0xE4,0x51,0xFF,0x05,0x5A,0xFF,0x25,0x5A,0xFF,0x25,0x62,0xFF,0x45,0x6A,0xFF,0xA6,0x72,0xFF,0xC7,0x72,0xFF,0x46,0x62,0xFF,0xA5,0x41,0xFF,0x03,0x21,0xFF,0x00,0x00,0xFF,0x64,0x39,0xFF,0x67,0x5A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x5A,0xFF,0x06,0x52,0xFF,0x06,0x52,0xFF,0x86,0x6A,0xFF,0xE7,0x82,0xFF,0xA9,0x9B,0xFF,0x0A,0xAC,0xFF,0x4B,0xB4,0xFF,0x0A,0xAC,0xFF,0x89,0x9B,0xFF,0xC7,0x7A,0xFF,0x04,0x62,0xFF,0x83,0x51,0xFF,0x22,0x41,0xFF,0xC4,0x51,0xFF,0xE8,0x72,0xFF,0x8A,0x8B,0xFF,0xAA,0x93,0xFF,0x69,0x93,0xFF,0xE7,0x82,0xFF,0x83,0x51,0xFF,0xE1,0x40,0xFF,0xC7,0x82,0xFF,0x27,0x93,0xFF,0xC8,0xAB,0xFF,0xAA,0xC4,0xFF,0xAA,0xCC,0xFF,0x69,0xC4,0xFF,0x08,0xB4,0xFF,0x48,0xBC,0xFF,0x89,0xC4,0xFF,0x89,0xC4,0xFF,0x69,0xBC,0xFF,0x28,0xB4,0xFF,0xE8,0xAB,0xFF,0xA8,0xA3,0xFF,0xA8,0x9B,0xFF,0x88,0x9B,0xFF,0x67,0x93,0xFF,0x27,0x8B,0xFF,0x66,0x6A,0xFF,
-    0xE2,0x30,0xFF,0x00,0x08,0xFF,0x06,0x52,0xFF,0x27,0x5A,0xFF,0xC1,0x30,0xFF,0xC4,0x59,0xFF,0xE5,0x59,0xFF,0x25,0x6A,0xFF,0x08,0x8B,0xFF,0x07,0x8B,0xFF,0x47,0x9B,0xFF,0x47,0x93,0xFF,0xC6,0x82,0xFF,0xC6,0x7A,0xFF,0xC6,0x7A,0xFF,0x45,0x6A,0xFF,0x28,0x83,0xFF,0x89,0x93,0xFF,0x08,0x7B,0xFF,0x25,0x5A,0xFF,0x23,0x31,0xFF,0x81,0x20,0xFF,0x02,0x39,0xFF,0xC8,0x72,0xFF,0xA7,0x72,0xFF,0x86,0x6A,0xFF,0xC7,0x72,0xFF,0xE8,0x72,0xFF,0x27,0x52,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x85,0x31,0xFF,0xC7,0x31,0xFF,
-    0xE8,0x41,0xFF,0xC7,0x39,0xFF,0x60,0x08,0xFF,0xA2,0x10,0xFF,0x24,0x29,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0x28,0x4A,0xFF,0x69,0x52,0xFF,0xC6,0x39,0xFF,0xA2,0x18,0xFF,0x85,0x31,0xFF,0x44,0x29,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x64,0x31,0xFF,0xE7,0x39,0xFF,0x49,0x4A,0xFF,0x44,0x21,0xFF,0xC2,0x10,0xFF,0x61,0x08,0xFF,0x61,0x10,0xFF,0x03,0x21,0xFF,0xC6,0x41,0xFF,0xC6,0x41,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0x06,0x4A,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,0x85,0x31,0xFF,0x65,0x31,0xFF,0x65,0x31,0xFF,0xA7,0x31,0xFF,0x69,0x4A,0xFF,0xA6,0x39,0xFF,0xC7,0x41,0xFF,0x07,0x4A,0xFF,0x68,0x5A,0xFF,0x26,0x5A,0xFF,0x06,0x52,0xFF,0x27,0x52,0xFF,0x4B,0x7B,0xFF,0xAC,0x8B,0xFF,0xE5,0x59,0xFF,0xE9,0x72,0xFF,0x87,0x62,0xFF,0x26,0x62,0xFF,0x67,0x6A,0xFF,0x46,0x62,0xFF,0x05,0x5A,0xFF,0x26,0x5A,0xFF,0x66,0x6A,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0xC7,0x72,0xFF,0xC7,0x72,0xFF,0xE7,0x7A,0xFF,0x27,0x83,0xFF,0x27,0x83,0xFF,0xC7,0x7A,0xFF,0x25,0x62,0xFF,
-    0xC5,0x41,0xFF,0x03,0x21,0xFF,0x20,0x00,0xFF,0x43,0x31,0xFF,0x26,0x52,0xFF,0x67,0x5A,0xFF,0x67,0x5A,0xFF,0x46,0x5A,0xFF,0x26,0x5A,0xFF,0x06,0x52,0xFF,0x08,0x83,0xFF,0x69,0x93,0xFF,0x28,0x8B,0xFF,0xE7,0x82,0xFF,0x66,0x6A,0xFF,0x04,0x62,0xFF,0xE5,0x59,0xFF,0x87,0x6A,0xFF,0x49,0x83,0xFF,0xEB,0x9B,0xFF,0xAE,0xB4,0xFF,0xEE,0xC4,0xFF,0x8C,0xB4,0xFF,0x0A,0xAC,0xFF,0x27,0x93,0xFF,0xC6,0x82,0xFF,0x07,0x8B,0xFF,0xE6,0x8A,0xFF,0xC6,0x8A,0xFF,0xA8,0xA3,0xFF,0x29,0xBC,0xFF,0x8A,0xC4,0xFF,0x89,0xC4,0xFF,0xAA,0xC4,0xFF,0x69,0xC4,0xFF,0x08,0xBC,0xFF,0xE8,0xB3,0xFF,0x28,0xBC,0xFF,0x48,0xBC,0xFF,0x28,0xB4,0xFF,0x29,0xB4,0xFF,0x29,0xB4,0xFF,0xC8,0xAB,0xFF,0xC9,0xA3,0xFF,0xC9,0xA3,0xFF,0x47,0x93,0xFF,0x85,0x72,0xFF,0xC4,0x51,0xFF,0xE2,0x28,0xFF,0x20,0x10,0xFF,0x47,0x5A,0xFF,0x26,0x62,0xFF,0x22,0x41,0xFF,0x83,0x51,0xFF,0x83,0x51,0xFF,0x87,0x72,0xFF,0xC7,0x82,0xFF,0xA6,0x82,0xFF,0xA6,0x82,0xFF,0xA6,0x7A,0xFF,0x45,0x72,0xFF,0x04,0x6A,0xFF,0x07,0x83,0xFF,0x89,0x93,0xFF,
-    0x48,0x8B,0xFF,0xA7,0x72,0xFF,0x25,0x62,0xFF,0xE5,0x51,0xFF,0x02,0x31,0xFF,0x60,0x18,0xFF,0x23,0x39,0xFF,0xE9,0x7A,0xFF,0x87,0x72,0xFF,0x46,0x6A,0xFF,0x86,0x72,0xFF,0xE8,0x7A,0xFF,0x27,0x52,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x86,0x31,0xFF,0xC7,0x39,0xFF,0xE7,0x41,0xFF,0xE7,0x41,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0x23,0x21,0xFF,0xA5,0x39,0xFF,0xE6,0x41,0xFF,0x07,0x4A,0xFF,0x69,0x52,0xFF,0x08,0x42,0xFF,0xA2,0x10,0xFF,0x44,0x29,0xFF,0x03,0x21,0xFF,0x03,0x29,0xFF,0x44,0x31,0xFF,0x85,0x39,0xFF,
-    0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xC7,0x39,0xFF,0x28,0x42,0xFF,0x24,0x21,0xFF,0xC2,0x18,0xFF,0x03,0x19,0xFF,0xA2,0x10,0xFF,0xA2,0x10,0xFF,0x23,0x21,0xFF,0xC6,0x41,0xFF,0xE6,0x49,0xFF,0x06,0x4A,0xFF,0x07,0x4A,0xFF,0xE6,0x41,0xFF,0x06,0x42,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0xA6,0x31,0xFF,0x08,0x42,0xFF,0x08,0x42,0xFF,0x44,0x29,0xFF,0xA6,0x39,0xFF,0xE7,0x41,0xFF,0x68,0x5A,0xFF,0x47,0x5A,0xFF,0xA5,0x41,0xFF,0x44,0x39,0xFF,0x2A,0x73,0xFF,0x0E,0x94,0xFF,0xA4,0x49,0xFF,0x67,0x62,0xFF,0x06,0x52,0xFF,0x05,0x5A,0xFF,0x67,0x6A,0xFF,0x87,0x72,0xFF,0x87,0x72,0xFF,0x86,0x72,0xFF,0xA7,0x72,0xFF,0xC7,0x7A,0xFF,0xE7,0x7A,0xFF,0x07,0x83,0xFF,0x27,0x83,0xFF,0xE7,0x7A,0xFF,0xA6,0x7A,0xFF,0x85,0x72,0xFF,0x45,0x6A,0xFF,0x04,0x5A,0xFF,0xA4,0x41,0xFF,0x02,0x29,0xFF,0x40,0x08,0xFF,0x44,0x31,0xFF,0x27,0x5A,0xFF,0x68,0x62,0xFF,0x67,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x5A,0xFF,0x67,0x62,0xFF,0x87,0x6A,0xFF,0xC4,0x59,0xFF,0xC4,0x51,0xFF,0x87,0x6A,0xFF,0x08,0x83,0xFF,0x49,0x93,0xFF,
-    0xCA,0xA3,0xFF,0x0B,0xA4,0xFF,0xEA,0xA3,0xFF,0xCA,0xA3,0xFF,0xEA,0xA3,0xFF,0xC9,0xA3,0xFF,0xE6,0x8A,0xFF,0xC5,0x8A,0xFF,0xE6,0x8A,0xFF,0x47,0x9B,0xFF,0x68,0x9B,0xFF,0x68,0x9B,0xFF,0x88,0xA3,0xFF,0xC8,0xB3,0xFF,0x29,0xBC,0xFF,0x49,0xBC,0xFF,0x08,0xB4,0xFF,0xE8,0xB3,0xFF,0xC7,0xB3,0xFF,0x87,0xAB,0xFF,0x67,0xAB,0xFF,0xC7,0xAB,0xFF,0x69,0xBC,0xFF,0x69,0xBC,0xFF,0x49,0xB4,0xFF,0xC8,0xA3,0xFF,0x87,0xA3,0xFF,0xA8,0xA3,0xFF,0x47,0x93,0xFF,0x27,0x8B,0xFF,0xE7,0x7A,0xFF,0x25,0x62,0xFF,0xE2,0x28,0xFF,0x60,0x18,0xFF,0x67,0x62,0xFF,0x46,0x6A,0xFF,0x25,0x6A,0xFF,0x66,0x72,0xFF,0x05,0x62,0xFF,0xE8,0x7A,0xFF,0xC7,0x82,0xFF,0xA6,0x7A,0xFF,0x86,0x7A,0xFF,0x86,0x7A,0xFF,0xA6,0x7A,0xFF,0xC6,0x7A,0xFF,0xE7,0x82,0xFF,0x65,0x72,0xFF,0x86,0x72,0xFF,0x08,0x83,0xFF,0x08,0x83,0xFF,0x25,0x5A,0xFF,0xE2,0x28,0xFF,0x40,0x18,0xFF,0x23,0x39,0xFF,0x87,0x6A,0xFF,0x46,0x6A,0xFF,0x66,0x6A,0xFF,0x86,0x72,0xFF,0xE8,0x7A,0xFF,0xCB,0x8B,0xFF,0x8A,0x83,0xFF,0xE9,0x6A,0xFF,0x26,0x4A,0xFF,
-    0x03,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x65,0x29,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0x07,0x42,0xFF,0xC2,0x18,0xFF,0x81,0x10,0xFF,0x03,0x21,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0x27,0x52,0xFF,0x49,0x52,0xFF,0x29,0x4A,0xFF,0x24,0x21,0xFF,0x44,0x29,0xFF,0x44,0x29,0xFF,0xE3,0x20,0xFF,0x03,0x29,0xFF,0x44,0x31,0xFF,0xA5,0x39,0xFF,0xE6,0x41,0xFF,0xE7,0x41,0xFF,0x07,0x42,0xFF,0x44,0x29,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0xC2,0x18,0xFF,0x45,0x29,0xFF,0x45,0x29,0xFF,0xE3,0x18,0xFF,0x64,0x31,0xFF,0x07,0x4A,0xFF,0x07,0x4A,0xFF,0x27,0x4A,0xFF,0xE6,0x41,0xFF,
-    0x85,0x31,0xFF,0x65,0x31,0xFF,0xC6,0x39,0xFF,0xC7,0x39,0xFF,0x45,0x29,0xFF,0x03,0x21,0xFF,0xE7,0x41,0xFF,0xE7,0x41,0xFF,0x47,0x52,0xFF,0x26,0x5A,0xFF,0xC5,0x49,0xFF,0x03,0x29,0xFF,0xC6,0x49,0xFF,0x26,0x5A,0xFF,0x47,0x62,0xFF,0x47,0x62,0xFF,0x06,0x5A,0xFF,0x46,0x62,0xFF,0x66,0x6A,0xFF,0x87,0x72,0xFF,0x46,0x6A,0xFF,0x46,0x6A,0xFF,0x86,0x72,0xFF,0xA7,0x72,0xFF,0x86,0x72,0xFF,0xC6,0x7A,0xFF,0xA5,0x7A,0xFF,0xA5,0x7A,0xFF,0xE7,0x82,0xFF,0xA6,0x7A,0xFF,0x65,0x72,0xFF,0x45,0x6A,0xFF,0xC5,0x51,0xFF,0x23,0x29,0xFF,0x40,0x08,0xFF,0xC5,0x41,0xFF,0xA8,0x6A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x67,0x62,0xFF,0xAB,0x93,0xFF,0x4C,0xAC,0xFF,0x8D,0xB4,0xFF,0x4C,0xAC,0xFF,0x89,0x9B,0xFF,0x27,0x93,0xFF,0x68,0x9B,0xFF,0x06,0x93,0xFF,0x88,0xA3,0xFF,0xC9,0xAB,0xFF,0xC5,0x8A,0xFF,0xA5,0x82,0xFF,0xA5,0x82,0xFF,0xE6,0x8A,0xFF,0x27,0x93,0xFF,0x67,0x9B,0xFF,0xE9,0xAB,0xFF,0xE9,0xAB,0xFF,0x88,0xA3,0xFF,0x47,0xA3,0xFF,0x67,0xA3,0xFF,0xC8,0xB3,0xFF,
-    0xA8,0xAB,0xFF,0x87,0xAB,0xFF,0x67,0xAB,0xFF,0x67,0xAB,0xFF,0xA7,0xAB,0xFF,0xC7,0xAB,0xFF,0x69,0xBC,0xFF,0x49,0xBC,0xFF,0xC8,0xAB,0xFF,0xA8,0xAB,0xFF,0x88,0xA3,0xFF,0x67,0x9B,0xFF,0x26,0x93,0xFF,0x47,0x93,0xFF,0x48,0x8B,0xFF,0x25,0x62,0xFF,0xA1,0x20,0xFF,0x81,0x20,0xFF,0x26,0x5A,0xFF,0x67,0x6A,0xFF,0xC8,0x7A,0xFF,0x86,0x72,0xFF,0x46,0x6A,0xFF,0xE8,0x82,0xFF,0x25,0x6A,0xFF,0x25,0x6A,0xFF,0x86,0x72,0xFF,0xC7,0x7A,0xFF,0x66,0x72,0xFF,0x86,0x72,0xFF,0x69,0x8B,0xFF,0xCA,0x9B,0xFF,0x89,0x93,0xFF,0xE7,0x7A,0xFF,0x25,0x62,0xFF,0x43,0x39,0xFF,0xA1,0x20,0xFF,0x20,0x10,0xFF,0x43,0x41,0xFF,0x46,0x62,0xFF,0x46,0x6A,0xFF,0x46,0x6A,0xFF,0x86,0x72,0xFF,0x07,0x7B,0xFF,0x6E,0xC5,0xFF,0xAE,0xD5,0xFF,0xCF,0xD5,0xFF,0x8F,0xCD,0xFF,0x2F,0xBD,0xFF,0x2C,0x94,0xFF,0xE5,0x41,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x04,0x21,0xFF,0xE7,0x39,0xFF,0xA6,0x39,0xFF,0xE7,0x41,0xFF,0x03,0x21,0xFF,0x60,0x08,0xFF,0x81,0x10,0xFF,0x64,0x31,0xFF,0xE6,0x41,0xFF,0xE6,0x49,0xFF,0x69,0x52,0xFF,0x6A,0x4A,0xFF,0xA7,0x31,0xFF,0xC2,0x18,0xFF,0x65,0x31,0xFF,0xE2,0x20,0xFF,0xE2,0x20,0xFF,0x23,0x29,0xFF,0x64,0x31,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0xE7,0x41,0xFF,0x03,0x21,0xFF,0xC2,0x18,0xFF,0x23,0x21,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0xC6,0x41,0xFF,0x28,0x4A,0xFF,0xA6,0x31,0xFF,0x03,0x21,0xFF,0xA5,0x39,0xFF,0x07,0x4A,0xFF,0xE6,0x41,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0xC7,0x39,0xFF,0xC7,0x39,0xFF,0x66,0x31,0xFF,0x65,0x29,0xFF,0x07,0x42,0xFF,0x07,0x42,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0xE6,0x49,0xFF,0xE3,0x20,0xFF,0x03,0x29,0xFF,0xA5,0x49,0xFF,0x67,0x62,0xFF,0x87,0x6A,0xFF,
-    0x06,0x5A,0xFF,0x05,0x5A,0xFF,0x46,0x6A,0xFF,0x46,0x6A,0xFF,0x25,0x6A,0xFF,0x45,0x6A,0xFF,0x66,0x72,0xFF,0x66,0x72,0xFF,0x85,0x72,0xFF,0x28,0x8B,0xFF,0xC9,0xA3,0xFF,0x0A,0xAC,0xFF,0xE9,0xA3,0xFF,0xA9,0x9B,0xFF,0x68,0x93,0xFF,0xC7,0x7A,0xFF,0xE5,0x51,0xFF,0x02,0x29,0xFF,0x40,0x10,0xFF,0xC6,0x49,0xFF,0xC9,0x6A,0xFF,0x27,0x5A,0xFF,0x67,0x5A,0xFF,0x47,0x5A,0xFF,0x06,0x52,0xFF,0x46,0x5A,0xFF,0x69,0x8B,0xFF,0x68,0x93,0xFF,0x06,0x8B,0xFF,0xC5,0x8A,0xFF,0x2A,0xB4,0xFF,0x8B,0xBC,0xFF,0xC9,0xAB,0xFF,0x87,0xA3,0xFF,0xC8,0xA3,0xFF,0xC8,0xA3,0xFF,0xA8,0xA3,0xFF,0x67,0x9B,0xFF,0x47,0x93,0xFF,0x68,0x9B,0xFF,0x88,0x9B,0xFF,0x88,0xA3,0xFF,0x88,0xA3,0xFF,0x68,0xA3,0xFF,0x27,0x93,0xFF,0x06,0x9B,0xFF,0x88,0xAB,0xFF,0xE8,0xB3,0xFF,0x87,0xA3,0xFF,0x87,0xA3,0xFF,0x87,0xAB,0xFF,0xE8,0xB3,0xFF,0x69,0xC4,0xFF,0x49,0xBC,0xFF,0x09,0xB4,0xFF,0xA8,0xA3,0xFF,0x67,0x9B,0xFF,0x47,0x9B,0xFF,0x06,0x93,0xFF,0x06,0x93,0xFF,0x27,0x93,0xFF,0x27,0x93,0xFF,0x48,0x8B,0xFF,0x05,0x5A,0xFF,
-    0x81,0x20,0xFF,0xC2,0x28,0xFF,0x26,0x62,0xFF,0x66,0x6A,0xFF,0x66,0x6A,0xFF,0x25,0x62,0xFF,0x87,0x6A,0xFF,0x09,0x7B,0xFF,0xE4,0x59,0xFF,0x25,0x6A,0xFF,0x46,0x6A,0xFF,0xA7,0x72,0xFF,0x08,0x83,0xFF,0x49,0x8B,0xFF,0x49,0x8B,0xFF,0xA7,0x72,0xFF,0x04,0x62,0xFF,0x46,0x6A,0xFF,0x67,0x62,0xFF,0x06,0x52,0xFF,0x03,0x31,0xFF,0x00,0x10,0xFF,0xA5,0x49,0xFF,0x46,0x6A,0xFF,0x46,0x6A,0xFF,0x66,0x72,0xFF,0x45,0x6A,0xFF,0x27,0x83,0xFF,0x8D,0xD5,0xFF,0xCD,0xDD,0xFF,0xCD,0xDD,0xFF,0x8D,0xD5,0xFF,0x8D,0xD5,0xFF,0xAF,0xD5,0xFF,0x2F,0xBD,0xFF,0xE6,0x41,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0x81,0x18,0xFF,0xA5,0x39,0xFF,0x26,0x52,0xFF,0x67,0x5A,0xFF,0xC8,0x6A,0xFF,0xE8,0x6A,0xFF,0x09,0x73,0xFF,0x88,0x5A,0xFF,0xC6,0x39,0xFF,
-    0x86,0x31,0xFF,0xC6,0x39,0xFF,0x24,0x29,0xFF,0x61,0x08,0xFF,0x03,0x21,0xFF,0xE3,0x18,0xFF,0x65,0x31,0xFF,0x27,0x4A,0xFF,0x48,0x52,0xFF,0x6A,0x4A,0xFF,0x6A,0x4A,0xFF,0xE3,0x18,0xFF,0x85,0x31,0xFF,0x23,0x29,0xFF,0xE2,0x20,0xFF,0x03,0x29,0xFF,0x44,0x31,0xFF,0x64,0x31,0xFF,0x85,0x39,0xFF,0xC6,0x39,0xFF,0x23,0x29,0xFF,0xC2,0x18,0xFF,0x23,0x21,0xFF,0xC2,0x18,0xFF,0x03,0x29,0xFF,0x44,0x31,0xFF,0x85,0x39,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0xC2,0x18,0xFF,0x44,0x29,0xFF,0xE6,0x41,0xFF,0xA5,0x39,0xFF,0x44,0x29,0xFF,0x86,0x31,0xFF,0xA7,0x31,0xFF,0x66,0x29,0xFF,0x86,0x31,0xFF,0xC6,0x39,0xFF,0xE7,0x41,0xFF,0x68,0x5A,0xFF,0x67,0x62,0xFF,0x27,0x5A,0xFF,0xA5,0x41,0xFF,0x06,0x4A,0xFF,0x27,0x5A,0xFF,0x26,0x5A,0xFF,0x67,0x62,0xFF,0x26,0x5A,0xFF,0xE5,0x59,0xFF,0x05,0x62,0xFF,0xE4,0x59,0xFF,0x25,0x6A,0xFF,0x85,0x72,0xFF,0xC6,0x7A,0xFF,0x27,0x8B,0xFF,0x68,0x93,0xFF,0xC9,0x9B,0xFF,0x2A,0xAC,0xFF,0x0A,0xAC,0xFF,0xEA,0xA3,0xFF,0xA9,0x93,0xFF,0x08,0x7B,0xFF,0x25,0x5A,0xFF,
-    0x43,0x39,0xFF,0xA1,0x20,0xFF,0x80,0x10,0xFF,0xA5,0x41,0xFF,0x06,0x52,0xFF,0x47,0x5A,0xFF,0x67,0x62,0xFF,0x47,0x5A,0xFF,0x06,0x52,0xFF,0x67,0x62,0xFF,0x08,0x83,0xFF,0x27,0x8B,0xFF,0x26,0x93,0xFF,0x88,0x9B,0xFF,0xA8,0xA3,0xFF,0x46,0x93,0xFF,0x06,0x93,0xFF,0x26,0x93,0xFF,0xA8,0xA3,0xFF,0xE8,0xA3,0xFF,0xC8,0xA3,0xFF,0x47,0x93,0xFF,0x47,0x93,0xFF,0xA9,0xA3,0xFF,0xA8,0xA3,0xFF,0x88,0x9B,0xFF,0x27,0x93,0xFF,0x07,0x93,0xFF,0xE6,0x8A,0xFF,0x07,0x9B,0xFF,0x88,0xA3,0xFF,0xA8,0xAB,0xFF,0xE8,0xB3,0xFF,0x08,0xBC,0xFF,0xC8,0xB3,0xFF,0x29,0xBC,0xFF,0xE8,0xB3,0xFF,0x87,0xA3,0xFF,0xC9,0xB3,0xFF,0x06,0x9B,0xFF,0x27,0x9B,0xFF,0x06,0x93,0xFF,0xA5,0x8A,0xFF,0xC6,0x8A,0xFF,0x65,0x7A,0xFF,0x24,0x72,0xFF,0x04,0x6A,0xFF,0x42,0x41,0xFF,0x81,0x20,0xFF,0xC2,0x28,0xFF,0x26,0x62,0xFF,0x25,0x62,0xFF,0x25,0x6A,0xFF,0x66,0x72,0xFF,0xA7,0x72,0xFF,0x4A,0x83,0xFF,0xC8,0x72,0xFF,0x87,0x72,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x87,0x72,0xFF,0x66,0x72,0xFF,0x49,0x8B,0xFF,0xEA,0xA3,0xFF,
-    0xCA,0xA3,0xFF,0x8A,0x9B,0xFF,0x87,0x72,0xFF,0x64,0x41,0xFF,0xA1,0x20,0xFF,0x20,0x18,0xFF,0x06,0x5A,0xFF,0x46,0x6A,0xFF,0x46,0x6A,0xFF,0x46,0x72,0xFF,0xE4,0x59,0xFF,0xA8,0x93,0xFF,0x8C,0xD5,0xFF,0xAC,0xDD,0xFF,0xED,0xE5,0xFF,0x8C,0xD5,0xFF,0xAD,0xD5,0xFF,0xAE,0xD5,0xFF,0xCD,0xB4,0xFF,0xC5,0x49,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x09,0x73,0xFF,0xEC,0x93,0xFF,0x0B,0x9C,0xFF,0x4C,0xA4,0xFF,0x6C,0xAC,0xFF,0x6B,0xAC,0xFF,0x4B,0xA4,0xFF,0x2B,0x9C,0xFF,0x49,0x7B,0xFF,0xE6,0x41,0xFF,0xA6,0x39,0xFF,0xA6,0x39,0xFF,0x24,0x29,0xFF,0x40,0x08,0xFF,0xE3,0x18,0xFF,0x24,0x21,0xFF,0x45,0x29,0xFF,0x85,0x31,0xFF,0x07,0x42,0xFF,0x69,0x4A,0xFF,0xEC,0x5A,0xFF,0xE8,0x39,0xFF,0xE3,0x20,0xFF,0x85,0x39,0xFF,0x23,0x29,0xFF,0xE2,0x20,0xFF,
-    0xE2,0x20,0xFF,0x44,0x31,0xFF,0xA5,0x39,0xFF,0xC6,0x39,0xFF,0x23,0x29,0xFF,0xE2,0x20,0xFF,0x23,0x29,0xFF,0xC2,0x18,0xFF,0x03,0x29,0xFF,0x44,0x31,0xFF,0x64,0x31,0xFF,0x65,0x31,0xFF,0x65,0x31,0xFF,0x44,0x29,0xFF,0x04,0x21,0xFF,0x24,0x29,0xFF,0xE6,0x39,0xFF,0xE6,0x39,0xFF,0xA6,0x31,0xFF,0xA7,0x31,0xFF,0x66,0x29,0xFF,0x86,0x29,0xFF,0x45,0x29,0xFF,0x85,0x31,0xFF,0x06,0x4A,0xFF,0x47,0x5A,0xFF,0x47,0x62,0xFF,0x27,0x5A,0xFF,0x47,0x5A,0xFF,0x27,0x5A,0xFF,0x06,0x5A,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x25,0x62,0xFF,0x66,0x6A,0xFF,0xE7,0x82,0xFF,0xA9,0x9B,0xFF,0x0A,0xA4,0xFF,0xE9,0x9B,0xFF,0xC9,0x9B,0xFF,0x89,0x93,0xFF,0x28,0x83,0xFF,0xE7,0x7A,0xFF,0x66,0x62,0xFF,0xE4,0x51,0xFF,0xA4,0x49,0xFF,0xC4,0x51,0xFF,0x05,0x5A,0xFF,0xC5,0x49,0xFF,0xE2,0x28,0xFF,0x60,0x10,0xFF,0x85,0x41,0xFF,0xE5,0x49,0xFF,0x47,0x5A,0xFF,0x67,0x62,0xFF,0x47,0x5A,0xFF,0x27,0x52,0xFF,0xC9,0x6A,0xFF,0x28,0x83,0xFF,0x47,0x93,0xFF,0x68,0x9B,0xFF,0xA8,0xA3,0xFF,0xA8,0xA3,0xFF,0x68,0x9B,0xFF,
-    0xE6,0x8A,0xFF,0x27,0x93,0xFF,0xA8,0x9B,0xFF,0xA8,0xA3,0xFF,0x88,0x9B,0xFF,0xA9,0xA3,0xFF,0xA9,0xA3,0xFF,0x68,0x9B,0xFF,0x27,0x93,0xFF,0xA6,0x82,0xFF,0x07,0x93,0xFF,0x48,0x9B,0xFF,0x27,0x9B,0xFF,0xA9,0xAB,0xFF,0x09,0xB4,0xFF,0x09,0xB4,0xFF,0xC8,0xB3,0xFF,0x87,0xAB,0xFF,0x67,0xAB,0xFF,0x67,0xAB,0xFF,0x87,0xB3,0xFF,0x87,0xAB,0xFF,0x87,0xAB,0xFF,0x87,0xAB,0xFF,0x47,0xA3,0xFF,0x85,0x8A,0xFF,0x65,0x82,0xFF,0x44,0x7A,0xFF,0x44,0x7A,0xFF,0x65,0x7A,0xFF,0x45,0x6A,0xFF,0x43,0x39,0xFF,0x81,0x18,0xFF,0xE2,0x28,0xFF,0x26,0x62,0xFF,0xE4,0x59,0xFF,0x45,0x6A,0xFF,0xC7,0x7A,0xFF,0x87,0x72,0xFF,0xC8,0x72,0xFF,0x26,0x5A,0xFF,0x46,0x62,0xFF,0xA7,0x72,0xFF,0xC7,0x82,0xFF,0xE7,0x82,0xFF,0x28,0x8B,0xFF,0x89,0x9B,0xFF,0x68,0x9B,0xFF,0x48,0x93,0xFF,0xE7,0x8A,0xFF,0xC4,0x61,0xFF,0x22,0x39,0xFF,0xA1,0x20,0xFF,0x40,0x18,0xFF,0x06,0x5A,0xFF,0x26,0x62,0xFF,0x25,0x6A,0xFF,0x04,0x62,0xFF,0xA3,0x51,0xFF,0x6B,0xA4,0xFF,0x0F,0xE6,0xFF,0xCC,0xDD,0xFF,0x0E,0xE6,0xFF,0x0E,0xE6,0xFF,
-    0x8D,0xD5,0xFF,0x6A,0xB4,0xFF,0x44,0x6A,0xFF,0x20,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0xE9,0x6A,0xFF,0x4C,0xA4,0xFF,0x2B,0xA4,0xFF,0x4B,0xA4,0xFF,0x2B,0xA4,0xFF,0x8C,0xAC,0xFF,0x6B,0xAC,0xFF,0x8C,0xB4,0xFF,0x0A,0xA4,0xFF,0x89,0x8B,0xFF,0x06,0x4A,0xFF,0xC6,0x39,0xFF,0xE7,0x41,0xFF,0x65,0x31,0xFF,0x20,0x00,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0xA6,0x39,0xFF,0xA6,0x39,0xFF,0xE8,0x41,0xFF,0xEC,0x5A,0xFF,0x0D,0x63,0xFF,0x04,0x19,0xFF,0x03,0x21,0xFF,0x44,0x31,0xFF,0x03,0x29,0xFF,0xE2,0x20,0xFF,0xC2,0x20,0xFF,0x85,0x31,0xFF,0xA5,0x39,0xFF,0x03,0x29,0xFF,0xE3,0x20,0xFF,0x23,0x29,0xFF,0xC2,0x20,0xFF,0xE3,0x20,0xFF,0x44,0x31,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0xA6,0x39,0xFF,0xA6,0x39,0xFF,
-    0x65,0x29,0xFF,0x65,0x29,0xFF,0xA6,0x31,0xFF,0x86,0x31,0xFF,0x45,0x21,0xFF,0x66,0x29,0xFF,0x45,0x29,0xFF,0x65,0x29,0xFF,0x68,0x5A,0xFF,0x67,0x5A,0xFF,0x06,0x5A,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x06,0x5A,0xFF,0x06,0x5A,0xFF,0x27,0x5A,0xFF,0x47,0x5A,0xFF,0x46,0x62,0xFF,0x28,0x83,0xFF,0xEA,0x9B,0xFF,0xEA,0x9B,0xFF,0xA9,0x93,0xFF,0xE7,0x7A,0xFF,0x45,0x62,0xFF,0xC4,0x49,0xFF,0xC5,0x49,0xFF,0xE5,0x51,0xFF,0x66,0x62,0xFF,0x28,0x83,0xFF,0x28,0x8B,0xFF,0x08,0x8B,0xFF,0xC7,0x7A,0xFF,0xE5,0x59,0xFF,0xC2,0x28,0xFF,0x40,0x10,0xFF,0xA5,0x41,0xFF,0xE6,0x51,0xFF,0x27,0x5A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0x67,0x5A,0xFF,0xA8,0x6A,0xFF,0xC7,0x7A,0xFF,0x07,0x8B,0xFF,0x27,0x93,0xFF,0x89,0x9B,0xFF,0x88,0x9B,0xFF,0x88,0x9B,0xFF,0xA9,0xA3,0xFF,0xA8,0x9B,0xFF,0x68,0x9B,0xFF,0x47,0x93,0xFF,0x47,0x93,0xFF,0x27,0x93,0xFF,0x07,0x8B,0xFF,0xE7,0x8A,0xFF,0xC6,0x8A,0xFF,0x27,0x93,0xFF,0x48,0x9B,0xFF,0x48,0x9B,0xFF,0x47,0x9B,0xFF,0x26,0xA3,0xFF,0x46,0xA3,0xFF,0x46,0xA3,0xFF,
-    0x46,0xA3,0xFF,0x46,0xA3,0xFF,0xE5,0x9A,0xFF,0xE5,0x9A,0xFF,0x66,0xAB,0xFF,0xE8,0xB3,0xFF,0xA7,0xAB,0xFF,0x47,0xA3,0xFF,0xE6,0x9A,0xFF,0xC6,0x92,0xFF,0xA5,0x8A,0xFF,0xA5,0x8A,0xFF,0xE6,0x8A,0xFF,0x06,0x8B,0xFF,0x86,0x72,0xFF,0x63,0x41,0xFF,0x81,0x20,0xFF,0xE2,0x30,0xFF,0x26,0x62,0xFF,0x05,0x62,0xFF,0x45,0x6A,0xFF,0x45,0x6A,0xFF,0x46,0x6A,0xFF,0x66,0x72,0xFF,0x49,0x93,0xFF,0x07,0x8B,0xFF,0x86,0x7A,0xFF,0x65,0x7A,0xFF,0x25,0x72,0xFF,0x45,0x72,0xFF,0x24,0x72,0xFF,0xA6,0x82,0xFF,0xA6,0x82,0xFF,0x65,0x72,0xFF,0xC4,0x59,0xFF,0x63,0x41,0xFF,0xA1,0x20,0xFF,0x60,0x18,0xFF,0x06,0x5A,0xFF,0x05,0x62,0xFF,0xE4,0x59,0xFF,0xE4,0x59,0xFF,0xA7,0x6A,0xFF,0x4A,0xA4,0xFF,0x4F,0xE6,0xFF,0xEE,0xDD,0xFF,0xEE,0xDD,0xFF,0xEE,0xDD,0xFF,0xCE,0xDD,0xFF,0xEC,0xBC,0xFF,0xA7,0x6A,0xFF,0x00,0x00,0xFF,0x64,0x31,0xFF,0x87,0x5A,0xFF,0x4A,0x73,0xFF,0x29,0x73,0xFF,0xA8,0x62,0xFF,0x26,0x52,0xFF,0x23,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0xC8,0x62,0xFF,0xEB,0x93,0xFF,0x0A,0x9C,0xFF,0x2A,0x9C,0xFF,0x2A,0xA4,0xFF,0x4B,0xA4,0xFF,0x8C,0xAC,0xFF,0x6B,0xAC,0xFF,0xC9,0x9B,0xFF,0x68,0x83,0xFF,0x68,0x52,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x20,0x00,0xFF,0xA2,0x10,0xFF,0x24,0x21,0xFF,0x44,0x29,0xFF,0x44,0x29,0xFF,0xA6,0x39,0xFF,0xE7,0x41,0xFF,0x28,0x42,0xFF,0x6E,0x6B,0xFF,0xCB,0x52,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0xE3,0x20,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0xA6,0x39,0xFF,0x64,0x31,0xFF,0xC2,0x20,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0xC2,0x18,0xFF,0xC2,0x20,0xFF,0x23,0x31,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x64,0x31,0xFF,0x85,0x39,0xFF,0xE7,0x41,0xFF,0x07,0x42,0xFF,0x28,0x4A,0xFF,0x28,0x42,0xFF,0x44,0x29,0xFF,0x65,0x29,0xFF,0x25,0x21,0xFF,0x25,0x21,0xFF,0x45,0x21,0xFF,0x85,0x31,0xFF,0x68,0x5A,0xFF,0x67,0x62,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x47,0x5A,0xFF,
-    0x26,0x5A,0xFF,0x26,0x5A,0xFF,0x45,0x62,0xFF,0x46,0x62,0xFF,0xE4,0x51,0xFF,0x46,0x5A,0xFF,0x29,0x7B,0xFF,0x8A,0x8B,0xFF,0x69,0x8B,0xFF,0x49,0x83,0xFF,0x48,0x8B,0xFF,0xA9,0x9B,0xFF,0xA8,0x9B,0xFF,0x88,0x9B,0xFF,0x47,0x93,0xFF,0x27,0x8B,0xFF,0x05,0x62,0xFF,0xC1,0x28,0xFF,0x40,0x10,0xFF,0x85,0x41,0xFF,0xE6,0x51,0xFF,0x27,0x5A,0xFF,0x06,0x52,0xFF,0x47,0x5A,0xFF,0x67,0x62,0xFF,0x67,0x62,0xFF,0xE8,0x82,0xFF,0xA6,0x82,0xFF,0xA6,0x82,0xFF,0xC6,0x82,0xFF,0x48,0x93,0xFF,0xA9,0x9B,0xFF,0x68,0x9B,0xFF,0x07,0x8B,0xFF,0xA6,0x82,0xFF,0xE6,0x8A,0xFF,0x47,0x9B,0xFF,0x27,0x93,0xFF,0xE6,0x8A,0xFF,0xC6,0x8A,0xFF,0xE6,0x8A,0xFF,0x47,0x9B,0xFF,0x27,0x9B,0xFF,0x07,0x9B,0xFF,0x26,0x9B,0xFF,0x06,0x9B,0xFF,0x87,0xAB,0xFF,0x87,0xAB,0xFF,0x47,0xAB,0xFF,0x27,0xA3,0xFF,0xE6,0x9A,0xFF,0x26,0xA3,0xFF,0xC8,0xB3,0xFF,0xC7,0xB3,0xFF,0x87,0xAB,0xFF,0x26,0xA3,0xFF,0xA5,0x92,0xFF,0xC6,0x92,0xFF,0x85,0x8A,0xFF,0x06,0x93,0xFF,0x67,0x9B,0xFF,0x47,0x93,0xFF,0x45,0x6A,0xFF,0x22,0x39,0xFF,
-    0x61,0x20,0xFF,0x02,0x39,0xFF,0x46,0x6A,0xFF,0x25,0x6A,0xFF,0x66,0x72,0xFF,0x66,0x6A,0xFF,0x66,0x72,0xFF,0x66,0x72,0xFF,0x65,0x82,0xFF,0x24,0x7A,0xFF,0x24,0x7A,0xFF,0x45,0x7A,0xFF,0x04,0x72,0xFF,0x04,0x6A,0xFF,0xC3,0x61,0xFF,0x04,0x6A,0xFF,0x86,0x7A,0xFF,0x86,0x7A,0xFF,0x25,0x6A,0xFF,0x84,0x49,0xFF,0xA1,0x20,0xFF,0xA1,0x28,0xFF,0x26,0x62,0xFF,0xC4,0x59,0xFF,0x66,0x6A,0xFF,0x48,0x83,0xFF,0x48,0x83,0xFF,0x2A,0xA4,0xFF,0xCD,0xDD,0xFF,0xCD,0xDD,0xFF,0xEE,0xDD,0xFF,0xAD,0xD5,0xFF,0x0E,0xE6,0xFF,0xEE,0xDD,0xFF,0x8E,0xCD,0xFF,0x6F,0xC5,0xFF,0xD0,0xCD,0xFF,0xD0,0xD5,0xFF,0xAF,0xCD,0xFF,0xF0,0xD5,0xFF,0xD0,0xD5,0xFF,0xAF,0xCD,0xFF,0x2F,0xBD,0xFF,0x8D,0xA4,0xFF,0x09,0x6B,0xFF,0x61,0x10,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x23,0x29,0xFF,0xA7,0x6A,0xFF,0x69,0x83,0xFF,0xA9,0x93,0xFF,0xC9,0x93,0xFF,0x0A,0x9C,0xFF,0xEA,0x9B,0xFF,0x27,0x83,0xFF,0x27,0x8B,0xFF,0xEB,0x9B,0xFF,0xEA,0x62,0xFF,
-    0x69,0x4A,0xFF,0x65,0x29,0xFF,0x44,0x29,0xFF,0x40,0x08,0xFF,0xA1,0x10,0xFF,0x03,0x21,0xFF,0x64,0x29,0xFF,0xA6,0x39,0xFF,0xE7,0x41,0xFF,0xE7,0x41,0xFF,0xE7,0x41,0xFF,0x69,0x4A,0xFF,0xAF,0x73,0xFF,0xCB,0x52,0xFF,0x66,0x29,0xFF,0x61,0x08,0xFF,0xA2,0x10,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x03,0x29,0xFF,0x81,0x18,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0xC2,0x20,0xFF,0xA1,0x18,0xFF,0x03,0x29,0xFF,0x85,0x39,0xFF,0xA5,0x41,0xFF,0xA5,0x39,0xFF,0x85,0x39,0xFF,0xA5,0x41,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0x07,0x42,0xFF,0x28,0x42,0xFF,0xA6,0x31,0xFF,0x04,0x21,0xFF,0x24,0x21,0xFF,0x45,0x21,0xFF,0x85,0x31,0xFF,0x47,0x52,0xFF,0xC8,0x72,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x67,0x62,0xFF,0x47,0x5A,0xFF,0x26,0x5A,0xFF,0x47,0x5A,0xFF,0x27,0x5A,0xFF,0xE5,0x51,0xFF,0xE8,0x72,0xFF,0x8A,0x8B,0xFF,0xAA,0x93,0xFF,0x0C,0xA4,0xFF,0xCB,0x9B,0xFF,0x28,0x83,0xFF,0xE6,0x82,0xFF,0x07,0x8B,0xFF,0x68,0x93,0xFF,0x67,0x9B,0xFF,0x67,0x9B,0xFF,0x27,0x93,0xFF,0xC6,0x82,0xFF,0x65,0x72,0xFF,
-    0xA3,0x51,0xFF,0xC1,0x20,0xFF,0x20,0x08,0xFF,0x85,0x39,0xFF,0xE6,0x49,0xFF,0x06,0x52,0xFF,0xE6,0x51,0xFF,0xE5,0x51,0xFF,0x26,0x5A,0xFF,0x87,0x6A,0xFF,0xA7,0x72,0xFF,0xC7,0x7A,0xFF,0x28,0x8B,0xFF,0x48,0x93,0xFF,0xE6,0x82,0xFF,0x27,0x93,0xFF,0x48,0x93,0xFF,0x27,0x93,0xFF,0x07,0x8B,0xFF,0x68,0x9B,0xFF,0x27,0x9B,0xFF,0x06,0x93,0xFF,0x47,0x9B,0xFF,0x47,0x9B,0xFF,0x88,0xA3,0xFF,0x67,0xA3,0xFF,0x06,0x9B,0xFF,0x27,0x9B,0xFF,0x67,0xA3,0xFF,0x87,0xAB,0xFF,0x67,0xAB,0xFF,0x47,0xA3,0xFF,0x26,0x9B,0xFF,0x67,0xAB,0xFF,0x67,0xAB,0xFF,0x87,0xAB,0xFF,0xE8,0xB3,0xFF,0xE8,0xB3,0xFF,0xA7,0xAB,0xFF,0x06,0x9B,0xFF,0x07,0x9B,0xFF,0x88,0xA3,0xFF,0xA9,0xA3,0xFF,0x68,0x93,0xFF,0xE7,0x82,0xFF,0x45,0x6A,0xFF,0x63,0x41,0xFF,0xE2,0x28,0xFF,0x40,0x18,0xFF,0x23,0x41,0xFF,0x67,0x72,0xFF,0x45,0x72,0xFF,0x04,0x6A,0xFF,0x65,0x72,0xFF,0x45,0x6A,0xFF,0x86,0x7A,0xFF,0x85,0x82,0xFF,0x85,0x82,0xFF,0x65,0x7A,0xFF,0x24,0x72,0xFF,0x65,0x7A,0xFF,0x86,0x82,0xFF,0xA6,0x82,0xFF,0xA6,0x82,0xFF,
-    0x45,0x72,0xFF,0xA3,0x61,0xFF,0x01,0x41,0xFF,0x22,0x39,0xFF,0xA1,0x20,0xFF,0xE2,0x30,0xFF,0x46,0x62,0xFF,0xA3,0x49,0xFF,0xEE,0xB4,0xFF,0x48,0x83,0xFF,0xC5,0x72,0xFF,0xEB,0xBC,0xFF,0x0E,0xEE,0xFF,0x0E,0xE6,0xFF,0x0D,0xE6,0xFF,0xCD,0xDD,0xFF,0x0E,0xE6,0xFF,0x0E,0xE6,0xFF,0xCD,0xDD,0xFF,0xAD,0xD5,0xFF,0x50,0xE6,0xFF,0x0E,0xE6,0xFF,0x0E,0xE6,0xFF,0x0F,0xDE,0xFF,0xCE,0xD5,0xFF,0xCE,0xD5,0xFF,0x8E,0xCD,0xFF,0xAF,0xCD,0xFF,0x6F,0xC5,0xFF,0x8E,0xA4,0xFF,0x85,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x82,0x10,0xFF,0x00,0x00,0xFF,0xA0,0x20,0xFF,0xA0,0x30,0xFF,0xA1,0x51,0xFF,0xC3,0x59,0xFF,0x81,0x51,0xFF,0x60,0x51,0xFF,0xA1,0x61,0xFF,0xE2,0x61,0xFF,0x28,0x83,0xFF,0x67,0x5A,0xFF,0x28,0x4A,0xFF,0xE7,0x39,0xFF,0xC2,0x18,0xFF,0x40,0x08,0xFF,0xA2,0x10,0xFF,0x03,0x21,0xFF,0x64,0x29,0xFF,0xA6,0x39,0xFF,0xC6,0x39,0xFF,0xE7,0x41,0xFF,0xE6,0x41,0xFF,0xA6,0x39,0xFF,0x08,0x42,0xFF,0x2D,0x63,0xFF,0x4D,0x63,0xFF,0xCB,0x52,0xFF,
-    0x8A,0x52,0xFF,0x28,0x4A,0xFF,0x64,0x31,0xFF,0xC2,0x20,0xFF,0xA1,0x20,0xFF,0xE2,0x20,0xFF,0xA2,0x18,0xFF,0xA1,0x18,0xFF,0xC2,0x20,0xFF,0xE2,0x28,0xFF,0x84,0x39,0xFF,0xE6,0x49,0xFF,0xC5,0x41,0xFF,0xA5,0x39,0xFF,0xE6,0x41,0xFF,0xE6,0x49,0xFF,0xC6,0x41,0xFF,0x85,0x39,0xFF,0x64,0x29,0xFF,0xA6,0x31,0xFF,0x24,0x21,0xFF,0x45,0x29,0xFF,0x45,0x29,0xFF,0xA5,0x31,0xFF,0xE5,0x49,0xFF,0x46,0x5A,0xFF,0xA8,0x6A,0xFF,0xC8,0x6A,0xFF,0x67,0x62,0xFF,0x06,0x52,0xFF,0xA5,0x49,0xFF,0x47,0x5A,0xFF,0x09,0x73,0xFF,0x8A,0x8B,0xFF,0xCA,0x93,0xFF,0xE7,0x7A,0xFF,0x45,0x6A,0xFF,0xE6,0x7A,0xFF,0x07,0x83,0xFF,0xC6,0x7A,0xFF,0xE6,0x82,0xFF,0x47,0x93,0xFF,0x67,0x9B,0xFF,0x67,0x9B,0xFF,0xE5,0x8A,0xFF,0xA5,0x82,0xFF,0x85,0x7A,0xFF,0x45,0x72,0xFF,0x83,0x49,0xFF,0xE2,0x28,0xFF,0x40,0x10,0xFF,0x85,0x39,0xFF,0xE6,0x49,0xFF,0xA5,0x49,0xFF,0x68,0x62,0xFF,0xEA,0x72,0xFF,0xC5,0x51,0xFF,0x87,0x6A,0xFF,0x89,0x93,0xFF,0xA9,0x9B,0xFF,0x68,0x93,0xFF,0x68,0x93,0xFF,0x27,0x8B,0xFF,0x27,0x93,0xFF,
-    0x07,0x93,0xFF,0x27,0x93,0xFF,0x27,0x93,0xFF,0xC5,0x8A,0xFF,0x26,0x9B,0xFF,0x88,0xA3,0xFF,0x87,0xA3,0xFF,0x26,0x9B,0xFF,0x47,0x9B,0xFF,0x27,0x9B,0xFF,0x26,0x9B,0xFF,0x47,0xA3,0xFF,0x47,0xA3,0xFF,0x47,0xA3,0xFF,0x26,0x9B,0xFF,0x26,0xA3,0xFF,0x27,0x9B,0xFF,0xE8,0xB3,0xFF,0x4A,0xBC,0xFF,0x8A,0xC4,0xFF,0x8B,0xBC,0xFF,0x6B,0xBC,0xFF,0x0B,0xAC,0xFF,0x49,0x93,0xFF,0xC7,0x7A,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0x28,0x83,0xFF,0xAA,0x93,0xFF,0xE8,0x72,0xFF,0x63,0x39,0xFF,0x60,0x18,0xFF,0x43,0x49,0xFF,0x87,0x7A,0xFF,0x86,0x7A,0xFF,0x85,0x72,0xFF,0x85,0x7A,0xFF,0x65,0x72,0xFF,0xE7,0x82,0xFF,0x44,0x7A,0xFF,0x65,0x7A,0xFF,0xA6,0x82,0xFF,0xE6,0x8A,0xFF,0xE7,0x8A,0xFF,0xA6,0x82,0xFF,0x45,0x72,0xFF,0x25,0x72,0xFF,0x04,0x6A,0xFF,0xE4,0x61,0xFF,0xC4,0x51,0xFF,0x43,0x39,0xFF,0x81,0x20,0xFF,0x42,0x39,0xFF,0x66,0x6A,0xFF,0xA3,0x51,0xFF,0x4C,0xA4,0xFF,0xE7,0x72,0xFF,0xE6,0x7A,0xFF,0xA8,0x9B,0xFF,0xE7,0xAB,0xFF,0xAA,0xC4,0xFF,0x0A,0xD5,0xFF,0x6B,0xD5,0xFF,
-    0x8C,0xDD,0xFF,0x4B,0xD5,0xFF,0x2A,0xD5,0xFF,0x0A,0xCD,0xFF,0xAC,0xD5,0xFF,0x8C,0xD5,0xFF,0xAD,0xD5,0xFF,0xEE,0xDD,0xFF,0xCD,0xD5,0xFF,0xEE,0xDD,0xFF,0xCE,0xDD,0xFF,0xAE,0xD5,0xFF,0x8E,0xCD,0xFF,0x6F,0xC5,0xFF,0x4A,0x73,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x65,0x31,0xFF,0x28,0x42,0xFF,0xA5,0x31,0xFF,0x2C,0x6B,0xFF,0x34,0xA5,0xFF,0x13,0xA5,0xFF,0x00,0x00,0xFF,0x28,0x42,0xFF,0x30,0x8C,0xFF,0x09,0x73,0xFF,0xC2,0x59,0xFF,0xC3,0x51,0xFF,0x65,0x6A,0xFF,0xC6,0x72,0xFF,0x85,0x6A,0xFF,0xA3,0x49,0xFF,0x84,0x39,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0xC2,0x18,0xFF,0x60,0x08,0xFF,0x81,0x10,0xFF,0x23,0x21,0xFF,0x64,0x31,0xFF,0xC6,0x39,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0xC6,0x41,0xFF,0xC6,0x41,0xFF,0xA6,0x39,0xFF,0xC7,0x39,0xFF,0x29,0x42,0xFF,0x6A,0x4A,0xFF,0x08,0x42,0xFF,0x65,0x31,0xFF,0x03,0x29,0xFF,0xA1,0x20,0xFF,0x03,0x29,0xFF,0xC2,0x20,0xFF,0xA1,0x20,0xFF,0x81,0x18,0xFF,0xC2,0x20,0xFF,0x03,0x29,0xFF,0x64,0x39,0xFF,0xA5,0x41,0xFF,0xE6,0x49,0xFF,0xC5,0x41,0xFF,0x84,0x39,0xFF,0x84,0x39,0xFF,
-    0xC6,0x41,0xFF,0xC6,0x41,0xFF,0x85,0x39,0xFF,0xA6,0x39,0xFF,0x45,0x29,0xFF,0x85,0x31,0xFF,0x65,0x31,0xFF,0x85,0x31,0xFF,0x47,0x52,0xFF,0x47,0x5A,0xFF,0xA8,0x62,0xFF,0xA8,0x6A,0xFF,0x87,0x62,0xFF,0x46,0x62,0xFF,0xC5,0x51,0xFF,0x67,0x5A,0xFF,0xC8,0x6A,0xFF,0x04,0x52,0xFF,0xA6,0x62,0xFF,0x07,0x73,0xFF,0x07,0x7B,0xFF,0x07,0x7B,0xFF,0xC6,0x7A,0xFF,0x85,0x72,0xFF,0xE6,0x82,0xFF,0x47,0x93,0xFF,0x46,0x93,0xFF,0x26,0x93,0xFF,0xC5,0x8A,0xFF,0xC5,0x8A,0xFF,0xC6,0x82,0xFF,0xA6,0x7A,0xFF,0xC4,0x51,0xFF,0xE2,0x28,0xFF,0x20,0x08,0xFF,0xE6,0x41,0xFF,0xE6,0x49,0xFF,0x23,0x31,0xFF,0xA9,0x6A,0xFF,0x2E,0x9C,0xFF,0xE6,0x59,0xFF,0x87,0x6A,0xFF,0xE7,0x7A,0xFF,0xC6,0x82,0xFF,0x27,0x93,0xFF,0x27,0x93,0xFF,0x47,0x93,0xFF,0x67,0x9B,0xFF,0x47,0x9B,0xFF,0x68,0x9B,0xFF,0x06,0x93,0xFF,0xE6,0x92,0xFF,0x47,0x9B,0xFF,0x27,0x9B,0xFF,0xE6,0x92,0xFF,0x06,0x9B,0xFF,0x27,0x9B,0xFF,0x06,0x9B,0xFF,0x26,0x9B,0xFF,0x27,0x9B,0xFF,0x06,0x9B,0xFF,0x47,0x9B,0xFF,0x68,0xA3,0xFF,0xA8,0xAB,0xFF,
-    0x0A,0xB4,0xFF,0x6B,0xB4,0xFF,0x4A,0xB4,0xFF,0xC9,0x9B,0xFF,0x08,0x83,0xFF,0x46,0x62,0xFF,0x06,0x52,0xFF,0x47,0x62,0xFF,0x26,0x62,0xFF,0xA7,0x7A,0xFF,0x08,0x8B,0xFF,0x28,0x8B,0xFF,0x28,0x8B,0xFF,0x66,0x72,0xFF,0xA3,0x51,0xFF,0x02,0x31,0xFF,0x20,0x10,0xFF,0x63,0x49,0xFF,0xA7,0x7A,0xFF,0x86,0x72,0xFF,0x64,0x72,0xFF,0x85,0x72,0xFF,0x85,0x7A,0xFF,0xA6,0x82,0xFF,0x44,0x72,0xFF,0x85,0x82,0xFF,0x85,0x82,0xFF,0x24,0x72,0xFF,0x24,0x72,0xFF,0x65,0x7A,0xFF,0x85,0x7A,0xFF,0x65,0x7A,0xFF,0x24,0x72,0xFF,0xE4,0x61,0xFF,0xC4,0x51,0xFF,0x23,0x39,0xFF,0x40,0x18,0xFF,0xA4,0x49,0xFF,0x86,0x72,0xFF,0xE3,0x59,0xFF,0xC2,0x59,0xFF,0x03,0x5A,0xFF,0xE6,0x7A,0xFF,0xC6,0x7A,0xFF,0x40,0x61,0xFF,0xE1,0x79,0xFF,0x01,0x82,0xFF,0x21,0x82,0xFF,0x40,0x8A,0xFF,0xA5,0xAB,0xFF,0x88,0xC4,0xFF,0x0A,0xCD,0xFF,0x6B,0xD5,0xFF,0xAC,0xDD,0xFF,0x0E,0xE6,0xFF,0xAD,0xD5,0xFF,0xED,0xDD,0xFF,0x0E,0xDE,0xFF,0xCD,0xD5,0xFF,0xAD,0xD5,0xFF,0xEF,0xDD,0xFF,0x6E,0xC5,0xFF,0xA7,0x62,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA6,0x31,0xFF,0x13,0xA5,0xFF,
-    0xD6,0xBD,0xFF,0x90,0x9C,0xFF,0x74,0xB5,0xFF,0xD5,0xBD,0xFF,0xD1,0x9C,0xFF,0x6C,0x73,0xFF,0xB6,0xB5,0xFF,0x99,0xD6,0xFF,0x4D,0x9C,0xFF,0x2A,0x9C,0xFF,0x8C,0xAC,0xFF,0xCC,0xAC,0xFF,0x8B,0xAC,0xFF,0xAC,0xAC,0xFF,0x6C,0xA4,0xFF,0x87,0x5A,0xFF,0x85,0x31,0xFF,0x64,0x29,0xFF,0x03,0x21,0xFF,0x40,0x08,0xFF,0x61,0x08,0xFF,0x03,0x21,0xFF,0x64,0x31,0xFF,0x64,0x31,0xFF,0x85,0x31,0xFF,0xE6,0x41,0xFF,0xE6,0x41,0xFF,0x64,0x31,0xFF,0xE6,0x41,0xFF,0xE6,0x39,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0x65,0x31,0xFF,0xE3,0x20,0xFF,0x60,0x10,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0xC2,0x28,0xFF,0xC2,0x28,0xFF,0xE2,0x28,0xFF,0x03,0x29,0xFF,0x23,0x31,0xFF,0x63,0x39,0xFF,0xA5,0x41,0xFF,0xC5,0x41,0xFF,0x06,0x52,0xFF,0xE5,0x49,0xFF,0x84,0x39,0xFF,0x84,0x39,0xFF,0xC6,0x41,0xFF,0xC6,0x39,0xFF,0xC6,0x39,0xFF,0x45,0x29,0xFF,0x65,0x29,0xFF,0x85,0x31,0xFF,0x85,0x31,0xFF,0x47,0x52,0xFF,0x67,0x5A,0xFF,0x26,0x52,0xFF,0x47,0x5A,0xFF,0x47,0x62,0xFF,0x46,0x6A,0xFF,0x06,0x5A,0xFF,0x47,0x5A,0xFF,
-    0xE9,0x6A,0xFF,0xE7,0x62,0xFF,0xE7,0x6A,0xFF,0x86,0x5A,0xFF,0x86,0x62,0xFF,0x65,0x62,0xFF,0xC6,0x72,0xFF,0x06,0x83,0xFF,0x47,0x8B,0xFF,0x67,0x93,0xFF,0x06,0x8B,0xFF,0xE6,0x92,0xFF,0x06,0x93,0xFF,0xE6,0x8A,0xFF,0xA6,0x82,0xFF,0x65,0x7A,0xFF,0xC4,0x51,0xFF,0xC2,0x28,0xFF,0x40,0x08,0xFF,0xA5,0x39,0xFF,0xA5,0x41,0xFF,0xE2,0x28,0xFF,0xA4,0x49,0xFF,0x47,0x62,0xFF,0xC5,0x49,0xFF,0x66,0x6A,0xFF,0xA6,0x7A,0xFF,0x48,0x93,0xFF,0x47,0x93,0xFF,0x27,0x93,0xFF,0x27,0x93,0xFF,0x47,0x93,0xFF,0x27,0x93,0xFF,0xE6,0x8A,0xFF,0xC6,0x8A,0xFF,0x06,0x93,0xFF,0x06,0x9B,0xFF,0xA5,0x92,0xFF,0x85,0x8A,0xFF,0x85,0x8A,0xFF,0xC6,0x92,0xFF,0x06,0x9B,0xFF,0xE6,0x92,0xFF,0x48,0x9B,0xFF,0x88,0xA3,0xFF,0x47,0x9B,0xFF,0x27,0x93,0xFF,0xA6,0x7A,0xFF,0x66,0x6A,0xFF,0x45,0x62,0xFF,0x66,0x6A,0xFF,0xA7,0x72,0xFF,0x08,0x7B,0xFF,0x6A,0x8B,0xFF,0x49,0x8B,0xFF,0x86,0x7A,0xFF,0x65,0x7A,0xFF,0x27,0x93,0xFF,0xA5,0x8A,0xFF,0x03,0x72,0xFF,0xA3,0x61,0xFF,0xC4,0x61,0xFF,0xC4,0x59,0xFF,0xE1,0x28,0xFF,
-    0x00,0x10,0xFF,0x64,0x41,0xFF,0xA7,0x72,0xFF,0xC7,0x7A,0xFF,0xC6,0x7A,0xFF,0xA6,0x7A,0xFF,0xC6,0x82,0xFF,0xA6,0x82,0xFF,0x24,0x72,0xFF,0x24,0x7A,0xFF,0x44,0x72,0xFF,0x44,0x72,0xFF,0x65,0x7A,0xFF,0x24,0x72,0xFF,0x04,0x6A,0xFF,0x24,0x72,0xFF,0x45,0x72,0xFF,0xA3,0x51,0xFF,0x43,0x41,0xFF,0xC1,0x28,0xFF,0x20,0x10,0xFF,0x87,0x6A,0xFF,0x66,0x6A,0xFF,0xA2,0x59,0xFF,0x03,0x62,0xFF,0x64,0x6A,0xFF,0x27,0x83,0xFF,0x86,0x72,0xFF,0xE0,0x50,0xFF,0x23,0x7A,0xFF,0xC5,0x92,0xFF,0x42,0x82,0xFF,0xE3,0x92,0xFF,0xA8,0xCC,0xFF,0x4A,0xD5,0xFF,0x4A,0xD5,0xFF,0xAB,0xDD,0xFF,0x0D,0xE6,0xFF,0x0D,0xDE,0xFF,0x2E,0xE6,0xFF,0xCA,0xBC,0xFF,0xA9,0xBC,0xFF,0xEA,0xC4,0xFF,0xCA,0xBC,0xFF,0x29,0xA4,0xFF,0xA5,0x6A,0xFF,0x80,0x20,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA2,0x10,0xFF,0xEF,0x83,0xFF,0x50,0x8C,0xFF,0xEE,0x83,0xFF,0x90,0x94,0xFF,0x91,0x9C,0xFF,0xAC,0x7B,0xFF,0x2E,0x8C,0xFF,0x4F,0x8C,0xFF,0x6F,0x94,0xFF,0xD1,0x9C,0xFF,0x95,0xB5,0xFF,0x50,0x94,0xFF,0x27,0x7B,0xFF,0xAB,0xAC,0xFF,0xEC,0xB4,0xFF,0xCC,0xB4,0xFF,0x8B,0xAC,0xFF,0x6B,0xA4,0xFF,0x2A,0x9C,0xFF,0xA7,0x62,0xFF,
-    0x44,0x29,0xFF,0x85,0x31,0xFF,0xA5,0x31,0xFF,0xA2,0x18,0xFF,0x81,0x10,0xFF,0xC2,0x18,0xFF,0x44,0x29,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x64,0x31,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0xA5,0x39,0xFF,0x85,0x39,0xFF,0x64,0x31,0xFF,0xE3,0x20,0xFF,0xC2,0x20,0xFF,0x23,0x29,0xFF,0x03,0x31,0xFF,0xE2,0x28,0xFF,0x03,0x29,0xFF,0x43,0x31,0xFF,0x43,0x39,0xFF,0x84,0x39,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0xC5,0x49,0xFF,0x06,0x52,0xFF,0xC5,0x49,0xFF,0xA5,0x39,0xFF,0x85,0x39,0xFF,0x65,0x31,0xFF,0xA6,0x39,0xFF,0x65,0x31,0xFF,0x65,0x31,0xFF,0x44,0x29,0xFF,0x65,0x31,0xFF,0x47,0x52,0xFF,0xE9,0x6A,0xFF,0xA8,0x62,0xFF,0x67,0x5A,0xFF,0x47,0x62,0xFF,0x26,0x6A,0xFF,0x46,0x6A,0xFF,0xC8,0x6A,0xFF,0x09,0x6B,0xFF,0xA6,0x5A,0xFF,0x07,0x63,0xFF,0x85,0x52,0xFF,0xA6,0x62,0xFF,0x07,0x73,0xFF,0x27,0x7B,0xFF,0x06,0x83,0xFF,0x46,0x8B,0xFF,0x46,0x93,0xFF,0x26,0x93,0xFF,0xE6,0x92,0xFF,0x84,0x82,0xFF,0x24,0x7A,0xFF,0x44,0x72,0xFF,0x04,0x62,0xFF,
-    0x63,0x41,0xFF,0xC1,0x20,0xFF,0x40,0x08,0xFF,0xE6,0x41,0xFF,0xE6,0x49,0xFF,0x02,0x31,0xFF,0xE2,0x30,0xFF,0x84,0x41,0xFF,0xA4,0x41,0xFF,0x46,0x62,0xFF,0xE7,0x82,0xFF,0x47,0x93,0xFF,0x27,0x93,0xFF,0x27,0x9B,0xFF,0x06,0x93,0xFF,0x27,0x9B,0xFF,0x67,0xA3,0xFF,0x47,0xA3,0xFF,0x06,0x9B,0xFF,0xC5,0x92,0xFF,0xA5,0x92,0xFF,0x64,0x82,0xFF,0x85,0x82,0xFF,0x65,0x82,0xFF,0x64,0x82,0xFF,0x64,0x82,0xFF,0x28,0x93,0xFF,0x89,0x9B,0xFF,0x07,0x8B,0xFF,0x45,0x6A,0xFF,0xA4,0x51,0xFF,0xC5,0x51,0xFF,0x46,0x6A,0xFF,0x08,0x83,0xFF,0x07,0x83,0xFF,0xE7,0x8A,0xFF,0x86,0x82,0xFF,0x44,0x7A,0xFF,0x64,0x82,0xFF,0xC5,0x8A,0xFF,0x67,0xA3,0xFF,0x67,0xA3,0xFF,0x06,0x93,0xFF,0xA5,0x8A,0xFF,0x65,0x7A,0xFF,0x25,0x6A,0xFF,0xA3,0x51,0xFF,0xC1,0x20,0xFF,0x00,0x08,0xFF,0x64,0x41,0xFF,0x87,0x6A,0xFF,0xA6,0x72,0xFF,0xE5,0x82,0xFF,0xC6,0x82,0xFF,0xC6,0x82,0xFF,0xA6,0x82,0xFF,0x24,0x72,0xFF,0x44,0x7A,0xFF,0x24,0x72,0xFF,0xC3,0x61,0xFF,0xC3,0x61,0xFF,0xE3,0x69,0xFF,0xC3,0x61,0xFF,0x24,0x6A,0xFF,
-    0x24,0x6A,0xFF,0xA3,0x51,0xFF,0x02,0x31,0xFF,0x20,0x10,0xFF,0x43,0x31,0xFF,0xE8,0x72,0xFF,0x44,0x6A,0xFF,0x24,0x6A,0xFF,0x44,0x6A,0xFF,0xA5,0x72,0xFF,0x67,0x8B,0xFF,0x68,0x8B,0xFF,0x40,0x61,0xFF,0xC4,0x92,0xFF,0x65,0xAB,0xFF,0x07,0xBC,0xFF,0xC8,0xCC,0xFF,0x8A,0xE5,0xFF,0xCB,0xE5,0xFF,0x0C,0xEE,0xFF,0x6D,0xEE,0xFF,0xCF,0xF6,0xFF,0x8E,0xEE,0xFF,0xEC,0xDD,0xFF,0x0A,0xC5,0xFF,0xEA,0xC4,0xFF,0xEA,0xC4,0xFF,0xA9,0xBC,0xFF,0x09,0xA4,0xFF,0xE7,0x72,0xFF,0x84,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x55,0xAD,0xFF,0x79,0xD6,0xFF,0xB1,0x9C,0xFF,0xAD,0x83,0xFF,0xAC,0x7B,0xFF,0x47,0x52,0xFF,0xE5,0x41,0xFF,0x4B,0x6B,0xFF,0xD1,0x9C,0xFF,0x6F,0x94,0xFF,0x58,0xCE,0xFF,0xD6,0xBD,0xFF,0xC9,0x62,0xFF,0xC5,0x6A,0xFF,0x4A,0xA4,0xFF,0x4A,0xA4,0xFF,0x4A,0xA4,0xFF,0x6A,0xA4,0xFF,0x8B,0xAC,0xFF,0x4B,0xA4,0xFF,0x29,0x73,0xFF,0x03,0x21,0xFF,0x64,0x31,0xFF,0xC6,0x39,0xFF,0x24,0x21,0xFF,0x81,0x10,0xFF,0xA2,0x10,0xFF,0xE3,0x18,0xFF,0x23,0x21,0xFF,0x64,0x31,0xFF,0xC6,0x39,0xFF,0x64,0x31,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0xC5,0x41,0xFF,0x85,0x39,0xFF,0xA5,0x39,0xFF,
-    0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x64,0x31,0xFF,0x03,0x21,0xFF,0xC2,0x18,0xFF,0x23,0x29,0xFF,0x44,0x31,0xFF,0x03,0x31,0xFF,0x44,0x39,0xFF,0x63,0x39,0xFF,0x43,0x39,0xFF,0x64,0x41,0xFF,0x64,0x39,0xFF,0x63,0x39,0xFF,0xA4,0x41,0xFF,0xE5,0x49,0xFF,0x06,0x4A,0xFF,0xA5,0x39,0xFF,0x44,0x31,0xFF,0x86,0x39,0xFF,0x86,0x39,0xFF,0x85,0x31,0xFF,0x65,0x31,0xFF,0x65,0x31,0xFF,0x07,0x4A,0xFF,0xC8,0x62,0xFF,0xE9,0x6A,0xFF,0x88,0x62,0xFF,0x88,0x6A,0xFF,0x87,0x72,0xFF,0x67,0x6A,0xFF,0xA8,0x6A,0xFF,0xC8,0x62,0xFF,0x65,0x52,0xFF,0x28,0x6B,0xFF,0xC7,0x62,0xFF,0xE7,0x6A,0xFF,0xA6,0x62,0xFF,0x65,0x62,0xFF,0x07,0x7B,0xFF,0x47,0x8B,0xFF,0x26,0x8B,0xFF,0xA5,0x82,0xFF,0xA5,0x82,0xFF,0x26,0x93,0xFF,0x27,0x93,0xFF,0x07,0x8B,0xFF,0x65,0x6A,0xFF,0x63,0x41,0xFF,0xE2,0x28,0xFF,0x40,0x10,0xFF,0x06,0x4A,0xFF,0x27,0x52,0xFF,0xA5,0x41,0xFF,0xA4,0x41,0xFF,0xE5,0x49,0xFF,0xC5,0x49,0xFF,0x66,0x6A,0xFF,0x27,0x93,0xFF,0x68,0x9B,0xFF,0x47,0x9B,0xFF,0x47,0x9B,0xFF,0x27,0x9B,0xFF,0x06,0x93,0xFF,
-    0xE6,0x92,0xFF,0x06,0x9B,0xFF,0xA5,0x92,0xFF,0x64,0x8A,0xFF,0x64,0x8A,0xFF,0xE6,0x92,0xFF,0x68,0xA3,0xFF,0x07,0x93,0xFF,0x07,0x93,0xFF,0x28,0x8B,0xFF,0x09,0x83,0xFF,0xA7,0x72,0xFF,0xA7,0x72,0xFF,0x6A,0x8B,0xFF,0xCB,0x9B,0xFF,0x49,0x93,0xFF,0xA6,0x82,0xFF,0x85,0x82,0xFF,0xE6,0x92,0xFF,0x67,0xA3,0xFF,0x06,0x9B,0xFF,0xE6,0x92,0xFF,0x47,0xA3,0xFF,0x87,0xAB,0xFF,0xC8,0xB3,0xFF,0xA7,0xAB,0xFF,0x06,0x93,0xFF,0x65,0x82,0xFF,0x04,0x6A,0xFF,0xE4,0x61,0xFF,0x63,0x49,0xFF,0xA1,0x20,0xFF,0x00,0x08,0xFF,0x63,0x41,0xFF,0x46,0x62,0xFF,0x65,0x6A,0xFF,0xCD,0xBC,0xFF,0xCA,0x9B,0xFF,0xA5,0x82,0xFF,0xC6,0x82,0xFF,0x44,0x7A,0xFF,0x44,0x72,0xFF,0x04,0x6A,0xFF,0xA3,0x59,0xFF,0xE4,0x59,0xFF,0x04,0x62,0xFF,0x04,0x62,0xFF,0xE4,0x61,0xFF,0x62,0x49,0xFF,0x01,0x39,0xFF,0x00,0x18,0xFF,0x40,0x18,0xFF,0xC8,0x6A,0xFF,0xA6,0x72,0xFF,0x44,0x6A,0xFF,0x24,0x6A,0xFF,0x64,0x6A,0xFF,0xA5,0x72,0xFF,0x67,0x8B,0xFF,0x6B,0xB4,0xFF,0x61,0x61,0xFF,0xA4,0x92,0xFF,0x86,0xAB,0xFF,0xC7,0xB3,0xFF,
-    0xC6,0xB3,0xFF,0xC5,0xAB,0xFF,0x26,0xBC,0xFF,0xA8,0xC4,0xFF,0x4A,0xD5,0xFF,0x8A,0xD5,0xFF,0x49,0xCD,0xFF,0x08,0xCD,0xFF,0xAB,0xDD,0xFF,0x0D,0xE6,0xFF,0xCC,0xDD,0xFF,0xAC,0xDD,0xFF,0xAD,0xD5,0xFF,0xAE,0xD5,0xFF,0x4E,0xC5,0xFF,0x4C,0x9C,0xFF,0x43,0x31,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x65,0x29,0xFF,0x55,0xAD,0xFF,0x38,0xC6,0xFF,0x4F,0x8C,0xFF,0x88,0x5A,0xFF,0x67,0x5A,0xFF,0xC9,0x62,0xFF,0x88,0x5A,0xFF,0xC9,0x62,0xFF,0xF1,0xA4,0xFF,0x37,0xCE,0xFF,0x94,0xB5,0xFF,0x33,0xAD,0xFF,0x4F,0x94,0xFF,0xE8,0x6A,0xFF,0x68,0x83,0xFF,0x2A,0x9C,0xFF,0xC9,0x93,0xFF,0x09,0x9C,0xFF,0x6B,0xA4,0xFF,0xAC,0xAC,0xFF,0x8C,0xA4,0xFF,0x08,0x73,0xFF,0x03,0x29,0xFF,0x64,0x31,0xFF,0xC6,0x39,0xFF,0x48,0x4A,0xFF,0xC3,0x18,0xFF,0x82,0x10,0xFF,0xE3,0x18,0xFF,0x04,0x21,0xFF,0x44,0x29,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0xA5,0x39,0xFF,0xC6,0x41,0xFF,0xE6,0x41,0xFF,0x64,0x31,0xFF,0x84,0x31,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x85,0x39,0xFF,0x64,0x31,0xFF,0x24,0x29,0xFF,0xE3,0x18,0xFF,0xE2,0x20,0xFF,0x64,0x39,0xFF,0x64,0x39,0xFF,0x84,0x39,0xFF,0x84,0x41,0xFF,0xA5,0x41,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0xC5,0x49,0xFF,
-    0xC5,0x49,0xFF,0xE6,0x49,0xFF,0xC5,0x41,0xFF,0xA6,0x39,0xFF,0xA6,0x41,0xFF,0x86,0x39,0xFF,0x65,0x31,0xFF,0x65,0x31,0xFF,0x06,0x4A,0xFF,0xA8,0x62,0xFF,0xE9,0x6A,0xFF,0x88,0x62,0xFF,0x67,0x6A,0xFF,0x09,0x83,0xFF,0x46,0x6A,0xFF,0xA7,0x6A,0xFF,0x09,0x73,0xFF,0x24,0x4A,0xFF,0x66,0x52,0xFF,0x86,0x5A,0xFF,0xA7,0x62,0xFF,0xC7,0x6A,0xFF,0xA6,0x6A,0xFF,0xE7,0x7A,0xFF,0xE6,0x7A,0xFF,0xC6,0x7A,0xFF,0x27,0x8B,0xFF,0x67,0x93,0xFF,0x26,0x8B,0xFF,0xE6,0x82,0xFF,0x85,0x7A,0xFF,0x24,0x62,0xFF,0xA3,0x49,0xFF,0xE2,0x28,0xFF,0x20,0x08,0xFF,0x67,0x5A,0xFF,0x26,0x52,0xFF,0xE5,0x49,0xFF,0xE5,0x49,0xFF,0xE5,0x49,0xFF,0x26,0x52,0xFF,0x87,0x6A,0xFF,0x07,0x8B,0xFF,0x47,0x9B,0xFF,0x06,0x93,0xFF,0xC6,0x8A,0xFF,0x06,0x93,0xFF,0xE6,0x92,0xFF,0x64,0x8A,0xFF,0x85,0x8A,0xFF,0x85,0x8A,0xFF,0xA6,0x8A,0xFF,0x07,0x93,0xFF,0x28,0x8B,0xFF,0xA7,0x7A,0xFF,0x25,0x62,0xFF,0x46,0x62,0xFF,0xC8,0x72,0xFF,0x8A,0x93,0xFF,0xEA,0xA3,0xFF,0x89,0xA3,0xFF,0x27,0x93,0xFF,0xA5,0x8A,0xFF,0x23,0x82,0xFF,
-    0x84,0x8A,0xFF,0x06,0x9B,0xFF,0x87,0xAB,0xFF,0x26,0xA3,0xFF,0x05,0x9B,0xFF,0x26,0xA3,0xFF,0x67,0xA3,0xFF,0x67,0xA3,0xFF,0x26,0x9B,0xFF,0x26,0x93,0xFF,0x64,0x82,0xFF,0x44,0x7A,0xFF,0x24,0x72,0xFF,0x65,0x72,0xFF,0xC4,0x51,0xFF,0xC1,0x20,0xFF,0x00,0x08,0xFF,0x63,0x41,0xFF,0x66,0x62,0xFF,0xE4,0x59,0xFF,0xA9,0x93,0xFF,0x68,0x93,0xFF,0x64,0x7A,0xFF,0x85,0x7A,0xFF,0xE3,0x61,0xFF,0x04,0x62,0xFF,0xE4,0x59,0xFF,0x83,0x49,0xFF,0xA3,0x51,0xFF,0xC3,0x59,0xFF,0xA2,0x51,0xFF,0xA3,0x49,0xFF,0xC7,0x6A,0xFF,0x66,0x5A,0xFF,0x6A,0x7B,0xFF,0x8F,0xA4,0xFF,0x08,0x7B,0xFF,0x24,0x62,0xFF,0x24,0x6A,0xFF,0x44,0x6A,0xFF,0x85,0x72,0xFF,0xE6,0x7A,0xFF,0x47,0x8B,0xFF,0xCC,0xB4,0xFF,0x42,0x59,0xFF,0x23,0x7A,0xFF,0x46,0xA3,0xFF,0x08,0xBC,0xFF,0x88,0xC4,0xFF,0xA8,0xCC,0xFF,0x46,0xBC,0xFF,0xE5,0xB3,0xFF,0x46,0xBC,0xFF,0x09,0xCD,0xFF,0xCC,0xD5,0xFF,0xCC,0xCD,0xFF,0x6A,0xCD,0xFF,0xEC,0xDD,0xFF,0xAC,0xD5,0xFF,0xAC,0xD5,0xFF,0xCC,0xD5,0xFF,0xED,0xDD,0xFF,0xCD,0xD5,0xFF,0xEF,0xD5,0xFF,
-    0x2F,0xB5,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0xEF,0x7B,0xFF,0x95,0xB5,0xFF,0xD2,0x9C,0xFF,0xEE,0x83,0xFF,0x67,0x52,0xFF,0x84,0x39,0xFF,0xC5,0x41,0xFF,
-    0x26,0x4A,0xFF,0x8C,0x7B,0xFF,0xF5,0xC5,0xFF,0xD9,0xDE,0xFF,0x73,0xB5,0xFF,0x4A,0x73,0xFF,0x66,0x62,0xFF,0x24,0x5A,0xFF,0x86,0x6A,0xFF,0xE7,0x72,0xFF,0x07,0x7B,0xFF,0x28,0x7B,0xFF,0xE7,0x72,0xFF,0x66,0x62,0xFF,0x43,0x39,0xFF,0xC1,0x20,0xFF,0x44,0x31,0xFF,0x65,0x31,0xFF,0x64,0x29,0xFF,0x49,0x4A,0xFF,0x08,0x3A,0xFF,0xA2,0x10,0xFF,0xE3,0x18,0xFF,0xE3,0x18,0xFF,0x03,0x19,0xFF,0x44,0x29,0xFF,0x85,0x31,0xFF,0x85,0x31,0xFF,0x85,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x64,0x31,0xFF,0x64,0x31,0xFF,0x64,0x31,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x44,0x31,0xFF,0x03,0x21,0xFF,0xE3,0x20,0xFF,0x85,0x39,0xFF,0xC5,0x41,0xFF,0xA5,0x41,0xFF,0xC5,0x49,0xFF,0xA5,0x41,0xFF,0xA5,0x41,0xFF,0x64,0x41,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0xA5,0x41,0xFF,0xA5,0x39,0xFF,0xA6,0x41,0xFF,0xC6,0x41,0xFF,0x65,0x31,0xFF,0x65,0x31,0xFF,0x64,0x31,0xFF,0x68,0x5A,0xFF,0x0A,0x73,0xFF,0x46,0x5A,0xFF,0x47,0x62,0xFF,0x87,0x6A,0xFF,0xE9,0x7A,0xFF,0x87,0x72,0xFF,0xC8,0x72,0xFF,
-    0x09,0x6B,0xFF,0x86,0x52,0xFF,0xE8,0x62,0xFF,0xC8,0x62,0xFF,0x26,0x52,0xFF,0xE4,0x49,0xFF,0x66,0x62,0xFF,0x86,0x6A,0xFF,0x65,0x6A,0xFF,0x48,0x8B,0xFF,0x67,0x93,0xFF,0x06,0x8B,0xFF,0xA5,0x7A,0xFF,0x85,0x72,0xFF,0x85,0x72,0xFF,0x65,0x6A,0xFF,0xC4,0x51,0xFF,0x02,0x31,0xFF,0x40,0x10,0xFF,0xA8,0x62,0xFF,0x26,0x5A,0xFF,0x06,0x52,0xFF,0x06,0x4A,0xFF,0x06,0x4A,0xFF,0xE5,0x49,0xFF,0x66,0x6A,0xFF,0xE7,0x8A,0xFF,0x27,0x93,0xFF,0xC6,0x8A,0xFF,0x85,0x82,0xFF,0xA6,0x82,0xFF,0xE7,0x8A,0xFF,0xE7,0x8A,0xFF,0xC7,0x8A,0xFF,0x66,0x7A,0xFF,0xE4,0x61,0xFF,0xE5,0x59,0xFF,0xE5,0x59,0xFF,0xC8,0x7A,0xFF,0x49,0x8B,0xFF,0x69,0x93,0xFF,0x48,0x93,0xFF,0xE7,0x8A,0xFF,0x84,0x8A,0xFF,0x84,0x8A,0xFF,0x64,0x8A,0xFF,0x84,0x92,0xFF,0xE6,0x9A,0xFF,0x26,0x9B,0xFF,0x47,0xA3,0xFF,0xC5,0x92,0xFF,0xC5,0x92,0xFF,0xC5,0x92,0xFF,0xA5,0x8A,0xFF,0xA5,0x8A,0xFF,0xE6,0x92,0xFF,0x47,0x9B,0xFF,0x67,0xA3,0xFF,0xE6,0x92,0xFF,0x85,0x82,0xFF,0x85,0x7A,0xFF,0x45,0x6A,0xFF,0x83,0x41,0xFF,0xA1,0x20,0xFF,
-    0x20,0x10,0xFF,0x84,0x49,0xFF,0x46,0x62,0xFF,0x42,0x41,0xFF,0xA2,0x59,0xFF,0x44,0x72,0xFF,0x65,0x72,0xFF,0x24,0x6A,0xFF,0x62,0x49,0xFF,0x41,0x41,0xFF,0x00,0x39,0xFF,0x41,0x41,0xFF,0xE4,0x51,0xFF,0x4A,0x7B,0xFF,0x2D,0x94,0xFF,0xAF,0xA4,0xFF,0x2D,0x94,0xFF,0xEC,0x8B,0xFF,0x4D,0x9C,0xFF,0xE7,0x72,0xFF,0x45,0x6A,0xFF,0x04,0x62,0xFF,0xC3,0x59,0xFF,0x04,0x62,0xFF,0x85,0x72,0xFF,0xA5,0x72,0xFF,0x26,0x83,0xFF,0x4D,0xCD,0xFF,0xE6,0x7A,0xFF,0x40,0x40,0xFF,0x00,0x59,0xFF,0x40,0x61,0xFF,0xE2,0x71,0xFF,0xA3,0x8A,0xFF,0x04,0x9B,0xFF,0x88,0xC4,0xFF,0xEC,0xE5,0xFF,0xAD,0xC5,0xFF,0x2C,0x9D,0xFF,0x6C,0x9D,0xFF,0x8C,0xA5,0xFF,0xEE,0xC5,0xFF,0xEE,0xCD,0xFF,0xEE,0xCD,0xFF,0x0E,0xD6,0xFF,0x2E,0xDE,0xFF,0x2F,0xDE,0xFF,0x50,0xE6,0xFF,0x90,0xC5,0xFF,0xA1,0x18,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x69,0x4A,0xFF,0x35,0xA5,0xFF,0xB2,0x94,0xFF,0xEE,0x83,0xFF,0x8C,0x7B,0xFF,0x68,0x52,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0x88,0x52,0xFF,0x0E,0x8C,0xFF,0x2E,0x8C,0xFF,0x6B,0x7B,0xFF,0x09,0x73,0xFF,0x86,0x6A,0xFF,0x44,0x6A,0xFF,0xE7,0x7A,0xFF,0x86,0x6A,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0x23,0x39,0xFF,0x00,0x20,0xFF,0x60,0x20,0xFF,0x23,0x31,0xFF,
-    0x64,0x31,0xFF,0x64,0x29,0xFF,0x64,0x29,0xFF,0x64,0x29,0xFF,0x28,0x42,0xFF,0xA6,0x31,0xFF,0x25,0x21,0xFF,0xC3,0x10,0xFF,0xA2,0x10,0xFF,0xC3,0x18,0xFF,0x03,0x21,0xFF,0xA5,0x31,0xFF,0xA6,0x39,0xFF,0x85,0x31,0xFF,0x85,0x31,0xFF,0x64,0x31,0xFF,0x64,0x31,0xFF,0x44,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x44,0x31,0xFF,0x84,0x39,0xFF,0x64,0x31,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x84,0x39,0xFF,0xA5,0x41,0xFF,0xA5,0x49,0xFF,0xA5,0x41,0xFF,0x84,0x41,0xFF,0xA5,0x49,0xFF,0x84,0x41,0xFF,0x84,0x39,0xFF,0x64,0x39,0xFF,0xA6,0x39,0xFF,0xA6,0x41,0xFF,0xA6,0x41,0xFF,0x44,0x31,0xFF,0x65,0x31,0xFF,0x88,0x5A,0xFF,0x4A,0x7B,0xFF,0x46,0x5A,0xFF,0x87,0x62,0xFF,0x67,0x62,0xFF,0xAB,0x8B,0xFF,0x09,0x7B,0xFF,0x46,0x62,0xFF,0x87,0x62,0xFF,0x05,0x4A,0xFF,0x66,0x52,0xFF,0x45,0x52,0xFF,0x46,0x5A,0xFF,0x66,0x62,0xFF,0x07,0x7B,0xFF,0xA6,0x72,0xFF,0x44,0x6A,0xFF,0xE6,0x7A,0xFF,0x07,0x8B,0xFF,0xC6,0x7A,0xFF,0x65,0x72,0xFF,0x85,0x72,0xFF,0xA6,0x72,0xFF,0x66,0x6A,0xFF,
-    0x83,0x49,0xFF,0xC1,0x28,0xFF,0x60,0x18,0xFF,0x67,0x62,0xFF,0x46,0x62,0xFF,0xE5,0x49,0xFF,0xE6,0x49,0xFF,0x06,0x52,0xFF,0xC5,0x49,0xFF,0x67,0x6A,0xFF,0xC6,0x7A,0xFF,0xA6,0x7A,0xFF,0x25,0x6A,0xFF,0x05,0x62,0xFF,0x05,0x6A,0xFF,0xE5,0x61,0xFF,0xC4,0x59,0xFF,0x67,0x6A,0xFF,0x09,0x83,0xFF,0x8A,0x93,0xFF,0x48,0x93,0xFF,0x68,0x9B,0xFF,0x48,0x9B,0xFF,0xA5,0x8A,0xFF,0x23,0x82,0xFF,0x44,0x82,0xFF,0x24,0x82,0xFF,0x23,0x82,0xFF,0x64,0x8A,0xFF,0x64,0x8A,0xFF,0x64,0x8A,0xFF,0x64,0x8A,0xFF,0x43,0x82,0xFF,0x85,0x8A,0xFF,0xA5,0x8A,0xFF,0x64,0x8A,0xFF,0x64,0x8A,0xFF,0x24,0x7A,0xFF,0x64,0x82,0xFF,0x88,0xA3,0xFF,0x26,0x9B,0xFF,0xE6,0x8A,0xFF,0x44,0x7A,0xFF,0xE3,0x69,0xFF,0xA3,0x59,0xFF,0x83,0x49,0xFF,0x22,0x31,0xFF,0xA1,0x20,0xFF,0x20,0x10,0xFF,0x84,0x49,0xFF,0x25,0x62,0xFF,0xE4,0x51,0xFF,0xC3,0x51,0xFF,0x24,0x6A,0xFF,0x25,0x6A,0xFF,0xA3,0x51,0xFF,0x62,0x41,0xFF,0xA7,0x6A,0xFF,0x4A,0x7B,0xFF,0xEC,0x93,0xFF,0x0C,0x9C,0xFF,0xEC,0x93,0xFF,0x4A,0x83,0xFF,0x66,0x62,0xFF,
-    0x61,0x41,0xFF,0xA7,0x6A,0xFF,0x44,0x6A,0xFF,0x65,0x72,0xFF,0x04,0x62,0xFF,0xC3,0x59,0xFF,0xC3,0x51,0xFF,0xC3,0x59,0xFF,0x45,0x6A,0xFF,0x85,0x72,0xFF,0xE5,0x7A,0xFF,0x46,0x8B,0xFF,0x66,0x93,0xFF,0x28,0xAC,0xFF,0xAA,0xBC,0xFF,0xEA,0xC4,0xFF,0xCA,0xC4,0xFF,0x69,0xBC,0xFF,0x48,0xB4,0xFF,0xA6,0xA3,0xFF,0xC7,0x9B,0xFF,0x25,0x63,0xFF,0x80,0x02,0xFF,0x22,0x03,0xFF,0xAA,0x54,0xFF,0xD4,0xB6,0xFF,0x93,0xBE,0xFF,0x11,0xAE,0xFF,0xCF,0xAD,0xFF,0x8E,0xAD,0xFF,0xCF,0xC5,0xFF,0x0C,0xB5,0xFF,0x07,0x7B,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x85,0x39,0xFF,0xA8,0x5A,0xFF,0x09,0x6B,0xFF,0x4F,0x94,0xFF,0xB5,0xB5,0xFF,0xD2,0x94,0xFF,0x91,0x94,0xFF,0x8C,0x73,0xFF,0x07,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEB,0x62,0xFF,0x2E,0x8C,0xFF,0x2A,0x6B,0xFF,0x26,0x52,0xFF,0xC4,0x41,0xFF,0x04,0x5A,0xFF,0x27,0x7B,0xFF,0x47,0x8B,0xFF,0xC6,0x7A,0xFF,0xA6,0x72,0xFF,0x47,0x62,0xFF,0x03,0x31,0xFF,0x00,0x10,0xFF,0xE1,0x30,0xFF,0xA4,0x49,0xFF,0xE2,0x20,0xFF,0x24,0x21,0xFF,0x24,0x21,0xFF,0x23,0x21,0xFF,0x03,0x21,0xFF,0xA6,0x31,0xFF,0x24,0x21,0xFF,0x86,0x31,0xFF,0x04,0x21,0xFF,0x41,0x08,0xFF,0xA2,0x10,0xFF,0x24,0x21,0xFF,0xA6,0x31,0xFF,0xC6,0x39,0xFF,0x85,0x31,0xFF,0x44,0x29,0xFF,
-    0x23,0x29,0xFF,0x23,0x29,0xFF,0x24,0x29,0xFF,0x23,0x29,0xFF,0x23,0x29,0xFF,0x43,0x31,0xFF,0x64,0x39,0xFF,0xA5,0x39,0xFF,0xA5,0x39,0xFF,0x84,0x31,0xFF,0xC2,0x18,0xFF,0x23,0x29,0xFF,0xA5,0x41,0xFF,0xA5,0x49,0xFF,0x84,0x41,0xFF,0xA5,0x49,0xFF,0xC5,0x49,0xFF,0xA5,0x41,0xFF,0x64,0x31,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0xE3,0x20,0xFF,0x65,0x31,0xFF,0x68,0x5A,0xFF,0x09,0x73,0xFF,0x87,0x62,0xFF,0x06,0x52,0xFF,0xA8,0x6A,0xFF,0x8B,0x8B,0xFF,0x87,0x6A,0xFF,0x26,0x62,0xFF,0x67,0x62,0xFF,0xE4,0x41,0xFF,0x66,0x52,0xFF,0xA6,0x62,0xFF,0xE7,0x6A,0xFF,0xC7,0x72,0xFF,0x07,0x83,0xFF,0x86,0x72,0xFF,0x24,0x62,0xFF,0xA6,0x7A,0xFF,0xC6,0x7A,0xFF,0x85,0x72,0xFF,0x45,0x6A,0xFF,0x65,0x6A,0xFF,0x65,0x72,0xFF,0x45,0x6A,0xFF,0x83,0x49,0xFF,0xC1,0x28,0xFF,0x40,0x10,0xFF,0x26,0x62,0xFF,0x25,0x62,0xFF,0x05,0x5A,0xFF,0x06,0x52,0xFF,0x06,0x52,0xFF,0xC5,0x49,0xFF,0x67,0x6A,0xFF,0xE5,0x59,0xFF,0x84,0x51,0xFF,0x23,0x41,0xFF,0x06,0x5A,0xFF,0xC8,0x72,0xFF,0x29,0x83,0xFF,
-    0xCA,0xA3,0xFF,0x2B,0xB4,0xFF,0xCA,0xAB,0xFF,0x27,0x9B,0xFF,0x64,0x8A,0xFF,0x03,0x82,0xFF,0x84,0x8A,0xFF,0x64,0x8A,0xFF,0x44,0x8A,0xFF,0x04,0x82,0xFF,0xC3,0x79,0xFF,0x04,0x82,0xFF,0x44,0x82,0xFF,0x03,0x7A,0xFF,0x24,0x82,0xFF,0x64,0x8A,0xFF,0x85,0x8A,0xFF,0xC5,0x92,0xFF,0x06,0x9B,0xFF,0xC5,0x92,0xFF,0x85,0x8A,0xFF,0x64,0x82,0xFF,0xA6,0x8A,0xFF,0xA6,0x8A,0xFF,0x44,0x7A,0xFF,0x24,0x72,0xFF,0x04,0x6A,0xFF,0xC3,0x61,0xFF,0xC4,0x59,0xFF,0xA4,0x49,0xFF,0x22,0x31,0xFF,0x81,0x18,0xFF,0x20,0x18,0xFF,0x84,0x49,0xFF,0x25,0x62,0xFF,0xC3,0x51,0xFF,0x04,0x62,0xFF,0x04,0x62,0xFF,0x24,0x6A,0xFF,0xAB,0x93,0xFF,0x4D,0xA4,0xFF,0xEB,0x93,0xFF,0x6A,0x8B,0xFF,0xE8,0x7A,0xFF,0x24,0x62,0xFF,0xA2,0x59,0xFF,0xA2,0x51,0xFF,0x21,0x39,0xFF,0xE4,0x51,0xFF,0x04,0x62,0xFF,0xC6,0x7A,0xFF,0x4B,0xAC,0xFF,0x64,0x72,0xFF,0xE3,0x61,0xFF,0xC3,0x59,0xFF,0xA3,0x59,0xFF,0xE3,0x59,0xFF,0x23,0x62,0xFF,0xC5,0x7A,0xFF,0xE2,0x61,0xFF,0xA8,0xBC,0xFF,0x2D,0xEE,0xFF,0x6E,0xF6,0xFF,0x4E,0xEE,0xFF,
-    0x2D,0xEE,0xFF,0xCC,0xDD,0xFF,0x6A,0xD5,0xFF,0xCC,0xDD,0xFF,0x8C,0xCD,0xFF,0x0B,0xA5,0xFF,0x24,0x2B,0xFF,0x44,0x13,0xFF,0x06,0x24,0xFF,0x73,0x9E,0xFF,0x57,0xC7,0xFF,0x16,0xC7,0xFF,0xF6,0xC6,0xFF,0x74,0xB6,0xFF,0xED,0x8C,0xFF,0xE6,0x5A,0xFF,0xA0,0x20,0xFF,0x20,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x67,0x52,0xFF,0x8B,0x83,0xFF,0x0C,0x94,0xFF,0x2C,0x9C,0xFF,0x2B,0x9C,0xFF,0x0B,0x94,0xFF,0x6E,0x9C,0xFF,0xB5,0xB5,0xFF,0x17,0xC6,0xFF,0xF2,0x9C,0xFF,0xC9,0x5A,0xFF,0x20,0x00,0xFF,0xC6,0x39,0xFF,0x28,0x42,0xFF,0x58,0xCE,0xFF,0x37,0xC6,0xFF,0x2F,0x8C,0xFF,0xE6,0x41,0xFF,0xC0,0x20,0xFF,0xE4,0x51,0xFF,0x28,0x7B,0xFF,0xE7,0x7A,0xFF,0xC2,0x61,0xFF,0x81,0x59,0xFF,0x82,0x49,0xFF,0x25,0x5A,0xFF,0x66,0x62,0xFF,0x86,0x6A,0xFF,0xC7,0x6A,0xFF,0x26,0x52,0xFF,0x23,0x29,0xFF,0xA2,0x10,0xFF,0x23,0x21,0xFF,0x44,0x29,0xFF,0x24,0x21,0xFF,0x81,0x10,0xFF,0x04,0x21,0xFF,0x49,0x42,0xFF,0x29,0x42,0xFF,0xA3,0x10,0xFF,0xA2,0x10,0xFF,0x24,0x21,0xFF,0x65,0x29,0xFF,0x85,0x31,0xFF,0x65,0x29,0xFF,0x44,0x29,0xFF,0x23,0x21,0xFF,0x23,0x29,0xFF,0x44,0x29,0xFF,0x23,0x29,0xFF,0x03,0x29,0xFF,0x64,0x31,0xFF,0x84,0x39,0xFF,0xA5,0x41,0xFF,0xE6,0x41,0xFF,0xC6,0x41,0xFF,0x23,0x29,0xFF,0xE2,0x20,0xFF,0x84,0x39,0xFF,0xA5,0x41,0xFF,0x84,0x41,0xFF,
-    0x84,0x49,0xFF,0xC5,0x49,0xFF,0x84,0x39,0xFF,0x65,0x39,0xFF,0x85,0x39,0xFF,0x65,0x39,0xFF,0x03,0x21,0xFF,0x44,0x29,0xFF,0x0A,0x6B,0xFF,0x8B,0x83,0xFF,0x46,0x62,0xFF,0x43,0x39,0xFF,0x22,0x39,0xFF,0x42,0x41,0xFF,0xC5,0x51,0xFF,0x06,0x5A,0xFF,0x67,0x62,0xFF,0x05,0x4A,0xFF,0x87,0x62,0xFF,0xC7,0x6A,0xFF,0xE7,0x72,0xFF,0xA6,0x72,0xFF,0xA6,0x72,0xFF,0xA6,0x72,0xFF,0x45,0x6A,0xFF,0x25,0x62,0xFF,0x42,0x49,0xFF,0x83,0x51,0xFF,0x04,0x62,0xFF,0x65,0x72,0xFF,0xA6,0x7A,0xFF,0x65,0x72,0xFF,0xC4,0x51,0xFF,0xA1,0x20,0xFF,0x40,0x10,0xFF,0x05,0x5A,0xFF,0x45,0x6A,0xFF,0x25,0x62,0xFF,0x25,0x62,0xFF,0x05,0x5A,0xFF,0x05,0x62,0xFF,0x66,0x6A,0xFF,0x46,0x62,0xFF,0x29,0x83,0xFF,0xEB,0x9B,0xFF,0xEB,0xA3,0xFF,0xCA,0xA3,0xFF,0x69,0xA3,0xFF,0x07,0x9B,0xFF,0x64,0x8A,0xFF,0x23,0x82,0xFF,0x23,0x82,0xFF,0x64,0x8A,0xFF,0x84,0x92,0xFF,0x84,0x8A,0xFF,0x64,0x8A,0xFF,0x03,0x82,0xFF,0xC3,0x79,0xFF,0xE3,0x79,0xFF,0xC3,0x71,0xFF,0xC3,0x69,0xFF,0xE3,0x71,0xFF,0xA5,0x8A,0xFF,0x26,0x9B,0xFF,
-    0xC5,0x92,0xFF,0x26,0xA3,0xFF,0x06,0x9B,0xFF,0x84,0x8A,0xFF,0x85,0x82,0xFF,0xA6,0x82,0xFF,0x45,0x7A,0xFF,0xE3,0x69,0xFF,0x04,0x6A,0xFF,0x24,0x6A,0xFF,0x45,0x6A,0xFF,0xA3,0x51,0xFF,0x83,0x49,0xFF,0x83,0x41,0xFF,0xE2,0x28,0xFF,0x20,0x10,0xFF,0x20,0x18,0xFF,0x63,0x49,0xFF,0xE4,0x59,0xFF,0xA3,0x51,0xFF,0x04,0x5A,0xFF,0xE4,0x61,0xFF,0x45,0x72,0xFF,0x29,0x8B,0xFF,0xA7,0x7A,0xFF,0x03,0x6A,0xFF,0x24,0x6A,0xFF,0x04,0x62,0xFF,0x24,0x6A,0xFF,0x24,0x6A,0xFF,0xE4,0x59,0xFF,0xC0,0x30,0xFF,0xE4,0x51,0xFF,0x61,0x51,0xFF,0xC2,0x59,0xFF,0x64,0x7A,0xFF,0x01,0x72,0xFF,0x64,0x72,0xFF,0xE6,0x7A,0xFF,0x67,0x8B,0xFF,0x47,0x8B,0xFF,0x84,0x72,0xFF,0x06,0x83,0xFF,0xE8,0x9B,0xFF,0x8B,0xD5,0xFF,0x2C,0xE6,0xFF,0x0D,0xE6,0xFF,0xCD,0xDD,0xFF,0x0E,0xE6,0xFF,0x0D,0xDE,0xFF,0xED,0xDD,0xFF,0xAD,0xD5,0xFF,0x8C,0xCD,0xFF,0xCA,0xA4,0xFF,0x45,0x43,0xFF,0xC2,0x02,0xFF,0x47,0x24,0xFF,0x2D,0x65,0xFF,0x36,0xBF,0xFF,0x16,0xBF,0xFF,0x17,0xC7,0xFF,0x38,0xCF,0xFF,0x95,0xBE,0xFF,0x2C,0x74,0xFF,
-    0x22,0x21,0xFF,0x00,0x00,0xFF,0x60,0x10,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0A,0x6B,0xFF,0x0C,0x94,0xFF,0x6C,0xA4,0xFF,0x2B,0x9C,0xFF,0x0A,0x9C,0xFF,0xE9,0x93,0xFF,0xC9,0x93,0xFF,0xEB,0x93,0xFF,0xB5,0xBD,0xFF,0xB5,0xBD,0xFF,0xD1,0x9C,0xFF,0xEE,0x83,0xFF,0xD2,0x9C,0xFF,0x95,0xB5,0xFF,
-    0x2F,0x84,0xFF,0x33,0xAD,0xFF,0x50,0x8C,0xFF,0x0A,0x6B,0xFF,0xE6,0x41,0xFF,0x84,0x39,0xFF,0x87,0x62,0xFF,0xC3,0x51,0xFF,0x44,0x62,0xFF,0x07,0x83,0xFF,0xA9,0x93,0xFF,0x2B,0xA4,0xFF,0x4B,0xA4,0xFF,0x4B,0xA4,0xFF,0xE9,0x93,0xFF,0x68,0x83,0xFF,0x08,0x73,0xFF,0x49,0x7B,0xFF,0x87,0x5A,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0x20,0x08,0xFF,0x04,0x19,0xFF,0xEC,0x5A,0xFF,0x0C,0x5B,0xFF,0x86,0x29,0xFF,0xA2,0x10,0xFF,0xC3,0x18,0xFF,0xE3,0x18,0xFF,0x44,0x29,0xFF,0x64,0x29,0xFF,0x23,0x29,0xFF,0x44,0x29,0xFF,0x23,0x29,0xFF,0x44,0x29,0xFF,0x43,0x29,0xFF,0x64,0x31,0xFF,0x85,0x39,0xFF,0xC5,0x41,0xFF,0xE6,0x49,0xFF,0x06,0x4A,0xFF,0xE6,0x49,0xFF,0xC6,0x41,0xFF,0x03,0x21,0xFF,0x44,0x31,0xFF,0xA5,0x41,0xFF,0xC5,0x49,0xFF,0xA5,0x41,0xFF,0x64,0x39,0xFF,0x64,0x39,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x65,0x31,0xFF,0x85,0x39,0xFF,0xC9,0x62,0xFF,0xCC,0x8B,0xFF,0x67,0x6A,0xFF,0xC4,0x49,0xFF,0x64,0x39,0xFF,0xC5,0x49,0xFF,0xC5,0x51,0xFF,0xC5,0x51,0xFF,
-    0x47,0x5A,0xFF,0x25,0x52,0xFF,0x86,0x62,0xFF,0x86,0x62,0xFF,0x66,0x62,0xFF,0x25,0x62,0xFF,0x45,0x6A,0xFF,0x66,0x6A,0xFF,0xE4,0x59,0xFF,0x22,0x41,0xFF,0xC4,0x51,0xFF,0x07,0x83,0xFF,0x28,0x8B,0xFF,0xC6,0x82,0xFF,0x65,0x72,0xFF,0x24,0x6A,0xFF,0x83,0x49,0xFF,0xA1,0x20,0xFF,0x40,0x10,0xFF,0xE5,0x51,0xFF,0x05,0x62,0xFF,0xE5,0x61,0xFF,0xE5,0x59,0xFF,0xE5,0x59,0xFF,0x05,0x62,0xFF,0xE7,0x82,0xFF,0xCA,0xA3,0xFF,0x69,0x9B,0xFF,0xA7,0x8A,0xFF,0x24,0x82,0xFF,0x44,0x82,0xFF,0x44,0x8A,0xFF,0x85,0x92,0xFF,0x84,0x8A,0xFF,0x84,0x92,0xFF,0x84,0x8A,0xFF,0x64,0x8A,0xFF,0x44,0x82,0xFF,0x64,0x8A,0xFF,0x44,0x82,0xFF,0x24,0x82,0xFF,0x04,0x7A,0xFF,0x04,0x7A,0xFF,0xE3,0x71,0xFF,0xC3,0x71,0xFF,0x65,0x82,0xFF,0xE6,0x92,0xFF,0x85,0x8A,0xFF,0x64,0x82,0xFF,0xA5,0x8A,0xFF,0x44,0x82,0xFF,0x24,0x7A,0xFF,0x85,0x82,0xFF,0x45,0x72,0xFF,0x04,0x6A,0xFF,0x04,0x6A,0xFF,0xE4,0x61,0xFF,0x83,0x51,0xFF,0x63,0x49,0xFF,0x42,0x39,0xFF,0x22,0x39,0xFF,0xE0,0x30,0xFF,0x22,0x31,0xFF,0xA5,0x41,0xFF,
-    0xE2,0x30,0xFF,0x42,0x41,0xFF,0x05,0x62,0xFF,0xE4,0x59,0xFF,0xA3,0x51,0xFF,0xC3,0x59,0xFF,0x45,0x72,0xFF,0xE3,0x69,0xFF,0xA3,0x61,0xFF,0xC3,0x61,0xFF,0xE3,0x61,0xFF,0x66,0x6A,0xFF,0x49,0x8B,0xFF,0x44,0x72,0xFF,0x62,0x51,0xFF,0x00,0x18,0xFF,0x85,0x6A,0xFF,0x27,0x7B,0xFF,0xC4,0x7A,0xFF,0x08,0xA4,0xFF,0x6C,0xCD,0xFF,0xCD,0xDD,0xFF,0xAC,0xDD,0xFF,0x8C,0xDD,0xFF,0x8C,0xDD,0xFF,0x8B,0xDD,0xFF,0xCC,0xDD,0xFF,0x4E,0xEE,0xFF,0x4D,0xE6,0xFF,0x8B,0xD5,0xFF,0x8B,0xD5,0xFF,0xED,0xE5,0xFF,0x0E,0xE6,0xFF,0x4F,0xE6,0xFF,0x4F,0xE6,0xFF,0x89,0xAC,0xFF,0x25,0x7B,0xFF,0xC8,0x7B,0xFF,0xC7,0x53,0xFF,0x85,0x0B,0xFF,0x06,0x1C,0xFF,0x27,0x24,0xFF,0x93,0x96,0xFF,0x37,0xB7,0xFF,0x17,0xBF,0xFF,0x17,0xBF,0xFF,0xD6,0xBE,0xFF,0xF2,0xA5,0xFF,0x08,0x53,0xFF,0x00,0x08,0xFF,0x60,0x08,0xFF,0x60,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,
-    0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE3,0x20,0xFF,0xEC,0x8B,0xFF,0x0B,0x9C,0xFF,0xC9,0x93,0xFF,0xC9,0x93,0xFF,0x0A,0x9C,0xFF,0xE9,0x93,0xFF,0xE9,0x93,0xFF,0xA9,0x8B,0xFF,0xED,0x8B,0xFF,0xB1,0x9C,0xFF,0x90,0x9C,0xFF,0xEE,0x83,0xFF,0x33,0xAD,0xFF,0x75,0xAD,0xFF,0xAD,0x7B,0xFF,0xC9,0x62,0xFF,0xC9,0x62,0xFF,0xC5,0x41,0xFF,0x23,0x29,0xFF,0x84,0x39,0xFF,0xA7,0x62,0xFF,0x45,0x5A,0xFF,0x68,0x83,0xFF,0x6B,0xAC,0xFF,0xCC,0xB4,0xFF,0xAC,0xAC,0xFF,0xCC,0xB4,0xFF,0xCC,0xB4,0xFF,0x8B,0xA4,0xFF,0xC9,0x8B,0xFF,
-    0xE3,0x51,0xFF,0x45,0x5A,0xFF,0x8A,0x7B,0xFF,0x64,0x31,0xFF,0x20,0x00,0xFF,0x81,0x10,0xFF,0xC2,0x18,0xFF,0x61,0x08,0xFF,0xA2,0x18,0xFF,0xC2,0x18,0xFF,0x08,0x42,0xFF,0xAA,0x52,0xFF,0xE8,0x39,0xFF,0xC3,0x18,0xFF,0xC3,0x18,0xFF,0xE3,0x18,0xFF,0x03,0x21,0xFF,0x24,0x21,0xFF,0x23,0x21,0xFF,0x23,0x21,0xFF,0x44,0x29,0xFF,0x44,0x29,0xFF,0x23,0x31,0xFF,0x23,0x31,0xFF,0x64,0x39,0xFF,0xA5,0x41,0xFF,0xC5,0x49,0xFF,0x84,0x41,0xFF,0xC6,0x41,0xFF,0xE6,0x41,0xFF,0x64,0x31,0xFF,0x03,0x29,0xFF,0x84,0x39,0xFF,0xA5,0x41,0xFF,0x44,0x31,0xFF,0x44,0x31,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0xA5,0x39,0xFF,0x27,0x52,0xFF,0x2A,0x7B,0xFF,0x46,0x6A,0xFF,0x26,0x5A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0xE6,0x51,0xFF,0xE6,0x51,0xFF,0xC8,0x6A,0xFF,0xE5,0x49,0xFF,0x05,0x52,0xFF,0x25,0x52,0xFF,0x05,0x52,0xFF,0x05,0x5A,0xFF,0x05,0x5A,0xFF,0x25,0x5A,0xFF,0xC1,0x30,0xFF,0xE5,0x51,0xFF,0xC7,0x7A,0xFF,0x86,0x72,0xFF,0x45,0x72,0xFF,0xE4,0x61,0xFF,0xE4,0x59,0xFF,0xC4,0x51,0xFF,
-    0x02,0x31,0xFF,0x40,0x10,0xFF,0x60,0x10,0xFF,0xA4,0x49,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0x05,0x62,0xFF,0x04,0x62,0xFF,0x65,0x7A,0xFF,0x04,0x72,0xFF,0xE3,0x79,0xFF,0x04,0x7A,0xFF,0x44,0x82,0xFF,0xE3,0x79,0xFF,0xC3,0x71,0xFF,0x65,0x82,0xFF,0x85,0x8A,0xFF,0xA5,0x8A,0xFF,0x44,0x82,0xFF,0xE3,0x71,0xFF,0xE3,0x71,0xFF,0x03,0x7A,0xFF,0x03,0x7A,0xFF,0xC3,0x71,0xFF,0xC3,0x69,0xFF,0x45,0x7A,0xFF,0x44,0x7A,0xFF,0x45,0x7A,0xFF,0x65,0x82,0xFF,0x04,0x72,0xFF,0xC3,0x69,0xFF,0x03,0x72,0xFF,0x03,0x72,0xFF,0xE3,0x69,0xFF,0xE4,0x69,0xFF,0x04,0x6A,0xFF,0x04,0x62,0xFF,0xA3,0x51,0xFF,0xA3,0x51,0xFF,0x42,0x41,0xFF,0xE0,0x30,0xFF,0x63,0x39,0xFF,0x26,0x52,0xFF,0x0A,0x73,0xFF,0xCD,0x8B,0xFF,0x0D,0x94,0xFF,0x8B,0x83,0xFF,0x64,0x41,0xFF,0xE1,0x40,0xFF,0xC4,0x59,0xFF,0xE4,0x59,0xFF,0x62,0x49,0xFF,0xA3,0x59,0xFF,0x25,0x72,0xFF,0xA4,0x61,0xFF,0x63,0x51,0xFF,0x83,0x51,0xFF,0x62,0x51,0xFF,0x25,0x62,0xFF,0x25,0x6A,0xFF,0xA2,0x59,0xFF,0xE9,0x9B,0xFF,0x4D,0xC5,0xFF,
-    0x6C,0xCD,0xFF,0x2B,0xCD,0xFF,0x2A,0xD5,0xFF,0x0C,0xEE,0xFF,0x4A,0xD5,0xFF,0x67,0xBC,0xFF,0x66,0xBC,0xFF,0x66,0xBC,0xFF,0xC8,0xC4,0xFF,0x8A,0xDD,0xFF,0xEC,0xE5,0xFF,0x4D,0xE6,0xFF,0x2D,0xE6,0xFF,0x0D,0xE6,0xFF,0xEC,0xDD,0xFF,0x4E,0xEE,0xFF,0x4E,0xE6,0xFF,0x6F,0xE6,0xFF,0x90,0xE6,0xFF,0x2F,0xDE,0xFF,0xAB,0xA4,0xFF,0x87,0x73,0xFF,0xAA,0x74,0xFF,0xA9,0x44,0xFF,0x2B,0x3D,0xFF,0xCE,0x45,0xFF,0x8D,0x45,0xFF,0x31,0x76,0xFF,0xB4,0x9E,0xFF,0xD5,0xAE,0xFF,0xF6,0xB6,0xFF,0x33,0x9E,0xFF,0xAD,0x7C,0xFF,0xA4,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC5,0x41,0xFF,0x49,0x73,0xFF,0xEC,0x8B,0xFF,0x0C,0x8C,0xFF,0xCC,0x83,0xFF,0x4A,0x73,0xFF,0x47,0x52,0xFF,0x23,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x73,0xFF,0xEB,0x93,0xFF,0xEA,0x93,0xFF,0xEA,0x93,0xFF,0x0B,0x9C,0xFF,0x0A,0x9C,0xFF,0xEA,0x93,0xFF,0xCA,0x93,0xFF,0x08,0x73,0xFF,0xAC,0x83,0xFF,0x8C,0x7B,0xFF,0xA8,0x62,0xFF,0xAD,0x7B,0xFF,0x6C,0x73,0xFF,0x67,0x5A,0xFF,0xC5,0x41,0xFF,0xA8,0x5A,0xFF,0x67,0x52,0xFF,0x85,0x39,0xFF,0x63,0x31,0xFF,0xEB,0x93,0xFF,0x4B,0xA4,0xFF,0xAC,0xAC,0xFF,0xCC,0xB4,0xFF,0xAC,0xAC,0xFF,0x8B,0xA4,0xFF,0xAC,0xAC,0xFF,0x0A,0x9C,0xFF,0xC9,0x93,0xFF,0x88,0x8B,0xFF,0x64,0x62,0xFF,0x24,0x5A,0xFF,0xA7,0x6A,0xFF,0x02,0x29,0xFF,0x61,0x08,0xFF,0xA2,0x18,0xFF,0xA2,0x10,0xFF,0x41,0x08,0xFF,0xA2,0x10,0xFF,0xE3,0x18,0xFF,0xE2,0x18,0xFF,0x03,0x21,0xFF,0x08,0x3A,0xFF,0x29,0x42,0xFF,0x24,0x21,0xFF,0xA2,0x10,0xFF,
-    0xE3,0x18,0xFF,0x24,0x21,0xFF,0x44,0x29,0xFF,0x23,0x21,0xFF,0x23,0x29,0xFF,0x44,0x29,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0x43,0x31,0xFF,0x64,0x39,0xFF,0x64,0x41,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0xA5,0x41,0xFF,0x07,0x4A,0xFF,0xA5,0x39,0xFF,0x03,0x21,0xFF,0x23,0x29,0xFF,0x44,0x31,0xFF,0x44,0x31,0xFF,0x85,0x39,0xFF,0x85,0x39,0xFF,0xA5,0x39,0xFF,0xC5,0x41,0xFF,0x47,0x52,0xFF,0xE9,0x72,0xFF,0x25,0x62,0xFF,0x06,0x5A,0xFF,0x27,0x52,0xFF,0x47,0x5A,0xFF,0xE6,0x51,0xFF,0xE6,0x51,0xFF,0xA9,0x6A,0xFF,0xC4,0x41,0xFF,0x26,0x52,0xFF,0x05,0x52,0xFF,0xE5,0x51,0xFF,0x25,0x5A,0xFF,0x87,0x6A,0xFF,0x26,0x62,0xFF,0x40,0x18,0xFF,0x80,0x20,0xFF,0x02,0x39,0xFF,0x42,0x41,0xFF,0x83,0x49,0xFF,0x84,0x49,0xFF,0xA4,0x41,0xFF,0x43,0x31,0xFF,0xC2,0x20,0xFF,0x81,0x18,0xFF,0x60,0x10,0xFF,0xC5,0x49,0xFF,0xC4,0x51,0xFF,0xE5,0x59,0xFF,0xC4,0x59,0xFF,0x05,0x5A,0xFF,0xE4,0x61,0xFF,0x04,0x72,0xFF,0xE4,0x71,0xFF,0x04,0x7A,0xFF,0x04,0x7A,0xFF,0x04,0x7A,0xFF,0xE4,0x71,0xFF,0xE4,0x71,0xFF,
-    0x04,0x7A,0xFF,0xE3,0x71,0xFF,0xE3,0x71,0xFF,0xC2,0x69,0xFF,0xC3,0x69,0xFF,0x44,0x7A,0xFF,0x85,0x82,0xFF,0x65,0x82,0xFF,0x24,0x7A,0xFF,0xE3,0x69,0xFF,0xE3,0x69,0xFF,0xE4,0x69,0xFF,0xC3,0x69,0xFF,0xC4,0x69,0xFF,0xE4,0x69,0xFF,0x04,0x72,0xFF,0x04,0x6A,0xFF,0x04,0x6A,0xFF,0xE4,0x61,0xFF,0xE4,0x61,0xFF,0xA3,0x51,0xFF,0x62,0x49,0xFF,0xE0,0x38,0xFF,0x63,0x41,0xFF,0x47,0x5A,0xFF,0x2A,0x7B,0xFF,0x6B,0x83,0xFF,0xAC,0x8B,0xFF,0x8B,0x83,0xFF,0xE9,0x72,0xFF,0x46,0x6A,0xFF,0xC4,0x59,0xFF,0xC1,0x38,0xFF,0x02,0x41,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0xC8,0x7A,0xFF,0xA3,0x59,0xFF,0x05,0x6A,0xFF,0xC4,0x61,0xFF,0x63,0x49,0xFF,0x01,0x39,0xFF,0x01,0x39,0xFF,0x83,0x49,0xFF,0xA0,0x38,0xFF,0x49,0xAC,0xFF,0xED,0xE5,0xFF,0x09,0xCD,0xFF,0x09,0xCD,0xFF,0x27,0xB4,0xFF,0x67,0xBC,0xFF,0xA8,0xC4,0xFF,0x02,0x93,0xFF,0xA5,0xA3,0xFF,0x87,0xC4,0xFF,0x06,0xB4,0xFF,0x49,0xD5,0xFF,0xCB,0xDD,0xFF,0x4E,0xEE,0xFF,0xCF,0xEE,0xFF,0x2E,0xDE,0xFF,0x2D,0xE6,0xFF,0x0D,0xDE,0xFF,0x6E,0xEE,0xFF,
-    0x6E,0xE6,0xFF,0x32,0xF7,0xFF,0xF0,0xF6,0xFF,0xCF,0xEE,0xFF,0x90,0xE6,0xFF,0x2F,0xD6,0xFF,0x8C,0xA5,0xFF,0xEA,0x64,0xFF,0xEF,0x55,0xFF,0xD1,0x66,0xFF,0x4B,0x35,0xFF,0xA9,0x1C,0xFF,0xAA,0x34,0xFF,0x0D,0x5D,0xFF,0xB0,0x75,0xFF,0x8C,0x5C,0xFF,0x8C,0x64,0xFF,0x08,0x4B,0xFF,0xA4,0x39,0xFF,0x30,0xB5,0xFF,0x53,0xDE,0xFF,0x72,0xE6,0xFF,0x31,0xDE,0xFF,0x10,0xD6,0xFF,0x10,0xD6,0xFF,0xF0,0xD5,0xFF,0xB0,0xCD,0xFF,0x4F,0xC5,0xFF,0xAE,0xA4,0xFF,0x29,0x73,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x84,0x39,0xFF,0x87,0x62,0xFF,0x08,0x73,0xFF,0x28,0x7B,0xFF,0x49,0x83,0xFF,0x28,0x7B,0xFF,0xE7,0x72,0xFF,0x86,0x6A,0xFF,0x05,0x52,0xFF,0x42,0x39,0xFF,0x01,0x31,0xFF,0x42,0x31,0xFF,0x45,0x52,0xFF,0x28,0x73,0xFF,0x49,0x7B,0xFF,0x49,0x7B,0xFF,0x29,0x7B,0xFF,0x29,0x73,0xFF,0xA7,0x62,0xFF,0x25,0x52,0xFF,0x8C,0xAC,0xFF,0xCC,0xB4,0xFF,0xCC,0xAC,0xFF,0xCC,0xB4,0xFF,0xAC,0xAC,0xFF,0x4A,0x9C,0xFF,0xC9,0x93,0xFF,0xC9,0x93,0xFF,0x2A,0xA4,0xFF,0xC9,0x93,0xFF,0x07,0x7B,0xFF,0xA7,0x6A,0xFF,0x43,0x39,0xFF,0x40,0x10,0xFF,0x40,0x08,0xFF,0x61,0x10,0xFF,0x81,0x10,0xFF,0x41,0x08,0xFF,0xA2,0x10,0xFF,0xC2,0x18,0xFF,0xC3,0x18,0xFF,0xC2,0x18,0xFF,0x61,0x10,0xFF,0x45,0x29,0xFF,0x08,0x3A,0xFF,0xA6,0x31,0xFF,0xC3,0x18,0xFF,0xE3,0x18,0xFF,0x03,0x21,0xFF,0x24,0x21,0xFF,0x23,0x21,0xFF,0x03,0x21,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x43,0x31,0xFF,0xA5,0x39,0xFF,0xC5,0x49,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0xA4,0x49,0xFF,0xA4,0x49,0xFF,0xC5,0x49,0xFF,
-    0xC6,0x41,0xFF,0x44,0x29,0xFF,0xC2,0x18,0xFF,0x24,0x31,0xFF,0x85,0x39,0xFF,0x85,0x41,0xFF,0xA5,0x41,0xFF,0xA5,0x39,0xFF,0x47,0x5A,0xFF,0x2A,0x7B,0xFF,0x46,0x62,0xFF,0x46,0x5A,0xFF,0x47,0x5A,0xFF,0x47,0x5A,0xFF,0xE6,0x51,0xFF,0xA5,0x49,0xFF,0x88,0x6A,0xFF,0xA5,0x41,0xFF,0x26,0x52,0xFF,0xE5,0x51,0xFF,0xC4,0x49,0xFF,0x64,0x49,0xFF,0x83,0x49,0xFF,0xE1,0x38,0xFF,0x02,0x31,0xFF,0x64,0x39,0xFF,0x84,0x41,0xFF,0x06,0x52,0xFF,0x47,0x5A,0xFF,0x46,0x5A,0xFF,0x26,0x5A,0xFF,0xA4,0x41,0xFF,0x43,0x31,0xFF,0xC1,0x18,0xFF,0x60,0x10,0xFF,0xE5,0x49,0xFF,0x25,0x5A,0xFF,0x05,0x5A,0xFF,0x05,0x5A,0xFF,0x25,0x5A,0xFF,0x25,0x62,0xFF,0x45,0x72,0xFF,0x24,0x72,0xFF,0x44,0x7A,0xFF,0x44,0x82,0xFF,0x24,0x7A,0xFF,0xE4,0x71,0xFF,0xA3,0x61,0xFF,0xA3,0x69,0xFF,0xC3,0x69,0xFF,0xE3,0x71,0xFF,0x04,0x72,0xFF,0x24,0x72,0xFF,0x44,0x7A,0xFF,0x65,0x7A,0xFF,0x04,0x72,0xFF,0x83,0x61,0xFF,0x83,0x59,0xFF,0xA3,0x61,0xFF,0xC3,0x61,0xFF,0xE4,0x61,0xFF,0xE4,0x69,0xFF,0xA4,0x61,0xFF,0x83,0x59,0xFF,
-    0x83,0x51,0xFF,0x42,0x49,0xFF,0x00,0x41,0xFF,0xE0,0x38,0xFF,0xC4,0x51,0xFF,0xC8,0x72,0xFF,0x0D,0x9C,0xFF,0x8F,0xA4,0xFF,0x2E,0x9C,0xFF,0x2A,0x7B,0xFF,0x46,0x62,0xFF,0x83,0x49,0xFF,0x62,0x49,0xFF,0x83,0x51,0xFF,0xE5,0x61,0xFF,0x84,0x51,0xFF,0xC1,0x30,0xFF,0x02,0x41,0xFF,0x43,0x49,0xFF,0x63,0x49,0xFF,0x66,0x6A,0xFF,0x02,0x39,0xFF,0xC4,0x59,0xFF,0x05,0x62,0xFF,0x63,0x41,0xFF,0xA0,0x28,0xFF,0x41,0x41,0xFF,0x64,0x6A,0xFF,0x84,0x7A,0xFF,0xA9,0xC4,0xFF,0x08,0xD5,0xFF,0xE8,0xD4,0xFF,0xE6,0xB3,0xFF,0x83,0x8A,0xFF,0x23,0x82,0xFF,0x28,0xBC,0xFF,0x07,0xB4,0xFF,0x88,0xC4,0xFF,0xA8,0xC4,0xFF,0x06,0xAC,0xFF,0x29,0xD5,0xFF,0x6A,0xD5,0xFF,0xEC,0xE5,0xFF,0x8F,0xEE,0xFF,0xCF,0xF6,0xFF,0x6D,0xE6,0xFF,0x4D,0xE6,0xFF,0x6E,0xEE,0xFF,0xAD,0xD5,0xFF,0x11,0xF7,0xFF,0x10,0xF7,0xFF,0x0F,0xF7,0xFF,0xCF,0xEE,0xFF,0x8F,0xE6,0xFF,0x4E,0xDE,0xFF,0xAD,0xB5,0xFF,0xAD,0x8D,0xFF,0xCE,0x5D,0xFF,0x2B,0x45,0xFF,0xEA,0x44,0xFF,0x48,0x2C,0xFF,0xC7,0x23,0xFF,0x08,0x2C,0xFF,0x66,0x1B,0xFF,
-    0xE8,0x3B,0xFF,0xC9,0x53,0xFF,0x0E,0xAD,0xFF,0x72,0xE6,0xFF,0x50,0xE6,0xFF,0x0F,0xDE,0xFF,0x8D,0xD5,0xFF,0x6C,0xCD,0xFF,0x8C,0xD5,0xFF,0x8C,0xD5,0xFF,0x8D,0xD5,0xFF,0xAE,0xD5,0xFF,0x8E,0xD5,0xFF,0x6F,0xCD,0xFF,0xCE,0xAC,0xFF,0x47,0x52,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA1,0x18,0xFF,0xE1,0x28,0xFF,0x42,0x31,0xFF,0x63,0x41,0xFF,0x63,0x41,0xFF,0x43,0x39,0xFF,0x60,0x18,0xFF,0x61,0x18,0xFF,0x05,0x4A,0xFF,0x29,0x73,0xFF,0xEA,0x93,0xFF,0x4B,0x9C,0xFF,0x6B,0xA4,0xFF,
-    0x4B,0xA4,0xFF,0x4A,0xA4,0xFF,0x2A,0xA4,0xFF,0xEA,0x93,0xFF,0x2B,0x9C,0xFF,0xCA,0x8B,0xFF,0x49,0x83,0xFF,0x8C,0xAC,0xFF,0xAC,0xAC,0xFF,0x6B,0xA4,0xFF,0x8C,0xAC,0xFF,0xED,0xBC,0xFF,0x4B,0xA4,0xFF,0x0A,0x9C,0xFF,0xEA,0x9B,0xFF,0x07,0x7B,0xFF,0x04,0x5A,0xFF,0xE1,0x30,0xFF,0xE1,0x30,0xFF,0x63,0x39,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x40,0x08,0xFF,0x40,0x08,0xFF,0xA2,0x10,0xFF,0xC3,0x18,0xFF,0xA2,0x10,0xFF,0xA2,0x18,0xFF,0xE3,0x18,0xFF,0xE2,0x18,0xFF,0x24,0x29,0xFF,0xE7,0x39,0xFF,0x28,0x42,0xFF,0x65,0x29,0xFF,0xA2,0x10,0xFF,0xE3,0x18,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0x03,0x29,0xFF,0x03,0x29,0xFF,0x23,0x29,0xFF,0x85,0x39,0xFF,0xE6,0x49,0xFF,0xC5,0x41,0xFF,0xA4,0x41,0xFF,0x84,0x41,0xFF,0x84,0x49,0xFF,0xA5,0x49,0xFF,0xE6,0x49,0xFF,0x85,0x39,0xFF,0x64,0x31,0xFF,0x24,0x29,0xFF,0x85,0x39,0xFF,0x64,0x39,0xFF,0x85,0x39,0xFF,0x64,0x39,0xFF,0x27,0x52,0xFF,0x2A,0x7B,0xFF,0x46,0x62,0xFF,0x26,0x5A,0xFF,0x26,0x52,0xFF,0x27,0x52,0xFF,0xE6,0x51,0xFF,0xA5,0x49,0xFF,
-    0xA9,0x6A,0xFF,0xA5,0x41,0xFF,0x27,0x5A,0xFF,0x26,0x5A,0xFF,0xE2,0x30,0xFF,0x64,0x41,0xFF,0x47,0x62,0xFF,0xA8,0x6A,0xFF,0xA8,0x72,0xFF,0xC8,0x72,0xFF,0x87,0x6A,0xFF,0x67,0x6A,0xFF,0x66,0x6A,0xFF,0x66,0x6A,0xFF,0x26,0x62,0xFF,0x84,0x41,0xFF,0x43,0x31,0xFF,0x81,0x18,0xFF,0x60,0x10,0xFF,0xE4,0x49,0xFF,0x46,0x5A,0xFF,0x45,0x5A,0xFF,0x25,0x5A,0xFF,0x45,0x5A,0xFF,0x25,0x5A,0xFF,0x45,0x6A,0xFF,0x24,0x72,0xFF,0x25,0x72,0xFF,0x04,0x72,0xFF,0xE4,0x69,0xFF,0xE4,0x69,0xFF,0xA3,0x61,0xFF,0x82,0x61,0xFF,0xA3,0x61,0xFF,0xE4,0x69,0xFF,0x04,0x6A,0xFF,0xC3,0x61,0xFF,0xC3,0x61,0xFF,0x04,0x6A,0xFF,0x83,0x59,0xFF,0xE4,0x61,0xFF,0x05,0x6A,0xFF,0xE4,0x61,0xFF,0x83,0x51,0xFF,0x83,0x51,0xFF,0x83,0x51,0xFF,0x42,0x49,0xFF,0xC0,0x38,0xFF,0x02,0x39,0xFF,0x26,0x5A,0xFF,0x6A,0x7B,0xFF,0x6E,0xA4,0xFF,0x4D,0xA4,0xFF,0x69,0x8B,0xFF,0x8A,0x8B,0xFF,0x46,0x62,0xFF,0x00,0x41,0xFF,0xC0,0x38,0xFF,0x22,0x41,0xFF,0x23,0x41,0xFF,0x63,0x49,0xFF,0x63,0x49,0xFF,0x63,0x49,0xFF,0x43,0x41,0xFF,
-    0xC1,0x30,0xFF,0x02,0x41,0xFF,0x23,0x41,0xFF,0x02,0x41,0xFF,0x22,0x41,0xFF,0x02,0x39,0xFF,0x43,0x41,0xFF,0x83,0x49,0xFF,0x80,0x20,0xFF,0x24,0x5A,0xFF,0xC7,0xA3,0xFF,0x86,0xA3,0xFF,0x84,0x82,0xFF,0x25,0x93,0xFF,0xA8,0xCC,0xFF,0xA8,0xCC,0xFF,0xA6,0xB3,0xFF,0xE1,0x71,0xFF,0x21,0x59,0xFF,0x44,0x8A,0xFF,0xC7,0xB3,0xFF,0xC9,0xCC,0xFF,0x2A,0xD5,0xFF,0xCC,0xE5,0xFF,0xCB,0xE5,0xFF,0x4D,0xEE,0xFF,0x4D,0xEE,0xFF,0xAF,0xF6,0xFF,0xCF,0xF6,0xFF,0xAF,0xEE,0xFF,0x8F,0xEE,0xFF,0x4B,0xCD,0xFF,0x46,0x93,0xFF,0x6F,0xE6,0xFF,0xF0,0xF6,0xFF,0xCF,0xEE,0xFF,0x10,0xF7,0xFF,0x11,0xF7,0xFF,0x8F,0xE6,0xFF,0x8F,0xE6,0xFF,0x70,0xD6,0xFF,0xEF,0xB5,0xFF,0xCB,0x74,0xFF,0x8E,0x7D,0xFF,0xCF,0x85,0xFF,0x0C,0x6D,0xFF,0x08,0x44,0xFF,0x08,0x44,0xFF,0xA6,0x33,0xFF,0x06,0x43,0xFF,0xEE,0xAC,0xFF,0x71,0xE6,0xFF,0x0F,0xDE,0xFF,0xAD,0xD5,0xFF,0x6C,0xCD,0xFF,0x8C,0xD5,0xFF,0xAC,0xD5,0xFF,0xCD,0xDD,0xFF,0xCD,0xDD,0xFF,0xCD,0xDD,0xFF,0xCE,0xDD,0xFF,0xEF,0xDD,0xFF,0x10,0xDE,0xFF,0x70,0xC5,0xFF,
-    0x84,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x43,0x31,0xFF,0x49,0x73,0xFF,0xEA,0x93,0xFF,0x6B,0xA4,0xFF,0xAB,0xAC,0xFF,0xCC,0xB4,0xFF,0xAB,0xAC,0xFF,0x6A,0xAC,0xFF,0xCC,0xB4,0xFF,0x2A,0xA4,0xFF,0x2A,0xA4,0xFF,0x2A,0x9C,0xFF,0x4C,0xA4,0xFF,0xE2,0x30,0xFF,0xC4,0x51,0xFF,0x07,0x7B,0xFF,0xA9,0x93,0xFF,0xEA,0x9B,0xFF,0x0B,0x9C,0xFF,0xAA,0x93,0xFF,0xE7,0x7A,0xFF,0xE4,0x59,0xFF,0x22,0x41,0xFF,
-    0x63,0x49,0xFF,0xA4,0x49,0xFF,0xA4,0x49,0xFF,0x02,0x31,0xFF,0x63,0x39,0xFF,0x26,0x52,0xFF,0xC2,0x20,0xFF,0x20,0x00,0xFF,0xA2,0x10,0xFF,0xC3,0x18,0xFF,0xC3,0x18,0xFF,0xA3,0x18,0xFF,0xC3,0x18,0xFF,0xC2,0x18,0xFF,0x24,0x21,0xFF,0x03,0x21,0xFF,0x65,0x29,0xFF,0x69,0x4A,0xFF,0xE7,0x39,0xFF,0x82,0x08,0xFF,0xA2,0x10,0xFF,0xE3,0x18,0xFF,0x03,0x21,0xFF,0xE3,0x20,0xFF,0x23,0x31,0xFF,0x44,0x31,0xFF,0x64,0x39,0xFF,0x64,0x39,0xFF,0x84,0x41,0xFF,0xA4,0x49,0xFF,0xA4,0x49,0xFF,0x84,0x49,0xFF,0xE5,0x51,0xFF,0xA5,0x41,0xFF,0x64,0x39,0xFF,0x65,0x39,0xFF,0xC6,0x41,0xFF,0x64,0x39,0xFF,0x85,0x41,0xFF,0x64,0x39,0xFF,0xE6,0x49,0xFF,0x88,0x6A,0xFF,0x05,0x62,0xFF,0x26,0x5A,0xFF,0x27,0x52,0xFF,0x06,0x52,0xFF,0xE6,0x51,0xFF,0x85,0x49,0xFF,0x88,0x6A,0xFF,0x85,0x41,0xFF,0x64,0x39,0xFF,0xE6,0x51,0xFF,0x88,0x6A,0xFF,0x0A,0x7B,0xFF,0x4A,0x83,0xFF,0xC8,0x7A,0xFF,0x26,0x6A,0xFF,0x05,0x62,0xFF,0x25,0x6A,0xFF,0x66,0x72,0xFF,0x45,0x6A,0xFF,0x45,0x6A,0xFF,0x05,0x5A,0xFF,0xA4,0x49,0xFF,
-    0x23,0x31,0xFF,0x61,0x10,0xFF,0x60,0x10,0xFF,0xC4,0x49,0xFF,0x24,0x52,0xFF,0x45,0x5A,0xFF,0x25,0x52,0xFF,0x25,0x52,0xFF,0x45,0x62,0xFF,0x24,0x6A,0xFF,0x25,0x72,0xFF,0x45,0x7A,0xFF,0x24,0x7A,0xFF,0x24,0x72,0xFF,0xE3,0x69,0xFF,0xE4,0x69,0xFF,0xC3,0x61,0xFF,0x83,0x59,0xFF,0x83,0x59,0xFF,0xC3,0x61,0xFF,0xE4,0x61,0xFF,0xE4,0x69,0xFF,0xE4,0x61,0xFF,0xE4,0x61,0xFF,0xE5,0x61,0xFF,0x83,0x51,0xFF,0x22,0x41,0xFF,0xE0,0x38,0xFF,0xC0,0x38,0xFF,0xC5,0x49,0xFF,0xEA,0x72,0xFF,0xCD,0x8B,0xFF,0x0D,0x94,0xFF,0xEC,0x93,0xFF,0x2D,0x9C,0xFF,0x6A,0x8B,0xFF,0xC6,0x7A,0xFF,0x44,0x72,0xFF,0xA1,0x59,0xFF,0x42,0x49,0xFF,0xA4,0x51,0xFF,0x66,0x6A,0xFF,0x63,0x49,0xFF,0x23,0x41,0xFF,0x43,0x41,0xFF,0x84,0x51,0xFF,0x84,0x49,0xFF,0x43,0x41,0xFF,0xA1,0x30,0xFF,0x02,0x39,0xFF,0x02,0x39,0xFF,0xA1,0x30,0xFF,0xC1,0x38,0xFF,0x83,0x49,0xFF,0xC3,0x51,0xFF,0xA3,0x49,0xFF,0xC3,0x51,0xFF,0xC7,0xA3,0xFF,0x06,0xAC,0xFF,0x45,0x93,0xFF,0x61,0x61,0xFF,0x00,0x51,0xFF,0xA4,0x82,0xFF,0x28,0xBC,0xFF,
-    0x28,0xBC,0xFF,0x46,0xA3,0xFF,0x24,0x72,0xFF,0x01,0x59,0xFF,0xC2,0x79,0xFF,0x64,0x92,0xFF,0xC4,0x9A,0xFF,0x86,0xAB,0xFF,0x28,0xBC,0xFF,0x4B,0xDD,0xFF,0xAB,0xDD,0xFF,0xCC,0xE5,0xFF,0xCC,0xE5,0xFF,0x4A,0xD5,0xFF,0xA7,0xC4,0xFF,0xE7,0xB3,0xFF,0x00,0x69,0xFF,0xEC,0xBC,0xFF,0x8F,0xEE,0xFF,0xAF,0xEE,0xFF,0xF0,0xF6,0xFF,0x11,0xF7,0xFF,0xF1,0xF6,0xFF,0xAF,0xEE,0xFF,0x6F,0xE6,0xFF,0x4F,0xD6,0xFF,0x91,0xCE,0xFF,0xB0,0xA5,0xFF,0xF1,0xAD,0xFF,0x74,0xC6,0xFF,0x70,0x9D,0xFF,0xA7,0x4B,0xFF,0x87,0x43,0xFF,0x44,0x32,0xFF,0x81,0x49,0xFF,0x6B,0xAC,0xFF,0xCF,0xD5,0xFF,0x2F,0xE6,0xFF,0x2F,0xDE,0xFF,0x2F,0xE6,0xFF,0xED,0xDD,0xFF,0x70,0xE6,0xFF,0xB1,0xEE,0xFF,0x91,0xEE,0xFF,0x70,0xEE,0xFF,0x0F,0xE6,0xFF,0x30,0xE6,0xFF,0xD1,0xD5,0xFF,0x06,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE6,0x41,0xFF,0xEB,0x8B,0xFF,0x0A,0x9C,0xFF,0xAB,0xAC,0xFF,0xAB,0xB4,0xFF,0x29,0x9C,0xFF,0x4A,0xA4,0xFF,0xCC,0xB4,0xFF,0x6B,0xAC,0xFF,0x29,0xA4,0xFF,0xC8,0x9B,0xFF,0x6A,0xAC,0xFF,0x2A,0xA4,0xFF,0x28,0x7B,0xFF,0x00,0x18,0xFF,0x80,0x30,0xFF,0x60,0x30,0xFF,0x00,0x28,0xFF,0x60,0x30,0xFF,0x20,0x49,0xFF,0x62,0x51,0xFF,0xC4,0x59,0xFF,0x25,0x6A,0xFF,0x45,0x6A,0xFF,0x05,0x5A,0xFF,0x42,0x41,0xFF,0xA0,0x28,0xFF,0xC1,0x30,0xFF,0xC1,0x28,0xFF,0xE6,0x49,0xFF,0x44,0x31,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x82,0x10,0xFF,0xC3,0x18,0xFF,0xC3,0x18,0xFF,0xC3,0x18,0xFF,0xE3,0x18,0xFF,0xE3,0x18,0xFF,0x03,0x21,0xFF,
-    0xE3,0x18,0xFF,0x04,0x21,0xFF,0x28,0x42,0xFF,0x8A,0x52,0xFF,0x24,0x21,0xFF,0x20,0x00,0xFF,0x81,0x10,0xFF,0xC2,0x18,0xFF,0x03,0x29,0xFF,0x24,0x31,0xFF,0x64,0x31,0xFF,0x44,0x39,0xFF,0x84,0x41,0xFF,0x43,0x39,0xFF,0x84,0x41,0xFF,0xA5,0x49,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0x44,0x39,0xFF,0x44,0x31,0xFF,0x85,0x41,0xFF,0x44,0x39,0xFF,0x84,0x41,0xFF,0x64,0x39,0xFF,0xC5,0x49,0xFF,0x67,0x6A,0xFF,0x67,0x6A,0xFF,0x67,0x62,0xFF,0x06,0x52,0xFF,0x06,0x52,0xFF,0x06,0x52,0xFF,0x85,0x51,0xFF,0x88,0x6A,0xFF,0x06,0x52,0xFF,0x68,0x62,0xFF,0xA8,0x72,0xFF,0x67,0x6A,0xFF,0x05,0x62,0xFF,0xE5,0x61,0xFF,0xA4,0x59,0xFF,0xA4,0x59,0xFF,0xE5,0x61,0xFF,0x05,0x6A,0xFF,0x25,0x6A,0xFF,0x05,0x6A,0xFF,0x45,0x6A,0xFF,0x25,0x62,0xFF,0xA4,0x49,0xFF,0x23,0x31,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0xA4,0x41,0xFF,0x04,0x52,0xFF,0xE4,0x49,0xFF,0x86,0x62,0xFF,0xA7,0x62,0xFF,0x24,0x5A,0xFF,0x45,0x72,0xFF,0x04,0x6A,0xFF,0xE4,0x69,0xFF,0x24,0x72,0xFF,0x24,0x72,0xFF,0xA3,0x61,0xFF,0x62,0x51,0xFF,
-    0x62,0x51,0xFF,0xA3,0x59,0xFF,0xE4,0x61,0xFF,0xE4,0x61,0xFF,0xE4,0x61,0xFF,0xC4,0x59,0xFF,0xA3,0x51,0xFF,0x42,0x49,0xFF,0xA0,0x38,0xFF,0xE1,0x38,0xFF,0xE6,0x51,0xFF,0x2A,0x7B,0xFF,0x4E,0x9C,0xFF,0x90,0xA4,0xFF,0x4F,0x9C,0xFF,0x6B,0x83,0xFF,0x46,0x62,0xFF,0xA2,0x59,0xFF,0x80,0x59,0xFF,0x81,0x61,0xFF,0xC2,0x61,0xFF,0x44,0x72,0xFF,0x65,0x7A,0xFF,0xC3,0x61,0xFF,0xC4,0x51,0xFF,0x29,0x8B,0xFF,0x45,0x6A,0xFF,0xC4,0x59,0xFF,0x84,0x51,0xFF,0xC4,0x51,0xFF,0xC5,0x51,0xFF,0x64,0x49,0xFF,0xA1,0x30,0xFF,0xC1,0x38,0xFF,0xA0,0x38,0xFF,0xC6,0x7A,0xFF,0x49,0xAC,0xFF,0xAA,0xBC,0xFF,0x28,0xB4,0xFF,0xE7,0xAB,0xFF,0xE6,0xAB,0xFF,0xE5,0xAB,0xFF,0xE6,0xB3,0xFF,0x65,0xA3,0xFF,0x43,0x72,0xFF,0x21,0x51,0xFF,0xC0,0x50,0xFF,0x41,0x69,0xFF,0x64,0x92,0xFF,0x67,0xAB,0xFF,0x2A,0xCC,0xFF,0xE9,0xC3,0xFF,0x66,0x92,0xFF,0x43,0x79,0xFF,0x22,0x79,0xFF,0x41,0x79,0xFF,0x60,0x79,0xFF,0x60,0x92,0xFF,0x24,0xA3,0xFF,0x85,0xB3,0xFF,0x43,0xAB,0xFF,0xE6,0xB3,0xFF,0x8B,0xE5,0xFF,0x28,0xBC,0xFF,
-    0x20,0x50,0xFF,0x24,0x82,0xFF,0x8D,0xD5,0xFF,0xB0,0xF6,0xFF,0x31,0xF7,0xFF,0x11,0xF7,0xFF,0x6E,0xE6,0xFF,0xF0,0xF6,0xFF,0x6F,0xE6,0xFF,0x6F,0xE6,0xFF,0x70,0xE6,0xFF,0x92,0xDE,0xFF,0x12,0xCE,0xFF,0xF7,0xE6,0xFF,0xD7,0xDE,0xFF,0xF4,0xBD,0xFF,0x8A,0x63,0xFF,0x09,0x63,0xFF,0x6A,0x7B,0xFF,0x08,0x7B,0xFF,0x28,0x83,0xFF,0x8B,0xAC,0xFF,0x8E,0xCD,0xFF,0x2F,0xDE,0xFF,0x50,0xE6,0xFF,0x91,0xEE,0xFF,0xB1,0xEE,0xFF,0x91,0xEE,0xFF,0x91,0xEE,0xFF,0x2F,0xE6,0xFF,0x8E,0xD5,0xFF,0x0B,0x9C,0xFF,0xC1,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x6A,0x7B,0xFF,0x6B,0xA4,0xFF,0x4A,0xA4,0xFF,0xEC,0xB4,0xFF,0x0C,0xBD,0xFF,0x6A,0xA4,0xFF,0x6A,0xA4,0xFF,0x4A,0xA4,0xFF,0xE8,0x9B,0xFF,0x09,0x9C,0xFF,0x09,0x9C,0xFF,0xA8,0x93,0xFF,0x06,0x83,0xFF,0x03,0x62,0xFF,0x45,0x62,0xFF,0xA6,0x72,0xFF,0x86,0x6A,0xFF,0x66,0x62,0xFF,0xC4,0x51,0xFF,0xC1,0x30,0xFF,0x60,0x30,0xFF,0xE1,0x38,0xFF,0xE1,0x38,0xFF,0xE0,0x38,0xFF,0x80,0x30,0xFF,0x80,0x28,0xFF,0xC1,0x30,0xFF,0xE2,0x38,0xFF,0x02,0x41,0xFF,0xA5,0x51,0xFF,0x23,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x82,0x10,0xFF,0xC3,0x18,0xFF,0xC3,0x18,0xFF,0xE3,0x18,0xFF,0xE3,0x18,0xFF,0x03,0x19,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0xA2,0x10,0xFF,0xC7,0x39,0xFF,0xAA,0x52,0xFF,0xC7,0x31,0xFF,0x41,0x00,0xFF,0xA2,0x10,0xFF,0x03,0x21,0xFF,0x23,0x29,0xFF,0x03,0x29,0xFF,0xE2,0x28,0xFF,0x44,0x39,0xFF,0xA5,0x41,0xFF,0x64,0x39,0xFF,0x85,0x41,0xFF,
-    0xA4,0x41,0xFF,0x64,0x41,0xFF,0x64,0x39,0xFF,0x44,0x39,0xFF,0x64,0x39,0xFF,0x23,0x39,0xFF,0x64,0x41,0xFF,0x44,0x39,0xFF,0xA5,0x49,0xFF,0x87,0x6A,0xFF,0x66,0x6A,0xFF,0x46,0x62,0xFF,0x06,0x5A,0xFF,0xE6,0x51,0xFF,0xE6,0x59,0xFF,0x85,0x51,0xFF,0x88,0x72,0xFF,0x67,0x6A,0xFF,0x26,0x62,0xFF,0xA4,0x51,0xFF,0xA4,0x51,0xFF,0x63,0x51,0xFF,0xC5,0x59,0xFF,0x26,0x6A,0xFF,0x05,0x62,0xFF,0x05,0x62,0xFF,0xE5,0x61,0xFF,0xE5,0x61,0xFF,0x05,0x6A,0xFF,0x04,0x62,0xFF,0x83,0x49,0xFF,0x43,0x39,0xFF,0x02,0x29,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x83,0x39,0xFF,0xC3,0x49,0xFF,0x83,0x41,0xFF,0xCB,0x83,0xFF,0x4D,0x9C,0xFF,0x03,0x5A,0xFF,0x45,0x72,0xFF,0xE4,0x61,0xFF,0xC4,0x61,0xFF,0xC4,0x61,0xFF,0x83,0x59,0xFF,0x62,0x51,0xFF,0xA3,0x59,0xFF,0xE4,0x61,0xFF,0xC4,0x59,0xFF,0x83,0x51,0xFF,0x42,0x49,0xFF,0x21,0x41,0xFF,0xA0,0x38,0xFF,0x63,0x41,0xFF,0xC9,0x6A,0xFF,0xCC,0x8B,0xFF,0x2E,0x9C,0xFF,0x6F,0xA4,0xFF,0x0D,0x94,0xFF,0x4A,0x7B,0xFF,0x06,0x5A,0xFF,0xE0,0x40,0xFF,0x00,0x49,0xFF,
-    0xC3,0x61,0xFF,0x04,0x6A,0xFF,0xE2,0x69,0xFF,0xE3,0x69,0xFF,0x03,0x72,0xFF,0x84,0x82,0xFF,0xC5,0x8A,0xFF,0x65,0x7A,0xFF,0xA3,0x59,0xFF,0x28,0x8B,0xFF,0x45,0x72,0xFF,0xC4,0x59,0xFF,0x63,0x49,0xFF,0x43,0x41,0xFF,0x63,0x41,0xFF,0xE2,0x30,0xFF,0x40,0x18,0xFF,0xE1,0x38,0xFF,0xA7,0x9B,0xFF,0x69,0xBC,0xFF,0x06,0xB4,0xFF,0x46,0xBC,0xFF,0x45,0xBC,0xFF,0x26,0xBC,0xFF,0x26,0xBC,0xFF,0x26,0xBC,0xFF,0x05,0xB4,0xFF,0x46,0xBC,0xFF,0x06,0xB4,0xFF,0x65,0xA3,0xFF,0x23,0x7A,0xFF,0x63,0x79,0xFF,0x43,0x89,0xFF,0xA2,0x90,0xFF,0x84,0xB1,0xFF,0x25,0xBA,0xFF,0x03,0xA2,0xFF,0x00,0x89,0xFF,0x00,0x78,0xFF,0x40,0x70,0xFF,0x88,0x9A,0xFF,0x6F,0xC4,0xFF,0xE9,0x92,0xFF,0xE2,0x79,0xFF,0x04,0xA3,0xFF,0x09,0xD5,0xFF,0xE9,0xD4,0xFF,0x83,0x92,0xFF,0x00,0x50,0xFF,0x40,0x69,0xFF,0x05,0x9B,0xFF,0x4C,0xD5,0xFF,0xB0,0xF6,0xFF,0x31,0xFF,0xFF,0x8F,0xEE,0xFF,0xAF,0xEE,0xFF,0x6E,0xE6,0xFF,0x4E,0xE6,0xFF,0xD0,0xEE,0xFF,0xD2,0xEE,0xFF,0x52,0xDE,0xFF,0x70,0xC5,0xFF,0x14,0xD6,0xFF,0x7B,0xF7,0xFF,
-    0x1A,0xE7,0xFF,0x14,0xD6,0xFF,0xB0,0xCD,0xFF,0xAF,0xD5,0xFF,0x8E,0xCD,0xFF,0x6D,0xCD,0xFF,0xEB,0xBC,0xFF,0x8A,0xB4,0xFF,0x09,0xA4,0xFF,0xA7,0x9B,0xFF,0x29,0xA4,0xFF,0x8A,0xB4,0xFF,0x8A,0xB4,0xFF,0x08,0xA4,0xFF,0xE6,0x7A,0xFF,0x83,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x29,0x73,0xFF,0x8C,0xA4,0xFF,0x4A,0xA4,0xFF,0x09,0x9C,0xFF,0x09,0x9C,0xFF,0x09,0x9C,0xFF,0x87,0x8B,0xFF,0xC8,0x93,0xFF,
-    0x4A,0xA4,0xFF,0x6B,0xAC,0xFF,0xC9,0x93,0xFF,0x06,0x83,0xFF,0x67,0x8B,0xFF,0xA8,0x93,0xFF,0x67,0x8B,0xFF,0x47,0x8B,0xFF,0x88,0x8B,0xFF,0xA8,0x93,0xFF,0xE9,0x9B,0xFF,0xC9,0x93,0xFF,0x86,0x6A,0xFF,0x22,0x39,0xFF,0x83,0x49,0xFF,0xE6,0x59,0xFF,0x68,0x6A,0xFF,0x89,0x72,0xFF,0x07,0x72,0xFF,0x24,0x59,0xFF,0xE3,0x50,0xFF,0x23,0x61,0xFF,0x03,0x51,0xFF,0xE2,0x40,0xFF,0x60,0x18,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x81,0x10,0xFF,0x61,0x08,0xFF,0x61,0x00,0xFF,0xA2,0x10,0xFF,0xC2,0x18,0xFF,0xE3,0x18,0xFF,0xE3,0x18,0xFF,0xE3,0x20,0xFF,0xE2,0x20,0xFF,0x65,0x31,0xFF,0x69,0x4A,0xFF,0x28,0x42,0xFF,0xE4,0x18,0xFF,0xC3,0x18,0xFF,0x03,0x21,0xFF,0xE3,0x20,0xFF,0xE3,0x20,0xFF,0x03,0x29,0xFF,0x85,0x39,0xFF,0x84,0x39,0xFF,0x85,0x41,0xFF,0xA4,0x41,0xFF,0x84,0x41,0xFF,0x64,0x39,0xFF,0x43,0x31,0xFF,0x44,0x39,0xFF,0x03,0x31,0xFF,0x64,0x41,0xFF,0x44,0x39,0xFF,0x64,0x41,0xFF,0x26,0x62,0xFF,0x46,0x6A,0xFF,0x67,0x6A,0xFF,0x06,0x62,0xFF,0xA5,0x51,0xFF,0xC5,0x51,0xFF,0x84,0x51,0xFF,
-    0x88,0x72,0xFF,0xC5,0x51,0xFF,0x64,0x49,0xFF,0x23,0x39,0xFF,0x84,0x49,0xFF,0x05,0x62,0xFF,0xE5,0x59,0xFF,0xC5,0x59,0xFF,0xA4,0x59,0xFF,0xC4,0x61,0xFF,0xE5,0x61,0xFF,0xC4,0x61,0xFF,0xA3,0x59,0xFF,0x04,0x6A,0xFF,0x05,0x62,0xFF,0xA4,0x49,0xFF,0x02,0x29,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0xA4,0x39,0xFF,0x82,0x39,0xFF,0x62,0x31,0xFF,0xC4,0x41,0xFF,0x86,0x62,0xFF,0x44,0x6A,0xFF,0x65,0x72,0xFF,0x63,0x51,0xFF,0x63,0x51,0xFF,0x25,0x62,0xFF,0x46,0x6A,0xFF,0xE4,0x59,0xFF,0xC4,0x59,0xFF,0x83,0x51,0xFF,0x00,0x41,0xFF,0x62,0x49,0xFF,0x06,0x5A,0xFF,0xEA,0x6A,0xFF,0x0E,0x94,0xFF,0xD1,0xAC,0xFF,0x4F,0x9C,0xFF,0xED,0x93,0xFF,0x87,0x6A,0xFF,0xC4,0x59,0xFF,0x21,0x41,0xFF,0x42,0x49,0xFF,0x84,0x49,0xFF,0x63,0x49,0xFF,0xC4,0x59,0xFF,0xE4,0x61,0xFF,0x24,0x72,0xFF,0xE3,0x69,0xFF,0x64,0x7A,0xFF,0x64,0x7A,0xFF,0x43,0x7A,0xFF,0xC4,0x8A,0xFF,0x05,0x93,0xFF,0x05,0x93,0xFF,0xA4,0x82,0xFF,0xC2,0x61,0xFF,0x62,0x51,0xFF,0x02,0x41,0xFF,0x81,0x28,0xFF,0xC1,0x28,0xFF,0x81,0x18,0xFF,
-    0x21,0x10,0xFF,0xE6,0x7A,0xFF,0x88,0xBC,0xFF,0x43,0xA3,0xFF,0xA4,0xAB,0xFF,0xE8,0xD4,0xFF,0x86,0xCC,0xFF,0x45,0xBC,0xFF,0x66,0xC4,0xFF,0xA7,0xC4,0xFF,0x87,0xC4,0xFF,0x05,0xBC,0xFF,0x67,0xC4,0xFF,0x26,0xBC,0xFF,0x66,0xAB,0xFF,0x66,0xA2,0xFF,0x82,0x90,0xFF,0x42,0x90,0xFF,0xC3,0x98,0xFF,0xC7,0xB1,0xFF,0x6D,0xC3,0xFF,0xCF,0xC3,0xFF,0x10,0xC4,0xFF,0x92,0xCC,0xFF,0xF3,0xDC,0xFF,0x54,0xE5,0xFF,0xF2,0xE4,0xFF,0x4A,0xB3,0xFF,0x82,0x92,0xFF,0x65,0xAB,0xFF,0x25,0xA3,0xFF,0x26,0x9B,0xFF,0x66,0xA3,0xFF,0xA2,0x69,0xFF,0x00,0x51,0xFF,0x64,0x82,0xFF,0xAA,0xC4,0xFF,0x4F,0xE6,0xFF,0x8F,0xEE,0xFF,0xD0,0xEE,0xFF,0x6F,0xE6,0xFF,0x8F,0xEE,0xFF,0xD0,0xEE,0xFF,0xD1,0xEE,0xFF,0x91,0xE6,0xFF,0x8B,0xAC,0xFF,0xF3,0xD5,0xFF,0x97,0xDE,0xFF,0x5B,0xF7,0xFF,0x96,0xE6,0xFF,0x8E,0xCD,0xFF,0x8D,0xD5,0xFF,0xEE,0xDD,0xFF,0xEE,0xDD,0xFF,0xEE,0xDD,0xFF,0xCE,0xDD,0xFF,0xAD,0xD5,0xFF,0xEC,0xBC,0xFF,0x89,0x8B,0xFF,0xE2,0x59,0xFF,0xC3,0x51,0xFF,0x42,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x64,0x31,0xFF,0x26,0x4A,0xFF,0x88,0x5A,0xFF,0xE8,0x6A,0xFF,0xC8,0x62,0xFF,0x46,0x52,0xFF,0xC4,0x49,0xFF,0xE7,0x72,0xFF,0xC9,0x93,0xFF,0x0A,0x9C,0xFF,0xE9,0x9B,0xFF,0xE9,0x9B,0xFF,0xA9,0x8B,0xFF,0x28,0x83,0xFF,0x86,0x6A,0xFF,0x28,0x83,0xFF,0xA8,0x93,0xFF,0x29,0x9C,0xFF,0x29,0x9C,0xFF,0x8B,0xAC,0xFF,0x2A,0x9C,0xFF,0x09,0x9C,0xFF,0xA8,0x93,0xFF,0x67,0x8B,0xFF,0xC5,0x7A,0xFF,0x88,0x8B,0xFF,0xA9,0x93,0xFF,0xE4,0x51,0xFF,0x89,0x6A,0xFF,0x0D,0x7B,0xFF,
-    0x0E,0x7B,0xFF,0x0E,0x8B,0xFF,0xCD,0x8A,0xFF,0x87,0x69,0xFF,0x00,0x50,0xFF,0x00,0x58,0xFF,0xC2,0x60,0xFF,0x43,0x69,0xFF,0x43,0x59,0xFF,0xC4,0x51,0xFF,0x46,0x5A,0xFF,0xA7,0x62,0xFF,0xA7,0x5A,0xFF,0x06,0x4A,0xFF,0x43,0x29,0xFF,0xA1,0x10,0xFF,0xA2,0x10,0xFF,0xC2,0x18,0xFF,0xE3,0x20,0xFF,0xE3,0x20,0xFF,0x03,0x21,0xFF,0x44,0x29,0xFF,0xE7,0x39,0xFF,0x28,0x42,0xFF,0xC7,0x39,0xFF,0xA2,0x10,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE3,0x20,0xFF,0x64,0x31,0xFF,0x44,0x39,0xFF,0x43,0x39,0xFF,0xA5,0x41,0xFF,0xA4,0x41,0xFF,0x84,0x41,0xFF,0x43,0x31,0xFF,0x23,0x31,0xFF,0x03,0x31,0xFF,0x44,0x39,0xFF,0x44,0x39,0xFF,0xA5,0x49,0xFF,0x67,0x6A,0xFF,0xA7,0x7A,0xFF,0x67,0x72,0xFF,0x26,0x6A,0xFF,0xA4,0x51,0xFF,0x85,0x51,0xFF,0x85,0x59,0xFF,0x67,0x6A,0xFF,0xE5,0x51,0xFF,0xC5,0x51,0xFF,0xA4,0x51,0xFF,0xC5,0x59,0xFF,0xC4,0x59,0xFF,0x64,0x49,0xFF,0x84,0x51,0xFF,0xA4,0x51,0xFF,0x05,0x62,0xFF,0x25,0x6A,0xFF,0x66,0x7A,0xFF,0x04,0x72,0xFF,0x25,0x72,0xFF,0x46,0x6A,0xFF,0xA4,0x49,0xFF,
-    0x02,0x29,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0xC4,0x41,0xFF,0x83,0x39,0xFF,0x62,0x31,0xFF,0x42,0x29,0xFF,0xE3,0x49,0xFF,0x23,0x5A,0xFF,0x86,0x72,0xFF,0xC4,0x59,0xFF,0xA4,0x51,0xFF,0x83,0x49,0xFF,0x62,0x49,0xFF,0x62,0x49,0xFF,0x05,0x5A,0xFF,0x09,0x73,0xFF,0xCC,0x8B,0xFF,0x8F,0xA4,0xFF,0x90,0xA4,0xFF,0xCD,0x8B,0xFF,0x0A,0x73,0xFF,0x26,0x52,0xFF,0x63,0x41,0xFF,0xE5,0x51,0xFF,0xE5,0x59,0xFF,0x26,0x62,0xFF,0x84,0x49,0xFF,0x23,0x39,0xFF,0xA4,0x49,0xFF,0x46,0x62,0xFF,0x25,0x62,0xFF,0xE4,0x59,0xFF,0xC3,0x61,0xFF,0x64,0x7A,0xFF,0xE5,0x8A,0xFF,0xE5,0x92,0xFF,0xC4,0x8A,0xFF,0x25,0x93,0xFF,0x45,0x9B,0xFF,0x05,0x93,0xFF,0xA4,0x82,0xFF,0x85,0x72,0xFF,0x85,0x72,0xFF,0x65,0x62,0xFF,0x04,0x52,0xFF,0x42,0x39,0xFF,0x40,0x10,0xFF,0x00,0x00,0xFF,0xE6,0x7A,0xFF,0x89,0xBC,0xFF,0x64,0xA3,0xFF,0xC4,0xAB,0xFF,0x45,0xC4,0xFF,0x86,0xC4,0xFF,0xA7,0xCC,0xFF,0x46,0xBC,0xFF,0x29,0xD5,0xFF,0x29,0xD5,0xFF,0x09,0xCD,0xFF,0x29,0xD5,0xFF,0x05,0xBC,0xFF,0x67,0xB3,0xFF,0xC4,0x91,0xFF,
-    0x62,0xA0,0xFF,0xA3,0xA0,0xFF,0x00,0x88,0xFF,0xCB,0xB2,0xFF,0x92,0xDC,0xFF,0x92,0xD4,0xFF,0x72,0xD4,0xFF,0x92,0xCC,0xFF,0xB2,0xCC,0xFF,0xF3,0xDC,0xFF,0x30,0xD4,0xFF,0x68,0xAA,0xFF,0xA5,0x9A,0xFF,0x89,0xCC,0xFF,0x4B,0xDD,0xFF,0x2B,0xDD,0xFF,0xE8,0xB3,0xFF,0x61,0x59,0xFF,0x40,0x28,0xFF,0x40,0x28,0xFF,0x44,0x72,0xFF,0x29,0xB4,0xFF,0x4C,0xCD,0xFF,0x0E,0xDE,0xFF,0x2E,0xE6,0xFF,0x8F,0xEE,0xFF,0x11,0xF7,0xFF,0x32,0xF7,0xFF,0x10,0xD6,0xFF,0x4B,0xA4,0xFF,0x4F,0xC5,0xFF,0x50,0xBD,0xFF,0x97,0xDE,0xFF,0xF8,0xEE,0xFF,0x11,0xD6,0xFF,0xAD,0xD5,0xFF,0xCE,0xD5,0xFF,0x2F,0xE6,0xFF,0xEE,0xD5,0xFF,0x8C,0xCD,0xFF,0xED,0xDD,0xFF,0xEE,0xDD,0xFF,0xD0,0xD5,0xFF,0x67,0x52,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE3,0x20,0xFF,0x87,0x5A,0xFF,0x29,0x73,0xFF,0x8A,0x83,0xFF,0xCA,0x93,0xFF,0x2B,0x9C,0xFF,0x4C,0xA4,0xFF,0x0A,0x9C,0xFF,0xA9,0x8B,0xFF,0x48,0x83,0xFF,0x65,0x6A,0xFF,0xC3,0x51,0xFF,0x42,0x41,0xFF,0x42,0x39,0xFF,0x42,0x41,0xFF,0x22,0x39,0xFF,0x22,0x39,0xFF,0x61,0x49,0xFF,0x68,0x8B,0xFF,0x09,0x9C,0xFF,0x8B,0xAC,0xFF,0xCC,0xB4,0xFF,0x6A,0xA4,0xFF,0x4A,0xA4,0xFF,0x6B,0xA4,0xFF,0xC9,0x93,0xFF,0xA8,0x8B,0xFF,0x67,0x8B,0xFF,0x47,0x83,0xFF,0xC6,0x7A,0xFF,0x28,0x62,0xFF,0xED,0x7A,0xFF,0xEE,0x7A,0xFF,0xCE,0x7A,0xFF,0xEF,0x82,0xFF,0xEF,0x8A,0xFF,0x6C,0x82,0xFF,0x00,0x40,0xFF,0x20,0x60,0xFF,0xC2,0x70,0xFF,0x81,0x68,0xFF,0x01,0x61,0xFF,0x65,0x72,0xFF,0x44,0x62,0xFF,0x44,0x62,0xFF,0x65,0x5A,0xFF,0x66,0x5A,0xFF,0xC7,0x62,0xFF,0x87,0x5A,0xFF,
-    0xC2,0x18,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xE2,0x18,0xFF,0x03,0x21,0xFF,0x03,0x21,0xFF,0x24,0x21,0xFF,0x29,0x4A,0xFF,0x08,0x42,0xFF,0xA3,0x10,0xFF,0x82,0x10,0xFF,0xC2,0x18,0xFF,0xE3,0x20,0xFF,0x03,0x29,0xFF,0x23,0x31,0xFF,0x64,0x39,0xFF,0x64,0x39,0xFF,0x84,0x39,0xFF,0x43,0x31,0xFF,0x23,0x29,0xFF,0x03,0x29,0xFF,0x23,0x31,0xFF,0x44,0x39,0xFF,0x84,0x49,0xFF,0x87,0x72,0xFF,0x66,0x72,0xFF,0x05,0x6A,0xFF,0xC4,0x59,0xFF,0x84,0x51,0xFF,0xA5,0x51,0xFF,0x64,0x51,0xFF,0x67,0x6A,0xFF,0x06,0x5A,0xFF,0xC4,0x51,0xFF,0xC4,0x51,0xFF,0x63,0x41,0xFF,0x43,0x41,0xFF,0x84,0x49,0xFF,0xE5,0x59,0xFF,0x26,0x6A,0xFF,0xA7,0x7A,0xFF,0xE4,0x69,0xFF,0x45,0x72,0xFF,0xC4,0x61,0xFF,0xA3,0x59,0xFF,0x63,0x49,0xFF,0x43,0x39,0xFF,0xE2,0x20,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0x05,0x4A,0xFF,0xC3,0x41,0xFF,0xA3,0x39,0xFF,0xC3,0x41,0xFF,0x04,0x4A,0xFF,0xC3,0x51,0xFF,0x65,0x6A,0xFF,0x01,0x41,0xFF,0x22,0x41,0xFF,0x26,0x5A,0xFF,0x09,0x7B,0xFF,0x0D,0x94,0xFF,0x6E,0xA4,0xFF,
-    0x6F,0xA4,0xFF,0x8C,0x83,0xFF,0xA8,0x62,0xFF,0x84,0x41,0xFF,0x22,0x39,0xFF,0x44,0x39,0xFF,0x84,0x41,0xFF,0xC6,0x49,0xFF,0xC5,0x49,0xFF,0xC5,0x51,0xFF,0xE6,0x51,0xFF,0xA5,0x49,0xFF,0x84,0x41,0xFF,0x63,0x41,0xFF,0xA4,0x49,0xFF,0xE4,0x51,0xFF,0xE4,0x51,0xFF,0xC4,0x59,0xFF,0x44,0x6A,0xFF,0xA5,0x7A,0xFF,0x85,0x7A,0xFF,0x84,0x7A,0xFF,0x66,0x9B,0xFF,0x07,0xAC,0xFF,0xC7,0xAB,0xFF,0xC7,0xAB,0xFF,0xC7,0xAB,0xFF,0xC7,0xAB,0xFF,0x28,0xB4,0xFF,0x07,0xAC,0xFF,0xA8,0x9B,0xFF,0x47,0x8B,0xFF,0x65,0x62,0xFF,0x21,0x41,0xFF,0x47,0x93,0xFF,0x28,0xB4,0xFF,0x47,0xBC,0xFF,0x86,0xC4,0xFF,0xA7,0xCC,0xFF,0xC8,0xCC,0xFF,0x87,0xC4,0xFF,0x49,0xD5,0xFF,0x8A,0xDD,0xFF,0xA7,0xC4,0xFF,0x87,0xC4,0xFF,0x49,0xC4,0xFF,0x48,0xAB,0xFF,0x00,0x68,0xFF,0x83,0x90,0xFF,0x83,0xA0,0xFF,0x00,0x88,0xFF,0x8A,0xB2,0xFF,0xCF,0xCB,0xFF,0xF0,0xC3,0xFF,0xCF,0xBB,0xFF,0xCF,0xBB,0xFF,0xD0,0xBB,0xFF,0x31,0xC4,0xFF,0x10,0xCC,0xFF,0x08,0xAA,0xFF,0xC6,0xB2,0xFF,0x27,0xCC,0xFF,0x84,0xAB,0xFF,0xE3,0x9A,0xFF,
-    0x60,0x61,0xFF,0x20,0x51,0xFF,0x62,0x49,0xFF,0x62,0x49,0xFF,0xC0,0x38,0xFF,0xC3,0x59,0xFF,0x26,0x93,0xFF,0xE8,0xAB,0xFF,0x8A,0xB4,0xFF,0xEC,0xC4,0xFF,0x6D,0xC5,0xFF,0x4D,0xBD,0xFF,0xA6,0x62,0xFF,0x66,0x62,0xFF,0xCD,0xB4,0xFF,0x91,0xCD,0xFF,0xB8,0xE6,0xFF,0x9B,0xF7,0xFF,0x18,0xEF,0xFF,0xAD,0xD5,0xFF,0xCD,0xD5,0xFF,0x4F,0xE6,0xFF,0x4F,0xE6,0xFF,0xAD,0xD5,0xFF,0xAD,0xD5,0xFF,0x2E,0xE6,0xFF,0x31,0xDE,0xFF,0x6A,0x7B,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x84,0x31,0xFF,0x8B,0x83,0xFF,
-    0x2B,0x9C,0xFF,0x4B,0xA4,0xFF,0xE9,0x9B,0xFF,0xE9,0x9B,0xFF,0x09,0x9C,0xFF,0xE9,0x9B,0xFF,0x0A,0x9C,0xFF,0x2A,0x9C,0xFF,0x2A,0x9C,0xFF,0x88,0x8B,0xFF,0xAA,0x8B,0xFF,0x84,0x39,0xFF,0x00,0x00,0xFF,0x47,0x52,0xFF,0xA7,0x6A,0xFF,0xA6,0x72,0xFF,0xC6,0x7A,0xFF,0xC5,0x7A,0xFF,0xC8,0x9B,0xFF,0x4A,0xA4,0xFF,0xAB,0xAC,0xFF,0xCC,0xAC,0xFF,0xEC,0xB4,0xFF,0xAB,0xAC,0xFF,0x88,0x8B,0xFF,0xC8,0x93,0xFF,0x0A,0xA4,0xFF,0x88,0x93,0xFF,0x68,0x72,0xFF,0xCD,0x7A,0xFF,0xEE,0x7A,0xFF,0xEF,0x7A,0xFF,0xCE,0x7A,0xFF,0xCF,0x82,0xFF,0xCF,0x8A,0xFF,0x4B,0x82,0xFF,0xC4,0x58,0xFF,0xA3,0x68,0xFF,0x00,0x68,0xFF,0x00,0x60,0xFF,0xE4,0x79,0xFF,0xC6,0x82,0xFF,0xE2,0x59,0xFF,0xC2,0x51,0xFF,0xA2,0x49,0xFF,0x40,0x39,0xFF,0xE3,0x49,0xFF,0x66,0x5A,0xFF,0x42,0x31,0xFF,0x61,0x08,0xFF,0xA2,0x10,0xFF,0xC2,0x10,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0xE3,0x20,0xFF,0xE2,0x20,0xFF,0xA1,0x10,0xFF,0xA6,0x31,0xFF,0x28,0x42,0xFF,0x24,0x21,0xFF,0x82,0x08,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE3,0x20,0xFF,
-    0x64,0x31,0xFF,0x23,0x29,0xFF,0x23,0x31,0xFF,0x23,0x31,0xFF,0x23,0x29,0xFF,0x03,0x29,0xFF,0x23,0x31,0xFF,0x23,0x31,0xFF,0x84,0x41,0xFF,0x46,0x6A,0xFF,0x25,0x6A,0xFF,0xE5,0x61,0xFF,0xA4,0x59,0xFF,0x64,0x51,0xFF,0x64,0x51,0xFF,0x43,0x49,0xFF,0x26,0x6A,0xFF,0xC5,0x51,0xFF,0x83,0x41,0xFF,0xC4,0x49,0xFF,0xC5,0x51,0xFF,0xE5,0x59,0xFF,0x05,0x62,0xFF,0xE5,0x61,0xFF,0xC3,0x59,0xFF,0x46,0x72,0xFF,0xE4,0x69,0xFF,0xE4,0x61,0xFF,0xC4,0x61,0xFF,0xA3,0x51,0xFF,0x63,0x49,0xFF,0xE2,0x28,0xFF,0xC2,0x20,0xFF,0x81,0x10,0xFF,0xC1,0x20,0xFF,0x45,0x52,0xFF,0xE3,0x49,0xFF,0xC3,0x39,0xFF,0xE3,0x41,0xFF,0xE4,0x49,0xFF,0xC3,0x51,0xFF,0x85,0x72,0xFF,0xAA,0x93,0xFF,0x2D,0xA4,0xFF,0xCB,0x93,0xFF,0xCC,0x93,0xFF,0x29,0x7B,0xFF,0x05,0x5A,0xFF,0xA3,0x49,0xFF,0x83,0x41,0xFF,0x84,0x41,0xFF,0xA8,0x62,0xFF,0x26,0x52,0xFF,0x64,0x41,0xFF,0x85,0x41,0xFF,0xC6,0x49,0xFF,0xE6,0x49,0xFF,0x85,0x41,0xFF,0x64,0x39,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,0x63,0x39,0xFF,0x43,0x39,0xFF,
-    0x83,0x41,0xFF,0x84,0x41,0xFF,0x83,0x41,0xFF,0x83,0x41,0xFF,0x42,0x41,0xFF,0x26,0x8B,0xFF,0x89,0xC4,0xFF,0x47,0xBC,0xFF,0xA4,0xAB,0xFF,0xA4,0xAB,0xFF,0xA4,0xAB,0xFF,0xC5,0xB3,0xFF,0x66,0xC4,0xFF,0x05,0xB4,0xFF,0x44,0x9B,0xFF,0xE7,0xAB,0xFF,0x26,0x93,0xFF,0xE4,0x59,0xFF,0x00,0x28,0xFF,0xA2,0x61,0xFF,0x25,0x93,0xFF,0x07,0xB4,0xFF,0xA8,0xC4,0xFF,0x09,0xCD,0xFF,0x2A,0xD5,0xFF,0x09,0xD5,0xFF,0xEA,0xCC,0xFF,0xEA,0xCC,0xFF,0xCB,0xC4,0xFF,0x69,0x9B,0xFF,0xA1,0x60,0xFF,0x07,0x9A,0xFF,0x00,0x78,0xFF,0xC3,0xA0,0xFF,0x00,0x88,0xFF,0xA7,0x99,0xFF,0x6F,0xCB,0xFF,0x8F,0xC3,0xFF,0xCF,0xC3,0xFF,0xCF,0xBB,0xFF,0x8F,0xBB,0xFF,0x8E,0xB3,0xFF,0xCF,0xBB,0xFF,0x08,0xA2,0xFF,0xC5,0xA9,0xFF,0x89,0xD4,0xFF,0x29,0xDD,0xFF,0x47,0xC4,0xFF,0xE7,0xAB,0xFF,0x28,0xB4,0xFF,0xA7,0xA3,0xFF,0x44,0x6A,0xFF,0x01,0x41,0xFF,0x00,0x20,0xFF,0x00,0x18,0xFF,0x21,0x49,0xFF,0x82,0x51,0xFF,0xA2,0x51,0xFF,0x41,0x41,0xFF,0x00,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6A,0x7B,0xFF,0x30,0xBD,0xFF,
-    0xF5,0xCD,0xFF,0x98,0xDE,0xFF,0xF7,0xE6,0xFF,0x71,0xE6,0xFF,0x0E,0xE6,0xFF,0x4F,0xE6,0xFF,0x4F,0xE6,0xFF,0x4F,0xE6,0xFF,0x4F,0xE6,0xFF,0x50,0xE6,0xFF,0xB0,0xCD,0xFF,0x87,0x5A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA5,0x39,0xFF,0x6A,0x7B,0xFF,0x0B,0x9C,0xFF,0x8C,0xAC,0xFF,0x8B,0xAC,0xFF,0xE9,0x93,0xFF,0x8B,0xAC,0xFF,0x09,0x9C,0xFF,0xE9,0x9B,0xFF,0x2A,0xA4,0xFF,0x4B,0xA4,0xFF,0x0A,0x9C,0xFF,0xA9,0x93,0xFF,0x4C,0xA4,0xFF,0x06,0x52,0xFF,0xE8,0x6A,0xFF,0x89,0x83,0xFF,0x88,0x8B,0xFF,0xC8,0x9B,0xFF,
-    0xC8,0x9B,0xFF,0x26,0x8B,0xFF,0xA5,0x82,0xFF,0xC9,0x9B,0xFF,0x8B,0xAC,0xFF,0xAB,0xAC,0xFF,0x0C,0xBD,0xFF,0xEC,0xB4,0xFF,0x8B,0xAC,0xFF,0x8B,0xAC,0xFF,0xC9,0x9B,0xFF,0x66,0x72,0xFF,0xAB,0x82,0xFF,0xEE,0x8A,0xFF,0xCF,0x8A,0xFF,0xCE,0x82,0xFF,0x8E,0x82,0xFF,0x8E,0x8A,0xFF,0x8E,0x92,0xFF,0xA9,0x79,0xFF,0xCA,0x81,0xFF,0xA9,0x89,0xFF,0x20,0x70,0xFF,0x20,0x68,0xFF,0x63,0x71,0xFF,0xE3,0x61,0xFF,0x44,0x62,0xFF,0x24,0x5A,0xFF,0x81,0x49,0xFF,0x61,0x41,0xFF,0x82,0x41,0xFF,0xC3,0x49,0xFF,0x62,0x39,0xFF,0x80,0x18,0xFF,0xA1,0x18,0xFF,0x81,0x10,0xFF,0x81,0x08,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0xE3,0x18,0xFF,0x61,0x08,0xFF,0xE4,0x18,0xFF,0xC7,0x39,0xFF,0xA6,0x31,0xFF,0xC3,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0x03,0x21,0xFF,0xE3,0x20,0xFF,0xE3,0x20,0xFF,0x24,0x29,0xFF,0xE3,0x20,0xFF,0xE3,0x20,0xFF,0x03,0x29,0xFF,0x43,0x39,0xFF,0x05,0x5A,0xFF,0x25,0x6A,0xFF,0xE4,0x61,0xFF,0xA4,0x59,0xFF,0x63,0x51,0xFF,0x43,0x49,0xFF,0x64,0x49,0xFF,
-    0x26,0x62,0xFF,0xE5,0x51,0xFF,0xA3,0x49,0xFF,0x05,0x5A,0xFF,0x25,0x62,0xFF,0x05,0x62,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0xE4,0x61,0xFF,0xC4,0x59,0xFF,0xE4,0x61,0xFF,0xE4,0x61,0xFF,0x05,0x62,0xFF,0xC4,0x49,0xFF,0xE2,0x28,0xFF,0xA1,0x18,0xFF,0x40,0x08,0xFF,0xE1,0x20,0xFF,0x45,0x52,0xFF,0x03,0x4A,0xFF,0xE3,0x49,0xFF,0x03,0x4A,0xFF,0x24,0x52,0xFF,0xE3,0x51,0xFF,0x85,0x72,0xFF,0x89,0x93,0xFF,0xE7,0x82,0xFF,0x24,0x6A,0xFF,0x03,0x62,0xFF,0xE3,0x59,0xFF,0xE4,0x51,0xFF,0xE4,0x49,0xFF,0x84,0x39,0xFF,0x43,0x39,0xFF,0xCC,0x8B,0xFF,0xA8,0x6A,0xFF,0x43,0x39,0xFF,0x85,0x41,0xFF,0xA5,0x41,0xFF,0xA5,0x41,0xFF,0x84,0x39,0xFF,0x84,0x39,0xFF,0xA4,0x41,0xFF,0xA4,0x41,0xFF,0xC5,0x41,0xFF,0xC4,0x41,0xFF,0xA5,0x41,0xFF,0xA5,0x39,0xFF,0x64,0x31,0xFF,0x23,0x29,0xFF,0xC2,0x18,0xFF,0x22,0x31,0xFF,0x87,0x9B,0xFF,0xA5,0xAB,0xFF,0xC5,0xB3,0xFF,0x06,0xBC,0xFF,0x25,0xBC,0xFF,0x66,0xC4,0xFF,0xE4,0xB3,0xFF,0x05,0xBC,0xFF,0x84,0xAB,0xFF,0x23,0x9B,0xFF,0xE3,0x92,0xFF,
-    0x43,0x7A,0xFF,0x41,0x51,0xFF,0xE1,0x38,0xFF,0x42,0x59,0xFF,0x60,0x61,0xFF,0xE1,0x79,0xFF,0x82,0x8A,0xFF,0xE3,0x92,0xFF,0x64,0xA3,0xFF,0x85,0xA3,0xFF,0xE4,0x92,0xFF,0x23,0x7A,0xFF,0x82,0x71,0xFF,0xC4,0x81,0xFF,0xA7,0xAA,0xFF,0xC8,0xBA,0xFF,0x45,0xB1,0xFF,0x62,0xA8,0xFF,0x00,0x90,0xFF,0x25,0x99,0xFF,0xED,0xCA,0xFF,0x2E,0xC3,0xFF,0x6E,0xBB,0xFF,0x8E,0xBB,0xFF,0x8E,0xB3,0xFF,0x8E,0xB3,0xFF,0xAE,0xBB,0xFF,0xE8,0x91,0xFF,0x44,0xA9,0xFF,0x8A,0xDC,0xFF,0x8B,0xE5,0xFF,0x67,0xC4,0xFF,0x27,0xBC,0xFF,0xC6,0xAB,0xFF,0x25,0x93,0xFF,0xA4,0x7A,0xFF,0x43,0x6A,0xFF,0xA5,0x72,0xFF,0x07,0x7B,0xFF,0x66,0x6A,0xFF,0x81,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0xA9,0x5A,0xFF,0xD4,0xC5,0xFF,0x5B,0xEF,0xFF,0x7B,0xF7,0xFF,0xD3,0xC5,0xFF,0x8B,0xAC,0xFF,0x2C,0xBD,0xFF,0xAE,0xCD,0xFF,0xAE,0xCD,0xFF,0x8E,0xCD,0xFF,0x4D,0xC5,0xFF,0x6B,0xAC,0xFF,0x08,0x73,0xFF,0x60,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x88,0x52,0xFF,0x2C,0x94,0xFF,0x2A,0x9C,0xFF,0x4A,0x9C,0xFF,0x6B,0xA4,0xFF,0xC8,0x93,0xFF,0x09,0x9C,0xFF,0xC8,0x93,0xFF,0xA8,0x93,0xFF,0xE9,0x9B,0xFF,0xA9,0x93,0xFF,0x48,0x8B,0xFF,0xCA,0x93,0xFF,0xA7,0x6A,0xFF,0xA8,0x62,0xFF,0x0B,0x94,0xFF,0x2A,0x9C,0xFF,0x09,0x9C,0xFF,0x09,0xA4,0xFF,0xE8,0x9B,0xFF,0xA8,0x9B,0xFF,0x23,0x6A,0xFF,0x24,0x6A,0xFF,0x06,0x8B,0xFF,0x67,0x93,0xFF,0x48,0x8B,0xFF,0xA9,0x93,0xFF,0xCA,0x9B,0xFF,0x69,0x93,0xFF,0x24,0x6A,0xFF,0xC7,0x69,0xFF,0xEE,0x92,0xFF,0xCF,0x8A,0xFF,0xAE,0x8A,0xFF,0x8E,0x8A,0xFF,
-    0xAE,0x9A,0xFF,0xAF,0xA2,0xFF,0x0C,0x8A,0xFF,0x07,0x69,0xFF,0xAA,0x89,0xFF,0x2C,0x9A,0xFF,0xA3,0x70,0xFF,0x40,0x60,0xFF,0x01,0x59,0xFF,0x82,0x51,0xFF,0x04,0x5A,0xFF,0x24,0x5A,0xFF,0xA2,0x49,0xFF,0xE3,0x51,0xFF,0x24,0x5A,0xFF,0x85,0x62,0xFF,0x45,0x62,0xFF,0x45,0x5A,0xFF,0x25,0x52,0xFF,0x05,0x4A,0xFF,0x43,0x29,0xFF,0x81,0x10,0xFF,0xA2,0x10,0xFF,0xA2,0x10,0xFF,0xC2,0x18,0xFF,0xA2,0x10,0xFF,0xC2,0x10,0xFF,0xE3,0x18,0xFF,0xC6,0x39,0xFF,0x49,0x4A,0xFF,0xE4,0x18,0xFF,0xC3,0x18,0xFF,0xE3,0x18,0xFF,0xC2,0x18,0xFF,0xE3,0x18,0xFF,0xC2,0x18,0xFF,0x24,0x29,0xFF,0x89,0x4A,0xFF,0x07,0x42,0xFF,0x03,0x21,0xFF,0x02,0x31,0xFF,0xE5,0x59,0xFF,0x46,0x72,0xFF,0xC4,0x61,0xFF,0xC5,0x59,0xFF,0x63,0x49,0xFF,0xE2,0x30,0xFF,0x64,0x49,0xFF,0x06,0x62,0xFF,0x26,0x5A,0xFF,0x83,0x41,0xFF,0xC4,0x51,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0xA4,0x51,0xFF,0x43,0x41,0xFF,0x43,0x49,0xFF,0x83,0x49,0xFF,0xE5,0x59,0xFF,0xE4,0x59,0xFF,0xA4,0x51,0xFF,0x22,0x31,0xFF,0x60,0x18,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0xC1,0x18,0xFF,0x45,0x52,0xFF,0x23,0x4A,0xFF,0x23,0x4A,0xFF,0x23,0x4A,0xFF,0x24,0x52,0xFF,0x24,0x5A,0xFF,0x24,0x6A,0xFF,0xC2,0x61,0xFF,0x23,0x6A,0xFF,0x85,0x7A,0xFF,0x65,0x72,0xFF,0x65,0x72,0xFF,0x45,0x62,0xFF,0xE5,0x51,0xFF,0x43,0x39,0xFF,0x02,0x29,0xFF,0xE5,0x49,0xFF,0xE5,0x51,0xFF,0x84,0x41,0xFF,0x84,0x41,0xFF,0xA5,0x41,0xFF,0xE5,0x41,0xFF,0xC5,0x41,0xFF,0xE6,0x41,0xFF,0x06,0x42,0xFF,0xE5,0x41,0xFF,0xC5,0x39,0xFF,0xA5,0x39,0xFF,0x03,0x21,0xFF,0xA1,0x18,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x60,0x18,0xFF,0x67,0x93,0xFF,0x08,0xB4,0xFF,0xE5,0xB3,0xFF,0x26,0xBC,0xFF,0x87,0xC4,0xFF,0x46,0xC4,0xFF,0x66,0xC4,0xFF,0x25,0xBC,0xFF,0xC5,0xB3,0xFF,0x64,0xA3,0xFF,0xC2,0x92,0xFF,0x80,0x61,0xFF,0x83,0x51,0xFF,0x01,0x41,0xFF,0x62,0x59,0xFF,0xC2,0x69,0xFF,0xE5,0x92,0xFF,0x05,0x93,0xFF,0x25,0x9B,0xFF,0xE7,0xAB,0xFF,0x6A,0xBC,0xFF,0xAB,0xBC,0xFF,0x4A,0xBC,0xFF,0x6B,0xCC,0xFF,0x89,0xBB,0xFF,0xE4,0x89,0xFF,0xC1,0x80,0xFF,
-    0x29,0xCA,0xFF,0xE9,0xD9,0xFF,0xA4,0xB8,0xFF,0x26,0xB9,0xFF,0x8C,0xD2,0xFF,0xCD,0xCA,0xFF,0x0D,0xC3,0xFF,0x4E,0xBB,0xFF,0x8E,0xBB,0xFF,0xF0,0xC3,0xFF,0x10,0xC4,0xFF,0x69,0x92,0xFF,0xE3,0x90,0xFF,0xC6,0xAA,0xFF,0xA7,0xAB,0xFF,0xC6,0xAB,0xFF,0x89,0xC4,0xFF,0x6C,0xD5,0xFF,0x8D,0xD5,0xFF,0x8D,0xD5,0xFF,0x6C,0xD5,0xFF,0x0B,0xC5,0xFF,0x6A,0xAC,0xFF,0x25,0x5A,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x60,0x10,0xFF,0x6F,0x9C,0xFF,0x73,0xBD,0xFF,0xD9,0xE6,0xFF,0x7C,0xF7,0xFF,0x15,0xC6,0xFF,0xA0,0x51,0xFF,0x85,0x6A,0xFF,0x64,0x62,0xFF,0xC6,0x72,0xFF,0x07,0x7B,0xFF,0x85,0x6A,0xFF,0xE4,0x49,0xFF,0x60,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x64,0x31,0xFF,0xEB,0x8B,0xFF,0x4B,0x9C,0xFF,0x2A,0x9C,0xFF,0x6B,0xA4,0xFF,0x2A,0x9C,0xFF,0xC9,0x93,0xFF,0xC9,0x93,0xFF,0xA8,0x8B,0xFF,0xC9,0x93,0xFF,0xC9,0x93,0xFF,0x89,0x8B,0xFF,0x45,0x5A,0xFF,0x00,0x00,0xFF,0x09,0x6B,0xFF,0x8D,0xA4,0xFF,0x2A,0x9C,0xFF,0xE9,0x9B,0xFF,0x08,0x9C,0xFF,0xE8,0xA3,0xFF,0xE8,0xA3,0xFF,0xA5,0x7A,0xFF,0x00,0x41,0xFF,0xE0,0x40,0xFF,0xA2,0x59,0xFF,0x62,0x59,0xFF,0xA2,0x59,0xFF,0xA3,0x59,0xFF,0x62,0x51,0xFF,0x43,0x51,0xFF,0xAC,0x8A,0xFF,0x0F,0x93,0xFF,0xAF,0x8A,0xFF,0x8E,0x8A,0xFF,0x4D,0x8A,0xFF,0x4D,0xA2,0xFF,0xEB,0x99,0xFF,0xE7,0x80,0xFF,0xA6,0x78,0xFF,0x69,0x81,0xFF,0xAE,0xB2,0xFF,0x25,0x81,0xFF,0x00,0x58,0xFF,0x01,0x49,0xFF,0xE3,0x59,0xFF,0xA3,0x51,0xFF,0xA2,0x49,0xFF,0xA2,0x49,0xFF,0xA2,0x49,0xFF,0x03,0x5A,0xFF,0x64,0x62,0xFF,
-    0x44,0x62,0xFF,0xA2,0x51,0xFF,0xE3,0x51,0xFF,0x66,0x62,0xFF,0xA7,0x6A,0xFF,0x05,0x4A,0xFF,0x61,0x10,0xFF,0x81,0x08,0xFF,0x82,0x10,0xFF,0xA3,0x10,0xFF,0xC3,0x10,0xFF,0x03,0x19,0xFF,0xE2,0x18,0xFF,0x44,0x29,0xFF,0x86,0x31,0xFF,0x65,0x29,0xFF,0xE3,0x18,0xFF,0xE3,0x18,0xFF,0xE3,0x18,0xFF,0xA2,0x10,0xFF,0x24,0x21,0xFF,0x4C,0x6B,0xFF,0x6D,0x6B,0xFF,0x03,0x21,0xFF,0x23,0x29,0xFF,0xC4,0x51,0xFF,0x66,0x72,0xFF,0x46,0x62,0xFF,0x47,0x62,0xFF,0xEA,0x72,0xFF,0xEA,0x72,0xFF,0x64,0x49,0xFF,0xA4,0x51,0xFF,0xA4,0x49,0xFF,0x63,0x41,0xFF,0xC4,0x51,0xFF,0x05,0x5A,0xFF,0xC4,0x51,0xFF,0x84,0x49,0xFF,0x63,0x41,0xFF,0x23,0x39,0xFF,0x43,0x41,0xFF,0x63,0x41,0xFF,0x02,0x39,0xFF,0x01,0x39,0xFF,0xC0,0x30,0xFF,0xA4,0x41,0xFF,0xA8,0x5A,0xFF,0x4B,0x6B,0xFF,0xA9,0x5A,0xFF,0xE1,0x20,0xFF,0x25,0x4A,0xFF,0x03,0x4A,0xFF,0x43,0x4A,0xFF,0x23,0x42,0xFF,0x44,0x4A,0xFF,0x44,0x52,0xFF,0x44,0x62,0xFF,0x24,0x6A,0xFF,0x44,0x6A,0xFF,0x65,0x72,0xFF,0x65,0x7A,0xFF,0x65,0x72,0xFF,0x66,0x6A,0xFF,
-    0x26,0x62,0xFF,0xE5,0x49,0xFF,0x84,0x39,0xFF,0x84,0x39,0xFF,0xC5,0x41,0xFF,0xC5,0x41,0xFF,0xE5,0x41,0xFF,0x26,0x4A,0xFF,0x27,0x4A,0xFF,0x27,0x4A,0xFF,0x06,0x42,0xFF,0x85,0x31,0xFF,0x23,0x29,0xFF,0x81,0x10,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x04,0x5A,0xFF,0xC8,0x9B,0xFF,0x28,0xB4,0xFF,0x06,0xB4,0xFF,0x47,0xBC,0xFF,0x06,0xB4,0xFF,0x26,0xBC,0xFF,0x46,0xBC,0xFF,0x26,0xBC,0xFF,0x47,0xBC,0xFF,0x08,0xB4,0xFF,0xC9,0x9B,0xFF,0x05,0x5A,0xFF,0x00,0x30,0xFF,0x21,0x51,0xFF,0xC0,0x48,0xFF,0x41,0x59,0xFF,0x03,0x72,0xFF,0x64,0x82,0xFF,0x06,0x93,0xFF,0xA7,0xA3,0xFF,0x09,0xB4,0xFF,0xA8,0xAB,0xFF,0xA5,0x9A,0xFF,0xE0,0x70,0xFF,0x60,0x60,0xFF,0x02,0x81,0xFF,0x86,0xA9,0xFF,0x6B,0xE2,0xFF,0x4B,0xEA,0xFF,0xE5,0xC8,0xFF,0x0A,0xD2,0xFF,0x6B,0xCA,0xFF,0xAC,0xC2,0xFF,0x2E,0xC3,0xFF,0x6F,0xBB,0xFF,0x8F,0xBB,0xFF,0x10,0xC4,0xFF,0xEC,0xA2,0xFF,0x41,0x80,0xFF,0x07,0xA2,0xFF,0x00,0x51,0xFF,0x69,0x8B,0xFF,
-    0xCE,0xB4,0xFF,0xAB,0xB4,0xFF,0x48,0xAC,0xFF,0x49,0xA4,0xFF,0xE8,0x9B,0xFF,0x67,0x8B,0xFF,0xA6,0x6A,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0x73,0xFF,0x16,0xCE,0xFF,0xB9,0xDE,0xFF,0x73,0xBD,0xFF,0x32,0xAD,0xFF,0x15,0xC6,0xFF,0x94,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x61,0x10,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0xC4,0x41,0xFF,0xA7,0x62,0xFF,
-    0x48,0x7B,0xFF,0xAA,0x8B,0xFF,0xCA,0x8B,0xFF,0x89,0x83,0xFF,0xA9,0x8B,0xFF,0x27,0x7B,0xFF,0xE7,0x72,0xFF,0x04,0x5A,0xFF,0x42,0x39,0xFF,0x40,0x18,0xFF,0x00,0x00,0xFF,0x23,0x29,0xFF,0xCC,0x83,0xFF,0x2C,0x9C,0xFF,0x0A,0x9C,0xFF,0xE9,0x9B,0xFF,0x09,0xA4,0xFF,0xA8,0x93,0xFF,0xC8,0x9B,0xFF,0x68,0x8B,0xFF,0xC7,0x72,0xFF,0xA7,0x6A,0xFF,0x87,0x62,0xFF,0xC4,0x51,0xFF,0x02,0x39,0xFF,0x80,0x28,0xFF,0x87,0x51,0xFF,0x50,0x9B,0xFF,0xCF,0x8A,0xFF,0x8E,0x8A,0xFF,0x2C,0x8A,0xFF,0xCB,0x91,0xFF,0x28,0x99,0xFF,0x86,0x98,0xFF,0xA6,0xA0,0xFF,0xA6,0x98,0xFF,0x48,0x99,0xFF,0x6D,0xBA,0xFF,0x05,0x89,0xFF,0xC0,0x58,0xFF,0x83,0x51,0xFF,0x21,0x41,0xFF,0x82,0x41,0xFF,0x44,0x62,0xFF,0x24,0x5A,0xFF,0x04,0x52,0xFF,0xE3,0x51,0xFF,0xC2,0x51,0xFF,0x64,0x6A,0xFF,0x64,0x6A,0xFF,0x24,0x62,0xFF,0xA2,0x49,0xFF,0x45,0x5A,0xFF,0xC7,0x6A,0xFF,0x02,0x29,0xFF,0x82,0x10,0xFF,0x82,0x10,0xFF,0xA3,0x10,0xFF,0xC3,0x10,0xFF,0xE3,0x18,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0xC2,0x18,0xFF,0x85,0x31,0xFF,
-    0xC7,0x39,0xFF,0x04,0x19,0xFF,0x82,0x10,0xFF,0xC3,0x10,0xFF,0x23,0x21,0xFF,0x85,0x31,0xFF,0x89,0x52,0xFF,0x44,0x29,0xFF,0x23,0x29,0xFF,0x84,0x49,0xFF,0xE5,0x59,0xFF,0xE5,0x51,0xFF,0x63,0x41,0xFF,0x88,0x62,0xFF,0x88,0x62,0xFF,0x64,0x49,0xFF,0x84,0x51,0xFF,0x64,0x41,0xFF,0x43,0x39,0xFF,0xC5,0x49,0xFF,0xC5,0x49,0xFF,0x63,0x39,0xFF,0x43,0x39,0xFF,0x23,0x31,0xFF,0xA1,0x28,0xFF,0x80,0x20,0xFF,0x43,0x39,0xFF,0x06,0x52,0xFF,0x09,0x73,0xFF,0x4E,0x9C,0xFF,0x6E,0x9C,0xFF,0x2E,0x94,0xFF,0x4A,0x6B,0xFF,0x64,0x31,0xFF,0x80,0x08,0xFF,0xC3,0x29,0xFF,0x03,0x2A,0xFF,0x02,0x2A,0xFF,0xE6,0x42,0xFF,0xE6,0x4A,0xFF,0x43,0x3A,0xFF,0x24,0x4A,0xFF,0x23,0x52,0xFF,0x24,0x5A,0xFF,0x65,0x6A,0xFF,0x64,0x72,0xFF,0x04,0x6A,0xFF,0x45,0x6A,0xFF,0x25,0x62,0xFF,0x26,0x5A,0xFF,0xE5,0x49,0xFF,0xC5,0x41,0xFF,0x06,0x4A,0xFF,0x06,0x4A,0xFF,0x06,0x42,0xFF,0xC5,0x39,0xFF,0x44,0x29,0xFF,0xE2,0x20,0xFF,0x61,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC1,0x20,0xFF,0x82,0x51,0xFF,0x84,0x7A,0xFF,0x46,0x93,0xFF,0xC7,0xA3,0xFF,0x08,0xAC,0xFF,0x28,0xB4,0xFF,0x48,0xBC,0xFF,0x28,0xB4,0xFF,0x29,0xAC,0xFF,0xA8,0x93,0xFF,0x85,0x72,0xFF,0x83,0x51,0xFF,0x45,0x6A,0xFF,0xA5,0x82,0xFF,0xA4,0x8A,0xFF,0x84,0x82,0xFF,0x23,0x72,0xFF,0x82,0x61,0xFF,0xE1,0x50,0xFF,0x42,0x61,0xFF,0xA2,0x71,0xFF,0x61,0x71,0xFF,0xE1,0x68,0xFF,0x22,0x79,0xFF,0x43,0x81,0xFF,0xA1,0x78,0xFF,0x45,0x91,0xFF,0x09,0xC2,0xFF,0x2B,0xE2,0xFF,0x67,0xC9,0xFF,0x83,0x98,0xFF,0x83,0x88,0xFF,0x47,0x99,0xFF,0x2A,0xAA,0xFF,0xAC,0xAA,0xFF,0xEC,0xAA,0xFF,0x2D,0xAB,0xFF,0x6A,0xA2,0xFF,0x29,0xBA,0xFF,0xEB,0xC2,0xFF,0x4A,0xA3,0xFF,0xF4,0xDD,0xFF,0x7B,0xFF,0xFF,0x3A,0xEF,0xFF,0xED,0x8B,0xFF,0x00,0x10,0xFF,0x40,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC6,0x39,0xFF,0xB1,0x9C,0xFF,0x74,0xB5,0xFF,0xAD,0x7B,0xFF,0x93,0xBD,0xFF,0xB8,0xDE,0xFF,0x9C,0xF7,0xFF,0xB8,0xDE,0xFF,
-    0xD0,0xA4,0xFF,0xD0,0xA4,0xFF,0x8C,0x73,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0xE1,0x20,0xFF,0xE1,0x28,0xFF,0x42,0x39,0xFF,0x42,0x39,0xFF,0x42,0x39,0xFF,0x42,0x39,0xFF,0x22,0x39,0xFF,0x02,0x31,0xFF,0x80,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x84,0x39,0xFF,0xA7,0x62,0xFF,0x28,0x7B,0xFF,0x68,0x83,0xFF,
-    0xC9,0x93,0xFF,0xA9,0x8B,0xFF,0x88,0x8B,0xFF,0x89,0x8B,0xFF,0x07,0x7B,0xFF,0x66,0x5A,0xFF,0x84,0x41,0xFF,0xC1,0x28,0xFF,0x60,0x18,0xFF,0x00,0x08,0xFF,0x2A,0x72,0xFF,0xEF,0x92,0xFF,0x4C,0x82,0xFF,0x89,0x71,0xFF,0x07,0x81,0xFF,0x85,0x88,0xFF,0x85,0x98,0xFF,0x65,0xA8,0xFF,0x28,0xC1,0xFF,0xAA,0xD1,0xFF,0xAB,0xC9,0xFF,0xEB,0xB9,0xFF,0x24,0x91,0xFF,0xC4,0x71,0xFF,0x82,0x59,0xFF,0xC3,0x59,0xFF,0x27,0x7B,0xFF,0xE6,0x72,0xFF,0x64,0x62,0xFF,0x24,0x5A,0xFF,0x64,0x6A,0xFF,0xE3,0x59,0xFF,0x81,0x51,0xFF,0x43,0x6A,0xFF,0x64,0x6A,0xFF,0x64,0x62,0xFF,0xA2,0x49,0xFF,0x25,0x52,0xFF,0x02,0x29,0xFF,0x81,0x10,0xFF,0x82,0x10,0xFF,0xC3,0x10,0xFF,0xA3,0x10,0xFF,0xC2,0x10,0xFF,0xC2,0x10,0xFF,0xC2,0x10,0xFF,0xC2,0x10,0xFF,0xA1,0x10,0xFF,0x24,0x21,0xFF,0xA6,0x31,0xFF,0x45,0x29,0xFF,0x03,0x21,0xFF,0x23,0x21,0xFF,0x03,0x21,0xFF,0x02,0x21,0xFF,0x03,0x21,0xFF,0x23,0x29,0xFF,0x43,0x39,0xFF,0x83,0x49,0xFF,0xA4,0x49,0xFF,0xE2,0x30,0xFF,0x64,0x41,0xFF,0x84,0x49,0xFF,0x83,0x51,0xFF,
-    0xC4,0x59,0xFF,0xA8,0x6A,0xFF,0x02,0x31,0xFF,0x43,0x31,0xFF,0x02,0x31,0xFF,0x23,0x31,0xFF,0xC5,0x49,0xFF,0x05,0x52,0xFF,0xA8,0x6A,0xFF,0x6B,0x83,0xFF,0xAC,0x83,0xFF,0x4B,0x7B,0xFF,0x09,0x73,0xFF,0x6B,0x7B,0xFF,0x63,0x39,0xFF,0xE0,0x28,0xFF,0x20,0x21,0xFF,0x03,0x1A,0xFF,0xE5,0x22,0xFF,0xA3,0x12,0xFF,0x05,0x23,0xFF,0x87,0x33,0xFF,0x63,0x12,0xFF,0x63,0x12,0xFF,0x42,0x12,0xFF,0x02,0x12,0xFF,0xA7,0x42,0xFF,0x45,0x3A,0xFF,0x24,0x52,0xFF,0x85,0x72,0xFF,0xE3,0x61,0xFF,0xC3,0x59,0xFF,0x04,0x5A,0xFF,0x25,0x5A,0xFF,0x65,0x62,0xFF,0x45,0x5A,0xFF,0x26,0x52,0xFF,0x44,0x29,0xFF,0x41,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x08,0xFF,0x22,0x39,0xFF,0x04,0x62,0xFF,0xA5,0x7A,0xFF,0xC6,0x82,0xFF,0xC6,0x82,0xFF,0xA5,0x7A,0xFF,0xE2,0x69,0xFF,0x03,0x6A,0xFF,0x47,0x8B,0xFF,
-    0x29,0xAC,0xFF,0x8A,0xBC,0xFF,0x48,0xBC,0xFF,0x07,0xBC,0xFF,0xE6,0xB3,0xFF,0xE6,0xB3,0xFF,0xE7,0xB3,0xFF,0xE7,0xB3,0xFF,0xC7,0xAB,0xFF,0x87,0xA3,0xFF,0x6B,0xBC,0xFF,0xA8,0xB3,0xFF,0x23,0x92,0xFF,0x83,0x81,0xFF,0x02,0x79,0xFF,0x81,0x60,0xFF,0x45,0x71,0xFF,0xCC,0xC2,0xFF,0xE9,0xD1,0xFF,0xA3,0xB0,0xFF,0x00,0x90,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x22,0x88,0xFF,0x05,0x99,0xFF,0xE5,0x88,0xFF,0x00,0x60,0xFF,0x83,0x70,0xFF,0xCB,0xC2,0xFF,0xEC,0xC2,0xFF,0x2A,0xAB,0xFF,0x72,0xD5,0xFF,0xB8,0xEE,0xFF,0x3A,0xF7,0xFF,0x37,0xD6,0xFF,0xCA,0x62,0xFF,0xD5,0xBD,0xFF,0x98,0xD6,0xFF,0x13,0xA5,0xFF,0xC5,0x39,0xFF,0x12,0xAD,0xFF,0x36,0xCE,0xFF,0x3A,0xEF,0xFF,0x1A,0xEF,0xFF,0xD4,0xC5,0xFF,0x73,0xBD,0xFF,0x57,0xD6,0xFF,0xB8,0xDE,0xFF,0x0E,0x8C,0xFF,0x06,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE2,0x20,0xFF,0x22,0x31,0xFF,0x63,0x39,0xFF,0x83,0x41,0xFF,0x83,0x41,0xFF,0x63,0x41,0xFF,0x42,0x39,0xFF,0xE1,0x28,0xFF,0x60,0x18,0xFF,0x20,0x08,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0xA3,0x30,0xFF,0x67,0x69,0xFF,0x06,0x71,0xFF,0x06,0x79,0xFF,0x22,0x60,0xFF,0x84,0x70,0xFF,0x43,0x78,0xFF,
-    0x64,0x90,0xFF,0x24,0xA0,0xFF,0x48,0xD1,0xFF,0xAA,0xE1,0xFF,0xEB,0xE1,0xFF,0x4A,0xC2,0xFF,0x86,0x89,0xFF,0x86,0x7A,0xFF,0xC6,0x7A,0xFF,0xA4,0x72,0xFF,0x06,0x7B,0xFF,0xE6,0x72,0xFF,0x44,0x62,0xFF,0x85,0x6A,0xFF,0x06,0x7B,0xFF,0x06,0x7B,0xFF,0x26,0x83,0xFF,0xC5,0x72,0xFF,0x44,0x62,0xFF,0x44,0x5A,0xFF,0xC3,0x51,0xFF,0x62,0x39,0xFF,0xC1,0x20,0xFF,0x20,0x00,0xFF,0x81,0x08,0xFF,0xA3,0x10,0xFF,0xA2,0x10,0xFF,0xA2,0x08,0xFF,0xA2,0x08,0xFF,0xA2,0x10,0xFF,0xC2,0x10,0xFF,0xE2,0x18,0xFF,0x43,0x29,0xFF,0x85,0x31,0xFF,0x07,0x42,0xFF,0xA5,0x31,0xFF,0x43,0x21,0xFF,0x43,0x29,0xFF,0xE2,0x18,0xFF,0xE2,0x20,0xFF,0x23,0x29,0xFF,0x83,0x41,0xFF,0xC4,0x51,0xFF,0x84,0x49,0xFF,0xE2,0x30,0xFF,0x22,0x41,0xFF,0x83,0x51,0xFF,0x84,0x59,0xFF,0x83,0x59,0xFF,0x09,0x7B,0xFF,0x6A,0x7B,0xFF,0xE5,0x51,0xFF,0x46,0x5A,0xFF,0x87,0x6A,0xFF,0xE8,0x72,0xFF,0xCC,0x93,0xFF,0x8C,0x83,0xFF,0xA9,0x6A,0xFF,0x84,0x41,0xFF,0xA0,0x30,0xFF,0x40,0x20,0xFF,0x80,0x28,0xFF,0xE2,0x28,0xFF,0x63,0x31,0xFF,
-    0xE3,0x21,0xFF,0x24,0x23,0xFF,0x27,0x2C,0xFF,0x68,0x34,0xFF,0xCB,0x54,0xFF,0xAB,0x54,0xFF,0x4B,0x54,0xFF,0x6C,0x64,0xFF,0x8C,0x6C,0xFF,0x6C,0x6C,0xFF,0x76,0xBE,0xFF,0xB3,0xA5,0xFF,0xE0,0x00,0xFF,0xC3,0x49,0xFF,0xE6,0x7A,0xFF,0x88,0x93,0xFF,0xA7,0x9B,0xFF,0xC7,0xA3,0xFF,0xC7,0x9B,0xFF,0x46,0x8B,0xFF,0xE6,0x7A,0xFF,0x65,0x62,0xFF,0x05,0x52,0xFF,0xE2,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x10,0xFF,0xC1,0x28,0xFF,0x22,0x31,0xFF,0xA1,0x28,0xFF,0x45,0x62,0xFF,0x6A,0xBC,0xFF,0x89,0xBC,0xFF,0x06,0xB4,0xFF,0xE5,0xB3,0xFF,0xA4,0xAB,0xFF,0xE5,0xBB,0xFF,0x26,0xBC,0xFF,0x46,0xC4,0xFF,0x05,0xBC,0xFF,0x26,0xBC,0xFF,0x67,0xC4,0xFF,0x26,0xBC,0xFF,0x69,0xC4,0xFF,0xE9,0xBB,0xFF,0x03,0x8A,0xFF,0xE1,0x60,0xFF,0x81,0x48,0xFF,0x20,0x28,0xFF,
-    0x41,0x28,0xFF,0xAB,0xBA,0xFF,0xE8,0xC9,0xFF,0x83,0xB0,0xFF,0x41,0xA8,0xFF,0x21,0x98,0xFF,0x00,0x90,0xFF,0x01,0x88,0xFF,0x42,0x88,0xFF,0xC4,0x88,0xFF,0xC4,0x80,0xFF,0x00,0x60,0xFF,0xE8,0x99,0xFF,0xCB,0xB2,0xFF,0x09,0x9B,0xFF,0xD0,0xCC,0xFF,0x11,0xC5,0xFF,0x15,0xDE,0xFF,0xD4,0xCD,0xFF,0x32,0xB5,0xFF,0x36,0xD6,0xFF,0x3B,0xEF,0xFF,0x5B,0xEF,0xFF,0x74,0xB5,0xFF,0x73,0xBD,0xFF,0xD0,0xAC,0xFF,0x77,0xD6,0xFF,0x1A,0xEF,0xFF,0xB4,0xC5,0xFF,0x4E,0x9C,0xFF,0x11,0xB5,0xFF,0x94,0xBD,0xFF,0xA6,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x38,0xFF,0xE4,0x58,0xFF,0xC4,0x68,0xFF,0xA4,0x70,0xFF,0xA4,0x68,0xFF,0x84,0x68,0xFF,0x63,0x68,0xFF,0xC5,0x88,0xFF,0x27,0xB9,0xFF,0xA6,0xC0,0xFF,0xE7,0xD0,0xFF,0xC8,0xD1,0xFF,0x08,0xA2,0xFF,0xC0,0x58,0xFF,0x82,0x59,0xFF,0x89,0x93,0xFF,0xC9,0x93,0xFF,0xC5,0x7A,0xFF,0x03,0x5A,0xFF,0xC2,0x51,0xFF,0x44,0x62,0xFF,0x27,0x83,0xFF,0x06,0x83,0xFF,
-    0xA4,0x72,0xFF,0xC5,0x72,0xFF,0x45,0x62,0xFF,0x25,0x5A,0xFF,0x83,0x41,0xFF,0x01,0x31,0xFF,0xC1,0x20,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x41,0x08,0xFF,0x82,0x10,0xFF,0x82,0x10,0xFF,0x81,0x08,0xFF,0x81,0x08,0xFF,0xA2,0x10,0xFF,0xE2,0x18,0xFF,0x03,0x21,0xFF,0xA5,0x39,0xFF,0x44,0x29,0xFF,0xE2,0x18,0xFF,0x23,0x21,0xFF,0x43,0x21,0xFF,0x23,0x21,0xFF,0x43,0x21,0xFF,0x43,0x29,0xFF,0xE4,0x51,0xFF,0x05,0x5A,0xFF,0x63,0x49,0xFF,0x63,0x41,0xFF,0xA4,0x51,0xFF,0xA4,0x59,0xFF,0x84,0x51,0xFF,0x63,0x49,0xFF,0xA3,0x51,0xFF,0xE8,0x72,0xFF,0xE8,0x72,0xFF,0xEC,0x93,0xFF,0x8E,0xAC,0xFF,0x2D,0x9C,0xFF,0x06,0x62,0xFF,0x02,0x49,0xFF,0xC1,0x40,0xFF,0xE2,0x38,0xFF,0x23,0x41,0xFF,0x02,0x39,0xFF,0x02,0x31,0xFF,0x02,0x31,0xFF,0x83,0x31,0xFF,0x43,0x22,0xFF,0x83,0x12,0xFF,0x82,0x02,0xFF,0x69,0x44,0xFF,0x0F,0x76,0xFF,0xAF,0x75,0xFF,0xAF,0x7D,0xFF,0x8F,0x85,0xFF,0x6F,0x85,0xFF,0x0E,0x85,0xFF,0xF4,0xAD,0xFF,0xD8,0xCE,0xFF,0x22,0x22,0xFF,0x43,0x4A,0xFF,0x29,0xA4,0xFF,0x07,0xB4,0xFF,
-    0xC5,0xAB,0xFF,0x05,0xB4,0xFF,0xA5,0xA3,0xFF,0x64,0x9B,0xFF,0x65,0x93,0xFF,0x25,0x8B,0xFF,0xE8,0xA3,0xFF,0xA8,0x93,0xFF,0x85,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0xA4,0xFF,0x07,0xB4,0xFF,0x84,0xA3,0xFF,0xC5,0xB3,0xFF,0x06,0xB4,0xFF,0x25,0xBC,0xFF,0x25,0xBC,0xFF,0xA7,0xCC,0xFF,0x86,0xCC,0xFF,0xA7,0xCC,0xFF,0x87,0xC4,0xFF,0xA7,0xCC,0xFF,0x86,0xC4,0xFF,0x06,0xBC,0xFF,0xA6,0xAB,0xFF,0xC5,0x8A,0xFF,0x83,0x51,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x66,0x81,0xFF,0x29,0xD2,0xFF,0xE8,0xC9,0xFF,0xC3,0xA0,0xFF,0xA3,0xA0,0xFF,0x45,0xB1,0xFF,0x22,0x98,0xFF,0xA3,0xA0,0xFF,0x05,0xA1,0xFF,0x82,0x78,0xFF,0x62,0x68,0xFF,0xE4,0x78,0xFF,0x45,0x69,0xFF,0xC5,0x59,0xFF,0xEC,0xA3,0xFF,
-    0xF0,0xBC,0xFF,0xF0,0xBC,0xFF,0x8C,0x83,0xFF,0x90,0xA4,0xFF,0xD0,0xAC,0xFF,0x73,0xBD,0xFF,0x56,0xD6,0xFF,0x12,0xB5,0xFF,0xD0,0xAC,0xFF,0x8F,0xA4,0xFF,0x52,0xBD,0xFF,0xD4,0xC5,0xFF,0x2E,0x94,0xFF,0xC9,0x6A,0xFF,0xAC,0x83,0xFF,0xCA,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA2,0x28,0xFF,0xE4,0x48,0xFF,0xA3,0x50,0xFF,0xC4,0x68,0xFF,0xE5,0x78,0xFF,0x63,0x68,0xFF,0x63,0x68,0xFF,0xC5,0x88,0xFF,0x48,0xB1,0xFF,0x47,0xB9,0xFF,0x84,0xA8,0xFF,0xE4,0x90,0xFF,0x81,0x68,0xFF,0x66,0x82,0xFF,0xC6,0x82,0xFF,0xC0,0x61,0xFF,0xE6,0x82,0xFF,0x88,0x8B,0xFF,0x88,0x8B,0xFF,0x27,0x7B,0xFF,0x06,0x7B,0xFF,0x07,0x7B,0xFF,0x48,0x83,0xFF,0x27,0x7B,0xFF,0xC6,0x72,0xFF,0x65,0x62,0xFF,0x83,0x41,0xFF,0x01,0x29,0xFF,0xE1,0x20,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x41,0x08,0xFF,0x61,0x08,0xFF,0x61,0x08,0xFF,0x81,0x10,0xFF,0xC1,0x18,0xFF,
-    0x02,0x21,0xFF,0x44,0x29,0xFF,0xE3,0x18,0xFF,0xC2,0x18,0xFF,0xC2,0x18,0xFF,0x03,0x21,0xFF,0x23,0x21,0xFF,0x43,0x21,0xFF,0x43,0x29,0xFF,0xE4,0x51,0xFF,0xE4,0x59,0xFF,0x43,0x49,0xFF,0x64,0x49,0xFF,0xA4,0x51,0xFF,0xE5,0x59,0xFF,0xC5,0x59,0xFF,0xC5,0x51,0xFF,0xA4,0x51,0xFF,0xC4,0x59,0xFF,0xC4,0x59,0xFF,0x42,0x49,0xFF,0xA0,0x30,0xFF,0x80,0x30,0xFF,0x44,0x49,0xFF,0xA5,0x69,0xFF,0x64,0x61,0xFF,0x23,0x59,0xFF,0x02,0x49,0xFF,0x02,0x41,0xFF,0x02,0x39,0xFF,0x02,0x31,0xFF,0x22,0x29,0xFF,0x23,0x22,0xFF,0x84,0x1A,0xFF,0xA8,0x33,0xFF,0xE8,0x3B,0xFF,0x8E,0x5D,0xFF,0x8E,0x6D,0xFF,0xD0,0x7D,0xFF,0xED,0x6C,0xFF,0x8D,0x6C,0xFF,0x6C,0x6C,0xFF,0x10,0x8D,0xFF,0x5A,0xD7,0xFF,0x0B,0x6C,0xFF,0x81,0x42,0xFF,0x64,0x93,0xFF,0x84,0xA3,0xFF,0x26,0xB4,0xFF,0xE5,0xAB,0xFF,0xA4,0xAB,0xFF,0x84,0xA3,0xFF,0xC6,0xA3,0xFF,0xC2,0x8A,0xFF,0xA5,0xA3,0xFF,0xE5,0xAB,0xFF,0x49,0xAC,0xFF,0x85,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x08,0xFF,0x0A,0xA4,0xFF,0x48,0xB4,0xFF,0x06,0xB4,0xFF,0x47,0xBC,0xFF,0x2A,0xD5,0xFF,0xC8,0xCC,0xFF,0x26,0xBC,0xFF,0x87,0xC4,0xFF,0x87,0xC4,0xFF,0x29,0xDD,0xFF,0xE5,0xB3,0xFF,0xE7,0xD4,0xFF,0xE7,0xD4,0xFF,0xE8,0xD4,0xFF,0x66,0xC4,0xFF,0x68,0xCC,0xFF,0xA6,0xAB,0xFF,0x06,0x8B,0xFF,0x63,0x41,0xFF,0x00,0x00,0xFF,0x40,0x30,0xFF,0x45,0x81,0xFF,0x25,0x89,0xFF,0x05,0x91,0xFF,0x86,0xA9,0xFF,0x66,0xB1,0xFF,0x05,0xA9,0xFF,0x45,0xA9,0xFF,0xC3,0x80,0xFF,0xA3,0x68,0xFF,0x04,0x69,0xFF,0x04,0x59,0xFF,0x40,0x20,0xFF,0x00,0x08,0xFF,0xA4,0x49,0xFF,0xC8,0x72,0xFF,0xC9,0x6A,0xFF,0x24,0x31,0xFF,0x6B,0x7B,0xFF,0x90,0xA4,0xFF,0xF1,0xAC,0xFF,0x52,0xBD,0xFF,0x6B,0x7B,0xFF,0xE9,0x6A,0xFF,0x6F,0xA4,0xFF,0xAF,0xA4,0xFF,0x8F,0x9C,0xFF,0xA5,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x41,0x10,0xFF,0xA3,0x38,0xFF,0xC4,0x50,0xFF,0xA3,0x68,0xFF,0x62,0x70,0xFF,0x42,0x60,0xFF,0x00,0x50,0xFF,0x20,0x58,0xFF,0x82,0x70,0xFF,0xA2,0x70,0xFF,0x00,0x58,0xFF,0xC4,0x69,0xFF,0xA7,0x8A,0xFF,0x27,0x93,0xFF,0x47,0x93,0xFF,0x43,0x72,0xFF,0xE1,0x61,0xFF,0x02,0x62,0xFF,0x02,0x5A,0xFF,0x03,0x5A,0xFF,0x02,0x5A,0xFF,0xE2,0x51,0xFF,0xA2,0x49,0xFF,0x20,0x39,0xFF,0xA0,0x28,0xFF,0xE3,0x29,0xFF,0xE3,0x29,0xFF,0x62,0x19,0xFF,0x42,0x11,0xFF,0x63,0x19,0xFF,0x83,0x21,0xFF,0xA4,0x29,0xFF,0x64,0x29,0xFF,0x43,0x29,0xFF,0x64,0x31,0xFF,0x43,0x29,0xFF,0x81,0x10,0xFF,0xA1,0x18,0xFF,0xC1,0x18,0xFF,0xA5,0x31,0xFF,0xE7,0x41,0xFF,0x61,0x08,0xFF,0xC2,0x10,0xFF,0xE3,0x18,0xFF,0x03,0x19,0xFF,0x23,0x21,0xFF,0x43,0x31,0xFF,0xE4,0x51,0xFF,0xE4,0x59,0xFF,0x63,0x49,0xFF,0x84,0x49,0xFF,0xA5,0x51,0xFF,0x84,0x51,0xFF,0xE5,0x59,0xFF,
-    0xC5,0x59,0xFF,0x64,0x51,0xFF,0x83,0x51,0xFF,0x63,0x51,0xFF,0xA5,0x51,0xFF,0x43,0x49,0xFF,0xA1,0x38,0xFF,0x23,0x59,0xFF,0x24,0x69,0xFF,0xC3,0x68,0xFF,0xE3,0x68,0xFF,0xE3,0x60,0xFF,0xC2,0x58,0xFF,0xA0,0x50,0xFF,0xC0,0x40,0xFF,0x01,0x29,0xFF,0xE3,0x21,0xFF,0xE1,0x01,0xFF,0xC8,0x33,0xFF,0x8D,0x55,0xFF,0x4D,0x4D,0xFF,0x2D,0x4D,0xFF,0x2D,0x5D,0xFF,0x6C,0x5C,0xFF,0x4C,0x5C,0xFF,0x2C,0x5C,0xFF,0x6E,0x74,0xFF,0x3A,0xD7,0xFF,0x50,0x8D,0xFF,0x80,0x3A,0xFF,0x85,0x93,0xFF,0x84,0xA3,0xFF,0x05,0xB4,0xFF,0xC4,0xAB,0xFF,0xC4,0xAB,0xFF,0x63,0xA3,0xFF,0xC4,0xAB,0xFF,0x46,0xBC,0xFF,0xE4,0xAB,0xFF,0x26,0xB4,0xFF,0x89,0xB4,0xFF,0x27,0x83,0xFF,0xE2,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x65,0x6A,0xFF,0x08,0xAC,0xFF,0x47,0xB4,0xFF,
-    0x26,0xB4,0xFF,0x26,0xBC,0xFF,0x87,0xC4,0xFF,0xE8,0xCC,0xFF,0xA7,0xCC,0xFF,0xE8,0xD4,0xFF,0x28,0xD5,0xFF,0x08,0xD5,0xFF,0xA9,0xE5,0xFF,0x68,0xDD,0xFF,0xC7,0xD4,0xFF,0xC4,0xB3,0xFF,0x46,0xCC,0xFF,0x25,0xC4,0xFF,0x47,0xC4,0xFF,0x09,0xA4,0xFF,0x63,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x61,0x38,0xFF,0xC3,0x50,0xFF,0xE3,0x58,0xFF,0x62,0x48,0xFF,0x62,0x48,0xFF,0x61,0x40,0xFF,0x20,0x30,0xFF,0x20,0x20,0xFF,0x00,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x44,0x31,0xFF,0x2B,0x7B,0xFF,0xED,0x8B,0xFF,0x2A,0x73,0xFF,0xA1,0x20,0xFF,0x00,0x08,0xFF,0xC6,0x49,0xFF,0x47,0x52,0xFF,0x24,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x41,0x20,0xFF,0xE3,0x60,0xFF,0xC3,0x70,0xFF,0xA2,0x68,0xFF,
-    0x81,0x58,0xFF,0x61,0x58,0xFF,0x61,0x58,0xFF,0xA2,0x50,0xFF,0x20,0x38,0xFF,0x02,0x49,0xFF,0x49,0x9B,0xFF,0xE2,0x71,0xFF,0xA5,0x82,0xFF,0x88,0x93,0xFF,0x88,0x93,0xFF,0x47,0x8B,0xFF,0x06,0x7B,0xFF,0xA5,0x6A,0xFF,0xA5,0x6A,0xFF,0x65,0x62,0xFF,0xE3,0x49,0xFF,0x67,0x42,0xFF,0x2D,0x6C,0xFF,0x85,0x22,0xFF,0x23,0x12,0xFF,0x24,0x1A,0xFF,0x24,0x1A,0xFF,0x85,0x1A,0xFF,0x84,0x22,0xFF,0x64,0x2A,0xFF,0x24,0x2A,0xFF,0xC3,0x31,0xFF,0xA4,0x39,0xFF,0x46,0x52,0xFF,0xE5,0x41,0xFF,0x80,0x18,0xFF,0xA1,0x18,0xFF,0x03,0x21,0xFF,0x85,0x31,0xFF,0xA2,0x10,0xFF,0xC2,0x10,0xFF,0xE2,0x18,0xFF,0xE2,0x18,0xFF,0x23,0x21,0xFF,0x43,0x31,0xFF,0xC3,0x49,0xFF,0x04,0x5A,0xFF,0xA4,0x51,0xFF,0xA4,0x51,0xFF,0xA4,0x51,0xFF,0x84,0x51,0xFF,0x84,0x51,0xFF,0x64,0x51,0xFF,0x64,0x51,0xFF,0x23,0x51,0xFF,0xA4,0x59,0xFF,0x88,0x7A,0xFF,0xA5,0x59,0xFF,0x61,0x48,0xFF,0x61,0x50,0xFF,0x20,0x60,0xFF,0x00,0x68,0xFF,0x00,0x68,0xFF,0x00,0x68,0xFF,0x00,0x60,0xFF,0xC6,0x71,0xFF,0xA9,0x8A,0xFF,0x41,0x61,0xFF,
-    0x88,0x53,0xFF,0xE8,0x3B,0xFF,0xE3,0x02,0xFF,0xCA,0x34,0xFF,0x6D,0x3D,0xFF,0x50,0x5E,0xFF,0x4E,0x55,0xFF,0x0A,0x44,0xFF,0x0B,0x4C,0xFF,0xEB,0x4B,0xFF,0x0C,0x5C,0xFF,0x19,0xC7,0xFF,0x33,0x9E,0xFF,0x43,0x2B,0xFF,0x84,0x83,0xFF,0xA3,0xA3,0xFF,0x46,0xBC,0xFF,0x05,0xB4,0xFF,0xC4,0xAB,0xFF,0x83,0xAB,0xFF,0xC4,0xAB,0xFF,0x46,0xB4,0xFF,0x2A,0xCD,0xFF,0x09,0xC5,0xFF,0xE6,0x9B,0xFF,0x2B,0x9C,0xFF,0x02,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE1,0x30,0xFF,0x03,0x62,0xFF,0x25,0x93,0xFF,0xE7,0xAB,0xFF,0x07,0xB4,0xFF,0x47,0xB4,0xFF,0x88,0xC4,0xFF,0x87,0xC4,0xFF,0xE8,0xD4,0xFF,0x08,0xD5,0xFF,0xAA,0xE5,0xFF,0x89,0xE5,0xFF,0x08,0xD5,0xFF,0x47,0xC4,0xFF,0x66,0xCC,0xFF,0x46,0xCC,0xFF,0x25,0xCC,0xFF,0xE8,0xD4,0xFF,0x0B,0xCD,0xFF,
-    0x29,0x7B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x08,0xFF,0x64,0x39,0xFF,0x67,0x5A,0xFF,0xC8,0x72,0xFF,0xC8,0x7A,0xFF,0x05,0x7A,0xFF,0xC5,0x79,0xFF,0xA5,0x81,0xFF,0x84,0x79,0xFF,0x43,0x71,0xFF,0xE2,0x60,0xFF,0xA1,0x48,0xFF,0x00,0x20,0xFF,0x60,0x38,0xFF,0x65,0x7A,0xFF,0x27,0x93,0xFF,0x85,0x7A,0xFF,0x43,0x72,0xFF,0x63,0x7A,0xFF,0x05,0x83,0xFF,0x05,0x83,0xFF,0xC5,0x72,0xFF,0x64,0x62,0xFF,0x03,0x52,0xFF,
-    0x80,0x29,0xFF,0xEC,0x5B,0xFF,0x8F,0x6C,0xFF,0x09,0x23,0xFF,0xC8,0x22,0xFF,0x87,0x22,0xFF,0xA6,0x1A,0xFF,0xE6,0x22,0xFF,0xA5,0x12,0xFF,0xA4,0x12,0xFF,0x43,0x12,0xFF,0x44,0x32,0xFF,0x24,0x42,0xFF,0xC4,0x49,0xFF,0xC4,0x49,0xFF,0x42,0x31,0xFF,0xE2,0x28,0xFF,0x81,0x10,0xFF,0x40,0x00,0xFF,0x81,0x10,0xFF,0xC2,0x10,0xFF,0xE2,0x18,0xFF,0xC2,0x18,0xFF,0x02,0x19,0xFF,0x43,0x31,0xFF,0xE4,0x51,0xFF,0x04,0x62,0xFF,0xA4,0x51,0xFF,0xA4,0x51,0xFF,0x84,0x51,0xFF,0x64,0x49,0xFF,0x64,0x49,0xFF,0x64,0x51,0xFF,0x23,0x49,0xFF,0x02,0x49,0xFF,0x64,0x59,0xFF,0x64,0x59,0xFF,0x81,0x50,0xFF,0xA2,0x70,0xFF,0x62,0x80,0xFF,0x25,0x99,0xFF,0xA3,0x98,0xFF,0xE8,0x91,0xFF,0xEF,0xB3,0xFF,0xF3,0xCC,0xFF,0x75,0xDD,0xFF,0xB5,0xE5,0xFF,0x6F,0xC4,0xFF,0x87,0x73,0xFF,0xAD,0x75,0xFF,0x27,0x14,0xFF,0x06,0x04,0xFF,0xAA,0x1C,0xFF,0xEF,0x45,0xFF,0x6B,0x2C,0xFF,0xEA,0x33,0xFF,0x2B,0x44,0xFF,0x0B,0x44,0xFF,0xEB,0x4B,0xFF,0xF8,0xB6,0xFF,0x16,0xA7,0xFF,0xA9,0x44,0xFF,0x67,0x84,0xFF,0x06,0xA4,0xFF,
-    0x63,0x9B,0xFF,0x42,0x9B,0xFF,0x42,0x9B,0xFF,0x46,0xBC,0xFF,0xC8,0xC4,0xFF,0x09,0xCD,0xFF,0x2A,0xCD,0xFF,0x2B,0xC5,0xFF,0x2D,0xC5,0xFF,0xEB,0x93,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x41,0x08,0xFF,0xA2,0x18,0xFF,0x02,0x39,0xFF,0x82,0x51,0xFF,0x02,0x6A,0xFF,0x84,0x7A,0xFF,0xA4,0x82,0xFF,0xC4,0x8A,0xFF,0xA3,0x8A,0xFF,0x03,0x9B,0xFF,0xC5,0xAB,0xFF,0xA8,0xC4,0xFF,0x89,0xBC,0xFF,0x27,0xBC,0xFF,0x08,0xD5,0xFF,0x27,0xDD,0xFF,0xE7,0xD4,0xFF,0x08,0xD5,0xFF,0x6A,0xDD,0xFF,0x4D,0xCD,0xFF,0xCB,0x8B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x64,0x31,0xFF,0x09,0x73,0xFF,0xAA,0x93,0xFF,0x0B,0xA4,0xFF,0x89,0x9B,0xFF,0xC6,0x8A,0xFF,0x24,0x7A,0xFF,0x83,0x69,0xFF,0x42,0x71,0xFF,0x63,0x79,0xFF,0xA4,0x79,0xFF,0x83,0x71,0xFF,0xE5,0x79,0xFF,0xE5,0x69,0xFF,0x02,0x41,0xFF,0xC4,0x61,0xFF,0x04,0x6A,0xFF,0x85,0x72,0xFF,0x06,0x83,0xFF,0x06,0x83,0xFF,0xE5,0x82,0xFF,0xE5,0x7A,0xFF,0xA5,0x72,0xFF,0x84,0x62,0xFF,0x23,0x4A,0xFF,0x23,0x22,0xFF,0x6A,0x3B,0xFF,0x6B,0x33,0xFF,0x4A,0x2B,0xFF,0x4A,0x2B,0xFF,0x2A,0x2B,0xFF,0xE9,0x2A,0xFF,0x6A,0x2B,0xFF,0xCB,0x33,0xFF,0xAE,0x4C,0xFF,0xAA,0x3B,0xFF,0xE3,0x09,0xFF,0xE3,0x31,0xFF,0xC3,0x49,0xFF,0xA3,0x49,0xFF,0x62,0x41,0xFF,
-    0xC1,0x28,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xC2,0x10,0xFF,0xC2,0x18,0xFF,0xE2,0x18,0xFF,0x22,0x29,0xFF,0x04,0x52,0xFF,0x25,0x62,0xFF,0xA4,0x51,0xFF,0x84,0x51,0xFF,0x63,0x49,0xFF,0x43,0x49,0xFF,0x64,0x49,0xFF,0x03,0x49,0xFF,0x03,0x49,0xFF,0x03,0x49,0xFF,0xA1,0x40,0xFF,0x81,0x58,0xFF,0x62,0x70,0xFF,0xC4,0x98,0xFF,0x42,0x90,0xFF,0xC4,0xA0,0xFF,0xEC,0xBA,0xFF,0x75,0xED,0xFF,0xD7,0xE5,0xFF,0xB6,0xDD,0xFF,0xB6,0xDD,0xFF,0xF6,0xE5,0xFF,0x36,0xEE,0xFF,0x4F,0xAC,0xFF,0xCB,0x74,0xFF,0xED,0x65,0xFF,0x8C,0x3D,0xFF,0x0B,0x2D,0xFF,0xD2,0x56,0xFF,0x0C,0x2D,0xFF,0x88,0x1B,0xFF,0x89,0x2B,0xFF,0x89,0x2B,0xFF,0x89,0x33,0xFF,0xCF,0x64,0xFF,0x90,0x6D,0xFF,0x0C,0x55,0xFF,0x28,0x6C,0xFF,0x86,0x83,0xFF,0xA6,0x9B,0xFF,0x65,0x93,0xFF,0x85,0x9B,0xFF,0x06,0xAC,0xFF,0x48,0xAC,0xFF,0xCA,0xBC,0xFF,0x0B,0xBD,0xFF,0xAB,0xB4,0xFF,0xC9,0x93,0xFF,0x83,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x87,0x62,0xFF,0xAA,0x8B,0xFF,0x0B,0x9C,0xFF,0x2A,0xA4,0xFF,0x0A,0xA4,0xFF,0x0A,0xAC,0xFF,0x88,0x93,0xFF,0xC6,0x7A,0xFF,0x86,0x6A,0xFF,0xA3,0x59,0xFF,0xC2,0x61,0xFF,0x44,0x7A,0xFF,0x47,0x9B,0xFF,0x66,0x9B,0xFF,0xE7,0xAB,0xFF,0xA8,0xC4,0xFF,0xE7,0xD4,0xFF,0xC7,0xCC,0xFF,0x48,0xD5,0xFF,0x69,0xD5,0xFF,0x8A,0xD5,0xFF,0x4C,0xCD,0xFF,0x4F,0xC5,0xFF,0x67,0x5A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x85,0x31,0xFF,0x6A,0x7B,0xFF,0x2A,0xA4,0xFF,0x6B,0xAC,0xFF,0x2A,0xAC,0xFF,0x0A,0xA4,0xFF,0xE9,0xA3,0xFF,0x47,0x93,0xFF,0xA5,0x82,0xFF,0x04,0x82,0xFF,0x04,0x8A,0xFF,0x45,0x92,0xFF,0x45,0x8A,0xFF,0x04,0x7A,0xFF,0xC7,0x8A,0xFF,0xA4,0x59,0xFF,0x87,0x72,0xFF,0xC3,0x59,0xFF,0x03,0x62,0xFF,0x23,0x6A,0xFF,0x64,0x72,0xFF,0x84,0x72,0xFF,0x84,0x72,0xFF,0x44,0x6A,0xFF,0x03,0x52,0xFF,0x02,0x32,0xFF,0xE8,0x32,0xFF,0xED,0x4B,0xFF,0x4B,0x33,0xFF,0x0A,0x2B,0xFF,0x0A,0x2B,0xFF,0x0A,0x2B,0xFF,0x0A,0x2B,0xFF,0x4A,0x2B,0xFF,0x10,0x55,0xFF,0xB1,0x5D,0xFF,0x91,0x5D,0xFF,0xAD,0x54,0xFF,0x85,0x42,0xFF,0x44,0x52,0xFF,0xC3,0x49,0xFF,0x21,0x39,0xFF,0xE1,0x28,0xFF,0xA1,0x18,0xFF,0x61,0x08,0xFF,0xA2,0x10,0xFF,0x81,0x10,0xFF,0xA1,0x10,0xFF,0xA1,0x10,0xFF,0xC1,0x18,0xFF,0x01,0x21,0xFF,0xE3,0x51,0xFF,0x45,0x6A,0xFF,0xA4,0x51,0xFF,0x63,0x49,0xFF,0x23,0x49,0xFF,0x23,0x41,0xFF,0x23,0x41,0xFF,
-    0x23,0x41,0xFF,0xE2,0x40,0xFF,0xE2,0x40,0xFF,0x61,0x40,0xFF,0xC3,0x78,0xFF,0xC4,0x90,0xFF,0x84,0x90,0xFF,0xA4,0x90,0xFF,0x00,0x78,0xFF,0x91,0xD4,0xFF,0xF7,0xF5,0xFF,0x76,0xDD,0xFF,0x76,0xD5,0xFF,0x96,0xD5,0xFF,0x96,0xD5,0xFF,0xF6,0xDD,0xFF,0x37,0xE6,0xFF,0x0D,0xA4,0xFF,0xEB,0x74,0xFF,0x70,0x6E,0xFF,0xCD,0x45,0xFF,0xB2,0x4E,0xFF,0xCB,0x24,0xFF,0xA4,0x02,0xFF,0x84,0x0A,0xFF,0xA5,0x12,0xFF,0x06,0x1B,0xFF,0xA5,0x02,0xFF,0xC5,0x12,0xFF,0x67,0x33,0xFF,0xC5,0x3A,0xFF,0xA0,0x20,0xFF,0x81,0x41,0xFF,0xE2,0x51,0xFF,0x64,0x6A,0xFF,0xC4,0x72,0xFF,0x26,0x83,0xFF,0xC5,0x7A,0xFF,0xA5,0x72,0xFF,0x45,0x62,0xFF,0x02,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x46,0x52,0xFF,0x8D,0xAC,0xFF,0xAC,0xBC,0xFF,0x29,0xB4,0xFF,0x07,0xB4,0xFF,0x46,0xBC,0xFF,0x26,0xBC,0xFF,0x47,0xC4,0xFF,0x67,0xC4,0xFF,
-    0x27,0xB4,0xFF,0xE7,0xAB,0xFF,0xA7,0x9B,0xFF,0x85,0x72,0xFF,0x21,0x51,0xFF,0xC6,0x82,0xFF,0xC8,0xA3,0xFF,0x69,0xBC,0xFF,0xCA,0xC4,0xFF,0xEA,0xC4,0xFF,0x0A,0xC5,0xFF,0x6C,0xD5,0xFF,0x4B,0xCD,0xFF,0x0B,0xBD,0xFF,0x0A,0x9C,0xFF,0x25,0x5A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC9,0x62,0xFF,0xCA,0x93,0xFF,0x4B,0xAC,0xFF,0x4B,0xAC,0xFF,0x2A,0xA4,0xFF,0xC9,0x9B,0xFF,0xC9,0x9B,0xFF,0x47,0x8B,0xFF,0x84,0x72,0xFF,0xA5,0x82,0xFF,
-    0x85,0x8A,0xFF,0x24,0x8A,0xFF,0x85,0x92,0xFF,0xC6,0x8A,0xFF,0x08,0x8B,0xFF,0x22,0x41,0xFF,0x46,0x62,0xFF,0xE8,0x7A,0xFF,0x65,0x6A,0xFF,0x64,0x72,0xFF,0x43,0x6A,0xFF,0x02,0x62,0xFF,0xC2,0x59,0xFF,0x81,0x49,0xFF,0xC2,0x39,0xFF,0x43,0x22,0xFF,0xCC,0x43,0xFF,0xED,0x43,0xFF,0x4B,0x33,0xFF,0xC9,0x22,0xFF,0xEA,0x22,0xFF,0xEA,0x22,0xFF,0x0A,0x23,0xFF,0xAB,0x33,0xFF,0xB2,0x65,0xFF,0xD2,0x5D,0xFF,0x12,0x66,0xFF,0x8D,0x4C,0xFF,0x44,0x3A,0xFF,0xA2,0x41,0xFF,0x62,0x41,0xFF,0x42,0x41,0xFF,0xC1,0x28,0xFF,0x81,0x18,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,0x81,0x10,0xFF,0x80,0x10,0xFF,0x60,0x08,0xFF,0x60,0x08,0xFF,0xE1,0x20,0xFF,0xE3,0x51,0xFF,0x45,0x6A,0xFF,0x63,0x49,0xFF,0x23,0x41,0xFF,0xE2,0x38,0xFF,0xC2,0x38,0xFF,0xE2,0x38,0xFF,0xC2,0x38,0xFF,0xA2,0x38,0xFF,0xE2,0x40,0xFF,0xC2,0x50,0xFF,0xE3,0x88,0xFF,0xE8,0xB1,0xFF,0x88,0xB1,0xFF,0x48,0xA9,0xFF,0x65,0x98,0xFF,0xE8,0x91,0xFF,0x14,0xDD,0xFF,0x76,0xE5,0xFF,0x75,0xDD,0xFF,0x75,0xD5,0xFF,0x96,0xD5,0xFF,0xB6,0xCD,0xFF,
-    0x17,0xDE,0xFF,0x57,0xEE,0xFF,0x6B,0x93,0xFF,0xAA,0x74,0xFF,0x2B,0x4D,0xFF,0xAA,0x24,0xFF,0x49,0x24,0xFF,0x09,0x2C,0xFF,0xE6,0x12,0xFF,0x06,0x23,0xFF,0x47,0x2B,0xFF,0x06,0x23,0xFF,0x06,0x2B,0xFF,0xC2,0x11,0xFF,0x62,0x21,0xFF,0xE4,0x41,0xFF,0x25,0x52,0xFF,0xE4,0x49,0xFF,0x25,0x52,0xFF,0x24,0x52,0xFF,0xA3,0x41,0xFF,0x22,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC5,0x41,0xFF,0xAC,0xB4,0xFF,0x48,0xBC,0xFF,0xA4,0xAB,0xFF,0x46,0xBC,0xFF,0xA7,0xCC,0xFF,0xE7,0xD4,0xFF,0x25,0xC4,0xFF,0xA4,0xB3,0xFF,0x26,0xC4,0xFF,0xA7,0xCC,0xFF,0x66,0xC4,0xFF,0x26,0xBC,0xFF,0x48,0xB4,0xFF,0xC6,0x72,0xFF,0x00,0x20,0xFF,0x21,0x41,0xFF,0xC3,0x59,0xFF,0x85,0x72,0xFF,0x26,0x83,0xFF,0x67,0x93,0xFF,0x67,0x93,0xFF,0x46,0x8B,0xFF,0x27,0x7B,0xFF,0x05,0x52,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x27,0x4A,0xFF,0x09,0x6B,0xFF,0x6A,0x7B,0xFF,0x49,0x73,0xFF,0x09,0x6B,0xFF,0x88,0x5A,0xFF,0x64,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x84,0x39,0xFF,0xC8,0x62,0xFF,0x6A,0x7B,0xFF,0x8A,0x7B,0xFF,0xAB,0x83,0xFF,0xAB,0x83,0xFF,0x8A,0x83,0xFF,0x49,0x73,0xFF,0xC8,0x62,0xFF,0xE6,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x09,0x6B,0xFF,0xEA,0x93,0xFF,0x0A,0x9C,0xFF,0xEA,0x9B,0xFF,0x0A,0x9C,0xFF,0x88,0x93,0xFF,0x0A,0x9C,0xFF,0xA8,0x93,0xFF,0x06,0x83,0xFF,0x47,0x93,0xFF,0x23,0x7A,0xFF,0xE6,0x92,0xFF,0x27,0x9B,0xFF,0x89,0x9B,0xFF,0x86,0x72,0xFF,0x40,0x20,0xFF,0x81,0x20,0xFF,0xE5,0x51,0xFF,0xC7,0x72,0xFF,0x27,0x8B,0xFF,0x47,0x8B,0xFF,0x27,0x83,0xFF,0xC6,0x7A,0xFF,0x45,0x5A,0xFF,0x64,0x3A,0xFF,0x69,0x3B,0xFF,
-    0x0D,0x4C,0xFF,0xCD,0x43,0xFF,0x4B,0x33,0xFF,0xA9,0x22,0xFF,0xC9,0x22,0xFF,0x0A,0x23,0xFF,0xC9,0x1A,0xFF,0x4D,0x44,0xFF,0xF3,0x6D,0xFF,0x13,0x6E,0xFF,0xF1,0x6D,0xFF,0x0A,0x44,0xFF,0x23,0x52,0xFF,0x44,0x5A,0xFF,0x24,0x5A,0xFF,0xE0,0x30,0xFF,0x42,0x39,0xFF,0xE4,0x51,0xFF,0x24,0x5A,0xFF,0xA6,0x62,0xFF,0xA6,0x6A,0xFF,0x85,0x6A,0xFF,0x85,0x6A,0xFF,0x04,0x52,0xFF,0xC0,0x20,0xFF,0x62,0x41,0xFF,0xC3,0x59,0xFF,0x60,0x38,0xFF,0xA0,0x38,0xFF,0x63,0x49,0xFF,0xA3,0x51,0xFF,0x63,0x49,0xFF,0x63,0x49,0xFF,0x22,0x49,0xFF,0xA5,0x61,0xFF,0xE2,0x58,0xFF,0x86,0x91,0xFF,0x45,0xA1,0xFF,0x02,0x98,0xFF,0x04,0xA8,0xFF,0x45,0xA0,0xFF,0x04,0x90,0xFF,0x4A,0x9A,0xFF,0xF4,0xE4,0xFF,0x55,0xE5,0xFF,0x55,0xDD,0xFF,0x95,0xD5,0xFF,0xD6,0xD5,0xFF,0x17,0xDE,0xFF,0x58,0xE6,0xFF,0x94,0xDD,0xFF,0x27,0x9B,0xFF,0x29,0x6C,0xFF,0xC7,0x1B,0xFF,0x49,0x2C,0xFF,0x4E,0x55,0xFF,0x88,0x33,0xFF,0xE2,0x01,0xFF,0xA5,0x22,0xFF,0x67,0x3B,0xFF,0x87,0x3B,0xFF,0x03,0x22,0xFF,0xA0,0x08,0xFF,0x80,0x10,0xFF,
-    0xC5,0x41,0xFF,0x05,0x4A,0xFF,0x04,0x52,0xFF,0x04,0x52,0xFF,0x86,0x62,0xFF,0x09,0x73,0xFF,0x06,0x4A,0xFF,0x0B,0x63,0xFF,0x30,0x8C,0xFF,0x6D,0x6B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC7,0x6A,0xFF,0xC8,0xAB,0xFF,0x85,0xAB,0xFF,0xC4,0xB3,0xFF,0x25,0xBC,0xFF,0x08,0xD5,0xFF,0xA7,0xCC,0xFF,0x45,0xC4,0xFF,0x26,0xBC,0xFF,0xE5,0xB3,0xFF,0x86,0xC4,0xFF,0x28,0xDD,0xFF,0x86,0xCC,0xFF,0xC8,0xC4,0xFF,0x4A,0xAC,0xFF,0xE2,0x20,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0xC1,0x20,0xFF,0x22,0x31,0xFF,0x63,0x39,0xFF,0x22,0x39,0xFF,0x22,0x31,0xFF,0xA1,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x61,0x10,0xFF,0xEC,0x8B,0xFF,0x6F,0xC5,0xFF,0xF0,0xD5,0xFF,0xF0,0xDD,0xFF,0x8F,0xCD,0xFF,0x8E,0xCD,0xFF,0xAE,0xD5,0xFF,0xAF,0xCD,0xFF,0x4F,0xC5,0xFF,0x6D,0x9C,0xFF,0xE9,0x6A,0xFF,0xE3,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x88,0x5A,0xFF,0xEC,0x8B,0xFF,0x6D,0xA4,0xFF,0x8C,0xA4,0xFF,0x8C,0xAC,0xFF,0x8C,0xAC,0xFF,0xAB,0xAC,0xFF,0x6B,0xA4,0xFF,0x4B,0xA4,0xFF,0x8C,0xA4,0xFF,0x6C,0xA4,0xFF,0x6D,0xA4,0xFF,0xAB,0x83,0xFF,0xC2,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x06,0x4A,0xFF,0xEB,0x93,0xFF,0xEA,0x93,0xFF,0xC9,0x93,0xFF,0xEA,0x9B,0xFF,0x4B,0xA4,0xFF,0x6B,0xAC,0xFF,0x2A,0xA4,0xFF,0x09,0xA4,0xFF,0xA8,0x9B,0xFF,0x06,0x8B,0xFF,0x68,0x9B,0xFF,0xA9,0x9B,0xFF,0xC7,0x7A,0xFF,0x63,0x41,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0xE2,0x30,0xFF,0xC4,0x49,0xFF,0x04,0x5A,0xFF,0x65,0x62,0xFF,0x25,0x5A,0xFF,0xE3,0x41,0xFF,0x07,0x3B,0xFF,0x72,0x85,0xFF,0xCC,0x3B,0xFF,0x8B,0x33,0xFF,0xC9,0x22,0xFF,0x68,0x1A,0xFF,0x68,0x1A,0xFF,0xA9,0x1A,0xFF,0x47,0x0A,0xFF,0x30,0x55,0xFF,0x33,0x6E,0xFF,0x90,0x65,0xFF,0x0D,0x55,0xFF,0xA8,0x53,0xFF,0xE2,0x51,0xFF,0x80,0x49,0xFF,0xE3,0x59,0xFF,0x07,0x7B,0xFF,
-    0x07,0x7B,0xFF,0xE6,0x7A,0xFF,0xA5,0x72,0xFF,0xC5,0x72,0xFF,0xC5,0x7A,0xFF,0x25,0x83,0xFF,0x66,0x93,0xFF,0x46,0x8B,0xFF,0xC3,0x51,0xFF,0x00,0x20,0xFF,0x06,0x7B,0xFF,0x8A,0xB4,0xFF,0x2B,0xC5,0xFF,0x0C,0xC5,0xFF,0xAB,0xBC,0xFF,0xE9,0xAB,0xFF,0x68,0x9B,0xFF,0x85,0x82,0xFF,0xE4,0x71,0xFF,0xA3,0x69,0xFF,0x43,0x79,0xFF,0x0C,0xD3,0xFF,0xC8,0xC1,0xFF,0x6B,0xD2,0xFF,0x0A,0xC2,0xFF,0x86,0xA8,0xFF,0x03,0x90,0xFF,0xCC,0xAA,0xFF,0xF4,0xE4,0xFF,0x75,0xE5,0xFF,0xB6,0xDD,0xFF,0x17,0xE6,0xFF,0x17,0xE6,0xFF,0x17,0xE6,0xFF,0x95,0xE5,0xFF,0x06,0x9A,0xFF,0x85,0x72,0xFF,0xC8,0x5B,0xFF,0x06,0x23,0xFF,0x27,0x2B,0xFF,0x85,0x2A,0xFF,0x44,0x2A,0xFF,0xE2,0x21,0xFF,0x02,0x2A,0xFF,0x45,0x63,0xFF,0x07,0x8C,0xFF,0xE6,0x6A,0xFF,0x60,0x18,0xFF,0x22,0x31,0xFF,0x0E,0x8C,0xFF,0x32,0xAD,0xFF,0xF1,0xA4,0xFF,0xC8,0x6A,0xFF,0x87,0x62,0xFF,0xEE,0x8B,0xFF,0xF6,0xC5,0xFF,0xFA,0xDE,0xFF,0x7C,0xEF,0xFF,0x50,0x8C,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x39,0xFF,0x88,0x9B,0xFF,0x27,0xBC,0xFF,0x87,0xCC,0xFF,0x66,0xC4,0xFF,0x66,0xC4,0xFF,0x45,0xC4,0xFF,0x66,0xC4,0xFF,0x66,0xC4,0xFF,0x67,0xC4,0xFF,0x66,0xC4,0xFF,0xC7,0xCC,0xFF,0xA7,0xCC,0xFF,0xC8,0xC4,0xFF,0xCB,0xBC,0xFF,0x43,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x43,0x31,0xFF,0x0E,0xB5,0xFF,0xCE,0xD5,0xFF,0x4B,0xCD,0xFF,0x2B,0xCD,0xFF,0x0A,0xCD,0xFF,0xEA,0xC4,0xFF,0x4C,0xCD,0xFF,0xAD,0xD5,0xFF,0xAD,0xDD,0xFF,0xED,0xDD,0xFF,0xCE,0xDD,0xFF,0x4E,0xC5,0xFF,0xAE,0xA4,0xFF,0xA8,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6B,0x7B,0xFF,0x8E,0xA4,0xFF,0x4B,0x9C,0xFF,0x8C,0xAC,0xFF,0xEC,0xB4,0xFF,0xCC,0xAC,0xFF,0xCB,0xAC,0xFF,0xEC,0xB4,0xFF,0xCB,0xB4,0xFF,0xCB,0xAC,0xFF,0x4A,0x9C,0xFF,0x0A,0x9C,0xFF,
-    0x6C,0xA4,0xFF,0xCE,0xAC,0xFF,0x4A,0x7B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0xE5,0x49,0xFF,0x29,0x73,0xFF,0xCA,0x8B,0xFF,0xEA,0x93,0xFF,0x0A,0x9C,0xFF,0x0A,0x9C,0xFF,0x2A,0xA4,0xFF,0x09,0xA4,0xFF,0x0A,0xA4,0xFF,0xAA,0x93,0xFF,0x48,0x83,0xFF,0x45,0x62,0xFF,0x83,0x41,0xFF,0x81,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x81,0x18,0xFF,0x02,0x29,0xFF,0x81,0x20,0xFF,0xA6,0x3A,0xFF,0x0A,0x4C,0xFF,0x8D,0x5C,0xFF,0x06,0x13,0xFF,0xE7,0x1A,0xFF,0xA6,0x0A,0xFF,0x86,0x0A,0xFF,0xE8,0x1A,0xFF,0xA8,0x1A,0xFF,0xE8,0x1A,0xFF,0xD2,0x65,0xFF,0xB1,0x5D,0xFF,0xAC,0x44,0xFF,0x0D,0x65,0xFF,0xE5,0x5A,0xFF,0x84,0x6A,0xFF,0x47,0x8B,0xFF,0xA8,0x93,0xFF,0x87,0x8B,0xFF,0x05,0x7B,0xFF,0x43,0x62,0xFF,0xC4,0x7A,0xFF,0x05,0x83,0xFF,0xA7,0x93,0xFF,0x28,0xAC,0xFF,0xE7,0xA3,0xFF,0x65,0x9B,0xFF,0x09,0xA4,0xFF,0x69,0xB4,0xFF,0xEC,0xE5,0xFF,0x6B,0xD5,0xFF,0xA9,0xBC,0xFF,0xC7,0xAB,0xFF,0x05,0x93,0xFF,0xC4,0x8A,0xFF,
-    0x25,0x9B,0xFF,0xE6,0x92,0xFF,0xA5,0x92,0xFF,0x85,0x92,0xFF,0xC3,0x81,0xFF,0x27,0xA2,0xFF,0x2D,0xDB,0xFF,0x93,0xFC,0xFF,0x93,0xFC,0xFF,0x4B,0xD2,0xFF,0x86,0xB0,0xFF,0x01,0x88,0xFF,0xAB,0xAA,0xFF,0x31,0xCC,0xFF,0xD3,0xCC,0xFF,0x55,0xD5,0xFF,0x34,0xCD,0xFF,0x71,0xC4,0xFF,0xAA,0x9A,0xFF,0xC3,0x88,0xFF,0x62,0x81,0xFF,0x64,0x62,0xFF,0xA1,0x31,0xFF,0x60,0x31,0xFF,0x03,0x3A,0xFF,0x84,0x4A,0xFF,0x83,0x52,0xFF,0x45,0x73,0xFF,0xEA,0xAC,0xFF,0x29,0xBD,0xFF,0x68,0xAC,0xFF,0x27,0x7B,0xFF,0x0A,0x6B,0xFF,0xD5,0xC5,0xFF,0xB8,0xDE,0xFF,0x9C,0xF7,0xFF,0x53,0xB5,0xFF,0x00,0x00,0xFF,0x90,0x9C,0xFF,0x74,0xB5,0xFF,0x57,0xCE,0xFF,0x7B,0xEF,0xFF,0xF6,0xC5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x81,0x18,0xFF,0x04,0x5A,0xFF,0x87,0x9B,0xFF,0x68,0xBC,0xFF,0x87,0xC4,0xFF,0xC8,0xCC,0xFF,0xE8,0xCC,0xFF,0xA7,0xC4,0xFF,0x66,0xC4,0xFF,0xE9,0xCC,0xFF,
-    0xE9,0xCC,0xFF,0xA8,0xCC,0xFF,0xC8,0xC4,0xFF,0x4C,0xCD,0xFF,0x6B,0xAC,0xFF,0xC1,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAB,0x83,0xFF,0x8D,0xCD,0xFF,0xE9,0xCC,0xFF,0xEA,0xCC,0xFF,0x8C,0xDD,0xFF,0x6A,0xD5,0xFF,0x6B,0xD5,0xFF,0xCD,0xDD,0xFF,0x2F,0xE6,0xFF,0xEE,0xDD,0xFF,0x0E,0xE6,0xFF,0xB0,0xEE,0xFF,0x4F,0xE6,0xFF,0x8E,0xCD,0xFF,0x0F,0xB5,0xFF,0x06,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x52,0xFF,0xAE,0xAC,0xFF,0x4B,0x9C,0xFF,0xCC,0xB4,0xFF,0x2C,0xBD,0xFF,0xEC,0xB4,0xFF,0xEC,0xB4,0xFF,0x2D,0xBD,0xFF,0xEC,0xB4,0xFF,0xCB,0xB4,0xFF,0xCB,0xAC,0xFF,0xAB,0xAC,0xFF,0x8B,0xA4,0xFF,0xAC,0xAC,0xFF,0xCD,0xB4,0xFF,0x0B,0x94,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x60,0x10,0xFF,0xE1,0x20,0xFF,0x63,0x39,0xFF,0x45,0x5A,0xFF,0xA7,0x6A,0xFF,0xC7,0x72,0xFF,0xA6,0x72,0xFF,0x65,0x6A,0xFF,0x25,0x62,0xFF,
-    0x83,0x49,0xFF,0x22,0x39,0xFF,0xA1,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA6,0x2A,0xFF,0x26,0x1B,0xFF,0x25,0x03,0xFF,0x05,0x0B,0xFF,0xA7,0x1B,0xFF,0x09,0x24,0xFF,0x09,0x24,0xFF,0x88,0x1B,0xFF,0x28,0x1B,0xFF,0x28,0x1B,0xFF,0x71,0x5D,0xFF,0xAC,0x44,0xFF,0x0D,0x55,0xFF,0x2A,0x64,0xFF,0xC5,0x6A,0xFF,0x09,0x9C,0xFF,0xC7,0x93,0xFF,0xA6,0x8B,0xFF,0x85,0x8B,0xFF,0x65,0x8B,0xFF,0x05,0x7B,0xFF,0x66,0x8B,0xFF,0x65,0x8B,0xFF,0x24,0x8B,0xFF,0x48,0xAC,0xFF,0x65,0x93,0xFF,0xA9,0xBC,0xFF,0xCB,0xE5,0xFF,0x69,0xE5,0xFF,0x86,0xC4,0xFF,0x64,0xA3,0xFF,0x44,0x9B,0xFF,0xE4,0x8A,0xFF,0x05,0x93,0xFF,0x46,0xA3,0xFF,0x25,0xA3,0xFF,0x25,0xA3,0xFF,0x25,0xA3,0xFF,0xC5,0xA2,0xFF,0x04,0x92,0xFF,0x00,0x81,0xFF,0x08,0xAA,0xFF,0x4D,0xDB,0xFF,0x31,0xFC,0xFF,0xAC,0xDA,0xFF,0x24,0xA8,0xFF,0x02,0x88,0xFF,0x23,0x90,0xFF,0x07,0x99,0xFF,0x07,0x89,0xFF,0xC8,0x91,0xFF,
-    0xA5,0x78,0xFF,0xC5,0x90,0xFF,0xC4,0x98,0xFF,0xA3,0x90,0xFF,0xE4,0x91,0xFF,0xC7,0xA3,0xFF,0x27,0x94,0xFF,0x85,0x7B,0xFF,0x44,0x7B,0xFF,0x23,0x73,0xFF,0xC5,0x83,0xFF,0xC5,0x8B,0xFF,0xA3,0x8B,0xFF,0x09,0xBD,0xFF,0xC8,0xB4,0xFF,0xA7,0x9B,0xFF,0x0C,0x9C,0xFF,0xB4,0xBD,0xFF,0x57,0xCE,0xFF,0x5B,0xEF,0xFF,0x16,0xCE,0xFF,0x00,0x08,0xFF,0x4F,0x9C,0xFF,0x73,0xBD,0xFF,0x32,0xB5,0xFF,0x36,0xD6,0xFF,0x73,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE2,0x28,0xFF,0xC3,0x59,0xFF,0xA5,0x82,0xFF,0xA7,0x9B,0xFF,0x49,0xB4,0xFF,0x88,0xBC,0xFF,0x89,0xBC,0xFF,0x89,0xBC,0xFF,0xCA,0xC4,0xFF,0xEA,0xC4,0xFF,0xEB,0xC4,0xFF,0x0C,0xC5,0xFF,0x8B,0xB4,0xFF,0xA6,0x6A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x73,0xFF,
-    0x6D,0xCD,0xFF,0xA7,0xC4,0xFF,0x67,0xBC,0xFF,0x2A,0xCD,0xFF,0xAB,0xDD,0xFF,0xCD,0xDD,0xFF,0x0F,0xDE,0xFF,0x0F,0xDE,0xFF,0x6F,0xE6,0xFF,0x2E,0xE6,0xFF,0xB0,0xEE,0xFF,0xD1,0xEE,0xFF,0x70,0xE6,0xFF,0x8F,0xCD,0xFF,0xCC,0x8B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x73,0xFF,0x8D,0xA4,0xFF,0x6C,0xA4,0xFF,0x4D,0xC5,0xFF,0x0C,0xBD,0xFF,0xEC,0xB4,0xFF,0x0D,0xB5,0xFF,0x4D,0xBD,0xFF,0x0D,0xBD,0xFF,0x2D,0xBD,0xFF,0x0D,0xBD,0xFF,0xCC,0xAC,0xFF,0x6B,0xA4,0xFF,0x6B,0xA4,0xFF,0xAC,0xAC,0xFF,0x69,0x83,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0xC1,0x20,0xFF,0xE2,0x28,0xFF,0xE1,0x28,0xFF,0xC1,0x28,0xFF,0x81,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA6,0x2A,0xFF,0x06,0x1B,0xFF,0x25,0x13,0xFF,
-    0x86,0x1B,0xFF,0x45,0x0B,0xFF,0x86,0x0B,0xFF,0x08,0x1C,0xFF,0x86,0x0B,0xFF,0x67,0x0B,0xFF,0x27,0x0B,0xFF,0xA9,0x23,0xFF,0xE9,0x23,0xFF,0xED,0x5C,0xFF,0xC7,0x4A,0xFF,0xC8,0x8B,0xFF,0xA6,0x8B,0xFF,0x44,0x7B,0xFF,0x43,0x73,0xFF,0x84,0x83,0xFF,0xC6,0x93,0xFF,0x86,0x8B,0xFF,0xC7,0x9B,0xFF,0x86,0x93,0xFF,0xE8,0x9B,0xFF,0x08,0xA4,0xFF,0xE7,0xA3,0xFF,0x4D,0xEE,0xFF,0xC8,0xD4,0xFF,0x67,0xCC,0xFF,0x26,0xBC,0xFF,0x44,0x9B,0xFF,0x25,0x93,0xFF,0x65,0xA3,0xFF,0xC6,0xB3,0xFF,0xA5,0xAB,0xFF,0x89,0xC4,0xFF,0xC6,0xB3,0xFF,0x44,0xAB,0xFF,0xC4,0xA2,0xFF,0x81,0x81,0xFF,0xE1,0x70,0xFF,0x43,0x89,0xFF,0x29,0xBA,0xFF,0x8B,0xDA,0xFF,0xE9,0xC1,0xFF,0x42,0x98,0xFF,0x22,0x88,0xFF,0x01,0x90,0xFF,0xC5,0xA0,0xFF,0xE6,0x90,0xFF,0xC5,0x88,0xFF,0xE5,0x90,0xFF,0x84,0x90,0xFF,0xA3,0x98,0xFF,0x62,0x90,0xFF,0xE6,0xAA,0xFF,0x68,0xB4,0xFF,0x26,0x9C,0xFF,0x63,0x83,0xFF,0x43,0x7B,0xFF,0xC6,0x8B,0xFF,0xA9,0xA4,0xFF,0xAB,0xCD,0xFF,0x0B,0xD6,0xFF,0xAA,0xD5,0xFF,0x0A,0xC5,0xFF,0x46,0x93,0xFF,
-    0xCF,0xB4,0xFF,0xB8,0xDE,0xFF,0x3A,0xE7,0xFF,0x97,0xDE,0xFF,0x11,0xAD,0xFF,0x00,0x00,0xFF,0xE9,0x6A,0xFF,0x6E,0xA4,0xFF,0x8F,0xAC,0xFF,0xF0,0xB4,0xFF,0x8C,0x83,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA1,0x20,0xFF,0x83,0x49,0xFF,0x04,0x62,0xFF,0x86,0x72,0xFF,0xE6,0x82,0xFF,0x67,0x8B,0xFF,0x88,0x93,0xFF,0x2A,0xA4,0xFF,0xE9,0x9B,0xFF,0x88,0x93,0xFF,0x27,0x83,0xFF,0x25,0x62,0xFF,0x00,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x20,0xFF,0x2A,0xA4,0xFF,0x6C,0xD5,0xFF,0x4A,0xD5,0xFF,0x4A,0xD5,0xFF,0x09,0xCD,0xFF,0x2E,0xE6,0xFF,0x2F,0xDE,0xFF,0x71,0xE6,0xFF,0x4F,0xE6,0xFF,0x8F,0xEE,0xFF,0xF2,0xF6,0xFF,0xB1,0xEE,0xFF,0x70,0xEE,0xFF,0xF0,0xD5,0xFF,0x0C,0x8C,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x87,0x5A,0xFF,0xAE,0xA4,0xFF,0x6B,0xA4,0xFF,0x0D,0xBD,0xFF,0xAB,0xAC,0xFF,0x8B,0xAC,0xFF,0xCC,0xB4,0xFF,0xCC,0xB4,0xFF,0xCC,0xB4,0xFF,0x2D,0xBD,0xFF,0x2D,0xBD,0xFF,0xAC,0xAC,0xFF,0xAC,0xAC,0xFF,0xAD,0xAC,0xFF,0xEA,0x93,0xFF,0x45,0x5A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x05,0x22,0xFF,0xC6,0x22,0xFF,0x66,0x1B,0xFF,0xAA,0x2C,0xFF,0x8A,0x1C,0xFF,0xA9,0x1C,0xFF,0xEA,0x24,0xFF,0x28,0x1C,0xFF,0x86,0x0B,0xFF,0xC9,0x1B,0xFF,0x27,0x0B,0xFF,0x88,0x2B,0xFF,0xCA,0x43,0xFF,0x07,0x6B,0xFF,0x66,0x7B,0xFF,0x24,0x73,0xFF,0x23,0x6B,0xFF,0x84,0x7B,0xFF,0xC6,0x8B,0xFF,
-    0x07,0x9C,0xFF,0xE3,0x7A,0xFF,0x86,0x8B,0xFF,0x8A,0xB4,0xFF,0xE7,0xA3,0xFF,0xC6,0xA3,0xFF,0x0D,0xE6,0xFF,0xAB,0xED,0xFF,0x43,0xAB,0xFF,0xC6,0xB3,0xFF,0xC5,0xAB,0xFF,0x85,0xA3,0xFF,0x27,0xB4,0xFF,0x26,0xBC,0xFF,0xE6,0xB3,0xFF,0x47,0xBC,0xFF,0x87,0xC4,0xFF,0xA8,0xC4,0xFF,0xA9,0xCC,0xFF,0xA6,0xBB,0xFF,0x63,0x9A,0xFF,0x61,0x81,0xFF,0x43,0x81,0xFF,0xE3,0x78,0xFF,0xC8,0xB9,0xFF,0x88,0xC9,0xFF,0x46,0xC1,0xFF,0x84,0xA0,0xFF,0x43,0xA0,0xFF,0x22,0x90,0xFF,0x84,0x90,0xFF,0x06,0xA1,0xFF,0xA7,0xA9,0xFF,0xC7,0xB1,0xFF,0x84,0xA1,0xFF,0x44,0x9A,0xFF,0x65,0xA3,0xFF,0x47,0xAC,0xFF,0x84,0x8B,0xFF,0x06,0x94,0xFF,0xA9,0xAC,0xFF,0xEA,0xB4,0xFF,0xA8,0xAC,0xFF,0x8A,0xCD,0xFF,0x0B,0xDE,0xFF,0x08,0xC5,0xFF,0xC6,0xA3,0xFF,0x4D,0xAC,0xFF,0x73,0xBD,0xFF,0xF9,0xE6,0xFF,0xDD,0xFF,0xFF,0x1A,0xEF,0xFF,0xC9,0x62,0xFF,0x00,0x00,0xFF,0xA1,0x18,0xFF,0xC9,0x72,0xFF,0x09,0x7B,0xFF,0x47,0x62,0xFF,0x00,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x60,0x18,0xFF,0x22,0x31,0xFF,0x43,0x39,0xFF,0x43,0x39,0xFF,0x02,0x31,0xFF,0x22,0x39,0xFF,0x43,0x39,0xFF,0x02,0x31,0xFF,0x00,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x10,0xFF,0x83,0x51,0xFF,0xE8,0x9B,0xFF,0x4B,0xCD,0xFF,0xCC,0xE5,0xFF,0xEC,0xE5,0xFF,0x2D,0xE6,0xFF,0x2E,0xE6,0xFF,0x70,0xE6,0xFF,0x90,0xEE,0xFF,0xB0,0xEE,0xFF,0xB1,0xEE,0xFF,0xB1,0xEE,0xFF,0x91,0xE6,0xFF,0xD0,0xCD,0xFF,0xC7,0x6A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA1,0x18,0xFF,0x08,0x6B,0xFF,0x2C,0x9C,0xFF,0x6C,0xA4,0xFF,0x8C,0xAC,0xFF,0x6B,0xA4,0xFF,0x6B,0xA4,0xFF,0x4A,0xA4,0xFF,0xAB,0xAC,0xFF,0xCC,0xB4,0xFF,0xEC,0xB4,0xFF,0xED,0xB4,0xFF,0xAC,0xAC,0xFF,
-    0x89,0x8B,0xFF,0x25,0x5A,0xFF,0x61,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x01,0xFF,0x44,0x1A,0xFF,0x87,0x23,0xFF,0x6A,0x24,0xFF,0x0B,0x2D,0xFF,0x4C,0x2D,0xFF,0x2C,0x35,0xFF,0xA7,0x13,0xFF,0xA9,0x23,0xFF,0x48,0x23,0xFF,0x24,0x12,0xFF,0xC4,0x31,0xFF,0x67,0x83,0xFF,0x03,0x73,0xFF,0x44,0x73,0xFF,0x64,0x73,0xFF,0xC5,0x8B,0xFF,0x48,0xA4,0xFF,0x47,0xA4,0xFF,0xC6,0x93,0xFF,0x28,0xA4,0xFF,0xA6,0x93,0xFF,0xA6,0x9B,0xFF,0xA9,0xC4,0xFF,0xE9,0xCC,0xFF,0xC7,0xAB,0xFF,0x49,0xBC,0xFF,0xA6,0xAB,0xFF,0xE6,0xB3,0xFF,0x27,0xB4,0xFF,0xA8,0xC4,0xFF,0xC9,0xC4,0xFF,0xA8,0xC4,0xFF,0x67,0xBC,0xFF,
-    0x6B,0xD5,0xFF,0xCD,0xE5,0xFF,0x0A,0xCD,0xFF,0xC6,0xBB,0xFF,0xE4,0xA2,0xFF,0x43,0x92,0xFF,0xA3,0x79,0xFF,0x00,0x40,0xFF,0x20,0x68,0xFF,0x05,0xA9,0xFF,0xA8,0xC9,0xFF,0xA4,0xA8,0xFF,0xC5,0xB0,0xFF,0x43,0xA0,0xFF,0x26,0xA1,0xFF,0xE8,0xB1,0xFF,0x49,0xAA,0xFF,0xA6,0x99,0xFF,0xA7,0xA2,0xFF,0x4A,0xC4,0xFF,0x28,0xB4,0xFF,0x27,0xAC,0xFF,0x27,0xA4,0xFF,0x47,0xA4,0xFF,0xC6,0x93,0xFF,0xE5,0x93,0xFF,0xA7,0xAC,0xFF,0xE8,0xBC,0xFF,0xC8,0xBC,0xFF,0x68,0xB4,0xFF,0x87,0x93,0xFF,0xB0,0xAC,0xFF,0x53,0xB5,0xFF,0xB5,0xBD,0xFF,0xD8,0xE6,0xFF,0xD8,0xE6,0xFF,0x70,0x94,0xFF,0x23,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x10,0xFF,0x83,0x49,0xFF,0xE6,0x7A,0xFF,0xC8,0x9B,0xFF,0xCB,0xB4,0xFF,0x4D,0xCD,0xFF,0x8D,0xD5,0xFF,0xAE,0xD5,0xFF,0x0F,0xDE,0xFF,0x30,0xDE,0xFF,0x30,0xD6,0xFF,0xAF,0xCD,0xFF,0xAD,0xAC,0xFF,0x69,0x83,0xFF,0x43,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x02,0x29,0xFF,0xC4,0x49,0xFF,0xA7,0x62,0xFF,0x48,0x7B,0xFF,0xA9,0x8B,0xFF,0xA9,0x8B,0xFF,0xC9,0x93,0xFF,0xE9,0x9B,0xFF,0xC9,0x9B,0xFF,0xC9,0x93,0xFF,0x48,0x83,0xFF,0xC7,0x6A,0xFF,0xA4,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x81,0x10,0xFF,0x26,0x52,0xFF,0xC7,0x62,0xFF,0x28,0x6B,0xFF,0xE6,0x5A,0xFF,0x63,0x32,0xFF,0x82,0x22,0xFF,0xC3,0x22,0xFF,0x05,0x1B,0xFF,0x26,0x1B,0xFF,0xE5,0x1A,0xFF,0x85,0x1A,0xFF,0xA3,0x11,0xFF,0x00,0x00,0xFF,0x02,0x29,0xFF,0xC8,0x8B,0xFF,0x65,0x83,0xFF,0x85,0x83,0xFF,0xC6,0x8B,0xFF,0x28,0x9C,0xFF,0x48,0xA4,0xFF,0x68,0xAC,0xFF,0x47,0xAC,0xFF,0x47,0xAC,0xFF,0x48,0xB4,0xFF,0xE7,0xAB,0xFF,0x08,0xAC,0xFF,0x85,0x72,0xFF,0x00,0x20,0xFF,0xA5,0x72,0xFF,0x2A,0xAC,0xFF,0x49,0xB4,0xFF,0x68,0xBC,0xFF,0x68,0xBC,0xFF,0xE9,0xCC,0xFF,0xC8,0xC4,0xFF,0x87,0xC4,0xFF,0xC9,0xC4,0xFF,0x87,0xBC,0xFF,0xE5,0xB3,0xFF,0x06,0xBC,0xFF,0xE6,0xB3,0xFF,0xC7,0xBB,0xFF,0xE3,0x71,0xFF,0x00,0x30,0xFF,0x00,0x48,0xFF,0x20,0x60,0xFF,0x25,0x99,0xFF,0x66,0xA9,0xFF,0xA7,0xB1,0xFF,0xE8,0xB1,0xFF,0xA7,0x99,0xFF,0x86,0x79,0xFF,
-    0x40,0x38,0xFF,0x81,0x48,0xFF,0x43,0x69,0xFF,0xA6,0x8A,0xFF,0xC8,0xA3,0xFF,0x28,0xAC,0xFF,0x89,0xB4,0xFF,0x48,0xAC,0xFF,0x68,0xAC,0xFF,0x69,0xAC,0xFF,0xAA,0xB4,0xFF,0x49,0xAC,0xFF,0x08,0xA4,0xFF,0x27,0x8B,0xFF,0x83,0x49,0xFF,0x2E,0x9C,0xFF,0xD1,0xAC,0xFF,0x90,0xA4,0xFF,0x31,0xB5,0xFF,0x15,0xCE,0xFF,0x7B,0xF7,0xFF,0x77,0xD6,0xFF,0xC1,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0xE1,0x28,0xFF,0x83,0x41,0xFF,0x45,0x62,0xFF,0xA6,0x6A,0xFF,0xC6,0x72,0xFF,0xE7,0x7A,0xFF,0x68,0x83,0xFF,0x89,0x83,0xFF,0xE7,0x72,0xFF,0xA6,0x6A,0xFF,0x25,0x5A,0xFF,0xE2,0x28,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA1,0x18,0xFF,0x23,0x31,0xFF,0x43,0x39,0xFF,0xC4,0x49,0xFF,0xE4,0x51,0xFF,0xE4,0x51,0xFF,0x04,0x5A,0xFF,0xE4,0x59,0xFF,0x83,0x41,0xFF,0xC1,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC7,0x62,0xFF,0xEB,0x93,0xFF,0xCA,0x93,0xFF,0x88,0x8B,0xFF,0xA8,0x83,0xFF,0xE8,0x83,0xFF,
-    0x07,0x7C,0xFF,0xE6,0x73,0xFF,0xC6,0x6B,0xFF,0x45,0x5B,0xFF,0xE4,0x52,0xFF,0x02,0x3A,0xFF,0x03,0x3A,0xFF,0xE1,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA6,0x62,0xFF,0xC8,0x8B,0xFF,0xC7,0x93,0xFF,0xE7,0x9B,0xFF,0xE7,0x9B,0xFF,0x28,0xAC,0xFF,0x27,0xAC,0xFF,0xA8,0xC4,0xFF,0xA9,0xC4,0xFF,0xE7,0xAB,0xFF,0x06,0x83,0xFF,0x83,0x49,0xFF,0x00,0x00,0xFF,0x00,0x10,0xFF,0x60,0x28,0xFF,0x44,0x6A,0xFF,0xA7,0x9B,0xFF,0x09,0xAC,0xFF,0x69,0xBC,0xFF,0xEA,0xCC,0xFF,0xC9,0xC4,0xFF,0xA9,0xC4,0xFF,0x88,0xC4,0xFF,0x87,0xC4,0xFF,0xE8,0xCC,0xFF,0x69,0xDD,0xFF,0x8A,0xE5,0xFF,0xE7,0xB3,0xFF,0x80,0x50,0xFF,0xE1,0x58,0xFF,0x22,0x61,0xFF,0xE2,0x58,0xFF,0x21,0x48,0xFF,0xC3,0x60,0xFF,0x45,0x71,0xFF,0x24,0x61,0xFF,0x20,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA2,0x30,0xFF,0x43,0x51,0xFF,0xE3,0x61,0xFF,0x85,0x7A,0xFF,0xE6,0x82,0xFF,0x46,0x8B,0xFF,0x67,0x93,0xFF,0x47,0x8B,0xFF,0x27,0x83,0xFF,0x65,0x6A,0xFF,0xA3,0x51,0xFF,0x60,0x20,0xFF,0x00,0x00,0xFF,0x68,0x5A,0xFF,
-    0x0E,0x9C,0xFF,0x6F,0xA4,0xFF,0x53,0xBD,0xFF,0xB5,0xBD,0xFF,0xFA,0xE6,0xFF,0x9B,0xF7,0xFF,0x4F,0x94,0xFF,0x6C,0x73,0xFF,0x53,0xAD,0xFF,0x13,0xA5,0xFF,0xC6,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE7,0x39,0xFF,0x07,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x41,0x08,0xFF,0x6C,0x73,0xFF,0xB1,0x9C,0xFF,0x0F,0x84,0xFF,0x81,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE2,0x20,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x43,0x31,0xFF,0x23,0x29,0xFF,0xC1,0x20,0xFF,0x40,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC7,0x6A,0xFF,0x2A,0x9C,0xFF,0x66,0x8B,0xFF,0xE7,0x9B,0xFF,0x28,0x9C,0xFF,0xC7,0x8B,0xFF,0xA7,0x8B,0xFF,0x68,0x94,0xFF,0x48,0x94,0xFF,0x28,0x8C,0xFF,0x07,0x8C,0xFF,0xE7,0x8B,0xFF,0x86,0x7B,0xFF,0xA8,0x8B,0xFF,0x07,0x7B,0xFF,0x81,0x18,0xFF,0x00,0x00,0xFF,0x00,0x08,0xFF,0x83,0x39,0xFF,0x64,0x5A,0xFF,0xA4,0x72,0xFF,0x83,0x7A,0xFF,0x63,0x72,0xFF,
-    0xA4,0x82,0xFF,0x25,0x93,0xFF,0x43,0x72,0xFF,0x62,0x51,0xFF,0xA4,0x51,0xFF,0x83,0x51,0xFF,0x01,0x39,0xFF,0xA0,0x30,0xFF,0x00,0x20,0xFF,0x01,0x39,0xFF,0x44,0x6A,0xFF,0x06,0x8B,0xFF,0xC5,0x8A,0xFF,0x05,0x93,0xFF,0x66,0x9B,0xFF,0x28,0xB4,0xFF,0x67,0xC4,0xFF,0xC8,0xCC,0xFF,0x69,0xDD,0xFF,0x49,0xD5,0xFF,0x48,0xB4,0xFF,0xA7,0xA3,0xFF,0x47,0xA3,0xFF,0x84,0x9A,0xFF,0xA5,0xA2,0xFF,0x85,0x9A,0xFF,0xA6,0x92,0xFF,0x45,0x7A,0xFF,0xC1,0x38,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0xA1,0x20,0xFF,0xE1,0x30,0xFF,0x42,0x39,0xFF,0x42,0x39,0xFF,0x02,0x31,0xFF,0xC1,0x28,0xFF,0x20,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x03,0x31,0xFF,0xCD,0x8B,0xFF,0xF1,0xAC,0xFF,0xB1,0xA4,0xFF,0x53,0xB5,0xFF,0x77,0xD6,0xFF,0xF5,0xCD,0xFF,0xB4,0xBD,0xFF,0x1A,0xE7,0xFF,0xDD,0xFF,0xFF,0x57,0xCE,0xFF,0xE2,0x20,0xFF,0xE7,0x41,0xFF,0x91,0x94,0xFF,0xB5,0xBD,0xFF,0x13,0xA5,0xFF,
-    0x64,0x29,0xFF,0x00,0x00,0xFF,0x50,0x8C,0xFF,0x37,0xCE,0xFF,0xB9,0xDE,0xFF,0xB5,0xB5,0xFF,0x65,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0F,0x84,0xFF,0x94,0xBD,0xFF,0x57,0xCE,0xFF,0x9C,0xF7,0xFF,0x74,0xB5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x26,0x4A,0xFF,0xE9,0x93,0xFF,0x08,0xA4,0xFF,0xA6,0x93,0xFF,0x68,0xAC,0xFF,0x89,0xAC,0xFF,0x28,0x9C,0xFF,0x07,0x94,0xFF,0xA6,0x8B,0xFF,0x66,0x7B,0xFF,0x45,0x7B,0xFF,0x45,0x7B,0xFF,0xA6,0x8B,0xFF,0x65,0x83,0xFF,0x6A,0xAC,0xFF,0x0A,0xA4,0xFF,0xC5,0x49,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x40,0x10,0xFF,0x87,0x6A,0xFF,0x45,0x72,0xFF,0xE3,0x61,0xFF,0x24,0x62,0xFF,0x04,0x62,0xFF,0x64,0x72,0xFF,0x84,0x7A,0xFF,0xA5,0x7A,0xFF,0xC5,0x82,0xFF,0x06,0x8B,0xFF,0xA5,0x7A,0xFF,0x82,0x51,0xFF,0x21,0x49,0xFF,0x21,0x49,0xFF,0x82,0x59,0xFF,0xA2,0x59,0xFF,0x44,0x72,0xFF,0x46,0x93,0xFF,
-    0x87,0x9B,0xFF,0x87,0x9B,0xFF,0x86,0x9B,0xFF,0x27,0xB4,0xFF,0x28,0xD5,0xFF,0x29,0xDD,0xFF,0x86,0xBB,0xFF,0xA7,0xC3,0xFF,0xC7,0xC3,0xFF,0x87,0xC3,0xFF,0x67,0xBB,0xFF,0xE9,0xC3,0xFF,0x68,0xA3,0xFF,0x84,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x27,0x4A,0xFF,0x6F,0x9C,0xFF,0xB0,0xA4,0xFF,0xF1,0xAC,0xFF,0xAF,0xAC,0xFF,0x72,0xC5,0xFF,0xB5,0xBD,0xFF,0xF6,0xC5,0xFF,0x3A,0xE7,0xFF,0x5B,0xF7,0xFF,0x2E,0x8C,0xFF,0x32,0xAD,0xFF,0x16,0xC6,0xFF,0xF9,0xDE,0xFF,0xBD,0xF7,0xFF,0x74,0xB5,0xFF,0x6D,0x73,0xFF,0x16,0xC6,0xFF,0x16,0xC6,0xFF,0xFA,0xDE,0xFF,0x9C,0xF7,0xFF,0xF2,0xA4,0xFF,0x00,0x00,0xFF,0xA6,0x39,0xFF,0xB5,0xBD,0xFF,0x74,0xB5,0xFF,0x94,0xB5,0xFF,0xD9,0xDE,0xFF,0xD9,0xDE,0xFF,0xCA,0x5A,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8A,0x7B,0xFF,0x49,0xA4,0xFF,0x28,0xA4,0xFF,0x08,0xA4,0xFF,0x08,0xA4,0xFF,0xAA,0xB4,0xFF,0xCA,0xB4,0xFF,0xE7,0x93,0xFF,0x45,0x83,0xFF,0x04,0x7B,0xFF,0x25,0x83,0xFF,0xE8,0x9B,0xFF,0x08,0xA4,0xFF,0x44,0x8B,0xFF,0xA7,0x9B,0xFF,0x6B,0xAC,0xFF,0xA4,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x73,0xFF,0x2B,0xAC,0xFF,0x46,0x9B,0xFF,0x87,0x9B,0xFF,0x67,0x9B,0xFF,0x66,0x9B,0xFF,0x66,0x9B,0xFF,0x87,0x9B,0xFF,0x86,0x9B,0xFF,0xE7,0xA3,0xFF,0x08,0xAC,0xFF,0xA7,0xA3,0xFF,0x82,0x7A,0xFF,0xE6,0x7A,0xFF,0x89,0x8B,0xFF,0x83,0x49,0xFF,0x28,0x83,0xFF,0x47,0x93,0xFF,0x25,0x93,0xFF,0xC6,0xAB,0xFF,0xE7,0xD4,0xFF,0x88,0xE5,0xFF,0xA9,0xE5,0xFF,0x46,0xC4,0xFF,0x04,0xAB,0xFF,0xC7,0xC3,0xFF,0x69,0xD4,0xFF,0xE8,0xCB,0xFF,0xE8,0xCB,0xFF,0xC7,0xC3,0xFF,0xE8,0xBB,0xFF,0x48,0x8B,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x5A,0xFF,0xCD,0x8B,0xFF,0x0D,0x94,0xFF,0xC8,0x72,0xFF,0x8F,0xA4,0xFF,0xF1,0xAC,0xFF,0xD1,0xA4,0xFF,0xD4,0xBD,0xFF,0x15,0xCE,0xFF,0xF1,0xB4,0xFF,0x36,0xD6,0xFF,0x73,0xB5,0xFF,0xD5,0xBD,0xFF,0xD9,0xDE,0xFF,0x57,0xD6,0xFF,0xF2,0xAC,0xFF,0xD6,0xC5,0xFF,0xF2,0x9C,0xFF,0x94,0xB5,0xFF,0x98,0xDE,0xFF,0x53,0xB5,0xFF,0x00,0x00,0xFF,0x06,0x4A,0xFF,0x53,0xB5,0xFF,0x32,0xAD,0xFF,0xD1,0x9C,0xFF,0x12,0xAD,0xFF,0x57,0xD6,0xFF,0x8D,0x73,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA8,0x62,0xFF,0xAC,0xB4,0xFF,0x49,0xAC,0xFF,0x69,0xAC,0xFF,0xAA,0xB4,0xFF,0xA9,0xB4,0xFF,0x48,0xAC,0xFF,0x28,0xA4,0xFF,
-    0xAA,0xB4,0xFF,0xEA,0xBC,0xFF,0x0B,0xC5,0xFF,0xAA,0xB4,0xFF,0xA6,0x9B,0xFF,0xC8,0x9B,0xFF,0xCD,0xBC,0xFF,0x89,0x93,0xFF,0x00,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC1,0x20,0xFF,0x07,0x73,0xFF,0xC9,0x9B,0xFF,0xE9,0xA3,0xFF,0xA7,0x9B,0xFF,0xC7,0xA3,0xFF,0xE7,0xAB,0xFF,0xA6,0xA3,0xFF,0xC6,0xA3,0xFF,0x47,0xBC,0xFF,0x67,0xBC,0xFF,0x88,0xBC,0xFF,0x2B,0xCD,0xFF,0xEC,0xBC,0xFF,0xA6,0x72,0xFF,0x00,0x08,0xFF,0xCA,0x9B,0xFF,0x07,0xB4,0xFF,0x87,0xCC,0xFF,0x66,0xC4,0xFF,0x27,0xDD,0xFF,0x88,0xE5,0xFF,0x08,0xD5,0xFF,0x87,0xCC,0xFF,0x48,0xCC,0xFF,0xE7,0xC3,0xFF,0xA6,0xC3,0xFF,0x86,0xC3,0xFF,0xC7,0xCB,0xFF,0xA7,0xC3,0xFF,0xE7,0xBB,0xFF,0x2B,0xAC,0xFF,0x64,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x23,0x21,0xFF,0xC8,0x62,0xFF,0x6A,0x7B,0xFF,0xCB,0x8B,0xFF,0x0B,0x94,0xFF,0xEB,0x93,0xFF,0x69,0x7B,0xFF,0x88,0x62,0xFF,0x44,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x08,0xFF,0x81,0x18,0xFF,0x00,0x00,0xFF,0xE9,0x6A,0xFF,0xAF,0xA4,0xFF,0xF0,0xAC,0xFF,0xD0,0xAC,0xFF,0x2D,0x94,0xFF,0x2A,0x7B,0xFF,0xF1,0xAC,0xFF,0xB1,0xA4,0xFF,0xF1,0xA4,0xFF,0xD4,0xC5,0xFF,0x93,0xBD,0xFF,0x0E,0x94,0xFF,0xF2,0xA4,0xFF,0x12,0xAD,0xFF,0xD1,0xA4,0xFF,0x53,0xB5,0xFF,0x0E,0x8C,0xFF,0x00,0x00,0xFF,0xA1,0x20,0xFF,0xAC,0x83,0xFF,0xD0,0xAC,0xFF,0x12,0xB5,0xFF,0x11,0xB5,0xFF,0xF1,0xAC,0xFF,0xE6,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x28,0x7B,0xFF,0x6B,0xAC,0xFF,0xAA,0xB4,0xFF,0x69,0xB4,0xFF,0x48,0xAC,0xFF,0xE7,0x9B,0xFF,0xA7,0x93,0xFF,0x29,0xA4,0xFF,0x28,0xAC,0xFF,0x08,0xA4,0xFF,0x6A,0xAC,0xFF,0xCC,0xBC,0xFF,0x8C,0xB4,0xFF,0x69,0x8B,0xFF,0x42,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x02,0x29,0xFF,
-    0xC4,0x49,0xFF,0x86,0x6A,0xFF,0x07,0x7B,0xFF,0xA8,0x93,0xFF,0xE8,0xA3,0xFF,0x28,0xAC,0xFF,0x68,0xBC,0xFF,0x88,0xBC,0xFF,0x88,0xBC,0xFF,0xAA,0xBC,0xFF,0xE8,0xA3,0xFF,0x23,0x62,0xFF,0x60,0x20,0xFF,0x00,0x00,0xFF,0x89,0x8B,0xFF,0xCA,0xC4,0xFF,0x08,0xD5,0xFF,0xE7,0xD4,0xFF,0xE7,0xD4,0xFF,0xA7,0xCC,0xFF,0x87,0xC4,0xFF,0x88,0xC4,0xFF,0xC7,0xBB,0xFF,0xC3,0xA2,0xFF,0x66,0xBB,0xFF,0x49,0xCC,0xFF,0x69,0xD4,0xFF,0x86,0xBB,0xFF,0xE8,0xB3,0xFF,0x8C,0xB4,0xFF,0x03,0x29,0xFF,0x00,0x00,0xFF,0xE2,0x20,0xFF,0xEB,0x8B,0xFF,0xCD,0xAC,0xFF,0x4B,0xA4,0xFF,0x29,0xA4,0xFF,0x08,0xA4,0xFF,0x69,0xB4,0xFF,0x6A,0xB4,0xFF,0xAB,0xBC,0xFF,0xAC,0xB4,0xFF,0x0B,0x9C,0xFF,0x87,0x62,0xFF,0x23,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x61,0x10,0xFF,0xC9,0x6A,0xFF,0x6B,0x7B,0xFF,0x2A,0x73,0xFF,0x06,0x52,0xFF,0x00,0x00,0xFF,0x4B,0x7B,0xFF,0x6F,0xA4,0xFF,0xF1,0xB4,0xFF,0xF1,0xB4,0xFF,
-    0xED,0x93,0xFF,0x64,0x39,0xFF,0x4B,0x7B,0xFF,0x4F,0x9C,0xFF,0x8F,0xA4,0xFF,0x4F,0x94,0xFF,0x64,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x64,0x39,0xFF,0x6B,0x7B,0xFF,0x0D,0x94,0xFF,0x0D,0x94,0xFF,0x68,0x5A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC1,0x20,0xFF,0x04,0x52,0xFF,0xE6,0x7A,0xFF,0x88,0x8B,0xFF,0xE9,0x9B,0xFF,0x09,0x9C,0xFF,0x09,0xA4,0xFF,0x09,0xA4,0xFF,0x2A,0xA4,0xFF,0x4A,0xA4,0xFF,0xEA,0x9B,0xFF,0x48,0x83,0xFF,0x45,0x62,0xFF,0xC1,0x28,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0xE2,0x28,0xFF,0x83,0x41,0xFF,0xC3,0x49,0xFF,0x65,0x62,0xFF,0x85,0x72,0xFF,0x05,0x83,0xFF,0xE5,0x82,0xFF,0x43,0x6A,0xFF,0xC2,0x51,0xFF,0x21,0x39,0xFF,0x60,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC4,0x49,0xFF,0x09,0xA4,0xFF,
-    0x89,0xBC,0xFF,0xC8,0xCC,0xFF,0x08,0xD5,0xFF,0x46,0xBC,0xFF,0x47,0xBC,0xFF,0x85,0xAB,0xFF,0xA6,0xB3,0xFF,0x68,0xCC,0xFF,0xC9,0xCC,0xFF,0x0B,0xDD,0xFF,0x48,0xC4,0xFF,0x69,0xC4,0xFF,0xEC,0xC4,0xFF,0xCA,0x93,0xFF,0x00,0x00,0xFF,0xE5,0x41,0xFF,0xAD,0xAC,0xFF,0x8B,0xB4,0xFF,0xA6,0x9B,0xFF,0xE6,0xA3,0xFF,0xA5,0xA3,0xFF,0x27,0xB4,0xFF,0x06,0xAC,0xFF,0xE6,0xAB,0xFF,0x68,0xBC,0xFF,0xA9,0xC4,0xFF,0xEB,0xC4,0xFF,0xAB,0xBC,0xFF,0xEB,0x9B,0xFF,0x88,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA2,0x18,0xFF,0x88,0x62,0xFF,0x2B,0x7B,0xFF,0x88,0x62,0xFF,0x03,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x44,0x39,0xFF,0xA5,0x41,0xFF,0x20,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC2,0x20,0xFF,0xA1,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x81,0x18,0xFF,0x22,0x31,0xFF,0xA3,0x49,0xFF,0x24,0x5A,0xFF,0x85,0x6A,0xFF,0xA6,0x6A,0xFF,0x85,0x6A,0xFF,0xA6,0x6A,0xFF,0x45,0x5A,0xFF,0xC4,0x49,0xFF,0xE2,0x28,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x81,0x18,0xFF,0xC1,0x20,0xFF,0xE1,0x28,0xFF,0xC1,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x10,0xFF,0x04,0x52,0xFF,0x68,0x8B,0xFF,0x09,0xAC,0xFF,0xA9,0xBC,0xFF,0x89,0xBC,0xFF,0xA9,0xC4,0xFF,0x89,0xC4,0xFF,0x88,0xC4,0xFF,0xA9,0xC4,0xFF,0x2B,0xD5,0xFF,0xEA,0xCC,0xFF,0xCB,0xC4,0xFF,0xCC,0xBC,0xFF,0xCA,0x9B,0xFF,0x84,0x41,0xFF,0x61,0x10,0xFF,0x4B,0xA4,0xFF,
-    0x28,0xAC,0xFF,0x23,0x93,0xFF,0xE6,0xAB,0xFF,0x88,0xBC,0xFF,0xE6,0xB3,0xFF,0x47,0xBC,0xFF,0xA8,0xC4,0xFF,0x67,0xBC,0xFF,0xA8,0xBC,0xFF,0xC8,0xCC,0xFF,0xE9,0xCC,0xFF,0x0A,0xCD,0xFF,0x2C,0xCD,0xFF,0x4C,0xA4,0xFF,0xA5,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x60,0x10,0xFF,0x81,0x18,0xFF,0x81,0x10,0xFF,
-    0x20,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x81,0x18,0xFF,0x83,0x49,0xFF,0x45,0x6A,0xFF,0xC6,0x7A,0xFF,0x47,0x8B,0xFF,0xC8,0x9B,0xFF,0xC8,0x9B,0xFF,0xE8,0xA3,0xFF,0x6A,0xAC,0xFF,0x8B,0xB4,0xFF,0x09,0xA4,0xFF,0x07,0x83,0xFF,0x65,0x62,0xFF,0x43,0x39,0xFF,0x00,0x00,0xFF,0x87,0x5A,0xFF,0x6A,0xB4,0xFF,0x06,0xB4,0xFF,0x68,0xBC,0xFF,0x27,0xB4,0xFF,0x64,0xA3,0xFF,0xC5,0xAB,0xFF,0x47,0xB4,0xFF,0xE9,0xCC,0xFF,0x6A,0xD5,0xFF,0x49,0xD5,0xFF,0x29,0xCD,0xFF,0xAC,0xDD,0xFF,0x4A,0xD5,0xFF,0x8B,0xDD,0xFF,0x8A,0xBC,0xFF,0xA7,0x62,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x81,0x18,0xFF,0x22,0x39,0xFF,0x83,0x49,0xFF,0x86,0x62,0xFF,0xA6,0x6A,0xFF,0xA6,0x72,0xFF,0x24,0x62,0xFF,0x63,0x49,0xFF,0x01,0x31,0xFF,0x80,0x20,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x46,0x52,0xFF,0xAB,0xBC,0xFF,0x47,0xBC,0xFF,0x67,0xBC,0xFF,0xA9,0xC4,0xFF,0x27,0xB4,0xFF,0x0A,0xCD,0xFF,0xA8,0xC4,0xFF,0x67,0xBC,0xFF,0x87,0xBC,0xFF,0xC7,0xC4,0xFF,0x29,0xCD,0xFF,0x8B,0xD5,0xFF,0x29,0xCD,0xFF,0x4A,0xD5,0xFF,0xEC,0xC4,0xFF,0xA7,0x6A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x81,0x18,0xFF,0x81,0x18,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x83,0xFF,0x8A,0xBC,0xFF,0x47,0xBC,0xFF,0x26,0xB4,0xFF,0x06,0xAC,0xFF,0x2A,0xCD,0xFF,0xE9,0xC4,0xFF,0x26,0xB4,0xFF,0xA7,0xBC,0xFF,0x6A,0xD5,0xFF,0xAC,0xDD,0xFF,0xA7,0xC4,0xFF,0xC8,0xC4,0xFF,0x4C,0xD5,0xFF,0x8C,0xB4,0xFF,0x64,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x39,0xFF,
-    0x07,0x7B,0xFF,0x08,0xA4,0xFF,0x48,0xB4,0xFF,0x68,0xB4,0xFF,0x4B,0xCD,0xFF,0x88,0xB4,0xFF,0xA8,0xBC,0xFF,0xC8,0xBC,0xFF,0x88,0xBC,0xFF,0x68,0xB4,0xFF,0x2B,0xCD,0xFF,0x4D,0xCD,0xFF,0x4B,0xAC,0xFF,0xC7,0x72,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x02,0x31,0xFF,0x24,0x5A,0xFF,0xC6,0x72,0xFF,0x47,0x8B,0xFF,0xA8,0x93,0xFF,0x29,0xAC,0xFF,0x8B,0xB4,0xFF,0x4A,0xAC,0xFF,0x4A,0xAC,0xFF,0x2A,0xA4,0xFF,0x0A,0x9C,0xFF,0x28,0x83,0xFF,0x05,0x52,0xFF,0x00,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x10,0xFF,0x22,0x31,0xFF,0xC3,0x49,0xFF,0x45,0x62,0xFF,0x85,0x6A,0xFF,0x85,0x6A,0xFF,0x86,0x6A,0xFF,0x86,0x6A,0xFF,0x25,0x5A,0xFF,0xC4,0x49,0xFF,0xA1,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x10,0xFF,0x60,0x10,0xFF,0x60,0x10,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    
-};
-const lv_img_dsc_t ui_img_bautesouro_png = {
-    .header.always_zero = 0,
-    .header.w = 240,
-    .header.h = 224,
-    .data_size = sizeof(ui_img_bautesouro_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_bautesouro_png_data
-};
-
@@ -29,7 +29,7 @@ void ui_Screen1_screen_init(void)
     lv_obj_set_style_bg_opa(ui_Olho, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Image1 = lv_img_create(ui_Screen1);
-    lv_img_set_src(ui_Image1, &ui_img_bautesouro_png);
+    lv_img_set_src(ui_Image1, ui_asset_img("BauTesouro"));
     lv_obj_set_width(ui_Image1, LV_SIZE_CONTENT);   /// 240
     lv_obj_set_height(ui_Image1, LV_SIZE_CONTENT);    /// 240
     lv_obj_set_align(ui_Image1, LV_ALIGN_CENTER);
@@ -37,7 +37,9 @@ extern "C" {
 extern lv_obj_t * ui____initial_actions0;
 
 // IMAGES AND IMAGE SETS
-LV_IMG_DECLARE(ui_img_bautesouro_png);    // assets/BauTesouro.png
+// Imagens vêm do AssetRegistry (src/display/LvglAssetDecoder.h), não de
+// arrays ui_img_*.c: a arte não é duplicada na flash
+const lv_img_dsc_t * ui_asset_img(const char * name);    // "BauTesouro" = assets/BauTesouro.png
 
 // UI INIT
 void ui_init(void);
@@ -0,0 +1,126 @@
+/**
+ * Arduino mínimo para os testes nativos (pio test -e native)
+ *
+ * Só o que os cabeçalhos de src/display testados no host usam: String,
+ * Print/Stream, Serial (stdout), millis()/micros() e os utilitários de
+ * <Arduino.h>.
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define memcpy_P memcpy
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+
+inline unsigned long micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() {
+  return micros() / 1000;
+}
+
+class String : public std::string {
+public:
+  String() {}
+  String(const char* s) : std::string(s ? s : "") {}
+  String(const std::string& s) : std::string(s) {}
+  String(int value) : std::string(std::to_string(value)) {}
+  String(unsigned int value) : std::string(std::to_string(value)) {}
+  String(long value) : std::string(std::to_string(value)) {}
+  String(unsigned long value) : std::string(std::to_string(value)) {}
+
+  unsigned int length() const { return size(); }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t pos = find(c, from);
+    return pos == npos ? -1 : (int)pos;
+  }
+
+  int indexOf(const char* s, unsigned int from = 0) const {
+    size_t pos = find(s, from);
+    return pos == npos ? -1 : (int)pos;
+  }
+
+  // Como no Arduino: right além do fim (ou -1) vai até o fim
+  String substring(unsigned int left, unsigned int right = UINT32_MAX) const {
+    if (left > right) std::swap(left, right);
+    if (left >= size()) return String();
+    return String(substr(left, std::min<size_t>(right, size()) - left));
+  }
+
+  long toInt() const { return strtol(c_str(), NULL, 10); }
+  bool startsWith(const char* prefix) const { return compare(0, strlen(prefix), prefix) == 0; }
+
+  void trim() {
+    size_t begin = find_first_not_of(" \t\r\n");
+    if (begin == npos) {
+      clear();
+      return;
+    }
+    assign(substr(begin, find_last_not_of(" \t\r\n") - begin + 1));
+  }
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t println(const char* s = "") { return print(s) + print("\n"); }
+  size_t println(const String& s) { return println(s.c_str()); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    return write((const uint8_t*)buffer, min<size_t>(len, sizeof(buffer) - 1));
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+};
+
+/**
+ * Serial: saída do teste (stdout)
+ */
+class HostSerial : public Print {
+public:
+  using Print::write;
+  size_t write(const uint8_t* buffer, size_t size) override {
+    return fwrite(buffer, 1, size, stdout);
+  }
+};
+
+static HostSerial Serial;
+
+#endif // NATIVE_ARDUINO_H
@@ -0,0 +1,111 @@
+/**
+ * Sistema de arquivos em RAM para os testes nativos
+ *
+ * Mesma API de fs::FS/File usada por TagStoreFile. Os arquivos ficam no
+ * objeto FS: um TagStore novo sobre o mesmo FS simula o reboot. writes e
+ * bytesWritten contam as gravações (o que iria para a flash).
+ */
+
+#ifndef NATIVE_FS_H
+#define NATIVE_FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace fs {
+
+typedef std::vector<uint8_t> FileData;
+
+struct FSCounters {
+  uint32_t writes = 0;
+  uint64_t bytesWritten = 0;
+};
+
+class File {
+public:
+  File() {}
+  File(std::shared_ptr<FileData> d, FSCounters* c, size_t start) : data(d), counters(c), pos(start) {}
+
+  explicit operator bool() const { return (bool)data; }
+  void close() { data.reset(); }
+  void flush() {}
+
+  size_t size() const { return data ? data->size() : 0; }
+  size_t position() const { return pos; }
+  int available() const { return data && pos < data->size() ? data->size() - pos : 0; }
+
+  bool seek(size_t offset) {
+    if (!data) return false;
+    pos = offset;
+    return true;
+  }
+
+  size_t read(uint8_t* buffer, size_t len) {
+    len = min<size_t>(len, available());
+    if (len) memcpy(buffer, data->data() + pos, len);
+    pos += len;
+    return len;
+  }
+
+  int read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+
+  String readStringUntil(char terminator) {
+    String line;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) line += (char)c;
+    return line;
+  }
+
+  size_t write(const uint8_t* buffer, size_t len) {
+    if (!data) return 0;
+    if (data->size() < pos + len) data->resize(pos + len);  // seek além do fim preenche com zeros
+    memcpy(data->data() + pos, buffer, len);
+    pos += len;
+    counters->writes++;
+    counters->bytesWritten += len;
+    return len;
+  }
+
+private:
+  std::shared_ptr<FileData> data;
+  FSCounters* counters = NULL;
+  size_t pos = 0;
+};
+
+class FS {
+public:
+  FSCounters counters;
+
+  /** Modos "r", "r+", "w" e "a" */
+  File open(const char* path, const char* mode = "r") {
+    auto it = files.find(path);
+    if (mode[0] == 'w') {
+      auto data = std::make_shared<FileData>();
+      files[path] = data;
+      return File(data, &counters, 0);
+    }
+    if (it == files.end()) {
+      if (mode[0] != 'a') return File();
+      it = files.emplace(path, std::make_shared<FileData>()).first;
+    }
+    return File(it->second, &counters, mode[0] == 'a' ? it->second->size() : 0);
+  }
+
+  bool exists(const char* path) { return files.count(path) != 0; }
+  bool remove(const char* path) { return files.erase(path) != 0; }
+  void format() { files.clear(); }
+
+private:
+  std::map<std::string, std::shared_ptr<FileData> > files;
+};
+
+}  // namespace fs
+
+using fs::File;
+
+#endif // NATIVE_FS_H
@@ -0,0 +1,120 @@
+/**
+ * NVS (Preferences) em RAM para os testes nativos
+ *
+ * Mesma API de Preferences usada por TagStoreNVS. Os namespaces ficam em
+ * nativeNVS(): um Preferences novo sobre o mesmo namespace simula o
+ * reboot, e nativeNVS().clear() apaga a partição. Como na NVS real, cada
+ * chave tem um tipo (ler um blob como inteiro devolve o padrão), chaves
+ * têm até 15 caracteres e getBytes() falha se o buffer for menor que o
+ * blob. nativeNVSWrites() conta put*() e remove() (o que iria para a
+ * flash).
+ */
+
+#ifndef NATIVE_PREFERENCES_H
+#define NATIVE_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+struct NativeNVSEntry {
+  char type;                    // 'u' uint32, 'c' uint8, 'i' int32, 's' string, 'b' blob
+  std::vector<uint8_t> bytes;
+};
+
+typedef std::map<std::string, NativeNVSEntry> NativeNVSNamespace;
+
+inline std::map<std::string, NativeNVSNamespace>& nativeNVS() {
+  static std::map<std::string, NativeNVSNamespace> partition;
+  return partition;
+}
+
+inline uint32_t& nativeNVSWrites() {
+  static uint32_t writes = 0;
+  return writes;
+}
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false, const char* = NULL) {
+    if (strlen(name) > 15) return false;
+    if (readOnly && !nativeNVS().count(name)) return false;
+    space = &nativeNVS()[name];
+    this->readOnly = readOnly;
+    return true;
+  }
+
+  void end() { space = NULL; }
+
+  bool clear() {
+    if (!writable()) return false;
+    space->clear();
+    nativeNVSWrites()++;
+    return true;
+  }
+
+  bool isKey(const char* key) { return space && space->count(key) != 0; }
+
+  bool remove(const char* key) {
+    if (!writable() || !space->erase(key)) return false;
+    nativeNVSWrites()++;
+    return true;
+  }
+
+  size_t putUChar(const char* key, uint8_t value) { return put(key, 'c', &value, sizeof(value)); }
+  size_t putUInt(const char* key, uint32_t value) { return put(key, 'u', &value, sizeof(value)); }
+  size_t putInt(const char* key, int32_t value) { return put(key, 'i', &value, sizeof(value)); }
+  size_t putString(const char* key, const String& value) {
+    return put(key, 's', value.c_str(), value.length() + 1);
+  }
+
+  size_t putBytes(const char* key, const void* value, size_t len) {
+    if (!value || len == 0) return 0;
+    return put(key, 'b', value, len);
+  }
+
+  uint8_t getUChar(const char* key, uint8_t value = 0) { get(key, 'c', &value, sizeof(value)); return value; }
+  uint32_t getUInt(const char* key, uint32_t value = 0) { get(key, 'u', &value, sizeof(value)); return value; }
+  int32_t getInt(const char* key, int32_t value = 0) { get(key, 'i', &value, sizeof(value)); return value; }
+
+  String getString(const char* key, const String& value = String()) {
+    const NativeNVSEntry* entry = find(key, 's');
+    return entry ? String((const char*)entry->bytes.data()) : value;
+  }
+
+  size_t getBytes(const char* key, void* buf, size_t maxLen) {
+    const NativeNVSEntry* entry = find(key, 'b');
+    if (!entry || !buf || entry->bytes.size() > maxLen) return 0;
+    memcpy(buf, entry->bytes.data(), entry->bytes.size());
+    return entry->bytes.size();
+  }
+
+private:
+  NativeNVSNamespace* space = NULL;
+  bool readOnly = false;
+
+  bool writable() const { return space && !readOnly; }
+
+  size_t put(const char* key, char type, const void* value, size_t len) {
+    if (!writable() || strlen(key) > 15) return 0;
+    NativeNVSEntry& entry = (*space)[key];
+    entry.type = type;
+    entry.bytes.assign((const uint8_t*)value, (const uint8_t*)value + len);
+    nativeNVSWrites()++;
+    return len;
+  }
+
+  const NativeNVSEntry* find(const char* key, char type) const {
+    if (!space) return NULL;
+    NativeNVSNamespace::const_iterator it = space->find(key);
+    return it != space->end() && it->second.type == type ? &it->second : NULL;
+  }
+
+  void get(const char* key, char type, void* value, size_t len) const {
+    const NativeNVSEntry* entry = find(key, type);
+    if (entry) memcpy(value, entry->bytes.data(), len);
+  }
+};
+
+#endif // NATIVE_PREFERENCES_H
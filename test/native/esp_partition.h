@@ -0,0 +1,66 @@
+/**
+ * Tabela de partições em RAM para os testes nativos
+ *
+ * O teste registra partições com nativePartitions().push_back(...);
+ * esp_partition_mmap devolve um ponteiro direto para os bytes dela.
+ */
+
+#ifndef NATIVE_ESP_PARTITION_H
+#define NATIVE_ESP_PARTITION_H
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef enum { ESP_PARTITION_TYPE_APP = 0, ESP_PARTITION_TYPE_DATA = 1 } esp_partition_type_t;
+typedef int esp_partition_subtype_t;
+typedef enum { ESP_PARTITION_MMAP_DATA, ESP_PARTITION_MMAP_INST } esp_partition_mmap_memory_t;
+typedef uint32_t spi_flash_mmap_handle_t;
+
+struct esp_partition_t {
+  esp_partition_type_t type;
+  esp_partition_subtype_t subtype;
+  uint32_t address;
+  uint32_t size;
+  char label[17];
+  std::vector<uint8_t> data;
+};
+
+inline std::vector<esp_partition_t>& nativePartitions() {
+  static std::vector<esp_partition_t> partitions;
+  return partitions;
+}
+
+inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t type,
+                                                       esp_partition_subtype_t subtype,
+                                                       const char* label) {
+  for (const esp_partition_t& p : nativePartitions()) {
+    if (p.type == type && p.subtype == subtype && (label == NULL || strcmp(p.label, label) == 0)) {
+      return &p;
+    }
+  }
+  return NULL;
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t* p, size_t offset, void* dst, size_t size) {
+  if (offset + size > p->data.size()) return ESP_FAIL;
+  memcpy(dst, p->data.data() + offset, size);
+  return ESP_OK;
+}
+
+inline esp_err_t esp_partition_mmap(const esp_partition_t* p, size_t offset, size_t size,
+                                    esp_partition_mmap_memory_t, const void** out,
+                                    spi_flash_mmap_handle_t* handle) {
+  if (offset + size > p->data.size()) return ESP_FAIL;
+  *out = p->data.data() + offset;
+  *handle = 1;
+  return ESP_OK;
+}
+
+inline void spi_flash_munmap(spi_flash_mmap_handle_t) {}
+
+#endif // NATIVE_ESP_PARTITION_H
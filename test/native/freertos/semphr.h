@@ -0,0 +1,31 @@
+/**
+ * Mutex recursivo do FreeRTOS sobre std::recursive_mutex (testes nativos)
+ */
+
+#ifndef NATIVE_SEMPHR_H
+#define NATIVE_SEMPHR_H
+
+#include <mutex>
+#include "FreeRTOS.h"
+
+typedef std::recursive_mutex* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+  return new std::recursive_mutex();
+}
+
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t mutex, TickType_t) {
+  mutex->lock();
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t mutex) {
+  mutex->unlock();
+  return pdTRUE;
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t mutex) {
+  delete mutex;
+}
+
+#endif // NATIVE_SEMPHR_H
@@ -0,0 +1,279 @@
+/**
+ * Validação do bundle da partição assets (pio test -e native)
+ *
+ * Bundles montados aqui no formato de scripts/build_assets.py --bundle e
+ * gravados numa partição em RAM (test/native/esp_partition.h). Um bundle
+ * com qualquer leitura fora dele (paleta curta, linha Q565 fora ou
+ * truncada, tamanho que estoura 32 bits) deve ser rejeitado no begin().
+ *
+ * As imagens compiladas (generated/, geradas pelo extra_script do env) são
+ * decodificadas linha a linha e comparadas com os pixels crus de
+ * generated/assets_reference.h; o teste de tempo imprime a razão de
+ * compressão e o custo por linha ao lado do tempo da linha no SPI.
+ */
+
+#include <unity.h>
+#include <vector>
+#include "AssetBundle.h"
+#include "generated/assets_index.h"
+#include "generated/assets_reference.h"
+
+// Clock SPI do ILI9341 no CYD (SPI_FREQUENCY do display-cyd)
+#define SPI_BUDGET_MHZ 55
+
+/**
+ * Monta um bundle: cabeçalho, diretório de count entradas e blobs
+ */
+class BundleBuilder {
+public:
+  explicit BundleBuilder(uint16_t count) : count(count) {}
+
+  /** Acrescenta um blob alinhado em 4; retorna o offset no bundle */
+  uint32_t blob(const void* data, size_t len) {
+    uint32_t offset = 16 + 40 * count + blobs.size();
+    blobs.insert(blobs.end(), (const uint8_t*)data, (const uint8_t*)data + len);
+    while (blobs.size() % 4) blobs.push_back(0);
+    return offset;
+  }
+
+  /** Acrescenta sem alinhar o fim (blob truncado no fim do bundle) */
+  uint32_t tail(const void* data, size_t len) {
+    uint32_t offset = 16 + 40 * count + blobs.size();
+    blobs.insert(blobs.end(), (const uint8_t*)data, (const uint8_t*)data + len);
+    return offset;
+  }
+
+  void entry(const char* name, uint16_t width, uint16_t height, uint8_t format,
+             uint32_t data, uint32_t aux) {
+    uint8_t e[40] = {};
+    strncpy((char*)e, name, 24);
+    put16(e + 24, width);
+    put16(e + 26, height);
+    e[28] = format;
+    put32(e + 32, data);
+    put32(e + 36, aux);
+    directory.insert(directory.end(), e, e + sizeof(e));
+  }
+
+  /** Grava o bundle na partição "assets" (substitui a anterior) */
+  void install() {
+    std::vector<uint8_t> body = directory;
+    body.insert(body.end(), blobs.begin(), blobs.end());
+    uint8_t header[16] = { 'C', 'Y', 'D', 'A' };
+    put16(header + 4, ASSET_BUNDLE_VERSION);
+    put16(header + 6, count);
+    put32(header + 8, body.size());
+    put32(header + 12, esp_rom_crc32_le(0, body.data(), body.size()));
+
+    esp_partition_t partition = {};
+    partition.type = ESP_PARTITION_TYPE_DATA;
+    partition.subtype = ASSET_PARTITION_SUBTYPE;
+    strcpy(partition.label, "assets");
+    partition.data.assign(header, header + sizeof(header));
+    partition.data.insert(partition.data.end(), body.begin(), body.end());
+    partition.size = partition.data.size();
+    nativePartitions().clear();
+    nativePartitions().push_back(partition);
+  }
+
+private:
+  uint16_t count;
+  std::vector<uint8_t> directory;
+  std::vector<uint8_t> blobs;
+
+  static void put16(uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+  static void put32(uint8_t* p, uint32_t v) { put16(p, v); put16(p + 2, v >> 16); }
+};
+
+// Q565 4x2: linha 0 = COR F800 + RUN de 3; linha 1 = COR 001F + 3 x DIFF(0,0,0)
+static const uint8_t Q565_PIXELS[] = { 0xFE, 0xF8, 0x00, 0xC2, 0xFE, 0x00, 0x1F, 0x6A, 0x6A, 0x6A };
+static const uint32_t Q565_ROWS[] = { 0, 4 };
+
+static uint16_t palette[256];
+
+void setUp() {
+  palette[0] = 0x1234;
+  palette[255] = 0xABCD;
+}
+
+void tearDown() {}
+
+void test_valid_bundle_loads_and_decodes() {
+  BundleBuilder builder(3);
+  uint32_t q565 = builder.blob(Q565_PIXELS, sizeof(Q565_PIXELS));
+  uint32_t rows = builder.blob(Q565_ROWS, sizeof(Q565_ROWS));
+  const uint8_t indices[] = { 0, 255 };
+  uint32_t pal8 = builder.blob(indices, sizeof(indices));
+  uint32_t pal = builder.blob(palette, sizeof(palette));
+  const uint16_t color = 0x5AA5;
+  uint32_t rgb = builder.blob(&color, sizeof(color));
+  builder.entry("Q", 4, 2, ASSET_Q565, q565, rows);
+  builder.entry("P", 2, 1, ASSET_PALETTE8, pal8, pal);
+  builder.entry("R", 1, 1, ASSET_RGB565, rgb, 0);
+  builder.install();
+
+  AssetBundle bundle;
+  TEST_ASSERT_TRUE(bundle.begin());
+  TEST_ASSERT_EQUAL_UINT16(3, bundle.count());
+
+  ImageAsset asset;
+  uint16_t out[8];
+  TEST_ASSERT_TRUE(bundle.find("Q", asset));
+  decodeImageRows(asset, 0, 2, out);
+  for (int i = 0; i < 4; i++) TEST_ASSERT_EQUAL_HEX16(0x00F8, out[i]);
+  for (int i = 4; i < 8; i++) TEST_ASSERT_EQUAL_HEX16(0x1F00, out[i]);
+
+  TEST_ASSERT_TRUE(bundle.find("P", asset));
+  decodeImageRows(asset, 0, 1, out);
+  TEST_ASSERT_EQUAL_HEX16(0x1234, out[0]);
+  TEST_ASSERT_EQUAL_HEX16(0xABCD, out[1]);
+
+  TEST_ASSERT_TRUE(bundle.find("R", asset));
+  TEST_ASSERT_FALSE(bundle.find("X", asset));
+  bundle.end();
+}
+
+void test_rejects_short_palette() {
+  BundleBuilder builder(1);
+  const uint8_t indices[] = { 0, 255 };
+  uint32_t pal8 = builder.blob(indices, sizeof(indices));
+  uint32_t pal = builder.tail(palette, 2 * sizeof(uint16_t));   // só 2 cores no fim
+  builder.entry("P", 2, 1, ASSET_PALETTE8, pal8, pal);
+  builder.install();
+
+  AssetBundle bundle;
+  TEST_ASSERT_FALSE(bundle.begin());
+}
+
+void test_rejects_q565_row_outside_bundle() {
+  BundleBuilder builder(1);
+  uint32_t q565 = builder.blob(Q565_PIXELS, sizeof(Q565_PIXELS));
+  const uint32_t rows[] = { 0, 0x10000 };
+  uint32_t aux = builder.blob(rows, sizeof(rows));
+  builder.entry("Q", 4, 2, ASSET_Q565, q565, aux);
+  builder.install();
+
+  AssetBundle bundle;
+  TEST_ASSERT_FALSE(bundle.begin());
+}
+
+void test_rejects_truncated_q565_row() {
+  BundleBuilder builder(1);
+  uint32_t aux = builder.blob(Q565_ROWS, sizeof(Q565_ROWS));
+  // Linha 1 termina com COR sem os 2 bytes da cor, no fim do bundle
+  const uint8_t pixels[] = { 0xFE, 0xF8, 0x00, 0xC2, 0x6A, 0x6A, 0x6A, 0xFE, 0x00 };
+  uint32_t q565 = builder.tail(pixels, sizeof(pixels));
+  builder.entry("Q", 4, 2, ASSET_Q565, q565, aux);
+  builder.install();
+
+  AssetBundle bundle;
+  TEST_ASSERT_FALSE(bundle.begin());
+}
+
+void test_rejects_oversized_rgb565() {
+  BundleBuilder builder(1);
+  const uint16_t color = 0;
+  uint32_t rgb = builder.blob(&color, sizeof(color));
+  builder.entry("R", 0xFFFF, 0xFFFF, ASSET_RGB565, rgb, 0);   // 8 GB: estoura 32 bits
+  builder.install();
+
+  AssetBundle bundle;
+  TEST_ASSERT_FALSE(bundle.begin());
+}
+
+void test_rejects_bad_crc() {
+  BundleBuilder builder(1);
+  const uint16_t color = 0;
+  uint32_t rgb = builder.blob(&color, sizeof(color));
+  builder.entry("R", 1, 1, ASSET_RGB565, rgb, 0);
+  builder.install();
+  nativePartitions()[0].data.back() ^= 0xFF;
+
+  AssetBundle bundle;
+  TEST_ASSERT_FALSE(bundle.begin());
+}
+
+static const char* formatName(uint8_t format) {
+  return format == ASSET_Q565 ? "q565" : format == ASSET_PALETTE8 ? "palette" : "rgb565";
+}
+
+/** Bytes de flash da imagem (dados + índice de linhas ou paleta usada) */
+static uint32_t encodedBytes(const ImageAsset& asset) {
+  uint32_t pixels = (uint32_t)asset.width * asset.height;
+  if (asset.format == ASSET_Q565) {
+    uint32_t last = asset.rows[asset.height - 1];
+    return last + Q565Decoder::rowLength((const uint8_t*)asset.pixels + last, UINT32_MAX, asset.width) +
+           4 * asset.height;
+  }
+  if (asset.format == ASSET_PALETTE8) {
+    uint32_t colors = 0;
+    for (uint32_t i = 0; i < pixels; i++) colors = max(colors, ((const uint8_t*)asset.pixels)[i] + 1u);
+    return pixels + 2 * colors;
+  }
+  return 2 * pixels;
+}
+
+void test_builtin_assets_match_reference() {
+  std::vector<uint16_t> band(IMAGE_MAX_WIDTH * IMAGE_BAND_LINES);
+  char message[64];
+  for (int i = 0; i < BUILTIN_ASSET_COUNT; i++) {
+    const ImageAsset& asset = *builtinAssets[i].asset;
+    const uint16_t* reference = builtinAssetReference[i];
+    TEST_ASSERT_LESS_OR_EQUAL(IMAGE_MAX_WIDTH, asset.width);
+
+    // Linha a linha (decodeRow), como o índice permite
+    for (uint16_t y = 0; asset.format == ASSET_Q565 && y < asset.height; y++) {
+      Q565Decoder::decodeRow((const uint8_t*)asset.pixels + asset.rows[y], asset.width, band.data());
+      snprintf(message, sizeof(message), "%s linha %u", builtinAssets[i].name, y);
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE(reference + y * asset.width, band.data(), asset.width * 2, message);
+    }
+
+    // Em faixas, como drawImageAsset()
+    for (uint16_t row = 0; row < asset.height; row += IMAGE_BAND_LINES) {
+      uint16_t lines = min(IMAGE_BAND_LINES, asset.height - row);
+      decodeImageRows(asset, row, lines, band.data());
+      snprintf(message, sizeof(message), "%s faixa %u", builtinAssets[i].name, row);
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE(reference + row * asset.width, band.data(),
+                                       asset.width * lines * 2, message);
+    }
+  }
+}
+
+/**
+ * Custo de decodificação por linha (no PC: serve para comparar formatos e
+ * versões do decodificador; o tempo no ESP32 sai no log de drawRewardImage)
+ */
+void test_builtin_assets_decode_time() {
+  const int passes = 20;
+  std::vector<uint16_t> band(IMAGE_MAX_WIDTH * IMAGE_BAND_LINES);
+  char message[160];
+  for (int i = 0; i < BUILTIN_ASSET_COUNT; i++) {
+    const ImageAsset& asset = *builtinAssets[i].asset;
+    uint32_t start = micros();
+    for (int pass = 0; pass < passes; pass++) {
+      for (uint16_t row = 0; row < asset.height; row += IMAGE_BAND_LINES) {
+        decodeImageRows(asset, row, min(IMAGE_BAND_LINES, asset.height - row), band.data());
+      }
+    }
+    float perRow = (float)(micros() - start) / (passes * asset.height);
+    float spiRow = asset.width * 16.0f / SPI_BUDGET_MHZ;
+    snprintf(message, sizeof(message), "%s %ux%u %s: %.2fx menor que rgb565, %.2f us/linha "
+             "(SPI %d MHz: %.1f us/linha)", builtinAssets[i].name, asset.width, asset.height,
+             formatName(asset.format), 2.0f * asset.width * asset.height / encodedBytes(asset),
+             perRow, SPI_BUDGET_MHZ, spiRow);
+    TEST_MESSAGE(message);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_valid_bundle_loads_and_decodes);
+  RUN_TEST(test_rejects_short_palette);
+  RUN_TEST(test_rejects_q565_row_outside_bundle);
+  RUN_TEST(test_rejects_truncated_q565_row);
+  RUN_TEST(test_rejects_oversized_rgb565);
+  RUN_TEST(test_rejects_bad_crc);
+  RUN_TEST(test_builtin_assets_match_reference);
+  RUN_TEST(test_builtin_assets_decode_time);
+  return UNITY_END();
+}
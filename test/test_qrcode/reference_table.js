@@ -0,0 +1,105 @@
+/**
+ * Tabela REFERENCES do test_main.cpp a partir de um codificador independente
+ *
+ *   npm install qrcode-terminal
+ *   node test/test_qrcode/reference_table.js
+ *
+ * QRCode.js (Kazuhiko Arase, vendorizado no qrcode-terminal) monta a matriz
+ * de cada máscara; a escolha da máscara usa a pontuação da ISO abaixo,
+ * porque a do QRCode.js não segue a norma.
+ */
+const QRCode = require('qrcode-terminal/vendor/QRCode');
+const QRRSBlock = require('qrcode-terminal/vendor/QRCode/QRRSBlock');
+// 15-H no QRCode.js está incompleto ([11, 36, 12]); ISO/IEC 18004 tabela 9
+QRRSBlock.RS_BLOCK_TABLE[(15 - 1) * 4 + 3] = [11, 36, 12, 7, 37, 13];
+const ECL = [1, 0, 3, 2];   // L, M, Q, H na numeração do QRCode.js
+const URL_BASE = 'https://rfid.local/tag/';
+const ALPHABET = 'abcdefghijklmnopqrstuvwxyz0123456789';
+
+function text(version, ecc, len) {
+  let s = URL_BASE;
+  for (let i = 0; s.length < len; i++) s += ALPHABET[(i * 7 + version * 13 + ecc * 5) % 36];
+  return s.substring(0, len);
+}
+
+function build(version, ecc, data, mask) {
+  const q = new QRCode(version, ECL[ecc]);
+  q.addData(data);
+  q.makeImpl(false, mask);
+  return q;
+}
+
+function capacity(version, ecc) {
+  let len = 1;
+  for (;;) {
+    try { build(version, ecc, 'x'.repeat(len + 1), 0); } catch (e) { return len; }
+    len++;
+  }
+}
+
+// Pontuação da ISO/IEC 18004 (7.8.3), escrita à parte do QrCode.h
+function penalty(q, size) {
+  const dark = (x, y) => q.isDark(y, x);
+  let score = 0;
+  for (let pass = 0; pass < 2; pass++) {
+    for (let a = 0; a < size; a++) {
+      const line = [];
+      for (let b = 0; b < size; b++) line.push(pass === 0 ? dark(b, a) : dark(a, b));
+      const runs = [];           // [escuro, tamanho]
+      for (const c of line) {
+        if (runs.length && runs[runs.length - 1][0] === c) runs[runs.length - 1][1]++;
+        else runs.push([c, 1]);
+      }
+      for (const [, n] of runs) if (n >= 5) score += 3 + n - 5;
+      const all = [[false, Infinity], ...runs, [false, Infinity]];
+      // Corridas claras nas bordas continuam na margem
+      if (!runs[0][0]) all.splice(0, 2, [false, Infinity]);
+      if (!runs[runs.length - 1][0]) all.splice(all.length - 2, 2, [false, Infinity]);
+      for (let i = 1; i + 4 < all.length - 1; i++) {
+        const n = all[i][1];
+        if (!all[i][0]) continue;
+        if (all[i + 1][1] !== n || all[i + 2][1] !== 3 * n || all[i + 3][1] !== n || all[i + 4][1] !== n) continue;
+        const before = all[i - 1][1], after = all[i + 5][1];
+        if (before >= 4 * n && after >= n) score += 40;
+        if (after >= 4 * n && before >= n) score += 40;
+      }
+    }
+  }
+  let darkCount = 0;
+  for (let y = 0; y < size; y++) {
+    for (let x = 0; x < size; x++) {
+      const c = dark(x, y);
+      if (c) darkCount++;
+      if (x + 1 < size && y + 1 < size && c === dark(x + 1, y) && c === dark(x, y + 1) && c === dark(x + 1, y + 1)) score += 3;
+    }
+  }
+  const total = size * size;
+  score += (Math.ceil(Math.abs(darkCount * 20 - total * 10) / total) - 1) * 10;
+  return score;
+}
+
+function fnv1a(q, size) {
+  let h = 0x811c9dc5;
+  for (let y = 0; y < size; y++) {
+    for (let x = 0; x < size; x++) {
+      h ^= q.isDark(y, x) ? 1 : 0;
+      h = Math.imul(h, 0x01000193) >>> 0;
+    }
+  }
+  return h >>> 0;
+}
+
+for (let version = 1; version <= 16; version++) {
+  for (let ecc = 0; ecc < 4; ecc++) {
+    const len = capacity(version, ecc);
+    const data = text(version, ecc, len);
+    const size = version * 4 + 17;
+    let best = 0, bestScore = Infinity, hash = 0;
+    for (let mask = 0; mask < 8; mask++) {
+      const q = build(version, ecc, data, mask);
+      const s = penalty(q, size);
+      if (s < bestScore) { bestScore = s; best = mask; hash = fnv1a(q, size); }
+    }
+    console.log(`  { ${String(version).padStart(2)}, ${'LMQH'[ecc]}, ${String(len).padStart(3)}, ${best}, 0x${hash.toString(16).padStart(8, '0').toUpperCase()} },`);
+  }
+}
@@ -0,0 +1,173 @@
+/**
+ * Codificador QR (QrCode.h) contra um codificador de referência
+ * (pio test -e native)
+ *
+ * Um texto fixo por versão 1 a 16 e nível de correção, do tamanho exato da
+ * capacidade em modo byte (não sobe de versão nem de correção). Versão,
+ * máscara e o hash FNV-1a da matriz (um byte 0/1 por módulo, linha a
+ * linha) vêm de test/test_qrcode/reference_table.js, que monta as 8
+ * máscaras no QRCode.js de Kazuhiko Arase e escolhe a de menor penalidade
+ * da ISO/IEC 18004 com uma pontuação própria. Regenerar só se o texto dos
+ * casos mudar.
+ */
+
+#include <unity.h>
+#include <string>
+#include "QrCode.h"
+
+struct Reference {
+  uint8_t version;
+  QrEcc ecc;
+  uint16_t length;
+  uint8_t mask;
+  uint32_t hash;
+};
+
+#define L QR_ECC_LOW
+#define M QR_ECC_MEDIUM
+#define Q QR_ECC_QUARTILE
+#define H QR_ECC_HIGH
+
+// node test/test_qrcode/reference_table.js
+static const Reference REFERENCES[] = {
+  {  1, L,  17, 1, 0xF8D0A303 },
+  {  1, M,  14, 2, 0x4CA7B443 },
+  {  1, Q,  11, 7, 0x07D3288F },
+  {  1, H,   7, 0, 0x2DAC10A3 },
+  {  2, L,  32, 1, 0x04BDF815 },
+  {  2, M,  26, 6, 0xE0AAA1E9 },
+  {  2, Q,  20, 5, 0xD7591382 },
+  {  2, H,  14, 2, 0xD7D3DF21 },
+  {  3, L,  53, 2, 0x292F60D0 },
+  {  3, M,  42, 5, 0xDBBBA332 },
+  {  3, Q,  32, 0, 0x9625100B },
+  {  3, H,  24, 3, 0x7F4D7E0F },
+  {  4, L,  78, 2, 0xB701D6A4 },
+  {  4, M,  62, 2, 0x66610B08 },
+  {  4, Q,  46, 2, 0x1361A81A },
+  {  4, H,  34, 2, 0x2C960D88 },
+  {  5, L, 106, 2, 0xF7985CC5 },
+  {  5, M,  84, 2, 0x35B7D53F },
+  {  5, Q,  60, 2, 0x59821B45 },
+  {  5, H,  44, 5, 0xD5F3F44E },
+  {  6, L, 134, 2, 0x2EC7B06A },
+  {  6, M, 106, 2, 0xFCC52CB6 },
+  {  6, Q,  74, 7, 0x884E8D31 },
+  {  6, H,  58, 2, 0x245DA99E },
+  {  7, L, 154, 2, 0x52FBC2DF },
+  {  7, M, 122, 2, 0x13F2BFCF },
+  {  7, Q,  86, 6, 0xC03EFA2B },
+  {  7, H,  64, 7, 0x69CFC223 },
+  {  8, L, 192, 4, 0x00071A31 },
+  {  8, M, 152, 2, 0x84E98EA3 },
+  {  8, Q, 108, 2, 0x2A5E9FC7 },
+  {  8, H,  84, 5, 0xEE2FCD30 },
+  {  9, L, 230, 2, 0x6FD51739 },
+  {  9, M, 180, 2, 0xDC5CF18D },
+  {  9, Q, 130, 2, 0x382D770D },
+  {  9, H,  98, 2, 0x98A908E7 },
+  { 10, L, 271, 2, 0xA8EBA169 },
+  { 10, M, 213, 2, 0x612D98ED },
+  { 10, Q, 151, 2, 0xF518CCF5 },
+  { 10, H, 119, 6, 0x313B750F },
+  { 11, L, 321, 2, 0x4A1BEEBB },
+  { 11, M, 251, 2, 0xDEAC5089 },
+  { 11, Q, 177, 2, 0xAE1D46AD },
+  { 11, H, 137, 6, 0xB05E1E49 },
+  { 12, L, 367, 2, 0xDCC86C15 },
+  { 12, M, 287, 2, 0xD1BF2639 },
+  { 12, Q, 203, 2, 0x87A2A111 },
+  { 12, H, 155, 2, 0x149FBCD5 },
+  { 13, L, 425, 2, 0xFA8FC7CD },
+  { 13, M, 331, 2, 0xA254F7D7 },
+  { 13, Q, 241, 2, 0x5B6FB697 },
+  { 13, H, 177, 2, 0x43CADE9B },
+  { 14, L, 458, 2, 0xA4018CDB },
+  { 14, M, 362, 2, 0x55676869 },
+  { 14, Q, 258, 2, 0xE8747767 },
+  { 14, H, 194, 2, 0x21B5E29B },
+  { 15, L, 520, 2, 0x594A5C71 },
+  { 15, M, 412, 2, 0x9ACD4BBF },
+  { 15, Q, 292, 2, 0x3EAE0C61 },
+  { 15, H, 220, 2, 0x204FDCB9 },
+  { 16, L, 586, 2, 0x2847EC3A },
+  { 16, M, 450, 2, 0xE5DA01A6 },
+  { 16, Q, 322, 2, 0xD425D6D2 },
+  { 16, H, 250, 2, 0x737CA26E },
+};
+
+#undef L
+#undef M
+#undef Q
+#undef H
+
+static QrEncoder encoder;
+static QrCode qr;
+
+// Mesmo texto do reference_table.js
+static std::string caseText(const Reference& ref) {
+  static const char ALPHABET[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+  std::string text = "https://rfid.local/tag/";
+  for (int i = 0; text.size() < ref.length; i++) text += ALPHABET[(i * 7 + ref.version * 13 + ref.ecc * 5) % 36];
+  return text.substr(0, ref.length);
+}
+
+static uint32_t matrixHash(const QrCode& code) {
+  uint32_t hash = 0x811C9DC5;
+  for (int y = 0; y < code.size; y++) {
+    for (int x = 0; x < code.size; x++) {
+      hash ^= code.get(x, y) ? 1 : 0;
+      hash *= 0x01000193;
+    }
+  }
+  return hash;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_matrices_match_reference() {
+  char message[32];
+  for (const Reference& ref : REFERENCES) {
+    std::string text = caseText(ref);
+    snprintf(message, sizeof(message), "versao %u ecc %u", ref.version, ref.ecc);
+    TEST_ASSERT_TRUE_MESSAGE(encoder.encode(text.c_str(), text.size(), qr, ref.ecc), message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(ref.version, qr.version, message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(ref.ecc, qr.ecc, message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(QR_SIZE_FOR(ref.version), qr.size, message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(ref.mask, qr.mask, message);
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE(ref.hash, matrixHash(qr), message);
+  }
+}
+
+void test_one_byte_more_moves_up() {
+  for (const Reference& ref : REFERENCES) {
+    if (ref.version == QR_MAX_VERSION) continue;
+    std::string text = caseText(ref) + "x";
+    TEST_ASSERT_TRUE(encoder.encode(text.c_str(), text.size(), qr, ref.ecc));
+    TEST_ASSERT_GREATER_THAN(ref.version, qr.version);
+  }
+}
+
+void test_ecc_boost_in_same_version() {
+  // 7 bytes cabem em 1-H: pedido médio sai com correção alta
+  TEST_ASSERT_TRUE(encoder.encode("https:/", 7, qr));
+  TEST_ASSERT_EQUAL_UINT8(1, qr.version);
+  TEST_ASSERT_EQUAL_UINT8(QR_ECC_HIGH, qr.ecc);
+}
+
+void test_too_long_fails() {
+  std::string text(451, 'x');   // 16-M leva até 450 bytes
+  TEST_ASSERT_FALSE(encoder.encode(text.c_str(), text.size(), qr));
+  TEST_ASSERT_TRUE(encoder.encode(text.c_str(), text.size(), qr, QR_ECC_LOW));
+  TEST_ASSERT_EQUAL_UINT8(14, qr.version);   // 14-L: 458 bytes
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_matrices_match_reference);
+  RUN_TEST(test_one_byte_more_moves_up);
+  RUN_TEST(test_ecc_boost_in_same_version);
+  RUN_TEST(test_too_long_fails);
+  return UNITY_END();
+}
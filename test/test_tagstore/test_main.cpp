@@ -0,0 +1,472 @@
+/**
+ * Conformidade e desempenho dos backends do TagStore (pio test -e native)
+ *
+ * A mesma suíte roda contra TagStoreRAM, TagStoreFile (sobre o FS em RAM
+ * de test/native/FS.h) e TagStoreNVS (sobre a NVS em RAM de
+ * test/native/Preferences.h). Backends persistentes também passam por
+ * reboot: um TagStore novo sobre o mesmo FS/NVS.
+ *
+ * O benchmark imprime ops/s e escritas na flash por inserção de cada
+ * backend (mesmos contadores do printStats() no display).
+ */
+
+#include <unity.h>
+
+// Compactação sem espera entre passos
+#define TAG_STORE_COMPACT_MS 0
+
+#include "TagStoreRAM.h"
+#include "TagStoreFile.h"
+#include "TagStoreNVS.h"
+
+#define BENCH_TAGS 2000
+
+/**
+ * TagStoreFile sobre o FS do host
+ */
+class TagStoreHostFS : public TagStoreFile {
+public:
+  explicit TagStoreHostFS(fs::FS& filesystem) : TagStoreFile(filesystem) {}
+
+  const char* name() const override { return "HostFS"; }
+
+protected:
+  bool mountFS() override { return true; }
+};
+
+static fs::FS hostFS;
+
+/**
+ * Cria (ou "reinicia") cada backend. persistent = false: o backend não
+ * sobrevive a reboot e reopen() não é usado.
+ */
+struct RamBackend {
+  static const bool persistent = false;
+  static TagStore* create() { return new TagStoreRAM(); }
+  static TagStore* reopen() { return NULL; }
+};
+
+struct FileBackend {
+  static const bool persistent = true;
+  static TagStore* create() {
+    hostFS.format();
+    return reopen();
+  }
+  static TagStore* reopen() { return new TagStoreHostFS(hostFS); }
+};
+
+struct NvsBackend {
+  static const bool persistent = true;
+  static TagStore* create() {
+    nativeNVS().clear();
+    return reopen();
+  }
+  static TagStore* reopen() { return new TagStoreNVS(); }
+};
+
+/** UID de teste n (7 bytes, formato do Reader) */
+static String uid(uint32_t n) {
+  char buf[15];
+  snprintf(buf, sizeof(buf), "04%08lX80", (unsigned long)n);
+  return String(buf);
+}
+
+template <typename Backend>
+static TagStore* open() {
+  TagStore* store = Backend::create();
+  TEST_ASSERT_TRUE(store->begin());
+  return store;
+}
+
+template <typename Backend>
+static TagStore* reboot(TagStore* store) {
+  store->flush();
+  delete store;
+  store = Backend::reopen();
+  TEST_ASSERT_TRUE(store->begin());
+  return store;
+}
+
+// ---------------------------
+// Suíte comum
+// ---------------------------
+
+template <typename Backend>
+static void checkInsertContains() {
+  TagStore* store = open<Backend>();
+  TEST_ASSERT_EQUAL_UINT32(0, store->count());
+  TEST_ASSERT_FALSE(store->contains(uid(1)));
+
+  TEST_ASSERT_TRUE(store->recordVisit(uid(1)));
+  TEST_ASSERT_TRUE(store->recordVisit(uid(2)));
+  TEST_ASSERT_FALSE(store->recordVisit(uid(1)));   // já conhecida: só toque
+  TEST_ASSERT_EQUAL_UINT32(2, store->count());
+  TEST_ASSERT_TRUE(store->contains(uid(1)));
+  TEST_ASSERT_TRUE(store->contains(uid(2)));
+  TEST_ASSERT_FALSE(store->contains(uid(3)));
+
+  // UID inválido: nem grava nem conta
+  TEST_ASSERT_FALSE(store->recordVisit("XYZ"));
+  TEST_ASSERT_FALSE(store->recordVisit("0102030405060708090A0B"));
+  TEST_ASSERT_EQUAL_UINT32(2, store->count());
+
+  TagRecord record;
+  TEST_ASSERT_TRUE(store->lookup(uid(1), record));
+  TEST_ASSERT_EQUAL_UINT16(2, record.taps);
+  TEST_ASSERT_EQUAL_STRING(uid(1).c_str(), record.uidHex().c_str());
+  delete store;
+}
+
+template <typename Backend>
+static void checkIterateSnapshot() {
+  TagStore* store = open<Backend>();
+  const uint32_t total = TAG_STORE_BLOCK_RECORDS * 3 + 5;   // vários blocos
+  for (uint32_t i = 0; i < total; i++) store->recordVisit(uid(i));
+  store->recordVisit(uid(7));
+
+  // Ordem de inserção, com o toque ainda só no cache
+  uint32_t seen = 0;
+  store->iterate([&](uint32_t index, const TagRecord& record) {
+    TEST_ASSERT_EQUAL_UINT32(seen, index);
+    TEST_ASSERT_EQUAL_STRING(uid(index).c_str(), record.uidHex().c_str());
+    TEST_ASSERT_EQUAL_UINT16(index == 7 ? 2 : 1, record.taps);
+    seen++;
+    return true;
+  });
+  TEST_ASSERT_EQUAL_UINT32(total, seen);
+
+  // Visitante interrompe
+  seen = 0;
+  store->iterate([&](uint32_t, const TagRecord&) { return ++seen < 3; });
+  TEST_ASSERT_EQUAL_UINT32(3, seen);
+
+  std::vector<TagRecord> records;
+  TEST_ASSERT_EQUAL_UINT32(total, store->snapshot(records));
+  TEST_ASSERT_EQUAL_UINT32(total - 20, store->snapshot(records, 20));
+  TEST_ASSERT_EQUAL_STRING(uid(20).c_str(), records[0].uidHex().c_str());
+  TEST_ASSERT_EQUAL_UINT32(0, store->snapshot(records, total));
+  delete store;
+}
+
+template <typename Backend>
+static void checkClearEpoch() {
+  TagStore* store = open<Backend>();
+  for (uint32_t i = 0; i < 40; i++) store->recordVisit(uid(i));
+  uint32_t generation = store->generation();
+  uint32_t writes = store->stats().flashWrites;
+
+  store->clear();
+  // Reset = uma escrita (época + contador zerado)
+  TEST_ASSERT_EQUAL_UINT32(writes + (Backend::persistent ? 1 : 0), store->stats().flashWrites);
+  TEST_ASSERT_EQUAL_UINT32(0, store->count());
+  TEST_ASSERT_EQUAL_UINT32(generation + 1, store->generation());
+  TEST_ASSERT_FALSE(store->contains(uid(0)));
+  TEST_ASSERT_EQUAL_UINT32(40, store->staleSlots());
+
+  // Tags novas ocupam os slots antigos; as antigas continuam esquecidas
+  TEST_ASSERT_TRUE(store->recordVisit(uid(100)));
+  TEST_ASSERT_TRUE(store->recordVisit(uid(0)));
+  TEST_ASSERT_EQUAL_UINT32(2, store->count());
+  TEST_ASSERT_FALSE(store->contains(uid(1)));
+  std::vector<TagRecord> records;
+  store->snapshot(records);
+  TEST_ASSERT_EQUAL_UINT32(2, records.size());
+  TEST_ASSERT_EQUAL_UINT16(1, records[1].taps);
+
+  // Compactação recupera os slots restantes
+  for (int i = 0; i < 10 && store->staleSlots() > 0; i++) store->maintain();
+  TEST_ASSERT_EQUAL_UINT32(0, store->staleSlots());
+  TEST_ASSERT_EQUAL_UINT32(2, store->count());
+  TEST_ASSERT_TRUE(store->contains(uid(100)));
+  delete store;
+}
+
+template <typename Backend>
+static void checkReopenAfterClear() {
+  if (!Backend::persistent) {
+    TEST_IGNORE_MESSAGE("backend sem persistência");
+  }
+  TagStore* store = open<Backend>();
+  for (uint32_t i = 0; i < 30; i++) store->recordVisit(uid(i));
+  store->recordVisit(uid(3));
+  store = reboot<Backend>(store);
+  TEST_ASSERT_EQUAL_UINT32(30, store->count());
+  TagRecord record;
+  TEST_ASSERT_TRUE(store->lookup(uid(3), record));
+  TEST_ASSERT_EQUAL_UINT16(2, record.taps);
+
+  // Reset seguido de reboot sem flush(): só as tags da época nova voltam
+  store->clear();
+  store->recordVisit(uid(200));
+  store->recordVisit(uid(201));
+  delete store;
+  store = Backend::reopen();
+  TEST_ASSERT_TRUE(store->begin());
+  TEST_ASSERT_EQUAL_UINT32(2, store->count());
+  TEST_ASSERT_TRUE(store->contains(uid(201)));
+  TEST_ASSERT_FALSE(store->contains(uid(0)));
+  TEST_ASSERT_EQUAL_UINT32(28, store->staleSlots());
+
+  // Relógio monotônico entre reboots (contador persistido ainda zerado)
+  TEST_ASSERT_TRUE(store->now() > record.lastSeen);
+  TEST_ASSERT_TRUE(store->lookup(uid(201), record));
+  TEST_ASSERT_TRUE(store->now() > record.lastSeen);
+
+  // Reset sem nenhuma tag nova
+  store->clear();
+  store = reboot<Backend>(store);
+  TEST_ASSERT_EQUAL_UINT32(0, store->count());
+  TEST_ASSERT_FALSE(store->contains(uid(200)));
+  TEST_ASSERT_TRUE(store->recordVisit(uid(200)));
+  delete store;
+}
+
+/**
+ * O registro guarda só o byte baixo da época: depois de 256 resets sem
+ * compactação, slots antigos não podem voltar no begin()
+ */
+template <typename Backend>
+static void checkEpochWrap() {
+  if (!Backend::persistent) {
+    TEST_IGNORE_MESSAGE("backend sem persistência");
+  }
+  TagStore* store = open<Backend>();
+  for (uint32_t i = 0; i < 20; i++) store->recordVisit(uid(i));
+  for (int i = 0; i < 256; i++) store->clear();   // sem maintain()
+  TEST_ASSERT_EQUAL_UINT32(0, store->staleSlots());
+  store->recordVisit(uid(300));
+
+  store = reboot<Backend>(store);
+  TEST_ASSERT_EQUAL_UINT32(1, store->count());
+  TEST_ASSERT_TRUE(store->contains(uid(300)));
+  TEST_ASSERT_FALSE(store->contains(uid(5)));
+  TEST_ASSERT_EQUAL_UINT32(0, store->staleSlots());
+  delete store;
+}
+
+/**
+ * Inserções, consultas e releituras de BENCH_TAGS tags
+ */
+template <typename Backend>
+static void benchmark() {
+  TagStore* store = open<Backend>();
+  store->resetStats();
+  for (uint32_t i = 0; i < BENCH_TAGS; i++) store->recordVisit(uid(i));
+  for (uint32_t i = 0; i < BENCH_TAGS; i++) TEST_ASSERT_TRUE(store->contains(uid(i)));
+  for (uint32_t i = 0; i < BENCH_TAGS; i += 4) store->recordVisit(uid(i));
+  store->flush();
+
+  const TagStoreStats& stats = store->stats();
+  TEST_ASSERT_EQUAL_UINT32(BENCH_TAGS, stats.inserts);
+  store->printStats();
+
+  char line[160];
+  snprintf(line, sizeof(line), "%s: insert %.0f ops/s, lookup %.0f ops/s, flashWrites/inserts %.2f",
+           store->name(),
+           stats.insertMicros ? stats.inserts * 1e6 / stats.insertMicros : 0.0,
+           stats.lookupMicros ? stats.lookups * 1e6 / stats.lookupMicros : 0.0,
+           (double)stats.flashWrites / stats.inserts);
+  TEST_MESSAGE(line);
+  delete store;
+}
+
+// ---------------------------
+// Casos por backend
+// ---------------------------
+
+void test_ram_insert_contains() { checkInsertContains<RamBackend>(); }
+void test_ram_iterate_snapshot() { checkIterateSnapshot<RamBackend>(); }
+void test_ram_clear_epoch() { checkClearEpoch<RamBackend>(); }
+void test_ram_reopen_after_clear() { checkReopenAfterClear<RamBackend>(); }
+void test_ram_epoch_wrap() { checkEpochWrap<RamBackend>(); }
+void test_ram_benchmark() { benchmark<RamBackend>(); }
+
+void test_nvs_insert_contains() { checkInsertContains<NvsBackend>(); }
+void test_nvs_iterate_snapshot() { checkIterateSnapshot<NvsBackend>(); }
+void test_nvs_clear_epoch() { checkClearEpoch<NvsBackend>(); }
+void test_nvs_reopen_after_clear() { checkReopenAfterClear<NvsBackend>(); }
+void test_nvs_epoch_wrap() { checkEpochWrap<NvsBackend>(); }
+void test_nvs_benchmark() { benchmark<NvsBackend>(); }
+
+void test_file_insert_contains() { checkInsertContains<FileBackend>(); }
+void test_file_iterate_snapshot() { checkIterateSnapshot<FileBackend>(); }
+void test_file_clear_epoch() { checkClearEpoch<FileBackend>(); }
+void test_file_reopen_after_clear() { checkReopenAfterClear<FileBackend>(); }
+void test_file_epoch_wrap() { checkEpochWrap<FileBackend>(); }
+void test_file_benchmark() { benchmark<FileBackend>(); }
+
+/**
+ * clear() no arquivo: só o cabeçalho de 16 bytes é regravado
+ */
+void test_file_clear_is_one_header_write() {
+  TagStore* store = open<FileBackend>();
+  for (uint32_t i = 0; i < 10; i++) store->recordVisit(uid(i));
+  store->flush();
+
+  fs::FSCounters before = hostFS.counters;
+  store->clear();
+  TEST_ASSERT_EQUAL_UINT32(before.writes + 1, hostFS.counters.writes);
+  TEST_ASSERT_EQUAL_UINT32(before.bytesWritten + 16, hostFS.counters.bytesWritten);
+  delete store;
+}
+
+/**
+ * clear() na NVS: só a chave "state" (época + contador zerado) é gravada
+ */
+void test_nvs_clear_is_one_key_write() {
+  TagStore* store = open<NvsBackend>();
+  for (uint32_t i = 0; i < 20; i++) store->recordVisit(uid(i));
+  store->flush();
+
+  uint32_t before = nativeNVSWrites();
+  store->clear();
+  TEST_ASSERT_EQUAL_UINT32(before + 1, nativeNVSWrites());
+  TEST_ASSERT_EQUAL_UINT32(3, nativeNVS()["rfid_tags"].size());   // state, p0, p1 intactas
+  delete store;
+}
+
+/**
+ * Formato mais antigo da NVS (count + tag_<i> em texto): importado e
+ * removido no begin()
+ */
+void test_nvs_migrates_legacy_strings() {
+  nativeNVS().clear();
+  Preferences prefs;
+  prefs.begin("rfid_tags");
+  prefs.putInt("count", 3);
+  prefs.putString("tag_0", "0431430F320289");
+  prefs.putString("tag_1", "04A1B2C3D4E5F6");
+  prefs.putString("tag_2", "0431430F320289");
+  prefs.end();
+
+  TagStore* store = new TagStoreNVS();
+  TEST_ASSERT_TRUE(store->begin());
+  TEST_ASSERT_EQUAL_UINT32(2, store->count());
+  TEST_ASSERT_TRUE(store->contains("04A1B2C3D4E5F6"));
+  prefs.begin("rfid_tags");
+  TEST_ASSERT_FALSE(prefs.isKey("count"));
+  TEST_ASSERT_FALSE(prefs.isKey("tag_0"));
+  prefs.end();
+
+  store = reboot<NvsBackend>(store);
+  TEST_ASSERT_EQUAL_UINT32(2, store->count());
+  delete store;
+}
+
+/**
+ * rcount/epoch em chaves separadas (versão anterior): viram "state" sem
+ * perder as tags da época atual
+ */
+void test_nvs_migrates_count_epoch_keys() {
+  TagStore* store = open<NvsBackend>();
+  store->recordVisit(uid(1));
+  for (int i = 0; i < 3; i++) store->clear();
+  for (uint32_t i = 10; i < 15; i++) store->recordVisit(uid(i));
+  store->flush();
+  delete store;
+
+  Preferences prefs;
+  prefs.begin("rfid_tags");
+  prefs.remove("state");
+  prefs.putUInt("rcount", 5);
+  prefs.putUChar("epoch", 3);
+  prefs.end();
+
+  store = NvsBackend::reopen();
+  TEST_ASSERT_TRUE(store->begin());
+  TEST_ASSERT_EQUAL_UINT32(5, store->count());
+  TEST_ASSERT_TRUE(store->contains(uid(14)));
+  TEST_ASSERT_FALSE(store->contains(uid(1)));
+  prefs.begin("rfid_tags");
+  TEST_ASSERT_TRUE(prefs.isKey("state"));
+  TEST_ASSERT_FALSE(prefs.isKey("rcount"));
+  TEST_ASSERT_FALSE(prefs.isKey("epoch"));
+  prefs.end();
+  delete store;
+}
+
+/**
+ * /tags.txt do formato antigo é importado e removido no begin()
+ */
+void test_file_migrates_legacy_text() {
+  hostFS.format();
+  File legacy = hostFS.open("/tags.txt", "w");
+  const char* text = "# tags\n0431430F320289\n\n04A1B2C3D4E5F6\r\n0431430F320289\n";
+  legacy.write((const uint8_t*)text, strlen(text));
+  legacy.close();
+
+  TagStoreHostFS store(hostFS);
+  TEST_ASSERT_TRUE(store.begin());
+  TEST_ASSERT_EQUAL_UINT32(2, store.count());
+  TEST_ASSERT_TRUE(store.contains("04A1B2C3D4E5F6"));
+  TEST_ASSERT_FALSE(hostFS.exists("/tags.txt"));
+}
+
+/**
+ * Sistema de arquivos que não monta: begin() falha e o display segue sem
+ * armazenamento (nenhuma tag lembrada, nada gravado, sem travar)
+ */
+class TagStoreNoFS : public TagStoreHostFS {
+public:
+  explicit TagStoreNoFS(fs::FS& filesystem) : TagStoreHostFS(filesystem) {}
+
+protected:
+  bool mountFS() override { return false; }
+};
+
+void test_unmounted_store_runs_without_storage() {
+  hostFS.format();
+  TagStoreNoFS store(hostFS);
+  TEST_ASSERT_FALSE(store.begin());
+
+  fs::FSCounters before = hostFS.counters;
+  TagRecord record;
+  TEST_ASSERT_FALSE(store.recordVisit(uid(1), &record));
+  TEST_ASSERT_EQUAL_STRING(uid(1).c_str(), record.uidHex().c_str());
+  TEST_ASSERT_FALSE(store.recordVisit(uid(1)));
+  TEST_ASSERT_FALSE(store.contains(uid(1)));
+  TEST_ASSERT_FALSE(store.lookup(uid(1), record));
+  record.taps = 1;
+  TEST_ASSERT_FALSE(store.merge(record));
+  TEST_ASSERT_EQUAL_UINT32(0, store.count());
+
+  store.clear();
+  store.flush();
+  store.maintain();
+  std::vector<TagRecord> records;
+  TEST_ASSERT_EQUAL_UINT32(0, store.snapshot(records));
+  TEST_ASSERT_EQUAL_UINT32(before.writes, hostFS.counters.writes);
+  TEST_ASSERT_FALSE(hostFS.exists("/tags.bin"));
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ram_insert_contains);
+  RUN_TEST(test_ram_iterate_snapshot);
+  RUN_TEST(test_ram_clear_epoch);
+  RUN_TEST(test_ram_reopen_after_clear);
+  RUN_TEST(test_ram_epoch_wrap);
+  RUN_TEST(test_ram_benchmark);
+  RUN_TEST(test_nvs_insert_contains);
+  RUN_TEST(test_nvs_iterate_snapshot);
+  RUN_TEST(test_nvs_clear_epoch);
+  RUN_TEST(test_nvs_reopen_after_clear);
+  RUN_TEST(test_nvs_epoch_wrap);
+  RUN_TEST(test_nvs_clear_is_one_key_write);
+  RUN_TEST(test_nvs_migrates_legacy_strings);
+  RUN_TEST(test_nvs_migrates_count_epoch_keys);
+  RUN_TEST(test_nvs_benchmark);
+  RUN_TEST(test_file_insert_contains);
+  RUN_TEST(test_file_iterate_snapshot);
+  RUN_TEST(test_file_clear_epoch);
+  RUN_TEST(test_file_reopen_after_clear);
+  RUN_TEST(test_file_epoch_wrap);
+  RUN_TEST(test_file_clear_is_one_header_write);
+  RUN_TEST(test_file_migrates_legacy_text);
+  RUN_TEST(test_file_benchmark);
+  RUN_TEST(test_unmounted_store_runs_without_storage);
+  return UNITY_END();
+}
@@ -0,0 +1,208 @@
+/**
+ * Exportação/importação do TagSync contra um host simulado
+ * (pio test -e native)
+ *
+ * LoopbackPort faz o papel da serial: o teste escreve o que o host
+ * mandaria e lê o que o display enviou. O host responde como o
+ * scripts/tag_sync.py (ACK|<proximo> / NAK|<proximo>).
+ */
+
+#include <unity.h>
+#include <deque>
+#include <vector>
+#include "TagStoreRAM.h"
+#include "TagSync.h"
+
+class LoopbackPort : public Stream {
+public:
+  std::deque<uint8_t> toDisplay;
+  std::vector<uint8_t> fromDisplay;
+  uint32_t writes = 0;
+
+  int available() override { return toDisplay.size(); }
+
+  int read() override {
+    if (toDisplay.empty()) return -1;
+    uint8_t b = toDisplay.front();
+    toDisplay.pop_front();
+    return b;
+  }
+
+  using Print::write;
+  size_t write(const uint8_t* buffer, size_t size) override {
+    writes++;
+    fromDisplay.insert(fromDisplay.end(), buffer, buffer + size);
+    return size;
+  }
+
+  void send(const char* text) { toDisplay.insert(toDisplay.end(), text, text + strlen(text)); }
+  void send(const std::vector<uint8_t>& bytes) { toDisplay.insert(toDisplay.end(), bytes.begin(), bytes.end()); }
+};
+
+/** Quadro recebido do display */
+struct Frame {
+  uint8_t type;
+  uint32_t index;
+  std::vector<TagRecord> records;
+};
+
+static uint32_t getU32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void putU32(std::vector<uint8_t>& out, uint32_t v) {
+  for (int i = 0; i < 4; i++) out.push_back(v >> (8 * i));
+}
+
+/** Tira um quadro inteiro do que o display enviou; false se não há */
+static bool takeFrame(LoopbackPort& port, Frame& frame) {
+  std::vector<uint8_t>& in = port.fromDisplay;
+  if (in.size() < SYNC_HEADER_SIZE) return false;
+  TEST_ASSERT_EQUAL_HEX8(SYNC_MAGIC_0, in[0]);
+  TEST_ASSERT_EQUAL_HEX8(SYNC_MAGIC_1, in[1]);
+  uint16_t n = in[7] | (in[8] << 8);
+  size_t size = SYNC_HEADER_SIZE + n * SYNC_RECORD_SIZE;
+  TEST_ASSERT_EQUAL_UINT32(size + 4, in.size());   // um quadro por write()
+  TEST_ASSERT_EQUAL_HEX32(esp_rom_crc32_le(0, in.data() + 2, size - 2), getU32(in.data() + size));
+
+  frame.type = in[2];
+  frame.index = getU32(in.data() + 3);
+  frame.records.resize(n);
+  if (n) memcpy(frame.records.data(), in.data() + SYNC_HEADER_SIZE, n * SYNC_RECORD_SIZE);
+  in.clear();
+  return true;
+}
+
+/** Monta um quadro do host (mesmo formato do tag_sync.py) */
+static std::vector<uint8_t> makeFrame(uint8_t type, uint32_t index, const TagRecord* records, uint16_t n) {
+  std::vector<uint8_t> out = { SYNC_MAGIC_0, SYNC_MAGIC_1, type };
+  putU32(out, index);
+  out.push_back(n);
+  out.push_back(n >> 8);
+  out.insert(out.end(), (const uint8_t*)records, (const uint8_t*)(records + n));
+  putU32(out, esp_rom_crc32_le(0, out.data() + 2, out.size() - 2));
+  return out;
+}
+
+static String takeLine(LoopbackPort& port) {
+  std::string text(port.fromDisplay.begin(), port.fromDisplay.end());
+  port.fromDisplay.clear();
+  return String(text);
+}
+
+/** UID de teste n (7 bytes, formato do Reader) */
+static String uid(uint32_t n) {
+  char buf[15];
+  snprintf(buf, sizeof(buf), "04%08lX80", (unsigned long)n);
+  return String(buf);
+}
+
+static TagStoreRAM store;
+static TagSync sync;
+static LoopbackPort port;
+
+void setUp() {
+  store.begin();
+  sync.begin(store);
+  port = LoopbackPort();
+}
+
+void tearDown() {}
+
+void test_export_all_records_with_acks() {
+  for (uint32_t i = 0; i < 40; i++) store.recordVisit(uid(i));
+  TEST_ASSERT_TRUE(sync.handleCommand("CMD|EXPORT|0", port));
+
+  std::vector<TagRecord> received;
+  Frame frame;
+  bool ended = false;
+  for (int step = 0; step < 20 && sync.active(port); step++) {
+    sync.poll();
+    if (!takeFrame(port, frame)) continue;
+    TEST_ASSERT_EQUAL_UINT32(received.size(), frame.index);
+    received.insert(received.end(), frame.records.begin(), frame.records.end());
+    ended = frame.type == SYNC_END;
+    char ack[24];
+    snprintf(ack, sizeof(ack), "ACK|%lu\n", (unsigned long)received.size());
+    port.send(ack);
+  }
+  TEST_ASSERT_TRUE(ended);
+  TEST_ASSERT_FALSE(sync.active(port));
+  TEST_ASSERT_EQUAL_UINT32(40, received.size());
+  TEST_ASSERT_EQUAL_STRING(uid(39).c_str(), received[39].uidHex().c_str());
+}
+
+/**
+ * Host que rejeita sempre o mesmo quadro (CRC que nunca confere):
+ * a exportação desiste depois de SYNC_MAX_RETRIES reenvios
+ */
+void test_export_gives_up_on_repeated_naks() {
+  for (uint32_t i = 0; i < 40; i++) store.recordVisit(uid(i));
+  TEST_ASSERT_TRUE(sync.handleCommand("CMD|EXPORT|0", port));
+
+  // Primeiro quadro aceito: o avanço zera as tentativas
+  sync.poll();
+  Frame frame;
+  TEST_ASSERT_TRUE(takeFrame(port, frame));
+  port.send("ACK|16\n");
+
+  int sent = 0;
+  for (int step = 0; step < 100 && sync.active(port); step++) {
+    sync.poll();
+    if (!takeFrame(port, frame)) continue;
+    TEST_ASSERT_EQUAL_UINT32(16, frame.index);
+    sent++;
+    port.send("NAK|16\n");
+  }
+  TEST_ASSERT_FALSE(sync.active(port));
+  TEST_ASSERT_EQUAL_INT(SYNC_MAX_RETRIES + 1, sent);
+}
+
+/**
+ * Importação: quadro corrompido recebe NAK e o reenvio é mesclado uma
+ * vez; quadro repetido depois do ACK não soma toques de novo
+ */
+void test_import_naks_corrupt_frame_and_merges_once() {
+  TagRecord records[20] = {};
+  for (uint32_t i = 0; i < 20; i++) {
+    records[i].setUID(uid(100 + i));
+    records[i].touch(10 + i);
+  }
+  TEST_ASSERT_TRUE(sync.handleCommand("CMD|IMPORT|20|7", port));
+  TEST_ASSERT_EQUAL_STRING("ACK|0\n", takeLine(port).c_str());
+
+  std::vector<uint8_t> first = makeFrame(SYNC_CHUNK, 0, records, 16);
+  std::vector<uint8_t> corrupt = first;
+  corrupt[SYNC_HEADER_SIZE + 3] ^= 0xFF;
+  port.send(corrupt);
+  sync.poll();
+  TEST_ASSERT_EQUAL_STRING("NAK|0\n", takeLine(port).c_str());
+
+  port.send(first);
+  sync.poll();
+  TEST_ASSERT_EQUAL_STRING("ACK|16\n", takeLine(port).c_str());
+  port.send(first);   // ACK perdido: host reenvia
+  sync.poll();
+  TEST_ASSERT_EQUAL_STRING("ACK|16\n", takeLine(port).c_str());
+
+  port.send(makeFrame(SYNC_CHUNK, 16, records + 16, 4));
+  sync.poll();
+  TEST_ASSERT_EQUAL_STRING("ACK|20\n", takeLine(port).c_str());
+  port.send(makeFrame(SYNC_END, 20, NULL, 0));
+  sync.poll();
+  TEST_ASSERT_EQUAL_STRING("ACK|END|20|0\n", takeLine(port).c_str());
+  TEST_ASSERT_FALSE(sync.active(port));
+
+  TagRecord stored;
+  TEST_ASSERT_TRUE(store.lookup(uid(100), stored));
+  TEST_ASSERT_EQUAL_UINT16(1, stored.taps);
+  TEST_ASSERT_EQUAL_UINT32(20, store.count());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_export_all_records_with_acks);
+  RUN_TEST(test_export_gives_up_on_repeated_naks);
+  RUN_TEST(test_import_naks_corrupt_frame_and_merges_once);
+  return UNITY_END();
+}